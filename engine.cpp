@@ -0,0 +1,666 @@
+/*
+Creation: 1200,20190410
+Name(s):  Grant Mulholland
+Email(s): grantlmul@gmail.com
+*/
+#include "engine.h"
+#include "number.h"
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+#include <glib.h>
+
+using namespace std;
+
+/* Larger results take too long to compute or to show */
+static const size_t MAX_DIGITS = 100000;
+static const int MAX_NESTING = 1000;
+/* Chunks of sums and products end after a term whose hash is 0 modulo
+   this, so they average this many terms */
+static const uint64_t CHUNK_MODULUS = 4;
+static const size_t MAX_CHUNK = 16;
+
+struct Engine::Shared
+{
+    atomic<unsigned long> latest;
+    atomic<bool> alive;
+    Callback callback;
+    GMainContext *context;
+};
+
+struct Cancelled
+{
+};
+
+struct ParseError
+{
+    const char *message;
+};
+
+enum Op
+{
+    LITERAL,
+    ADD,
+    MUL,
+    NEG,
+    INV,
+    POW
+};
+
+struct Value
+{
+    bool ok;
+    Rational number;
+    string error;
+};
+
+struct Node
+{
+    Op op;
+    int a, b;
+    string text; /* for literals */
+    bool evaluated;
+    Value value;
+};
+
+struct NodeKey
+{
+    Op op;
+    int a, b;
+
+    bool operator==(const NodeKey &other) const
+    {
+        return op == other.op && a == other.a && b == other.b;
+    }
+};
+
+static uint64_t mix(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+struct NodeKeyHash
+{
+    size_t operator()(const NodeKey &key) const
+    {
+        return mix(((uint64_t) key.op << 58) ^ ((uint64_t) (uint32_t) key.a << 29) ^ (uint32_t) key.b);
+    }
+};
+
+class Evaluator
+{
+public:
+    explicit Evaluator(const atomic<unsigned long> &latest) : latest(latest) {}
+
+    Result evaluate(const string &text, unsigned long generation, int digits);
+    /* Throws Cancelled if a newer expression was set */
+    void check_cancelled() const;
+
+private:
+    const atomic<unsigned long> &latest;
+    unsigned long generation;
+
+    vector<Node> nodes;
+    unordered_map<string, int> literals;
+    unordered_map<NodeKey, int, NodeKeyHash> operations;
+
+    /* Parser state */
+    const string *input;
+    size_t pos;
+    int nesting;
+
+    int intern_literal(const string &text);
+    int intern(Op op, int a, int b);
+    int negate(int node);
+    int invert(int node);
+    int chunk(Op op, vector<int> &terms);
+
+    void skip_space();
+    bool accept(const char *token);
+    int parse_sum();
+    int parse_product();
+    int parse_unary();
+    int parse_power();
+    int parse_primary();
+
+    const Value &eval(int node);
+    void compute(Node &node);
+    void compact(int &root);
+};
+
+int Evaluator::intern_literal(const string &text)
+{
+    unordered_map<string, int>::iterator it = literals.find(text);
+    if (it != literals.end())
+        return it->second;
+
+    Node node;
+    node.op = LITERAL;
+    node.a = node.b = -1;
+    node.text = text;
+    node.evaluated = false;
+    nodes.push_back(node);
+    literals[text] = nodes.size() - 1;
+    return nodes.size() - 1;
+}
+
+int Evaluator::intern(Op op, int a, int b)
+{
+    NodeKey key = { op, a, b };
+    unordered_map<NodeKey, int, NodeKeyHash>::iterator it = operations.find(key);
+    if (it != operations.end())
+        return it->second;
+
+    Node node;
+    node.op = op;
+    node.a = a;
+    node.b = b;
+    node.evaluated = false;
+    nodes.push_back(node);
+    operations[key] = nodes.size() - 1;
+    return nodes.size() - 1;
+}
+
+/* Signs and reciprocals of numbers are folded into the numbers, so
+   that "a - 5" and "a + -5" share their nodes */
+int Evaluator::negate(int node)
+{
+    if (nodes[node].op == LITERAL)
+        return intern_literal("-" + nodes[node].text);
+    if (nodes[node].op == NEG)
+        return nodes[node].a;
+    return intern(NEG, node, -1);
+}
+
+int Evaluator::invert(int node)
+{
+    if (nodes[node].op == LITERAL)
+        return intern_literal("1/" + nodes[node].text);
+    return intern(INV, node, -1);
+}
+
+/*
+Builds a tree over the terms of a sum or product. Rather than always
+pairing neighbours, which would regroup every term after an inserted
+one, chunks end at terms chosen by hashing the terms themselves. An
+edit then only changes the chunks around it, and the chunks above
+those, and everything else is found in the table with its value.
+*/
+int Evaluator::chunk(Op op, vector<int> &terms)
+{
+    for (uint64_t level = 1; terms.size() > 1; level++) {
+        vector<int> chunks;
+        int current = -1;
+        size_t length = 0;
+
+        for (size_t i = 0; i < terms.size(); i++) {
+            current = current < 0 ? terms[i] : intern(op, current, terms[i]);
+            length++;
+
+            /* Chunks of at least two terms, so that every level shrinks */
+            if (length >= 2 &&
+                (mix(terms[i] ^ (level * 0x9e3779b97f4a7c15ULL)) % CHUNK_MODULUS == 0 ||
+                 length == MAX_CHUNK)) {
+                chunks.push_back(current);
+                current = -1;
+                length = 0;
+            }
+        }
+        if (current >= 0)
+            chunks.push_back(current);
+
+        terms.swap(chunks);
+    }
+    return terms[0];
+}
+
+void Evaluator::skip_space()
+{
+    while (pos < input->size() && isspace((unsigned char) (*input)[pos]))
+        pos++;
+}
+
+bool Evaluator::accept(const char *token)
+{
+    size_t length = strlen(token);
+
+    skip_space();
+    if (input->compare(pos, length, token) != 0)
+        return false;
+    pos += length;
+    return true;
+}
+
+int Evaluator::parse_sum()
+{
+    vector<int> terms;
+
+    terms.push_back(parse_product());
+    for (;;) {
+        if (accept("+"))
+            terms.push_back(parse_product());
+        else if (accept("-") || accept("\xe2\x88\x92"))
+            terms.push_back(negate(parse_product()));
+        else
+            break;
+    }
+    return chunk(ADD, terms);
+}
+
+int Evaluator::parse_product()
+{
+    vector<int> factors;
+
+    factors.push_back(parse_unary());
+    for (;;) {
+        if (accept("*") || accept("\xc3\x97"))
+            factors.push_back(parse_unary());
+        else if (accept("/") || accept("\xc3\xb7"))
+            factors.push_back(invert(parse_unary()));
+        else
+            break;
+    }
+    return chunk(MUL, factors);
+}
+
+int Evaluator::parse_unary()
+{
+    if (++nesting > MAX_NESTING)
+        throw ParseError { "Expression is nested too deeply" };
+
+    int node;
+    if (accept("+"))
+        node = parse_unary();
+    else if (accept("-") || accept("\xe2\x88\x92"))
+        node = negate(parse_unary());
+    else
+        node = parse_power();
+
+    nesting--;
+    return node;
+}
+
+/* Right associative, and binds tighter than a sign on its left */
+int Evaluator::parse_power()
+{
+    int base = parse_primary();
+
+    if (accept("^"))
+        return intern(POW, base, parse_unary());
+    return base;
+}
+
+int Evaluator::parse_primary()
+{
+    skip_space();
+
+    if (accept("(")) {
+        int node = parse_sum();
+        if (!accept(")"))
+            throw ParseError { "Missing )" };
+        return node;
+    }
+
+    size_t start = pos;
+    while (pos < input->size() && (isdigit((unsigned char) (*input)[pos]) || (*input)[pos] == '.'))
+        pos++;
+    if (pos == start)
+        throw ParseError { pos == input->size() ? "Expression is incomplete" : "Syntax error" };
+
+    /* Only take an exponent if it has digits, so "2e" stays an error */
+    if (pos < input->size() && ((*input)[pos] == 'e' || (*input)[pos] == 'E')) {
+        size_t end = pos + 1;
+        if (end < input->size() && ((*input)[end] == '+' || (*input)[end] == '-'))
+            end++;
+        if (end < input->size() && isdigit((unsigned char) (*input)[end])) {
+            while (end < input->size() && isdigit((unsigned char) (*input)[end]))
+                end++;
+            pos = end;
+        }
+    }
+
+    return intern_literal(input->substr(start, pos - start));
+}
+
+static Value error_value(const char *message)
+{
+    Value value;
+
+    value.ok = false;
+    value.error = message;
+    return value;
+}
+
+static Value number_value(const Rational &number)
+{
+    Value value;
+
+    if (number.digits() > MAX_DIGITS)
+        return error_value("Result is too large");
+
+    value.ok = true;
+    value.number = number;
+    return value;
+}
+
+static Value literal_value(const string &text)
+{
+    if (text[0] == '-') {
+        Value value = literal_value(text.substr(1));
+        if (value.ok)
+            value.number = -value.number;
+        return value;
+    }
+    if (text.compare(0, 2, "1/") == 0) {
+        Value value = literal_value(text.substr(2));
+        if (!value.ok)
+            return value;
+        if (value.number.is_zero())
+            return error_value("Division by zero");
+        return number_value(value.number.reciprocal());
+    }
+
+    /* Refuse 1e999999999 before computing it */
+    size_t e = text.find_first_of("eE");
+    if (e != string::npos) {
+        long exponent = strtol(text.c_str() + e + 1, NULL, 10);
+        if ((size_t) labs(exponent) > MAX_DIGITS)
+            return error_value("Result is too large");
+    }
+
+    Rational number;
+    if (!Rational::parse(text, number))
+        return error_value("Syntax error");
+    return number_value(number);
+}
+
+void Evaluator::check_cancelled() const
+{
+    if (latest.load(memory_order_relaxed) != generation)
+        throw Cancelled();
+}
+
+const Value &Evaluator::eval(int index)
+{
+    if (nodes[index].evaluated)
+        return nodes[index].value;
+
+    check_cancelled();
+
+    if (nodes[index].a >= 0)
+        eval(nodes[index].a);
+    if (nodes[index].b >= 0)
+        eval(nodes[index].b);
+
+    compute(nodes[index]);
+    nodes[index].evaluated = true;
+    return nodes[index].value;
+}
+
+void Evaluator::compute(Node &node)
+{
+    if (node.op == LITERAL) {
+        node.value = literal_value(node.text);
+        return;
+    }
+
+    const Value &a = nodes[node.a].value;
+    if (!a.ok) {
+        node.value = a;
+        return;
+    }
+    if (node.op == NEG) {
+        node.value = number_value(-a.number);
+        return;
+    }
+    if (node.op == INV) {
+        node.value = a.number.is_zero() ? error_value("Division by zero")
+                                        : number_value(a.number.reciprocal());
+        return;
+    }
+
+    const Value &b = nodes[node.b].value;
+    if (!b.ok) {
+        node.value = b;
+        return;
+    }
+
+    long exponent;
+    switch (node.op) {
+    case ADD:
+        node.value = number_value(a.number + b.number);
+        break;
+    case MUL:
+        /* Checked before multiplying, as that is the slow part */
+        if (a.number.digits() + b.number.digits() > MAX_DIGITS)
+            node.value = error_value("Result is too large");
+        else
+            node.value = number_value(a.number * b.number);
+        break;
+    case POW:
+        if (!b.number.is_integer() || !b.number.numerator().to_long(exponent))
+            node.value = error_value("Exponent must be an integer");
+        else if (a.number.is_zero() && exponent < 0)
+            node.value = error_value("Division by zero");
+        else if (labs(exponent) * (a.number.numerator().log10() + a.number.denominator().log10()) > MAX_DIGITS)
+            node.value = error_value("Result is too large");
+        else
+            node.value = number_value(a.number.pow(exponent));
+        break;
+    default:
+        break;
+    }
+}
+
+/*
+The table only grows while typing, so once most of it is unreachable
+from the current expression, it is rebuilt from the nodes that are.
+*/
+void Evaluator::compact(int &root)
+{
+    vector<int> remap(nodes.size(), -1);
+    vector<int> order;
+    vector<int> stack(1, root);
+
+    /* Post-order, so that children are renumbered before their parents */
+    while (!stack.empty()) {
+        int index = stack.back();
+        if (remap[index] >= 0) {
+            stack.pop_back();
+            continue;
+        }
+
+        Node &node = nodes[index];
+        bool ready = true;
+        if (node.a >= 0 && remap[node.a] < 0) {
+            stack.push_back(node.a);
+            ready = false;
+        }
+        if (node.b >= 0 && remap[node.b] < 0) {
+            stack.push_back(node.b);
+            ready = false;
+        }
+        if (ready) {
+            remap[index] = order.size();
+            order.push_back(index);
+            stack.pop_back();
+        }
+    }
+
+    if (nodes.size() <= 2 * order.size() + 4096)
+        return;
+
+    vector<Node> kept;
+    kept.reserve(order.size());
+    literals.clear();
+    operations.clear();
+    for (size_t i = 0; i < order.size(); i++) {
+        Node node = nodes[order[i]];
+        if (node.a >= 0)
+            node.a = remap[node.a];
+        if (node.b >= 0)
+            node.b = remap[node.b];
+        if (node.op == LITERAL) {
+            literals[node.text] = i;
+        } else {
+            NodeKey key = { node.op, node.a, node.b };
+            operations[key] = i;
+        }
+        kept.push_back(node);
+    }
+    nodes.swap(kept);
+    root = remap[root];
+}
+
+Result Evaluator::evaluate(const string &text, unsigned long generation, int digits)
+{
+    Result result;
+    int root;
+
+    this->generation = generation;
+    result.generation = generation;
+    result.ok = false;
+    result.exact = false;
+
+    input = &text;
+    pos = 0;
+    nesting = 0;
+    skip_space();
+    if (pos == text.size())
+        return result;
+
+    try {
+        root = parse_sum();
+        skip_space();
+        if (pos != text.size())
+            throw ParseError { (text[pos] == ')') ? "Missing (" : "Syntax error" };
+    } catch (const ParseError &error) {
+        result.text = error.message;
+        return result;
+    }
+
+    const Value &value = eval(root);
+    if (value.ok) {
+        result.ok = true;
+        result.text = value.number.to_decimal(digits, result.exact);
+    } else {
+        result.text = value.error;
+    }
+
+    if (nodes.size() > 4096)
+        compact(root);
+    return result;
+}
+
+Engine::Engine(Callback callback, int digits)
+    : shared(new Shared), digits(digits), has_pending(false), quit(false)
+{
+    shared->latest = 0;
+    shared->alive = true;
+    shared->callback = callback;
+    shared->context = g_main_context_ref_thread_default();
+
+    evaluator.reset(new Evaluator(shared->latest));
+    worker = thread(&Engine::run, this);
+}
+
+Engine::~Engine()
+{
+    {
+        lock_guard<mutex> guard(lock);
+        quit = true;
+        /* Stops the evaluation that is running */
+        shared->latest++;
+    }
+    wake.notify_one();
+    worker.join();
+
+    shared->alive = false;
+    g_main_context_unref(shared->context);
+}
+
+unsigned long Engine::set_expression(const string &text)
+{
+    unsigned long generation;
+
+    {
+        lock_guard<mutex> guard(lock);
+        pending = text;
+        has_pending = true;
+        generation = ++shared->latest;
+    }
+    wake.notify_one();
+    return generation;
+}
+
+void Engine::run()
+{
+    /* A single division or gcd can take a while on its own */
+    set_interrupt_check([this] { evaluator->check_cancelled(); });
+
+    for (;;) {
+        string text;
+        unsigned long generation;
+
+        {
+            unique_lock<mutex> guard(lock);
+            wake.wait(guard, [this] { return quit || has_pending; });
+            if (quit)
+                return;
+            text.swap(pending);
+            has_pending = false;
+            generation = shared->latest;
+        }
+
+        try {
+            deliver(evaluator->evaluate(text, generation, digits));
+        } catch (const Cancelled &) {
+            /* A newer expression is pending */
+        }
+    }
+}
+
+struct Engine::Delivery
+{
+    shared_ptr<Shared> shared;
+    Result result;
+};
+
+int Engine::deliver_idle(void *data)
+{
+    Delivery *delivery = static_cast<Delivery *>(data);
+    Shared *shared = delivery->shared.get();
+
+    /* Drop results for expressions that were replaced meanwhile */
+    if (shared->alive && shared->latest == delivery->result.generation)
+        shared->callback(delivery->result);
+    return G_SOURCE_REMOVE;
+}
+
+static void delivery_free(gpointer data)
+{
+    delete static_cast<Engine::Delivery *>(data);
+}
+
+void Engine::deliver(const Result &result)
+{
+    Delivery *delivery = new Delivery;
+    GSource *source;
+
+    delivery->shared = shared;
+    delivery->result = result;
+
+    source = g_idle_source_new();
+    g_source_set_callback(source, deliver_idle, delivery, delivery_free);
+    g_source_attach(source, shared->context);
+    g_source_unref(source);
+}
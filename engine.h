@@ -0,0 +1,73 @@
+/*
+Creation: 1200,20190410
+Name(s):  Grant Mulholland
+Email(s): grantlmul@gmail.com
+*/
+#ifndef GTKALC_ENGINE_H
+#define GTKALC_ENGINE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+struct Result
+{
+    unsigned long generation;
+    bool ok;          /* otherwise text is the error, empty for an empty expression */
+    std::string text;
+    bool exact;       /* whether text is the exact value, not a rounded one */
+};
+
+class Evaluator;
+
+/*
+Evaluates expressions with + - * / ^ and parentheses exactly, on a
+worker thread.
+
+Every sub-expression is interned, so the same sub-expression is only
+ever represented once, and caches its value. Long sums and products
+are split into chunks at positions that depend only on their terms, so
+editing one term of an expression only re-evaluates the chunks that
+contain it and the few nodes above them.
+
+Results are delivered to the callback on the main context of the
+thread that created the engine, and only for the latest expression.
+*/
+class Engine
+{
+public:
+    typedef std::function<void (const Result &)> Callback;
+
+    Engine(Callback callback, int digits = 32);
+    ~Engine();
+
+    /* Returns the generation that the result will carry */
+    unsigned long set_expression(const std::string &text);
+
+    struct Delivery;
+
+private:
+    struct Shared;
+
+    std::shared_ptr<Shared> shared;
+    std::unique_ptr<Evaluator> evaluator;
+    int digits;
+
+    std::thread worker;
+    std::mutex lock;
+    std::condition_variable wake;
+    std::string pending;
+    bool has_pending;
+    bool quit;
+
+    void run();
+    void deliver(const Result &result);
+    /* A GSourceFunc */
+    static int deliver_idle(void *data);
+};
+
+#endif
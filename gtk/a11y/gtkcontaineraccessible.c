@@ -27,6 +27,11 @@
 struct _GtkContainerAccessiblePrivate
 {
   GList *children;
+
+  /* Children added while the widget was not mapped. They are
+   * announced in one go once it is.
+   */
+  GList *pending_children;
 };
 
 G_DEFINE_TYPE_WITH_PRIVATE (GtkContainerAccessible, gtk_container_accessible, GTK_TYPE_WIDGET_ACCESSIBLE)
@@ -56,7 +61,7 @@ static AtkObject *
 gtk_container_accessible_ref_child (AtkObject *obj,
                                     gint       i)
 {
-  GList *children, *tmp_list;
+  GList *tmp_list;
   AtkObject  *accessible;
   GtkWidget *widget;
 
@@ -64,16 +69,12 @@ gtk_container_accessible_ref_child (AtkObject *obj,
   if (widget == NULL)
     return NULL;
 
-  children = gtk_container_get_children (GTK_CONTAINER (widget));
-  tmp_list = g_list_nth (children, i);
+  /* The list is kept up to date by add_gtk and remove_gtk */
+  tmp_list = g_list_nth (GTK_CONTAINER_ACCESSIBLE (obj)->priv->children, i);
   if (!tmp_list)
-    {
-      g_list_free (children);
-      return NULL;
-    }
-  accessible = gtk_widget_get_accessible (GTK_WIDGET (tmp_list->data));
+    return NULL;
 
-  g_list_free (children);
+  accessible = gtk_widget_get_accessible (GTK_WIDGET (tmp_list->data));
   g_object_ref (accessible);
 
   return accessible;
@@ -125,14 +126,27 @@ gtk_container_accessible_real_add_gtk (GtkContainer *container,
   AtkObject *atk_parent;
   AtkObject *atk_child;
   GtkContainerAccessible *accessible;
+  GtkWidget *parent_widget;
   gint index;
 
   atk_parent = ATK_OBJECT (data);
-  atk_child = gtk_widget_get_accessible (widget);
   accessible = GTK_CONTAINER_ACCESSIBLE (atk_parent);
 
   g_list_free (accessible->priv->children);
   accessible->priv->children = gtk_container_get_children (container);
+
+  /* Nobody can see the child yet, so don't create its accessible
+   * until the AT asks for it or the parent gets mapped.
+   */
+  parent_widget = gtk_accessible_get_widget (GTK_ACCESSIBLE (atk_parent));
+  if (parent_widget != NULL && !gtk_widget_get_mapped (parent_widget))
+    {
+      if (!g_list_find (accessible->priv->pending_children, widget))
+        accessible->priv->pending_children = g_list_prepend (accessible->priv->pending_children, widget);
+      return 1;
+    }
+
+  atk_child = gtk_widget_get_accessible (widget);
   index = g_list_index (accessible->priv->children, widget);
   _gtk_container_accessible_add_child (accessible, atk_child, index);
 
@@ -147,13 +161,25 @@ gtk_container_accessible_real_remove_gtk (GtkContainer *container,
   AtkObject* atk_parent;
   AtkObject *atk_child;
   GtkContainerAccessible *accessible;
+  GList *pending;
   gint index;
 
   atk_parent = ATK_OBJECT (data);
+  accessible = GTK_CONTAINER_ACCESSIBLE (atk_parent);
+
+  /* The addition was never announced, so neither is the removal */
+  pending = g_list_find (accessible->priv->pending_children, widget);
+  if (pending)
+    {
+      accessible->priv->pending_children = g_list_delete_link (accessible->priv->pending_children, pending);
+      g_list_free (accessible->priv->children);
+      accessible->priv->children = gtk_container_get_children (container);
+      return 1;
+    }
+
   atk_child = _gtk_widget_peek_accessible (widget);
   if (atk_child == NULL)
     return 1;
-  accessible = GTK_CONTAINER_ACCESSIBLE (atk_parent);
 
   index = g_list_index (accessible->priv->children, widget);
   g_list_free (accessible->priv->children);
@@ -164,6 +190,34 @@ gtk_container_accessible_real_remove_gtk (GtkContainer *container,
   return 1;
 }
 
+static void
+map_cb (GtkWidget *widget)
+{
+  GtkContainerAccessible *accessible;
+  AtkObject *obj;
+  GList *pending, *l;
+  gint index;
+
+  obj = _gtk_widget_peek_accessible (widget);
+  if (!GTK_IS_CONTAINER_ACCESSIBLE (obj))
+    return;
+
+  accessible = GTK_CONTAINER_ACCESSIBLE (obj);
+  pending = g_list_reverse (accessible->priv->pending_children);
+  accessible->priv->pending_children = NULL;
+
+  for (l = pending; l; l = l->next)
+    {
+      index = g_list_index (accessible->priv->children, l->data);
+      if (index >= 0)
+        _gtk_container_accessible_add_child (accessible,
+                                             gtk_widget_get_accessible (l->data),
+                                             index);
+    }
+
+  g_list_free (pending);
+}
+
 static void
 gtk_container_accessible_real_initialize (AtkObject *obj,
                                           gpointer   data)
@@ -173,6 +227,7 @@ gtk_container_accessible_real_initialize (AtkObject *obj,
   ATK_OBJECT_CLASS (gtk_container_accessible_parent_class)->initialize (obj, data);
 
   accessible->priv->children = gtk_container_get_children (GTK_CONTAINER (data));
+  g_signal_connect (data, "map", G_CALLBACK (map_cb), NULL);
 
   obj->role = ATK_ROLE_PANEL;
 }
@@ -183,6 +238,7 @@ gtk_container_accessible_finalize (GObject *object)
   GtkContainerAccessible *accessible = GTK_CONTAINER_ACCESSIBLE (object);
 
   g_list_free (accessible->priv->children);
+  g_list_free (accessible->priv->pending_children);
 
   G_OBJECT_CLASS (gtk_container_accessible_parent_class)->finalize (object);
 }
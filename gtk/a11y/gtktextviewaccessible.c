@@ -33,10 +33,21 @@
 #include "gtktextviewprivate.h"
 #include "gtk/gtkwidgetprivate.h"
 
+/* Inserted text is announced at most this often, in milliseconds */
+#define MIN_FLUSH_INTERVAL 50
+
 struct _GtkTextViewAccessiblePrivate
 {
   gint insert_offset;
   gint selection_bound;
+
+  /* Inserted text that was not announced yet. Insertions next to it
+   * or inside of it are merged into it.
+   */
+  gint pending_offset;
+  gint pending_length;
+  guint flush_id;
+  gint64 last_flush_time;
 };
 
 static void       insert_text_cb        (GtkTextBuffer    *buffer,
@@ -56,6 +67,8 @@ static void       mark_set_cb           (GtkTextBuffer    *buffer,
                                                          GtkTextIter      *arg1,
                                                          GtkTextMark      *arg2,
                                                          gpointer         user_data);
+static void       gtk_text_view_accessible_flush_changes (GtkTextViewAccessible *accessible);
+static void       gtk_text_view_accessible_sync         (AtkText          *text);
 
 
 static void atk_editable_text_interface_init      (AtkEditableTextIface      *iface);
@@ -122,14 +135,25 @@ gtk_text_view_accessible_change_buffer (GtkTextViewAccessible *accessible,
                                         GtkTextBuffer         *old_buffer,
                                         GtkTextBuffer         *new_buffer)
 {
+  GtkTextViewAccessiblePrivate *priv = accessible->priv;
+
   if (old_buffer)
     {
       g_signal_handlers_disconnect_matched (old_buffer, G_SIGNAL_MATCH_DATA, 0, 0, NULL, NULL, accessible);
 
+      /* Text that was not announced does not need to be removed either */
+      if (priv->flush_id)
+        {
+          g_source_remove (priv->flush_id);
+          priv->flush_id = 0;
+        }
+
       g_signal_emit_by_name (accessible,
                              "text-changed::delete",
                              0,
-                             gtk_text_buffer_get_char_count (old_buffer));
+                             gtk_text_buffer_get_char_count (old_buffer) - priv->pending_length);
+
+      priv->pending_length = 0;
     }
 
   if (new_buffer)
@@ -162,13 +186,27 @@ gtk_text_view_accessible_widget_unset (GtkAccessible *accessible)
                                           NULL);
 }
 
+static void
+gtk_text_view_accessible_finalize (GObject *object)
+{
+  GtkTextViewAccessible *accessible = GTK_TEXT_VIEW_ACCESSIBLE (object);
+
+  if (accessible->priv->flush_id)
+    g_source_remove (accessible->priv->flush_id);
+
+  G_OBJECT_CLASS (gtk_text_view_accessible_parent_class)->finalize (object);
+}
+
 static void
 gtk_text_view_accessible_class_init (GtkTextViewAccessibleClass *klass)
 {
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
   AtkObjectClass  *class = ATK_OBJECT_CLASS (klass);
   GtkAccessibleClass *accessible_class = GTK_ACCESSIBLE_CLASS (klass);
   GtkWidgetAccessibleClass *widget_class = (GtkWidgetAccessibleClass*)klass;
 
+  gobject_class->finalize = gtk_text_view_accessible_finalize;
+
   accessible_class->widget_set = gtk_text_view_accessible_widget_set;
   accessible_class->widget_unset = gtk_text_view_accessible_widget_unset;
 
@@ -194,6 +232,8 @@ gtk_text_view_accessible_get_text (AtkText *text,
   GtkTextIter start, end;
   GtkWidget *widget;
 
+  gtk_text_view_accessible_sync (text);
+
   widget = gtk_accessible_get_widget (GTK_ACCESSIBLE (text));
   if (widget == NULL)
     return NULL;
@@ -219,6 +259,8 @@ gtk_text_view_accessible_get_text_after_offset (AtkText         *text,
   GtkTextIter pos;
   GtkTextIter start, end;
 
+  gtk_text_view_accessible_sync (text);
+
   widget = gtk_accessible_get_widget (GTK_ACCESSIBLE (text));
   if (widget == NULL)
     return NULL;
@@ -262,6 +304,8 @@ gtk_text_view_accessible_get_text_at_offset (AtkText         *text,
   GtkTextIter pos;
   GtkTextIter start, end;
 
+  gtk_text_view_accessible_sync (text);
+
   widget = gtk_accessible_get_widget (GTK_ACCESSIBLE (text));
   if (widget == NULL)
     return NULL;
@@ -307,6 +351,8 @@ gtk_text_view_accessible_get_text_before_offset (AtkText         *text,
   GtkTextIter pos;
   GtkTextIter start, end;
 
+  gtk_text_view_accessible_sync (text);
+
   widget = gtk_accessible_get_widget (GTK_ACCESSIBLE (text));
   if (widget == NULL)
     return NULL;
@@ -361,6 +407,8 @@ gtk_text_view_accessible_get_character_at_offset (AtkText *text,
   gchar *string;
   gunichar unichar;
 
+  gtk_text_view_accessible_sync (text);
+
   widget = gtk_accessible_get_widget (GTK_ACCESSIBLE (text));
   if (widget == NULL)
     return '\0';
@@ -385,6 +433,8 @@ gtk_text_view_accessible_get_character_count (AtkText *text)
   GtkWidget *widget;
   GtkTextBuffer *buffer;
 
+  gtk_text_view_accessible_sync (text);
+
   widget = gtk_accessible_get_widget (GTK_ACCESSIBLE (text));
   if (widget == NULL)
     return 0;
@@ -410,6 +460,8 @@ gtk_text_view_accessible_get_caret_offset (AtkText *text)
   GtkWidget *widget;
   GtkTextBuffer *buffer;
 
+  gtk_text_view_accessible_sync (text);
+
   widget = gtk_accessible_get_widget (GTK_ACCESSIBLE (text));
   if (widget == NULL)
     return 0;
@@ -1771,6 +1823,77 @@ gtk_text_view_accessible_update_cursor (GtkTextViewAccessible *accessible,
     g_signal_emit_by_name (accessible, "text-selection-changed");
 }
 
+static gboolean
+flush_changes_cb (gpointer data)
+{
+  GtkTextViewAccessible *accessible = data;
+
+  accessible->priv->flush_id = 0;
+  gtk_text_view_accessible_flush_changes (accessible);
+
+  return G_SOURCE_REMOVE;
+}
+
+/* Announces the pending inserted text and the cursor position. For
+ * every text-changed signal, the at-spi bridge reads the text and
+ * sends it to the accessibility bus, so this is done once per main
+ * loop iteration, and at most every MIN_FLUSH_INTERVAL milliseconds
+ * while the text keeps changing.
+ */
+static void
+gtk_text_view_accessible_flush_changes (GtkTextViewAccessible *accessible)
+{
+  GtkTextViewAccessiblePrivate *priv = accessible->priv;
+  GtkWidget *widget;
+  gint length;
+
+  if (priv->flush_id)
+    {
+      g_source_remove (priv->flush_id);
+      priv->flush_id = 0;
+    }
+
+  length = priv->pending_length;
+  priv->pending_length = 0;
+  priv->last_flush_time = g_get_monotonic_time ();
+
+  if (length > 0)
+    g_signal_emit_by_name (accessible, "text-changed::insert", priv->pending_offset, length);
+
+  widget = gtk_accessible_get_widget (GTK_ACCESSIBLE (accessible));
+  if (widget)
+    gtk_text_view_accessible_update_cursor (accessible, gtk_text_view_get_buffer (GTK_TEXT_VIEW (widget)));
+}
+
+static void
+gtk_text_view_accessible_queue_flush (GtkTextViewAccessible *accessible)
+{
+  GtkTextViewAccessiblePrivate *priv = accessible->priv;
+  gint64 elapsed;
+
+  if (priv->flush_id)
+    return;
+
+  elapsed = (g_get_monotonic_time () - priv->last_flush_time) / 1000;
+  if (elapsed >= MIN_FLUSH_INTERVAL)
+    priv->flush_id = g_idle_add (flush_changes_cb, accessible);
+  else
+    priv->flush_id = g_timeout_add (MIN_FLUSH_INTERVAL - elapsed, flush_changes_cb, accessible);
+  g_source_set_name_by_id (priv->flush_id, "[gtk] flush_changes_cb");
+}
+
+/* Assistive technologies reading the text must have been told about
+ * all of it first.
+ */
+static void
+gtk_text_view_accessible_sync (AtkText *text)
+{
+  GtkTextViewAccessible *accessible = GTK_TEXT_VIEW_ACCESSIBLE (text);
+
+  if (accessible->priv->pending_length > 0)
+    gtk_text_view_accessible_flush_changes (accessible);
+}
+
 static void
 insert_text_cb (GtkTextBuffer *buffer,
                 GtkTextIter   *iter,
@@ -1779,15 +1902,23 @@ insert_text_cb (GtkTextBuffer *buffer,
                 gpointer       data)
 {
   GtkTextViewAccessible *accessible = data;
+  GtkTextViewAccessiblePrivate *priv = accessible->priv;
   gint position;
   gint length;
 
-  position = gtk_text_iter_get_offset (iter);
   length = g_utf8_strlen (text, len);
- 
-  g_signal_emit_by_name (accessible, "text-changed::insert", position - length, length);
+  position = gtk_text_iter_get_offset (iter) - length;
+
+  if (priv->pending_length > 0 &&
+      (position < priv->pending_offset ||
+       position > priv->pending_offset + priv->pending_length))
+    gtk_text_view_accessible_flush_changes (accessible);
 
-  gtk_text_view_accessible_update_cursor (accessible, buffer);
+  if (priv->pending_length == 0)
+    priv->pending_offset = position;
+  priv->pending_length += length;
+
+  gtk_text_view_accessible_queue_flush (accessible);
 }
 
 static void
@@ -1797,10 +1928,31 @@ delete_range_cb (GtkTextBuffer *buffer,
                  gpointer       data)
 {
   GtkTextViewAccessible *accessible = data;
-  gint offset, length;
+  GtkTextViewAccessiblePrivate *priv = accessible->priv;
+  gint offset, end_offset, length;
 
   offset = gtk_text_iter_get_offset (start);
-  length = gtk_text_iter_get_offset (end) - offset;
+  end_offset = gtk_text_iter_get_offset (end);
+  length = end_offset - offset;
+
+  /* The bridge reads the removed text now, so the offsets must be
+   * valid both for the buffer and for what was announced. That is
+   * the case before the pending text, and text inside of it does
+   * not need to be announced at all.
+   */
+  if (priv->pending_length > 0)
+    {
+      if (offset >= priv->pending_offset &&
+          end_offset <= priv->pending_offset + priv->pending_length)
+        {
+          priv->pending_length -= length;
+          return;
+        }
+      else if (end_offset <= priv->pending_offset)
+        priv->pending_offset -= length;
+      else
+        gtk_text_view_accessible_flush_changes (accessible);
+    }
 
   g_signal_emit_by_name (accessible,
                          "text-changed::delete",
@@ -1816,7 +1968,9 @@ delete_range_after_cb (GtkTextBuffer *buffer,
 {
   GtkTextViewAccessible *accessible = data;
 
-  gtk_text_view_accessible_update_cursor (accessible, buffer);
+  /* Otherwise the cursor is updated with the pending text */
+  if (accessible->priv->flush_id == 0)
+    gtk_text_view_accessible_update_cursor (accessible, buffer);
 }
 
 static void
@@ -1831,13 +1985,10 @@ mark_set_cb (GtkTextBuffer *buffer,
    * Only generate the signal for the "insert" mark, which
    * represents the cursor.
    */
-  if (mark == gtk_text_buffer_get_insert (buffer))
-    {
-      gtk_text_view_accessible_update_cursor (accessible, buffer);
-    }
-  else if (mark == gtk_text_buffer_get_selection_bound (buffer))
+  if (mark == gtk_text_buffer_get_insert (buffer) ||
+      mark == gtk_text_buffer_get_selection_bound (buffer))
     {
-      gtk_text_view_accessible_update_cursor (accessible, buffer);
+      gtk_text_view_accessible_flush_changes (accessible);
     }
 }
 
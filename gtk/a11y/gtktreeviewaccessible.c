@@ -35,9 +35,16 @@
 #include "gtkcellaccessibleparent.h"
 #include "gtkcellaccessibleprivate.h"
 
+/* Cell accessibles are created on demand and are cheap to recreate,
+ * so only keep this many around. The focus row and the visible rows
+ * are never evicted.
+ */
+#define MAX_CELL_INFOS 1024
+
 struct _GtkTreeViewAccessiblePrivate
 {
   GHashTable *cell_infos;
+  GQueue cell_lru;
 };
 
 typedef struct _GtkTreeViewAccessibleCellInfo  GtkTreeViewAccessibleCellInfo;
@@ -48,6 +55,7 @@ struct _GtkTreeViewAccessibleCellInfo
   GtkTreeRBNode *node;
   GtkTreeViewColumn *cell_col_ref;
   GtkTreeViewAccessible *view;
+  GList *link;
 };
 
 /* Misc */
@@ -103,6 +111,8 @@ gtk_tree_view_accessible_get_data_quark (void)
 static void
 cell_info_free (GtkTreeViewAccessibleCellInfo *cell_info)
 {
+  g_queue_delete_link (&cell_info->view->priv->cell_lru, cell_info->link);
+
   gtk_accessible_set_widget (GTK_ACCESSIBLE (cell_info->cell), NULL);
   g_object_unref (cell_info->cell);
 
@@ -356,9 +366,88 @@ peek_cell (GtkTreeViewAccessible *accessible,
   if (cell_info == NULL)
     return NULL;
 
+  g_queue_unlink (&accessible->priv->cell_lru, cell_info->link);
+  g_queue_push_head_link (&accessible->priv->cell_lru, cell_info->link);
+
   return cell_info->cell;
 }
 
+static gboolean
+get_visible_row_range (GtkTreeView *treeview,
+                       int         *first,
+                       int         *last)
+{
+  GtkTreePath *start, *end;
+  GtkTreeRBTree *tree;
+  GtkTreeRBNode *node;
+  gboolean found = FALSE;
+
+  if (!gtk_tree_view_get_visible_range (treeview, &start, &end))
+    return FALSE;
+
+  if (_gtk_tree_view_find_node (treeview, start, &tree, &node) == FALSE && node)
+    {
+      *first = gtk_tree_rbtree_node_get_index (tree, node);
+      if (_gtk_tree_view_find_node (treeview, end, &tree, &node) == FALSE && node)
+        {
+          *last = gtk_tree_rbtree_node_get_index (tree, node);
+          found = TRUE;
+        }
+    }
+
+  gtk_tree_path_free (start);
+  gtk_tree_path_free (end);
+
+  return found;
+}
+
+/* Drops the least recently used cells that are neither in the cursor
+ * row nor visible, until there is room for a new one.
+ */
+static void
+trim_cell_infos (GtkTreeView           *treeview,
+                 GtkTreeViewAccessible *accessible)
+{
+  GtkTreeViewAccessiblePrivate *priv = accessible->priv;
+  GtkTreeViewAccessibleCellInfo *cell_info;
+  GtkTreeRBTree *cursor_tree;
+  GtkTreeRBNode *cursor_node;
+  int first, last, index;
+  gboolean has_range, keep;
+  guint n_kept;
+
+  if (priv->cell_lru.length < MAX_CELL_INFOS)
+    return;
+
+  if (!_gtk_tree_view_get_cursor_node (treeview, &cursor_tree, &cursor_node))
+    cursor_node = NULL;
+  has_range = get_visible_row_range (treeview, &first, &last);
+
+  n_kept = 0;
+  while (priv->cell_lru.length >= MAX_CELL_INFOS &&
+         n_kept < priv->cell_lru.length)
+    {
+      cell_info = g_queue_peek_tail (&priv->cell_lru);
+
+      keep = cell_info->node == cursor_node;
+      if (!keep && has_range)
+        {
+          index = gtk_tree_rbtree_node_get_index (cell_info->tree, cell_info->node);
+          keep = index >= first && index <= last;
+        }
+
+      if (keep)
+        {
+          GList *link = g_queue_pop_tail_link (&priv->cell_lru);
+          g_queue_push_head_link (&priv->cell_lru, link);
+          n_kept++;
+          continue;
+        }
+
+      g_hash_table_remove (priv->cell_infos, cell_info);
+    }
+}
+
 static GtkCellAccessible *
 create_cell_accessible_for_renderer (GtkCellRenderer *renderer,
                                      GtkWidget       *widget,
@@ -421,6 +510,8 @@ create_cell (GtkTreeView           *treeview,
 {
   GtkCellAccessible *cell;
 
+  trim_cell_infos (treeview, accessible);
+
   cell = create_cell_accessible (treeview, accessible, column);
   cell_info_new (accessible, tree, node, column, cell);
 
@@ -1545,6 +1636,9 @@ cell_info_new (GtkTreeViewAccessible *accessible,
   cell_info->cell_col_ref = tv_col;
   cell_info->cell = cell;
   cell_info->view = accessible;
+  cell_info->link = g_list_alloc ();
+  cell_info->link->data = cell_info;
+  g_queue_push_head_link (&accessible->priv->cell_lru, cell_info->link);
 
   g_object_set_qdata (G_OBJECT (cell), 
                       gtk_tree_view_accessible_get_data_quark (),
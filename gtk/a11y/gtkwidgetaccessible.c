@@ -27,8 +27,13 @@
 struct _GtkWidgetAccessiblePrivate
 {
   AtkLayer layer;
+
+  /* States that changed while the widget was not mapped */
+  guint64 pending_states;
 };
 
+G_STATIC_ASSERT (ATK_STATE_LAST_DEFINED <= 64);
+
 #define TOOLTIP_KEY "tooltip"
 
 extern GtkWidget *_focus_widget;
@@ -86,13 +91,52 @@ static gint
 map_cb (GtkWidget *widget)
 {
   AtkObject *accessible;
+  GtkWidgetAccessiblePrivate *priv;
+  gboolean mapped;
 
   accessible = gtk_widget_get_accessible (widget);
-  atk_object_notify_state_change (accessible, ATK_STATE_SHOWING,
-                                  gtk_widget_get_mapped (widget));
+  priv = GTK_WIDGET_ACCESSIBLE (accessible)->priv;
+  mapped = gtk_widget_get_mapped (widget);
+
+  if (mapped && priv->pending_states != 0)
+    {
+      AtkStateSet *state_set;
+      AtkState state;
+
+      state_set = atk_object_ref_state_set (accessible);
+      for (state = ATK_STATE_INVALID; state < ATK_STATE_LAST_DEFINED; state++)
+        {
+          if (priv->pending_states & (G_GUINT64_CONSTANT (1) << state))
+            atk_object_notify_state_change (accessible, state,
+                                            atk_state_set_contains_state (state_set, state));
+        }
+      g_object_unref (state_set);
+
+      priv->pending_states = 0;
+    }
+
+  atk_object_notify_state_change (accessible, ATK_STATE_SHOWING, mapped);
   return 1;
 }
 
+/* Hidden widgets are of no interest to the AT, so only tell it
+ * about their state changes once they get mapped.
+ */
+static void
+notify_state_change (GtkWidget *widget,
+                     AtkObject *accessible,
+                     AtkState   state,
+                     gboolean   value)
+{
+  if (state != ATK_STATE_VISIBLE && !gtk_widget_get_mapped (widget))
+    {
+      GTK_WIDGET_ACCESSIBLE (accessible)->priv->pending_states |= G_GUINT64_CONSTANT (1) << state;
+      return;
+    }
+
+  atk_object_notify_state_change (accessible, state, value);
+}
+
 static void
 gtk_widget_accessible_update_tooltip (GtkWidgetAccessible *accessible,
                                       GtkWidget *widget)
@@ -480,12 +524,12 @@ gtk_widget_accessible_notify_gtk (GObject    *obj,
   else
     return;
 
-  atk_object_notify_state_change (atk_obj, state, value);
+  notify_state_change (widget, atk_obj, state, value);
   if (state == ATK_STATE_SENSITIVE)
-    atk_object_notify_state_change (atk_obj, ATK_STATE_ENABLED, value);
+    notify_state_change (widget, atk_obj, ATK_STATE_ENABLED, value);
 
   if (state == ATK_STATE_HORIZONTAL)
-    atk_object_notify_state_change (atk_obj, ATK_STATE_VERTICAL, !value);
+    notify_state_change (widget, atk_obj, ATK_STATE_VERTICAL, !value);
 }
 
 static AtkAttributeSet *
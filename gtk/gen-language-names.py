@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Generates language-names-table.c from the ISO 639 data of iso-codes
+#
+#   gen-language-names.py iso_639.xml iso_639_3.xml > language-names-table.c
+#
+# Newer iso-codes releases call the files iso_639-2.xml and iso_639-3.xml.
+# The names are kept in English, they are translated at runtime with
+# the gettext domains of iso-codes.
+
+import sys
+import xml.etree.ElementTree as ET
+
+# The gettext domain for the names of each input file, in order
+domains = [ 'iso_639', 'iso_639_3' ]
+
+if len(sys.argv) != len(domains) + 1:
+    sys.stderr.write('usage: %s iso_639.xml iso_639_3.xml\n' % sys.argv[0])
+    sys.exit(1)
+
+# code -> (name, domain), later entries replace earlier ones
+languages = {}
+
+def code_length_ok(attr, value):
+    if attr == 'iso_639_1_code':
+        return len(value) == 2
+    if attr in ('iso_639_2B_code', 'iso_639_2T_code'):
+        return len(value) == 3
+    if attr == 'id':
+        return len(value) in (2, 3)
+    return True
+
+for domain, filename in enumerate(sys.argv[1:]):
+    root = ET.parse(filename).getroot()
+    for entry in root:
+        if entry.tag not in ('iso_639_entry', 'iso_639_3_entry'):
+            continue
+
+        # Entries with malformed codes are skipped entirely
+        if not all(code_length_ok(attr, value)
+                   for attr, value in entry.attrib.items() if value):
+            continue
+
+        name = entry.get('name')
+        if name is None:
+            continue
+
+        for attr in ('iso_639_1_code', 'iso_639_2B_code', 'iso_639_2T_code', 'id'):
+            code = entry.get(attr)
+            if code:
+                languages[code.lower()] = (name, domain)
+
+# MSVC does not allow string literals longer than 64k,
+# so the names are split into several of them
+CHUNK_SIZE = 32768
+
+chunks = [ [] ]
+offsets = {}
+offset = 0
+for code in sorted(languages):
+    name = languages[code][0]
+    if name in offsets:
+        continue
+    size = len(name.encode('utf-8')) + 1
+    if offset + size > CHUNK_SIZE:
+        chunks.append([])
+        offset = 0
+    offsets[name] = (len(chunks) - 1, offset)
+    chunks[-1].append(name)
+    offset += size
+
+def c_string(s):
+    return s.replace('\\', '\\\\').replace('"', '\\"')
+
+out = sys.stdout
+out.write('/* Generated by gen-language-names.py */\n\n')
+
+out.write('static const char language_domains[][10] = {\n')
+for domain in domains:
+    out.write('  "%s",\n' % domain)
+out.write('};\n\n')
+
+for i, chunk in enumerate(chunks):
+    out.write('static const char language_names_%d[] =' % i)
+    for name in chunk:
+        out.write('\n  "%s\\0"' % c_string(name))
+    out.write(';\n\n')
+
+out.write('static const char * const language_names[] = {\n')
+for i in range(len(chunks)):
+    out.write('  language_names_%d,\n' % i)
+out.write('};\n\n')
+
+out.write('typedef struct {\n'
+          '  char code[4];\n'
+          '  guint8 domain;\n'
+          '  guint8 chunk;\n'
+          '  guint16 name;\n'
+          '} LanguageInfo;\n\n'
+          '/* Sorted by code */\n'
+          'static const LanguageInfo languages[] = {\n')
+for code in sorted(languages):
+    name, domain = languages[code]
+    chunk, offset = offsets[name]
+    out.write('  { "%s", %d, %d, %5d },\n' % (code, domain, chunk, offset))
+out.write('};\n')
@@ -25,6 +25,7 @@
 #include "gtksnapshotprivate.h"
 
 #include <math.h>
+#include <string.h>
 
 #include <pango/pango.h>
 #include <cairo.h>
@@ -39,6 +40,17 @@
  * to text nodes, all other draw calls fall back to cairo nodes.
  */
 
+typedef struct _PendingRectangle PendingRectangle;
+
+struct _PendingRectangle
+{
+  GdkRGBA color;
+  int x;
+  int y;
+  int width;
+  int height;
+};
+
 struct _GskPangoRenderer
 {
   PangoRenderer parent_instance;
@@ -47,6 +59,17 @@ struct _GskPangoRenderer
   GdkRGBA fg_color;
   graphene_rect_t bounds;
 
+  /* Consecutive glyph runs with the same font and color on the same
+   * line are collected into one text node, and adjacent decorations
+   * of the same color into one color node. */
+  PangoFont *pending_font;
+  GdkRGBA pending_color;
+  int pending_x;
+  int pending_y;
+  int pending_end;
+  PangoGlyphString *pending_glyphs;
+  GArray *pending_rects;
+
   /* house-keeping options */
   gboolean is_cached_renderer;
 };
@@ -100,6 +123,36 @@ set_color (GskPangoRenderer *crenderer,
   gdk_cairo_set_source_rgba (cr, &rgba);
 }
 
+static void
+gsk_pango_renderer_flush (GskPangoRenderer *crenderer)
+{
+  guint i;
+
+  if (crenderer->pending_font)
+    {
+      gtk_snapshot_append_text (crenderer->snapshot,
+                                crenderer->pending_font,
+                                crenderer->pending_glyphs,
+                                &crenderer->pending_color,
+                                (float) crenderer->pending_x / PANGO_SCALE,
+                                (float) crenderer->pending_y / PANGO_SCALE);
+      g_clear_object (&crenderer->pending_font);
+    }
+
+  for (i = 0; i < crenderer->pending_rects->len; i++)
+    {
+      const PendingRectangle *rect = &g_array_index (crenderer->pending_rects, PendingRectangle, i);
+
+      gtk_snapshot_append_color (crenderer->snapshot,
+                                 &rect->color,
+                                 &GRAPHENE_RECT_INIT ((double)rect->x / PANGO_SCALE,
+                                                      (double)rect->y / PANGO_SCALE,
+                                                      (double)rect->width / PANGO_SCALE,
+                                                      (double)rect->height / PANGO_SCALE));
+    }
+  g_array_set_size (crenderer->pending_rects, 0);
+}
+
 static void
 gsk_pango_renderer_show_text_glyphs (PangoRenderer        *renderer,
                                      const char           *text,
@@ -113,16 +166,44 @@ gsk_pango_renderer_show_text_glyphs (PangoRenderer        *renderer,
                                      int                   y)
 {
   GskPangoRenderer *crenderer = (GskPangoRenderer *) (renderer);
+  PangoGlyphString *pending = crenderer->pending_glyphs;
   GdkRGBA color;
 
+  if (glyphs->num_glyphs == 0)
+    return;
+
   get_color (crenderer, PANGO_RENDER_PART_FOREGROUND, &color);
 
-  gtk_snapshot_append_text (crenderer->snapshot,
-                            font,
-                            glyphs,
-                            &color,
-                            (float) x / PANGO_SCALE,
-                            (float) y / PANGO_SCALE);
+  if (crenderer->pending_font == font &&
+      crenderer->pending_y == y &&
+      crenderer->pending_end <= x &&
+      gdk_rgba_equal (&crenderer->pending_color, &color))
+    {
+      int n_glyphs = pending->num_glyphs;
+
+      pango_glyph_string_set_size (pending, n_glyphs + glyphs->num_glyphs);
+      memcpy (&pending->glyphs[n_glyphs], glyphs->glyphs, glyphs->num_glyphs * sizeof (PangoGlyphInfo));
+      memcpy (&pending->log_clusters[n_glyphs], glyphs->log_clusters, glyphs->num_glyphs * sizeof (int));
+
+      /* Glyphs are positioned by the widths of the ones before them,
+       * so move the new ones to where the run starts */
+      pending->glyphs[n_glyphs - 1].geometry.width += x - crenderer->pending_end;
+    }
+  else
+    {
+      gsk_pango_renderer_flush (crenderer);
+
+      crenderer->pending_font = g_object_ref (font);
+      crenderer->pending_color = color;
+      crenderer->pending_x = x;
+      crenderer->pending_y = y;
+
+      pango_glyph_string_set_size (pending, glyphs->num_glyphs);
+      memcpy (pending->glyphs, glyphs->glyphs, glyphs->num_glyphs * sizeof (PangoGlyphInfo));
+      memcpy (pending->log_clusters, glyphs->log_clusters, glyphs->num_glyphs * sizeof (int));
+    }
+
+  crenderer->pending_end = x + pango_glyph_string_get_width (glyphs);
 }
 
 static void
@@ -157,16 +238,39 @@ gsk_pango_renderer_draw_rectangle (PangoRenderer     *renderer,
                                    int                height)
 {
   GskPangoRenderer *crenderer = (GskPangoRenderer *) (renderer);
+  PendingRectangle *last;
   GdkRGBA rgba;
-  graphene_rect_t bounds;
 
   get_color (crenderer, part, &rgba);
 
-  graphene_rect_init (&bounds,
-                      (double)x / PANGO_SCALE, (double)y / PANGO_SCALE,
-                      (double)width / PANGO_SCALE, (double)height / PANGO_SCALE);
+  /* Backgrounds go below the glyphs, so they can't wait */
+  if (part == PANGO_RENDER_PART_BACKGROUND)
+    {
+      gsk_pango_renderer_flush (crenderer);
+      gtk_snapshot_append_color (crenderer->snapshot,
+                                 &rgba,
+                                 &GRAPHENE_RECT_INIT ((double)x / PANGO_SCALE, (double)y / PANGO_SCALE,
+                                                      (double)width / PANGO_SCALE, (double)height / PANGO_SCALE));
+      return;
+    }
 
-  gtk_snapshot_append_color (crenderer->snapshot, &rgba, &bounds);
+  /* Continue the previous decoration if this one starts where it ends */
+  if (crenderer->pending_rects->len > 0)
+    {
+      last = &g_array_index (crenderer->pending_rects, PendingRectangle, crenderer->pending_rects->len - 1);
+      if (last->y == y &&
+          last->height == height &&
+          last->x + last->width == x &&
+          gdk_rgba_equal (&last->color, &rgba))
+        {
+          last->width += width;
+          return;
+        }
+    }
+
+  g_array_append_vals (crenderer->pending_rects,
+                       &(PendingRectangle) { rgba, x, y, width, height },
+                       1);
 }
 
 static void
@@ -183,6 +287,8 @@ gsk_pango_renderer_draw_trapezoid (PangoRenderer   *renderer,
   cairo_t *cr;
   gdouble x, y;
 
+  gsk_pango_renderer_flush (crenderer);
+
   cr = gtk_snapshot_append_cairo (crenderer->snapshot, &crenderer->bounds);
 
   set_color (crenderer, part, cr);
@@ -286,6 +392,8 @@ gsk_pango_renderer_draw_error_underline (PangoRenderer *renderer,
   GskPangoRenderer *crenderer = (GskPangoRenderer *) (renderer);
   cairo_t *cr;
 
+  gsk_pango_renderer_flush (crenderer);
+
   cr = gtk_snapshot_append_cairo (crenderer->snapshot, &crenderer->bounds);
 
   set_color (crenderer, PANGO_RENDER_PART_UNDERLINE, cr);
@@ -315,6 +423,8 @@ gsk_pango_renderer_draw_shape (PangoRenderer  *renderer,
   double base_x = (double)x / PANGO_SCALE;
   double base_y = (double)y / PANGO_SCALE;
 
+  gsk_pango_renderer_flush (crenderer);
+
   cr = gtk_snapshot_append_cairo (crenderer->snapshot, &crenderer->bounds);
 
   layout = pango_renderer_get_layout (renderer);
@@ -337,15 +447,31 @@ gsk_pango_renderer_draw_shape (PangoRenderer  *renderer,
 }
 
 static void
-gsk_pango_renderer_init (GskPangoRenderer *renderer G_GNUC_UNUSED)
+gsk_pango_renderer_init (GskPangoRenderer *renderer)
 {
+  renderer->pending_glyphs = pango_glyph_string_new ();
+  renderer->pending_rects = g_array_new (FALSE, FALSE, sizeof (PendingRectangle));
+}
+
+static void
+gsk_pango_renderer_finalize (GObject *object)
+{
+  GskPangoRenderer *renderer = (GskPangoRenderer *) object;
+
+  pango_glyph_string_free (renderer->pending_glyphs);
+  g_array_unref (renderer->pending_rects);
+
+  G_OBJECT_CLASS (gsk_pango_renderer_parent_class)->finalize (object);
 }
 
 static void
 gsk_pango_renderer_class_init (GskPangoRendererClass *klass)
 {
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
   PangoRendererClass *renderer_class = PANGO_RENDERER_CLASS (klass);
 
+  object_class->finalize = gsk_pango_renderer_finalize;
+
   renderer_class->draw_glyphs = gsk_pango_renderer_draw_glyphs;
   renderer_class->draw_glyph_item = gsk_pango_renderer_draw_glyph_item;
   renderer_class->draw_rectangle = gsk_pango_renderer_draw_rectangle;
@@ -423,6 +549,7 @@ gtk_snapshot_append_layout (GtkSnapshot   *snapshot,
   graphene_rect_init (&crenderer->bounds, ink_rect.x, ink_rect.y, ink_rect.width, ink_rect.height);
 
   pango_renderer_draw_layout (PANGO_RENDERER (crenderer), layout, 0, 0);
+  gsk_pango_renderer_flush (crenderer);
 
   release_renderer (crenderer);
 }
@@ -189,6 +189,8 @@ gtk_accel_group_finalize (GObject *object)
     }
 
   g_free (accel_group->priv->priv_accels);
+  g_hash_table_unref (accel_group->priv->closure_keys);
+  g_hash_table_unref (accel_group->priv->path_closures);
 
   G_OBJECT_CLASS (gtk_accel_group_parent_class)->finalize (object);
 }
@@ -215,6 +217,18 @@ gtk_accel_group_get_property (GObject    *object,
     }
 }
 
+/* Closures that are connected more than once, they are looked up by
+ * walking all accelerators
+ */
+static GtkAccelKey multiple_keys;
+
+static void
+closure_key_free (gpointer data)
+{
+  if (data != &multiple_keys)
+    g_slice_free (GtkAccelKey, data);
+}
+
 static void
 gtk_accel_group_init (GtkAccelGroup *accel_group)
 {
@@ -228,6 +242,8 @@ gtk_accel_group_init (GtkAccelGroup *accel_group)
   priv->acceleratables = NULL;
   priv->n_accels = 0;
   priv->priv_accels = NULL;
+  priv->closure_keys = g_hash_table_new_full (NULL, NULL, NULL, closure_key_free);
+  priv->path_closures = g_hash_table_new_full (NULL, NULL, NULL, (GDestroyNotify) g_slist_free);
 }
 
 /**
@@ -468,6 +484,9 @@ bsearch_compare_accels (const void *d1,
     return entry1->key.accel_key < entry2->key.accel_key ? -1 : 1;
 }
 
+static gint quick_accel_find_closure (GtkAccelGroup *accel_group,
+                                      GClosure      *closure);
+
 static void
 quick_accel_add (GtkAccelGroup   *accel_group,
                  guint            accel_key,
@@ -476,15 +495,27 @@ quick_accel_add (GtkAccelGroup   *accel_group,
                  GClosure        *closure,
                  GQuark           path_quark)
 {
-  guint pos, i = accel_group->priv->n_accels++;
+  guint pos, lo, hi, i = accel_group->priv->n_accels++;
   GtkAccelGroupEntry key;
+  GtkAccelKey *closure_key;
+  GSList *closures;
 
   /* find position */
   key.key.accel_key = accel_key;
   key.key.accel_mods = accel_mods;
-  for (pos = 0; pos < i; pos++)
-    if (bsearch_compare_accels (&key, accel_group->priv->priv_accels + pos) < 0)
-      break;
+  lo = 0;
+  hi = i;
+  while (lo < hi)
+    {
+      guint mid = lo + (hi - lo) / 2;
+
+      /* after all equal keys, so they stay in connection order */
+      if (bsearch_compare_accels (&key, accel_group->priv->priv_accels + mid) < 0)
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
+  pos = lo;
 
   /* insert at position, ref closure */
   accel_group->priv->priv_accels = g_renew (GtkAccelGroupEntry, accel_group->priv->priv_accels, accel_group->priv->n_accels);
@@ -500,6 +531,24 @@ quick_accel_add (GtkAccelGroup   *accel_group,
   /* handle closure invalidation and reverse lookups */
   g_closure_add_invalidate_notifier (closure, accel_group, accel_closure_invalidate);
 
+  /* index by closure and accel path */
+  if (g_hash_table_lookup (accel_group->priv->closure_keys, closure))
+    closure_key = &multiple_keys;
+  else
+    {
+      closure_key = g_slice_new (GtkAccelKey);
+      *closure_key = accel_group->priv->priv_accels[pos].key;
+    }
+  g_hash_table_insert (accel_group->priv->closure_keys, closure, closure_key);
+
+  if (path_quark)
+    {
+      closures = g_hash_table_lookup (accel_group->priv->path_closures, GUINT_TO_POINTER (path_quark));
+      g_hash_table_steal (accel_group->priv->path_closures, GUINT_TO_POINTER (path_quark));
+      closures = g_slist_prepend (closures, closure);
+      g_hash_table_insert (accel_group->priv->path_closures, GUINT_TO_POINTER (path_quark), closures);
+    }
+
   /* get accel path notification */
   if (path_quark)
     _gtk_accel_map_add_group (g_quark_to_string (path_quark), accel_group);
@@ -548,13 +597,28 @@ quick_accel_remove (GtkAccelGroup *accel_group,
                                           closure, NULL, NULL);
   /* clean up accel path notification */
   if (entry->accel_path_quark)
-    _gtk_accel_map_remove_group (g_quark_to_string (entry->accel_path_quark), accel_group);
+    {
+      GQuark path_quark = entry->accel_path_quark;
+      GSList *closures;
+
+      _gtk_accel_map_remove_group (g_quark_to_string (path_quark), accel_group);
+
+      closures = g_hash_table_lookup (accel_group->priv->path_closures, GUINT_TO_POINTER (path_quark));
+      g_hash_table_steal (accel_group->priv->path_closures, GUINT_TO_POINTER (path_quark));
+      closures = g_slist_remove (closures, closure);
+      if (closures)
+        g_hash_table_insert (accel_group->priv->path_closures, GUINT_TO_POINTER (path_quark), closures);
+    }
 
   /* physically remove */
   accel_group->priv->n_accels -= 1;
   memmove (entry, entry + 1,
            (accel_group->priv->n_accels - pos) * sizeof (accel_group->priv->priv_accels[0]));
 
+  if (g_hash_table_lookup (accel_group->priv->closure_keys, closure) != &multiple_keys ||
+      quick_accel_find_closure (accel_group, closure) < 0)
+    g_hash_table_remove (accel_group->priv->closure_keys, closure);
+
   /* and notify */
   if (accel_quark)
     g_signal_emit (accel_group, signal_accel_changed, accel_quark, accel_key, accel_mods, closure);
@@ -598,6 +662,35 @@ quick_accel_find (GtkAccelGroup   *accel_group,
   return entry;
 }
 
+/* Returns the position of @closure in priv_accels, or -1 */
+static gint
+quick_accel_find_closure (GtkAccelGroup *accel_group,
+                          GClosure      *closure)
+{
+  GtkAccelGroupEntry *entries;
+  GtkAccelKey *key;
+  guint i, n;
+
+  key = g_hash_table_lookup (accel_group->priv->closure_keys, closure);
+  if (key == NULL)
+    return -1;
+
+  if (key == &multiple_keys)
+    {
+      for (i = 0; i < accel_group->priv->n_accels; i++)
+        if (accel_group->priv->priv_accels[i].closure == closure)
+          return i;
+      return -1;
+    }
+
+  entries = quick_accel_find (accel_group, key->accel_key, key->accel_mods, &n);
+  for (i = 0; i < n; i++)
+    if (entries[i].closure == closure)
+      return entries + i - accel_group->priv->priv_accels;
+
+  return -1;
+}
+
 /**
  * gtk_accel_group_connect:
  * @accel_group: the accelerator group to install an accelerator in
@@ -700,19 +793,18 @@ gboolean
 gtk_accel_group_disconnect (GtkAccelGroup *accel_group,
                             GClosure      *closure)
 {
-  guint i;
+  gint pos;
 
   g_return_val_if_fail (GTK_IS_ACCEL_GROUP (accel_group), FALSE);
 
-  for (i = 0; i < accel_group->priv->n_accels; i++)
-    if (accel_group->priv->priv_accels[i].closure == closure)
-      {
-        g_object_ref (accel_group);
-        quick_accel_remove (accel_group, i);
-        g_object_unref (accel_group);
-        return TRUE;
-      }
-  return FALSE;
+  pos = quick_accel_find_closure (accel_group, closure);
+  if (pos < 0)
+    return FALSE;
+
+  g_object_ref (accel_group);
+  quick_accel_remove (accel_group, pos);
+  g_object_unref (accel_group);
+  return TRUE;
 }
 
 /**
@@ -768,20 +860,15 @@ void
 _gtk_accel_group_reconnect (GtkAccelGroup *accel_group,
                             GQuark         accel_path_quark)
 {
-  GSList *slist, *clist = NULL;
-  guint i;
+  GSList *slist, *clist;
 
   g_return_if_fail (GTK_IS_ACCEL_GROUP (accel_group));
 
   g_object_ref (accel_group);
 
-  for (i = 0; i < accel_group->priv->n_accels; i++)
-    if (accel_group->priv->priv_accels[i].accel_path_quark == accel_path_quark)
-      {
-        GClosure *closure = g_closure_ref (accel_group->priv->priv_accels[i].closure);
-
-        clist = g_slist_prepend (clist, closure);
-      }
+  clist = g_slist_copy_deep (g_hash_table_lookup (accel_group->priv->path_closures,
+                                                  GUINT_TO_POINTER (accel_path_quark)),
+                             (GCopyFunc) g_closure_ref, NULL);
 
   for (slist = clist; slist; slist = slist->next)
     {
@@ -32,6 +32,10 @@ struct _GtkAccelGroupPrivate
   GSList             *acceleratables;
   guint               n_accels;
   GtkAccelGroupEntry *priv_accels;
+
+  /* Indexes into priv_accels, for disconnect and reconnect */
+  GHashTable         *closure_keys;   /* GClosure -> GtkAccelKey */
+  GHashTable         *path_closures;  /* accel path GQuark -> GSList of GClosure */
 };
 
 void	_gtk_accel_group_reconnect        (GtkAccelGroup *accel_group,
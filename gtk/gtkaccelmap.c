@@ -117,6 +117,7 @@ typedef struct {
   guint	       std_accel_key;
   guint	       std_accel_mods;
   guint        changed    :  1;
+  guint        notify_pending : 1;
   guint        lock_count : 15;
   GSList      *groups;
 } AccelEntry;
@@ -133,6 +134,12 @@ static GHashTable  *accel_entry_ht = NULL;	/* accel_path -> AccelEntry */
 static GSList      *accel_filters = NULL;
 static gulong	    accel_map_signals[LAST_SIGNAL] = { 0, };
 
+/* While accel map files are loaded, ::changed is emitted only once
+ * per entry when loading is done
+ */
+static guint        load_depth = 0;
+static GSList      *pending_changes = NULL;	/* AccelEntry, reversed */
+
 /* --- prototypes --- */
 static void do_accel_map_changed (AccelEntry *entry);
 
@@ -618,6 +625,7 @@ gtk_accel_map_load_scanner (GScanner *scanner)
 
   /* outer parsing loop
    */
+  load_depth++;
   g_scanner_peek_next_token (scanner);
   while (scanner->next_token == '(')
     {
@@ -627,6 +635,23 @@ gtk_accel_map_load_scanner (GScanner *scanner)
 
       g_scanner_peek_next_token (scanner);
     }
+  load_depth--;
+
+  if (load_depth == 0)
+    {
+      GSList *changes, *slist;
+
+      changes = g_slist_reverse (pending_changes);
+      pending_changes = NULL;
+      for (slist = changes; slist; slist = slist->next)
+        {
+          AccelEntry *entry = slist->data;
+
+          entry->notify_pending = FALSE;
+          do_accel_map_changed (entry);
+        }
+      g_slist_free (changes);
+    }
 
   /* restore config */
   scanner->config->skip_comment_single = skip_comment_single;
@@ -1042,6 +1067,16 @@ gtk_accel_map_get (void)
 static void
 do_accel_map_changed (AccelEntry *entry)
 {
+  if (load_depth > 0)
+    {
+      if (!entry->notify_pending)
+        {
+          entry->notify_pending = TRUE;
+          pending_changes = g_slist_prepend (pending_changes, entry);
+        }
+      return;
+    }
+
   if (accel_map)
     g_signal_emit (accel_map,
 		   accel_map_signals[CHANGED],
@@ -61,6 +61,10 @@ struct _GtkAdjustmentPrivate {
   gint64 end_time;
   guint tick_id;
   GdkFrameClock *clock;
+
+  guint batch_depth;
+  gdouble batch_value;
+  guint value_pending : 1;
 };
 typedef struct _GtkAdjustmentPrivate GtkAdjustmentPrivate;
 
@@ -325,6 +329,14 @@ gtk_adjustment_set_property (GObject      *object,
 static inline void
 emit_value_changed (GtkAdjustment *adjustment)
 {
+  GtkAdjustmentPrivate *priv = gtk_adjustment_get_instance_private (adjustment);
+
+  if (priv->batch_depth > 0)
+    {
+      priv->value_pending = TRUE;
+      return;
+    }
+
   g_signal_emit (adjustment, adjustment_signals[VALUE_CHANGED], 0);
   g_object_notify_by_pspec (G_OBJECT (adjustment), adjustment_props[PROP_VALUE]);
 }
@@ -851,6 +863,67 @@ gtk_adjustment_configure (GtkAdjustment *adjustment,
     emit_value_changed (adjustment);
 }
 
+/*
+ * gtk_adjustment_begin_batch:
+ * @adjustment: a #GtkAdjustment
+ *
+ * Starts collecting changes to @adjustment. Until the matching
+ * gtk_adjustment_end_batch(), the setters and gtk_adjustment_configure()
+ * update the adjustment as usual, but #GtkAdjustment::changed and
+ * #GtkAdjustment::value-changed are held back, so that a widget
+ * which reconfigures its adjustments several times while allocating
+ * only makes the scrollbars and the scrolled child react once.
+ *
+ * Batches nest.
+ */
+void
+gtk_adjustment_begin_batch (GtkAdjustment *adjustment)
+{
+  GtkAdjustmentPrivate *priv = gtk_adjustment_get_instance_private (adjustment);
+
+  g_return_if_fail (GTK_IS_ADJUSTMENT (adjustment));
+
+  if (priv->batch_depth++ > 0)
+    return;
+
+  priv->batch_value = priv->value;
+  priv->value_pending = FALSE;
+
+  g_object_freeze_notify (G_OBJECT (adjustment));
+}
+
+/*
+ * gtk_adjustment_end_batch:
+ * @adjustment: a #GtkAdjustment
+ *
+ * Ends a batch started with gtk_adjustment_begin_batch(). When the
+ * outermost batch ends, #GtkAdjustment::changed is emitted once if
+ * any of the range properties changed, followed by
+ * #GtkAdjustment::value-changed if the value ended up different
+ * from what it was when the batch started.
+ */
+void
+gtk_adjustment_end_batch (GtkAdjustment *adjustment)
+{
+  GtkAdjustmentPrivate *priv = gtk_adjustment_get_instance_private (adjustment);
+  gboolean value_changed;
+
+  g_return_if_fail (GTK_IS_ADJUSTMENT (adjustment));
+  g_return_if_fail (priv->batch_depth > 0);
+
+  if (--priv->batch_depth > 0)
+    return;
+
+  value_changed = priv->value_pending && priv->value != priv->batch_value;
+  priv->value_pending = FALSE;
+
+  /* The dispatch_properties_changed implementation will emit ::changed! */
+  g_object_thaw_notify (G_OBJECT (adjustment));
+
+  if (value_changed)
+    emit_value_changed (adjustment);
+}
+
 /**
  * gtk_adjustment_clamp_page:
  * @adjustment: a #GtkAdjustment
@@ -34,6 +34,9 @@ gdouble gtk_adjustment_get_target_value (GtkAdjustment *adjustment);
 
 gboolean gtk_adjustment_is_animating (GtkAdjustment *adjustment);
 
+void gtk_adjustment_begin_batch (GtkAdjustment *adjustment);
+void gtk_adjustment_end_batch   (GtkAdjustment *adjustment);
+
 G_END_DECLS
 
 
@@ -20,8 +20,11 @@
 #include <config.h>
 
 #include "gtkallocatedbitmaskprivate.h"
+#include "gtkcsstypesprivate.h"
 #include "gtkprivate.h"
 
+#include <string.h>
+
 
 #define VALUE_TYPE gsize
 
@@ -29,9 +32,16 @@
 #define VALUE_BIT(idx) (((VALUE_TYPE) 1) << (idx))
 #define ALL_BITS (~((VALUE_TYPE) 0))
 
+/* Enough words for a bit per CSS property, which is what most
+ * allocated masks are used for. Masks up to that size never need
+ * to be reallocated when bits are set or cleared.
+ */
+#define N_INLINE_VALUES ((GTK_CSS_PROPERTY_N_PROPERTIES + VALUE_SIZE_BITS - 1) / VALUE_SIZE_BITS)
+
 struct _GtkBitmask {
   gsize len;
-  VALUE_TYPE data[1];
+  gsize alloc;
+  VALUE_TYPE data[N_INLINE_VALUES];
 };
 
 #define ENSURE_ALLOCATED(mask, heap_mask) G_STMT_START { \
@@ -39,6 +49,7 @@ struct _GtkBitmask {
     { \
       heap_mask.data[0] = _gtk_bitmask_to_bits (mask); \
       heap_mask.len = heap_mask.data[0] ? 1 : 0; \
+      heap_mask.alloc = 1; \
       mask = &heap_mask; \
     } \
 } G_STMT_END
@@ -50,15 +61,18 @@ static GtkBitmask *
 gtk_allocated_bitmask_resize (GtkBitmask *mask,
                               gsize       size)
 {
-  gsize i;
-
   if (size == mask->len)
     return mask;
 
-  mask = g_realloc (mask, sizeof (GtkBitmask) + sizeof(VALUE_TYPE) * (size - 1));
+  /* Shrinking keeps the memory, masks tend to grow back */
+  if (size > mask->alloc)
+    {
+      mask->alloc = MAX (size, 2 * mask->alloc);
+      mask = g_realloc (mask, sizeof (GtkBitmask) + sizeof (VALUE_TYPE) * (mask->alloc - N_INLINE_VALUES));
+    }
 
-  for (i = mask->len; i < size; i++)
-    mask->data[i] = 0;
+  if (size > mask->len)
+    memset (mask->data + mask->len, 0, sizeof (VALUE_TYPE) * (size - mask->len));
 
   mask->len = size;
 
@@ -72,6 +86,7 @@ gtk_allocated_bitmask_new_for_bits (gsize bits)
   
   mask = g_malloc (sizeof (GtkBitmask));
   mask->len = bits ? 1 : 0;
+  mask->alloc = N_INLINE_VALUES;
   mask->data[0] = bits;
 
   return mask;
@@ -177,14 +192,9 @@ _gtk_allocated_bitmask_intersect (GtkBitmask       *mask,
   mask = gtk_bitmask_ensure_allocated (mask);
   ENSURE_ALLOCATED (other, other_allocated);
 
-  for (i = 0; i < MIN (mask->len, other->len); i++)
-    {
-      mask->data[i] &= other->data[i];
-    }
-  for (; i < mask->len; i++)
-    {
-      mask->data[i] = 0;
-    }
+  mask = gtk_allocated_bitmask_resize (mask, MIN (mask->len, other->len));
+  for (i = 0; i < mask->len; i++)
+    mask->data[i] &= other->data[i];
 
   return gtk_allocated_bitmask_shrink (mask);
 }
@@ -204,9 +214,7 @@ _gtk_allocated_bitmask_union (GtkBitmask       *mask,
 
   mask = gtk_allocated_bitmask_resize (mask, MAX (mask->len, other->len));
   for (i = 0; i < other->len; i++)
-    {
-      mask->data[i] |= other->data[i];
-    }
+    mask->data[i] |= other->data[i];
 
   return mask;
 }
@@ -226,9 +234,7 @@ _gtk_allocated_bitmask_subtract (GtkBitmask       *mask,
 
   len = MIN (mask->len, other->len);
   for (i = 0; i < len; i++)
-    {
-      mask->data[i] &= ~other->data[i];
-    }
+    mask->data[i] &= ~other->data[i];
 
   return gtk_allocated_bitmask_shrink (mask);
 }
@@ -322,21 +328,13 @@ gboolean
 _gtk_allocated_bitmask_equals (const GtkBitmask  *mask,
                                const GtkBitmask  *other)
 {
-  guint i;
-
   gtk_internal_return_val_if_fail (mask != NULL, FALSE);
   gtk_internal_return_val_if_fail (other != NULL, FALSE);
 
   if (mask->len != other->len)
     return FALSE;
 
-  for (i = 0; i < mask->len; i++)
-    {
-      if (mask->data[i] != other->data[i])
-        return FALSE;
-    }
-
-  return TRUE;
+  return memcmp (mask->data, other->data, sizeof (VALUE_TYPE) * mask->len) == 0;
 }
 
 gboolean
@@ -344,7 +342,8 @@ _gtk_allocated_bitmask_intersects (const GtkBitmask *mask,
                                    const GtkBitmask *other)
 {
   GtkBitmask mask_allocated, other_allocated;
-  int i;
+  VALUE_TYPE result = 0;
+  gsize i, len;
 
   gtk_internal_return_val_if_fail (mask != NULL, FALSE);
   gtk_internal_return_val_if_fail (other != NULL, FALSE);
@@ -352,12 +351,53 @@ _gtk_allocated_bitmask_intersects (const GtkBitmask *mask,
   ENSURE_ALLOCATED (mask, mask_allocated);
   ENSURE_ALLOCATED (other, other_allocated);
 
-  for (i = MIN (mask->len, other->len) - 1; i >= 0; i--)
+  /* Masks are short, so going through all of them without
+   * a branch per word is faster, and it can be vectorized */
+  len = MIN (mask->len, other->len);
+  for (i = 0; i < len; i++)
+    result |= mask->data[i] & other->data[i];
+
+  return result != 0;
+}
+
+guint
+_gtk_allocated_bitmask_count (const GtkBitmask *mask)
+{
+  guint i, count;
+
+  gtk_internal_return_val_if_fail (mask != NULL, 0);
+
+  count = 0;
+  for (i = 0; i < mask->len; i++)
+    count += _gtk_bitmask_bits_count (mask->data[i]);
+
+  return count;
+}
+
+guint
+_gtk_allocated_bitmask_next_set (const GtkBitmask *mask,
+                                 guint             index_)
+{
+  guint array_index, bit_index;
+  VALUE_TYPE value;
+
+  gtk_internal_return_val_if_fail (mask != NULL, G_MAXUINT);
+
+  gtk_allocated_bitmask_indexes (index_, &array_index, &bit_index);
+
+  if (array_index >= mask->len)
+    return G_MAXUINT;
+
+  value = mask->data[array_index] & (ALL_BITS << bit_index);
+  while (value == 0)
     {
-      if (mask->data[i] & other->data[i])
-        return TRUE;
+      array_index++;
+      if (array_index >= mask->len)
+        return G_MAXUINT;
+
+      value = mask->data[array_index];
     }
 
-  return FALSE;
+  return array_index * VALUE_SIZE_BITS + _gtk_bitmask_bits_first_set (value);
 }
 
@@ -38,6 +38,37 @@ typedef struct _GtkBitmask GtkBitmask;
 
 #define GTK_BITMASK_N_DIRECT_BITS (sizeof (gsize) * 8 - 1)
 
+static inline guint
+_gtk_bitmask_bits_count (gsize bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_popcountll (bits);
+#else
+  guint count;
+
+  for (count = 0; bits; count++)
+    bits &= bits - 1;
+
+  return count;
+#endif
+}
+
+/* @bits must not be 0 */
+static inline guint
+_gtk_bitmask_bits_first_set (gsize bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll (bits);
+#else
+  guint index_;
+
+  for (index_ = 0; !(bits & 1); index_++)
+    bits >>= 1;
+
+  return index_;
+#endif
+}
+
 
 GtkBitmask *   _gtk_allocated_bitmask_copy              (const GtkBitmask  *mask);
 void           _gtk_allocated_bitmask_free              (GtkBitmask        *mask);
@@ -67,6 +98,10 @@ gboolean       _gtk_allocated_bitmask_equals            (const GtkBitmask  *mask
 gboolean       _gtk_allocated_bitmask_intersects        (const GtkBitmask  *mask,
                                                          const GtkBitmask  *other);
 
+guint          _gtk_allocated_bitmask_count             (const GtkBitmask  *mask);
+guint          _gtk_allocated_bitmask_next_set          (const GtkBitmask  *mask,
+                                                         guint              index_);
+
 G_END_DECLS
 
 #endif /* __GTK_ALLOCATED_BITMASK_PRIVATE_H__ */
@@ -95,6 +95,7 @@ struct _GtkAppChooserWidgetPrivate {
   GtkCellRenderer *secondary_padding;
 
   GAppInfoMonitor *monitor;
+  GCancellable *cancellable;
 
   GtkWidget *popup_menu;
 };
@@ -685,10 +686,159 @@ gtk_app_chooser_widget_select_first (GtkAppChooserWidget *self)
     }
 }
 
+/* Looking up applications means reading all desktop files the first
+ * time, so it is done on a thread. The results are kept until the
+ * installed applications change: the applications for each content
+ * type that was asked for, and the list of all applications.
+ */
+typedef struct
+{
+  GAppInfo *default_app;
+  GList *recommended_apps;
+  GList *fallback_apps;
+} TypedApps;
+
+typedef struct
+{
+  gchar *content_type;  /* NULL to not look up the typed apps */
+  gboolean want_all;
+  guint generation;
+
+  TypedApps *typed_apps;
+  GList *all_apps;
+} AppsQuery;
+
+static GHashTable *typed_apps_cache = NULL;
+static GList *all_apps_cache = NULL;
+static gboolean all_apps_cached = FALSE;
+static guint apps_cache_generation = 0;
+
 static void
-gtk_app_chooser_widget_real_add_items (GtkAppChooserWidget *self)
+typed_apps_free (gpointer data)
+{
+  TypedApps *typed_apps = data;
+
+  g_clear_object (&typed_apps->default_app);
+  g_list_free_full (typed_apps->recommended_apps, g_object_unref);
+  g_list_free_full (typed_apps->fallback_apps, g_object_unref);
+  g_slice_free (TypedApps, typed_apps);
+}
+
+static void
+apps_query_free (gpointer data)
+{
+  AppsQuery *query = data;
+
+  g_free (query->content_type);
+  if (query->typed_apps)
+    typed_apps_free (query->typed_apps);
+  g_list_free_full (query->all_apps, g_object_unref);
+  g_slice_free (AppsQuery, query);
+}
+
+static void
+apps_cache_clear (void)
+{
+  apps_cache_generation++;
+
+  g_hash_table_remove_all (typed_apps_cache);
+  g_list_free_full (all_apps_cache, g_object_unref);
+  all_apps_cache = NULL;
+  all_apps_cached = FALSE;
+}
+
+static void
+apps_cache_changed (GAppInfoMonitor *monitor,
+                    gpointer         user_data)
+{
+  apps_cache_clear ();
+}
+
+/* Called from class_init, so that the cache is cleared before any
+ * widget refreshes for a change.
+ */
+static void
+apps_cache_init (void)
+{
+  typed_apps_cache = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                            g_free, typed_apps_free);
+
+  /* Kept for as long as the cache */
+  g_signal_connect (g_app_info_monitor_get (), "changed",
+                    G_CALLBACK (apps_cache_changed), NULL);
+}
+
+static void
+lookup_apps_thread (GTask        *task,
+                    gpointer      source_object,
+                    gpointer      task_data,
+                    GCancellable *cancellable)
+{
+  AppsQuery *query = task_data;
+
+  if (query->content_type)
+    {
+      query->typed_apps = g_slice_new0 (TypedApps);
+      query->typed_apps->default_app = g_app_info_get_default_for_type (query->content_type, FALSE);
+#ifndef G_OS_WIN32
+      query->typed_apps->recommended_apps = g_app_info_get_recommended_for_type (query->content_type);
+      query->typed_apps->fallback_apps = g_app_info_get_fallback_for_type (query->content_type);
+#endif
+    }
+
+  if (query->want_all && !g_task_return_error_if_cancelled (task))
+    query->all_apps = g_app_info_get_all ();
+
+  if (!g_task_had_error (task))
+    g_task_return_boolean (task, TRUE);
+}
+
+static void gtk_app_chooser_widget_real_add_items (GtkAppChooserWidget *self);
+
+static void
+lookup_apps_done (GObject      *source,
+                  GAsyncResult *result,
+                  gpointer      user_data)
+{
+  GtkAppChooserWidget *self = GTK_APP_CHOOSER_WIDGET (source);
+  AppsQuery *query = g_task_get_task_data (G_TASK (result));
+
+  /* Cancelled for a newer lookup */
+  if (!g_task_propagate_boolean (G_TASK (result), NULL))
+    return;
+
+  g_clear_object (&self->priv->cancellable);
+
+  /* The applications changed while looking them up */
+  if (query->generation != apps_cache_generation)
+    {
+      gtk_app_chooser_widget_real_add_items (self);
+      return;
+    }
+
+  if (query->typed_apps)
+    {
+      g_hash_table_replace (typed_apps_cache,
+                            g_strdup (query->content_type),
+                            query->typed_apps);
+      query->typed_apps = NULL;
+    }
+
+  if (query->want_all && !all_apps_cached)
+    {
+      all_apps_cache = query->all_apps;
+      all_apps_cached = TRUE;
+      query->all_apps = NULL;
+    }
+
+  gtk_app_chooser_widget_real_add_items (self);
+}
+
+static void
+gtk_app_chooser_widget_add_apps (GtkAppChooserWidget *self,
+                                 TypedApps           *typed_apps,
+                                 GList               *all_applications)
 {
-  GList *all_applications = NULL;
   GList *recommended_apps = NULL;
   GList *fallback_apps = NULL;
   GList *exclude_apps = NULL;
@@ -699,13 +849,18 @@ gtk_app_chooser_widget_real_add_items (GtkAppChooserWidget *self)
   show_headings = TRUE;
   apps_added = FALSE;
 
+  if (typed_apps)
+    {
+      default_app = typed_apps->default_app;
+      recommended_apps = typed_apps->recommended_apps;
+      fallback_apps = typed_apps->fallback_apps;
+    }
+
   if (self->priv->show_all)
     show_headings = FALSE;
 
   if (self->priv->show_default && self->priv->content_type)
     {
-      default_app = g_app_info_get_default_for_type (self->priv->content_type, FALSE);
-
       if (default_app != NULL)
         {
           gtk_app_chooser_add_default (self, default_app);
@@ -717,9 +872,6 @@ gtk_app_chooser_widget_real_add_items (GtkAppChooserWidget *self)
 #ifndef G_OS_WIN32
   if ((self->priv->content_type && self->priv->show_recommended) || self->priv->show_all)
     {
-      if (self->priv->content_type)
-	recommended_apps = g_app_info_get_recommended_for_type (self->priv->content_type);
-
       apps_added |= gtk_app_chooser_widget_add_section (self, _("Recommended Applications"),
                                                         show_headings,
                                                         !self->priv->show_all, /* mark as recommended */
@@ -732,9 +884,6 @@ gtk_app_chooser_widget_real_add_items (GtkAppChooserWidget *self)
 
   if ((self->priv->content_type && self->priv->show_fallback) || self->priv->show_all)
     {
-      if (self->priv->content_type)
-	fallback_apps = g_app_info_get_fallback_for_type (self->priv->content_type);
-
       apps_added |= gtk_app_chooser_widget_add_section (self, _("Related Applications"),
                                                         show_headings,
                                                         FALSE, /* mark as recommended */
@@ -747,8 +896,6 @@ gtk_app_chooser_widget_real_add_items (GtkAppChooserWidget *self)
 
   if (self->priv->show_other || self->priv->show_all)
     {
-      all_applications = g_app_info_get_all ();
-
       apps_added |= gtk_app_chooser_widget_add_section (self, _("Other Applications"),
                                                         show_headings,
                                                         FALSE,
@@ -763,15 +910,63 @@ gtk_app_chooser_widget_real_add_items (GtkAppChooserWidget *self)
 
   gtk_app_chooser_widget_select_first (self);
 
-  if (default_app != NULL)
-    g_object_unref (default_app);
-
-  g_list_free_full (all_applications, g_object_unref);
-  g_list_free_full (recommended_apps, g_object_unref);
-  g_list_free_full (fallback_apps, g_object_unref);
   g_list_free (exclude_apps);
 }
 
+static void
+gtk_app_chooser_widget_real_add_items (GtkAppChooserWidget *self)
+{
+  TypedApps *typed_apps = NULL;
+  gboolean want_typed, want_all;
+  AppsQuery *query;
+  GTask *task;
+
+  want_typed = self->priv->content_type != NULL &&
+               (self->priv->show_default || self->priv->show_recommended ||
+                self->priv->show_fallback || self->priv->show_all);
+  want_all = self->priv->show_other || self->priv->show_all;
+
+  if (want_typed)
+    typed_apps = g_hash_table_lookup (typed_apps_cache, self->priv->content_type);
+
+  if ((!want_typed || typed_apps != NULL) &&
+      (!want_all || all_apps_cached))
+    {
+      if (self->priv->cancellable)
+        {
+          g_cancellable_cancel (self->priv->cancellable);
+          g_clear_object (&self->priv->cancellable);
+        }
+
+      gtk_app_chooser_widget_add_apps (self, typed_apps, all_apps_cache);
+      return;
+    }
+
+  /* Show neither the applications nor the "no applications" label
+   * until we know which it is.
+   */
+  gtk_widget_set_visible (self->priv->no_apps, FALSE);
+
+  if (self->priv->cancellable)
+    {
+      g_cancellable_cancel (self->priv->cancellable);
+      g_object_unref (self->priv->cancellable);
+    }
+  self->priv->cancellable = g_cancellable_new ();
+
+  query = g_slice_new0 (AppsQuery);
+  if (want_typed && typed_apps == NULL)
+    query->content_type = g_strdup (self->priv->content_type);
+  query->want_all = want_all && !all_apps_cached;
+  query->generation = apps_cache_generation;
+
+  task = g_task_new (self, self->priv->cancellable, lookup_apps_done, NULL);
+  g_task_set_source_tag (task, gtk_app_chooser_widget_real_add_items);
+  g_task_set_task_data (task, query, apps_query_free);
+  g_task_run_in_thread (task, lookup_apps_thread);
+  g_object_unref (task);
+}
+
 static void
 gtk_app_chooser_widget_initialize_items (GtkAppChooserWidget *self)
 {
@@ -897,6 +1092,12 @@ gtk_app_chooser_widget_dispose (GObject *object)
 
   g_clear_object (&priv->selected_app_info);
 
+  if (priv->cancellable)
+    {
+      g_cancellable_cancel (priv->cancellable);
+      g_clear_object (&priv->cancellable);
+    }
+
   if (priv->overlay)
     {
       gtk_widget_unparent (priv->overlay);
@@ -970,6 +1171,7 @@ gtk_app_chooser_widget_class_init (GtkAppChooserWidgetClass *klass)
   widget_class->size_allocate = gtk_app_chooser_widget_size_allocate;
   widget_class->snapshot = gtk_app_chooser_widget_snapshot;
 
+  apps_cache_init ();
 
   g_object_class_override_property (gobject_class, PROP_CONTENT_TYPE, "content-type");
 
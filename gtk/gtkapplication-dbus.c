@@ -25,6 +25,7 @@
 #include "gtkapplicationprivate.h"
 #include "gtksettings.h"
 #include "gtkprivate.h"
+#include "gtkstartuptraceprivate.h"
 
 G_DEFINE_TYPE (GtkApplicationImplDBus, gtk_application_impl_dbus, GTK_TYPE_APPLICATION_IMPL)
 
@@ -119,25 +120,35 @@ client_proxy_signal (GDBusProxy  *proxy,
     }
 }
 
-static GDBusProxy*
-gtk_application_get_proxy_if_service_present (GDBusConnection *connection,
-                                              GDBusProxyFlags  flags,
-                                              const gchar     *bus_name,
-                                              const gchar     *object_path,
-                                              const gchar     *interface,
-                                              GError         **error)
+static void
+gtk_application_get_proxy_if_service_present (GDBusConnection     *connection,
+                                              GDBusProxyFlags      flags,
+                                              const gchar         *bus_name,
+                                              const gchar         *object_path,
+                                              const gchar         *interface,
+                                              GCancellable        *cancellable,
+                                              GAsyncReadyCallback  callback,
+                                              gpointer             user_data)
+{
+  g_dbus_proxy_new (connection,
+                    flags,
+                    NULL,
+                    bus_name,
+                    object_path,
+                    interface,
+                    cancellable,
+                    callback,
+                    user_data);
+}
+
+static GDBusProxy *
+gtk_application_get_proxy_if_service_present_finish (GAsyncResult  *result,
+                                                     GError       **error)
 {
   GDBusProxy *proxy;
   gchar *owner;
 
-  proxy = g_dbus_proxy_new_sync (connection,
-                                 flags,
-                                 NULL,
-                                 bus_name,
-                                 object_path,
-                                 interface,
-                                 NULL,
-                                 error);
+  proxy = g_dbus_proxy_new_finish (result, error);
 
   if (!proxy)
     return NULL;
@@ -146,9 +157,9 @@ gtk_application_get_proxy_if_service_present (GDBusConnection *connection,
   owner = g_dbus_proxy_get_name_owner (proxy);
   if (owner == NULL)
     {
-      g_clear_object (&proxy);
       g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_NAME_HAS_NO_OWNER,
-                   "The name %s is not owned", bus_name);
+                   "The name %s is not owned", g_dbus_proxy_get_name (proxy));
+      g_clear_object (&proxy);
     }
   else
     g_free (owner);
@@ -271,111 +282,304 @@ create_monitor_cb (GObject      *source,
   g_variant_unref (ret);
 }
 
+/* Inhibitors are sent to the session manager or the portal once we know
+ * which one there is, until then they are queued. Cookies are handed out
+ * by us, so that they can be returned before the reply arrives.
+ */
+typedef enum {
+  INHIBIT_QUEUED,
+  INHIBIT_SENT,
+  INHIBIT_ACTIVE,
+  INHIBIT_FAILED
+} InhibitState;
+
+static int next_cookie;
+
+typedef struct {
+  int cookie;
+  InhibitState state;
+  gboolean released;            /* uninhibited while it was sent */
+
+  GtkApplicationInhibitFlags flags;
+  char *reason;
+  GVariant *window_id;
+
+  GDBusProxy *proxy;
+  gboolean portal;
+  guint sm_cookie;
+  char *handle;
+} InhibitHandle;
+
 static void
-gtk_application_impl_dbus_startup (GtkApplicationImpl *impl,
-                                   gboolean            register_session)
+inhibit_handle_free (gpointer data)
 {
-  GtkApplicationImplDBus *dbus = (GtkApplicationImplDBus *) impl;
+  InhibitHandle *handle = data;
+
+  g_free (handle->reason);
+  g_variant_unref (handle->window_id);
+  g_clear_object (&handle->proxy);
+  g_free (handle->handle);
+  g_free (handle);
+}
+
+static void
+inhibit_handle_release (InhibitHandle *handle)
+{
+  if (handle->portal)
+    {
+      g_dbus_connection_call (g_dbus_proxy_get_connection (handle->proxy),
+                              PORTAL_BUS_NAME,
+                              handle->handle,
+                              PORTAL_REQUEST_INTERFACE,
+                              "Close",
+                              g_variant_new ("()"),
+                              G_VARIANT_TYPE_UNIT,
+                              G_DBUS_CALL_FLAGS_NONE,
+                              G_MAXINT,
+                              NULL, NULL, NULL);
+    }
+  else
+    {
+      g_dbus_proxy_call (handle->proxy,
+                         "Uninhibit",
+                         g_variant_new ("(u)", handle->sm_cookie),
+                         G_DBUS_CALL_FLAGS_NONE,
+                         G_MAXINT,
+                         NULL, NULL, NULL);
+    }
+}
+
+static void
+inhibit_done (GObject      *source,
+              GAsyncResult *result,
+              gpointer      data)
+{
+  InhibitHandle *handle = data;
+  static gboolean warned = FALSE;
   GError *error = NULL;
   GVariant *res;
-  gboolean same_bus;
-  const char *bus_name;
-  const char *client_interface;
 
-#ifndef G_HAS_CONSTRUCTORS
-  stash_desktop_autostart_id ();
-#endif
+  res = g_dbus_proxy_call_finish (G_DBUS_PROXY (source), result, &error);
+  if (res)
+    {
+      if (handle->portal)
+        g_variant_get (res, "(o)", &handle->handle);
+      else
+        g_variant_get (res, "(u)", &handle->sm_cookie);
+      g_variant_unref (res);
 
-  dbus->session = g_application_get_dbus_connection (G_APPLICATION (impl->application));
+      handle->state = INHIBIT_ACTIVE;
+    }
+  else
+    {
+      if (!warned)
+        {
+          g_warning ("Calling %s.Inhibit failed: %s",
+                     g_dbus_proxy_get_interface_name (G_DBUS_PROXY (source)),
+                     error->message);
+          warned = TRUE;
+        }
+      g_error_free (error);
 
-  if (!dbus->session)
-    goto out;
+      handle->state = INHIBIT_FAILED;
+    }
 
-  dbus->application_id = g_application_get_application_id (G_APPLICATION (impl->application));
-  dbus->object_path = g_application_get_dbus_object_path (G_APPLICATION (impl->application));
-  dbus->unique_name = g_dbus_connection_get_unique_name (dbus->session);
+  /* Nobody knows about the handle anymore */
+  if (handle->released)
+    {
+      if (handle->state == INHIBIT_ACTIVE)
+        inhibit_handle_release (handle);
+      inhibit_handle_free (handle);
+    }
+}
 
-  if (gdk_should_use_portal ())
-    goto out;
+static void
+inhibit_handle_send (GtkApplicationImplDBus *dbus,
+                     InhibitHandle          *handle)
+{
+  if (dbus->sm_proxy)
+    {
+      handle->proxy = g_object_ref (dbus->sm_proxy);
+      g_dbus_proxy_call (handle->proxy,
+                         "Inhibit",
+                         g_variant_new ("(s@usu)",
+                                        dbus->application_id,
+                                        handle->window_id,
+                                        handle->reason,
+                                        handle->flags),
+                         G_DBUS_CALL_FLAGS_NONE,
+                         G_MAXINT,
+                         NULL,
+                         inhibit_done, handle);
+      handle->state = INHIBIT_SENT;
+    }
+  else if (dbus->inhibit_proxy)
+    {
+      GVariantBuilder options;
 
-  g_debug ("Connecting to session manager");
+      g_variant_builder_init (&options, G_VARIANT_TYPE_VARDICT);
+      g_variant_builder_add (&options, "{sv}", "reason", g_variant_new_string (handle->reason));
+
+      handle->proxy = g_object_ref (dbus->inhibit_proxy);
+      handle->portal = TRUE;
+      g_dbus_proxy_call (handle->proxy,
+                         "Inhibit",
+                         g_variant_new ("(su@a{sv})",
+                                        "", /* window */
+                                        handle->flags,
+                                        g_variant_builder_end (&options)),
+                         G_DBUS_CALL_FLAGS_NONE,
+                         G_MAXINT,
+                         NULL,
+                         inhibit_done, handle);
+      handle->state = INHIBIT_SENT;
+    }
+  else
+    handle->state = INHIBIT_FAILED;
+}
 
-  /* Try the GNOME session manager first */
-  dbus->sm_proxy = gtk_application_get_proxy_if_service_present (dbus->session,
-                                                                 G_DBUS_PROXY_FLAGS_DO_NOT_AUTO_START |
-                                                                 G_DBUS_PROXY_FLAGS_DO_NOT_LOAD_PROPERTIES |
-                                                                 G_DBUS_PROXY_FLAGS_DO_NOT_CONNECT_SIGNALS,
-                                                                 GNOME_DBUS_NAME,
-                                                                 GNOME_DBUS_OBJECT_PATH,
-                                                                 GNOME_DBUS_INTERFACE,
-                                                                 &error);
+/* Called once we know whether to use the session manager or the portal */
+static void
+session_setup_done (GtkApplicationImplDBus *dbus)
+{
+  GSList *l;
 
-  if (error)
+  dbus->session_pending = FALSE;
+
+  gtk_startup_trace_end_async (dbus->session_trace_start, "Session manager setup",
+                               dbus->sm_proxy ? g_dbus_proxy_get_name (dbus->sm_proxy)
+                                              : (dbus->inhibit_proxy ? PORTAL_BUS_NAME : NULL));
+
+  for (l = dbus->inhibit_handles; l; l = l->next)
     {
-      g_debug ("Failed to get the GNOME session proxy: %s", error->message);
-      g_clear_error (&error);
+      InhibitHandle *handle = l->data;
+
+      if (handle->state == INHIBIT_QUEUED)
+        inhibit_handle_send (dbus, handle);
     }
+}
 
-  if (!dbus->sm_proxy)
+static void
+inhibit_portal_proxy_ready (GObject      *source,
+                            GAsyncResult *result,
+                            gpointer      data)
+{
+  GtkApplicationImplDBus *dbus = data;
+  GError *error = NULL;
+  char *token;
+  GVariantBuilder opt_builder;
+
+  dbus->inhibit_proxy = gtk_application_get_proxy_if_service_present_finish (result, &error);
+  if (error)
     {
-      /* Fallback to trying the Xfce session manager */
-      dbus->sm_proxy = gtk_application_get_proxy_if_service_present (dbus->session,
-                                                                     G_DBUS_PROXY_FLAGS_DO_NOT_AUTO_START |
-                                                                     G_DBUS_PROXY_FLAGS_DO_NOT_LOAD_PROPERTIES |
-                                                                     G_DBUS_PROXY_FLAGS_DO_NOT_CONNECT_SIGNALS,
-                                                                     XFCE_DBUS_NAME,
-                                                                     XFCE_DBUS_OBJECT_PATH,
-                                                                     XFCE_DBUS_INTERFACE,
-                                                                     &error);
-
-      if (error)
+      if (g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
         {
-          g_debug ("Failed to get the Xfce session proxy: %s", error->message);
-          g_clear_error (&error);
-          goto out;
+          g_error_free (error);
+          return;
         }
-    }
 
-  if (!register_session)
-    goto out;
+      g_debug ("Failed to get an inhibit portal proxy: %s", error->message);
+      g_clear_error (&error);
+      session_setup_done (dbus);
+      return;
+    }
 
-  dbus->ss_proxy = gtk_application_get_proxy_if_service_present (dbus->session,
-                                                                 G_DBUS_PROXY_FLAGS_DO_NOT_AUTO_START |
-                                                                 G_DBUS_PROXY_FLAGS_DO_NOT_LOAD_PROPERTIES |
-                                                                 G_DBUS_PROXY_FLAGS_NONE,
-                                                                 GNOME_SCREENSAVER_DBUS_NAME,
-                                                                 GNOME_SCREENSAVER_DBUS_OBJECT_PATH,
-                                                                 GNOME_SCREENSAVER_DBUS_INTERFACE,
-                                                                 &error);
-  if (error)
+  if (dbus->register_session)
     {
-      g_debug ("Failed to get the GNOME screensaver proxy: %s", error->message);
-      g_clear_error (&error);
-      g_clear_object (&dbus->ss_proxy);
+      /* Monitor screensaver state */
+
+      dbus->session_id = gtk_get_portal_session_path (dbus->session, &token);
+      dbus->state_changed_handler =
+          g_dbus_connection_signal_subscribe (dbus->session,
+                                              PORTAL_BUS_NAME,
+                                              PORTAL_INHIBIT_INTERFACE,
+                                              "StateChanged",
+                                              PORTAL_OBJECT_PATH,
+                                              NULL,
+                                              G_DBUS_SIGNAL_FLAGS_NO_MATCH_RULE,
+                                              screensaver_signal_portal,
+                                              dbus,
+                                              NULL);
+      g_variant_builder_init (&opt_builder, G_VARIANT_TYPE_VARDICT);
+      g_variant_builder_add (&opt_builder, "{sv}",
+                             "session_handle_token", g_variant_new_string (token));
+      g_dbus_proxy_call (dbus->inhibit_proxy,
+                         "CreateMonitor",
+                         g_variant_new ("(sa{sv})", "", &opt_builder),
+                         G_DBUS_CALL_FLAGS_NONE,
+                         G_MAXINT,
+                         NULL,
+                         create_monitor_cb, dbus);
+      g_free (token);
     }
 
-  if (dbus->ss_proxy)
+  session_setup_done (dbus);
+}
+
+static void
+connect_to_inhibit_portal (GtkApplicationImplDBus *dbus)
+{
+  gtk_application_get_proxy_if_service_present (dbus->session,
+                                                G_DBUS_PROXY_FLAGS_NONE,
+                                                PORTAL_BUS_NAME,
+                                                PORTAL_OBJECT_PATH,
+                                                PORTAL_INHIBIT_INTERFACE,
+                                                dbus->cancellable,
+                                                inhibit_portal_proxy_ready,
+                                                dbus);
+}
+
+static void
+client_proxy_ready (GObject      *source,
+                    GAsyncResult *result,
+                    gpointer      data)
+{
+  GtkApplicationImplDBus *dbus = data;
+  GDBusProxy *proxy;
+  GError *error = NULL;
+
+  proxy = g_dbus_proxy_new_finish (result, &error);
+  if (error)
     {
-      g_signal_connect (dbus->ss_proxy, "g-signal",
-                        G_CALLBACK (screensaver_signal_session), impl->application);
+      if (!g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+        {
+          g_warning ("Failed to get client proxy: %s", error->message);
+          g_free (dbus->client_path);
+          dbus->client_path = NULL;
+        }
+      g_error_free (error);
+      return;
     }
 
-  g_debug ("Registering client '%s' '%s'", dbus->application_id, client_id);
+  dbus->client_proxy = proxy;
+  g_signal_connect (dbus->client_proxy, "g-signal", G_CALLBACK (client_proxy_signal), dbus);
+}
 
-  res = g_dbus_proxy_call_sync (dbus->sm_proxy,
-                                "RegisterClient",
-                                g_variant_new ("(ss)", dbus->application_id, client_id),
-                                G_DBUS_CALL_FLAGS_NONE,
-                                G_MAXINT,
-                                NULL,
-                                &error);
+static void
+register_client_done (GObject      *source,
+                      GAsyncResult *result,
+                      gpointer      data)
+{
+  GtkApplicationImplDBus *dbus = data;
+  GError *error = NULL;
+  GVariant *res;
+  const char *bus_name;
+  const char *client_interface;
 
+  res = g_dbus_proxy_call_finish (G_DBUS_PROXY (source), result, &error);
   if (error)
     {
+      if (g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+        {
+          g_error_free (error);
+          return;
+        }
+
       g_warning ("Failed to register client: %s", error->message);
       g_clear_error (&error);
       g_clear_object (&dbus->sm_proxy);
-      goto out;
+      connect_to_inhibit_portal (dbus);
+      return;
     }
 
   g_variant_get (res, "(o)", &dbus->client_path);
@@ -394,27 +598,195 @@ gtk_application_impl_dbus_startup (GtkApplicationImpl *impl,
       client_interface = XFCE_DBUS_CLIENT_INTERFACE;
     }
 
-  dbus->client_proxy = g_dbus_proxy_new_sync (dbus->session, 0,
-                                              NULL,
-                                              bus_name,
-                                              dbus->client_path,
-                                              client_interface,
-                                              NULL,
-                                              &error);
+  g_dbus_proxy_new (dbus->session, 0,
+                    NULL,
+                    bus_name,
+                    dbus->client_path,
+                    client_interface,
+                    dbus->cancellable,
+                    client_proxy_ready,
+                    dbus);
+
+  session_setup_done (dbus);
+}
+
+static void
+ss_proxy_ready (GObject      *source,
+                GAsyncResult *result,
+                gpointer      data)
+{
+  GtkApplicationImplDBus *dbus = data;
+  GError *error = NULL;
+
+  dbus->ss_proxy = gtk_application_get_proxy_if_service_present_finish (result, &error);
+  if (error)
+    {
+      if (!g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+        g_debug ("Failed to get the GNOME screensaver proxy: %s", error->message);
+      g_error_free (error);
+      return;
+    }
+
+  g_signal_connect (dbus->ss_proxy, "g-signal",
+                    G_CALLBACK (screensaver_signal_session), dbus->impl.application);
+}
+
+static void
+sm_proxy_found (GtkApplicationImplDBus *dbus)
+{
+  if (!dbus->register_session)
+    {
+      session_setup_done (dbus);
+      return;
+    }
+
+  /* The screensaver proxy and the registration don't depend on each other */
+  gtk_application_get_proxy_if_service_present (dbus->session,
+                                                G_DBUS_PROXY_FLAGS_DO_NOT_AUTO_START |
+                                                G_DBUS_PROXY_FLAGS_DO_NOT_LOAD_PROPERTIES |
+                                                G_DBUS_PROXY_FLAGS_NONE,
+                                                GNOME_SCREENSAVER_DBUS_NAME,
+                                                GNOME_SCREENSAVER_DBUS_OBJECT_PATH,
+                                                GNOME_SCREENSAVER_DBUS_INTERFACE,
+                                                dbus->cancellable,
+                                                ss_proxy_ready,
+                                                dbus);
+
+  g_debug ("Registering client '%s' '%s'", dbus->application_id, client_id);
+
+  g_dbus_proxy_call (dbus->sm_proxy,
+                     "RegisterClient",
+                     g_variant_new ("(ss)", dbus->application_id, client_id),
+                     G_DBUS_CALL_FLAGS_NONE,
+                     G_MAXINT,
+                     dbus->cancellable,
+                     register_client_done,
+                     dbus);
+}
+
+static void
+xfce_sm_proxy_ready (GObject      *source,
+                     GAsyncResult *result,
+                     gpointer      data)
+{
+  GtkApplicationImplDBus *dbus = data;
+  GError *error = NULL;
+
+  dbus->sm_proxy = gtk_application_get_proxy_if_service_present_finish (result, &error);
   if (error)
     {
-      g_warning ("Failed to get client proxy: %s", error->message);
+      if (g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+        {
+          g_error_free (error);
+          return;
+        }
+
+      g_debug ("Failed to get the Xfce session proxy: %s", error->message);
       g_clear_error (&error);
-      g_free (dbus->client_path);
-      dbus->client_path = NULL;
+      connect_to_inhibit_portal (dbus);
+      return;
+    }
+
+  sm_proxy_found (dbus);
+}
+
+static void
+gnome_sm_proxy_ready (GObject      *source,
+                      GAsyncResult *result,
+                      gpointer      data)
+{
+  GtkApplicationImplDBus *dbus = data;
+  GError *error = NULL;
+
+  dbus->sm_proxy = gtk_application_get_proxy_if_service_present_finish (result, &error);
+  if (error)
+    {
+      if (g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+        {
+          g_error_free (error);
+          return;
+        }
+
+      g_debug ("Failed to get the GNOME session proxy: %s", error->message);
+      g_clear_error (&error);
+
+      /* Fallback to trying the Xfce session manager */
+      gtk_application_get_proxy_if_service_present (dbus->session,
+                                                    G_DBUS_PROXY_FLAGS_DO_NOT_AUTO_START |
+                                                    G_DBUS_PROXY_FLAGS_DO_NOT_LOAD_PROPERTIES |
+                                                    G_DBUS_PROXY_FLAGS_DO_NOT_CONNECT_SIGNALS,
+                                                    XFCE_DBUS_NAME,
+                                                    XFCE_DBUS_OBJECT_PATH,
+                                                    XFCE_DBUS_INTERFACE,
+                                                    dbus->cancellable,
+                                                    xfce_sm_proxy_ready,
+                                                    dbus);
+      return;
+    }
+
+  sm_proxy_found (dbus);
+}
+
+static void
+gtk_application_impl_dbus_startup (GtkApplicationImpl *impl,
+                                   gboolean            register_session)
+{
+  GtkApplicationImplDBus *dbus = (GtkApplicationImplDBus *) impl;
+  GVariant *res;
+  gboolean same_bus;
+  gint64 trace_start;
+
+#ifndef G_HAS_CONSTRUCTORS
+  stash_desktop_autostart_id ();
+#endif
+
+  trace_start = gtk_startup_trace_begin ();
+
+  dbus->session = g_application_get_dbus_connection (G_APPLICATION (impl->application));
+
+  if (!dbus->session)
+    goto out;
+
+  dbus->application_id = g_application_get_application_id (G_APPLICATION (impl->application));
+  dbus->object_path = g_application_get_dbus_object_path (G_APPLICATION (impl->application));
+  dbus->unique_name = g_dbus_connection_get_unique_name (dbus->session);
+
+  /* None of the session manager calls block startup, their replies
+   * are handled as they come in. Calls are only chained where they
+   * depend on each other.
+   */
+  dbus->cancellable = g_cancellable_new ();
+  dbus->register_session = register_session;
+  dbus->session_pending = TRUE;
+  dbus->session_trace_start = gtk_startup_trace_begin_async ();
+
+  if (gdk_should_use_portal ())
+    {
+      connect_to_inhibit_portal (dbus);
       goto out;
     }
 
-  g_signal_connect (dbus->client_proxy, "g-signal", G_CALLBACK (client_proxy_signal), dbus);
+  g_debug ("Connecting to session manager");
+
+  /* Try the GNOME session manager first */
+  gtk_application_get_proxy_if_service_present (dbus->session,
+                                                G_DBUS_PROXY_FLAGS_DO_NOT_AUTO_START |
+                                                G_DBUS_PROXY_FLAGS_DO_NOT_LOAD_PROPERTIES |
+                                                G_DBUS_PROXY_FLAGS_DO_NOT_CONNECT_SIGNALS,
+                                                GNOME_DBUS_NAME,
+                                                GNOME_DBUS_OBJECT_PATH,
+                                                GNOME_DBUS_INTERFACE,
+                                                dbus->cancellable,
+                                                gnome_sm_proxy_ready,
+                                                dbus);
 
  out:
   same_bus = FALSE;
 
+  /* This one stays synchronous, gtk_application_prefers_app_menu()
+   * must not change its mind once startup is done. It is only made
+   * when XSETTINGS tell us the bus of the session.
+   */
   if (dbus->session)
     {
       const gchar *id;
@@ -460,53 +832,7 @@ gtk_application_impl_dbus_startup (GtkApplicationImpl *impl,
                   "gtk-shell-shows-menubar", FALSE,
                   NULL);
 
-  if (dbus->sm_proxy == NULL && dbus->session)
-    {
-      dbus->inhibit_proxy = gtk_application_get_proxy_if_service_present (dbus->session,
-                                                                          G_DBUS_PROXY_FLAGS_NONE,
-                                                                          PORTAL_BUS_NAME,
-                                                                          PORTAL_OBJECT_PATH,
-                                                                          PORTAL_INHIBIT_INTERFACE,
-                                                                          &error);
-      if (error)
-        {
-          g_debug ("Failed to get an inhibit portal proxy: %s", error->message);
-          g_clear_error (&error);
-          return;
-        }
-
-      if (register_session)
-        {
-          char *token;
-          GVariantBuilder opt_builder;
-
-          /* Monitor screensaver state */
-
-          dbus->session_id = gtk_get_portal_session_path (dbus->session, &token);
-          dbus->state_changed_handler =
-              g_dbus_connection_signal_subscribe (dbus->session,
-                                                  PORTAL_BUS_NAME,
-                                                  PORTAL_INHIBIT_INTERFACE,
-                                                  "StateChanged",
-                                                  PORTAL_OBJECT_PATH,
-                                                  NULL,
-                                                  G_DBUS_SIGNAL_FLAGS_NO_MATCH_RULE,
-                                                  screensaver_signal_portal,
-                                                  dbus,
-                                                  NULL);
-          g_variant_builder_init (&opt_builder, G_VARIANT_TYPE_VARDICT);
-          g_variant_builder_add (&opt_builder, "{sv}",
-                                 "session_handle_token", g_variant_new_string (token));
-          g_dbus_proxy_call (dbus->inhibit_proxy,
-                             "CreateMonitor",
-                             g_variant_new ("(sa{sv})", "", &opt_builder),
-                             G_DBUS_CALL_FLAGS_NONE,
-                             G_MAXINT,
-                             NULL,
-                             create_monitor_cb, dbus);
-          g_free (token);
-        }
-    }
+  gtk_startup_trace_end (trace_start, "D-Bus setup", NULL);
 }
 
 static void
@@ -519,17 +845,13 @@ GQuark gtk_application_impl_dbus_export_id_quark (void);
 G_DEFINE_QUARK (GtkApplicationImplDBus export id, gtk_application_impl_dbus_export_id)
 
 static void
-gtk_application_impl_dbus_window_added (GtkApplicationImpl *impl,
-                                        GtkWindow          *window)
+gtk_application_impl_dbus_export_window (GtkApplicationImplDBus *dbus,
+                                         GtkWindow              *window)
 {
-  GtkApplicationImplDBus *dbus = (GtkApplicationImplDBus *) impl;
   GActionGroup *actions;
   gchar *path;
   guint id;
 
-  if (!dbus->session || !GTK_IS_APPLICATION_WINDOW (window))
-    return;
-
   /* Export the action group of this window, based on its id */
   actions = gtk_application_window_get_action_group (GTK_APPLICATION_WINDOW (window));
 
@@ -540,6 +862,18 @@ gtk_application_impl_dbus_window_added (GtkApplicationImpl *impl,
   g_object_set_qdata (G_OBJECT (window), gtk_application_impl_dbus_export_id_quark (), GUINT_TO_POINTER (id));
 }
 
+static void
+gtk_application_impl_dbus_window_added (GtkApplicationImpl *impl,
+                                        GtkWindow          *window)
+{
+  GtkApplicationImplDBus *dbus = (GtkApplicationImplDBus *) impl;
+
+  if (!dbus->session || !dbus->exported || !GTK_IS_APPLICATION_WINDOW (window))
+    return;
+
+  gtk_application_impl_dbus_export_window (dbus, window);
+}
+
 static void
 gtk_application_impl_dbus_window_removed (GtkApplicationImpl *impl,
                                           GtkWindow          *window)
@@ -605,7 +939,10 @@ gtk_application_impl_dbus_set_app_menu (GtkApplicationImpl *impl,
 {
   GtkApplicationImplDBus *dbus = (GtkApplicationImplDBus *) impl;
 
-  gtk_application_impl_dbus_publish_menu (dbus, "appmenu", app_menu, &dbus->app_menu_id, &dbus->app_menu_path);
+  g_set_object (&dbus->app_menu, app_menu);
+
+  if (dbus->exported)
+    gtk_application_impl_dbus_publish_menu (dbus, "appmenu", app_menu, &dbus->app_menu_id, &dbus->app_menu_path);
 }
 
 static void
@@ -614,7 +951,41 @@ gtk_application_impl_dbus_set_menubar (GtkApplicationImpl *impl,
 {
   GtkApplicationImplDBus *dbus = (GtkApplicationImplDBus *) impl;
 
-  gtk_application_impl_dbus_publish_menu (dbus, "menubar", menubar, &dbus->menubar_id, &dbus->menubar_path);
+  g_set_object (&dbus->menubar, menubar);
+
+  if (dbus->exported)
+    gtk_application_impl_dbus_publish_menu (dbus, "menubar", menubar, &dbus->menubar_id, &dbus->menubar_path);
+}
+
+/* Nobody can look at our menus and window actions before there is a
+ * window to find them from, so exporting them waits until the first
+ * window is realized. The paths are set on the window there.
+ */
+static void
+gtk_application_impl_dbus_handle_window_realize (GtkApplicationImpl *impl,
+                                                 GtkWindow          *window)
+{
+  GtkApplicationImplDBus *dbus = (GtkApplicationImplDBus *) impl;
+  GList *l;
+  gint64 trace_start;
+
+  if (!dbus->session || dbus->exported)
+    return;
+
+  trace_start = gtk_startup_trace_begin ();
+
+  dbus->exported = TRUE;
+
+  gtk_application_impl_dbus_publish_menu (dbus, "appmenu", dbus->app_menu, &dbus->app_menu_id, &dbus->app_menu_path);
+  gtk_application_impl_dbus_publish_menu (dbus, "menubar", dbus->menubar, &dbus->menubar_id, &dbus->menubar_path);
+
+  for (l = gtk_application_get_windows (impl->application); l; l = l->next)
+    {
+      if (GTK_IS_APPLICATION_WINDOW (l->data))
+        gtk_application_impl_dbus_export_window (dbus, l->data);
+    }
+
+  gtk_startup_trace_end (trace_start, "Export menus and actions", NULL);
 }
 
 static GVariant *
@@ -632,22 +1003,6 @@ gtk_application_impl_dbus_get_window_system_id (GtkApplicationImplDBus *dbus,
   return GTK_APPLICATION_IMPL_DBUS_GET_CLASS (dbus)->get_window_system_id (dbus, window);
 }
 
-static int next_cookie;
-
-typedef struct {
-  char *handle;
-  int cookie;
-} InhibitHandle;
-
-static void
-inhibit_handle_free (gpointer data)
-{
-  InhibitHandle *handle = data;
-
-  g_free (handle->handle);
-  g_free (handle);
-}
-
 static guint
 gtk_application_impl_dbus_inhibit (GtkApplicationImpl         *impl,
                                    GtkWindow                  *window,
@@ -655,89 +1010,28 @@ gtk_application_impl_dbus_inhibit (GtkApplicationImpl         *impl,
                                    const gchar                *reason)
 {
   GtkApplicationImplDBus *dbus = (GtkApplicationImplDBus *) impl;
-  GVariant *res;
-  GError *error = NULL;
-  guint cookie;
-  static gboolean warned = FALSE;
+  InhibitHandle *handle;
 
-  if (dbus->sm_proxy)
-    {
-      res = g_dbus_proxy_call_sync (dbus->sm_proxy,
-                                    "Inhibit",
-                                    g_variant_new ("(s@usu)",
-                                                   dbus->application_id,
-                                                   window ? gtk_application_impl_dbus_get_window_system_id (dbus, window) : g_variant_new_uint32 (0),
-                                                   reason ? reason : "",
-                                                   flags),
-                                    G_DBUS_CALL_FLAGS_NONE,
-                                    G_MAXINT,
-                                    NULL,
-                                    &error);
-
-      if (res)
-        {
-          g_variant_get (res, "(u)", &cookie);
-          g_variant_unref (res);
-          return cookie;
-        }
+  handle = g_new0 (InhibitHandle, 1);
+  handle->state = INHIBIT_QUEUED;
+  handle->flags = flags;
+  handle->reason = g_strdup (reason ? reason : "");
+  handle->window_id = g_variant_ref_sink (window ? gtk_application_impl_dbus_get_window_system_id (dbus, window)
+                                                 : g_variant_new_uint32 (0));
 
-      if (error)
-        {
-          if (!warned)
-            {
-              g_warning ("Calling %s.Inhibit failed: %s",
-                         g_dbus_proxy_get_interface_name (dbus->sm_proxy),
-                         error->message);
-              warned = TRUE;
-            }
-          g_clear_error (&error);
-        }
-    }
-  else if (dbus->inhibit_proxy)
-    {
-      GVariantBuilder options;
-
-      g_variant_builder_init (&options, G_VARIANT_TYPE_VARDICT);
-      g_variant_builder_add (&options, "{sv}", "reason", g_variant_new_string (reason));
-      res = g_dbus_proxy_call_sync (dbus->inhibit_proxy,
-                                    "Inhibit",
-                                    g_variant_new ("(su@a{sv})",
-                                                   "", /* window */
-                                                   flags,
-                                                   g_variant_builder_end (&options)),
-                                    G_DBUS_CALL_FLAGS_NONE,
-                                    G_MAXINT,
-                                    NULL,
-                                    &error);
-      if (res)
-        {
-          InhibitHandle *handle;
-
-          handle = g_new (InhibitHandle, 1);
-          handle->cookie = ++next_cookie;
-
-          g_variant_get (res, "(o)", &handle->handle);
-          g_variant_unref (res);
-
-          dbus->inhibit_handles = g_slist_prepend (dbus->inhibit_handles, handle);
+  if (!dbus->session_pending)
+    inhibit_handle_send (dbus, handle);
 
-          return handle->cookie;
-        }
-
-      if (error)
-        {
-          if (!warned)
-            {
-              g_warning ("Calling %s.Inhibit failed: %s",
-                         g_dbus_proxy_get_interface_name (dbus->inhibit_proxy),
-                         error->message);
-              warned = TRUE;
-            }
-          g_clear_error (&error);
-        }
+  if (handle->state == INHIBIT_FAILED)
+    {
+      inhibit_handle_free (handle);
+      return 0;
     }
 
-  return 0;
+  handle->cookie = ++next_cookie;
+  dbus->inhibit_handles = g_slist_prepend (dbus->inhibit_handles, handle);
+
+  return handle->cookie;
 }
 
 static void
@@ -745,40 +1039,28 @@ gtk_application_impl_dbus_uninhibit (GtkApplicationImpl *impl,
                                      guint               cookie)
 {
   GtkApplicationImplDBus *dbus = (GtkApplicationImplDBus *) impl;
+  GSList *l;
 
-  if (dbus->sm_proxy)
-    {
-      g_dbus_proxy_call (dbus->sm_proxy,
-                         "Uninhibit",
-                         g_variant_new ("(u)", cookie),
-                         G_DBUS_CALL_FLAGS_NONE,
-                         G_MAXINT,
-                         NULL, NULL, NULL);
-    }
-  else if (dbus->inhibit_proxy)
+  for (l = dbus->inhibit_handles; l; l = l->next)
     {
-      GSList *l;
+      InhibitHandle *handle = l->data;
+
+      if (handle->cookie != cookie)
+        continue;
 
-      for (l = dbus->inhibit_handles; l; l = l->next)
+      dbus->inhibit_handles = g_slist_delete_link (dbus->inhibit_handles, l);
+
+      if (handle->state == INHIBIT_SENT)
         {
-          InhibitHandle *handle = l->data;
-          if (handle->cookie == cookie)
-            {
-              g_dbus_connection_call (dbus->session,
-                                      PORTAL_BUS_NAME,
-                                      handle->handle,
-                                      PORTAL_REQUEST_INTERFACE,
-                                      "Close",
-                                      g_variant_new ("()"),
-                                      G_VARIANT_TYPE_UNIT,
-                                      G_DBUS_CALL_FLAGS_NONE,
-                                      G_MAXINT,
-                                      NULL, NULL, NULL);
-              dbus->inhibit_handles = g_slist_remove (dbus->inhibit_handles, handle);
-              inhibit_handle_free (handle);
-              break;
-            }
+          /* inhibit_done() takes care of it */
+          handle->released = TRUE;
+          return;
         }
+
+      if (handle->state == INHIBIT_ACTIVE)
+        inhibit_handle_release (handle);
+      inhibit_handle_free (handle);
+      return;
     }
 }
 
@@ -823,6 +1105,7 @@ static void
 gtk_application_impl_dbus_finalize (GObject *object)
 {
   GtkApplicationImplDBus *dbus = (GtkApplicationImplDBus *) object;
+  GSList *l;
 
   if (dbus->session_id)
     {
@@ -840,11 +1123,31 @@ gtk_application_impl_dbus_finalize (GObject *object)
     g_dbus_connection_signal_unsubscribe (dbus->session,
                                           dbus->state_changed_handler);
 
+  if (dbus->cancellable)
+    {
+      g_cancellable_cancel (dbus->cancellable);
+      g_object_unref (dbus->cancellable);
+    }
+
+  for (l = dbus->inhibit_handles; l; l = l->next)
+    {
+      InhibitHandle *handle = l->data;
+
+      if (handle->state == INHIBIT_SENT)
+        handle->released = TRUE;
+      else
+        inhibit_handle_free (handle);
+    }
+  g_slist_free (dbus->inhibit_handles);
+
   g_clear_object (&dbus->inhibit_proxy);
-  g_slist_free_full (dbus->inhibit_handles, inhibit_handle_free);
+  g_clear_object (&dbus->app_menu);
   g_free (dbus->app_menu_path);
+  g_clear_object (&dbus->menubar);
   g_free (dbus->menubar_path);
   g_clear_object (&dbus->sm_proxy);
+  g_clear_object (&dbus->client_proxy);
+  g_free (dbus->client_path);
   g_clear_object (&dbus->ss_proxy);
 
   G_OBJECT_CLASS (gtk_application_impl_dbus_parent_class)->finalize (object);
@@ -863,6 +1166,7 @@ gtk_application_impl_dbus_class_init (GtkApplicationImplDBusClass *class)
   impl_class->window_added = gtk_application_impl_dbus_window_added;
   impl_class->window_removed = gtk_application_impl_dbus_window_removed;
   impl_class->active_window_changed = gtk_application_impl_dbus_active_window_changed;
+  impl_class->handle_window_realize = gtk_application_impl_dbus_handle_window_realize;
   impl_class->set_app_menu = gtk_application_impl_dbus_set_app_menu;
   impl_class->set_menubar = gtk_application_impl_dbus_set_menubar;
   impl_class->inhibit = gtk_application_impl_dbus_inhibit;
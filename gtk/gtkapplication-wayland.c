@@ -44,6 +44,9 @@ gtk_application_impl_wayland_handle_window_realize (GtkApplicationImpl *impl,
   GdkSurface *gdk_surface;
   gchar *window_path;
 
+  /* Exports the menus, so that their paths are known */
+  impl_class->handle_window_realize (impl, window);
+
   gdk_surface = gtk_widget_get_surface (GTK_WIDGET (window));
 
   if (!GDK_IS_WAYLAND_SURFACE (gdk_surface))
@@ -56,8 +59,6 @@ gtk_application_impl_wayland_handle_window_realize (GtkApplicationImpl *impl,
                                                       window_path, dbus->object_path, dbus->unique_name);
 
   g_free (window_path);
-
-  impl_class->handle_window_realize (impl, window);
 }
 
 static void
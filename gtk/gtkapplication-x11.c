@@ -38,10 +38,15 @@ static void
 gtk_application_impl_x11_handle_window_realize (GtkApplicationImpl *impl,
                                                 GtkWindow          *window)
 {
+  GtkApplicationImplClass *impl_class =
+    GTK_APPLICATION_IMPL_CLASS (gtk_application_impl_x11_parent_class);
   GtkApplicationImplDBus *dbus = (GtkApplicationImplDBus *) impl;
   GdkSurface *gdk_surface;
   gchar *window_path;
 
+  /* Exports the menus, so that their paths are known */
+  impl_class->handle_window_realize (impl, window);
+
   gdk_surface = gtk_widget_get_surface (GTK_WIDGET (window));
 
   if (!GDK_IS_X11_SURFACE (gdk_surface))
@@ -122,13 +122,23 @@ typedef struct
   const gchar     *unique_name;
   const gchar     *object_path;
 
+  GCancellable    *cancellable;
+
+  /* Menus and actions are exported when the first window is realized */
+  gboolean         exported;
+
+  GMenuModel      *app_menu;
   gchar           *app_menu_path;
   guint            app_menu_id;
 
+  GMenuModel      *menubar;
   gchar           *menubar_path;
   guint            menubar_id;
 
   /* Session management... */
+  gboolean         register_session;
+  gboolean         session_pending;
+  gint64           session_trace_start;
   GDBusProxy      *sm_proxy;
   GDBusProxy      *client_proxy;
   gchar           *client_path;
@@ -64,10 +64,32 @@ typedef enum {
   GTK_BINDING_TOKEN_UNBIND
 } GtkBindingTokens;
 
+/* The entries for one key in the binding sets of a class and its
+ * parents, most derived first
+ */
+typedef struct {
+  guint            keyval;
+  GdkModifierType  modifiers;
+  GPtrArray       *entries;
+} BindingChain;
+
+/* The binding sets of a class and its parents, merged. They are built
+ * on the first key press and thrown away when any binding changes.
+ */
+typedef struct {
+  guint       ref_count;
+  guint       generation;
+  GPtrArray  *sets;
+  GHashTable *chains;
+} BindingClassTable;
+
 /* --- variables --- */
 static GHashTable       *binding_entry_hash_table = NULL;
 static GSList           *binding_key_hashes = NULL;
 static GSList           *binding_set_list = NULL;
+static GHashTable       *binding_set_hash = NULL;
+static GHashTable       *binding_class_tables = NULL;
+static guint             binding_generation = 0;
 static const gchar       key_class_binding_set[] = "gtk-class-binding-set";
 static GQuark            key_id_class_binding_set = 0;
 
@@ -124,9 +146,8 @@ binding_entries_compare (gconstpointer  a,
   return (ea->keyval == eb->keyval && ea->modifiers == eb->modifiers);
 }
 
-static void
-binding_key_hash_insert_entry (GtkKeyHash      *key_hash,
-                               GtkBindingEntry *entry)
+static guint
+binding_entry_get_lookup_keyval (GtkBindingEntry *entry)
 {
   guint keyval = entry->keyval;
 
@@ -141,7 +162,17 @@ binding_key_hash_insert_entry (GtkKeyHash      *key_hash,
         keyval = gdk_keyval_to_upper (keyval);
     }
 
-  _gtk_key_hash_add_entry (key_hash, keyval, entry->modifiers & ~GDK_RELEASE_MASK, entry);
+  return keyval;
+}
+
+static void
+binding_key_hash_insert_entry (GtkKeyHash      *key_hash,
+                               GtkBindingEntry *entry)
+{
+  _gtk_key_hash_add_entry (key_hash,
+                           binding_entry_get_lookup_keyval (entry),
+                           entry->modifiers & ~GDK_RELEASE_MASK,
+                           entry);
 }
 
 static void
@@ -192,6 +223,124 @@ binding_key_hash_for_keymap (GdkKeymap *keymap)
   return key_hash;
 }
 
+static guint
+binding_chain_hash (gconstpointer key)
+{
+  const BindingChain *chain = key;
+
+  return chain->keyval ^ chain->modifiers;
+}
+
+static gboolean
+binding_chain_equal (gconstpointer a,
+                     gconstpointer b)
+{
+  const BindingChain *ca = a;
+  const BindingChain *cb = b;
+
+  return ca->keyval == cb->keyval && ca->modifiers == cb->modifiers;
+}
+
+static void
+binding_chain_free (gpointer data)
+{
+  BindingChain *chain = data;
+
+  g_ptr_array_unref (chain->entries);
+  g_slice_free (BindingChain, chain);
+}
+
+static BindingClassTable *
+binding_class_table_ref (BindingClassTable *table)
+{
+  table->ref_count++;
+
+  return table;
+}
+
+static void
+binding_class_table_unref (gpointer data)
+{
+  BindingClassTable *table = data;
+
+  table->ref_count--;
+  if (table->ref_count > 0)
+    return;
+
+  g_ptr_array_unref (table->sets);
+  g_hash_table_unref (table->chains);
+  g_slice_free (BindingClassTable, table);
+}
+
+static GtkBindingSet *gtk_binding_set_find_interned (const gchar *set_name);
+
+static BindingClassTable *
+binding_class_table_new (GType type)
+{
+  BindingClassTable *table;
+  GtkBindingSet *binding_set;
+  GtkBindingEntry *entry;
+  BindingChain *chain;
+
+  table = g_slice_new (BindingClassTable);
+  table->ref_count = 1;
+  table->generation = binding_generation;
+  table->sets = g_ptr_array_new ();
+  table->chains = g_hash_table_new_full (binding_chain_hash, binding_chain_equal,
+                                         binding_chain_free, NULL);
+
+  for (; type; type = g_type_parent (type))
+    {
+      binding_set = gtk_binding_set_find_interned (g_type_name (type));
+      if (!binding_set)
+        continue;
+
+      g_ptr_array_add (table->sets, binding_set);
+
+      for (entry = binding_set->entries; entry; entry = entry->set_next)
+        {
+          BindingChain lookup_chain;
+
+          lookup_chain.keyval = binding_entry_get_lookup_keyval (entry);
+          lookup_chain.modifiers = entry->modifiers;
+
+          chain = g_hash_table_lookup (table->chains, &lookup_chain);
+          if (!chain)
+            {
+              chain = g_slice_new (BindingChain);
+              chain->keyval = lookup_chain.keyval;
+              chain->modifiers = lookup_chain.modifiers;
+              chain->entries = g_ptr_array_new ();
+              g_hash_table_add (table->chains, chain);
+            }
+
+          g_ptr_array_add (chain->entries, entry);
+        }
+    }
+
+  return table;
+}
+
+/* Returns a new reference, the table may be replaced by the handlers
+ * of the bindings while it is used.
+ */
+static BindingClassTable *
+binding_class_table_for_type (GType type)
+{
+  BindingClassTable *table;
+
+  if (!binding_class_tables)
+    binding_class_tables = g_hash_table_new_full (NULL, NULL, NULL, binding_class_table_unref);
+
+  table = g_hash_table_lookup (binding_class_tables, GSIZE_TO_POINTER (type));
+  if (!table || table->generation != binding_generation)
+    {
+      table = binding_class_table_new (type);
+      g_hash_table_insert (binding_class_tables, GSIZE_TO_POINTER (type), table);
+    }
+
+  return binding_class_table_ref (table);
+}
 
 static GtkBindingEntry*
 binding_entry_new (GtkBindingSet  *binding_set,
@@ -227,6 +376,8 @@ binding_entry_new (GtkBindingSet  *binding_set,
       binding_key_hash_insert_entry (key_hash, entry);
     }
 
+  binding_generation++;
+
   return entry;
 }
 
@@ -315,6 +466,8 @@ binding_entry_destroy (GtkBindingEntry *entry)
       _gtk_key_hash_remove_entry (key_hash, entry);
     }
 
+  binding_generation++;
+
   entry->destroyed = TRUE;
 
   if (!entry->in_emission)
@@ -591,6 +744,12 @@ gtk_binding_set_new (const gchar *set_name)
 
   binding_set_list = g_slist_prepend (binding_set_list, binding_set);
 
+  if (!binding_set_hash)
+    binding_set_hash = g_hash_table_new (NULL, NULL);
+  g_hash_table_insert (binding_set_hash, binding_set->set_name, binding_set);
+
+  binding_generation++;
+
   return binding_set;
 }
 
@@ -630,18 +789,10 @@ gtk_binding_set_by_class (gpointer object_class)
 static GtkBindingSet*
 gtk_binding_set_find_interned (const gchar *set_name)
 {
-  GSList *slist;
-
-  for (slist = binding_set_list; slist; slist = slist->next)
-    {
-      GtkBindingSet *binding_set;
-
-      binding_set = slist->data;
-      if (binding_set->set_name == set_name)
-        return binding_set;
-    }
+  if (!binding_set_hash)
+    return NULL;
 
-  return NULL;
+  return g_hash_table_lookup (binding_set_hash, set_name);
 }
 
 /**
@@ -1344,39 +1495,59 @@ gtk_bindings_activate_list (GObject  *object,
                             GSList   *entries,
                             gboolean  is_release)
 {
-  GtkBindingSet *binding_set;
+  BindingClassTable *table;
   gboolean handled = FALSE;
   gboolean unbound = FALSE;
+  guint i;
 
   if (!entries)
     return FALSE;
 
-  if (!handled)
+  table = binding_class_table_for_type (G_TYPE_FROM_INSTANCE (object));
+
+  for (i = 0; i < table->sets->len && !handled; i++)
     {
-      GType class_type;
+      handled = binding_activate (g_ptr_array_index (table->sets, i), entries,
+                                  object, is_release,
+                                  &unbound);
+      if (unbound)
+        break;
+    }
 
-      class_type = G_TYPE_FROM_INSTANCE (object);
+  binding_class_table_unref (table);
 
-      while (class_type && !handled)
-        {
-          binding_set = gtk_binding_set_find_interned (g_type_name (class_type));
-          class_type = g_type_parent (class_type);
+  if (unbound)
+    return FALSE;
 
-          if (!binding_set)
-            continue;
+  return handled;
+}
 
-          handled = binding_activate (binding_set, entries,
-                                      object, is_release,
-                                      &unbound);
-          if (unbound)
-            break;
-        }
+static gboolean
+binding_chain_activate (BindingChain *chain,
+                        GObject      *object)
+{
+  GtkBindingEntry *entry;
+  guint generation = binding_generation;
+  guint i;
 
-      if (unbound)
+  for (i = 0; i < chain->entries->len; i++)
+    {
+      entry = g_ptr_array_index (chain->entries, i);
+
+      if (entry->marks_unbound)
+        return FALSE;
+
+      if (gtk_binding_entry_activate (entry, object))
+        return TRUE;
+
+      /* The handlers changed the bindings, the remaining entries
+       * may be gone
+       */
+      if (generation != binding_generation)
         return FALSE;
     }
 
-  return handled;
+  return FALSE;
 }
 
 /**
@@ -1395,26 +1566,27 @@ gtk_bindings_activate (GObject         *object,
                        guint            keyval,
                        GdkModifierType  modifiers)
 {
-  GSList *entries = NULL;
-  GdkDisplay *display;
-  GtkKeyHash *key_hash;
+  BindingClassTable *table;
+  BindingChain lookup_chain;
+  BindingChain *chain;
   gboolean handled = FALSE;
-  gboolean is_release;
 
   if (!GTK_IS_WIDGET (object))
     return FALSE;
 
-  is_release = (modifiers & GDK_RELEASE_MASK) != 0;
-  modifiers = modifiers & BINDING_MOD_MASK () & ~GDK_RELEASE_MASK;
+  if (!keyval)
+    return FALSE;
 
-  display = gtk_widget_get_display (GTK_WIDGET (object));
-  key_hash = binding_key_hash_for_keymap (gdk_display_get_keymap (display));
+  table = binding_class_table_for_type (G_TYPE_FROM_INSTANCE (object));
 
-  entries = _gtk_key_hash_lookup_keyval (key_hash, keyval, modifiers);
+  lookup_chain.keyval = keyval;
+  lookup_chain.modifiers = modifiers & BINDING_MOD_MASK ();
 
-  handled = gtk_bindings_activate_list (object, entries, is_release);
+  chain = g_hash_table_lookup (table->chains, &lookup_chain);
+  if (chain)
+    handled = binding_chain_activate (chain, object);
 
-  g_slist_free (entries);
+  binding_class_table_unref (table);
 
   return handled;
 }
@@ -56,6 +56,16 @@ static inline gboolean          _gtk_bitmask_equals               (const GtkBitm
 static inline gboolean          _gtk_bitmask_intersects           (const GtkBitmask  *mask,
                                                                    const GtkBitmask  *other);
 
+static inline guint             _gtk_bitmask_count                (const GtkBitmask  *mask);
+static inline guint             _gtk_bitmask_next_set             (const GtkBitmask  *mask,
+                                                                   guint              index_);
+
+/* Iterates over the indexes of all bits that are set in @mask, in order */
+#define _gtk_bitmask_foreach(mask, i) \
+  for ((i) = _gtk_bitmask_next_set ((mask), 0); \
+       (i) != G_MAXUINT; \
+       (i) = _gtk_bitmask_next_set ((mask), (i) + 1))
+
 
 /* This is the actual implementation of the functions declared above.
  * We put it in a separate file so people don’t get scared from looking at this
@@ -165,3 +165,33 @@ _gtk_bitmask_intersects (const GtkBitmask *mask,
   else
     return _gtk_bitmask_to_bits (mask) & _gtk_bitmask_to_bits (other) ? TRUE : FALSE;
 }
+
+static inline guint
+_gtk_bitmask_count (const GtkBitmask *mask)
+{
+  if (_gtk_bitmask_is_allocated (mask))
+    return _gtk_allocated_bitmask_count (mask);
+  else
+    return _gtk_bitmask_bits_count (_gtk_bitmask_to_bits (mask));
+}
+
+/* Returns the index of the first bit that is set in @mask
+ * and not lower than @index_, or G_MAXUINT if there is none */
+static inline guint
+_gtk_bitmask_next_set (const GtkBitmask *mask,
+                       guint             index_)
+{
+  gsize bits;
+
+  if (_gtk_bitmask_is_allocated (mask))
+    return _gtk_allocated_bitmask_next_set (mask, index_);
+
+  if (index_ >= GTK_BITMASK_N_DIRECT_BITS)
+    return G_MAXUINT;
+
+  bits = _gtk_bitmask_to_bits (mask) >> index_;
+  if (bits == 0)
+    return G_MAXUINT;
+
+  return index_ + _gtk_bitmask_bits_first_set (bits);
+}
@@ -30,6 +30,20 @@
 #include "gtkbookmarksmanager.h"
 #include "gtkfilechooser.h" /* for the GError types */
 
+struct _GtkBookmarksStore
+{
+  /* This list contains GtkBookmark structs */
+  GSList *bookmarks;
+
+  GFileMonitor *bookmarks_monitor;
+  gulong bookmarks_monitor_changed_id;
+
+  /* The managers using the store, it is freed with the last one */
+  GList *managers;
+};
+
+static GtkBookmarksStore *bookmarks_store;
+
 static void
 _gtk_bookmark_free (gpointer data)
 {
@@ -181,11 +195,31 @@ save_bookmarks (GFile  *bookmarks_file,
   g_string_free (contents, TRUE);
 }
 
+/* Every manager sees the change, not only the one that made it */
 static void
-notify_changed (GtkBookmarksManager *manager)
+notify_changed (GtkBookmarksStore *store)
 {
-  if (manager->changed_func)
-    manager->changed_func (manager->changed_func_data);
+  GList *managers, *l;
+
+  /* Callbacks may free their manager */
+  managers = g_list_copy (store->managers);
+
+  for (l = managers; l; l = l->next)
+    {
+      GtkBookmarksManager *manager = l->data;
+
+      /* The last manager went away along with the store */
+      if (bookmarks_store != store)
+        break;
+
+      if (!g_list_find (store->managers, manager))
+        continue;
+
+      if (manager->changed_func)
+        manager->changed_func (manager->changed_func_data);
+    }
+
+  g_list_free (managers);
 }
 
 static void
@@ -195,7 +229,7 @@ bookmarks_file_changed (GFileMonitor      *monitor,
 			GFileMonitorEvent  event,
 			gpointer           data)
 {
-  GtkBookmarksManager *manager = data;
+  GtkBookmarksStore *store = data;
 
   switch (event)
     {
@@ -203,9 +237,9 @@ bookmarks_file_changed (GFileMonitor      *monitor,
     case G_FILE_MONITOR_EVENT_CHANGES_DONE_HINT:
     case G_FILE_MONITOR_EVENT_CREATED:
     case G_FILE_MONITOR_EVENT_DELETED:
-      g_slist_free_full (manager->bookmarks, _gtk_bookmark_free);
-      manager->bookmarks = read_bookmarks (file);
-      notify_changed (manager);
+      g_slist_free_full (store->bookmarks, _gtk_bookmark_free);
+      store->bookmarks = read_bookmarks (file);
+      notify_changed (store);
       break;
 
     case G_FILE_MONITOR_EVENT_ATTRIBUTE_CHANGED:
@@ -221,66 +255,98 @@ bookmarks_file_changed (GFileMonitor      *monitor,
     }
 }
 
-GtkBookmarksManager *
-_gtk_bookmarks_manager_new (GtkBookmarksChangedFunc changed_func, gpointer changed_func_data)
+static GtkBookmarksStore *
+bookmarks_store_new (void)
 {
-  GtkBookmarksManager *manager;
+  GtkBookmarksStore *store;
   GFile *bookmarks_file;
   GError *error;
 
-  manager = g_new0 (GtkBookmarksManager, 1);
-
-  manager->changed_func = changed_func;
-  manager->changed_func_data = changed_func_data;
+  store = g_new0 (GtkBookmarksStore, 1);
 
   bookmarks_file = get_bookmarks_file ();
-  manager->bookmarks = read_bookmarks (bookmarks_file);
-  if (!manager->bookmarks)
+  store->bookmarks = read_bookmarks (bookmarks_file);
+  if (!store->bookmarks)
     {
       GFile *legacy_bookmarks_file;
 
       /* Read the legacy one and write it to the new one */
       legacy_bookmarks_file = get_legacy_bookmarks_file ();
-      manager->bookmarks = read_bookmarks (legacy_bookmarks_file);
-      if (manager->bookmarks)
-	save_bookmarks (bookmarks_file, manager->bookmarks);
+      store->bookmarks = read_bookmarks (legacy_bookmarks_file);
+      if (store->bookmarks)
+	save_bookmarks (bookmarks_file, store->bookmarks);
 
       g_object_unref (legacy_bookmarks_file);
     }
 
   error = NULL;
-  manager->bookmarks_monitor = g_file_monitor_file (bookmarks_file,
-						    G_FILE_MONITOR_NONE,
-						    NULL, &error);
+  store->bookmarks_monitor = g_file_monitor_file (bookmarks_file,
+						  G_FILE_MONITOR_NONE,
+						  NULL, &error);
   if (error)
     {
       g_warning ("%s", error->message);
       g_error_free (error);
     }
   else
-    manager->bookmarks_monitor_changed_id = g_signal_connect (manager->bookmarks_monitor, "changed",
-							      G_CALLBACK (bookmarks_file_changed), manager);
+    store->bookmarks_monitor_changed_id = g_signal_connect (store->bookmarks_monitor, "changed",
+							    G_CALLBACK (bookmarks_file_changed), store);
 
   g_object_unref (bookmarks_file);
 
+  return store;
+}
+
+static void
+bookmarks_store_free (GtkBookmarksStore *store)
+{
+  if (store->bookmarks_monitor)
+    {
+      g_file_monitor_cancel (store->bookmarks_monitor);
+      g_signal_handler_disconnect (store->bookmarks_monitor, store->bookmarks_monitor_changed_id);
+      store->bookmarks_monitor_changed_id = 0;
+      g_object_unref (store->bookmarks_monitor);
+    }
+
+  g_slist_free_full (store->bookmarks, _gtk_bookmark_free);
+
+  g_free (store);
+}
+
+GtkBookmarksManager *
+_gtk_bookmarks_manager_new (GtkBookmarksChangedFunc changed_func, gpointer changed_func_data)
+{
+  GtkBookmarksManager *manager;
+
+  manager = g_new0 (GtkBookmarksManager, 1);
+
+  manager->changed_func = changed_func;
+  manager->changed_func_data = changed_func_data;
+
+  if (bookmarks_store == NULL)
+    bookmarks_store = bookmarks_store_new ();
+
+  manager->store = bookmarks_store;
+  bookmarks_store->managers = g_list_prepend (bookmarks_store->managers, manager);
+
   return manager;
 }
 
 void
 _gtk_bookmarks_manager_free (GtkBookmarksManager *manager)
 {
+  GtkBookmarksStore *store;
+
   g_return_if_fail (manager != NULL);
 
-  if (manager->bookmarks_monitor)
+  store = manager->store;
+  store->managers = g_list_remove (store->managers, manager);
+  if (store->managers == NULL)
     {
-      g_file_monitor_cancel (manager->bookmarks_monitor);
-      g_signal_handler_disconnect (manager->bookmarks_monitor, manager->bookmarks_monitor_changed_id);
-      manager->bookmarks_monitor_changed_id = 0;
-      g_object_unref (manager->bookmarks_monitor);
+      bookmarks_store_free (store);
+      bookmarks_store = NULL;
     }
 
-  g_slist_free_full (manager->bookmarks, _gtk_bookmark_free);
-
   g_free (manager);
 }
 
@@ -291,7 +357,7 @@ _gtk_bookmarks_manager_list_bookmarks (GtkBookmarksManager *manager)
 
   g_return_val_if_fail (manager != NULL, NULL);
 
-  bookmarks = manager->bookmarks;
+  bookmarks = manager->store->bookmarks;
 
   while (bookmarks)
     {
@@ -339,7 +405,7 @@ _gtk_bookmarks_manager_has_bookmark (GtkBookmarksManager *manager,
 {
   GSList *link;
 
-  link = find_bookmark_link_for_file (manager->bookmarks, file, NULL);
+  link = find_bookmark_link_for_file (manager->store->bookmarks, file, NULL);
   return (link != NULL);
 }
 
@@ -356,7 +422,7 @@ _gtk_bookmarks_manager_insert_bookmark (GtkBookmarksManager *manager,
   g_return_val_if_fail (manager != NULL, FALSE);
   g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
 
-  link = find_bookmark_link_for_file (manager->bookmarks, file, NULL);
+  link = find_bookmark_link_for_file (manager->store->bookmarks, file, NULL);
 
   if (link)
     {
@@ -378,13 +444,13 @@ _gtk_bookmarks_manager_insert_bookmark (GtkBookmarksManager *manager,
   bookmark = g_slice_new0 (GtkBookmark);
   bookmark->file = g_object_ref (file);
 
-  manager->bookmarks = g_slist_insert (manager->bookmarks, bookmark, position);
+  manager->store->bookmarks = g_slist_insert (manager->store->bookmarks, bookmark, position);
 
   bookmarks_file = get_bookmarks_file ();
-  save_bookmarks (bookmarks_file, manager->bookmarks);
+  save_bookmarks (bookmarks_file, manager->store->bookmarks);
   g_object_unref (bookmarks_file);
 
-  notify_changed (manager);
+  notify_changed (manager->store);
 
   return TRUE;
 }
@@ -400,15 +466,15 @@ _gtk_bookmarks_manager_remove_bookmark (GtkBookmarksManager *manager,
   g_return_val_if_fail (manager != NULL, FALSE);
   g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
 
-  if (!manager->bookmarks)
+  if (!manager->store->bookmarks)
     return FALSE;
 
-  link = find_bookmark_link_for_file (manager->bookmarks, file, NULL);
+  link = find_bookmark_link_for_file (manager->store->bookmarks, file, NULL);
   if (link)
     {
       GtkBookmark *bookmark = link->data;
 
-      manager->bookmarks = g_slist_remove_link (manager->bookmarks, link);
+      manager->store->bookmarks = g_slist_remove_link (manager->store->bookmarks, link);
       _gtk_bookmark_free (bookmark);
       g_slist_free_1 (link);
     }
@@ -419,10 +485,10 @@ _gtk_bookmarks_manager_remove_bookmark (GtkBookmarksManager *manager,
     }
 
   bookmarks_file = get_bookmarks_file ();
-  save_bookmarks (bookmarks_file, manager->bookmarks);
+  save_bookmarks (bookmarks_file, manager->store->bookmarks);
   g_object_unref (bookmarks_file);
 
-  notify_changed (manager);
+  notify_changed (manager->store);
 
   return TRUE;
 }
@@ -441,10 +507,10 @@ _gtk_bookmarks_manager_reorder_bookmark (GtkBookmarksManager *manager,
   g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
   g_return_val_if_fail (new_position >= 0, FALSE);
 
-  if (!manager->bookmarks)
+  if (!manager->store->bookmarks)
     return FALSE;
 
-  link = find_bookmark_link_for_file (manager->bookmarks, file, &old_position);
+  link = find_bookmark_link_for_file (manager->store->bookmarks, file, &old_position);
   if (new_position == old_position)
     return TRUE;
 
@@ -452,13 +518,13 @@ _gtk_bookmarks_manager_reorder_bookmark (GtkBookmarksManager *manager,
     {
       GtkBookmark *bookmark = link->data; 
 
-      manager->bookmarks = g_slist_remove_link (manager->bookmarks, link);
+      manager->store->bookmarks = g_slist_remove_link (manager->store->bookmarks, link);
       g_slist_free_1 (link);
 
       if (new_position > old_position)
 	new_position--;
 
-      manager->bookmarks = g_slist_insert (manager->bookmarks, bookmark, new_position);
+      manager->store->bookmarks = g_slist_insert (manager->store->bookmarks, bookmark, new_position);
     }
   else
     {
@@ -467,10 +533,10 @@ _gtk_bookmarks_manager_reorder_bookmark (GtkBookmarksManager *manager,
     }
 
   bookmarks_file = get_bookmarks_file ();
-  save_bookmarks (bookmarks_file, manager->bookmarks);
+  save_bookmarks (bookmarks_file, manager->store->bookmarks);
   g_object_unref (bookmarks_file);
 
-  notify_changed (manager);
+  notify_changed (manager->store);
 
   return TRUE;
 }
@@ -485,7 +551,7 @@ _gtk_bookmarks_manager_get_bookmark_label (GtkBookmarksManager *manager,
   g_return_val_if_fail (manager != NULL, NULL);
   g_return_val_if_fail (file != NULL, NULL);
 
-  bookmarks = manager->bookmarks;
+  bookmarks = manager->store->bookmarks;
 
   while (bookmarks)
     {
@@ -516,7 +582,7 @@ _gtk_bookmarks_manager_set_bookmark_label (GtkBookmarksManager *manager,
   g_return_val_if_fail (manager != NULL, FALSE);
   g_return_val_if_fail (file != NULL, FALSE);
 
-  link = find_bookmark_link_for_file (manager->bookmarks, file, NULL);
+  link = find_bookmark_link_for_file (manager->store->bookmarks, file, NULL);
   if (link)
     {
       GtkBookmark *bookmark = link->data;
@@ -531,10 +597,10 @@ _gtk_bookmarks_manager_set_bookmark_label (GtkBookmarksManager *manager,
     }
 
   bookmarks_file = get_bookmarks_file ();
-  save_bookmarks (bookmarks_file, manager->bookmarks);
+  save_bookmarks (bookmarks_file, manager->store->bookmarks);
   g_object_unref (bookmarks_file);
 
-  notify_changed (manager);
+  notify_changed (manager->store);
 
   return TRUE;
 }
@@ -551,7 +617,7 @@ _gtk_bookmarks_manager_get_xdg_type (GtkBookmarksManager *manager,
   GUserDirectory dir;
   GtkBookmark *bookmark;
 
-  link = find_bookmark_link_for_file (manager->bookmarks, file, NULL);
+  link = find_bookmark_link_for_file (manager->store->bookmarks, file, NULL);
   if (!link)
     return FALSE;
 
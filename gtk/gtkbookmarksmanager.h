@@ -28,13 +28,14 @@
 
 typedef void (* GtkBookmarksChangedFunc) (gpointer data);
 
+/* The bookmarks are read and monitored once per process, and
+ * shared by all the managers.
+ */
+typedef struct _GtkBookmarksStore GtkBookmarksStore;
+
 typedef struct
 {
-  /* This list contains GtkBookmark structs */
-  GSList *bookmarks;
-
-  GFileMonitor *bookmarks_monitor;
-  gulong bookmarks_monitor_changed_id;
+  GtkBookmarksStore *store;
 
   gpointer changed_func_data;
   GtkBookmarksChangedFunc changed_func;
@@ -25,10 +25,191 @@
 #include <gio/gio.h>
 #include <string.h>
 
+/* Menus from resources are parsed once. What was parsed is kept as a
+ * template, with the attribute values already translated and turned
+ * into GVariants, and later builders skip over the <menu> element and
+ * create the same menus from the template.
+ *
+ * The menus themselves are not shared, since applications are free to
+ * change the menus they got from a builder.
+ */
+typedef struct _MenuTemplate MenuTemplate;
+
+typedef struct
+{
+  gchar    *name;
+  GVariant *value;
+} AttributeTemplate;
+
+typedef struct
+{
+  gchar        *name;
+  MenuTemplate *menu;
+} LinkTemplate;
+
+typedef struct
+{
+  GPtrArray *attributes;
+  GPtrArray *links;
+} ItemTemplate;
+
+struct _MenuTemplate
+{
+  gchar     *id;
+  GPtrArray *items;
+};
+
+G_LOCK_DEFINE_STATIC (menu_templates);
+static GHashTable *menu_templates;
+
+static void menu_template_free (MenuTemplate *template);
+
+static void
+attribute_template_free (AttributeTemplate *attribute)
+{
+  g_free (attribute->name);
+  g_variant_unref (attribute->value);
+  g_slice_free (AttributeTemplate, attribute);
+}
+
+static void
+link_template_free (LinkTemplate *link)
+{
+  g_free (link->name);
+  menu_template_free (link->menu);
+  g_slice_free (LinkTemplate, link);
+}
+
+static void
+item_template_free (ItemTemplate *item)
+{
+  g_ptr_array_unref (item->attributes);
+  g_ptr_array_unref (item->links);
+  g_slice_free (ItemTemplate, item);
+}
+
+static MenuTemplate *
+menu_template_new (const gchar *id)
+{
+  MenuTemplate *template;
+
+  template = g_slice_new (MenuTemplate);
+  template->id = g_strdup (id);
+  template->items = g_ptr_array_new_with_free_func ((GDestroyNotify) item_template_free);
+
+  return template;
+}
+
+static void
+menu_template_free (MenuTemplate *template)
+{
+  g_free (template->id);
+  g_ptr_array_unref (template->items);
+  g_slice_free (MenuTemplate, template);
+}
+
+/* These do nothing if the menu is not being recorded, as then
+ * there are no templates to add to
+ */
+static ItemTemplate *
+menu_template_add_item (MenuTemplate *template)
+{
+  ItemTemplate *item;
+
+  if (template == NULL)
+    return NULL;
+
+  item = g_slice_new (ItemTemplate);
+  item->attributes = g_ptr_array_new_with_free_func ((GDestroyNotify) attribute_template_free);
+  item->links = g_ptr_array_new_with_free_func ((GDestroyNotify) link_template_free);
+  g_ptr_array_add (template->items, item);
+
+  return item;
+}
+
+static MenuTemplate *
+item_template_add_link (ItemTemplate *item,
+                        const gchar  *name,
+                        const gchar  *id)
+{
+  LinkTemplate *link;
+
+  if (item == NULL)
+    return NULL;
+
+  link = g_slice_new (LinkTemplate);
+  link->name = g_strdup (name);
+  link->menu = menu_template_new (id);
+  g_ptr_array_add (item->links, link);
+
+  return link->menu;
+}
+
+static void
+item_template_add_attribute (ItemTemplate *item,
+                             const gchar  *name,
+                             GVariant     *value)
+{
+  AttributeTemplate *attribute;
+
+  if (item == NULL)
+    return;
+
+  attribute = g_slice_new (AttributeTemplate);
+  attribute->name = g_strdup (name);
+  attribute->value = g_variant_ref_sink (value);
+  g_ptr_array_add (item->attributes, attribute);
+}
+
+/* Adds the ids in the same order as parsing the menu would */
+static GMenu *
+menu_template_instantiate (MenuTemplate *template,
+                           GtkBuilder   *builder)
+{
+  GMenu *menu;
+  guint i, j;
+
+  menu = g_menu_new ();
+  if (template->id != NULL)
+    _gtk_builder_add_object (builder, template->id, G_OBJECT (menu));
+
+  for (i = 0; i < template->items->len; i++)
+    {
+      ItemTemplate *item_template = g_ptr_array_index (template->items, i);
+      GMenuItem *item;
+
+      item = g_menu_item_new (NULL, NULL);
+
+      for (j = 0; j < item_template->links->len; j++)
+        {
+          LinkTemplate *link = g_ptr_array_index (item_template->links, j);
+          GMenu *submenu;
+
+          submenu = menu_template_instantiate (link->menu, builder);
+          g_menu_item_set_link (item, link->name, G_MENU_MODEL (submenu));
+          g_object_unref (submenu);
+        }
+
+      for (j = 0; j < item_template->attributes->len; j++)
+        {
+          AttributeTemplate *attribute = g_ptr_array_index (item_template->attributes, j);
+
+          g_menu_item_set_attribute_value (item, attribute->name, attribute->value);
+        }
+
+      g_menu_append_item (menu, item);
+      g_object_unref (item);
+    }
+
+  return menu;
+}
+
 struct frame
 {
   GMenu        *menu;
   GMenuItem    *item;
+  MenuTemplate *menu_template;
+  ItemTemplate *item_template;
   struct frame *prev;
 };
 
@@ -37,6 +218,11 @@ typedef struct
   ParserData *parser_data;
   struct frame frame;
 
+  /* templates */
+  gchar        *template_key;
+  MenuTemplate *template;
+  gboolean      template_cached;
+
   /* attributes */
   gchar        *attribute;
   GVariantType *type;
@@ -50,7 +236,9 @@ typedef struct
 static void
 gtk_builder_menu_push_frame (GtkBuilderMenuState *state,
                              GMenu               *menu,
-                             GMenuItem           *item)
+                             GMenuItem           *item,
+                             MenuTemplate        *menu_template,
+                             ItemTemplate        *item_template)
 {
   struct frame *new;
 
@@ -59,6 +247,8 @@ gtk_builder_menu_push_frame (GtkBuilderMenuState *state,
 
   state->frame.menu = menu;
   state->frame.item = item;
+  state->frame.menu_template = menu_template;
+  state->frame.item_template = item_template;
   state->frame.prev = new;
 }
 
@@ -107,7 +297,8 @@ gtk_builder_menu_start_element (GMarkupParseContext  *context,
           if (COLLECT (G_MARKUP_COLLECT_INVALID, NULL))
             {
               item = g_menu_item_new (NULL, NULL);
-              gtk_builder_menu_push_frame (state, NULL, item);
+              gtk_builder_menu_push_frame (state, NULL, item, NULL,
+                                           menu_template_add_item (state->frame.menu_template));
             }
 
           return;
@@ -121,10 +312,14 @@ gtk_builder_menu_start_element (GMarkupParseContext  *context,
             {
               GMenuItem *item;
               GMenu *menu;
+              ItemTemplate *item_template;
+              MenuTemplate *menu_template;
 
               menu = g_menu_new ();
               item = g_menu_item_new_submenu (NULL, G_MENU_MODEL (menu));
-              gtk_builder_menu_push_frame (state, menu, item);
+              item_template = menu_template_add_item (state->frame.menu_template);
+              menu_template = item_template_add_link (item_template, G_MENU_LINK_SUBMENU, id);
+              gtk_builder_menu_push_frame (state, menu, item, menu_template, item_template);
 
               if (id != NULL)
                 _gtk_builder_add_object (state->parser_data->builder, id, G_OBJECT (menu));
@@ -142,10 +337,14 @@ gtk_builder_menu_start_element (GMarkupParseContext  *context,
             {
               GMenuItem *item;
               GMenu *menu;
+              ItemTemplate *item_template;
+              MenuTemplate *menu_template;
 
               menu = g_menu_new ();
               item = g_menu_item_new_section (NULL, G_MENU_MODEL (menu));
-              gtk_builder_menu_push_frame (state, menu, item);
+              item_template = menu_template_add_item (state->frame.menu_template);
+              menu_template = item_template_add_link (item_template, G_MENU_LINK_SECTION, id);
+              gtk_builder_menu_push_frame (state, menu, item, menu_template, item_template);
 
               if (id != NULL)
                 _gtk_builder_add_object (state->parser_data->builder, id, G_OBJECT (menu));
@@ -184,7 +383,7 @@ gtk_builder_menu_start_element (GMarkupParseContext  *context,
               state->attribute = g_strdup (name);
               state->context = g_strdup (ctxt);
 
-              gtk_builder_menu_push_frame (state, NULL, NULL);
+              gtk_builder_menu_push_frame (state, NULL, NULL, NULL, NULL);
             }
 
           return;
@@ -202,7 +401,9 @@ gtk_builder_menu_start_element (GMarkupParseContext  *context,
 
               menu = g_menu_new ();
               g_menu_item_set_link (state->frame.item, name, G_MENU_MODEL (menu));
-              gtk_builder_menu_push_frame (state, menu, NULL);
+              gtk_builder_menu_push_frame (state, menu, NULL,
+                                           item_template_add_link (state->frame.item_template, name, id),
+                                           NULL);
 
               if (id != NULL)
                 _gtk_builder_add_object (state->parser_data->builder, id, G_OBJECT (menu));
@@ -267,16 +468,20 @@ gtk_builder_menu_end_element (GMarkupParseContext  *context,
 
       if (state->type == NULL)
         /* No type string specified -> it's a normal string. */
-        g_menu_item_set_attribute (state->frame.item, state->attribute, "s", text);
+        value = g_variant_ref_sink (g_variant_new_string (text));
 
       /* Else, we try to parse it according to the type string.  If
        * error is set here, it will follow us out, ending the parse.
        *
        * We still need to free everything, though, so ignore it here.
        */
-      else if ((value = g_variant_parse (state->type, text, NULL, NULL, error)))
+      else
+        value = g_variant_parse (state->type, text, NULL, NULL, error);
+
+      if (value)
         {
           g_menu_item_set_attribute_value (state->frame.item, state->attribute, value);
+          item_template_add_attribute (state->frame.item_template, state->attribute, value);
           g_variant_unref (value);
         }
 
@@ -345,6 +550,10 @@ gtk_builder_menu_error (GMarkupParseContext *context,
   g_free (state->attribute);
   g_free (state->context);
 
+  if (state->template && !state->template_cached)
+    menu_template_free (state->template);
+  g_free (state->template_key);
+
   g_slice_free (GtkBuilderMenuState, state);
 }
 
@@ -357,6 +566,79 @@ static GMarkupParser gtk_builder_menu_subparser =
   gtk_builder_menu_error
 };
 
+/* For menus that have a template already. Their contents were
+ * checked when the template was recorded.
+ */
+static GMarkupParser gtk_builder_menu_skip_subparser =
+{
+  NULL,
+  NULL,
+  NULL,
+  NULL,                            /* passthrough */
+  gtk_builder_menu_error
+};
+
+/* Only resources can be assumed to have the same contents every time */
+static gchar *
+get_template_key (ParserData *parser_data)
+{
+  gint line, col;
+
+  if (!g_str_has_prefix (parser_data->filename, "<resource>"))
+    return NULL;
+
+  g_markup_parse_context_get_position (parser_data->ctx, &line, &col);
+
+  return g_strdup_printf ("%s:%d:%d:%s", parser_data->filename, line, col,
+                          parser_data->domain ? parser_data->domain : "");
+}
+
+static MenuTemplate *
+lookup_template (const gchar *key)
+{
+  MenuTemplate *template = NULL;
+
+  G_LOCK (menu_templates);
+  if (menu_templates)
+    template = g_hash_table_lookup (menu_templates, key);
+  G_UNLOCK (menu_templates);
+
+  return template;
+}
+
+/* Takes the key and the template. Templates are never freed once
+ * they are cached, so they can be used without holding the lock.
+ */
+static MenuTemplate *
+cache_template (gchar        *key,
+                MenuTemplate *template)
+{
+  MenuTemplate *cached;
+
+  G_LOCK (menu_templates);
+
+  if (menu_templates == NULL)
+    menu_templates = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                            g_free, (GDestroyNotify) menu_template_free);
+
+  /* Another thread may have recorded the same menu meanwhile */
+  cached = g_hash_table_lookup (menu_templates, key);
+  if (cached == NULL)
+    {
+      g_hash_table_insert (menu_templates, key, template);
+      cached = template;
+    }
+  else
+    {
+      g_free (key);
+      menu_template_free (template);
+    }
+
+  G_UNLOCK (menu_templates);
+
+  return cached;
+}
+
 void
 _gtk_builder_menu_start (ParserData   *parser_data,
                          const gchar  *element_name,
@@ -369,15 +651,30 @@ _gtk_builder_menu_start (ParserData   *parser_data,
 
   state = g_slice_new0 (GtkBuilderMenuState);
   state->parser_data = parser_data;
+  state->template_key = get_template_key (parser_data);
+
+  if (state->template_key)
+    state->template = lookup_template (state->template_key);
+
+  if (state->template)
+    {
+      state->template_cached = TRUE;
+      g_markup_parse_context_push (parser_data->ctx, &gtk_builder_menu_skip_subparser, state);
+      return;
+    }
+
   g_markup_parse_context_push (parser_data->ctx, &gtk_builder_menu_subparser, state);
 
   if (COLLECT (STRING, "id", &id))
     {
       GMenu *menu;
 
+      if (state->template_key)
+        state->template = menu_template_new (id);
+
       menu = g_menu_new ();
       _gtk_builder_add_object (state->parser_data->builder, id, G_OBJECT (menu));
-      gtk_builder_menu_push_frame (state, menu, NULL);
+      gtk_builder_menu_push_frame (state, menu, NULL, state->template, NULL);
       g_object_unref (menu);
     }
 }
@@ -388,10 +685,28 @@ _gtk_builder_menu_end (ParserData *parser_data)
   GtkBuilderMenuState *state;
 
   state = g_markup_parse_context_pop (parser_data->ctx);
-  gtk_builder_menu_pop_frame (state);
+
+  if (state->template_cached)
+    {
+      GMenu *menu;
+
+      menu = menu_template_instantiate (state->template, parser_data->builder);
+      g_object_unref (menu);
+    }
+  else
+    {
+      gtk_builder_menu_pop_frame (state);
+
+      if (state->template)
+        {
+          cache_template (state->template_key, state->template);
+          state->template_key = NULL;
+        }
+    }
 
   g_assert (state->frame.prev == NULL);
   g_assert (state->frame.item == NULL);
   g_assert (state->frame.menu == NULL);
+  g_free (state->template_key);
   g_slice_free (GtkBuilderMenuState, state);
 }
@@ -98,6 +98,16 @@
  * parts of the UI definition. GTK+ reserves ids starting and ending
  * with ___ (3 underscores) for its own purposes.
  *
+ * Toplevel objects with an id can be marked with lazy="true". They are
+ * not constructed while the UI definition is parsed, but the first
+ * time they are needed: when gtk_builder_get_object() is called for
+ * them or for an object inside them, or when another object refers to
+ * them. Until then gtk_builder_get_objects() does not return them, and
+ * the signals of a lazy object are connected by the next call to
+ * gtk_builder_connect_signals() after it has been constructed. This is
+ * useful for dialogs, popovers and other parts of a UI that are often
+ * never shown.
+ *
  * Setting properties of objects is pretty straightforward with the
  * <property> element: the “name” attribute specifies the name of the
  * property, and the content of the element specifies the value.
@@ -204,6 +214,7 @@
 #include <errno.h> /* errno */
 #include <stdlib.h>
 #include <string.h> /* strlen */
+#include <gmodule.h>
 
 #include "gtkbuilder.h"
 #include "gtkbuildable.h"
@@ -248,9 +259,21 @@ typedef struct
   gchar *filename;
   gchar *resource_prefix;
   GType template_type;
+  GtkBuilderTemplateCache *template_cache;
+  GHashTable *deferred_objects;
   GtkApplication *application;
 } GtkBuilderPrivate;
 
+/* A lazy toplevel object, with the ids of everything in it */
+typedef struct
+{
+  gint ref_count;
+  gchar *filename;
+  gchar *buffer;
+  gsize length;
+  gchar **ids;
+} DeferredObject;
+
 G_DEFINE_TYPE_WITH_PRIVATE (GtkBuilder, gtk_builder, G_TYPE_OBJECT)
 
 static void
@@ -310,6 +333,8 @@ gtk_builder_finalize (GObject *object)
   g_free (priv->resource_prefix);
 
   g_hash_table_destroy (priv->objects);
+  if (priv->deferred_objects)
+    g_hash_table_destroy (priv->deferred_objects);
   if (priv->callbacks)
     g_hash_table_destroy (priv->callbacks);
 
@@ -391,20 +416,62 @@ type_name_mangle (const gchar *name)
   return g_string_free (symbol_name, FALSE);
 }
 
+/* Every instance of a template and every builder loading the same
+ * file looks up the same handler and type symbols again, so keep the
+ * ones that were found. Missing symbols are not remembered, a module
+ * loaded later may still provide them.
+ */
+G_LOCK_DEFINE_STATIC (symbols);
+static GModule *symbols_module = NULL;
+static GHashTable *symbols = NULL;
+
+/*< private >
+ * _gtk_builder_lookup_symbol:
+ * @name: the name of a symbol
+ *
+ * Looks up @name in the symbol table of the program.
+ *
+ * Returns: (nullable): the address of the symbol, or %NULL
+ */
+gpointer
+_gtk_builder_lookup_symbol (const gchar *name)
+{
+  gpointer symbol = NULL;
+
+  G_LOCK (symbols);
+
+  if (symbols == NULL)
+    {
+      symbols_module = g_module_open (NULL, G_MODULE_BIND_LAZY);
+      symbols = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+    }
+
+  if (symbols_module != NULL)
+    {
+      symbol = g_hash_table_lookup (symbols, name);
+
+      if (symbol == NULL &&
+          g_module_symbol (symbols_module, name, &symbol) &&
+          symbol != NULL)
+        g_hash_table_insert (symbols, g_strdup (name), symbol);
+    }
+
+  G_UNLOCK (symbols);
+
+  return symbol;
+}
+
 static GType
 _gtk_builder_resolve_type_lazily (const gchar *name)
 {
-  static GModule *module = NULL;
   GTypeGetFunc func;
   gchar *symbol;
   GType gtype = G_TYPE_INVALID;
 
-  if (!module)
-    module = g_module_open (NULL, 0);
-
   symbol = type_name_mangle (name);
 
-  if (g_module_symbol (module, symbol, (gpointer)&func))
+  func = (GTypeGetFunc) _gtk_builder_lookup_symbol (symbol);
+  if (func)
     gtype = func ();
 
   g_free (symbol);
@@ -504,6 +571,202 @@ object_properties_get_value (ObjectProperties *properties,
   return &g_array_index (properties->values, GValue, idx);
 }
 
+/*
+ * GtkBuilderTemplateCache:
+ *
+ * Templates are built with the same types and property values for
+ * every instance, so the types and the converted values of simple
+ * properties can be looked up once per class and copied from then on.
+ * Values that depend on the objects of the builder, like objects and
+ * files, are never cached.
+ */
+struct _GtkBuilderTemplateCache
+{
+  GHashTable *types;
+  GHashTable *values;
+};
+
+typedef struct
+{
+  GParamSpec *pspec;
+  gchar *string;
+} CachedValueKey;
+
+static guint
+cached_value_key_hash (gconstpointer data)
+{
+  const CachedValueKey *key = data;
+
+  return g_direct_hash (key->pspec) ^ g_str_hash (key->string);
+}
+
+static gboolean
+cached_value_key_equal (gconstpointer a,
+                        gconstpointer b)
+{
+  const CachedValueKey *key_a = a;
+  const CachedValueKey *key_b = b;
+
+  return key_a->pspec == key_b->pspec &&
+         strcmp (key_a->string, key_b->string) == 0;
+}
+
+static void
+cached_value_key_free (gpointer data)
+{
+  CachedValueKey *key = data;
+
+  g_free (key->string);
+  g_slice_free (CachedValueKey, key);
+}
+
+static void
+cached_value_free (gpointer data)
+{
+  GValue *value = data;
+
+  g_value_unset (value);
+  g_slice_free (GValue, value);
+}
+
+GtkBuilderTemplateCache *
+_gtk_builder_template_cache_new (void)
+{
+  GtkBuilderTemplateCache *cache;
+
+  cache = g_slice_new (GtkBuilderTemplateCache);
+  cache->types = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+  cache->values = g_hash_table_new_full (cached_value_key_hash,
+                                         cached_value_key_equal,
+                                         cached_value_key_free,
+                                         cached_value_free);
+
+  return cache;
+}
+
+void
+_gtk_builder_template_cache_free (GtkBuilderTemplateCache *cache)
+{
+  g_hash_table_unref (cache->types);
+  g_hash_table_unref (cache->values);
+  g_slice_free (GtkBuilderTemplateCache, cache);
+}
+
+/*< private >
+ * _gtk_builder_set_template_cache:
+ * @builder: a #GtkBuilder
+ * @cache: (nullable): a #GtkBuilderTemplateCache
+ *
+ * Makes @builder look up types and property values in @cache, and
+ * add the ones it resolves. The cache must stay alive while @builder
+ * is adding objects.
+ */
+void
+_gtk_builder_set_template_cache (GtkBuilder              *builder,
+                                 GtkBuilderTemplateCache *cache)
+{
+  GtkBuilderPrivate *priv = gtk_builder_get_instance_private (builder);
+
+  priv->template_cache = cache;
+}
+
+/*< private >
+ * _gtk_builder_lookup_type:
+ * @builder: a #GtkBuilder
+ * @type_name: type name to lookup
+ *
+ * Like gtk_builder_get_type_from_name(), but uses the template
+ * cache of @builder, if it has one.
+ *
+ * Returns: the #GType found for @type_name or #G_TYPE_INVALID
+ */
+GType
+_gtk_builder_lookup_type (GtkBuilder  *builder,
+                          const gchar *type_name)
+{
+  GtkBuilderPrivate *priv = gtk_builder_get_instance_private (builder);
+  GType type;
+
+  if (priv->template_cache)
+    {
+      type = GPOINTER_TO_SIZE (g_hash_table_lookup (priv->template_cache->types, type_name));
+      if (type != G_TYPE_INVALID)
+        return type;
+    }
+
+  type = gtk_builder_get_type_from_name (builder, type_name);
+
+  if (priv->template_cache && type != G_TYPE_INVALID)
+    g_hash_table_insert (priv->template_cache->types,
+                         g_strdup (type_name), GSIZE_TO_POINTER (type));
+
+  return type;
+}
+
+static gboolean
+value_is_cacheable (GParamSpec *pspec)
+{
+  switch (G_TYPE_FUNDAMENTAL (G_PARAM_SPEC_VALUE_TYPE (pspec)))
+    {
+    case G_TYPE_CHAR:
+    case G_TYPE_UCHAR:
+    case G_TYPE_BOOLEAN:
+    case G_TYPE_INT:
+    case G_TYPE_UINT:
+    case G_TYPE_LONG:
+    case G_TYPE_ULONG:
+    case G_TYPE_INT64:
+    case G_TYPE_UINT64:
+    case G_TYPE_ENUM:
+    case G_TYPE_FLAGS:
+    case G_TYPE_FLOAT:
+    case G_TYPE_DOUBLE:
+    case G_TYPE_VARIANT:
+      return TRUE;
+
+    default:
+      return FALSE;
+    }
+}
+
+static gboolean
+gtk_builder_value_from_string_cached (GtkBuilder   *builder,
+                                      GParamSpec   *pspec,
+                                      const gchar  *string,
+                                      GValue       *value,
+                                      GError      **error)
+{
+  GtkBuilderPrivate *priv = gtk_builder_get_instance_private (builder);
+  CachedValueKey lookup, *key;
+  GValue *cached;
+
+  if (!priv->template_cache || !value_is_cacheable (pspec))
+    return gtk_builder_value_from_string (builder, pspec, string, value, error);
+
+  lookup.pspec = pspec;
+  lookup.string = (gchar *) string;
+  cached = g_hash_table_lookup (priv->template_cache->values, &lookup);
+  if (cached)
+    {
+      g_value_init (value, G_VALUE_TYPE (cached));
+      g_value_copy (cached, value);
+      return TRUE;
+    }
+
+  if (!gtk_builder_value_from_string (builder, pspec, string, value, error))
+    return FALSE;
+
+  key = g_slice_new (CachedValueKey);
+  key->pspec = pspec;
+  key->string = g_strdup (string);
+  cached = g_slice_new0 (GValue);
+  g_value_init (cached, G_VALUE_TYPE (value));
+  g_value_copy (value, cached);
+  g_hash_table_insert (priv->template_cache->values, key, cached);
+
+  return TRUE;
+}
+
 static void
 gtk_builder_get_parameters (GtkBuilder         *builder,
                             GType               object_type,
@@ -535,8 +798,8 @@ gtk_builder_get_parameters (GtkBuilder         *builder,
           (G_PARAM_SPEC_VALUE_TYPE (prop->pspec) != GDK_TYPE_PAINTABLE) &&
           (G_PARAM_SPEC_VALUE_TYPE (prop->pspec) != G_TYPE_FILE))
         {
-          GObject *object = g_hash_table_lookup (priv->objects,
-                                                 g_strstrip (prop->text->str));
+          GObject *object = gtk_builder_get_object (builder,
+                                                    g_strstrip (prop->text->str));
 
           if (object)
             {
@@ -571,10 +834,10 @@ gtk_builder_get_parameters (GtkBuilder         *builder,
            */
           continue;
         }
-      else if (!gtk_builder_value_from_string (builder, prop->pspec,
-                                               prop->text->str,
-                                               &property_value,
-                                               &error))
+      else if (!gtk_builder_value_from_string_cached (builder, prop->pspec,
+                                                      prop->text->str,
+                                                      &property_value,
+                                                      &error))
         {
           g_warning ("Failed to set property %s.%s to %s: %s",
                      g_type_name (object_type), prop->pspec->name, prop->text->str,
@@ -994,9 +1257,13 @@ static inline void
 gtk_builder_create_bindings (GtkBuilder *builder)
 {
   GtkBuilderPrivate *priv = gtk_builder_get_instance_private (builder);
-  GSList *l;
+  GSList *l, *bindings;
+
+  /* Take the list over, building lazy objects adds bindings */
+  bindings = priv->bindings;
+  priv->bindings = NULL;
 
-  for (l = priv->bindings; l; l = l->next)
+  for (l = bindings; l; l = l->next)
     {
       BindingInfo *info = l->data;
       GObject *source;
@@ -1010,8 +1277,7 @@ gtk_builder_create_bindings (GtkBuilder *builder)
       free_binding_info (info, NULL);
     }
 
-  g_slist_free (priv->bindings);
-  priv->bindings = NULL;
+  g_slist_free (bindings);
 }
 
 void
@@ -1494,6 +1760,102 @@ gtk_builder_add_objects_from_string (GtkBuilder   *builder,
   return TRUE;
 }
 
+static DeferredObject *
+deferred_object_ref (DeferredObject *deferred)
+{
+  deferred->ref_count++;
+  return deferred;
+}
+
+static void
+deferred_object_unref (DeferredObject *deferred)
+{
+  deferred->ref_count--;
+  if (deferred->ref_count > 0)
+    return;
+
+  g_free (deferred->filename);
+  g_free (deferred->buffer);
+  g_strfreev (deferred->ids);
+  g_slice_free (DeferredObject, deferred);
+}
+
+/*< private >
+ * _gtk_builder_add_deferred:
+ * @builder: a #GtkBuilder
+ * @filename: the file the object is from, for error messages
+ * @buffer: (transfer full): a UI definition containing the object
+ * @length: the length of @buffer
+ * @ids: (transfer full): the ids of all objects in @buffer
+ *
+ * Adds a lazy object, which is constructed from @buffer the first
+ * time one of @ids is looked up.
+ */
+void
+_gtk_builder_add_deferred (GtkBuilder  *builder,
+                           const gchar *filename,
+                           gchar       *buffer,
+                           gsize        length,
+                           gchar      **ids)
+{
+  GtkBuilderPrivate *priv = gtk_builder_get_instance_private (builder);
+  DeferredObject *deferred;
+  gint i;
+
+  if (priv->deferred_objects == NULL)
+    priv->deferred_objects = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                                    g_free, (GDestroyNotify) deferred_object_unref);
+
+  deferred = g_slice_new (DeferredObject);
+  deferred->ref_count = 0;
+  deferred->filename = g_strdup (filename);
+  deferred->buffer = buffer;
+  deferred->length = length;
+  deferred->ids = ids;
+
+  for (i = 0; ids[i]; i++)
+    g_hash_table_insert (priv->deferred_objects,
+                         g_strdup (ids[i]), deferred_object_ref (deferred));
+}
+
+static void
+gtk_builder_build_deferred (GtkBuilder     *builder,
+                            DeferredObject *deferred)
+{
+  GtkBuilderPrivate *priv = gtk_builder_get_instance_private (builder);
+  GSList *delayed_properties, *bindings;
+  GError *error = NULL;
+  gint i;
+
+  deferred_object_ref (deferred);
+
+  for (i = 0; deferred->ids[i]; i++)
+    g_hash_table_remove (priv->deferred_objects, deferred->ids[i]);
+
+  /* This may happen while other objects are being built, and those
+   * must not see the properties and bindings of the lazy object
+   */
+  delayed_properties = priv->delayed_properties;
+  bindings = priv->bindings;
+  priv->delayed_properties = NULL;
+  priv->bindings = NULL;
+
+  _gtk_builder_parser_parse_buffer (builder, deferred->filename,
+                                    deferred->buffer, deferred->length,
+                                    NULL,
+                                    &error);
+  if (error)
+    {
+      g_warning ("Failed to build lazy object: %s", error->message);
+      g_error_free (error);
+    }
+
+  priv->delayed_properties = delayed_properties;
+  priv->bindings = bindings;
+
+  deferred_object_unref (deferred);
+}
+
 /**
  * gtk_builder_get_object:
  * @builder: a #GtkBuilder
@@ -1510,10 +1872,22 @@ gtk_builder_get_object (GtkBuilder  *builder,
                         const gchar *name)
 {
   GtkBuilderPrivate *priv = gtk_builder_get_instance_private (builder);
+  GObject *object;
+  DeferredObject *deferred;
 
   g_return_val_if_fail (GTK_IS_BUILDER (builder), NULL);
   g_return_val_if_fail (name != NULL, NULL);
 
+  object = g_hash_table_lookup (priv->objects, name);
+  if (object || !priv->deferred_objects)
+    return object;
+
+  deferred = g_hash_table_lookup (priv->deferred_objects, name);
+  if (!deferred)
+    return NULL;
+
+  gtk_builder_build_deferred (builder, deferred);
+
   return g_hash_table_lookup (priv->objects, name);
 }
 
@@ -1618,7 +1992,7 @@ gtk_builder_expose_object (GtkBuilder    *builder,
 
 
 typedef struct {
-  GModule *module;
+  gboolean module_supported;
   gpointer data;
 } ConnectArgs;
 
@@ -1641,10 +2015,11 @@ gtk_builder_connect_signals_default (GtkBuilder    *builder,
       /* Only error out for missing GModule support if we've not
        * found the symbols explicitly added with gtk_builder_add_callback_symbol()
        */
-      if (args->module == NULL)
+      if (!args->module_supported)
         g_error ("gtk_builder_connect_signals() requires working GModule");
 
-      if (!g_module_symbol (args->module, handler_name, (gpointer)&func))
+      func = (GCallback) _gtk_builder_lookup_symbol (handler_name);
+      if (!func)
         {
           g_warning ("Could not find signal handler '%s'.  Did you compile with -rdynamic?", handler_name);
           return;
@@ -1694,17 +2069,11 @@ gtk_builder_connect_signals (GtkBuilder *builder,
   g_return_if_fail (GTK_IS_BUILDER (builder));
 
   args.data = user_data;
-
-  if (g_module_supported ())
-    args.module = g_module_open (NULL, G_MODULE_BIND_LAZY);
-  else
-    args.module = NULL;
+  args.module_supported = g_module_supported ();
 
   gtk_builder_connect_signals_full (builder,
                                     gtk_builder_connect_signals_default,
                                     &args);
-  if (args.module)
-    g_module_close (args.module);
 }
 
 /**
@@ -2768,10 +3137,30 @@ _gtk_builder_prefix_error (GtkBuilder           *builder,
                            GMarkupParseContext  *context,
                            GError              **error)
 {
-  GtkBuilderPrivate *priv = gtk_builder_get_instance_private (builder);
   gint line, col;
 
   g_markup_parse_context_get_position (context, &line, &col);
+  _gtk_builder_prefix_error_at (builder, line, col, error);
+}
+
+/*< private >
+ * _gtk_builder_prefix_error_at:
+ * @builder: a #GtkBuilder
+ * @line: the line of the error
+ * @col: the column of the error
+ * @error: an error
+ *
+ * Like _gtk_builder_prefix_error(), for when there is no
+ * #GMarkupParseContext to take the position from.
+ */
+void
+_gtk_builder_prefix_error_at (GtkBuilder  *builder,
+                              gint         line,
+                              gint         col,
+                              GError     **error)
+{
+  GtkBuilderPrivate *priv = gtk_builder_get_instance_private (builder);
+
   g_prefix_error (error, "%s:%d:%d ", priv->filename, line, col);
 }
 
@@ -2877,7 +3266,7 @@ _gtk_builder_lookup_object (GtkBuilder  *builder,
   GObject *obj;
   GError *error = NULL;
 
-  obj = g_hash_table_lookup (priv->objects, name);
+  obj = gtk_builder_get_object (builder, name);
   error = (GError *) g_object_get_data (G_OBJECT (builder), "lookup-error");
 
   if (!obj && !error)
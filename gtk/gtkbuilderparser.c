@@ -23,6 +23,7 @@
 
 #include <gio/gio.h>
 #include "gtkbuilderprivate.h"
+#include "gtkbuilderprecompileprivate.h"
 #include "gtkbuilder.h"
 #include "gtkbuildable.h"
 #include "gtkdebug.h"
@@ -65,6 +66,37 @@ state_pop (ParserData *data)
 #define state_peek_info(data, st) ((st*)state_peek(data))
 #define state_pop_info(data, st) ((st*)state_pop(data))
 
+/* When replaying precompiled data, there is only a parse
+ * context while a custom tag fragment is parsed
+ */
+static void
+get_position (ParserData *data,
+              gint       *line,
+              gint       *col)
+{
+  if (data->ctx)
+    {
+      g_markup_parse_context_get_position (data->ctx, line, col);
+    }
+  else
+    {
+      if (line)
+        *line = data->line;
+      if (col)
+        *col = data->col;
+    }
+}
+
+static void
+prefix_error (ParserData  *data,
+              GError     **error)
+{
+  gint line, col;
+
+  get_position (data, &line, &col);
+  _gtk_builder_prefix_error_at (data->builder, line, col, error);
+}
+
 static void
 error_missing_attribute (ParserData   *data,
                          const gchar  *tag,
@@ -73,7 +105,7 @@ error_missing_attribute (ParserData   *data,
 {
   gint line, col;
 
-  g_markup_parse_context_get_position (data->ctx, &line, &col);
+  get_position (data, &line, &col);
 
   g_set_error (error,
                GTK_BUILDER_ERROR,
@@ -90,7 +122,7 @@ error_invalid_tag (ParserData   *data,
 {
   gint line, col;
 
-  g_markup_parse_context_get_position (data->ctx, &line, &col);
+  get_position (data, &line, &col);
 
   if (expected)
     g_set_error (error,
@@ -113,7 +145,7 @@ error_unhandled_tag (ParserData   *data,
 {
   gint line, col;
 
-  g_markup_parse_context_get_position (data->ctx, &line, &col);
+  get_position (data, &line, &col);
   g_set_error (error,
                GTK_BUILDER_ERROR,
                GTK_BUILDER_ERROR_UNHANDLED_TAG,
@@ -162,13 +194,10 @@ builder_construct (ParserData  *data,
 static GType
 _get_type_by_symbol (const gchar *symbol)
 {
-  static GModule *module = NULL;
   GTypeGetFunc func;
 
-  if (!module)
-    module = g_module_open (NULL, 0);
-
-  if (!g_module_symbol (module, symbol, (gpointer)&func))
+  func = (GTypeGetFunc) _gtk_builder_lookup_symbol (symbol);
+  if (!func)
     return G_TYPE_INVALID;
 
   return func ();
@@ -193,7 +222,7 @@ parse_requires (ParserData   *data,
                                     G_MARKUP_COLLECT_STRING, "version", &version,
                                     G_MARKUP_COLLECT_INVALID))
     {
-      _gtk_builder_prefix_error (data->builder, data->ctx, error);
+      prefix_error (data, error);
       return;
     }
 
@@ -203,7 +232,7 @@ parse_requires (ParserData   *data,
                    GTK_BUILDER_ERROR,
                    GTK_BUILDER_ERROR_INVALID_VALUE,
                    "'version' attribute has malformed value '%s'", version);
-      _gtk_builder_prefix_error (data->builder, data->ctx, error);
+      prefix_error (data, error);
       return;
     }
   version_major = g_ascii_strtoll (split[0], NULL, 10);
@@ -234,8 +263,7 @@ is_requested_object (const gchar *object,
 }
 
 static void
-parse_object (GMarkupParseContext  *context,
-              ParserData           *data,
+parse_object (ParserData           *data,
               const gchar          *element_name,
               const gchar         **names,
               const gchar         **values,
@@ -269,9 +297,10 @@ parse_object (GMarkupParseContext  *context,
                                     G_MARKUP_COLLECT_STRING|G_MARKUP_COLLECT_OPTIONAL, "constructor", &constructor,
                                     G_MARKUP_COLLECT_STRING|G_MARKUP_COLLECT_OPTIONAL, "type-func", &type_func,
                                     G_MARKUP_COLLECT_STRING|G_MARKUP_COLLECT_OPTIONAL, "id", &object_id,
+                                    G_MARKUP_COLLECT_STRING|G_MARKUP_COLLECT_OPTIONAL, "lazy", NULL,
                                     G_MARKUP_COLLECT_INVALID))
     {
-      _gtk_builder_prefix_error (data->builder, data->ctx, error);
+      prefix_error (data, error);
       return;
     }
 
@@ -293,7 +322,7 @@ parse_object (GMarkupParseContext  *context,
                        GTK_BUILDER_ERROR,
                        GTK_BUILDER_ERROR_INVALID_TYPE_FUNCTION,
                        "Invalid type function '%s'", type_func);
-          _gtk_builder_prefix_error (data->builder, context, error);
+          prefix_error (data, error);
           return;
         }
     }
@@ -301,14 +330,14 @@ parse_object (GMarkupParseContext  *context,
     {
       g_assert_nonnull (object_class);
 
-      object_type = gtk_builder_get_type_from_name (data->builder, object_class);
+      object_type = _gtk_builder_lookup_type (data->builder, object_class);
       if (object_type == G_TYPE_INVALID)
         {
           g_set_error (error,
                        GTK_BUILDER_ERROR,
                        GTK_BUILDER_ERROR_INVALID_VALUE,
                        "Invalid object type '%s'", object_class);
-          _gtk_builder_prefix_error (data->builder, context, error);
+          prefix_error (data, error);
           return;
        }
     }
@@ -358,17 +387,16 @@ parse_object (GMarkupParseContext  *context,
                    GTK_BUILDER_ERROR_DUPLICATE_ID,
                    "Duplicate object ID '%s' (previously on line %d)",
                    object_id, line);
-      _gtk_builder_prefix_error (data->builder, context, error);
+      prefix_error (data, error);
       return;
     }
 
-  g_markup_parse_context_get_position (context, &line, NULL);
+  get_position (data, &line, NULL);
   g_hash_table_insert (data->object_ids, g_strdup (object_id), GINT_TO_POINTER (line));
 }
 
 static void
-parse_template (GMarkupParseContext  *context,
-                ParserData           *data,
+parse_template (ParserData           *data,
                 const gchar          *element_name,
                 const gchar         **names,
                 const gchar         **values,
@@ -388,7 +416,7 @@ parse_template (GMarkupParseContext  *context,
                                     G_MARKUP_COLLECT_STRING|G_MARKUP_COLLECT_OPTIONAL, "parent", &parent_class,
                                     G_MARKUP_COLLECT_INVALID))
     {
-      _gtk_builder_prefix_error (data->builder, data->ctx, error);
+      prefix_error (data, error);
       return;
     }
 
@@ -399,7 +427,7 @@ parse_template (GMarkupParseContext  *context,
                    GTK_BUILDER_ERROR_UNHANDLED_TAG,
                    "Not expecting to handle a template (class '%s', parent '%s')",
                    object_class, parent_class ? parent_class : "GtkWidget");
-      _gtk_builder_prefix_error (data->builder, context, error);
+      prefix_error (data, error);
       return;
     }
   else if (state_peek (data) != NULL)
@@ -416,7 +444,7 @@ parse_template (GMarkupParseContext  *context,
                    GTK_BUILDER_ERROR_TEMPLATE_MISMATCH,
                    "Parsed template definition for type '%s', expected type '%s'",
                    object_class, g_type_name (template_type));
-      _gtk_builder_prefix_error (data->builder, context, error);
+      prefix_error (data, error);
       return;
     }
 
@@ -430,7 +458,7 @@ parse_template (GMarkupParseContext  *context,
           g_set_error (error, GTK_BUILDER_ERROR,
                        GTK_BUILDER_ERROR_INVALID_VALUE,
                        "Invalid template parent type '%s'", parent_class);
-          _gtk_builder_prefix_error (data->builder, context, error);
+          prefix_error (data, error);
           return;
         }
       if (parent_type != expected_type)
@@ -439,7 +467,7 @@ parse_template (GMarkupParseContext  *context,
                        GTK_BUILDER_ERROR_TEMPLATE_MISMATCH,
                        "Template parent type '%s' does not match instance parent type '%s'.",
                        parent_class, g_type_name (expected_type));
-          _gtk_builder_prefix_error (data->builder, context, error);
+          prefix_error (data, error);
           return;
         }
     }
@@ -462,11 +490,11 @@ parse_template (GMarkupParseContext  *context,
                    GTK_BUILDER_ERROR_DUPLICATE_ID,
                    "Duplicate object ID '%s' (previously on line %d)",
                    object_class, line);
-      _gtk_builder_prefix_error (data->builder, context, error);
+      prefix_error (data, error);
       return;
     }
 
-  g_markup_parse_context_get_position (context, &line, NULL);
+  get_position (data, &line, NULL);
   g_hash_table_insert (data->object_ids, g_strdup (object_class), GINT_TO_POINTER (line));
 }
 
@@ -510,7 +538,7 @@ parse_child (ParserData   *data,
                                     G_MARKUP_COLLECT_STRING|G_MARKUP_COLLECT_OPTIONAL, "internal-child", &internal_child,
                                     G_MARKUP_COLLECT_INVALID))
     {
-      _gtk_builder_prefix_error (data->builder, data->ctx, error);
+      prefix_error (data, error);
       return;
     }
 
@@ -570,7 +598,7 @@ parse_property (ParserData   *data,
                                     G_MARKUP_COLLECT_STRING|G_MARKUP_COLLECT_OPTIONAL, "bind-flags", &bind_flags_str,
                                     G_MARKUP_COLLECT_INVALID))
     {
-      _gtk_builder_prefix_error (data->builder, data->ctx, error);
+      prefix_error (data, error);
       return;
     }
 
@@ -583,7 +611,7 @@ parse_property (ParserData   *data,
                    GTK_BUILDER_ERROR_INVALID_PROPERTY,
                    "Invalid property: %s.%s",
                    g_type_name (object_info->type), name);
-      _gtk_builder_prefix_error (data->builder, data->ctx, error);
+      prefix_error (data, error);
       return;
     }
 
@@ -591,12 +619,12 @@ parse_property (ParserData   *data,
     {
       if (!_gtk_builder_flags_from_string (G_TYPE_BINDING_FLAGS, NULL, bind_flags_str, &bind_flags, error))
         {
-          _gtk_builder_prefix_error (data->builder, data->ctx, error);
+          prefix_error (data, error);
           return;
         }
     }
 
-  g_markup_parse_context_get_position (data->ctx, &line, &col);
+  get_position (data, &line, &col);
 
   if (bind_source && bind_property)
     {
@@ -677,7 +705,7 @@ parse_signal (ParserData   *data,
                                     G_MARKUP_COLLECT_TRISTATE|G_MARKUP_COLLECT_OPTIONAL, "swapped", &swapped,
                                     G_MARKUP_COLLECT_INVALID))
     {
-      _gtk_builder_prefix_error (data->builder, data->ctx, error);
+      prefix_error (data, error);
       return;
     }
 
@@ -688,7 +716,7 @@ parse_signal (ParserData   *data,
                    GTK_BUILDER_ERROR_INVALID_SIGNAL,
                    "Invalid signal '%s' for type '%s'",
                    name, g_type_name (object_info->type));
-      _gtk_builder_prefix_error (data->builder, data->ctx, error);
+      prefix_error (data, error);
       return;
     }
 
@@ -747,7 +775,7 @@ parse_interface (ParserData   *data,
                                     G_MARKUP_COLLECT_STRING|G_MARKUP_COLLECT_OPTIONAL, "domain", &domain,
                                     G_MARKUP_COLLECT_INVALID))
     {
-      _gtk_builder_prefix_error (data->builder, data->ctx, error);
+      prefix_error (data, error);
       return;
     }
 
@@ -917,6 +945,142 @@ parse_custom (GMarkupParseContext  *context,
   return TRUE;
 }
 
+/* Lazy objects are copied out of the UI definition as XML, with
+ * their line numbers, and parsed when they are first looked up
+ */
+static gboolean
+is_lazy_object (ParserData   *data,
+                const gchar  *element_name,
+                const gchar **names,
+                const gchar **values)
+{
+  const gchar *lazy = NULL;
+  const gchar *id = NULL;
+  gboolean value;
+  gint i;
+
+  if (strcmp (element_name, "object") != 0 ||
+      data->subparser || data->stack ||
+      data->cur_object_level != 0 ||
+      data->requested_objects)
+    return FALSE;
+
+  for (i = 0; names[i]; i++)
+    {
+      if (strcmp (names[i], "lazy") == 0)
+        lazy = values[i];
+      else if (strcmp (names[i], "id") == 0)
+        id = values[i];
+    }
+
+  if (lazy == NULL || id == NULL)
+    return FALSE;
+
+  return _gtk_builder_boolean_from_string (lazy, &value, NULL) && value;
+}
+
+static void
+deferred_append_text (ParserData  *data,
+                      const gchar *text,
+                      gssize       text_len)
+{
+  gchar *escaped;
+  const gchar *p;
+
+  escaped = g_markup_escape_text (text, text_len);
+  for (p = escaped; *p; p++)
+    if (*p == '\n')
+      data->deferred_line++;
+  g_string_append (data->deferred, escaped);
+  g_free (escaped);
+}
+
+static void
+deferred_start_element (ParserData   *data,
+                        const gchar  *element_name,
+                        const gchar **names,
+                        const gchar **values,
+                        GError      **error)
+{
+  gint line, i;
+
+  get_position (data, &line, NULL);
+
+  if (data->deferred == NULL)
+    {
+      data->deferred = g_string_new ("<interface");
+      if (data->domain)
+        {
+          g_string_append (data->deferred, " domain=\"");
+          deferred_append_text (data, data->domain, -1);
+          g_string_append_c (data->deferred, '"');
+        }
+      g_string_append_c (data->deferred, '>');
+      data->deferred_line = 1;
+      data->deferred_ids = g_ptr_array_new_with_free_func (g_free);
+    }
+
+  for (; data->deferred_line < line; data->deferred_line++)
+    g_string_append_c (data->deferred, '\n');
+
+  g_string_append_printf (data->deferred, "<%s", element_name);
+  for (i = 0; names[i]; i++)
+    {
+      if (data->deferred_depth == 0 && strcmp (names[i], "lazy") == 0)
+        continue;
+
+      if (strcmp (element_name, "object") == 0 && strcmp (names[i], "id") == 0)
+        {
+          gint previous;
+
+          previous = GPOINTER_TO_INT (g_hash_table_lookup (data->object_ids, values[i]));
+          if (previous != 0)
+            {
+              g_set_error (error,
+                           GTK_BUILDER_ERROR,
+                           GTK_BUILDER_ERROR_DUPLICATE_ID,
+                           "Duplicate object ID '%s' (previously on line %d)",
+                           values[i], previous);
+              prefix_error (data, error);
+              return;
+            }
+
+          g_hash_table_insert (data->object_ids, g_strdup (values[i]), GINT_TO_POINTER (line));
+          g_ptr_array_add (data->deferred_ids, g_strdup (values[i]));
+        }
+
+      g_string_append_printf (data->deferred, " %s=\"", names[i]);
+      deferred_append_text (data, values[i], -1);
+      g_string_append_c (data->deferred, '"');
+    }
+  g_string_append_c (data->deferred, '>');
+
+  data->deferred_depth++;
+}
+
+static void
+deferred_end_element (ParserData  *data,
+                      const gchar *element_name)
+{
+  gsize length;
+  gchar *buffer;
+
+  g_string_append_printf (data->deferred, "</%s>", element_name);
+
+  if (--data->deferred_depth > 0)
+    return;
+
+  g_string_append (data->deferred, "</interface>");
+  g_ptr_array_add (data->deferred_ids, NULL);
+
+  length = data->deferred->len;
+  buffer = g_string_free (data->deferred, FALSE);
+  _gtk_builder_add_deferred (data->builder, data->filename, buffer, length,
+                             (gchar **) g_ptr_array_free (data->deferred_ids, FALSE));
+  data->deferred = NULL;
+  data->deferred_ids = NULL;
+}
+
 static void
 start_element (GMarkupParseContext  *context,
                const gchar          *element_name,
@@ -952,6 +1116,13 @@ start_element (GMarkupParseContext  *context,
     }
   data->last_element = element_name;
 
+  if (data->deferred_depth > 0 ||
+      is_lazy_object (data, element_name, names, values))
+    {
+      deferred_start_element (data, element_name, names, values, error);
+      return;
+    }
+
   if (data->subparser)
     {
       if (!subparser_start (context, element_name, names, values, data, error))
@@ -959,7 +1130,7 @@ start_element (GMarkupParseContext  *context,
     }
 
   if (strcmp (element_name, "object") == 0)
-    parse_object (context, data, element_name, names, values, error);
+    parse_object (data, element_name, names, values, error);
   else if (data->requested_objects && !data->inside_requested_object)
     {
       /* If outside a requested object, simply ignore this tag */
@@ -971,7 +1142,7 @@ start_element (GMarkupParseContext  *context,
   else if (strcmp (element_name, "signal") == 0)
     parse_signal (data, element_name, names, values, error);
   else if (strcmp (element_name, "template") == 0)
-    parse_template (context, data, element_name, names, values, error);
+    parse_template (data, element_name, names, values, error);
   else if (strcmp (element_name, "requires") == 0)
     parse_requires (data, element_name, names, values, error);
   else if (strcmp (element_name, "interface") == 0)
@@ -1013,6 +1184,12 @@ end_element (GMarkupParseContext  *context,
 
   GTK_NOTE (BUILDER, g_message ("</%s>", element_name));
 
+  if (data->deferred_depth > 0)
+    {
+      deferred_end_element (data, element_name);
+      return;
+    }
+
   if (data->subparser && data->subparser->start)
     {
       subparser_end (context, element_name, data, error);
@@ -1130,7 +1307,7 @@ end_element (GMarkupParseContext  *context,
                            req_info->library,
                            req_info->major, req_info->minor,
                            GTK_MAJOR_VERSION, GTK_MINOR_VERSION);
-              _gtk_builder_prefix_error (data->builder, context, error);
+              prefix_error (data, error);
            }
         }
       free_requires_info (req_info, NULL);
@@ -1151,7 +1328,7 @@ end_element (GMarkupParseContext  *context,
                    GTK_BUILDER_ERROR,
                    GTK_BUILDER_ERROR_UNHANDLED_TAG,
                    "Unhandled tag: <%s>", element_name);
-      _gtk_builder_prefix_error (data->builder, context, error);
+      prefix_error (data, error);
     }
 }
 
@@ -1167,6 +1344,12 @@ text (GMarkupParseContext  *context,
   ParserData *data = (ParserData*)user_data;
   CommonInfo *info;
 
+  if (data->deferred_depth > 0)
+    {
+      deferred_append_text (data, text, text_len);
+      return;
+    }
+
   if (data->subparser && data->subparser->start)
     {
       GError *tmp_error = NULL;
@@ -1185,7 +1368,9 @@ text (GMarkupParseContext  *context,
   info = state_peek_info (data, CommonInfo);
   g_assert (info != NULL);
 
-  if (strcmp (g_markup_parse_context_get_element (context), "property") == 0)
+  /* Precompiled data only has text inside <property> */
+  if (context == NULL ||
+      strcmp (g_markup_parse_context_get_element (context), "property") == 0)
     {
       PropertyInfo *prop_info = (PropertyInfo*)info;
 
@@ -1226,6 +1411,147 @@ static const GMarkupParser parser = {
   NULL,
 };
 
+static void
+replay_start_element (const gchar  *element_name,
+                      const gchar **names,
+                      const gchar **values,
+                      gint          line,
+                      gint          col,
+                      gpointer      user_data,
+                      GError      **error)
+{
+  ParserData *data = user_data;
+
+  data->line = line;
+  data->col = col;
+
+  start_element (NULL, element_name, names, values, data, error);
+}
+
+static void
+replay_end_element (const gchar  *element_name,
+                    gpointer      user_data,
+                    GError      **error)
+{
+  end_element (NULL, element_name, user_data, error);
+}
+
+static void
+replay_text (const gchar  *text_data,
+             gsize         text_len,
+             gpointer      user_data,
+             GError      **error)
+{
+  text (NULL, text_data, text_len, user_data, error);
+}
+
+typedef struct {
+  ParserData *data;
+  guint depth;
+  gboolean wrapped;
+} FragmentData;
+
+/* Custom tag fragments are wrapped in their parent element, so
+ * that custom parsers find the element stack they expect
+ */
+static void
+fragment_start_element (GMarkupParseContext  *context,
+                        const gchar          *element_name,
+                        const gchar         **names,
+                        const gchar         **values,
+                        gpointer              user_data,
+                        GError              **error)
+{
+  FragmentData *fragment = user_data;
+
+  if (fragment->depth++ == 0 && fragment->wrapped)
+    return;
+
+  start_element (context, element_name, names, values, fragment->data, error);
+}
+
+static void
+fragment_end_element (GMarkupParseContext  *context,
+                      const gchar          *element_name,
+                      gpointer              user_data,
+                      GError              **error)
+{
+  FragmentData *fragment = user_data;
+
+  if (--fragment->depth == 0 && fragment->wrapped)
+    return;
+
+  end_element (context, element_name, fragment->data, error);
+}
+
+static void
+fragment_text (GMarkupParseContext  *context,
+               const gchar          *text_data,
+               gsize                 text_len,
+               gpointer              user_data,
+               GError              **error)
+{
+  FragmentData *fragment = user_data;
+
+  if (fragment->depth <= (fragment->wrapped ? 1 : 0))
+    return;
+
+  text (context, text_data, text_len, fragment->data, error);
+}
+
+static const GMarkupParser fragment_parser = {
+  fragment_start_element,
+  fragment_end_element,
+  fragment_text,
+  NULL,
+};
+
+static void
+replay_fragment (const gchar  *parent_name,
+                 const gchar  *xml,
+                 gsize         xml_len,
+                 gint          line,
+                 gpointer      user_data,
+                 GError      **error)
+{
+  ParserData *data = user_data;
+  FragmentData fragment;
+  GString *buffer;
+  gint i;
+
+  fragment.data = data;
+  fragment.depth = 0;
+  fragment.wrapped = parent_name[0] != '\0';
+
+  buffer = g_string_sized_new (xml_len + line + 2 * strlen (parent_name) + 5);
+  if (fragment.wrapped)
+    g_string_append_printf (buffer, "<%s>", parent_name);
+  /* Keep the line numbers of the original file */
+  for (i = 1; i < line; i++)
+    g_string_append_c (buffer, '\n');
+  g_string_append_len (buffer, xml, xml_len);
+  if (fragment.wrapped)
+    g_string_append_printf (buffer, "</%s>", parent_name);
+
+  data->ctx = g_markup_parse_context_new (&fragment_parser,
+                                          G_MARKUP_TREAT_CDATA_AS_TEXT,
+                                          &fragment, NULL);
+
+  if (g_markup_parse_context_parse (data->ctx, buffer->str, buffer->len, error))
+    g_markup_parse_context_end_parse (data->ctx, error);
+
+  g_markup_parse_context_free (data->ctx);
+  data->ctx = NULL;
+  g_string_free (buffer, TRUE);
+}
+
+static const GtkBuilderReplayParser replay_parser = {
+  replay_start_element,
+  replay_end_element,
+  replay_text,
+  replay_fragment
+};
+
 void
 _gtk_builder_parser_parse_buffer (GtkBuilder   *builder,
                                   const gchar  *filename,
@@ -1263,12 +1589,21 @@ _gtk_builder_parser_parse_buffer (GtkBuilder   *builder,
       data.inside_requested_object = TRUE;
     }
 
-  data.ctx = g_markup_parse_context_new (&parser,
-                                          G_MARKUP_TREAT_CDATA_AS_TEXT,
-                                          &data, NULL);
+  /* Precompiled data always has a length, it contains nul bytes */
+  if ((gssize) length >= 0 && _gtk_builder_is_precompiled (buffer, length))
+    {
+      if (!_gtk_builder_replay_precompiled (buffer, length, &replay_parser, &data, error))
+        goto out;
+    }
+  else
+    {
+      data.ctx = g_markup_parse_context_new (&parser,
+                                              G_MARKUP_TREAT_CDATA_AS_TEXT,
+                                              &data, NULL);
 
-  if (!g_markup_parse_context_parse (data.ctx, buffer, length, error))
-    goto out;
+      if (!g_markup_parse_context_parse (data.ctx, buffer, length, error))
+        goto out;
+    }
 
   _gtk_builder_finish (builder);
   if (_gtk_builder_lookup_failed (builder, error))
@@ -1307,7 +1642,12 @@ _gtk_builder_parser_parse_buffer (GtkBuilder   *builder,
   g_slist_free (data.finalizers);
   g_free (data.domain);
   g_hash_table_destroy (data.object_ids);
-  g_markup_parse_context_free (data.ctx);
+  if (data.deferred)
+    g_string_free (data.deferred, TRUE);
+  if (data.deferred_ids)
+    g_ptr_array_free (data.deferred_ids, TRUE);
+  if (data.ctx)
+    g_markup_parse_context_free (data.ctx);
 
   /* restore the original domain */
   gtk_builder_set_translation_domain (builder, domain);
@@ -0,0 +1,74 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GTK_BUILDER_PRECOMPILE_PRIVATE_H__
+#define __GTK_BUILDER_PRECOMPILE_PRIVATE_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/*
+ * GtkBuilderReplayParser:
+ *
+ * The callbacks that _gtk_builder_replay_precompiled() calls for the
+ * records of precompiled data. @start_element, @end_element and @text
+ * are called for the elements that GtkBuilder handles itself, with
+ * the position of the element in the original file.
+ *
+ * Everything below other elements, which are handed to custom tag
+ * parsers, is passed to @fragment as XML. The XML starts on line
+ * @line of the original file and its lines match the original ones.
+ */
+typedef struct
+{
+  void (* start_element) (const gchar  *element_name,
+                          const gchar **attribute_names,
+                          const gchar **attribute_values,
+                          gint          line,
+                          gint          col,
+                          gpointer      user_data,
+                          GError      **error);
+  void (* end_element)   (const gchar  *element_name,
+                          gpointer      user_data,
+                          GError      **error);
+  void (* text)          (const gchar  *text,
+                          gsize         text_len,
+                          gpointer      user_data,
+                          GError      **error);
+  void (* fragment)      (const gchar  *parent_name,
+                          const gchar  *xml,
+                          gsize         xml_len,
+                          gint          line,
+                          gpointer      user_data,
+                          GError      **error);
+} GtkBuilderReplayParser;
+
+gboolean      _gtk_builder_is_precompiled       (const gchar                  *data,
+                                                 gsize                         length);
+GBytes *      _gtk_builder_precompile           (const gchar                  *data,
+                                                 gssize                        length,
+                                                 GError                      **error);
+gboolean      _gtk_builder_replay_precompiled   (const gchar                  *data,
+                                                 gsize                         length,
+                                                 const GtkBuilderReplayParser *parser,
+                                                 gpointer                      user_data,
+                                                 GError                      **error);
+
+G_END_DECLS
+
+#endif /* __GTK_BUILDER_PRECOMPILE_PRIVATE_H__ */
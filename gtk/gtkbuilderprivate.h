@@ -116,6 +116,10 @@ typedef struct {
   SubParser *subparser;
   GMarkupParseContext *ctx;
   const gchar *filename;
+
+  /* The position of the current element when replaying precompiled data */
+  gint line;
+  gint col;
   GSList *finalizers;
   GSList *custom_finalizers;
 
@@ -127,10 +131,18 @@ typedef struct {
   gint object_counter;
 
   GHashTable *object_ids;
+
+  /* A lazy object that is being copied out, see _gtk_builder_add_deferred() */
+  GString *deferred;
+  gint deferred_depth;
+  gint deferred_line;
+  GPtrArray *deferred_ids;
 } ParserData;
 
 typedef GType (*GTypeGetFunc) (void);
 
+typedef struct _GtkBuilderTemplateCache GtkBuilderTemplateCache;
+
 /* Things only GtkBuilder should use */
 void _gtk_builder_parser_parse_buffer (GtkBuilder *builder,
                                        const gchar *filename,
@@ -185,9 +197,28 @@ void      _gtk_builder_menu_end   (ParserData  *parser_data);
 
 GType     _gtk_builder_get_template_type (GtkBuilder *builder);
 
+GtkBuilderTemplateCache *
+          _gtk_builder_template_cache_new  (void);
+void      _gtk_builder_template_cache_free (GtkBuilderTemplateCache *cache);
+void      _gtk_builder_set_template_cache  (GtkBuilder              *builder,
+                                            GtkBuilderTemplateCache *cache);
+GType     _gtk_builder_lookup_type         (GtkBuilder              *builder,
+                                            const gchar             *type_name);
+gpointer  _gtk_builder_lookup_symbol       (const gchar             *name);
+
+void      _gtk_builder_add_deferred        (GtkBuilder              *builder,
+                                            const gchar             *filename,
+                                            gchar                   *buffer,
+                                            gsize                    length,
+                                            gchar                  **ids);
+
 void _gtk_builder_prefix_error            (GtkBuilder           *builder,
                                            GMarkupParseContext  *context,
                                            GError              **error);
+void _gtk_builder_prefix_error_at         (GtkBuilder           *builder,
+                                           gint                  line,
+                                           gint                  col,
+                                           GError              **error);
 void _gtk_builder_error_unhandled_tag     (GtkBuilder           *builder,
                                            GMarkupParseContext  *context,
                                            const gchar          *object,
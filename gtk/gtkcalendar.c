@@ -213,6 +213,22 @@ struct _GtkCalendarPrivate
   guint day_width;
   guint week_width;
 
+  /* The grid of days, computed on allocation */
+  gint column_x[7];
+  gint row_y[6];
+  gint row_height;
+
+  /* Layouts of the day numbers, week numbers and day names by their
+   * text, for the font of pango_context_get_serial() layouts_serial */
+  GHashTable *layouts;
+  guint layouts_serial;
+
+  /* The days as they were last drawn, with the day_key() they were
+   * drawn for. Unless there are details, a day is only snapshotted
+   * again when its key changed. */
+  GskRenderNode *day_nodes[6][7];
+  guint day_keys[6][7];
+
   guint min_day_width;
   guint max_day_char_width;
   guint max_day_char_ascent;
@@ -300,6 +316,7 @@ static void     gtk_calendar_grab_notify    (GtkWidget        *widget,
                                              gboolean          was_grabbed);
 static void     gtk_calendar_state_flags_changed  (GtkWidget     *widget,
                                                    GtkStateFlags  previous_state);
+static void     gtk_calendar_style_updated  (GtkWidget        *widget);
 static gboolean gtk_calendar_query_tooltip  (GtkWidget        *widget,
                                              gint              x,
                                              gint              y,
@@ -334,6 +351,8 @@ static void calendar_invalidate_day     (GtkCalendar *widget,
 static void calendar_invalidate_day_num (GtkCalendar *widget,
                                          gint       day);
 
+static void calendar_invalidate_days   (GtkCalendar *calendar);
+
 static void calendar_compute_days      (GtkCalendar *calendar);
 static gint calendar_get_xsep          (GtkCalendar *calendar);
 static gint calendar_get_ysep          (GtkCalendar *calendar);
@@ -366,6 +385,7 @@ gtk_calendar_class_init (GtkCalendarClass *class)
   widget_class->measure = gtk_calendar_measure;
   widget_class->size_allocate = gtk_calendar_size_allocate;
   widget_class->state_flags_changed = gtk_calendar_state_flags_changed;
+  widget_class->style_updated = gtk_calendar_style_updated;
   widget_class->grab_notify = gtk_calendar_grab_notify;
   widget_class->query_tooltip = gtk_calendar_query_tooltip;
 
@@ -1060,11 +1080,7 @@ calendar_select_and_focus_day (GtkCalendar *calendar,
 static gint
 calendar_row_height (GtkCalendar *calendar)
 {
-  GtkCalendarPrivate *priv = calendar->priv;
-
-  return (priv->main_h - CALENDAR_MARGIN
-          - ((priv->display_flags & GTK_CALENDAR_SHOW_DAY_NAMES)
-             ? calendar_get_ysep (calendar) : CALENDAR_MARGIN)) / 6;
+  return calendar->priv->row_height;
 }
 
 static void
@@ -1104,36 +1120,51 @@ get_component_paddings (GtkCalendar *calendar,
     }
 }
 
-/* calendar_left_x_for_column: returns the x coordinate
- * for the left of the column */
-static gint
-calendar_left_x_for_column (GtkCalendar *calendar,
-                            gint         column)
+/* calendar_compute_grid: computes the coordinates of the
+ * rows and columns after the sizes of the parts changed */
+static void
+calendar_compute_grid (GtkCalendar *calendar)
 {
   GtkCalendarPrivate *priv = calendar->priv;
-  gint width;
-  gint x_left;
+  gint column, col;
+  gint row;
   gint week_width;
   gint calendar_xsep = calendar_get_xsep (calendar);
   gint inner_border = calendar_get_inner_border (calendar);
 
-  get_component_paddings (calendar, NULL, NULL, NULL);
-
   week_width = priv->week_width + inner_border;
-
   if (gtk_widget_get_direction (GTK_WIDGET (calendar)) == GTK_TEXT_DIR_RTL)
+    week_width = 0;
+
+  for (column = 0; column < 7; column++)
     {
-      column = 6 - column;
-      week_width = 0;
+      if (gtk_widget_get_direction (GTK_WIDGET (calendar)) == GTK_TEXT_DIR_RTL)
+        col = 6 - column;
+      else
+        col = column;
+
+      if (priv->display_flags & GTK_CALENDAR_SHOW_WEEK_NUMBERS)
+        priv->column_x[column] = week_width + calendar_xsep + (priv->day_width + DAY_XSEP) * col;
+      else
+        priv->column_x[column] = week_width + CALENDAR_MARGIN + (priv->day_width + DAY_XSEP) * col;
     }
 
-  width = calendar->priv->day_width;
-  if (priv->display_flags & GTK_CALENDAR_SHOW_WEEK_NUMBERS)
-    x_left = week_width + calendar_xsep + (width + DAY_XSEP) * column;
-  else
-    x_left = week_width + CALENDAR_MARGIN + (width + DAY_XSEP) * column;
+  priv->row_height = (priv->main_h - CALENDAR_MARGIN
+                      - ((priv->display_flags & GTK_CALENDAR_SHOW_DAY_NAMES)
+                         ? calendar_get_ysep (calendar) : CALENDAR_MARGIN)) / 6;
 
-  return x_left;
+  for (row = 0; row < 6; row++)
+    priv->row_y[row] = priv->header_h + priv->day_name_h + inner_border
+                       + row * priv->row_height;
+}
+
+/* calendar_left_x_for_column: returns the x coordinate
+ * for the left of the column */
+static gint
+calendar_left_x_for_column (GtkCalendar *calendar,
+                            gint         column)
+{
+  return calendar->priv->column_x[column];
 }
 
 /* column_from_x: returns the column 0-6 that the
@@ -1168,11 +1199,7 @@ static gint
 calendar_top_y_for_row (GtkCalendar *calendar,
                         gint         row)
 {
-  GtkCalendarPrivate *priv = calendar->priv;
-  gint inner_border = calendar_get_inner_border (calendar);
-
-  return priv->header_h + priv->day_name_h + inner_border
-         + row * calendar_row_height (calendar);
+  return calendar->priv->row_y[row];
 }
 
 /* row_from_y: returns the row 0-5 that the
@@ -1325,6 +1352,9 @@ gtk_calendar_destroy (GtkWidget *widget)
 
   calendar_stop_spinning (GTK_CALENDAR (widget));
 
+  calendar_invalidate_days (GTK_CALENDAR (widget));
+  g_clear_pointer (&priv->layouts, g_hash_table_unref);
+
   /* Call the destroy function for the extra display callback: */
   if (priv->detail_func_destroy && priv->detail_func_user_data)
     {
@@ -1873,6 +1903,9 @@ gtk_calendar_size_allocate (GtkWidget *widget,
                          - (DAY_XSEP * 6))/7;
       priv->week_width = 0;
     }
+
+  calendar_compute_grid (calendar);
+  calendar_invalidate_days (calendar);
 }
 
 
@@ -1880,6 +1913,56 @@ gtk_calendar_size_allocate (GtkWidget *widget,
  *              Repainting              *
  ****************************************/
 
+/* Drops the days as they were drawn, for when more
+ * than their day_key() changed */
+static void
+calendar_invalidate_days (GtkCalendar *calendar)
+{
+  GtkCalendarPrivate *priv = calendar->priv;
+  gint row, col;
+
+  for (row = 0; row < 6; row++)
+    for (col = 0; col < 7; col++)
+      {
+        g_clear_pointer (&priv->day_nodes[row][col], gsk_render_node_unref);
+        priv->day_keys[row][col] = 0;
+      }
+}
+
+/* Returns a layout showing @text, which should be short and
+ * come from a small set, like the day numbers. The layout is
+ * owned by the calendar and must not be changed. */
+static PangoLayout *
+calendar_get_layout (GtkCalendar *calendar,
+                     const char  *text)
+{
+  GtkWidget *widget = GTK_WIDGET (calendar);
+  GtkCalendarPrivate *priv = calendar->priv;
+  PangoLayout *layout;
+  guint serial;
+
+  if (priv->layouts == NULL)
+    priv->layouts = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                           g_free, g_object_unref);
+
+  serial = pango_context_get_serial (gtk_widget_get_pango_context (widget));
+  if (serial != priv->layouts_serial)
+    {
+      g_hash_table_remove_all (priv->layouts);
+      priv->layouts_serial = serial;
+      calendar_invalidate_days (calendar);
+    }
+
+  layout = g_hash_table_lookup (priv->layouts, text);
+  if (layout == NULL)
+    {
+      layout = gtk_widget_create_pango_layout (widget, text);
+      g_hash_table_insert (priv->layouts, g_strdup (text), layout);
+    }
+
+  return layout;
+}
+
 static void
 calendar_snapshot_header (GtkCalendar *calendar,
                           GtkSnapshot *snapshot)
@@ -2045,8 +2128,6 @@ calendar_snapshot_day_names (GtkCalendar *calendar,
   /*
    * Write the labels
    */
-  layout = gtk_widget_create_pango_layout (widget, NULL);
-
   for (i = 0; i < 7; i++)
     {
       if (gtk_widget_get_direction (GTK_WIDGET (calendar)) == GTK_TEXT_DIR_RTL)
@@ -2056,7 +2137,7 @@ calendar_snapshot_day_names (GtkCalendar *calendar,
       day = (day + priv->week_start) % 7;
       g_snprintf (buffer, sizeof (buffer), "%s", default_abbreviated_dayname[day]);
 
-      pango_layout_set_text (layout, buffer, -1);
+      layout = calendar_get_layout (calendar, buffer);
       pango_layout_get_pixel_extents (layout, NULL, &logical_rect);
 
       gtk_snapshot_render_layout (snapshot, context,
@@ -2070,8 +2151,6 @@ calendar_snapshot_day_names (GtkCalendar *calendar,
                                   layout);
     }
 
-  g_object_unref (layout);
-
   gtk_style_context_restore (context);
   gtk_snapshot_restore (snapshot);
 }
@@ -2127,7 +2206,6 @@ calendar_snapshot_week_numbers (GtkCalendar *calendar,
    * Write the labels
    */
 
-  layout = gtk_widget_create_pango_layout (widget, NULL);
   day_height = calendar_row_height (calendar);
 
   for (row = 0; row < 6; row++)
@@ -2163,7 +2241,7 @@ calendar_snapshot_week_numbers (GtkCalendar *calendar,
        * too.
        */
       g_snprintf (buffer, sizeof (buffer), C_("calendar:week:digits", "%d"), week);
-      pango_layout_set_text (layout, buffer, -1);
+      layout = calendar_get_layout (calendar, buffer);
       pango_layout_get_pixel_extents (layout, NULL, &logical_rect);
 
       y_loc = calendar_top_y_for_row (calendar, row) + (day_height - logical_rect.height) / 2;
@@ -2175,8 +2253,6 @@ calendar_snapshot_week_numbers (GtkCalendar *calendar,
       gtk_snapshot_render_layout (snapshot, context, x_loc, y_loc, layout);
     }
 
-  g_object_unref (layout);
-
   gtk_style_context_restore (context);
 }
 
@@ -2203,6 +2279,53 @@ is_color_attribute (PangoAttribute *attribute,
           attribute->klass->type == PANGO_ATTR_BACKGROUND);
 }
 
+static GtkStateFlags
+calendar_day_state (GtkCalendar *calendar,
+                    gint         row,
+                    gint         col)
+{
+  GtkCalendarPrivate *priv = calendar->priv;
+  GtkStateFlags state;
+  gint day;
+
+  state = gtk_widget_get_state_flags (GTK_WIDGET (calendar));
+  state &= ~(GTK_STATE_FLAG_INCONSISTENT | GTK_STATE_FLAG_ACTIVE | GTK_STATE_FLAG_SELECTED | GTK_STATE_FLAG_DROP_ACTIVE);
+
+  day = priv->day[row][col];
+
+  if (priv->day_month[row][col] == MONTH_PREV ||
+      priv->day_month[row][col] == MONTH_NEXT)
+    state |= GTK_STATE_FLAG_INCONSISTENT;
+  else
+    {
+      if (priv->marked_date[day-1])
+        state |= GTK_STATE_FLAG_ACTIVE;
+
+      if (priv->selected_day == day)
+        state |= GTK_STATE_FLAG_SELECTED;
+    }
+
+  return state;
+}
+
+/* Everything that the drawing of a day without details depends on,
+ * besides the allocation, the style and the font. Never 0. */
+static guint
+calendar_day_key (GtkCalendar *calendar,
+                  gint         row,
+                  gint         col)
+{
+  GtkCalendarPrivate *priv = calendar->priv;
+  gboolean focus;
+
+  focus = gtk_widget_has_visible_focus (GTK_WIDGET (calendar)) &&
+          priv->focus_row == row && priv->focus_col == col;
+
+  return priv->day[row][col] |
+         (focus << 5) |
+         (calendar_day_state (calendar, row, col) << 6);
+}
+
 static void
 calendar_snapshot_day (GtkCalendar *calendar,
                        GtkSnapshot *snapshot,
@@ -2212,7 +2335,7 @@ calendar_snapshot_day (GtkCalendar *calendar,
   GtkWidget *widget = GTK_WIDGET (calendar);
   GtkCalendarPrivate *priv = calendar->priv;
   GtkStyleContext *context;
-  GtkStateFlags state = 0;
+  GtkStateFlags state;
   gchar *detail;
   gchar buffer[32];
   gint day;
@@ -2228,7 +2351,7 @@ calendar_snapshot_day (GtkCalendar *calendar,
   g_return_if_fail (col < 7);
 
   context = gtk_widget_get_style_context (widget);
-  state = gtk_widget_get_state_flags (widget);
+  state = calendar_day_state (calendar, row, col);
 
   day = priv->day[row][col];
   show_details = (priv->display_flags & GTK_CALENDAR_SHOW_DETAILS);
@@ -2236,30 +2359,13 @@ calendar_snapshot_day (GtkCalendar *calendar,
   calendar_day_rectangle (calendar, row, col, &day_rect);
 
   gtk_style_context_save (context);
-
-  state &= ~(GTK_STATE_FLAG_INCONSISTENT | GTK_STATE_FLAG_ACTIVE | GTK_STATE_FLAG_SELECTED | GTK_STATE_FLAG_DROP_ACTIVE);
-
-  if (priv->day_month[row][col] == MONTH_PREV ||
-      priv->day_month[row][col] == MONTH_NEXT)
-    state |= GTK_STATE_FLAG_INCONSISTENT;
-  else
-    {
-      if (priv->marked_date[day-1])
-        state |= GTK_STATE_FLAG_ACTIVE;
-
-      if (priv->selected_day == day)
-        {
-          state |= GTK_STATE_FLAG_SELECTED;
-
-          gtk_style_context_set_state (context, state);
-          gtk_snapshot_render_background (snapshot, context,
-                                          day_rect.x, day_rect.y,
-                                          day_rect.width, day_rect.height);
-        }
-    }
-
   gtk_style_context_set_state (context, state);
 
+  if (state & GTK_STATE_FLAG_SELECTED)
+    gtk_snapshot_render_background (snapshot, context,
+                                    day_rect.x, day_rect.y,
+                                    day_rect.width, day_rect.height);
+
   /* Translators: this defines whether the day numbers should use
    * localized digits or the ones used in English (0123...).
    *
@@ -2276,8 +2382,7 @@ calendar_snapshot_day (GtkCalendar *calendar,
 
   detail = gtk_calendar_get_detail (calendar, row, col);
 
-  layout = gtk_widget_create_pango_layout (widget, buffer);
-  pango_layout_set_alignment (layout, PANGO_ALIGN_CENTER);
+  layout = calendar_get_layout (calendar, buffer);
   pango_layout_get_pixel_extents (layout, NULL, &logical_rect);
 
   x_loc = day_rect.x + (day_rect.width - logical_rect.width) / 2;
@@ -2310,6 +2415,8 @@ calendar_snapshot_day (GtkCalendar *calendar,
   if (detail && show_details)
     {
       gchar *markup = g_strconcat ("<small>", detail, "</small>", NULL);
+
+      layout = gtk_widget_create_pango_layout (widget, NULL);
       pango_layout_set_markup (layout, markup, -1);
       g_free (markup);
 
@@ -2337,6 +2444,7 @@ calendar_snapshot_day (GtkCalendar *calendar,
         }
 
       gtk_snapshot_render_layout (snapshot, context, day_rect.x, y_loc, layout);
+      g_object_unref (layout);
     }
 
   if (gtk_widget_has_visible_focus (widget) &&
@@ -2351,7 +2459,6 @@ calendar_snapshot_day (GtkCalendar *calendar,
     priv->detail_overflow[row] &= ~(1 << col);
 
   gtk_style_context_restore (context);
-  g_object_unref (layout);
   g_free (detail);
 }
 
@@ -2359,11 +2466,40 @@ static void
 calendar_snapshot_main (GtkCalendar *calendar,
                         GtkSnapshot *snapshot)
 {
+  GtkCalendarPrivate *priv = calendar->priv;
+  GtkSnapshot *day_snapshot;
   gint row, col;
+  guint key;
+
+  /* Details can change at any time */
+  if (priv->detail_func)
+    {
+      calendar_invalidate_days (calendar);
+
+      for (col = 0; col < 7; col++)
+        for (row = 0; row < 6; row++)
+          calendar_snapshot_day (calendar, snapshot, row, col);
+
+      return;
+    }
 
   for (col = 0; col < 7; col++)
     for (row = 0; row < 6; row++)
-      calendar_snapshot_day (calendar, snapshot, row, col);
+      {
+        key = calendar_day_key (calendar, row, col);
+        if (key != priv->day_keys[row][col])
+          {
+            g_clear_pointer (&priv->day_nodes[row][col], gsk_render_node_unref);
+
+            day_snapshot = gtk_snapshot_new ();
+            calendar_snapshot_day (calendar, day_snapshot, row, col);
+            priv->day_nodes[row][col] = gtk_snapshot_free_to_node (day_snapshot);
+            priv->day_keys[row][col] = key;
+          }
+
+        if (priv->day_nodes[row][col])
+          gtk_snapshot_append_node (snapshot, priv->day_nodes[row][col]);
+      }
 }
 
 static void
@@ -2882,6 +3018,14 @@ gtk_calendar_state_flags_changed (GtkWidget     *widget,
     }
 }
 
+static void
+gtk_calendar_style_updated (GtkWidget *widget)
+{
+  GTK_WIDGET_CLASS (gtk_calendar_parent_class)->style_updated (widget);
+
+  calendar_invalidate_days (GTK_CALENDAR (widget));
+}
+
 static void
 gtk_calendar_grab_notify (GtkWidget *widget,
                           gboolean   was_grabbed)
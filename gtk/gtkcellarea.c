@@ -551,8 +551,15 @@ typedef struct {
   GtkTreeIter  *iter;
   gboolean      is_expander;
   gboolean      is_expanded;
+
+  /* Cached attribute values of the row, if caching is enabled */
+  GArray       *values;
+  guint         n_values;
 } AttributeData;
 
+/* The number of rows whose attribute values are cached at most */
+#define MAX_CACHED_ROWS 1024
+
 struct _GtkCellAreaPrivate
 {
   /* The GtkCellArea bookkeeps any connected
@@ -577,6 +584,11 @@ struct _GtkCellAreaPrivate
 
   /* Tracking which cells are focus siblings of focusable cells */
   GHashTable      *focus_siblings;
+
+  /* Attribute values pulled from the model, by path string,
+   * or %NULL if they are not cached
+   */
+  GHashTable      *attribute_cache;
 };
 
 enum {
@@ -900,6 +912,7 @@ gtk_cell_area_finalize (GObject *object)
    */
   g_hash_table_destroy (priv->cell_info);
   g_hash_table_destroy (priv->focus_siblings);
+  g_clear_pointer (&priv->attribute_cache, g_hash_table_destroy);
 
   g_free (priv->current_path);
 
@@ -1225,6 +1238,27 @@ apply_cell_attributes (GtkCellRenderer *renderer,
     {
       attribute = list->data;
 
+      if (data->values)
+        {
+          GValue *cached;
+
+          /* The cells are always visited in the same order, so the
+           * values are found in the order they were pulled in
+           */
+          if (data->n_values == data->values->len)
+            {
+              g_array_set_size (data->values, data->n_values + 1);
+              cached = &g_array_index (data->values, GValue, data->n_values);
+              gtk_tree_model_get_value (data->model, data->iter, attribute->column, cached);
+            }
+          else
+            cached = &g_array_index (data->values, GValue, data->n_values);
+
+          data->n_values++;
+          g_object_set_property (G_OBJECT (renderer), attribute->attribute, cached);
+          continue;
+        }
+
       gtk_tree_model_get_value (data->model, data->iter, attribute->column, &value);
       g_object_set_property (G_OBJECT (renderer), attribute->attribute, &value);
       g_value_unset (&value);
@@ -1259,16 +1293,32 @@ gtk_cell_area_real_apply_attributes (GtkCellArea           *area,
   data.iter        = iter;
   data.is_expander = is_expander;
   data.is_expanded = is_expanded;
-
-  /* Go over any cells that have attributes or custom GtkCellLayoutDataFuncs and
-   * apply the data from the treemodel */
-  g_hash_table_foreach (priv->cell_info, (GHFunc)apply_cell_attributes, &data);
+  data.values      = NULL;
+  data.n_values    = 0;
 
   /* Update the currently applied path */
   g_free (priv->current_path);
   path               = gtk_tree_model_get_path (tree_model, iter);
   priv->current_path = gtk_tree_path_to_string (path);
   gtk_tree_path_free (path);
+
+  if (priv->attribute_cache)
+    {
+      data.values = g_hash_table_lookup (priv->attribute_cache, priv->current_path);
+      if (data.values == NULL)
+        {
+          if (g_hash_table_size (priv->attribute_cache) >= MAX_CACHED_ROWS)
+            g_hash_table_remove_all (priv->attribute_cache);
+
+          data.values = g_array_new (FALSE, TRUE, sizeof (GValue));
+          g_array_set_clear_func (data.values, (GDestroyNotify) g_value_unset);
+          g_hash_table_insert (priv->attribute_cache, g_strdup (priv->current_path), data.values);
+        }
+    }
+
+  /* Go over any cells that have attributes or custom GtkCellLayoutDataFuncs and
+   * apply the data from the treemodel */
+  g_hash_table_foreach (priv->cell_info, (GHFunc)apply_cell_attributes, &data);
 }
 
 static GtkCellAreaContext *
@@ -1521,6 +1571,8 @@ gtk_cell_area_clear_attributes (GtkCellLayout         *cell_layout,
       g_slist_free_full (info->attributes, (GDestroyNotify)cell_attribute_free);
       info->attributes = NULL;
     }
+
+  _gtk_cell_area_invalidate_cached_attributes (area, NULL);
 }
 
 static void
@@ -1623,6 +1675,7 @@ gtk_cell_area_remove (GtkCellArea        *area,
 
   /* Remove any custom attributes and custom cell data func here first */
   g_hash_table_remove (priv->cell_info, renderer);
+  _gtk_cell_area_invalidate_cached_attributes (area, NULL);
 
   /* Remove focus siblings of this renderer */
   g_hash_table_remove (priv->focus_siblings, renderer);
@@ -2203,6 +2256,7 @@ gtk_cell_area_attribute_connect (GtkCellArea        *area,
     }
 
   info->attributes = g_slist_prepend (info->attributes, cell_attribute);
+  _gtk_cell_area_invalidate_cached_attributes (area, NULL);
 }
 
 /**
@@ -2244,6 +2298,7 @@ gtk_cell_area_attribute_disconnect (GtkCellArea        *area,
           cell_attribute_free (cell_attribute);
 
           info->attributes = g_slist_delete_link (info->attributes, node);
+          _gtk_cell_area_invalidate_cached_attributes (area, NULL);
         }
     }
 }
@@ -3572,5 +3627,62 @@ _gtk_cell_area_set_cell_data_func_with_proxy (GtkCellArea           *area,
       info->proxy = proxy;
 
       g_hash_table_insert (priv->cell_info, cell, info);
+      _gtk_cell_area_invalidate_cached_attributes (area, NULL);
+    }
+}
+
+/*
+ * _gtk_cell_area_set_cache_attributes:
+ * @area: a #GtkCellArea
+ * @cache: whether to cache attribute values
+ *
+ * Sets whether gtk_cell_area_apply_attributes() keeps the values it
+ * pulls from the model for the attributes, so that applying the same
+ * row again does not have to go to the model. Cell data functions are
+ * still called every time.
+ *
+ * The values are kept by path, the caller must invalidate them with
+ * _gtk_cell_area_invalidate_cached_attributes() whenever rows of the
+ * model change.
+ */
+void
+_gtk_cell_area_set_cache_attributes (GtkCellArea *area,
+                                     gboolean     cache)
+{
+  GtkCellAreaPrivate *priv = area->priv;
+
+  if (!cache)
+    g_clear_pointer (&priv->attribute_cache, g_hash_table_destroy);
+  else if (priv->attribute_cache == NULL)
+    priv->attribute_cache = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                                   g_free,
+                                                   (GDestroyNotify) g_array_unref);
+}
+
+/*
+ * _gtk_cell_area_invalidate_cached_attributes:
+ * @area: a #GtkCellArea
+ * @path: (allow-none): the row to forget the values of, or %NULL for all rows
+ *
+ * Drops the attribute values cached for @path, or for all rows.
+ */
+void
+_gtk_cell_area_invalidate_cached_attributes (GtkCellArea *area,
+                                             GtkTreePath *path)
+{
+  GtkCellAreaPrivate *priv = area->priv;
+  gchar *path_string;
+
+  if (priv->attribute_cache == NULL)
+    return;
+
+  if (path == NULL)
+    {
+      g_hash_table_remove_all (priv->attribute_cache);
+      return;
     }
+
+  path_string = gtk_tree_path_to_string (path);
+  g_hash_table_remove (priv->attribute_cache, path_string);
+  g_free (path_string);
 }
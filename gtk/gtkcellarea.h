@@ -529,6 +529,11 @@ void                 _gtk_cell_area_set_cell_data_func_with_proxy  (GtkCellArea
 								    GDestroyNotify         destroy,
 								    gpointer               proxy);
 
+void                 _gtk_cell_area_set_cache_attributes          (GtkCellArea           *area,
+                                                                   gboolean               cache);
+void                 _gtk_cell_area_invalidate_cached_attributes  (GtkCellArea           *area,
+                                                                   GtkTreePath           *path);
+
 G_END_DECLS
 
 #endif /* __GTK_CELL_AREA_H__ */
@@ -656,6 +656,36 @@ reset_contexts (GtkCellAreaBox *box)
     }
 }
 
+/* Requests the size of a renderer, answering from the context for
+ * renderers that declared a constant size. Those do not depend on
+ * @for_size either, so the cached size is used for any @for_size.
+ */
+static void
+request_renderer (GtkCellAreaBox        *box,
+                  GtkCellAreaBoxContext *context,
+                  GtkCellRenderer       *renderer,
+                  GtkOrientation         orientation,
+                  GtkWidget             *widget,
+                  gint                   for_size,
+                  gint                  *minimum_size,
+                  gint                  *natural_size)
+{
+  if (gtk_cell_renderer_get_constant_size (renderer))
+    {
+      if (_gtk_cell_area_box_context_get_renderer_size (context, renderer, widget, orientation,
+                                                        minimum_size, natural_size))
+        return;
+
+      gtk_cell_area_request_renderer (GTK_CELL_AREA (box), renderer, orientation, widget, -1,
+                                      minimum_size, natural_size);
+      _gtk_cell_area_box_context_push_renderer_size (context, renderer, widget, orientation,
+                                                     *minimum_size, *natural_size);
+    }
+  else
+    gtk_cell_area_request_renderer (GTK_CELL_AREA (box), renderer, orientation, widget, for_size,
+                                    minimum_size, natural_size);
+}
+
 /* Fall back on a completely unaligned dynamic allocation of cells
  * when not allocated for the said orientation, alignment of cells
  * is not done when each area gets a different size in the orientation
@@ -802,7 +832,6 @@ get_allocated_cells (GtkCellAreaBox        *box,
                      gint                   height)
 {
   GtkCellAreaBoxAllocation *group_allocs;
-  GtkCellArea              *area = GTK_CELL_AREA (box);
   GtkCellAreaBoxPrivate    *priv = box->priv;
   GList                    *cell_list;
   GSList                   *allocated_cells = NULL;
@@ -861,11 +890,11 @@ get_allocated_cells (GtkCellAreaBox        *box,
 	  else
 	    {
 	      gint dummy;
-              gtk_cell_area_request_renderer (area, info->renderer,
-                                              priv->orientation,
-                                              widget, for_size,
-                                              &dummy,
-                                              &cell_size);
+              request_renderer (box, context, info->renderer,
+                                priv->orientation,
+                                widget, for_size,
+                                &dummy,
+                                &cell_size);
 	      cell_size = MIN (cell_size, group_allocs[i].size);
 	    }
 
@@ -918,11 +947,11 @@ get_allocated_cells (GtkCellAreaBox        *box,
               if (!gtk_cell_renderer_get_visible (info->renderer))
                 continue;
 
-              gtk_cell_area_request_renderer (area, info->renderer,
-                                              priv->orientation,
-                                              widget, for_size,
-                                              &sizes[j].minimum_size,
-                                              &sizes[j].natural_size);
+              request_renderer (box, context, info->renderer,
+                                priv->orientation,
+                                widget, for_size,
+                                &sizes[j].minimum_size,
+                                &sizes[j].natural_size);
 
               sizes[j].data = info;
               avail_size   -= sizes[j].minimum_size;
@@ -1492,7 +1521,6 @@ compute_size (GtkCellAreaBox        *box,
               gint                  *natural_size)
 {
   GtkCellAreaBoxPrivate *priv = box->priv;
-  GtkCellArea           *area = GTK_CELL_AREA (box);
   GList                 *list;
   gint                   i;
   gint                   min_size = 0;
@@ -1512,8 +1540,8 @@ compute_size (GtkCellAreaBox        *box,
           if (!gtk_cell_renderer_get_visible (info->renderer))
               continue;
 
-          gtk_cell_area_request_renderer (area, info->renderer, orientation, widget, for_size,
-                                          &renderer_min_size, &renderer_nat_size);
+          request_renderer (box, context, info->renderer, orientation, widget, for_size,
+                            &renderer_min_size, &renderer_nat_size);
 
           if (orientation == priv->orientation)
             {
@@ -1570,11 +1598,12 @@ compute_size (GtkCellAreaBox        *box,
 }
 
 static GtkRequestedSize *
-get_group_sizes (GtkCellArea    *area,
-                 CellGroup      *group,
-                 GtkOrientation  orientation,
-                 GtkWidget      *widget,
-                 gint           *n_sizes)
+get_group_sizes (GtkCellAreaBox        *box,
+                 GtkCellAreaBoxContext *context,
+                 CellGroup             *group,
+                 GtkOrientation         orientation,
+                 GtkWidget             *widget,
+                 gint                  *n_sizes)
 {
   GtkRequestedSize *sizes;
   GList            *l;
@@ -1592,10 +1621,10 @@ get_group_sizes (GtkCellArea    *area,
 
       sizes[i].data = info;
 
-      gtk_cell_area_request_renderer (area, info->renderer,
-                                      orientation, widget, -1,
-                                      &sizes[i].minimum_size,
-                                      &sizes[i].natural_size);
+      request_renderer (box, context, info->renderer,
+                        orientation, widget, -1,
+                        &sizes[i].minimum_size,
+                        &sizes[i].natural_size);
 
       i++;
     }
@@ -1604,24 +1633,24 @@ get_group_sizes (GtkCellArea    *area,
 }
 
 static void
-compute_group_size_for_opposing_orientation (GtkCellAreaBox     *box,
-                                             CellGroup          *group,
-                                             GtkWidget          *widget,
-                                             gint                for_size,
-                                             gint               *minimum_size,
-                                             gint               *natural_size)
+compute_group_size_for_opposing_orientation (GtkCellAreaBox        *box,
+                                             GtkCellAreaBoxContext *context,
+                                             CellGroup             *group,
+                                             GtkWidget             *widget,
+                                             gint                   for_size,
+                                             gint                  *minimum_size,
+                                             gint                  *natural_size)
 {
   GtkCellAreaBoxPrivate *priv = box->priv;
-  GtkCellArea           *area = GTK_CELL_AREA (box);
 
   /* Exception for single cell groups */
   if (group->n_cells == 1)
     {
       CellInfo *info = group->cells->data;
 
-      gtk_cell_area_request_renderer (area, info->renderer,
-                                      OPPOSITE_ORIENTATION (priv->orientation),
-                                      widget, for_size, minimum_size, natural_size);
+      request_renderer (box, context, info->renderer,
+                        OPPOSITE_ORIENTATION (priv->orientation),
+                        widget, for_size, minimum_size, natural_size);
     }
   else
     {
@@ -1632,7 +1661,7 @@ compute_group_size_for_opposing_orientation (GtkCellAreaBox     *box,
       gint              extra_size, extra_extra;
       gint              min_size = 0, nat_size = 0;
 
-      orientation_sizes = get_group_sizes (area, group, priv->orientation, widget, &n_sizes);
+      orientation_sizes = get_group_sizes (box, context, group, priv->orientation, widget, &n_sizes);
 
       /* First naturally allocate the cells in the group into the for_size */
       avail_size -= (n_sizes - 1) * priv->spacing;
@@ -1669,11 +1698,11 @@ compute_group_size_for_opposing_orientation (GtkCellAreaBox     *box,
                 }
             }
 
-          gtk_cell_area_request_renderer (area, info->renderer,
-                                          OPPOSITE_ORIENTATION (priv->orientation),
-                                          widget,
-                                          orientation_sizes[i].minimum_size,
-                                          &cell_min, &cell_nat);
+          request_renderer (box, context, info->renderer,
+                            OPPOSITE_ORIENTATION (priv->orientation),
+                            widget,
+                            orientation_sizes[i].minimum_size,
+                            &cell_min, &cell_nat);
 
           min_size = MAX (min_size, cell_min);
           nat_size = MAX (nat_size, cell_nat);
@@ -1752,7 +1781,7 @@ compute_size_for_opposing_orientation (GtkCellAreaBox        *box,
       /* Now we have the allocation for the group,
        * request its height-for-width
        */
-      compute_group_size_for_opposing_orientation (box, group, widget,
+      compute_group_size_for_opposing_orientation (box, context, group, widget,
                                                    orientation_sizes[i].minimum_size,
                                                    &group_min, &group_nat);
 
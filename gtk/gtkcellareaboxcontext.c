@@ -63,6 +63,17 @@ typedef struct {
   gint     nat_size;
 } CachedSize;
 
+/* Sizes of constant size renderers, valid for one widget and
+ * one size serial of the renderer
+ */
+typedef struct {
+  GtkWidget *widget;
+  guint      serial;
+  guint      valid : 2; /* one bit per orientation */
+  gint       min_size[2];
+  gint       nat_size[2];
+} RendererSize;
+
 struct _GtkCellAreaBoxContextPrivate
 {
   /* Table of per renderer CachedSizes */
@@ -73,6 +84,9 @@ struct _GtkCellAreaBoxContextPrivate
   GHashTable *widths;
   GHashTable *heights;
 
+  /* Table of RendererSizes of constant size renderers */
+  GHashTable *renderer_sizes;
+
   /* Whether each group expands */
   gboolean  *expand;
 
@@ -88,6 +102,12 @@ free_cache_array (GArray *array)
   g_array_free (array, TRUE);
 }
 
+static void
+free_renderer_size (RendererSize *size)
+{
+  g_slice_free (RendererSize, size);
+}
+
 static GArray *
 group_array_new (GtkCellAreaBoxContext *context)
 {
@@ -177,6 +197,9 @@ _gtk_cell_area_box_context_init (GtkCellAreaBoxContext *box_context)
                                               NULL, (GDestroyNotify)free_cache_array);
   priv->heights      = g_hash_table_new_full (g_direct_hash, g_direct_equal,
                                               NULL, (GDestroyNotify)free_cache_array);
+
+  priv->renderer_sizes = g_hash_table_new_full (g_direct_hash, g_direct_equal,
+                                                NULL, (GDestroyNotify)free_renderer_size);
 }
 
 static void 
@@ -206,6 +229,7 @@ _gtk_cell_area_box_context_finalize (GObject *object)
   g_array_free (priv->base_heights, TRUE);
   g_hash_table_destroy (priv->widths);
   g_hash_table_destroy (priv->heights);
+  g_hash_table_destroy (priv->renderer_sizes);
 
   g_free (priv->expand);
   g_free (priv->align);
@@ -241,6 +265,9 @@ _gtk_cell_area_box_context_reset (GtkCellAreaContext *context)
   g_hash_table_remove_all (priv->widths);
   g_hash_table_remove_all (priv->heights);
 
+  /* Styles may have changed, so constant sizes must be measured again */
+  g_hash_table_remove_all (priv->renderer_sizes);
+
   GTK_CELL_AREA_CONTEXT_CLASS
     (_gtk_cell_area_box_context_parent_class)->reset (context);
 }
@@ -665,6 +692,62 @@ _gtk_cell_area_box_context_get_group_width_for_height (GtkCellAreaBoxContext *bo
     }
 }
 
+/* Constant size renderer cache */
+gboolean
+_gtk_cell_area_box_context_get_renderer_size (GtkCellAreaBoxContext *box_context,
+                                              GtkCellRenderer       *renderer,
+                                              GtkWidget             *widget,
+                                              GtkOrientation         orientation,
+                                              gint                  *minimum_size,
+                                              gint                  *natural_size)
+{
+  GtkCellAreaBoxContextPrivate *priv = box_context->priv;
+  RendererSize                 *size;
+
+  size = g_hash_table_lookup (priv->renderer_sizes, renderer);
+
+  if (size == NULL ||
+      size->widget != widget ||
+      size->serial != _gtk_cell_renderer_get_size_serial (renderer) ||
+      (size->valid & (1 << orientation)) == 0)
+    return FALSE;
+
+  *minimum_size = size->min_size[orientation];
+  *natural_size = size->nat_size[orientation];
+
+  return TRUE;
+}
+
+void
+_gtk_cell_area_box_context_push_renderer_size (GtkCellAreaBoxContext *box_context,
+                                               GtkCellRenderer       *renderer,
+                                               GtkWidget             *widget,
+                                               GtkOrientation         orientation,
+                                               gint                   minimum_size,
+                                               gint                   natural_size)
+{
+  GtkCellAreaBoxContextPrivate *priv = box_context->priv;
+  RendererSize                 *size;
+  guint                         serial;
+
+  serial = _gtk_cell_renderer_get_size_serial (renderer);
+  size = g_hash_table_lookup (priv->renderer_sizes, renderer);
+
+  if (size == NULL)
+    {
+      size = g_slice_new0 (RendererSize);
+      g_hash_table_insert (priv->renderer_sizes, renderer, size);
+    }
+  else if (size->widget != widget || size->serial != serial)
+    size->valid = 0;
+
+  size->widget = widget;
+  size->serial = serial;
+  size->valid |= 1 << orientation;
+  size->min_size[orientation] = minimum_size;
+  size->nat_size[orientation] = natural_size;
+}
+
 static GtkRequestedSize *
 _gtk_cell_area_box_context_get_requests (GtkCellAreaBoxContext *box_context,
                                         GtkCellAreaBox        *area,
@@ -116,6 +116,21 @@ void    _gtk_cell_area_box_context_get_group_width_for_height   (GtkCellAreaBoxC
                                                                 gint                  *minimum_width,
                                                                 gint                  *natural_width);
 
+/* Cache the sizes of constant size renderers */
+gboolean _gtk_cell_area_box_context_get_renderer_size          (GtkCellAreaBoxContext *box_context,
+                                                                GtkCellRenderer       *renderer,
+                                                                GtkWidget             *widget,
+                                                                GtkOrientation         orientation,
+                                                                gint                  *minimum_size,
+                                                                gint                  *natural_size);
+
+void    _gtk_cell_area_box_context_push_renderer_size          (GtkCellAreaBoxContext *box_context,
+                                                                GtkCellRenderer       *renderer,
+                                                                GtkWidget             *widget,
+                                                                GtkOrientation         orientation,
+                                                                gint                   minimum_size,
+                                                                gint                   natural_size);
+
 GtkRequestedSize *_gtk_cell_area_box_context_get_widths         (GtkCellAreaBoxContext *box_context,
                                                                 gint                  *n_widths);
 GtkRequestedSize *_gtk_cell_area_box_context_get_heights        (GtkCellAreaBoxContext *box_context,
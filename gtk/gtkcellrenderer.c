@@ -126,6 +126,9 @@ struct _GtkCellRendererPrivate
   guint16 xpad;
   guint16 ypad;
 
+  /* Bumped whenever something besides the attributes changes the size */
+  guint size_serial;
+
   guint mode                : 2;
   guint visible             : 1;
   guint is_expander         : 1;
@@ -133,6 +136,7 @@ struct _GtkCellRendererPrivate
   guint cell_background_set : 1;
   guint sensitive           : 1;
   guint editing             : 1;
+  guint constant_size       : 1;
 
   GdkRGBA cell_background;
 };
@@ -158,7 +162,8 @@ enum {
   PROP_CELL_BACKGROUND,
   PROP_CELL_BACKGROUND_RGBA,
   PROP_CELL_BACKGROUND_SET,
-  PROP_EDITING
+  PROP_EDITING,
+  PROP_CONSTANT_SIZE
 };
 
 /* Signal IDs */
@@ -412,6 +417,23 @@ gtk_cell_renderer_class_init (GtkCellRendererClass *class)
 							 FALSE,
 							 GTK_PARAM_READABLE));
 
+  /**
+   * GtkCellRenderer:constant-size:
+   *
+   * Whether the size of the renderer does not depend on the values
+   * of its attributes, so that it is the same for every row.
+   *
+   * Cell areas use this to measure the renderer only once instead
+   * of once for every row.
+   */
+  g_object_class_install_property (object_class,
+				   PROP_CONSTANT_SIZE,
+				   g_param_spec_boolean ("constant-size",
+							 P_("Constant size"),
+							 P_("Whether the size does not depend on the attributes"),
+							 FALSE,
+							 GTK_PARAM_READWRITE|G_PARAM_EXPLICIT_NOTIFY));
+
 
 #define ADD_SET_PROP(propname, propval, nick, blurb) g_object_class_install_property (object_class, propval, g_param_spec_boolean (propname, nick, blurb, FALSE, GTK_PARAM_READWRITE|G_PARAM_EXPLICIT_NOTIFY))
 
@@ -487,6 +509,9 @@ gtk_cell_renderer_get_property (GObject     *object,
     case PROP_EDITING:
       g_value_set_boolean (value, priv->editing);
       break;
+    case PROP_CONSTANT_SIZE:
+      g_value_set_boolean (value, priv->constant_size);
+      break;
     case PROP_XALIGN:
       g_value_set_float (value, priv->xalign);
       break;
@@ -575,6 +600,7 @@ gtk_cell_renderer_set_property (GObject      *object,
       if (priv->xpad != g_value_get_uint (value))
         {
           priv->xpad = g_value_get_uint (value);
+          _gtk_cell_renderer_size_changed (cell);
           g_object_notify_by_pspec (object, pspec);
         }
       break;
@@ -582,6 +608,7 @@ gtk_cell_renderer_set_property (GObject      *object,
       if (priv->ypad != g_value_get_uint (value))
         {
           priv->ypad = g_value_get_uint (value);
+          _gtk_cell_renderer_size_changed (cell);
           g_object_notify_by_pspec (object, pspec);
         }
       break;
@@ -589,6 +616,7 @@ gtk_cell_renderer_set_property (GObject      *object,
       if (priv->width != g_value_get_int (value))
         {
           priv->width = g_value_get_int (value);
+          _gtk_cell_renderer_size_changed (cell);
           g_object_notify_by_pspec (object, pspec);
         }
       break;
@@ -596,6 +624,7 @@ gtk_cell_renderer_set_property (GObject      *object,
       if (priv->height != g_value_get_int (value))
         {
           priv->height = g_value_get_int (value);
+          _gtk_cell_renderer_size_changed (cell);
           g_object_notify_by_pspec (object, pspec);
         }
       break;
@@ -637,6 +666,9 @@ gtk_cell_renderer_set_property (GObject      *object,
           g_object_notify (object, "cell-background-set");
         }
       break;
+    case PROP_CONSTANT_SIZE:
+      gtk_cell_renderer_set_constant_size (cell, g_value_get_boolean (value));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, param_id, pspec);
       break;
@@ -889,6 +921,8 @@ gtk_cell_renderer_set_fixed_size (GtkCellRenderer *cell,
           g_object_notify (G_OBJECT (cell), "height");
         }
 
+      _gtk_cell_renderer_size_changed (cell);
+
       g_object_thaw_notify (G_OBJECT (cell));
     }
 }
@@ -1020,6 +1054,8 @@ gtk_cell_renderer_set_padding (GtkCellRenderer *cell,
           g_object_notify (G_OBJECT (cell), "ypad");
         }
 
+      _gtk_cell_renderer_size_changed (cell);
+
       g_object_thaw_notify (G_OBJECT (cell));
     }
 }
@@ -1130,6 +1166,72 @@ gtk_cell_renderer_get_sensitive (GtkCellRenderer *cell)
 }
 
 
+/**
+ * gtk_cell_renderer_set_constant_size:
+ * @cell: A #GtkCellRenderer
+ * @constant_size: whether the size of @cell is the same for every row
+ *
+ * Declares that the size of @cell does not depend on the values of
+ * its attributes, for example because it always draws an indicator
+ * or an icon of the same size. Cell areas then measure @cell once and
+ * reuse the result for every row, instead of asking it for each row.
+ *
+ * Do not set this if any attribute that is mapped to @cell in a
+ * #GtkCellArea can change its size.
+ */
+void
+gtk_cell_renderer_set_constant_size (GtkCellRenderer *cell,
+                                     gboolean         constant_size)
+{
+  GtkCellRendererPrivate *priv;
+
+  g_return_if_fail (GTK_IS_CELL_RENDERER (cell));
+
+  priv = cell->priv;
+  constant_size = !!constant_size;
+
+  if (priv->constant_size == constant_size)
+    return;
+
+  priv->constant_size = constant_size;
+  _gtk_cell_renderer_size_changed (cell);
+  g_object_notify (G_OBJECT (cell), "constant-size");
+}
+
+/**
+ * gtk_cell_renderer_get_constant_size:
+ * @cell: A #GtkCellRenderer
+ *
+ * Returns whether the size of @cell is declared to be the same for
+ * every row, see gtk_cell_renderer_set_constant_size().
+ *
+ * Returns: %TRUE if the size of @cell does not depend on its attributes
+ */
+gboolean
+gtk_cell_renderer_get_constant_size (GtkCellRenderer *cell)
+{
+  g_return_val_if_fail (GTK_IS_CELL_RENDERER (cell), FALSE);
+
+  return cell->priv->constant_size;
+}
+
+/* Called by renderers when a property that is not expected to be
+ * bound to an attribute, such as the padding, changes their size.
+ * Sizes that were cached for constant size renderers are dropped.
+ */
+void
+_gtk_cell_renderer_size_changed (GtkCellRenderer *cell)
+{
+  cell->priv->size_serial++;
+}
+
+guint
+_gtk_cell_renderer_get_size_serial (GtkCellRenderer *cell)
+{
+  return cell->priv->size_serial;
+}
+
+
 /**
  * gtk_cell_renderer_is_activatable:
  * @cell: A #GtkCellRenderer
@@ -283,6 +283,12 @@ void             gtk_cell_renderer_set_sensitive  (GtkCellRenderer      *cell,
 GDK_AVAILABLE_IN_ALL
 gboolean         gtk_cell_renderer_get_sensitive  (GtkCellRenderer      *cell);
 
+GDK_AVAILABLE_IN_ALL
+void             gtk_cell_renderer_set_constant_size (GtkCellRenderer   *cell,
+                                                      gboolean           constant_size);
+GDK_AVAILABLE_IN_ALL
+gboolean         gtk_cell_renderer_get_constant_size (GtkCellRenderer   *cell);
+
 GDK_AVAILABLE_IN_ALL
 gboolean         gtk_cell_renderer_is_activatable (GtkCellRenderer      *cell);
 
@@ -300,6 +306,9 @@ void            _gtk_cell_renderer_calc_offset    (GtkCellRenderer      *cell,
                                                    gint                 *x_offset,
                                                    gint                 *y_offset);
 
+void            _gtk_cell_renderer_size_changed    (GtkCellRenderer      *cell);
+guint           _gtk_cell_renderer_get_size_serial (GtkCellRenderer      *cell);
+
 GDK_AVAILABLE_IN_ALL
 GtkStateFlags   gtk_cell_renderer_get_state       (GtkCellRenderer      *cell,
                                                    GtkWidget            *widget,
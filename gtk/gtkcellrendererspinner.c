@@ -159,6 +159,8 @@ gtk_cell_renderer_spinner_init (GtkCellRendererSpinner *cell)
   cell->priv = gtk_cell_renderer_spinner_get_instance_private (cell);
   cell->priv->pulse = 0;
   cell->priv->icon_size = GTK_ICON_SIZE_INHERIT;
+
+  gtk_cell_renderer_set_constant_size (GTK_CELL_RENDERER (cell), TRUE);
 }
 
 /**
@@ -250,6 +252,7 @@ gtk_cell_renderer_spinner_set_property (GObject      *object,
         if (priv->icon_size != g_value_get_enum (value))
           {
             priv->icon_size = g_value_get_enum (value);
+            _gtk_cell_renderer_size_changed (GTK_CELL_RENDERER (object));
             g_object_notify (object, "size");
           }
         break;
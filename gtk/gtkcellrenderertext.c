@@ -31,6 +31,7 @@
 #include "a11y/gtktextcellaccessible.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 /**
  * SECTION:gtkcellrenderertext
@@ -1424,11 +1425,186 @@ add_attr (PangoAttrList  *attr_list,
   pango_attr_list_insert (attr_list, attr);
 }
 
+/* Layout cache
+ *
+ * Tree views tend to show the same strings over and over, and every
+ * size request and every snapshot of a row builds a new PangoLayout
+ * and shapes it again. So the finished layouts are kept in a small
+ * cache shared by all text renderers, keyed by everything that affects
+ * their shape: the text, the attributes, the PangoContext (which holds
+ * the font of the widget) and the width, wrap, ellipsize and alignment.
+ *
+ * Layouts handed out by the cache are shared, so they must not be
+ * modified. Use get_layout_for_width() to get one with a given width.
+ */
+#define LAYOUT_CACHE_SIZE 256
+
+typedef struct {
+  PangoLayout *layout;
+  guint        context_serial;
+  guint        hash;
+  GList        link;
+} CachedLayout;
+
+static GHashTable *layout_cache = NULL;
+static GQueue      layout_cache_lru = G_QUEUE_INIT;
+
+static guint
+cached_layout_hash (gconstpointer data)
+{
+  const CachedLayout *cached = data;
+
+  return cached->hash;
+}
+
+static gboolean
+attr_lists_equal (PangoAttrList *a,
+                  PangoAttrList *b)
+{
+  PangoAttrIterator *iter_a, *iter_b;
+  gboolean equal = TRUE;
+
+  if (a == b)
+    return TRUE;
+
+  if (a == NULL || b == NULL)
+    return FALSE;
+
+  iter_a = pango_attr_list_get_iterator (a);
+  iter_b = pango_attr_list_get_iterator (b);
+
+  while (equal)
+    {
+      GSList *attrs_a, *attrs_b, *l, *m;
+      gint start_a, end_a, start_b, end_b;
+      gboolean more_a, more_b;
+
+      pango_attr_iterator_range (iter_a, &start_a, &end_a);
+      pango_attr_iterator_range (iter_b, &start_b, &end_b);
+
+      if (start_a != start_b || end_a != end_b)
+        {
+          equal = FALSE;
+          break;
+        }
+
+      attrs_a = pango_attr_iterator_get_attrs (iter_a);
+      attrs_b = pango_attr_iterator_get_attrs (iter_b);
+
+      if (g_slist_length (attrs_a) != g_slist_length (attrs_b))
+        equal = FALSE;
+
+      for (l = attrs_a; l && equal; l = l->next)
+        {
+          for (m = attrs_b; m; m = m->next)
+            {
+              if (pango_attribute_equal (l->data, m->data))
+                break;
+            }
+
+          if (m == NULL)
+            equal = FALSE;
+        }
+
+      g_slist_free_full (attrs_a, (GDestroyNotify) pango_attribute_destroy);
+      g_slist_free_full (attrs_b, (GDestroyNotify) pango_attribute_destroy);
+
+      more_a = pango_attr_iterator_next (iter_a);
+      more_b = pango_attr_iterator_next (iter_b);
+
+      if (more_a != more_b)
+        equal = FALSE;
+
+      if (!more_a)
+        break;
+    }
+
+  pango_attr_iterator_destroy (iter_a);
+  pango_attr_iterator_destroy (iter_b);
+
+  return equal;
+}
+
+static gboolean
+cached_layout_equal (gconstpointer a,
+                     gconstpointer b)
+{
+  const CachedLayout *cached_a = a;
+  const CachedLayout *cached_b = b;
+  PangoLayout *layout_a = cached_a->layout;
+  PangoLayout *layout_b = cached_b->layout;
+
+  return cached_a->hash == cached_b->hash &&
+         cached_a->context_serial == cached_b->context_serial &&
+         pango_layout_get_context (layout_a) == pango_layout_get_context (layout_b) &&
+         pango_layout_get_width (layout_a) == pango_layout_get_width (layout_b) &&
+         pango_layout_get_wrap (layout_a) == pango_layout_get_wrap (layout_b) &&
+         pango_layout_get_ellipsize (layout_a) == pango_layout_get_ellipsize (layout_b) &&
+         pango_layout_get_alignment (layout_a) == pango_layout_get_alignment (layout_b) &&
+         pango_layout_get_single_paragraph_mode (layout_a) == pango_layout_get_single_paragraph_mode (layout_b) &&
+         strcmp (pango_layout_get_text (layout_a), pango_layout_get_text (layout_b)) == 0 &&
+         attr_lists_equal (pango_layout_get_attributes (layout_a),
+                           pango_layout_get_attributes (layout_b));
+}
+
+static void
+cached_layout_free (gpointer data)
+{
+  CachedLayout *cached = data;
+
+  g_queue_unlink (&layout_cache_lru, &cached->link);
+  g_object_unref (cached->layout);
+  g_slice_free (CachedLayout, cached);
+}
+
+/* Takes ownership of @layout, and returns a reference to an identical
+ * layout from the cache, or to @layout after adding it to the cache.
+ */
+static PangoLayout *
+cache_layout (PangoLayout *layout)
+{
+  CachedLayout key, *cached;
+
+  if (G_UNLIKELY (layout_cache == NULL))
+    layout_cache = g_hash_table_new_full (cached_layout_hash, cached_layout_equal,
+                                          cached_layout_free, NULL);
+
+  key.layout = layout;
+  key.context_serial = pango_context_get_serial (pango_layout_get_context (layout));
+  key.hash = g_str_hash (pango_layout_get_text (layout)) ^
+             (guint) pango_layout_get_width (layout) * 31 ^
+             (guint) pango_layout_get_ellipsize (layout) << 8 ^
+             (guint) pango_layout_get_wrap (layout) << 12;
+
+  cached = g_hash_table_lookup (layout_cache, &key);
+  if (cached)
+    {
+      g_object_unref (layout);
+
+      g_queue_unlink (&layout_cache_lru, &cached->link);
+      g_queue_push_head_link (&layout_cache_lru, &cached->link);
+
+      return g_object_ref (cached->layout);
+    }
+
+  if (layout_cache_lru.length >= LAYOUT_CACHE_SIZE)
+    g_hash_table_remove (layout_cache, g_queue_peek_tail (&layout_cache_lru));
+
+  cached = g_slice_new (CachedLayout);
+  *cached = key;
+  cached->link.data = cached;
+  cached->link.prev = cached->link.next = NULL;
+  g_queue_push_head_link (&layout_cache_lru, &cached->link);
+  g_hash_table_add (layout_cache, cached);
+
+  return g_object_ref (layout);
+}
+
 static PangoLayout*
-get_layout (GtkCellRendererText *celltext,
-            GtkWidget           *widget,
-            const GdkRectangle  *cell_area,
-            GtkCellRendererState flags)
+create_layout (GtkCellRendererText *celltext,
+               GtkWidget           *widget,
+               const GdkRectangle  *cell_area,
+               GtkCellRendererState flags)
 {
   GtkCellRendererTextPrivate *priv = celltext->priv;
   PangoAttrList *attr_list;
@@ -1550,11 +1726,14 @@ get_layout (GtkCellRendererText *celltext,
 
   if (priv->wrap_width != -1)
     {
+      PangoLayout   *unwrapped;
       PangoRectangle rect;
       gint           width, text_width;
 
-      pango_layout_get_extents (layout, NULL, &rect);
+      unwrapped = cache_layout (pango_layout_copy (layout));
+      pango_layout_get_extents (unwrapped, NULL, &rect);
       text_width = rect.width;
+      g_object_unref (unwrapped);
 
       if (cell_area)
 	width = (cell_area->width - xpad * 2) * PANGO_SCALE;
@@ -1589,6 +1768,31 @@ get_layout (GtkCellRendererText *celltext,
   return layout;
 }
 
+/* The returned layout is shared and must not be modified */
+static PangoLayout*
+get_layout (GtkCellRendererText *celltext,
+            GtkWidget           *widget,
+            const GdkRectangle  *cell_area,
+            GtkCellRendererState flags)
+{
+  return cache_layout (create_layout (celltext, widget, cell_area, flags));
+}
+
+static PangoLayout*
+get_layout_for_width (GtkCellRendererText *celltext,
+                      GtkWidget           *widget,
+                      const GdkRectangle  *cell_area,
+                      GtkCellRendererState flags,
+                      gint                 width)
+{
+  PangoLayout *layout;
+
+  layout = create_layout (celltext, widget, cell_area, flags);
+  pango_layout_set_width (layout, width);
+
+  return cache_layout (layout);
+}
+
 
 static void
 get_size (GtkCellRenderer    *cell,
@@ -1733,11 +1937,13 @@ gtk_cell_renderer_text_snapshot (GtkCellRenderer      *cell,
 
   gtk_cell_renderer_get_padding (cell, &xpad, &ypad);
 
+  /* Without wrapping, get_layout() already leaves the width unset */
   if (priv->ellipsize_set && priv->ellipsize != PANGO_ELLIPSIZE_NONE)
-    pango_layout_set_width (layout,
-			    (cell_area->width - x_offset - 2 * xpad) * PANGO_SCALE);
-  else if (priv->wrap_width == -1)
-    pango_layout_set_width (layout, -1);
+    {
+      g_object_unref (layout);
+      layout = get_layout_for_width (celltext, widget, cell_area, flags,
+                                     (cell_area->width - x_offset - 2 * xpad) * PANGO_SCALE);
+    }
 
   pango_layout_get_pixel_extents (layout, NULL, &rect);
   x_offset = x_offset - rect.x;
@@ -2006,10 +2212,8 @@ gtk_cell_renderer_text_get_preferred_width (GtkCellRenderer *cell,
 
   gtk_cell_renderer_get_padding (cell, &xpad, NULL);
 
-  layout = get_layout (celltext, widget, NULL, 0);
-
   /* Fetch the length of the complete unwrapped text */
-  pango_layout_set_width (layout, -1);
+  layout = get_layout_for_width (celltext, widget, NULL, 0, -1);
   pango_layout_get_extents (layout, NULL, &rect);
   text_width = rect.width;
 
@@ -2079,9 +2283,8 @@ gtk_cell_renderer_text_get_preferred_height_for_width (GtkCellRenderer *cell,
 
   gtk_cell_renderer_get_padding (cell, &xpad, &ypad);
 
-  layout = get_layout (celltext, widget, NULL, 0);
-
-  pango_layout_set_width (layout, (width - xpad * 2) * PANGO_SCALE);
+  layout = get_layout_for_width (celltext, widget, NULL, 0,
+                                 (width - xpad * 2) * PANGO_SCALE);
   pango_layout_get_pixel_size (layout, NULL, &text_height);
 
   if (minimum_height)
@@ -116,6 +116,7 @@ gtk_cell_renderer_toggle_init (GtkCellRendererToggle *celltoggle)
 
   g_object_set (celltoggle, "mode", GTK_CELL_RENDERER_MODE_ACTIVATABLE, NULL);
   gtk_cell_renderer_set_padding (GTK_CELL_RENDERER (celltoggle), 2, 2);
+  gtk_cell_renderer_set_constant_size (GTK_CELL_RENDERER (celltoggle), TRUE);
 
   priv->inconsistent = FALSE;
 }
@@ -257,6 +258,7 @@ gtk_cell_renderer_toggle_set_property (GObject      *object,
       if (priv->radio != g_value_get_boolean (value))
         {
           priv->radio = g_value_get_boolean (value);
+          _gtk_cell_renderer_size_changed (GTK_CELL_RENDERER (object));
           g_object_notify_by_pspec (object, pspec);
         }
       break;
@@ -518,6 +520,9 @@ gtk_cell_renderer_toggle_set_radio (GtkCellRendererToggle *toggle,
 
   priv = toggle->priv;
 
+  if (priv->radio != radio)
+    _gtk_cell_renderer_size_changed (GTK_CELL_RENDERER (toggle));
+
   priv->radio = radio;
 }
 
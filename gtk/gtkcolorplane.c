@@ -34,8 +34,6 @@ struct _GtkColorPlanePrivate
   GtkAdjustment *h_adj;
   GtkAdjustment *s_adj;
   GtkAdjustment *v_adj;
-
-  GdkTexture *texture;
 };
 
 enum {
@@ -65,6 +63,49 @@ sv_to_xy (GtkColorPlane *plane,
   *y = CLAMP (height * (1 - s), 0, height - 1);
 }
 
+/* The plane shows saturation going down and value going right. Since
+ * hsv_to_rgb (h, s, v) = v * (s * hsv_to_rgb (h, 1, 1) + (1 - s) * white),
+ * it is the hue fading to white from top to bottom, darkened by black
+ * fading out from left to right. Drawing it as two gradients leaves the
+ * pixels to the renderer, so changing the hue does not touch them.
+ */
+static void
+plane_snapshot_gradient (GtkColorPlane *plane,
+                         GtkSnapshot   *snapshot,
+                         int            width,
+                         int            height)
+{
+  GdkRGBA hue = { 0, 0, 0, 1 };
+  double r, g, b;
+
+  if (width <= 1 || height <= 1)
+    return;
+
+  gtk_hsv_to_rgb (gtk_adjustment_get_value (plane->priv->h_adj), 1, 1, &r, &g, &b);
+  hue.red = r;
+  hue.green = g;
+  hue.blue = b;
+
+  gtk_snapshot_append_linear_gradient (snapshot,
+                                       &GRAPHENE_RECT_INIT (0, 0, width, height),
+                                       &GRAPHENE_POINT_INIT (0, 0),
+                                       &GRAPHENE_POINT_INIT (0, height),
+                                       (GskColorStop[2]) {
+                                         { 0, hue },
+                                         { 1, { 1, 1, 1, 1 } },
+                                       },
+                                       2);
+  gtk_snapshot_append_linear_gradient (snapshot,
+                                       &GRAPHENE_RECT_INIT (0, 0, width, height),
+                                       &GRAPHENE_POINT_INIT (0, 0),
+                                       &GRAPHENE_POINT_INIT (width, 0),
+                                       (GskColorStop[2]) {
+                                         { 0, { 0, 0, 0, 1 } },
+                                         { 1, { 0, 0, 0, 0 } },
+                                       },
+                                       2);
+}
+
 static void
 plane_snapshot (GtkWidget   *widget,
                 GtkSnapshot *snapshot)
@@ -77,9 +118,8 @@ plane_snapshot (GtkWidget   *widget,
   width = gtk_widget_get_width (widget);
   height = gtk_widget_get_height (widget);
 
-  gtk_snapshot_append_texture (snapshot,
-                               plane->priv->texture,
-                               &GRAPHENE_RECT_INIT (0, 0, width, height));
+  plane_snapshot_gradient (plane, snapshot, width, height);
+
   if (gtk_widget_has_visible_focus (widget))
     {
       const GdkRGBA c1 = { 1.0, 1.0, 1.0, 0.6 };
@@ -110,94 +150,6 @@ plane_snapshot (GtkWidget   *widget,
     }
 }
 
-static void
-create_texture (GtkColorPlane *plane)
-{
-  GtkWidget *widget = GTK_WIDGET (plane);
-  GBytes *bytes;
-  gint width, height, stride;
-  guint red, green, blue;
-  guint32 *data, *p;
-  gdouble h, s, v;
-  gdouble r, g, b;
-  gdouble sf, vf;
-  gint x, y;
-
-  if (!gtk_widget_get_realized (widget))
-    return;
-
-  width = gtk_widget_get_width (widget);
-  height = gtk_widget_get_height (widget);
-
-  g_clear_object (&plane->priv->texture);
-
-  stride = width * 4;
-
-  data = g_malloc (height * stride);
-
-  if (width > 1 && height > 1)
-    {
-      h = gtk_adjustment_get_value (plane->priv->h_adj);
-      sf = 1.0 / (height - 1);
-      vf = 1.0 / (width - 1);
-      for (y = 0; y < height; y++)
-        {
-          s = CLAMP (1.0 - y * sf, 0.0, 1.0);
-          p = data + y * (stride / 4);
-          for (x = 0; x < width; x++)
-            {
-              v = x * vf;
-              gtk_hsv_to_rgb (h, s, v, &r, &g, &b);
-              red = CLAMP (r * 255, 0, 255);
-              green = CLAMP (g * 255, 0, 255);
-              blue = CLAMP (b * 255, 0, 255);
-              p[x] = (0xff << 24) | (red << 16) | (green << 8) | blue;
-            }
-        }
-    }
-  else
-    {
-      memset (data, 0, height * stride);
-    }
-
-  bytes = g_bytes_new_take (data, height * stride);
-  plane->priv->texture = gdk_memory_texture_new (width, height,
-                                                 GDK_MEMORY_DEFAULT,
-                                                 bytes,
-                                                 stride);
-  g_bytes_unref (bytes);
-}
-
-static void
-plane_size_allocate (GtkWidget *widget,
-                     int        width,
-                     int        height,
-                     int        baseline)
-{
-  GtkColorPlane *plane = GTK_COLOR_PLANE (widget);
-
-  create_texture (plane);
-}
-
-static void
-plane_realize (GtkWidget *widget)
-{
-  GTK_WIDGET_CLASS (gtk_color_plane_parent_class)->realize (widget);
-
-  create_texture (GTK_COLOR_PLANE (widget));
-}
-
-static void
-plane_unrealize (GtkWidget *widget)
-{
-  GtkColorPlane *plane = GTK_COLOR_PLANE (widget);
-  GtkColorPlanePrivate *priv = gtk_color_plane_get_instance_private (plane);
-
-  g_clear_object (&priv->texture);
-
-  GTK_WIDGET_CLASS (gtk_color_plane_parent_class)->unrealize (widget);
-}
-
 static void
 set_cross_cursor (GtkWidget *widget,
                   gboolean   enabled)
@@ -211,7 +163,6 @@ set_cross_cursor (GtkWidget *widget,
 static void
 h_changed (GtkColorPlane *plane)
 {
-  create_texture (plane);
   gtk_widget_queue_draw (GTK_WIDGET (plane));
 }
 
@@ -435,8 +386,6 @@ plane_finalize (GObject *object)
 {
   GtkColorPlane *plane = GTK_COLOR_PLANE (object);
 
-  g_clear_object (&plane->priv->texture);
-
   g_clear_object (&plane->priv->h_adj);
   g_clear_object (&plane->priv->s_adj);
   g_clear_object (&plane->priv->v_adj);
@@ -498,9 +447,6 @@ gtk_color_plane_class_init (GtkColorPlaneClass *class)
   object_class->set_property = plane_set_property;
 
   widget_class->snapshot = plane_snapshot;
-  widget_class->size_allocate = plane_size_allocate;
-  widget_class->realize = plane_realize;
-  widget_class->unrealize = plane_unrealize;
 
   g_object_class_install_property (object_class,
                                    PROP_H_ADJUSTMENT,
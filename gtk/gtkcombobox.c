@@ -35,9 +35,12 @@
 #include "gtkmenuitem.h"
 #include "gtkmenuprivate.h"
 #include "gtkmenushellprivate.h"
+#include "gtkpopover.h"
 #include "gtkprivate.h"
+#include "gtkscrolledwindow.h"
 #include "gtktogglebutton.h"
 #include "gtktreemenu.h"
+#include "gtktreeview.h"
 #include "gtktypebuiltins.h"
 #include "gtkeventcontrollerkey.h"
 
@@ -127,6 +130,10 @@ typedef struct
 
   GtkWidget *popup_widget;
 
+  /* Used instead of popup_widget for large models */
+  GtkWidget *list_popup;
+  GtkWidget *tree_view;
+
   guint popup_idle_id;
   guint scroll_timer;
   guint resize_idle_id;
@@ -162,6 +169,7 @@ typedef struct
  * button -> GtkToggleButton set_parent to combo
  * arrow -> GtkArrow set_parent to button
  * popup_widget -> GtkMenu
+ * list_popup -> GtkPopover, for large flat models
  *
  * 2) child added:
  *
@@ -169,6 +177,7 @@ typedef struct
  * button -> GtkToggleButton set_parent to combo
  * arrow -> GtkArrow, child of button
  * popup_widget -> GtkMenu
+ * list_popup -> GtkPopover, for large flat models
  */
 
 enum {
@@ -1378,6 +1387,166 @@ gtk_combo_box_menu_popup (GtkComboBox    *combo_box)
       gtk_menu_shell_select_item (GTK_MENU_SHELL (priv->popup_widget), active);
 }
 
+/* Models with this many rows are shown in a list instead of a menu, if
+ * they are flat. A list only creates cells for the rows that are
+ * visible, a menu creates widgets for all of them. */
+#define LIST_POPUP_MIN_ROWS 1000
+#define LIST_POPUP_MAX_HEIGHT 400
+
+static gboolean
+gtk_combo_box_use_list_popup (GtkComboBox *combo_box)
+{
+  GtkComboBoxPrivate *priv = gtk_combo_box_get_instance_private (combo_box);
+
+  return priv->model != NULL &&
+         (gtk_tree_model_get_flags (priv->model) & GTK_TREE_MODEL_LIST_ONLY) &&
+         gtk_tree_model_iter_n_children (priv->model, NULL) >= LIST_POPUP_MIN_ROWS;
+}
+
+/* The menu only gets the model when it is used, so large models
+ * never get a menu item for every row */
+static void
+gtk_combo_box_update_menu_model (GtkComboBox *combo_box)
+{
+  GtkComboBoxPrivate *priv = gtk_combo_box_get_instance_private (combo_box);
+  GtkTreeMenu *menu = GTK_TREE_MENU (priv->popup_widget);
+  GtkTreeModel *model;
+
+  if (gtk_combo_box_use_list_popup (combo_box))
+    model = NULL;
+  else
+    model = priv->model;
+
+  if (_gtk_tree_menu_get_model (menu) != model)
+    _gtk_tree_menu_set_model (menu, model);
+}
+
+static void
+gtk_combo_box_list_row_activated (GtkTreeView       *tree_view,
+                                  GtkTreePath       *path,
+                                  GtkTreeViewColumn *column,
+                                  GtkComboBox       *combo_box)
+{
+  GtkComboBoxPrivate *priv = gtk_combo_box_get_instance_private (combo_box);
+  GtkTreeIter iter;
+
+  if (gtk_tree_model_get_iter (priv->model, &iter, path))
+    gtk_combo_box_set_active_iter (combo_box, &iter);
+
+  g_object_set (combo_box,
+                "editing-canceled", FALSE,
+                NULL);
+
+  gtk_popover_popdown (GTK_POPOVER (priv->list_popup));
+}
+
+static void
+gtk_combo_box_ensure_list_popup (GtkComboBox *combo_box)
+{
+  GtkComboBoxPrivate *priv = gtk_combo_box_get_instance_private (combo_box);
+  GtkTreeViewColumn *column;
+  GtkWidget *sw;
+
+  if (priv->list_popup)
+    return;
+
+  priv->list_popup = gtk_popover_new (GTK_WIDGET (combo_box));
+  gtk_popover_set_position (GTK_POPOVER (priv->list_popup), GTK_POS_BOTTOM);
+  g_signal_connect (priv->list_popup, "show",
+                    G_CALLBACK (gtk_combo_box_menu_show), combo_box);
+  g_signal_connect (priv->list_popup, "hide",
+                    G_CALLBACK (gtk_combo_box_menu_hide), combo_box);
+
+  sw = gtk_scrolled_window_new (NULL, NULL);
+  gtk_scrolled_window_set_policy (GTK_SCROLLED_WINDOW (sw),
+                                  GTK_POLICY_NEVER, GTK_POLICY_AUTOMATIC);
+  gtk_scrolled_window_set_max_content_height (GTK_SCROLLED_WINDOW (sw),
+                                              LIST_POPUP_MAX_HEIGHT);
+  gtk_scrolled_window_set_propagate_natural_height (GTK_SCROLLED_WINDOW (sw), TRUE);
+  gtk_container_add (GTK_CONTAINER (priv->list_popup), sw);
+
+  priv->tree_view = gtk_tree_view_new ();
+  gtk_tree_view_set_headers_visible (GTK_TREE_VIEW (priv->tree_view), FALSE);
+  gtk_tree_view_set_activate_on_single_click (GTK_TREE_VIEW (priv->tree_view), TRUE);
+  gtk_tree_view_set_hover_selection (GTK_TREE_VIEW (priv->tree_view), TRUE);
+  g_signal_connect (priv->tree_view, "row-activated",
+                    G_CALLBACK (gtk_combo_box_list_row_activated), combo_box);
+
+  /* Fixed height, so the rows are not measured on popup */
+  column = gtk_tree_view_column_new_with_area (priv->area);
+  gtk_tree_view_column_set_sizing (column, GTK_TREE_VIEW_COLUMN_FIXED);
+  gtk_tree_view_append_column (GTK_TREE_VIEW (priv->tree_view), column);
+  gtk_tree_view_set_fixed_height_mode (GTK_TREE_VIEW (priv->tree_view), TRUE);
+
+  gtk_container_add (GTK_CONTAINER (sw), priv->tree_view);
+}
+
+/* The column to search when typing in the list: the text column,
+ * or the one shown by the first text renderer */
+static gint
+gtk_combo_box_get_search_column (GtkComboBox *combo_box)
+{
+  GtkComboBoxPrivate *priv = gtk_combo_box_get_instance_private (combo_box);
+  GList *cells, *l;
+  gint column = -1;
+
+  if (priv->text_column >= 0)
+    return priv->text_column;
+
+  cells = gtk_cell_layout_get_cells (GTK_CELL_LAYOUT (priv->area));
+  for (l = cells; l; l = l->next)
+    {
+      if (GTK_IS_CELL_RENDERER_TEXT (l->data))
+        {
+          column = gtk_cell_area_attribute_get_column (priv->area, l->data, "text");
+          if (column >= 0)
+            break;
+        }
+    }
+  g_list_free (cells);
+
+  return column;
+}
+
+static void
+gtk_combo_box_list_popup (GtkComboBox *combo_box)
+{
+  GtkComboBoxPrivate *priv = gtk_combo_box_get_instance_private (combo_box);
+  GtkTreeView *tree_view;
+  GtkTreePath *path;
+  gint search_column;
+
+  gtk_combo_box_ensure_list_popup (combo_box);
+  tree_view = GTK_TREE_VIEW (priv->tree_view);
+
+  if (gtk_tree_view_get_model (tree_view) != priv->model)
+    gtk_tree_view_set_model (tree_view, priv->model);
+  gtk_tree_view_set_row_separator_func (tree_view,
+                                        (GtkTreeViewRowSeparatorFunc) gtk_combo_box_row_separator_func,
+                                        combo_box, NULL);
+
+  search_column = gtk_combo_box_get_search_column (combo_box);
+  gtk_tree_view_set_enable_search (tree_view, search_column >= 0);
+  if (search_column >= 0)
+    gtk_tree_view_set_search_column (tree_view, search_column);
+
+  gtk_widget_set_size_request (priv->list_popup,
+                               gtk_widget_get_width (GTK_WIDGET (combo_box)), -1);
+
+  if (gtk_tree_row_reference_valid (priv->active_row))
+    {
+      path = gtk_tree_row_reference_get_path (priv->active_row);
+      gtk_tree_view_set_cursor (tree_view, path, NULL, FALSE);
+      gtk_tree_view_scroll_to_cell (tree_view, path, NULL, TRUE, 0.5, 0.0);
+      gtk_tree_path_free (path);
+    }
+  else
+    gtk_tree_selection_unselect_all (gtk_tree_view_get_selection (tree_view));
+
+  gtk_popover_popup (GTK_POPOVER (priv->list_popup));
+  gtk_widget_grab_focus (priv->tree_view);
+}
+
 /**
  * gtk_combo_box_popup:
  * @combo_box: a #GtkComboBox
@@ -1422,16 +1591,22 @@ gtk_combo_box_popup_for_device (GtkComboBox *combo_box,
   if (!gtk_widget_get_realized (GTK_WIDGET (combo_box)))
     return;
 
-  if (gtk_widget_get_mapped (priv->popup_widget))
+  if (gtk_widget_get_mapped (priv->popup_widget) ||
+      (priv->list_popup && gtk_widget_get_mapped (priv->list_popup)))
     return;
 
-  gtk_combo_box_menu_popup (combo_box);
+  gtk_combo_box_real_popup (combo_box);
 }
 
 static void
 gtk_combo_box_real_popup (GtkComboBox *combo_box)
 {
-  gtk_combo_box_menu_popup (combo_box);
+  gtk_combo_box_update_menu_model (combo_box);
+
+  if (gtk_combo_box_use_list_popup (combo_box))
+    gtk_combo_box_list_popup (combo_box);
+  else
+    gtk_combo_box_menu_popup (combo_box);
 }
 
 static gboolean
@@ -1465,6 +1640,8 @@ gtk_combo_box_popdown (GtkComboBox *combo_box)
   g_return_if_fail (GTK_IS_COMBO_BOX (combo_box));
 
   gtk_menu_popdown (GTK_MENU (priv->popup_widget));
+  if (priv->list_popup)
+    gtk_popover_popdown (GTK_POPOVER (priv->list_popup));
 }
 
 static void
@@ -2170,8 +2347,7 @@ gtk_combo_box_set_model (GtkComboBox  *combo_box,
                     G_CALLBACK (gtk_combo_box_model_row_changed),
                     combo_box);
 
-  _gtk_tree_menu_set_model (GTK_TREE_MENU (priv->popup_widget),
-                            priv->model);
+  gtk_combo_box_update_menu_model (combo_box);
 
   if (priv->cell_view)
     gtk_cell_view_set_model (GTK_CELL_VIEW (priv->cell_view),
@@ -2495,6 +2671,16 @@ gtk_combo_box_dispose (GObject* object)
       priv->popup_widget = NULL;
     }
 
+  if (priv->list_popup)
+    {
+      g_signal_handlers_disconnect_by_func (priv->list_popup,
+                                            gtk_combo_box_menu_hide,
+                                            combo_box);
+      gtk_popover_set_relative_to (GTK_POPOVER (priv->list_popup), NULL);
+      priv->list_popup = NULL;
+      priv->tree_view = NULL;
+    }
+
   gtk_combo_box_unset_model (combo_box);
 
   G_OBJECT_CLASS (gtk_combo_box_parent_class)->dispose (object);
@@ -2675,7 +2861,7 @@ gtk_combo_box_set_row_separator_func (GtkComboBox                 *combo_box,
 
   /* Make the TreeMenu rebuild itself using the new separator func */
   _gtk_tree_menu_set_model (GTK_TREE_MENU (priv->popup_widget), NULL);
-  _gtk_tree_menu_set_model (GTK_TREE_MENU (priv->popup_widget), priv->model);
+  gtk_combo_box_update_menu_model (combo_box);
 
   gtk_widget_queue_draw (GTK_WIDGET (combo_box));
 }
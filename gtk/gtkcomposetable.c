@@ -30,7 +30,7 @@
 
 
 #define GTK_COMPOSE_TABLE_MAGIC "GtkComposeTable"
-#define GTK_COMPOSE_TABLE_VERSION (1)
+#define GTK_COMPOSE_TABLE_VERSION (2)
 
 typedef struct {
   gunichar     *sequence;
@@ -534,63 +534,45 @@ gtk_compose_hash_get_cache_path (guint32 hash)
   return path;
 }
 
+/* The cache is the trie as it is in memory, so that it can be used
+ * straight from the mapped file. It starts with a header of
+ * GTK_COMPOSE_CACHE_HEADER_SIZE bytes: the magic, padded to 16 bytes,
+ * then the version, a byte order mark, the maximum sequence length
+ * and the number of nodes as guint32 in host byte order. Caches
+ * written on machines with a different byte order are rebuilt.
+ */
+#define GTK_COMPOSE_CACHE_MAGIC_SIZE 16
+#define GTK_COMPOSE_CACHE_HEADER_SIZE (GTK_COMPOSE_CACHE_MAGIC_SIZE + 4 * sizeof (guint32))
+#define GTK_COMPOSE_CACHE_BYTE_ORDER 0x01020304
+
 static gchar *
 gtk_compose_table_serialize (GtkComposeTable *compose_table,
                              gsize           *count)
 {
-  gchar *p, *contents;
-  gsize length, total_length;
-  guint16 bytes;
-  const gchar *header = GTK_COMPOSE_TABLE_MAGIC;
-  const guint16 version = GTK_COMPOSE_TABLE_VERSION;
-  guint16 max_seq_len = compose_table->max_seq_len;
-  guint16 index_stride = max_seq_len + 2;
-  guint16 n_seqs = compose_table->n_seqs;
-  guint32 i;
+  gchar *contents;
+  guint32 header[4];
+  gsize total_length;
 
   g_return_val_if_fail (compose_table != NULL, NULL);
-  g_return_val_if_fail (max_seq_len > 0, NULL);
-  g_return_val_if_fail (index_stride > 0, NULL);
+  g_return_val_if_fail (compose_table->max_seq_len > 0, NULL);
 
-  length = strlen (header);
-  total_length = length + sizeof (guint16) * (3 +  index_stride * n_seqs);
+  total_length = GTK_COMPOSE_CACHE_HEADER_SIZE +
+                 compose_table->n_nodes * sizeof (GtkComposeNode);
   if (count)
     *count = total_length;
 
-  p = contents = g_slice_alloc (total_length);
-
-  memcpy (p, header, length);
-  p += length;
-
-  /* Copy by byte for endian */
-#define BYTE_COPY_FROM_BUF(element)                                           \
-  bytes = GUINT16_TO_BE ((element));                                          \
-  memcpy (p, &bytes, length);                                                 \
-  p += length;                                                                \
-  if (p - contents > total_length)                                            \
-    {                                                                         \
-      g_warning ("data size %lld is bigger than %" G_GSIZE_FORMAT,            \
-                 (long long) (p - contents), total_length);                   \
-      g_free (contents);                                                      \
-      if (count)                                                              \
-        {                                                                     \
-          *count = 0;                                                         \
-        }                                                                     \
-      return NULL;                                                            \
-    }
+  contents = g_malloc0 (total_length);
+  memcpy (contents, GTK_COMPOSE_TABLE_MAGIC, strlen (GTK_COMPOSE_TABLE_MAGIC));
 
-  length = sizeof (guint16);
+  header[0] = GTK_COMPOSE_TABLE_VERSION;
+  header[1] = GTK_COMPOSE_CACHE_BYTE_ORDER;
+  header[2] = compose_table->max_seq_len;
+  header[3] = compose_table->n_nodes;
+  memcpy (contents + GTK_COMPOSE_CACHE_MAGIC_SIZE, header, sizeof (header));
 
-  BYTE_COPY_FROM_BUF (version);
-  BYTE_COPY_FROM_BUF (max_seq_len);
-  BYTE_COPY_FROM_BUF (n_seqs);
-
-  for (i = 0; i < (guint32) index_stride * n_seqs; i++)
-    {
-      BYTE_COPY_FROM_BUF (compose_table->data[i]);
-    }
-
-#undef BYTE_COPY_FROM_BUF
+  memcpy (contents + GTK_COMPOSE_CACHE_HEADER_SIZE,
+          compose_table->nodes,
+          compose_table->n_nodes * sizeof (GtkComposeNode));
 
   return contents;
 }
@@ -604,25 +586,44 @@ gtk_compose_table_find (gconstpointer data1,
   return compose_table->id != hash;
 }
 
+/* Children always come after their parent, so walking the trie
+ * of a valid cache ends, and stays inside of it.
+ */
+static gboolean
+gtk_compose_nodes_validate (const GtkComposeNode *nodes,
+                            guint32               n_nodes)
+{
+  guint32 i;
+
+  if (n_nodes == 0)
+    return FALSE;
+
+  for (i = 0; i < n_nodes; i++)
+    {
+      if (nodes[i].n_children == 0)
+        continue;
+
+      if (nodes[i].children <= i ||
+          nodes[i].children > n_nodes ||
+          nodes[i].n_children > n_nodes - nodes[i].children)
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
 static GtkComposeTable *
 gtk_compose_table_load_cache (const gchar *compose_file)
 {
   guint32 hash;
   gchar *path = NULL;
-  gchar *contents = NULL;
-  gchar *p;
+  GMappedFile *mapped = NULL;
+  const gchar *contents;
   GStatBuf original_buf;
   GStatBuf cache_buf;
   gsize total_length;
-  gsize length;
   GError *error = NULL;
-  guint16 bytes;
-  guint16 version;
-  guint16 max_seq_len;
-  guint16 index_stride;
-  guint16 n_seqs;
-  guint32 i;
-  guint16 *gtk_compose_seqs = NULL;
+  guint32 header[4];
   GtkComposeTable *retval;
 
   hash = g_str_hash (compose_file);
@@ -635,81 +636,56 @@ gtk_compose_table_load_cache (const gchar *compose_file)
   g_stat (path, &cache_buf);
   if (original_buf.st_mtime > cache_buf.st_mtime)
     goto out_load_cache;
-  if (!g_file_get_contents (path, &contents, &total_length, &error))
+
+  mapped = g_mapped_file_new (path, FALSE, &error);
+  if (mapped == NULL)
     {
       g_warning ("Failed to get cache content %s: %s", path, error->message);
       g_error_free (error);
       goto out_load_cache;
     }
 
-  /* Copy by byte for endian */
-#define BYTE_COPY_TO_BUF(element)                                       \
-  memcpy (&bytes, p, length);                                           \
-  element = GUINT16_FROM_BE (bytes);                                    \
-  p += length;                                                          \
-  if (p - contents > total_length)                                      \
-    {                                                                   \
-      g_warning ("Broken cache content %s in %s", path, #element);      \
-      goto out_load_cache;                                              \
-    }
+  contents = g_mapped_file_get_contents (mapped);
+  total_length = g_mapped_file_get_length (mapped);
 
-  p = contents;
-  if (g_ascii_strncasecmp (p, GTK_COMPOSE_TABLE_MAGIC,
-                           strlen (GTK_COMPOSE_TABLE_MAGIC)) != 0)
+  if (total_length < GTK_COMPOSE_CACHE_HEADER_SIZE ||
+      strncmp (contents, GTK_COMPOSE_TABLE_MAGIC, strlen (GTK_COMPOSE_TABLE_MAGIC)) != 0)
     {
       g_warning ("The file is not a GtkComposeTable cache file %s", path);
       goto out_load_cache;
     }
-  p += strlen (GTK_COMPOSE_TABLE_MAGIC);
-  if (p - contents > total_length)
-    {
-      g_warning ("Broken cache content %s at head", path);
-      goto out_load_cache;
-    }
 
-  length = sizeof (guint16);
+  memcpy (header, contents + GTK_COMPOSE_CACHE_MAGIC_SIZE, sizeof (header));
 
-  BYTE_COPY_TO_BUF (version);
-  if (version != GTK_COMPOSE_TABLE_VERSION)
-    {
-      g_warning ("cache version is different %u != %u",
-                 version, GTK_COMPOSE_TABLE_VERSION);
-      goto out_load_cache;
-    }
-
-  BYTE_COPY_TO_BUF (max_seq_len);
-  BYTE_COPY_TO_BUF (n_seqs);
+  /* Older caches are silently replaced */
+  if (header[0] != GTK_COMPOSE_TABLE_VERSION ||
+      header[1] != GTK_COMPOSE_CACHE_BYTE_ORDER)
+    goto out_load_cache;
 
-  if (max_seq_len == 0 || n_seqs == 0)
+  if (header[2] == 0 || header[2] > GTK_MAX_COMPOSE_LEN ||
+      header[3] > (total_length - GTK_COMPOSE_CACHE_HEADER_SIZE) / sizeof (GtkComposeNode) ||
+      total_length != GTK_COMPOSE_CACHE_HEADER_SIZE + header[3] * sizeof (GtkComposeNode) ||
+      !gtk_compose_nodes_validate ((const GtkComposeNode *) (contents + GTK_COMPOSE_CACHE_HEADER_SIZE),
+                                   header[3]))
     {
-      g_warning ("cache size is not correct %d %d", max_seq_len, n_seqs);
+      g_warning ("Broken cache content %s", path);
       goto out_load_cache;
     }
 
-  index_stride = max_seq_len + 2;
-  gtk_compose_seqs = g_new0 (guint16, n_seqs * index_stride);
-
-  for (i = 0; i < (guint32) index_stride * n_seqs; i++)
-    {
-      BYTE_COPY_TO_BUF (gtk_compose_seqs[i]);
-    }
-
   retval = g_new0 (GtkComposeTable, 1);
-  retval->data = gtk_compose_seqs;
-  retval->max_seq_len = max_seq_len;
-  retval->n_seqs = n_seqs;
+  retval->nodes = (const GtkComposeNode *) (contents + GTK_COMPOSE_CACHE_HEADER_SIZE);
+  retval->n_nodes = header[3];
+  retval->max_seq_len = header[2];
   retval->id = hash;
+  retval->mapped = mapped;
 
-  g_free (contents);
   g_free (path);
 
   return retval;
 
-#undef BYTE_COPY_TO_BUF
-
 out_load_cache:
-  g_free (gtk_compose_seqs);
-  g_free (contents);
+  if (mapped)
+    g_mapped_file_unref (mapped);
   g_free (path);
   return NULL;
 }
@@ -739,10 +715,108 @@ gtk_compose_table_save_cache (GtkComposeTable *compose_table)
     }
 
 out_save_cache:
-  g_slice_free1 (length, contents);
+  g_free (contents);
   g_free (path);
 }
 
+typedef struct {
+  guint32 node;
+  gint lo;
+  gint hi;
+  gint depth;
+} GtkComposeRange;
+
+/* Builds the trie breadth first, so that the children of every node
+ * end up next to each other. @data must be sorted, so that the rows
+ * below a node are in one range, with the ones ending there first.
+ */
+static GtkComposeTable *
+gtk_compose_table_new_with_data (const guint16 *data,
+                                 gint           max_seq_len,
+                                 gint           n_seqs,
+                                 guint32        hash)
+{
+  gint row_stride = max_seq_len + 2;
+  GtkComposeTable *retval;
+  GArray *nodes;
+  GQueue queue = G_QUEUE_INIT;
+  GtkComposeRange *range;
+  GtkComposeNode root = { 0, 0, 0, GTK_COMPOSE_NO_VALUE };
+
+  nodes = g_array_new (FALSE, FALSE, sizeof (GtkComposeNode));
+  g_array_append_val (nodes, root);
+
+  range = g_slice_new (GtkComposeRange);
+  range->node = 0;
+  range->lo = 0;
+  range->hi = n_seqs;
+  range->depth = 0;
+  g_queue_push_tail (&queue, range);
+
+  while ((range = g_queue_pop_head (&queue)))
+    {
+      const guint16 *seq;
+      GtkComposeNode *node;
+      guint32 first_child;
+      gint i, start;
+
+      i = range->lo;
+
+      /* A sequence that ends here */
+      if (i < range->hi)
+        {
+          seq = data + i * row_stride;
+          if (range->depth == max_seq_len || seq[range->depth] == 0)
+            {
+              node = &g_array_index (nodes, GtkComposeNode, range->node);
+              node->value = 0x10000 * seq[max_seq_len] + seq[max_seq_len + 1];
+            }
+        }
+
+      /* Skip it and any duplicates */
+      while (i < range->hi &&
+             (range->depth == max_seq_len || data[i * row_stride + range->depth] == 0))
+        i++;
+
+      first_child = nodes->len;
+
+      while (i < range->hi)
+        {
+          GtkComposeNode child = { 0, 0, 0, GTK_COMPOSE_NO_VALUE };
+          GtkComposeRange *child_range;
+
+          start = i;
+          child.keysym = data[start * row_stride + range->depth];
+          while (i < range->hi && data[i * row_stride + range->depth] == child.keysym)
+            i++;
+
+          child_range = g_slice_new (GtkComposeRange);
+          child_range->node = nodes->len;
+          child_range->lo = start;
+          child_range->hi = i;
+          child_range->depth = range->depth + 1;
+          g_queue_push_tail (&queue, child_range);
+
+          g_array_append_val (nodes, child);
+        }
+
+      node = &g_array_index (nodes, GtkComposeNode, range->node);
+      node->children = first_child;
+      node->n_children = nodes->len - first_child;
+
+      g_slice_free (GtkComposeRange, range);
+    }
+
+  retval = g_new0 (GtkComposeTable, 1);
+  retval->n_nodes = nodes->len;
+  retval->data = (GtkComposeNode *) g_array_free (nodes, FALSE);
+  retval->nodes = retval->data;
+  retval->max_seq_len = max_seq_len;
+  retval->id = hash;
+
+  return retval;
+}
+
 static GtkComposeTable *
 gtk_compose_table_new_with_list (GList   *compose_list,
                                  int      max_compose_len,
@@ -780,11 +854,8 @@ gtk_compose_table_new_with_list (GList   *compose_list,
       gtk_compose_seqs[n++] = (guint16) compose_data->value[1];
     }
 
-  retval = g_new0 (GtkComposeTable, 1);
-  retval->data = gtk_compose_seqs;
-  retval->max_seq_len = max_compose_len;
-  retval->n_seqs = length;
-  retval->id = hash;
+  retval = gtk_compose_table_new_with_data (gtk_compose_seqs, max_compose_len, length, hash);
+  g_free (gtk_compose_seqs);
 
   return retval;
 }
@@ -837,8 +908,6 @@ gtk_compose_table_list_add_array (GSList        *compose_tables,
   GtkComposeTable *compose_table;
   int n_index_stride = max_seq_len + 2;
   int length = n_index_stride * n_seqs;
-  int i;
-  guint16 *gtk_compose_seqs = NULL;
 
   g_return_val_if_fail (data != NULL, compose_tables);
   g_return_val_if_fail (max_seq_len <= GTK_MAX_COMPOSE_LEN, compose_tables);
@@ -848,15 +917,7 @@ gtk_compose_table_list_add_array (GSList        *compose_tables,
   if (g_slist_find_custom (compose_tables, GINT_TO_POINTER (hash), gtk_compose_table_find) != NULL)
     return compose_tables;
 
-  gtk_compose_seqs = g_new0 (guint16, length);
-  for (i = 0; i < length; i++)
-    gtk_compose_seqs[i] = data[i];
-
-  compose_table = g_new (GtkComposeTable, 1);
-  compose_table->data = gtk_compose_seqs;
-  compose_table->max_seq_len = max_seq_len;
-  compose_table->n_seqs = n_seqs;
-  compose_table->id = hash;
+  compose_table = gtk_compose_table_new_with_data (data, max_seq_len, n_seqs, hash);
 
   return g_slist_prepend (compose_tables, compose_table);
 }
@@ -884,3 +945,56 @@ gtk_compose_table_list_add_file (GSList      *compose_tables,
   gtk_compose_table_save_cache (compose_table);
   return g_slist_prepend (compose_tables, compose_table);
 }
+
+/*
+ * gtk_compose_table_lookup:
+ * @table: a #GtkComposeTable
+ * @sequence: the keysyms typed so far
+ * @n_keys: the number of keysyms in @sequence
+ *
+ * Finds the node of the trie for @sequence, by taking one step per
+ * keysym. If the node has a value other than %GTK_COMPOSE_NO_VALUE,
+ * a sequence ends there. If it has children, longer sequences start
+ * with @sequence.
+ *
+ * Returns: (nullable): the node, or %NULL if no sequence starts
+ *   with @sequence
+ */
+const GtkComposeNode *
+gtk_compose_table_lookup (const GtkComposeTable *table,
+                          const guint16         *sequence,
+                          gint                   n_keys)
+{
+  const GtkComposeNode *node = &table->nodes[0];
+  gint i;
+
+  if (n_keys > table->max_seq_len)
+    return NULL;
+
+  for (i = 0; i < n_keys; i++)
+    {
+      const GtkComposeNode *children = &table->nodes[node->children];
+      guint lo = 0, hi = node->n_children;
+
+      node = NULL;
+      while (lo < hi)
+        {
+          guint mid = (lo + hi) / 2;
+
+          if (children[mid].keysym < sequence[i])
+            lo = mid + 1;
+          else if (children[mid].keysym > sequence[i])
+            hi = mid;
+          else
+            {
+              node = &children[mid];
+              break;
+            }
+        }
+
+      if (node == NULL)
+        return NULL;
+    }
+
+  return node;
+}
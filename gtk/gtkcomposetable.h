@@ -26,12 +26,31 @@ G_BEGIN_DECLS
 typedef struct _GtkComposeTable GtkComposeTable;
 typedef struct _GtkComposeTableCompact GtkComposeTableCompact;
 
+typedef struct _GtkComposeNode GtkComposeNode;
+
+#define GTK_COMPOSE_NO_VALUE G_MAXUINT32
+
+/* A node of the compose trie. The children of a node are next to each
+ * other, sorted by keysym, starting at the index @children.
+ */
+struct _GtkComposeNode
+{
+  guint16 keysym;
+  guint16 n_children;
+  guint32 children;
+  guint32 value;
+};
+
 struct _GtkComposeTable
 {
-  guint16 *data;
+  const GtkComposeNode *nodes;
+  guint n_nodes;
   gint max_seq_len;
-  gint n_seqs;
   guint32 id;
+
+  /* What the nodes are in */
+  GtkComposeNode *data;
+  GMappedFile *mapped;
 };
 
 struct _GtkComposeTableCompact
@@ -49,6 +68,9 @@ GSList *gtk_compose_table_list_add_array          (GSList        *compose_tables
                                                    gint           n_seqs);
 GSList *gtk_compose_table_list_add_file           (GSList        *compose_tables,
                                                    const gchar   *compose_file);
+const GtkComposeNode *gtk_compose_table_lookup (const GtkComposeTable *table,
+                                                const guint16         *sequence,
+                                                gint                   n_keys);
 
 G_END_DECLS
 
@@ -30,6 +30,7 @@
 #include "gtkassistant.h"
 #include "gtkbuildable.h"
 #include "gtkbuilderprivate.h"
+#include "gtkframephasetimingsprivate.h"
 #include "gtkintl.h"
 #include "gtkpopovermenu.h"
 #include "gtkprivate.h"
@@ -1350,6 +1351,11 @@ gtk_container_idle_sizer (GdkFrameClock *clock,
 			  GtkContainer  *container)
 {
   GtkContainerPrivate *priv = gtk_container_get_instance_private (container);
+  GtkFramePhaseTimings *timings, *previous_timings = NULL;
+  gint64 phase_start, phase_nested;
+
+  if (GTK_IS_WINDOW (container))
+    previous_timings = gtk_window_begin_frame_phases (GTK_WINDOW (container));
 
   /* We validate the style contexts in a single loop before even trying
    * to handle resizes instead of doing validations inline.
@@ -1364,7 +1370,9 @@ gtk_container_idle_sizer (GdkFrameClock *clock,
   if (priv->restyle_pending)
     {
       priv->restyle_pending = FALSE;
+      timings = gtk_frame_phase_begin (GTK_FRAME_PHASE_STYLE, &phase_start, &phase_nested);
       gtk_css_node_validate (gtk_widget_get_css_node (GTK_WIDGET (container)));
+      gtk_frame_phase_end (timings, GTK_FRAME_PHASE_STYLE, NULL, phase_start, phase_nested);
     }
 
   /* we may be invoked with a container_resize_queue of NULL, because
@@ -1385,11 +1393,15 @@ gtk_container_idle_sizer (GdkFrameClock *clock,
     {
       gtk_container_stop_idle_sizer (container);
     }
-  else
+  else if (!GTK_IS_WINDOW (container) ||
+           !gtk_window_get_layout_deferred (GTK_WINDOW (container)))
     {
       gdk_frame_clock_request_phase (clock,
                                      GDK_FRAME_CLOCK_PHASE_LAYOUT);
     }
+
+  if (GTK_IS_WINDOW (container))
+    gtk_window_end_frame_phases (GTK_WINDOW (container), previous_timings);
 }
 
 void
@@ -0,0 +1,190 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GTK_COUNTING_BLOOM_FILTER_PRIVATE_H__
+#define __GTK_COUNTING_BLOOM_FILTER_PRIVATE_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/*
+ * GtkCountingBloomFilter:
+ *
+ * This implements a counting bloom filter. A bloom filter is a space-efficient
+ * probabilistic data structure that is used to test whether an element may be
+ * a member of a set.
+ * The Wikipedia links provide a lot more details into how and why this data
+ * structure works and when to use it.
+ *
+ * This implementation is based on similar implementations in web browsers, because
+ * its original use case is the same: Making CSS lookups fast.
+ *
+ * As such, the number of bits is hardcoded to 12 and the elements in the set
+ * are 32bit hash values, of which the lower 24 bits are used to select two
+ * buckets.
+ *
+ * See: [Bloom filter](https://en.wikipedia.org/wiki/Bloom_filter),
+ *      [Counting Bloom filter](https://en.wikipedia.org/wiki/Counting_Bloom_filter)
+ */
+
+/* The number of bits from the hash we care about */
+#define GTK_COUNTING_BLOOM_FILTER_BITS (12)
+
+/* The necessary size of the filter */
+#define GTK_COUNTING_BLOOM_FILTER_SIZE (1 << GTK_COUNTING_BLOOM_FILTER_BITS)
+
+typedef struct _GtkCountingBloomFilter GtkCountingBloomFilter;
+
+struct _GtkCountingBloomFilter
+{
+  guint8        buckets[GTK_COUNTING_BLOOM_FILTER_SIZE];
+};
+
+#define GTK_COUNTING_BLOOM_FILTER_INIT { { 0, } }
+
+static inline void      gtk_counting_bloom_filter_add           (GtkCountingBloomFilter         *self,
+                                                                 guint32                         hash);
+static inline void      gtk_counting_bloom_filter_remove        (GtkCountingBloomFilter         *self,
+                                                                 guint32                         hash);
+static inline gboolean  gtk_counting_bloom_filter_may_contain   (const GtkCountingBloomFilter   *self,
+                                                                 guint32                         hash);
+
+static inline guint32   gtk_counting_bloom_filter_hash_pointer  (gconstpointer                   interned,
+                                                                 guint                           salt);
+
+
+/*
+ * GTK_COUNTING_BLOOM_FILTER_SALT_*:
+ *
+ * Names, IDs and style classes are all interned, so we hash the
+ * pointer or quark directly. The salt keeps the same string used
+ * as a name and as a class from hashing to the same buckets.
+ */
+#define GTK_COUNTING_BLOOM_FILTER_SALT_NAME  (0x5bd1e995u)
+#define GTK_COUNTING_BLOOM_FILTER_SALT_ID    (0x27d4eb2fu)
+#define GTK_COUNTING_BLOOM_FILTER_SALT_CLASS (0x165667b1u)
+
+static inline gsize
+gtk_counting_bloom_filter_hash1 (guint32 hash)
+{
+  return hash % GTK_COUNTING_BLOOM_FILTER_SIZE;
+}
+
+static inline gsize
+gtk_counting_bloom_filter_hash2 (guint32 hash)
+{
+  return (hash >> GTK_COUNTING_BLOOM_FILTER_BITS) % GTK_COUNTING_BLOOM_FILTER_SIZE;
+}
+
+static inline guint32
+gtk_counting_bloom_filter_hash_pointer (gconstpointer interned,
+                                        guint         salt)
+{
+  guint32 h = (guint32) GPOINTER_TO_SIZE (interned) ^ salt;
+
+  /* murmur3 finalizer, so that nearby pointers and small quarks spread out */
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+
+  return h;
+}
+
+/**
+ * gtk_counting_bloom_filter_add:
+ * @self: a #GtkCountingBloomFilter
+ * @hash: a hash value to add to the filter
+ *
+ * Adds the hash value to the filter.
+ *
+ * If the same hash value gets added multiple times, it will
+ * be considered as contained in the hash until it has been
+ * removed as many times.
+ **/
+static inline void
+gtk_counting_bloom_filter_add (GtkCountingBloomFilter *self,
+                               guint32                 hash)
+{
+  guint8 *b1, *b2;
+
+  b1 = &self->buckets[gtk_counting_bloom_filter_hash1 (hash)];
+  if (*b1 != 0xFF)
+    (*b1)++;
+
+  b2 = &self->buckets[gtk_counting_bloom_filter_hash2 (hash)];
+  if (*b2 != 0xFF)
+    (*b2)++;
+}
+
+/**
+ * gtk_counting_bloom_filter_remove:
+ * @self: a #GtkCountingBloomFilter
+ * @hash: a hash value to remove from the filter
+ *
+ * Removes a hash value from the filter that has previously
+ * been added via gtk_counting_bloom_filter_add().
+ *
+ * Buckets that overflowed stay saturated, so removing never
+ * causes false negatives.
+ **/
+static inline void
+gtk_counting_bloom_filter_remove (GtkCountingBloomFilter *self,
+                                  guint32                 hash)
+{
+  guint8 *b1, *b2;
+
+  b1 = &self->buckets[gtk_counting_bloom_filter_hash1 (hash)];
+  g_assert (*b1 > 0);
+  if (*b1 != 0xFF)
+    (*b1)--;
+
+  b2 = &self->buckets[gtk_counting_bloom_filter_hash2 (hash)];
+  g_assert (*b2 > 0);
+  if (*b2 != 0xFF)
+    (*b2)--;
+}
+
+/**
+ * gtk_counting_bloom_filter_may_contain:
+ * @self: a #GtkCountingBloomFilter
+ * @hash: the hash value to check
+ *
+ * Checks if @hash may be contained in @self.
+ *
+ * A return value of %FALSE means that @hash is definitely not part
+ * of @self.
+ *
+ * A return value of %TRUE means that @hash may or may not have been
+ * added to @self. In that case a different method must be used to
+ * confirm that @hash is indeed part of the set.
+ *
+ * Returns: %FALSE if @hash is not part of @self.
+ **/
+static inline gboolean
+gtk_counting_bloom_filter_may_contain (const GtkCountingBloomFilter *self,
+                                       guint32                       hash)
+{
+  return self->buckets[gtk_counting_bloom_filter_hash1 (hash)] != 0
+      && self->buckets[gtk_counting_bloom_filter_hash2 (hash)] != 0;
+}
+
+G_END_DECLS
+
+#endif /* __GTK_COUNTING_BLOOM_FILTER_PRIVATE_H__ */
@@ -157,19 +157,23 @@ gtk_css_animated_style_create_dynamic (GSList      *animations,
                                        GtkCssStyle *style,
                                        gint64       timestamp)
 {
+  GtkBitmask *properties;
   guint i;
 
   /* XXX: Check animations if they have dynamic values */
 
+  properties = _gtk_bitmask_new ();
   for (i = 0; i < GTK_CSS_PROPERTY_N_PROPERTIES; i++)
     {
       if (gtk_css_value_is_dynamic (gtk_css_style_get_value (style, i)))
-        {
-          animations = g_slist_append (animations, gtk_css_dynamic_new (timestamp));
-          break;
-        }
+        properties = _gtk_bitmask_set (properties, i, TRUE);
     }
 
+  if (!_gtk_bitmask_is_empty (properties))
+    animations = g_slist_append (animations, gtk_css_dynamic_new (timestamp, properties));
+
+  _gtk_bitmask_free (properties);
+
   return animations;
 }
 
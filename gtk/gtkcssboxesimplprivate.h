@@ -51,6 +51,7 @@ gtk_css_boxes_init_content_box (GtkCssBoxes *boxes,
   memset (boxes, 0, sizeof (GtkCssBoxes));
 
   boxes->style = style;
+  boxes->scale = 1;
   boxes->box[GTK_CSS_AREA_CONTENT_BOX].bounds = GRAPHENE_RECT_INIT (x, y, width, height);
   boxes->has_rect[GTK_CSS_AREA_CONTENT_BOX] = TRUE;
 }
@@ -66,6 +67,7 @@ gtk_css_boxes_init_border_box (GtkCssBoxes *boxes,
   memset (boxes, 0, sizeof (GtkCssBoxes));
 
   boxes->style = style;
+  boxes->scale = 1;
   boxes->box[GTK_CSS_AREA_BORDER_BOX].bounds = GRAPHENE_RECT_INIT (x, y, width, height);
   boxes->has_rect[GTK_CSS_AREA_BORDER_BOX] = TRUE;
 }
@@ -283,37 +285,53 @@ gtk_css_boxes_get_outline_rect (GtkCssBoxes *boxes)
   return &boxes->box[GTK_CSS_AREA_OUTLINE_BOX].bounds;
 }
 
-/* clamp border radius, following CSS specs */
+/* clamp border radius, following CSS specs
+ *
+ * The 8 floats of the corners are handled as two vectors,
+ * (top-left, top-right) and (bottom-right, bottom-left), each
+ * holding the width and height of both corners.
+ */
 static inline void
 gtk_css_boxes_clamp_border_radius (GskRoundedRect *box)
 {
-  gdouble factor = 1.0;
-  gdouble corners;
-
-  corners = box->corner[GSK_CORNER_TOP_LEFT].width + box->corner[GSK_CORNER_TOP_RIGHT].width;
-  if (corners != 0)
-    factor = MIN (factor, box->bounds.size.width / corners);
-
-  corners = box->corner[GSK_CORNER_TOP_RIGHT].height + box->corner[GSK_CORNER_BOTTOM_RIGHT].height;
-  if (corners != 0)
-    factor = MIN (factor, box->bounds.size.height / corners);
-
-  corners = box->corner[GSK_CORNER_BOTTOM_RIGHT].width + box->corner[GSK_CORNER_BOTTOM_LEFT].width;
-  if (corners != 0)
-    factor = MIN (factor, box->bounds.size.width / corners);
-
-  corners = box->corner[GSK_CORNER_TOP_LEFT].height + box->corner[GSK_CORNER_BOTTOM_LEFT].height;
-  if (corners != 0)
-    factor = MIN (factor, box->bounds.size.height / corners);
-
-  box->corner[GSK_CORNER_TOP_LEFT].width *= factor;
-  box->corner[GSK_CORNER_TOP_LEFT].height *= factor;
-  box->corner[GSK_CORNER_TOP_RIGHT].width *= factor;
-  box->corner[GSK_CORNER_TOP_RIGHT].height *= factor;
-  box->corner[GSK_CORNER_BOTTOM_RIGHT].width *= factor;
-  box->corner[GSK_CORNER_BOTTOM_RIGHT].height *= factor;
-  box->corner[GSK_CORNER_BOTTOM_LEFT].width *= factor;
-  box->corner[GSK_CORNER_BOTTOM_LEFT].height *= factor;
+  graphene_simd4f_t tl_tr, br_bl, widths, heights, sums, factors;
+  float factor, f;
+
+  tl_tr = graphene_simd4f_init_4f ((const float *) &box->corner[GSK_CORNER_TOP_LEFT]);
+  br_bl = graphene_simd4f_init_4f ((const float *) &box->corner[GSK_CORNER_BOTTOM_RIGHT]);
+
+  /* Most boxes are not rounded at all */
+  if (graphene_simd4f_is_zero4 (tl_tr) && graphene_simd4f_is_zero4 (br_bl))
+    return;
+
+  /* x: top widths, z: bottom widths */
+  widths = graphene_simd4f_max (graphene_simd4f_add (tl_tr, graphene_simd4f_shuffle_zwxy (tl_tr)),
+                                graphene_simd4f_add (br_bl, graphene_simd4f_shuffle_zwxy (br_bl)));
+  /* y: left heights, w: right heights */
+  heights = graphene_simd4f_add (tl_tr, graphene_simd4f_shuffle_zwxy (br_bl));
+  heights = graphene_simd4f_max (heights, graphene_simd4f_shuffle_zwxy (heights));
+  /* x: larger of the width sums, y: larger of the height sums */
+  sums = graphene_simd4f_merge_low (widths, graphene_simd4f_shuffle_yzwx (heights));
+
+  factors = graphene_simd4f_div (graphene_simd4f_init (box->bounds.size.width, box->bounds.size.height, 1.f, 1.f),
+                                 sums);
+
+  /* A sum of 0 gives inf or NaN, both of which fail the comparisons */
+  factor = 1.0;
+  f = graphene_simd4f_get_x (factors);
+  if (f < factor)
+    factor = f;
+  f = graphene_simd4f_get_y (factors);
+  if (f < factor)
+    factor = f;
+
+  if (factor == 1.0)
+    return;
+
+  graphene_simd4f_dup_4f (graphene_simd4f_mul (tl_tr, graphene_simd4f_splat (factor)),
+                          (float *) &box->corner[GSK_CORNER_TOP_LEFT]);
+  graphene_simd4f_dup_4f (graphene_simd4f_mul (br_bl, graphene_simd4f_splat (factor)),
+                          (float *) &box->corner[GSK_CORNER_BOTTOM_RIGHT]);
 }
 
 static inline void
@@ -338,44 +356,49 @@ gtk_css_boxes_apply_border_radius (GskRoundedRect    *box,
   gtk_css_boxes_clamp_border_radius (box);
 }
 
-/* NB: width and height must be >= 0 */
 static inline void
-gtk_css_boxes_shrink_border_radius (graphene_size_t       *dest,
-                                    const graphene_size_t *src,
-                                    double                 width,
-                                    double                 height)
+gtk_css_boxes_fixup_corner (graphene_size_t *corner)
 {
-  dest->width = src->width - width;
-  dest->height = src->height - height;
-
-  if (dest->width <= 0 || dest->height <= 0)
+  if (corner->width == 0 || corner->height == 0)
     {
-      dest->width = 0;
-      dest->height = 0;
+      corner->width = 0;
+      corner->height = 0;
     }
 }
 
+/* NB: dest must be inside of src */
 static inline void
 gtk_css_boxes_shrink_corners (GskRoundedRect       *dest,
                               const GskRoundedRect *src)
 {
-  double top = dest->bounds.origin.y - src->bounds.origin.y;
-  double right = src->bounds.origin.x + src->bounds.size.width - dest->bounds.origin.x - dest->bounds.size.width;
-  double bottom = src->bounds.origin.y + src->bounds.size.height - dest->bounds.origin.y - dest->bounds.size.height;
-  double left = dest->bounds.origin.x - src->bounds.origin.x;
-
-  gtk_css_boxes_shrink_border_radius (&dest->corner[GSK_CORNER_TOP_LEFT],
-                                      &src->corner[GSK_CORNER_TOP_LEFT],
-                                      top, left);
-  gtk_css_boxes_shrink_border_radius (&dest->corner[GSK_CORNER_TOP_RIGHT],
-                                      &src->corner[GSK_CORNER_TOP_RIGHT],
-                                      top, right);
-  gtk_css_boxes_shrink_border_radius (&dest->corner[GSK_CORNER_BOTTOM_RIGHT],
-                                      &src->corner[GSK_CORNER_BOTTOM_RIGHT],
-                                      bottom, right);
-  gtk_css_boxes_shrink_border_radius (&dest->corner[GSK_CORNER_BOTTOM_LEFT],
-                                      &src->corner[GSK_CORNER_BOTTOM_LEFT],
-                                      bottom, left);
+  float top = dest->bounds.origin.y - src->bounds.origin.y;
+  float right = src->bounds.origin.x + src->bounds.size.width - dest->bounds.origin.x - dest->bounds.size.width;
+  float bottom = src->bounds.origin.y + src->bounds.size.height - dest->bounds.origin.y - dest->bounds.size.height;
+  float left = dest->bounds.origin.x - src->bounds.origin.x;
+  const graphene_simd4f_t zero = graphene_simd4f_splat (0.f);
+  graphene_simd4f_t tl_tr, br_bl;
+
+  tl_tr = graphene_simd4f_init_4f ((const float *) &src->corner[GSK_CORNER_TOP_LEFT]);
+  br_bl = graphene_simd4f_init_4f ((const float *) &src->corner[GSK_CORNER_BOTTOM_RIGHT]);
+
+  /* Nothing to shrink if the source isn't rounded, which is the common case */
+  if (graphene_simd4f_is_zero4 (tl_tr) && graphene_simd4f_is_zero4 (br_bl))
+    {
+      memset (dest->corner, 0, sizeof (dest->corner));
+      return;
+    }
+
+  tl_tr = graphene_simd4f_sub (tl_tr, graphene_simd4f_init (top, left, top, right));
+  br_bl = graphene_simd4f_sub (br_bl, graphene_simd4f_init (bottom, right, bottom, left));
+
+  graphene_simd4f_dup_4f (graphene_simd4f_max (tl_tr, zero), (float *) &dest->corner[GSK_CORNER_TOP_LEFT]);
+  graphene_simd4f_dup_4f (graphene_simd4f_max (br_bl, zero), (float *) &dest->corner[GSK_CORNER_BOTTOM_RIGHT]);
+
+  /* A corner that shrank to nothing in one direction is gone */
+  gtk_css_boxes_fixup_corner (&dest->corner[GSK_CORNER_TOP_LEFT]);
+  gtk_css_boxes_fixup_corner (&dest->corner[GSK_CORNER_TOP_RIGHT]);
+  gtk_css_boxes_fixup_corner (&dest->corner[GSK_CORNER_BOTTOM_RIGHT]);
+  gtk_css_boxes_fixup_corner (&dest->corner[GSK_CORNER_BOTTOM_LEFT]);
 }
 
 static inline void
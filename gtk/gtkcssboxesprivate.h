@@ -50,6 +50,7 @@ struct _GtkCssBoxes
   GskRoundedRect box[GTK_CSS_AREA_N_BOXES];
   gboolean has_rect[GTK_CSS_AREA_N_BOXES]; /* TRUE if we have initialized just the bounds rect */
   gboolean has_box[GTK_CSS_AREA_N_BOXES]; /* TRUE if we have initialized the whole box */
+  int scale; /* window scale to render cached images at, 1 unless set */
 };
 
 static inline void                      gtk_css_boxes_init                      (GtkCssBoxes      *boxes,
@@ -69,32 +69,51 @@ gtk_css_value_new_from_array (GPtrArray *array)
   return result;
 }
 
+/* Adds @value to the sorted @terms, merging it with a term of the
+ * same unit if there is one. @terms must have space for one more term.
+ */
 static void
-gtk_css_calc_array_add (GPtrArray *array, GtkCssValue *value)
+gtk_css_calc_terms_add (GtkCssValue **terms,
+                        gsize        *n_terms,
+                        GtkCssValue  *value)
 {
   gsize i;
   gint calc_term_order;
 
   calc_term_order = gtk_css_number_value_get_calc_term_order (value);
 
-  for (i = 0; i < array->len; i++)
+  for (i = 0; i < *n_terms; i++)
     {
-      GtkCssValue *sum = gtk_css_number_value_try_add (g_ptr_array_index (array, i), value);
+      GtkCssValue *sum = gtk_css_number_value_try_add (terms[i], value);
 
       if (sum)
         {
-          g_ptr_array_index (array, i) = sum;
+          _gtk_css_value_unref (terms[i]);
+          terms[i] = sum;
           _gtk_css_value_unref (value);
           return;
         }
-      else if (gtk_css_number_value_get_calc_term_order (g_ptr_array_index (array, i)) > calc_term_order)
+      else if (gtk_css_number_value_get_calc_term_order (terms[i]) > calc_term_order)
         {
-          g_ptr_array_insert (array, i, value);
+          memmove (&terms[i + 1], &terms[i], (*n_terms - i) * sizeof (GtkCssValue *));
+          terms[i] = value;
+          (*n_terms)++;
           return;
         }
     }
 
-  g_ptr_array_add (array, value);
+  terms[i] = value;
+  (*n_terms)++;
+}
+
+static void
+gtk_css_calc_array_add (GPtrArray *array, GtkCssValue *value)
+{
+  gsize n_terms = array->len;
+
+  g_ptr_array_set_size (array, n_terms + 1);
+  gtk_css_calc_terms_add ((GtkCssValue **) array->pdata, &n_terms, value);
+  g_ptr_array_set_size (array, n_terms);
 }
 
 static GtkCssValue *
@@ -104,34 +123,55 @@ gtk_css_value_calc_compute (GtkCssValue      *value,
                             GtkCssStyle      *style,
                             GtkCssStyle      *parent_style)
 {
+  GtkCssValue *stack_terms[8];
+  GtkCssValue **computed, **terms;
   GtkCssValue *result;
-  GPtrArray *array;
   gboolean changed = FALSE;
-  gsize i;
+  gsize i, n_terms;
+
+  /* This runs for every style using the value, so avoid allocating
+   * anything unless the result differs from @value. */
+  if (value->n_terms <= G_N_ELEMENTS (stack_terms) / 2)
+    computed = stack_terms;
+  else
+    computed = g_new (GtkCssValue *, 2 * value->n_terms);
+  terms = computed + value->n_terms;
 
-  array = g_ptr_array_new ();
   for (i = 0; i < value->n_terms; i++)
     {
-      GtkCssValue *computed = _gtk_css_value_compute (value->terms[i], property_id, provider, style, parent_style);
-      changed |= computed != value->terms[i];
-      gtk_css_calc_array_add (array, computed);
+      computed[i] = _gtk_css_value_compute (value->terms[i], property_id, provider, style, parent_style);
+      changed |= computed[i] != value->terms[i];
     }
 
   if (changed)
     {
-      result = gtk_css_value_new_from_array (array);
+      n_terms = 0;
+      for (i = 0; i < value->n_terms; i++)
+        gtk_css_calc_terms_add (terms, &n_terms, computed[i]);
+
+      if (n_terms > 1)
+        {
+          result = gtk_css_calc_value_new (n_terms);
+          memcpy (result->terms, terms, n_terms * sizeof (GtkCssValue *));
+        }
+      else
+        {
+          result = terms[0];
+        }
     }
   else
     {
-      g_ptr_array_set_free_func (array, (GDestroyNotify) _gtk_css_value_unref);
-      g_ptr_array_free (array, TRUE);
+      for (i = 0; i < value->n_terms; i++)
+        _gtk_css_value_unref (computed[i]);
       result = _gtk_css_value_ref (value);
     }
 
+  if (computed != stack_terms)
+    g_free (computed);
+
   return result;
 }
 
-
 static gboolean
 gtk_css_value_calc_equal (const GtkCssValue *value1,
                           const GtkCssValue *value2)
@@ -167,6 +167,15 @@ gtk_css_value_dimension_equal (const GtkCssValue *number1,
          number1->value == number2->value;
 }
 
+static guint
+gtk_css_value_dimension_hash (const GtkCssValue *number)
+{
+  /* -0 and 0 are equal, so they must hash the same */
+  double value = number->value == 0 ? 0 : number->value;
+
+  return g_double_hash (&value) ^ (number->unit << 24);
+}
+
 static void
 gtk_css_value_dimension_print (const GtkCssValue *number,
                             GString           *string)
@@ -278,7 +287,8 @@ static const GtkCssNumberValueClass GTK_CSS_VALUE_DIMENSION = {
     gtk_css_number_value_transition,
     NULL,
     NULL,
-    gtk_css_value_dimension_print
+    gtk_css_value_dimension_print,
+    gtk_css_value_dimension_hash
   },
   gtk_css_value_dimension_get,
   gtk_css_value_dimension_get_dimension,
@@ -322,6 +332,6 @@ gtk_css_dimension_value_new (double     value,
   result->unit = unit;
   result->value = value;
 
-  return result;
+  return gtk_css_value_intern (result);
 }
 
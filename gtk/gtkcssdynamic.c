@@ -29,7 +29,9 @@ static GtkStyleAnimation *
 gtk_css_dynamic_advance (GtkStyleAnimation    *style_animation,
                          gint64                timestamp)
 {
-  return gtk_css_dynamic_new (timestamp);
+  GtkCssDynamic *dynamic = GTK_CSS_DYNAMIC (style_animation);
+
+  return gtk_css_dynamic_new (timestamp, dynamic->properties);
 }
 
 static void
@@ -39,10 +41,10 @@ gtk_css_dynamic_apply_values (GtkStyleAnimation    *style_animation,
   GtkCssDynamic *dynamic = GTK_CSS_DYNAMIC (style_animation);
   guint i;
 
-  for (i = 0; i < GTK_CSS_PROPERTY_N_PROPERTIES; i++)
+  _gtk_bitmask_foreach (dynamic->properties, i)
     {
       GtkCssValue *value, *dynamic_value;
-      
+
       value = gtk_css_style_get_value (GTK_CSS_STYLE (style), i);
       dynamic_value = gtk_css_value_get_dynamic_value (value, dynamic->timestamp);
       if (value != dynamic_value)
@@ -63,11 +65,24 @@ gtk_css_dynamic_is_static (GtkStyleAnimation *style_animation)
   return FALSE;
 }
 
+static void
+gtk_css_dynamic_finalize (GObject *object)
+{
+  GtkCssDynamic *dynamic = GTK_CSS_DYNAMIC (object);
+
+  _gtk_bitmask_free (dynamic->properties);
+
+  G_OBJECT_CLASS (gtk_css_dynamic_parent_class)->finalize (object);
+}
+
 static void
 gtk_css_dynamic_class_init (GtkCssDynamicClass *klass)
 {
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
   GtkStyleAnimationClass *animation_class = GTK_STYLE_ANIMATION_CLASS (klass);
 
+  object_class->finalize = gtk_css_dynamic_finalize;
+
   animation_class->advance = gtk_css_dynamic_advance;
   animation_class->apply_values = gtk_css_dynamic_apply_values;
   animation_class->is_finished = gtk_css_dynamic_is_finished;
@@ -79,14 +94,18 @@ gtk_css_dynamic_init (GtkCssDynamic *dynamic)
 {
 }
 
+/* @properties are the ids of the properties that have dynamic values,
+ * only those get updated when advancing. */
 GtkStyleAnimation *
-gtk_css_dynamic_new (gint64 timestamp)
+gtk_css_dynamic_new (gint64            timestamp,
+                     const GtkBitmask *properties)
 {
   GtkCssDynamic *dynamic;
 
   dynamic = g_object_new (GTK_TYPE_CSS_DYNAMIC, NULL);
 
   dynamic->timestamp = timestamp;
+  dynamic->properties = _gtk_bitmask_copy (properties);
 
   return GTK_STYLE_ANIMATION (dynamic);
 }
@@ -22,6 +22,7 @@
 
 #include "gtkstyleanimationprivate.h"
 
+#include "gtkbitmaskprivate.h"
 #include "gtkprogresstrackerprivate.h"
 
 G_BEGIN_DECLS
@@ -41,6 +42,7 @@ struct _GtkCssDynamic
   GtkStyleAnimation   parent;
 
   gint64              timestamp;
+  GtkBitmask         *properties;       /* ids of the properties with dynamic values */
 };
 
 struct _GtkCssDynamicClass
@@ -50,7 +52,8 @@ struct _GtkCssDynamicClass
 
 GType                   gtk_css_dynamic_get_type        (void) G_GNUC_CONST;
 
-GtkStyleAnimation *     gtk_css_dynamic_new             (gint64 timestamp);
+GtkStyleAnimation *     gtk_css_dynamic_new             (gint64                  timestamp,
+                                                         const GtkBitmask       *properties);
 
 G_END_DECLS
 
@@ -21,8 +21,10 @@
 
 #include "gtkcssimageprivate.h"
 
+#include "gtkcssstatsprivate.h"
 #include "gtkcssstyleprivate.h"
-#include "gtksnapshot.h"
+#include "gtkrendernodecacheprivate.h"
+#include "gtksnapshotprivate.h"
 
 /* for the types only */
 #include "gtk/gtkcssimagecrossfadeprivate.h"
@@ -264,6 +266,23 @@ _gtk_css_image_draw (GtkCssImage        *image,
   cairo_restore (cr);
 }
 
+/* Gradients, cross-fades and recolored images are costly to create
+ * and to render, and the same ones get drawn at the same sizes all
+ * over the place. So keep the nodes for them, which also lets the
+ * renderers reuse whatever they cached for those nodes.
+ */
+static GtkRenderNodeCache image_cache;
+
+static gboolean
+gtk_css_image_should_cache (GtkCssImage *image)
+{
+  return (GTK_IS_CSS_IMAGE_LINEAR (image) ||
+          GTK_IS_CSS_IMAGE_RADIAL (image) ||
+          GTK_IS_CSS_IMAGE_CROSS_FADE (image) ||
+          GTK_IS_CSS_IMAGE_RECOLOR (image)) &&
+         !gtk_css_image_is_dynamic (image);
+}
+
 void
 gtk_css_image_snapshot (GtkCssImage *image,
                         GtkSnapshot *snapshot,
@@ -271,6 +290,8 @@ gtk_css_image_snapshot (GtkCssImage *image,
                         double       height)
 {
   GtkCssImageClass *klass;
+  graphene_rect_t bounds;
+  GskRenderNode *node;
 
   g_return_if_fail (GTK_IS_CSS_IMAGE (image));
   g_return_if_fail (snapshot != NULL);
@@ -279,7 +300,61 @@ gtk_css_image_snapshot (GtkCssImage *image,
 
   klass = GTK_CSS_IMAGE_GET_CLASS (image);
 
-  klass->snapshot (image, snapshot, width, height);
+  if (!gtk_css_image_should_cache (image))
+    {
+      klass->snapshot (image, snapshot, width, height);
+      return;
+    }
+
+  graphene_rect_init (&bounds, 0, 0, width, height);
+
+  gtk_css_stats.image_cache_lookups++;
+
+  if (gtk_render_node_cache_lookup (&image_cache, image, &bounds, &node))
+    {
+      gtk_css_stats.image_cache_hits++;
+    }
+  else
+    {
+      gtk_snapshot_push_collect (snapshot);
+      klass->snapshot (image, snapshot, width, height);
+      node = gtk_snapshot_pop_collect (snapshot);
+
+      gtk_render_node_cache_insert (&image_cache, image, &bounds, node);
+      if (node)
+        gsk_render_node_unref (node);
+    }
+
+  if (node)
+    gtk_snapshot_append_node (snapshot, node);
+}
+
+/**
+ * gtk_css_image_get_n_cached:
+ *
+ * Returns the number of image nodes kept by gtk_css_image_snapshot(),
+ * for display in the inspector.
+ *
+ * Returns: the number of cached nodes
+ **/
+guint
+gtk_css_image_get_n_cached (void)
+{
+  return image_cache.n_entries;
+}
+
+/**
+ * gtk_css_image_get_cache_cost:
+ *
+ * Returns the estimated memory kept alive by the nodes that
+ * gtk_css_image_snapshot() cached, for display in the inspector.
+ *
+ * Returns: the estimate in bytes
+ **/
+gsize
+gtk_css_image_get_cache_cost (void)
+{
+  return image_cache.cost;
 }
 
 gboolean
@@ -119,6 +119,8 @@ void           gtk_css_image_snapshot              (GtkCssImage                *
                                                     GtkSnapshot                *snapshot,
                                                     double                      width,
                                                     double                      height);
+guint          gtk_css_image_get_n_cached          (void);
+gsize          gtk_css_image_get_cache_cost        (void);
 gboolean       gtk_css_image_is_invalid            (GtkCssImage                *image);
 gboolean       gtk_css_image_is_dynamic            (GtkCssImage                *image);
 GtkCssImage *  gtk_css_image_get_dynamic_image     (GtkCssImage                *image,
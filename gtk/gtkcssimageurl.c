@@ -23,63 +23,302 @@
 
 #include "gtkcssimageurlprivate.h"
 
+#include "gtkcssarrayvalueprivate.h"
 #include "gtkcssimageinvalidprivate.h"
 #include "gtkcssimagepaintableprivate.h"
+#include "gtkcssimagevalueprivate.h"
+#include "gtkcssnodeprivate.h"
+#include "gtkcssstylepropertyprivate.h"
+#include "gtkcsswidgetnodeprivate.h"
 #include "gtkstyleproviderprivate.h"
+#include "gtkwidgetprivate.h"
+#include "gtkwindow.h"
+
+/*
+ * Images are loaded and decoded in a worker thread, the first time a
+ * style uses them. Until then the image draws nothing and has no size.
+ * When it is ready, the widgets whose style uses it are redrawn, or
+ * resized for icons.
+ *
+ * The computed value is the url image itself, so styles don't change
+ * when the image arrives and cached styles stay valid.
+ *
+ * Decoded images are shared by all url images with the same uri, so
+ * providers that use the same file, or reloading a theme, don't decode
+ * it again.
+ */
 
 G_DEFINE_TYPE (GtkCssImageUrl, _gtk_css_image_url, GTK_TYPE_CSS_IMAGE)
 
-static GtkCssImage *
-gtk_css_image_url_load_image (GtkCssImageUrl  *url,
-                              GError         **error)
+/* uri => GtkCssImage, the decoded images that are alive */
+static GHashTable *loaded_images;
+/* uri => GPtrArray of GtkCssImageUrl waiting for the image */
+static GHashTable *pending_loads;
+
+typedef struct {
+  GFile *file;
+  GtkStyleProvider *provider;
+  GtkCssSection *section;
+} LoadData;
+
+static void
+load_data_free (gpointer data)
 {
-  GdkTexture *texture;
-  GError *local_error = NULL;
+  LoadData *load = data;
 
-  if (url->loaded_image)
-    return url->loaded_image;
+  g_object_unref (load->file);
+  g_clear_object (&load->provider);
+  g_clear_pointer (&load->section, gtk_css_section_unref);
+
+  g_slice_free (LoadData, load);
+}
+
+static GdkTexture *
+load_texture (GFile   *file,
+              GError **error)
+{
+  GdkTexture *texture;
 
   /* We special case resources here so we can use
      gdk_pixbuf_new_from_resource, which in turn has some special casing
      for GdkPixdata files to avoid duplicating the memory for the pixbufs */
-  if (g_file_has_uri_scheme (url->file, "resource"))
+  if (g_file_has_uri_scheme (file, "resource"))
     {
-      char *uri = g_file_get_uri (url->file);
+      char *uri = g_file_get_uri (file);
       char *resource_path = g_uri_unescape_string (uri + strlen ("resource://"), NULL);
 
       texture = gdk_texture_new_from_resource (resource_path);
+      if (texture == NULL)
+        g_set_error_literal (error, G_IO_ERROR, G_IO_ERROR_NOT_FOUND, "Resource not found");
 
       g_free (resource_path);
       g_free (uri);
     }
   else
     {
-      texture = gdk_texture_new_from_file (url->file, &local_error);
+      texture = gdk_texture_new_from_file (file, error);
     }
 
-  if (texture == NULL)
+  return texture;
+}
+
+static void
+load_texture_in_thread (GTask        *task,
+                        gpointer      source_object,
+                        gpointer      task_data,
+                        GCancellable *cancellable)
+{
+  LoadData *load = task_data;
+  GdkTexture *texture;
+  GError *error = NULL;
+
+  texture = load_texture (load->file, &error);
+  if (texture)
+    g_task_return_pointer (task, texture, g_object_unref);
+  else
+    g_task_return_error (task, error);
+}
+
+static void
+forget_loaded_image (gpointer  key,
+                     GObject  *image)
+{
+  g_hash_table_remove (loaded_images, key);
+}
+
+static gboolean
+url_images_contain (GPtrArray   *urls,
+                    GtkCssImage *image)
+{
+  guint i;
+
+  for (i = 0; i < urls->len; i++)
+    {
+      if (g_ptr_array_index (urls, i) == image)
+        return TRUE;
+    }
+
+  return FALSE;
+}
+
+static gboolean
+value_uses_url_images (GtkCssValue *value,
+                       GPtrArray   *urls)
+{
+  GtkCssImage *image;
+
+  image = _gtk_css_image_value_get_image (value);
+
+  return image != NULL && url_images_contain (urls, image);
+}
+
+static void
+gtk_css_node_update_url_images (GtkCssNode *node,
+                                GtkWidget  *widget,
+                                GPtrArray  *urls)
+{
+  GtkCssStyle *style;
+  GtkCssValue *value;
+  GtkCssNode *child;
+  guint i;
+
+  if (GTK_IS_CSS_WIDGET_NODE (node))
+    widget = gtk_css_widget_node_get_widget (GTK_CSS_WIDGET_NODE (node));
+
+  style = gtk_css_node_get_style (node);
+  if (widget && style)
     {
-      if (error)
+      if (value_uses_url_images (gtk_css_style_get_value (style, GTK_CSS_PROPERTY_ICON_SOURCE), urls))
         {
-          char *uri;
-
-          uri = g_file_get_uri (url->file);
-          g_set_error (error,
-                       GTK_CSS_PROVIDER_ERROR,
-                       GTK_CSS_PROVIDER_ERROR_FAILED,
-                       "Error loading image '%s': %s", uri, local_error->message);
-          g_free (uri);
-       }
-      
-      url->loaded_image = gtk_css_image_invalid_new ();
+          gtk_widget_queue_resize (widget);
+        }
+      else
+        {
+          value = gtk_css_style_get_value (style, GTK_CSS_PROPERTY_BACKGROUND_IMAGE);
+          for (i = 0; i < _gtk_css_array_value_get_n_values (value); i++)
+            {
+              if (value_uses_url_images (_gtk_css_array_value_get_nth (value, i), urls))
+                break;
+            }
+
+          if (i < _gtk_css_array_value_get_n_values (value) ||
+              value_uses_url_images (gtk_css_style_get_value (style, GTK_CSS_PROPERTY_BORDER_IMAGE_SOURCE), urls))
+            gtk_widget_queue_draw (widget);
+        }
     }
-  else
+
+  for (child = gtk_css_node_get_first_child (node);
+       child;
+       child = gtk_css_node_get_next_sibling (child))
+    gtk_css_node_update_url_images (child, widget, urls);
+}
+
+static void
+gtk_css_image_url_load_done (GObject      *source,
+                             GAsyncResult *result,
+                             gpointer      user_data)
+{
+  char *uri = user_data;
+  LoadData *load = g_task_get_task_data (G_TASK (result));
+  GtkCssImage *image;
+  GdkTexture *texture;
+  GError *error = NULL;
+  GPtrArray *urls;
+  GList *toplevels, *l;
+  char *key;
+  guint i;
+
+  texture = g_task_propagate_pointer (G_TASK (result), &error);
+  if (texture)
     {
-      url->loaded_image = gtk_css_image_paintable_new (GDK_PAINTABLE (texture), GDK_PAINTABLE (texture));
+      image = gtk_css_image_paintable_new (GDK_PAINTABLE (texture), GDK_PAINTABLE (texture));
       g_object_unref (texture);
+
+      /* The table doesn't keep the image alive, url images do */
+      if (loaded_images == NULL)
+        loaded_images = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+      key = g_strdup (uri);
+      g_hash_table_insert (loaded_images, key, image);
+      g_object_weak_ref (G_OBJECT (image), forget_loaded_image, key);
+    }
+  else
+    {
+      if (load->provider)
+        {
+          GError *css_error;
+
+          css_error = g_error_new (GTK_CSS_PROVIDER_ERROR,
+                                   GTK_CSS_PROVIDER_ERROR_FAILED,
+                                   "Error loading image '%s': %s", uri, error->message);
+          gtk_style_provider_emit_error (load->provider, load->section, css_error);
+          g_error_free (css_error);
+        }
+      g_error_free (error);
+
+      image = gtk_css_image_invalid_new ();
+    }
+
+  urls = g_hash_table_lookup (pending_loads, uri);
+  g_hash_table_remove (pending_loads, uri);
+
+  for (i = 0; i < urls->len; i++)
+    {
+      GtkCssImageUrl *url = g_ptr_array_index (urls, i);
+
+      url->loaded_image = g_object_ref (image);
+      url->loading = FALSE;
+    }
+
+  toplevels = gtk_window_list_toplevels ();
+  for (l = toplevels; l; l = l->next)
+    gtk_css_node_update_url_images (gtk_widget_get_css_node (l->data), NULL, urls);
+  g_list_free (toplevels);
+
+  g_ptr_array_unref (urls);
+  g_object_unref (image);
+  g_free (uri);
+}
+
+static void
+gtk_css_image_url_start_load (GtkCssImageUrl   *url,
+                              GtkStyleProvider *provider,
+                              GtkCssSection    *section)
+{
+  GtkCssImage *image;
+  GPtrArray *urls;
+  LoadData *load;
+  GTask *task;
+  char *uri;
+
+  if (url->loaded_image || url->loading)
+    return;
+
+  uri = g_file_get_uri (url->file);
+
+  image = loaded_images ? g_hash_table_lookup (loaded_images, uri) : NULL;
+  if (image)
+    {
+      url->loaded_image = g_object_ref (image);
+      g_free (uri);
+      return;
     }
 
-  g_clear_error (&local_error);
+  url->loading = TRUE;
+
+  if (pending_loads == NULL)
+    pending_loads = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+
+  urls = g_hash_table_lookup (pending_loads, uri);
+  if (urls)
+    {
+      g_ptr_array_add (urls, g_object_ref (url));
+      g_free (uri);
+      return;
+    }
+
+  urls = g_ptr_array_new_with_free_func (g_object_unref);
+  g_ptr_array_add (urls, g_object_ref (url));
+  g_hash_table_insert (pending_loads, uri, urls);
+
+  load = g_slice_new0 (LoadData);
+  load->file = g_object_ref (url->file);
+  if (provider)
+    load->provider = g_object_ref (provider);
+  if (section)
+    load->section = gtk_css_section_ref (section);
+
+  task = g_task_new (NULL, NULL, gtk_css_image_url_load_done, g_strdup (uri));
+  g_task_set_source_tag (task, gtk_css_image_url_start_load);
+  g_task_set_task_data (task, load, load_data_free);
+  g_task_run_in_thread (task, load_texture_in_thread);
+  g_object_unref (task);
+}
+
+/* Returns the image to draw, or %NULL if it is still loading */
+static GtkCssImage *
+gtk_css_image_url_get_image (GtkCssImageUrl *url)
+{
+  gtk_css_image_url_start_load (url, NULL, NULL);
 
   return url->loaded_image;
 }
@@ -87,25 +326,34 @@ gtk_css_image_url_load_image (GtkCssImageUrl  *url,
 static int
 gtk_css_image_url_get_width (GtkCssImage *image)
 {
-  GtkCssImageUrl *url = GTK_CSS_IMAGE_URL (image);
+  GtkCssImage *loaded = gtk_css_image_url_get_image (GTK_CSS_IMAGE_URL (image));
 
-  return _gtk_css_image_get_width (gtk_css_image_url_load_image (url, NULL));
+  if (loaded == NULL)
+    return 0;
+
+  return _gtk_css_image_get_width (loaded);
 }
 
 static int
 gtk_css_image_url_get_height (GtkCssImage *image)
 {
-  GtkCssImageUrl *url = GTK_CSS_IMAGE_URL (image);
+  GtkCssImage *loaded = gtk_css_image_url_get_image (GTK_CSS_IMAGE_URL (image));
 
-  return _gtk_css_image_get_height (gtk_css_image_url_load_image (url, NULL));
+  if (loaded == NULL)
+    return 0;
+
+  return _gtk_css_image_get_height (loaded);
 }
 
 static double
 gtk_css_image_url_get_aspect_ratio (GtkCssImage *image)
 {
-  GtkCssImageUrl *url = GTK_CSS_IMAGE_URL (image);
+  GtkCssImage *loaded = gtk_css_image_url_get_image (GTK_CSS_IMAGE_URL (image));
 
-  return _gtk_css_image_get_aspect_ratio (gtk_css_image_url_load_image (url, NULL));
+  if (loaded == NULL)
+    return 0;
+
+  return _gtk_css_image_get_aspect_ratio (loaded);
 }
 
 static void
@@ -114,9 +362,12 @@ gtk_css_image_url_snapshot (GtkCssImage *image,
                             double       width,
                             double       height)
 {
-  GtkCssImageUrl *url = GTK_CSS_IMAGE_URL (image);
+  GtkCssImage *loaded = gtk_css_image_url_get_image (GTK_CSS_IMAGE_URL (image));
+
+  if (loaded == NULL)
+    return;
 
-  gtk_css_image_snapshot (gtk_css_image_url_load_image (url, NULL), snapshot, width, height);
+  gtk_css_image_snapshot (loaded, snapshot, width, height);
 }
 
 static GtkCssImage *
@@ -127,18 +378,10 @@ gtk_css_image_url_compute (GtkCssImage      *image,
                            GtkCssStyle      *parent_style)
 {
   GtkCssImageUrl *url = GTK_CSS_IMAGE_URL (image);
-  GtkCssImage *copy;
-  GError *error = NULL;
 
-  copy = gtk_css_image_url_load_image (url, &error);
-  if (error)
-    {
-      GtkCssSection *section = gtk_css_style_get_section (style, property_id);
-      gtk_style_provider_emit_error (provider, section, error);
-      g_error_free (error);
-    }
+  gtk_css_image_url_start_load (url, provider, gtk_css_style_get_section (style, property_id));
 
-  return g_object_ref (copy);
+  return g_object_ref (image);
 }
 
 static gboolean
@@ -156,7 +399,11 @@ gtk_css_image_url_is_invalid (GtkCssImage *image)
 {
   GtkCssImageUrl *url = GTK_CSS_IMAGE_URL (image);
 
-  return gtk_css_image_is_invalid (gtk_css_image_url_load_image (url, NULL));
+  /* Until it is loaded, we assume it works out */
+  if (url->loaded_image == NULL)
+    return FALSE;
+
+  return gtk_css_image_is_invalid (url->loaded_image);
 }
 
 static gboolean
@@ -177,8 +424,13 @@ gtk_css_image_url_print (GtkCssImage *image,
                          GString     *string)
 {
   GtkCssImageUrl *url = GTK_CSS_IMAGE_URL (image);
+  char *uri;
 
-  _gtk_css_image_print (gtk_css_image_url_load_image (url, NULL), string);
+  uri = g_file_get_uri (url->file);
+  g_string_append (string, "url(");
+  _gtk_css_print_string (string, uri);
+  g_string_append (string, ")");
+  g_free (uri);
 }
 
 static void
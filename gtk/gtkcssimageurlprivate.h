@@ -39,7 +39,8 @@ struct _GtkCssImageUrl
   GtkCssImage parent;
 
   GFile           *file;                /* the file we're loading from */
-  GtkCssImage     *loaded_image;        /* the actual image we render */
+  GtkCssImage     *loaded_image;        /* the actual image we render, NULL while loading */
+  guint            loading : 1;         /* a worker thread is loading the file */
 };
 
 struct _GtkCssImageUrlClass
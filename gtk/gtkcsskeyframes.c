@@ -27,6 +27,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* Resolved keyframes keep the values they computed at this many evenly
+ * spaced points of the timeline, so that running animations look them
+ * up instead of creating new values every frame. That is fine enough
+ * to not be visible: a full turn is off by less than a fifth of a degree. */
+#define N_SAMPLES 1024
+
 struct _GtkCssKeyframes {
   int ref_count;                /* ref count */
   int n_keyframes;              /* number of keyframes (at least 2 for 0% and 100% */
@@ -34,10 +40,29 @@ struct _GtkCssKeyframes {
   int n_properties;             /* number of properties used by keyframes */
   guint *property_ids;          /* ordered array of n_properties property ids */
   GtkCssValue **values;         /* 2D array: n_keyframes * n_properties of (value or NULL) for all the keyframes */
+
+  /* resolved keyframes only */
+  GtkCssValue **samples;        /* 2D array: n_properties * N_SAMPLES of (value or NULL), filled on demand */
+
+  /* unresolved keyframes only: the last result of _gtk_css_keyframes_compute(),
+   * which is shared by all nodes with the same style, like rows of a list */
+  GtkCssKeyframes *resolved;
+  GtkStyleProvider *resolved_provider;
+  GtkCssStyle *resolved_style;
+  GtkCssStyle *resolved_parent_style;
 };
 
 #define KEYFRAMES_VALUE(keyframes, k, p) ((keyframes)->values[(k) * (keyframes)->n_properties + (p)])
 
+static void
+gtk_css_keyframes_clear_resolved (GtkCssKeyframes *keyframes)
+{
+  g_clear_pointer (&keyframes->resolved, _gtk_css_keyframes_unref);
+  keyframes->resolved_provider = NULL;
+  g_clear_object (&keyframes->resolved_style);
+  g_clear_object (&keyframes->resolved_parent_style);
+}
+
 GtkCssKeyframes *
 _gtk_css_keyframes_ref (GtkCssKeyframes *keyframes)
 {
@@ -72,6 +97,18 @@ _gtk_css_keyframes_unref (GtkCssKeyframes *keyframes)
     }
   g_free (keyframes->values);
 
+  if (keyframes->samples)
+    {
+      for (k = 0; k < keyframes->n_properties * N_SAMPLES; k++)
+        {
+          if (keyframes->samples[k])
+            _gtk_css_value_unref (keyframes->samples[k]);
+        }
+      g_free (keyframes->samples);
+    }
+
+  gtk_css_keyframes_clear_resolved (keyframes);
+
   g_slice_free (GtkCssKeyframes, keyframes);
 }
 
@@ -448,6 +485,12 @@ _gtk_css_keyframes_compute (GtkCssKeyframes  *keyframes,
   g_return_val_if_fail (GTK_IS_CSS_STYLE (style), NULL);
   g_return_val_if_fail (parent_style == NULL || GTK_IS_CSS_STYLE (parent_style), NULL);
 
+  if (keyframes->resolved &&
+      keyframes->resolved_provider == provider &&
+      keyframes->resolved_style == style &&
+      keyframes->resolved_parent_style == parent_style)
+    return _gtk_css_keyframes_ref (keyframes->resolved);
+
   resolved = gtk_css_keyframes_alloc ();
   resolved->n_keyframes = keyframes->n_keyframes;
   resolved->keyframe_progress = g_memdup (keyframes->keyframe_progress, keyframes->n_keyframes * sizeof (double));
@@ -470,6 +513,14 @@ _gtk_css_keyframes_compute (GtkCssKeyframes  *keyframes,
         }
     }
 
+  /* The provider owns @keyframes, so it doesn't need a ref */
+  gtk_css_keyframes_clear_resolved (keyframes);
+  keyframes->resolved = _gtk_css_keyframes_ref (resolved);
+  keyframes->resolved_provider = provider;
+  keyframes->resolved_style = g_object_ref (style);
+  if (parent_style)
+    keyframes->resolved_parent_style = g_object_ref (parent_style);
+
   return resolved;
 }
 
@@ -491,19 +542,16 @@ _gtk_css_keyframes_get_property_id (GtkCssKeyframes *keyframes,
   return keyframes->property_ids[id];
 }
 
-GtkCssValue *
-_gtk_css_keyframes_get_value (GtkCssKeyframes *keyframes,
-                              guint            id,
-                              double           progress,
-                              GtkCssValue     *default_value)
+static GtkCssValue *
+gtk_css_keyframes_interpolate (GtkCssKeyframes *keyframes,
+                               guint            id,
+                               double           progress,
+                               GtkCssValue     *default_value)
 {
   GtkCssValue *start_value, *end_value, *result;
   double start_progress, end_progress;
   guint k;
 
-  g_return_val_if_fail (keyframes != NULL, 0);
-  g_return_val_if_fail (id < keyframes->n_properties, 0);
-
   start_value = default_value;
   start_progress = 0.0;
   end_value = default_value;
@@ -545,3 +593,37 @@ _gtk_css_keyframes_get_value (GtkCssKeyframes *keyframes,
   return result;
 }
 
+GtkCssValue *
+_gtk_css_keyframes_get_value (GtkCssKeyframes *keyframes,
+                              guint            id,
+                              double           progress,
+                              GtkCssValue     *default_value)
+{
+  GtkCssValue **samples;
+  guint sample;
+
+  g_return_val_if_fail (keyframes != NULL, 0);
+  g_return_val_if_fail (id < keyframes->n_properties, 0);
+
+  /* Only values that don't depend on @default_value can be kept.
+   * Easing functions can also overshoot, those values aren't kept either. */
+  if (progress < 0.0 || progress > 1.0 ||
+      KEYFRAMES_VALUE (keyframes, 0, id) == NULL ||
+      KEYFRAMES_VALUE (keyframes, keyframes->n_keyframes - 1, id) == NULL)
+    return gtk_css_keyframes_interpolate (keyframes, id, progress, default_value);
+
+  if (keyframes->samples == NULL)
+    keyframes->samples = g_new0 (GtkCssValue *, keyframes->n_properties * N_SAMPLES);
+
+  samples = &keyframes->samples[id * N_SAMPLES];
+  sample = (guint) (progress * (N_SAMPLES - 1) + 0.5);
+
+  if (samples[sample] == NULL)
+    samples[sample] = gtk_css_keyframes_interpolate (keyframes,
+                                                     id,
+                                                     (double) sample / (N_SAMPLES - 1),
+                                                     default_value);
+
+  return _gtk_css_value_ref (samples[sample]);
+}
+
@@ -47,15 +47,6 @@ _gtk_css_lookup_destroy (GtkCssLookup *lookup)
   _gtk_bitmask_free (lookup->missing);
 }
 
-gboolean
-_gtk_css_lookup_is_missing (const GtkCssLookup *lookup,
-                            guint               id)
-{
-  gtk_internal_return_val_if_fail (lookup != NULL, FALSE);
-
-  return _gtk_bitmask_get (lookup->missing, id);
-}
-
 /**
  * _gtk_css_lookup_set:
  * @lookup: the lookup
@@ -43,8 +43,9 @@ void                    _gtk_css_lookup_init                    (GtkCssLookup
 void                    _gtk_css_lookup_destroy                 (GtkCssLookup               *lookup);
 
 static inline const GtkBitmask *_gtk_css_lookup_get_missing     (const GtkCssLookup         *lookup);
-gboolean                _gtk_css_lookup_is_missing              (const GtkCssLookup         *lookup,
+static inline gboolean  _gtk_css_lookup_is_missing              (const GtkCssLookup         *lookup,
                                                                  guint                       id);
+static inline gboolean  _gtk_css_lookup_is_done                 (const GtkCssLookup         *lookup);
 void                    _gtk_css_lookup_set                     (GtkCssLookup               *lookup,
                                                                  guint                       id,
                                                                  GtkCssSection              *section,
@@ -60,6 +61,20 @@ _gtk_css_lookup_get_missing (const GtkCssLookup *lookup)
   return lookup->missing;
 }
 
+static inline gboolean
+_gtk_css_lookup_is_missing (const GtkCssLookup *lookup,
+                            guint               id)
+{
+  return _gtk_bitmask_get (lookup->missing, id);
+}
+
+/* Whether all properties are set, so lower priority rules don't matter */
+static inline gboolean
+_gtk_css_lookup_is_done (const GtkCssLookup *lookup)
+{
+  return _gtk_bitmask_is_empty (lookup->missing);
+}
+
 
 
 G_END_DECLS
@@ -186,6 +186,14 @@ _gtk_css_matcher_init (GtkCssMatcher               *matcher,
   return TRUE;
 }
 
+/* Whether @matcher finds the ancestors in a widget path instead of
+ * walking up the node tree */
+gboolean
+_gtk_css_matcher_is_widget_path (const GtkCssMatcher *matcher)
+{
+  return matcher->klass == &GTK_CSS_MATCHER_WIDGET_PATH;
+}
+
 /* GTK_CSS_MATCHER_NODE */
 
 static gboolean
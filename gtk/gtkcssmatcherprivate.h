@@ -85,6 +85,8 @@ void              _gtk_css_matcher_superset_init  (GtkCssMatcher          *match
                                                    const GtkCssMatcher    *subset,
                                                    GtkCssChange            relevant);
 
+gboolean          _gtk_css_matcher_is_widget_path (const GtkCssMatcher    *matcher);
+
 
 static inline gboolean
 _gtk_css_matcher_get_parent (GtkCssMatcher       *matcher,
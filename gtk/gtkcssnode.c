@@ -20,8 +20,12 @@
 #include "gtkcssnodeprivate.h"
 
 #include "gtkcssanimatedstyleprivate.h"
+#include "gtkcssmatcherprivate.h"
 #include "gtkcsssectionprivate.h"
+#include "gtkcssstaticstyleprivate.h"
+#include "gtkcssstatsprivate.h"
 #include "gtkcssstylepropertyprivate.h"
+#include "gtkdebug.h"
 #include "gtkintl.h"
 #include "gtkmarshalers.h"
 #include "gtksettingsprivate.h"
@@ -327,6 +331,82 @@ lookup_in_global_parent_cache (GtkCssNode                  *node,
   return gtk_css_node_style_cache_get_style (node->cache);
 }
 
+static GtkCssNode *
+get_previous_visible_sibling (GtkCssNode *node)
+{
+  do {
+    node = node->previous_sibling;
+  } while (node && !node->visible);
+
+  return node;
+}
+
+/* Styles that don't depend on siblings or on the position can't go
+ * in the parent cache when the node has its own style provider, but
+ * identical siblings (think rows in a list) can still share them.
+ *
+ * The previous sibling's style is always valid here, because
+ * gtk_css_node_ensure_style() validates it first.
+ */
+static gboolean
+may_share_style_with_sibling (GtkCssNode                  *node,
+                              const GtkCssNodeDeclaration *decl,
+                              GtkCssNode                  *sibling,
+                              GtkCssStyle                 *style)
+{
+  GtkCssChange change;
+
+  if (G_OBJECT_TYPE (sibling) != G_OBJECT_TYPE (node) ||
+      gtk_css_node_get_style_provider (sibling) != gtk_css_node_get_style_provider (node) ||
+      !gtk_css_node_declaration_equal (sibling->decl, decl))
+    return FALSE;
+
+  change = gtk_css_static_style_get_change (GTK_CSS_STATIC_STYLE (style));
+  if (change & (GTK_CSS_CHANGE_ANY_SIBLING | GTK_CSS_CHANGE_NTH_CHILD | GTK_CSS_CHANGE_NTH_LAST_CHILD))
+    return FALSE;
+
+  if ((change & GTK_CSS_CHANGE_FIRST_CHILD) &&
+      gtk_css_node_is_first_child (sibling) != gtk_css_node_is_first_child (node))
+    return FALSE;
+
+  if ((change & GTK_CSS_CHANGE_LAST_CHILD) &&
+      gtk_css_node_is_last_child (sibling) != gtk_css_node_is_last_child (node))
+    return FALSE;
+
+  return TRUE;
+}
+
+static GtkCssStyle *
+lookup_in_previous_sibling (GtkCssNode                  *node,
+                            const GtkCssNodeDeclaration *decl)
+{
+  GtkCssNode *sibling;
+  GtkCssStyle *style;
+  gboolean shared;
+
+#ifdef G_ENABLE_DEBUG
+  if (GTK_DEBUG_CHECK (NO_CSS_CACHE))
+    return NULL;
+#endif
+
+  sibling = get_previous_visible_sibling (node);
+  if (sibling == NULL ||
+      sibling->style == NULL ||
+      sibling->style_is_invalid)
+    return NULL;
+
+  style = sibling->style;
+  if (GTK_IS_CSS_ANIMATED_STYLE (style))
+    style = GTK_CSS_ANIMATED_STYLE (style)->style;
+
+  shared = may_share_style_with_sibling (node, decl, sibling, style);
+  gtk_css_stats.sibling_lookups++;
+  if (shared)
+    gtk_css_stats.sibling_hits++;
+
+  return shared ? style : NULL;
+}
+
 static void
 store_in_global_parent_cache (GtkCssNode                  *node,
                               const GtkCssNodeDeclaration *decl,
@@ -353,7 +433,8 @@ store_in_global_parent_cache (GtkCssNode                  *node,
 }
 
 static GtkCssStyle *
-gtk_css_node_create_style (GtkCssNode *cssnode)
+gtk_css_node_create_style (GtkCssNode                   *cssnode,
+                           const GtkCountingBloomFilter *filter)
 {
   const GtkCssNodeDeclaration *decl;
   GtkCssMatcher matcher;
@@ -366,14 +447,20 @@ gtk_css_node_create_style (GtkCssNode *cssnode)
   if (style)
     return g_object_ref (style);
 
+  style = lookup_in_previous_sibling (cssnode, decl);
+  if (style)
+    return g_object_ref (style);
+
   parent = cssnode->parent ? cssnode->parent->style : NULL;
 
   if (gtk_css_node_init_matcher (cssnode, &matcher))
     style = gtk_css_static_style_new_compute (gtk_css_node_get_style_provider (cssnode),
+                                              filter,
                                               &matcher,
                                               parent);
   else
     style = gtk_css_static_style_new_compute (gtk_css_node_get_style_provider (cssnode),
+                                              NULL,
                                               NULL,
                                               parent);
 
@@ -406,10 +493,11 @@ gtk_css_style_needs_recreation (GtkCssStyle  *style,
 }
 
 static GtkCssStyle *
-gtk_css_node_real_update_style (GtkCssNode   *cssnode,
-                                GtkCssChange  change,
-                                gint64        timestamp,
-                                GtkCssStyle  *style)
+gtk_css_node_real_update_style (GtkCssNode                   *cssnode,
+                                const GtkCountingBloomFilter *filter,
+                                GtkCssChange                  change,
+                                gint64                        timestamp,
+                                GtkCssStyle                  *style)
 {
   GtkCssStyle *static_style, *new_static_style, *new_style;
 
@@ -423,7 +511,7 @@ gtk_css_node_real_update_style (GtkCssNode   *cssnode,
     }
 
   if (gtk_css_style_needs_recreation (static_style, change))
-    new_static_style = gtk_css_node_create_style (cssnode);
+    new_static_style = gtk_css_node_create_style (cssnode, filter);
   else
     new_static_style = g_object_ref (static_style);
 
@@ -966,12 +1054,16 @@ gtk_css_node_propagate_pending_changes (GtkCssNode *cssnode,
 static gboolean
 gtk_css_node_needs_new_style (GtkCssNode *cssnode)
 {
-  return cssnode->style_is_invalid || cssnode->needs_propagation;
+  return cssnode->style_is_invalid || cssnode->animation_is_invalid || cssnode->needs_propagation;
 }
 
+/* @filter, if not %NULL, must contain the ancestors of @cssnode.
+ * As it is only used to reject selectors, it is fine to use it for
+ * the parent and the siblings, too. */
 static void
-gtk_css_node_ensure_style (GtkCssNode *cssnode,
-                           gint64      current_time)
+gtk_css_node_ensure_style (GtkCssNode                   *cssnode,
+                           const GtkCountingBloomFilter *filter,
+                           gint64                        current_time)
 {
   gboolean style_changed;
 
@@ -979,19 +1071,26 @@ gtk_css_node_ensure_style (GtkCssNode *cssnode,
     return;
 
   if (cssnode->parent)
-    gtk_css_node_ensure_style (cssnode->parent, current_time);
+    gtk_css_node_ensure_style (cssnode->parent, filter, current_time);
 
-  if (cssnode->style_is_invalid)
+  if (cssnode->style_is_invalid || cssnode->animation_is_invalid)
     {
       GtkCssStyle *new_style;
+      GtkCssChange change;
+
+      change = cssnode->pending_changes;
 
-      if (cssnode->previous_sibling)
-        gtk_css_node_ensure_style (cssnode->previous_sibling, current_time);
+      if (cssnode->style_is_invalid && cssnode->previous_sibling)
+        gtk_css_node_ensure_style (cssnode->previous_sibling, filter, current_time);
+
+      if (cssnode->animation_is_invalid)
+        change |= GTK_CSS_CHANGE_TIMESTAMP;
 
       g_clear_pointer (&cssnode->cache, gtk_css_node_style_cache_unref);
 
       new_style = GTK_CSS_NODE_GET_CLASS (cssnode)->update_style (cssnode,
-                                                                  cssnode->pending_changes,
+                                                                  filter,
+                                                                  change,
                                                                   current_time,
                                                                   cssnode->style);
 
@@ -1007,6 +1106,7 @@ gtk_css_node_ensure_style (GtkCssNode *cssnode,
 
   cssnode->pending_changes = 0;
   cssnode->style_is_invalid = FALSE;
+  cssnode->animation_is_invalid = FALSE;
 }
 
 GtkCssStyle *
@@ -1016,7 +1116,7 @@ gtk_css_node_get_style (GtkCssNode *cssnode)
     {
       gint64 timestamp = gtk_css_node_get_timestamp (cssnode);
 
-      gtk_css_node_ensure_style (cssnode, timestamp);
+      gtk_css_node_ensure_style (cssnode, NULL, timestamp);
     }
 
   return cssnode->style;
@@ -1265,6 +1365,23 @@ gtk_css_node_invalidate_style_provider (GtkCssNode *cssnode)
     }
 }
 
+static void
+gtk_css_node_invalidate_animation (GtkCssNode *cssnode)
+{
+  if (cssnode->animation_is_invalid)
+    return;
+
+  cssnode->animation_is_invalid = TRUE;
+
+  GTK_CSS_NODE_GET_CLASS (cssnode)->invalidate (cssnode);
+
+  gtk_css_node_set_invalid (cssnode, TRUE);
+}
+
+/* Only nodes with animated or dynamic values are revisited, and those
+ * don't drag along the static nodes after and below them the way
+ * gtk_css_node_invalidate() would. Nodes that aren't invalid have no
+ * such values in their subtree, so they are skipped entirely. */
 static void
 gtk_css_node_invalidate_timestamp (GtkCssNode *cssnode)
 {
@@ -1274,7 +1391,7 @@ gtk_css_node_invalidate_timestamp (GtkCssNode *cssnode)
     return;
 
   if (!gtk_css_style_is_static (cssnode->style))
-    gtk_css_node_invalidate (cssnode, GTK_CSS_CHANGE_TIMESTAMP);
+    gtk_css_node_invalidate_animation (cssnode);
 
   for (child = cssnode->first_child; child; child = child->next_sibling)
     {
@@ -1315,16 +1432,33 @@ gtk_css_node_invalidate (GtkCssNode   *cssnode,
   gtk_css_node_invalidate_style (cssnode);
 }
 
+/* The ancestors of nodes matching via a widget path are in that path,
+ * and the path of a node is inherited by its descendants' matchers, so
+ * none of them may use an ancestor filter built from the node tree. */
+static gboolean
+gtk_css_node_matches_by_path (GtkCssNode *cssnode)
+{
+  GtkCssMatcher matcher;
+
+  return gtk_css_node_init_matcher (cssnode, &matcher) &&
+         _gtk_css_matcher_is_widget_path (&matcher);
+}
+
 static void
-gtk_css_node_validate_internal (GtkCssNode *cssnode,
-                                gint64      timestamp)
+gtk_css_node_validate_internal (GtkCssNode             *cssnode,
+                                GtkCountingBloomFilter *filter,
+                                gint64                  timestamp)
 {
+  GtkCssNodeDeclaration *decl;
   GtkCssNode *child;
 
   if (!cssnode->invalid)
     return;
 
-  gtk_css_node_ensure_style (cssnode, timestamp);
+  if (filter && gtk_css_node_matches_by_path (cssnode))
+    filter = NULL;
+
+  gtk_css_node_ensure_style (cssnode, filter, timestamp);
 
   /* need to set to FALSE then to TRUE here to make it chain up */
   gtk_css_node_set_invalid (cssnode, FALSE);
@@ -1333,23 +1467,54 @@ gtk_css_node_validate_internal (GtkCssNode *cssnode,
 
   GTK_CSS_NODE_GET_CLASS (cssnode)->validate (cssnode);
 
+  if (cssnode->first_child == NULL)
+    return;
+
+  /* Keep a ref to what we added, the validate vfunc of the children
+   * might change our declaration. */
+  decl = NULL;
+  if (filter)
+    {
+      decl = gtk_css_node_declaration_ref (cssnode->decl);
+      gtk_css_node_declaration_add_bloom_hashes (decl, filter);
+    }
+
   for (child = gtk_css_node_get_first_child (cssnode);
        child;
        child = gtk_css_node_get_next_sibling (child))
     {
       if (child->visible)
-        gtk_css_node_validate_internal (child, timestamp);
+        gtk_css_node_validate_internal (child, filter, timestamp);
+    }
+
+  if (decl)
+    {
+      gtk_css_node_declaration_remove_bloom_hashes (decl, filter);
+      gtk_css_node_declaration_unref (decl);
     }
 }
 
 void
 gtk_css_node_validate (GtkCssNode *cssnode)
 {
+  GtkCountingBloomFilter filter = GTK_COUNTING_BLOOM_FILTER_INIT;
+  GtkCssNode *ancestor;
   gint64 timestamp;
 
   timestamp = gtk_css_node_get_timestamp (cssnode);
 
-  gtk_css_node_validate_internal (cssnode, timestamp);
+  for (ancestor = cssnode->parent; ancestor; ancestor = ancestor->parent)
+    {
+      if (gtk_css_node_matches_by_path (ancestor))
+        {
+          gtk_css_node_validate_internal (cssnode, NULL, timestamp);
+          return;
+        }
+
+      gtk_css_node_declaration_add_bloom_hashes (ancestor->decl, &filter);
+    }
+
+  gtk_css_node_validate_internal (cssnode, &filter, timestamp);
 }
 
 gboolean
@@ -22,16 +22,36 @@
 
 #include <string.h>
 
+/*
+ * Declarations are hash-consed: there is only ever one declaration
+ * for a given combination of type, name, id, state and classes, and
+ * it never changes. The setters look up the declaration with the change
+ * applied and replace the one they are given with it. So declarations
+ * can be compared by pointer, and their hash is computed only once.
+ *
+ * The table of declarations does not hold references, declarations
+ * remove themselves from it when they are freed.
+ *
+ * Selector matching asks for classes a lot, and most of the time the
+ * node doesn't have the class. So declarations carry a signature with
+ * one bit per class, which answers most of those questions without
+ * looking at the classes.
+ */
+
 struct _GtkCssNodeDeclaration {
   guint refcount;
+  guint hash;
   GType type;
   const /* interned */ char *name;
   const /* interned */ char *id;
   GtkStateFlags state;
   guint n_classes;
+  guint64 class_signature;      /* computed from the classes */
   /* GQuark classes[n_classes]; */
 };
 
+static GHashTable *declarations;
+
 static inline GQuark *
 get_classes (const GtkCssNodeDeclaration *decl)
 {
@@ -46,66 +66,160 @@ sizeof_node (guint n_classes)
 }
 
 static inline gsize
-sizeof_this_node (GtkCssNodeDeclaration *decl)
+sizeof_this_node (const GtkCssNodeDeclaration *decl)
 {
   return sizeof_node (decl->n_classes);
 }
 
-static void
-gtk_css_node_declaration_make_writable (GtkCssNodeDeclaration **decl)
+/* Quarks are allocated sequentially, so the classes of a node
+ * rarely end up on the same bit */
+static inline guint64
+class_signature_bit (GQuark class_quark)
 {
-  if ((*decl)->refcount == 1)
-    return;
+  return G_GUINT64_CONSTANT (1) << (class_quark % 64);
+}
+
+static guint64
+gtk_css_node_declaration_compute_class_signature (const GtkCssNodeDeclaration *decl)
+{
+  GQuark *classes;
+  guint64 signature;
+  guint i;
+
+  signature = 0;
+  classes = get_classes (decl);
+  for (i = 0; i < decl->n_classes; i++)
+    signature |= class_signature_bit (classes[i]);
+
+  return signature;
+}
+
+static guint
+gtk_css_node_declaration_compute_hash (const GtkCssNodeDeclaration *decl)
+{
+  GQuark *classes;
+  guint hash, i;
+  
+  hash = (guint) decl->type;
+  hash ^= GPOINTER_TO_UINT (decl->name);
+  hash <<= 5;
+  hash ^= GPOINTER_TO_UINT (decl->id);
+
+  classes = get_classes (decl);
+  for (i = 0; i < decl->n_classes; i++)
+    {
+      hash <<= 5;
+      hash += classes[i];
+    }
+
+  hash ^= decl->state;
+
+  return hash;
+}
 
-  (*decl)->refcount--;
+static gboolean
+gtk_css_node_declaration_equal_values (gconstpointer elem1,
+                                       gconstpointer elem2)
+{
+  const GtkCssNodeDeclaration *decl1 = elem1;
+  const GtkCssNodeDeclaration *decl2 = elem2;
+  GQuark *classes1, *classes2;
+  guint i;
+
+  if (decl1->hash != decl2->hash)
+    return FALSE;
+
+  if (decl1->type != decl2->type)
+    return FALSE;
+
+  if (decl1->name != decl2->name)
+    return FALSE;
+
+  if (decl1->state != decl2->state)
+    return FALSE;
+
+  if (decl1->id != decl2->id)
+    return FALSE;
 
-  *decl = g_memdup (*decl, sizeof_this_node (*decl));
-  (*decl)->refcount = 1;
+  if (decl1->n_classes != decl2->n_classes)
+    return FALSE;
+
+  classes1 = get_classes (decl1);
+  classes2 = get_classes (decl2);
+  for (i = 0; i < decl1->n_classes; i++)
+    {
+      if (classes1[i] != classes2[i])
+        return FALSE;
+    }
+
+  return TRUE;
 }
 
+static GHashTable *
+get_declarations (void)
+{
+  if (G_UNLIKELY (declarations == NULL))
+    declarations = g_hash_table_new (gtk_css_node_declaration_hash,
+                                     gtk_css_node_declaration_equal_values);
+
+  return declarations;
+}
+
+/* Replaces *decl with the declaration that equals @templ, creating
+ * it if it doesn't exist yet. @templ is usually on the stack, so
+ * changing to an existing declaration doesn't allocate.
+ */
 static void
-gtk_css_node_declaration_make_writable_resize (GtkCssNodeDeclaration **decl,
-                                               gsize                   offset,
-                                               gsize                   bytes_added,
-                                               gsize                   bytes_removed)
+gtk_css_node_declaration_intern (GtkCssNodeDeclaration **decl,
+                                 GtkCssNodeDeclaration  *templ)
 {
-  gsize old_size = sizeof_this_node (*decl);
-  gsize new_size = old_size + bytes_added - bytes_removed;
+  GtkCssNodeDeclaration *result;
 
-  if ((*decl)->refcount == 1)
+  templ->hash = gtk_css_node_declaration_compute_hash (templ);
+
+  result = g_hash_table_lookup (get_declarations (), templ);
+  if (result)
     {
-      if (bytes_removed > 0 && old_size - offset - bytes_removed > 0)
-        memmove (((char *) *decl) + offset, ((char *) *decl) + offset + bytes_removed, old_size - offset - bytes_removed);
-      *decl = g_realloc (*decl, new_size);
-      if (bytes_added > 0 && old_size - offset > 0)
-        memmove (((char *) *decl) + offset + bytes_added, ((char *) *decl) + offset, old_size - offset);
+      gtk_css_node_declaration_ref (result);
     }
   else
     {
-      GtkCssNodeDeclaration *old = *decl;
-
-      old->refcount--;
-  
-      *decl = g_malloc (new_size);
-      memcpy (*decl, old, offset);
-      if (old_size - offset - bytes_removed > 0)
-        memcpy (((char *) *decl) + offset + bytes_added, ((char *) old) + offset + bytes_removed, old_size - offset - bytes_removed);
-      (*decl)->refcount = 1;
+      result = g_memdup (templ, sizeof_this_node (templ));
+      result->refcount = 1;
+      result->class_signature = gtk_css_node_declaration_compute_class_signature (result);
+      g_hash_table_add (declarations, result);
     }
+
+  gtk_css_node_declaration_unref (*decl);
+  *decl = result;
 }
 
+#define gtk_css_node_declaration_copy_on_stack(decl) \
+  ((GtkCssNodeDeclaration *) memcpy (g_alloca (sizeof_this_node (decl)), (decl), sizeof_this_node (decl)))
+
 GtkCssNodeDeclaration *
 gtk_css_node_declaration_new (void)
 {
   static GtkCssNodeDeclaration empty = {
-    1, /* need to own a ref ourselves so the copy-on-write path kicks in when people change things */
+    1, /* need to own a ref ourselves so it is never freed */
+    0,
     0,
     NULL,
     NULL,
     0,
+    0,
     0
   };
 
+  static gboolean interned = FALSE;
+
+  if (G_UNLIKELY (!interned))
+    {
+      empty.hash = gtk_css_node_declaration_compute_hash (&empty);
+      g_hash_table_add (get_declarations (), &empty);
+      interned = TRUE;
+    }
+
   return gtk_css_node_declaration_ref (&empty);
 }
 
@@ -124,6 +238,7 @@ gtk_css_node_declaration_unref (GtkCssNodeDeclaration *decl)
   if (decl->refcount > 0)
     return;
 
+  g_hash_table_remove (declarations, decl);
   g_free (decl);
 }
 
@@ -131,11 +246,14 @@ gboolean
 gtk_css_node_declaration_set_type (GtkCssNodeDeclaration **decl,
                                    GType                   type)
 {
+  GtkCssNodeDeclaration *templ;
+
   if ((*decl)->type == type)
     return FALSE;
 
-  gtk_css_node_declaration_make_writable (decl);
-  (*decl)->type = type;
+  templ = gtk_css_node_declaration_copy_on_stack (*decl);
+  templ->type = type;
+  gtk_css_node_declaration_intern (decl, templ);
 
   return TRUE;
 }
@@ -150,11 +268,14 @@ gboolean
 gtk_css_node_declaration_set_name (GtkCssNodeDeclaration   **decl,
                                    /*interned*/ const char  *name)
 {
+  GtkCssNodeDeclaration *templ;
+
   if ((*decl)->name == name)
     return FALSE;
 
-  gtk_css_node_declaration_make_writable (decl);
-  (*decl)->name = name;
+  templ = gtk_css_node_declaration_copy_on_stack (*decl);
+  templ->name = name;
+  gtk_css_node_declaration_intern (decl, templ);
 
   return TRUE;
 }
@@ -169,13 +290,16 @@ gboolean
 gtk_css_node_declaration_set_id (GtkCssNodeDeclaration **decl,
                                  const char             *id)
 {
+  GtkCssNodeDeclaration *templ;
+
   id = g_intern_string (id);
 
   if ((*decl)->id == id)
     return FALSE;
 
-  gtk_css_node_declaration_make_writable (decl);
-  (*decl)->id = id;
+  templ = gtk_css_node_declaration_copy_on_stack (*decl);
+  templ->id = id;
+  gtk_css_node_declaration_intern (decl, templ);
 
   return TRUE;
 }
@@ -190,11 +314,14 @@ gboolean
 gtk_css_node_declaration_set_state (GtkCssNodeDeclaration **decl,
                                     GtkStateFlags           state)
 {
+  GtkCssNodeDeclaration *templ;
+
   if ((*decl)->state == state)
     return FALSE;
   
-  gtk_css_node_declaration_make_writable (decl);
-  (*decl)->state = state;
+  templ = gtk_css_node_declaration_copy_on_stack (*decl);
+  templ->state = state;
+  gtk_css_node_declaration_intern (decl, templ);
 
   return TRUE;
 }
@@ -256,17 +383,21 @@ gboolean
 gtk_css_node_declaration_add_class (GtkCssNodeDeclaration **decl,
                                     GQuark                  class_quark)
 {
+  GtkCssNodeDeclaration *templ;
+  GQuark *classes;
   guint pos;
 
   if (find_class (*decl, class_quark, &pos))
     return FALSE;
 
-  gtk_css_node_declaration_make_writable_resize (decl,
-                                                 (char *) &get_classes (*decl)[pos] - (char *) *decl,
-                                                 sizeof (GQuark),
-                                                 0);
-  (*decl)->n_classes++;
-  get_classes(*decl)[pos] = class_quark;
+  templ = g_alloca (sizeof_node ((*decl)->n_classes + 1));
+  *templ = **decl;
+  templ->n_classes++;
+  classes = get_classes (*decl);
+  memcpy (get_classes (templ), classes, sizeof (GQuark) * pos);
+  get_classes (templ)[pos] = class_quark;
+  memcpy (get_classes (templ) + pos + 1, classes + pos, sizeof (GQuark) * ((*decl)->n_classes - pos));
+  gtk_css_node_declaration_intern (decl, templ);
 
   return TRUE;
 }
@@ -275,16 +406,21 @@ gboolean
 gtk_css_node_declaration_remove_class (GtkCssNodeDeclaration **decl,
                                        GQuark                  class_quark)
 {
+  GtkCssNodeDeclaration *templ;
+  GQuark *classes;
   guint pos;
 
-  if (!find_class (*decl, class_quark, &pos))
+  if (((*decl)->class_signature & class_signature_bit (class_quark)) == 0 ||
+      !find_class (*decl, class_quark, &pos))
     return FALSE;
 
-  gtk_css_node_declaration_make_writable_resize (decl,
-                                                 (char *) &get_classes (*decl)[pos] - (char *) *decl,
-                                                 0,
-                                                 sizeof (GQuark));
-  (*decl)->n_classes--;
+  templ = g_alloca (sizeof_node ((*decl)->n_classes - 1));
+  *templ = **decl;
+  templ->n_classes--;
+  classes = get_classes (*decl);
+  memcpy (get_classes (templ), classes, sizeof (GQuark) * pos);
+  memcpy (get_classes (templ) + pos, classes + pos + 1, sizeof (GQuark) * (templ->n_classes - pos));
+  gtk_css_node_declaration_intern (decl, templ);
 
   return TRUE;
 }
@@ -292,14 +428,14 @@ gtk_css_node_declaration_remove_class (GtkCssNodeDeclaration **decl,
 gboolean
 gtk_css_node_declaration_clear_classes (GtkCssNodeDeclaration **decl)
 {
+  GtkCssNodeDeclaration templ;
+
   if ((*decl)->n_classes == 0)
     return FALSE;
 
-  gtk_css_node_declaration_make_writable_resize (decl,
-                                                 (char *) get_classes (*decl) - (char *) *decl,
-                                                 0,
-                                                 sizeof (GQuark) * (*decl)->n_classes);
-  (*decl)->n_classes = 0;
+  templ = **decl;
+  templ.n_classes = 0;
+  gtk_css_node_declaration_intern (decl, &templ);
 
   return TRUE;
 }
@@ -311,6 +447,9 @@ gtk_css_node_declaration_has_class (const GtkCssNodeDeclaration *decl,
   guint pos;
   GQuark *classes = get_classes (decl);
 
+  if ((decl->class_signature & class_signature_bit (class_quark)) == 0)
+    return FALSE;
+
   switch (decl->n_classes)
     {
     case 3:
@@ -346,62 +485,50 @@ guint
 gtk_css_node_declaration_hash (gconstpointer elem)
 {
   const GtkCssNodeDeclaration *decl = elem;
-  GQuark *classes;
-  guint hash, i;
-  
-  hash = (guint) decl->type;
-  hash ^= GPOINTER_TO_UINT (decl->name);
-  hash <<= 5;
-  hash ^= GPOINTER_TO_UINT (decl->id);
 
-  classes = get_classes (decl);
-  for (i = 0; i < decl->n_classes; i++)
-    {
-      hash <<= 5;
-      hash += classes[i];
-    }
-
-  hash ^= decl->state;
-
-  return hash;
+  return decl->hash;
 }
 
+/* Declarations are interned, so equal ones are the same */
 gboolean
 gtk_css_node_declaration_equal (gconstpointer elem1,
                                 gconstpointer elem2)
 {
-  const GtkCssNodeDeclaration *decl1 = elem1;
-  const GtkCssNodeDeclaration *decl2 = elem2;
-  GQuark *classes1, *classes2;
-  guint i;
-
-  if (decl1 == decl2)
-    return TRUE;
-
-  if (decl1->type != decl2->type)
-    return FALSE;
+  return elem1 == elem2;
+}
 
-  if (decl1->name != decl2->name)
-    return FALSE;
+void
+gtk_css_node_declaration_add_bloom_hashes (const GtkCssNodeDeclaration *decl,
+                                           GtkCountingBloomFilter      *filter)
+{
+  GQuark *classes;
+  guint i;
 
-  if (decl1->state != decl2->state)
-    return FALSE;
+  if (decl->name)
+    gtk_counting_bloom_filter_add (filter, gtk_counting_bloom_filter_hash_pointer (decl->name, GTK_COUNTING_BLOOM_FILTER_SALT_NAME));
+  if (decl->id)
+    gtk_counting_bloom_filter_add (filter, gtk_counting_bloom_filter_hash_pointer (decl->id, GTK_COUNTING_BLOOM_FILTER_SALT_ID));
 
-  if (decl1->id != decl2->id)
-    return FALSE;
+  classes = get_classes (decl);
+  for (i = 0; i < decl->n_classes; i++)
+    gtk_counting_bloom_filter_add (filter, gtk_counting_bloom_filter_hash_pointer (GUINT_TO_POINTER (classes[i]), GTK_COUNTING_BLOOM_FILTER_SALT_CLASS));
+}
 
-  if (decl1->n_classes != decl2->n_classes)
-    return FALSE;
+void
+gtk_css_node_declaration_remove_bloom_hashes (const GtkCssNodeDeclaration *decl,
+                                              GtkCountingBloomFilter      *filter)
+{
+  GQuark *classes;
+  guint i;
 
-  classes1 = get_classes (decl1);
-  classes2 = get_classes (decl2);
-  for (i = 0; i < decl1->n_classes; i++)
-    {
-      if (classes1[i] != classes2[i])
-        return FALSE;
-    }
+  if (decl->name)
+    gtk_counting_bloom_filter_remove (filter, gtk_counting_bloom_filter_hash_pointer (decl->name, GTK_COUNTING_BLOOM_FILTER_SALT_NAME));
+  if (decl->id)
+    gtk_counting_bloom_filter_remove (filter, gtk_counting_bloom_filter_hash_pointer (decl->id, GTK_COUNTING_BLOOM_FILTER_SALT_ID));
 
-  return TRUE;
+  classes = get_classes (decl);
+  for (i = 0; i < decl->n_classes; i++)
+    gtk_counting_bloom_filter_remove (filter, gtk_counting_bloom_filter_hash_pointer (GUINT_TO_POINTER (classes[i]), GTK_COUNTING_BLOOM_FILTER_SALT_CLASS));
 }
 
 void
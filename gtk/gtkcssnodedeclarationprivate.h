@@ -18,6 +18,7 @@
 #ifndef __GTK_CSS_NODE_DECLARATION_PRIVATE_H__
 #define __GTK_CSS_NODE_DECLARATION_PRIVATE_H__
 
+#include "gtkcountingbloomfilterprivate.h"
 #include "gtkcsstypesprivate.h"
 #include "gtkenums.h"
 #include "gtkwidgetpath.h"
@@ -55,6 +56,11 @@ guint                   gtk_css_node_declaration_hash                   (gconstp
 gboolean                gtk_css_node_declaration_equal                  (gconstpointer                  elem1,
                                                                          gconstpointer                  elem2);
 
+void                    gtk_css_node_declaration_add_bloom_hashes       (const GtkCssNodeDeclaration   *decl,
+                                                                         GtkCountingBloomFilter        *filter);
+void                    gtk_css_node_declaration_remove_bloom_hashes    (const GtkCssNodeDeclaration   *decl,
+                                                                         GtkCountingBloomFilter        *filter);
+
 void                    gtk_css_node_declaration_add_to_widget_path     (const GtkCssNodeDeclaration   *decl,
                                                                          GtkWidgetPath                 *path,
                                                                          guint                          pos);
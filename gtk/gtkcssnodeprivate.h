@@ -60,6 +60,10 @@ struct _GtkCssNode
    * So if a valid style is computed, one has to previously ensure that the parent's and the previous sibling's style
    * are valid. This allows both validation and invalidation to run in O(nodes-in-tree) */
   guint                  style_is_invalid :1;   /* the style needs to be recomputed */
+  /* Unlike style_is_invalid, this does not spread to siblings and children:
+   * nothing they match on changes when animations advance, and they get
+   * %GTK_CSS_CHANGE_PARENT_STYLE if the advanced style differs. */
+  guint                  animation_is_invalid :1; /* the animated values need to be advanced to the current time */
 };
 
 struct _GtkCssNodeClass
@@ -84,6 +88,7 @@ struct _GtkCssNodeClass
   /* get frame clock or NULL (only relevant for root node) */
   GdkFrameClock *       (* get_frame_clock)             (GtkCssNode            *cssnode);
   GtkCssStyle *         (* update_style)                (GtkCssNode            *cssnode,
+                                                         const GtkCountingBloomFilter *filter,
                                                          GtkCssChange           pending_changes,
                                                          gint64                 timestamp,
                                                          GtkCssStyle           *old_style);
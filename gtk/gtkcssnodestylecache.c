@@ -21,6 +21,7 @@
 
 #include "gtkdebug.h"
 #include "gtkcssstaticstyleprivate.h"
+#include "gtkcssstatsprivate.h"
 
 struct _GtkCssNodeStyleCache {
   guint        ref_count;
@@ -118,17 +119,6 @@ gtk_css_node_style_cache_decl_hash (gconstpointer item)
     | UNPACK_FLAGS (item);
 }
 
-static gboolean
-gtk_css_node_style_cache_decl_equal (gconstpointer item1,
-                                     gconstpointer item2)
-{
-  if (UNPACK_FLAGS (item1) != UNPACK_FLAGS (item2))
-    return FALSE;
-
-  return gtk_css_node_declaration_equal (UNPACK_DECLARATION (item1),
-                                         UNPACK_DECLARATION (item2));
-}
-
 static void
 gtk_css_node_style_cache_decl_free (gpointer item)
 {
@@ -149,7 +139,8 @@ gtk_css_node_style_cache_insert (GtkCssNodeStyleCache   *parent,
 
   if (parent->children == NULL)
     parent->children = g_hash_table_new_full (gtk_css_node_style_cache_decl_hash,
-                                              gtk_css_node_style_cache_decl_equal,
+                                              /* declarations are interned */
+                                              g_direct_equal,
                                               gtk_css_node_style_cache_decl_free,
                                               (GDestroyNotify) gtk_css_node_style_cache_unref);
 
@@ -170,6 +161,8 @@ gtk_css_node_style_cache_lookup (GtkCssNodeStyleCache        *parent,
 {
   GtkCssNodeStyleCache *result;
 
+  gtk_css_stats.parent_cache_lookups++;
+
   if (parent->children == NULL)
     return NULL;
 
@@ -177,6 +170,7 @@ gtk_css_node_style_cache_lookup (GtkCssNodeStyleCache        *parent,
   if (result == NULL)
     return NULL;
 
+  gtk_css_stats.parent_cache_hits++;
+
   return gtk_css_node_style_cache_ref (result);
 }
-
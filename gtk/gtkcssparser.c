@@ -47,6 +47,8 @@ struct _GtkCssParser
 
   /* Use this for parsing identifiers, names and strings. */
   GString               *ident_str;
+
+  guint                  n_urls;        /* url()s read so far */
 };
 
 GtkCssParser *
@@ -399,6 +401,25 @@ _gtk_css_parser_read_char (GtkCssParser *parser,
   return FALSE;
 }
 
+/* Appends as many allowed characters as possible to @str. Runs of
+ * plain characters are copied in one go, only escapes and non-ASCII
+ * characters are looked at one by one. */
+static void
+_gtk_css_parser_read_chars (GtkCssParser *parser,
+                            GString      *str,
+                            const char   *allowed)
+{
+  gsize len;
+
+  do
+    {
+      len = strspn (parser->data, allowed);
+      g_string_append_len (str, parser->data, len);
+      parser->data += len;
+    }
+  while (_gtk_css_parser_read_char (parser, str, allowed));
+}
+
 static char *
 _gtk_css_parser_get_ident (GtkCssParser *parser)
 {
@@ -414,39 +435,63 @@ _gtk_css_parser_get_ident (GtkCssParser *parser)
   return result;
 }
 
-char *
-_gtk_css_parser_try_name (GtkCssParser *parser,
-                          gboolean      skip_whitespace)
+/* Like _gtk_css_parser_get_ident() but without a copy, the buffer is
+ * reused. So once a name is known, reading it again allocates nothing. */
+static const char *
+_gtk_css_parser_get_interned_ident (GtkCssParser *parser)
 {
-  GString *name;
+  const char *result;
 
-  g_return_val_if_fail (GTK_IS_CSS_PARSER (parser), NULL);
+  result = g_intern_string (parser->ident_str->str);
+  g_string_set_size (parser->ident_str, 0);
+
+  return result;
+}
 
+static void
+_gtk_css_parser_read_name (GtkCssParser *parser,
+                           gboolean      skip_whitespace)
+{
   if (parser->ident_str == NULL)
     parser->ident_str = g_string_new (NULL);
 
-  name = parser->ident_str;
-
-  while (_gtk_css_parser_read_char (parser, name, NMCHAR))
-    ;
+  _gtk_css_parser_read_chars (parser, parser->ident_str, NMCHAR);
 
   if (skip_whitespace)
     _gtk_css_parser_skip_whitespace (parser);
+}
+
+char *
+_gtk_css_parser_try_name (GtkCssParser *parser,
+                          gboolean      skip_whitespace)
+{
+  g_return_val_if_fail (GTK_IS_CSS_PARSER (parser), NULL);
+
+  _gtk_css_parser_read_name (parser, skip_whitespace);
 
   return _gtk_css_parser_get_ident (parser);
 }
 
-char *
-_gtk_css_parser_try_ident (GtkCssParser *parser,
-                           gboolean      skip_whitespace)
+const char *
+_gtk_css_parser_try_interned_name (GtkCssParser *parser,
+                                   gboolean      skip_whitespace)
+{
+  g_return_val_if_fail (GTK_IS_CSS_PARSER (parser), NULL);
+
+  _gtk_css_parser_read_name (parser, skip_whitespace);
+
+  return _gtk_css_parser_get_interned_ident (parser);
+}
+
+static gboolean
+_gtk_css_parser_read_ident (GtkCssParser *parser,
+                            gboolean      skip_whitespace)
 {
   const char *start;
   GString *ident;
 
-  g_return_val_if_fail (GTK_IS_CSS_PARSER (parser), NULL);
-
   start = parser->data;
-  
+
   if (parser->ident_str == NULL)
     parser->ident_str = g_string_new (NULL);
 
@@ -462,18 +507,41 @@ _gtk_css_parser_try_ident (GtkCssParser *parser,
     {
       parser->data = start;
       g_string_set_size (ident, 0);
-      return NULL;
+      return FALSE;
     }
 
-  while (_gtk_css_parser_read_char (parser, ident, NMCHAR))
-    ;
+  _gtk_css_parser_read_chars (parser, ident, NMCHAR);
 
   if (skip_whitespace)
     _gtk_css_parser_skip_whitespace (parser);
 
+  return TRUE;
+}
+
+char *
+_gtk_css_parser_try_ident (GtkCssParser *parser,
+                           gboolean      skip_whitespace)
+{
+  g_return_val_if_fail (GTK_IS_CSS_PARSER (parser), NULL);
+
+  if (!_gtk_css_parser_read_ident (parser, skip_whitespace))
+    return NULL;
+
   return _gtk_css_parser_get_ident (parser);
 }
 
+const char *
+_gtk_css_parser_try_interned_ident (GtkCssParser *parser,
+                                    gboolean      skip_whitespace)
+{
+  g_return_val_if_fail (GTK_IS_CSS_PARSER (parser), NULL);
+
+  if (!_gtk_css_parser_read_ident (parser, skip_whitespace))
+    return NULL;
+
+  return _gtk_css_parser_get_interned_ident (parser);
+}
+
 gboolean
 _gtk_css_parser_is_string (GtkCssParser *parser)
 {
@@ -670,7 +738,8 @@ gtk_css_dimension_value_parse (GtkCssParser           *parser,
     { "s",    GTK_CSS_S,       GTK_CSS_PARSE_TIME   },
     { "ms",   GTK_CSS_MS,      GTK_CSS_PARSE_TIME   }
   };
-  char *end, *unit_name;
+  const char *unit_name;
+  char *end;
   double value;
   GtkCssUnit unit;
 
@@ -698,7 +767,7 @@ gtk_css_dimension_value_parse (GtkCssParser           *parser,
       return NULL;
     }
 
-  unit_name = _gtk_css_parser_try_ident (parser, FALSE);
+  unit_name = _gtk_css_parser_try_interned_ident (parser, FALSE);
 
   if (unit_name)
     {
@@ -714,13 +783,10 @@ gtk_css_dimension_value_parse (GtkCssParser           *parser,
       if (i >= G_N_ELEMENTS (units))
         {
           _gtk_css_parser_error (parser, "'%s' is not a valid unit.", unit_name);
-          g_free (unit_name);
           return NULL;
         }
 
       unit = units[i].unit;
-
-      g_free (unit_name);
     }
   else
     {
@@ -783,7 +849,7 @@ _gtk_css_parser_try_enum (GtkCssParser *parser,
   GEnumClass *enum_class;
   gboolean result;
   const char *start;
-  char *str;
+  const char *str;
 
   g_return_val_if_fail (GTK_IS_CSS_PARSER (parser), FALSE);
   g_return_val_if_fail (value != NULL, FALSE);
@@ -794,7 +860,7 @@ _gtk_css_parser_try_enum (GtkCssParser *parser,
 
   start = parser->data;
 
-  str = _gtk_css_parser_try_ident (parser, TRUE);
+  str = _gtk_css_parser_try_interned_ident (parser, TRUE);
   if (str == NULL)
     return FALSE;
 
@@ -814,7 +880,6 @@ _gtk_css_parser_try_enum (GtkCssParser *parser,
 	}
     }
 
-  g_free (str);
   g_type_class_unref (enum_class);
 
   if (!result)
@@ -878,6 +943,13 @@ _gtk_css_parser_try_hash_color (GtkCssParser *parser,
   return FALSE;
 }
 
+/* Number of files referenced through url() so far */
+guint
+_gtk_css_parser_get_n_urls (GtkCssParser *parser)
+{
+  return parser->n_urls;
+}
+
 GFile *
 _gtk_css_parser_read_url (GtkCssParser *parser)
 {
@@ -910,6 +982,7 @@ _gtk_css_parser_read_url (GtkCssParser *parser)
 	  file = g_file_new_for_uri (path);
 	  g_free (path);
 	  g_free (scheme);
+	  parser->n_urls++;
 	  return file;
 	}
     }
@@ -925,6 +998,7 @@ _gtk_css_parser_read_url (GtkCssParser *parser)
 
   file = _gtk_css_parser_get_file_for_path (parser, path);
   g_free (path);
+  parser->n_urls++;
 
   return file;
 }
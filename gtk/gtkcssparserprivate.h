@@ -75,6 +75,13 @@ char *          _gtk_css_parser_try_ident         (GtkCssParser          *parser
                                                    gboolean               skip_whitespace);
 char *          _gtk_css_parser_try_name          (GtkCssParser          *parser,
                                                    gboolean               skip_whitespace);
+/* Like the above, but the result is interned with g_intern_string() and
+ * doesn't need to be freed. Use these for names that are interned anyway,
+ * they don't allocate once the name is known. */
+const char *    _gtk_css_parser_try_interned_ident (GtkCssParser         *parser,
+                                                   gboolean               skip_whitespace);
+const char *    _gtk_css_parser_try_interned_name (GtkCssParser          *parser,
+                                                   gboolean               skip_whitespace);
 gboolean        _gtk_css_parser_try_int           (GtkCssParser          *parser,
                                                    int                   *value);
 gboolean        _gtk_css_parser_try_uint          (GtkCssParser          *parser,
@@ -93,6 +100,7 @@ gboolean        _gtk_css_parser_has_number        (GtkCssParser          *parser
 char *          _gtk_css_parser_read_string       (GtkCssParser          *parser);
 char *          _gtk_css_parser_read_value        (GtkCssParser          *parser);
 GFile *         _gtk_css_parser_read_url          (GtkCssParser          *parser);
+guint           _gtk_css_parser_get_n_urls        (GtkCssParser          *parser);
 
 void            _gtk_css_parser_skip_whitespace   (GtkCssParser          *parser);
 void            _gtk_css_parser_resync            (GtkCssParser          *parser,
@@ -91,13 +91,15 @@ gtk_css_path_node_real_get_widget_path (GtkCssNode *node)
 }
 
 static GtkCssStyle *
-gtk_css_path_node_update_style (GtkCssNode   *cssnode,
-                                GtkCssChange  change,
-                                gint64        timestamp,
-                                GtkCssStyle  *style)
+gtk_css_path_node_update_style (GtkCssNode                   *cssnode,
+                                const GtkCountingBloomFilter *filter,
+                                GtkCssChange                  change,
+                                gint64                        timestamp,
+                                GtkCssStyle                  *style)
 {
-  /* This should get rid of animations */
-  return GTK_CSS_NODE_CLASS (gtk_css_path_node_parent_class)->update_style (cssnode, change, 0, style);
+  /* This should get rid of animations.
+   * Our ancestors live in the widget path, not in the filter. */
+  return GTK_CSS_NODE_CLASS (gtk_css_path_node_parent_class)->update_style (cssnode, NULL, change, 0, style);
 }
 
 static GtkStyleProvider *
@@ -34,6 +34,7 @@
 #include "gtkcssselectorprivate.h"
 #include "gtkcssshorthandpropertyprivate.h"
 #include "gtksettingsprivate.h"
+#include "gtkstartuptraceprivate.h"
 #include "gtkstyleprovider.h"
 #include "gtkstylecontextprivate.h"
 #include "gtkstylepropertyprivate.h"
@@ -119,6 +120,8 @@ struct _GtkCssProviderPrivate
   GtkCssSelectorTree *tree;
   GResource *resource;
   gchar *path;
+
+  guint depends_on_files : 1; /* content used url() or @import */
 };
 
 enum {
@@ -317,6 +320,12 @@ gtk_css_scanner_destroy (GtkCssScanner *scanner)
 {
   if (scanner->section)
     gtk_css_section_unref (scanner->section);
+  if (_gtk_css_parser_get_n_urls (scanner->parser) > 0)
+    {
+      GtkCssProviderPrivate *priv = gtk_css_provider_get_instance_private (scanner->provider);
+
+      priv->depends_on_files = TRUE;
+    }
   g_object_unref (scanner->provider);
   _gtk_css_parser_free (scanner->parser);
 
@@ -489,7 +498,7 @@ verify_tree_get_change_results (GtkCssProvider *provider,
     GPtrArray *tree_rules;
     int i;
 
-    tree_rules = _gtk_css_selector_tree_match_all (priv->tree, matcher);
+    tree_rules = _gtk_css_selector_tree_match_all (priv->tree, NULL, matcher);
     if (tree_rules)
       {
         verify_tree_match_results (provider, matcher, tree_rules);
@@ -554,49 +563,64 @@ gtk_css_style_provider_get_keyframes (GtkStyleProvider *provider,
 }
 
 static void
-gtk_css_style_provider_lookup (GtkStyleProvider    *provider,
-                               const GtkCssMatcher *matcher,
-                               GtkCssLookup        *lookup,
-                               GtkCssChange        *change)
+gtk_css_ruleset_lookup (const GtkCssRuleset *ruleset,
+                        GtkCssLookup        *lookup)
+{
+  guint j;
+
+  if (ruleset->styles == NULL)
+    return;
+
+  /* Everything this ruleset sets was set by more specific ones */
+  if (!_gtk_bitmask_intersects (_gtk_css_lookup_get_missing (lookup),
+                                ruleset->set_styles))
+    return;
+
+  for (j = 0; j < ruleset->n_styles; j++)
+    {
+      GtkCssStyleProperty *prop = ruleset->styles[j].property;
+      guint id = _gtk_css_style_property_get_id (prop);
+
+      if (!_gtk_css_lookup_is_missing (lookup, id))
+        continue;
+
+      _gtk_css_lookup_set (lookup,
+                           id,
+                           ruleset->styles[j].section,
+                           ruleset->styles[j].value);
+    }
+}
+
+static void
+gtk_css_style_provider_lookup (GtkStyleProvider             *provider,
+                               const GtkCountingBloomFilter *filter,
+                               const GtkCssMatcher          *matcher,
+                               GtkCssLookup                 *lookup,
+                               GtkCssChange                 *change)
 {
   GtkCssProvider *css_provider = GTK_CSS_PROVIDER (provider);
   GtkCssProviderPrivate *priv = gtk_css_provider_get_instance_private (css_provider);
-  GtkCssRuleset *ruleset;
-  guint j;
   int i;
   GPtrArray *tree_rules;
 
-  tree_rules = _gtk_css_selector_tree_match_all (priv->tree, matcher);
+  /* A higher priority provider may have set everything already,
+   * then only the change is needed */
+  if (_gtk_css_lookup_is_done (lookup))
+    tree_rules = NULL;
+  else
+    tree_rules = _gtk_css_selector_tree_match_all (priv->tree, filter, matcher);
+
   if (tree_rules)
     {
       verify_tree_match_results (css_provider, matcher, tree_rules);
 
+      /* Rulesets are sorted by specificity, so the most specific
+       * ones come last and win */
       for (i = tree_rules->len - 1; i >= 0; i--)
         {
-          ruleset = tree_rules->pdata[i];
-
-          if (ruleset->styles == NULL)
-            continue;
-
-          if (!_gtk_bitmask_intersects (_gtk_css_lookup_get_missing (lookup),
-                                        ruleset->set_styles))
-          continue;
-
-          for (j = 0; j < ruleset->n_styles; j++)
-            {
-              GtkCssStyleProperty *prop = ruleset->styles[j].property;
-              guint id = _gtk_css_style_property_get_id (prop);
-
-              if (!_gtk_css_lookup_is_missing (lookup, id))
-                continue;
-
-              _gtk_css_lookup_set (lookup,
-                                   id,
-                                   ruleset->styles[j].section,
-                                  ruleset->styles[j].value);
-            }
+          gtk_css_ruleset_lookup (tree_rules->pdata[i], lookup);
 
-          if (_gtk_bitmask_is_empty (_gtk_css_lookup_get_missing (lookup)))
+          if (_gtk_css_lookup_is_done (lookup))
             break;
         }
 
@@ -614,6 +638,40 @@ gtk_css_style_provider_lookup (GtkStyleProvider    *provider,
     }
 }
 
+/* Used by GtkStyleCascade to merge the selector trees of its providers.
+ * The rulesets are ordered by increasing precedence.
+ */
+guint
+gtk_css_provider_get_n_rulesets (GtkCssProvider *provider)
+{
+  GtkCssProviderPrivate *priv = gtk_css_provider_get_instance_private (provider);
+
+  return priv->rulesets->len;
+}
+
+GtkCssSelector *
+gtk_css_provider_get_ruleset_selector (GtkCssProvider *provider,
+                                       guint           i)
+{
+  GtkCssProviderPrivate *priv = gtk_css_provider_get_instance_private (provider);
+
+  return g_array_index (priv->rulesets, GtkCssRuleset, i).selector;
+}
+
+void
+gtk_css_provider_lookup_ruleset (GtkCssProvider *provider,
+                                 guint           i,
+                                 GtkCssLookup   *lookup)
+{
+  GtkCssProviderPrivate *priv = gtk_css_provider_get_instance_private (provider);
+
+  /* The provider may be reloading */
+  if (i >= priv->rulesets->len)
+    return;
+
+  gtk_css_ruleset_lookup (&g_array_index (priv->rulesets, GtkCssRuleset, i), lookup);
+}
+
 static void
 gtk_css_style_provider_iface_init (GtkStyleProviderInterface *iface)
 {
@@ -772,7 +830,7 @@ gtk_css_provider_reset (GtkCssProvider *css_provider)
   g_array_set_size (priv->rulesets, 0);
   _gtk_css_selector_tree_free (priv->tree);
   priv->tree = NULL;
-
+  priv->depends_on_files = FALSE;
 }
 
 static gboolean
@@ -1017,11 +1075,11 @@ parse_declaration (GtkCssScanner *scanner,
                    GtkCssRuleset *ruleset)
 {
   GtkStyleProperty *property;
-  char *name;
+  const char *name;
 
   gtk_css_scanner_push_section (scanner, GTK_CSS_SECTION_DECLARATION);
 
-  name = _gtk_css_parser_try_ident (scanner->parser, TRUE);
+  name = _gtk_css_parser_try_interned_ident (scanner->parser, TRUE);
   if (name == NULL)
     goto check_for_semicolon;
 
@@ -1031,7 +1089,6 @@ parse_declaration (GtkCssScanner *scanner,
     {
       gtk_css_provider_invalid_token (scanner->provider, scanner, "':'");
       _gtk_css_parser_resync (scanner->parser, TRUE, '}');
-      g_free (name);
       gtk_css_scanner_pop_section (scanner, GTK_CSS_SECTION_DECLARATION);
       return;
     }
@@ -1040,8 +1097,6 @@ parse_declaration (GtkCssScanner *scanner,
     {
       GtkCssValue *value;
 
-      g_free (name);
-
       gtk_css_scanner_push_section (scanner, GTK_CSS_SECTION_VALUE);
 
       value = _gtk_style_property_parse_value (property,
@@ -1098,8 +1153,6 @@ parse_declaration (GtkCssScanner *scanner,
 
       gtk_css_scanner_pop_section (scanner, GTK_CSS_SECTION_VALUE);
     }
-  else
-    g_free (name);
 
 check_for_semicolon:
   gtk_css_scanner_pop_section (scanner, GTK_CSS_SECTION_DECLARATION);
@@ -1249,17 +1302,7 @@ gtk_css_provider_postprocess (GtkCssProvider *css_provider)
   priv->tree = _gtk_css_selector_tree_builder_build (builder);
   _gtk_css_selector_tree_builder_free (builder);
 
-#ifndef VERIFY_TREE
-  for (i = 0; i < priv->rulesets->len; i++)
-    {
-      GtkCssRuleset *ruleset;
-
-      ruleset = &g_array_index (priv->rulesets, GtkCssRuleset, i);
-
-      _gtk_css_selector_free (ruleset->selector);
-      ruleset->selector = NULL;
-    }
-#endif
+  /* The selectors are kept, style cascades build their trees from them */
 }
 
 static void
@@ -1270,6 +1313,10 @@ gtk_css_provider_load_internal (GtkCssProvider *css_provider,
 {
   GtkCssScanner *scanner;
   GBytes *bytes;
+  gint64 trace_start;
+
+  /* Imports are part of the span of the file importing them */
+  trace_start = parent == NULL ? gtk_startup_trace_begin () : 0;
 
   if (text == NULL)
     {
@@ -1334,6 +1381,179 @@ gtk_css_provider_load_internal (GtkCssProvider *css_provider,
 
   if (bytes)
     g_bytes_unref (bytes);
+
+  if (trace_start)
+    {
+      char *uri = file ? g_file_get_uri (file) : NULL;
+
+      gtk_startup_trace_end (trace_start, "Load CSS", uri);
+      g_free (uri);
+    }
+}
+
+static gboolean
+gtk_css_provider_is_empty (GtkCssProvider *css_provider)
+{
+  GtkCssProviderPrivate *priv = gtk_css_provider_get_instance_private (css_provider);
+
+  return priv->rulesets->len == 0 &&
+         g_hash_table_size (priv->symbolic_colors) == 0 &&
+         g_hash_table_size (priv->keyframes) == 0;
+}
+
+static gboolean
+gtk_css_rulesets_equal (GArray *a,
+                        GArray *b)
+{
+  guint i, j;
+
+  if (a->len != b->len)
+    return FALSE;
+
+  for (i = 0; i < a->len; i++)
+    {
+      GtkCssRuleset *ra = &g_array_index (a, GtkCssRuleset, i);
+      GtkCssRuleset *rb = &g_array_index (b, GtkCssRuleset, i);
+
+      if (!_gtk_css_selector_equal (ra->selector, rb->selector) ||
+          ra->n_styles != rb->n_styles)
+        return FALSE;
+
+      for (j = 0; j < ra->n_styles; j++)
+        {
+          if (ra->styles[j].property != rb->styles[j].property ||
+              !_gtk_css_value_equal (ra->styles[j].value, rb->styles[j].value))
+            return FALSE;
+        }
+    }
+
+  return TRUE;
+}
+
+static gboolean
+gtk_css_colors_equal (GHashTable *a,
+                      GHashTable *b)
+{
+  GHashTableIter iter;
+  gpointer key, value;
+
+  if (g_hash_table_size (a) != g_hash_table_size (b))
+    return FALSE;
+
+  g_hash_table_iter_init (&iter, a);
+  while (g_hash_table_iter_next (&iter, &key, &value))
+    {
+      GtkCssValue *other = g_hash_table_lookup (b, key);
+
+      if (other == NULL || !_gtk_css_value_equal (value, other))
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
+static gboolean
+gtk_css_keyframes_equal (GHashTable *a,
+                         GHashTable *b)
+{
+  GHashTableIter iter;
+  gpointer key, value;
+  GString *sa, *sb;
+  gboolean equal = TRUE;
+
+  if (g_hash_table_size (a) != g_hash_table_size (b))
+    return FALSE;
+
+  sa = g_string_new (NULL);
+  sb = g_string_new (NULL);
+
+  g_hash_table_iter_init (&iter, a);
+  while (equal && g_hash_table_iter_next (&iter, &key, &value))
+    {
+      GtkCssKeyframes *other = g_hash_table_lookup (b, key);
+
+      if (other == NULL)
+        {
+          equal = FALSE;
+          break;
+        }
+
+      g_string_truncate (sa, 0);
+      g_string_truncate (sb, 0);
+      _gtk_css_keyframes_print (value, sa);
+      _gtk_css_keyframes_print (other, sb);
+      equal = g_string_equal (sa, sb);
+    }
+
+  g_string_free (sa, TRUE);
+  g_string_free (sb, TRUE);
+
+  return equal;
+}
+
+/* Replaces the contents of @css_provider and only emits ::changed when
+ * the parsed result differs. Reloading identical CSS is common, for
+ * example when settings get reapplied or an editor reloads on every
+ * keystroke, and it would otherwise restyle every widget.
+ *
+ * Content that refers to other files via url() or @import is always
+ * treated as changed, since those files may differ even when the text
+ * does not.
+ */
+static void
+gtk_css_provider_reload (GtkCssProvider *css_provider,
+                         GFile          *file,
+                         const char     *text)
+{
+  GtkCssProviderPrivate *priv = gtk_css_provider_get_instance_private (css_provider);
+  GArray *old_rulesets = NULL;
+  GHashTable *old_colors = NULL;
+  GHashTable *old_keyframes = NULL;
+  gboolean unchanged;
+  guint i;
+
+  /* With sections kept, the inspector wants to see the new ones */
+  if (gtk_keep_css_sections ||
+      priv->depends_on_files ||
+      gtk_css_provider_is_empty (css_provider))
+    {
+      gtk_css_provider_reset (css_provider);
+      gtk_css_provider_load_internal (css_provider, NULL, file, text);
+      gtk_style_provider_changed (GTK_STYLE_PROVIDER (css_provider));
+      return;
+    }
+
+  /* Keep the old contents around for comparing */
+  old_rulesets = priv->rulesets;
+  old_colors = priv->symbolic_colors;
+  old_keyframes = priv->keyframes;
+  priv->rulesets = g_array_new (FALSE, FALSE, sizeof (GtkCssRuleset));
+  priv->symbolic_colors = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                                 (GDestroyNotify) g_free,
+                                                 (GDestroyNotify) _gtk_css_value_unref);
+  priv->keyframes = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                           (GDestroyNotify) g_free,
+                                           (GDestroyNotify) _gtk_css_keyframes_unref);
+
+  gtk_css_provider_reset (css_provider);
+
+  gtk_css_provider_load_internal (css_provider, NULL, file, text);
+
+  unchanged = !priv->depends_on_files &&
+              gtk_css_rulesets_equal (old_rulesets, priv->rulesets) &&
+              gtk_css_colors_equal (old_colors, priv->symbolic_colors) &&
+              gtk_css_keyframes_equal (old_keyframes, priv->keyframes);
+
+  for (i = 0; i < old_rulesets->len; i++)
+    gtk_css_ruleset_clear (&g_array_index (old_rulesets, GtkCssRuleset, i));
+  g_array_free (old_rulesets, TRUE);
+  g_hash_table_unref (old_colors);
+  g_hash_table_unref (old_keyframes);
+
+  if (unchanged)
+    return;
+
+  gtk_style_provider_changed (GTK_STYLE_PROVIDER (css_provider));
 }
 
 /**
@@ -1368,13 +1588,9 @@ gtk_css_provider_load_from_data (GtkCssProvider  *css_provider,
       data = free_data;
     }
 
-  gtk_css_provider_reset (css_provider);
-
-  gtk_css_provider_load_internal (css_provider, NULL, NULL, data);
+  gtk_css_provider_reload (css_provider, NULL, data);
 
   g_free (free_data);
-
-  gtk_style_provider_changed (GTK_STYLE_PROVIDER (css_provider));
 }
 
 /**
@@ -1392,11 +1608,7 @@ gtk_css_provider_load_from_file (GtkCssProvider  *css_provider,
   g_return_if_fail (GTK_IS_CSS_PROVIDER (css_provider));
   g_return_if_fail (G_IS_FILE (file));
 
-  gtk_css_provider_reset (css_provider);
-
-  gtk_css_provider_load_internal (css_provider, NULL, file, NULL);
-
-  gtk_style_provider_changed (GTK_STYLE_PROVIDER (css_provider));
+  gtk_css_provider_reload (css_provider, file, NULL);
 }
 
 /**
@@ -19,6 +19,8 @@
 #define __GTK_CSS_PROVIDER_PRIVATE_H__
 
 #include "gtkcssprovider.h"
+#include "gtkcsslookupprivate.h"
+#include "gtkcssselectorprivate.h"
 
 G_BEGIN_DECLS
 
@@ -32,6 +34,13 @@ void   _gtk_css_provider_load_named    (GtkCssProvider *provider,
 
 void   gtk_css_provider_set_keep_css_sections (void);
 
+guint            gtk_css_provider_get_n_rulesets        (GtkCssProvider *provider);
+GtkCssSelector * gtk_css_provider_get_ruleset_selector  (GtkCssProvider *provider,
+                                                         guint           i);
+void             gtk_css_provider_lookup_ruleset        (GtkCssProvider *provider,
+                                                         guint           i,
+                                                         GtkCssLookup   *lookup);
+
 G_END_DECLS
 
 #endif /* __GTK_CSS_PROVIDER_PRIVATE_H__ */
@@ -50,6 +50,12 @@ gtk_css_value_rgba_equal (const GtkCssValue *rgba1,
   return gdk_rgba_equal (&rgba1->rgba, &rgba2->rgba);
 }
 
+static guint
+gtk_css_value_rgba_hash (const GtkCssValue *rgba)
+{
+  return gdk_rgba_hash (&rgba->rgba);
+}
+
 static inline double
 transition (double start,
             double end,
@@ -104,7 +110,8 @@ static const GtkCssValueClass GTK_CSS_VALUE_RGBA = {
   gtk_css_value_rgba_transition,
   NULL,
   NULL,
-  gtk_css_value_rgba_print
+  gtk_css_value_rgba_print,
+  gtk_css_value_rgba_hash
 };
 
 GtkCssValue *
@@ -117,7 +124,7 @@ _gtk_css_rgba_value_new_from_rgba (const GdkRGBA *rgba)
   value = _gtk_css_value_new (GtkCssValue, &GTK_CSS_VALUE_RGBA);
   value->rgba = *rgba;
 
-  return value;
+  return gtk_css_value_intern (value);
 }
 
 const GdkRGBA *
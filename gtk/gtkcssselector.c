@@ -23,6 +23,7 @@
 #include <string.h>
 
 #include "gtkcssprovider.h"
+#include "gtkcssstatsprivate.h"
 #include "gtkstylecontextprivate.h"
 
 #if defined(_MSC_VER) && _MSC_VER >= 1500
@@ -926,9 +927,9 @@ parse_selector_class (GtkCssParser   *parser,
                       GtkCssSelector *selector,
                       gboolean        negate)
 {
-  char *name;
+  const char *name;
     
-  name = _gtk_css_parser_try_name (parser, FALSE);
+  name = _gtk_css_parser_try_interned_name (parser, FALSE);
 
   if (name == NULL)
     {
@@ -941,9 +942,8 @@ parse_selector_class (GtkCssParser   *parser,
   selector = gtk_css_selector_new (negate ? &GTK_CSS_SELECTOR_NOT_CLASS
                                           : &GTK_CSS_SELECTOR_CLASS,
                                    selector);
-  selector->style_class.style_class = g_quark_from_string (name);
-
-  g_free (name);
+  /* interned strings live forever */
+  selector->style_class.style_class = g_quark_from_static_string (name);
 
   return selector;
 }
@@ -953,9 +953,9 @@ parse_selector_id (GtkCssParser   *parser,
                    GtkCssSelector *selector,
                    gboolean        negate)
 {
-  char *name;
+  const char *name;
     
-  name = _gtk_css_parser_try_name (parser, FALSE);
+  name = _gtk_css_parser_try_interned_name (parser, FALSE);
 
   if (name == NULL)
     {
@@ -968,9 +968,7 @@ parse_selector_id (GtkCssParser   *parser,
   selector = gtk_css_selector_new (negate ? &GTK_CSS_SELECTOR_NOT_ID
                                           : &GTK_CSS_SELECTOR_ID,
                                    selector);
-  selector->id.name = g_intern_string (name);
-
-  g_free (name);
+  selector->id.name = name;
 
   return selector;
 }
@@ -1169,15 +1167,14 @@ static GtkCssSelector *
 parse_selector_negation (GtkCssParser   *parser,
                          GtkCssSelector *selector)
 {
-  char *name;
+  const char *name;
 
-  name = _gtk_css_parser_try_ident (parser, FALSE);
+  name = _gtk_css_parser_try_interned_ident (parser, FALSE);
   if (name)
     {
       selector = gtk_css_selector_new (&GTK_CSS_SELECTOR_NOT_NAME,
                                        selector);
-      selector->name.name = g_intern_string (name);
-      g_free (name);
+      selector->name.name = name;
     }
   else if (_gtk_css_parser_try (parser, "*", FALSE))
     selector = gtk_css_selector_new (&GTK_CSS_SELECTOR_NOT_ANY, selector);
@@ -1213,14 +1210,13 @@ parse_simple_selector (GtkCssParser   *parser,
                        GtkCssSelector *selector)
 {
   gboolean parsed_something = FALSE;
-  char *name;
+  const char *name;
 
-  name = _gtk_css_parser_try_ident (parser, FALSE);
+  name = _gtk_css_parser_try_interned_ident (parser, FALSE);
   if (name)
     {
       selector = gtk_css_selector_new (&GTK_CSS_SELECTOR_NAME, selector);
-      selector->name.name = g_intern_string (name);
-      g_free (name);
+      selector->name.name = name;
       parsed_something = TRUE;
     }
   else if (_gtk_css_parser_try (parser, "*", FALSE))
@@ -1397,6 +1393,24 @@ _gtk_css_selector_compare (const GtkCssSelector *a,
   return a_elements - b_elements;
 }
 
+/* Unlike _gtk_css_selector_compare(), this checks that @a and @b are
+ * the same selector, not that they are equally specific */
+gboolean
+_gtk_css_selector_equal (const GtkCssSelector *a,
+                         const GtkCssSelector *b)
+{
+  while (a && b)
+    {
+      if (!gtk_css_selector_equal (a, b))
+        return FALSE;
+
+      a = gtk_css_selector_previous (a);
+      b = gtk_css_selector_previous (b);
+    }
+
+  return a == b;
+}
+
 GtkCssChange
 _gtk_css_selector_get_change (const GtkCssSelector *selector)
 {
@@ -1408,19 +1422,47 @@ _gtk_css_selector_get_change (const GtkCssSelector *selector)
 
 /******************** SelectorTree handling *****************/
 
+typedef struct {
+  GtkCssSelector selector;      /* the key, a copy so that infos can be modified */
+  guint          count;
+} GtkCssSelectorCount;
+
 static GHashTable *
 gtk_css_selectors_count_initial_init (void)
 {
-  return g_hash_table_new ((GHashFunc)gtk_css_selector_hash_one, (GEqualFunc)gtk_css_selector_equal);
+  return g_hash_table_new_full ((GHashFunc)gtk_css_selector_hash_one, (GEqualFunc)gtk_css_selector_equal, NULL, g_free);
 }
 
 static void
-gtk_css_selectors_count_initial (const GtkCssSelector *selector, GHashTable *hash_one)
+gtk_css_selector_count_add (GHashTable           *hash_one,
+                            const GtkCssSelector *selector,
+                            int                   delta)
+{
+  GtkCssSelectorCount *entry;
+
+  entry = g_hash_table_lookup (hash_one, selector);
+  if (entry == NULL)
+    {
+      g_assert (delta > 0);
+      entry = g_new (GtkCssSelectorCount, 1);
+      entry->selector = *selector;
+      entry->count = 0;
+      g_hash_table_insert (hash_one, &entry->selector, entry);
+    }
+
+  entry->count += delta;
+  if (entry->count == 0)
+    g_hash_table_remove (hash_one, &entry->selector);
+}
+
+static void
+gtk_css_selectors_count_initial (const GtkCssSelector *selector,
+                                 GHashTable           *hash_one,
+                                 int                   delta)
 {
   if (!selector->class->is_simple)
     {
-      guint count = GPOINTER_TO_INT (g_hash_table_lookup (hash_one, selector));
-      g_hash_table_replace (hash_one, (gpointer)selector, GUINT_TO_POINTER (count + 1));
+      gtk_css_selector_count_add (hash_one, selector, delta);
       return;
     }
 
@@ -1428,8 +1470,7 @@ gtk_css_selectors_count_initial (const GtkCssSelector *selector, GHashTable *has
        selector && selector->class->is_simple;
        selector = gtk_css_selector_previous (selector))
     {
-      guint count = GPOINTER_TO_INT (g_hash_table_lookup (hash_one, selector));
-      g_hash_table_replace (hash_one, (gpointer)selector, GUINT_TO_POINTER (count + 1));
+      gtk_css_selector_count_add (hash_one, selector, delta);
     }
 }
 
@@ -1476,38 +1517,137 @@ gtk_css_selectors_skip_initial_selector (GtkCssSelector *selector, const GtkCssS
   return (GtkCssSelector *)gtk_css_selector_previous (selector);
 }
 
+typedef struct {
+  const GtkCountingBloomFilter *filter;
+  GPtrArray *results;
+} GtkCssSelectorTreeMatchData;
+
+static inline gboolean
+gtk_css_selector_is_ancestor_combinator (const GtkCssSelector *selector)
+{
+  return selector->class == &GTK_CSS_SELECTOR_DESCENDANT ||
+         selector->class == &GTK_CSS_SELECTOR_CHILD;
+}
+
+/* Checks if the first simple selector of @tree can be matched by
+ * any of the ancestors recorded in @filter. A %FALSE return value is
+ * definite, a %TRUE return value needs to be confirmed by matching.
+ */
+static gboolean
+gtk_css_selector_tree_may_match_filter (const GtkCssSelectorTree     *tree,
+                                        const GtkCountingBloomFilter *filter)
+{
+  const GtkCssSelector *selector = &tree->selector;
+  guint32 hash;
+
+  if (selector->class == &GTK_CSS_SELECTOR_NAME)
+    hash = gtk_counting_bloom_filter_hash_pointer (selector->name.name, GTK_COUNTING_BLOOM_FILTER_SALT_NAME);
+  else if (selector->class == &GTK_CSS_SELECTOR_CLASS)
+    hash = gtk_counting_bloom_filter_hash_pointer (GUINT_TO_POINTER (selector->style_class.style_class), GTK_COUNTING_BLOOM_FILTER_SALT_CLASS);
+  else if (selector->class == &GTK_CSS_SELECTOR_ID)
+    hash = gtk_counting_bloom_filter_hash_pointer (selector->id.name, GTK_COUNTING_BLOOM_FILTER_SALT_ID);
+  else
+    return TRUE;
+
+  return gtk_counting_bloom_filter_may_contain (filter, hash);
+}
+
+/* Descendant and child combinators walk up the ancestors. If none of
+ * the selectors that follow them could match any ancestor, we don't
+ * need to walk at all.
+ */
+static gboolean
+gtk_css_selector_tree_may_match_ancestors (const GtkCssSelectorTree     *tree,
+                                           const GtkCountingBloomFilter *filter)
+{
+  const GtkCssSelectorTree *prev;
+
+  if (filter == NULL ||
+      !gtk_css_selector_is_ancestor_combinator (&tree->selector))
+    return TRUE;
+
+  for (prev = gtk_css_selector_tree_get_previous (tree);
+       prev != NULL;
+       prev = gtk_css_selector_tree_get_sibling (prev))
+    {
+      if (gtk_css_selector_tree_may_match_filter (prev, filter))
+        return TRUE;
+    }
+
+  return FALSE;
+}
+
 static gboolean
 gtk_css_selector_tree_match_foreach (const GtkCssSelector *selector,
                                      const GtkCssMatcher  *matcher,
                                      gpointer              res)
 {
+  GtkCssSelectorTreeMatchData *data = res;
   const GtkCssSelectorTree *tree = (const GtkCssSelectorTree *) selector;
   const GtkCssSelectorTree *prev;
+  gboolean check_filter;
+
+  gtk_css_stats.selector_matches++;
 
   if (!gtk_css_selector_match (selector, matcher))
     return FALSE;
 
-  gtk_css_selector_tree_found_match (tree, res);
+  gtk_css_selector_tree_found_match (tree, &data->results);
+
+  check_filter = data->filter != NULL && gtk_css_selector_is_ancestor_combinator (selector);
 
   for (prev = gtk_css_selector_tree_get_previous (tree);
        prev != NULL;
        prev = gtk_css_selector_tree_get_sibling (prev))
-    gtk_css_selector_foreach (&prev->selector, matcher, gtk_css_selector_tree_match_foreach, res);
+    {
+      if ((check_filter && !gtk_css_selector_tree_may_match_filter (prev, data->filter)) ||
+          !gtk_css_selector_tree_may_match_ancestors (prev, data->filter))
+        {
+          gtk_css_stats.selector_rejects++;
+          continue;
+        }
+
+      gtk_css_selector_foreach (&prev->selector, matcher, gtk_css_selector_tree_match_foreach, res);
+    }
 
   return FALSE;
 }
 
+/**
+ * _gtk_css_selector_tree_match_all:
+ * @tree: the selector tree
+ * @filter: (nullable): a bloom filter of the names, classes and IDs
+ *     of all ancestors of the node being matched, or %NULL
+ * @matcher: the matcher for the node
+ *
+ * Collects all rulesets whose selectors match @matcher.
+ *
+ * If @filter is given, it must contain (at least) all ancestors that
+ * @matcher can reach through its parent chain. It is used to skip
+ * descendant and child selectors that can't possibly match.
+ *
+ * Returns: (nullable): the matching rulesets, sorted, or %NULL
+ **/
 GPtrArray *
-_gtk_css_selector_tree_match_all (const GtkCssSelectorTree *tree,
-				  const GtkCssMatcher *matcher)
+_gtk_css_selector_tree_match_all (const GtkCssSelectorTree     *tree,
+                                  const GtkCountingBloomFilter *filter,
+				  const GtkCssMatcher          *matcher)
 {
-  GPtrArray *array = NULL;
+  GtkCssSelectorTreeMatchData data = { filter, NULL };
 
   for (; tree != NULL;
        tree = gtk_css_selector_tree_get_sibling (tree))
-    gtk_css_selector_foreach (&tree->selector, matcher, gtk_css_selector_tree_match_foreach, &array);
+    {
+      if (!gtk_css_selector_tree_may_match_ancestors (tree, filter))
+        {
+          gtk_css_stats.selector_rejects++;
+          continue;
+        }
 
-  return array;
+      gtk_css_selector_foreach (&tree->selector, matcher, gtk_css_selector_tree_match_foreach, &data);
+    }
+
+  return data.results;
 }
 
 /* When checking for changes via the tree we need to know if a rule further
@@ -1709,101 +1849,124 @@ subdivide_infos (GByteArray *array, GList *infos, gint32 parent_offset)
   GList *l;
   GList *matched;
   GList *remaining;
+  GList *unmatched;
   gint32 tree_offset;
+  gint32 first_offset;
+  gint32 previous_sibling;
   GtkCssSelectorTree *tree;
   GtkCssSelectorRuleSetInfo *info;
   GtkCssSelector max_selector;
   GHashTableIter iter;
   guint max_count;
-  gpointer key, value;
+  gpointer value;
   GPtrArray *exact_matches;
   gint32 res;
 
   if (infos == NULL)
     return GTK_CSS_SELECTOR_TREE_EMPTY_OFFSET;
 
+  /* Count once for this level and only subtract the infos that get moved
+   * into a subtree, instead of recounting the remaining infos for every
+   * sibling. This used to make building the tree quadratic in the number
+   * of distinct selectors at a level. */
   ht = gtk_css_selectors_count_initial_init ();
 
   for (l = infos; l != NULL; l = l->next)
     {
       info = l->data;
-      gtk_css_selectors_count_initial (info->current_selector, ht);
+      gtk_css_selectors_count_initial (info->current_selector, ht, 1);
     }
 
-  /* Pick the selector with highest count, and use as decision on this level
-     as that makes it possible to skip the largest amount of checks later */
+  first_offset = GTK_CSS_SELECTOR_TREE_EMPTY_OFFSET;
+  previous_sibling = GTK_CSS_SELECTOR_TREE_EMPTY_OFFSET;
+  remaining = infos;
 
-  max_count = 0;
-
-  g_hash_table_iter_init (&iter, ht);
-  while (g_hash_table_iter_next (&iter, &key, &value))
+  while (remaining)
     {
-      GtkCssSelector *selector = key;
-      if (GPOINTER_TO_UINT (value) > max_count ||
-	  (GPOINTER_TO_UINT (value) == max_count &&
-	  gtk_css_selector_compare_one (selector, &max_selector) < 0))
-	{
-	  max_count = GPOINTER_TO_UINT (value);
-	  max_selector = *selector;
-	}
-    }
+      /* Pick the selector with highest count, and use as decision on this level
+         as that makes it possible to skip the largest amount of checks later */
 
-  matched = NULL;
-  remaining = NULL;
+      max_count = 0;
 
-  tree = alloc_tree (array, &tree_offset);
-  tree->parent_offset = parent_offset;
-  tree->selector = max_selector;
+      g_hash_table_iter_init (&iter, ht);
+      while (g_hash_table_iter_next (&iter, NULL, &value))
+        {
+          GtkCssSelectorCount *entry = value;
+          if (entry->count > max_count ||
+              (entry->count == max_count &&
+              gtk_css_selector_compare_one (&entry->selector, &max_selector) < 0))
+            {
+              max_count = entry->count;
+              max_selector = entry->selector;
+            }
+        }
 
-  exact_matches = NULL;
-  for (l = infos; l != NULL; l = l->next)
-    {
-      info = l->data;
+      matched = NULL;
+      unmatched = NULL;
 
-      if (gtk_css_selectors_has_initial_selector (info->current_selector, &max_selector))
-	{
-	  info->current_selector = gtk_css_selectors_skip_initial_selector (info->current_selector, &max_selector);
-	  if (info->current_selector == NULL)
-	    {
-	      /* Matches current node */
-	      if (exact_matches == NULL)
-		exact_matches = g_ptr_array_new ();
-	      g_ptr_array_add (exact_matches, info->match);
-	      if (info->selector_match != NULL)
-		*info->selector_match = GUINT_TO_POINTER (tree_offset);
-	    }
-	  else
-	    matched = g_list_prepend (matched, info);
-	}
+      tree = alloc_tree (array, &tree_offset);
+      tree->parent_offset = parent_offset;
+      tree->selector = max_selector;
+      tree->sibling_offset = GTK_CSS_SELECTOR_TREE_EMPTY_OFFSET;
+
+      if (previous_sibling == GTK_CSS_SELECTOR_TREE_EMPTY_OFFSET)
+        first_offset = tree_offset;
       else
-	{
-	  remaining = g_list_prepend (remaining, info);
-	}
-    }
+        get_tree (array, previous_sibling)->sibling_offset = tree_offset;
 
-  if (exact_matches)
-    {
-      g_ptr_array_add (exact_matches, NULL); /* Null terminate */
-      res = array->len;
-      g_byte_array_append (array, (guint8 *)exact_matches->pdata,
-			   exact_matches->len * sizeof (gpointer));
-      g_ptr_array_free (exact_matches, TRUE);
-    }
-  else
-    res = GTK_CSS_SELECTOR_TREE_EMPTY_OFFSET;
-  get_tree (array, tree_offset)->matches_offset = res;
+      exact_matches = NULL;
+      for (l = remaining; l != NULL; l = l->next)
+        {
+          info = l->data;
+
+          if (gtk_css_selectors_has_initial_selector (info->current_selector, &max_selector))
+            {
+              gtk_css_selectors_count_initial (info->current_selector, ht, -1);
 
-  res = subdivide_infos (array, matched, tree_offset);
-  get_tree (array, tree_offset)->previous_offset = res;
+              info->current_selector = gtk_css_selectors_skip_initial_selector (info->current_selector, &max_selector);
+              if (info->current_selector == NULL)
+                {
+                  /* Matches current node */
+                  if (exact_matches == NULL)
+                    exact_matches = g_ptr_array_new ();
+                  g_ptr_array_add (exact_matches, info->match);
+                  if (info->selector_match != NULL)
+                    *info->selector_match = GUINT_TO_POINTER (tree_offset);
+                }
+              else
+                matched = g_list_prepend (matched, info);
+            }
+          else
+            {
+              unmatched = g_list_prepend (unmatched, info);
+            }
+        }
 
-  res = subdivide_infos (array, remaining, parent_offset);
-  get_tree (array, tree_offset)->sibling_offset = res;
+      if (exact_matches)
+        {
+          g_ptr_array_add (exact_matches, NULL); /* Null terminate */
+          res = array->len;
+          g_byte_array_append (array, (guint8 *)exact_matches->pdata,
+                               exact_matches->len * sizeof (gpointer));
+          g_ptr_array_free (exact_matches, TRUE);
+        }
+      else
+        res = GTK_CSS_SELECTOR_TREE_EMPTY_OFFSET;
+      get_tree (array, tree_offset)->matches_offset = res;
+
+      res = subdivide_infos (array, matched, tree_offset);
+      get_tree (array, tree_offset)->previous_offset = res;
+
+      g_list_free (matched);
+      if (remaining != infos)
+        g_list_free (remaining);
+      remaining = unmatched;
+      previous_sibling = tree_offset;
+    }
 
-  g_list_free (matched);
-  g_list_free (remaining);
   g_hash_table_unref (ht);
 
-  return tree_offset;
+  return first_offset;
 }
 
 struct _GtkCssSelectorTreeBuilder {
@@ -290,7 +290,8 @@ gtk_css_shadows_value_get_shadows (const GtkCssValue  *shadows,
 void
 gtk_css_shadows_value_snapshot_outset (const GtkCssValue   *shadows,
                                        GtkSnapshot         *snapshot,
-                                       const GskRoundedRect*border_box)
+                                       const GskRoundedRect*border_box,
+                                       int                  scale)
 {
   guint i;
 
@@ -301,7 +302,7 @@ gtk_css_shadows_value_snapshot_outset (const GtkCssValue   *shadows,
       if (_gtk_css_shadow_value_get_inset (shadows->values[i]))
         continue;
 
-      gtk_css_shadow_value_snapshot_outset (shadows->values[i], snapshot, border_box);
+      gtk_css_shadow_value_snapshot_outset (shadows->values[i], snapshot, border_box, scale);
     }
 }
 
@@ -43,7 +43,8 @@ void            gtk_css_shadows_value_get_shadows    (const GtkCssValue        *
 
 void            gtk_css_shadows_value_snapshot_outset (const GtkCssValue        *shadows,
                                                        GtkSnapshot              *snapshot,
-                                                       const GskRoundedRect     *border_box);
+                                                       const GskRoundedRect     *border_box,
+                                                       int                       scale);
 void            gtk_css_shadows_value_snapshot_inset  (const GtkCssValue        *shadows,
                                                        GtkSnapshot              *snapshot,
                                                        const GskRoundedRect     *padding_box);
@@ -32,6 +32,7 @@
 #include "gsk/gskroundedrectprivate.h"
 
 #include <math.h>
+#include <string.h>
 
 struct _GtkCssValue {
   GTK_CSS_VALUE_BASE
@@ -109,6 +110,20 @@ gtk_css_value_shadow_equal (const GtkCssValue *shadow1,
       && _gtk_css_value_equal (shadow1->color, shadow2->color);
 }
 
+static guint
+gtk_css_value_shadow_hash (const GtkCssValue *shadow)
+{
+  guint hash;
+
+  hash = gtk_css_value_hash (shadow->hoffset);
+  hash = hash * 31 + gtk_css_value_hash (shadow->voffset);
+  hash = hash * 31 + gtk_css_value_hash (shadow->radius);
+  hash = hash * 31 + gtk_css_value_hash (shadow->spread);
+  hash = hash * 31 + gtk_css_value_hash (shadow->color);
+
+  return hash ^ shadow->inset;
+}
+
 static GtkCssValue *
 gtk_css_value_shadow_transition (GtkCssValue *start,
                                  GtkCssValue *end,
@@ -161,7 +176,8 @@ static const GtkCssValueClass GTK_CSS_VALUE_SHADOW = {
   gtk_css_value_shadow_transition,
   NULL,
   NULL,
-  gtk_css_value_shadow_print
+  gtk_css_value_shadow_print,
+  gtk_css_value_shadow_hash
 };
 
 static GtkCssValue *
@@ -183,7 +199,7 @@ gtk_css_shadow_value_new (GtkCssValue *hoffset,
   retval->inset = inset;
   retval->color = color;
 
-  return retval;
+  return gtk_css_value_intern (retval);
 }
 
 GtkCssValue *
@@ -344,10 +360,276 @@ gtk_css_shadow_value_get_shadow (const GtkCssValue *value,
   shadow->radius = _gtk_css_number_value_get (value->radius, 0);
 }
 
+/* Blurring is expensive, and the same shadows get drawn over and over,
+ * only around boxes of different sizes. So for blurred outset shadows
+ * we render the shadow of a box that is just large enough once and
+ * then draw the shadow of any larger box with the same corners as a
+ * nine-slice of that image. The middle slices are 1 pixel wide and
+ * get stretched, the center is inside the box and never drawn.
+ * The image is rendered at the window scale, so the cache is keyed
+ * on it as well.
+ */
+#define SHADOW_SLICES_CACHE_SIZE 8
+
+typedef struct _ShadowSlices ShadowSlices;
+
+struct _ShadowSlices {
+  graphene_size_t corner[4];
+  GdkRGBA color;
+  double radius;
+  int scale;
+
+  /* sizes of the corner slices, in application pixels */
+  int left;
+  int right;
+  int top;
+  int bottom;
+
+  GdkTexture *slices[9];
+};
+
+static ShadowSlices shadow_slices_cache[SHADOW_SLICES_CACHE_SIZE];
+static guint n_shadow_slices;
+
+static gboolean
+shadow_slices_matches (const ShadowSlices   *slices,
+                       const GskRoundedRect *box,
+                       const GdkRGBA        *color,
+                       double                radius,
+                       int                   scale)
+{
+  guint i;
+
+  if (slices->radius != radius ||
+      slices->scale != scale ||
+      !gdk_rgba_equal (&slices->color, color))
+    return FALSE;
+
+  for (i = 0; i < 4; i++)
+    {
+      if (!graphene_size_equal (&slices->corner[i], &box->corner[i]))
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
+static void
+shadow_slices_clear (ShadowSlices *slices)
+{
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (slices->slices); i++)
+    g_clear_object (&slices->slices[i]);
+}
+
+/* Everything within the blur extents of a curved corner is different,
+ * past that the shadow is the same all along the side. */
+static void
+shadow_slices_get_sizes (const GskRoundedRect *box,
+                         double                radius,
+                         int                  *left,
+                         int                  *right,
+                         int                  *top,
+                         int                  *bottom)
+{
+  int extents = ceil (gsk_cairo_blur_compute_pixels (radius));
+
+  *left = 2 * extents + ceil (MAX (box->corner[GSK_CORNER_TOP_LEFT].width, box->corner[GSK_CORNER_BOTTOM_LEFT].width));
+  *right = 2 * extents + ceil (MAX (box->corner[GSK_CORNER_TOP_RIGHT].width, box->corner[GSK_CORNER_BOTTOM_RIGHT].width));
+  *top = 2 * extents + ceil (MAX (box->corner[GSK_CORNER_TOP_LEFT].height, box->corner[GSK_CORNER_TOP_RIGHT].height));
+  *bottom = 2 * extents + ceil (MAX (box->corner[GSK_CORNER_BOTTOM_LEFT].height, box->corner[GSK_CORNER_BOTTOM_RIGHT].height));
+}
+
+static void
+shadow_slices_init (ShadowSlices         *slices,
+                    const GskRoundedRect *box,
+                    const GdkRGBA        *color,
+                    double                radius,
+                    int                   scale)
+{
+  GskRenderNode *node;
+  GskRoundedRect outline;
+  cairo_surface_t *surface;
+  cairo_t *cr;
+  GBytes *bytes;
+  int extents, width, height, stride;
+  int x[4], y[4];
+  guint i, j;
+
+  for (i = 0; i < 4; i++)
+    slices->corner[i] = box->corner[i];
+  slices->color = *color;
+  slices->radius = radius;
+  slices->scale = scale;
+
+  extents = ceil (gsk_cairo_blur_compute_pixels (radius));
+  shadow_slices_get_sizes (box, radius,
+                           &slices->left, &slices->right,
+                           &slices->top, &slices->bottom);
+
+  width = slices->left + 1 + slices->right;
+  height = slices->top + 1 + slices->bottom;
+
+  gsk_rounded_rect_init (&outline,
+                         &GRAPHENE_RECT_INIT (extents, extents, width - 2 * extents, height - 2 * extents),
+                         &box->corner[GSK_CORNER_TOP_LEFT],
+                         &box->corner[GSK_CORNER_TOP_RIGHT],
+                         &box->corner[GSK_CORNER_BOTTOM_RIGHT],
+                         &box->corner[GSK_CORNER_BOTTOM_LEFT]);
+  node = gsk_outset_shadow_node_new (&outline, color, 0, 0, 0, radius);
+
+  surface = cairo_image_surface_create (CAIRO_FORMAT_ARGB32, width * scale, height * scale);
+  cairo_surface_set_device_scale (surface, scale, scale);
+  cr = cairo_create (surface);
+  gsk_render_node_draw (node, cr);
+  cairo_destroy (cr);
+  gsk_render_node_unref (node);
+
+  cairo_surface_flush (surface);
+  stride = cairo_image_surface_get_stride (surface);
+  bytes = g_bytes_new (cairo_image_surface_get_data (surface), stride * height * scale);
+  cairo_surface_destroy (surface);
+
+  x[0] = 0;
+  x[1] = slices->left * scale;
+  x[2] = (slices->left + 1) * scale;
+  x[3] = width * scale;
+  y[0] = 0;
+  y[1] = slices->top * scale;
+  y[2] = (slices->top + 1) * scale;
+  y[3] = height * scale;
+
+  /* All slices share the pixels of the whole image */
+  for (i = 0; i < 3; i++)
+    for (j = 0; j < 3; j++)
+      {
+        GBytes *slice_bytes;
+        int w = x[j + 1] - x[j];
+        int h = y[i + 1] - y[i];
+
+        if (i == 1 && j == 1)
+          {
+            slices->slices[4] = NULL;
+            continue;
+          }
+
+        slice_bytes = g_bytes_new_from_bytes (bytes,
+                                              y[i] * stride + x[j] * 4,
+                                              (h - 1) * stride + w * 4);
+        slices->slices[3 * i + j] = gdk_memory_texture_new (w, h,
+                                                            GDK_MEMORY_DEFAULT,
+                                                            slice_bytes,
+                                                            stride);
+        g_bytes_unref (slice_bytes);
+      }
+
+  g_bytes_unref (bytes);
+}
+
+static const ShadowSlices *
+shadow_slices_lookup (const GskRoundedRect *box,
+                      const GdkRGBA        *color,
+                      double                radius,
+                      int                   scale)
+{
+  ShadowSlices found;
+  guint i;
+
+  for (i = 0; i < n_shadow_slices; i++)
+    {
+      if (shadow_slices_matches (&shadow_slices_cache[i], box, color, radius, scale))
+        break;
+    }
+
+  if (i < n_shadow_slices)
+    {
+      found = shadow_slices_cache[i];
+    }
+  else
+    {
+      if (n_shadow_slices < SHADOW_SLICES_CACHE_SIZE)
+        n_shadow_slices++;
+      else
+        shadow_slices_clear (&shadow_slices_cache[SHADOW_SLICES_CACHE_SIZE - 1]);
+
+      i = n_shadow_slices - 1;
+      shadow_slices_init (&found, box, color, radius, scale);
+    }
+
+  /* Keep the most recently used ones in front */
+  memmove (&shadow_slices_cache[1], &shadow_slices_cache[0], i * sizeof (ShadowSlices));
+  shadow_slices_cache[0] = found;
+
+  return &shadow_slices_cache[0];
+}
+
+static gboolean
+gtk_css_shadow_value_snapshot_outset_sliced (const GtkCssValue    *shadow,
+                                             GtkSnapshot          *snapshot,
+                                             const GskRoundedRect *border_box,
+                                             int                   scale)
+{
+  const ShadowSlices *slices;
+  GskRoundedRect box;
+  double radius, spread, extents;
+  int left, right, top, bottom;
+  float x[4], y[4];
+  guint i, j;
+
+  radius = _gtk_css_number_value_get (shadow->radius, 0);
+  if (radius <= 0)
+    return FALSE;
+
+  spread = _gtk_css_number_value_get (shadow->spread, 0);
+  extents = ceil (gsk_cairo_blur_compute_pixels (radius));
+
+  gsk_rounded_rect_init_copy (&box, border_box);
+  gsk_rounded_rect_shrink (&box, -spread, -spread, -spread, -spread);
+  gsk_rounded_rect_offset (&box,
+                           _gtk_css_number_value_get (shadow->hoffset, 0),
+                           _gtk_css_number_value_get (shadow->voffset, 0));
+
+  shadow_slices_get_sizes (&box, radius, &left, &right, &top, &bottom);
+
+  x[0] = box.bounds.origin.x - extents;
+  x[3] = box.bounds.origin.x + box.bounds.size.width + extents;
+  x[1] = x[0] + left;
+  x[2] = x[3] - right;
+  y[0] = box.bounds.origin.y - extents;
+  y[3] = box.bounds.origin.y + box.bounds.size.height + extents;
+  y[1] = y[0] + top;
+  y[2] = y[3] - bottom;
+
+  /* The box is too small for the straight parts of the sides */
+  if (x[2] - x[1] < 1 || y[2] - y[1] < 1)
+    return FALSE;
+
+  slices = shadow_slices_lookup (&box, _gtk_css_rgba_value_get_rgba (shadow->color), radius, MAX (scale, 1));
+
+  gtk_snapshot_push_debug (snapshot, "Sliced outset shadow");
+
+  for (i = 0; i < 3; i++)
+    for (j = 0; j < 3; j++)
+      {
+        if (slices->slices[3 * i + j] == NULL)
+          continue;
+
+        gtk_snapshot_append_texture (snapshot,
+                                     slices->slices[3 * i + j],
+                                     &GRAPHENE_RECT_INIT (x[j], y[i], x[j + 1] - x[j], y[i + 1] - y[i]));
+      }
+
+  gtk_snapshot_pop (snapshot);
+
+  return TRUE;
+}
+
 void
 gtk_css_shadow_value_snapshot_outset (const GtkCssValue    *shadow,
                                       GtkSnapshot          *snapshot,
-                                      const GskRoundedRect *border_box)
+                                      const GskRoundedRect *border_box,
+                                      int                   scale)
 {
   g_return_if_fail (shadow->class == &GTK_CSS_VALUE_SHADOW);
 
@@ -355,6 +637,9 @@ gtk_css_shadow_value_snapshot_outset (const GtkCssValue    *shadow,
   if (gdk_rgba_is_clear (_gtk_css_rgba_value_get_rgba (shadow->color)))
     return;
 
+  if (gtk_css_shadow_value_snapshot_outset_sliced (shadow, snapshot, border_box, scale))
+    return;
+
   gtk_snapshot_append_outset_shadow (snapshot,
                                      border_box,
                                      _gtk_css_rgba_value_get_rgba (shadow->color),
@@ -47,7 +47,8 @@ void            _gtk_css_shadow_value_paint_icon      (const GtkCssValue
 
 void            gtk_css_shadow_value_snapshot_outset  (const GtkCssValue        *shadow,
                                                        GtkSnapshot              *snapshot,
-                                                       const GskRoundedRect     *border_box);
+                                                       const GskRoundedRect     *border_box,
+                                                       int                       scale);
 void            gtk_css_shadow_value_snapshot_inset   (const GtkCssValue        *shadow,
                                                        GtkSnapshot              *snapshot,
                                                        const GskRoundedRect     *padding_box);
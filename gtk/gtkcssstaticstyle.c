@@ -29,6 +29,7 @@
 #include "gtkcssnumbervalueprivate.h"
 #include "gtkcsssectionprivate.h"
 #include "gtkcssshorthandpropertyprivate.h"
+#include "gtkcssstatsprivate.h"
 #include "gtkcssstringvalueprivate.h"
 #include "gtkcssstylepropertyprivate.h"
 #include "gtkcsstransitionprivate.h"
@@ -41,14 +42,266 @@
 
 G_DEFINE_TYPE (GtkCssStaticStyle, gtk_css_static_style, GTK_TYPE_CSS_STYLE)
 
+struct _GtkCssValues
+{
+  guint         ref_count;
+  guint         n_values;
+  GtkCssValue  *values[1];
+};
+
+static const guint core_props[] = {
+  GTK_CSS_PROPERTY_COLOR,
+  GTK_CSS_PROPERTY_DPI,
+  GTK_CSS_PROPERTY_FONT_SIZE,
+  GTK_CSS_PROPERTY_ICON_THEME,
+  GTK_CSS_PROPERTY_ICON_PALETTE
+};
+
+static const guint font_props[] = {
+  GTK_CSS_PROPERTY_FONT_FAMILY,
+  GTK_CSS_PROPERTY_FONT_STYLE,
+  GTK_CSS_PROPERTY_FONT_WEIGHT,
+  GTK_CSS_PROPERTY_FONT_STRETCH,
+  GTK_CSS_PROPERTY_LETTER_SPACING,
+  GTK_CSS_PROPERTY_TEXT_SHADOW,
+  GTK_CSS_PROPERTY_CARET_COLOR,
+  GTK_CSS_PROPERTY_SECONDARY_CARET_COLOR,
+  GTK_CSS_PROPERTY_FONT_FEATURE_SETTINGS,
+  GTK_CSS_PROPERTY_FONT_VARIATION_SETTINGS
+};
+
+static const guint icon_props[] = {
+  GTK_CSS_PROPERTY_ICON_SIZE,
+  GTK_CSS_PROPERTY_ICON_SHADOW,
+  GTK_CSS_PROPERTY_ICON_STYLE
+};
+
+static const guint font_variant_props[] = {
+  GTK_CSS_PROPERTY_TEXT_DECORATION_LINE,
+  GTK_CSS_PROPERTY_TEXT_DECORATION_COLOR,
+  GTK_CSS_PROPERTY_TEXT_DECORATION_STYLE,
+  GTK_CSS_PROPERTY_FONT_KERNING,
+  GTK_CSS_PROPERTY_FONT_VARIANT_LIGATURES,
+  GTK_CSS_PROPERTY_FONT_VARIANT_POSITION,
+  GTK_CSS_PROPERTY_FONT_VARIANT_CAPS,
+  GTK_CSS_PROPERTY_FONT_VARIANT_NUMERIC,
+  GTK_CSS_PROPERTY_FONT_VARIANT_ALTERNATES,
+  GTK_CSS_PROPERTY_FONT_VARIANT_EAST_ASIAN
+};
+
+static const guint background_props[] = {
+  GTK_CSS_PROPERTY_BACKGROUND_COLOR,
+  GTK_CSS_PROPERTY_BOX_SHADOW,
+  GTK_CSS_PROPERTY_BACKGROUND_CLIP,
+  GTK_CSS_PROPERTY_BACKGROUND_ORIGIN,
+  GTK_CSS_PROPERTY_BACKGROUND_SIZE,
+  GTK_CSS_PROPERTY_BACKGROUND_POSITION,
+  GTK_CSS_PROPERTY_BACKGROUND_REPEAT,
+  GTK_CSS_PROPERTY_BACKGROUND_IMAGE,
+  GTK_CSS_PROPERTY_BACKGROUND_BLEND_MODE
+};
+
+static const guint border_props[] = {
+  GTK_CSS_PROPERTY_BORDER_TOP_STYLE,
+  GTK_CSS_PROPERTY_BORDER_TOP_WIDTH,
+  GTK_CSS_PROPERTY_BORDER_LEFT_STYLE,
+  GTK_CSS_PROPERTY_BORDER_LEFT_WIDTH,
+  GTK_CSS_PROPERTY_BORDER_BOTTOM_STYLE,
+  GTK_CSS_PROPERTY_BORDER_BOTTOM_WIDTH,
+  GTK_CSS_PROPERTY_BORDER_RIGHT_STYLE,
+  GTK_CSS_PROPERTY_BORDER_RIGHT_WIDTH,
+  GTK_CSS_PROPERTY_BORDER_TOP_LEFT_RADIUS,
+  GTK_CSS_PROPERTY_BORDER_TOP_RIGHT_RADIUS,
+  GTK_CSS_PROPERTY_BORDER_BOTTOM_RIGHT_RADIUS,
+  GTK_CSS_PROPERTY_BORDER_BOTTOM_LEFT_RADIUS,
+  GTK_CSS_PROPERTY_BORDER_TOP_COLOR,
+  GTK_CSS_PROPERTY_BORDER_RIGHT_COLOR,
+  GTK_CSS_PROPERTY_BORDER_BOTTOM_COLOR,
+  GTK_CSS_PROPERTY_BORDER_LEFT_COLOR,
+  GTK_CSS_PROPERTY_BORDER_IMAGE_SOURCE,
+  GTK_CSS_PROPERTY_BORDER_IMAGE_REPEAT,
+  GTK_CSS_PROPERTY_BORDER_IMAGE_SLICE,
+  GTK_CSS_PROPERTY_BORDER_IMAGE_WIDTH
+};
+
+static const guint outline_props[] = {
+  GTK_CSS_PROPERTY_OUTLINE_STYLE,
+  GTK_CSS_PROPERTY_OUTLINE_WIDTH,
+  GTK_CSS_PROPERTY_OUTLINE_OFFSET,
+  GTK_CSS_PROPERTY_OUTLINE_TOP_LEFT_RADIUS,
+  GTK_CSS_PROPERTY_OUTLINE_TOP_RIGHT_RADIUS,
+  GTK_CSS_PROPERTY_OUTLINE_BOTTOM_RIGHT_RADIUS,
+  GTK_CSS_PROPERTY_OUTLINE_BOTTOM_LEFT_RADIUS,
+  GTK_CSS_PROPERTY_OUTLINE_COLOR
+};
+
+static const guint size_props[] = {
+  GTK_CSS_PROPERTY_MARGIN_TOP,
+  GTK_CSS_PROPERTY_MARGIN_LEFT,
+  GTK_CSS_PROPERTY_MARGIN_BOTTOM,
+  GTK_CSS_PROPERTY_MARGIN_RIGHT,
+  GTK_CSS_PROPERTY_PADDING_TOP,
+  GTK_CSS_PROPERTY_PADDING_LEFT,
+  GTK_CSS_PROPERTY_PADDING_BOTTOM,
+  GTK_CSS_PROPERTY_PADDING_RIGHT,
+  GTK_CSS_PROPERTY_BORDER_SPACING,
+  GTK_CSS_PROPERTY_MIN_WIDTH,
+  GTK_CSS_PROPERTY_MIN_HEIGHT
+};
+
+static const guint transition_props[] = {
+  GTK_CSS_PROPERTY_TRANSITION_PROPERTY,
+  GTK_CSS_PROPERTY_TRANSITION_DURATION,
+  GTK_CSS_PROPERTY_TRANSITION_TIMING_FUNCTION,
+  GTK_CSS_PROPERTY_TRANSITION_DELAY
+};
+
+static const guint animation_props[] = {
+  GTK_CSS_PROPERTY_ANIMATION_NAME,
+  GTK_CSS_PROPERTY_ANIMATION_DURATION,
+  GTK_CSS_PROPERTY_ANIMATION_TIMING_FUNCTION,
+  GTK_CSS_PROPERTY_ANIMATION_ITERATION_COUNT,
+  GTK_CSS_PROPERTY_ANIMATION_DIRECTION,
+  GTK_CSS_PROPERTY_ANIMATION_PLAY_STATE,
+  GTK_CSS_PROPERTY_ANIMATION_DELAY,
+  GTK_CSS_PROPERTY_ANIMATION_FILL_MODE
+};
+
+static const guint other_props[] = {
+  GTK_CSS_PROPERTY_ICON_SOURCE,
+  GTK_CSS_PROPERTY_ICON_TRANSFORM,
+  GTK_CSS_PROPERTY_ICON_FILTER,
+  GTK_CSS_PROPERTY_TRANSFORM,
+  GTK_CSS_PROPERTY_OPACITY,
+  GTK_CSS_PROPERTY_FILTER
+};
+
+static const struct {
+  const guint *ids;
+  guint        n_ids;
+} group_props[GTK_CSS_N_VALUES_GROUPS] = {
+  [GTK_CSS_CORE_VALUES]         = { core_props, G_N_ELEMENTS (core_props) },
+  [GTK_CSS_FONT_VALUES]         = { font_props, G_N_ELEMENTS (font_props) },
+  [GTK_CSS_ICON_VALUES]         = { icon_props, G_N_ELEMENTS (icon_props) },
+  [GTK_CSS_FONT_VARIANT_VALUES] = { font_variant_props, G_N_ELEMENTS (font_variant_props) },
+  [GTK_CSS_BACKGROUND_VALUES]   = { background_props, G_N_ELEMENTS (background_props) },
+  [GTK_CSS_BORDER_VALUES]       = { border_props, G_N_ELEMENTS (border_props) },
+  [GTK_CSS_OUTLINE_VALUES]      = { outline_props, G_N_ELEMENTS (outline_props) },
+  [GTK_CSS_SIZE_VALUES]         = { size_props, G_N_ELEMENTS (size_props) },
+  [GTK_CSS_TRANSITION_VALUES]   = { transition_props, G_N_ELEMENTS (transition_props) },
+  [GTK_CSS_ANIMATION_VALUES]    = { animation_props, G_N_ELEMENTS (animation_props) },
+  [GTK_CSS_OTHER_VALUES]        = { other_props, G_N_ELEMENTS (other_props) },
+};
+
+/* filled in class_init from group_props */
+static guint8 property_group[GTK_CSS_PROPERTY_N_PROPERTIES];
+static guint8 property_index[GTK_CSS_PROPERTY_N_PROPERTIES];
+static gboolean group_inherited[GTK_CSS_N_VALUES_GROUPS];
+
+/*
+ * gtk_css_static_style_get_group_properties:
+ * @group: a #GtkCssValuesGroup
+ * @n_ids: (out): return location for the number of properties
+ *
+ * Returns: the ids of the properties stored in @group
+ */
+const guint *
+gtk_css_static_style_get_group_properties (GtkCssValuesGroup  group,
+                                           guint             *n_ids)
+{
+  *n_ids = group_props[group].n_ids;
+
+  return group_props[group].ids;
+}
+
+static GtkCssValues *
+gtk_css_values_new (GtkCssValuesGroup group)
+{
+  GtkCssValues *values;
+  guint n_values = group_props[group].n_ids;
+
+  values = g_malloc0 (sizeof (GtkCssValues) + (n_values - 1) * sizeof (GtkCssValue *));
+  values->ref_count = 1;
+  values->n_values = n_values;
+
+  return values;
+}
+
+static GtkCssValues *
+gtk_css_values_ref (GtkCssValues *values)
+{
+  values->ref_count++;
+
+  return values;
+}
+
+static void
+gtk_css_values_unref (GtkCssValues *values)
+{
+  guint i;
+
+  values->ref_count--;
+  if (values->ref_count > 0)
+    return;
+
+  for (i = 0; i < values->n_values; i++)
+    {
+      if (values->values[i])
+        _gtk_css_value_unref (values->values[i]);
+    }
+
+  g_free (values);
+}
+
+static GtkCssValues *
+gtk_css_values_copy (const GtkCssValues *values)
+{
+  GtkCssValues *copy;
+  guint i;
+
+  copy = g_malloc (sizeof (GtkCssValues) + (values->n_values - 1) * sizeof (GtkCssValue *));
+  copy->ref_count = 1;
+  copy->n_values = values->n_values;
+
+  for (i = 0; i < values->n_values; i++)
+    {
+      copy->values[i] = values->values[i];
+      if (copy->values[i])
+        _gtk_css_value_ref (copy->values[i]);
+    }
+
+  return copy;
+}
+
+static gboolean
+gtk_css_values_equal (const GtkCssValues *values1,
+                      const GtkCssValues *values2)
+{
+  guint i;
+
+  for (i = 0; i < values1->n_values; i++)
+    {
+      /* Inherited values are refs of the parent's value, so pointer
+       * equality catches the common case. */
+      if (values1->values[i] != values2->values[i])
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
 static GtkCssValue *
 gtk_css_static_style_get_value (GtkCssStyle *style,
                                 guint        id)
 {
   /* This is called a lot, so we avoid a dynamic type check here */
   GtkCssStaticStyle *sstyle = (GtkCssStaticStyle *) style;
+  GtkCssValues *values = sstyle->groups[property_group[id]];
 
-  return sstyle->values[id];
+  if (values == NULL)
+    return NULL;
+
+  return values->values[property_index[id]];
 }
 
 static GtkCssSection *
@@ -70,10 +323,13 @@ gtk_css_static_style_dispose (GObject *object)
   GtkCssStaticStyle *style = GTK_CSS_STATIC_STYLE (object);
   guint i;
 
-  for (i = 0; i < GTK_CSS_PROPERTY_N_PROPERTIES; i++)
+  for (i = 0; i < GTK_CSS_N_VALUES_GROUPS; i++)
     {
-      if (style->values[i])
-        _gtk_css_value_unref (style->values[i]);
+      if (style->groups[i])
+        {
+          gtk_css_values_unref (style->groups[i]);
+          style->groups[i] = NULL;
+        }
     }
   if (style->sections)
     {
@@ -89,6 +345,22 @@ gtk_css_static_style_class_init (GtkCssStaticStyleClass *klass)
 {
   GObjectClass *object_class = G_OBJECT_CLASS (klass);
   GtkCssStyleClass *style_class = GTK_CSS_STYLE_CLASS (klass);
+  guint i, j;
+
+  for (i = 0; i < GTK_CSS_N_VALUES_GROUPS; i++)
+    {
+      group_inherited[i] = _gtk_css_style_property_is_inherit (_gtk_css_style_property_lookup_by_id (group_props[i].ids[0]));
+
+      for (j = 0; j < group_props[i].n_ids; j++)
+        {
+          guint id = group_props[i].ids[j];
+
+          g_assert (_gtk_css_style_property_is_inherit (_gtk_css_style_property_lookup_by_id (id)) == group_inherited[i]);
+
+          property_group[id] = i;
+          property_index[id] = j;
+        }
+    }
 
   object_class->dispose = gtk_css_static_style_dispose;
 
@@ -114,9 +386,27 @@ gtk_css_static_style_set_value (GtkCssStaticStyle *style,
                                 GtkCssValue       *value,
                                 GtkCssSection     *section)
 {
-  if (style->values[id])
-    _gtk_css_value_unref (style->values[id]);
-  style->values[id] = _gtk_css_value_ref (value);
+  GtkCssValuesGroup group = property_group[id];
+  GtkCssValues *values = style->groups[group];
+  guint index = property_index[id];
+
+  if (values == NULL)
+    {
+      values = gtk_css_values_new (group);
+      style->groups[group] = values;
+    }
+  else if (values->ref_count > 1)
+    {
+      GtkCssValues *copy = gtk_css_values_copy (values);
+
+      gtk_css_values_unref (values);
+      values = copy;
+      style->groups[group] = values;
+    }
+
+  if (values->values[index])
+    _gtk_css_value_unref (values->values[index]);
+  values->values[index] = _gtk_css_value_ref (value);
 
   if (style->sections && style->sections->len > id && g_ptr_array_index (style->sections, id))
     {
@@ -157,6 +447,7 @@ gtk_css_static_style_get_default (void)
 
       settings = gtk_settings_get_default ();
       default_style = gtk_css_static_style_new_compute (GTK_STYLE_PROVIDER (settings),
+                                                        NULL,
                                                         NULL,
                                                         NULL);
       g_object_set_data_full (G_OBJECT (settings), I_("gtk-default-style"),
@@ -166,19 +457,88 @@ gtk_css_static_style_get_default (void)
   return default_style;
 }
 
+/* Replace every group that turned out identical to the parent's
+ * with a reference to the parent's group. This is mostly the
+ * inherited groups, but non-inherited ones that ended up with the
+ * same values (typically the initial ones) are shared, too.
+ */
+static void
+gtk_css_static_style_share_values (GtkCssStaticStyle *style,
+                                   GtkCssStaticStyle *parent)
+{
+  guint i;
+
+  for (i = 0; i < GTK_CSS_N_VALUES_GROUPS; i++)
+    {
+      GtkCssValues *values = style->groups[i];
+      GtkCssValues *parent_values = parent->groups[i];
+
+      if (values == NULL || parent_values == NULL ||
+          values == parent_values)
+        continue;
+
+      if (!gtk_css_values_equal (values, parent_values))
+        continue;
+
+      gtk_css_values_unref (values);
+      style->groups[i] = gtk_css_values_ref (parent_values);
+    }
+}
+
+/* Takes the parent's group for every inherited group that has no
+ * declared values, as computing it would only produce refs of the
+ * parent's values. Those properties are taken out of the lookup so
+ * that resolving it skips them.
+ */
+static void
+gtk_css_static_style_inherit_values (GtkCssStaticStyle *style,
+                                     GtkCssStaticStyle *parent,
+                                     GtkCssLookup      *lookup)
+{
+  guint i, j;
+
+  for (i = 0; i < GTK_CSS_N_VALUES_GROUPS; i++)
+    {
+      if (!group_inherited[i] || parent->groups[i] == NULL)
+        continue;
+
+      for (j = 0; j < group_props[i].n_ids; j++)
+        {
+          guint id = group_props[i].ids[j];
+
+          if (lookup->values[id].value != NULL ||
+              !_gtk_bitmask_get (lookup->missing, id))
+            break;
+        }
+
+      if (j < group_props[i].n_ids)
+        continue;
+
+      style->groups[i] = gtk_css_values_ref (parent->groups[i]);
+
+      for (j = 0; j < group_props[i].n_ids; j++)
+        lookup->missing = _gtk_bitmask_set (lookup->missing, group_props[i].ids[j], FALSE);
+    }
+}
+
 GtkCssStyle *
-gtk_css_static_style_new_compute (GtkStyleProvider    *provider,
-                                  const GtkCssMatcher *matcher,
-                                  GtkCssStyle         *parent)
+gtk_css_static_style_new_compute (GtkStyleProvider             *provider,
+                                  const GtkCountingBloomFilter *filter,
+                                  const GtkCssMatcher          *matcher,
+                                  GtkCssStyle                  *parent)
 {
   GtkCssStaticStyle *result;
   GtkCssLookup lookup;
   GtkCssChange change = GTK_CSS_CHANGE_ANY_SELF | GTK_CSS_CHANGE_ANY_SIBLING | GTK_CSS_CHANGE_ANY_PARENT;
+  gint64 before;
+
+  before = g_get_monotonic_time ();
 
   _gtk_css_lookup_init (&lookup, NULL);
 
   if (matcher)
     gtk_style_provider_lookup (provider,
+                               filter,
                                matcher,
                                &lookup,
                                &change);
@@ -187,6 +547,9 @@ gtk_css_static_style_new_compute (GtkStyleProvider    *provider,
 
   result->change = change;
 
+  if (parent && GTK_IS_CSS_STATIC_STYLE (parent))
+    gtk_css_static_style_inherit_values (result, GTK_CSS_STATIC_STYLE (parent), &lookup);
+
   _gtk_css_lookup_resolve (&lookup,
                            provider,
                            result,
@@ -194,6 +557,12 @@ gtk_css_static_style_new_compute (GtkStyleProvider    *provider,
 
   _gtk_css_lookup_destroy (&lookup);
 
+  if (parent && GTK_IS_CSS_STATIC_STYLE (parent))
+    gtk_css_static_style_share_values (result, GTK_CSS_STATIC_STYLE (parent));
+
+  gtk_css_stats.static_styles++;
+  gtk_css_stats.compute_time += g_get_monotonic_time () - before;
+
   return GTK_CSS_STYLE (result);
 }
 
@@ -209,6 +578,8 @@ gtk_css_static_style_compute_value (GtkCssStaticStyle *style,
 
   gtk_internal_return_if_fail (id < GTK_CSS_PROPERTY_N_PROPERTIES);
 
+  gtk_css_stats.computed_values[id]++;
+
   /* http://www.w3.org/TR/css3-cascade/#cascade
    * Then, for every element, the value for each property can be found
    * by following this pseudo-algorithm:
@@ -241,3 +612,40 @@ gtk_css_static_style_get_change (GtkCssStaticStyle *style)
 
   return style->change;
 }
+
+/*
+ * gtk_css_static_style_get_memory_size:
+ * @style: a #GtkCssStaticStyle
+ * @seen: set of the value groups that were accounted for already
+ *
+ * Gets the bytes used by @style itself and by those of its value
+ * groups that are not in @seen yet, and adds them to @seen. The
+ * values are mostly shared between styles and are not included.
+ *
+ * Returns: the size of @style in bytes
+ */
+gsize
+gtk_css_static_style_get_memory_size (GtkCssStaticStyle *style,
+                                      GHashTable        *seen)
+{
+  gsize size;
+  guint i;
+
+  g_return_val_if_fail (GTK_IS_CSS_STATIC_STYLE (style), 0);
+
+  size = sizeof (GtkCssStaticStyle);
+  if (style->sections)
+    size += style->sections->len * sizeof (gpointer);
+
+  for (i = 0; i < GTK_CSS_N_VALUES_GROUPS; i++)
+    {
+      GtkCssValues *values = style->groups[i];
+
+      if (values == NULL || !g_hash_table_add (seen, values))
+        continue;
+
+      size += sizeof (GtkCssValues) + (values->n_values - 1) * sizeof (GtkCssValue *);
+    }
+
+  return size;
+}
@@ -20,6 +20,7 @@
 #ifndef __GTK_CSS_STATIC_STYLE_PRIVATE_H__
 #define __GTK_CSS_STATIC_STYLE_PRIVATE_H__
 
+#include "gtk/gtkcountingbloomfilterprivate.h"
 #include "gtk/gtkcssmatcherprivate.h"
 #include "gtk/gtkcssstyleprivate.h"
 
@@ -34,12 +35,37 @@ G_BEGIN_DECLS
 
 typedef struct _GtkCssStaticStyle           GtkCssStaticStyle;
 typedef struct _GtkCssStaticStyleClass      GtkCssStaticStyleClass;
+typedef struct _GtkCssValues                GtkCssValues;
+
+/*
+ * GtkCssValuesGroup:
+ *
+ * Properties are stored in refcounted groups of related values, so
+ * that styles which agree on a whole group can share it. A group only
+ * ever contains properties that are either all inherited or all not
+ * inherited.
+ */
+typedef enum {
+  GTK_CSS_CORE_VALUES,
+  GTK_CSS_FONT_VALUES,
+  GTK_CSS_ICON_VALUES,
+  GTK_CSS_FONT_VARIANT_VALUES,
+  GTK_CSS_BACKGROUND_VALUES,
+  GTK_CSS_BORDER_VALUES,
+  GTK_CSS_OUTLINE_VALUES,
+  GTK_CSS_SIZE_VALUES,
+  GTK_CSS_TRANSITION_VALUES,
+  GTK_CSS_ANIMATION_VALUES,
+  GTK_CSS_OTHER_VALUES,
+  /* add more */
+  GTK_CSS_N_VALUES_GROUPS
+} GtkCssValuesGroup;
 
 struct _GtkCssStaticStyle
 {
   GtkCssStyle parent;
 
-  GtkCssValue           *values[GTK_CSS_PROPERTY_N_PROPERTIES]; /* the values */
+  GtkCssValues          *groups[GTK_CSS_N_VALUES_GROUPS]; /* the values, shared copy-on-write */
   GPtrArray             *sections;             /* sections the values are defined in */
 
   GtkCssChange           change;               /* change as returned by value lookup */
@@ -54,6 +80,7 @@ GType                   gtk_css_static_style_get_type           (void) G_GNUC_CO
 
 GtkCssStyle *           gtk_css_static_style_get_default        (void);
 GtkCssStyle *           gtk_css_static_style_new_compute        (GtkStyleProvider       *provider,
+                                                                 const GtkCountingBloomFilter *filter,
                                                                  const GtkCssMatcher    *matcher,
                                                                  GtkCssStyle            *parent);
 
@@ -64,7 +91,13 @@ void                    gtk_css_static_style_compute_value      (GtkCssStaticSty
                                                                  GtkCssValue            *specified,
                                                                  GtkCssSection          *section);
 
+const guint *           gtk_css_static_style_get_group_properties
+                                                                (GtkCssValuesGroup       group,
+                                                                 guint                  *n_ids);
+
 GtkCssChange            gtk_css_static_style_get_change         (GtkCssStaticStyle      *style);
+gsize                   gtk_css_static_style_get_memory_size    (GtkCssStaticStyle      *style,
+                                                                 GHashTable             *seen);
 
 G_END_DECLS
 
@@ -0,0 +1,110 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "gtkcssstatsprivate.h"
+
+#include "gtkcssstylepropertyprivate.h"
+
+#include <string.h>
+
+GtkCssStats gtk_css_stats;
+
+/**
+ * gtk_css_stats_get:
+ * @stats: (out caller-allocates): return location for the counters
+ *
+ * Fills in the counters accumulated since the last call to
+ * gtk_css_stats_reset().
+ **/
+void
+gtk_css_stats_get (GtkCssStats *stats)
+{
+  g_return_if_fail (stats != NULL);
+
+  *stats = gtk_css_stats;
+}
+
+/**
+ * gtk_css_stats_snapshot:
+ *
+ * Returns the counters of the work done by the style machinery since
+ * GTK was initialized or gtk_css_stats_reset() was last called. This
+ * is meant for automated performance tests, the counters are not
+ * guaranteed to stay the same between GTK versions.
+ *
+ * The result is a dictionary of type `a{sv}`. It contains these uint32
+ * counters: “selector-matches”, “selector-rejects” (selectors skipped
+ * by the ancestor filter), “parent-cache-lookups”, “parent-cache-hits”,
+ * “sibling-lookups”, “sibling-hits”, “static-styles”,
+ * “image-cache-lookups” and “image-cache-hits”. It also contains
+ * “compute-time”, the int64 number of microseconds spent computing
+ * static styles, and “computed-values”, an `a{su}` dictionary of how
+ * often each CSS property was computed, leaving out those that weren't.
+ *
+ * Returns: (transfer floating): the counters
+ **/
+GVariant *
+gtk_css_stats_snapshot (void)
+{
+  GVariantBuilder builder, values;
+  GtkCssStats stats;
+  guint i;
+
+  gtk_css_stats_get (&stats);
+
+  g_variant_builder_init (&builder, G_VARIANT_TYPE_VARDICT);
+  g_variant_builder_add (&builder, "{sv}", "selector-matches", g_variant_new_uint32 (stats.selector_matches));
+  g_variant_builder_add (&builder, "{sv}", "selector-rejects", g_variant_new_uint32 (stats.selector_rejects));
+  g_variant_builder_add (&builder, "{sv}", "parent-cache-lookups", g_variant_new_uint32 (stats.parent_cache_lookups));
+  g_variant_builder_add (&builder, "{sv}", "parent-cache-hits", g_variant_new_uint32 (stats.parent_cache_hits));
+  g_variant_builder_add (&builder, "{sv}", "sibling-lookups", g_variant_new_uint32 (stats.sibling_lookups));
+  g_variant_builder_add (&builder, "{sv}", "sibling-hits", g_variant_new_uint32 (stats.sibling_hits));
+  g_variant_builder_add (&builder, "{sv}", "static-styles", g_variant_new_uint32 (stats.static_styles));
+  g_variant_builder_add (&builder, "{sv}", "compute-time", g_variant_new_int64 (stats.compute_time));
+  g_variant_builder_add (&builder, "{sv}", "image-cache-lookups", g_variant_new_uint32 (stats.image_cache_lookups));
+  g_variant_builder_add (&builder, "{sv}", "image-cache-hits", g_variant_new_uint32 (stats.image_cache_hits));
+
+  g_variant_builder_init (&values, G_VARIANT_TYPE ("a{su}"));
+  for (i = 0; i < GTK_CSS_PROPERTY_N_PROPERTIES; i++)
+    {
+      GtkStyleProperty *property;
+
+      if (stats.computed_values[i] == 0)
+        continue;
+
+      property = GTK_STYLE_PROPERTY (_gtk_css_style_property_lookup_by_id (i));
+      g_variant_builder_add (&values, "{su}",
+                             _gtk_style_property_get_name (property),
+                             stats.computed_values[i]);
+    }
+  g_variant_builder_add (&builder, "{sv}", "computed-values", g_variant_builder_end (&values));
+
+  return g_variant_builder_end (&builder);
+}
+
+/**
+ * gtk_css_stats_reset:
+ *
+ * Resets all counters returned by gtk_css_stats_snapshot() to 0.
+ **/
+void
+gtk_css_stats_reset (void)
+{
+  memset (&gtk_css_stats, 0, sizeof (GtkCssStats));
+}
@@ -0,0 +1,60 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GTK_CSS_STATS_PRIVATE_H__
+#define __GTK_CSS_STATS_PRIVATE_H__
+
+#include "gtkcssstats.h"
+
+#include "gtkcsstypesprivate.h"
+
+G_BEGIN_DECLS
+
+typedef struct _GtkCssStats GtkCssStats;
+
+/*
+ * GtkCssStats:
+ *
+ * Counters for the work done by the style machinery, so that it is
+ * possible to find out why restyling is slow. They are displayed by
+ * the inspector and can be read with gtk_css_stats_get(), or from
+ * outside GTK with gtk_css_stats_snapshot().
+ *
+ * The counters only ever increase until gtk_css_stats_reset() is called.
+ */
+struct _GtkCssStats {
+  guint   selector_matches;     /* selectors checked against a node */
+  guint   selector_rejects;     /* selector subtrees skipped by the ancestor filter */
+  guint   parent_cache_lookups; /* lookups in the parent's style cache */
+  guint   parent_cache_hits;    /* ...that found a style */
+  guint   sibling_lookups;      /* lookups in the previous sibling */
+  guint   sibling_hits;         /* ...that could share its style */
+  guint   static_styles;        /* static styles computed */
+  gint64  compute_time;         /* time spent computing them, in µs */
+  guint   image_cache_lookups;  /* images looked up in the node cache */
+  guint   image_cache_hits;     /* ...that were found */
+  guint   computed_values[GTK_CSS_PROPERTY_N_PROPERTIES]; /* values computed per property */
+};
+
+/* Incremented directly from the hot paths, use the functions below otherwise */
+extern GtkCssStats gtk_css_stats;
+
+void            gtk_css_stats_get                       (GtkCssStats            *stats);
+
+G_END_DECLS
+
+#endif /* __GTK_CSS_STATS_PRIVATE_H__ */
@@ -19,24 +19,140 @@
 
 #include "gtkcssstylechangeprivate.h"
 
+#include "gtkcssanimatedstyleprivate.h"
+#include "gtkcssstaticstyleprivate.h"
 #include "gtkcssstylepropertyprivate.h"
 
+/* The affects of every property, looked up once */
+static GtkCssAffects property_affects[GTK_CSS_PROPERTY_N_PROPERTIES];
+
+static void
+init_property_affects (void)
+{
+  static gboolean initialized = FALSE;
+  guint i;
+
+  if (G_LIKELY (initialized))
+    return;
+
+  for (i = 0; i < GTK_CSS_PROPERTY_N_PROPERTIES; i++)
+    property_affects[i] = _gtk_css_style_property_get_affects (_gtk_css_style_property_lookup_by_id (i));
+
+  initialized = TRUE;
+}
+
+static void
+gtk_css_style_compare_value (GtkCssStyleChange *change,
+                             guint              id)
+{
+  if (_gtk_bitmask_get (change->changes, id))
+    return;
+
+  if (!_gtk_css_value_equal (gtk_css_style_get_value (change->old_style, id),
+                             gtk_css_style_get_value (change->new_style, id)))
+    {
+      change->affects |= property_affects[id];
+      change->changes = _gtk_bitmask_set (change->changes, id, TRUE);
+    }
+}
+
+static GtkCssStyle *
+gtk_css_style_get_base (GtkCssStyle  *style,
+                        GPtrArray   **animated_values)
+{
+  if (GTK_IS_CSS_ANIMATED_STYLE (style))
+    {
+      *animated_values = GTK_CSS_ANIMATED_STYLE (style)->animated_values;
+      return GTK_CSS_ANIMATED_STYLE (style)->style;
+    }
+
+  *animated_values = NULL;
+  return style;
+}
+
+static void
+gtk_css_style_compare_animated_values (GtkCssStyleChange *change,
+                                       GPtrArray         *animated_values)
+{
+  guint i;
+
+  if (animated_values == NULL)
+    return;
+
+  for (i = 0; i < animated_values->len; i++)
+    {
+      if (g_ptr_array_index (animated_values, i))
+        gtk_css_style_compare_value (change, i);
+    }
+}
+
+static void
+gtk_css_style_compare_groups (GtkCssStyleChange *change,
+                              GtkCssStaticStyle *old_base,
+                              GtkCssStaticStyle *new_base)
+{
+  const guint *ids;
+  guint i, j, n_ids;
+
+  for (i = 0; i < GTK_CSS_N_VALUES_GROUPS; i++)
+    {
+      /* Most groups are shared between the two styles, and then
+       * none of their values can differ. */
+      if (old_base->groups[i] == new_base->groups[i])
+        continue;
+
+      ids = gtk_css_static_style_get_group_properties (i, &n_ids);
+      for (j = 0; j < n_ids; j++)
+        gtk_css_style_compare_value (change, ids[j]);
+    }
+}
+
 void
 gtk_css_style_change_init (GtkCssStyleChange *change,
                            GtkCssStyle       *old_style,
                            GtkCssStyle       *new_style)
 {
+  GtkCssStyle *old_base, *new_base;
+  GPtrArray *old_animated, *new_animated;
+  guint i;
+
   change->old_style = g_object_ref (old_style);
   change->new_style = g_object_ref (new_style);
 
-  change->n_compared = 0;
-
   change->affects = 0;
   change->changes = _gtk_bitmask_new ();
-  
+
   /* Make sure we don't do extra work if old and new are equal. */
   if (old_style == new_style)
-    change->n_compared = GTK_CSS_PROPERTY_N_PROPERTIES;
+    return;
+
+  init_property_affects ();
+
+  /* The whole change is computed here, so that the queries widgets do
+   * afterwards are just looking at the bits. Comparing groups first
+   * makes that cheap: when animations advance, or start or stop, the
+   * underlying style stays the same and only the animated values can
+   * differ, and most other restyles only touch a few groups. */
+  old_base = gtk_css_style_get_base (old_style, &old_animated);
+  new_base = gtk_css_style_get_base (new_style, &new_animated);
+
+  if (old_base != new_base)
+    {
+      if (GTK_IS_CSS_STATIC_STYLE (old_base) && GTK_IS_CSS_STATIC_STYLE (new_base))
+        {
+          gtk_css_style_compare_groups (change,
+                                        GTK_CSS_STATIC_STYLE (old_base),
+                                        GTK_CSS_STATIC_STYLE (new_base));
+        }
+      else
+        {
+          for (i = 0; i < GTK_CSS_PROPERTY_N_PROPERTIES; i++)
+            gtk_css_style_compare_value (change, i);
+        }
+    }
+
+  gtk_css_style_compare_animated_values (change, old_animated);
+  gtk_css_style_compare_animated_values (change, new_animated);
 }
 
 void
@@ -59,54 +175,23 @@ gtk_css_style_change_get_new_style (GtkCssStyleChange *change)
   return change->new_style;
 }
 
-static gboolean
-gtk_css_style_compare_next_value (GtkCssStyleChange *change)
-{
-  if (change->n_compared == GTK_CSS_PROPERTY_N_PROPERTIES)
-    return FALSE;
-
-  if (!_gtk_css_value_equal (gtk_css_style_get_value (change->old_style, change->n_compared),
-                             gtk_css_style_get_value (change->new_style, change->n_compared)))
-    {
-      change->affects |= _gtk_css_style_property_get_affects (_gtk_css_style_property_lookup_by_id (change->n_compared));
-      change->changes = _gtk_bitmask_set (change->changes, change->n_compared, TRUE);
-    }
-
-  change->n_compared++;
-
-  return TRUE;
-}
-
 gboolean
 gtk_css_style_change_has_change (GtkCssStyleChange *change)
 {
-  do {
-    if (!_gtk_bitmask_is_empty (change->changes))
-      return TRUE;
-  } while (gtk_css_style_compare_next_value (change));
-
-  return FALSE;
+  return !_gtk_bitmask_is_empty (change->changes);
 }
 
 gboolean
 gtk_css_style_change_affects (GtkCssStyleChange *change,
                               GtkCssAffects      affects)
 {
-  do {
-    if (change->affects & affects)
-      return TRUE;
-  } while (gtk_css_style_compare_next_value (change));
-
-  return FALSE;
+  return (change->affects & affects) != 0;
 }
 
 gboolean
 gtk_css_style_change_changes_property (GtkCssStyleChange *change,
                                        guint              id)
 {
-  while (change->n_compared <= id)
-    gtk_css_style_compare_next_value (change);
-
   return _gtk_bitmask_get (change->changes, id);
 }
 
@@ -114,35 +199,32 @@ void
 gtk_css_style_change_print (GtkCssStyleChange *change,
                             GString           *string)
 {
-  int i;
+  guint i;
   GtkCssStyle *old = gtk_css_style_change_get_old_style (change);
   GtkCssStyle *new = gtk_css_style_change_get_new_style (change);
 
-  for (i = 0; i < GTK_CSS_PROPERTY_N_PROPERTIES; i ++)
+  _gtk_bitmask_foreach (change->changes, i)
     {
-      if (gtk_css_style_change_changes_property (change, i))
-        {
-          GtkCssStyleProperty *prop;
-          GtkCssValue *value;
-          const char *name;
-
-          if (_gtk_css_value_equal (gtk_css_style_get_value (change->old_style, i),
-                                     gtk_css_style_get_value (change->new_style, i)))
-            continue;
-
-          prop = _gtk_css_style_property_lookup_by_id (i);
-          name = _gtk_style_property_get_name (GTK_STYLE_PROPERTY (prop));
-
-          g_string_append_printf (string, "%s: ", name);
-          value = gtk_css_style_get_value (old, i);
-          _gtk_css_value_print (value, string);
-          g_string_append (string, "\n");
-
-          g_string_append_printf (string, "%s: ", name);
-          value = gtk_css_style_get_value (new, i);
-          _gtk_css_value_print (value, string);
-          g_string_append (string, "\n");
-        }
+      GtkCssStyleProperty *prop;
+      GtkCssValue *value;
+      const char *name;
+
+      if (_gtk_css_value_equal (gtk_css_style_get_value (change->old_style, i),
+                                 gtk_css_style_get_value (change->new_style, i)))
+        continue;
+
+      prop = _gtk_css_style_property_lookup_by_id (i);
+      name = _gtk_style_property_get_name (GTK_STYLE_PROPERTY (prop));
+
+      g_string_append_printf (string, "%s: ", name);
+      value = gtk_css_style_get_value (old, i);
+      _gtk_css_value_print (value, string);
+      g_string_append (string, "\n");
+
+      g_string_append_printf (string, "%s: ", name);
+      value = gtk_css_style_get_value (new, i);
+      _gtk_css_value_print (value, string);
+      g_string_append (string, "\n");
     }
 
 }
@@ -28,8 +28,6 @@ struct _GtkCssStyleChange {
   GtkCssStyle   *old_style;
   GtkCssStyle   *new_style;
 
-  guint          n_compared;
-
   GtkCssAffects  affects;
   GtkBitmask    *changes;
 };
@@ -53,13 +53,14 @@ gtk_css_transient_node_get_widget_path (GtkCssNode *node)
 }
 
 static GtkCssStyle *
-gtk_css_transient_node_update_style (GtkCssNode   *cssnode,
-                                     GtkCssChange  change,
-                                     gint64        timestamp,
-                                     GtkCssStyle  *style)
+gtk_css_transient_node_update_style (GtkCssNode                   *cssnode,
+                                     const GtkCountingBloomFilter *filter,
+                                     GtkCssChange                  change,
+                                     gint64                        timestamp,
+                                     GtkCssStyle                  *style)
 {
   /* This should get rid of animations */
-  return GTK_CSS_NODE_CLASS (gtk_css_transient_node_parent_class)->update_style (cssnode, change, 0, style);
+  return GTK_CSS_NODE_CLASS (gtk_css_transient_node_parent_class)->update_style (cssnode, filter, change, 0, style);
 }
 
 static void
@@ -92,3 +93,29 @@ gtk_css_transient_node_new (GtkCssNode *parent)
   return result;
 }
 
+/*
+ * gtk_css_transient_node_reset:
+ * @node: a transient node without a parent
+ * @parent: the node to copy the declaration from
+ *
+ * Makes @node look like it was just created with
+ * gtk_css_transient_node_new(), so that it can be reused.
+ */
+void
+gtk_css_transient_node_reset (GtkCssNode *node,
+                              GtkCssNode *parent)
+{
+  gtk_internal_return_if_fail (GTK_IS_CSS_TRANSIENT_NODE (node));
+  gtk_internal_return_if_fail (GTK_IS_CSS_NODE (parent));
+  gtk_internal_return_if_fail (gtk_css_node_get_parent (node) == NULL);
+
+  if (node->decl != parent->decl)
+    {
+      gtk_css_node_declaration_unref (node->decl);
+      node->decl = gtk_css_node_declaration_ref (parent->decl);
+    }
+
+  /* The parent's style may have changed while @node was not attached.
+   * The new style is usually found in the parent's style cache. */
+  gtk_css_node_invalidate (node, GTK_CSS_CHANGE_ANY);
+}
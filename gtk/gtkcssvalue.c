@@ -29,6 +29,33 @@ struct _GtkCssValue {
 
 G_DEFINE_BOXED_TYPE (GtkCssValue, _gtk_css_value, _gtk_css_value_ref, _gtk_css_value_unref)
 
+/* Canonical instances of all interned values. The table does not hold
+ * a reference, values remove themselves when they are freed. */
+static GHashTable *interned_values;
+
+static gboolean
+gtk_css_value_equal_func (gconstpointer value1,
+                          gconstpointer value2)
+{
+  return _gtk_css_value_equal (value1, value2);
+}
+
+static guint
+gtk_css_value_hash_func (gconstpointer value)
+{
+  return gtk_css_value_hash (value);
+}
+
+static void
+gtk_css_value_unintern (GtkCssValue *value)
+{
+  if (interned_values == NULL)
+    return;
+
+  if (g_hash_table_lookup (interned_values, value) == value)
+    g_hash_table_remove (interned_values, value);
+}
+
 GtkCssValue *
 _gtk_css_value_alloc (const GtkCssValueClass *klass,
                       gsize                   size)
@@ -63,6 +90,9 @@ gtk_css_value_unref (GtkCssValue *value)
   if (value->ref_count > 0)
     return;
 
+  if (value->class->hash)
+    gtk_css_value_unintern (value);
+
   value->class->free (value);
 }
 
@@ -88,7 +118,15 @@ _gtk_css_value_compute (GtkCssValue      *value,
                         GtkCssStyle      *style,
                         GtkCssStyle      *parent_style)
 {
-  return value->class->compute (value, property_id, provider, style, parent_style);
+  GtkCssValue *result;
+
+  result = value->class->compute (value, property_id, provider, style, parent_style);
+
+  /* Values that compute to themselves have been interned on creation */
+  if (result != NULL && result != value)
+    result = gtk_css_value_intern (result);
+
+  return result;
 }
 
 gboolean
@@ -121,6 +159,70 @@ _gtk_css_value_equal0 (const GtkCssValue *value1,
   return _gtk_css_value_equal (value1, value2);
 }
 
+/**
+ * gtk_css_value_hash:
+ * @value: a #GtkCssValue
+ *
+ * Computes a hash for @value that is consistent with
+ * _gtk_css_value_equal(). Values of classes that don't provide
+ * a hash function hash by pointer.
+ *
+ * Returns: the hash value
+ **/
+guint
+gtk_css_value_hash (const GtkCssValue *value)
+{
+  gtk_internal_return_val_if_fail (value != NULL, 0);
+
+  if (!value->class->hash)
+    return g_direct_hash (value);
+
+  return GPOINTER_TO_UINT (value->class) ^ value->class->hash (value);
+}
+
+/**
+ * gtk_css_value_intern:
+ * @value: (transfer full): a #GtkCssValue
+ *
+ * Looks up the canonical instance of @value. If an equal value has
+ * been interned before, @value is unreffed and the existing instance
+ * is returned instead. Otherwise @value becomes the canonical instance.
+ *
+ * Values are immutable, so equal values can be freely shared.
+ * Value classes without a hash function are not interned and @value
+ * is returned as is.
+ *
+ * Returns: (transfer full): the interned value
+ **/
+GtkCssValue *
+gtk_css_value_intern (GtkCssValue *value)
+{
+  GtkCssValue *interned;
+
+  gtk_internal_return_val_if_fail (value != NULL, NULL);
+
+  if (!value->class->hash)
+    return value;
+
+  if (G_UNLIKELY (interned_values == NULL))
+    interned_values = g_hash_table_new (gtk_css_value_hash_func, gtk_css_value_equal_func);
+
+  interned = g_hash_table_lookup (interned_values, value);
+  if (interned == value)
+    return value;
+
+  if (interned)
+    {
+      gtk_css_value_ref (interned);
+      gtk_css_value_unref (value);
+      return interned;
+    }
+
+  g_hash_table_add (interned_values, value);
+
+  return value;
+}
+
 GtkCssValue *
 _gtk_css_value_transition (GtkCssValue *start,
                            GtkCssValue *end,
@@ -0,0 +1,592 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "gtkdirectorylistingprivate.h"
+
+/*
+ * Directory listings
+ *
+ * The files in a directory, as needed for completing file names.
+ * Listings are shared by everything in the process that asks for the
+ * same directory, and the ones that were used last are kept around
+ * when nobody uses them anymore, so that going back to a directory
+ * does not list it again. This matters on network mounts, where
+ * listing a directory can take seconds.
+ *
+ * A listing is loaded asynchronously and kept up to date with a
+ * directory monitor. If the directory can't be monitored, a listing
+ * that is reused is reloaded in the background and its contents stay
+ * available until the reload is done.
+ *
+ * Watches are called from an idle when the contents changed and when
+ * loading is done.
+ */
+
+/* priority used for all async operations, like GtkFileSystemModel */
+#define IO_PRIORITY G_PRIORITY_DEFAULT
+
+/* The first query is small so the first files show up right away,
+ * following ones double in size up to the maximum */
+#define FILES_PER_QUERY 100
+#define MAX_FILES_PER_QUERY (10 * FILES_PER_QUERY)
+
+/* Listings that nobody uses, but are kept for the next time */
+#define MAX_UNUSED_LISTINGS 8
+
+#define LISTING_ATTRIBUTES "standard::name,standard::display-name,standard::type,standard::content-type"
+
+typedef struct {
+  GtkDirectoryListingFunc func;
+  gpointer user_data;
+} Watch;
+
+struct _GtkDirectoryListing
+{
+  int ref_count;
+  GFile *dir;
+
+  GHashTable *files;            /* name -> GFileInfo */
+  GHashTable *reloaded_files;   /* the same, while reloading */
+  GPtrArray *infos;             /* sorted files, or NULL if not computed */
+  guint serial;
+
+  GCancellable *cancellable;
+  GFileMonitor *monitor;        /* NULL if monitoring is not supported */
+  guint files_per_query;
+  GError *error;
+  guint loaded : 1;
+
+  GList link;                   /* in unused, while ref_count is 0 */
+
+  GArray *watches;
+  guint notify_id;
+};
+
+static GHashTable *listings;    /* GFile -> GtkDirectoryListing */
+static GQueue unused = G_QUEUE_INIT; /* most recently used first */
+
+static void start_loading (GtkDirectoryListing *listing);
+
+static void
+gtk_directory_listing_free (GtkDirectoryListing *listing)
+{
+  g_hash_table_remove (listings, listing->dir);
+
+  if (listing->notify_id)
+    g_source_remove (listing->notify_id);
+
+  /* Cancelling makes the pending callbacks not touch the listing */
+  g_cancellable_cancel (listing->cancellable);
+  if (listing->monitor)
+    {
+      g_signal_handlers_disconnect_by_data (listing->monitor, listing);
+      g_file_monitor_cancel (listing->monitor);
+      g_object_unref (listing->monitor);
+    }
+  g_object_unref (listing->cancellable);
+
+  g_hash_table_unref (listing->files);
+  g_clear_pointer (&listing->reloaded_files, g_hash_table_unref);
+  g_clear_pointer (&listing->infos, g_ptr_array_unref);
+  g_clear_error (&listing->error);
+  g_array_free (listing->watches, TRUE);
+  g_object_unref (listing->dir);
+
+  g_slice_free (GtkDirectoryListing, listing);
+}
+
+static gboolean
+notify_watches (gpointer data)
+{
+  GtkDirectoryListing *listing = data;
+  GArray *watches;
+  guint i, j;
+
+  listing->notify_id = 0;
+
+  /* Watches may be removed, or the listing be unreffed, by the callbacks */
+  gtk_directory_listing_ref (listing);
+  watches = g_array_sized_new (FALSE, FALSE, sizeof (Watch), listing->watches->len);
+  g_array_append_vals (watches, listing->watches->data, listing->watches->len);
+
+  for (i = 0; i < watches->len; i++)
+    {
+      Watch *watch = &g_array_index (watches, Watch, i);
+
+      for (j = 0; j < listing->watches->len; j++)
+        {
+          Watch *other = &g_array_index (listing->watches, Watch, j);
+
+          if (other->func == watch->func && other->user_data == watch->user_data)
+            {
+              watch->func (listing, watch->user_data);
+              break;
+            }
+        }
+    }
+
+  g_array_free (watches, TRUE);
+  gtk_directory_listing_unref (listing);
+
+  return G_SOURCE_REMOVE;
+}
+
+static void
+queue_notify (GtkDirectoryListing *listing)
+{
+  if (listing->notify_id != 0)
+    return;
+
+  listing->notify_id = g_idle_add (notify_watches, listing);
+  g_source_set_name_by_id (listing->notify_id, "[gtk] notify_watches");
+}
+
+static void
+files_changed (GtkDirectoryListing *listing)
+{
+  g_clear_pointer (&listing->infos, g_ptr_array_unref);
+  listing->serial++;
+
+  queue_notify (listing);
+}
+
+static void
+loading_done (GtkDirectoryListing *listing,
+              GError              *error)
+{
+  if (listing->reloaded_files)
+    {
+      /* Keep what we have if reloading failed */
+      if (error == NULL)
+        {
+          g_hash_table_unref (listing->files);
+          listing->files = listing->reloaded_files;
+          files_changed (listing);
+        }
+      else
+        {
+          g_hash_table_unref (listing->reloaded_files);
+          g_error_free (error);
+        }
+      listing->reloaded_files = NULL;
+    }
+  else
+    listing->error = error;
+
+  listing->loaded = TRUE;
+  queue_notify (listing);
+}
+
+static void
+closed_enumerator (GObject      *object,
+                   GAsyncResult *res,
+                   gpointer      data)
+{
+  g_file_enumerator_close_finish (G_FILE_ENUMERATOR (object), res, NULL);
+}
+
+static void
+got_files (GObject      *object,
+           GAsyncResult *res,
+           gpointer      data)
+{
+  GFileEnumerator *enumerator = G_FILE_ENUMERATOR (object);
+  GtkDirectoryListing *listing = data; /* only a valid pointer if not cancelled */
+  GError *error = NULL;
+  GList *files, *l;
+
+  files = g_file_enumerator_next_files_finish (enumerator, res, &error);
+
+  if (g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+    {
+      g_error_free (error);
+      return;
+    }
+
+  if (files == NULL)
+    {
+      g_file_enumerator_close_async (enumerator,
+                                     IO_PRIORITY,
+                                     NULL,
+                                     closed_enumerator,
+                                     NULL);
+      loading_done (listing, error);
+      return;
+    }
+
+  for (l = files; l; l = l->next)
+    {
+      GFileInfo *info = l->data;
+      const char *name = g_file_info_get_name (info);
+
+      if (name == NULL)
+        {
+          /* Shouldn't happen, but the APIs allow it */
+          g_object_unref (info);
+          continue;
+        }
+
+      g_hash_table_replace (listing->reloaded_files ? listing->reloaded_files : listing->files,
+                            g_strdup (name), info);
+    }
+  g_list_free (files);
+
+  /* Show what is there while the rest is loading, but not when reloading */
+  if (listing->reloaded_files == NULL)
+    files_changed (listing);
+
+  listing->files_per_query = MIN (2 * listing->files_per_query, MAX_FILES_PER_QUERY);
+  g_file_enumerator_next_files_async (enumerator,
+                                      listing->files_per_query,
+                                      IO_PRIORITY,
+                                      listing->cancellable,
+                                      got_files,
+                                      listing);
+}
+
+static void
+query_done (GObject      *object,
+            GAsyncResult *res,
+            gpointer      data)
+{
+  GtkDirectoryListing *listing = data; /* only a valid pointer if not cancelled */
+  GFileInfo *info;
+  const char *name;
+
+  info = g_file_query_info_finish (G_FILE (object), res, NULL);
+  if (info == NULL)
+    return;
+
+  name = g_file_info_get_name (info);
+  if (name == NULL)
+    {
+      g_object_unref (info);
+      return;
+    }
+
+  g_hash_table_replace (listing->files, g_strdup (name), info);
+  files_changed (listing);
+}
+
+static void
+monitor_changed (GFileMonitor        *monitor,
+                 GFile               *file,
+                 GFile               *other_file,
+                 GFileMonitorEvent    type,
+                 GtkDirectoryListing *listing)
+{
+  char *name;
+
+  switch (type)
+    {
+      case G_FILE_MONITOR_EVENT_CREATED:
+      case G_FILE_MONITOR_EVENT_CHANGED:
+      case G_FILE_MONITOR_EVENT_ATTRIBUTE_CHANGED:
+        g_file_query_info_async (file,
+                                 LISTING_ATTRIBUTES,
+                                 G_FILE_QUERY_INFO_NONE,
+                                 IO_PRIORITY,
+                                 listing->cancellable,
+                                 query_done,
+                                 listing);
+        break;
+      case G_FILE_MONITOR_EVENT_DELETED:
+        name = g_file_get_basename (file);
+        if (g_hash_table_remove (listing->files, name))
+          files_changed (listing);
+        g_free (name);
+        break;
+      default:
+        /* ignore these, like GtkFileSystemModel does */
+        break;
+    }
+}
+
+static void
+got_enumerator (GObject      *object,
+                GAsyncResult *res,
+                gpointer      data)
+{
+  GtkDirectoryListing *listing = data; /* only a valid pointer if not cancelled */
+  GFileEnumerator *enumerator;
+  GError *error = NULL;
+
+  enumerator = g_file_enumerate_children_finish (G_FILE (object), res, &error);
+  if (enumerator == NULL)
+    {
+      if (g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+        g_error_free (error);
+      else
+        loading_done (listing, error);
+      return;
+    }
+
+  g_file_enumerator_next_files_async (enumerator,
+                                      listing->files_per_query,
+                                      IO_PRIORITY,
+                                      listing->cancellable,
+                                      got_files,
+                                      listing);
+  g_object_unref (enumerator);
+
+  if (listing->monitor == NULL)
+    {
+      /* we don't mind if directory monitoring isn't supported */
+      listing->monitor = g_file_monitor_directory (listing->dir,
+                                                   G_FILE_MONITOR_NONE,
+                                                   listing->cancellable,
+                                                   NULL);
+      if (listing->monitor)
+        g_signal_connect (listing->monitor, "changed",
+                          G_CALLBACK (monitor_changed), listing);
+    }
+}
+
+static void
+start_loading (GtkDirectoryListing *listing)
+{
+  listing->files_per_query = FILES_PER_QUERY;
+
+  g_file_enumerate_children_async (listing->dir,
+                                   LISTING_ATTRIBUTES,
+                                   G_FILE_QUERY_INFO_NONE,
+                                   IO_PRIORITY,
+                                   listing->cancellable,
+                                   got_enumerator,
+                                   listing);
+}
+
+/*
+ * gtk_directory_listing_get:
+ * @dir: the directory to list
+ *
+ * Gets the listing of @dir, from the listings that are in use or
+ * were used recently if possible. Otherwise, @dir is loaded.
+ *
+ * Returns: (transfer full): the listing for @dir
+ */
+GtkDirectoryListing *
+gtk_directory_listing_get (GFile *dir)
+{
+  GtkDirectoryListing *listing;
+
+  g_return_val_if_fail (G_IS_FILE (dir), NULL);
+
+  if (listings == NULL)
+    listings = g_hash_table_new (g_file_hash, (GEqualFunc) g_file_equal);
+
+  listing = g_hash_table_lookup (listings, dir);
+  if (listing)
+    {
+      if (listing->ref_count == 0)
+        {
+          g_queue_unlink (&unused, &listing->link);
+
+          /* Nothing told us about changes while it was unused */
+          if (listing->monitor == NULL && listing->loaded && listing->reloaded_files == NULL)
+            {
+              listing->reloaded_files = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                                               g_free, g_object_unref);
+              start_loading (listing);
+            }
+        }
+
+      return gtk_directory_listing_ref (listing);
+    }
+
+  listing = g_slice_new0 (GtkDirectoryListing);
+  listing->ref_count = 1;
+  listing->dir = g_object_ref (dir);
+  listing->files = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_object_unref);
+  listing->cancellable = g_cancellable_new ();
+  listing->link.data = listing;
+  listing->watches = g_array_new (FALSE, FALSE, sizeof (Watch));
+
+  g_hash_table_insert (listings, listing->dir, listing);
+
+  start_loading (listing);
+
+  return listing;
+}
+
+GtkDirectoryListing *
+gtk_directory_listing_ref (GtkDirectoryListing *listing)
+{
+  listing->ref_count++;
+
+  return listing;
+}
+
+void
+gtk_directory_listing_unref (GtkDirectoryListing *listing)
+{
+  g_return_if_fail (listing->ref_count > 0);
+
+  listing->ref_count--;
+  if (listing->ref_count > 0)
+    return;
+
+  /* Try again next time */
+  if (listing->error)
+    {
+      gtk_directory_listing_free (listing);
+      return;
+    }
+
+  g_queue_push_head_link (&unused, &listing->link);
+  while (unused.length > MAX_UNUSED_LISTINGS)
+    gtk_directory_listing_free (unused.tail->data);
+}
+
+GFile *
+gtk_directory_listing_get_directory (GtkDirectoryListing *listing)
+{
+  return listing->dir;
+}
+
+/*
+ * gtk_directory_listing_is_loaded:
+ * @listing: a #GtkDirectoryListing
+ *
+ * Returns whether all files of the directory were listed, or
+ * loading failed. While loading, the files listed so far are
+ * available.
+ *
+ * Returns: %TRUE if loading is done
+ */
+gboolean
+gtk_directory_listing_is_loaded (GtkDirectoryListing *listing)
+{
+  return listing->loaded;
+}
+
+const GError *
+gtk_directory_listing_get_error (GtkDirectoryListing *listing)
+{
+  return listing->error;
+}
+
+/*
+ * gtk_directory_listing_get_serial:
+ * @listing: a #GtkDirectoryListing
+ *
+ * Returns a number that changes whenever the files in @listing
+ * change, so that work done on them can be reused until then.
+ *
+ * Returns: the serial of the current files
+ */
+guint
+gtk_directory_listing_get_serial (GtkDirectoryListing *listing)
+{
+  return listing->serial;
+}
+
+static int
+compare_infos (gconstpointer a,
+               gconstpointer b)
+{
+  GFileInfo *info1 = *(GFileInfo **) a;
+  GFileInfo *info2 = *(GFileInfo **) b;
+
+  return g_utf8_collate (g_file_info_get_display_name (info1),
+                         g_file_info_get_display_name (info2));
+}
+
+/*
+ * gtk_directory_listing_get_infos:
+ * @listing: a #GtkDirectoryListing
+ *
+ * Gets the files in @listing, sorted by display name.
+ * The array can be kept, it does not change when the files
+ * change.
+ *
+ * Returns: (transfer none) (element-type GFileInfo): the files
+ */
+GPtrArray *
+gtk_directory_listing_get_infos (GtkDirectoryListing *listing)
+{
+  GHashTableIter iter;
+  gpointer info;
+
+  if (listing->infos)
+    return listing->infos;
+
+  listing->infos = g_ptr_array_new_full (g_hash_table_size (listing->files), g_object_unref);
+
+  g_hash_table_iter_init (&iter, listing->files);
+  while (g_hash_table_iter_next (&iter, NULL, &info))
+    g_ptr_array_add (listing->infos, g_object_ref (info));
+
+  g_ptr_array_sort (listing->infos, compare_infos);
+
+  return listing->infos;
+}
+
+/*
+ * gtk_directory_listing_lookup:
+ * @listing: a #GtkDirectoryListing
+ * @name: the name of a file in the directory
+ *
+ * Returns: (transfer none) (nullable): the info for the file
+ *   called @name, if it was listed
+ */
+GFileInfo *
+gtk_directory_listing_lookup (GtkDirectoryListing *listing,
+                              const char          *name)
+{
+  return g_hash_table_lookup (listing->files, name);
+}
+
+/*
+ * gtk_directory_listing_add_watch:
+ * @listing: a #GtkDirectoryListing
+ * @func: function to call
+ * @user_data: data to pass to @func
+ *
+ * Makes @func be called when the files in @listing change or loading
+ * is done. Calls for several changes are merged into one.
+ */
+void
+gtk_directory_listing_add_watch (GtkDirectoryListing     *listing,
+                                 GtkDirectoryListingFunc  func,
+                                 gpointer                 user_data)
+{
+  Watch watch = { func, user_data };
+
+  g_array_append_val (listing->watches, watch);
+}
+
+void
+gtk_directory_listing_remove_watch (GtkDirectoryListing     *listing,
+                                    GtkDirectoryListingFunc  func,
+                                    gpointer                 user_data)
+{
+  guint i;
+
+  for (i = 0; i < listing->watches->len; i++)
+    {
+      Watch *watch = &g_array_index (listing->watches, Watch, i);
+
+      if (watch->func == func && watch->user_data == user_data)
+        {
+          g_array_remove_index (listing->watches, i);
+          return;
+        }
+    }
+}
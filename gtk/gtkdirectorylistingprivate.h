@@ -0,0 +1,51 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GTK_DIRECTORY_LISTING_PRIVATE_H__
+#define __GTK_DIRECTORY_LISTING_PRIVATE_H__
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+typedef struct _GtkDirectoryListing GtkDirectoryListing;
+
+typedef void (* GtkDirectoryListingFunc) (GtkDirectoryListing *listing,
+                                          gpointer             user_data);
+
+GtkDirectoryListing *   gtk_directory_listing_get               (GFile                  *dir);
+GtkDirectoryListing *   gtk_directory_listing_ref               (GtkDirectoryListing    *listing);
+void                    gtk_directory_listing_unref             (GtkDirectoryListing    *listing);
+
+GFile *                 gtk_directory_listing_get_directory     (GtkDirectoryListing    *listing);
+gboolean                gtk_directory_listing_is_loaded         (GtkDirectoryListing    *listing);
+const GError *          gtk_directory_listing_get_error         (GtkDirectoryListing    *listing);
+guint                   gtk_directory_listing_get_serial        (GtkDirectoryListing    *listing);
+GPtrArray *             gtk_directory_listing_get_infos         (GtkDirectoryListing    *listing);
+GFileInfo *             gtk_directory_listing_lookup            (GtkDirectoryListing    *listing,
+                                                                 const char             *name);
+
+void                    gtk_directory_listing_add_watch         (GtkDirectoryListing    *listing,
+                                                                 GtkDirectoryListingFunc func,
+                                                                 gpointer                user_data);
+void                    gtk_directory_listing_remove_watch      (GtkDirectoryListing    *listing,
+                                                                 GtkDirectoryListingFunc func,
+                                                                 gpointer                user_data);
+
+G_END_DECLS
+
+#endif /* __GTK_DIRECTORY_LISTING_PRIVATE_H__ */
@@ -219,7 +219,10 @@ gtk_drag_get_data_got_data (GObject      *source,
                             GAsyncResult *result,
                             gpointer      data)
 {
+  GMemoryOutputStream *stream = G_MEMORY_OUTPUT_STREAM (source);
   gssize written;
+  guchar *bytes;
+  gsize size, allocated;
 
   written = g_output_stream_splice_finish (G_OUTPUT_STREAM (source), result, NULL);
   if (written < 0)
@@ -228,9 +231,17 @@ gtk_drag_get_data_got_data (GObject      *source,
     }
   else
     {
-      gtk_drag_get_data_finish (data,
-                                g_memory_output_stream_get_data (G_MEMORY_OUTPUT_STREAM (source)),
-                                g_memory_output_stream_get_data_size (G_MEMORY_OUTPUT_STREAM (source)));
+      /* Like all selection data, the data needs to be nul-terminated.
+       * Taking it over avoids copying it for that. */
+      size = g_memory_output_stream_get_data_size (stream);
+      allocated = g_memory_output_stream_get_size (stream);
+      bytes = g_memory_output_stream_steal_data (stream);
+      if (allocated <= size)
+        bytes = g_realloc (bytes, size + 1);
+      bytes[size] = 0;
+
+      gtk_drag_get_data_finish (data, bytes, size);
+      g_free (bytes);
     }
 }
 
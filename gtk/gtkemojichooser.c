@@ -69,6 +69,12 @@ struct _GtkEmojiChooser
   EmojiSection flags;
 
   GVariant *data;
+  GtkWidget *box;
+  GVariantIter iter;
+  guint populate_idle;
+
+  /* The folded words of the search text, or %NULL */
+  char **search_tokens;
 
   GSettings *settings;
 };
@@ -91,7 +97,11 @@ gtk_emoji_chooser_finalize (GObject *object)
 {
   GtkEmojiChooser *chooser = GTK_EMOJI_CHOOSER (object);
 
+  if (chooser->populate_idle)
+    g_source_remove (chooser->populate_idle);
+
   g_variant_unref (chooser->data);
+  g_strfreev (chooser->search_tokens);
   g_object_unref (chooser->settings);
 
   G_OBJECT_CLASS (gtk_emoji_chooser_parent_class)->finalize (object);
@@ -398,47 +408,75 @@ add_emoji (GtkWidget    *box,
   gtk_flow_box_insert (GTK_FLOW_BOX (box), child, prepend ? 0 : -1);
 }
 
-static void
-populate_emoji_chooser (GtkEmojiChooser *chooser)
+static void update_headings (GtkEmojiChooser *chooser);
+
+/* How long to add emoji for before giving the main loop
+ * back, so that the popover can be shown and scrolled
+ */
+#define POPULATE_TIME_SLICE (8 * G_TIME_SPAN_MILLISECOND)
+
+static gboolean
+populate_emoji_chooser (gpointer data)
 {
-  GBytes *bytes = NULL;
-  GVariantIter iter;
+  GtkEmojiChooser *chooser = data;
   GVariant *item;
-  GtkWidget *box;
+  gint64 start;
 
-  bytes = g_resources_lookup_data ("/org/gtk/libgtk/emoji/emoji.data", 0, NULL);
-  chooser->data = g_variant_ref_sink (g_variant_new_from_bytes (G_VARIANT_TYPE ("a(auss)"), bytes, TRUE));
+  start = g_get_monotonic_time ();
 
-  g_variant_iter_init (&iter, chooser->data);
-  box = chooser->people.box;
-  while ((item = g_variant_iter_next_value (&iter)))
+  while ((item = g_variant_iter_next_value (&chooser->iter)))
     {
       const char *name;
 
       g_variant_get_child (item, 1, "&s", &name);
 
       if (strcmp (name, chooser->body.first) == 0)
-        box = chooser->body.box;
+        chooser->box = chooser->body.box;
       else if (strcmp (name, chooser->nature.first) == 0)
-        box = chooser->nature.box;
+        chooser->box = chooser->nature.box;
       else if (strcmp (name, chooser->food.first) == 0)
-        box = chooser->food.box;
+        chooser->box = chooser->food.box;
       else if (strcmp (name, chooser->travel.first) == 0)
-        box = chooser->travel.box;
+        chooser->box = chooser->travel.box;
       else if (strcmp (name, chooser->activities.first) == 0)
-        box = chooser->activities.box;
+        chooser->box = chooser->activities.box;
       else if (strcmp (name, chooser->objects.first) == 0)
-        box = chooser->objects.box;
+        chooser->box = chooser->objects.box;
       else if (strcmp (name, chooser->symbols.first) == 0)
-        box = chooser->symbols.box;
+        chooser->box = chooser->symbols.box;
       else if (strcmp (name, chooser->flags.first) == 0)
-        box = chooser->flags.box;
+        chooser->box = chooser->flags.box;
 
-      add_emoji (box, FALSE, item, 0, chooser);
+      add_emoji (chooser->box, FALSE, item, 0, chooser);
       g_variant_unref (item);
+
+      if (g_get_monotonic_time () > start + POPULATE_TIME_SLICE)
+        return G_SOURCE_CONTINUE;
     }
 
+  chooser->populate_idle = 0;
+
+  /* Sections that were filled while searching may have matches now */
+  if (chooser->search_tokens)
+    update_headings (chooser);
+
+  return G_SOURCE_REMOVE;
+}
+
+static void
+start_populating_emoji_chooser (GtkEmojiChooser *chooser)
+{
+  GBytes *bytes = NULL;
+
+  bytes = g_resources_lookup_data ("/org/gtk/libgtk/emoji/emoji.data", 0, NULL);
+  chooser->data = g_variant_ref_sink (g_variant_new_from_bytes (G_VARIANT_TYPE ("a(auss)"), bytes, TRUE));
   g_bytes_unref (bytes);
+
+  g_variant_iter_init (&chooser->iter, chooser->data);
+  chooser->box = chooser->people.box;
+
+  chooser->populate_idle = g_idle_add (populate_emoji_chooser, chooser);
+  g_source_set_name_by_id (chooser->populate_idle, "[gtk] populate_emoji_chooser");
 }
 
 static void
@@ -491,6 +529,62 @@ adj_value_changed (GtkAdjustment *adj,
     }
 }
 
+/* The folded words of the emoji name and their ASCII alternates,
+ * built on the first search and kept with the child, so that typing
+ * does not split and fold every name again.
+ */
+static char **
+get_keywords (GtkFlowBoxChild *child,
+              GVariant        *emoji_data)
+{
+  char **keywords;
+  char **tokens;
+  char **alternates;
+  const char *name;
+  guint n_tokens, n_alternates;
+
+  keywords = g_object_get_data (G_OBJECT (child), "emoji-keywords");
+  if (keywords)
+    return keywords;
+
+  g_variant_get_child (emoji_data, 1, "&s", &name);
+  tokens = g_str_tokenize_and_fold (name, NULL, &alternates);
+  n_tokens = g_strv_length (tokens);
+  n_alternates = g_strv_length (alternates);
+
+  keywords = g_renew (char *, tokens, n_tokens + n_alternates + 1);
+  memcpy (keywords + n_tokens, alternates, (n_alternates + 1) * sizeof (char *));
+  g_free (alternates);
+
+  g_object_set_data_full (G_OBJECT (child), "emoji-keywords",
+                          keywords, (GDestroyNotify) g_strfreev);
+
+  return keywords;
+}
+
+/* Like g_str_match_string(), every word of the search has to start
+ * one of the keywords */
+static gboolean
+match_keywords (char **search_tokens,
+                char **keywords)
+{
+  int i, j;
+
+  for (i = 0; search_tokens[i]; i++)
+    {
+      for (j = 0; keywords[j]; j++)
+        {
+          if (g_str_has_prefix (keywords[j], search_tokens[i]))
+            break;
+        }
+
+      if (keywords[j] == NULL)
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
 static gboolean
 filter_func (GtkFlowBoxChild *child,
              gpointer         data)
@@ -498,24 +592,20 @@ filter_func (GtkFlowBoxChild *child,
   EmojiSection *section = data;
   GtkEmojiChooser *chooser;
   GVariant *emoji_data;
-  const char *text;
-  const char *name;
   gboolean res;
 
   res = TRUE;
 
   chooser = GTK_EMOJI_CHOOSER (gtk_widget_get_ancestor (GTK_WIDGET (child), GTK_TYPE_EMOJI_CHOOSER));
-  text = gtk_editable_get_text (GTK_EDITABLE (chooser->search_entry));
   emoji_data = (GVariant *) g_object_get_data (G_OBJECT (child), "emoji-data");
 
-  if (text[0] == 0)
+  if (chooser->search_tokens == NULL)
     goto out;
 
   if (!emoji_data)
     goto out;
 
-  g_variant_get_child (emoji_data, 1, "&s", &name);
-  res = g_str_match_string (text, name, TRUE);
+  res = match_keywords (chooser->search_tokens, get_keywords (child, emoji_data));
 
 out:
   if (res)
@@ -568,6 +658,12 @@ search_changed (GtkEntry *entry,
                 gpointer  data)
 {
   GtkEmojiChooser *chooser = data;
+  const char *text;
+
+  g_clear_pointer (&chooser->search_tokens, g_strfreev);
+  text = gtk_editable_get_text (GTK_EDITABLE (chooser->search_entry));
+  if (text[0] != 0)
+    chooser->search_tokens = g_str_tokenize_and_fold (text, NULL, NULL);
 
   invalidate_section (&chooser->recent);
   invalidate_section (&chooser->people);
@@ -650,7 +746,7 @@ gtk_emoji_chooser_init (GtkEmojiChooser *chooser)
   setup_section (chooser, &chooser->symbols, "ATM sign", "emoji-symbols-symbolic");
   setup_section (chooser, &chooser->flags, "chequered flag", "emoji-flags-symbolic");
 
-  populate_emoji_chooser (chooser);
+  start_populating_emoji_chooser (chooser);
   populate_recent_section (chooser);
 
   /* We scroll to the top on show, so check the right button for the 1st time */
@@ -75,6 +75,18 @@ struct _GtkEntryBufferPrivate
   gsize  normal_text_bytes;
   guint  normal_text_chars;
 
+  /* The unused part of normal_text is kept as a gap at the last
+   * edit position, so that typing into long text does not move
+   * the rest of it around on every keystroke. The gap is always
+   * zeroed and at least one byte long, so that moving it to the
+   * end terminates the text.
+   */
+  gsize  normal_text_gap;
+
+  /* The byte offset of the last character position looked up */
+  guint  offset_cache_chars;
+  gsize  offset_cache_bytes;
+
   gint   max_length;
 };
 
@@ -98,6 +110,127 @@ trash_area (gchar *area,
     *varea++ = 0;
 }
 
+static inline gsize
+gap_size (GtkEntryBufferPrivate *pv)
+{
+  return pv->normal_text_size - pv->normal_text_bytes;
+}
+
+/* Moves the gap to the byte offset @at in the text */
+static void
+move_gap (GtkEntryBufferPrivate *pv,
+          gsize                  at)
+{
+  gsize gap = pv->normal_text_gap;
+  gsize len = gap_size (pv);
+  gsize stale;
+
+  if (at < gap)
+    {
+      memmove (pv->normal_text + at + len, pv->normal_text + at, gap - at);
+      /* Could be a password, the part of the new gap that held text
+       * before must not keep a copy of it.
+       */
+      trash_area (pv->normal_text + at, MIN (gap - at, len));
+    }
+  else if (at > gap)
+    {
+      memmove (pv->normal_text + gap, pv->normal_text + gap + len, at - gap);
+      stale = MAX (at, gap + len);
+      trash_area (pv->normal_text + stale, at + len - stale);
+    }
+
+  pv->normal_text_gap = at;
+}
+
+static gsize
+walk_forward (GtkEntryBufferPrivate *pv,
+              gsize                  byte,
+              guint                  n_chars)
+{
+  gsize gap = pv->normal_text_gap;
+  gsize len = gap_size (pv);
+  const gchar *p, *limit;
+
+  while (n_chars > 0)
+    {
+      if (byte < gap)
+        {
+          p = pv->normal_text + byte;
+          limit = pv->normal_text + gap;
+          for (; n_chars > 0 && p < limit; n_chars--)
+            p = g_utf8_next_char (p);
+          byte = p - pv->normal_text;
+        }
+      else
+        {
+          p = pv->normal_text + byte + len;
+          for (; n_chars > 0; n_chars--)
+            p = g_utf8_next_char (p);
+          byte = p - pv->normal_text - len;
+        }
+    }
+
+  return byte;
+}
+
+static gsize
+walk_backward (GtkEntryBufferPrivate *pv,
+               gsize                  byte,
+               guint                  n_chars)
+{
+  gsize gap = pv->normal_text_gap;
+  gsize len = gap_size (pv);
+  const gchar *p, *limit;
+
+  while (n_chars > 0)
+    {
+      if (byte > gap)
+        {
+          p = pv->normal_text + byte + len;
+          limit = pv->normal_text + gap + len;
+          for (; n_chars > 0 && p > limit; n_chars--)
+            p = g_utf8_prev_char (p);
+          byte = p - pv->normal_text - len;
+        }
+      else
+        {
+          p = pv->normal_text + byte;
+          for (; n_chars > 0; n_chars--)
+            p = g_utf8_prev_char (p);
+          byte = p - pv->normal_text;
+        }
+    }
+
+  return byte;
+}
+
+/* Converts a character position into a byte offset in the text,
+ * walking from the start, the end or the last looked up position,
+ * whichever is closest.
+ */
+static gsize
+offset_to_byte (GtkEntryBufferPrivate *pv,
+                guint                  position)
+{
+  guint cached = pv->offset_cache_chars;
+  gsize byte;
+
+  if (position <= cached / 2)
+    byte = walk_forward (pv, 0, position);
+  else if (position <= cached)
+    byte = walk_backward (pv, pv->offset_cache_bytes, cached - position);
+  else if (position - cached <= (pv->normal_text_chars - position))
+    byte = walk_forward (pv, pv->offset_cache_bytes, position - cached);
+  else
+    byte = walk_backward (pv, pv->normal_text_bytes, pv->normal_text_chars - position);
+
+  pv->offset_cache_chars = position;
+  pv->offset_cache_bytes = byte;
+
+  return byte;
+}
+
 static const gchar*
 gtk_entry_buffer_normal_get_text (GtkEntryBuffer *buffer,
                                   gsize          *n_bytes)
@@ -110,6 +243,9 @@ gtk_entry_buffer_normal_get_text (GtkEntryBuffer *buffer,
   if (!priv->normal_text)
       return "";
 
+  /* The zeroed gap terminates the text once it is at the end */
+  move_gap (priv, priv->normal_text_bytes);
+
   return priv->normal_text;
 }
 
@@ -138,6 +274,7 @@ gtk_entry_buffer_normal_insert_text (GtkEntryBuffer *buffer,
   if (n_bytes + pv->normal_text_bytes + 1 > pv->normal_text_size)
     {
       gchar *et_new;
+      gsize tail;
 
       prev_size = pv->normal_text_size;
 
@@ -165,22 +302,31 @@ gtk_entry_buffer_normal_insert_text (GtkEntryBuffer *buffer,
         }
 
       /* Could be a password, so can't leave stuff in memory. */
-      et_new = g_malloc (pv->normal_text_size);
-      memcpy (et_new, pv->normal_text, MIN (prev_size, pv->normal_text_size));
-      trash_area (pv->normal_text, prev_size);
-      g_free (pv->normal_text);
+      et_new = g_malloc0 (pv->normal_text_size);
+      if (pv->normal_text)
+        {
+          tail = pv->normal_text_bytes - pv->normal_text_gap;
+          memcpy (et_new, pv->normal_text, pv->normal_text_gap);
+          memcpy (et_new + pv->normal_text_size - tail,
+                  pv->normal_text + prev_size - tail,
+                  tail);
+          trash_area (pv->normal_text, prev_size);
+          g_free (pv->normal_text);
+        }
       pv->normal_text = et_new;
     }
 
   /* Actual text insertion */
-  at = g_utf8_offset_to_pointer (pv->normal_text, position) - pv->normal_text;
-  memmove (pv->normal_text + at + n_bytes, pv->normal_text + at, pv->normal_text_bytes - at);
+  at = offset_to_byte (pv, position);
+  move_gap (pv, at);
   memcpy (pv->normal_text + at, chars, n_bytes);
 
   /* Book keeping */
   pv->normal_text_bytes += n_bytes;
   pv->normal_text_chars += n_chars;
-  pv->normal_text[pv->normal_text_bytes] = '\0';
+  pv->normal_text_gap += n_bytes;
+  pv->offset_cache_chars = position + n_chars;
+  pv->offset_cache_bytes = at + n_bytes;
 
   gtk_entry_buffer_emit_inserted_text (buffer, position, chars, n_chars);
   return n_chars;
@@ -201,19 +347,20 @@ gtk_entry_buffer_normal_delete_text (GtkEntryBuffer *buffer,
 
   if (n_chars > 0)
     {
-      start = g_utf8_offset_to_pointer (pv->normal_text, position) - pv->normal_text;
-      end = g_utf8_offset_to_pointer (pv->normal_text, position + n_chars) - pv->normal_text;
+      start = offset_to_byte (pv, position);
+      end = walk_forward (pv, start, n_chars);
 
-      memmove (pv->normal_text + start, pv->normal_text + end, pv->normal_text_bytes + 1 - end);
+      /* The deleted text ends up at the start of the gap */
+      move_gap (pv, end);
+      pv->normal_text_gap = start;
       pv->normal_text_chars -= n_chars;
       pv->normal_text_bytes -= (end - start);
 
       /*
-       * Could be a password, make sure we don't leave anything sensitive after
-       * the terminating zero.  Note, that the terminating zero already trashed
-       * one byte.
+       * Could be a password, make sure we don't leave anything sensitive in
+       * the gap.
        */
-      trash_area (pv->normal_text + pv->normal_text_bytes + 1, end - start - 1);
+      trash_area (pv->normal_text + start, end - start);
 
       gtk_entry_buffer_emit_deleted_text (buffer, position, n_chars);
     }
@@ -257,6 +404,9 @@ gtk_entry_buffer_init (GtkEntryBuffer *buffer)
   pv->normal_text_chars = 0;
   pv->normal_text_bytes = 0;
   pv->normal_text_size = 0;
+  pv->normal_text_gap = 0;
+  pv->offset_cache_chars = 0;
+  pv->offset_cache_bytes = 0;
 }
 
 static void
@@ -272,6 +422,7 @@ gtk_entry_buffer_finalize (GObject *obj)
       pv->normal_text = NULL;
       pv->normal_text_bytes = pv->normal_text_size = 0;
       pv->normal_text_chars = 0;
+      pv->normal_text_gap = 0;
     }
 
   G_OBJECT_CLASS (gtk_entry_buffer_parent_class)->finalize (obj);
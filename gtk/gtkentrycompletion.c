@@ -639,6 +639,7 @@ gtk_entry_completion_set_property (GObject      *object,
 
       case PROP_TEXT_COLUMN:
         priv->text_column = g_value_get_int (value);
+        clear_normalized_rows (completion);
         break;
 
       case PROP_INLINE_COMPLETION:
@@ -749,6 +750,7 @@ gtk_entry_completion_finalize (GObject *object)
 
   g_free (priv->case_normalized_key);
   g_free (priv->completion_prefix);
+  clear_normalized_rows (completion);
 
   if (priv->match_notify)
     (* priv->match_notify) (priv->match_data);
@@ -815,6 +817,66 @@ gtk_entry_completion_get_area (GtkCellLayout *cell_layout)
   return priv->cell_area;
 }
 
+/* The default match func normalizes and case folds every row text
+ * only once. Rows remember whether they matched the last key, when the
+ * key grows they can only match if they did.
+ */
+typedef struct {
+  gchar *case_normalized_string;
+  guint checked_serial;
+  guint matched_serial;
+} NormalizedRow;
+
+static void
+normalized_row_free (gpointer data)
+{
+  NormalizedRow *row = data;
+
+  g_free (row->case_normalized_string);
+  g_slice_free (NormalizedRow, row);
+}
+
+static void
+clear_normalized_rows (GtkEntryCompletion *completion)
+{
+  GtkEntryCompletionPrivate *priv = completion->priv;
+
+  g_clear_pointer (&priv->normalized_rows, g_hash_table_unref);
+  priv->narrowing = FALSE;
+}
+
+static NormalizedRow *
+get_normalized_row (GtkEntryCompletion *completion,
+                    gchar              *item)
+{
+  GtkEntryCompletionPrivate *priv = completion->priv;
+  NormalizedRow *row;
+  gchar *normalized_string;
+
+  if (priv->normalized_rows == NULL)
+    priv->normalized_rows = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                                   g_free, normalized_row_free);
+
+  row = g_hash_table_lookup (priv->normalized_rows, item);
+  if (row != NULL)
+    {
+      g_free (item);
+      return row;
+    }
+
+  row = g_slice_new0 (NormalizedRow);
+  normalized_string = g_utf8_normalize (item, -1, G_NORMALIZE_ALL);
+  if (normalized_string != NULL)
+    {
+      row->case_normalized_string = g_utf8_casefold (normalized_string, -1);
+      g_free (normalized_string);
+    }
+
+  g_hash_table_insert (priv->normalized_rows, item, row);
+
+  return row;
+}
+
 /* all those callbacks */
 static gboolean
 gtk_entry_completion_default_completion_func (GtkEntryCompletion *completion,
@@ -822,39 +884,39 @@ gtk_entry_completion_default_completion_func (GtkEntryCompletion *completion,
                                               GtkTreeIter        *iter,
                                               gpointer            user_data)
 {
+  GtkEntryCompletionPrivate *priv = completion->priv;
   gchar *item = NULL;
-  gchar *normalized_string;
-  gchar *case_normalized_string;
-
+  NormalizedRow *row;
   gboolean ret = FALSE;
 
   GtkTreeModel *model;
 
-  model = gtk_tree_model_filter_get_model (completion->priv->filter_model);
+  model = gtk_tree_model_filter_get_model (priv->filter_model);
 
-  g_return_val_if_fail (gtk_tree_model_get_column_type (model, completion->priv->text_column) == G_TYPE_STRING,
+  g_return_val_if_fail (gtk_tree_model_get_column_type (model, priv->text_column) == G_TYPE_STRING,
                         FALSE);
 
   gtk_tree_model_get (model, iter,
-                      completion->priv->text_column, &item,
+                      priv->text_column, &item,
                       -1);
 
-  if (item != NULL)
-    {
-      normalized_string = g_utf8_normalize (item, -1, G_NORMALIZE_ALL);
+  if (item == NULL)
+    return FALSE;
 
-      if (normalized_string != NULL)
-        {
-          case_normalized_string = g_utf8_casefold (normalized_string, -1);
+  row = get_normalized_row (completion, item);
 
-          if (!strncmp (key, case_normalized_string, strlen (key)))
-            ret = TRUE;
+  /* Rows that did not match the shorter key can't match this one */
+  if (priv->narrowing &&
+      row->checked_serial == priv->match_serial - 1 &&
+      row->matched_serial != priv->match_serial - 1)
+    ret = FALSE;
+  else if (row->case_normalized_string != NULL &&
+           !strncmp (key, row->case_normalized_string, strlen (key)))
+    ret = TRUE;
 
-          g_free (case_normalized_string);
-        }
-      g_free (normalized_string);
-    }
-  g_free (item);
+  row->checked_serial = priv->match_serial;
+  if (ret)
+    row->matched_serial = priv->match_serial;
 
   return ret;
 }
@@ -1045,6 +1107,8 @@ gtk_entry_completion_set_model (GtkEntryCompletion *completion,
   g_return_if_fail (GTK_IS_ENTRY_COMPLETION (completion));
   g_return_if_fail (model == NULL || GTK_IS_TREE_MODEL (model));
 
+  clear_normalized_rows (completion);
+
   if (!model)
     {
       gtk_tree_view_set_model (GTK_TREE_VIEW (completion->priv->tree_view),
@@ -1173,22 +1237,35 @@ gtk_entry_completion_get_minimum_key_length (GtkEntryCompletion *completion)
 void
 gtk_entry_completion_complete (GtkEntryCompletion *completion)
 {
+  GtkEntryCompletionPrivate *priv;
   gchar *tmp;
+  gchar *key;
   GtkTreeIter iter;
 
   g_return_if_fail (GTK_IS_ENTRY_COMPLETION (completion));
   g_return_if_fail (GTK_IS_ENTRY (completion->priv->entry));
 
-  if (!completion->priv->filter_model)
-    return;
+  priv = completion->priv;
 
-  g_free (completion->priv->case_normalized_key);
+  if (!priv->filter_model)
+    return;
 
-  tmp = g_utf8_normalize (gtk_editable_get_text (GTK_EDITABLE (completion->priv->entry)),
+  tmp = g_utf8_normalize (gtk_editable_get_text (GTK_EDITABLE (priv->entry)),
                           -1, G_NORMALIZE_ALL);
-  completion->priv->case_normalized_key = g_utf8_casefold (tmp, -1);
+  key = g_utf8_casefold (tmp, -1);
   g_free (tmp);
 
+  /* A match func may do anything with the key, only narrow
+   * down the matches of the default one */
+  priv->narrowing = priv->match_func == NULL &&
+                    priv->normalized_rows != NULL &&
+                    priv->case_normalized_key != NULL &&
+                    g_str_has_prefix (key, priv->case_normalized_key);
+  priv->match_serial++;
+
+  g_free (priv->case_normalized_key);
+  priv->case_normalized_key = key;
+
   gtk_tree_model_filter_refilter (completion->priv->filter_model);
 
   if (!gtk_tree_model_get_iter_first (GTK_TREE_MODEL (completion->priv->filter_model), &iter))
@@ -1322,6 +1399,7 @@ gtk_entry_completion_set_text_column (GtkEntryCompletion *completion,
     return;
 
   completion->priv->text_column = column;
+  clear_normalized_rows (completion);
 
   cell = gtk_cell_renderer_text_new ();
   gtk_cell_layout_pack_start (GTK_CELL_LAYOUT (completion),
@@ -49,6 +49,12 @@ struct _GtkEntryCompletionPrivate
 
   gchar *case_normalized_key;
 
+  /* For the default match func: row texts mapping to their
+   * normalized keys, and the number of the current match */
+  GHashTable *normalized_rows;
+  guint match_serial;
+  guint narrowing          : 1;
+
   GtkEventController *entry_key_controller;
 
   /* only used by GtkEntry when attached: */
@@ -1034,6 +1034,26 @@ typedef enum
 } GtkPopoverConstraint;
 
 
+/**
+ * GtkFramePhase:
+ * @GTK_FRAME_PHASE_STYLE: Validating CSS styles
+ * @GTK_FRAME_PHASE_MEASURE: Measuring widgets with gtk_widget_measure()
+ * @GTK_FRAME_PHASE_ALLOCATE: Allocating widgets with gtk_widget_allocate()
+ * @GTK_FRAME_PHASE_SNAPSHOT: Creating render nodes with gtk_widget_snapshot()
+ * @GTK_FRAME_PHASE_RENDER: Rendering the frame with the window’s #GskRenderer
+ *
+ * The parts of a frame of a #GtkWindow that are tracked by
+ * #GtkFramePhaseTimings.
+ */
+typedef enum
+{
+  GTK_FRAME_PHASE_STYLE,
+  GTK_FRAME_PHASE_MEASURE,
+  GTK_FRAME_PHASE_ALLOCATE,
+  GTK_FRAME_PHASE_SNAPSHOT,
+  GTK_FRAME_PHASE_RENDER
+} GtkFramePhase;
+
 typedef enum {
   GTK_PLACES_OPEN_NORMAL     = 1 << 0,
   GTK_PLACES_OPEN_NEW_TAB    = 1 << 1,
@@ -24,9 +24,12 @@
 
 #include "gtkcelllayout.h"
 #include "gtkcellrenderertext.h"
+#include "gtkdirectorylistingprivate.h"
 #include "gtkentryprivate.h"
-#include "gtkfilesystemmodel.h"
+#include "gtkfilesystem.h"
 #include "gtklabel.h"
+#include "gtkliststore.h"
+#include "gtkprivate.h"
 #include "gtkmain.h"
 #include "gtksizerequest.h"
 #include "gtkwindow.h"
@@ -59,6 +62,14 @@ struct _GtkFileChooserEntry
   GtkTreeModel *completion_store;
   GtkFileFilter *current_filter;
 
+  /* The files of current_folder_file, and the ones that matched
+   * matches_file_part at matches_serial. Typing more characters only
+   * needs to look at the files that matched before */
+  GtkDirectoryListing *listing;
+  GPtrArray *matches;
+  char *matches_file_part;
+  guint matches_serial;
+
   guint current_folder_loaded : 1;
   guint complete_on_load : 1;
   guint eat_tabs       : 1;
@@ -70,6 +81,7 @@ enum
 {
   DISPLAY_NAME_COLUMN,
   FULL_PATH_COLUMN,
+  FILE_INFO_COLUMN,
   N_COLUMNS
 };
 
@@ -113,9 +125,8 @@ static void refresh_current_folder_and_file_part (GtkFileChooserEntry *chooser_e
 static void set_completion_folder (GtkFileChooserEntry *chooser_entry,
                                    GFile               *folder,
 				   char                *dir_part);
-static void finished_loading_cb (GtkFileSystemModel  *model,
-                                 GError              *error,
-		                 GtkFileChooserEntry *chooser_entry);
+static void listing_changed (GtkDirectoryListing *listing,
+                             gpointer             data);
 
 G_DEFINE_TYPE (GtkFileChooserEntry, _gtk_file_chooser_entry, GTK_TYPE_ENTRY)
 
@@ -189,26 +200,33 @@ match_func (GtkEntryCompletion *compl,
 {
   GtkFileChooserEntry *chooser_entry = user_data;
 
-  /* If we arrive here, the GtkFileSystemModel's GtkFileFilter already filtered out all
-   * files that don't start with the current prefix, so we manually apply the GtkFileChooser's
+  /* If we arrive here, the completion store only contains the files that
+   * start with the current prefix, so we manually apply the GtkFileChooser's
    * current file filter (e.g. just jpg files) here. */
   if (chooser_entry->current_filter != NULL)
     {
       char *mime_type = NULL;
+      char *filename = NULL;
+      char *uri = NULL;
       gboolean matches;
       GFile *file;
       GFileInfo *file_info;
       GtkFileFilterInfo filter_info;
       GtkFileFilterFlags needed_flags;
 
-      file = _gtk_file_system_model_get_file (GTK_FILE_SYSTEM_MODEL (chooser_entry->completion_store),
-                                              iter);
-      file_info = _gtk_file_system_model_get_info (GTK_FILE_SYSTEM_MODEL (chooser_entry->completion_store),
-                                                   iter);
+      gtk_tree_model_get (chooser_entry->completion_store, iter,
+                          FILE_INFO_COLUMN, &file_info,
+                          -1);
 
       /* We always allow navigating into subfolders, so don't ever filter directories */
       if (g_file_info_get_file_type (file_info) != G_FILE_TYPE_REGULAR)
-        return TRUE;
+        {
+          g_object_unref (file_info);
+          return TRUE;
+        }
+
+      file = g_file_get_child (gtk_directory_listing_get_directory (chooser_entry->listing),
+                               g_file_info_get_name (file_info));
 
       needed_flags = gtk_file_filter_get_needed (chooser_entry->current_filter);
 
@@ -231,17 +249,17 @@ match_func (GtkEntryCompletion *compl,
 
       if (needed_flags & GTK_FILE_FILTER_FILENAME)
         {
-          const char *path = g_file_get_path (file);
-          if (path != NULL)
+          filename = g_file_get_path (file);
+          if (filename != NULL)
             {
-              filter_info.filename = path;
+              filter_info.filename = filename;
               filter_info.contains |= GTK_FILE_FILTER_FILENAME;
             }
         }
 
       if (needed_flags & GTK_FILE_FILTER_URI)
         {
-          const char *uri = g_file_get_uri (file);
+          uri = g_file_get_uri (file);
           if (uri)
             {
               filter_info.uri = uri;
@@ -252,6 +270,10 @@ match_func (GtkEntryCompletion *compl,
       matches = gtk_file_filter_filter (chooser_entry->current_filter, &filter_info);
 
       g_free (mime_type);
+      g_free (filename);
+      g_free (uri);
+      g_object_unref (file);
+      g_object_unref (file_info);
       return matches;
     }
 
@@ -335,6 +357,7 @@ gtk_file_chooser_entry_finalize (GObject *object)
 
   g_free (chooser_entry->dir_part);
   g_free (chooser_entry->file_part);
+  g_free (chooser_entry->matches_file_part);
 
   G_OBJECT_CLASS (_gtk_file_chooser_entry_parent_class)->finalize (object);
 }
@@ -577,6 +600,9 @@ update_inline_completion (GtkFileChooserEntry *chooser_entry)
 static void
 discard_completion_store (GtkFileChooserEntry *chooser_entry)
 {
+  g_clear_pointer (&chooser_entry->matches, g_ptr_array_unref);
+  g_clear_pointer (&chooser_entry->matches_file_part, g_free);
+
   if (!chooser_entry->completion_store)
     return;
 
@@ -587,80 +613,119 @@ discard_completion_store (GtkFileChooserEntry *chooser_entry)
 }
 
 static gboolean
-completion_store_set (GtkFileSystemModel  *model,
-                      GFile               *file,
-                      GFileInfo           *info,
-                      int                  column,
-                      GValue              *value,
-                      gpointer             data)
+is_literal (const char *file_part)
 {
-  GtkFileChooserEntry *chooser_entry = data;
+  return strpbrk (file_part, "*?[\\") == NULL;
+}
+
+static gboolean
+file_matches (GtkFileChooserEntry *chooser_entry,
+              GFileInfo           *info,
+              const char          *pattern)
+{
+  if (!_gtk_file_info_consider_as_directory (info) &&
+      chooser_entry->action != GTK_FILE_CHOOSER_ACTION_OPEN &&
+      chooser_entry->action != GTK_FILE_CHOOSER_ACTION_SAVE)
+    return FALSE;
+
+  return _gtk_fnmatch (pattern, g_file_info_get_display_name (info), FALSE);
+}
+
+/* Fills the completion store with the files of the current folder
+ * that start with the file part
+ */
+static void
+update_completion_store (GtkFileChooserEntry *chooser_entry)
+{
+  GPtrArray *files, *matches;
+  GtkListStore *store;
+  char *pattern;
+  guint serial, i;
+
+  serial = gtk_directory_listing_get_serial (chooser_entry->listing);
+
+  if (chooser_entry->matches &&
+      chooser_entry->matches_serial == serial &&
+      g_strcmp0 (chooser_entry->matches_file_part, chooser_entry->file_part) == 0)
+    return;
+
+  /* A longer prefix matches a subset of the files that matched before,
+   * unless the prefix was a pattern itself */
+  if (chooser_entry->matches &&
+      chooser_entry->matches_serial == serial &&
+      is_literal (chooser_entry->matches_file_part) &&
+      g_str_has_prefix (chooser_entry->file_part, chooser_entry->matches_file_part))
+    files = chooser_entry->matches;
+  else
+    files = gtk_directory_listing_get_infos (chooser_entry->listing);
+
+  pattern = g_strconcat (chooser_entry->file_part, "*", NULL);
+  matches = g_ptr_array_new_with_free_func (g_object_unref);
+  for (i = 0; i < files->len; i++)
+    {
+      GFileInfo *info = g_ptr_array_index (files, i);
+
+      if (file_matches (chooser_entry, info, pattern))
+        g_ptr_array_add (matches, g_object_ref (info));
+    }
+  g_free (pattern);
+
+  g_free (chooser_entry->matches_file_part);
+  chooser_entry->matches_file_part = g_strdup (chooser_entry->file_part);
+
+  /* Nothing was filtered out, the store is still right */
+  if (files == chooser_entry->matches &&
+      matches->len == chooser_entry->matches->len &&
+      chooser_entry->completion_store)
+    {
+      g_ptr_array_unref (matches);
+      return;
+    }
 
-  const char *prefix = "";
-  const char *suffix = "";
+  g_clear_pointer (&chooser_entry->matches, g_ptr_array_unref);
+  chooser_entry->matches = matches;
+  chooser_entry->matches_serial = serial;
 
-  switch (column)
+  /* A new store is cheaper than changing the rows of the one the
+   * completion is using */
+  store = gtk_list_store_new (N_COLUMNS, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_FILE_INFO);
+  for (i = 0; i < matches->len; i++)
     {
-    case FULL_PATH_COLUMN:
-      prefix = chooser_entry->dir_part;
-      /* fall through */
-    case DISPLAY_NAME_COLUMN:
+      GFileInfo *info = g_ptr_array_index (matches, i);
+      const char *suffix = "";
+      char *display_name, *full_path;
+
       if (_gtk_file_info_consider_as_directory (info))
         suffix = G_DIR_SEPARATOR_S;
 
-      g_value_take_string (value,
-			   g_strconcat (prefix,
-					g_file_info_get_display_name (info),
-					suffix,
-					NULL));
-      break;
-    default:
-      g_assert_not_reached ();
-      break;
-    }
+      display_name = g_strconcat (g_file_info_get_display_name (info), suffix, NULL);
+      full_path = g_strconcat (chooser_entry->dir_part, display_name, NULL);
 
-  return TRUE;
-}
+      gtk_list_store_insert_with_values (store, NULL, -1,
+                                         DISPLAY_NAME_COLUMN, display_name,
+                                         FULL_PATH_COLUMN, full_path,
+                                         FILE_INFO_COLUMN, info,
+                                         -1);
 
-/* Fills the completion store from the contents of the current folder */
-static void
-populate_completion_store (GtkFileChooserEntry *chooser_entry)
-{
-  chooser_entry->completion_store = GTK_TREE_MODEL (
-      _gtk_file_system_model_new_for_directory (chooser_entry->current_folder_file,
-                                                "standard::name,standard::display-name,standard::type,"
-                                                "standard::content-type",
-                                                completion_store_set,
-                                                chooser_entry,
-                                                N_COLUMNS,
-                                                G_TYPE_STRING,
-                                                G_TYPE_STRING));
-  g_signal_connect (chooser_entry->completion_store, "finished-loading",
-		    G_CALLBACK (finished_loading_cb), chooser_entry);
-
-  _gtk_file_system_model_set_filter_folders (GTK_FILE_SYSTEM_MODEL (chooser_entry->completion_store),
-                                             TRUE);
-  _gtk_file_system_model_set_show_files (GTK_FILE_SYSTEM_MODEL (chooser_entry->completion_store),
-                                         chooser_entry->action == GTK_FILE_CHOOSER_ACTION_OPEN ||
-                                         chooser_entry->action == GTK_FILE_CHOOSER_ACTION_SAVE);
-  gtk_tree_sortable_set_sort_column_id (GTK_TREE_SORTABLE (chooser_entry->completion_store),
-					DISPLAY_NAME_COLUMN, GTK_SORT_ASCENDING);
+      g_free (display_name);
+      g_free (full_path);
+    }
 
+  g_clear_object (&chooser_entry->completion_store);
+  chooser_entry->completion_store = GTK_TREE_MODEL (store);
   gtk_entry_completion_set_model (gtk_entry_get_completion (GTK_ENTRY (chooser_entry)),
 				  chooser_entry->completion_store);
 }
 
-/* Callback when the current folder finishes loading */
+/* Called when the current folder finishes loading */
 static void
-finished_loading_cb (GtkFileSystemModel  *model,
-                     GError              *error,
-		     GtkFileChooserEntry *chooser_entry)
+finished_loading (GtkFileChooserEntry *chooser_entry)
 {
   GtkEntryCompletion *completion;
 
   chooser_entry->current_folder_loaded = TRUE;
 
-  if (error)
+  if (gtk_directory_listing_get_error (chooser_entry->listing))
     {
       discard_completion_store (chooser_entry);
       set_complete_on_load (chooser_entry, FALSE);
@@ -682,6 +747,20 @@ finished_loading_cb (GtkFileSystemModel  *model,
     }
 }
 
+static void
+listing_changed (GtkDirectoryListing *listing,
+                 gpointer             data)
+{
+  GtkFileChooserEntry *chooser_entry = data;
+
+  if (gtk_directory_listing_get_error (listing) == NULL)
+    update_completion_store (chooser_entry);
+
+  if (!chooser_entry->current_folder_loaded &&
+      gtk_directory_listing_is_loaded (listing))
+    finished_loading (chooser_entry);
+}
+
 static void
 set_completion_folder (GtkFileChooserEntry *chooser_entry,
                        GFile               *folder_file,
@@ -707,6 +786,12 @@ set_completion_folder (GtkFileChooserEntry *chooser_entry,
       chooser_entry->current_folder_file = NULL;
     }
 
+  if (chooser_entry->listing)
+    {
+      gtk_directory_listing_remove_watch (chooser_entry->listing, listing_changed, chooser_entry);
+      g_clear_pointer (&chooser_entry->listing, gtk_directory_listing_unref);
+    }
+
   g_free (chooser_entry->dir_part);
   chooser_entry->dir_part = g_strdup (dir_part);
   
@@ -717,7 +802,19 @@ set_completion_folder (GtkFileChooserEntry *chooser_entry,
   if (folder_file)
     {
       chooser_entry->current_folder_file = g_object_ref (folder_file);
-      populate_completion_store (chooser_entry);
+      chooser_entry->listing = gtk_directory_listing_get (folder_file);
+      gtk_directory_listing_add_watch (chooser_entry->listing, listing_changed, chooser_entry);
+
+      /* Folders that were listed recently are completed right away */
+      if (gtk_directory_listing_get_error (chooser_entry->listing) == NULL)
+        update_completion_store (chooser_entry);
+      if (gtk_directory_listing_is_loaded (chooser_entry->listing))
+        {
+          chooser_entry->current_folder_loaded = TRUE;
+          if (gtk_directory_listing_get_error (chooser_entry->listing))
+            discard_completion_store (chooser_entry);
+          update_inline_completion (chooser_entry);
+        }
     }
 }
 
@@ -755,20 +852,7 @@ refresh_current_folder_and_file_part (GtkFileChooserEntry *chooser_entry)
 
   if (chooser_entry->completion_store &&
       (g_strcmp0 (old_file_part, chooser_entry->file_part) != 0))
-    {
-      GtkFileFilter *filter;
-      char *pattern;
-
-      filter = gtk_file_filter_new ();
-      pattern = g_strconcat (chooser_entry->file_part, "*", NULL);
-      gtk_file_filter_add_pattern (filter, pattern);
-
-      _gtk_file_system_model_set_filter (GTK_FILE_SYSTEM_MODEL (chooser_entry->completion_store),
-                                         filter);
-
-      g_free (pattern);
-      g_object_unref (filter);
-    }
+    update_completion_store (chooser_entry);
 
   g_free (text);
   g_free (old_file_part);
@@ -984,9 +1068,11 @@ _gtk_file_chooser_entry_set_action (GtkFileChooserEntry *chooser_entry,
 	}
 
       if (chooser_entry->completion_store)
-        _gtk_file_system_model_set_show_files (GTK_FILE_SYSTEM_MODEL (chooser_entry->completion_store),
-                                               action == GTK_FILE_CHOOSER_ACTION_OPEN ||
-                                               action == GTK_FILE_CHOOSER_ACTION_SAVE);
+        {
+          /* Files are shown or hidden now */
+          g_clear_pointer (&chooser_entry->matches, g_ptr_array_unref);
+          update_completion_store (chooser_entry);
+        }
 
       update_inline_completion (chooser_entry);
     }
@@ -1014,19 +1100,18 @@ gboolean
 _gtk_file_chooser_entry_get_is_folder (GtkFileChooserEntry *chooser_entry,
 				       GFile               *file)
 {
-  GtkTreeIter iter;
   GFileInfo *info;
+  char *name;
 
   if (chooser_entry->completion_store == NULL ||
-      !_gtk_file_system_model_get_iter_for_file (GTK_FILE_SYSTEM_MODEL (chooser_entry->completion_store),
-                                                 &iter,
-                                                 file))
+      !g_file_has_parent (file, gtk_directory_listing_get_directory (chooser_entry->listing)))
     return FALSE;
 
-  info = _gtk_file_system_model_get_info (GTK_FILE_SYSTEM_MODEL (chooser_entry->completion_store),
-                                          &iter);
+  name = g_file_get_basename (file);
+  info = gtk_directory_listing_lookup (chooser_entry->listing, name);
+  g_free (name);
 
-  return _gtk_file_info_consider_as_directory (info);
+  return info != NULL && _gtk_file_info_consider_as_directory (info);
 }
 
 
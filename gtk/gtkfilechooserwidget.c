@@ -82,6 +82,7 @@
 #include "gtkdebug.h"
 #include "gtkfilechoosererrorstackprivate.h"
 #include "gtkentryprivate.h"
+#include "gtkthumbnailcacheprivate.h"
 
 #include <cairo-gobject.h>
 
@@ -254,6 +255,11 @@ struct _GtkFileChooserWidgetPrivate {
 
   GtkFileSystemModel *browse_files_model;
   char *browse_files_last_selected_name;
+  double browse_files_last_scroll_value;
+
+  /* Files whose thumbnail was decoded since the last frame */
+  GHashTable *thumbnails_ready;
+  guint thumbnails_tick_id;
 
   GtkWidget *places_sidebar;
   GtkWidget *places_view;
@@ -431,6 +437,9 @@ enum {
 
 #define ICON_SIZE 16
 
+/* Rows ahead of the scroll direction to load thumbnails for */
+#define THUMBNAIL_PREFETCH_ROWS 32
+
 #define PREVIEW_HBOX_SPACING 12
 #define NUM_LINES 45
 #define NUM_CHARS 60
@@ -3457,6 +3466,34 @@ gtk_file_chooser_widget_get_property (GObject    *object,
 }
 
 /* This cancels everything that may be going on in the background. */
+static void
+stop_loading_thumbnails (GtkFileChooserWidget *impl)
+{
+  GtkFileChooserWidgetPrivate *priv = impl->priv;
+  gboolean pending;
+
+  pending = gtk_thumbnail_cache_cancel (gtk_thumbnail_cache_get_default (), impl) > 0;
+
+  if (priv->thumbnails_tick_id)
+    {
+      gtk_widget_remove_tick_callback (priv->browse_files_tree_view, priv->thumbnails_tick_id);
+      priv->thumbnails_tick_id = 0;
+    }
+
+  if (priv->thumbnails_ready)
+    {
+      if (g_hash_table_size (priv->thumbnails_ready) > 0)
+        pending = TRUE;
+      g_clear_pointer (&priv->thumbnails_ready, g_hash_table_unref);
+    }
+
+  /* Rows waiting for their thumbnail show the icon for their type
+   * until it is decoded, so they need to look it up again.
+   */
+  if (pending)
+    clear_model_cache (impl, MODEL_COL_ICON);
+}
+
 static void
 cancel_all_operations (GtkFileChooserWidget *impl)
 {
@@ -3490,6 +3527,7 @@ cancel_all_operations (GtkFileChooserWidget *impl)
 
   search_stop_searching (impl, TRUE);
   recent_stop_loading (impl);
+  stop_loading_thumbnails (impl);
 }
 
 /* Removes the settings signal handler.  It's safe to call multiple times */
@@ -4767,6 +4805,185 @@ file_system_model_got_thumbnail (GObject      *object,
   g_object_unref (queried);
 }
 
+static void
+query_thumbnail_info (GtkFileSystemModel *model,
+                      GFile              *file,
+                      GFileInfo          *info)
+{
+  g_file_info_set_attribute_boolean (info, "filechooser::queried", TRUE);
+  g_file_query_info_async (file,
+                           G_FILE_ATTRIBUTE_THUMBNAIL_PATH ","
+                           G_FILE_ATTRIBUTE_THUMBNAILING_FAILED ","
+                           G_FILE_ATTRIBUTE_STANDARD_ICON,
+                           G_FILE_QUERY_INFO_NONE,
+                           G_PRIORITY_DEFAULT,
+                           _gtk_file_system_model_get_cancellable (model),
+                           file_system_model_got_thumbnail,
+                           model);
+}
+
+static void
+show_ready_thumbnail (GtkFileSystemModel *model,
+                     GFile              *file)
+{
+  if (model)
+    _gtk_file_system_model_clear_value (model, file, MODEL_COL_ICON);
+}
+
+/* Shows the thumbnails decoded since the last frame in one go */
+static gboolean
+update_thumbnails (GtkWidget     *widget,
+                   GdkFrameClock *frame_clock,
+                   gpointer       data)
+{
+  GtkFileChooserWidget *impl = data;
+  GtkFileChooserWidgetPrivate *priv = impl->priv;
+  GHashTableIter iter;
+  GFile *file;
+
+  priv->thumbnails_tick_id = 0;
+
+  g_hash_table_iter_init (&iter, priv->thumbnails_ready);
+  while (g_hash_table_iter_next (&iter, (gpointer *) &file, NULL))
+    {
+      show_ready_thumbnail (priv->browse_files_model, file);
+      show_ready_thumbnail (priv->search_model, file);
+      show_ready_thumbnail (priv->recent_model, file);
+    }
+
+  g_hash_table_remove_all (priv->thumbnails_ready);
+
+  return G_SOURCE_REMOVE;
+}
+
+static void
+thumbnail_ready (gpointer   owner,
+                 GdkPixbuf *pixbuf,
+                 gpointer   data)
+{
+  GtkFileChooserWidget *impl = owner;
+  GtkFileChooserWidgetPrivate *priv = impl->priv;
+  GFile *file = data;
+
+  /* The row keeps the icon for its type */
+  if (pixbuf == NULL)
+    return;
+
+  if (priv->thumbnails_ready == NULL)
+    priv->thumbnails_ready = g_hash_table_new_full (g_file_hash,
+                                                    (GEqualFunc) g_file_equal,
+                                                    g_object_unref,
+                                                    NULL);
+
+  g_hash_table_add (priv->thumbnails_ready, g_object_ref (file));
+
+  if (priv->thumbnails_tick_id == 0)
+    priv->thumbnails_tick_id = gtk_widget_add_tick_callback (priv->browse_files_tree_view,
+                                                             update_thumbnails,
+                                                             impl,
+                                                             NULL);
+}
+
+static void
+load_thumbnail (GtkFileChooserWidget *impl,
+                GFile                *file,
+                GFileInfo            *info,
+                GtkThumbnailPriority  priority)
+{
+  const char *thumbnail_path;
+  guint64 mtime;
+  int size;
+
+  thumbnail_path = g_file_info_get_attribute_byte_string (info, G_FILE_ATTRIBUTE_THUMBNAIL_PATH);
+  mtime = g_file_info_get_attribute_uint64 (info, G_FILE_ATTRIBUTE_TIME_MODIFIED);
+  size = ICON_SIZE * gtk_widget_get_scale_factor (GTK_WIDGET (impl));
+
+  /* Prefetched thumbnails just go to the cache, their rows look
+   * them up when they are shown.
+   */
+  if (priority == GTK_THUMBNAIL_PRIORITY_PREFETCH)
+    gtk_thumbnail_cache_load (gtk_thumbnail_cache_get_default (),
+                              thumbnail_path, mtime, size,
+                              priority, impl,
+                              NULL, NULL, NULL);
+  else
+    gtk_thumbnail_cache_load (gtk_thumbnail_cache_get_default (),
+                              thumbnail_path, mtime, size,
+                              priority, impl,
+                              thumbnail_ready, g_object_ref (file), g_object_unref);
+}
+
+/* Loads thumbnails for the rows about to be scrolled into view */
+static void
+browse_files_scrolled (GtkAdjustment        *adjustment,
+                       GtkFileChooserWidget *impl)
+{
+  GtkFileChooserWidgetPrivate *priv = impl->priv;
+  GtkTreeModel *tree_model;
+  GtkTreePath *start, *end, *path;
+  GtkTreeIter iter;
+  gboolean forward;
+  double value;
+  int first, last, i;
+
+  value = gtk_adjustment_get_value (adjustment);
+  forward = value >= priv->browse_files_last_scroll_value;
+  priv->browse_files_last_scroll_value = value;
+
+  tree_model = gtk_tree_view_get_model (GTK_TREE_VIEW (priv->browse_files_tree_view));
+  if (!GTK_IS_FILE_SYSTEM_MODEL (tree_model))
+    return;
+
+  if (!gtk_tree_view_get_visible_range (GTK_TREE_VIEW (priv->browse_files_tree_view), &start, &end))
+    return;
+
+  if (forward)
+    {
+      first = gtk_tree_path_get_indices (end)[0] + 1;
+      last = first + THUMBNAIL_PREFETCH_ROWS;
+    }
+  else
+    {
+      last = gtk_tree_path_get_indices (start)[0];
+      first = MAX (last - THUMBNAIL_PREFETCH_ROWS, 0);
+    }
+
+  gtk_tree_path_free (start);
+  gtk_tree_path_free (end);
+
+  for (i = first; i < last; i++)
+    {
+      GFileInfo *info;
+
+      path = gtk_tree_path_new_from_indices (i, -1);
+      if (!gtk_tree_model_get_iter (tree_model, &iter, path))
+        {
+          gtk_tree_path_free (path);
+          break;
+        }
+      gtk_tree_path_free (path);
+
+      info = _gtk_file_system_model_get_info (GTK_FILE_SYSTEM_MODEL (tree_model), &iter);
+      if (info == NULL)
+        continue;
+
+      if (g_file_info_has_attribute (info, G_FILE_ATTRIBUTE_STANDARD_ICON))
+        {
+          if (g_file_info_has_attribute (info, G_FILE_ATTRIBUTE_THUMBNAIL_PATH))
+            load_thumbnail (impl,
+                            _gtk_file_system_model_get_file (GTK_FILE_SYSTEM_MODEL (tree_model), &iter),
+                            info,
+                            GTK_THUMBNAIL_PRIORITY_PREFETCH);
+        }
+      else if (!g_file_info_has_attribute (info, "filechooser::queried"))
+        {
+          query_thumbnail_info (GTK_FILE_SYSTEM_MODEL (tree_model),
+                                _gtk_file_system_model_get_file (GTK_FILE_SYSTEM_MODEL (tree_model), &iter),
+                                info);
+        }
+    }
+}
+
 static gboolean
 file_system_model_set (GtkFileSystemModel *model,
                        GFile              *file,
@@ -4831,7 +5048,13 @@ file_system_model_set (GtkFileSystemModel *model,
         {
           if (g_file_info_has_attribute (info, G_FILE_ATTRIBUTE_STANDARD_ICON))
             {
-              g_value_take_object (value, _gtk_file_info_get_icon (info, ICON_SIZE, gtk_widget_get_scale_factor (GTK_WIDGET (impl))));
+              gboolean needs_thumbnail;
+
+              g_value_take_object (value, _gtk_file_info_peek_icon (info, ICON_SIZE,
+                                                                    gtk_widget_get_scale_factor (GTK_WIDGET (impl)),
+                                                                    &needs_thumbnail));
+              if (needs_thumbnail)
+                load_thumbnail (impl, file, info, GTK_THUMBNAIL_PRIORITY_VISIBLE);
             }
           else
             {
@@ -4867,18 +5090,7 @@ file_system_model_set (GtkFileSystemModel *model,
               else
                 visible = TRUE;
               if (visible)
-                {
-                  g_file_info_set_attribute_boolean (info, "filechooser::queried", TRUE);
-                  g_file_query_info_async (file,
-                                           G_FILE_ATTRIBUTE_THUMBNAIL_PATH ","
-                                           G_FILE_ATTRIBUTE_THUMBNAILING_FAILED ","
-                                           G_FILE_ATTRIBUTE_STANDARD_ICON,
-                                           G_FILE_QUERY_INFO_NONE,
-                                           G_PRIORITY_DEFAULT,
-                                           _gtk_file_system_model_get_cancellable (model),
-                                           file_system_model_got_thumbnail,
-                                           model);
-                }
+                query_thumbnail_info (model, file, info);
               return FALSE;
             }
         }
@@ -8445,6 +8657,8 @@ post_process_ui (GtkFileChooserWidget *impl)
   g_object_set_data (G_OBJECT (impl->priv->browse_files_tree_view), I_("GtkFileChooserWidget"), impl);
 
   /* Setup file list treeview */
+  g_signal_connect (gtk_scrollable_get_vadjustment (GTK_SCROLLABLE (impl->priv->browse_files_tree_view)),
+                    "value-changed", G_CALLBACK (browse_files_scrolled), impl);
   selection = gtk_tree_view_get_selection (GTK_TREE_VIEW (impl->priv->browse_files_tree_view));
   gtk_tree_selection_set_select_function (selection,
                                           list_select_func,
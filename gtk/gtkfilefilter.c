@@ -75,6 +75,7 @@
 
 typedef struct _GtkFileFilterClass GtkFileFilterClass;
 typedef struct _FilterRule FilterRule;
+typedef struct _CompiledFilter CompiledFilter;
 
 #define GTK_FILE_FILTER_CLASS(klass)     (G_TYPE_CHECK_CLASS_CAST ((klass), GTK_TYPE_FILE_FILTER, GtkFileFilterClass))
 #define GTK_IS_FILE_FILTER_CLASS(klass)  (G_TYPE_CHECK_CLASS_TYPE ((klass), GTK_TYPE_FILE_FILTER))
@@ -100,6 +101,8 @@ struct _GtkFileFilter
   GSList *rules;
 
   GtkFileFilterFlags needed;
+
+  CompiledFilter *compiled;
 };
 
 struct _FilterRule
@@ -119,6 +122,23 @@ struct _FilterRule
   } u;
 };
 
+/* The rules, sorted for checking a file with as few lookups as
+ * possible; built when filtering the first file after rules changed.
+ */
+struct _CompiledFilter
+{
+  GHashTable *names;            /* patterns without wildcards */
+  GHashTable *suffixes;         /* "*suffix" patterns, without the star */
+  GArray *suffix_lengths;       /* distinct lengths of the suffixes */
+  GPtrArray *patterns;          /* other patterns, for _gtk_fnmatch() */
+
+  GPtrArray *content_types;     /* of the mime type rules */
+  GHashTable *pixbuf_mime_types;
+  GHashTable *mime_type_matches; /* mime type => GINT_TO_POINTER (match + 1) */
+
+  GSList *custom;               /* FilterRule */
+};
+
 static void gtk_file_filter_finalize   (GObject            *object);
 
 
@@ -182,11 +202,26 @@ filter_rule_free (FilterRule *rule)
   g_slice_free (FilterRule, rule);
 }
 
+static void
+compiled_filter_free (CompiledFilter *compiled)
+{
+  g_hash_table_unref (compiled->names);
+  g_hash_table_unref (compiled->suffixes);
+  g_array_unref (compiled->suffix_lengths);
+  g_ptr_array_unref (compiled->patterns);
+  g_ptr_array_unref (compiled->content_types);
+  g_hash_table_unref (compiled->pixbuf_mime_types);
+  g_hash_table_unref (compiled->mime_type_matches);
+  g_slist_free (compiled->custom);
+  g_slice_free (CompiledFilter, compiled);
+}
+
 static void
 gtk_file_filter_finalize (GObject  *object)
 {
   GtkFileFilter *filter = GTK_FILE_FILTER (object);
 
+  g_clear_pointer (&filter->compiled, compiled_filter_free);
   g_slist_free_full (filter->rules, (GDestroyNotify)filter_rule_free);
 
   g_free (filter->name);
@@ -446,6 +481,8 @@ file_filter_add_rule (GtkFileFilter *filter,
 {
   filter->needed |= rule->needed;
   filter->rules = g_slist_append (filter->rules, rule);
+
+  g_clear_pointer (&filter->compiled, compiled_filter_free);
 }
 
 /**
@@ -703,6 +740,166 @@ _gtk_file_filter_get_as_patterns (GtkFileFilter      *filter)
   return (char **)g_ptr_array_free (array, FALSE);
 }
 
+static gboolean
+is_literal (const char *pattern)
+{
+#ifdef G_PLATFORM_WIN32
+  /* _gtk_fnmatch() is case insensitive there */
+  return FALSE;
+#else
+  return strpbrk (pattern, "*?[\\") == NULL;
+#endif
+}
+
+static void
+compile_pattern (CompiledFilter *compiled,
+                 const char     *pattern)
+{
+  if (is_literal (pattern))
+    g_hash_table_add (compiled->names, (gpointer) pattern);
+  else if (pattern[0] == '*' && is_literal (pattern + 1) &&
+           strchr (pattern, G_DIR_SEPARATOR) == NULL)
+    {
+      guint len = strlen (pattern + 1);
+      guint i;
+
+      g_hash_table_add (compiled->suffixes, (gpointer) (pattern + 1));
+
+      for (i = 0; i < compiled->suffix_lengths->len; i++)
+        {
+          if (g_array_index (compiled->suffix_lengths, guint, i) == len)
+            break;
+        }
+      if (i == compiled->suffix_lengths->len)
+        g_array_append_val (compiled->suffix_lengths, len);
+    }
+  else
+    g_ptr_array_add (compiled->patterns, (gpointer) pattern);
+}
+
+static CompiledFilter *
+gtk_file_filter_compile (GtkFileFilter *filter)
+{
+  CompiledFilter *compiled;
+  GSList *l, *list;
+
+  compiled = g_slice_new0 (CompiledFilter);
+  compiled->names = g_hash_table_new (g_str_hash, g_str_equal);
+  compiled->suffixes = g_hash_table_new (g_str_hash, g_str_equal);
+  compiled->suffix_lengths = g_array_new (FALSE, FALSE, sizeof (guint));
+  compiled->patterns = g_ptr_array_new ();
+  compiled->content_types = g_ptr_array_new_with_free_func (g_free);
+  compiled->pixbuf_mime_types = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+  compiled->mime_type_matches = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+
+  for (l = filter->rules; l; l = l->next)
+    {
+      FilterRule *rule = l->data;
+
+      switch (rule->type)
+        {
+        case FILTER_RULE_MIME_TYPE:
+          {
+            gchar *content_type = g_content_type_from_mime_type (rule->u.mime_type);
+
+            if (content_type)
+              g_ptr_array_add (compiled->content_types, content_type);
+          }
+          break;
+        case FILTER_RULE_PATTERN:
+          compile_pattern (compiled, rule->u.pattern);
+          break;
+        case FILTER_RULE_PIXBUF_FORMATS:
+          for (list = rule->u.pixbuf_formats; list; list = list->next)
+            {
+              gchar **mime_types;
+              int i;
+
+              mime_types = gdk_pixbuf_format_get_mime_types (list->data);
+              for (i = 0; mime_types[i] != NULL; i++)
+                g_hash_table_add (compiled->pixbuf_mime_types, g_strdup (mime_types[i]));
+              g_strfreev (mime_types);
+            }
+          break;
+        case FILTER_RULE_CUSTOM:
+          compiled->custom = g_slist_prepend (compiled->custom, rule);
+          break;
+        default:
+          break;
+        }
+    }
+
+  compiled->custom = g_slist_reverse (compiled->custom);
+
+  return compiled;
+}
+
+static gboolean
+compiled_filter_match_name (CompiledFilter *compiled,
+                            const char     *name)
+{
+  gsize len;
+  guint i;
+
+  if (g_hash_table_contains (compiled->names, name))
+    return TRUE;
+
+  /* '*' doesn't match directory separators */
+  if (compiled->suffix_lengths->len > 0 &&
+      strchr (name, G_DIR_SEPARATOR) == NULL)
+    {
+      len = strlen (name);
+      for (i = 0; i < compiled->suffix_lengths->len; i++)
+        {
+          guint suffix_len = g_array_index (compiled->suffix_lengths, guint, i);
+
+          if (suffix_len <= len &&
+              g_hash_table_contains (compiled->suffixes, name + len - suffix_len))
+            return TRUE;
+        }
+    }
+
+  for (i = 0; i < compiled->patterns->len; i++)
+    {
+      if (_gtk_fnmatch (g_ptr_array_index (compiled->patterns, i), name, FALSE))
+        return TRUE;
+    }
+
+  return FALSE;
+}
+
+/* Files in a folder share few mime types, so the result of
+ * checking the mime type rules is remembered per mime type.
+ */
+static gboolean
+compiled_filter_match_mime_type (CompiledFilter *compiled,
+                                 const char     *mime_type)
+{
+  gpointer cached;
+  gboolean match;
+
+  cached = g_hash_table_lookup (compiled->mime_type_matches, mime_type);
+  if (cached)
+    return GPOINTER_TO_INT (cached) - 1;
+
+  match = g_hash_table_contains (compiled->pixbuf_mime_types, mime_type);
+
+  if (!match && compiled->content_types->len > 0)
+    {
+      gchar *content_type = g_content_type_from_mime_type (mime_type);
+      guint i;
+
+      for (i = 0; content_type != NULL && i < compiled->content_types->len && !match; i++)
+        match = g_content_type_is_a (content_type, g_ptr_array_index (compiled->content_types, i));
+
+      g_free (content_type);
+    }
+
+  g_hash_table_insert (compiled->mime_type_matches, g_strdup (mime_type), GINT_TO_POINTER (match + 1));
+
+  return match;
+}
+
 /**
  * gtk_file_filter_filter:
  * @filter: a #GtkFileFilter
@@ -723,75 +920,32 @@ gboolean
 gtk_file_filter_filter (GtkFileFilter           *filter,
 			const GtkFileFilterInfo *filter_info)
 {
+  CompiledFilter *compiled;
   GSList *tmp_list;
 
-  for (tmp_list = filter->rules; tmp_list; tmp_list = tmp_list->next)
+  if (filter->compiled == NULL)
+    filter->compiled = gtk_file_filter_compile (filter);
+  compiled = filter->compiled;
+
+  if ((filter_info->contains & GTK_FILE_FILTER_DISPLAY_NAME) &&
+      filter_info->display_name != NULL &&
+      compiled_filter_match_name (compiled, filter_info->display_name))
+    return TRUE;
+
+  if ((filter_info->contains & GTK_FILE_FILTER_MIME_TYPE) &&
+      filter_info->mime_type != NULL &&
+      compiled_filter_match_mime_type (compiled, filter_info->mime_type))
+    return TRUE;
+
+  for (tmp_list = compiled->custom; tmp_list; tmp_list = tmp_list->next)
     {
       FilterRule *rule = tmp_list->data;
 
       if ((filter_info->contains & rule->needed) != rule->needed)
 	continue;
 
-      switch (rule->type)
-	{
-	case FILTER_RULE_MIME_TYPE:
-          if (filter_info->mime_type != NULL)
-            {
-              gchar *filter_content_type, *rule_content_type;
-              gboolean match;
-
-              filter_content_type = g_content_type_from_mime_type (filter_info->mime_type);
-              rule_content_type = g_content_type_from_mime_type (rule->u.mime_type);
-              match = filter_content_type != NULL &&
-                      rule_content_type != NULL &&
-                      g_content_type_is_a (filter_content_type, rule_content_type);
-              g_free (filter_content_type);
-              g_free (rule_content_type);
-
-              if (match)
-                return TRUE;
-        }
-	  break;
-	case FILTER_RULE_PATTERN:
-	  if (filter_info->display_name != NULL &&
-	      _gtk_fnmatch (rule->u.pattern, filter_info->display_name, FALSE))
-	    return TRUE;
-	  break;
-	case FILTER_RULE_PIXBUF_FORMATS:
-	  {
-	    GSList *list;
-
-	    if (!filter_info->mime_type)
-	      break;
-
-	    for (list = rule->u.pixbuf_formats; list; list = list->next)
-	      {
-		int i;
-		gchar **mime_types;
-
-		mime_types = gdk_pixbuf_format_get_mime_types (list->data);
-
-		for (i = 0; mime_types[i] != NULL; i++)
-		  {
-		    if (strcmp (mime_types[i], filter_info->mime_type) == 0)
-		      {
-			g_strfreev (mime_types);
-			return TRUE;
-		      }
-		  }
-
-		g_strfreev (mime_types);
-	      }
-	    break;
-	  }
-	case FILTER_RULE_CUSTOM:
-	  if (rule->u.custom.func (filter_info, rule->u.custom.data))
-	    return TRUE;
-	  break;
-
-        default:
-          break;
-	}
+      if (rule->u.custom.func (filter_info, rule->u.custom.data))
+        return TRUE;
     }
 
   return FALSE;
@@ -0,0 +1,1064 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "gtkfilenameindexprivate.h"
+
+#include "gtksettings.h"
+
+#include <glib/gstdio.h>
+#include <string.h>
+
+/*
+ * File name index
+ *
+ * When there is no search service, searching in the file chooser
+ * crawls the file system. To have results right away, the names of
+ * the files in the directories that were browsed are kept in an
+ * index, which is looked up before crawling. Hits from the index are
+ * verified before they are shown, and the crawl still finds the files
+ * that are not in the index.
+ *
+ * The index is a cache file that is used straight from the mapped
+ * file. It lists directories, the names of their files, and for each
+ * trigram of the prepared display names, see gtk_query_matches_string(),
+ * the files whose name contains it. Directories that change while the
+ * file is mapped are kept in memory, they replace their version from
+ * the file until the file is written again.
+ *
+ * Only the most recently and frequently browsed directories are
+ * kept. The index is not used when recent files are disabled.
+ */
+
+#define GTK_FILE_NAME_INDEX_MAGIC "GtkFileNameIndex"
+#define GTK_FILE_NAME_INDEX_VERSION (1)
+
+/* The cache starts with the magic, then the version, a byte order mark
+ * and the numbers of directories, names, trigrams, postings and bytes
+ * of strings as guint32 in host byte order, followed by the tables.
+ */
+#define GTK_FILE_NAME_INDEX_MAGIC_SIZE 16
+#define GTK_FILE_NAME_INDEX_HEADER_SIZE (GTK_FILE_NAME_INDEX_MAGIC_SIZE + 7 * sizeof (guint32))
+#define GTK_FILE_NAME_INDEX_BYTE_ORDER 0x01020304
+
+#define MAX_DIRECTORIES 1000
+#define MAX_NAMES 200000
+
+/* Write changes a while after they happened, to batch them */
+#define SAVE_DELAY_SECONDS 5
+
+/* A use of a directory counts as much as a day of recency, up to a month */
+#define SECONDS_PER_USE (24 * 60 * 60)
+#define MAX_COUNTED_USES 30
+
+typedef struct
+{
+  guint32 uri;          /* offset in the strings */
+  guint32 first_name;
+  guint32 n_names;
+  guint32 n_uses;
+  guint32 last_used;    /* seconds since the epoch */
+} DirRecord;
+
+typedef struct
+{
+  guint32 dir;
+  guint32 name;         /* offset in the strings, the file's basename */
+} NameRecord;
+
+typedef struct
+{
+  guint32 trigram;
+  guint32 first_posting;
+  guint32 n_postings;   /* postings are indexes of names */
+} TrigramRecord;
+
+typedef struct
+{
+  char *uri;
+  GPtrArray *names;
+  guint32 n_uses;
+  guint32 last_used;
+  guint serial;         /* index->serial when it last changed */
+} IndexDir;
+
+struct _GtkFileNameIndex
+{
+  GMappedFile *mapped;
+  const DirRecord *dirs;
+  const NameRecord *names;
+  const TrigramRecord *trigrams;
+  const guint32 *postings;
+  const char *strings;
+  guint32 n_dirs;
+  guint32 n_names;
+  guint32 n_trigrams;
+  guint32 n_postings;
+  guint32 strings_size;
+
+  /* uri => index in dirs + 1, pointing into the mapped file */
+  GHashTable *mapped_dirs;
+
+  /* uri => IndexDir, replacing the mapped version */
+  GHashTable *changed_dirs;
+  guint serial;
+
+  guint save_id;
+  guint saving : 1;
+  guint save_again : 1;
+};
+
+static GtkFileNameIndex *default_index;
+
+/* Same as in gtkquery.c */
+static char *
+prepare_string (const char *string)
+{
+  char *normalized, *res;
+
+  normalized = g_utf8_normalize (string, -1, G_NORMALIZE_NFD);
+  res = g_utf8_strdown (normalized, -1);
+  g_free (normalized);
+
+  return res;
+}
+
+static inline guint32
+get_trigram (const char *s)
+{
+  return ((guchar) s[0] << 16) | ((guchar) s[1] << 8) | (guchar) s[2];
+}
+
+static IndexDir *
+index_dir_new (const char *uri)
+{
+  IndexDir *dir;
+
+  dir = g_slice_new0 (IndexDir);
+  dir->uri = g_strdup (uri);
+  dir->names = g_ptr_array_new_with_free_func (g_free);
+
+  return dir;
+}
+
+static IndexDir *
+index_dir_copy (const IndexDir *dir)
+{
+  IndexDir *copy;
+  guint i;
+
+  copy = index_dir_new (dir->uri);
+  for (i = 0; i < dir->names->len; i++)
+    g_ptr_array_add (copy->names, g_strdup (g_ptr_array_index (dir->names, i)));
+  copy->n_uses = dir->n_uses;
+  copy->last_used = dir->last_used;
+  copy->serial = dir->serial;
+
+  return copy;
+}
+
+static void
+index_dir_free (gpointer data)
+{
+  IndexDir *dir = data;
+
+  g_free (dir->uri);
+  g_ptr_array_unref (dir->names);
+  g_slice_free (IndexDir, dir);
+}
+
+static char *
+gtk_file_name_index_get_cache_path (void)
+{
+  char *dir;
+  char *path;
+
+  dir = g_build_filename (g_get_user_cache_dir (), "gtk-4.0", NULL);
+  if (g_mkdir_with_parents (dir, 0755) != 0)
+    {
+      g_warning ("Failed to mkdir %s", dir);
+      g_free (dir);
+      return NULL;
+    }
+
+  path = g_build_filename (dir, "file-name-index", NULL);
+  g_free (dir);
+
+  return path;
+}
+
+static gboolean
+string_is_valid (GtkFileNameIndex *index,
+                 guint32           offset)
+{
+  return offset < index->strings_size;
+}
+
+/* Everything is checked once when loading, so that lookups can
+ * trust the mapped file.
+ */
+static gboolean
+gtk_file_name_index_validate (GtkFileNameIndex *index)
+{
+  guint32 i;
+
+  if (index->strings_size == 0 ||
+      index->strings[index->strings_size - 1] != '\0')
+    return FALSE;
+
+  for (i = 0; i < index->n_dirs; i++)
+    {
+      const DirRecord *dir = &index->dirs[i];
+
+      if (!string_is_valid (index, dir->uri) ||
+          dir->first_name > index->n_names ||
+          dir->n_names > index->n_names - dir->first_name)
+        return FALSE;
+    }
+
+  for (i = 0; i < index->n_names; i++)
+    {
+      if (index->names[i].dir >= index->n_dirs ||
+          !string_is_valid (index, index->names[i].name))
+        return FALSE;
+    }
+
+  for (i = 0; i < index->n_trigrams; i++)
+    {
+      const TrigramRecord *trigram = &index->trigrams[i];
+
+      if ((i > 0 && index->trigrams[i - 1].trigram >= trigram->trigram) ||
+          trigram->first_posting > index->n_postings ||
+          trigram->n_postings > index->n_postings - trigram->first_posting)
+        return FALSE;
+    }
+
+  for (i = 0; i < index->n_postings; i++)
+    {
+      if (index->postings[i] >= index->n_names)
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
+static void
+gtk_file_name_index_unmap (GtkFileNameIndex *index)
+{
+  g_hash_table_remove_all (index->mapped_dirs);
+  g_clear_pointer (&index->mapped, g_mapped_file_unref);
+  index->n_dirs = index->n_names = index->n_trigrams = index->n_postings = 0;
+  index->strings_size = 0;
+}
+
+static void
+gtk_file_name_index_load_cache (GtkFileNameIndex *index)
+{
+  char *path;
+  GMappedFile *mapped;
+  const char *contents;
+  gsize total_length, length;
+  GError *error = NULL;
+  guint32 header[7];
+  guint32 i;
+
+  gtk_file_name_index_unmap (index);
+
+  if ((path = gtk_file_name_index_get_cache_path ()) == NULL)
+    return;
+
+  if (!g_file_test (path, G_FILE_TEST_EXISTS))
+    {
+      g_free (path);
+      return;
+    }
+
+  mapped = g_mapped_file_new (path, FALSE, &error);
+  if (mapped == NULL)
+    {
+      g_warning ("Failed to get cache content %s: %s", path, error->message);
+      g_error_free (error);
+      g_free (path);
+      return;
+    }
+
+  contents = g_mapped_file_get_contents (mapped);
+  total_length = g_mapped_file_get_length (mapped);
+
+  if (total_length < GTK_FILE_NAME_INDEX_HEADER_SIZE ||
+      strncmp (contents, GTK_FILE_NAME_INDEX_MAGIC, GTK_FILE_NAME_INDEX_MAGIC_SIZE) != 0)
+    {
+      g_warning ("The file is not a file name index %s", path);
+      goto out;
+    }
+
+  memcpy (header, contents + GTK_FILE_NAME_INDEX_MAGIC_SIZE, sizeof (header));
+
+  /* Older indexes are silently replaced */
+  if (header[0] != GTK_FILE_NAME_INDEX_VERSION ||
+      header[1] != GTK_FILE_NAME_INDEX_BYTE_ORDER)
+    goto out;
+
+  length = GTK_FILE_NAME_INDEX_HEADER_SIZE;
+  if (header[2] > MAX_DIRECTORIES || header[3] > MAX_NAMES ||
+      header[4] > total_length || header[5] > total_length || header[6] > total_length)
+    goto broken;
+
+  index->dirs = (const DirRecord *) (contents + length);
+  length += (gsize) header[2] * sizeof (DirRecord);
+  index->names = (const NameRecord *) (contents + length);
+  length += (gsize) header[3] * sizeof (NameRecord);
+  index->trigrams = (const TrigramRecord *) (contents + length);
+  length += (gsize) header[4] * sizeof (TrigramRecord);
+  index->postings = (const guint32 *) (contents + length);
+  length += (gsize) header[5] * sizeof (guint32);
+  index->strings = contents + length;
+  length += header[6];
+
+  if (length != total_length)
+    goto broken;
+
+  index->mapped = mapped;
+  index->n_dirs = header[2];
+  index->n_names = header[3];
+  index->n_trigrams = header[4];
+  index->n_postings = header[5];
+  index->strings_size = header[6];
+
+  if (!gtk_file_name_index_validate (index))
+    {
+      index->mapped = NULL;
+      gtk_file_name_index_unmap (index);
+      goto broken;
+    }
+
+  for (i = 0; i < index->n_dirs; i++)
+    g_hash_table_insert (index->mapped_dirs,
+                         (gpointer) (index->strings + index->dirs[i].uri),
+                         GUINT_TO_POINTER (i + 1));
+
+  g_free (path);
+  return;
+
+broken:
+  g_warning ("Broken cache content %s", path);
+out:
+  g_mapped_file_unref (mapped);
+  g_free (path);
+}
+
+/*** Saving ***/
+
+typedef struct
+{
+  const char *uri;
+  guint32 n_uses;
+  guint32 last_used;
+  /* Either from the mapped file or from an IndexDir */
+  const NameRecord *mapped_names;
+  GPtrArray *names;
+  guint32 n_names;
+} SaveDir;
+
+typedef struct
+{
+  GMappedFile *mapped;
+  const char *strings;
+  GArray *dirs;         /* SaveDir */
+  GPtrArray *changed;   /* IndexDir, copies owned by the SaveData */
+  guint serial;
+} SaveData;
+
+static void
+save_data_free (gpointer data)
+{
+  SaveData *save = data;
+
+  g_clear_pointer (&save->mapped, g_mapped_file_unref);
+  g_array_unref (save->dirs);
+  g_ptr_array_unref (save->changed);
+  g_slice_free (SaveData, save);
+}
+
+static inline const char *
+save_dir_get_name (SaveData      *save,
+                   const SaveDir *dir,
+                   guint          i)
+{
+  if (dir->names)
+    return g_ptr_array_index (dir->names, i);
+  else
+    return save->strings + dir->mapped_names[i].name;
+}
+
+static int
+compare_save_dirs (gconstpointer a,
+                   gconstpointer b)
+{
+  const SaveDir *dir1 = a;
+  const SaveDir *dir2 = b;
+  gint64 score1, score2;
+
+  score1 = dir1->last_used + (gint64) MIN (dir1->n_uses, MAX_COUNTED_USES) * SECONDS_PER_USE;
+  score2 = dir2->last_used + (gint64) MIN (dir2->n_uses, MAX_COUNTED_USES) * SECONDS_PER_USE;
+
+  /* Best first */
+  return (score1 < score2) ? 1 : ((score1 == score2) ? 0 : -1);
+}
+
+static int
+compare_trigrams (gconstpointer a,
+                  gconstpointer b)
+{
+  guint32 t1 = GPOINTER_TO_UINT (*(gpointer *) a);
+  guint32 t2 = GPOINTER_TO_UINT (*(gpointer *) b);
+
+  return (t1 < t2) ? -1 : ((t1 == t2) ? 0 : 1);
+}
+
+static char *
+gtk_file_name_index_serialize (SaveData *save,
+                               gsize    *count)
+{
+  GArray *dir_records, *name_records, *trigram_records, *postings;
+  GHashTable *trigrams;
+  GPtrArray *keys;
+  GString *strings;
+  guint32 header[7];
+  char *contents;
+  gsize total_length, offset;
+  guint i, j;
+
+  g_array_sort (save->dirs, compare_save_dirs);
+
+  dir_records = g_array_new (FALSE, FALSE, sizeof (DirRecord));
+  name_records = g_array_new (FALSE, FALSE, sizeof (NameRecord));
+  trigram_records = g_array_new (FALSE, FALSE, sizeof (TrigramRecord));
+  postings = g_array_new (FALSE, FALSE, sizeof (guint32));
+  trigrams = g_hash_table_new_full (NULL, NULL, NULL, (GDestroyNotify) g_array_unref);
+  strings = g_string_new (NULL);
+
+  for (i = 0; i < save->dirs->len && dir_records->len < MAX_DIRECTORIES; i++)
+    {
+      const SaveDir *dir = &g_array_index (save->dirs, SaveDir, i);
+      DirRecord record;
+
+      if (name_records->len + dir->n_names > MAX_NAMES)
+        continue;
+
+      record.uri = strings->len;
+      record.first_name = name_records->len;
+      record.n_names = dir->n_names;
+      record.n_uses = dir->n_uses;
+      record.last_used = dir->last_used;
+      g_string_append_len (strings, dir->uri, strlen (dir->uri) + 1);
+
+      for (j = 0; j < dir->n_names; j++)
+        {
+          const char *name = save_dir_get_name (save, dir, j);
+          NameRecord name_record;
+          char *display_name, *prepared;
+          guint32 name_id;
+          gsize len, k;
+
+          name_id = name_records->len;
+          name_record.dir = dir_records->len;
+          name_record.name = strings->len;
+          g_string_append_len (strings, name, strlen (name) + 1);
+          g_array_append_val (name_records, name_record);
+
+          display_name = g_filename_display_name (name);
+          prepared = prepare_string (display_name);
+          len = strlen (prepared);
+
+          for (k = 0; k + 3 <= len; k++)
+            {
+              guint32 trigram = get_trigram (prepared + k);
+              GArray *list;
+
+              list = g_hash_table_lookup (trigrams, GUINT_TO_POINTER (trigram));
+              if (list == NULL)
+                {
+                  list = g_array_new (FALSE, FALSE, sizeof (guint32));
+                  g_hash_table_insert (trigrams, GUINT_TO_POINTER (trigram), list);
+                }
+
+              /* Names with a repeated trigram are only listed once */
+              if (list->len == 0 || g_array_index (list, guint32, list->len - 1) != name_id)
+                g_array_append_val (list, name_id);
+            }
+
+          g_free (prepared);
+          g_free (display_name);
+        }
+
+      g_array_append_val (dir_records, record);
+    }
+
+  keys = g_hash_table_get_keys_as_ptr_array (trigrams);
+  g_ptr_array_sort (keys, compare_trigrams);
+
+  for (i = 0; i < keys->len; i++)
+    {
+      GArray *list = g_hash_table_lookup (trigrams, g_ptr_array_index (keys, i));
+      TrigramRecord record;
+
+      record.trigram = GPOINTER_TO_UINT (g_ptr_array_index (keys, i));
+      record.first_posting = postings->len;
+      record.n_postings = list->len;
+      g_array_append_vals (postings, list->data, list->len);
+      g_array_append_val (trigram_records, record);
+    }
+
+  /* An empty index still has one string, so that it is valid */
+  if (strings->len == 0)
+    g_string_append_len (strings, "", 1);
+
+  header[0] = GTK_FILE_NAME_INDEX_VERSION;
+  header[1] = GTK_FILE_NAME_INDEX_BYTE_ORDER;
+  header[2] = dir_records->len;
+  header[3] = name_records->len;
+  header[4] = trigram_records->len;
+  header[5] = postings->len;
+  header[6] = strings->len;
+
+  total_length = GTK_FILE_NAME_INDEX_HEADER_SIZE +
+                 dir_records->len * sizeof (DirRecord) +
+                 name_records->len * sizeof (NameRecord) +
+                 trigram_records->len * sizeof (TrigramRecord) +
+                 postings->len * sizeof (guint32) +
+                 strings->len;
+  *count = total_length;
+
+  contents = g_malloc0 (total_length);
+  memcpy (contents, GTK_FILE_NAME_INDEX_MAGIC, GTK_FILE_NAME_INDEX_MAGIC_SIZE);
+  memcpy (contents + GTK_FILE_NAME_INDEX_MAGIC_SIZE, header, sizeof (header));
+  offset = GTK_FILE_NAME_INDEX_HEADER_SIZE;
+
+#define APPEND(data, size) G_STMT_START { memcpy (contents + offset, data, size); offset += size; } G_STMT_END
+  APPEND (dir_records->data, dir_records->len * sizeof (DirRecord));
+  APPEND (name_records->data, name_records->len * sizeof (NameRecord));
+  APPEND (trigram_records->data, trigram_records->len * sizeof (TrigramRecord));
+  APPEND (postings->data, postings->len * sizeof (guint32));
+  APPEND (strings->str, strings->len);
+#undef APPEND
+
+  g_assert (offset == total_length);
+
+  g_ptr_array_unref (keys);
+  g_hash_table_unref (trigrams);
+  g_string_free (strings, TRUE);
+  g_array_unref (dir_records);
+  g_array_unref (name_records);
+  g_array_unref (trigram_records);
+  g_array_unref (postings);
+
+  return contents;
+}
+
+static void
+save_thread (GTask        *task,
+             gpointer      source_object,
+             gpointer      task_data,
+             GCancellable *cancellable)
+{
+  SaveData *save = task_data;
+  GError *error = NULL;
+  char *path;
+  char *contents;
+  gsize length;
+
+  if ((path = gtk_file_name_index_get_cache_path ()) == NULL)
+    {
+      g_task_return_boolean (task, FALSE);
+      return;
+    }
+
+  contents = gtk_file_name_index_serialize (save, &length);
+  if (!g_file_set_contents (path, contents, length, &error))
+    {
+      g_warning ("Failed to save file name index %s: %s", path, error->message);
+      g_error_free (error);
+    }
+
+  g_free (contents);
+  g_free (path);
+
+  g_task_return_boolean (task, TRUE);
+}
+
+static void gtk_file_name_index_queue_save (GtkFileNameIndex *index);
+
+static void
+save_done (GObject      *source,
+           GAsyncResult *result,
+           gpointer      user_data)
+{
+  GtkFileNameIndex *index = user_data;
+  SaveData *save = g_task_get_task_data (G_TASK (result));
+  GHashTableIter iter;
+  IndexDir *dir;
+
+  index->saving = FALSE;
+
+  if (g_task_propagate_boolean (G_TASK (result), NULL))
+    {
+      gtk_file_name_index_load_cache (index);
+
+      /* Directories that changed while saving still replace the new file */
+      g_hash_table_iter_init (&iter, index->changed_dirs);
+      while (g_hash_table_iter_next (&iter, NULL, (gpointer *) &dir))
+        {
+          if (dir->serial <= save->serial)
+            g_hash_table_iter_remove (&iter);
+        }
+    }
+
+  if (index->save_again)
+    {
+      index->save_again = FALSE;
+      gtk_file_name_index_queue_save (index);
+    }
+}
+
+static gboolean
+save_timeout (gpointer user_data)
+{
+  GtkFileNameIndex *index = user_data;
+  SaveData *save;
+  GHashTableIter iter;
+  IndexDir *dir;
+  GTask *task;
+  guint32 i;
+
+  index->save_id = 0;
+
+  if (index->saving)
+    {
+      index->save_again = TRUE;
+      return G_SOURCE_REMOVE;
+    }
+
+  save = g_slice_new0 (SaveData);
+  save->dirs = g_array_new (FALSE, FALSE, sizeof (SaveDir));
+  save->changed = g_ptr_array_new_with_free_func (index_dir_free);
+  save->serial = index->serial;
+
+  /* The mapped file stays alive until the thread is done with it */
+  if (index->mapped)
+    {
+      save->mapped = g_mapped_file_ref (index->mapped);
+      save->strings = index->strings;
+    }
+
+  for (i = 0; i < index->n_dirs; i++)
+    {
+      const DirRecord *record = &index->dirs[i];
+      SaveDir save_dir;
+
+      if (g_hash_table_contains (index->changed_dirs, index->strings + record->uri))
+        continue;
+
+      save_dir.uri = index->strings + record->uri;
+      save_dir.n_uses = record->n_uses;
+      save_dir.last_used = record->last_used;
+      save_dir.mapped_names = &index->names[record->first_name];
+      save_dir.names = NULL;
+      save_dir.n_names = record->n_names;
+      g_array_append_val (save->dirs, save_dir);
+    }
+
+  g_hash_table_iter_init (&iter, index->changed_dirs);
+  while (g_hash_table_iter_next (&iter, NULL, (gpointer *) &dir))
+    {
+      IndexDir *copy = index_dir_copy (dir);
+      SaveDir save_dir;
+
+      g_ptr_array_add (save->changed, copy);
+
+      save_dir.uri = copy->uri;
+      save_dir.n_uses = copy->n_uses;
+      save_dir.last_used = copy->last_used;
+      save_dir.mapped_names = NULL;
+      save_dir.names = copy->names;
+      save_dir.n_names = copy->names->len;
+      g_array_append_val (save->dirs, save_dir);
+    }
+
+  index->saving = TRUE;
+
+  task = g_task_new (NULL, NULL, save_done, index);
+  g_task_set_source_tag (task, save_timeout);
+  g_task_set_task_data (task, save, save_data_free);
+  g_task_run_in_thread (task, save_thread);
+  g_object_unref (task);
+
+  return G_SOURCE_REMOVE;
+}
+
+static void
+gtk_file_name_index_queue_save (GtkFileNameIndex *index)
+{
+  if (index->save_id != 0)
+    return;
+
+  index->save_id = g_timeout_add_seconds (SAVE_DELAY_SECONDS, save_timeout, index);
+  g_source_set_name_by_id (index->save_id, "[gtk] save_file_name_index");
+}
+
+/*** API ***/
+
+/*
+ * gtk_file_name_index_get_default:
+ *
+ * Returns the file name index, loading it the first time.
+ *
+ * Returns: (nullable) (transfer none): the index, or %NULL if
+ *     recent files are disabled
+ */
+GtkFileNameIndex *
+gtk_file_name_index_get_default (void)
+{
+  GtkSettings *settings;
+  gboolean enabled = TRUE;
+
+  settings = gtk_settings_get_default ();
+  if (settings)
+    g_object_get (settings, "gtk-recent-files-enabled", &enabled, NULL);
+
+  if (!enabled)
+    return NULL;
+
+  if (default_index == NULL)
+    {
+      default_index = g_new0 (GtkFileNameIndex, 1);
+      default_index->mapped_dirs = g_hash_table_new (g_str_hash, g_str_equal);
+      default_index->changed_dirs = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                                           NULL, index_dir_free);
+      gtk_file_name_index_load_cache (default_index);
+    }
+
+  return default_index;
+}
+
+/* Returns the in-memory version of the directory, copying it from the
+ * mapped file if needed. Unknown directories are only created if @create.
+ */
+static IndexDir *
+gtk_file_name_index_get_changed_dir (GtkFileNameIndex *index,
+                                     const char       *uri,
+                                     gboolean          create)
+{
+  IndexDir *dir;
+  guint mapped;
+
+  dir = g_hash_table_lookup (index->changed_dirs, uri);
+  if (dir)
+    return dir;
+
+  mapped = GPOINTER_TO_UINT (g_hash_table_lookup (index->mapped_dirs, uri));
+  if (mapped == 0 && !create)
+    return NULL;
+
+  dir = index_dir_new (uri);
+  if (mapped != 0)
+    {
+      const DirRecord *record = &index->dirs[mapped - 1];
+      guint32 i;
+
+      for (i = 0; i < record->n_names; i++)
+        g_ptr_array_add (dir->names,
+                         g_strdup (index->strings + index->names[record->first_name + i].name));
+      dir->n_uses = record->n_uses;
+      dir->last_used = record->last_used;
+    }
+
+  g_hash_table_insert (index->changed_dirs, dir->uri, dir);
+
+  return dir;
+}
+
+static void
+gtk_file_name_index_dir_changed (GtkFileNameIndex *index,
+                                 IndexDir         *dir)
+{
+  dir->serial = ++index->serial;
+  gtk_file_name_index_queue_save (index);
+}
+
+/*
+ * gtk_file_name_index_set_directory:
+ * @index: a #GtkFileNameIndex
+ * @dir: a directory
+ * @names: (element-type filename): the names of the files in @dir
+ *
+ * Replaces the files of @dir in the index, and counts it as used.
+ */
+void
+gtk_file_name_index_set_directory (GtkFileNameIndex *index,
+                                   GFile            *dir,
+                                   GPtrArray        *names)
+{
+  IndexDir *index_dir;
+  char *uri;
+  guint i;
+
+  uri = g_file_get_uri (dir);
+  index_dir = gtk_file_name_index_get_changed_dir (index, uri, TRUE);
+  g_free (uri);
+
+  g_ptr_array_set_size (index_dir->names, 0);
+  for (i = 0; i < names->len; i++)
+    g_ptr_array_add (index_dir->names, g_strdup (g_ptr_array_index (names, i)));
+
+  index_dir->n_uses++;
+  index_dir->last_used = g_get_real_time () / G_USEC_PER_SEC;
+
+  gtk_file_name_index_dir_changed (index, index_dir);
+}
+
+static int
+find_name (IndexDir   *dir,
+           const char *name)
+{
+  guint i;
+
+  for (i = 0; i < dir->names->len; i++)
+    {
+      if (strcmp (g_ptr_array_index (dir->names, i), name) == 0)
+        return i;
+    }
+
+  return -1;
+}
+
+/*
+ * gtk_file_name_index_add_file:
+ * @index: a #GtkFileNameIndex
+ * @dir: a directory
+ * @name: (type filename): the name of a file that was created in @dir
+ *
+ * Adds a file to @dir, if @dir is in the index.
+ */
+void
+gtk_file_name_index_add_file (GtkFileNameIndex *index,
+                              GFile            *dir,
+                              const char       *name)
+{
+  IndexDir *index_dir;
+  char *uri;
+
+  uri = g_file_get_uri (dir);
+  index_dir = gtk_file_name_index_get_changed_dir (index, uri, FALSE);
+  g_free (uri);
+
+  if (index_dir == NULL || find_name (index_dir, name) >= 0)
+    return;
+
+  g_ptr_array_add (index_dir->names, g_strdup (name));
+  gtk_file_name_index_dir_changed (index, index_dir);
+}
+
+/*
+ * gtk_file_name_index_remove_file:
+ * @index: a #GtkFileNameIndex
+ * @dir: a directory
+ * @name: (type filename): the name of a file that was deleted from @dir
+ *
+ * Removes a file from @dir, if @dir is in the index.
+ */
+void
+gtk_file_name_index_remove_file (GtkFileNameIndex *index,
+                                 GFile            *dir,
+                                 const char       *name)
+{
+  IndexDir *index_dir;
+  char *uri;
+  int i;
+
+  uri = g_file_get_uri (dir);
+  index_dir = gtk_file_name_index_get_changed_dir (index, uri, FALSE);
+  g_free (uri);
+
+  if (index_dir == NULL || (i = find_name (index_dir, name)) < 0)
+    return;
+
+  g_ptr_array_remove_index_fast (index_dir->names, i);
+  gtk_file_name_index_dir_changed (index, index_dir);
+}
+
+static gboolean
+dir_matches_location (const char *uri,
+                      const char *location,
+                      gboolean    recursive)
+{
+  gsize len;
+
+  if (strcmp (uri, location) == 0)
+    return TRUE;
+
+  if (!recursive)
+    return FALSE;
+
+  len = strlen (location);
+  if (len == 0 || strncmp (uri, location, len) != 0)
+    return FALSE;
+
+  return location[len - 1] == '/' || uri[len] == '/';
+}
+
+static gboolean
+name_matches (GtkQuery   *query,
+              const char *name)
+{
+  char *display_name;
+  gboolean matches;
+
+  display_name = g_filename_display_name (name);
+  matches = gtk_query_matches_string (query, display_name);
+  g_free (display_name);
+
+  return matches;
+}
+
+static const TrigramRecord *
+find_trigram (GtkFileNameIndex *index,
+              guint32           trigram)
+{
+  guint32 start = 0, end = index->n_trigrams;
+
+  while (start < end)
+    {
+      guint32 mid = start + (end - start) / 2;
+
+      if (index->trigrams[mid].trigram == trigram)
+        return &index->trigrams[mid];
+      else if (index->trigrams[mid].trigram < trigram)
+        start = mid + 1;
+      else
+        end = mid;
+    }
+
+  return NULL;
+}
+
+/*
+ * gtk_file_name_index_lookup:
+ * @index: a #GtkFileNameIndex
+ * @query: the query
+ * @recursive: whether to look in subdirectories of the query location
+ * @max_files: the maximum number of files to return
+ *
+ * Finds the files in the index that match @query. The files may not
+ * exist anymore, or have another display name, so they need to be
+ * checked before showing them.
+ *
+ * Queries without a word of at least 3 bytes can't be answered from
+ * the index, and return no files.
+ *
+ * Returns: (transfer full) (element-type GFile): the matching files
+ */
+GList *
+gtk_file_name_index_lookup (GtkFileNameIndex *index,
+                            GtkQuery         *query,
+                            gboolean          recursive,
+                            guint             max_files)
+{
+  const TrigramRecord *best = NULL;
+  gboolean have_trigram = FALSE;
+  GHashTableIter iter;
+  IndexDir *dir;
+  GList *files = NULL;
+  guint n_files = 0;
+  char *location;
+  char *prepared;
+  char **words;
+  guint32 i;
+  guint j;
+
+  if (gtk_query_get_text (query) == NULL || gtk_query_get_location (query) == NULL)
+    return NULL;
+
+  /* Only the rarest trigram is used, matching the names checks the others */
+  prepared = prepare_string (gtk_query_get_text (query));
+  words = g_strsplit (prepared, " ", -1);
+  for (j = 0; words[j]; j++)
+    {
+      gsize len = strlen (words[j]), k;
+
+      for (k = 0; k + 3 <= len; k++)
+        {
+          const TrigramRecord *trigram = find_trigram (index, get_trigram (words[j] + k));
+
+          if (!have_trigram || (best != NULL && (trigram == NULL || trigram->n_postings < best->n_postings)))
+            best = trigram;
+          have_trigram = TRUE;
+        }
+    }
+  g_strfreev (words);
+  g_free (prepared);
+
+  if (!have_trigram)
+    return NULL;
+
+  location = g_file_get_uri (gtk_query_get_location (query));
+
+  for (i = 0; best != NULL && i < best->n_postings && n_files < max_files; i++)
+    {
+      const NameRecord *name = &index->names[index->postings[best->first_posting + i]];
+      const char *uri = index->strings + index->dirs[name->dir].uri;
+      GFile *parent;
+
+      /* The in-memory version is more recent */
+      if (g_hash_table_contains (index->changed_dirs, uri) ||
+          !dir_matches_location (uri, location, recursive) ||
+          !name_matches (query, index->strings + name->name))
+        continue;
+
+      parent = g_file_new_for_uri (uri);
+      files = g_list_prepend (files, g_file_get_child (parent, index->strings + name->name));
+      g_object_unref (parent);
+      n_files++;
+    }
+
+  g_hash_table_iter_init (&iter, index->changed_dirs);
+  while (n_files < max_files && g_hash_table_iter_next (&iter, NULL, (gpointer *) &dir))
+    {
+      GFile *parent;
+
+      if (!dir_matches_location (dir->uri, location, recursive))
+        continue;
+
+      parent = g_file_new_for_uri (dir->uri);
+      for (j = 0; j < dir->names->len && n_files < max_files; j++)
+        {
+          const char *name = g_ptr_array_index (dir->names, j);
+
+          if (!name_matches (query, name))
+            continue;
+
+          files = g_list_prepend (files, g_file_get_child (parent, name));
+          n_files++;
+        }
+      g_object_unref (parent);
+    }
+
+  g_free (location);
+
+  return g_list_reverse (files);
+}
@@ -0,0 +1,47 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GTK_FILE_NAME_INDEX_PRIVATE_H__
+#define __GTK_FILE_NAME_INDEX_PRIVATE_H__
+
+#include <gio/gio.h>
+#include "gtkquery.h"
+
+G_BEGIN_DECLS
+
+typedef struct _GtkFileNameIndex GtkFileNameIndex;
+
+GtkFileNameIndex *      gtk_file_name_index_get_default         (void);
+
+void                    gtk_file_name_index_set_directory       (GtkFileNameIndex       *index,
+                                                                 GFile                  *dir,
+                                                                 GPtrArray              *names);
+void                    gtk_file_name_index_add_file            (GtkFileNameIndex       *index,
+                                                                 GFile                  *dir,
+                                                                 const char             *name);
+void                    gtk_file_name_index_remove_file         (GtkFileNameIndex       *index,
+                                                                 GFile                  *dir,
+                                                                 const char             *name);
+
+GList *                 gtk_file_name_index_lookup              (GtkFileNameIndex       *index,
+                                                                 GtkQuery               *query,
+                                                                 gboolean                recursive,
+                                                                 guint                   max_files);
+
+G_END_DECLS
+
+#endif /* __GTK_FILE_NAME_INDEX_PRIVATE_H__ */
@@ -31,6 +31,7 @@
 #include "gtkintl.h"
 #include "gtkprivate.h"
 #include "gtkstylecontextprivate.h"
+#include "gtkthumbnailcacheprivate.h"
 
 /* #define DEBUG_MODE */
 #ifdef DEBUG_MODE
@@ -89,11 +90,29 @@ struct AsyncFuncData
   GtkFileSystem *file_system;
   GFile *file;
   GCancellable *cancellable;
+  gchar *attributes;
+  GFileInfo *info;
 
   gpointer callback;
   gpointer data;
 };
 
+/* The path bar, the sidebar and the file chooser widgets all ask for
+ * the same folders, so the infos of local files are shared by all file
+ * systems. A monitor on each file drops its info when it changes.
+ */
+#define INFO_CACHE_SIZE 64
+
+typedef struct
+{
+  gchar *key;
+  GFileInfo *info;
+  GFileMonitor *monitor;
+} CachedInfo;
+
+static GHashTable *info_cache;
+static GQueue info_cache_lru = G_QUEUE_INIT;
+
 G_DEFINE_TYPE_WITH_PRIVATE (GtkFileSystem, _gtk_file_system, G_TYPE_OBJECT)
 
 
@@ -387,10 +406,134 @@ free_async_data (AsyncFuncData *async_data)
   g_object_unref (async_data->file_system);
   g_object_unref (async_data->file);
   g_object_unref (async_data->cancellable);
+  g_free (async_data->attributes);
+  g_clear_object (&async_data->info);
 
   g_free (async_data);
 }
 
+static gchar *
+info_cache_key (GFile       *file,
+                const gchar *attributes)
+{
+  gchar *uri, *key;
+
+  uri = g_file_get_uri (file);
+  key = g_strconcat (attributes, " ", uri, NULL);
+  g_free (uri);
+
+  return key;
+}
+
+static void
+cached_info_free (gpointer data)
+{
+  CachedInfo *cached = data;
+
+  g_queue_remove (&info_cache_lru, cached);
+  g_signal_handlers_disconnect_by_data (cached->monitor, cached);
+  g_file_monitor_cancel (cached->monitor);
+  g_object_unref (cached->monitor);
+  g_object_unref (cached->info);
+  g_free (cached->key);
+  g_slice_free (CachedInfo, cached);
+}
+
+static void
+cached_info_changed (GFileMonitor      *monitor,
+                     GFile             *file,
+                     GFile             *other_file,
+                     GFileMonitorEvent  event,
+                     gpointer           data)
+{
+  CachedInfo *cached = data;
+
+  g_hash_table_remove (info_cache, cached->key);
+}
+
+static GFileInfo *
+info_cache_lookup (GFile       *file,
+                   const gchar *attributes)
+{
+  CachedInfo *cached;
+  gchar *key;
+
+  if (info_cache == NULL)
+    return NULL;
+
+  key = info_cache_key (file, attributes);
+  cached = g_hash_table_lookup (info_cache, key);
+  g_free (key);
+
+  if (cached == NULL)
+    return NULL;
+
+  g_queue_remove (&info_cache_lru, cached);
+  g_queue_push_head (&info_cache_lru, cached);
+
+  return g_file_info_dup (cached->info);
+}
+
+static void
+info_cache_insert (GFile       *file,
+                   const gchar *attributes,
+                   GFileInfo   *info)
+{
+  CachedInfo *cached;
+  GFileMonitor *monitor;
+
+  /* Remote files may not have monitors, or only polling ones */
+  if (!g_file_is_native (file))
+    return;
+
+  monitor = g_file_monitor (file, G_FILE_MONITOR_NONE, NULL, NULL);
+  if (monitor == NULL)
+    return;
+
+  if (info_cache == NULL)
+    info_cache = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, cached_info_free);
+
+  cached = g_slice_new (CachedInfo);
+  cached->key = info_cache_key (file, attributes);
+  cached->info = g_file_info_dup (info);
+  cached->monitor = monitor;
+  g_signal_connect (monitor, "changed", G_CALLBACK (cached_info_changed), cached);
+
+  g_hash_table_replace (info_cache, cached->key, cached);
+  g_queue_push_head (&info_cache_lru, cached);
+
+  if (info_cache_lru.length > INFO_CACHE_SIZE)
+    {
+      CachedInfo *last = g_queue_peek_tail (&info_cache_lru);
+
+      g_hash_table_remove (info_cache, last->key);
+    }
+}
+
+static gboolean
+cached_info_idle (gpointer user_data)
+{
+  AsyncFuncData *async_data = user_data;
+  GError *error = NULL;
+
+  /* Same as for a query that was cancelled */
+  if (g_cancellable_set_error_if_cancelled (async_data->cancellable, &error))
+    g_clear_object (&async_data->info);
+
+  if (async_data->callback)
+    {
+      ((GtkFileSystemGetInfoCallback) async_data->callback) (async_data->cancellable,
+							     async_data->info, error, async_data->data);
+    }
+
+  if (error)
+    g_error_free (error);
+
+  free_async_data (async_data);
+
+  return G_SOURCE_REMOVE;
+}
+
 static void
 query_info_callback (GObject      *source_object,
 		     GAsyncResult *result,
@@ -407,6 +550,9 @@ query_info_callback (GObject      *source_object,
   async_data = (AsyncFuncData *) user_data;
   file_info = g_file_query_info_finish (file, result, &error);
 
+  if (file_info)
+    info_cache_insert (file, async_data->attributes, file_info);
+
   if (async_data->callback)
     {
       ((GtkFileSystemGetInfoCallback) async_data->callback) (async_data->cancellable,
@@ -442,9 +588,23 @@ _gtk_file_system_get_info (GtkFileSystem                *file_system,
   async_data->file = g_object_ref (file);
   async_data->cancellable = g_object_ref (cancellable);
 
+  async_data->attributes = g_strdup (attributes);
+
   async_data->callback = callback;
   async_data->data = data;
 
+  /* Callers expect the callback to run after this returns */
+  async_data->info = info_cache_lookup (file, attributes);
+  if (async_data->info)
+    {
+      guint id;
+
+      id = g_idle_add (cached_info_idle, async_data);
+      g_source_set_name_by_id (id, "[gtk] cached_info_idle");
+
+      return cancellable;
+    }
+
   g_file_query_info_async (file,
 			   attributes,
 			   G_FILE_QUERY_INFO_NONE,
@@ -750,34 +910,84 @@ _gtk_file_system_volume_unref (GtkFileSystemVolume *volume)
 }
 
 /* GFileInfo helper functions */
+static GIcon *
+get_standard_icon (GFileInfo *info)
+{
+  GIcon *icon;
+
+  icon = g_file_info_get_icon (info);
+  if (icon)
+    return g_object_ref (icon);
+
+  /* Use general fallback for all files without icon */
+  icon = g_themed_icon_new ("text-x-generic");
+  return icon;
+}
+
 GIcon *
 _gtk_file_info_get_icon (GFileInfo *info,
 			 int        icon_size,
                          int        scale)
 {
-  GIcon *icon;
+  GtkThumbnailCache *cache;
   GdkPixbuf *pixbuf;
   const gchar *thumbnail_path;
+  guint64 mtime;
 
   thumbnail_path = g_file_info_get_attribute_byte_string (info, G_FILE_ATTRIBUTE_THUMBNAIL_PATH);
 
   if (thumbnail_path)
     {
-      pixbuf = gdk_pixbuf_new_from_file_at_size (thumbnail_path,
-						 icon_size*scale, icon_size*scale,
-						 NULL);
+      cache = gtk_thumbnail_cache_get_default ();
+      mtime = g_file_info_get_attribute_uint64 (info, G_FILE_ATTRIBUTE_TIME_MODIFIED);
+
+      if (!gtk_thumbnail_cache_lookup (cache, thumbnail_path, mtime, icon_size * scale, &pixbuf))
+        {
+          pixbuf = gdk_pixbuf_new_from_file_at_size (thumbnail_path,
+                                                     icon_size*scale, icon_size*scale,
+                                                     NULL);
+          gtk_thumbnail_cache_insert (cache, thumbnail_path, mtime, icon_size * scale, pixbuf);
+        }
 
       if (pixbuf != NULL)
         return G_ICON (pixbuf);
     }
 
-  icon = g_file_info_get_icon (info);
-  if (icon)
-    return g_object_ref (icon);
+  return get_standard_icon (info);
+}
 
-  /* Use general fallback for all files without icon */
-  icon = g_themed_icon_new ("text-x-generic");
-  return icon;
+/* Like _gtk_file_info_get_icon(), but never decodes the thumbnail. If
+ * it is not in the thumbnail cache yet, the icon for the file type is
+ * returned and @needs_thumbnail is set, so that it can be loaded with
+ * gtk_thumbnail_cache_load().
+ */
+GIcon *
+_gtk_file_info_peek_icon (GFileInfo *info,
+                          int        icon_size,
+                          int        scale,
+                          gboolean  *needs_thumbnail)
+{
+  GdkPixbuf *pixbuf;
+  const gchar *thumbnail_path;
+  guint64 mtime;
+
+  *needs_thumbnail = FALSE;
+
+  thumbnail_path = g_file_info_get_attribute_byte_string (info, G_FILE_ATTRIBUTE_THUMBNAIL_PATH);
+
+  if (thumbnail_path)
+    {
+      mtime = g_file_info_get_attribute_uint64 (info, G_FILE_ATTRIBUTE_TIME_MODIFIED);
+
+      if (!gtk_thumbnail_cache_lookup (gtk_thumbnail_cache_get_default (),
+                                       thumbnail_path, mtime, icon_size * scale,
+                                       &pixbuf))
+        *needs_thumbnail = TRUE;
+      else if (pixbuf != NULL)
+        return G_ICON (pixbuf);
+    }
+
+  return get_standard_icon (info);
 }
 
 gboolean
@@ -103,6 +103,10 @@ void                  _gtk_file_system_volume_unref            (GtkFileSystemVol
 GIcon *               _gtk_file_info_get_icon    (GFileInfo *info,
                                                   int        icon_size,
                                                   int        scale);
+GIcon *               _gtk_file_info_peek_icon   (GFileInfo *info,
+                                                  int        icon_size,
+                                                  int        scale,
+                                                  gboolean  *needs_thumbnail);
 
 gboolean	_gtk_file_info_consider_as_directory (GFileInfo *info);
 
@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "gtkfilenameindexprivate.h"
 #include "gtkfilesystem.h"
 #include "gtkintl.h"
 #include "gtkmarshalers.h"
@@ -115,6 +116,13 @@
  * freeze_updates()) during the intial population process.  When the model is
  * frozen, sorting will not happen.  The model will sort itself when the freeze
  * count goes back to zero, via corresponding calls to thaw_updates().
+ *
+ * The nodes before model->n_nodes_sorted are known to be in order.  New files
+ * are appended after them, so when the model gets sorted only those new nodes
+ * need to be sorted, and they are then merged with the sorted ones in linear
+ * time.  A single node that changes, or the only node added while not frozen,
+ * is moved into place after a binary search instead.  Changing the sort
+ * column or function resets model->n_nodes_sorted and sorts everything.
  */
 
 /*** DEFINES ***/
@@ -127,6 +135,19 @@
 /* random number that everyone else seems to use, too */
 #define FILES_PER_QUERY 100
 
+/* The first query is small so the first rows show up right away,
+ * following ones double in size up to these limits. Non-native files
+ * are usually remote, so big queries would stall for longer. */
+#define MAX_FILES_PER_QUERY_NATIVE (50 * FILES_PER_QUERY)
+#define MAX_FILES_PER_QUERY_REMOTE (10 * FILES_PER_QUERY)
+
+/* While loading, the model is thawed (and resorted) at this interval.
+ * Sorting gets more expensive as files come in, so big directories
+ * are thawed less often, up to the maximum interval. */
+#define THAW_INTERVAL_MS 50
+#define THAW_INTERVAL_MAX_MS 1000
+#define FILES_PER_THAW_MS 200
+
 typedef struct _FileModelNode           FileModelNode;
 typedef struct _GtkFileSystemModelClass GtkFileSystemModelClass;
 
@@ -152,6 +173,7 @@ struct _GtkFileSystemModel
 
   GFile *               dir;            /* directory that's displayed */
   guint                 dir_thaw_source;/* GSource id for unfreezing the model */
+  guint                 files_per_query;/* size of the next enumeration query */
   char *                attributes;     /* attributes the file info must contain, or NULL for all attributes */
   GFileMonitor *        dir_monitor;    /* directory that is monitored, or NULL if monitoring was not supported */
 
@@ -159,6 +181,7 @@ struct _GtkFileSystemModel
   GArray *              files;          /* array of FileModelNode containing all our files */
   gsize                 node_size;	/* Size of a FileModelNode structure once its ->values field has n_columns */
   guint                 n_nodes_valid;  /* count of valid nodes (i.e. those whose node->row is accurate) */
+  guint                 n_nodes_sorted; /* count of nodes known to be in sort order, see "Sorting" above */
   GHashTable *          file_lookup;    /* mapping of GFile => array index in model->files
 					 * This hash table doesn't always have the same number of entries as the files array;
 					 * it can get cleared completely when we resort.
@@ -206,6 +229,9 @@ struct _GtkFileSystemModelClass
 
 static void freeze_updates (GtkFileSystemModel *model);
 static void thaw_updates (GtkFileSystemModel *model);
+static void gtk_file_system_model_got_files (GObject      *object,
+                                             GAsyncResult *res,
+                                             gpointer      data);
 
 static guint node_get_for_file (GtkFileSystemModel *model,
 				GFile              *file);
@@ -766,6 +792,108 @@ compare_array_element (gconstpointer a, gconstpointer b, gpointer user_data)
   return data->func (GTK_TREE_MODEL (data->model), &itera, &iterb, data->data) * data->order;
 }
 
+/* Emits ::rows-reordered after nodes were moved around in model->files.
+ * All rows must have been validated before moving them, node->row is
+ * used to find the old position of each node.
+ */
+static void
+emit_rows_reordered (GtkFileSystemModel *model,
+                     guint               n_visible_rows)
+{
+  GtkTreePath *path;
+  int *new_order;
+  guint i, r;
+
+  if (n_visible_rows == 0)
+    return;
+
+  new_order = g_new (int, n_visible_rows);
+
+  r = 0;
+  for (i = 0; i < model->files->len; i++)
+    {
+      FileModelNode *node = get_node (model, i);
+      if (!node->visible)
+        {
+          node->row = r;
+          continue;
+        }
+
+      new_order[r] = node->row - 1;
+      r++;
+      node->row = r;
+    }
+  g_assert (r == n_visible_rows);
+  model->n_nodes_valid = model->files->len;
+
+  path = gtk_tree_path_new ();
+  gtk_tree_model_rows_reordered (GTK_TREE_MODEL (model),
+                                 path,
+                                 NULL,
+                                 new_order);
+  gtk_tree_path_free (path);
+  g_free (new_order);
+}
+
+/* Sorts the nodes after model->n_nodes_sorted and merges them with the
+ * ones before, which are already in order.
+ */
+static void
+sort_merge_unsorted (GtkFileSystemModel *model,
+                     SortData           *data)
+{
+  guint n_sorted = model->n_nodes_sorted;
+  guint len = model->files->len;
+  guint start, end, i, j, k;
+  gchar *merged;
+
+  g_qsort_with_data (get_node (model, n_sorted),
+                     len - n_sorted,
+                     model->node_size,
+                     compare_array_element,
+                     data);
+
+  if (n_sorted <= 1)
+    return;
+
+  /* The sorted nodes before the first new one stay where they are */
+  start = 1;
+  end = n_sorted;
+  while (start < end)
+    {
+      guint mid = start + (end - start) / 2;
+
+      if (compare_array_element (get_node (model, n_sorted), get_node (model, mid), data) < 0)
+        end = mid;
+      else
+        start = mid + 1;
+    }
+
+  if (start == n_sorted)
+    return;
+
+  /* Comparing needs the nodes in model->files, so merge into a copy */
+  merged = g_malloc (model->node_size * (len - start));
+  i = start;
+  j = n_sorted;
+  k = 0;
+  while (i < n_sorted && j < len)
+    {
+      /* On ties, keep the node that was sorted already first */
+      if (compare_array_element (get_node (model, j), get_node (model, i), data) < 0)
+        memcpy (merged + model->node_size * k++, get_node (model, j++), model->node_size);
+      else
+        memcpy (merged + model->node_size * k++, get_node (model, i++), model->node_size);
+    }
+  if (i < n_sorted)
+    memcpy (merged + model->node_size * k, get_node (model, i), model->node_size * (n_sorted - i));
+  else if (j < len)
+    memcpy (merged + model->node_size * k, get_node (model, j), model->node_size * (len - j));
+
+  memcpy (get_node (model, start), merged, model->node_size * (len - start));
+  g_free (merged);
+}
+
 static void
 gtk_file_system_model_sort (GtkFileSystemModel *model)
 {
@@ -777,59 +905,113 @@ gtk_file_system_model_sort (GtkFileSystemModel *model)
       return;
     }
 
-  if (sort_data_init (&data, model))
+  if (!sort_data_init (&data, model))
     {
-      GtkTreePath *path;
-      guint i;
-      guint r, n_visible_rows;
+      /* Whatever the order is, it needs to be sorted once there is a sort function */
+      model->n_nodes_sorted = 1;
+    }
+  else if (model->n_nodes_sorted < model->files->len)
+    {
+      guint n_visible_rows;
 
       node_validate_rows (model, G_MAXUINT, G_MAXUINT);
       n_visible_rows = node_get_tree_row (model, model->files->len - 1) + 1;
       model->n_nodes_valid = 0;
       g_hash_table_remove_all (model->file_lookup);
-      g_qsort_with_data (get_node (model, 1), /* start at index 1; don't sort the editable row */
-                         model->files->len - 1,
-                         model->node_size,
-                         compare_array_element,
-                         &data);
+      sort_merge_unsorted (model, &data);
       g_assert (model->n_nodes_valid == 0);
       g_assert (g_hash_table_size (model->file_lookup) == 0);
-      if (n_visible_rows)
-        {
-          int *new_order = g_new (int, n_visible_rows);
-        
-          r = 0;
-          for (i = 0; i < model->files->len; i++)
-            {
-              FileModelNode *node = get_node (model, i);
-              if (!node->visible)
-                {
-                  node->row = r;
-                  continue;
-                }
-
-              new_order[r] = node->row - 1;
-              r++;
-              node->row = r;
-            }
-          g_assert (r == n_visible_rows);
-          path = gtk_tree_path_new ();
-          gtk_tree_model_rows_reordered (GTK_TREE_MODEL (model),
-                                         path,
-                                         NULL,
-                                         new_order);
-          gtk_tree_path_free (path);
-          g_free (new_order);
-        }
+      model->n_nodes_sorted = model->files->len;
+      emit_rows_reordered (model, n_visible_rows);
     }
 
   model->sort_on_thaw = FALSE;
 }
 
+/* Moves the node at @id into place, all other nodes must be in order */
+static void
+gtk_file_system_model_reposition_node (GtkFileSystemModel *model,
+                                       SortData           *data,
+                                       guint               id)
+{
+  guint start, end, dest, n_visible_rows = 0;
+  gboolean visible;
+  gpointer node;
+
+  /* Search the other nodes as if @id had been removed */
+  start = 1;
+  end = model->files->len - 1;
+  while (start < end)
+    {
+      guint mid = start + (end - start) / 2;
+      guint other = mid < id ? mid : mid + 1;
+
+      if (compare_array_element (get_node (model, id), get_node (model, other), data) < 0)
+        end = mid;
+      else
+        start = mid + 1;
+    }
+  dest = start;
+
+  if (dest == id)
+    return;
+
+  visible = get_node (model, id)->visible;
+  if (visible)
+    {
+      node_validate_rows (model, G_MAXUINT, G_MAXUINT);
+      n_visible_rows = node_get_tree_row (model, model->files->len - 1) + 1;
+    }
+  g_hash_table_remove_all (model->file_lookup);
+
+  node = g_memdup (get_node (model, id), model->node_size);
+  if (dest < id)
+    memmove (get_node (model, dest + 1), get_node (model, dest), model->node_size * (id - dest));
+  else
+    memmove (get_node (model, id), get_node (model, id + 1), model->node_size * (dest - id));
+  memcpy (get_node (model, dest), node, model->node_size);
+  g_free (node);
+
+  if (visible)
+    emit_rows_reordered (model, n_visible_rows);
+  else
+    node_invalidate_index (model, MIN (id, dest));
+}
+
 static void
 gtk_file_system_model_sort_node (GtkFileSystemModel *model, guint node)
 {
-  /* FIXME: improve */
+  SortData data;
+  guint len = model->files->len;
+
+  if (model->frozen)
+    {
+      /* Keep the order up to @node, the rest will be merged on thaw */
+      model->n_nodes_sorted = CLAMP (node, 1, model->n_nodes_sorted);
+      model->sort_on_thaw = TRUE;
+      return;
+    }
+
+  if (!sort_data_init (&data, model))
+    {
+      model->n_nodes_sorted = 1;
+      model->sort_on_thaw = FALSE;
+      return;
+    }
+
+  /* The node changed and everything else is sorted, or it was
+   * just appended to sorted nodes.
+   */
+  if ((node < model->n_nodes_sorted && model->n_nodes_sorted == len) ||
+      (node == len - 1 && model->n_nodes_sorted == len - 1))
+    {
+      gtk_file_system_model_reposition_node (model, &data, node);
+      model->n_nodes_sorted = len;
+      model->sort_on_thaw = FALSE;
+      return;
+    }
+
+  model->n_nodes_sorted = CLAMP (node, 1, model->n_nodes_sorted);
   gtk_file_system_model_sort (model);
 }
 
@@ -888,6 +1070,7 @@ gtk_file_system_model_set_sort_column_id (GtkTreeSortable  *sortable,
 
   gtk_tree_sortable_sort_column_changed (sortable);
 
+  model->n_nodes_sorted = 1;
   gtk_file_system_model_sort (model);
 }
 
@@ -905,7 +1088,10 @@ gtk_file_system_model_set_sort_func (GtkTreeSortable        *sortable,
                                                      func, data, destroy);
 
   if (model->sort_column_id == sort_column_id)
-    gtk_file_system_model_sort (model);
+    {
+      model->n_nodes_sorted = 1;
+      gtk_file_system_model_sort (model);
+    }
 }
 
 static void
@@ -929,7 +1115,10 @@ gtk_file_system_model_set_default_sort_func (GtkTreeSortable        *sortable,
   model->default_sort_destroy = destroy;
 
   if (model->sort_column_id == GTK_TREE_SORTABLE_DEFAULT_SORT_COLUMN_ID)
-    gtk_file_system_model_sort (model);
+    {
+      model->n_nodes_sorted = 1;
+      gtk_file_system_model_sort (model);
+    }
 }
 
 static gboolean
@@ -1129,6 +1318,69 @@ thaw_func (gpointer data)
   return FALSE;
 }
 
+static guint
+get_thaw_interval (GtkFileSystemModel *model)
+{
+  return CLAMP (model->files->len / FILES_PER_THAW_MS, THAW_INTERVAL_MS, THAW_INTERVAL_MAX_MS);
+}
+
+static void
+next_files_async (GtkFileSystemModel *model,
+                  GFileEnumerator    *enumerator)
+{
+  guint max_files;
+
+  g_file_enumerator_next_files_async (enumerator,
+                                      model->files_per_query,
+                                      IO_PRIORITY,
+                                      model->cancellable,
+                                      gtk_file_system_model_got_files,
+                                      model);
+
+  max_files = g_file_is_native (model->dir) ? MAX_FILES_PER_QUERY_NATIVE : MAX_FILES_PER_QUERY_REMOTE;
+  model->files_per_query = MIN (model->files_per_query * 2, max_files);
+}
+
+static gboolean
+is_indexed_file (GFileInfo *info)
+{
+  const char *name;
+
+  name = g_file_info_get_name (info);
+  if (name == NULL || name[0] == '.')
+    return FALSE;
+
+  return !g_file_info_get_attribute_boolean (info, G_FILE_ATTRIBUTE_STANDARD_IS_HIDDEN);
+}
+
+/* Local folders are remembered, so that searching finds their files right away */
+static void
+gtk_file_system_model_update_index (GtkFileSystemModel *model)
+{
+  GtkFileNameIndex *index;
+  GPtrArray *names;
+  guint i;
+
+  if (!g_file_is_native (model->dir) || _gtk_file_consider_as_remote (model->dir))
+    return;
+
+  index = gtk_file_name_index_get_default ();
+  if (index == NULL)
+    return;
+
+  names = g_ptr_array_sized_new (model->files->len);
+  for (i = 1; i < model->files->len; i++)
+    {
+      FileModelNode *node = get_node (model, i);
+
+      if (node->info && is_indexed_file (node->info))
+        g_ptr_array_add (names, (gpointer) g_file_info_get_name (node->info));
+    }
+
+  gtk_file_name_index_set_directory (index, model->dir, names);
+  g_ptr_array_unref (names);
+}
+
 static void
 gtk_file_system_model_got_files (GObject *object, GAsyncResult *res, gpointer data)
 {
@@ -1141,15 +1393,13 @@ gtk_file_system_model_got_files (GObject *object, GAsyncResult *res, gpointer da
 
   if (files)
     {
+      gboolean first_batch;
+
+      /* Only the editable node is there before the first batch */
+      first_batch = model->files->len == 1;
+
       if (model->dir_thaw_source == 0)
-        {
-          freeze_updates (model);
-          model->dir_thaw_source = g_timeout_add_full (IO_PRIORITY + 1, 50,
-                                                       thaw_func,
-                                                       model,
-                                                       NULL);
-          g_source_set_name_by_id (model->dir_thaw_source, "[gtk] thaw_func");
-        }
+        freeze_updates (model);
 
       for (walk = files; walk; walk = walk->next)
         {
@@ -1172,12 +1422,22 @@ gtk_file_system_model_got_files (GObject *object, GAsyncResult *res, gpointer da
         }
       g_list_free (files);
 
-      g_file_enumerator_next_files_async (enumerator,
-					  g_file_is_native (model->dir) ? 50 * FILES_PER_QUERY : FILES_PER_QUERY,
-					  IO_PRIORITY,
-					  model->cancellable,
-					  gtk_file_system_model_got_files,
-					  model);
+      /* Show the first batch right away, it is small enough to be
+       * sorted quickly and fills the first screen of the view.
+       * Later batches are merged and sorted once per thaw. */
+      if (first_batch && model->dir_thaw_source == 0)
+        thaw_updates (model);
+      else if (model->dir_thaw_source == 0)
+        {
+          model->dir_thaw_source = g_timeout_add_full (IO_PRIORITY + 1,
+                                                       get_thaw_interval (model),
+                                                       thaw_func,
+                                                       model,
+                                                       NULL);
+          g_source_set_name_by_id (model->dir_thaw_source, "[gtk] thaw_func");
+        }
+
+      next_files_async (model, enumerator);
     }
   else
     {
@@ -1195,6 +1455,9 @@ gtk_file_system_model_got_files (GObject *object, GAsyncResult *res, gpointer da
               thaw_updates (model);
             }
 
+          if (error == NULL)
+            gtk_file_system_model_update_index (model);
+
           g_signal_emit (model, file_system_model_signals[FINISHED_LOADING], 0, error);
         }
 
@@ -1232,6 +1495,24 @@ gtk_file_system_model_monitor_change (GFileMonitor *      monitor,
                                       GFileMonitorEvent   type,
                                       GtkFileSystemModel *model)
 {
+  GtkFileNameIndex *index;
+
+  if ((type == G_FILE_MONITOR_EVENT_CREATED || type == G_FILE_MONITOR_EVENT_DELETED) &&
+      (index = gtk_file_name_index_get_default ()) != NULL)
+    {
+      char *name = g_file_get_basename (file);
+
+      if (name[0] != '.')
+        {
+          if (type == G_FILE_MONITOR_EVENT_CREATED)
+            gtk_file_name_index_add_file (index, model->dir, name);
+          else
+            gtk_file_name_index_remove_file (index, model->dir, name);
+        }
+
+      g_free (name);
+    }
+
   switch (type)
     {
       case G_FILE_MONITOR_EVENT_CREATED:
@@ -1281,12 +1562,8 @@ gtk_file_system_model_got_enumerator (GObject *dir, GAsyncResult *res, gpointer
     }
   else
     {
-      g_file_enumerator_next_files_async (enumerator,
-                                          g_file_is_native (model->dir) ? 50 * FILES_PER_QUERY : FILES_PER_QUERY,
-                                          IO_PRIORITY,
-                                          model->cancellable,
-                                          gtk_file_system_model_got_files,
-                                          model);
+      model->files_per_query = FILES_PER_QUERY;
+      next_files_async (model, enumerator);
       g_object_unref (enumerator);
       model->dir_monitor = g_file_monitor_directory (model->dir,
                                                      G_FILE_MONITOR_NONE,
@@ -1333,6 +1610,7 @@ gtk_file_system_model_set_n_columns (GtkFileSystemModel *model,
   /* add editable node at start */
   g_array_set_size (model->files, 1);
   memset (get_node (model, 0), 0, model->node_size);
+  model->n_nodes_sorted = 1;
 }
 
 static void
@@ -1897,6 +2175,8 @@ remove_file (GtkFileSystemModel *model,
     g_object_unref (node->info);
 
   g_array_remove_index (model->files, id);
+  if (id < model->n_nodes_sorted)
+    model->n_nodes_sorted--;
 
   /* We don't need to resort, as removing a row doesn't change the sorting order of the other rows */
 
@@ -2108,6 +2388,42 @@ _gtk_file_system_model_clear_cache (GtkFileSystemModel *model,
   /* FIXME: resort? */
 }
 
+/**
+ * _gtk_file_system_model_clear_value:
+ * @model: a #GtkFileSystemModel
+ * @file: the file to clear the value for
+ * @column: the column to clear
+ *
+ * Like _gtk_file_system_model_clear_cache(), but only for the row of
+ * @file. Nothing happens if @file is not in @model or if the value
+ * was not computed yet.
+ **/
+void
+_gtk_file_system_model_clear_value (GtkFileSystemModel *model,
+                                    GFile              *file,
+                                    int                 column)
+{
+  FileModelNode *node;
+  guint id;
+
+  g_return_if_fail (GTK_IS_FILE_SYSTEM_MODEL (model));
+  g_return_if_fail (G_IS_FILE (file));
+  g_return_if_fail (column >= 0 && (guint) column < model->n_columns);
+
+  id = node_get_for_file (model, file);
+  if (id == 0)
+    return;
+
+  node = get_node (model, id);
+  if (!G_VALUE_TYPE (&node->values[column]))
+    return;
+
+  g_value_unset (&node->values[column]);
+
+  if (node->visible)
+    emit_row_changed_for_node (model, id);
+}
+
 /**
  * _gtk_file_system_model_add_and_query_file:
  * @model: a #GtkFileSystemModel
@@ -90,6 +90,9 @@ void                _gtk_file_system_model_set_filter_folders (GtkFileSystemMode
 							     gboolean            show_folders);
 void                _gtk_file_system_model_clear_cache      (GtkFileSystemModel *model,
                                                              int                 column);
+void                _gtk_file_system_model_clear_value      (GtkFileSystemModel *model,
+                                                             GFile              *file,
+                                                             int                 column);
 
 void                _gtk_file_system_model_set_filter       (GtkFileSystemModel *model,
                                                              GtkFileFilter      *filter);
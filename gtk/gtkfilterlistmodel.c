@@ -23,6 +23,7 @@
 
 #include "gtkrbtreeprivate.h"
 #include "gtkintl.h"
+#include "gtklistmodelitemsprivate.h"
 #include "gtkprivate.h"
 
 /**
@@ -35,13 +36,24 @@
  * listmodel.
  * It hides some elements from the other model according to
  * criteria given by a #GtkFilterListModelFilterFunc.
+ *
+ * Filtering large models can take a while. If
+ * #GtkFilterListModel:incremental is set, refiltering happens in short
+ * steps from an idle handler, and #GListModel::items-changed is emitted
+ * for every step. The #GtkFilterListModel:pending property tells how
+ * many items are still left to check.
  */
 
+/* How long one incremental filtering step may run, in microseconds */
+#define FILTER_STEP_TIME 1000
+
 enum {
   PROP_0,
   PROP_HAS_FILTER,
+  PROP_INCREMENTAL,
   PROP_ITEM_TYPE,
   PROP_MODEL,
+  PROP_PENDING,
   NUM_PROPERTIES
 };
 
@@ -70,6 +82,14 @@ struct _GtkFilterListModel
   GDestroyNotify user_destroy;
 
   GtkRbTree *items; /* NULL if filter_func == NULL */
+
+  gboolean incremental;
+
+  /* An ongoing refilter has checked all items before refilter_position */
+  guint refiltering : 1;
+  GtkFilterListModelChange refilter_change;
+  guint refilter_position;
+  guint refilter_cb;
 };
 
 struct _GtkFilterListModelClass
@@ -220,8 +240,66 @@ gtk_filter_list_model_model_init (GListModelInterface *iface)
   iface->get_item = gtk_filter_list_model_get_item;
 }
 
+static guint
+gtk_filter_list_model_get_items (GtkListModelItems *list,
+                                 guint              position,
+                                 guint              n_items,
+                                 gpointer          *items)
+{
+  GtkFilterListModel *self = GTK_FILTER_LIST_MODEL (list);
+  FilterNode *node;
+  guint unfiltered, run_start, run_length, n_found, n;
+
+  if (self->model == NULL)
+    return 0;
+
+  if (self->items == NULL)
+    return gtk_list_model_get_items (self->model, position, n_items, items);
+
+  node = gtk_filter_list_model_get_nth_filtered (self->items, position, &unfiltered);
+
+  /* Visible items next to each other get fetched in one go */
+  n_found = 0;
+  run_start = unfiltered;
+  run_length = 0;
+  while (node != NULL && n_found + run_length < n_items)
+    {
+      if (node->visible)
+        {
+          run_length++;
+        }
+      else
+        {
+          if (run_length > 0)
+            {
+              n = gtk_list_model_get_items (self->model, run_start, run_length, items + n_found);
+              n_found += n;
+              if (n < run_length)
+                return n_found;
+            }
+          run_start = unfiltered + 1;
+          run_length = 0;
+        }
+
+      unfiltered++;
+      node = gtk_rb_tree_node_get_next (node);
+    }
+
+  if (run_length > 0)
+    n_found += gtk_list_model_get_items (self->model, run_start, run_length, items + n_found);
+
+  return n_found;
+}
+
+static void
+gtk_filter_list_model_items_init (GtkListModelItemsInterface *iface)
+{
+  iface->get_items = gtk_filter_list_model_get_items;
+}
+
 G_DEFINE_TYPE_WITH_CODE (GtkFilterListModel, gtk_filter_list_model, G_TYPE_OBJECT,
-                         G_IMPLEMENT_INTERFACE (G_TYPE_LIST_MODEL, gtk_filter_list_model_model_init))
+                         G_IMPLEMENT_INTERFACE (G_TYPE_LIST_MODEL, gtk_filter_list_model_model_init)
+                         G_IMPLEMENT_INTERFACE (GTK_TYPE_LIST_MODEL_ITEMS, gtk_filter_list_model_items_init))
 
 static gboolean
 gtk_filter_list_model_run_filter (GtkFilterListModel *self,
@@ -248,12 +326,13 @@ gtk_filter_list_model_add_items (GtkFilterListModel *self,
 
   n_visible = 0;
   
+  node = gtk_rb_tree_insert_n_before (self->items, after, n_items);
   for (i = 0; i < n_items; i++)
     {
-      node = gtk_rb_tree_insert_before (self->items, after);
       node->visible = gtk_filter_list_model_run_filter (self, position + i);
       if (node->visible)
         n_visible++;
+      node = gtk_rb_tree_node_get_next (node);
     }
 
   return n_visible;
@@ -277,6 +356,16 @@ gtk_filter_list_model_items_changed_cb (GListModel         *model,
 
   node = gtk_filter_list_model_get_nth (self->items, position, &filter_position);
 
+  /* Added items get filtered right away, so an ongoing refilter
+   * continues after them */
+  if (self->refiltering && self->refilter_position >= position)
+    {
+      if (self->refilter_position >= position + removed)
+        self->refilter_position += added - removed;
+      else
+        self->refilter_position = position + added;
+    }
+
   filter_removed = 0;
   for (i = 0; i < removed; i++)
     {
@@ -303,6 +392,10 @@ gtk_filter_list_model_set_property (GObject      *object,
 
   switch (prop_id)
     {
+    case PROP_INCREMENTAL:
+      gtk_filter_list_model_set_incremental (self, g_value_get_boolean (value));
+      break;
+
     case PROP_ITEM_TYPE:
       self->item_type = g_value_get_gtype (value);
       break;
@@ -331,6 +424,10 @@ gtk_filter_list_model_get_property (GObject     *object,
       g_value_set_boolean (value, self->items != NULL);
       break;
 
+    case PROP_INCREMENTAL:
+      g_value_set_boolean (value, self->incremental);
+      break;
+
     case PROP_ITEM_TYPE:
       g_value_set_gtype (value, self->item_type);
       break;
@@ -339,18 +436,40 @@ gtk_filter_list_model_get_property (GObject     *object,
       g_value_set_object (value, self->model);
       break;
 
+    case PROP_PENDING:
+      g_value_set_uint (value, gtk_filter_list_model_get_pending (self));
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
     }
 }
 
+static void
+gtk_filter_list_model_stop_refilter (GtkFilterListModel *self)
+{
+  if (!self->refiltering)
+    return;
+
+  self->refiltering = FALSE;
+  if (self->refilter_cb != 0)
+    {
+      g_source_remove (self->refilter_cb);
+      self->refilter_cb = 0;
+    }
+
+  g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_PENDING]);
+}
+
 static void
 gtk_filter_list_model_clear_model (GtkFilterListModel *self)
 {
   if (self->model == NULL)
     return;
 
+  gtk_filter_list_model_stop_refilter (self);
+
   g_signal_handlers_disconnect_by_func (self->model, gtk_filter_list_model_items_changed_cb, self);
   g_clear_object (&self->model);
   if (self->items)
@@ -368,6 +487,7 @@ gtk_filter_list_model_dispose (GObject *object)
   self->filter_func = NULL;
   self->user_data = NULL;
   self->user_destroy = NULL;
+  gtk_filter_list_model_stop_refilter (self);
   g_clear_pointer (&self->items, gtk_rb_tree_unref);
 
   G_OBJECT_CLASS (gtk_filter_list_model_parent_class)->dispose (object);
@@ -394,6 +514,18 @@ gtk_filter_list_model_class_init (GtkFilterListModelClass *class)
                             FALSE,
                             GTK_PARAM_READABLE | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * GtkFilterListModel:incremental:
+   *
+   * If the model should filter items incrementally
+   */
+  properties[PROP_INCREMENTAL] =
+      g_param_spec_boolean ("incremental",
+                            P_("Incremental"),
+                            P_("Filter items incrementally"),
+                            FALSE,
+                            GTK_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   /**
    * GtkFilterListModel:item-type:
    *
@@ -418,6 +550,18 @@ gtk_filter_list_model_class_init (GtkFilterListModelClass *class)
                            G_TYPE_LIST_MODEL,
                            GTK_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * GtkFilterListModel:pending:
+   *
+   * Number of items not yet filtered
+   */
+  properties[PROP_PENDING] =
+      g_param_spec_uint ("pending",
+                         P_("Pending"),
+                         P_("Number of items not yet filtered"),
+                         0, G_MAXUINT, 0,
+                         GTK_PARAM_READABLE | G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_install_properties (gobject_class, NUM_PROPERTIES, properties);
 }
 
@@ -543,6 +687,7 @@ gtk_filter_list_model_set_filter_func (GtkFilterListModel           *self,
   
   if (!will_be_filtered)
     {
+      gtk_filter_list_model_stop_refilter (self);
       g_clear_pointer (&self->items, gtk_rb_tree_unref);
     }
   else if (!was_filtered)
@@ -555,11 +700,14 @@ gtk_filter_list_model_set_filter_func (GtkFilterListModel           *self,
                                      NULL, NULL);
       if (self->model)
         {
+          FilterNode *node;
+
           n_items = g_list_model_get_n_items (self->model);
+          node = gtk_rb_tree_insert_n_before (self->items, NULL, n_items);
           for (i = 0; i < n_items; i++)
             {
-              FilterNode *node = gtk_rb_tree_insert_before (self->items, NULL);
               node->visible = TRUE;
+              node = gtk_rb_tree_node_get_next (node);
             }
         }
     }
@@ -649,37 +797,50 @@ gtk_filter_list_model_has_filter (GtkFilterListModel *self)
   return self->filter_func != NULL;
 }
 
-/**
- * gtk_filter_list_model_refilter:
- * @self: a #GtkFilterListModel
- *
- * Causes @self to refilter all items in the model.
- *
- * Calling this function is necessary when data used by the filter
- * function has changed.
- **/
-void
-gtk_filter_list_model_refilter (GtkFilterListModel *self)
+/* Refilters the items from refilter_position on, until @end_time
+ * or until done if @end_time is 0. Returns %TRUE if there are
+ * items left to check.
+ */
+static gboolean
+gtk_filter_list_model_refilter_step (GtkFilterListModel *self,
+                                     gint64              end_time)
 {
   FilterNode *node;
-  guint i, first_change, last_change;
+  guint n_checked, position, first_change, last_change;
   guint n_is_visible, n_was_visible;
-  gboolean visible;
+  gboolean visible, done, check_time;
 
-  g_return_if_fail (GTK_IS_FILTER_LIST_MODEL (self));
-  
-  if (self->items == NULL || self->model == NULL)
-    return;
+  node = gtk_filter_list_model_get_nth (self->items, self->refilter_position, &position);
 
   first_change = G_MAXUINT;
   last_change = 0;
   n_is_visible = 0;
   n_was_visible = 0;
-  for (i = 0, node = gtk_rb_tree_get_first (self->items);
+  n_checked = 0;
+  check_time = FALSE;
+  for (;
        node != NULL;
-       i++, node = gtk_rb_tree_node_get_next (node))
+       self->refilter_position++, node = gtk_rb_tree_node_get_next (node))
     {
-      visible = gtk_filter_list_model_run_filter (self, i);
+      if (check_time)
+        {
+          if (g_get_monotonic_time () >= end_time)
+            break;
+          check_time = FALSE;
+        }
+
+      /* A stricter filter can only hide visible items, a less
+       * strict one can only show hidden ones */
+      if ((self->refilter_change == GTK_FILTER_LIST_MODEL_CHANGE_MORE_STRICT && !node->visible) ||
+          (self->refilter_change == GTK_FILTER_LIST_MODEL_CHANGE_LESS_STRICT && node->visible))
+        visible = node->visible;
+      else
+        {
+          visible = gtk_filter_list_model_run_filter (self, self->refilter_position);
+          n_checked++;
+          check_time = end_time > 0 && n_checked % 64 == 0;
+        }
+
       if (visible == node->visible)
         {
           if (visible)
@@ -700,12 +861,222 @@ gtk_filter_list_model_refilter (GtkFilterListModel *self)
       last_change = MAX (n_is_visible, last_change);
     }
 
+  done = node == NULL;
+  if (done)
+    {
+      self->refiltering = FALSE;
+      self->refilter_cb = 0;
+    }
+
   if (first_change <= last_change)
     {
       g_list_model_items_changed (G_LIST_MODEL (self),
-                                  first_change,
+                                  position + first_change,
                                   last_change - first_change + n_was_visible - n_is_visible,
                                   last_change - first_change);
     }
+
+  g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_PENDING]);
+
+  return !done;
+}
+
+static gboolean
+gtk_filter_list_model_refilter_cb (gpointer data)
+{
+  GtkFilterListModel *self = data;
+
+  if (gtk_filter_list_model_refilter_step (self, g_get_monotonic_time () + FILTER_STEP_TIME))
+    return G_SOURCE_CONTINUE;
+
+  return G_SOURCE_REMOVE;
 }
 
+static void
+gtk_filter_list_model_finish_refilter (GtkFilterListModel *self)
+{
+  if (!self->refiltering)
+    return;
+
+  if (self->refilter_cb != 0)
+    {
+      g_source_remove (self->refilter_cb);
+      self->refilter_cb = 0;
+    }
+
+  gtk_filter_list_model_refilter_step (self, 0);
+}
+
+/**
+ * gtk_filter_list_model_filter_changed:
+ * @self: a #GtkFilterListModel
+ * @change: how the filter function changed
+ *
+ * Causes @self to refilter items in the model, like
+ * gtk_filter_list_model_refilter().
+ *
+ * If the filter function got stricter, so that it only ever hides
+ * items it used to show, such as when typing more characters into
+ * a search, pass %GTK_FILTER_LIST_MODEL_CHANGE_MORE_STRICT and only
+ * the currently visible items are checked again.
+ * %GTK_FILTER_LIST_MODEL_CHANGE_LESS_STRICT does the same for hidden
+ * items.
+ *
+ * If #GtkFilterListModel:incremental is set, an ongoing refilter is
+ * replaced by the new one.
+ **/
+void
+gtk_filter_list_model_filter_changed (GtkFilterListModel       *self,
+                                      GtkFilterListModelChange  change)
+{
+  g_return_if_fail (GTK_IS_FILTER_LIST_MODEL (self));
+
+  if (self->items == NULL || self->model == NULL)
+    return;
+
+  /* The items an ongoing refilter did not get to yet have not seen
+   * the previous change, so only a change in the same direction can
+   * be combined with it */
+  if (self->refiltering)
+    {
+      if (self->refilter_change != change)
+        change = GTK_FILTER_LIST_MODEL_CHANGE_DIFFERENT;
+
+      self->refiltering = FALSE;
+      if (self->refilter_cb != 0)
+        {
+          g_source_remove (self->refilter_cb);
+          self->refilter_cb = 0;
+        }
+    }
+
+  self->refiltering = TRUE;
+  self->refilter_change = change;
+  self->refilter_position = 0;
+
+  if (!self->incremental)
+    {
+      gtk_filter_list_model_refilter_step (self, 0);
+      return;
+    }
+
+  self->refilter_cb = g_idle_add (gtk_filter_list_model_refilter_cb, self);
+  g_source_set_name_by_id (self->refilter_cb, "[gtk] gtk_filter_list_model_refilter_cb");
+
+  g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_PENDING]);
+}
+
+/**
+ * gtk_filter_list_model_refilter:
+ * @self: a #GtkFilterListModel
+ *
+ * Causes @self to refilter all items in the model.
+ *
+ * Calling this function is necessary when data used by the filter
+ * function has changed.
+ **/
+void
+gtk_filter_list_model_refilter (GtkFilterListModel *self)
+{
+  g_return_if_fail (GTK_IS_FILTER_LIST_MODEL (self));
+
+  gtk_filter_list_model_filter_changed (self, GTK_FILTER_LIST_MODEL_CHANGE_DIFFERENT);
+}
+
+/**
+ * gtk_filter_list_model_set_incremental:
+ * @self: a #GtkFilterListModel
+ * @incremental: %TRUE to filter incrementally
+ *
+ * When incremental filtering is enabled, refiltering does not check
+ * all items right away, but does so in short steps from an idle
+ * handler. Items that have not been checked yet keep their previous
+ * visibility meanwhile.
+ *
+ * Items that get added to the model are always filtered right away.
+ *
+ * By default, incremental filtering is disabled. Disabling it while a
+ * refilter is in progress finishes the refilter right away.
+ *
+ * See gtk_filter_list_model_get_pending() for progress information
+ * about an ongoing incremental filtering operation.
+ **/
+void
+gtk_filter_list_model_set_incremental (GtkFilterListModel *self,
+                                       gboolean            incremental)
+{
+  g_return_if_fail (GTK_IS_FILTER_LIST_MODEL (self));
+
+  incremental = incremental != FALSE;
+
+  if (self->incremental == incremental)
+    return;
+
+  self->incremental = incremental;
+
+  if (!incremental)
+    gtk_filter_list_model_finish_refilter (self);
+
+  g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_INCREMENTAL]);
+}
+
+/**
+ * gtk_filter_list_model_get_incremental:
+ * @self: a #GtkFilterListModel
+ *
+ * Returns whether incremental filtering was enabled via
+ * gtk_filter_list_model_set_incremental().
+ *
+ * Returns: %TRUE if incremental filtering is enabled
+ **/
+gboolean
+gtk_filter_list_model_get_incremental (GtkFilterListModel *self)
+{
+  g_return_val_if_fail (GTK_IS_FILTER_LIST_MODEL (self), FALSE);
+
+  return self->incremental;
+}
+
+/**
+ * gtk_filter_list_model_get_pending:
+ * @self: a #GtkFilterListModel
+ *
+ * Returns the number of items that an ongoing incremental refilter
+ * still needs to check. If no refilter is in progress, 0 is returned.
+ *
+ * Returns: the number of items not yet filtered
+ **/
+guint
+gtk_filter_list_model_get_pending (GtkFilterListModel *self)
+{
+  FilterNode *root;
+  FilterAugment *aug;
+  guint n_items, n_visible, visible_before;
+
+  g_return_val_if_fail (GTK_IS_FILTER_LIST_MODEL (self), 0);
+
+  if (!self->refiltering)
+    return 0;
+
+  root = gtk_rb_tree_get_root (self->items);
+  if (root == NULL)
+    return 0;
+
+  aug = gtk_rb_tree_get_augment (self->items, root);
+  n_items = aug->n_items;
+  n_visible = aug->n_visible;
+  gtk_filter_list_model_get_nth (self->items, self->refilter_position, &visible_before);
+
+  switch (self->refilter_change)
+    {
+    case GTK_FILTER_LIST_MODEL_CHANGE_MORE_STRICT:
+      return n_visible - visible_before;
+
+    case GTK_FILTER_LIST_MODEL_CHANGE_LESS_STRICT:
+      return (n_items - n_visible) - (self->refilter_position - visible_before);
+
+    case GTK_FILTER_LIST_MODEL_CHANGE_DIFFERENT:
+    default:
+      return n_items - self->refilter_position;
+    }
+}
@@ -23,6 +23,7 @@
 
 #include "gtkrbtreeprivate.h"
 #include "gtkintl.h"
+#include "gtklistmodelitemsprivate.h"
 #include "gtkprivate.h"
 
 /**
@@ -206,8 +207,47 @@ gtk_flatten_list_model_model_init (GListModelInterface *iface)
   iface->get_item = gtk_flatten_list_model_get_item;
 }
 
+static guint
+gtk_flatten_list_model_get_items (GtkListModelItems *list,
+                                  guint              position,
+                                  guint              n_items,
+                                  gpointer          *items)
+{
+  GtkFlattenListModel *self = GTK_FLATTEN_LIST_MODEL (list);
+  FlattenNode *node;
+  guint model_pos, n_found, n;
+
+  if (!self->items)
+    return 0;
+
+  node = gtk_flatten_list_model_get_nth (self->items, position, &model_pos);
+
+  n_found = 0;
+  while (node != NULL && n_found < n_items)
+    {
+      n = g_list_model_get_n_items (node->model);
+      if (model_pos < n)
+        n_found += gtk_list_model_get_items (node->model,
+                                             model_pos,
+                                             MIN (n - model_pos, n_items - n_found),
+                                             items + n_found);
+
+      model_pos = 0;
+      node = gtk_rb_tree_node_get_next (node);
+    }
+
+  return n_found;
+}
+
+static void
+gtk_flatten_list_model_items_init (GtkListModelItemsInterface *iface)
+{
+  iface->get_items = gtk_flatten_list_model_get_items;
+}
+
 G_DEFINE_TYPE_WITH_CODE (GtkFlattenListModel, gtk_flatten_list_model, G_TYPE_OBJECT,
-                         G_IMPLEMENT_INTERFACE (G_TYPE_LIST_MODEL, gtk_flatten_list_model_model_init))
+                         G_IMPLEMENT_INTERFACE (G_TYPE_LIST_MODEL, gtk_flatten_list_model_model_init)
+                         G_IMPLEMENT_INTERFACE (GTK_TYPE_LIST_MODEL_ITEMS, gtk_flatten_list_model_items_init))
 
 static void
 gtk_flatten_list_model_items_changed_cb (GListModel          *model,
@@ -287,9 +327,9 @@ gtk_flatten_list_model_add_items (GtkFlattenListModel *self,
   guint added, i;
 
   added = 0;
+  node = gtk_rb_tree_insert_n_before (self->items, after, n);
   for (i = 0; i < n; i++)
     {
-      node = gtk_rb_tree_insert_before (self->items, after);
       node->model = g_list_model_get_item (self->model, position + i);
       g_warn_if_fail (g_type_is_a (g_list_model_get_item_type (node->model), self->item_type));
       g_signal_connect (node->model,
@@ -298,6 +338,7 @@ gtk_flatten_list_model_add_items (GtkFlattenListModel *self,
                         node);
       node->list = self;
       added +=g_list_model_get_n_items (node->model);
+      node = gtk_rb_tree_node_get_next (node);
     }
 
   return added;
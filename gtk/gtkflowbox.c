@@ -84,6 +84,7 @@
 #include "gtkgesturedrag.h"
 #include "gtkgesturemultipress.h"
 #include "gtkintl.h"
+#include "gtklistmodelitemsprivate.h"
 #include "gtkmain.h"
 #include "gtkmarshalers.h"
 #include "gtkprivate.h"
@@ -129,6 +130,9 @@ static void gtk_flow_box_set_accept_unpaired_release (GtkFlowBox *box,
 
 static void gtk_flow_box_check_model_compat  (GtkFlowBox *box);
 
+static void gtk_flow_box_queue_update_virtual_children (GtkFlowBox *box);
+static guint gtk_flow_box_get_virtual_offset           (GtkFlowBox *box);
+
 static void
 get_current_selection_modifiers (GtkWidget *widget,
                                  gboolean  *modify,
@@ -493,7 +497,15 @@ gtk_flow_box_child_get_index (GtkFlowBoxChild *child)
   priv = CHILD_PRIV (child);
 
   if (priv->iter != NULL)
-    return g_sequence_iter_get_position (priv->iter);
+    {
+      GtkFlowBox *box = gtk_flow_box_child_get_box (child);
+      gint index = g_sequence_iter_get_position (priv->iter);
+
+      if (box)
+        index += gtk_flow_box_get_virtual_offset (box);
+
+      return index;
+    }
 
   return -1;
 }
@@ -562,6 +574,14 @@ gtk_flow_box_child_changed (GtkFlowBoxChild *child)
 #define AUTOSCROLL_FACTOR 20
 #define AUTOSCROLL_FACTOR_FAST 10
 
+/* How many items to get from the bound model at once */
+#define N_BATCH_ITEMS 64
+
+/* With virtual children, the number of children to create before the
+ * line size is known and the visible range can be computed
+ */
+#define INITIAL_VIRTUAL_CHILDREN 64
+
 /* GObject boilerplate {{{2 */
 
 enum {
@@ -587,6 +607,7 @@ enum {
   PROP_SELECTION_MODE,
   PROP_ACTIVATE_ON_SINGLE_CLICK,
   PROP_ACCEPT_UNPAIRED_RELEASE,
+  PROP_VIRTUAL_CHILDREN,
 
   /* orientable */
   PROP_ORIENTATION,
@@ -645,6 +666,17 @@ struct _GtkFlowBoxPrivate {
   GtkFlowBoxCreateWidgetFunc  create_widget_func;
   gpointer                    create_widget_func_data;
   GDestroyNotify              create_widget_func_data_destroy;
+
+  /* Virtual children: only the items of the bound model in the lines
+   * around the visible part of the adjustment have a child, starting
+   * with the item at virtual_first. All lines are virtual_line_stride
+   * pixels apart, since this needs the box to be homogeneous.
+   */
+  gboolean                    virtual_children;
+  guint                       virtual_first;
+  gint                        virtual_line_stride;
+  gint                        virtual_scroll_lines;
+  guint                       virtual_tick_id;
 };
 
 #define BOX_PRIV(box) ((GtkFlowBoxPrivate*)gtk_flow_box_get_instance_private ((GtkFlowBox*)(box)))
@@ -675,12 +707,31 @@ child_is_visible (GtkWidget *child)
          gtk_widget_get_child_visible (child);
 }
 
+static inline gboolean
+gtk_flow_box_is_virtual (GtkFlowBox *box)
+{
+  GtkFlowBoxPrivate *priv = BOX_PRIV (box);
+
+  return priv->virtual_children && priv->homogeneous && priv->bound_model != NULL;
+}
+
+/* The index of the item of the first child */
+static guint
+gtk_flow_box_get_virtual_offset (GtkFlowBox *box)
+{
+  return gtk_flow_box_is_virtual (box) ? BOX_PRIV (box)->virtual_first : 0;
+}
+
 static gint
 get_visible_children (GtkFlowBox *box)
 {
   GSequenceIter *iter;
   gint i = 0;
 
+  /* All items count, the existing children give their size */
+  if (gtk_flow_box_is_virtual (box))
+    return g_list_model_get_n_items (BOX_PRIV (box)->bound_model);
+
   for (iter = g_sequence_get_begin_iter (BOX_PRIV (box)->children);
        !g_sequence_iter_is_end (iter);
        iter = g_sequence_iter_next (iter))
@@ -1371,10 +1422,12 @@ gtk_flow_box_size_allocate (GtkWidget *widget,
   gint line_offset, item_offset, n_children, n_lines, line_count;
   gint extra_pixels = 0, extra_per_item = 0, extra_extra = 0;
   gint extra_line_pixels = 0, extra_per_line = 0, extra_line_extra = 0;
-  gint i, this_line_size;
+  gint i, first, this_line_size, old_line_length;
+  gboolean is_virtual;
   GSequenceIter *iter;
 
   min_items = MAX (1, priv->min_children_per_line);
+  is_virtual = gtk_flow_box_is_virtual (box);
 
   if (priv->orientation == GTK_ORIENTATION_HORIZONTAL)
     {
@@ -1526,6 +1579,7 @@ gtk_flow_box_size_allocate (GtkWidget *widget,
    * go on to distribute expand space if needed.
    */
 
+  old_line_length = priv->cur_children_per_line;
   priv->cur_children_per_line = line_length;
 
   /* FIXME: This portion needs to consider which columns
@@ -1570,8 +1624,46 @@ gtk_flow_box_size_allocate (GtkWidget *widget,
         }
     }
 
-  i = 0;
+  i = first = 0;
   line_count = 0;
+
+  if (is_virtual)
+    {
+      gint stride = line_size + line_spacing;
+
+      /* Children only exist from virtual_first on, start with its line */
+      i = first = MIN (priv->virtual_first, n_children);
+      line_count = first / line_length;
+      line_offset += line_count * stride;
+
+      /* Normally virtual_first starts a line, unless the model or
+       * the line length changed since the children were updated */
+      if (first % line_length != 0)
+        item_offset += (first % line_length) * (item_size + extra_per_item + item_spacing) +
+                       MIN (first % line_length, extra_extra);
+
+      if (stride != priv->virtual_line_stride ||
+          line_length != old_line_length ||
+          first % line_length != 0)
+        gtk_flow_box_queue_update_virtual_children (box);
+
+      priv->virtual_line_stride = stride;
+
+      /* Keep the same items in view after the model changed before them */
+      if (priv->virtual_scroll_lines != 0)
+        {
+          GtkAdjustment *adjustment;
+
+          adjustment = priv->orientation == GTK_ORIENTATION_HORIZONTAL
+                       ? priv->vadjustment : priv->hadjustment;
+          if (adjustment)
+            gtk_adjustment_set_value (adjustment,
+                                      gtk_adjustment_get_value (adjustment) +
+                                      priv->virtual_scroll_lines * stride);
+          priv->virtual_scroll_lines = 0;
+        }
+    }
+
   for (iter = g_sequence_get_begin_iter (priv->children);
        !g_sequence_iter_is_end (iter);
        iter = g_sequence_iter_next (iter))
@@ -1589,7 +1681,7 @@ gtk_flow_box_size_allocate (GtkWidget *widget,
       position = i % line_length;
 
       /* adjust the line_offset/count at the beginning of each new line */
-      if (i > 0 && position == 0)
+      if (i > first && position == 0)
         {
           /* Push the line_offset */
           line_offset += this_line_size + line_spacing;
@@ -3276,6 +3368,9 @@ gtk_flow_box_get_property (GObject    *object,
     case PROP_ACCEPT_UNPAIRED_RELEASE:
       g_value_set_boolean (value, priv->accept_unpaired_release);
       break;
+    case PROP_VIRTUAL_CHILDREN:
+      g_value_set_boolean (value, priv->virtual_children);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -3327,6 +3422,9 @@ gtk_flow_box_set_property (GObject      *object,
     case PROP_ACCEPT_UNPAIRED_RELEASE:
       gtk_flow_box_set_accept_unpaired_release (box, g_value_get_boolean (value));
       break;
+    case PROP_VIRTUAL_CHILDREN:
+      gtk_flow_box_set_virtual_children (box, g_value_get_boolean (value));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -3344,8 +3442,16 @@ gtk_flow_box_finalize (GObject *obj)
     priv->sort_destroy (priv->sort_data);
 
   g_sequence_free (priv->children);
-  g_clear_object (&priv->hadjustment);
-  g_clear_object (&priv->vadjustment);
+  if (priv->hadjustment)
+    {
+      g_signal_handlers_disconnect_by_func (priv->hadjustment, gtk_flow_box_queue_update_virtual_children, obj);
+      g_clear_object (&priv->hadjustment);
+    }
+  if (priv->vadjustment)
+    {
+      g_signal_handlers_disconnect_by_func (priv->vadjustment, gtk_flow_box_queue_update_virtual_children, obj);
+      g_clear_object (&priv->vadjustment);
+    }
 
   if (priv->bound_model)
     {
@@ -3494,6 +3600,21 @@ gtk_flow_box_class_init (GtkFlowBoxClass *class)
                        0, G_MAXUINT, 0,
                        GTK_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * GtkFlowBox:virtual-children:
+   *
+   * Whether children for the items of a bound model are only
+   * created around the visible part of a homogeneous box.
+   *
+   * See gtk_flow_box_set_virtual_children().
+   */
+  props[PROP_VIRTUAL_CHILDREN] =
+    g_param_spec_boolean ("virtual-children",
+                          P_("Virtual children"),
+                          P_("Whether children are only created for visible items of the bound model"),
+                          FALSE,
+                          GTK_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_install_properties (object_class, LAST_PROP, props);
 
   /**
@@ -3746,6 +3867,189 @@ gtk_flow_box_init (GtkFlowBox *box)
   gtk_widget_add_controller (GTK_WIDGET (box), controller);
 }
 
+static void
+gtk_flow_box_insert_object (GtkFlowBox *box,
+                            GObject    *item,
+                            gint        position)
+{
+  GtkFlowBoxPrivate *priv = BOX_PRIV (box);
+  GtkWidget *widget;
+
+  widget = priv->create_widget_func (item, priv->create_widget_func_data);
+
+  /* We need to sink the floating reference here, so that we can accept
+   * both instances created with a floating reference (e.g. C functions
+   * that just return the result of g_object_new()) and without (e.g.
+   * from language bindings which will automatically sink the floating
+   * reference).
+   *
+   * See the similar code in gtklistbox.c:gtk_list_box_bound_model_changed.
+   */
+  if (g_object_is_floating (widget))
+    g_object_ref_sink (widget);
+
+  gtk_widget_show (widget);
+  gtk_flow_box_insert (box, widget, position);
+
+  g_object_unref (widget);
+}
+
+static void
+gtk_flow_box_insert_item (GtkFlowBox *box,
+                          guint       item_position,
+                          gint        position)
+{
+  GObject *item;
+
+  item = g_list_model_get_item (BOX_PRIV (box)->bound_model, item_position);
+  gtk_flow_box_insert_object (box, item, position);
+  g_object_unref (item);
+}
+
+static GtkAdjustment *
+gtk_flow_box_get_scroll_adjustment (GtkFlowBox *box)
+{
+  GtkFlowBoxPrivate *priv = BOX_PRIV (box);
+
+  /* Lines are stacked in the opposite orientation */
+  if (priv->orientation == GTK_ORIENTATION_HORIZONTAL)
+    return priv->vadjustment;
+  else
+    return priv->hadjustment;
+}
+
+/* Makes the children cover the lines in the visible part of the
+ * scroll adjustment plus a page before and after it, creating
+ * children for the items that come into view and destroying the
+ * ones that went out of it.
+ */
+static void
+gtk_flow_box_update_virtual_children (GtkFlowBox *box)
+{
+  GtkFlowBoxPrivate *priv = BOX_PRIV (box);
+  GtkAdjustment *adjustment;
+  guint n_items, n_children;
+  guint line_length;
+  guint first, end;
+
+  if (!gtk_flow_box_is_virtual (box))
+    return;
+
+  n_items = g_list_model_get_n_items (priv->bound_model);
+  n_children = g_sequence_get_length (priv->children);
+  line_length = priv->cur_children_per_line;
+  if (line_length == 0)
+    line_length = MAX (1, priv->min_children_per_line);
+
+  adjustment = gtk_flow_box_get_scroll_adjustment (box);
+
+  if (priv->virtual_line_stride > 0 &&
+      adjustment && gtk_adjustment_get_page_size (adjustment) > 0)
+    {
+      double value = gtk_adjustment_get_value (adjustment);
+      double page = gtk_adjustment_get_page_size (adjustment);
+      guint first_line, end_line;
+
+      first_line = MAX (0, value - page) / priv->virtual_line_stride;
+      end_line = (value + 2 * page) / priv->virtual_line_stride + 1;
+
+      first = MIN (first_line * line_length, n_items);
+      end = MIN ((guint64) end_line * line_length, n_items);
+    }
+  else
+    {
+      /* Until we know how big lines are, or without an adjustment,
+       * make enough children to size lines and fill a typical view */
+      first = MIN (priv->virtual_first - priv->virtual_first % line_length, n_items);
+      end = MIN (first + MAX (INITIAL_VIRTUAL_CHILDREN, n_children), n_items);
+    }
+
+  /* Children that don't overlap the new range will all be replaced */
+  if (n_children > 0 &&
+      (end <= priv->virtual_first || first >= priv->virtual_first + n_children))
+    {
+      gtk_flow_box_forall (GTK_CONTAINER (box), (GtkCallback) gtk_widget_destroy, NULL);
+      n_children = 0;
+    }
+
+  if (n_children == 0)
+    priv->virtual_first = first;
+
+  while (priv->virtual_first < first)
+    {
+      gtk_widget_destroy (g_sequence_get (g_sequence_get_begin_iter (priv->children)));
+      priv->virtual_first++;
+      n_children--;
+    }
+
+  while (priv->virtual_first + n_children > end)
+    {
+      gtk_widget_destroy (g_sequence_get (g_sequence_iter_prev (g_sequence_get_end_iter (priv->children))));
+      n_children--;
+    }
+
+  while (priv->virtual_first > first)
+    {
+      priv->virtual_first--;
+      gtk_flow_box_insert_item (box, priv->virtual_first, 0);
+      n_children++;
+    }
+
+  while (priv->virtual_first + n_children < end)
+    {
+      gtk_flow_box_insert_item (box, priv->virtual_first + n_children, -1);
+      n_children++;
+    }
+}
+
+static gboolean
+gtk_flow_box_virtual_children_tick (GtkWidget     *widget,
+                                    GdkFrameClock *frame_clock,
+                                    gpointer       user_data)
+{
+  GtkFlowBox *box = GTK_FLOW_BOX (widget);
+
+  BOX_PRIV (box)->virtual_tick_id = 0;
+  gtk_flow_box_update_virtual_children (box);
+
+  return G_SOURCE_REMOVE;
+}
+
+/* Adjustments change during size allocation, and widgets can't be
+ * created then, so update the children before the next layout instead.
+ */
+static void
+gtk_flow_box_queue_update_virtual_children (GtkFlowBox *box)
+{
+  GtkFlowBoxPrivate *priv = BOX_PRIV (box);
+
+  if (!gtk_flow_box_is_virtual (box) || priv->virtual_tick_id != 0)
+    return;
+
+  priv->virtual_tick_id = gtk_widget_add_tick_callback (GTK_WIDGET (box),
+                                                        gtk_flow_box_virtual_children_tick,
+                                                        NULL, NULL);
+}
+
+/* Recreates all children of a model-bound box */
+static void
+gtk_flow_box_rebuild_bound_children (GtkFlowBox *box)
+{
+  GtkFlowBoxPrivate *priv = BOX_PRIV (box);
+
+  if (priv->bound_model == NULL)
+    return;
+
+  gtk_flow_box_forall (GTK_CONTAINER (box), (GtkCallback) gtk_widget_destroy, NULL);
+  priv->virtual_first = 0;
+  priv->virtual_line_stride = 0;
+  priv->virtual_scroll_lines = 0;
+
+  gtk_flow_box_bound_model_changed (priv->bound_model,
+                                    0, 0, g_list_model_get_n_items (priv->bound_model),
+                                    box);
+}
+
 static void
 gtk_flow_box_bound_model_changed (GListModel *list,
                                   guint       position,
@@ -3755,7 +4059,40 @@ gtk_flow_box_bound_model_changed (GListModel *list,
 {
   GtkFlowBox *box = user_data;
   GtkFlowBoxPrivate *priv = BOX_PRIV (box);
-  gint i;
+  guint i, n;
+
+  if (gtk_flow_box_is_virtual (box))
+    {
+      guint n_children = g_sequence_get_length (priv->children);
+      GtkAdjustment *adjustment = gtk_flow_box_get_scroll_adjustment (box);
+      guint line_length = MAX (1, priv->cur_children_per_line);
+
+      /* If the change is entirely before the first visible line, scroll
+       * by as many lines as the first visible item moves */
+      if (adjustment && priv->virtual_line_stride > 0)
+        {
+          guint line = gtk_adjustment_get_value (adjustment) / priv->virtual_line_stride;
+          guint anchor = (line + priv->virtual_scroll_lines) * line_length;
+
+          if (position < anchor && position + removed <= anchor)
+            priv->virtual_scroll_lines += (gint) ((anchor - removed + added) / line_length) -
+                                          (gint) (anchor / line_length);
+        }
+
+      /* Children for items after the change stay valid, as do
+       * children that all come before it. */
+      if (position + removed <= priv->virtual_first)
+        priv->virtual_first = priv->virtual_first - removed + added;
+      else if (position < priv->virtual_first + n_children)
+        {
+          gtk_flow_box_forall (GTK_CONTAINER (box), (GtkCallback) gtk_widget_destroy, NULL);
+          priv->virtual_first = 0;
+        }
+
+      gtk_flow_box_update_virtual_children (box);
+      gtk_widget_queue_resize (GTK_WIDGET (box));
+      return;
+    }
 
   while (removed--)
     {
@@ -3765,30 +4102,21 @@ gtk_flow_box_bound_model_changed (GListModel *list,
       gtk_widget_destroy (GTK_WIDGET (child));
     }
 
-  for (i = 0; i < added; i++)
+  for (i = 0; i < added; i += n)
     {
-      GObject *item;
-      GtkWidget *widget;
-
-      item = g_list_model_get_item (list, position + i);
-      widget = priv->create_widget_func (item, priv->create_widget_func_data);
-
-      /* We need to sink the floating reference here, so that we can accept
-       * both instances created with a floating reference (e.g. C functions
-       * that just return the result of g_object_new()) and without (e.g.
-       * from language bindings which will automatically sink the floating
-       * reference).
-       *
-       * See the similar code in gtklistbox.c:gtk_list_box_bound_model_changed.
-       */
-      if (g_object_is_floating (widget))
-        g_object_ref_sink (widget);
+      gpointer items[N_BATCH_ITEMS];
+      guint j;
 
-      gtk_widget_show (widget);
-      gtk_flow_box_insert (box, widget, position + i);
+      n = gtk_list_model_get_items (priv->bound_model, position + i,
+                                    MIN (added - i, N_BATCH_ITEMS), items);
+      if (n == 0)
+        break;
 
-      g_object_unref (widget);
-      g_object_unref (item);
+      for (j = 0; j < n; j++)
+        {
+          gtk_flow_box_insert_object (box, items[j], position + i + j);
+          g_object_unref (items[j]);
+        }
     }
 }
 
@@ -3904,6 +4232,13 @@ gtk_flow_box_get_child_at_index (GtkFlowBox *box,
 
   g_return_val_if_fail (GTK_IS_FLOW_BOX (box), NULL);
 
+  if (gtk_flow_box_is_virtual (box))
+    {
+      if (idx < (gint) BOX_PRIV (box)->virtual_first)
+        return NULL;
+      idx -= BOX_PRIV (box)->virtual_first;
+    }
+
   iter = g_sequence_get_iter_at_pos (BOX_PRIV (box)->children, idx);
   if (!g_sequence_iter_is_end (iter))
     return g_sequence_get (iter);
@@ -3967,9 +4302,18 @@ gtk_flow_box_set_hadjustment (GtkFlowBox    *box,
 
   g_object_ref (adjustment);
   if (priv->hadjustment)
-    g_object_unref (priv->hadjustment);
+    {
+      g_signal_handlers_disconnect_by_func (priv->hadjustment, gtk_flow_box_queue_update_virtual_children, box);
+      g_object_unref (priv->hadjustment);
+    }
   priv->hadjustment = adjustment;
   gtk_container_set_focus_hadjustment (GTK_CONTAINER (box), adjustment);
+
+  g_signal_connect_swapped (adjustment, "value-changed",
+                            G_CALLBACK (gtk_flow_box_queue_update_virtual_children), box);
+  g_signal_connect_swapped (adjustment, "changed",
+                            G_CALLBACK (gtk_flow_box_queue_update_virtual_children), box);
+  gtk_flow_box_queue_update_virtual_children (box);
 }
 
 /**
@@ -4002,9 +4346,18 @@ gtk_flow_box_set_vadjustment (GtkFlowBox    *box,
 
   g_object_ref (adjustment);
   if (priv->vadjustment)
-    g_object_unref (priv->vadjustment);
+    {
+      g_signal_handlers_disconnect_by_func (priv->vadjustment, gtk_flow_box_queue_update_virtual_children, box);
+      g_object_unref (priv->vadjustment);
+    }
   priv->vadjustment = adjustment;
   gtk_container_set_focus_vadjustment (GTK_CONTAINER (box), adjustment);
+
+  g_signal_connect_swapped (adjustment, "value-changed",
+                            G_CALLBACK (gtk_flow_box_queue_update_virtual_children), box);
+  g_signal_connect_swapped (adjustment, "changed",
+                            G_CALLBACK (gtk_flow_box_queue_update_virtual_children), box);
+  gtk_flow_box_queue_update_virtual_children (box);
 }
 
 static void
@@ -4041,6 +4394,8 @@ gtk_flow_box_check_model_compat (GtkFlowBox *box)
  * Note that using a model is incompatible with the filtering and sorting
  * functionality in GtkFlowBox. When using a model, filtering and sorting
  * should be implemented by the model.
+ *
+ * For large models, see gtk_flow_box_set_virtual_children().
  */
 void
 gtk_flow_box_bind_model (GtkFlowBox                 *box,
@@ -4065,6 +4420,9 @@ gtk_flow_box_bind_model (GtkFlowBox                 *box,
     }
 
   gtk_flow_box_forall (GTK_CONTAINER (box), (GtkCallback) gtk_widget_destroy, NULL);
+  priv->virtual_first = 0;
+  priv->virtual_line_stride = 0;
+  priv->virtual_scroll_lines = 0;
 
   if (model == NULL)
     return;
@@ -4080,6 +4438,72 @@ gtk_flow_box_bind_model (GtkFlowBox                 *box,
   gtk_flow_box_bound_model_changed (model, 0, 0, g_list_model_get_n_items (model), box);
 }
 
+/**
+ * gtk_flow_box_set_virtual_children:
+ * @box: a #GtkFlowBox
+ * @virtual_children: %TRUE to only create children for visible items
+ *
+ * Sets whether @box only creates children for the items of its
+ * bound model that are in or near the visible lines.
+ *
+ * The visible lines are taken from the adjustment of @box that
+ * scrolls across lines. That is the vertical adjustment for
+ * horizontal boxes and the horizontal one for vertical boxes, see
+ * gtk_flow_box_set_vadjustment(). Children are created as their line
+ * scrolls into view and destroyed when it moves out of it again.
+ * The box keeps showing the same items when items are added or
+ * removed before them.
+ *
+ * Since lines of items that have no child can't be measured, this
+ * only has an effect when @box is homogeneous, and all items are
+ * assumed to be as large as the largest child currently created.
+ *
+ * A child that is destroyed loses its selection and focus, and only
+ * children that exist are returned by functions like
+ * gtk_flow_box_get_child_at_index() or
+ * gtk_flow_box_get_selected_children().
+ *
+ * This has no effect on flow boxes that are not bound to a model
+ * with gtk_flow_box_bind_model().
+ */
+void
+gtk_flow_box_set_virtual_children (GtkFlowBox *box,
+                                   gboolean    virtual_children)
+{
+  GtkFlowBoxPrivate *priv = BOX_PRIV (box);
+
+  g_return_if_fail (GTK_IS_FLOW_BOX (box));
+
+  virtual_children = virtual_children != FALSE;
+
+  if (priv->virtual_children == virtual_children)
+    return;
+
+  priv->virtual_children = virtual_children;
+
+  if (priv->homogeneous)
+    gtk_flow_box_rebuild_bound_children (box);
+
+  g_object_notify_by_pspec (G_OBJECT (box), props[PROP_VIRTUAL_CHILDREN]);
+}
+
+/**
+ * gtk_flow_box_get_virtual_children:
+ * @box: a #GtkFlowBox
+ *
+ * Returns whether children are only created for visible items.
+ * See gtk_flow_box_set_virtual_children().
+ *
+ * Returns: %TRUE if children are only created for visible items
+ */
+gboolean
+gtk_flow_box_get_virtual_children (GtkFlowBox *box)
+{
+  g_return_val_if_fail (GTK_IS_FLOW_BOX (box), FALSE);
+
+  return BOX_PRIV (box)->virtual_children;
+}
+
 /* Setters and getters {{{2 */
 
 /**
@@ -4121,6 +4545,10 @@ gtk_flow_box_set_homogeneous (GtkFlowBox *box,
     {
       BOX_PRIV (box)->homogeneous = homogeneous;
 
+      /* This switches between virtual and real children */
+      if (BOX_PRIV (box)->virtual_children)
+        gtk_flow_box_rebuild_bound_children (box);
+
       g_object_notify_by_pspec (G_OBJECT (box), props[PROP_HOMOGENEOUS]);
       gtk_widget_queue_resize (GTK_WIDGET (box));
     }
@@ -136,6 +136,11 @@ void                  gtk_flow_box_bind_model                (GtkFlowBox
                                                               GtkFlowBoxCreateWidgetFunc  create_widget_func,
                                                               gpointer                    user_data,
                                                               GDestroyNotify              user_data_free_func);
+GDK_AVAILABLE_IN_ALL
+void                  gtk_flow_box_set_virtual_children      (GtkFlowBox                 *box,
+                                                              gboolean                    virtual_children);
+GDK_AVAILABLE_IN_ALL
+gboolean              gtk_flow_box_get_virtual_children      (GtkFlowBox                 *box);
 
 GDK_AVAILABLE_IN_ALL
 void                  gtk_flow_box_set_homogeneous           (GtkFlowBox           *box,
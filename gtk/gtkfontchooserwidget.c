@@ -107,6 +107,14 @@ struct _GtkFontChooserWidgetPrivate
   GtkWidget    *list_stack;
   GtkTreeModel *model;
   GtkTreeModel *filter_model;
+  gchar       **search_terms;     /* casefolded, NULL if not searching */
+
+  /* Families are added with a placeholder row, the rows before this
+   * one have their faces listed already.
+   */
+  gint          n_expanded_rows;
+  guint         expand_families_id;
+  gint          preview_text_height;
 
   GtkWidget       *preview;
   GtkWidget       *preview2;
@@ -155,9 +163,13 @@ enum {
   FAMILY_COLUMN,
   FACE_COLUMN,
   FONT_DESC_COLUMN,
-  PREVIEW_TITLE_COLUMN
+  PREVIEW_TITLE_COLUMN,
+  SEARCH_KEY_COLUMN
 };
 
+/* How long to list faces for in one main loop iteration, in microseconds */
+#define EXPAND_FAMILIES_TIME_SLICE 5000
+
 static void gtk_font_chooser_widget_set_property         (GObject         *object,
                                                           guint            prop_id,
                                                           const GValue    *value,
@@ -199,6 +211,8 @@ static void     gtk_font_chooser_widget_set_show_preview_entry (GtkFontChooserWi
 static void     gtk_font_chooser_widget_set_cell_size          (GtkFontChooserWidget *fontchooser);
 static void     gtk_font_chooser_widget_load_fonts             (GtkFontChooserWidget *fontchooser,
                                                                 gboolean              force);
+static gboolean gtk_font_chooser_widget_ensure_face            (GtkFontChooserWidget *fontchooser,
+                                                                GtkTreeIter          *iter);
 static void     gtk_font_chooser_widget_populate_features      (GtkFontChooserWidget *fontchooser);
 static gboolean visible_func                                   (GtkTreeModel *model,
 								GtkTreeIter  *iter,
@@ -360,6 +374,20 @@ gtk_font_chooser_widget_get_property (GObject         *object,
 static void
 gtk_font_chooser_widget_refilter_font_list (GtkFontChooserWidget *fontchooser)
 {
+  GtkFontChooserWidgetPrivate *priv = fontchooser->priv;
+  const gchar *search_text;
+
+  /* Split the search text once, not for every row */
+  g_clear_pointer (&priv->search_terms, g_strfreev);
+  search_text = gtk_editable_get_text (GTK_EDITABLE (priv->search_entry));
+  if (search_text[0] != 0)
+    {
+      gchar *search_casefold = g_utf8_casefold (search_text, -1);
+
+      priv->search_terms = g_strsplit (search_casefold, " ", 0);
+      g_free (search_casefold);
+    }
+
   gtk_tree_model_filter_refilter (GTK_TREE_MODEL_FILTER (fontchooser->priv->filter_model));
   gtk_font_chooser_widget_ensure_selection (fontchooser);
 }
@@ -550,6 +578,9 @@ cursor_changed_cb (GtkTreeView *treeview,
   gtk_tree_model_filter_convert_iter_to_child_iter (GTK_TREE_MODEL_FILTER (priv->filter_model),
                                                     &iter,
                                                     &filter_iter);
+  if (!gtk_font_chooser_widget_ensure_face (fontchooser, &iter))
+    return;
+
   gtk_tree_model_get (priv->model, &iter,
                       FONT_DESC_COLUMN, &desc,
                       -1);
@@ -670,6 +701,12 @@ gtk_font_chooser_widget_dispose (GObject *object)
   GtkFontChooserWidget *self = GTK_FONT_CHOOSER_WIDGET (object);
   GtkFontChooserWidgetPrivate *priv = gtk_font_chooser_widget_get_instance_private (self);
 
+  if (priv->expand_families_id)
+    {
+      g_source_remove (priv->expand_families_id);
+      priv->expand_families_id = 0;
+    }
+
   g_clear_pointer (&priv->stack, gtk_widget_unparent);
 
   G_OBJECT_CLASS (gtk_font_chooser_widget_parent_class)->dispose (object);
@@ -904,6 +941,170 @@ cmp_families (const void *a,
   return g_utf8_collate (a_name, b_name);
 }
 
+/* Replaces the placeholder row of the family at @iter with a row per
+ * face, the first of them at @iter. Returns %FALSE if the family has
+ * no faces, its row is removed then.
+ */
+static gboolean
+gtk_font_chooser_widget_expand_family (GtkFontChooserWidget *fontchooser,
+                                       GtkTreeIter          *iter)
+{
+  GtkFontChooserWidgetPrivate *priv = fontchooser->priv;
+  GtkListStore *list_store = GTK_LIST_STORE (priv->model);
+  PangoFontFamily *family;
+  PangoFontFace **faces;
+  GtkTreePath *path;
+  const gchar *fam_name;
+  int position, j, n_faces;
+
+  gtk_tree_model_get (priv->model, iter,
+                      FAMILY_COLUMN, &family,
+                      -1);
+
+  fam_name = pango_font_family_get_name (family);
+  pango_font_family_list_faces (family, &faces, &n_faces);
+
+  g_signal_handlers_block_by_func (priv->family_face_list, cursor_changed_cb, fontchooser);
+
+  if (n_faces == 0)
+    {
+      gtk_list_store_remove (list_store, iter);
+    }
+  else
+    {
+      path = gtk_tree_model_get_path (priv->model, iter);
+      position = gtk_tree_path_get_indices (path)[0];
+      gtk_tree_path_free (path);
+
+      for (j = 0; j < n_faces; j++)
+        {
+          GtkDelayedFontDescription *desc;
+          const gchar *face_name;
+          char *title, *search_key;
+
+          face_name = pango_font_face_get_face_name (faces[j]);
+
+          if ((priv->level & GTK_FONT_CHOOSER_LEVEL_STYLE) != 0)
+            title = g_strconcat (fam_name, " ", face_name, NULL);
+          else
+            title = g_strdup (fam_name);
+          search_key = g_utf8_casefold (title, -1);
+
+          desc = gtk_delayed_font_description_new (faces[j]);
+
+          if (j == 0)
+            gtk_list_store_set (list_store, iter,
+                                FACE_COLUMN, faces[j],
+                                FONT_DESC_COLUMN, desc,
+                                PREVIEW_TITLE_COLUMN, title,
+                                SEARCH_KEY_COLUMN, search_key,
+                                -1);
+          else
+            gtk_list_store_insert_with_values (list_store, NULL, position + j,
+                                               FAMILY_COLUMN, family,
+                                               FACE_COLUMN, faces[j],
+                                               FONT_DESC_COLUMN, desc,
+                                               PREVIEW_TITLE_COLUMN, title,
+                                               SEARCH_KEY_COLUMN, search_key,
+                                               -1);
+
+          g_free (title);
+          g_free (search_key);
+          gtk_delayed_font_description_unref (desc);
+
+          if ((priv->level & GTK_FONT_CHOOSER_LEVEL_STYLE) == 0)
+            break;
+        }
+    }
+
+  g_signal_handlers_unblock_by_func (priv->family_face_list, cursor_changed_cb, fontchooser);
+
+  g_free (faces);
+  g_object_unref (family);
+
+  return n_faces > 0;
+}
+
+/* Makes sure the row at @iter is not a family placeholder, see
+ * gtk_font_chooser_widget_expand_family() for the return value.
+ */
+static gboolean
+gtk_font_chooser_widget_ensure_face (GtkFontChooserWidget *fontchooser,
+                                     GtkTreeIter          *iter)
+{
+  PangoFontFace *face;
+
+  gtk_tree_model_get (fontchooser->priv->model, iter,
+                      FACE_COLUMN, &face,
+                      -1);
+
+  if (face == NULL)
+    return gtk_font_chooser_widget_expand_family (fontchooser, iter);
+
+  g_object_unref (face);
+
+  return TRUE;
+}
+
+static void
+gtk_font_chooser_widget_expand_visible_families (GtkFontChooserWidget *fontchooser)
+{
+  GtkFontChooserWidgetPrivate *priv = fontchooser->priv;
+  GtkTreePath *start, *end;
+
+  if (!gtk_widget_get_mapped (priv->family_face_list) ||
+      !gtk_tree_view_get_visible_range (GTK_TREE_VIEW (priv->family_face_list), &start, &end))
+    return;
+
+  while (gtk_tree_path_compare (start, end) <= 0)
+    {
+      GtkTreeIter filter_iter, iter;
+
+      if (!gtk_tree_model_get_iter (priv->filter_model, &filter_iter, start))
+        break;
+
+      gtk_tree_model_filter_convert_iter_to_child_iter (GTK_TREE_MODEL_FILTER (priv->filter_model),
+                                                        &iter,
+                                                        &filter_iter);
+      gtk_font_chooser_widget_ensure_face (fontchooser, &iter);
+
+      gtk_tree_path_next (start);
+    }
+
+  gtk_tree_path_free (start);
+  gtk_tree_path_free (end);
+}
+
+static gboolean
+expand_families_idle (gpointer data)
+{
+  GtkFontChooserWidget *fontchooser = data;
+  GtkFontChooserWidgetPrivate *priv = fontchooser->priv;
+  GtkTreeIter iter;
+  gint64 end_time;
+
+  end_time = g_get_monotonic_time () + EXPAND_FAMILIES_TIME_SLICE;
+
+  /* The rows that are shown come first */
+  gtk_font_chooser_widget_expand_visible_families (fontchooser);
+
+  /* Only rows after n_expanded_rows are ever added or removed, so the
+   * row at that index is always the next one to look at.
+   */
+  while (gtk_tree_model_iter_nth_child (priv->model, &iter, NULL, priv->n_expanded_rows))
+    {
+      if (g_get_monotonic_time () > end_time)
+        return G_SOURCE_CONTINUE;
+
+      if (gtk_font_chooser_widget_ensure_face (fontchooser, &iter))
+        priv->n_expanded_rows++;
+    }
+
+  priv->expand_families_id = 0;
+
+  return G_SOURCE_REMOVE;
+}
+
 static void
 gtk_font_chooser_widget_load_fonts (GtkFontChooserWidget *fontchooser,
                                     gboolean              force)
@@ -946,50 +1147,33 @@ gtk_font_chooser_widget_load_fonts (GtkFontChooserWidget *fontchooser,
   g_signal_handlers_block_by_func (priv->filter_model, rows_changed_cb, fontchooser);
   gtk_list_store_clear (list_store);
 
-  /* Iterate over families and faces */
+  /* Listing the faces of thousands of families takes seconds, so only
+   * add a row per family here and list their faces when they are needed,
+   * or from an idle.
+   */
   for (i = 0; i < n_families; i++)
     {
-      GtkTreeIter     iter;
-      PangoFontFace **faces;
-      int             j, n_faces;
-      const gchar    *fam_name = pango_font_family_get_name (families[i]);
-
-      pango_font_family_list_faces (families[i], &faces, &n_faces);
-
-      for (j = 0; j < n_faces; j++)
-        {
-          GtkDelayedFontDescription *desc;
-          const gchar *face_name;
-          char *title;
-
-          face_name = pango_font_face_get_face_name (faces[j]);
-
-          if ((priv->level & GTK_FONT_CHOOSER_LEVEL_STYLE) != 0)
-            title = g_strconcat (fam_name, " ", face_name, NULL);
-          else
-            title = g_strdup (fam_name);
-
-          desc = gtk_delayed_font_description_new (faces[j]);
-
-          gtk_list_store_insert_with_values (list_store, &iter, -1,
-                                             FAMILY_COLUMN, families[i],
-                                             FACE_COLUMN, faces[j],
-                                             FONT_DESC_COLUMN, desc,
-                                             PREVIEW_TITLE_COLUMN, title,
-                                             -1);
-
-          g_free (title);
-          gtk_delayed_font_description_unref (desc);
-
-          if ((priv->level & GTK_FONT_CHOOSER_LEVEL_STYLE) == 0)
-            break;
-        }
-
-      g_free (faces);
+      const gchar *fam_name = pango_font_family_get_name (families[i]);
+      gchar *search_key;
+
+      search_key = g_utf8_casefold (fam_name, -1);
+      gtk_list_store_insert_with_values (list_store, NULL, -1,
+                                         FAMILY_COLUMN, families[i],
+                                         PREVIEW_TITLE_COLUMN, fam_name,
+                                         SEARCH_KEY_COLUMN, search_key,
+                                         -1);
+      g_free (search_key);
     }
 
   g_free (families);
 
+  priv->n_expanded_rows = 0;
+  if (priv->expand_families_id == 0)
+    {
+      priv->expand_families_id = g_idle_add (expand_families_idle, fontchooser);
+      g_source_set_name_by_id (priv->expand_families_id, "[gtk] expand_families_idle");
+    }
+
   rows_changed_cb (fontchooser);
 
   g_signal_handlers_unblock_by_func (priv->filter_model, rows_changed_cb, fontchooser);
@@ -1009,9 +1193,7 @@ visible_func (GtkTreeModel *model,
 {
   GtkFontChooserWidgetPrivate *priv = user_data;
   gboolean result = TRUE;
-  const gchar *search_text;
-  gchar **split_terms;
-  gchar *font_name, *font_name_casefold;
+  gchar *search_key;
   guint i;
 
   if (priv->filter_func != NULL)
@@ -1024,6 +1206,13 @@ visible_func (GtkTreeModel *model,
                           FACE_COLUMN, &face,
                           -1);
 
+      /* Placeholders are filtered once their faces are listed */
+      if (face == NULL)
+        {
+          g_object_unref (family);
+          return FALSE;
+        }
+
       result = priv->filter_func (family, face, priv->filter_data);
 
       g_object_unref (family);
@@ -1034,33 +1223,23 @@ visible_func (GtkTreeModel *model,
     }
 
   /* If there's no filter string we show the item */
-  search_text = gtk_editable_get_text (GTK_EDITABLE (priv->search_entry));
-  if (strlen (search_text) == 0)
+  if (priv->search_terms == NULL)
     return TRUE;
 
   gtk_tree_model_get (model, iter,
-                      PREVIEW_TITLE_COLUMN, &font_name,
+                      SEARCH_KEY_COLUMN, &search_key,
                       -1);
 
-  if (font_name == NULL)
+  if (search_key == NULL)
     return FALSE;
 
-  split_terms = g_strsplit (search_text, " ", 0);
-  font_name_casefold = g_utf8_casefold (font_name, -1);
-
-  for (i = 0; split_terms[i] && result; i++)
+  for (i = 0; priv->search_terms[i] && result; i++)
     {
-      gchar* term_casefold = g_utf8_casefold (split_terms[i], -1);
-
-      if (!strstr (font_name_casefold, term_casefold))
+      if (!strstr (search_key, priv->search_terms[i]))
         result = FALSE;
-
-      g_free (term_casefold);
     }
 
-  g_free (font_name_casefold);
-  g_free (font_name);
-  g_strfreev (split_terms);
+  g_free (search_key);
 
   return result;
 }
@@ -1099,7 +1278,10 @@ gtk_font_chooser_widget_get_preview_attributes (GtkFontChooserWidget       *font
       pango_attr_list_insert (attrs, attribute);
     }
 
-  attribute = pango_attr_size_new_absolute (gtk_font_chooser_widget_get_preview_text_height (fontchooser));
+  if (fontchooser->priv->preview_text_height == 0)
+    fontchooser->priv->preview_text_height = gtk_font_chooser_widget_get_preview_text_height (fontchooser);
+
+  attribute = pango_attr_size_new_absolute (fontchooser->priv->preview_text_height);
   pango_attr_list_insert (attrs, attribute);
 
   return attrs;
@@ -1122,8 +1304,22 @@ gtk_font_chooser_widget_cell_data_func (GtkTreeViewColumn *column,
                       FONT_DESC_COLUMN, &desc,
                       -1);
 
-  attrs = gtk_font_chooser_widget_get_preview_attributes (fontchooser,
-                                                          gtk_delayed_font_description_get (desc));
+  if (desc)
+    {
+      attrs = gtk_font_chooser_widget_get_preview_attributes (fontchooser,
+                                                              gtk_delayed_font_description_get (desc));
+      gtk_delayed_font_description_unref (desc);
+    }
+  else
+    {
+      PangoFontDescription *font_desc;
+
+      /* A family whose faces are not listed yet */
+      font_desc = pango_font_description_new ();
+      pango_font_description_set_family_static (font_desc, preview_title);
+      attrs = gtk_font_chooser_widget_get_preview_attributes (fontchooser, font_desc);
+      pango_font_description_free (font_desc);
+    }
 
   g_object_set (cell,
                 "xpad", 20,
@@ -1132,7 +1328,6 @@ gtk_font_chooser_widget_cell_data_func (GtkTreeViewColumn *column,
                 "text", preview_title,
                 NULL);
 
-  gtk_delayed_font_description_unref (desc);
   pango_attr_list_unref (attrs);
   g_free (preview_title);
 }
@@ -1146,6 +1341,7 @@ gtk_font_chooser_widget_set_cell_size (GtkFontChooserWidget *fontchooser)
 
   gtk_cell_renderer_set_fixed_size (priv->family_face_cell, -1, -1);
 
+  priv->preview_text_height = gtk_font_chooser_widget_get_preview_text_height (fontchooser);
   attrs = gtk_font_chooser_widget_get_preview_attributes (fontchooser, NULL);
   
   g_object_set (priv->family_face_cell,
@@ -1177,6 +1373,7 @@ gtk_font_chooser_widget_finalize (GObject *object)
     priv->filter_data_destroy (priv->filter_data);
 
   g_free (priv->preview_text);
+  g_strfreev (priv->search_terms);
 
   g_clear_object (&priv->font_map);
 
@@ -1220,17 +1417,27 @@ gtk_font_chooser_widget_find_font (GtkFontChooserWidget        *fontchooser,
 
       gtk_tree_model_get (priv->model, iter,
                           FAMILY_COLUMN, &family,
-                          FONT_DESC_COLUMN, &desc,
                           -1);
 
       if (!my_pango_font_family_equal (pango_font_description_get_family (font_desc),
                                        pango_font_family_get_name (family)))
         {
-          gtk_delayed_font_description_unref (desc);
           g_object_unref (family);
           continue;
         }
 
+      /* Only the faces of the family we look for need to be listed */
+      if (!gtk_font_chooser_widget_ensure_face (fontchooser, iter))
+        {
+          /* The family has no faces, so its row is gone */
+          g_object_unref (family);
+          return gtk_font_chooser_widget_find_font (fontchooser, font_desc, iter);
+        }
+
+      gtk_tree_model_get (priv->model, iter,
+                          FONT_DESC_COLUMN, &desc,
+                          -1);
+
       merged = pango_font_description_copy_static (gtk_delayed_font_description_get (desc));
 
       pango_font_description_merge_static (merged, font_desc, FALSE);
@@ -1372,7 +1579,7 @@ gtk_font_chooser_widget_update_font_name (GtkFontChooserWidget *fontchooser,
 {
   GtkFontChooserWidgetPrivate *priv = fontchooser->priv;
   GtkTreeModel *model;
-  GtkTreeIter iter;
+  GtkTreeIter iter, child_iter;
   PangoFontFamily *family;
   PangoFontFace *face;
   GtkDelayedFontDescription *desc;
@@ -1383,7 +1590,13 @@ gtk_font_chooser_widget_update_font_name (GtkFontChooserWidget *fontchooser,
   char *title;
 
   gtk_tree_selection_get_selected (selection, &model, &iter);
-  gtk_tree_model_get (model, &iter,
+  gtk_tree_model_filter_convert_iter_to_child_iter (GTK_TREE_MODEL_FILTER (model),
+                                                    &child_iter,
+                                                    &iter);
+  if (!gtk_font_chooser_widget_ensure_face (fontchooser, &child_iter))
+    return;
+
+  gtk_tree_model_get (priv->model, &child_iter,
                       FAMILY_COLUMN, &family,
                       FACE_COLUMN, &face,
                       FONT_DESC_COLUMN, &desc,
@@ -0,0 +1,362 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "gtkframephasetimingsprivate.h"
+
+#include "gtkprivate.h"
+
+/**
+ * SECTION:gtkframephasetimings
+ * @Short_description: Where the time of a frame went
+ * @Title: GtkFramePhaseTimings
+ * @See_also: #GdkFrameTimings
+ *
+ * A #GtkFramePhaseTimings breaks a frame of a #GtkWindow down into
+ * style validation, measuring, allocating, snapshotting and rendering.
+ * For each phase it records when it started, how long it took and how
+ * many widgets did work in it. It also remembers the widgets that took
+ * the longest, so that the cause of a slow frame can be logged without
+ * attaching a profiler.
+ *
+ * The time of a widget only includes its own work; time spent in its
+ * children, or in another phase started from it (such as a measure
+ * caused by an allocation) is charged to those instead. Because of this,
+ * the durations of all phases add up to the time GTK spent on the frame.
+ *
+ * Input events that caused widgets to be redrawn or resized are charged
+ * to the frame that followed them. Together with the presentation time
+ * of the frame, this gives the latency from the input to its result
+ * being shown, see gtk_frame_phase_timings_get_input_latency().
+ *
+ * Recording is enabled with gtk_window_set_record_frame_phases(), and the
+ * records of recent frames are available via
+ * gtk_window_get_frame_phase_timings().
+ */
+
+G_DEFINE_BOXED_TYPE (GtkFramePhaseTimings, gtk_frame_phase_timings,
+                     gtk_frame_phase_timings_ref,
+                     gtk_frame_phase_timings_unref)
+
+GtkFramePhaseTimings *gtk_frame_phase_timings_current = NULL;
+
+GtkFramePhaseTimings *
+gtk_frame_phase_timings_new (gint64 frame_counter)
+{
+  GtkFramePhaseTimings *timings;
+
+  timings = g_slice_new0 (GtkFramePhaseTimings);
+  timings->ref_count = 1;
+  timings->frame_counter = frame_counter;
+
+  return timings;
+}
+
+static void
+gtk_frame_phase_timings_add_slowest (GtkFramePhaseTimings *timings,
+                                     GtkFramePhase         phase,
+                                     GtkWidget            *widget,
+                                     gint64                duration)
+{
+  guint i;
+
+  /* The list is short and sorted by duration, longest first */
+  i = timings->n_slowest;
+  if (i == GTK_FRAME_PHASE_N_SLOWEST)
+    {
+      if (duration <= timings->slowest[i - 1].duration)
+        return;
+      i--;
+    }
+  else
+    timings->n_slowest++;
+
+  for (; i > 0 && timings->slowest[i - 1].duration < duration; i--)
+    timings->slowest[i] = timings->slowest[i - 1];
+
+  timings->slowest[i] = (GtkFramePhaseWidget) { G_OBJECT_TYPE (widget), phase, duration };
+}
+
+void
+gtk_frame_phase_timings_end (GtkFramePhaseTimings *timings,
+                             GtkFramePhase         phase,
+                             GtkWidget            *widget,
+                             gint64                start,
+                             gint64                outer_nested_time)
+{
+  gint64 elapsed, own_time;
+
+  elapsed = g_get_monotonic_time () - start;
+  own_time = MAX (0, elapsed - timings->nested_time);
+  timings->nested_time = outer_nested_time + elapsed;
+
+  timings->phase_duration[phase] += own_time;
+
+  if (widget)
+    {
+      timings->phase_widgets[phase]++;
+      gtk_frame_phase_timings_add_slowest (timings, phase, widget, own_time);
+    }
+}
+
+/**
+ * gtk_frame_phase_timings_ref:
+ * @timings: a #GtkFramePhaseTimings
+ *
+ * Increases the reference count of @timings.
+ *
+ * Returns: @timings
+ */
+GtkFramePhaseTimings *
+gtk_frame_phase_timings_ref (GtkFramePhaseTimings *timings)
+{
+  g_return_val_if_fail (timings != NULL, NULL);
+
+  timings->ref_count++;
+
+  return timings;
+}
+
+/**
+ * gtk_frame_phase_timings_unref:
+ * @timings: a #GtkFramePhaseTimings
+ *
+ * Decreases the reference count of @timings. If @timings
+ * is no longer referenced, it will be freed.
+ */
+void
+gtk_frame_phase_timings_unref (GtkFramePhaseTimings *timings)
+{
+  g_return_if_fail (timings != NULL);
+  g_return_if_fail (timings->ref_count > 0);
+
+  timings->ref_count--;
+  if (timings->ref_count == 0)
+    g_slice_free (GtkFramePhaseTimings, timings);
+}
+
+/**
+ * gtk_frame_phase_timings_get_frame_counter:
+ * @timings: a #GtkFramePhaseTimings
+ *
+ * Gets the frame counter value of the #GdkFrameClock when
+ * the frame was produced.
+ *
+ * Returns: the frame counter value for this frame
+ */
+gint64
+gtk_frame_phase_timings_get_frame_counter (GtkFramePhaseTimings *timings)
+{
+  g_return_val_if_fail (timings != NULL, 0);
+
+  return timings->frame_counter;
+}
+
+/**
+ * gtk_frame_phase_timings_get_phase_start:
+ * @timings: a #GtkFramePhaseTimings
+ * @phase: a #GtkFramePhase
+ *
+ * Gets the time when @phase first started doing work in the frame,
+ * in the timescale of g_get_monotonic_time().
+ *
+ * Returns: the start time of @phase, or 0 if nothing was done in @phase
+ */
+gint64
+gtk_frame_phase_timings_get_phase_start (GtkFramePhaseTimings *timings,
+                                         GtkFramePhase         phase)
+{
+  g_return_val_if_fail (timings != NULL, 0);
+  g_return_val_if_fail (phase < GTK_N_FRAME_PHASES, 0);
+
+  return timings->phase_start[phase];
+}
+
+/**
+ * gtk_frame_phase_timings_get_phase_duration:
+ * @timings: a #GtkFramePhaseTimings
+ * @phase: a #GtkFramePhase
+ *
+ * Gets the time spent in @phase during the frame, in microseconds.
+ *
+ * Phases can be interleaved, for example widgets may be measured while
+ * they are being allocated, so this is not necessarily the time between
+ * the start of @phase and the start of the next one.
+ *
+ * Returns: the duration of @phase
+ */
+gint64
+gtk_frame_phase_timings_get_phase_duration (GtkFramePhaseTimings *timings,
+                                            GtkFramePhase         phase)
+{
+  g_return_val_if_fail (timings != NULL, 0);
+  g_return_val_if_fail (phase < GTK_N_FRAME_PHASES, 0);
+
+  return timings->phase_duration[phase];
+}
+
+/**
+ * gtk_frame_phase_timings_get_phase_widgets:
+ * @timings: a #GtkFramePhaseTimings
+ * @phase: a #GtkFramePhase
+ *
+ * Gets how many times widgets did work in @phase during the frame.
+ * Measures that were answered from the size request cache and widgets
+ * that were not redrawn are not counted.
+ *
+ * Returns: the number of widgets
+ */
+guint
+gtk_frame_phase_timings_get_phase_widgets (GtkFramePhaseTimings *timings,
+                                           GtkFramePhase         phase)
+{
+  g_return_val_if_fail (timings != NULL, 0);
+  g_return_val_if_fail (phase < GTK_N_FRAME_PHASES, 0);
+
+  return timings->phase_widgets[phase];
+}
+
+/**
+ * gtk_frame_phase_timings_get_n_slowest:
+ * @timings: a #GtkFramePhaseTimings
+ *
+ * Gets the number of entries in the list of slowest widgets
+ * of the frame.
+ *
+ * Returns: the number of entries that can be queried with
+ *   gtk_frame_phase_timings_get_slowest()
+ */
+guint
+gtk_frame_phase_timings_get_n_slowest (GtkFramePhaseTimings *timings)
+{
+  g_return_val_if_fail (timings != NULL, 0);
+
+  return timings->n_slowest;
+}
+
+/**
+ * gtk_frame_phase_timings_get_slowest:
+ * @timings: a #GtkFramePhaseTimings
+ * @position: the position in the list, 0 being the slowest
+ * @phase: (out) (optional): return location for the phase
+ * @duration: (out) (optional): return location for the time
+ *   the widget took, in microseconds
+ *
+ * Gets one of the widgets that took the longest to do their work
+ * in the frame.
+ *
+ * The widgets themselves are not kept alive by @timings, so
+ * only the name of their type is returned.
+ *
+ * Returns: the type name of the widget
+ */
+const char *
+gtk_frame_phase_timings_get_slowest (GtkFramePhaseTimings *timings,
+                                     guint                 position,
+                                     GtkFramePhase        *phase,
+                                     gint64               *duration)
+{
+  g_return_val_if_fail (timings != NULL, NULL);
+  g_return_val_if_fail (position < timings->n_slowest, NULL);
+
+  if (phase)
+    *phase = timings->slowest[position].phase;
+  if (duration)
+    *duration = timings->slowest[position].duration;
+
+  return g_type_name (timings->slowest[position].type);
+}
+
+/**
+ * gtk_frame_phase_timings_get_n_input_events:
+ * @timings: a #GtkFramePhaseTimings
+ *
+ * Gets the number of input events, such as key presses, pointer motion
+ * or scrolling, that were handled since the previous frame and caused
+ * widgets of the window to be redrawn or resized.
+ *
+ * Returns: the number of input events shown by the frame
+ */
+guint
+gtk_frame_phase_timings_get_n_input_events (GtkFramePhaseTimings *timings)
+{
+  g_return_val_if_fail (timings != NULL, 0);
+
+  return timings->n_input_events;
+}
+
+/**
+ * gtk_frame_phase_timings_get_input_time:
+ * @timings: a #GtkFramePhaseTimings
+ *
+ * Gets the time when GTK started handling the first of the input events
+ * counted by gtk_frame_phase_timings_get_n_input_events(), in the
+ * timescale of g_get_monotonic_time().
+ *
+ * Returns: the time of the oldest input event, or 0 if there was none
+ */
+gint64
+gtk_frame_phase_timings_get_input_time (GtkFramePhaseTimings *timings)
+{
+  g_return_val_if_fail (timings != NULL, 0);
+
+  return timings->input_time;
+}
+
+/**
+ * gtk_frame_phase_timings_get_input_latency:
+ * @timings: a #GtkFramePhaseTimings
+ * @frame_clock: the #GdkFrameClock of the window the frame belongs to
+ *
+ * Gets the time from the oldest input event shown by the frame to the
+ * frame being presented. If the frame was not presented yet, or the
+ * windowing system does not report presentation, the predicted
+ * presentation time is used instead.
+ *
+ * Only the time the event spent in GTK is included; the time between
+ * the input device and the event reaching the application is not
+ * known to GTK.
+ *
+ * Returns: the input latency in microseconds, or 0 if the frame does not
+ *   show any input or its presentation time is not known
+ */
+gint64
+gtk_frame_phase_timings_get_input_latency (GtkFramePhaseTimings *timings,
+                                           GdkFrameClock        *frame_clock)
+{
+  GdkFrameTimings *frame_timings;
+  gint64 presentation_time;
+
+  g_return_val_if_fail (timings != NULL, 0);
+  g_return_val_if_fail (GDK_IS_FRAME_CLOCK (frame_clock), 0);
+
+  if (timings->n_input_events == 0)
+    return 0;
+
+  frame_timings = gdk_frame_clock_get_timings (frame_clock, timings->frame_counter);
+  if (frame_timings == NULL)
+    return 0;
+
+  presentation_time = gdk_frame_timings_get_presentation_time (frame_timings);
+  if (presentation_time == 0)
+    presentation_time = gdk_frame_timings_get_predicted_presentation_time (frame_timings);
+  if (presentation_time == 0)
+    return 0;
+
+  return MAX (0, presentation_time - timings->input_time);
+}
@@ -0,0 +1,80 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GTK_FRAME_PHASE_TIMINGS_H__
+#define __GTK_FRAME_PHASE_TIMINGS_H__
+
+#if !defined (__GTK_H_INSIDE__) && !defined (GTK_COMPILATION)
+#error "Only <gtk/gtk.h> can be included directly."
+#endif
+
+#include <gdk/gdk.h>
+#include <gtk/gtkenums.h>
+
+G_BEGIN_DECLS
+
+#define GTK_TYPE_FRAME_PHASE_TIMINGS (gtk_frame_phase_timings_get_type ())
+
+/**
+ * GtkFramePhaseTimings:
+ *
+ * A #GtkFramePhaseTimings records how the work of a single frame of a
+ * #GtkWindow was split between the phases listed in #GtkFramePhase.
+ *
+ * See gtk_window_set_record_frame_phases().
+ */
+typedef struct _GtkFramePhaseTimings GtkFramePhaseTimings;
+
+GDK_AVAILABLE_IN_ALL
+GType                   gtk_frame_phase_timings_get_type                (void) G_GNUC_CONST;
+
+GDK_AVAILABLE_IN_ALL
+GtkFramePhaseTimings *  gtk_frame_phase_timings_ref                     (GtkFramePhaseTimings *timings);
+GDK_AVAILABLE_IN_ALL
+void                    gtk_frame_phase_timings_unref                   (GtkFramePhaseTimings *timings);
+
+GDK_AVAILABLE_IN_ALL
+gint64                  gtk_frame_phase_timings_get_frame_counter       (GtkFramePhaseTimings *timings);
+GDK_AVAILABLE_IN_ALL
+gint64                  gtk_frame_phase_timings_get_phase_start         (GtkFramePhaseTimings *timings,
+                                                                         GtkFramePhase         phase);
+GDK_AVAILABLE_IN_ALL
+gint64                  gtk_frame_phase_timings_get_phase_duration      (GtkFramePhaseTimings *timings,
+                                                                         GtkFramePhase         phase);
+GDK_AVAILABLE_IN_ALL
+guint                   gtk_frame_phase_timings_get_phase_widgets       (GtkFramePhaseTimings *timings,
+                                                                         GtkFramePhase         phase);
+
+GDK_AVAILABLE_IN_ALL
+guint                   gtk_frame_phase_timings_get_n_slowest           (GtkFramePhaseTimings *timings);
+GDK_AVAILABLE_IN_ALL
+const char *            gtk_frame_phase_timings_get_slowest             (GtkFramePhaseTimings *timings,
+                                                                         guint                 position,
+                                                                         GtkFramePhase        *phase,
+                                                                         gint64               *duration);
+
+GDK_AVAILABLE_IN_ALL
+guint                   gtk_frame_phase_timings_get_n_input_events      (GtkFramePhaseTimings *timings);
+GDK_AVAILABLE_IN_ALL
+gint64                  gtk_frame_phase_timings_get_input_time          (GtkFramePhaseTimings *timings);
+GDK_AVAILABLE_IN_ALL
+gint64                  gtk_frame_phase_timings_get_input_latency       (GtkFramePhaseTimings *timings,
+                                                                         GdkFrameClock        *frame_clock);
+
+G_END_DECLS
+
+#endif /* __GTK_FRAME_PHASE_TIMINGS_H__ */
@@ -0,0 +1,122 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GTK_FRAME_PHASE_TIMINGS_PRIVATE_H__
+#define __GTK_FRAME_PHASE_TIMINGS_PRIVATE_H__
+
+#include "gtkframephasetimings.h"
+#include "gtkwidget.h"
+
+G_BEGIN_DECLS
+
+#define GTK_N_FRAME_PHASES (GTK_FRAME_PHASE_RENDER + 1)
+
+/* How many of the slowest widgets of a frame we remember */
+#define GTK_FRAME_PHASE_N_SLOWEST 8
+
+typedef struct
+{
+  GType         type;
+  GtkFramePhase phase;
+  gint64        duration;
+} GtkFramePhaseWidget;
+
+struct _GtkFramePhaseTimings
+{
+  int                   ref_count;
+
+  gint64                frame_counter;
+  gint64                phase_start[GTK_N_FRAME_PHASES];
+  gint64                phase_duration[GTK_N_FRAME_PHASES];
+  guint                 phase_widgets[GTK_N_FRAME_PHASES];
+
+  /* time spent in nested phases, so every widget only gets
+   * charged for the work it does itself */
+  gint64                nested_time;
+
+  guint                 n_slowest;
+  GtkFramePhaseWidget   slowest[GTK_FRAME_PHASE_N_SLOWEST];
+
+  /* the input events that the frame shows the results of */
+  gint64                input_time;
+  guint                 n_input_events;
+};
+
+/* The record of the frame that is currently being produced, or %NULL
+ * if the window producing it does not record frame phases. */
+extern GtkFramePhaseTimings *gtk_frame_phase_timings_current;
+
+GtkFramePhaseTimings *  gtk_frame_phase_timings_new             (gint64                 frame_counter);
+
+void                    gtk_frame_phase_timings_end             (GtkFramePhaseTimings  *timings,
+                                                                 GtkFramePhase          phase,
+                                                                 GtkWidget             *widget,
+                                                                 gint64                 start,
+                                                                 gint64                 outer_nested_time);
+
+/*
+ * gtk_frame_phase_begin:
+ * @phase: the phase that is starting
+ * @start: (out): return location for the start time
+ * @outer_nested_time: (out): return location for state to pass
+ *   to gtk_frame_phase_end()
+ *
+ * Starts timing a part of @phase. This is a cheap pointer check
+ * when no frame is being recorded.
+ *
+ * Returns: the record to pass to gtk_frame_phase_end(), or %NULL
+ */
+static inline GtkFramePhaseTimings *
+gtk_frame_phase_begin (GtkFramePhase  phase,
+                       gint64        *start,
+                       gint64        *outer_nested_time)
+{
+  GtkFramePhaseTimings *timings = gtk_frame_phase_timings_current;
+
+  if (G_LIKELY (timings == NULL))
+    {
+      *start = 0;
+      *outer_nested_time = 0;
+      return NULL;
+    }
+
+  *start = g_get_monotonic_time ();
+  *outer_nested_time = timings->nested_time;
+  timings->nested_time = 0;
+
+  if (timings->phase_start[phase] == 0)
+    timings->phase_start[phase] = *start;
+
+  return timings;
+}
+
+static inline void
+gtk_frame_phase_end (GtkFramePhaseTimings *timings,
+                     GtkFramePhase         phase,
+                     GtkWidget            *widget,
+                     gint64                start,
+                     gint64                outer_nested_time)
+{
+  if (G_LIKELY (timings == NULL))
+    return;
+
+  gtk_frame_phase_timings_end (timings, phase, widget, start, outer_nested_time);
+}
+
+G_END_DECLS
+
+#endif /* __GTK_FRAME_PHASE_TIMINGS_PRIVATE_H__ */
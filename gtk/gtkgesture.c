@@ -142,6 +142,7 @@ enum {
 
 struct _PointData
 {
+  GdkEventSequence *sequence;
   GdkEvent *event;
   gdouble widget_x;
   gdouble widget_y;
@@ -152,17 +153,26 @@ struct _PointData
 
   guint press_handled : 1;
   guint state : 2;
+  guint ended : 1;
 };
 
+#define POINT_IS_ACTIVE(p) ((p)->state != GTK_EVENT_SEQUENCE_DENIED && !(p)->ended)
+
 struct _GtkGesturePrivate
 {
   GHashTable *points;
+  /* The same points in the order they were pressed, the
+   * hash table is only needed to look up a sequence.
+   */
+  GPtrArray *point_list;
+  GdkRectangle bounding_box;
   GdkEventSequence *last_sequence;
   GdkDevice *device;
   GList *group_link;
   guint n_points;
   guint recognized : 1;
   guint touchpad : 1;
+  guint bounding_box_valid : 1;
 };
 
 static guint signals[N_SIGNALS] = { 0 };
@@ -221,6 +231,7 @@ gtk_gesture_finalize (GObject *object)
   gtk_gesture_ungroup (gesture);
   g_list_free (priv->group_link);
 
+  g_ptr_array_unref (priv->point_list);
   g_hash_table_destroy (priv->points);
 
   G_OBJECT_CLASS (gtk_gesture_parent_class)->finalize (object);
@@ -267,25 +278,20 @@ _gtk_gesture_get_n_touch_points (GtkGesture *gesture,
                                  gboolean    only_active)
 {
   GtkGesturePrivate *priv;
-  GHashTableIter iter;
   guint n_points = 0;
-  PointData *data;
-  GdkEventType event_type;
+  guint i;
 
   priv = gtk_gesture_get_instance_private (gesture);
-  g_hash_table_iter_init (&iter, priv->points);
 
-  while (g_hash_table_iter_next (&iter, NULL, (gpointer *) &data))
-    {
-      event_type = gdk_event_get_event_type (data->event);
+  if (!only_active)
+    return priv->point_list->len;
 
-      if (only_active &&
-          (data->state == GTK_EVENT_SEQUENCE_DENIED ||
-           event_type == GDK_TOUCH_END ||
-           event_type == GDK_BUTTON_RELEASE))
-        continue;
+  for (i = 0; i < priv->point_list->len; i++)
+    {
+      PointData *data = g_ptr_array_index (priv->point_list, i);
 
-      n_points++;
+      if (POINT_IS_ACTIVE (data))
+        n_points++;
     }
 
   return n_points;
@@ -521,7 +527,9 @@ _gtk_gesture_update_point (GtkGesture     *gesture,
         }
 
       data = g_new0 (PointData, 1);
+      data->sequence = sequence;
       g_hash_table_insert (priv->points, sequence, data);
+      g_ptr_array_add (priv->point_list, data);
 
       group_state = gtk_gesture_get_group_state (gesture, sequence);
       gtk_gesture_set_sequence_state (gesture, sequence, group_state);
@@ -531,8 +539,11 @@ _gtk_gesture_update_point (GtkGesture     *gesture,
     g_object_unref (data->event);
 
   data->event = g_object_ref ((gpointer) event);
+  data->ended = (gdk_event_get_event_type (event) == GDK_TOUCH_END ||
+                 gdk_event_get_event_type (event) == GDK_BUTTON_RELEASE);
   _update_touchpad_deltas (data);
   _update_widget_coordinates (gesture, data);
+  priv->bounding_box_valid = FALSE;
 
   /* Deny the sequence right away if the expected
    * number of points is exceeded, so this sequence
@@ -559,6 +570,17 @@ _gtk_gesture_check_empty (GtkGesture *gesture)
     }
 }
 
+static void
+_gtk_gesture_forget_point (GtkGesture *gesture,
+                           PointData  *data)
+{
+  GtkGesturePrivate *priv;
+
+  priv = gtk_gesture_get_instance_private (gesture);
+  g_ptr_array_remove (priv->point_list, data);
+  priv->bounding_box_valid = FALSE;
+}
+
 static void
 _gtk_gesture_remove_point (GtkGesture     *gesture,
                            const GdkEvent *event)
@@ -566,6 +588,7 @@ _gtk_gesture_remove_point (GtkGesture     *gesture,
   GdkEventSequence *sequence;
   GtkGesturePrivate *priv;
   GdkDevice *device;
+  PointData *data;
 
   sequence = gdk_event_get_event_sequence (event);
   device = gdk_event_get_device (event);
@@ -574,6 +597,10 @@ _gtk_gesture_remove_point (GtkGesture     *gesture,
   if (priv->device != device)
     return;
 
+  data = g_hash_table_lookup (priv->points, sequence);
+  if (data)
+    _gtk_gesture_forget_point (gesture, data);
+
   g_hash_table_remove (priv->points, sequence);
   _gtk_gesture_check_empty (gesture);
 }
@@ -584,13 +611,15 @@ _gtk_gesture_cancel_all (GtkGesture *gesture)
   GdkEventSequence *sequence;
   GtkGesturePrivate *priv;
   GHashTableIter iter;
+  PointData *data;
 
   priv = gtk_gesture_get_instance_private (gesture);
   g_hash_table_iter_init (&iter, priv->points);
 
-  while (g_hash_table_iter_next (&iter, (gpointer*) &sequence, NULL))
+  while (g_hash_table_iter_next (&iter, (gpointer*) &sequence, (gpointer*) &data))
     {
       g_signal_emit (gesture, signals[CANCEL], 0, sequence);
+      _gtk_gesture_forget_point (gesture, data);
       g_hash_table_iter_remove (&iter);
       _gtk_gesture_check_recognized (gesture, sequence);
     }
@@ -911,6 +940,7 @@ gtk_gesture_init (GtkGesture *gesture)
   priv = gtk_gesture_get_instance_private (gesture);
   priv->points = g_hash_table_new_full (NULL, NULL, NULL,
                                         (GDestroyNotify) free_point_data);
+  priv->point_list = g_ptr_array_new ();
   priv->group_link = g_list_prepend (NULL, gesture);
 }
 
@@ -1046,6 +1076,7 @@ gtk_gesture_set_sequence_state (GtkGesture            *gesture,
     return FALSE;
 
   data->state = state;
+  priv->bounding_box_valid = FALSE;
   gtk_widget_cancel_event_sequence (gtk_event_controller_get_widget (GTK_EVENT_CONTROLLER (gesture)),
                                     gesture, sequence, state);
   g_signal_emit (gesture, signals[SEQUENCE_STATE_CHANGED], 0,
@@ -1082,6 +1113,7 @@ gtk_gesture_set_state (GtkGesture            *gesture,
                         state <= GTK_EVENT_SEQUENCE_DENIED, FALSE);
 
   priv = gtk_gesture_get_instance_private (gesture);
+  /* Handlers may remove points, so don't walk the point list */
   sequences = g_hash_table_get_keys (priv->points);
 
   for (l = sequences; l; l = l->next)
@@ -1107,30 +1139,20 @@ gtk_gesture_set_state (GtkGesture            *gesture,
 GList *
 gtk_gesture_get_sequences (GtkGesture *gesture)
 {
-  GdkEventSequence *sequence;
   GtkGesturePrivate *priv;
   GList *sequences = NULL;
-  GHashTableIter iter;
-  PointData *data;
-  GdkEventType event_type;
+  guint i;
 
   g_return_val_if_fail (GTK_IS_GESTURE (gesture), NULL);
 
   priv = gtk_gesture_get_instance_private (gesture);
-  g_hash_table_iter_init (&iter, priv->points);
 
-  while (g_hash_table_iter_next (&iter, (gpointer *) &sequence, (gpointer *) &data))
+  for (i = priv->point_list->len; i > 0; i--)
     {
-      if (data->state == GTK_EVENT_SEQUENCE_DENIED)
-        continue;
-
-      event_type = gdk_event_get_event_type (data->event);
-
-      if (event_type == GDK_TOUCH_END ||
-          event_type == GDK_BUTTON_RELEASE)
-        continue;
+      PointData *data = g_ptr_array_index (priv->point_list, i - 1);
 
-      sequences = g_list_prepend (sequences, sequence);
+      if (POINT_IS_ACTIVE (data))
+        sequences = g_list_prepend (sequences, data->sequence);
     }
 
   return sequences;
@@ -1248,6 +1270,51 @@ _gtk_gesture_get_last_update_time (GtkGesture       *gesture,
   return TRUE;
 };
 
+/*
+ * _gtk_gesture_get_active_points:
+ * @gesture: a #GtkGesture
+ * @points: (out caller-allocates) (array length=n_points): return location
+ *     for the points
+ * @n_points: the number of elements in @points
+ *
+ * Fills in @points with the active points of @gesture, in the order
+ * they were pressed. This is what gtk_gesture_get_sequences() followed
+ * by gtk_gesture_get_point() would return, without allocating a list
+ * on every update.
+ *
+ * Returns: the number of active points, which may be larger than @n_points
+ */
+guint
+_gtk_gesture_get_active_points (GtkGesture       *gesture,
+                                GtkGesturePoint  *points,
+                                guint             n_points)
+{
+  GtkGesturePrivate *priv;
+  guint i, n_active = 0;
+
+  priv = gtk_gesture_get_instance_private (gesture);
+
+  for (i = 0; i < priv->point_list->len; i++)
+    {
+      PointData *data = g_ptr_array_index (priv->point_list, i);
+
+      if (!POINT_IS_ACTIVE (data))
+        continue;
+
+      if (n_active < n_points)
+        {
+          points[n_active].sequence = data->sequence;
+          points[n_active].event = data->event;
+          points[n_active].x = data->widget_x;
+          points[n_active].y = data->widget_y;
+        }
+
+      n_active++;
+    }
+
+  return n_active;
+}
+
 /**
  * gtk_gesture_get_bounding_box:
  * @gesture: a #GtkGesture
@@ -1272,31 +1339,30 @@ gtk_gesture_get_bounding_box (GtkGesture   *gesture,
 {
   GtkGesturePrivate *priv;
   gdouble x1, y1, x2, y2;
-  GHashTableIter iter;
   guint n_points = 0;
-  PointData *data;
-  GdkEventType event_type;
+  guint i;
 
   g_return_val_if_fail (GTK_IS_GESTURE (gesture), FALSE);
   g_return_val_if_fail (rect != NULL, FALSE);
 
   priv = gtk_gesture_get_instance_private (gesture);
+
+  /* Zoom and rotate handlers ask for it on every update */
+  if (priv->bounding_box_valid)
+    {
+      *rect = priv->bounding_box;
+      return rect->width >= 0;
+    }
+
   x1 = y1 = G_MAXDOUBLE;
   x2 = y2 = -G_MAXDOUBLE;
 
-  g_hash_table_iter_init (&iter, priv->points);
-
-  while (g_hash_table_iter_next (&iter, NULL, (gpointer *) &data))
+  for (i = 0; i < priv->point_list->len; i++)
     {
+      PointData *data = g_ptr_array_index (priv->point_list, i);
       gdouble x, y;
 
-      if (data->state == GTK_EVENT_SEQUENCE_DENIED)
-        continue;
-
-      event_type = gdk_event_get_event_type (data->event);
-
-      if (event_type == GDK_TOUCH_END ||
-          event_type == GDK_BUTTON_RELEASE)
+      if (!POINT_IS_ACTIVE (data))
         continue;
 
       gdk_event_get_coords (data->event, &x, &y);
@@ -1307,13 +1373,20 @@ gtk_gesture_get_bounding_box (GtkGesture   *gesture,
       y2 = MAX (y2, y);
     }
 
+  priv->bounding_box_valid = TRUE;
+
   if (n_points == 0)
-    return FALSE;
+    {
+      /* A negative width caches the lack of active touches */
+      priv->bounding_box.width = -1;
+      return FALSE;
+    }
 
-  rect->x = x1;
-  rect->y = y1;
-  rect->width = x2 - x1;
-  rect->height = y2 - y1;
+  priv->bounding_box.x = x1;
+  priv->bounding_box.y = y1;
+  priv->bounding_box.width = x2 - x1;
+  priv->bounding_box.height = y2 - y1;
+  *rect = priv->bounding_box;
 
   return TRUE;
 }
@@ -40,6 +40,7 @@
 #include "gtkdnd.h"
 #include "gtkprivate.h"
 #include "gtkintl.h"
+#include "gtksettingsprivate.h"
 
 typedef struct _GtkGestureLongPressPrivate GtkGestureLongPressPrivate;
 
@@ -134,9 +135,7 @@ gtk_gesture_long_press_begin (GtkGesture       *gesture,
     return;
 
   widget = gtk_event_controller_get_widget (GTK_EVENT_CONTROLLER (gesture));
-  g_object_get (gtk_widget_get_settings (widget),
-                "gtk-long-press-time", &delay,
-                NULL);
+  delay = gtk_settings_get_values (gtk_widget_get_settings (widget))->long_press_time;
 
   delay = (gint)(priv->delay_factor * delay);
 
@@ -40,6 +40,7 @@
 #include "gtkgesturemultipressprivate.h"
 #include "gtkprivate.h"
 #include "gtkintl.h"
+#include "gtksettingsprivate.h"
 
 typedef struct _GtkGestureMultiPressPrivate GtkGestureMultiPressPrivate;
 
@@ -149,7 +150,7 @@ _gtk_gesture_multi_press_update_timeout (GtkGestureMultiPress *gesture)
 
   widget = gtk_event_controller_get_widget (GTK_EVENT_CONTROLLER (gesture));
   settings = gtk_widget_get_settings (widget);
-  g_object_get (settings, "gtk-double-click-time", &double_click_time, NULL);
+  double_click_time = gtk_settings_get_values (settings)->double_click_time;
 
   priv->double_click_timeout_id = g_timeout_add (double_click_time, _double_click_timeout_cb, gesture);
   g_source_set_name_by_id (priv->double_click_timeout_id, "[gtk] _double_click_timeout_cb");
@@ -172,9 +173,7 @@ _gtk_gesture_multi_press_check_within_threshold (GtkGestureMultiPress *gesture,
 
   widget = gtk_event_controller_get_widget (GTK_EVENT_CONTROLLER (gesture));
   settings = gtk_widget_get_settings (widget);
-  g_object_get (settings,
-                "gtk-double-click-distance", &double_click_distance,
-                NULL);
+  double_click_distance = gtk_settings_get_values (settings)->double_click_distance;
 
   if (ABS (priv->initial_press_x - x) < double_click_distance &&
       ABS (priv->initial_press_y - y) < double_click_distance)
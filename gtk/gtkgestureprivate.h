@@ -54,6 +54,16 @@ struct _GtkGestureClass
 
 G_BEGIN_DECLS
 
+typedef struct _GtkGesturePoint GtkGesturePoint;
+
+struct _GtkGesturePoint
+{
+  GdkEventSequence *sequence;
+  const GdkEvent *event;
+  gdouble x;
+  gdouble y;
+};
+
 gboolean _gtk_gesture_check                  (GtkGesture       *gesture);
 
 gboolean _gtk_gesture_handled_sequence_press (GtkGesture       *gesture,
@@ -70,6 +80,10 @@ gboolean _gtk_gesture_get_last_update_time   (GtkGesture       *gesture,
                                               GdkEventSequence *sequence,
                                               guint32          *evtime);
 
+guint    _gtk_gesture_get_active_points      (GtkGesture       *gesture,
+                                              GtkGesturePoint  *points,
+                                              guint             n_points);
+
 G_END_DECLS
 
 #endif /* __GTK_GESTURE_PRIVATE_H__ */
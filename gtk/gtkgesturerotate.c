@@ -78,11 +78,10 @@ _gtk_gesture_rotate_get_angle (GtkGestureRotate *rotate,
                                gdouble          *angle)
 {
   GtkGestureRotatePrivate *priv;
-  const GdkEvent *last_event;
-  gdouble x1, y1, x2, y2;
+  GtkGesturePoint points[2];
   GtkGesture *gesture;
   gdouble dx, dy;
-  GList *sequences;
+  guint n_points;
   GdkTouchpadGesturePhase phase;
 
   gesture = GTK_GESTURE (rotate);
@@ -91,15 +90,13 @@ _gtk_gesture_rotate_get_angle (GtkGestureRotate *rotate,
   if (!gtk_gesture_is_recognized (gesture))
     return FALSE;
 
-  sequences = gtk_gesture_get_sequences (gesture);
-  if (!sequences)
+  n_points = _gtk_gesture_get_active_points (gesture, points, G_N_ELEMENTS (points));
+  if (n_points == 0)
     return FALSE;
 
-  last_event = gtk_gesture_get_last_event (gesture, sequences->data);
+  gdk_event_get_touchpad_gesture_phase (points[0].event, &phase);
 
-  gdk_event_get_touchpad_gesture_phase (last_event, &phase);
-
-  if (gdk_event_get_event_type (last_event) == GDK_TOUCHPAD_PINCH &&
+  if (gdk_event_get_event_type (points[0].event) == GDK_TOUCHPAD_PINCH &&
       (phase == GDK_TOUCHPAD_GESTURE_PHASE_BEGIN ||
        phase == GDK_TOUCHPAD_GESTURE_PHASE_UPDATE ||
        phase == GDK_TOUCHPAD_GESTURE_PHASE_END))
@@ -108,15 +105,11 @@ _gtk_gesture_rotate_get_angle (GtkGestureRotate *rotate,
     }
   else
     {
-      if (!sequences->next)
+      if (n_points < 2)
         return FALSE;
 
-      gtk_gesture_get_point (gesture, sequences->data, &x1, &y1);
-      gtk_gesture_get_point (gesture, sequences->next->data, &x2, &y2);
-      g_list_free (sequences);
-
-      dx = x1 - x2;
-      dy = y1 - y2;
+      dx = points[0].x - points[1].x;
+      dy = points[0].y - points[1].y;
 
       *angle = atan2 (dx, dy);
 
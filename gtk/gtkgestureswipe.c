@@ -43,6 +43,7 @@
 #include "gtkintl.h"
 
 #define CAPTURE_THRESHOLD_MS 150
+#define MIN_BACKLOG_SIZE 32
 
 typedef struct _GtkGestureSwipePrivate GtkGestureSwipePrivate;
 typedef struct _EventData EventData;
@@ -54,11 +55,19 @@ struct _EventData
   int y;
 };
 
+/* The events of the last CAPTURE_THRESHOLD_MS, in a ring buffer that
+ * only grows, so that motion events don't allocate or move memory.
+ */
 struct _GtkGestureSwipePrivate
 {
-  GArray *events;
+  EventData *events;
+  guint n_allocated;
+  guint first;
+  guint n_events;
 };
 
+#define EVENT_AT(priv,i) (&(priv)->events[((priv)->first + (i)) % (priv)->n_allocated])
+
 enum {
   SWIPE,
   N_SIGNALS
@@ -74,7 +83,7 @@ gtk_gesture_swipe_finalize (GObject *object)
   GtkGestureSwipePrivate *priv;
 
   priv = gtk_gesture_swipe_get_instance_private (GTK_GESTURE_SWIPE (object));
-  g_array_free (priv->events, TRUE);
+  g_free (priv->events);
 
   G_OBJECT_CLASS (gtk_gesture_swipe_parent_class)->finalize (object);
 }
@@ -111,11 +120,11 @@ _gtk_gesture_swipe_clear_backlog (GtkGestureSwipe *gesture,
 
   priv = gtk_gesture_swipe_get_instance_private (gesture);
 
-  for (i = 0; i < (gint) priv->events->len; i++)
+  for (i = 0; i < (gint) priv->n_events; i++)
     {
       EventData *data;
 
-      data = &g_array_index (priv->events, EventData, i);
+      data = EVENT_AT (priv, i);
 
       if (data->evtime >= evtime - CAPTURE_THRESHOLD_MS)
         {
@@ -125,7 +134,39 @@ _gtk_gesture_swipe_clear_backlog (GtkGestureSwipe *gesture,
     }
 
   if (length > 0)
-    g_array_remove_range (priv->events, 0, length);
+    {
+      priv->first = (priv->first + length) % priv->n_allocated;
+      priv->n_events -= length;
+    }
+}
+
+static void
+_gtk_gesture_swipe_append_event (GtkGestureSwipe *gesture,
+                                 const EventData *data)
+{
+  GtkGestureSwipePrivate *priv;
+
+  priv = gtk_gesture_swipe_get_instance_private (gesture);
+
+  if (priv->n_events == priv->n_allocated)
+    {
+      EventData *events;
+      guint i, n_allocated;
+
+      n_allocated = MAX (priv->n_allocated * 2, MIN_BACKLOG_SIZE);
+      events = g_new (EventData, n_allocated);
+
+      for (i = 0; i < priv->n_events; i++)
+        events[i] = *EVENT_AT (priv, i);
+
+      g_free (priv->events);
+      priv->events = events;
+      priv->n_allocated = n_allocated;
+      priv->first = 0;
+    }
+
+  priv->n_events++;
+  *EVENT_AT (priv, priv->n_events - 1) = *data;
 }
 
 static void
@@ -133,11 +174,9 @@ gtk_gesture_swipe_update (GtkGesture       *gesture,
                           GdkEventSequence *sequence)
 {
   GtkGestureSwipe *swipe = GTK_GESTURE_SWIPE (gesture);
-  GtkGestureSwipePrivate *priv;
   EventData new;
   gdouble x, y;
 
-  priv = gtk_gesture_swipe_get_instance_private (swipe);
   _gtk_gesture_get_last_update_time (gesture, sequence, &new.evtime);
   gtk_gesture_get_point (gesture, sequence, &x, &y);
 
@@ -145,7 +184,7 @@ gtk_gesture_swipe_update (GtkGesture       *gesture,
   new.y = y;
 
   _gtk_gesture_swipe_clear_backlog (swipe, new.evtime);
-  g_array_append_val (priv->events, new);
+  _gtk_gesture_swipe_append_event (swipe, &new);
 }
 
 static void
@@ -166,11 +205,11 @@ _gtk_gesture_swipe_calculate_velocity (GtkGestureSwipe *gesture,
   _gtk_gesture_get_last_update_time (GTK_GESTURE (gesture), sequence, &evtime);
   _gtk_gesture_swipe_clear_backlog (gesture, evtime);
 
-  if (priv->events->len == 0)
+  if (priv->n_events == 0)
     return;
 
-  start = &g_array_index (priv->events, EventData, 0);
-  end = &g_array_index (priv->events, EventData, priv->events->len - 1);
+  start = EVENT_AT (priv, 0);
+  end = EVENT_AT (priv, priv->n_events - 1);
 
   diff_time = end->evtime - start->evtime;
   diff_x = end->x - start->x;
@@ -205,8 +244,8 @@ gtk_gesture_swipe_end (GtkGesture       *gesture,
   _gtk_gesture_swipe_calculate_velocity (swipe, &velocity_x, &velocity_y);
   g_signal_emit (gesture, signals[SWIPE], 0, velocity_x, velocity_y);
 
-  if (priv->events->len > 0)
-    g_array_remove_range (priv->events, 0, priv->events->len);
+  priv->first = 0;
+  priv->n_events = 0;
 }
 
 static void
@@ -244,10 +283,6 @@ gtk_gesture_swipe_class_init (GtkGestureSwipeClass *klass)
 static void
 gtk_gesture_swipe_init (GtkGestureSwipe *gesture)
 {
-  GtkGestureSwipePrivate *priv;
-
-  priv = gtk_gesture_swipe_get_instance_private (gesture);
-  priv->events = g_array_new (FALSE, FALSE, sizeof (EventData));
 }
 
 /**
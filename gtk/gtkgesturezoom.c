@@ -76,27 +76,24 @@ static gboolean
 _gtk_gesture_zoom_get_distance (GtkGestureZoom *zoom,
                                 gdouble        *distance)
 {
-  const GdkEvent *last_event;
-  gdouble x1, y1, x2, y2;
+  GtkGesturePoint points[2];
   GtkGesture *gesture;
-  GList *sequences = NULL;
   gdouble dx, dy;
+  guint n_points;
   GdkTouchpadGesturePhase phase;
-  gboolean retval = FALSE;
 
   gesture = GTK_GESTURE (zoom);
 
   if (!gtk_gesture_is_recognized (gesture))
-    goto out;
+    return FALSE;
 
-  sequences = gtk_gesture_get_sequences (gesture);
-  if (!sequences)
-    goto out;
+  n_points = _gtk_gesture_get_active_points (gesture, points, G_N_ELEMENTS (points));
+  if (n_points == 0)
+    return FALSE;
 
-  last_event = gtk_gesture_get_last_event (gesture, sequences->data);
-  gdk_event_get_touchpad_gesture_phase (last_event, &phase);
+  gdk_event_get_touchpad_gesture_phase (points[0].event, &phase);
 
-  if (gdk_event_get_event_type (last_event) == GDK_TOUCHPAD_PINCH &&
+  if (gdk_event_get_event_type (points[0].event) == GDK_TOUCHPAD_PINCH &&
       (phase == GDK_TOUCHPAD_GESTURE_PHASE_BEGIN ||
        phase == GDK_TOUCHPAD_GESTURE_PHASE_UPDATE ||
        phase == GDK_TOUCHPAD_GESTURE_PHASE_END))
@@ -104,27 +101,20 @@ _gtk_gesture_zoom_get_distance (GtkGestureZoom *zoom,
       double scale;
       /* Touchpad pinch */
 
-      gdk_event_get_touchpad_scale (last_event, &scale);
+      gdk_event_get_touchpad_scale (points[0].event, &scale);
       *distance = scale;
     }
   else
     {
-      if (!sequences->next)
-        goto out;
-
-      gtk_gesture_get_point (gesture, sequences->data, &x1, &y1);
-      gtk_gesture_get_point (gesture, sequences->next->data, &x2, &y2);
+      if (n_points < 2)
+        return FALSE;
 
-      dx = x1 - x2;
-      dy = y1 - y2;;
+      dx = points[0].x - points[1].x;
+      dy = points[0].y - points[1].y;
       *distance = sqrt ((dx * dx) + (dy * dy));
     }
 
-  retval = TRUE;
-
- out:
-  g_list_free (sequences);
-  return retval;
+  return TRUE;
 }
 
 static gboolean
@@ -158,15 +158,20 @@ typedef struct {
   int required_gl_version;
 
   guint frame_buffer;
+  guint read_frame_buffer;
   guint depth_stencil_buffer;
   Texture *texture;
   GList *textures;
+  Texture *last_texture;        /* the last rendered one, we hold a reference to its holder */
+
+  GdkRectangle damage;          /* in device pixels, only if has_damage is set */
 
   gboolean has_depth_buffer;
   gboolean has_stencil_buffer;
 
   gboolean needs_resize;
   gboolean needs_render;
+  gboolean has_damage;          /* only damage needs to be rendered, not everything */
   gboolean auto_render;
   gboolean use_es;
 } GtkGLAreaPrivate;
@@ -472,6 +477,7 @@ gtk_gl_area_allocate_buffers (GtkGLArea *area)
     }
 
   priv->needs_render = TRUE;
+  priv->has_damage = FALSE;
 }
 
 static void
@@ -573,6 +579,12 @@ gtk_gl_area_delete_buffers (GtkGLArea *area)
 
   priv->have_buffers = FALSE;
 
+  if (priv->read_frame_buffer != 0)
+    {
+      glDeleteFramebuffersEXT (1, &priv->read_frame_buffer);
+      priv->read_frame_buffer = 0;
+    }
+
   if (priv->depth_stencil_buffer != 0)
     {
       glDeleteRenderbuffersEXT (1, &priv->depth_stencil_buffer);
@@ -592,6 +604,12 @@ gtk_gl_area_delete_textures (GtkGLArea *area)
 {
   GtkGLAreaPrivate *priv = gtk_gl_area_get_instance_private (area);
 
+  if (priv->last_texture)
+    {
+      g_object_unref (priv->last_texture->holder);
+      priv->last_texture = NULL;
+    }
+
   if (priv->texture)
     {
       delete_one_texture (priv->texture);
@@ -675,6 +693,29 @@ release_texture (gpointer data)
   texture->holder = NULL;
 }
 
+/* Starts the new texture with the contents of the last
+ * one, so that only the damaged area needs to be rendered */
+static void
+gtk_gl_area_copy_last_texture (GtkGLArea *area)
+{
+  GtkGLAreaPrivate *priv = gtk_gl_area_get_instance_private (area);
+  Texture *last = priv->last_texture;
+
+  if (priv->read_frame_buffer == 0)
+    glGenFramebuffersEXT (1, &priv->read_frame_buffer);
+
+  glBindFramebufferEXT (GL_READ_FRAMEBUFFER, priv->read_frame_buffer);
+  glFramebufferTexture2D (GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                          GL_TEXTURE_2D, last->id, 0);
+  glBindFramebufferEXT (GL_DRAW_FRAMEBUFFER, priv->frame_buffer);
+
+  glBlitFramebuffer (0, 0, last->width, last->height,
+                     0, 0, last->width, last->height,
+                     GL_COLOR_BUFFER_BIT, GL_NEAREST);
+
+  glBindFramebufferEXT (GL_FRAMEBUFFER_EXT, priv->frame_buffer);
+}
+
 static void
 gtk_gl_area_snapshot (GtkWidget   *widget,
                       GtkSnapshot *snapshot)
@@ -704,6 +745,19 @@ gtk_gl_area_snapshot (GtkWidget   *widget,
   if (priv->context == NULL)
     return;
 
+  /* Nothing changed, show what was rendered last time */
+  if (!priv->needs_render && !priv->auto_render && !priv->needs_resize &&
+      priv->last_texture != NULL &&
+      priv->last_texture->width == w && priv->last_texture->height == h)
+    {
+      gtk_snapshot_append_texture (snapshot,
+                                   priv->last_texture->holder,
+                                   &GRAPHENE_RECT_INIT (0, 0,
+                                                        gtk_widget_get_width (widget),
+                                                        gtk_widget_get_height (widget)));
+      return;
+    }
+
   gtk_gl_area_make_current (area);
 
   gtk_gl_area_attach_buffers (area);
@@ -720,16 +774,37 @@ gtk_gl_area_snapshot (GtkWidget   *widget,
 
       if (priv->needs_render || priv->auto_render)
         {
+          gboolean partial;
+
+          partial = priv->has_damage &&
+                    !priv->auto_render &&
+                    !priv->needs_resize &&
+                    priv->last_texture != NULL &&
+                    priv->last_texture->width == w &&
+                    priv->last_texture->height == h;
+
           if (priv->needs_resize)
             {
               g_signal_emit (area, area_signals[RESIZE], 0, w, h, NULL);
               priv->needs_resize = FALSE;
             }
 
+          if (partial)
+            {
+              gtk_gl_area_copy_last_texture (area);
+              glEnable (GL_SCISSOR_TEST);
+              glScissor (priv->damage.x, h - priv->damage.y - priv->damage.height,
+                         priv->damage.width, priv->damage.height);
+            }
+
           g_signal_emit (area, area_signals[RENDER], 0, priv->context, &unused);
+
+          if (partial)
+            glDisable (GL_SCISSOR_TEST);
         }
 
       priv->needs_render = FALSE;
+      priv->has_damage = FALSE;
 
       texture = priv->texture;
       priv->texture = NULL;
@@ -747,7 +822,11 @@ gtk_gl_area_snapshot (GtkWidget   *widget,
                                                         gtk_widget_get_width (widget),
                                                         gtk_widget_get_height (widget)));
 
-      g_object_unref (texture->holder);
+      /* Keep it to draw again if nothing changes, and to
+       * copy from if only part of it needs to be rendered */
+      if (priv->last_texture)
+        g_object_unref (priv->last_texture->holder);
+      priv->last_texture = texture;
     }
   else
     {
@@ -1226,6 +1305,56 @@ gtk_gl_area_queue_render (GtkGLArea *area)
 
   g_return_if_fail (GTK_IS_GL_AREA (area));
 
+  priv->needs_render = TRUE;
+  priv->has_damage = FALSE;
+
+  gtk_widget_queue_draw (GTK_WIDGET (area));
+}
+
+/**
+ * gtk_gl_area_queue_render_rect:
+ * @area: a #GtkGLArea
+ * @rect: the part of @area that needs to be rendered again
+ *
+ * Like gtk_gl_area_queue_render(), but only the contents of @rect
+ * are marked as invalid.
+ *
+ * When the #GtkGLArea::render signal is emitted next, the framebuffer
+ * already contains what was rendered before, and the scissor test is
+ * enabled to limit rendering to the invalid part, so drawing only what
+ * is in that area is enough. If the area was resized or everything is
+ * invalid, the whole framebuffer has to be rendered as usual, and the
+ * scissor test is not enabled.
+ *
+ * Like gtk_gl_area_queue_render(), this is only useful when
+ * gtk_gl_area_set_auto_render() has been called with a %FALSE value.
+ */
+void
+gtk_gl_area_queue_render_rect (GtkGLArea          *area,
+                               const GdkRectangle *rect)
+{
+  GtkGLAreaPrivate *priv = gtk_gl_area_get_instance_private (area);
+  GdkRectangle damage;
+  int scale;
+
+  g_return_if_fail (GTK_IS_GL_AREA (area));
+  g_return_if_fail (rect != NULL);
+
+  scale = gtk_widget_get_scale_factor (GTK_WIDGET (area));
+  damage.x = rect->x * scale;
+  damage.y = rect->y * scale;
+  damage.width = rect->width * scale;
+  damage.height = rect->height * scale;
+
+  if (priv->has_damage)
+    gdk_rectangle_union (&priv->damage, &damage, &priv->damage);
+  else if (!priv->needs_render)
+    {
+      priv->damage = damage;
+      priv->has_damage = TRUE;
+    }
+  /* else everything is invalid already */
+
   priv->needs_render = TRUE;
 
   gtk_widget_queue_draw (GTK_WIDGET (area));
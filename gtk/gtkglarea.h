@@ -111,6 +111,9 @@ void            gtk_gl_area_set_auto_render             (GtkGLArea    *area,
                                                          gboolean      auto_render);
 GDK_AVAILABLE_IN_ALL
 void           gtk_gl_area_queue_render                 (GtkGLArea    *area);
+GDK_AVAILABLE_IN_ALL
+void            gtk_gl_area_queue_render_rect           (GtkGLArea          *area,
+                                                         const GdkRectangle *rect);
 
 
 GDK_AVAILABLE_IN_ALL
@@ -84,6 +84,13 @@ static const GtkGridRowProperties gtk_grid_row_properties_default = {
 struct _GtkGridChild
 {
   GtkGridChildAttach attach[2];
+
+  /* One bit per orientation whose cached line requests
+   * don't include the current size of the child yet
+   */
+  guint dirty   : 2;
+  /* Visibility the cached line requests account for */
+  guint visible : 1;
 };
 
 #define CHILD_LEFT(child)    ((child)->attach[GTK_ORIENTATION_HORIZONTAL].pos)
@@ -108,6 +115,15 @@ struct _GtkGridPrivate
   gint baseline_row;
 
   GtkGridLineData linedata[2];
+
+  /* Line requests of the non-spanning children, measured without
+   * context, kept across size requests so that only the lines of
+   * children that queued a resize need to be measured again.
+   */
+  GtkGridLine *cached_lines[2];
+  gint cached_min[2];
+  gint cached_max[2];
+  guint cached_lines_valid : 2;
 };
 typedef struct _GtkGridPrivate GtkGridPrivate;
 
@@ -285,6 +301,24 @@ get_grid_child (GtkWidget *widget)
   return (GtkGridChild *) g_object_get_qdata (G_OBJECT (widget), child_data_quark);
 }
 
+static void
+gtk_grid_invalidate_lines (GtkGrid *grid)
+{
+  GtkGridPrivate *priv = gtk_grid_get_instance_private (grid);
+
+  priv->cached_lines_valid = 0;
+}
+
+static void
+gtk_grid_child_resize (GtkWidget *widget,
+                       GtkWidget *child)
+{
+  GtkGridChild *grid_child = get_grid_child (child);
+
+  if (grid_child)
+    grid_child->dirty = 3;
+}
+
 static void
 gtk_grid_get_child_property (GtkContainer *container,
                              GtkWidget    *child,
@@ -367,6 +401,8 @@ gtk_grid_set_child_property (GtkContainer *container,
       break;
     }
 
+  gtk_grid_invalidate_lines (grid);
+
   if (_gtk_widget_get_visible (child) &&
       _gtk_widget_get_visible (GTK_WIDGET (grid)))
     gtk_widget_queue_resize (child);
@@ -379,6 +415,8 @@ gtk_grid_finalize (GObject *object)
   GtkGridPrivate *priv = gtk_grid_get_instance_private (grid);
 
   g_list_free_full (priv->row_properties, (GDestroyNotify)gtk_grid_row_properties_free);
+  g_free (priv->cached_lines[0]);
+  g_free (priv->cached_lines[1]);
 
   G_OBJECT_CLASS (gtk_grid_parent_class)->finalize (object);
 }
@@ -398,6 +436,9 @@ grid_attach (GtkGrid   *grid,
   CHILD_TOP (child) = top;
   CHILD_WIDTH (child) = width;
   CHILD_HEIGHT (child) = height;
+  /* picked up as a visibility change by the next size request */
+  child->dirty = 0;
+  child->visible = FALSE;
 
   g_object_set_qdata_full (G_OBJECT (widget), child_data_quark, child, g_free);
 
@@ -479,6 +520,7 @@ gtk_grid_remove (GtkContainer *container,
 
   was_visible = _gtk_widget_get_visible (child);
   gtk_widget_unparent (child);
+  gtk_grid_invalidate_lines (grid);
 
   if (was_visible && _gtk_widget_get_visible (GTK_WIDGET (grid)))
     gtk_widget_queue_resize (GTK_WIDGET (grid));
@@ -556,6 +598,19 @@ gtk_grid_request_count_lines (GtkGridRequest *request)
   request->lines[1].max = max[1];
 }
 
+static void
+gtk_grid_line_init (GtkGridLine *line)
+{
+  line->minimum = 0;
+  line->natural = 0;
+  line->minimum_above = -1;
+  line->minimum_below = -1;
+  line->natural_above = -1;
+  line->natural_below = -1;
+  line->expand = FALSE;
+  line->empty = TRUE;
+}
+
 /* Sets line sizes to 0 and marks lines as expand
  * if they have a non-spanning expanding child.
  */
@@ -571,16 +626,7 @@ gtk_grid_request_init (GtkGridRequest *request,
   lines = &request->lines[orientation];
 
   for (i = 0; i < lines->max - lines->min; i++)
-    {
-      lines->lines[i].minimum = 0;
-      lines->lines[i].natural = 0;
-      lines->lines[i].minimum_above = -1;
-      lines->lines[i].minimum_below = -1;
-      lines->lines[i].natural_above = -1;
-      lines->lines[i].natural_below = -1;
-      lines->lines[i].expand = FALSE;
-      lines->lines[i].empty = TRUE;
-    }
+    gtk_grid_line_init (&lines->lines[i]);
 
 
   for (child = gtk_widget_get_first_child (GTK_WIDGET (request->grid));
@@ -659,6 +705,70 @@ compute_request_for_child (GtkGridRequest *request,
     }
 }
 
+static void
+gtk_grid_line_add_request (GtkGridLine *line,
+                           gint         minimum,
+                           gint         natural,
+                           gint         minimum_baseline,
+                           gint         natural_baseline)
+{
+  if (minimum_baseline != -1)
+    {
+      line->minimum_above = MAX (line->minimum_above, minimum_baseline);
+      line->minimum_below = MAX (line->minimum_below, minimum - minimum_baseline);
+      line->natural_above = MAX (line->natural_above, natural_baseline);
+      line->natural_below = MAX (line->natural_below, natural - natural_baseline);
+    }
+  else
+    {
+      line->minimum = MAX (line->minimum, minimum);
+      line->natural = MAX (line->natural, natural);
+    }
+}
+
+/* Folds the baseline aligned requests of a line into
+ * its size, once all its children have been added.
+ */
+static void
+gtk_grid_line_finish_request (GtkGrid     *grid,
+                              GtkGridLine *line,
+                              gint         pos)
+{
+  GtkBaselinePosition baseline_pos;
+
+  if (line->minimum_above == -1)
+    return;
+
+  line->minimum = MAX (line->minimum, line->minimum_above + line->minimum_below);
+  line->natural = MAX (line->natural, line->natural_above + line->natural_below);
+
+  baseline_pos = gtk_grid_get_row_baseline_position (grid, pos);
+
+  switch (baseline_pos)
+    {
+    case GTK_BASELINE_POSITION_TOP:
+      line->minimum_above += 0;
+      line->minimum_below += line->minimum - (line->minimum_above + line->minimum_below);
+      line->natural_above += 0;
+      line->natural_below += line->natural - (line->natural_above + line->natural_below);
+      break;
+    case GTK_BASELINE_POSITION_CENTER:
+      line->minimum_above += (line->minimum - (line->minimum_above + line->minimum_below))/2;
+      line->minimum_below += (line->minimum - (line->minimum_above + line->minimum_below))/2;
+      line->natural_above += (line->natural - (line->natural_above + line->natural_below))/2;
+      line->natural_below += (line->natural - (line->natural_above + line->natural_below))/2;
+      break;
+    case GTK_BASELINE_POSITION_BOTTOM:
+      line->minimum_above += line->minimum - (line->minimum_above + line->minimum_below);
+      line->minimum_below += 0;
+      line->natural_above += line->natural - (line->natural_above + line->natural_below);
+      line->natural_below += 0;
+      break;
+    default:
+      break;
+    }
+}
+
 /* Sets requisition to max. of non-spanning children.
  * If contextual is TRUE, requires allocations of
  * lines in the opposite orientation to be set.
@@ -671,9 +781,7 @@ gtk_grid_request_non_spanning (GtkGridRequest *request,
   GtkWidget *child;
   GtkGridChildAttach *attach;
   GtkGridLines *lines;
-  GtkGridLine *line;
   gint i;
-  GtkBaselinePosition baseline_pos;
   gint minimum, minimum_baseline;
   gint natural, natural_baseline;
 
@@ -694,58 +802,143 @@ gtk_grid_request_non_spanning (GtkGridRequest *request,
 
       compute_request_for_child (request, child, grid_child, orientation, contextual, &minimum, &natural, &minimum_baseline, &natural_baseline);
 
-      line = &lines->lines[attach->pos - lines->min];
-
-      if (minimum_baseline != -1)
-	{
-	  line->minimum_above = MAX (line->minimum_above, minimum_baseline);
-	  line->minimum_below = MAX (line->minimum_below, minimum - minimum_baseline);
-	  line->natural_above = MAX (line->natural_above, natural_baseline);
-	  line->natural_below = MAX (line->natural_below, natural - natural_baseline);
-	}
-      else
-	{
-	  line->minimum = MAX (line->minimum, minimum);
-	  line->natural = MAX (line->natural, natural);
-	}
+      gtk_grid_line_add_request (&lines->lines[attach->pos - lines->min],
+                                 minimum, natural,
+                                 minimum_baseline, natural_baseline);
     }
 
   for (i = 0; i < lines->max - lines->min; i++)
+    gtk_grid_line_finish_request (request->grid, &lines->lines[i], i + lines->min);
+}
+
+/* Like gtk_grid_request_init() followed by a non-contextual
+ * gtk_grid_request_non_spanning(), but keeps the result around
+ * between calls. Children that queued a resize or changed their
+ * visibility since then mark their line as dirty, and only the
+ * children in dirty lines get measured again.
+ */
+static void
+gtk_grid_request_non_spanning_cached (GtkGridRequest *request,
+                                      GtkOrientation  orientation)
+{
+  GtkGridPrivate *priv = gtk_grid_get_instance_private (request->grid);
+  GtkWidget *child;
+  GtkGridChildAttach *attach;
+  GtkGridLines *lines;
+  GtkGridLine *cached;
+  gboolean *dirty_lines;
+  gboolean any_dirty;
+  gint minimum, minimum_baseline;
+  gint natural, natural_baseline;
+  gint n_lines;
+  gint i;
+
+  lines = &request->lines[orientation];
+  n_lines = lines->max - lines->min;
+
+  if ((priv->cached_lines_valid & (1 << orientation)) == 0 ||
+      priv->cached_min[orientation] != lines->min ||
+      priv->cached_max[orientation] != lines->max)
     {
-      line = &lines->lines[i];
+      for (child = gtk_widget_get_first_child (GTK_WIDGET (request->grid));
+           child != NULL;
+           child = gtk_widget_get_next_sibling (child))
+        {
+          GtkGridChild *grid_child = get_grid_child (child);
 
-      if (line->minimum_above != -1)
-	{
-	  line->minimum = MAX (line->minimum, line->minimum_above + line->minimum_below);
-	  line->natural = MAX (line->natural, line->natural_above + line->natural_below);
+          if (grid_child->visible != _gtk_widget_get_visible (child))
+            {
+              grid_child->visible = _gtk_widget_get_visible (child);
+              grid_child->dirty = 3;
+            }
+          grid_child->dirty &= ~(1 << orientation);
+        }
 
-	  baseline_pos = gtk_grid_get_row_baseline_position (request->grid, i + lines->min);
+      gtk_grid_request_init (request, orientation);
+      gtk_grid_request_non_spanning (request, orientation, FALSE);
 
-	  switch (baseline_pos)
-	    {
-	    case GTK_BASELINE_POSITION_TOP:
-	      line->minimum_above += 0;
-	      line->minimum_below += line->minimum - (line->minimum_above + line->minimum_below);
-	      line->natural_above += 0;
-	      line->natural_below += line->natural - (line->natural_above + line->natural_below);
-	      break;
-	    case GTK_BASELINE_POSITION_CENTER:
-	      line->minimum_above += (line->minimum - (line->minimum_above + line->minimum_below))/2;
-	      line->minimum_below += (line->minimum - (line->minimum_above + line->minimum_below))/2;
-	      line->natural_above += (line->natural - (line->natural_above + line->natural_below))/2;
-	      line->natural_below += (line->natural - (line->natural_above + line->natural_below))/2;
-	      break;
-	    case GTK_BASELINE_POSITION_BOTTOM:
-	      line->minimum_above += line->minimum - (line->minimum_above + line->minimum_below);
-	      line->minimum_below += 0;
-	      line->natural_above += line->natural - (line->natural_above + line->natural_below);
-	      line->natural_below += 0;
-	      break;
-            default:
-              break;
-	    }
-	}
+      priv->cached_lines[orientation] = g_renew (GtkGridLine, priv->cached_lines[orientation], n_lines);
+      memcpy (priv->cached_lines[orientation], lines->lines, n_lines * sizeof (GtkGridLine));
+      priv->cached_min[orientation] = lines->min;
+      priv->cached_max[orientation] = lines->max;
+      priv->cached_lines_valid |= 1 << orientation;
+      return;
+    }
+
+  cached = priv->cached_lines[orientation];
+  dirty_lines = g_newa (gboolean, n_lines);
+  memset (dirty_lines, 0, n_lines * sizeof (gboolean));
+  any_dirty = FALSE;
+
+  for (child = gtk_widget_get_first_child (GTK_WIDGET (request->grid));
+       child != NULL;
+       child = gtk_widget_get_next_sibling (child))
+    {
+      GtkGridChild *grid_child = get_grid_child (child);
+
+      /* A child that was resized while hidden, or measured by
+       * someone else since, may not have told us about it.
+       */
+      if (grid_child->visible != _gtk_widget_get_visible (child) ||
+          _gtk_widget_get_resize_needed (child))
+        {
+          grid_child->visible = _gtk_widget_get_visible (child);
+          grid_child->dirty = 3;
+        }
+
+      if ((grid_child->dirty & (1 << orientation)) == 0)
+        continue;
+
+      grid_child->dirty &= ~(1 << orientation);
+
+      /* Spanning children don't contribute here */
+      attach = &grid_child->attach[orientation];
+      if (attach->span == 1)
+        {
+          dirty_lines[attach->pos - lines->min] = TRUE;
+          any_dirty = TRUE;
+        }
     }
+
+  if (any_dirty)
+    {
+      for (i = 0; i < n_lines; i++)
+        {
+          if (dirty_lines[i])
+            gtk_grid_line_init (&cached[i]);
+        }
+
+      for (child = gtk_widget_get_first_child (GTK_WIDGET (request->grid));
+           child != NULL;
+           child = gtk_widget_get_next_sibling (child))
+        {
+          GtkGridChild *grid_child = get_grid_child (child);
+          GtkGridLine *line;
+
+          attach = &grid_child->attach[orientation];
+          if (attach->span != 1 || !dirty_lines[attach->pos - lines->min])
+            continue;
+
+          line = &cached[attach->pos - lines->min];
+
+          if (gtk_widget_compute_expand (child, orientation))
+            line->expand = TRUE;
+
+          if (!_gtk_widget_get_visible (child))
+            continue;
+
+          compute_request_for_child (request, child, grid_child, orientation, FALSE, &minimum, &natural, &minimum_baseline, &natural_baseline);
+          gtk_grid_line_add_request (line, minimum, natural, minimum_baseline, natural_baseline);
+        }
+
+      for (i = 0; i < n_lines; i++)
+        {
+          if (dirty_lines[i])
+            gtk_grid_line_finish_request (request->grid, &cached[i], i + lines->min);
+        }
+    }
+
+  memcpy (lines->lines, cached, n_lines * sizeof (GtkGridLine));
 }
 
 /* Enforce homogeneous sizes.
@@ -1107,8 +1300,14 @@ gtk_grid_request_run (GtkGridRequest *request,
                       GtkOrientation  orientation,
                       gboolean        contextual)
 {
-  gtk_grid_request_init (request, orientation);
-  gtk_grid_request_non_spanning (request, orientation, contextual);
+  if (contextual)
+    {
+      gtk_grid_request_init (request, orientation);
+      gtk_grid_request_non_spanning (request, orientation, TRUE);
+    }
+  else
+    gtk_grid_request_non_spanning_cached (request, orientation);
+
   gtk_grid_request_homogeneous (request, orientation);
   gtk_grid_request_spanning (request, orientation, contextual);
   gtk_grid_request_homogeneous (request, orientation);
@@ -1614,6 +1813,8 @@ gtk_grid_class_init (GtkGridClass *class)
   container_class->set_child_property = gtk_grid_set_child_property;
   container_class->get_child_property = gtk_grid_get_child_property;
 
+  gtk_widget_class_set_child_resize_func (widget_class, gtk_grid_child_resize);
+
   g_object_class_override_property (object_class, PROP_ORIENTATION, "orientation");
 
   obj_properties[PROP_ROW_SPACING] =
@@ -1930,6 +2131,8 @@ gtk_grid_insert_row (GtkGrid *grid,
         }
     }
 
+  gtk_grid_invalidate_lines (grid);
+
   for (list = priv->row_properties; list != NULL; list = list->next)
     {
       GtkGridRowProperties *prop = list->data;
@@ -2029,6 +2232,8 @@ gtk_grid_insert_column (GtkGrid *grid,
                                                child_properties[CHILD_PROP_WIDTH]);
         }
     }
+
+  gtk_grid_invalidate_lines (grid);
 }
 
 /**
@@ -2376,6 +2581,7 @@ gtk_grid_set_row_baseline_position (GtkGrid            *grid,
   if (props->baseline_position != pos)
     {
       props->baseline_position = pos;
+      gtk_grid_invalidate_lines (grid);
 
       if (_gtk_widget_get_visible (GTK_WIDGET (grid)))
         gtk_widget_queue_resize (GTK_WIDGET (grid));
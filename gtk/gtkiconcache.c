@@ -23,6 +23,7 @@
 
 #include <glib/gstdio.h>
 #include <gdk-pixbuf/gdk-pixdata.h>
+#include <gdk/gdk.h>
 
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
@@ -51,8 +52,33 @@ struct _GtkIconCache {
   gchar *buffer;
 
   guint32 last_chain_offset;
+  guint32 last_slot;
+
+  /* The icon index, if the cache has one */
+  guint32 index_offset;
+  guint32 index_mask;
+  guint32 bitmap_offset;
+  guint32 n_bitmap_words;
 };
 
+#define NO_SLOT 0xffffffff
+
+static void
+setup_index (GtkIconCache *cache)
+{
+  guint32 n_slots;
+
+  if (GET_UINT16 (cache->buffer, 2) < ICON_CACHE_INDEX_MINOR_VERSION ||
+      GET_UINT32 (cache->buffer, 4) < 16)
+    return;
+
+  cache->index_offset = GET_UINT32 (cache->buffer, 12);
+  n_slots = GET_UINT32 (cache->buffer, cache->index_offset);
+  cache->index_mask = n_slots - 1;
+  cache->n_bitmap_words = GET_UINT32 (cache->buffer, cache->index_offset + 4);
+  cache->bitmap_offset = cache->index_offset + 8 + 8 * n_slots;
+}
+
 GtkIconCache *
 gtk_icon_cache_ref (GtkIconCache *cache)
 {
@@ -152,6 +178,7 @@ gtk_icon_cache_new_for_path (const gchar *path)
   cache->ref_count = 1;
   cache->map = map;
   cache->buffer = g_mapped_file_get_contents (map);
+  setup_index (cache);
 
  done:
   g_free (cache_filename);  
@@ -170,6 +197,7 @@ gtk_icon_cache_new (const gchar *data)
   cache->ref_count = 1;
   cache->map = NULL;
   cache->buffer = (gchar *)data;
+  setup_index (cache);
   
   return cache;
 }
@@ -217,29 +245,70 @@ icon_name_hash (gconstpointer key)
   return h;
 }
 
-static gint
-find_image_offset (GtkIconCache *cache,
-		   const gchar  *icon_name,
-		   gint          directory_index)
+static inline gboolean
+slot_in_directory (GtkIconCache *cache,
+                   guint32       slot,
+                   gint          directory_index)
+{
+  guint32 word;
+
+  word = GET_UINT32 (cache->buffer, cache->bitmap_offset +
+                     4 * (cache->n_bitmap_words * slot + directory_index / 32));
+
+  return (word & (1u << (directory_index % 32))) != 0;
+}
+
+/* Returns the offset of the icon, or 0xffffffff. @slot is set to
+ * the slot of the icon in the index, or NO_SLOT if there is no index
+ */
+static guint32
+find_icon (GtkIconCache *cache,
+           const gchar  *icon_name,
+           guint32      *slot)
 {
   guint32 hash_offset;
   guint32 n_buckets;
   guint32 chain_offset;
   int hash;
-  guint32 image_list_offset, n_images;
-  int i;
 
-  if (!icon_name)
-    return 0;
+  *slot = NO_SLOT;
 
-  chain_offset = cache->last_chain_offset;
-  if (chain_offset)
+  if (cache->index_offset)
     {
-      guint32 name_offset = GET_UINT32 (cache->buffer, chain_offset + 4);
-      gchar *name = cache->buffer + name_offset;
+      guint32 index_hash, pos, dist;
 
-      if (strcmp (name, icon_name) == 0)
-        goto find_dir;
+      index_hash = icon_cache_index_hash (icon_name);
+      pos = index_hash & cache->index_mask;
+
+      /* Entries are ordered by distance from their home slot, so
+       * we can stop once we pass one that is closer to it than
+       * we are to ours
+       */
+      for (dist = 0; dist <= cache->index_mask; dist++)
+        {
+          guint32 slot_offset = cache->index_offset + 8 + 8 * pos;
+          guint32 slot_hash = GET_UINT32 (cache->buffer, slot_offset);
+
+          chain_offset = GET_UINT32 (cache->buffer, slot_offset + 4);
+          if (chain_offset == 0xffffffff ||
+              ((pos - (slot_hash & cache->index_mask)) & cache->index_mask) < dist)
+            break;
+
+          if (slot_hash == index_hash)
+            {
+              guint32 name_offset = GET_UINT32 (cache->buffer, chain_offset + 4);
+
+              if (strcmp (cache->buffer + name_offset, icon_name) == 0)
+                {
+                  *slot = pos;
+                  return chain_offset;
+                }
+            }
+
+          pos = (pos + 1) & cache->index_mask;
+        }
+
+      return 0xffffffff;
     }
 
   hash_offset = GET_UINT32 (cache->buffer, 4);
@@ -253,18 +322,53 @@ find_image_offset (GtkIconCache *cache,
       gchar *name = cache->buffer + name_offset;
 
       if (strcmp (name, icon_name) == 0)
-        {
-          cache->last_chain_offset = chain_offset;
-          goto find_dir;
-	}
-  
+        return chain_offset;
+
       chain_offset = GET_UINT32 (cache->buffer, chain_offset);
     }
 
-  cache->last_chain_offset = 0;
-  return 0;
+  return 0xffffffff;
+}
+
+static gint
+find_image_offset (GtkIconCache *cache,
+		   const gchar  *icon_name,
+		   gint          directory_index)
+{
+  guint32 chain_offset;
+  guint32 slot;
+  guint32 image_list_offset, n_images;
+  int i;
+
+  if (!icon_name)
+    return 0;
+
+  chain_offset = cache->last_chain_offset;
+  slot = cache->last_slot;
+  if (chain_offset)
+    {
+      guint32 name_offset = GET_UINT32 (cache->buffer, chain_offset + 4);
+      gchar *name = cache->buffer + name_offset;
+
+      if (strcmp (name, icon_name) == 0)
+        goto find_dir;
+    }
+
+  chain_offset = find_icon (cache, icon_name, &slot);
+  if (chain_offset == 0xffffffff)
+    {
+      cache->last_chain_offset = 0;
+      return 0;
+    }
+
+  cache->last_chain_offset = chain_offset;
+  cache->last_slot = slot;
 
 find_dir:
+  /* The bitmap answers for the directories the icon is not in */
+  if (slot != NO_SLOT && !slot_in_directory (cache, slot, directory_index))
+    return 0;
+
   /* We've found an icon list, now check if we have the right icon in it */
   image_list_offset = GET_UINT32 (cache->buffer, chain_offset + 8);
   n_images = GET_UINT32 (cache->buffer, image_list_offset);
@@ -309,6 +413,21 @@ gtk_icon_cache_has_icons (GtkIconCache *cache,
   if (directory_index == -1)
     return FALSE;
 
+  if (cache->index_offset)
+    {
+      guint32 slot;
+
+      for (slot = 0; slot <= cache->index_mask; slot++)
+        {
+          chain_offset = GET_UINT32 (cache->buffer, cache->index_offset + 12 + 8 * slot);
+          if (chain_offset != 0xffffffff &&
+              slot_in_directory (cache, slot, directory_index))
+            return TRUE;
+        }
+
+      return FALSE;
+    }
+
   hash_offset = GET_UINT32 (cache->buffer, 4);
   n_buckets = GET_UINT32 (cache->buffer, hash_offset);
 
@@ -349,6 +468,25 @@ gtk_icon_cache_add_icons (GtkIconCache *cache,
 
   if (directory_index == -1)
     return;
+
+  if (cache->index_offset)
+    {
+      guint32 slot;
+
+      for (slot = 0; slot <= cache->index_mask; slot++)
+        {
+          chain_offset = GET_UINT32 (cache->buffer, cache->index_offset + 12 + 8 * slot);
+          if (chain_offset != 0xffffffff &&
+              slot_in_directory (cache, slot, directory_index))
+            {
+              guint32 name_offset = GET_UINT32 (cache->buffer, chain_offset + 4);
+
+              g_hash_table_insert (hash_table, cache->buffer + name_offset, NULL);
+            }
+        }
+
+      return;
+    }
   
   hash_offset = GET_UINT32 (cache->buffer, 4);
   n_buckets = GET_UINT32 (cache->buffer, hash_offset);
@@ -380,29 +518,9 @@ gboolean
 gtk_icon_cache_has_icon (GtkIconCache *cache,
 			  const gchar  *icon_name)
 {
-  guint32 hash_offset;
-  guint32 n_buckets;
-  guint32 chain_offset;
-  gint hash;
-  
-  hash_offset = GET_UINT32 (cache->buffer, 4);
-  n_buckets = GET_UINT32 (cache->buffer, hash_offset);
-
-  hash = icon_name_hash (icon_name) % n_buckets;
-
-  chain_offset = GET_UINT32 (cache->buffer, hash_offset + 4 + 4 * hash);
-  while (chain_offset != 0xffffffff)
-    {
-      guint32 name_offset = GET_UINT32 (cache->buffer, chain_offset + 4);
-      gchar *name = cache->buffer + name_offset;
+  guint32 slot;
 
-      if (strcmp (name, icon_name) == 0)
-	return TRUE;
-	  
-      chain_offset = GET_UINT32 (cache->buffer, chain_offset);
-    }
-
-  return FALSE;
+  return find_icon (cache, icon_name, &slot) != 0xffffffff;
 }
 
 gboolean
@@ -410,55 +528,14 @@ gtk_icon_cache_has_icon_in_directory (GtkIconCache *cache,
 				       const gchar  *icon_name,
 				       const gchar  *directory)
 {
-  guint32 hash_offset;
-  guint32 n_buckets;
-  guint32 chain_offset;
-  gint hash;
-  gboolean found_icon = FALSE;
   gint directory_index;
 
   directory_index = get_directory_index (cache, directory);
 
   if (directory_index == -1)
     return FALSE;
-  
-  hash_offset = GET_UINT32 (cache->buffer, 4);
-  n_buckets = GET_UINT32 (cache->buffer, hash_offset);
 
-  hash = icon_name_hash (icon_name) % n_buckets;
-
-  chain_offset = GET_UINT32 (cache->buffer, hash_offset + 4 + 4 * hash);
-  while (chain_offset != 0xffffffff)
-    {
-      guint32 name_offset = GET_UINT32 (cache->buffer, chain_offset + 4);
-      gchar *name = cache->buffer + name_offset;
-
-      if (strcmp (name, icon_name) == 0)
-	{
-	  found_icon = TRUE;
-	  break;
-	}
-	  
-      chain_offset = GET_UINT32 (cache->buffer, chain_offset);
-    }
-
-  if (found_icon)
-    {
-      guint32 image_list_offset = GET_UINT32 (cache->buffer, chain_offset + 8);
-      guint32 n_images =  GET_UINT32 (cache->buffer, image_list_offset);
-      guint32 image_offset = image_list_offset + 4;
-      gint i;
-      for (i = 0; i < n_images; i++)
-	{
-	  guint16 index = GET_UINT16 (cache->buffer, image_offset);
-	  
-	  if (index == directory_index)
-	    return TRUE;
-	  image_offset += 8;
-	}
-    }
-
-  return FALSE;
+  return find_image_offset (cache, icon_name, directory_index) != 0;
 }
 
 static void
@@ -495,7 +572,11 @@ gtk_icon_cache_get_icon (GtkIconCache *cache,
 
   type = GET_UINT32 (cache->buffer, pixel_data_offset);
 
-  if (type != 0)
+  /* Texture data is handed out by gtk_icon_cache_get_texture() */
+  if (type == ICON_CACHE_PIXEL_DATA_TEXTURE)
+    return NULL;
+
+  if (type != ICON_CACHE_PIXEL_DATA_PIXDATA)
     {
       GTK_NOTE (ICONTHEME, g_message ("invalid pixel data type %u", type));
       return NULL;
@@ -533,3 +614,63 @@ G_GNUC_END_IGNORE_DEPRECATIONS
   return pixbuf;
 }
 
+/*
+ * gtk_icon_cache_get_texture:
+ * @cache: a #GtkIconCache
+ * @icon_name: the name of the icon
+ * @directory_index: the index of the directory to look in
+ *
+ * Gets a texture for the icon if the cache contains texture data
+ * for it, see the --include-texture-data option of
+ * gtk-update-icon-cache. The texture uses the texels in the cache
+ * directly and keeps the cache alive.
+ *
+ * Returns: (nullable) (transfer full): a texture, or %NULL if the
+ *     cache has no texture data for the icon
+ */
+GdkTexture *
+gtk_icon_cache_get_texture (GtkIconCache *cache,
+                            const gchar  *icon_name,
+                            gint          directory_index)
+{
+  guint32 offset, image_data_offset, pixel_data_offset;
+  guint32 width, height, stride, format, texel_offset;
+  GdkTexture *texture;
+  GBytes *bytes;
+
+  offset = find_image_offset (cache, icon_name, directory_index);
+  if (!offset)
+    return NULL;
+
+  image_data_offset = GET_UINT32 (cache->buffer, offset + 4);
+  if (!image_data_offset)
+    return NULL;
+
+  pixel_data_offset = GET_UINT32 (cache->buffer, image_data_offset);
+  if (!pixel_data_offset ||
+      GET_UINT32 (cache->buffer, pixel_data_offset) != ICON_CACHE_PIXEL_DATA_TEXTURE)
+    return NULL;
+
+  width = GET_UINT32 (cache->buffer, pixel_data_offset + 8);
+  height = GET_UINT32 (cache->buffer, pixel_data_offset + 12);
+  stride = GET_UINT32 (cache->buffer, pixel_data_offset + 16);
+  format = GET_UINT32 (cache->buffer, pixel_data_offset + 20);
+  texel_offset = GET_UINT32 (cache->buffer, pixel_data_offset + 24);
+
+  if (format != ICON_CACHE_TEXTURE_FORMAT_B8G8R8A8_PREMULTIPLIED)
+    {
+      GTK_NOTE (ICONTHEME, g_message ("invalid texture format %u", format));
+      return NULL;
+    }
+
+  bytes = g_bytes_new_with_free_func (cache->buffer + pixel_data_offset + texel_offset,
+                                      (gsize) stride * height,
+                                      (GDestroyNotify) gtk_icon_cache_unref,
+                                      gtk_icon_cache_ref (cache));
+  texture = gdk_memory_texture_new (width, height,
+                                    GDK_MEMORY_B8G8R8A8_PREMULTIPLIED,
+                                    bytes, stride);
+  g_bytes_unref (bytes);
+
+  return texture;
+}
@@ -18,6 +18,7 @@
 #define __GTK_ICON_CACHE_PRIVATE_H__
 
 #include <gdk-pixbuf/gdk-pixbuf.h>
+#include <gdk/gdk.h>
 
 G_BEGIN_DECLS
 
@@ -44,6 +45,9 @@ gint          gtk_icon_cache_get_icon_flags             (GtkIconCache *cache,
 GdkPixbuf    *gtk_icon_cache_get_icon                   (GtkIconCache *cache,
                                                          const gchar  *icon_name,
                                                          gint          directory_index);
+GdkTexture   *gtk_icon_cache_get_texture                (GtkIconCache *cache,
+                                                         const gchar  *icon_name,
+                                                         gint          directory_index);
 
 GtkIconCache *gtk_icon_cache_ref                        (GtkIconCache *cache);
 void          gtk_icon_cache_unref                      (GtkIconCache *cache);
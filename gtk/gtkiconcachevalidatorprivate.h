@@ -27,6 +27,58 @@ enum {
   CHECK_PIXBUFS = 4
 };
 
+/* Types of pixel data */
+enum {
+  ICON_CACHE_PIXEL_DATA_PIXDATA = 0,
+  ICON_CACHE_PIXEL_DATA_TEXTURE = 1
+};
+
+/* Minor version of caches with texture data */
+#define ICON_CACHE_TEXTURE_MINOR_VERSION 1
+
+/* Minor version of caches with an icon index. Their header has
+ * the offset of the index after the directory list offset, and
+ * they may contain texture data.
+ *
+ * The index is an open addressing hash table over the icon names,
+ * using Robin Hood hashing. It starts with the number of slots,
+ * which is a power of 2, and the number of 32 bit words in the
+ * directory bitmaps. Then come the slots, each the icon index hash
+ * of the name and the offset of the icon, or 0xffffffff if the slot
+ * is empty. Then come the bitmaps of the slots, which have bit
+ * i % 32 of word i / 32 set if the icon is in directory i.
+ */
+#define ICON_CACHE_INDEX_MINOR_VERSION 2
+
+static inline guint32
+icon_cache_index_hash (const gchar *name)
+{
+  const guchar *p;
+  guint32 h = 2166136261u;
+
+  /* FNV-1a, the chained hash of the cache is too weak for
+   * power of 2 tables
+   */
+  for (p = (const guchar *) name; *p != '\0'; p++)
+    {
+      h ^= *p;
+      h *= 16777619u;
+    }
+
+  return h;
+}
+
+/* Texture data has, after the type and length, the width, height,
+ * rowstride, memory format and the offset of the texels from the
+ * start of the pixel data. The texels are aligned in the file, so
+ * that textures can be made directly from the mapped cache.
+ */
+#define ICON_CACHE_TEXTURE_HEADER_SIZE 28
+#define ICON_CACHE_TEXTURE_ALIGNMENT 16
+
+/* Premultiplied BGRA, in this byte order */
+#define ICON_CACHE_TEXTURE_FORMAT_B8G8R8A8_PREMULTIPLIED 0
+
 typedef struct {
   const gchar *cache;
   gsize cache_size;
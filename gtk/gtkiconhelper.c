@@ -32,6 +32,7 @@
 #include "gtkcsstransientnodeprivate.h"
 #include "gtkiconthemeprivate.h"
 #include "gtkrendericonprivate.h"
+#include "gtkscaledtextureprivate.h"
 #include "gtkscalerprivate.h"
 #include "gtksnapshot.h"
 #include "gtkwidgetprivate.h"
@@ -91,6 +92,95 @@ get_icon_lookup_flags (GtkIconHelper    *self,
   return flags;
 }
 
+/* Paintables loaded for icons are shared between all icon helpers
+ * showing the same icon at the same size, so that a list with
+ * thousands of identical icons does only one lookup and keeps only
+ * one texture. Symbolic icons are recolored when they are drawn, so
+ * the colors are not part of the key.
+ *
+ * Every icon theme has its own table, which does not keep the
+ * paintables alive and is flushed when the theme changes.
+ */
+typedef struct
+{
+  GIcon *gicon;
+  gint size;
+  gint scale;
+  GtkIconLookupFlags flags;
+
+  GHashTable *table;
+  GdkPaintable *paintable;
+  gboolean symbolic;
+} SharedPaintable;
+
+static guint
+shared_paintable_hash (gconstpointer data)
+{
+  const SharedPaintable *shared = data;
+
+  return g_icon_hash (shared->gicon) ^
+         (shared->size << 16) ^ (shared->scale << 8) ^ shared->flags;
+}
+
+static gboolean
+shared_paintable_equal (gconstpointer a,
+                        gconstpointer b)
+{
+  const SharedPaintable *shared_a = a;
+  const SharedPaintable *shared_b = b;
+
+  return shared_a->size == shared_b->size &&
+         shared_a->scale == shared_b->scale &&
+         shared_a->flags == shared_b->flags &&
+         g_icon_equal (shared_a->gicon, shared_b->gicon);
+}
+
+static void
+shared_paintable_finalized (gpointer  data,
+                            GObject  *where_the_object_was)
+{
+  SharedPaintable *shared = data;
+
+  g_hash_table_steal (shared->table, shared);
+  g_object_unref (shared->gicon);
+  g_slice_free (SharedPaintable, shared);
+}
+
+static void
+shared_paintable_free (gpointer data)
+{
+  SharedPaintable *shared = data;
+
+  g_object_weak_unref (G_OBJECT (shared->paintable), shared_paintable_finalized, shared);
+  g_object_unref (shared->gicon);
+  g_slice_free (SharedPaintable, shared);
+}
+
+static GHashTable *
+get_shared_paintables (GtkIconTheme *icon_theme)
+{
+  static GQuark quark;
+  GHashTable *table;
+
+  if (G_UNLIKELY (quark == 0))
+    quark = g_quark_from_static_string ("gtk-icon-helper-shared-paintables");
+
+  table = g_object_get_qdata (G_OBJECT (icon_theme), quark);
+  if (table == NULL)
+    {
+      table = g_hash_table_new_full (shared_paintable_hash,
+                                     shared_paintable_equal,
+                                     shared_paintable_free,
+                                     NULL);
+      g_object_set_qdata_full (G_OBJECT (icon_theme), quark,
+                               table, (GDestroyNotify) g_hash_table_unref);
+      g_signal_connect_swapped (icon_theme, "changed",
+                                G_CALLBACK (g_hash_table_remove_all), table);
+    }
+
+  return table;
+}
+
 static GdkPaintable *
 ensure_paintable_for_gicon (GtkIconHelper    *self,
                             GtkCssStyle      *style,
@@ -104,6 +194,8 @@ ensure_paintable_for_gicon (GtkIconHelper    *self,
   GtkIconInfo *info;
   GtkIconLookupFlags flags;
   GdkPaintable *paintable;
+  GHashTable *shared_paintables;
+  SharedPaintable lookup, *shared;
 
   icon_theme = gtk_css_icon_theme_value_get_icon_theme
     (gtk_css_style_get_value (style, GTK_CSS_PROPERTY_ICON_THEME));
@@ -111,6 +203,18 @@ ensure_paintable_for_gicon (GtkIconHelper    *self,
 
   width = height = gtk_icon_helper_get_size (self);
 
+  shared_paintables = get_shared_paintables (icon_theme);
+  lookup.gicon = gicon;
+  lookup.size = width;
+  lookup.scale = scale;
+  lookup.flags = flags;
+  shared = g_hash_table_lookup (shared_paintables, &lookup);
+  if (shared)
+    {
+      *symbolic = shared->symbolic;
+      return g_object_ref (shared->paintable);
+    }
+
   info = gtk_icon_theme_lookup_by_gicon_for_scale (icon_theme,
                                                    gicon,
                                                    MIN (width, height),
@@ -133,6 +237,20 @@ ensure_paintable_for_gicon (GtkIconHelper    *self,
       g_object_unref (orig);
     }
 
+  if (paintable)
+    {
+      shared = g_slice_new (SharedPaintable);
+      shared->gicon = g_object_ref (gicon);
+      shared->size = width;
+      shared->scale = scale;
+      shared->flags = flags;
+      shared->table = shared_paintables;
+      shared->paintable = paintable;
+      shared->symbolic = *symbolic;
+      g_object_weak_ref (G_OBJECT (paintable), shared_paintable_finalized, shared);
+      g_hash_table_add (shared_paintables, shared);
+    }
+
   return paintable;
 }
 
@@ -273,7 +391,7 @@ gtk_icon_helper_paintable_snapshot (GdkPaintable *paintable,
         gtk_snapshot_translate (snapshot, &GRAPHENE_POINT_INIT (x, y));
         gtk_css_style_snapshot_icon_paintable (style,
                                                snapshot,
-                                               self->paintable,
+                                               gtk_scaled_texture_lookup (self->paintable, w, h, self->owner),
                                                w, h,
                                                self->texture_is_symbolic);
         gtk_snapshot_restore (snapshot);
@@ -46,6 +46,7 @@
 #include "gtkintl.h"
 #include "gtkmain.h"
 #include "gtksettingsprivate.h"
+#include "gtkstartuptraceprivate.h"
 #include "gtkstylecontextprivate.h"
 #include "gtkprivate.h"
 #include "gdkpixbufutilsprivate.h"
@@ -123,7 +124,10 @@ typedef enum
   ICON_SUFFIX_SYMBOLIC_PNG = 1 << 4
 } IconSuffix;
 
-#define INFO_CACHE_LRU_SIZE 32
+/* The default number of bytes of decoded image data that the LRU
+ * may keep alive, see gtk_icon_theme_set_cache_budget()
+ */
+#define INFO_CACHE_DEFAULT_BUDGET (8 * 1024 * 1024)
 #if 0
 #define DEBUG_CACHE(args) g_print args
 #else
@@ -133,7 +137,11 @@ typedef enum
 struct _GtkIconThemePrivate
 {
   GHashTable *info_cache;
-  GList *info_cache_lru;
+  GQueue info_cache_lru;
+  gsize info_cache_lru_bytes;
+  gsize info_cache_budget;
+  guint info_cache_hits;
+  guint info_cache_misses;
 
   gchar *current_theme;
   gchar **search_path;
@@ -195,12 +203,17 @@ struct _GtkIconInfo
   IconInfoKey key;
   GtkIconTheme *in_cache;
 
+  /* Link in the LRU of in_cache, data is set while linked */
+  GList lru_link;
+  gsize lru_cost;
+
   gchar *filename;
   GFile *icon_file;
   GLoadableIcon *loadable;
 
-  /* Cache pixbuf (if there is any) */
+  /* Cache pixbuf or texture (if there is any) */
   GdkPixbuf *cache_pixbuf;
+  GdkTexture *cache_texture;
 
   /* Information about the directory where
    * the source was found
@@ -230,9 +243,6 @@ struct _GtkIconInfo
   gdouble scale;
 
   SymbolicPixbufCache *symbolic_pixbuf_cache;
-
-  gint symbolic_width;
-  gint symbolic_height;
 };
 
 typedef struct
@@ -246,6 +256,8 @@ typedef struct
   GList *dirs;
 } IconTheme;
 
+typedef struct _DirScan DirScan;
+
 typedef struct
 {
   IconThemeDirType type;
@@ -264,6 +276,8 @@ typedef struct
   
   GtkIconCache *cache;
   
+  /* Set until the directory has been scanned, see theme_dir_ensure_scanned() */
+  DirScan *scan;
   GHashTable *icons;
 } IconThemeDir;
 
@@ -280,6 +294,7 @@ typedef struct
   time_t mtime;
   GtkIconCache *cache;
   gboolean exists;
+  gboolean cache_checked;
 } IconThemeDirMtime;
 
 static void         gtk_icon_theme_finalize   (GObject          *object);
@@ -314,6 +329,7 @@ static GtkIconInfo *icon_info_new             (IconThemeDirType  type,
 static IconSuffix   suffix_from_name          (const gchar      *name);
 static void         remove_from_lru_cache     (GtkIconTheme     *icon_theme,
                                                GtkIconInfo      *icon_info);
+static void         queue_directory_scans     (GtkIconTheme     *icon_theme);
 static gboolean     icon_info_ensure_scale_and_pixbuf (GtkIconInfo* icon_info);
 
 static guint signal_changed = 0;
@@ -660,6 +676,8 @@ gtk_icon_theme_init (GtkIconTheme *icon_theme)
 
   priv->info_cache = g_hash_table_new_full (icon_info_key_hash, icon_info_key_equal, NULL,
                                             (GDestroyNotify)icon_info_uncached);
+  g_queue_init (&priv->info_cache_lru);
+  priv->info_cache_budget = INFO_CACHE_DEFAULT_BUDGET;
 
   priv->custom_theme = FALSE;
 
@@ -779,7 +797,7 @@ gtk_icon_theme_finalize (GObject *object)
   priv = icon_theme->priv;
 
   g_hash_table_destroy (priv->info_cache);
-  g_assert (priv->info_cache_lru == NULL);
+  g_assert (g_queue_is_empty (&priv->info_cache_lru));
 
   if (priv->theme_changed_idle)
     g_source_remove (priv->theme_changed_idle);
@@ -1079,6 +1097,7 @@ insert_theme (GtkIconTheme *icon_theme,
                                NULL);
       dir_mtime = g_slice_new (IconThemeDirMtime);
       dir_mtime->cache = NULL;
+      dir_mtime->cache_checked = FALSE;
       dir_mtime->dir = path;
       if (g_stat (path, &stat_buf) == 0 && S_ISDIR (stat_buf.st_mode)) {
         dir_mtime->mtime = stat_buf.st_mtime;
@@ -1322,6 +1341,7 @@ load_themes (GtkIconTheme *icon_theme)
       dir_mtime->mtime = 0;
       dir_mtime->exists = FALSE;
       dir_mtime->cache = NULL;
+      dir_mtime->cache_checked = FALSE;
 
       if (g_stat (dir, &stat_buf) != 0 || !S_ISDIR (stat_buf.st_mode))
         continue;
@@ -1329,6 +1349,7 @@ load_themes (GtkIconTheme *icon_theme)
       dir_mtime->exists = TRUE;
 
       dir_mtime->cache = gtk_icon_cache_new_for_path (dir);
+      dir_mtime->cache_checked = TRUE;
       if (dir_mtime->cache != NULL)
         continue;
 
@@ -1360,6 +1381,8 @@ load_themes (GtkIconTheme *icon_theme)
     }
 
   priv->themes_valid = TRUE;
+
+  queue_directory_scans (icon_theme);
   
   g_get_current_time (&tv);
   priv->last_stat_time = tv.tv_sec;
@@ -1404,7 +1427,11 @@ ensure_valid_themes (GtkIconTheme *icon_theme)
   
   if (!priv->themes_valid)
     {
+      gint64 trace_start;
+
+      trace_start = gtk_startup_trace_begin ();
       load_themes (icon_theme);
+      gtk_startup_trace_end (trace_start, "Load icon theme", priv->current_theme);
 
       if (was_valid)
         queue_theme_changed (icon_theme);
@@ -1413,7 +1440,7 @@ ensure_valid_themes (GtkIconTheme *icon_theme)
   priv->loading_themes = FALSE;
 }
 
-/* The LRU cache is a short list of IconInfos that are kept
+/* The LRU cache is a list of IconInfos that are kept
  * alive even though their IconInfo would otherwise have
  * been freed, so that we can avoid reloading these
  * constantly.
@@ -1421,26 +1448,70 @@ ensure_valid_themes (GtkIconTheme *icon_theme)
  * references the info. So, when we get a cache hit
  * we remove it from the list, and when the proxy
  * pixmap is released we put it on the list.
+ *
+ * The list is bounded by the number of bytes of decoded
+ * image data the infos hold, not by their number, so that
+ * many small icons can stay around while a few large ones
+ * don't push out everything else. The links are embedded
+ * in the infos, so that moving and removing items is O(1).
  */
+static gsize
+pixbuf_get_byte_size (GdkPixbuf *pixbuf)
+{
+  if (pixbuf == NULL)
+    return 0;
+
+  return (gsize) gdk_pixbuf_get_rowstride (pixbuf) * gdk_pixbuf_get_height (pixbuf);
+}
+
+static gsize
+icon_info_get_cache_cost (GtkIconInfo *icon_info)
+{
+  SymbolicPixbufCache *symbolic_cache;
+  gsize cost;
+
+  /* Also count the info itself, so that infos without
+   * any image data don't accumulate without bounds
+   */
+  cost = sizeof (GtkIconInfo);
+  cost += pixbuf_get_byte_size (icon_info->pixbuf);
+
+  /* Textures from the icon cache live in its mapping */
+  if (icon_info->texture && icon_info->texture != icon_info->cache_texture)
+    cost += (gsize) 4 * gdk_texture_get_width (icon_info->texture)
+                      * gdk_texture_get_height (icon_info->texture);
+
+  for (symbolic_cache = icon_info->symbolic_pixbuf_cache;
+       symbolic_cache != NULL;
+       symbolic_cache = symbolic_cache->next)
+    cost += pixbuf_get_byte_size (symbolic_cache->pixbuf);
+
+  return cost;
+}
+
 static void
 ensure_lru_cache_space (GtkIconTheme *icon_theme)
 {
   GtkIconThemePrivate *priv = icon_theme->priv;
-  GList *l;
+  guint keep;
 
-  /* Remove last item if LRU full */
-  l = g_list_nth (priv->info_cache_lru, INFO_CACHE_LRU_SIZE - 1);
-  if (l)
+  /* Never evict the most recently used info, unless caching is off */
+  keep = priv->info_cache_budget > 0 ? 1 : 0;
+
+  while (priv->info_cache_lru_bytes > priv->info_cache_budget &&
+         g_queue_get_length (&priv->info_cache_lru) > keep)
     {
+      GList *l = g_queue_pop_tail_link (&priv->info_cache_lru);
       GtkIconInfo *icon_info = l->data;
 
-      DEBUG_CACHE (("removing (due to out of space) %p (%s %d 0x%x) from LRU cache (cache size %d)\n",
+      DEBUG_CACHE (("removing (due to out of space) %p (%s %d 0x%x) from LRU cache (cache size %"G_GSIZE_FORMAT")\n",
                     icon_info,
                     g_strjoinv (",", icon_info->key.icon_names),
                     icon_info->key.size, icon_info->key.flags,
-                    g_list_length (priv->info_cache_lru)));
+                    priv->info_cache_lru_bytes));
 
-      priv->info_cache_lru = g_list_delete_link (priv->info_cache_lru, l);
+      l->data = NULL;
+      priv->info_cache_lru_bytes -= icon_info->lru_cost;
       g_object_unref (icon_info);
     }
 }
@@ -1451,18 +1522,24 @@ add_to_lru_cache (GtkIconTheme *icon_theme,
 {
   GtkIconThemePrivate *priv = icon_theme->priv;
 
-  DEBUG_CACHE (("adding  %p (%s %d 0x%x) to LRU cache (cache size %d)\n",
+  DEBUG_CACHE (("adding  %p (%s %d 0x%x) to LRU cache (cache size %"G_GSIZE_FORMAT")\n",
                 icon_info,
                 g_strjoinv (",", icon_info->key.icon_names),
                 icon_info->key.size, icon_info->key.flags,
-                g_list_length (priv->info_cache_lru)));
+                priv->info_cache_lru_bytes));
 
-  g_assert (g_list_find (priv->info_cache_lru, icon_info) == NULL);
+  g_assert (icon_info->lru_link.data == NULL);
+
+  if (priv->info_cache_budget == 0)
+    return;
 
-  ensure_lru_cache_space (icon_theme);
   /* prepend new info to LRU */
-  priv->info_cache_lru = g_list_prepend (priv->info_cache_lru,
-                                         g_object_ref (icon_info));
+  icon_info->lru_link.data = g_object_ref (icon_info);
+  icon_info->lru_cost = icon_info_get_cache_cost (icon_info);
+  g_queue_push_head_link (&priv->info_cache_lru, &icon_info->lru_link);
+  priv->info_cache_lru_bytes += icon_info->lru_cost;
+
+  ensure_lru_cache_space (icon_theme);
 }
 
 static void
@@ -1470,14 +1547,20 @@ ensure_in_lru_cache (GtkIconTheme *icon_theme,
                      GtkIconInfo  *icon_info)
 {
   GtkIconThemePrivate *priv = icon_theme->priv;
-  GList *l;
 
-  l = g_list_find (priv->info_cache_lru, icon_info);
-  if (l)
+  if (icon_info->lru_link.data != NULL)
     {
-      /* Move to front of LRU if already in it */
-      priv->info_cache_lru = g_list_remove_link (priv->info_cache_lru, l);
-      priv->info_cache_lru = g_list_concat (l, priv->info_cache_lru);
+      /* Move to front of LRU if already in it, the info
+       * may have loaded more data since it was added
+       */
+      g_queue_unlink (&priv->info_cache_lru, &icon_info->lru_link);
+      g_queue_push_head_link (&priv->info_cache_lru, &icon_info->lru_link);
+
+      priv->info_cache_lru_bytes -= icon_info->lru_cost;
+      icon_info->lru_cost = icon_info_get_cache_cost (icon_info);
+      priv->info_cache_lru_bytes += icon_info->lru_cost;
+
+      ensure_lru_cache_space (icon_theme);
     }
   else
     add_to_lru_cache (icon_theme, icon_info);
@@ -1488,19 +1571,91 @@ remove_from_lru_cache (GtkIconTheme *icon_theme,
                        GtkIconInfo  *icon_info)
 {
   GtkIconThemePrivate *priv = icon_theme->priv;
-  if (g_list_find (priv->info_cache_lru, icon_info))
+
+  if (icon_info->lru_link.data != NULL)
     {
-      DEBUG_CACHE (("removing %p (%s %d 0x%x) from LRU cache (cache size %d)\n",
+      DEBUG_CACHE (("removing %p (%s %d 0x%x) from LRU cache (cache size %"G_GSIZE_FORMAT")\n",
                     icon_info,
                     g_strjoinv (",", icon_info->key.icon_names),
                     icon_info->key.size, icon_info->key.flags,
-                    g_list_length (priv->info_cache_lru)));
+                    priv->info_cache_lru_bytes));
 
-      priv->info_cache_lru = g_list_remove (priv->info_cache_lru, icon_info);
+      g_queue_unlink (&priv->info_cache_lru, &icon_info->lru_link);
+      icon_info->lru_link.data = NULL;
+      priv->info_cache_lru_bytes -= icon_info->lru_cost;
       g_object_unref (icon_info);
     }
 }
 
+/**
+ * gtk_icon_theme_set_cache_budget:
+ * @icon_theme: a #GtkIconTheme
+ * @n_bytes: the number of bytes to use for caching icons
+ *
+ * Sets the amount of decoded image data that @icon_theme keeps
+ * around for icons that are not in use anymore, so that they
+ * don't have to be loaded again when they are needed next.
+ *
+ * The least recently used icons are dropped first. Setting
+ * @n_bytes to 0 turns this caching off. The default is 8 MB.
+ */
+void
+gtk_icon_theme_set_cache_budget (GtkIconTheme *icon_theme,
+                                 gsize         n_bytes)
+{
+  g_return_if_fail (GTK_IS_ICON_THEME (icon_theme));
+
+  icon_theme->priv->info_cache_budget = n_bytes;
+  ensure_lru_cache_space (icon_theme);
+}
+
+/**
+ * gtk_icon_theme_get_cache_budget:
+ * @icon_theme: a #GtkIconTheme
+ *
+ * Gets the amount of decoded image data that @icon_theme keeps
+ * around for icons that are not in use anymore.
+ * See gtk_icon_theme_set_cache_budget().
+ *
+ * Returns: the cache budget, in bytes
+ */
+gsize
+gtk_icon_theme_get_cache_budget (GtkIconTheme *icon_theme)
+{
+  g_return_val_if_fail (GTK_IS_ICON_THEME (icon_theme), 0);
+
+  return icon_theme->priv->info_cache_budget;
+}
+
+/*
+ * gtk_icon_theme_get_cache_stats:
+ * @icon_theme: a #GtkIconTheme
+ * @hits: (out) (optional): return location for the number of lookups
+ *     that were answered from the cache
+ * @misses: (out) (optional): return location for the number of lookups
+ *     that had to search the themes
+ * @n_bytes: (out) (optional): return location for the number of bytes
+ *     currently kept alive by the cache
+ *
+ * Gets statistics about the icon info cache of @icon_theme,
+ * for the inspector.
+ */
+void
+gtk_icon_theme_get_cache_stats (GtkIconTheme *icon_theme,
+                                guint        *hits,
+                                guint        *misses,
+                                gsize        *n_bytes)
+{
+  GtkIconThemePrivate *priv = icon_theme->priv;
+
+  if (hits)
+    *hits = priv->info_cache_hits;
+  if (misses)
+    *misses = priv->info_cache_misses;
+  if (n_bytes)
+    *n_bytes = priv->info_cache_lru_bytes;
+}
+
 static SymbolicPixbufCache *
 symbolic_pixbuf_cache_new (GdkPixbuf           *pixbuf,
                            const GdkRGBA       *fg,
@@ -1634,12 +1789,16 @@ real_choose_icon (GtkIconTheme       *icon_theme,
                     icon_info->key.size, icon_info->key.flags,
                     g_hash_table_size (priv->info_cache)));
 
+      priv->info_cache_hits++;
+
       icon_info = g_object_ref (icon_info);
       remove_from_lru_cache (icon_theme, icon_info);
 
       return icon_info;
     }
 
+  priv->info_cache_misses++;
+
   if (flags & GTK_ICON_LOOKUP_NO_SVG)
     allow_svg = FALSE;
   else if (flags & GTK_ICON_LOOKUP_FORCE_SVG)
@@ -2630,9 +2789,207 @@ theme_destroy (IconTheme *theme)
   g_free (theme);
 }
 
+/* Directories without an icon cache must be listed before
+ * they can be looked at. This is slow on network file systems,
+ * and a theme has plenty of directories, most of which a given
+ * application never needs.
+ *
+ * So directories are not listed when the theme is loaded. They
+ * are queued on a pool of worker threads instead, and a lookup
+ * that needs a directory before its worker got to it either lists
+ * it right away or waits for the worker that is listing it.
+ * Lookups only need the directories that could be a better match
+ * than the best one found so far, see theme_lookup_icon().
+ */
+typedef enum {
+  DIR_SCAN_PENDING,
+  DIR_SCAN_RUNNING,
+  DIR_SCAN_DONE
+} DirScanState;
+
+struct _DirScan
+{
+  gint ref_count;
+  gchar *path;
+
+  /* Protected by scan_mutex */
+  DirScanState state;
+  GHashTable *icons;
+};
+
+#define MAX_SCAN_THREADS 4
+
+static GMutex scan_mutex;
+static GCond scan_cond;
+static GThreadPool *scan_pool;
+
+static DirScan *
+dir_scan_new (const gchar *path)
+{
+  DirScan *scan;
+
+  scan = g_new0 (DirScan, 1);
+  scan->ref_count = 1;
+  scan->path = g_strdup (path);
+  scan->state = DIR_SCAN_PENDING;
+
+  return scan;
+}
+
+static DirScan *
+dir_scan_ref (DirScan *scan)
+{
+  g_atomic_int_inc (&scan->ref_count);
+
+  return scan;
+}
+
+static void
+dir_scan_unref (DirScan *scan)
+{
+  if (!g_atomic_int_dec_and_test (&scan->ref_count))
+    return;
+
+  if (scan->icons)
+    g_hash_table_destroy (scan->icons);
+  g_free (scan->path);
+  g_free (scan);
+}
+
+/* Can be called from any thread */
+static GHashTable *
+scan_directory (const gchar *full_dir)
+{
+  GHashTable *icons;
+  GDir *gdir;
+  const gchar *name;
+
+  icons = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+
+  gdir = g_dir_open (full_dir, 0, NULL);
+  if (gdir == NULL)
+    return icons;
+
+  while ((name = g_dir_read_name (gdir)))
+    {
+      gchar *base_name;
+      IconSuffix suffix, hash_suffix;
+
+      suffix = suffix_from_name (name);
+      if (suffix == ICON_SUFFIX_NONE)
+        continue;
+
+      base_name = strip_suffix (name);
+
+      hash_suffix = GPOINTER_TO_INT (g_hash_table_lookup (icons, base_name));
+      /* takes ownership of base_name */
+      g_hash_table_replace (icons, base_name, GUINT_TO_POINTER (hash_suffix|suffix));
+    }
+  
+  g_dir_close (gdir);
+
+  return icons;
+}
+
+static void
+dir_scan_worker (gpointer data,
+                 gpointer user_data)
+{
+  DirScan *scan = data;
+  GHashTable *icons;
+
+  g_mutex_lock (&scan_mutex);
+  /* The directory may have been needed, or dropped, in the meantime */
+  if (scan->state != DIR_SCAN_PENDING || g_atomic_int_get (&scan->ref_count) == 1)
+    {
+      g_mutex_unlock (&scan_mutex);
+      dir_scan_unref (scan);
+      return;
+    }
+  scan->state = DIR_SCAN_RUNNING;
+  g_mutex_unlock (&scan_mutex);
+
+  icons = scan_directory (scan->path);
+
+  g_mutex_lock (&scan_mutex);
+  scan->icons = icons;
+  scan->state = DIR_SCAN_DONE;
+  g_cond_broadcast (&scan_cond);
+  g_mutex_unlock (&scan_mutex);
+
+  dir_scan_unref (scan);
+}
+
+static void
+queue_directory_scans (GtkIconTheme *icon_theme)
+{
+  GList *l, *d;
+
+  for (l = icon_theme->priv->themes; l; l = l->next)
+    {
+      IconTheme *theme = l->data;
+
+      for (d = theme->dirs; d; d = d->next)
+        {
+          IconThemeDir *dir = d->data;
+
+          if (dir->scan == NULL)
+            continue;
+
+          if (scan_pool == NULL)
+            {
+              if (g_get_num_processors () < 2)
+                return;
+
+              scan_pool = g_thread_pool_new (dir_scan_worker, NULL,
+                                             MAX_SCAN_THREADS, FALSE, NULL);
+            }
+
+          g_thread_pool_push (scan_pool, dir_scan_ref (dir->scan), NULL);
+        }
+    }
+}
+
+static void
+theme_dir_ensure_scanned (IconThemeDir *dir)
+{
+  DirScan *scan = dir->scan;
+  gboolean scan_here = FALSE;
+
+  if (scan == NULL)
+    return;
+
+  g_mutex_lock (&scan_mutex);
+  if (scan->state == DIR_SCAN_PENDING)
+    {
+      scan->state = DIR_SCAN_RUNNING;
+      scan_here = TRUE;
+    }
+  else
+    {
+      while (scan->state != DIR_SCAN_DONE)
+        g_cond_wait (&scan_cond, &scan_mutex);
+
+      dir->icons = scan->icons;
+      scan->icons = NULL;
+    }
+  g_mutex_unlock (&scan_mutex);
+
+  if (scan_here)
+    {
+      GTK_NOTE (ICONTHEME, g_message ("scanning directory %s", dir->dir));
+      dir->icons = scan_directory (dir->dir);
+    }
+
+  dir->scan = NULL;
+  dir_scan_unref (scan);
+}
+
 static void
 theme_dir_destroy (IconThemeDir *dir)
 {
+  if (dir->scan)
+    dir_scan_unref (dir->scan);
   if (dir->cache)
     gtk_icon_cache_unref (dir->cache);
   if (dir->icons)
@@ -2771,7 +3128,10 @@ theme_dir_get_icon_suffix (IconThemeDir *dir,
       suffix = suffix & ~HAS_ICON_FILE;
     }
   else
-    suffix = GPOINTER_TO_UINT (g_hash_table_lookup (dir->icons, icon_name));
+    {
+      theme_dir_ensure_scanned (dir);
+      suffix = GPOINTER_TO_UINT (g_hash_table_lookup (dir->icons, icon_name));
+    }
 
   GTK_NOTE (ICONTHEME, g_message ("get icon suffix%s: %u", dir->cache ? " (cached)" : "", suffix));
 
@@ -2867,15 +3227,18 @@ theme_lookup_icon (IconTheme   *theme,
     {
       dir = l->data;
 
-      GTK_NOTE (ICONTHEME, g_message ("look up icon dir %s", dir->dir));
-      suffix = theme_dir_get_icon_suffix (dir, icon_name, NULL);
-      if (best_suffix (suffix, allow_svg) != ICON_SUFFIX_NONE)
+      /* Only look into directories that would be a better match,
+       * so that the others don't need to be scanned
+       */
+      difference = theme_dir_size_difference (dir, size, scale);
+      if (min_dir == NULL ||
+          compare_dir_matches (dir, difference,
+                               min_dir, min_difference,
+                               size, scale))
         {
-          difference = theme_dir_size_difference (dir, size, scale);
-          if (min_dir == NULL ||
-              compare_dir_matches (dir, difference,
-                                   min_dir, min_difference,
-                                   size, scale))
+          GTK_NOTE (ICONTHEME, g_message ("look up icon dir %s", dir->dir));
+          suffix = theme_dir_get_icon_suffix (dir, icon_name, NULL);
+          if (best_suffix (suffix, allow_svg) != ICON_SUFFIX_NONE)
             {
               min_dir = dir;
               min_difference = difference;
@@ -2925,8 +3288,11 @@ theme_lookup_icon (IconTheme   *theme,
 
       if (min_dir->cache)
         {
-          icon_info->cache_pixbuf = gtk_icon_cache_get_icon (min_dir->cache, icon_name,
-                                                              min_dir->subdir_index);
+          icon_info->cache_texture = gtk_icon_cache_get_texture (min_dir->cache, icon_name,
+                                                                 min_dir->subdir_index);
+          if (icon_info->cache_texture == NULL)
+            icon_info->cache_pixbuf = gtk_icon_cache_get_icon (min_dir->cache, icon_name,
+                                                                min_dir->subdir_index);
         }
 
       return icon_info;
@@ -2953,7 +3319,10 @@ theme_list_icons (IconTheme  *theme,
           if (dir->cache)
             gtk_icon_cache_add_icons (dir->cache, dir->subdir, icons);
           else
-            g_hash_table_foreach (dir->icons, add_key_to_hash, icons);
+            {
+              theme_dir_ensure_scanned (dir);
+              g_hash_table_foreach (dir->icons, add_key_to_hash, icons);
+            }
         }
       l = l->next;
     }
@@ -2976,6 +3345,7 @@ theme_has_icon (IconTheme   *theme,
         }
       else
         {
+          theme_dir_ensure_scanned (dir);
           if (g_hash_table_lookup (dir->icons, icon_name) != NULL)
             return TRUE;
         }
@@ -2996,6 +3366,17 @@ theme_list_contexts (IconTheme  *theme,
     {
       dir = l->data;
 
+      /* Directories without a cache are kept even if they turn out to be empty */
+      if (dir->cache == NULL && !dir->is_resource)
+        {
+          theme_dir_ensure_scanned (dir);
+          if (g_hash_table_size (dir->icons) == 0)
+            {
+              l = l->next;
+              continue;
+            }
+        }
+
       context = g_quark_to_string (dir->context);
       if (context != NULL)
         g_hash_table_replace (contexts, (gpointer) context, NULL);
@@ -3004,45 +3385,6 @@ theme_list_contexts (IconTheme  *theme,
     }
 }
 
-static gboolean
-scan_directory (GtkIconThemePrivate *icon_theme,
-                IconThemeDir        *dir,
-                gchar               *full_dir)
-{
-  GDir *gdir;
-  const gchar *name;
-
-  GTK_DISPLAY_NOTE (icon_theme->display, ICONTHEME,
-                    g_message ("scanning directory %s", full_dir));
-
-  gdir = g_dir_open (full_dir, 0, NULL);
-
-  if (gdir == NULL)
-    return FALSE;
-
-  dir->icons = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
-
-  while ((name = g_dir_read_name (gdir)))
-    {
-      gchar *base_name;
-      IconSuffix suffix, hash_suffix;
-
-      suffix = suffix_from_name (name);
-      if (suffix == ICON_SUFFIX_NONE)
-        continue;
-
-      base_name = strip_suffix (name);
-
-      hash_suffix = GPOINTER_TO_INT (g_hash_table_lookup (dir->icons, base_name));
-      /* takes ownership of base_name */
-      g_hash_table_replace (dir->icons, base_name, GUINT_TO_POINTER (hash_suffix|suffix));
-    }
-  
-  g_dir_close (gdir);
-
-  return g_hash_table_size (dir->icons) > 0;
-}
-
 static gboolean
 scan_resources (GtkIconThemePrivate  *icon_theme,
                 IconThemeDir         *dir,
@@ -3163,46 +3505,46 @@ theme_subdir_load (GtkIconTheme *icon_theme,
       full_dir = g_build_filename (dir_mtime->dir, subdir, NULL);
 
       /* First, see if we have a cache for the directory */
-      if (dir_mtime->cache != NULL || g_file_test (full_dir, G_FILE_TEST_IS_DIR))
+      if (!dir_mtime->cache_checked)
         {
-          if (dir_mtime->cache == NULL)
-            {
-              /* This will return NULL if the cache doesn't exist or is outdated */
-              dir_mtime->cache = gtk_icon_cache_new_for_path (dir_mtime->dir);
-            }
-
-          dir = g_new0 (IconThemeDir, 1);
-          dir->type = type;
-          dir->is_resource = FALSE;
-          dir->context = context;
-          dir->size = size;
-          dir->min_size = min_size;
-          dir->max_size = max_size;
-          dir->threshold = threshold;
-          dir->dir = full_dir;
-          dir->subdir = g_strdup (subdir);
-          dir->scale = scale;
+          /* This will return NULL if the cache doesn't exist or is outdated */
+          dir_mtime->cache = gtk_icon_cache_new_for_path (dir_mtime->dir);
+          dir_mtime->cache_checked = TRUE;
+        }
 
-          if (dir_mtime->cache != NULL)
-            {
-              dir->cache = gtk_icon_cache_ref (dir_mtime->cache);
-              dir->subdir_index = gtk_icon_cache_get_directory_index (dir->cache, dir->subdir);
-              has_icons = gtk_icon_cache_has_icons (dir->cache, dir->subdir);
-            }
-          else
-            {
-              dir->cache = NULL;
-              dir->subdir_index = -1;
-              has_icons = scan_directory (icon_theme->priv, dir, full_dir);
-            }
+      dir = g_new0 (IconThemeDir, 1);
+      dir->type = type;
+      dir->is_resource = FALSE;
+      dir->context = context;
+      dir->size = size;
+      dir->min_size = min_size;
+      dir->max_size = max_size;
+      dir->threshold = threshold;
+      dir->dir = full_dir;
+      dir->subdir = g_strdup (subdir);
+      dir->scale = scale;
 
-          if (has_icons)
-            theme->dirs = g_list_prepend (theme->dirs, dir);
-          else
-            theme_dir_destroy (dir);
+      if (dir_mtime->cache != NULL)
+        {
+          dir->cache = gtk_icon_cache_ref (dir_mtime->cache);
+          dir->subdir_index = gtk_icon_cache_get_directory_index (dir->cache, dir->subdir);
+          has_icons = gtk_icon_cache_has_icons (dir->cache, dir->subdir);
         }
       else
-        g_free (full_dir);
+        {
+          /* Listing the directory is left for later, so we
+           * don't know yet whether it exists or has any icons
+           */
+          dir->cache = NULL;
+          dir->subdir_index = -1;
+          dir->scan = dir_scan_new (full_dir);
+          has_icons = TRUE;
+        }
+
+      if (has_icons)
+        theme->dirs = g_list_prepend (theme->dirs, dir);
+      else
+        theme_dir_destroy (dir);
     }
 
   if (strcmp (theme->name, FALLBACK_ICON_THEME) == 0)
@@ -3288,6 +3630,8 @@ icon_info_dup (GtkIconInfo *icon_info)
 
   if (icon_info->cache_pixbuf)
     dup->cache_pixbuf = g_object_ref (icon_info->cache_pixbuf);
+  if (icon_info->cache_texture)
+    dup->cache_texture = g_object_ref (icon_info->cache_texture);
 
   dup->scale = icon_info->scale;
   dup->unscaled_scale = icon_info->unscaled_scale;
@@ -3297,8 +3641,6 @@ icon_info_dup (GtkIconInfo *icon_info)
   dup->is_resource = icon_info->is_resource;
   dup->min_size = icon_info->min_size;
   dup->max_size = icon_info->max_size;
-  dup->symbolic_width = icon_info->symbolic_width;
-  dup->symbolic_height = icon_info->symbolic_height;
 
   return dup;
 }
@@ -3319,7 +3661,9 @@ gtk_icon_info_finalize (GObject *object)
   g_clear_object (&icon_info->loadable);
   g_clear_object (&icon_info->pixbuf);
   g_clear_object (&icon_info->proxy_pixbuf);
+  g_clear_object (&icon_info->texture);
   g_clear_object (&icon_info->cache_pixbuf);
+  g_clear_object (&icon_info->cache_texture);
   g_clear_error (&icon_info->load_error);
 
   symbolic_pixbuf_cache_free (icon_info->symbolic_pixbuf_cache);
@@ -3506,6 +3850,8 @@ icon_info_ensure_scale_and_pixbuf (GtkIconInfo *icon_info)
   source_pixbuf = NULL;
   if (icon_info->cache_pixbuf)
     source_pixbuf = g_object_ref (icon_info->cache_pixbuf);
+  else if (icon_info->cache_texture)
+    source_pixbuf = gdk_pixbuf_get_from_texture (icon_info->cache_texture);
   else if (icon_info->is_resource)
     {
       if (icon_info->is_svg)
@@ -3745,6 +4091,17 @@ gtk_icon_info_load_icon (GtkIconInfo *icon_info,
 GdkTexture *
 gtk_icon_info_load_texture (GtkIconInfo *icon_info)
 {
+  /* Icons that are used at the size they have in the icon cache
+   * can use its texture data directly, without being decoded
+   */
+  if (!icon_info->texture &&
+      icon_info->cache_texture &&
+      !icon_info->forced_size &&
+      (icon_info->dir_type == ICON_THEME_DIR_FIXED ||
+       icon_info->dir_type == ICON_THEME_DIR_THRESHOLD) &&
+      icon_info->unscaled_scale == 1.0)
+    icon_info->texture = g_object_ref (icon_info->cache_texture);
+
   if (!icon_info->texture)
     {
       GdkPixbuf *pixbuf;
@@ -3752,8 +4109,6 @@ gtk_icon_info_load_texture (GtkIconInfo *icon_info)
       pixbuf = gtk_icon_info_load_icon (icon_info, NULL);
       icon_info->texture = gdk_texture_new_for_pixbuf (pixbuf);
       g_object_unref (pixbuf);
-
-      g_object_add_weak_pointer (G_OBJECT (icon_info->texture), (void **)&icon_info->texture);
     }
 
   if (icon_info->in_cache != NULL)
@@ -3918,21 +4273,6 @@ symbolic_cache_get_proxy (SymbolicPixbufCache *symbolic_cache,
   return symbolic_cache->proxy_pixbuf;
 }
 
-#define MAX_RGB_STRING_LENGTH (3 + 1 + ((3 + 1) * 3) + 1 + 1)
-static inline void
-rgba_to_string_noalpha (const GdkRGBA *rgba,
-                        char          *buff)
-{
-  /* gdk_rgba_to_string inlined in here for the alpha == 1 case,
-   * and g_strdup_printf replaced with g_snprintf */
-  g_snprintf (buff,
-              MAX_RGB_STRING_LENGTH,
-              "rgb(%d,%d,%d)",
-              (int)(0.5 + CLAMP (rgba->red, 0., 1.) * 255.),
-              (int)(0.5 + CLAMP (rgba->green, 0., 1.) * 255.),
-              (int)(0.5 + CLAMP (rgba->blue, 0., 1.) * 255.));
-}
-
 static void
 rgba_to_pixel(const GdkRGBA  *rgba,
 	      guint8 pixel[4])
@@ -4027,13 +4367,21 @@ gtk_icon_theme_color_symbolic_pixbuf (GdkPixbuf     *symbolic,
   return colored;
 }
 
+/* Symbolic icons, both SVG and .symbolic.png ones, are loaded
+ * once into a mask that has the amount of success, warning and
+ * error color in its color channels, see
+ * gtk_make_symbolic_pixbuf_from_data(). Widgets recolor that
+ * mask with a color matrix at render time. For the pixbuf API,
+ * we color the mask here instead of rendering the SVG again for
+ * every set of colors.
+ */
 static GdkPixbuf *
-gtk_icon_info_load_symbolic_png (GtkIconInfo    *icon_info,
-                                 const GdkRGBA  *fg,
-                                 const GdkRGBA  *success_color,
-                                 const GdkRGBA  *warning_color,
-                                 const GdkRGBA  *error_color,
-                                 GError        **error)
+gtk_icon_info_color_symbolic_mask (GtkIconInfo    *icon_info,
+                                   const GdkRGBA  *fg,
+                                   const GdkRGBA  *success_color,
+                                   const GdkRGBA  *warning_color,
+                                   const GdkRGBA  *error_color,
+                                   GError        **error)
 {
   GdkRGBA fg_default = { 0.7450980392156863, 0.7450980392156863, 0.7450980392156863, 1.0};
   GdkRGBA success_default = { 0.3046921492332342,0.6015716792553597, 0.023437857633325704, 1.0};
@@ -4065,133 +4413,6 @@ gtk_icon_info_load_symbolic_png (GtkIconInfo    *icon_info,
                                                error_color ? error_color : &error_default);
 }
 
-static GdkPixbuf *
-gtk_icon_info_load_symbolic_svg (GtkIconInfo    *icon_info,
-                                 const GdkRGBA  *fg,
-                                 const GdkRGBA  *success_color,
-                                 const GdkRGBA  *warning_color,
-                                 const GdkRGBA  *error_color,
-                                 GError        **error)
-{
-  GInputStream *stream;
-  GdkPixbuf *pixbuf;
-  char css_fg[MAX_RGB_STRING_LENGTH];
-  char css_warning[MAX_RGB_STRING_LENGTH] = "rgb(245,121,62)";
-  char css_success[MAX_RGB_STRING_LENGTH] = "rgb(78,154,6)";
-  char css_error[MAX_RGB_STRING_LENGTH] = "rgb(204,0,0)";
-  gchar *data;
-  gchar *width;
-  gchar *height;
-  gchar *file_data, *escaped_file_data;
-  gsize file_len;
-  gint symbolic_size;
-  double alpha;
-  gchar alphastr[G_ASCII_DTOSTR_BUF_SIZE];
-
-  alpha = fg->alpha;
-
-  rgba_to_string_noalpha (fg, css_fg);
-
-  if (warning_color)
-    rgba_to_string_noalpha (warning_color, css_warning);
-
-  if (error_color)
-    rgba_to_string_noalpha (error_color, css_error);
-
-  if (success_color)
-    rgba_to_string_noalpha (success_color, css_success);
-
-  if (!g_file_load_contents (icon_info->icon_file, NULL, &file_data, &file_len, NULL, error))
-    return NULL;
-
-  if (!icon_info_ensure_scale_and_pixbuf (icon_info))
-    {
-      g_propagate_error (error, icon_info->load_error);
-      icon_info->load_error = NULL;
-      g_free (file_data);
-      return NULL;
-    }
-
-  if (icon_info->symbolic_width == 0 ||
-      icon_info->symbolic_height == 0)
-    {
-      /* Fetch size from the original icon */
-      stream = g_memory_input_stream_new_from_data (file_data, file_len, NULL);
-      pixbuf = gdk_pixbuf_new_from_stream (stream, NULL, error);
-      g_object_unref (stream);
-
-      if (!pixbuf)
-        {
-          g_free (file_data);
-          return NULL;
-        }
-
-      icon_info->symbolic_width = gdk_pixbuf_get_width (pixbuf);
-      icon_info->symbolic_height = gdk_pixbuf_get_height (pixbuf);
-      g_object_unref (pixbuf);
-    }
-
-  symbolic_size = MAX (icon_info->symbolic_width, icon_info->symbolic_height);
-
-  GTK_NOTE (ICONTHEME,
-  if (icon_info->dir_type == ICON_THEME_DIR_UNTHEMED)
-    g_message ("Symbolic icon %s is not in an icon theme directory",
-               icon_info->key.icon_names ? icon_info->key.icon_names[0] : icon_info->filename);
-  else if (icon_info->dir_size * icon_info->dir_scale != symbolic_size)
-    g_message ("Symbolic icon %s of size %d is in an icon theme directory of size %d",
-               icon_info->key.icon_names ? icon_info->key.icon_names[0] : icon_info->filename,
-               symbolic_size,
-               icon_info->dir_size * icon_info->dir_scale)
-  );
-
-  width = g_strdup_printf ("%d", icon_info->symbolic_width);
-  height = g_strdup_printf ("%d", icon_info->symbolic_height);
-
-  escaped_file_data = g_base64_encode ((guchar *) file_data, file_len);
-  g_free (file_data);
-
-  g_ascii_dtostr (alphastr, G_ASCII_DTOSTR_BUF_SIZE, CLAMP (alpha, 0, 1));
-
-  data = g_strconcat ("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n"
-                      "<svg version=\"1.1\"\n"
-                      "     xmlns=\"http://www.w3.org/2000/svg\"\n"
-                      "     xmlns:xi=\"http://www.w3.org/2001/XInclude\"\n"
-                      "     width=\"", width, "\"\n"
-                      "     height=\"", height, "\">\n"
-                      "  <style type=\"text/css\">\n"
-                      "    rect,path,ellipse,circle,polygon {\n"
-                      "      fill: ", css_fg," !important;\n"
-                      "    }\n"
-                      "    .warning {\n"
-                      "      fill: ", css_warning, " !important;\n"
-                      "    }\n"
-                      "    .error {\n"
-                      "      fill: ", css_error ," !important;\n"
-                      "    }\n"
-                      "    .success {\n"
-                      "      fill: ", css_success, " !important;\n"
-                      "    }\n"
-                      "  </style>\n"
-                      "  <g opacity=\"", alphastr, "\" ><xi:include href=\"data:text/xml;base64,", escaped_file_data, "\"/></g>\n"
-                      "</svg>",
-                      NULL);
-  g_free (escaped_file_data);
-  g_free (width);
-  g_free (height);
-
-  stream = g_memory_input_stream_new_from_data (data, -1, g_free);
-  pixbuf = gdk_pixbuf_new_from_stream_at_scale (stream,
-                                                gdk_pixbuf_get_width (icon_info->pixbuf),
-                                                gdk_pixbuf_get_height (icon_info->pixbuf),
-                                                TRUE,
-                                                NULL,
-                                                error);
-  g_object_unref (stream);
-
-  return pixbuf;
-}
-
-
 static GdkPixbuf *
 gtk_icon_info_load_symbolic_internal (GtkIconInfo    *icon_info,
 				      const GdkRGBA  *fg,
@@ -4203,7 +4424,6 @@ gtk_icon_info_load_symbolic_internal (GtkIconInfo    *icon_info,
 {
   GdkPixbuf *pixbuf;
   SymbolicPixbufCache *symbolic_cache;
-  char *icon_uri;
 
   if (use_cache)
     {
@@ -4218,13 +4438,7 @@ gtk_icon_info_load_symbolic_internal (GtkIconInfo    *icon_info,
    */
   g_return_val_if_fail (fg != NULL, NULL);
 
-  icon_uri = g_file_get_uri (icon_info->icon_file);
-  if (g_str_has_suffix (icon_uri, ".symbolic.png"))
-    pixbuf = gtk_icon_info_load_symbolic_png (icon_info, fg, success_color, warning_color, error_color, error);
-  else
-    pixbuf = gtk_icon_info_load_symbolic_svg (icon_info, fg, success_color, warning_color, error_color, error);
-
-  g_free (icon_uri);
+  pixbuf = gtk_icon_info_color_symbolic_mask (icon_info, fg, success_color, warning_color, error_color, error);
 
   if (pixbuf != NULL)
     {
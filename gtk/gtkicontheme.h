@@ -197,6 +197,12 @@ GDK_AVAILABLE_IN_ALL
 void          gtk_icon_theme_set_custom_theme      (GtkIconTheme                *icon_theme,
 						    const gchar                 *theme_name);
 
+GDK_AVAILABLE_IN_ALL
+void          gtk_icon_theme_set_cache_budget      (GtkIconTheme                *icon_theme,
+                                                    gsize                        n_bytes);
+GDK_AVAILABLE_IN_ALL
+gsize         gtk_icon_theme_get_cache_budget      (GtkIconTheme                *icon_theme);
+
 GDK_AVAILABLE_IN_ALL
 gboolean      gtk_icon_theme_has_icon              (GtkIconTheme                *icon_theme,
 						    const gchar                 *icon_name);
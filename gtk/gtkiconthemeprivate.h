@@ -27,4 +27,9 @@ void        gtk_icon_theme_lookup_symbolic_colors       (GtkCssStyle    *style,
                                                          GdkRGBA        *warning_out,
                                                          GdkRGBA        *error_out);
 
+void        gtk_icon_theme_get_cache_stats              (GtkIconTheme   *icon_theme,
+                                                         guint          *hits,
+                                                         guint          *misses,
+                                                         gsize          *n_bytes);
+
 #endif /* __GTK_ICON_THEME_PRIVATE_H__ */
@@ -159,6 +159,7 @@ static void             gtk_icon_view_size_allocate             (GtkWidget
                                                                  int                 baseline);
 static void             gtk_icon_view_snapshot                  (GtkWidget          *widget,
                                                                  GtkSnapshot        *snapshot);
+static void             gtk_icon_view_style_updated             (GtkWidget          *widget);
 static void             gtk_icon_view_motion                    (GtkEventController *controller,
                                                                  double              x,
                                                                  double              y,
@@ -357,6 +358,7 @@ gtk_icon_view_class_init (GtkIconViewClass *klass)
   widget_class->measure = gtk_icon_view_measure;
   widget_class->size_allocate = gtk_icon_view_size_allocate;
   widget_class->snapshot = gtk_icon_view_snapshot;
+  widget_class->style_updated = gtk_icon_view_style_updated;
   widget_class->drag_begin = gtk_icon_view_drag_begin;
   widget_class->drag_end = gtk_icon_view_drag_end;
   widget_class->drag_data_get = gtk_icon_view_drag_data_get;
@@ -953,6 +955,8 @@ gtk_icon_view_init (GtkIconView *icon_view)
 
   icon_view->priv->row_contexts = 
     g_ptr_array_new_with_free_func ((GDestroyNotify)g_object_unref);
+  icon_view->priv->row_sizes = g_array_new (FALSE, FALSE, sizeof (GtkRequestedSize));
+  icon_view->priv->row_offsets = g_array_new (FALSE, FALSE, sizeof (gint));
 
   gtk_style_context_add_class (gtk_widget_get_style_context (GTK_WIDGET (icon_view)),
                                GTK_STYLE_CLASS_VIEW);
@@ -1004,12 +1008,26 @@ gtk_icon_view_dispose (GObject *object)
       priv->cell_area_context = NULL;
     }
 
+  g_clear_object (&priv->height_request_context);
+
   if (priv->row_contexts)
     {
       g_ptr_array_free (priv->row_contexts, TRUE);
       priv->row_contexts = NULL;
     }
 
+  if (priv->row_sizes)
+    {
+      g_array_free (priv->row_sizes, TRUE);
+      priv->row_sizes = NULL;
+    }
+
+  if (priv->row_offsets)
+    {
+      g_array_free (priv->row_offsets, TRUE);
+      priv->row_offsets = NULL;
+    }
+
   if (priv->cell_area)
     {
       gtk_cell_area_stop_editing (icon_view->priv->cell_area, TRUE);
@@ -1385,6 +1403,120 @@ gtk_icon_view_is_empty (GtkIconView *icon_view)
   return icon_view->priv->items == NULL;
 }
 
+/* Adds the widths of the items that are not in
+ * cell_area_context yet.
+ *
+ * The context only ever grows, like it would when all items were
+ * measured again. Widths that got smaller only take effect after
+ * gtk_icon_view_invalidate_sizes().
+ */
+static void
+gtk_icon_view_update_width_context (GtkIconView *icon_view)
+{
+  GtkIconViewPrivate *priv = icon_view->priv;
+  GList *items;
+  gint minimum, natural;
+
+  if (!priv->width_context_valid)
+    {
+      gtk_cell_area_context_reset (priv->cell_area_context);
+
+      for (items = priv->items; items; items = items->next)
+        {
+          GtkIconViewItem *item = items->data;
+
+          _gtk_icon_view_set_cell_data (icon_view, item);
+          if (items == priv->items)
+            adjust_wrap_width (icon_view);
+          cell_area_get_preferred_size (icon_view, priv->cell_area_context,
+                                        GTK_ORIENTATION_HORIZONTAL, -1, NULL, NULL);
+          item->width_requested = TRUE;
+        }
+
+      priv->n_pending_widths = 0;
+      priv->width_context_valid = TRUE;
+    }
+  else if (priv->n_pending_widths > 0)
+    {
+      for (items = priv->items; items && priv->n_pending_widths > 0; items = items->next)
+        {
+          GtkIconViewItem *item = items->data;
+
+          if (item->width_requested)
+            continue;
+
+          _gtk_icon_view_set_cell_data (icon_view, item);
+          cell_area_get_preferred_size (icon_view, priv->cell_area_context,
+                                        GTK_ORIENTATION_HORIZONTAL, -1, NULL, NULL);
+          item->width_requested = TRUE;
+          priv->n_pending_widths--;
+        }
+    }
+
+  gtk_cell_area_context_get_preferred_width (priv->cell_area_context, &minimum, &natural);
+
+  /* Aligned cells make heights and row layouts depend on the widths */
+  if (minimum != priv->context_min_width || natural != priv->context_nat_width)
+    {
+      priv->context_min_width = minimum;
+      priv->context_nat_width = natural;
+      priv->layout_widths_changed = TRUE;
+      g_clear_object (&priv->height_request_context);
+    }
+}
+
+/* Makes height_request_context hold the heights of all items
+ * for @for_size, measuring only items that are not in it yet.
+ */
+static void
+gtk_icon_view_update_height_request_context (GtkIconView *icon_view,
+                                             gint         for_size)
+{
+  GtkIconViewPrivate *priv = icon_view->priv;
+  GList *items;
+
+  if (priv->height_request_context == NULL ||
+      priv->height_request_width != for_size)
+    {
+      g_clear_object (&priv->height_request_context);
+      priv->height_request_context = gtk_cell_area_copy_context (priv->cell_area,
+                                                                 priv->cell_area_context);
+      priv->height_request_width = for_size;
+
+      for (items = priv->items; items; items = items->next)
+        {
+          GtkIconViewItem *item = items->data;
+
+          _gtk_icon_view_set_cell_data (icon_view, item);
+          if (items == priv->items)
+            adjust_wrap_width (icon_view);
+          cell_area_get_preferred_size (icon_view, priv->height_request_context,
+                                        GTK_ORIENTATION_VERTICAL, for_size, NULL, NULL);
+          item->height_requested = TRUE;
+        }
+
+      priv->n_pending_heights = 0;
+    }
+  else if (priv->n_pending_heights > 0)
+    {
+      for (items = priv->items; items && priv->n_pending_heights > 0; items = items->next)
+        {
+          GtkIconViewItem *item = items->data;
+
+          if (item->height_requested)
+            continue;
+
+          _gtk_icon_view_set_cell_data (icon_view, item);
+          cell_area_get_preferred_size (icon_view, priv->height_request_context,
+                                        GTK_ORIENTATION_HORIZONTAL, -1, NULL, NULL);
+          cell_area_get_preferred_size (icon_view, priv->height_request_context,
+                                        GTK_ORIENTATION_VERTICAL, for_size, NULL, NULL);
+          item->height_requested = TRUE;
+          priv->n_pending_heights--;
+        }
+    }
+}
+
 static void
 gtk_icon_view_get_preferred_item_size (GtkIconView    *icon_view,
                                        GtkOrientation  orientation,
@@ -1398,32 +1530,47 @@ gtk_icon_view_get_preferred_item_size (GtkIconView    *icon_view,
 
   g_assert (!gtk_icon_view_is_empty (icon_view));
 
-  context = gtk_cell_area_create_context (priv->cell_area);
-
   for_size -= 2 * priv->item_padding;
 
-  if (for_size > 0)
+  /* The requests layouting needs are collected incrementally */
+  if (orientation == GTK_ORIENTATION_HORIZONTAL && for_size <= 0)
+    {
+      gtk_icon_view_update_width_context (icon_view);
+      context = g_object_ref (priv->cell_area_context);
+    }
+  else if (orientation == GTK_ORIENTATION_VERTICAL && for_size > 0)
     {
-      /* This is necessary for the context to work properly */
+      gtk_icon_view_update_width_context (icon_view);
+      gtk_icon_view_update_height_request_context (icon_view, for_size);
+      context = g_object_ref (priv->height_request_context);
+    }
+  else
+    {
+      context = gtk_cell_area_create_context (priv->cell_area);
+
+      if (for_size > 0)
+        {
+          /* This is necessary for the context to work properly */
+          for (items = priv->items; items; items = items->next)
+            {
+              GtkIconViewItem *item = items->data;
+
+              _gtk_icon_view_set_cell_data (icon_view, item);
+              cell_area_get_preferred_size (icon_view, context, 1 - orientation, -1, NULL, NULL);
+            }
+        }
+
       for (items = priv->items; items; items = items->next)
         {
           GtkIconViewItem *item = items->data;
 
           _gtk_icon_view_set_cell_data (icon_view, item);
-          cell_area_get_preferred_size (icon_view, context, 1 - orientation, -1, NULL, NULL);
+          if (items == priv->items)
+            adjust_wrap_width (icon_view);
+          cell_area_get_preferred_size (icon_view, context, orientation, for_size, NULL, NULL);
         }
     }
 
-  for (items = priv->items; items; items = items->next)
-    {
-      GtkIconViewItem *item = items->data;
-
-      _gtk_icon_view_set_cell_data (icon_view, item);
-      if (items == priv->items)
-        adjust_wrap_width (icon_view);
-      cell_area_get_preferred_size (icon_view, context, orientation, for_size, NULL, NULL);
-    }
-
   if (orientation == GTK_ORIENTATION_HORIZONTAL)
     {
       if (for_size > 0)
@@ -1603,6 +1750,22 @@ gtk_icon_view_measure (GtkWidget *widget,
 }
 
 
+static void
+gtk_icon_view_style_updated (GtkWidget *widget)
+{
+  GtkStyleContext *style_context;
+  GtkCssStyleChange *change;
+
+  GTK_WIDGET_CLASS (gtk_icon_view_parent_class)->style_updated (widget);
+
+  style_context = gtk_widget_get_style_context (widget);
+  change = gtk_style_context_get_change (style_context);
+
+  /* The item sizes kept for layouting depend on the style */
+  if (change == NULL || gtk_css_style_change_affects (change, GTK_CSS_AFFECTS_SIZE))
+    gtk_icon_view_invalidate_sizes (GTK_ICON_VIEW (widget));
+}
+
 static void
 gtk_icon_view_allocate_children (GtkIconView *icon_view)
 {
@@ -2363,6 +2526,8 @@ gtk_icon_view_start_rubberbanding (GtkIconView  *icon_view,
 
       item->selected_before_rubberbanding = item->selected;
     }
+  priv->rubberband_first_row = G_MAXINT;
+  priv->rubberband_last_row = -1;
 
   priv->rubberband_x1 = x + gtk_adjustment_get_value (priv->hadjustment);
   priv->rubberband_y1 = y + gtk_adjustment_get_value (priv->vadjustment);
@@ -2396,23 +2561,75 @@ gtk_icon_view_stop_rubberbanding (GtkIconView *icon_view)
   gtk_widget_queue_draw (GTK_WIDGET (icon_view));
 }
 
+/* Returns the last row whose items start at or above @y */
+static gint
+gtk_icon_view_get_row_at_y (GtkIconView *icon_view,
+                            gint         y)
+{
+  GArray *row_offsets = icon_view->priv->row_offsets;
+  guint lo, hi;
+
+  lo = 0;
+  hi = row_offsets->len;
+  while (lo < hi)
+    {
+      guint mid = lo + (hi - lo) / 2;
+
+      if (g_array_index (row_offsets, gint, mid) <= y)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  return MAX ((gint) lo - 1, 0);
+}
+
 static void
 gtk_icon_view_update_rubberband_selection (GtkIconView *icon_view)
 {
+  GtkIconViewPrivate *priv = icon_view->priv;
   GList *items;
   gint x, y, width, height;
+  gint first_row, last_row, n_items;
   gboolean dirty = FALSE;
   
-  x = MIN (icon_view->priv->rubberband_x1,
-	   icon_view->priv->rubberband_x2);
-  y = MIN (icon_view->priv->rubberband_y1,
-	   icon_view->priv->rubberband_y2);
-  width = ABS (icon_view->priv->rubberband_x1 - 
-	       icon_view->priv->rubberband_x2);
-  height = ABS (icon_view->priv->rubberband_y1 - 
-		icon_view->priv->rubberband_y2);
-  
-  for (items = icon_view->priv->items; items; items = items->next)
+  x = MIN (priv->rubberband_x1,
+	   priv->rubberband_x2);
+  y = MIN (priv->rubberband_y1,
+	   priv->rubberband_y2);
+  width = ABS (priv->rubberband_x1 - 
+	       priv->rubberband_x2);
+  height = ABS (priv->rubberband_y1 - 
+		priv->rubberband_y2);
+
+  /* Only items in the rows that the band covers, or covered at the
+   * last update, can change. Finding them needs an up to date layout,
+   * without one all items are looked at. */
+  if (priv->layout_valid &&
+      priv->layout_dirty_index == G_MAXINT &&
+      priv->row_offsets->len > 0)
+    {
+      first_row = gtk_icon_view_get_row_at_y (icon_view, y);
+      last_row = gtk_icon_view_get_row_at_y (icon_view, y + height);
+
+      items = g_list_nth (priv->items,
+                          MIN (first_row, priv->rubberband_first_row) * priv->layout_n_columns);
+      n_items = (MIN (MAX (last_row, priv->rubberband_last_row), (gint) priv->row_offsets->len - 1) -
+                 MIN (first_row, priv->rubberband_first_row) + 1) * priv->layout_n_columns;
+    }
+  else
+    {
+      first_row = 0;
+      last_row = G_MAXINT;
+
+      items = priv->items;
+      n_items = G_MAXINT;
+    }
+
+  priv->rubberband_first_row = first_row;
+  priv->rubberband_last_row = last_row;
+
+  for (; items && n_items > 0; items = items->next, n_items--)
     {
       GtkIconViewItem *item = items->data;
       gboolean is_in;
@@ -2427,12 +2644,14 @@ gtk_icon_view_update_rubberband_selection (GtkIconView *icon_view)
 	{
 	  item->selected = selected;
 	  dirty = TRUE;
-	  gtk_icon_view_queue_draw_item (icon_view, item);
 	}
     }
 
   if (dirty)
-    g_signal_emit (icon_view, icon_view_signals[SELECTION_CHANGED], 0);
+    {
+      gtk_widget_queue_draw (GTK_WIDGET (icon_view));
+      g_signal_emit (icon_view, icon_view_signals[SELECTION_CHANGED], 0);
+    }
 }
 
 
@@ -2472,6 +2691,12 @@ gtk_icon_view_item_hit_test (GtkIconView      *icon_view,
       MIN (y + height, item_area->y + item_area->height) - MAX (y, item_area->y) <= 0)
     return FALSE;
 
+  /* The cells of an item that is completely inside are hit,
+   * no need to set up the cells and look at them */
+  if (x <= item_area->x && item_area->x + item_area->width <= x + width &&
+      y <= item_area->y && item_area->y + item_area->height <= y + height)
+    return TRUE;
+
   context = g_ptr_array_index (icon_view->priv->row_contexts, item->row);
 
   _gtk_icon_view_set_cell_data (icon_view, item);
@@ -2731,6 +2956,45 @@ compare_sizes (gconstpointer p1,
        - GPOINTER_TO_INT (((const GtkRequestedSize *) p2)->data);
 }
 
+/* Measures the row of @n_columns items starting at @items */
+static GtkCellAreaContext *
+gtk_icon_view_measure_row (GtkIconView      *icon_view,
+                           GList            *items,
+                           gint              n_columns,
+                           gint              item_width,
+                           GtkRequestedSize *size)
+{
+  GtkIconViewPrivate *priv = icon_view->priv;
+  GtkCellAreaContext *context;
+  gint col;
+
+  context = gtk_cell_area_copy_context (priv->cell_area, priv->cell_area_context);
+
+  for (col = 0; col < n_columns && items; col++, items = items->next)
+    {
+      GtkIconViewItem *item = items->data;
+
+      _gtk_icon_view_set_cell_data (icon_view, item);
+      gtk_cell_area_get_preferred_height_for_width (priv->cell_area,
+                                                    context,
+                                                    GTK_WIDGET (icon_view),
+                                                    item_width,
+                                                    NULL, NULL);
+    }
+
+  gtk_cell_area_context_get_preferred_height_for_width (context,
+                                                        item_width,
+                                                        &size->minimum_size,
+                                                        &size->natural_size);
+
+  return context;
+}
+
+/* Layouting is incremental: rows keep their size and context from
+ * the last layout, unless they hold items that changed or come after
+ * an item that was added or removed. Item positions are only updated
+ * from the first row whose position might have changed.
+ */
 static void
 gtk_icon_view_layout (GtkIconView *icon_view)
 {
@@ -2739,9 +3003,10 @@ gtk_icon_view_layout (GtkIconView *icon_view)
   GList *items;
   gint item_width; /* this doesn't include item_padding */
   gint n_columns, n_rows, n_items;
+  gint first_row, first_moved_row;
   gint col, row;
   GtkRequestedSize *sizes;
-  gboolean rtl;
+  gboolean rtl, expanded;
   int width, height;
 
   if (gtk_icon_view_is_empty (icon_view))
@@ -2764,72 +3029,123 @@ gtk_icon_view_layout (GtkIconView *icon_view)
   priv->width += 2 * priv->margin;
   priv->width = MAX (priv->width, width);
 
-  /* Clear the per row contexts */
-  g_ptr_array_set_size (icon_view->priv->row_contexts, 0);
+  gtk_icon_view_update_width_context (icon_view);
 
-  gtk_cell_area_context_reset (priv->cell_area_context);
-  /* because layouting is complicated. We designed an API
-   * that is O(N²) and nonsensical.
-   * And we're proud of it. */
-  for (items = priv->items; items; items = items->next)
+  /* All rows depend on the columns and on the widths of all items */
+  if (!priv->layout_valid ||
+      priv->layout_widths_changed ||
+      n_columns != priv->layout_n_columns ||
+      item_width != priv->layout_item_width)
     {
-      _gtk_icon_view_set_cell_data (icon_view, items->data);
-      gtk_cell_area_get_preferred_width (priv->cell_area,
-                                         priv->cell_area_context,
-                                         widget,
-                                         NULL, NULL);
+      priv->layout_dirty_index = 0;
+      priv->layout_n_columns = n_columns;
+      priv->layout_item_width = item_width;
+      priv->layout_widths_changed = FALSE;
     }
 
-  sizes = g_newa (GtkRequestedSize, n_rows);
+  first_row = MIN (priv->layout_dirty_index / n_columns, n_rows);
+  first_row = MIN (first_row, (gint) priv->row_contexts->len);
+
+  g_ptr_array_set_size (priv->row_contexts, first_row);
+  g_array_set_size (priv->row_sizes, first_row);
+
+  /* because layouting is complicated. We designed an API
+   * that is O(N²) and nonsensical.
+   * And we're proud of it. */
+  first_moved_row = first_row;
   items = priv->items;
   priv->height = priv->margin;
 
-  /* Collect the heights for all rows */
+  /* Collect the heights for the rows that need it */
   for (row = 0; row < n_rows; row++)
     {
-      GtkCellAreaContext *context = gtk_cell_area_copy_context (priv->cell_area, priv->cell_area_context);
-      g_ptr_array_add (priv->row_contexts, context);
+      GtkRequestedSize *size;
 
-      for (col = 0; col < n_columns && items; col++, items = items->next)
+      if (row < first_row)
         {
-          GtkIconViewItem *item = items->data;
+          size = &g_array_index (priv->row_sizes, GtkRequestedSize, row);
 
-          _gtk_icon_view_set_cell_data (icon_view, item);
-          gtk_cell_area_get_preferred_height_for_width (priv->cell_area,
-                                                        context,
-                                                        widget,
-                                                        item_width, 
-                                                        NULL, NULL);
+          /* A row with changed items */
+          if (GPOINTER_TO_INT (size->data) < 0)
+            {
+              GtkRequestedSize old_size = *size;
+
+              size->data = GINT_TO_POINTER (row);
+
+              g_object_unref (g_ptr_array_index (priv->row_contexts, row));
+              g_ptr_array_index (priv->row_contexts, row) =
+                gtk_icon_view_measure_row (icon_view, items, n_columns, item_width, size);
+
+              /* Rows after it only move if its size changed */
+              if (size->minimum_size != old_size.minimum_size ||
+                  size->natural_size != old_size.natural_size)
+                first_moved_row = MIN (first_moved_row, row);
+              else
+                gtk_cell_area_context_allocate (g_ptr_array_index (priv->row_contexts, row),
+                                                item_width, size->minimum_size);
+            }
         }
-      
-      sizes[row].data = GINT_TO_POINTER (row);
-      gtk_cell_area_context_get_preferred_height_for_width (context,
-                                                            item_width,
-                                                            &sizes[row].minimum_size,
-                                                            &sizes[row].natural_size);
-      priv->height += sizes[row].minimum_size + 2 * priv->item_padding + priv->row_spacing;
+      else
+        {
+          GtkRequestedSize new_size;
+
+          g_ptr_array_add (priv->row_contexts,
+                           gtk_icon_view_measure_row (icon_view, items, n_columns, item_width, &new_size));
+          new_size.data = GINT_TO_POINTER (row);
+          g_array_append_val (priv->row_sizes, new_size);
+          size = &g_array_index (priv->row_sizes, GtkRequestedSize, row);
+        }
+
+      priv->height += size->minimum_size + 2 * priv->item_padding + priv->row_spacing;
+
+      for (col = 0; col < n_columns && items; col++)
+        items = items->next;
     }
 
   priv->height -= priv->row_spacing;
   priv->height += priv->margin;
   priv->height = MIN (priv->height, height);
 
-  gtk_distribute_natural_allocation (height - priv->height,
-                                     n_rows,
-                                     sizes);
+  priv->layout_dirty_index = G_MAXINT;
+  priv->layout_valid = TRUE;
 
-  /* Actually allocate the rows */
-  g_qsort_with_data (sizes, n_rows, sizeof (GtkRequestedSize), compare_sizes, NULL);
-  
-  items = priv->items;
+  /* Spare height goes to all rows, moving all of them */
+  expanded = height > priv->height;
+  if (expanded || priv->layout_expanded ||
+      rtl != priv->layout_rtl || priv->width != priv->layout_width)
+    first_moved_row = 0;
+
+  priv->layout_expanded = expanded;
+  priv->layout_rtl = rtl;
+  priv->layout_width = priv->width;
+
+  sizes = g_memdup (priv->row_sizes->data, n_rows * sizeof (GtkRequestedSize));
+
+  if (expanded)
+    {
+      gtk_distribute_natural_allocation (height - priv->height,
+                                         n_rows,
+                                         sizes);
+
+      g_qsort_with_data (sizes, n_rows, sizeof (GtkRequestedSize), compare_sizes, NULL);
+    }
+
+  /* Rows before the first moved row stay where they are */
   priv->height = priv->margin;
+  for (row = 0; row < first_moved_row; row++)
+    priv->height += sizes[row].minimum_size + 2 * priv->item_padding + priv->row_spacing;
 
-  for (row = 0; row < n_rows; row++)
+  items = g_list_nth (priv->items, first_moved_row * n_columns);
+  g_array_set_size (priv->row_offsets, n_rows);
+
+  /* Actually allocate the rows */
+  for (row = first_moved_row; row < n_rows; row++)
     {
       GtkCellAreaContext *context = g_ptr_array_index (priv->row_contexts, row);
       gtk_cell_area_context_allocate (context, item_width, sizes[row].minimum_size);
 
       priv->height += priv->item_padding;
+      g_array_index (priv->row_offsets, gint, row) = priv->height;
 
       for (col = 0; col < n_columns && items; col++, items = items->next)
         {
@@ -2851,6 +3167,8 @@ gtk_icon_view_layout (GtkIconView *icon_view)
       priv->height += sizes[row].minimum_size + priv->item_padding + priv->row_spacing;
     }
 
+  g_free (sizes);
+
   priv->height -= priv->row_spacing;
   priv->height += priv->margin;
   priv->height = MAX (priv->height, height);
@@ -2859,10 +3177,17 @@ gtk_icon_view_layout (GtkIconView *icon_view)
 static void
 gtk_icon_view_invalidate_sizes (GtkIconView *icon_view)
 {
+  GtkIconViewPrivate *priv = icon_view->priv;
+
   /* Clear all item sizes */
   g_list_foreach (icon_view->priv->items,
 		  (GFunc)gtk_icon_view_item_invalidate_size, NULL);
 
+  /* Measure all items again */
+  priv->width_context_valid = FALSE;
+  priv->layout_valid = FALSE;
+  g_clear_object (&priv->height_request_context);
+
   /* Re-layout the items */
   gtk_widget_queue_resize (GTK_WIDGET (icon_view));
 }
@@ -3199,6 +3524,8 @@ gtk_icon_view_row_changed (GtkTreeModel *model,
                            gpointer      data)
 {
   GtkIconView *icon_view = GTK_ICON_VIEW (data);
+  GtkIconViewPrivate *priv = icon_view->priv;
+  GtkIconViewItem *item;
 
   /* ignore changes in branches */
   if (gtk_tree_path_get_depth (path) > 1)
@@ -3211,15 +3538,28 @@ gtk_icon_view_row_changed (GtkTreeModel *model,
   if (icon_view->priv->cell_area)
     gtk_cell_area_stop_editing (icon_view->priv->cell_area, TRUE);
 
-  /* Here we can use a "grow-only" strategy for optimization
-   * and only invalidate a single item and queue a relayout
-   * instead of invalidating the whole thing.
-   *
-   * For now GtkIconView still cant deal with huge models
-   * so just invalidate the whole thing when the model
-   * changes.
+  item = g_list_nth_data (priv->items, gtk_tree_path_get_indices (path)[0]);
+  if (item == NULL)
+    return;
+
+  /* Here we use a "grow-only" strategy: the item's new requests
+   * are added to the ones of all items, and only its row gets
+   * layouted again.
    */
-  gtk_icon_view_invalidate_sizes (icon_view);
+  if (item->width_requested)
+    {
+      item->width_requested = FALSE;
+      priv->n_pending_widths++;
+    }
+  if (item->height_requested)
+    {
+      item->height_requested = FALSE;
+      priv->n_pending_heights++;
+    }
+  if (item->row < (gint) priv->row_sizes->len)
+    g_array_index (priv->row_sizes, GtkRequestedSize, item->row).data = GINT_TO_POINTER (-1);
+
+  gtk_widget_queue_resize (GTK_WIDGET (icon_view));
 
   verify_items (icon_view);
 }
@@ -3247,6 +3587,10 @@ gtk_icon_view_row_inserted (GtkTreeModel *model,
 
   item->index = index;
 
+  icon_view->priv->n_pending_widths++;
+  icon_view->priv->n_pending_heights++;
+  icon_view->priv->layout_dirty_index = MIN (icon_view->priv->layout_dirty_index, index);
+
   /* FIXME: We can be more efficient here,
      we can store a tail pointer and use that when
      appending (which is a rather common operation)
@@ -3305,6 +3649,14 @@ gtk_icon_view_row_deleted (GtkTreeModel *model,
 
   if (item->selected)
     emit = TRUE;
+
+  /* The requests of the item stay in the contexts, see
+   * gtk_icon_view_update_width_context() */
+  if (!item->width_requested)
+    icon_view->priv->n_pending_widths--;
+  if (!item->height_requested)
+    icon_view->priv->n_pending_heights--;
+  icon_view->priv->layout_dirty_index = MIN (icon_view->priv->layout_dirty_index, index);
   
   gtk_icon_view_item_free (item);
 
@@ -3367,6 +3719,9 @@ gtk_icon_view_rows_reordered (GtkTreeModel *model,
   g_list_free (icon_view->priv->items);
   icon_view->priv->items = items;
 
+  /* All rows have other items now */
+  icon_view->priv->layout_dirty_index = 0;
+
   gtk_widget_queue_resize (GTK_WIDGET (icon_view));
 
   verify_items (icon_view);  
@@ -3398,6 +3753,8 @@ gtk_icon_view_build_items (GtkIconView *icon_view)
     } while (gtk_tree_model_iter_next (icon_view->priv->model, &iter));
 
   icon_view->priv->items = g_list_reverse (items);
+  icon_view->priv->n_pending_widths = i;
+  icon_view->priv->n_pending_heights = i;
 }
 
 static void
@@ -4730,6 +5087,8 @@ gtk_icon_view_set_model (GtkIconView *icon_view,
       
       g_list_free_full (icon_view->priv->items, (GDestroyNotify) gtk_icon_view_item_free);
       icon_view->priv->items = NULL;
+      icon_view->priv->n_pending_widths = 0;
+      icon_view->priv->n_pending_heights = 0;
       icon_view->priv->anchor_item = NULL;
       icon_view->priv->cursor_item = NULL;
       icon_view->priv->last_single_clicked = NULL;
@@ -4768,7 +5127,7 @@ gtk_icon_view_set_model (GtkIconView *icon_view,
   if (dirty)
     g_signal_emit (icon_view, icon_view_signals[SELECTION_CHANGED], 0);
 
-  gtk_widget_queue_resize (GTK_WIDGET (icon_view));
+  gtk_icon_view_invalidate_sizes (icon_view);
 }
 
 /**
@@ -35,6 +35,11 @@ struct _GtkIconViewItem
   guint selected : 1;
   guint selected_before_rubberbanding : 1;
 
+  /* Whether the item's requests went into the width context
+   * and into the height request context */
+  guint width_requested : 1;
+  guint height_requested : 1;
+
 };
 
 struct _GtkIconViewPrivate
@@ -48,6 +53,30 @@ struct _GtkIconViewPrivate
 
   GPtrArray          *row_contexts;
 
+  /* Incremental layout: the row sizes of the last layout, with the
+   * row as data, or -1 for rows to measure again. Rows from the one
+   * holding layout_dirty_index on are measured again as well. */
+  GArray             *row_sizes;
+  gint                layout_dirty_index;
+  gint                layout_n_columns;
+  gint                layout_item_width;
+  gint                layout_width;
+
+  /* The y of the items in each row, from the last layout, to find
+   * the rows at a position without looking at the items */
+  GArray             *row_offsets;
+
+  /* cell_area_context collects the widths of all items, only the
+   * n_pending_widths items without width_requested get added to it */
+  gint                context_min_width;
+  gint                context_nat_width;
+  gint                n_pending_widths;
+
+  /* Heights of all items for height_request_width, for measuring */
+  GtkCellAreaContext *height_request_context;
+  gint                height_request_width;
+  gint                n_pending_heights;
+
   gint width, height;
   double mouse_x;
   double mouse_y;
@@ -69,6 +98,7 @@ struct _GtkIconViewPrivate
   gint rubberband_x2, rubberband_y2;
   GdkDevice *rubberband_device;
   GtkCssNode *rubberband_node;
+  gint rubberband_first_row, rubberband_last_row; /* rows the band covered */
 
   guint scroll_timeout_id;
   gint scroll_value_diff;
@@ -134,6 +164,11 @@ struct _GtkIconViewPrivate
 
   guint doing_rubberband : 1;
 
+  guint width_context_valid : 1;
+  guint layout_valid : 1;
+  guint layout_widths_changed : 1;
+  guint layout_rtl : 1;
+  guint layout_expanded : 1;
 };
 
 void                 _gtk_icon_view_set_cell_data                  (GtkIconView            *icon_view,
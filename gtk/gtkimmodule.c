@@ -37,6 +37,7 @@
 #include "gtkmodulesprivate.h"
 #include "gtksettings.h"
 #include "gtkprivate.h"
+#include "gtkstartuptraceprivate.h"
 #include "gtkutilsprivate.h"
 #include "gtkintl.h"
 
@@ -93,6 +94,8 @@ _gtk_im_module_create (const gchar *context_id)
   if (strcmp (context_id, NONE_ID) == 0)
     return NULL;
 
+  gtk_im_modules_init ();
+
   ep = g_io_extension_point_lookup (GTK_IM_MODULE_EXTENSION_POINT_NAME);
   ext = g_io_extension_point_get_extension_by_name (ep, context_id);
   if (ext)
@@ -180,17 +183,8 @@ lookup_immodule (GdkDisplay  *display,
   return NULL;
 }
 
-/**
- * _gtk_im_module_get_default_context_id:
- * @display: The display to look up the module for
- *
- * Return the context_id of the best IM context type 
- * for the given window.
- * 
- * Returns: the context ID (will never be %NULL)
- */
-const gchar *
-_gtk_im_module_get_default_context_id (GdkDisplay *display)
+static const gchar *
+lookup_default_context_id (GdkDisplay *display)
 {
   const gchar *context_id = NULL;
   const gchar *envvar;
@@ -242,6 +236,55 @@ _gtk_im_module_get_default_context_id (GdkDisplay *display)
   return SIMPLE_ID;
 }
 
+static void
+im_module_setting_changed (GtkSettings *settings,
+                           GParamSpec  *pspec,
+                           GdkDisplay  *display)
+{
+  g_object_set_data (G_OBJECT (display), "gtk-im-default-context-id", NULL);
+}
+
+/**
+ * _gtk_im_module_get_default_context_id:
+ * @display: The display to look up the module for
+ *
+ * Return the context_id of the best IM context type 
+ * for the given window.
+ *
+ * The result is remembered for @display until the
+ * #GtkSettings:gtk-im-module setting changes, so that
+ * only the first text widget pays for the lookup.
+ * 
+ * Returns: the context ID (will never be %NULL)
+ */
+const gchar *
+_gtk_im_module_get_default_context_id (GdkDisplay *display)
+{
+  const gchar *context_id;
+  GtkSettings *settings;
+
+  context_id = g_object_get_data (G_OBJECT (display), "gtk-im-default-context-id");
+  if (context_id)
+    return context_id;
+
+  gtk_im_modules_init ();
+
+  settings = gtk_settings_get_for_display (display);
+  if (!g_object_get_data (G_OBJECT (settings), "gtk-im-module-watched"))
+    {
+      g_signal_connect_object (settings, "notify::gtk-im-module",
+                               G_CALLBACK (im_module_setting_changed),
+                               display, 0);
+      g_object_set_data (G_OBJECT (settings), "gtk-im-module-watched", GINT_TO_POINTER (TRUE));
+    }
+
+  /* Extension names live as long as the extension point */
+  context_id = lookup_default_context_id (display);
+  g_object_set_data (G_OBJECT (display), "gtk-im-default-context-id", (gpointer) context_id);
+
+  return context_id;
+}
+
 void
 gtk_im_module_ensure_extension_point (void)
 {
@@ -260,13 +303,28 @@ gtk_im_module_ensure_extension_point (void)
   registered = TRUE;
 }
 
+/**
+ * gtk_im_modules_init:
+ *
+ * Registers the built-in input methods and loads the input method
+ * modules. This happens the first time an input method context is
+ * needed, most applications don't need to call it.
+ */
 void
 gtk_im_modules_init (void)
 {
+  static gboolean initialized = FALSE;
   GIOModuleScope *scope;
+  gint64 trace_start;
   char **paths;
   int i;
 
+  if (initialized)
+    return;
+
+  initialized = TRUE;
+  trace_start = gtk_startup_trace_begin ();
+
   gtk_im_module_ensure_extension_point ();
 
   g_type_ensure (gtk_im_context_simple_get_type ());
@@ -291,9 +349,13 @@ gtk_im_modules_init (void)
   paths = _gtk_get_module_path ("immodules");
   for (i = 0; paths[i]; i++)
     {
+      gint64 trace_start;
+
       GTK_NOTE (MODULES,
                 g_print ("Scanning io modules in %s\n", paths[i]));
+      trace_start = gtk_startup_trace_begin ();
       g_io_modules_scan_all_in_directory_with_scope (paths[i], scope);
+      gtk_startup_trace_end (trace_start, "Scan modules", paths[i]);
     }
   g_strfreev (paths);
 
@@ -314,4 +376,6 @@ gtk_im_modules_init (void)
                    g_type_name (g_io_extension_get_type (ext)));
         }
     }
+
+  gtk_startup_trace_end (trace_start, "Input method modules", NULL);
 }
@@ -317,7 +317,8 @@ gtk_im_multicontext_set_client_widget (GtkIMContext *context,
                         self);
     }
 
-  slave = gtk_im_multicontext_get_slave (self);
+  /* The slave is created on focus-in, most widgets never get there */
+  slave = priv->slave;
   if (slave)
     gtk_im_context_set_client_widget (slave, widget);
 }
@@ -329,7 +330,7 @@ gtk_im_multicontext_get_preedit_string (GtkIMContext   *context,
 					gint           *cursor_pos)
 {
   GtkIMMulticontext *multicontext = GTK_IM_MULTICONTEXT (context);
-  GtkIMContext *slave = gtk_im_multicontext_get_slave (multicontext);
+  GtkIMContext *slave = multicontext->priv->slave;
 
   if (slave)
     gtk_im_context_get_preedit_string (slave, str, attrs, cursor_pos);
@@ -408,7 +409,7 @@ gtk_im_multicontext_focus_out (GtkIMContext   *context)
 {
   GtkIMMulticontext *multicontext = GTK_IM_MULTICONTEXT (context);
   GtkIMMulticontextPrivate *priv = multicontext->priv;
-  GtkIMContext *slave = gtk_im_multicontext_get_slave (multicontext);
+  GtkIMContext *slave = priv->slave;
 
   priv->focus_in = FALSE;
 
@@ -420,7 +421,7 @@ static void
 gtk_im_multicontext_reset (GtkIMContext   *context)
 {
   GtkIMMulticontext *multicontext = GTK_IM_MULTICONTEXT (context);
-  GtkIMContext *slave = gtk_im_multicontext_get_slave (multicontext);
+  GtkIMContext *slave = multicontext->priv->slave;
 
   if (slave)
     gtk_im_context_reset (slave);
@@ -432,7 +433,7 @@ gtk_im_multicontext_set_cursor_location (GtkIMContext   *context,
 {
   GtkIMMulticontext *multicontext = GTK_IM_MULTICONTEXT (context);
   GtkIMMulticontextPrivate *priv = multicontext->priv;
-  GtkIMContext *slave = gtk_im_multicontext_get_slave (multicontext);
+  GtkIMContext *slave = priv->slave;
 
   priv->have_cursor_location = TRUE;
   priv->cursor_location = *area;
@@ -447,7 +448,7 @@ gtk_im_multicontext_set_use_preedit (GtkIMContext   *context,
 {
   GtkIMMulticontext *multicontext = GTK_IM_MULTICONTEXT (context);
   GtkIMMulticontextPrivate *priv = multicontext->priv;
-  GtkIMContext *slave = gtk_im_multicontext_get_slave (multicontext);
+  GtkIMContext *slave = priv->slave;
 
   use_preedit = use_preedit != FALSE;
 
@@ -463,7 +464,7 @@ gtk_im_multicontext_get_surrounding (GtkIMContext  *context,
 				     gint          *cursor_index)
 {
   GtkIMMulticontext *multicontext = GTK_IM_MULTICONTEXT (context);
-  GtkIMContext *slave = gtk_im_multicontext_get_slave (multicontext);
+  GtkIMContext *slave = multicontext->priv->slave;
 
   if (slave)
     return gtk_im_context_get_surrounding (slave, text, cursor_index);
@@ -485,7 +486,7 @@ gtk_im_multicontext_set_surrounding (GtkIMContext *context,
 				     gint          cursor_index)
 {
   GtkIMMulticontext *multicontext = GTK_IM_MULTICONTEXT (context);
-  GtkIMContext *slave = gtk_im_multicontext_get_slave (multicontext);
+  GtkIMContext *slave = multicontext->priv->slave;
 
   if (slave)
     gtk_im_context_set_surrounding (slave, text, len, cursor_index);
@@ -47,6 +47,7 @@
 #include "gtkpango.h"
 #include "gtkprivate.h"
 #include "gtkseparatormenuitem.h"
+#include "gtksettingsprivate.h"
 #include "gtkshow.h"
 #include "gtksnapshot.h"
 #include "gtkstylecontextprivate.h"
@@ -250,6 +251,11 @@
  * the #GtkLabel::activate-link signal and the gtk_label_get_current_uri() function.
  */
 
+/* The number of layouts at other widths than the label's own
+ * layout that are kept around for measuring
+ */
+#define N_MEASURING_LAYOUTS 4
+
 struct _GtkLabelPrivate
 {
   GtkLabelSelectionInfo *select_info;
@@ -259,6 +265,8 @@ struct _GtkLabelPrivate
   PangoAttrList *attrs;
   PangoAttrList *markup_attrs;
   PangoLayout   *layout;
+  /* Copies of layout laid out at different widths, most recently used first */
+  PangoLayout   *measuring_layouts[N_MEASURING_LAYOUTS];
 
   gchar   *label;
   gchar   *text;
@@ -2291,9 +2299,19 @@ gtk_label_get_label (GtkLabel *label)
   return priv->label;
 }
 
+/* A link as it was parsed, the GtkLabelLinks for it are
+ * created for each label that shows the markup */
+typedef struct
+{
+  gchar *uri;
+  gchar *title;
+  gchar *css_class;
+  gint start;
+  gint end;
+} MarkupLink;
+
 typedef struct
 {
-  GtkLabel *label;
   GList *links;
   GString *new_str;
   gsize text_len;
@@ -2308,20 +2326,16 @@ start_element_handler (GMarkupParseContext  *context,
                        GError              **error)
 {
   UriParserData *pdata = user_data;
-  GtkLabelPrivate *priv = gtk_label_get_instance_private (pdata->label);
 
   if (strcmp (element_name, "a") == 0)
     {
-      GtkLabelLink *link;
+      MarkupLink *link;
       const gchar *uri = NULL;
       const gchar *title = NULL;
       const gchar *class = NULL;
-      gboolean visited = FALSE;
       gint line_number;
       gint char_number;
       gint i;
-      GtkCssNode *widget_node;
-      GtkStateFlags state;
 
       g_markup_parse_context_get_position (context, &line_number, &char_number);
 
@@ -2358,41 +2372,10 @@ start_element_handler (GMarkupParseContext  *context,
           return;
         }
 
-      visited = FALSE;
-      if (priv->track_links && priv->select_info)
-        {
-          GList *l;
-          for (l = priv->select_info->links; l; l = l->next)
-            {
-              link = l->data;
-              if (strcmp (uri, link->uri) == 0)
-                {
-                  visited = link->visited;
-                  break;
-                }
-            }
-        }
-
-      link = g_new0 (GtkLabelLink, 1);
+      link = g_new0 (MarkupLink, 1);
       link->uri = g_strdup (uri);
       link->title = g_strdup (title);
-
-      widget_node = gtk_widget_get_css_node (GTK_WIDGET (pdata->label));
-      link->cssnode = gtk_css_node_new ();
-      gtk_css_node_set_name (link->cssnode, I_("link"));
-      gtk_css_node_set_parent (link->cssnode, widget_node);
-      if (class)
-        gtk_css_node_add_class (link->cssnode, g_quark_from_string (class));
-
-      state = gtk_css_node_get_state (widget_node);
-      if (visited)
-        state |= GTK_STATE_FLAG_VISITED;
-      else
-        state |= GTK_STATE_FLAG_LINK;
-      gtk_css_node_set_state (link->cssnode, state);
-      g_object_unref (link->cssnode);
-
-      link->visited = visited;
+      link->css_class = g_strdup (class);
       link->start = pdata->text_len;
       pdata->links = g_list_prepend (pdata->links, link);
     }
@@ -2433,7 +2416,7 @@ end_element_handler (GMarkupParseContext  *context,
 
   if (!strcmp (element_name, "a"))
     {
-      GtkLabelLink *link = pdata->links->data;
+      MarkupLink *link = pdata->links->data;
       link->end = pdata->text_len;
     }
   else
@@ -2484,10 +2467,17 @@ link_free (GtkLabelLink *link)
   g_free (link);
 }
 
+static void
+markup_link_free (MarkupLink *link)
+{
+  g_free (link->uri);
+  g_free (link->title);
+  g_free (link->css_class);
+  g_free (link);
+}
 
 static gboolean
-parse_uri_markup (GtkLabel     *label,
-                  const gchar  *str,
+parse_uri_markup (const gchar  *str,
                   gchar       **new_str,
                   GList       **links,
                   GError      **error)
@@ -2502,7 +2492,6 @@ parse_uri_markup (GtkLabel     *label,
   p = str;
   end = str + length;
 
-  pdata.label = label;
   pdata.links = NULL;
   pdata.new_str = g_string_sized_new (length);
   pdata.text_len = 0;
@@ -2536,100 +2525,132 @@ parse_uri_markup (GtkLabel     *label,
   g_markup_parse_context_free (context);
 
   *new_str = g_string_free (pdata.new_str, FALSE);
-  *links = pdata.links;
+  *links = g_list_reverse (pdata.links);
 
   return TRUE;
 
 failed:
   g_markup_parse_context_free (context);
   g_string_free (pdata.new_str, TRUE);
-  g_list_free_full (pdata.links, (GDestroyNotify) link_free);
+  g_list_free_full (pdata.links, (GDestroyNotify) markup_link_free);
 
   return FALSE;
 }
 
-static void
-gtk_label_ensure_has_tooltip (GtkLabel *label)
+/*
+ * Parsed markup
+ *
+ * Parsing markup takes two passes over it, one for the links and one
+ * by Pango, and labels often get the same markup many times, such as
+ * when updating a value with the same formatting. So the results are
+ * kept in a cache that all labels share, the markup that was parsed
+ * last is kept.
+ */
+
+/* How the markup is parsed, the results differ */
+typedef enum {
+  MARKUP_PLAIN,
+  MARKUP_WITH_ULINE,
+  MARKUP_WITH_HIDDEN_ULINE
+} MarkupMode;
+
+typedef struct
 {
-  GtkLabelPrivate *priv = gtk_label_get_instance_private (label);
-  GList *l;
-  gboolean has_tooltip = FALSE;
+  gchar *markup;
+  MarkupMode mode;
 
-  for (l = priv->select_info->links; l; l = l->next)
-    {
-      GtkLabelLink *link = l->data;
-      if (link->title)
-        {
-          has_tooltip = TRUE;
-          break;
-        }
-    }
+  gchar *text;
+  PangoAttrList *attrs;
+  gunichar accel_char;
+  GList *links;                 /* MarkupLink, in order */
 
-  gtk_widget_set_has_tooltip (GTK_WIDGET (label), has_tooltip);
+  GList lru_link;
+} ParsedMarkup;
+
+#define MARKUP_CACHE_SIZE 256
+/* Longer markup is rarely repeated, and would use too much memory */
+#define MARKUP_CACHE_MAX_LENGTH 1024
+
+static GHashTable *markup_cache;
+/* Most recently used first */
+static GQueue markup_lru = G_QUEUE_INIT;
+
+static guint
+parsed_markup_hash (gconstpointer data)
+{
+  const ParsedMarkup *parsed = data;
+
+  return g_str_hash (parsed->markup) ^ parsed->mode;
+}
+
+static gboolean
+parsed_markup_equal (gconstpointer a,
+                     gconstpointer b)
+{
+  const ParsedMarkup *parsed1 = a;
+  const ParsedMarkup *parsed2 = b;
+
+  return parsed1->mode == parsed2->mode &&
+         strcmp (parsed1->markup, parsed2->markup) == 0;
 }
 
 static void
-gtk_label_set_markup_internal (GtkLabel    *label,
-                               const gchar *str,
-                               gboolean     with_uline)
+parsed_markup_free (ParsedMarkup *parsed)
 {
-  GtkLabelPrivate *priv = gtk_label_get_instance_private (label);
-  gchar *text = NULL;
+  g_free (parsed->markup);
+  g_free (parsed->text);
+  if (parsed->attrs)
+    pango_attr_list_unref (parsed->attrs);
+  g_list_free_full (parsed->links, (GDestroyNotify) markup_link_free);
+  g_slice_free (ParsedMarkup, parsed);
+}
+
+static ParsedMarkup *
+parse_markup (const gchar *str,
+              MarkupMode   mode)
+{
+  ParsedMarkup *parsed;
   GError *error = NULL;
-  PangoAttrList *attrs = NULL;
-  gunichar accel_char = 0;
   gchar *str_for_display = NULL;
   gchar *str_for_accel = NULL;
   GList *links = NULL;
 
-  if (!parse_uri_markup (label, str, &str_for_display, &links, &error))
+  if (!parse_uri_markup (str, &str_for_display, &links, &error))
     {
       g_warning ("Failed to set text '%s' from markup due to error parsing markup: %s",
                  str, error->message);
       g_error_free (error);
-      return;
+      return NULL;
     }
 
-  str_for_accel = g_strdup (str_for_display);
+  parsed = g_slice_new0 (ParsedMarkup);
+  parsed->markup = g_strdup (str);
+  parsed->mode = mode;
+  parsed->links = links;
+  parsed->lru_link.data = parsed;
 
-  if (links)
-    {
-      gtk_label_ensure_select_info (label);
-      priv->select_info->links = g_list_reverse (links);
-      _gtk_label_accessible_update_links (label);
-      gtk_label_ensure_has_tooltip (label);
-    }
+  str_for_accel = g_strdup (str_for_display);
 
-  if (with_uline)
+  if (mode == MARKUP_WITH_HIDDEN_ULINE)
     {
-      gboolean enable_mnemonics = TRUE;
-      gboolean auto_mnemonics = TRUE;
+      gchar *tmp;
+      gchar *pattern;
+      guint key;
 
-      if (!(enable_mnemonics && priv->mnemonics_visible &&
-            (!auto_mnemonics ||
-             (gtk_widget_is_sensitive (GTK_WIDGET (label)) &&
-              (!priv->mnemonic_widget ||
-               gtk_widget_is_sensitive (priv->mnemonic_widget))))))
+      if (separate_uline_pattern (str_for_display, &key, &tmp, &pattern))
         {
-          gchar *tmp;
-          gchar *pattern;
-          guint key;
-
-          if (separate_uline_pattern (str_for_display, &key, &tmp, &pattern))
-            {
-              g_free (str_for_display);
-              str_for_display = tmp;
-              g_free (pattern);
-            }
+          g_free (str_for_display);
+          str_for_display = tmp;
+          g_free (pattern);
         }
     }
 
   /* Extract the text to display */
   if (!pango_parse_markup (str_for_display,
                            -1,
-                           with_uline ? '_' : 0,
-                           &attrs,
-                           &text,
+                           mode != MARKUP_PLAIN ? '_' : 0,
+                           &parsed->attrs,
+                           &parsed->text,
                            NULL,
                            &error))
     {
@@ -2638,45 +2659,230 @@ gtk_label_set_markup_internal (GtkLabel    *label,
       g_free (str_for_display);
       g_free (str_for_accel);
       g_error_free (error);
-      return;
+      parsed_markup_free (parsed);
+      return NULL;
     }
 
   /* Extract the accelerator character */
-  if (with_uline && !pango_parse_markup (str_for_accel,
-					 -1,
-					 '_',
-					 NULL,
-					 NULL,
-					 &accel_char,
-					 &error))
+  if (mode != MARKUP_PLAIN && !pango_parse_markup (str_for_accel,
+                                                   -1,
+                                                   '_',
+                                                   NULL,
+                                                   NULL,
+                                                   &parsed->accel_char,
+                                                   &error))
     {
       g_warning ("Failed to set text from markup due to error parsing markup: %s",
                  error->message);
       g_free (str_for_display);
       g_free (str_for_accel);
       g_error_free (error);
-      return;
+      parsed_markup_free (parsed);
+      return NULL;
     }
 
   g_free (str_for_display);
   g_free (str_for_accel);
 
-  if (text)
-    gtk_label_set_text_internal (label, text);
+  return parsed;
+}
 
-  if (attrs)
+/* Returns: (transfer none) (nullable): the parsed @str,
+ *   owned by the cache */
+static ParsedMarkup *
+lookup_markup (const gchar *str,
+               MarkupMode   mode)
+{
+  ParsedMarkup key = { (gchar *) str, mode, };
+  ParsedMarkup *parsed;
+
+  if (markup_cache == NULL)
+    markup_cache = g_hash_table_new (parsed_markup_hash, parsed_markup_equal);
+
+  parsed = g_hash_table_lookup (markup_cache, &key);
+  if (parsed)
+    {
+      g_queue_unlink (&markup_lru, &parsed->lru_link);
+      g_queue_push_head_link (&markup_lru, &parsed->lru_link);
+      return parsed;
+    }
+
+  parsed = parse_markup (str, mode);
+  if (parsed == NULL)
+    return NULL;
+
+  g_hash_table_add (markup_cache, parsed);
+  g_queue_push_head_link (&markup_lru, &parsed->lru_link);
+
+  if (markup_lru.length > MARKUP_CACHE_SIZE)
+    {
+      ParsedMarkup *oldest = markup_lru.tail->data;
+
+      g_queue_unlink (&markup_lru, &oldest->lru_link);
+      g_hash_table_remove (markup_cache, oldest);
+      parsed_markup_free (oldest);
+    }
+
+  return parsed;
+}
+
+static GList *
+gtk_label_create_links (GtkLabel *label,
+                        GList    *markup_links)
+{
+  GtkLabelPrivate *priv = gtk_label_get_instance_private (label);
+  GtkCssNode *widget_node;
+  GList *links = NULL;
+  GList *l;
+
+  widget_node = gtk_widget_get_css_node (GTK_WIDGET (label));
+
+  for (l = markup_links; l; l = l->next)
+    {
+      MarkupLink *markup_link = l->data;
+      GtkLabelLink *link;
+      GtkStateFlags state;
+      gboolean visited = FALSE;
+
+      if (priv->track_links && priv->select_info)
+        {
+          GList *old;
+
+          for (old = priv->select_info->links; old; old = old->next)
+            {
+              GtkLabelLink *old_link = old->data;
+
+              if (strcmp (markup_link->uri, old_link->uri) == 0)
+                {
+                  visited = old_link->visited;
+                  break;
+                }
+            }
+        }
+
+      link = g_new0 (GtkLabelLink, 1);
+      link->uri = g_strdup (markup_link->uri);
+      link->title = g_strdup (markup_link->title);
+
+      link->cssnode = gtk_css_node_new ();
+      gtk_css_node_set_name (link->cssnode, I_("link"));
+      gtk_css_node_set_parent (link->cssnode, widget_node);
+      if (markup_link->css_class)
+        gtk_css_node_add_class (link->cssnode, g_quark_from_string (markup_link->css_class));
+
+      state = gtk_css_node_get_state (widget_node);
+      if (visited)
+        state |= GTK_STATE_FLAG_VISITED;
+      else
+        state |= GTK_STATE_FLAG_LINK;
+      gtk_css_node_set_state (link->cssnode, state);
+      g_object_unref (link->cssnode);
+
+      link->visited = visited;
+      link->start = markup_link->start;
+      link->end = markup_link->end;
+      links = g_list_prepend (links, link);
+    }
+
+  return g_list_reverse (links);
+}
+
+static void
+gtk_label_ensure_has_tooltip (GtkLabel *label)
+{
+  GtkLabelPrivate *priv = gtk_label_get_instance_private (label);
+  GList *l;
+  gboolean has_tooltip = FALSE;
+
+  for (l = priv->select_info->links; l; l = l->next)
+    {
+      GtkLabelLink *link = l->data;
+      if (link->title)
+        {
+          has_tooltip = TRUE;
+          break;
+        }
+    }
+
+  gtk_widget_set_has_tooltip (GTK_WIDGET (label), has_tooltip);
+}
+
+static void
+gtk_label_apply_markup (GtkLabel     *label,
+                        ParsedMarkup *parsed)
+{
+  GtkLabelPrivate *priv = gtk_label_get_instance_private (label);
+
+  if (parsed->links)
+    {
+      gtk_label_ensure_select_info (label);
+      priv->select_info->links = gtk_label_create_links (label, parsed->links);
+      _gtk_label_accessible_update_links (label);
+      gtk_label_ensure_has_tooltip (label);
+    }
+
+  if (parsed->text)
+    gtk_label_set_text_internal (label, g_strdup (parsed->text));
+
+  /* The attributes are shared with the cache and other labels */
+  if (parsed->attrs)
     {
       if (priv->markup_attrs)
-	pango_attr_list_unref (priv->markup_attrs);
-      priv->markup_attrs = attrs;
+        pango_attr_list_unref (priv->markup_attrs);
+      priv->markup_attrs = pango_attr_list_ref (parsed->attrs);
     }
 
-  if (accel_char != 0)
-    priv->mnemonic_keyval = gdk_keyval_to_lower (gdk_unicode_to_keyval (accel_char));
+  if (parsed->accel_char != 0)
+    priv->mnemonic_keyval = gdk_keyval_to_lower (gdk_unicode_to_keyval (parsed->accel_char));
   else
     priv->mnemonic_keyval = GDK_KEY_VoidSymbol;
 }
 
+static void
+gtk_label_set_markup_internal (GtkLabel    *label,
+                               const gchar *str,
+                               gboolean     with_uline)
+{
+  GtkLabelPrivate *priv = gtk_label_get_instance_private (label);
+  ParsedMarkup *parsed;
+  MarkupMode mode;
+
+  if (!with_uline)
+    mode = MARKUP_PLAIN;
+  else
+    {
+      gboolean enable_mnemonics = TRUE;
+      gboolean auto_mnemonics = TRUE;
+
+      if (!(enable_mnemonics && priv->mnemonics_visible &&
+            (!auto_mnemonics ||
+             (gtk_widget_is_sensitive (GTK_WIDGET (label)) &&
+              (!priv->mnemonic_widget ||
+               gtk_widget_is_sensitive (priv->mnemonic_widget))))))
+        mode = MARKUP_WITH_HIDDEN_ULINE;
+      else
+        mode = MARKUP_WITH_ULINE;
+    }
+
+  if (strlen (str) <= MARKUP_CACHE_MAX_LENGTH)
+    {
+      parsed = lookup_markup (str, mode);
+      if (parsed == NULL)
+        return;
+
+      gtk_label_apply_markup (label, parsed);
+    }
+  else
+    {
+      parsed = parse_markup (str, mode);
+      if (parsed == NULL)
+        return;
+
+      gtk_label_apply_markup (label, parsed);
+      parsed_markup_free (parsed);
+    }
+}
+
 /**
  * gtk_label_set_markup:
  * @label: a #GtkLabel
@@ -3184,7 +3390,7 @@ gtk_label_finalize (GObject *object)
   g_free (priv->label);
   g_free (priv->text);
 
-  g_clear_object (&priv->layout);
+  gtk_label_clear_layout (label);
   g_clear_pointer (&priv->attrs, pango_attr_list_unref);
   g_clear_pointer (&priv->markup_attrs, pango_attr_list_unref);
 
@@ -3199,12 +3405,62 @@ gtk_label_finalize (GObject *object)
   G_OBJECT_CLASS (gtk_label_parent_class)->finalize (object);
 }
 
+static void
+gtk_label_clear_measuring_layouts (GtkLabel *label)
+{
+  GtkLabelPrivate *priv = gtk_label_get_instance_private (label);
+  int i;
+
+  for (i = 0; i < N_MEASURING_LAYOUTS; i++)
+    g_clear_object (&priv->measuring_layouts[i]);
+}
+
 static void
 gtk_label_clear_layout (GtkLabel *label)
 {
   GtkLabelPrivate *priv = gtk_label_get_instance_private (label);
 
   g_clear_object (&priv->layout);
+  gtk_label_clear_measuring_layouts (label);
+}
+
+/* Finds a measuring layout that has been laid out at @width
+ * and moves it to the front. */
+static PangoLayout *
+gtk_label_find_measuring_layout (GtkLabel *label,
+                                 int       width)
+{
+  GtkLabelPrivate *priv = gtk_label_get_instance_private (label);
+  PangoLayout *layout;
+  int i;
+
+  for (i = 0; i < N_MEASURING_LAYOUTS && priv->measuring_layouts[i]; i++)
+    {
+      layout = priv->measuring_layouts[i];
+      if (pango_layout_get_width (layout) != width)
+        continue;
+
+      memmove (&priv->measuring_layouts[1], &priv->measuring_layouts[0],
+               i * sizeof (PangoLayout *));
+      priv->measuring_layouts[0] = layout;
+
+      return layout;
+    }
+
+  return NULL;
+}
+
+/* Adds @layout at the front, dropping the least recently used one */
+static void
+gtk_label_add_measuring_layout (GtkLabel    *label,
+                                PangoLayout *layout)
+{
+  GtkLabelPrivate *priv = gtk_label_get_instance_private (label);
+
+  g_clear_object (&priv->measuring_layouts[N_MEASURING_LAYOUTS - 1]);
+  memmove (&priv->measuring_layouts[1], &priv->measuring_layouts[0],
+           (N_MEASURING_LAYOUTS - 1) * sizeof (PangoLayout *));
+  priv->measuring_layouts[0] = layout;
 }
 
 /**
@@ -3218,6 +3474,10 @@ gtk_label_clear_layout (GtkLabel *label)
  * layout’s width, which will be set to @width. Do not modify the returned
  * layout.
  *
+ * Layouts at other widths are kept around, so that measuring the
+ * same widths again, when allocating or on the next resize, does not
+ * need to lay out the text again.
+ *
  * Returns: a new reference to a pango layout
  **/
 static PangoLayout *
@@ -3230,15 +3490,7 @@ gtk_label_get_measuring_layout (GtkLabel *   label,
   PangoLayout *copy;
 
   if (existing_layout != NULL)
-    {
-      if (existing_layout != priv->layout)
-        {
-          pango_layout_set_width (existing_layout, width);
-          return existing_layout;
-        }
-
-      g_object_unref (existing_layout);
-    }
+    g_object_unref (existing_layout);
 
   gtk_label_ensure_layout (label);
 
@@ -3273,9 +3525,15 @@ gtk_label_get_measuring_layout (GtkLabel *   label,
       return priv->layout;
     }
 
-  copy = pango_layout_copy (priv->layout);
-  pango_layout_set_width (copy, width);
-  return copy;
+  copy = gtk_label_find_measuring_layout (label, width);
+  if (copy == NULL)
+    {
+      copy = pango_layout_copy (priv->layout);
+      pango_layout_set_width (copy, width);
+      gtk_label_add_measuring_layout (label, copy);
+    }
+
+  return g_object_ref (copy);
 }
 
 static void
@@ -3287,6 +3545,8 @@ gtk_label_update_layout_attributes (GtkLabel *label)
   PangoAttrList *attrs;
   PangoAttrList *style_attrs;
 
+  gtk_label_clear_measuring_layouts (label);
+
   if (priv->layout == NULL)
     return;
 
@@ -3424,6 +3684,33 @@ get_height_for_width (GtkLabel *label,
   g_object_unref (layout);
 }
 
+/*
+ * _gtk_label_foreach_layout:
+ * @label: a #GtkLabel
+ * @func: function to call for each layout
+ * @data: user data for @func
+ *
+ * Calls @func for the layout and the measuring layouts that @label
+ * holds on to, without creating any of them.
+ */
+void
+_gtk_label_foreach_layout (GtkLabel *label,
+                           GFunc     func,
+                           gpointer  data)
+{
+  GtkLabelPrivate *priv = gtk_label_get_instance_private (label);
+  guint i;
+
+  if (priv->layout)
+    func (priv->layout, data);
+
+  for (i = 0; i < N_MEASURING_LAYOUTS; i++)
+    {
+      if (priv->measuring_layouts[i])
+        func (priv->measuring_layouts[i], data);
+    }
+}
+
 static gint
 get_char_pixels (GtkWidget   *label,
                  PangoLayout *layout)
@@ -3587,8 +3874,6 @@ gtk_label_measure (GtkWidget      *widget,
 
   if (orientation == GTK_ORIENTATION_VERTICAL && for_size != -1 && priv->wrap)
     {
-      gtk_label_clear_layout (label);
-
       get_height_for_width (label, for_size, minimum, natural, minimum_baseline, natural_baseline);
     }
   else
@@ -3670,13 +3955,30 @@ gtk_label_size_allocate (GtkWidget *widget,
 {
   GtkLabel *label = GTK_LABEL (widget);
   GtkLabelPrivate *priv = gtk_label_get_instance_private (label);
+  PangoLayout *measured;
+  int layout_width;
 
   if (priv->layout)
     {
       if (priv->ellipsize || priv->wrap)
-        pango_layout_set_width (priv->layout, width * PANGO_SCALE);
+        layout_width = width * PANGO_SCALE;
+      else
+        layout_width = -1;
+
+      if (pango_layout_get_width (priv->layout) == layout_width)
+        return;
+
+      /* Measuring has most likely laid out the text at this width
+       * already, so swap that layout in instead of redoing it.
+       */
+      measured = gtk_label_find_measuring_layout (label, layout_width);
+      if (measured)
+        {
+          priv->measuring_layouts[0] = priv->layout;
+          priv->layout = measured;
+        }
       else
-        pango_layout_set_width (priv->layout, -1);
+        pango_layout_set_width (priv->layout, layout_width);
     }
 }
 
@@ -5610,9 +5912,7 @@ get_better_cursor (GtkLabel *label,
   gboolean split_cursor;
   PangoRectangle strong_pos, weak_pos;
   
-  g_object_get (gtk_widget_get_settings (GTK_WIDGET (label)),
-		"gtk-split-cursor", &split_cursor,
-		NULL);
+  split_cursor = gtk_settings_get_values (gtk_widget_get_settings (GTK_WIDGET (label)))->split_cursor;
 
   gtk_label_ensure_layout (label);
   
@@ -5700,9 +6000,7 @@ gtk_label_move_visually (GtkLabel *label,
 
       gtk_label_ensure_layout (label);
 
-      g_object_get (gtk_widget_get_settings (GTK_WIDGET (label)),
-		    "gtk-split-cursor", &split_cursor,
-		    NULL);
+      split_cursor = gtk_settings_get_values (gtk_widget_get_settings (GTK_WIDGET (label)))->split_cursor;
 
       if (split_cursor)
 	strong = TRUE;
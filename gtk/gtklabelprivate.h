@@ -44,6 +44,10 @@ gboolean     _gtk_label_get_link_visited (GtkLabel *label,
                                           gint      idx);
 gboolean     _gtk_label_get_link_focused (GtkLabel *label,
                                           gint      idx);
+
+void         _gtk_label_foreach_layout        (GtkLabel     *label,
+                                               GFunc         func,
+                                               gpointer      data);
                              
 G_END_DECLS
 
@@ -28,6 +28,7 @@
 #include "gtkdnd.h"
 #include "gtkgesturemultipress.h"
 #include "gtkintl.h"
+#include "gtklistmodelitemsprivate.h"
 #include "gtkmain.h"
 #include "gtkmarshalers.h"
 #include "gtkprivate.h"
@@ -123,6 +124,28 @@ typedef struct
   GtkListBoxCreateWidgetFunc create_widget_func;
   gpointer create_widget_func_data;
   GDestroyNotify create_widget_func_data_destroy;
+
+  /* Rows of the bound model that were removed, by the type of item
+   * they showed, kept until the main loop is idle so that items that
+   * are added again in the meantime can reuse them.
+   */
+  GtkListBoxRebindWidgetFunc rebind_widget_func;
+  gpointer rebind_widget_func_data;
+  GDestroyNotify rebind_widget_func_data_destroy;
+  GHashTable *row_pool;
+  guint row_pool_idle_id;
+
+  /* Virtual rows: only the items of the bound model around the
+   * visible part of the adjustment have a row in children, starting
+   * with the item at virtual_first. The heights of all other items
+   * are remembered from when they had a row, or estimated.
+   */
+  gboolean virtual_rows;
+  GArray *item_heights;
+  gint64 measured_height_sum;
+  guint n_measured_heights;
+  guint virtual_first;
+  guint virtual_tick_id;
 } GtkListBoxPrivate;
 
 typedef struct
@@ -132,10 +155,12 @@ typedef struct
   GtkActionHelper *action_helper;
   gint y;
   gint height;
+  GType item_type;  /* of the bound model item the row shows */
   guint visible     :1;
   guint selected    :1;
   guint activatable :1;
   guint selectable  :1;
+  guint wrapped     :1;  /* created by the box around the widget */
 } GtkListBoxRowPrivate;
 
 enum {
@@ -160,6 +185,7 @@ enum {
   PROP_SELECTION_MODE,
   PROP_ACTIVATE_ON_SINGLE_CLICK,
   PROP_ACCEPT_UNPAIRED_RELEASE,
+  PROP_VIRTUAL_ROWS,
   LAST_PROPERTY
 };
 
@@ -176,6 +202,11 @@ enum {
 };
 
 #define BOX_PRIV(box) ((GtkListBoxPrivate*)gtk_list_box_get_instance_private ((GtkListBox*)(box)))
+
+/* Height assumed for items that never had a row, before any row got measured */
+#define DEFAULT_ESTIMATED_ROW_HEIGHT 32
+/* How many items to get from the bound model at once */
+#define N_BATCH_ITEMS 64
 #define ROW_PRIV(row) ((GtkListBoxRowPrivate*)gtk_list_box_row_get_instance_private ((GtkListBoxRow*)(row)))
 
 static GtkBuildableIface *parent_buildable_iface;
@@ -277,6 +308,9 @@ static void gtk_list_box_update_row_styles (GtkListBox    *box);
 static void gtk_list_box_update_row_style  (GtkListBox    *box,
                                             GtkListBoxRow *row);
 
+static void                 gtk_list_box_update_virtual_rows            (GtkListBox          *box);
+static void                 gtk_list_box_queue_update_virtual_rows      (GtkListBox          *box);
+static void                 gtk_list_box_clear_row_pool                 (GtkListBox          *box);
 static void                 gtk_list_box_bound_model_changed            (GListModel          *list,
                                                                          guint                position,
                                                                          guint                removed,
@@ -332,6 +366,9 @@ gtk_list_box_get_property (GObject    *obj,
     case PROP_ACCEPT_UNPAIRED_RELEASE:
       g_value_set_boolean (value, priv->accept_unpaired_release);
       break;
+    case PROP_VIRTUAL_ROWS:
+      g_value_set_boolean (value, priv->virtual_rows);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (obj, property_id, pspec);
       break;
@@ -357,6 +394,9 @@ gtk_list_box_set_property (GObject      *obj,
     case PROP_ACCEPT_UNPAIRED_RELEASE:
       gtk_list_box_set_accept_unpaired_release (box, g_value_get_boolean (value));
       break;
+    case PROP_VIRTUAL_ROWS:
+      gtk_list_box_set_virtual_rows (box, g_value_get_boolean (value));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (obj, property_id, pspec);
       break;
@@ -375,11 +415,16 @@ gtk_list_box_finalize (GObject *obj)
   if (priv->update_header_func_target_destroy_notify != NULL)
     priv->update_header_func_target_destroy_notify (priv->update_header_func_target);
 
-  g_clear_object (&priv->adjustment);
+  if (priv->adjustment)
+    {
+      g_signal_handlers_disconnect_by_func (priv->adjustment, gtk_list_box_queue_update_virtual_rows, obj);
+      g_clear_object (&priv->adjustment);
+    }
   g_clear_object (&priv->drag_highlighted_row);
 
   g_sequence_free (priv->children);
   g_hash_table_unref (priv->header_hash);
+  g_array_unref (priv->item_heights);
 
   if (priv->bound_model)
     {
@@ -390,6 +435,11 @@ gtk_list_box_finalize (GObject *obj)
       g_clear_object (&priv->bound_model);
     }
 
+  gtk_list_box_clear_row_pool (GTK_LIST_BOX (obj));
+  g_clear_pointer (&priv->row_pool, g_hash_table_unref);
+  if (priv->rebind_widget_func_data_destroy)
+    priv->rebind_widget_func_data_destroy (priv->rebind_widget_func_data);
+
   G_OBJECT_CLASS (gtk_list_box_parent_class)->finalize (obj);
 }
 
@@ -446,6 +496,21 @@ gtk_list_box_class_init (GtkListBoxClass *klass)
                           FALSE,
                           G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * GtkListBox:virtual-rows:
+   *
+   * Whether rows for the items of a bound model are only created
+   * around the visible part of the list.
+   *
+   * See gtk_list_box_set_virtual_rows().
+   */
+  properties[PROP_VIRTUAL_ROWS] =
+    g_param_spec_boolean ("virtual-rows",
+                          P_("Virtual rows"),
+                          P_("Whether rows are only created for visible items of the bound model"),
+                          FALSE,
+                          G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_install_properties (object_class, LAST_PROPERTY, properties);
 
   /**
@@ -617,6 +682,7 @@ gtk_list_box_init (GtkListBox *box)
 
   priv->children = g_sequence_new (NULL);
   priv->header_hash = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL, NULL);
+  priv->item_heights = g_array_new (FALSE, FALSE, sizeof (gint));
 
   gesture = gtk_gesture_multi_press_new ();
   gtk_event_controller_set_propagation_phase (GTK_EVENT_CONTROLLER (gesture),
@@ -667,17 +733,30 @@ gtk_list_box_get_selected_row (GtkListBox *box)
  * If @_index is negative or larger than the number of items in the
  * list, %NULL is returned.
  *
+ * When #GtkListBox:virtual-rows is set, %NULL is also returned
+ * for items that currently don't have a row.
+ *
  * Returns: (transfer none) (nullable): the child #GtkWidget or %NULL
  */
 GtkListBoxRow *
 gtk_list_box_get_row_at_index (GtkListBox *box,
                                gint        index_)
 {
+  GtkListBoxPrivate *priv;
   GSequenceIter *iter;
 
   g_return_val_if_fail (GTK_IS_LIST_BOX (box), NULL);
 
-  iter = g_sequence_get_iter_at_pos (BOX_PRIV (box)->children, index_);
+  priv = BOX_PRIV (box);
+
+  if (priv->virtual_rows && priv->bound_model)
+    {
+      if (index_ < (gint) priv->virtual_first)
+        return NULL;
+      index_ -= priv->virtual_first;
+    }
+
+  iter = g_sequence_get_iter_at_pos (priv->children, index_);
   if (!g_sequence_iter_is_end (iter))
     return g_sequence_get (iter);
 
@@ -957,8 +1036,21 @@ gtk_list_box_set_adjustment (GtkListBox    *box,
   if (adjustment)
     g_object_ref_sink (adjustment);
   if (priv->adjustment)
-    g_object_unref (priv->adjustment);
+    {
+      g_signal_handlers_disconnect_by_func (priv->adjustment, gtk_list_box_queue_update_virtual_rows, box);
+      g_object_unref (priv->adjustment);
+    }
   priv->adjustment = adjustment;
+
+  if (adjustment)
+    {
+      g_signal_connect_swapped (adjustment, "value-changed",
+                                G_CALLBACK (gtk_list_box_queue_update_virtual_rows), box);
+      g_signal_connect_swapped (adjustment, "changed",
+                                G_CALLBACK (gtk_list_box_queue_update_virtual_rows), box);
+    }
+
+  gtk_list_box_queue_update_virtual_rows (box);
 }
 
 /**
@@ -2391,6 +2483,95 @@ gtk_list_box_child_type (GtkContainer *container)
   return GTK_TYPE_LIST_BOX_ROW;
 }
 
+static int
+gtk_list_box_get_estimated_height (GtkListBox *box)
+{
+  GtkListBoxPrivate *priv = BOX_PRIV (box);
+
+  if (priv->n_measured_heights == 0)
+    return DEFAULT_ESTIMATED_ROW_HEIGHT;
+
+  return priv->measured_height_sum / priv->n_measured_heights;
+}
+
+static inline int
+gtk_list_box_get_item_height (GtkListBox *box,
+                              guint       position,
+                              int         estimate)
+{
+  int height = g_array_index (BOX_PRIV (box)->item_heights, gint, position);
+
+  return height >= 0 ? height : estimate;
+}
+
+/* Sums the heights of the items from @start to @end,
+ * including their headers.
+ */
+static int
+gtk_list_box_get_items_height (GtkListBox *box,
+                               guint       start,
+                               guint       end)
+{
+  GtkListBoxPrivate *priv = BOX_PRIV (box);
+  int estimate;
+  int height;
+  guint i;
+
+  if (end - start == priv->item_heights->len && start == 0)
+    return priv->measured_height_sum +
+           (priv->item_heights->len - priv->n_measured_heights) * gtk_list_box_get_estimated_height (box);
+
+  estimate = gtk_list_box_get_estimated_height (box);
+  height = 0;
+  for (i = start; i < end; i++)
+    height += gtk_list_box_get_item_height (box, i, estimate);
+
+  return height;
+}
+
+/* Remembers the height of a virtual row, returns whether it changed */
+static gboolean
+gtk_list_box_set_item_height (GtkListBox *box,
+                              guint       position,
+                              int         height)
+{
+  GtkListBoxPrivate *priv = BOX_PRIV (box);
+  gint *item_height = &g_array_index (priv->item_heights, gint, position);
+
+  if (*item_height == height)
+    return FALSE;
+
+  if (*item_height < 0)
+    priv->n_measured_heights++;
+  else
+    priv->measured_height_sum -= *item_height;
+
+  priv->measured_height_sum += height;
+  *item_height = height;
+
+  return TRUE;
+}
+
+static void
+gtk_list_box_forget_item_heights (GtkListBox *box,
+                                  guint       position,
+                                  guint       n_items)
+{
+  GtkListBoxPrivate *priv = BOX_PRIV (box);
+  guint i;
+
+  for (i = position; i < position + n_items; i++)
+    {
+      gint height = g_array_index (priv->item_heights, gint, i);
+
+      if (height >= 0)
+        {
+          priv->measured_height_sum -= height;
+          priv->n_measured_heights--;
+        }
+    }
+}
+
 static GtkSizeRequestMode
 gtk_list_box_get_request_mode (GtkWidget *widget)
 {
@@ -2406,6 +2587,7 @@ gtk_list_box_measure (GtkWidget     *widget,
                       int            *minimum_baseline,
                       int            *natural_baseline)
 {
+  GtkListBox *box = GTK_LIST_BOX (widget);
   GtkListBoxPrivate *priv = BOX_PRIV (widget);
   GSequenceIter *iter;
 
@@ -2468,6 +2650,14 @@ gtk_list_box_measure (GtkWidget     *widget,
                             minimum, NULL,
                             NULL, NULL);
 
+      if (priv->virtual_rows && priv->bound_model)
+        {
+          /* Rows that exist are accounted for by their last allocation */
+          *minimum += gtk_list_box_get_items_height (box, 0, priv->item_heights->len);
+          *natural = *minimum;
+          return;
+        }
+
       for (iter = g_sequence_get_begin_iter (priv->children);
            !g_sequence_iter_is_end (iter);
            iter = g_sequence_iter_next (iter))
@@ -2512,6 +2702,10 @@ gtk_list_box_size_allocate (GtkWidget *widget,
   GtkListBoxRow *row;
   GSequenceIter *iter;
   int child_min;
+  gboolean virtual_rows;
+  gboolean heights_changed;
+  guint position;
+  int item_y;
 
 
   child_allocation.x = 0;
@@ -2535,15 +2729,25 @@ gtk_list_box_size_allocate (GtkWidget *widget,
       child_allocation.y += child_min;
     }
 
+  virtual_rows = priv->virtual_rows && priv->bound_model;
+  heights_changed = FALSE;
+  position = priv->virtual_first;
+  if (virtual_rows)
+    child_allocation.y += gtk_list_box_get_items_height (GTK_LIST_BOX (widget), 0, priv->virtual_first);
+
   for (iter = g_sequence_get_begin_iter (priv->children);
        !g_sequence_iter_is_end (iter);
-       iter = g_sequence_iter_next (iter))
+       iter = g_sequence_iter_next (iter), position++)
     {
       row = g_sequence_get (iter);
+      item_y = child_allocation.y;
+
       if (!row_is_visible (row))
         {
           ROW_PRIV (row)->y = child_allocation.y;
           ROW_PRIV (row)->height = 0;
+          if (virtual_rows)
+            heights_changed |= gtk_list_box_set_item_height (GTK_LIST_BOX (widget), position, 0);
           continue;
         }
 
@@ -2570,7 +2774,15 @@ gtk_list_box_size_allocate (GtkWidget *widget,
       ROW_PRIV (row)->height = child_allocation.height;
       gtk_widget_size_allocate (GTK_WIDGET (row), &child_allocation, -1);
       child_allocation.y += child_min;
+
+      if (virtual_rows)
+        heights_changed |= gtk_list_box_set_item_height (GTK_LIST_BOX (widget), position,
+                                                         child_allocation.y - item_y);
     }
+
+  /* The rows we made fit the viewport with the old heights */
+  if (heights_changed)
+    gtk_list_box_queue_update_virtual_rows (GTK_LIST_BOX (widget));
 }
 
 /**
@@ -2621,6 +2833,7 @@ gtk_list_box_insert (GtkListBox *box,
     {
       row = GTK_LIST_BOX_ROW (gtk_list_box_row_new ());
       gtk_container_add (GTK_CONTAINER (row), child);
+      ROW_PRIV (row)->wrapped = TRUE;
     }
 
   if (priv->sort_func != NULL)
@@ -3087,7 +3300,15 @@ gtk_list_box_row_get_index (GtkListBoxRow *row)
   priv = ROW_PRIV (row);
 
   if (priv->iter != NULL)
-    return g_sequence_iter_get_position (priv->iter);
+    {
+      GtkListBox *box = gtk_list_box_row_get_box (row);
+      gint index = g_sequence_iter_get_position (priv->iter);
+
+      if (box && BOX_PRIV (box)->virtual_rows && BOX_PRIV (box)->bound_model)
+        index += BOX_PRIV (box)->virtual_first;
+
+      return index;
+    }
 
   return -1;
 }
@@ -3473,6 +3694,348 @@ gtk_list_box_buildable_interface_init (GtkBuildableIface *iface)
   iface->add_child = gtk_list_box_buildable_add_child;
 }
 
+static void
+gtk_list_box_clear_row_pool (GtkListBox *box)
+{
+  GtkListBoxPrivate *priv = BOX_PRIV (box);
+
+  if (priv->row_pool_idle_id != 0)
+    {
+      g_source_remove (priv->row_pool_idle_id);
+      priv->row_pool_idle_id = 0;
+    }
+
+  if (priv->row_pool)
+    g_hash_table_remove_all (priv->row_pool);
+}
+
+static gboolean
+gtk_list_box_row_pool_idle (gpointer user_data)
+{
+  GtkListBox *box = user_data;
+
+  BOX_PRIV (box)->row_pool_idle_id = 0;
+  gtk_list_box_clear_row_pool (box);
+
+  return G_SOURCE_REMOVE;
+}
+
+static void
+row_queue_free (gpointer data)
+{
+  g_queue_free_full (data, g_object_unref);
+}
+
+/* Called for rows of the bound model before they are removed */
+static void
+gtk_list_box_pool_row (GtkListBox    *box,
+                       GtkListBoxRow *row)
+{
+  GtkListBoxPrivate *priv = BOX_PRIV (box);
+  GType item_type = ROW_PRIV (row)->item_type;
+  GQueue *queue;
+
+  if (priv->rebind_widget_func == NULL || item_type == G_TYPE_INVALID)
+    return;
+
+  if (priv->row_pool == NULL)
+    priv->row_pool = g_hash_table_new_full (NULL, NULL, NULL, row_queue_free);
+
+  queue = g_hash_table_lookup (priv->row_pool, GSIZE_TO_POINTER (item_type));
+  if (queue == NULL)
+    {
+      queue = g_queue_new ();
+      g_hash_table_insert (priv->row_pool, GSIZE_TO_POINTER (item_type), queue);
+    }
+
+  g_queue_push_tail (queue, g_object_ref (row));
+
+  if (priv->row_pool_idle_id == 0)
+    {
+      priv->row_pool_idle_id = g_idle_add (gtk_list_box_row_pool_idle, box);
+      g_source_set_name_by_id (priv->row_pool_idle_id, "[gtk] gtk_list_box_row_pool_idle");
+    }
+}
+
+/* Returns a pooled row that now shows @item, or %NULL */
+static GtkListBoxRow *
+gtk_list_box_reuse_row (GtkListBox *box,
+                        GObject    *item)
+{
+  GtkListBoxPrivate *priv = BOX_PRIV (box);
+  GtkListBoxRow *row;
+  GQueue *queue;
+
+  if (priv->row_pool == NULL)
+    return NULL;
+
+  queue = g_hash_table_lookup (priv->row_pool, GSIZE_TO_POINTER (G_OBJECT_TYPE (item)));
+  if (queue == NULL)
+    return NULL;
+
+  while ((row = g_queue_pop_head (queue)) != NULL)
+    {
+      GtkWidget *widget;
+
+      if (ROW_PRIV (row)->wrapped)
+        widget = gtk_bin_get_child (GTK_BIN (row));
+      else
+        widget = GTK_WIDGET (row);
+
+      if (widget != NULL &&
+          priv->rebind_widget_func (widget, item, priv->rebind_widget_func_data))
+        {
+          gtk_list_box_row_set_selected (row, FALSE);
+          return row;
+        }
+
+      g_object_unref (row);
+    }
+
+  return NULL;
+}
+
+static void
+gtk_list_box_insert_object (GtkListBox *box,
+                            GObject    *item,
+                            gint        position)
+{
+  GtkListBoxPrivate *priv = BOX_PRIV (box);
+  GtkWidget *widget;
+  GtkListBoxRow *row;
+
+  row = gtk_list_box_reuse_row (box, item);
+  if (row != NULL)
+    {
+      gtk_list_box_insert (box, GTK_WIDGET (row), position);
+      g_object_unref (row);
+      return;
+    }
+
+  widget = priv->create_widget_func (item, priv->create_widget_func_data);
+
+  /* We allow the create_widget_func to either return a full
+   * reference or a floating reference.  If we got the floating
+   * reference, then turn it into a full reference now.  That means
+   * that gtk_list_box_insert() will take another full reference.
+   * Finally, we'll release this full reference below, leaving only
+   * the one held by the box.
+   */
+  if (g_object_is_floating (widget))
+    g_object_ref_sink (widget);
+
+  gtk_widget_show (widget);
+  gtk_list_box_insert (box, widget, position);
+
+  if (GTK_IS_LIST_BOX_ROW (widget))
+    row = GTK_LIST_BOX_ROW (widget);
+  else
+    row = GTK_LIST_BOX_ROW (gtk_widget_get_parent (widget));
+  ROW_PRIV (row)->item_type = G_OBJECT_TYPE (item);
+
+  g_object_unref (widget);
+}
+
+static void
+gtk_list_box_insert_item (GtkListBox *box,
+                          guint       item_position,
+                          gint        position)
+{
+  GObject *item;
+
+  item = g_list_model_get_item (BOX_PRIV (box)->bound_model, item_position);
+  gtk_list_box_insert_object (box, item, position);
+  g_object_unref (item);
+}
+
+static void
+gtk_list_box_remove_all_rows (GtkListBox *box)
+{
+  GtkListBoxPrivate *priv = BOX_PRIV (box);
+  GSequenceIter *iter;
+
+  iter = g_sequence_get_begin_iter (priv->children);
+  while (!g_sequence_iter_is_end (iter))
+    {
+      GtkWidget *row = g_sequence_get (iter);
+      iter = g_sequence_iter_next (iter);
+      gtk_list_box_pool_row (box, GTK_LIST_BOX_ROW (row));
+      gtk_list_box_remove (GTK_CONTAINER (box), row);
+    }
+}
+
+static int
+gtk_list_box_measure_virtual_row (GtkListBox    *box,
+                                  GtkListBoxRow *row)
+{
+  int width = gtk_widget_get_width (GTK_WIDGET (box));
+  int height, min;
+
+  if (!row_is_visible (row))
+    return 0;
+
+  height = 0;
+  if (ROW_PRIV (row)->header != NULL)
+    {
+      gtk_widget_measure (ROW_PRIV (row)->header, GTK_ORIENTATION_VERTICAL,
+                          width > 0 ? width : -1,
+                          &min, NULL, NULL, NULL);
+      height += min;
+    }
+
+  gtk_widget_measure (GTK_WIDGET (row), GTK_ORIENTATION_VERTICAL,
+                      width > 0 ? width : -1,
+                      &min, NULL, NULL, NULL);
+
+  return height + min;
+}
+
+/* Makes the rows in children cover the visible part of the
+ * adjustment plus a page above and below it, creating rows for
+ * the items that come into view and destroying the ones that
+ * went out of it.
+ */
+static void
+gtk_list_box_update_virtual_rows (GtkListBox *box)
+{
+  GtkListBoxPrivate *priv = BOX_PRIV (box);
+  guint n_items, n_rows;
+  guint first, position;
+  int top, bottom;
+  int estimate;
+  int y;
+  gboolean heights_changed;
+
+  if (!priv->virtual_rows || priv->bound_model == NULL)
+    return;
+
+  n_items = priv->item_heights->len;
+  n_rows = g_sequence_get_length (priv->children);
+
+  if (priv->adjustment)
+    {
+      int page = gtk_adjustment_get_page_size (priv->adjustment);
+
+      top = gtk_adjustment_get_value (priv->adjustment) - page;
+      bottom = gtk_adjustment_get_value (priv->adjustment) + 2 * page;
+    }
+  else
+    {
+      /* Without an adjustment all we can do is cover the box itself */
+      top = 0;
+      bottom = MAX (gtk_widget_get_height (GTK_WIDGET (box)), 1);
+    }
+
+  estimate = gtk_list_box_get_estimated_height (box);
+
+  y = 0;
+  for (first = 0; first < n_items; first++)
+    {
+      int height = gtk_list_box_get_item_height (box, first, estimate);
+
+      if (y + height > top)
+        break;
+
+      y += height;
+    }
+
+  if (first == n_items && n_items > 0)
+    first = n_items - 1;
+
+  /* Drop rows above the new range */
+  while (n_rows > 0 && priv->virtual_first < first)
+    {
+      GtkListBoxRow *row = g_sequence_get (g_sequence_get_begin_iter (priv->children));
+
+      gtk_list_box_pool_row (box, row);
+      gtk_list_box_remove (GTK_CONTAINER (box), GTK_WIDGET (row));
+      priv->virtual_first++;
+      n_rows--;
+    }
+
+  /* Rows that start below the new range will all be replaced anyway */
+  if (n_rows > 0 &&
+      priv->virtual_first > first &&
+      y + gtk_list_box_get_items_height (box, first, priv->virtual_first) >= bottom)
+    {
+      gtk_list_box_remove_all_rows (box);
+      n_rows = 0;
+    }
+
+  if (n_rows == 0)
+    priv->virtual_first = first;
+
+  while (priv->virtual_first > first)
+    {
+      priv->virtual_first--;
+      gtk_list_box_insert_item (box, priv->virtual_first, 0);
+      n_rows++;
+    }
+
+  /* Fill the range, measuring new rows right away so that the
+   * range is based on their real heights */
+  heights_changed = FALSE;
+  for (position = first; position < n_items && y < bottom; position++)
+    {
+      GtkListBoxRow *row;
+
+      if (position >= priv->virtual_first + n_rows)
+        {
+          gtk_list_box_insert_item (box, position, -1);
+          n_rows++;
+        }
+
+      row = gtk_list_box_get_row_at_index (box, position);
+      heights_changed |= gtk_list_box_set_item_height (box, position,
+                                                       gtk_list_box_measure_virtual_row (box, row));
+
+      y += gtk_list_box_get_item_height (box, position, estimate);
+    }
+
+  /* Drop rows below the new range */
+  while (priv->virtual_first + n_rows > position)
+    {
+      GtkListBoxRow *row = g_sequence_get (g_sequence_iter_prev (g_sequence_get_end_iter (priv->children)));
+
+      gtk_list_box_pool_row (box, row);
+      gtk_list_box_remove (GTK_CONTAINER (box), GTK_WIDGET (row));
+      n_rows--;
+    }
+
+  /* Adding and removing rows queues a resize by itself */
+  if (heights_changed)
+    gtk_widget_queue_resize (GTK_WIDGET (box));
+}
+
+static gboolean
+gtk_list_box_virtual_rows_tick (GtkWidget     *widget,
+                                GdkFrameClock *frame_clock,
+                                gpointer       user_data)
+{
+  GtkListBox *box = GTK_LIST_BOX (widget);
+
+  BOX_PRIV (box)->virtual_tick_id = 0;
+  gtk_list_box_update_virtual_rows (box);
+
+  return G_SOURCE_REMOVE;
+}
+
+/* Adjustments change during size allocation, and widgets can't be
+ * created then, so update the rows before the next layout instead.
+ */
+static void
+gtk_list_box_queue_update_virtual_rows (GtkListBox *box)
+{
+  GtkListBoxPrivate *priv = BOX_PRIV (box);
+
+  if (!priv->virtual_rows || priv->bound_model == NULL || priv->virtual_tick_id != 0)
+    return;
+
+  priv->virtual_tick_id = gtk_widget_add_tick_callback (GTK_WIDGET (box),
+                                                        gtk_list_box_virtual_rows_tick,
+                                                        NULL, NULL);
+}
+
 static void
 gtk_list_box_bound_model_changed (GListModel *list,
                                   guint       position,
@@ -3482,39 +4045,59 @@ gtk_list_box_bound_model_changed (GListModel *list,
 {
   GtkListBox *box = user_data;
   GtkListBoxPrivate *priv = BOX_PRIV (user_data);
-  guint i;
+  guint i, n;
+
+  if (priv->virtual_rows)
+    {
+      guint n_rows = g_sequence_get_length (priv->children);
+
+      gtk_list_box_forget_item_heights (box, position, removed);
+      g_array_remove_range (priv->item_heights, position, removed);
+      g_array_set_size (priv->item_heights, priv->item_heights->len + added);
+      memmove (&g_array_index (priv->item_heights, gint, position + added),
+               &g_array_index (priv->item_heights, gint, position),
+               (priv->item_heights->len - position - added) * sizeof (gint));
+      for (i = position; i < position + added; i++)
+        g_array_index (priv->item_heights, gint, i) = -1;
+
+      /* Rows for items before the change stay valid, as do
+       * rows that all come after it. */
+      if (position + removed <= priv->virtual_first)
+        priv->virtual_first = priv->virtual_first - removed + added;
+      else if (position < priv->virtual_first + n_rows)
+        {
+          gtk_list_box_remove_all_rows (box);
+          priv->virtual_first = 0;
+        }
+
+      gtk_list_box_update_virtual_rows (box);
+      return;
+    }
 
   while (removed--)
     {
       GtkListBoxRow *row;
 
       row = gtk_list_box_get_row_at_index (box, position);
+      gtk_list_box_pool_row (box, row);
       gtk_container_remove (GTK_CONTAINER (box), GTK_WIDGET (row));
     }
 
-  for (i = 0; i < added; i++)
+  for (i = 0; i < added; i += n)
     {
-      GObject *item;
-      GtkWidget *widget;
-
-      item = g_list_model_get_item (list, position + i);
-      widget = priv->create_widget_func (item, priv->create_widget_func_data);
+      gpointer items[N_BATCH_ITEMS];
+      guint j;
 
-      /* We allow the create_widget_func to either return a full
-       * reference or a floating reference.  If we got the floating
-       * reference, then turn it into a full reference now.  That means
-       * that gtk_list_box_insert() will take another full reference.
-       * Finally, we'll release this full reference below, leaving only
-       * the one held by the box.
-       */
-      if (g_object_is_floating (widget))
-        g_object_ref_sink (widget);
-
-      gtk_widget_show (widget);
-      gtk_list_box_insert (box, widget, position + i);
+      n = gtk_list_model_get_items (priv->bound_model, position + i,
+                                    MIN (added - i, N_BATCH_ITEMS), items);
+      if (n == 0)
+        break;
 
-      g_object_unref (widget);
-      g_object_unref (item);
+      for (j = 0; j < n; j++)
+        {
+          gtk_list_box_insert_object (box, items[j], position + i + j);
+          g_object_unref (items[j]);
+        }
     }
 }
 
@@ -3553,6 +4136,10 @@ gtk_list_box_check_model_compat (GtkListBox *box)
  * Note that using a model is incompatible with the filtering and sorting
  * functionality in GtkListBox. When using a model, filtering and sorting
  * should be implemented by the model.
+ *
+ * For large models, see gtk_list_box_set_virtual_rows(). To reuse
+ * the widgets of removed items for added ones, see
+ * gtk_list_box_set_rebind_widget_func().
  */
 void
 gtk_list_box_bind_model (GtkListBox                 *box,
@@ -3562,7 +4149,6 @@ gtk_list_box_bind_model (GtkListBox                 *box,
                          GDestroyNotify              user_data_free_func)
 {
   GtkListBoxPrivate *priv = BOX_PRIV (box);
-  GSequenceIter *iter;
 
   g_return_if_fail (GTK_IS_LIST_BOX (box));
   g_return_if_fail (model == NULL || G_IS_LIST_MODEL (model));
@@ -3577,13 +4163,11 @@ gtk_list_box_bind_model (GtkListBox                 *box,
       g_clear_object (&priv->bound_model);
     }
 
-  iter = g_sequence_get_begin_iter (priv->children);
-  while (!g_sequence_iter_is_end (iter))
-    {
-      GtkWidget *row = g_sequence_get (iter);
-      iter = g_sequence_iter_next (iter);
-      gtk_list_box_remove (GTK_CONTAINER (box), row);
-    }
+  gtk_list_box_remove_all_rows (box);
+  gtk_list_box_clear_row_pool (box);
+  gtk_list_box_forget_item_heights (box, 0, priv->item_heights->len);
+  g_array_set_size (priv->item_heights, 0);
+  priv->virtual_first = 0;
 
 
   if (model == NULL)
@@ -3599,3 +4183,113 @@ gtk_list_box_bind_model (GtkListBox                 *box,
   g_signal_connect (priv->bound_model, "items-changed", G_CALLBACK (gtk_list_box_bound_model_changed), box);
   gtk_list_box_bound_model_changed (model, 0, 0, g_list_model_get_n_items (model), box);
 }
+
+/**
+ * gtk_list_box_set_rebind_widget_func:
+ * @box: a #GtkListBox
+ * @rebind_widget_func: (nullable): a function that makes a widget show
+ *   another item, or %NULL to always create new widgets
+ * @user_data: user data passed to @rebind_widget_func
+ * @user_data_free_func: function for freeing @user_data
+ *
+ * Makes @box keep the rows of items that are removed from its bound
+ * model until the main loop is idle, and reuse them for items of the
+ * same type that are added in the meantime, instead of creating new
+ * widgets for them.
+ *
+ * A row is reused by passing the widget that the create_widget_func
+ * of gtk_list_box_bind_model() returned for its old item to
+ * @rebind_widget_func together with the new item. This makes models
+ * that remove and add back the same items, like sorted ones, as well
+ * as scrolling with gtk_list_box_set_virtual_rows(), much cheaper.
+ */
+void
+gtk_list_box_set_rebind_widget_func (GtkListBox                 *box,
+                                     GtkListBoxRebindWidgetFunc  rebind_widget_func,
+                                     gpointer                    user_data,
+                                     GDestroyNotify              user_data_free_func)
+{
+  GtkListBoxPrivate *priv = BOX_PRIV (box);
+
+  g_return_if_fail (GTK_IS_LIST_BOX (box));
+
+  gtk_list_box_clear_row_pool (box);
+
+  if (priv->rebind_widget_func_data_destroy)
+    priv->rebind_widget_func_data_destroy (priv->rebind_widget_func_data);
+
+  priv->rebind_widget_func = rebind_widget_func;
+  priv->rebind_widget_func_data = user_data;
+  priv->rebind_widget_func_data_destroy = user_data_free_func;
+}
+
+/**
+ * gtk_list_box_set_virtual_rows:
+ * @box: a #GtkListBox
+ * @virtual_rows: %TRUE to only create rows for visible items
+ *
+ * Sets whether @box only creates rows for the items of its bound
+ * model that are in or near the visible part of the list.
+ *
+ * The visible part is taken from the adjustment of @box, see
+ * gtk_list_box_set_adjustment(). Rows are created as they scroll
+ * into view and destroyed when they move out of it again. Items
+ * that don't have a row take up the height their row had last
+ * time, or the average height of the rows seen so far.
+ *
+ * A row that is destroyed loses its selection and focus, and only
+ * rows that exist are returned by functions like
+ * gtk_list_box_get_row_at_index() or gtk_list_box_get_selected_rows().
+ * The header function set with gtk_list_box_set_header_func() is
+ * only passed rows that exist as well.
+ *
+ * This has no effect on list boxes that are not bound to a model
+ * with gtk_list_box_bind_model().
+ */
+void
+gtk_list_box_set_virtual_rows (GtkListBox *box,
+                               gboolean    virtual_rows)
+{
+  GtkListBoxPrivate *priv = BOX_PRIV (box);
+
+  g_return_if_fail (GTK_IS_LIST_BOX (box));
+
+  virtual_rows = !!virtual_rows;
+
+  if (priv->virtual_rows == virtual_rows)
+    return;
+
+  if (priv->bound_model)
+    {
+      gtk_list_box_remove_all_rows (box);
+      gtk_list_box_forget_item_heights (box, 0, priv->item_heights->len);
+      g_array_set_size (priv->item_heights, 0);
+      priv->virtual_first = 0;
+    }
+
+  priv->virtual_rows = virtual_rows;
+
+  if (priv->bound_model)
+    gtk_list_box_bound_model_changed (priv->bound_model,
+                                      0, 0, g_list_model_get_n_items (priv->bound_model),
+                                      box);
+
+  g_object_notify_by_pspec (G_OBJECT (box), properties[PROP_VIRTUAL_ROWS]);
+}
+
+/**
+ * gtk_list_box_get_virtual_rows:
+ * @box: a #GtkListBox
+ *
+ * Returns whether rows are only created for visible items.
+ * See gtk_list_box_set_virtual_rows().
+ *
+ * Returns: %TRUE if rows are only created for visible items
+ */
+gboolean
+gtk_list_box_get_virtual_rows (GtkListBox *box)
+{
+  g_return_val_if_fail (GTK_IS_LIST_BOX (box), FALSE);
+
+  return BOX_PRIV (box)->virtual_rows;
+}
@@ -176,6 +176,23 @@ typedef void (*GtkListBoxUpdateHeaderFunc) (GtkListBoxRow *row,
 typedef GtkWidget * (*GtkListBoxCreateWidgetFunc) (gpointer item,
                                                    gpointer user_data);
 
+/**
+ * GtkListBoxRebindWidgetFunc:
+ * @widget: a widget that was created for an item that was removed
+ * @item: (type GObject): the item from the model that @widget should show now
+ * @user_data: (closure): user data
+ *
+ * Called for list boxes that reuse the widgets of removed items, see
+ * gtk_list_box_set_rebind_widget_func(). @item has the same type as
+ * the item @widget was created for.
+ *
+ * Returns: %TRUE if @widget now represents @item, %FALSE if it can't
+ *   be reused
+ */
+typedef gboolean (*GtkListBoxRebindWidgetFunc) (GtkWidget *widget,
+                                                gpointer   item,
+                                                gpointer   user_data);
+
 GDK_AVAILABLE_IN_ALL
 GType      gtk_list_box_row_get_type      (void) G_GNUC_CONST;
 GDK_AVAILABLE_IN_ALL
@@ -299,6 +316,16 @@ void           gtk_list_box_bind_model                   (GtkListBox
                                                           GtkListBoxCreateWidgetFunc    create_widget_func,
                                                           gpointer                      user_data,
                                                           GDestroyNotify                user_data_free_func);
+GDK_AVAILABLE_IN_ALL
+void           gtk_list_box_set_rebind_widget_func       (GtkListBox                   *box,
+                                                          GtkListBoxRebindWidgetFunc    rebind_widget_func,
+                                                          gpointer                      user_data,
+                                                          GDestroyNotify                user_data_free_func);
+GDK_AVAILABLE_IN_ALL
+void           gtk_list_box_set_virtual_rows             (GtkListBox                   *box,
+                                                          gboolean                      virtual_rows);
+GDK_AVAILABLE_IN_ALL
+gboolean       gtk_list_box_get_virtual_rows             (GtkListBox                   *box);
 
 G_DEFINE_AUTOPTR_CLEANUP_FUNC(GtkListBox, g_object_unref)
 G_DEFINE_AUTOPTR_CLEANUP_FUNC(GtkListBoxRow, g_object_unref)
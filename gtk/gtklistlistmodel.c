@@ -43,6 +43,7 @@ struct _GtkListListModel
   gpointer (* get_previous) (gpointer, gpointer);
   gpointer (* get_last) (gpointer);
   gpointer (* get_item) (gpointer, gpointer);
+  gpointer (* get_nth) (gpointer, guint);
   gpointer data;
   GDestroyNotify notify;
 };
@@ -80,6 +81,10 @@ gtk_list_list_model_get_item (GListModel *list,
     {
       return NULL;
     }
+  else if (self->get_nth)
+    {
+      result = self->get_nth (self->data, position);
+    }
   else if (self->get_last &&
            position >= self->n_items / 2)
     {
@@ -206,6 +211,23 @@ gtk_list_list_model_new_with_size (GType          item_type,
   return result;
 }
 
+/*
+ * gtk_list_list_model_set_get_nth:
+ * @self: a #GtkListListModel
+ * @get_nth: (nullable): function returning the item at a position
+ *
+ * Lets lists with an index look up items directly instead of walking
+ * from the first or last one.
+ */
+void
+gtk_list_list_model_set_get_nth (GtkListListModel  *self,
+                                 gpointer         (* get_nth) (gpointer, guint))
+{
+  g_return_if_fail (GTK_IS_LIST_LIST_MODEL (self));
+
+  self->get_nth = get_nth;
+}
+
 void
 gtk_list_list_model_item_added (GtkListListModel *self,
                                 gpointer          item)
@@ -56,6 +56,9 @@ GtkListListModel *      gtk_list_list_model_new_with_size       (GType
                                                                  gpointer                data,
                                                                  GDestroyNotify          notify);
 
+void                    gtk_list_list_model_set_get_nth         (GtkListListModel       *self,
+                                                                 gpointer                (* get_nth) (gpointer, guint));
+
 void                    gtk_list_list_model_item_added          (GtkListListModel       *self,
                                                                  gpointer                item);
 void                    gtk_list_list_model_item_added_at       (GtkListListModel       *self,
@@ -0,0 +1,73 @@
+/*
+ * Copyright © 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "gtklistmodelitemsprivate.h"
+
+G_DEFINE_INTERFACE (GtkListModelItems, gtk_list_model_items, G_TYPE_LIST_MODEL)
+
+static void
+gtk_list_model_items_default_init (GtkListModelItemsInterface *iface)
+{
+}
+
+/*
+ * gtk_list_model_get_items:
+ * @model: a #GListModel
+ * @position: the position of the first item to get
+ * @n_items: the number of items to get
+ * @items: (out caller-allocates) (array length=n_items) (transfer full):
+ *     return location for the items
+ *
+ * Gets the items from @position to @position + @n_items - 1, like
+ * calling g_list_model_get_item() for each of them would.
+ *
+ * GTK's own list models look up the first position only once and
+ * walk on from there, so getting a run of items this way is a lot
+ * cheaper than getting them one by one when models are stacked.
+ * Other models are asked for every item.
+ *
+ * Returns: the number of items stored in @items. This is less than
+ *     @n_items if @model runs out of items.
+ */
+guint
+gtk_list_model_get_items (GListModel *model,
+                          guint       position,
+                          guint       n_items,
+                          gpointer   *items)
+{
+  guint i;
+
+  g_return_val_if_fail (G_IS_LIST_MODEL (model), 0);
+
+  if (n_items == 0)
+    return 0;
+
+  if (GTK_IS_LIST_MODEL_ITEMS (model))
+    return GTK_LIST_MODEL_ITEMS_GET_IFACE (model)->get_items (GTK_LIST_MODEL_ITEMS (model),
+                                                               position, n_items, items);
+
+  for (i = 0; i < n_items; i++)
+    {
+      items[i] = g_list_model_get_item (model, position + i);
+      if (items[i] == NULL)
+        break;
+    }
+
+  return i;
+}
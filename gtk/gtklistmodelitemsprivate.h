@@ -0,0 +1,54 @@
+/*
+ * Copyright © 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GTK_LIST_MODEL_ITEMS_PRIVATE_H__
+#define __GTK_LIST_MODEL_ITEMS_PRIVATE_H__
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+#define GTK_TYPE_LIST_MODEL_ITEMS (gtk_list_model_items_get_type ())
+
+G_DECLARE_INTERFACE (GtkListModelItems, gtk_list_model_items, GTK, LIST_MODEL_ITEMS, GListModel)
+
+/*
+ * GtkListModelItemsInterface:
+ * @get_items: Store references to up to @n_items items starting at
+ *     @position in @items and return how many were stored.
+ *
+ * Implemented by the list models in GTK that can fetch a run of items
+ * faster than by looking up each position on its own.
+ */
+struct _GtkListModelItemsInterface
+{
+  GTypeInterface g_iface;
+
+  guint                 (* get_items)                           (GtkListModelItems      *self,
+                                                                 guint                   position,
+                                                                 guint                   n_items,
+                                                                 gpointer               *items);
+};
+
+guint                   gtk_list_model_get_items                (GListModel             *model,
+                                                                 guint                   position,
+                                                                 guint                   n_items,
+                                                                 gpointer               *items);
+
+G_END_DECLS
+
+#endif /* __GTK_LIST_MODEL_ITEMS_PRIVATE_H__ */
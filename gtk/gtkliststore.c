@@ -556,14 +556,22 @@ gtk_list_store_set_column_type (GtkListStore *list_store,
   priv->column_headers[column] = type;
 }
 
+static void
+free_row (gpointer data,
+          gpointer user_data)
+{
+  GtkListStorePrivate *priv = user_data;
+
+  _gtk_tree_data_list_free (data, priv->column_headers, priv->n_columns);
+}
+
 static void
 gtk_list_store_finalize (GObject *object)
 {
   GtkListStore *list_store = GTK_LIST_STORE (object);
   GtkListStorePrivate *priv = list_store->priv;
 
-  g_sequence_foreach (priv->seq,
-		      (GFunc) _gtk_tree_data_list_free, priv->column_headers);
+  g_sequence_foreach (priv->seq, free_row, priv);
 
   g_sequence_free (priv->seq);
 
@@ -670,20 +678,16 @@ gtk_list_store_get_value (GtkTreeModel *tree_model,
   GtkListStore *list_store = GTK_LIST_STORE (tree_model);
   GtkListStorePrivate *priv = list_store->priv;
   GtkTreeDataList *list;
-  gint tmp_column = column;
 
   g_return_if_fail (column < priv->n_columns);
   g_return_if_fail (iter_is_valid (iter, list_store));
 		    
   list = g_sequence_get (iter->user_data);
 
-  while (tmp_column-- > 0 && list)
-    list = list->next;
-
   if (list == NULL)
     g_value_init (value, priv->column_headers[column]);
   else
-    _gtk_tree_data_list_node_to_value (list,
+    _gtk_tree_data_list_node_to_value (&list[column],
 				       priv->column_headers[column],
 				       value);
 }
@@ -820,8 +824,6 @@ gtk_list_store_real_set_value (GtkListStore *list_store,
 {
   GtkListStorePrivate *priv = list_store->priv;
   GtkTreeDataList *list;
-  GtkTreeDataList *prev;
-  gint old_column = column;
   GValue real_value = G_VALUE_INIT;
   gboolean converted = FALSE;
   gboolean retval = FALSE;
@@ -850,48 +852,15 @@ gtk_list_store_real_set_value (GtkListStore *list_store,
       converted = TRUE;
     }
 
-  prev = list = g_sequence_get (iter->user_data);
-
-  while (list != NULL)
-    {
-      if (column == 0)
-	{
-	  if (converted)
-	    _gtk_tree_data_list_value_to_node (list, &real_value);
-	  else
-	    _gtk_tree_data_list_value_to_node (list, value);
-	  retval = TRUE;
-	  if (converted)
-	    g_value_unset (&real_value);
-         if (sort && GTK_LIST_STORE_IS_SORTED (list_store))
-            gtk_list_store_sort_iter_changed (list_store, iter, old_column);
-	  return retval;
-	}
-
-      column--;
-      prev = list;
-      list = list->next;
-    }
+  list = g_sequence_get (iter->user_data);
 
-  if (g_sequence_get (iter->user_data) == NULL)
+  if (list == NULL)
     {
-      list = _gtk_tree_data_list_alloc();
+      list = _gtk_tree_data_list_alloc (priv->n_columns);
       g_sequence_set (iter->user_data, list);
-      list->next = NULL;
-    }
-  else
-    {
-      list = prev->next = _gtk_tree_data_list_alloc ();
-      list->next = NULL;
     }
 
-  while (column != 0)
-    {
-      list->next = _gtk_tree_data_list_alloc ();
-      list = list->next;
-      list->next = NULL;
-      column --;
-    }
+  list = &list[column];
 
   if (converted)
     _gtk_tree_data_list_value_to_node (list, &real_value);
@@ -903,7 +872,7 @@ gtk_list_store_real_set_value (GtkListStore *list_store,
     g_value_unset (&real_value);
 
   if (sort && GTK_LIST_STORE_IS_SORTED (list_store))
-    gtk_list_store_sort_iter_changed (list_store, iter, old_column);
+    gtk_list_store_sort_iter_changed (list_store, iter, column);
 
   return retval;
 }
@@ -1207,7 +1176,7 @@ gtk_list_store_remove (GtkListStore *list_store,
   ptr = iter->user_data;
   next = g_sequence_iter_next (ptr);
   
-  _gtk_tree_data_list_free (g_sequence_get (ptr), priv->column_headers);
+  _gtk_tree_data_list_free (g_sequence_get (ptr), priv->column_headers, priv->n_columns);
   g_sequence_remove (iter->user_data);
 
   priv->length--;
@@ -1562,28 +1531,12 @@ gtk_list_store_drag_data_received (GtkTreeDragDest   *drag_dest,
         {
           GtkTreeDataList *dl = g_sequence_get (src_iter.user_data);
           GtkTreeDataList *copy_head = NULL;
-          GtkTreeDataList *copy_prev = NULL;
-          GtkTreeDataList *copy_iter = NULL;
 	  GtkTreePath *path;
-          gint col;
-
-          col = 0;
-          while (dl)
-            {
-              copy_iter = _gtk_tree_data_list_node_copy (dl,
-                                                         priv->column_headers[col]);
-
-              if (copy_head == NULL)
-                copy_head = copy_iter;
-
-              if (copy_prev)
-                copy_prev->next = copy_iter;
 
-              copy_prev = copy_iter;
-
-              dl = dl->next;
-              ++col;
-            }
+          if (dl)
+            copy_head = _gtk_tree_data_list_copy (dl,
+                                                  priv->column_headers,
+                                                  priv->n_columns);
 
 	  dest_iter.stamp = priv->stamp;
           g_sequence_set (dest_iter.user_data, copy_head);
@@ -2307,6 +2260,117 @@ gtk_list_store_insert_with_valuesv (GtkListStore *list_store,
   gtk_tree_path_free (path);
 }
 
+static gint
+compare_sequence_iters (gconstpointer a,
+                        gconstpointer b)
+{
+  return g_sequence_iter_compare (*(GSequenceIter **) a, *(GSequenceIter **) b);
+}
+
+/**
+ * gtk_list_store_append_rows:
+ * @list_store: A #GtkListStore
+ * @n_rows: the number of rows to append
+ * @columns: (array length=n_values): an array of column numbers
+ * @values: (array): an array of @n_values times @n_rows GValues
+ * @n_values: the length of the @columns array
+ *
+ * Appends @n_rows rows to @list_store, taking the values column by
+ * column: the values for column @columns[i] of all new rows are at
+ * @values[i * @n_rows] to @values[(i + 1) * @n_rows - 1].
+ *
+ * This is a lot faster than appending the rows one by one when
+ * loading large amounts of data. If nothing is connected to
+ * #GtkTreeModel::row-inserted, for example because the store is
+ * filled before it is set on a #GtkTreeView, no signals are
+ * emitted at all, and the view builds its rows in one pass when it
+ * gets the model. Otherwise the signal is emitted once per new row,
+ * after all of them have been added.
+ */
+void
+gtk_list_store_append_rows (GtkListStore *list_store,
+                            gint          n_rows,
+                            gint         *columns,
+                            GValue       *values,
+                            gint          n_values)
+{
+  static guint row_inserted_id = 0;
+  GtkListStorePrivate *priv;
+  GtkTreeIterCompareFunc func;
+  GPtrArray *rows;
+  GtkTreeIter iter;
+  GtkTreePath *path;
+  gboolean sort = FALSE;
+  gint row, i;
+
+  g_return_if_fail (GTK_IS_LIST_STORE (list_store));
+  g_return_if_fail (n_rows >= 0);
+  g_return_if_fail (n_values == 0 || (columns != NULL && values != NULL));
+
+  if (n_rows == 0)
+    return;
+
+  priv = list_store->priv;
+
+  for (i = 0; i < n_values; i++)
+    g_return_if_fail (columns[i] >= 0 && columns[i] < priv->n_columns);
+
+  priv->columns_dirty = TRUE;
+
+  if (GTK_LIST_STORE_IS_SORTED (list_store))
+    {
+      func = gtk_list_store_get_compare_func (list_store);
+      sort = func != _gtk_tree_data_list_compare_func;
+      for (i = 0; i < n_values; i++)
+        sort = sort || columns[i] == priv->sort_column_id;
+    }
+
+  rows = g_ptr_array_sized_new (n_rows);
+  iter.stamp = priv->stamp;
+
+  for (row = 0; row < n_rows; row++)
+    {
+      iter.user_data = g_sequence_append (priv->seq, NULL);
+
+      for (i = 0; i < n_values; i++)
+        gtk_list_store_real_set_value (list_store, &iter, columns[i],
+                                       &values[i * n_rows + row], FALSE);
+
+      if (sort)
+        g_sequence_sort_changed_iter (iter.user_data,
+                                      gtk_list_store_compare_func,
+                                      list_store);
+
+      g_ptr_array_add (rows, iter.user_data);
+    }
+
+  priv->length += n_rows;
+
+  if (row_inserted_id == 0)
+    row_inserted_id = g_signal_lookup ("row-inserted", GTK_TYPE_TREE_MODEL);
+
+  /* Rows appended at the end do not move any existing row, so
+   * without handlers nothing needs to hear about them.
+   */
+  if (sort ||
+      g_signal_has_handler_pending (list_store, row_inserted_id, 0, FALSE))
+    {
+      /* Listeners must see the rows arrive in order */
+      if (sort)
+        g_ptr_array_sort (rows, compare_sequence_iters);
+
+      for (row = 0; row < n_rows; row++)
+        {
+          iter.user_data = g_ptr_array_index (rows, row);
+          path = gtk_list_store_get_path (GTK_TREE_MODEL (list_store), &iter);
+          gtk_tree_model_row_inserted (GTK_TREE_MODEL (list_store), path, &iter);
+          gtk_tree_path_free (path);
+        }
+    }
+
+  g_ptr_array_unref (rows);
+}
+
 /* GtkBuildable custom tag implementation
  *
  * <columns>
@@ -123,6 +123,12 @@ void          gtk_list_store_insert_with_valuesv (GtkListStore *list_store,
 						  GValue       *values,
 						  gint          n_values);
 GDK_AVAILABLE_IN_ALL
+void          gtk_list_store_append_rows         (GtkListStore *list_store,
+                                                  gint          n_rows,
+                                                  gint         *columns,
+                                                  GValue       *values,
+                                                  gint          n_values);
+GDK_AVAILABLE_IN_ALL
 void          gtk_list_store_prepend          (GtkListStore *list_store,
 					       GtkTreeIter  *iter);
 GDK_AVAILABLE_IN_ALL
@@ -124,6 +124,7 @@
 #include "gtkprivate.h"
 #include "gtkrecentmanager.h"
 #include "gtksettingsprivate.h"
+#include "gtkstartuptraceprivate.h"
 #include "gtktooltipprivate.h"
 #include "gtkversion.h"
 #include "gtkwidgetprivate.h"
@@ -640,19 +641,27 @@ gettext_initialization (void)
 static void
 default_display_notify_cb (GdkDisplayManager *dm)
 {
+  gint64 trace_start;
+
   debug_flags[0].display = gdk_display_get_default ();
 #ifdef G_OS_UNIX
+  trace_start = gtk_startup_trace_begin ();
   gtk_print_backends_init ();
+  gtk_startup_trace_end (trace_start, "Print backends", NULL);
 #endif
-  gtk_im_modules_init ();
+  trace_start = gtk_startup_trace_begin ();
   gtk_media_file_extension_init ();
+  gtk_startup_trace_end (trace_start, "Media modules", NULL);
+  trace_start = gtk_startup_trace_begin ();
   _gtk_accessibility_init ();
+  gtk_startup_trace_end (trace_start, "Accessibility", NULL);
 }
 
 static void
 do_post_parse_initialization (void)
 {
   GdkDisplayManager *display_manager;
+  gint64 trace_start;
 
   if (gtk_initialized)
     return;
@@ -665,8 +674,10 @@ do_post_parse_initialization (void)
 
   gtk_widget_set_default_direction (gtk_get_locale_direction ());
 
+  trace_start = gtk_startup_trace_begin ();
   gsk_ensure_resources ();
   _gtk_ensure_resources ();
+  gtk_startup_trace_end (trace_start, "Register resources", NULL);
 
   _gtk_accel_map_init ();
 
@@ -782,26 +793,41 @@ gtk_simulate_touchscreen (void)
 gboolean
 gtk_init_check (void)
 {
+  gint64 init_start, trace_start;
   gboolean ret;
 
   if (gtk_initialized)
     return TRUE;
 
+  gtk_startup_trace_init ();
+  init_start = gtk_startup_trace_begin ();
+
   gettext_initialization ();
 
   if (!check_setugid ())
-    return FALSE;
+    {
+      gtk_startup_trace_end (init_start, "gtk_init", NULL);
+      return FALSE;
+    }
 
+  trace_start = gtk_startup_trace_begin ();
   do_pre_parse_initialization ();
+  gtk_startup_trace_end (trace_start, "Pre-parse initialization", NULL);
+  trace_start = gtk_startup_trace_begin ();
   do_post_parse_initialization ();
+  gtk_startup_trace_end (trace_start, "Post-parse initialization", NULL);
 
   initialized_thread = g_thread_self ();
 
+  trace_start = gtk_startup_trace_begin ();
   ret = gdk_display_open_default () != NULL;
+  gtk_startup_trace_end (trace_start, "Open display", NULL);
 
   if (ret && (gtk_get_debug_flags () & GTK_DEBUG_INTERACTIVE))
     gtk_window_set_interactive_debugging (TRUE);
 
+  gtk_startup_trace_end (init_start, "gtk_init", NULL);
+
   return ret;
 }
 
@@ -1730,6 +1756,9 @@ gtk_main_do_event (GdkEvent *event)
   GdkEvent *rewritten_event = NULL;
   GdkDevice *device;
   GList *tmp_list;
+  GtkWidget *toplevel;
+  GtkWindow *recording_window = NULL;
+  gint64 receive_time = 0;
 
   if (gtk_inspector_handle_event (event))
     return;
@@ -1742,6 +1771,15 @@ gtk_main_do_event (GdkEvent *event)
   if (!event_widget)
     return;
 
+  /* Windows recording frame phases also record input latency */
+  toplevel = gtk_widget_get_toplevel (event_widget);
+  if (GTK_IS_WINDOW (toplevel) &&
+      gtk_window_get_record_frame_phases (GTK_WINDOW (toplevel)))
+    {
+      recording_window = g_object_ref (GTK_WINDOW (toplevel));
+      receive_time = g_get_monotonic_time ();
+    }
+
   target_widget = event_widget;
 
   /* If pointer or keyboard grabs are in effect, munge the events
@@ -1914,6 +1952,9 @@ gtk_main_do_event (GdkEvent *event)
     case GDK_PAD_STRIP:
     case GDK_PAD_GROUP_MODE:
       gtk_propagate_event (grab_widget, event);
+
+      if (recording_window)
+        gtk_window_add_input_event (recording_window, receive_time);
       break;
 
     case GDK_ENTER_NOTIFY:
@@ -1942,6 +1983,9 @@ gtk_main_do_event (GdkEvent *event)
 
   if (rewritten_event)
     g_object_unref (rewritten_event);
+
+  if (recording_window)
+    g_object_unref (recording_window);
 }
 
 static GtkWindowGroup *
@@ -23,6 +23,7 @@
 
 #include "gtkrbtreeprivate.h"
 #include "gtkintl.h"
+#include "gtklistmodelitemsprivate.h"
 #include "gtkprivate.h"
 
 /**
@@ -42,6 +43,7 @@
 
 enum {
   PROP_0,
+  PROP_CACHE_SIZE,
   PROP_HAS_MAP,
   PROP_ITEM_TYPE,
   PROP_MODEL,
@@ -55,6 +57,7 @@ struct _MapNode
 {
   guint n_items;
   gpointer item; /* can only be set when n_items == 1 */
+  GList cache_link; /* data is set while the item is in the cache */
 };
 
 struct _MapAugment
@@ -73,6 +76,10 @@ struct _GtkMapListModel
   GDestroyNotify user_destroy;
 
   GtkRbTree *items; /* NULL if map_func == NULL */
+
+  /* nodes whose items we keep alive, most recently used first */
+  GQueue cache;
+  guint cache_size;
 };
 
 struct _GtkMapListModelClass
@@ -122,6 +129,93 @@ gtk_map_list_model_get_nth (GtkRbTree *tree,
   return node;
 }
 
+/* Turns @node, which has lost its item, back into a part of the
+ * unmapped runs next to it, so that nodes don't pile up.
+ */
+static void
+gtk_map_list_model_merge_node (GtkMapListModel *self,
+                               MapNode         *node)
+{
+  MapNode *other;
+
+  g_assert (node->item == NULL);
+
+  other = gtk_rb_tree_node_get_previous (node);
+  if (other && other->item == NULL)
+    {
+      other->n_items += node->n_items;
+      gtk_rb_tree_node_mark_dirty (other);
+      gtk_rb_tree_remove (self->items, node);
+      node = other;
+    }
+
+  other = gtk_rb_tree_node_get_next (node);
+  if (other && other->item == NULL)
+    {
+      node->n_items += other->n_items;
+      gtk_rb_tree_node_mark_dirty (node);
+      gtk_rb_tree_remove (self->items, other);
+    }
+}
+
+static void
+gtk_map_list_model_uncache_node (GtkMapListModel *self,
+                                 MapNode         *node,
+                                 gboolean         merge)
+{
+  gpointer item;
+
+  if (node->cache_link.data == NULL)
+    return;
+
+  g_queue_unlink (&self->cache, &node->cache_link);
+  node->cache_link.data = NULL;
+
+  /* This clears node->item if we held the last reference */
+  item = node->item;
+  g_object_unref (item);
+
+  if (merge && node->item == NULL)
+    gtk_map_list_model_merge_node (self, node);
+}
+
+static void
+gtk_map_list_model_clear_cache (GtkMapListModel *self)
+{
+  while (self->cache.head)
+    gtk_map_list_model_uncache_node (self, self->cache.head->data, FALSE);
+}
+
+static void
+gtk_map_list_model_trim_cache (GtkMapListModel *self)
+{
+  while (self->cache.length > self->cache_size)
+    gtk_map_list_model_uncache_node (self, self->cache.tail->data, TRUE);
+}
+
+/* Marks the item of @node as recently used. Callers need to
+ * trim the cache afterwards.
+ */
+static void
+gtk_map_list_model_touch_node (GtkMapListModel *self,
+                               MapNode         *node)
+{
+  if (self->cache_size == 0)
+    return;
+
+  if (node->cache_link.data)
+    {
+      g_queue_unlink (&self->cache, &node->cache_link);
+    }
+  else
+    {
+      g_object_ref (node->item);
+      node->cache_link.data = node;
+    }
+
+  g_queue_push_head_link (&self->cache, &node->cache_link);
+}
+
 static GType
 gtk_map_list_model_get_item_type (GListModel *list)
 {
@@ -141,27 +235,19 @@ gtk_map_list_model_get_n_items (GListModel *list)
   return g_list_model_get_n_items (self->model);
 }
 
+/* Maps @source into the unmapped @node that starts at @offset and
+ * contains @position. Afterwards @node holds only that item, and the
+ * remaining positions of the run are in the nodes around it.
+ *
+ * Returns: (transfer full): the mapped item
+ */
 static gpointer
-gtk_map_list_model_get_item (GListModel *list,
-                             guint       position)
+gtk_map_list_model_map_node (GtkMapListModel *self,
+                             MapNode         *node,
+                             guint            offset,
+                             guint            position,
+                             gpointer         source)
 {
-  GtkMapListModel *self = GTK_MAP_LIST_MODEL (list);
-  MapNode *node;
-  guint offset;
-
-  if (self->model == NULL)
-    return NULL;
-
-  if (self->items == NULL)
-    return g_list_model_get_item (self->model, position);
-
-  node = gtk_map_list_model_get_nth (self->items, position, &offset);
-  if (node == NULL)
-    return NULL;
-
-  if (node->item)
-    return g_object_ref (node->item);
-
   if (offset != position)
     {
       MapNode *before = gtk_rb_tree_insert_before (self->items, node);
@@ -178,7 +264,7 @@ gtk_map_list_model_get_item (GListModel *list,
       gtk_rb_tree_node_mark_dirty (node);
     }
 
-  node->item = self->map_func (g_list_model_get_item (self->model, position), self->user_data);
+  node->item = self->map_func (source, self->user_data);
   if (!G_TYPE_CHECK_INSTANCE_TYPE (node->item, self->item_type))
     {
       g_critical ("Map function returned a %s, but it is not a subtype of the model's type %s",
@@ -189,6 +275,37 @@ gtk_map_list_model_get_item (GListModel *list,
   return node->item;
 }
 
+static gpointer
+gtk_map_list_model_get_item (GListModel *list,
+                             guint       position)
+{
+  GtkMapListModel *self = GTK_MAP_LIST_MODEL (list);
+  MapNode *node;
+  gpointer item;
+  guint offset;
+
+  if (self->model == NULL)
+    return NULL;
+
+  if (self->items == NULL)
+    return g_list_model_get_item (self->model, position);
+
+  node = gtk_map_list_model_get_nth (self->items, position, &offset);
+  if (node == NULL)
+    return NULL;
+
+  if (node->item)
+    item = g_object_ref (node->item);
+  else
+    item = gtk_map_list_model_map_node (self, node, offset, position,
+                                        g_list_model_get_item (self->model, position));
+
+  gtk_map_list_model_touch_node (self, node);
+  gtk_map_list_model_trim_cache (self);
+
+  return item;
+}
+
 static void
 gtk_map_list_model_model_init (GListModelInterface *iface)
 {
@@ -197,8 +314,70 @@ gtk_map_list_model_model_init (GListModelInterface *iface)
   iface->get_item = gtk_map_list_model_get_item;
 }
 
+static guint
+gtk_map_list_model_get_items (GtkListModelItems *list,
+                              guint              position,
+                              guint              n_items,
+                              gpointer          *items)
+{
+  GtkMapListModel *self = GTK_MAP_LIST_MODEL (list);
+  MapNode *node;
+  guint offset, n_found, n, i;
+
+  if (self->model == NULL)
+    return 0;
+
+  if (self->items == NULL)
+    return gtk_list_model_get_items (self->model, position, n_items, items);
+
+  node = gtk_map_list_model_get_nth (self->items, position, &offset);
+
+  n_found = 0;
+  while (node != NULL && n_found < n_items)
+    {
+      if (node->item)
+        {
+          items[n_found++] = g_object_ref (node->item);
+          gtk_map_list_model_touch_node (self, node);
+          position++;
+          offset = position;
+          node = gtk_rb_tree_node_get_next (node);
+          continue;
+        }
+
+      /* Get the source items of the unmapped run in one go and
+       * map them in place */
+      n = MIN (node->n_items - (position - offset), n_items - n_found);
+      n = gtk_list_model_get_items (self->model, position, n, items + n_found);
+      if (n == 0)
+        break;
+
+      for (i = 0; i < n; i++)
+        {
+          items[n_found] = gtk_map_list_model_map_node (self, node, offset, position, items[n_found]);
+          gtk_map_list_model_touch_node (self, node);
+          n_found++;
+          position++;
+          offset = position;
+          node = gtk_rb_tree_node_get_next (node);
+        }
+    }
+
+  /* Not earlier, trimming may merge the nodes we are walking */
+  gtk_map_list_model_trim_cache (self);
+
+  return n_found;
+}
+
+static void
+gtk_map_list_model_items_init (GtkListModelItemsInterface *iface)
+{
+  iface->get_items = gtk_map_list_model_get_items;
+}
+
 G_DEFINE_TYPE_WITH_CODE (GtkMapListModel, gtk_map_list_model, G_TYPE_OBJECT,
-                         G_IMPLEMENT_INTERFACE (G_TYPE_LIST_MODEL, gtk_map_list_model_model_init))
+                         G_IMPLEMENT_INTERFACE (G_TYPE_LIST_MODEL, gtk_map_list_model_model_init)
+                         G_IMPLEMENT_INTERFACE (GTK_TYPE_LIST_MODEL_ITEMS, gtk_map_list_model_items_init))
 
 static void
 gtk_map_list_model_items_changed_cb (GListModel      *model,
@@ -208,7 +387,7 @@ gtk_map_list_model_items_changed_cb (GListModel      *model,
                                      GtkMapListModel *self)
 {
   MapNode *node;
-  guint start, end;
+  guint start, end, n_removed;
 
   if (self->items == NULL)
     {
@@ -219,22 +398,24 @@ gtk_map_list_model_items_changed_cb (GListModel      *model,
   node = gtk_map_list_model_get_nth (self->items, position, &start);
   g_assert (start <= position);
 
-  while (removed > 0)
+  n_removed = removed;
+  while (n_removed > 0)
     {
       end = start + node->n_items;
-      if (start == position && end <= position + removed)
+      if (start == position && end <= position + n_removed)
         {
           MapNode *next = gtk_rb_tree_node_get_next (node);
-          removed -= node->n_items;
+          n_removed -= node->n_items;
+          gtk_map_list_model_uncache_node (self, node, FALSE);
           gtk_rb_tree_remove (self->items, node);
           node = next;
         }
       else
         {
-          if (end >= position + removed)
+          if (end >= position + n_removed)
             {
-              node->n_items -= removed;
-              removed = 0;
+              node->n_items -= n_removed;
+              n_removed = 0;
               gtk_rb_tree_node_mark_dirty (node);
             }
           else if (start < position)
@@ -242,7 +423,7 @@ gtk_map_list_model_items_changed_cb (GListModel      *model,
               guint overlap = node->n_items - (position - start);
               node->n_items -= overlap;
               gtk_rb_tree_node_mark_dirty (node);
-              removed -= overlap;
+              n_removed -= overlap;
               start = position;
               node = gtk_rb_tree_node_get_next (node);
             }
@@ -254,7 +435,7 @@ gtk_map_list_model_items_changed_cb (GListModel      *model,
       if (node == NULL)
         node = gtk_rb_tree_insert_before (self->items, NULL);
       else if (node->item)
-        node = gtk_rb_tree_insert_after (self->items, node);
+        node = gtk_rb_tree_insert_before (self->items, node);
 
       node->n_items += added;
       gtk_rb_tree_node_mark_dirty (node);
@@ -273,6 +454,10 @@ gtk_map_list_model_set_property (GObject      *object,
 
   switch (prop_id)
     {
+    case PROP_CACHE_SIZE:
+      gtk_map_list_model_set_cache_size (self, g_value_get_uint (value));
+      break;
+
     case PROP_ITEM_TYPE:
       self->item_type = g_value_get_gtype (value);
       break;
@@ -297,6 +482,10 @@ gtk_map_list_model_get_property (GObject     *object,
 
   switch (prop_id)
     {
+    case PROP_CACHE_SIZE:
+      g_value_set_uint (value, self->cache_size);
+      break;
+
     case PROP_HAS_MAP:
       g_value_set_boolean (value, self->items != NULL);
       break;
@@ -336,6 +525,7 @@ gtk_map_list_model_dispose (GObject *object)
   self->map_func = NULL;
   self->user_data = NULL;
   self->user_destroy = NULL;
+  gtk_map_list_model_clear_cache (self);
   g_clear_pointer (&self->items, gtk_rb_tree_unref);
 
   G_OBJECT_CLASS (gtk_map_list_model_parent_class)->dispose (object);
@@ -350,6 +540,18 @@ gtk_map_list_model_class_init (GtkMapListModelClass *class)
   gobject_class->get_property = gtk_map_list_model_get_property;
   gobject_class->dispose = gtk_map_list_model_dispose;
 
+  /**
+   * GtkMapListModel:cache-size:
+   *
+   * The number of recently used mapped items to keep alive
+   */
+  properties[PROP_CACHE_SIZE] =
+      g_param_spec_uint ("cache-size",
+                         P_("Cache size"),
+                         P_("The number of recently used mapped items to keep alive"),
+                         0, G_MAXUINT, 0,
+                         GTK_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   /**
    * GtkMapListModel:has-map:
    *
@@ -466,6 +668,8 @@ gtk_map_list_model_clear_node (gpointer _node)
 static void
 gtk_map_list_model_init_items (GtkMapListModel *self)
 {
+  gtk_map_list_model_clear_cache (self);
+
   if (self->map_func && self->model)
     {
       guint n_items;
@@ -629,3 +833,50 @@ gtk_map_list_model_has_map (GtkMapListModel *self)
 
   return self->map_func != NULL;
 }
+
+/**
+ * gtk_map_list_model_set_cache_size:
+ * @self: a #GtkMapListModel
+ * @cache_size: the number of mapped items to keep
+ *
+ * Sets how many of the most recently requested mapped items @self
+ * keeps alive.
+ *
+ * By default, @self does not hold on to the items returned by the
+ * map function, so they go away once nobody else uses them and get
+ * mapped again when they are requested the next time. With a cache,
+ * the items that were requested last stay around, while older ones
+ * are released. That way, scrolling back and forth in a view does
+ * not map the same items over and over, and memory for mapped items
+ * stays bounded however far the view scrolls.
+ **/
+void
+gtk_map_list_model_set_cache_size (GtkMapListModel *self,
+                                   guint            cache_size)
+{
+  g_return_if_fail (GTK_IS_MAP_LIST_MODEL (self));
+
+  if (self->cache_size == cache_size)
+    return;
+
+  self->cache_size = cache_size;
+  gtk_map_list_model_trim_cache (self);
+
+  g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_CACHE_SIZE]);
+}
+
+/**
+ * gtk_map_list_model_get_cache_size:
+ * @self: a #GtkMapListModel
+ *
+ * Gets the value set via gtk_map_list_model_set_cache_size().
+ *
+ * Returns: the number of mapped items @self keeps alive
+ **/
+guint
+gtk_map_list_model_get_cache_size (GtkMapListModel *self)
+{
+  g_return_val_if_fail (GTK_IS_MAP_LIST_MODEL (self), 0);
+
+  return self->cache_size;
+}
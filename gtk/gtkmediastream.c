@@ -42,9 +42,41 @@
  * gtk_media_stream_seek_failed(),
  * gtk_media_stream_gerror(),
  * gtk_media_stream_error(),
- * gtk_media_stream_error_valist().
+ * gtk_media_stream_error_valist(),
+ * gtk_media_stream_acquire_frame_buffer(),
+ * gtk_media_stream_submit_frame_buffer(),
+ * gtk_media_stream_submit_frame().
+ *
+ * Implementations that decode video into memory should use
+ * gtk_media_stream_acquire_frame_buffer() and
+ * gtk_media_stream_submit_frame_buffer() to hand frames to GTK. The
+ * buffers are recycled once GTK is done drawing them, so playing a
+ * video does not allocate memory for every frame. Frames that already
+ * live in a texture, such as a #GdkGLTexture wrapping a buffer that was
+ * imported from the video decoder, can be passed to
+ * gtk_media_stream_submit_frame() instead. Either way, the stream draws
+ * the newest frame and invalidates its contents at most once per frame
+ * of the #GdkFrameClock of the surface it was realized with.
  */
 
+/* How many unused buffers a frame pool keeps around */
+#define MAX_FREE_FRAME_BUFFERS 4
+
+/* Frame buffers start with a pointer to their pool, padded
+ * to keep the pixels aligned as well as g_malloc() does */
+#define FRAME_BUFFER_HEADER_SIZE (2 * sizeof (gpointer))
+
+typedef struct _GtkMediaFramePool GtkMediaFramePool;
+
+struct _GtkMediaFramePool
+{
+  int ref_count;
+  int width;
+  int height;
+  gsize stride;
+  GSList *free_buffers;
+};
+
 typedef struct _GtkMediaStreamPrivate GtkMediaStreamPrivate;
 
 struct _GtkMediaStreamPrivate
@@ -54,6 +86,12 @@ struct _GtkMediaStreamPrivate
   GError *error;
   double volume;
 
+  GdkPaintable *frame;
+  GtkMediaFramePool *frame_pool;
+  GSList *surfaces;             /* one for every call to gtk_media_stream_realize() */
+  GdkFrameClock *frame_clock;
+  gulong update_handler;
+
   guint has_audio : 1;
   guint has_video : 1;
   guint playing : 1;
@@ -63,6 +101,8 @@ struct _GtkMediaStreamPrivate
   guint loop : 1;
   guint prepared : 1;
   guint muted : 1;
+  guint frame_changed : 1;
+  guint frame_size_changed : 1;
 };
 
 enum {
@@ -86,26 +126,86 @@ enum {
 
 static GParamSpec *properties[N_PROPS] = { NULL, };
 
+static void gtk_media_stream_paintable_init (GdkPaintableInterface *iface);
+
+G_DEFINE_ABSTRACT_TYPE_WITH_CODE (GtkMediaStream, gtk_media_stream, G_TYPE_OBJECT,
+                                  G_IMPLEMENT_INTERFACE (GDK_TYPE_PAINTABLE,
+                                                         gtk_media_stream_paintable_init)
+                                  G_ADD_PRIVATE (GtkMediaStream))
+
 static void
 gtk_media_stream_paintable_snapshot (GdkPaintable *paintable,
                                      GdkSnapshot  *snapshot,
                                      double        width,
                                      double        height)
 {
+  GtkMediaStream *self = GTK_MEDIA_STREAM (paintable);
+  GtkMediaStreamPrivate *priv = gtk_media_stream_get_instance_private (self);
+
+  if (priv->frame)
+    gdk_paintable_snapshot (priv->frame, snapshot, width, height);
+}
+
+static GdkPaintable *
+gtk_media_stream_paintable_get_current_image (GdkPaintable *paintable)
+{
+  GtkMediaStream *self = GTK_MEDIA_STREAM (paintable);
+  GtkMediaStreamPrivate *priv = gtk_media_stream_get_instance_private (self);
+
+  if (priv->frame)
+    return g_object_ref (priv->frame);
+
+  return gdk_paintable_new_empty (0, 0);
+}
+
+static int
+gtk_media_stream_paintable_get_intrinsic_width (GdkPaintable *paintable)
+{
+  GtkMediaStream *self = GTK_MEDIA_STREAM (paintable);
+  GtkMediaStreamPrivate *priv = gtk_media_stream_get_instance_private (self);
+
+  if (priv->frame)
+    return gdk_paintable_get_intrinsic_width (priv->frame);
+
+  return 0;
+}
+
+static int
+gtk_media_stream_paintable_get_intrinsic_height (GdkPaintable *paintable)
+{
+  GtkMediaStream *self = GTK_MEDIA_STREAM (paintable);
+  GtkMediaStreamPrivate *priv = gtk_media_stream_get_instance_private (self);
+
+  if (priv->frame)
+    return gdk_paintable_get_intrinsic_height (priv->frame);
+
+  return 0;
+}
+
+static double
+gtk_media_stream_paintable_get_intrinsic_aspect_ratio (GdkPaintable *paintable)
+{
+  GtkMediaStream *self = GTK_MEDIA_STREAM (paintable);
+  GtkMediaStreamPrivate *priv = gtk_media_stream_get_instance_private (self);
+
+  if (priv->frame)
+    return gdk_paintable_get_intrinsic_aspect_ratio (priv->frame);
+
+  return 0;
 }
 
 static void
 gtk_media_stream_paintable_init (GdkPaintableInterface *iface)
 {
-  /* We implement the behavior for "no video stream" here */
+  /* We implement the behavior for "no video stream" here, and
+   * drawing the frames passed to gtk_media_stream_submit_frame() */
   iface->snapshot = gtk_media_stream_paintable_snapshot;
+  iface->get_current_image = gtk_media_stream_paintable_get_current_image;
+  iface->get_intrinsic_width = gtk_media_stream_paintable_get_intrinsic_width;
+  iface->get_intrinsic_height = gtk_media_stream_paintable_get_intrinsic_height;
+  iface->get_intrinsic_aspect_ratio = gtk_media_stream_paintable_get_intrinsic_aspect_ratio;
 }
 
-G_DEFINE_ABSTRACT_TYPE_WITH_CODE (GtkMediaStream, gtk_media_stream, G_TYPE_OBJECT,
-                                  G_IMPLEMENT_INTERFACE (GDK_TYPE_PAINTABLE,
-                                                         gtk_media_stream_paintable_init)
-                                  G_ADD_PRIVATE (GtkMediaStream))
-
 #define GTK_MEDIA_STREAM_WARN_NOT_IMPLEMENTED_METHOD(obj,method) \
   g_critical ("Media stream of type '%s' does not implement GtkMediaStream::" # method, G_OBJECT_TYPE_NAME (obj))
 
@@ -258,17 +358,24 @@ gtk_media_stream_dispose (GObject *object)
   GtkMediaStreamPrivate *priv = gtk_media_stream_get_instance_private (self);
 
   g_clear_error (&priv->error);
+  g_clear_object (&priv->frame);
 
   G_OBJECT_CLASS (gtk_media_stream_parent_class)->dispose (object);
 }
 
+static void gtk_media_frame_pool_unref (GtkMediaFramePool *pool);
+
 static void
 gtk_media_stream_finalize (GObject *object)
 {
-#if 0
   GtkMediaStream *self = GTK_MEDIA_STREAM (object);
   GtkMediaStreamPrivate *priv = gtk_media_stream_get_instance_private (self);
-#endif
+
+  /* Every realized surface holds a reference */
+  g_assert (priv->surfaces == NULL);
+  g_assert (priv->frame_clock == NULL);
+
+  g_clear_pointer (&priv->frame_pool, gtk_media_frame_pool_unref);
 
   G_OBJECT_CLASS (gtk_media_stream_parent_class)->finalize (object);
 }
@@ -933,6 +1040,69 @@ gtk_media_stream_set_volume (GtkMediaStream *self,
   g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_VOLUME]);
 }
 
+static void
+gtk_media_stream_invalidate_frame (GtkMediaStream *self)
+{
+  GtkMediaStreamPrivate *priv = gtk_media_stream_get_instance_private (self);
+
+  if (!priv->frame_changed)
+    return;
+
+  priv->frame_changed = FALSE;
+
+  if (priv->frame_size_changed)
+    {
+      priv->frame_size_changed = FALSE;
+      gdk_paintable_invalidate_size (GDK_PAINTABLE (self));
+    }
+
+  gdk_paintable_invalidate_contents (GDK_PAINTABLE (self));
+}
+
+static void
+gtk_media_stream_frame_clock_update (GdkFrameClock  *frame_clock,
+                                     GtkMediaStream *self)
+{
+  gtk_media_stream_invalidate_frame (self);
+}
+
+/* Frames are shown in sync with the frame clock of the first surface */
+static void
+gtk_media_stream_update_frame_clock (GtkMediaStream *self)
+{
+  GtkMediaStreamPrivate *priv = gtk_media_stream_get_instance_private (self);
+  GdkFrameClock *frame_clock;
+
+  if (priv->surfaces)
+    frame_clock = gdk_surface_get_frame_clock (priv->surfaces->data);
+  else
+    frame_clock = NULL;
+
+  if (frame_clock == priv->frame_clock)
+    return;
+
+  if (priv->frame_clock)
+    {
+      g_signal_handler_disconnect (priv->frame_clock, priv->update_handler);
+      priv->update_handler = 0;
+      g_clear_object (&priv->frame_clock);
+    }
+
+  if (frame_clock)
+    {
+      priv->frame_clock = g_object_ref (frame_clock);
+      priv->update_handler = g_signal_connect (frame_clock, "update",
+                                               G_CALLBACK (gtk_media_stream_frame_clock_update), self);
+      if (priv->frame_changed)
+        gdk_frame_clock_request_phase (frame_clock, GDK_FRAME_CLOCK_PHASE_UPDATE);
+    }
+  else
+    {
+      /* Nothing to sync to anymore */
+      gtk_media_stream_invalidate_frame (self);
+    }
+}
+
 /**
  * gtk_media_stream_realize:
  * @self: a #GtkMediaStream
@@ -957,12 +1127,17 @@ void
 gtk_media_stream_realize (GtkMediaStream *self,
                           GdkSurface      *surface)
 {
+  GtkMediaStreamPrivate *priv = gtk_media_stream_get_instance_private (self);
+
   g_return_if_fail (GTK_IS_MEDIA_STREAM (self));
   g_return_if_fail (GDK_IS_SURFACE (surface));
 
   g_object_ref (self);
   g_object_ref (surface);
 
+  priv->surfaces = g_slist_append (priv->surfaces, surface);
+  gtk_media_stream_update_frame_clock (self);
+
   GTK_MEDIA_STREAM_GET_CLASS (self)->realize (self, surface);
 }
 
@@ -978,11 +1153,17 @@ void
 gtk_media_stream_unrealize (GtkMediaStream *self,
                             GdkSurface      *surface)
 {
+  GtkMediaStreamPrivate *priv = gtk_media_stream_get_instance_private (self);
+
   g_return_if_fail (GTK_IS_MEDIA_STREAM (self));
   g_return_if_fail (GDK_IS_SURFACE (surface));
+  g_return_if_fail (g_slist_find (priv->surfaces, surface) != NULL);
 
   GTK_MEDIA_STREAM_GET_CLASS (self)->unrealize (self, surface);
 
+  priv->surfaces = g_slist_remove (priv->surfaces, surface);
+  gtk_media_stream_update_frame_clock (self);
+
   g_object_unref (surface);
   g_object_unref (self);
 }
@@ -1347,3 +1528,182 @@ gtk_media_stream_seek_failed (GtkMediaStream *self)
   g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_SEEKING]);
 }
 
+static GtkMediaFramePool *
+gtk_media_frame_pool_new (int width,
+                          int height)
+{
+  GtkMediaFramePool *pool;
+
+  pool = g_slice_new0 (GtkMediaFramePool);
+  pool->ref_count = 1;
+  pool->width = width;
+  pool->height = height;
+  /* Keep rows aligned for the renderers */
+  pool->stride = ((gsize) width * 4 + 63) & ~((gsize) 63);
+
+  return pool;
+}
+
+static void
+gtk_media_frame_pool_unref (GtkMediaFramePool *pool)
+{
+  pool->ref_count--;
+  if (pool->ref_count > 0)
+    return;
+
+  g_slist_free_full (pool->free_buffers, g_free);
+  g_slice_free (GtkMediaFramePool, pool);
+}
+
+static void
+gtk_media_frame_buffer_release (gpointer buffer)
+{
+  GtkMediaFramePool *pool = *(GtkMediaFramePool **) buffer;
+
+  if (pool->ref_count > 1 &&
+      g_slist_length (pool->free_buffers) < MAX_FREE_FRAME_BUFFERS)
+    pool->free_buffers = g_slist_prepend (pool->free_buffers, buffer);
+  else
+    g_free (buffer);
+
+  gtk_media_frame_pool_unref (pool);
+}
+
+/**
+ * gtk_media_stream_acquire_frame_buffer:
+ * @self: a #GtkMediaStream
+ * @width: width of the frame in pixels
+ * @height: height of the frame in pixels
+ * @stride: (out): return location for the distance between rows in bytes
+ *
+ * Gets memory to decode a video frame into. The memory is meant to hold
+ * pixels in the %GDK_MEMORY_DEFAULT format and has to be passed to
+ * gtk_media_stream_submit_frame_buffer() once the frame is decoded.
+ *
+ * The memory of frames that GTK is done with is reused, so this is
+ * much faster than allocating memory for every frame.
+ *
+ * Returns: (transfer none): memory for @height rows of @stride bytes
+ */
+guchar *
+gtk_media_stream_acquire_frame_buffer (GtkMediaStream *self,
+                                       int             width,
+                                       int             height,
+                                       gsize          *stride)
+{
+  GtkMediaStreamPrivate *priv = gtk_media_stream_get_instance_private (self);
+  GtkMediaFramePool *pool;
+  guchar *buffer;
+
+  g_return_val_if_fail (GTK_IS_MEDIA_STREAM (self), NULL);
+  g_return_val_if_fail (width > 0, NULL);
+  g_return_val_if_fail (height > 0, NULL);
+  g_return_val_if_fail (stride != NULL, NULL);
+
+  /* Buffers that are still in use keep the old pool alive */
+  if (priv->frame_pool &&
+      (priv->frame_pool->width != width || priv->frame_pool->height != height))
+    g_clear_pointer (&priv->frame_pool, gtk_media_frame_pool_unref);
+
+  if (priv->frame_pool == NULL)
+    priv->frame_pool = gtk_media_frame_pool_new (width, height);
+
+  pool = priv->frame_pool;
+
+  if (pool->free_buffers)
+    {
+      buffer = pool->free_buffers->data;
+      pool->free_buffers = g_slist_delete_link (pool->free_buffers, pool->free_buffers);
+    }
+  else
+    {
+      buffer = g_malloc (FRAME_BUFFER_HEADER_SIZE + pool->stride * height);
+      *(GtkMediaFramePool **) buffer = pool;
+    }
+
+  *stride = pool->stride;
+
+  return buffer + FRAME_BUFFER_HEADER_SIZE;
+}
+
+/**
+ * gtk_media_stream_submit_frame_buffer:
+ * @self: a #GtkMediaStream
+ * @data: memory returned by gtk_media_stream_acquire_frame_buffer()
+ *
+ * Makes the frame that was decoded into @data the current frame
+ * of @self. @self takes over the memory, it must not be touched
+ * after calling this function.
+ */
+void
+gtk_media_stream_submit_frame_buffer (GtkMediaStream *self,
+                                      guchar         *data)
+{
+  GtkMediaFramePool *pool;
+  GdkTexture *texture;
+  GBytes *bytes;
+  guchar *buffer;
+
+  g_return_if_fail (GTK_IS_MEDIA_STREAM (self));
+  g_return_if_fail (data != NULL);
+
+  buffer = data - FRAME_BUFFER_HEADER_SIZE;
+  pool = *(GtkMediaFramePool **) buffer;
+
+  /* The buffer keeps its pool alive until it is released */
+  pool->ref_count++;
+  bytes = g_bytes_new_with_free_func (data,
+                                      pool->stride * pool->height,
+                                      gtk_media_frame_buffer_release,
+                                      buffer);
+  texture = gdk_memory_texture_new (pool->width, pool->height,
+                                    GDK_MEMORY_DEFAULT,
+                                    bytes,
+                                    pool->stride);
+  g_bytes_unref (bytes);
+
+  gtk_media_stream_submit_frame (self, GDK_PAINTABLE (texture));
+  g_object_unref (texture);
+}
+
+/**
+ * gtk_media_stream_submit_frame:
+ * @self: a #GtkMediaStream
+ * @frame: (nullable): the new frame or %NULL for none
+ *
+ * Makes @frame the current frame of @self, which is what it draws.
+ *
+ * Use this for frames that are not in memory, such as a #GdkGLTexture
+ * that wraps a buffer the video decoder allocated. Such a texture should
+ * be created with a release function that gives the buffer back to the
+ * decoder, GTK drops its references to @frame as soon as it has drawn
+ * a newer frame.
+ *
+ * The contents of @self are invalidated once for the next frame of
+ * the frame clock, even if several frames are submitted before.
+ */
+void
+gtk_media_stream_submit_frame (GtkMediaStream *self,
+                               GdkPaintable   *frame)
+{
+  GtkMediaStreamPrivate *priv = gtk_media_stream_get_instance_private (self);
+
+  g_return_if_fail (GTK_IS_MEDIA_STREAM (self));
+  g_return_if_fail (frame == NULL || GDK_IS_PAINTABLE (frame));
+
+  if (priv->frame == frame)
+    return;
+
+  if (priv->frame == NULL || frame == NULL ||
+      gdk_paintable_get_intrinsic_width (priv->frame) != gdk_paintable_get_intrinsic_width (frame) ||
+      gdk_paintable_get_intrinsic_height (priv->frame) != gdk_paintable_get_intrinsic_height (frame))
+    priv->frame_size_changed = TRUE;
+
+  g_set_object (&priv->frame, frame);
+  priv->frame_changed = TRUE;
+
+  if (priv->frame_clock)
+    gdk_frame_clock_request_phase (priv->frame_clock, GDK_FRAME_CLOCK_PHASE_UPDATE);
+  else
+    gtk_media_stream_invalidate_frame (self);
+}
@@ -150,6 +150,18 @@ void                    gtk_media_stream_error_valist           (GtkMediaStream
                                                                  const gchar    *format,
                                                                  va_list         args) G_GNUC_PRINTF (4, 0);
 
+GDK_AVAILABLE_IN_ALL
+guchar *                gtk_media_stream_acquire_frame_buffer   (GtkMediaStream *self,
+                                                                 int             width,
+                                                                 int             height,
+                                                                 gsize          *stride);
+GDK_AVAILABLE_IN_ALL
+void                    gtk_media_stream_submit_frame_buffer    (GtkMediaStream *self,
+                                                                 guchar         *data);
+GDK_AVAILABLE_IN_ALL
+void                    gtk_media_stream_submit_frame           (GtkMediaStream *self,
+                                                                 GdkPaintable   *frame);
+
 G_END_DECLS
 
 #endif /* __GTK_MEDIA_STREAM_H__ */
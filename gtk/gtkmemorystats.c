@@ -0,0 +1,343 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "gtkmemorystatsprivate.h"
+
+#include "gtkcssanimatedstyleprivate.h"
+#include "gtkcssnodeprivate.h"
+#include "gtkcssstaticstyleprivate.h"
+#include "gtklabelprivate.h"
+#include "gtktextviewprivate.h"
+#include "gtkwidgetprivate.h"
+
+#include <string.h>
+
+/*
+ * Memory census
+ *
+ * Walks a widget tree and adds up what the widgets keep alive for
+ * rendering. Everything that can be shared, like render nodes of
+ * children, textures, styles and value groups, is put into a set
+ * of seen pointers and only counted for the first widget that gets
+ * to it. Children are visited before their parent, so that nodes
+ * are attributed to the widget that created them.
+ *
+ * Most of the sizes are estimates, as neither GSK nor Pango expose
+ * their allocations. They are good enough to compare widgets and to
+ * see what grows over time.
+ */
+
+/* GdkTexture does not expose its format, assume 32 bits per pixel */
+#define TEXTURE_BYTES_PER_PIXEL 4
+
+/* A guess for the node itself, for estimates of single node trees */
+#define RENDER_NODE_BYTES 64
+
+typedef struct {
+  GtkMemoryStats *stats;
+  GHashTable *seen;
+} LayoutData;
+
+void
+gtk_memory_stats_add (GtkMemoryStats       *stats,
+                      const GtkMemoryStats *other)
+{
+  stats->n_widgets += other->n_widgets;
+  stats->n_render_nodes += other->n_render_nodes;
+  stats->render_node_bytes += other->render_node_bytes;
+  stats->n_textures += other->n_textures;
+  stats->texture_bytes += other->texture_bytes;
+  stats->n_layouts += other->n_layouts;
+  stats->layout_bytes += other->layout_bytes;
+  stats->n_styles += other->n_styles;
+  stats->style_bytes += other->style_bytes;
+}
+
+gsize
+gtk_memory_stats_get_bytes (const GtkMemoryStats *stats)
+{
+  return stats->render_node_bytes +
+         stats->texture_bytes +
+         stats->layout_bytes +
+         stats->style_bytes;
+}
+
+static void
+add_texture (GtkMemoryStats *stats,
+             GdkTexture     *texture,
+             GHashTable     *seen)
+{
+  if (!g_hash_table_add (seen, texture))
+    return;
+
+  stats->n_textures++;
+  stats->texture_bytes += (gsize) gdk_texture_get_width (texture) *
+                          gdk_texture_get_height (texture) *
+                          TEXTURE_BYTES_PER_PIXEL;
+}
+
+static void
+add_surface (GtkMemoryStats  *stats,
+             cairo_surface_t *surface,
+             GHashTable      *seen)
+{
+  if (surface == NULL ||
+      cairo_surface_get_type (surface) != CAIRO_SURFACE_TYPE_IMAGE ||
+      !g_hash_table_add (seen, surface))
+    return;
+
+  stats->render_node_bytes += (gsize) cairo_image_surface_get_stride (surface) *
+                              cairo_image_surface_get_height (surface);
+}
+
+static void
+add_render_node (GtkMemoryStats *stats,
+                 GskRenderNode  *node,
+                 GHashTable     *seen)
+{
+  guint i;
+
+  if (node == NULL || !g_hash_table_add (seen, node))
+    return;
+
+  stats->n_render_nodes++;
+
+  switch (gsk_render_node_get_node_type (node))
+    {
+    default:
+    case GSK_NOT_A_RENDER_NODE:
+      g_assert_not_reached ();
+      break;
+
+    case GSK_COLOR_NODE:
+    case GSK_LINEAR_GRADIENT_NODE:
+    case GSK_REPEATING_LINEAR_GRADIENT_NODE:
+    case GSK_BORDER_NODE:
+    case GSK_INSET_SHADOW_NODE:
+    case GSK_OUTSET_SHADOW_NODE:
+      break;
+
+    case GSK_CAIRO_NODE:
+      add_surface (stats, gsk_cairo_node_peek_surface (node), seen);
+      break;
+
+    case GSK_TEXT_NODE:
+      stats->render_node_bytes += gsk_text_node_get_num_glyphs (node) * sizeof (PangoGlyphInfo);
+      break;
+
+    case GSK_TEXTURE_NODE:
+      add_texture (stats, gsk_texture_node_get_texture (node), seen);
+      break;
+
+    case GSK_TRANSFORM_NODE:
+      add_render_node (stats, gsk_transform_node_get_child (node), seen);
+      break;
+
+    case GSK_OPACITY_NODE:
+      add_render_node (stats, gsk_opacity_node_get_child (node), seen);
+      break;
+
+    case GSK_COLOR_MATRIX_NODE:
+      add_render_node (stats, gsk_color_matrix_node_get_child (node), seen);
+      break;
+
+    case GSK_BLUR_NODE:
+      add_render_node (stats, gsk_blur_node_get_child (node), seen);
+      break;
+
+    case GSK_REPEAT_NODE:
+      add_render_node (stats, gsk_repeat_node_get_child (node), seen);
+      break;
+
+    case GSK_CLIP_NODE:
+      add_render_node (stats, gsk_clip_node_get_child (node), seen);
+      break;
+
+    case GSK_ROUNDED_CLIP_NODE:
+      add_render_node (stats, gsk_rounded_clip_node_get_child (node), seen);
+      break;
+
+    case GSK_SHADOW_NODE:
+      add_render_node (stats, gsk_shadow_node_get_child (node), seen);
+      break;
+
+    case GSK_BLEND_NODE:
+      add_render_node (stats, gsk_blend_node_get_bottom_child (node), seen);
+      add_render_node (stats, gsk_blend_node_get_top_child (node), seen);
+      break;
+
+    case GSK_CROSS_FADE_NODE:
+      add_render_node (stats, gsk_cross_fade_node_get_start_child (node), seen);
+      add_render_node (stats, gsk_cross_fade_node_get_end_child (node), seen);
+      break;
+
+    case GSK_CONTAINER_NODE:
+      for (i = 0; i < gsk_container_node_get_n_children (node); i++)
+        add_render_node (stats, gsk_container_node_get_child (node, i), seen);
+      break;
+
+    case GSK_DEBUG_NODE:
+      add_render_node (stats, gsk_debug_node_get_child (node), seen);
+      break;
+    }
+}
+
+static void
+add_style (GtkMemoryStats *stats,
+           GtkCssStyle    *style,
+           GHashTable     *seen)
+{
+  if (style == NULL || !g_hash_table_add (seen, style))
+    return;
+
+  stats->n_styles++;
+
+  if (GTK_IS_CSS_ANIMATED_STYLE (style))
+    {
+      GtkCssAnimatedStyle *animated = GTK_CSS_ANIMATED_STYLE (style);
+
+      stats->style_bytes += sizeof (GtkCssAnimatedStyle);
+      if (animated->animated_values)
+        stats->style_bytes += animated->animated_values->len * sizeof (gpointer);
+
+      add_style (stats, animated->style, seen);
+    }
+  else if (GTK_IS_CSS_STATIC_STYLE (style))
+    {
+      stats->style_bytes += gtk_css_static_style_get_memory_size (GTK_CSS_STATIC_STYLE (style), seen);
+    }
+}
+
+static void
+add_layout (gpointer layout,
+            gpointer user_data)
+{
+  LayoutData *data = user_data;
+  const char *text;
+
+  if (!g_hash_table_add (data->seen, layout))
+    return;
+
+  /* Don't ask for the lines, that would lay out the layout.
+   * The text and its log attrs are the part that grows. */
+  text = pango_layout_get_text (layout);
+  data->stats->n_layouts++;
+  data->stats->layout_bytes += (text ? strlen (text) : 0) +
+                               (pango_layout_get_character_count (layout) + 1) * sizeof (PangoLogAttr);
+}
+
+static void
+collect_widget (GtkWidget      *widget,
+                GHashTable     *seen,
+                GtkMemoryStats *total,
+                GHashTable     *by_type)
+{
+  GtkWidgetPrivate *priv = widget->priv;
+  GtkMemoryStats stats = { 0, };
+  GtkMemoryStats *type_stats;
+  GtkWidget *child;
+  LayoutData data;
+
+  for (child = _gtk_widget_get_first_child (widget);
+       child != NULL;
+       child = _gtk_widget_get_next_sibling (child))
+    collect_widget (child, seen, total, by_type);
+
+  stats.n_widgets = 1;
+
+  /* The transform node wraps the render node, if there is one */
+  add_render_node (&stats, priv->transform_node, seen);
+  add_render_node (&stats, priv->render_node, seen);
+
+  add_style (&stats, gtk_css_node_get_style (priv->cssnode), seen);
+
+  data.stats = &stats;
+  data.seen = seen;
+  if (GTK_IS_LABEL (widget))
+    _gtk_label_foreach_layout (GTK_LABEL (widget), add_layout, &data);
+  else if (GTK_IS_TEXT_VIEW (widget))
+    gtk_text_view_foreach_layout (GTK_TEXT_VIEW (widget), add_layout, &data);
+
+  if (total)
+    gtk_memory_stats_add (total, &stats);
+
+  if (by_type)
+    {
+      type_stats = g_hash_table_lookup (by_type, GSIZE_TO_POINTER (G_OBJECT_TYPE (widget)));
+      if (type_stats == NULL)
+        {
+          type_stats = g_new0 (GtkMemoryStats, 1);
+          g_hash_table_insert (by_type, GSIZE_TO_POINTER (G_OBJECT_TYPE (widget)), type_stats);
+        }
+      gtk_memory_stats_add (type_stats, &stats);
+    }
+}
+
+/*
+ * gtk_memory_stats_estimate_render_node:
+ * @node: (nullable): a #GskRenderNode
+ *
+ * Estimates how many bytes @node and everything it draws keep
+ * alive, counting nodes that are used more than once only once.
+ *
+ * Returns: the estimated size in bytes
+ */
+gsize
+gtk_memory_stats_estimate_render_node (GskRenderNode *node)
+{
+  GtkMemoryStats stats = { 0, };
+  GHashTable *seen;
+
+  if (node == NULL)
+    return 0;
+
+  seen = g_hash_table_new (NULL, NULL);
+  add_render_node (&stats, node, seen);
+  g_hash_table_unref (seen);
+
+  return stats.n_render_nodes * RENDER_NODE_BYTES +
+         stats.render_node_bytes +
+         stats.texture_bytes;
+}
+
+/*
+ * gtk_memory_stats_collect:
+ * @widget: a #GtkWidget
+ * @seen: a set of pointers, see g_hash_table_add()
+ * @total: (nullable): the stats to add the whole tree of @widget to
+ * @by_type: (nullable): a #GHashTable mapping #GType to #GtkMemoryStats
+ *
+ * Adds up the memory held by @widget and its descendents, skipping
+ * everything in @seen and adding what was counted to it. Use the same
+ * set when collecting several trees to not count shared data twice.
+ *
+ * If @by_type is given, stats for every widget type that is found
+ * are added to it, missing entries are created with g_new0().
+ */
+void
+gtk_memory_stats_collect (GtkWidget      *widget,
+                          GHashTable     *seen,
+                          GtkMemoryStats *total,
+                          GHashTable     *by_type)
+{
+  g_return_if_fail (GTK_IS_WIDGET (widget));
+  g_return_if_fail (seen != NULL);
+
+  collect_widget (widget, seen, total, by_type);
+}
@@ -0,0 +1,60 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GTK_MEMORY_STATS_PRIVATE_H__
+#define __GTK_MEMORY_STATS_PRIVATE_H__
+
+#include "gtkwidget.h"
+
+G_BEGIN_DECLS
+
+typedef struct _GtkMemoryStats GtkMemoryStats;
+
+struct _GtkMemoryStats
+{
+  guint n_widgets;
+
+  /* Retained render nodes, with the glyphs and cairo surfaces they hold */
+  guint n_render_nodes;
+  gsize render_node_bytes;
+
+  /* Textures drawn by the retained render nodes */
+  guint n_textures;
+  gsize texture_bytes;
+
+  /* Layouts cached by labels and text views */
+  guint n_layouts;
+  gsize layout_bytes;
+
+  guint n_styles;
+  gsize style_bytes;
+};
+
+void                    gtk_memory_stats_add                    (GtkMemoryStats         *stats,
+                                                                 const GtkMemoryStats   *other);
+gsize                   gtk_memory_stats_get_bytes              (const GtkMemoryStats   *stats);
+
+gsize                   gtk_memory_stats_estimate_render_node   (GskRenderNode          *node);
+
+void                    gtk_memory_stats_collect                (GtkWidget              *widget,
+                                                                 GHashTable             *seen,
+                                                                 GtkMemoryStats         *total,
+                                                                 GHashTable             *by_type);
+
+G_END_DECLS
+
+#endif /* __GTK_MEMORY_STATS_PRIVATE_H__ */
@@ -41,6 +41,7 @@ struct _GtkMenuSectionBox
 
   GtkMenuSectionBox *toplevel;
   GtkMenuTracker    *tracker;
+  GtkMenuTrackerItem *submenu_item;
   GtkBox            *item_box;
   GtkWidget         *separator;
   guint              separator_sync_idle;
@@ -376,6 +377,7 @@ gtk_menu_section_box_dispose (GObject *object)
     }
 
   g_clear_object (&box->separator);
+  g_clear_object (&box->submenu_item);
 
   if (box->tracker)
     {
@@ -386,10 +388,26 @@ gtk_menu_section_box_dispose (GObject *object)
   G_OBJECT_CLASS (gtk_menu_section_box_parent_class)->dispose (object);
 }
 
+static void
+gtk_menu_section_box_map (GtkWidget *widget)
+{
+  GtkMenuSectionBox *box = GTK_MENU_SECTION_BOX (widget);
+
+  /* Submenus are only filled in when they are shown for the first time */
+  if (box->submenu_item != NULL && box->tracker == NULL)
+    box->tracker = gtk_menu_tracker_new_for_item_link (box->submenu_item, G_MENU_LINK_SUBMENU, FALSE, FALSE,
+                                                       gtk_menu_section_box_insert_func,
+                                                       gtk_menu_section_box_remove_func,
+                                                       box);
+
+  GTK_WIDGET_CLASS (gtk_menu_section_box_parent_class)->map (widget);
+}
+
 static void
 gtk_menu_section_box_class_init (GtkMenuSectionBoxClass *class)
 {
   G_OBJECT_CLASS (class)->dispose = gtk_menu_section_box_dispose;
+  GTK_WIDGET_CLASS (class)->map = gtk_menu_section_box_map;
 }
 
 static void
@@ -472,10 +490,8 @@ gtk_menu_section_box_new_submenu (GtkMenuTrackerItem *item,
   gtk_stack_add_named (GTK_STACK (gtk_widget_get_ancestor (GTK_WIDGET (toplevel), GTK_TYPE_STACK)),
                        GTK_WIDGET (box), gtk_menu_tracker_item_get_label (item));
 
-  box->tracker = gtk_menu_tracker_new_for_item_link (item, G_MENU_LINK_SUBMENU, FALSE, FALSE,
-                                                     gtk_menu_section_box_insert_func,
-                                                     gtk_menu_section_box_remove_func,
-                                                     box);
+  /* The items are added in gtk_menu_section_box_map() */
+  box->submenu_item = g_object_ref (item);
 }
 
 static GtkWidget *
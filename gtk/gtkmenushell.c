@@ -1831,6 +1831,27 @@ gtk_menu_shell_tracker_remove_func (gint     position,
   gtk_widget_destroy (child);
 }
 
+static void gtk_menu_shell_tracker_insert_func (GtkMenuTrackerItem *item,
+                                                gint                position,
+                                                gpointer            user_data);
+
+static void
+gtk_menu_shell_submenu_populate (GtkWidget *submenu,
+                                 gpointer   user_data)
+{
+  GtkMenuShell *menu_shell = GTK_MENU_SHELL (submenu);
+  GtkMenuTrackerItem *item = user_data;
+
+  if (menu_shell->priv->tracker)
+    return;
+
+  menu_shell->priv->tracker = gtk_menu_tracker_new_for_item_link (item,
+                                                                  G_MENU_LINK_SUBMENU, TRUE, FALSE,
+                                                                  gtk_menu_shell_tracker_insert_func,
+                                                                  gtk_menu_shell_tracker_remove_func,
+                                                                  menu_shell);
+}
+
 static void
 gtk_menu_shell_tracker_insert_func (GtkMenuTrackerItem *item,
                                     gint                position,
@@ -1868,15 +1889,13 @@ gtk_menu_shell_tracker_insert_func (GtkMenuTrackerItem *item,
       submenu = GTK_MENU_SHELL (gtk_menu_new ());
       gtk_widget_hide (GTK_WIDGET (submenu));
 
-      /* We recurse directly here: we could use an idle instead to
-       * prevent arbitrary recursion depth.  We could also do it
-       * lazy...
+      /* The items of the submenu are only created when it is shown
+       * for the first time.
+       *
+       * Note: 'item' is kept alive by the menu item, which owns the
+       * submenu.
        */
-      submenu->priv->tracker = gtk_menu_tracker_new_for_item_link (item,
-                                                                   G_MENU_LINK_SUBMENU, TRUE, FALSE,
-                                                                   gtk_menu_shell_tracker_insert_func,
-                                                                   gtk_menu_shell_tracker_remove_func,
-                                                                   submenu);
+      g_signal_connect (submenu, "show", G_CALLBACK (gtk_menu_shell_submenu_populate), item);
       gtk_menu_item_set_submenu (GTK_MENU_ITEM (widget), GTK_WIDGET (submenu));
 
       if (gtk_menu_tracker_item_get_should_request_show (item))
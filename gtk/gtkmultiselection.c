@@ -0,0 +1,697 @@
+/*
+ * Copyright © 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "gtkmultiselection.h"
+
+#include "gtkintl.h"
+#include "gtkselectionmodel.h"
+
+/**
+ * SECTION:gtkmultiselection
+ * @Short_description: A selection model that allows selecting multiple items
+ * @Title: GtkMultiSelection
+ * @see_also: #GtkSelectionModel, #GtkSingleSelection
+ *
+ * GtkMultiSelection is an implementation of the #GtkSelectionModel interface
+ * that allows selecting any number of items.
+ *
+ * The selection is stored as a sorted list of ranges, so its size depends
+ * on how fragmented the selection is, not on the number of selected items.
+ * Looking up ranges takes logarithmic time, and selecting all items as well
+ * as inverting the selection take constant time.
+ */
+
+typedef struct _SelectionRange SelectionRange;
+
+struct _SelectionRange
+{
+  guint start;
+  guint n_items;
+};
+
+struct _GtkMultiSelection
+{
+  GObject parent_instance;
+
+  GListModel *model;
+
+  /* Sorted, disjoint and non-adjacent. If inverted is set, these
+   * are the unselected items instead of the selected ones.
+   */
+  GArray *ranges;
+  guint n_stored;
+  guint inverted : 1;
+};
+
+struct _GtkMultiSelectionClass
+{
+  GObjectClass parent_class;
+};
+
+enum {
+  PROP_0,
+  PROP_MODEL,
+  N_PROPS
+};
+
+static GParamSpec *properties[N_PROPS] = { NULL, };
+
+#define RANGE(self, i) (&g_array_index ((self)->ranges, SelectionRange, (i)))
+#define RANGE_END(range) ((range)->start + (range)->n_items)
+
+static guint
+gtk_multi_selection_get_model_n_items (GtkMultiSelection *self)
+{
+  if (self->model == NULL)
+    return 0;
+
+  return g_list_model_get_n_items (self->model);
+}
+
+/* Returns the index of the first range that ends after @position */
+static guint
+gtk_multi_selection_find_range (GtkMultiSelection *self,
+                                guint              position)
+{
+  guint lo, hi, mid;
+
+  lo = 0;
+  hi = self->ranges->len;
+  while (lo < hi)
+    {
+      mid = (lo + hi) / 2;
+      if (RANGE_END (RANGE (self, mid)) <= position)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  return lo;
+}
+
+static void
+gtk_multi_selection_add_stored (GtkMultiSelection *self,
+                                guint              start,
+                                guint              n_items)
+{
+  SelectionRange range;
+  guint i, j, end;
+
+  if (n_items == 0)
+    return;
+
+  end = start + n_items;
+
+  /* Ranges touching the new one get merged, too */
+  i = gtk_multi_selection_find_range (self, start > 0 ? start - 1 : 0);
+  for (j = i; j < self->ranges->len && RANGE (self, j)->start <= end; j++)
+    {
+      SelectionRange *r = RANGE (self, j);
+
+      start = MIN (start, r->start);
+      end = MAX (end, RANGE_END (r));
+      self->n_stored -= r->n_items;
+    }
+
+  range.start = start;
+  range.n_items = end - start;
+  self->n_stored += range.n_items;
+
+  if (j > i)
+    {
+      *RANGE (self, i) = range;
+      if (j > i + 1)
+        g_array_remove_range (self->ranges, i + 1, j - i - 1);
+    }
+  else
+    g_array_insert_val (self->ranges, i, range);
+}
+
+static void
+gtk_multi_selection_remove_stored (GtkMultiSelection *self,
+                                   guint              start,
+                                   guint              n_items)
+{
+  SelectionRange *r;
+  guint i, j, end;
+
+  if (n_items == 0)
+    return;
+
+  end = start + n_items;
+
+  i = gtk_multi_selection_find_range (self, start);
+  if (i >= self->ranges->len)
+    return;
+
+  r = RANGE (self, i);
+  if (r->start < start)
+    {
+      guint r_end = RANGE_END (r);
+
+      if (r_end > end)
+        {
+          SelectionRange tail = { end, r_end - end };
+
+          /* punch a hole into the range */
+          r->n_items = start - r->start;
+          self->n_stored -= n_items;
+          g_array_insert_val (self->ranges, i + 1, tail);
+          return;
+        }
+
+      self->n_stored -= r_end - start;
+      r->n_items = start - r->start;
+      i++;
+    }
+
+  for (j = i; j < self->ranges->len; j++)
+    {
+      r = RANGE (self, j);
+      if (RANGE_END (r) > end)
+        break;
+      self->n_stored -= r->n_items;
+    }
+  g_array_remove_range (self->ranges, i, j - i);
+
+  if (i < self->ranges->len)
+    {
+      r = RANGE (self, i);
+      if (r->start < end)
+        {
+          self->n_stored -= end - r->start;
+          r->n_items = RANGE_END (r) - end;
+          r->start = end;
+        }
+    }
+}
+
+static void
+gtk_multi_selection_set_range (GtkMultiSelection *self,
+                               guint              start,
+                               guint              n_items,
+                               gboolean           selected)
+{
+  if (selected != self->inverted)
+    gtk_multi_selection_add_stored (self, start, n_items);
+  else
+    gtk_multi_selection_remove_stored (self, start, n_items);
+}
+
+static void
+gtk_multi_selection_clear (GtkMultiSelection *self,
+                           gboolean           selected)
+{
+  g_array_set_size (self->ranges, 0);
+  self->n_stored = 0;
+  self->inverted = selected;
+}
+
+/* Gets the smallest range that contains all selected items */
+static gboolean
+gtk_multi_selection_get_bounds (GtkMultiSelection *self,
+                                guint             *start,
+                                guint             *end)
+{
+  guint n_items = gtk_multi_selection_get_model_n_items (self);
+
+  if (self->inverted)
+    {
+      if (self->n_stored >= n_items)
+        return FALSE;
+
+      *start = 0;
+      *end = n_items;
+    }
+  else
+    {
+      if (self->ranges->len == 0)
+        return FALSE;
+
+      *start = RANGE (self, 0)->start;
+      *end = RANGE_END (RANGE (self, self->ranges->len - 1));
+    }
+
+  return TRUE;
+}
+
+static GType
+gtk_multi_selection_get_item_type (GListModel *list)
+{
+  GtkMultiSelection *self = GTK_MULTI_SELECTION (list);
+
+  return g_list_model_get_item_type (self->model);
+}
+
+static guint
+gtk_multi_selection_get_n_items (GListModel *list)
+{
+  GtkMultiSelection *self = GTK_MULTI_SELECTION (list);
+
+  return gtk_multi_selection_get_model_n_items (self);
+}
+
+static gpointer
+gtk_multi_selection_get_item (GListModel *list,
+                              guint       position)
+{
+  GtkMultiSelection *self = GTK_MULTI_SELECTION (list);
+
+  if (self->model == NULL)
+    return NULL;
+
+  return g_list_model_get_item (self->model, position);
+}
+
+static void
+gtk_multi_selection_list_model_init (GListModelInterface *iface)
+{
+  iface->get_item_type = gtk_multi_selection_get_item_type;
+  iface->get_n_items = gtk_multi_selection_get_n_items;
+  iface->get_item = gtk_multi_selection_get_item;
+}
+
+static gboolean
+gtk_multi_selection_is_selected (GtkSelectionModel *model,
+                                 guint              position)
+{
+  GtkMultiSelection *self = GTK_MULTI_SELECTION (model);
+  gboolean stored;
+  guint i;
+
+  if (position >= gtk_multi_selection_get_model_n_items (self))
+    return FALSE;
+
+  i = gtk_multi_selection_find_range (self, position);
+  stored = i < self->ranges->len && RANGE (self, i)->start <= position;
+
+  return stored != self->inverted;
+}
+
+static gboolean
+gtk_multi_selection_select_range (GtkSelectionModel *model,
+                                  guint              position,
+                                  guint              n_items,
+                                  gboolean           exclusive)
+{
+  GtkMultiSelection *self = GTK_MULTI_SELECTION (model);
+  guint n_model, start, end, old_start, old_end;
+
+  n_model = gtk_multi_selection_get_model_n_items (self);
+  if (position >= n_model)
+    return FALSE;
+  n_items = MIN (n_items, n_model - position);
+
+  start = position;
+  end = position + n_items;
+
+  if (exclusive)
+    {
+      if (gtk_multi_selection_get_bounds (self, &old_start, &old_end))
+        {
+          start = MIN (start, old_start);
+          end = MAX (end, old_end);
+        }
+      gtk_multi_selection_clear (self, FALSE);
+    }
+
+  gtk_multi_selection_set_range (self, position, n_items, TRUE);
+
+  gtk_selection_model_selection_changed (model, start, end - start);
+
+  return TRUE;
+}
+
+static gboolean
+gtk_multi_selection_unselect_range (GtkSelectionModel *model,
+                                    guint              position,
+                                    guint              n_items)
+{
+  GtkMultiSelection *self = GTK_MULTI_SELECTION (model);
+  guint n_model;
+
+  n_model = gtk_multi_selection_get_model_n_items (self);
+  if (position >= n_model)
+    return FALSE;
+  n_items = MIN (n_items, n_model - position);
+
+  gtk_multi_selection_set_range (self, position, n_items, FALSE);
+
+  gtk_selection_model_selection_changed (model, position, n_items);
+
+  return TRUE;
+}
+
+static gboolean
+gtk_multi_selection_select_item (GtkSelectionModel *model,
+                                 guint              position,
+                                 gboolean           exclusive)
+{
+  return gtk_multi_selection_select_range (model, position, 1, exclusive);
+}
+
+static gboolean
+gtk_multi_selection_unselect_item (GtkSelectionModel *model,
+                                   guint              position)
+{
+  return gtk_multi_selection_unselect_range (model, position, 1);
+}
+
+static gboolean
+gtk_multi_selection_select_all (GtkSelectionModel *model)
+{
+  GtkMultiSelection *self = GTK_MULTI_SELECTION (model);
+  guint n_items;
+
+  gtk_multi_selection_clear (self, TRUE);
+
+  n_items = gtk_multi_selection_get_model_n_items (self);
+  if (n_items > 0)
+    gtk_selection_model_selection_changed (model, 0, n_items);
+
+  return TRUE;
+}
+
+static gboolean
+gtk_multi_selection_unselect_all (GtkSelectionModel *model)
+{
+  GtkMultiSelection *self = GTK_MULTI_SELECTION (model);
+  guint start, end;
+
+  if (!gtk_multi_selection_get_bounds (self, &start, &end))
+    {
+      gtk_multi_selection_clear (self, FALSE);
+      return TRUE;
+    }
+
+  gtk_multi_selection_clear (self, FALSE);
+  gtk_selection_model_selection_changed (model, start, end - start);
+
+  return TRUE;
+}
+
+static void
+gtk_multi_selection_query_range (GtkSelectionModel *model,
+                                 guint              position,
+                                 guint             *start_range,
+                                 guint             *n_range,
+                                 gboolean          *selected)
+{
+  GtkMultiSelection *self = GTK_MULTI_SELECTION (model);
+  guint i, n_items;
+
+  n_items = gtk_multi_selection_get_model_n_items (self);
+
+  if (position >= n_items)
+    {
+      *start_range = position;
+      *n_range = 0;
+      *selected = FALSE;
+      return;
+    }
+
+  i = gtk_multi_selection_find_range (self, position);
+  if (i < self->ranges->len && RANGE (self, i)->start <= position)
+    {
+      *start_range = RANGE (self, i)->start;
+      *n_range = RANGE (self, i)->n_items;
+      *selected = !self->inverted;
+    }
+  else
+    {
+      *start_range = i > 0 ? RANGE_END (RANGE (self, i - 1)) : 0;
+      *n_range = (i < self->ranges->len ? RANGE (self, i)->start : n_items) - *start_range;
+      *selected = self->inverted;
+    }
+}
+
+static void
+gtk_multi_selection_selection_model_init (GtkSelectionModelInterface *iface)
+{
+  iface->is_selected = gtk_multi_selection_is_selected;
+  iface->select_item = gtk_multi_selection_select_item;
+  iface->unselect_item = gtk_multi_selection_unselect_item;
+  iface->select_range = gtk_multi_selection_select_range;
+  iface->unselect_range = gtk_multi_selection_unselect_range;
+  iface->select_all = gtk_multi_selection_select_all;
+  iface->unselect_all = gtk_multi_selection_unselect_all;
+  iface->query_range = gtk_multi_selection_query_range;
+}
+
+G_DEFINE_TYPE_EXTENDED (GtkMultiSelection, gtk_multi_selection, G_TYPE_OBJECT, 0,
+                        G_IMPLEMENT_INTERFACE (G_TYPE_LIST_MODEL,
+                                               gtk_multi_selection_list_model_init)
+                        G_IMPLEMENT_INTERFACE (GTK_TYPE_SELECTION_MODEL,
+                                               gtk_multi_selection_selection_model_init))
+
+static void
+gtk_multi_selection_items_changed_cb (GListModel        *model,
+                                      guint              position,
+                                      guint              removed,
+                                      guint              added,
+                                      GtkMultiSelection *self)
+{
+  SelectionRange *r;
+  guint i;
+
+  gtk_multi_selection_remove_stored (self, position, removed);
+
+  /* Split a range that the new items get inserted into */
+  i = gtk_multi_selection_find_range (self, position);
+  if (i < self->ranges->len && RANGE (self, i)->start < position)
+    {
+      SelectionRange tail;
+
+      r = RANGE (self, i);
+      tail.start = position;
+      tail.n_items = RANGE_END (r) - position;
+      r->n_items = position - r->start;
+      g_array_insert_val (self->ranges, i + 1, tail);
+      i++;
+    }
+
+  if (added != removed)
+    {
+      guint j;
+
+      for (j = i; j < self->ranges->len; j++)
+        {
+          r = RANGE (self, j);
+          r->start = r->start - removed + added;
+        }
+    }
+
+  /* Join the ranges on both sides if nothing got added in between */
+  if (added == 0 && i > 0 && i < self->ranges->len &&
+      RANGE_END (RANGE (self, i - 1)) == RANGE (self, i)->start)
+    {
+      RANGE (self, i - 1)->n_items += RANGE (self, i)->n_items;
+      g_array_remove_index (self->ranges, i);
+    }
+
+  /* New items start out unselected */
+  if (self->inverted)
+    gtk_multi_selection_add_stored (self, position, added);
+
+  g_list_model_items_changed (G_LIST_MODEL (self), position, removed, added);
+}
+
+static void
+gtk_multi_selection_clear_model (GtkMultiSelection *self)
+{
+  if (self->model == NULL)
+    return;
+
+  g_signal_handlers_disconnect_by_func (self->model,
+                                        gtk_multi_selection_items_changed_cb,
+                                        self);
+  g_clear_object (&self->model);
+}
+
+static void
+gtk_multi_selection_set_property (GObject      *object,
+                                  guint         prop_id,
+                                  const GValue *value,
+                                  GParamSpec   *pspec)
+
+{
+  GtkMultiSelection *self = GTK_MULTI_SELECTION (object);
+
+  switch (prop_id)
+    {
+    case PROP_MODEL:
+      gtk_multi_selection_clear_model (self);
+      self->model = g_value_dup_object (value);
+      if (self->model)
+        g_signal_connect (self->model, "items-changed",
+                          G_CALLBACK (gtk_multi_selection_items_changed_cb), self);
+      gtk_multi_selection_clear (self, FALSE);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+    }
+}
+
+static void
+gtk_multi_selection_get_property (GObject    *object,
+                                  guint       prop_id,
+                                  GValue     *value,
+                                  GParamSpec *pspec)
+{
+  GtkMultiSelection *self = GTK_MULTI_SELECTION (object);
+
+  switch (prop_id)
+    {
+    case PROP_MODEL:
+      g_value_set_object (value, self->model);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+    }
+}
+
+static void
+gtk_multi_selection_dispose (GObject *object)
+{
+  GtkMultiSelection *self = GTK_MULTI_SELECTION (object);
+
+  gtk_multi_selection_clear_model (self);
+  gtk_multi_selection_clear (self, FALSE);
+
+  G_OBJECT_CLASS (gtk_multi_selection_parent_class)->dispose (object);
+}
+
+static void
+gtk_multi_selection_finalize (GObject *object)
+{
+  GtkMultiSelection *self = GTK_MULTI_SELECTION (object);
+
+  g_array_free (self->ranges, TRUE);
+
+  G_OBJECT_CLASS (gtk_multi_selection_parent_class)->finalize (object);
+}
+
+static void
+gtk_multi_selection_class_init (GtkMultiSelectionClass *klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+
+  gobject_class->get_property = gtk_multi_selection_get_property;
+  gobject_class->set_property = gtk_multi_selection_set_property;
+  gobject_class->dispose = gtk_multi_selection_dispose;
+  gobject_class->finalize = gtk_multi_selection_finalize;
+
+  /**
+   * GtkMultiSelection:model:
+   *
+   * The list managed by this selection
+   */
+  properties[PROP_MODEL] =
+    g_param_spec_object ("model",
+                       P_("Model"),
+                       P_("List managed by this selection"),
+                       G_TYPE_LIST_MODEL,
+                       G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY | G_PARAM_STATIC_STRINGS);
+
+  g_object_class_install_properties (gobject_class, N_PROPS, properties);
+}
+
+static void
+gtk_multi_selection_init (GtkMultiSelection *self)
+{
+  self->ranges = g_array_new (FALSE, FALSE, sizeof (SelectionRange));
+}
+
+/**
+ * gtk_multi_selection_new:
+ * @model: (transfer none): the #GListModel to manage
+ *
+ * Creates a new selection to handle @model.
+ *
+ * Returns: (transfer full) (type GtkMultiSelection): a new #GtkMultiSelection
+ **/
+GtkMultiSelection *
+gtk_multi_selection_new (GListModel *model)
+{
+  g_return_val_if_fail (G_IS_LIST_MODEL (model), NULL);
+
+  return g_object_new (GTK_TYPE_MULTI_SELECTION,
+                       "model", model,
+                       NULL);
+}
+
+/**
+ * gtk_multi_selection_get_model:
+ * @self: a #GtkMultiSelection
+ *
+ * Gets the model that @self is managing.
+ *
+ * Returns: (transfer none): the model
+ **/
+GListModel *
+gtk_multi_selection_get_model (GtkMultiSelection *self)
+{
+  g_return_val_if_fail (GTK_IS_MULTI_SELECTION (self), NULL);
+
+  return self->model;
+}
+
+/**
+ * gtk_multi_selection_get_n_selected:
+ * @self: a #GtkMultiSelection
+ *
+ * Gets the number of selected items.
+ *
+ * Returns: the number of selected items
+ **/
+guint
+gtk_multi_selection_get_n_selected (GtkMultiSelection *self)
+{
+  g_return_val_if_fail (GTK_IS_MULTI_SELECTION (self), 0);
+
+  if (self->inverted)
+    return gtk_multi_selection_get_model_n_items (self) - self->n_stored;
+  else
+    return self->n_stored;
+}
+
+/**
+ * gtk_multi_selection_invert:
+ * @self: a #GtkMultiSelection
+ *
+ * Selects all items that are not selected and unselects all
+ * items that are.
+ **/
+void
+gtk_multi_selection_invert (GtkMultiSelection *self)
+{
+  guint n_items;
+
+  g_return_if_fail (GTK_IS_MULTI_SELECTION (self));
+
+  self->inverted = !self->inverted;
+
+  n_items = gtk_multi_selection_get_model_n_items (self);
+  if (n_items > 0)
+    gtk_selection_model_selection_changed (GTK_SELECTION_MODEL (self), 0, n_items);
+}
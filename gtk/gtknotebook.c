@@ -45,6 +45,7 @@
 #include "gtkmenu.h"
 #include "gtkmenuitem.h"
 #include "gtkorientable.h"
+#include "gtksettingsprivate.h"
 #include "gtksizerequest.h"
 #include "gtkstylecontextprivate.h"
 #include "gtkprivate.h"
@@ -272,6 +273,7 @@ enum {
   PROP_ENABLE_POPUP,
   PROP_GROUP_NAME,
   PROP_PAGES,
+  PROP_LAZY_PAGES,
   LAST_PROP
 };
 
@@ -1013,6 +1015,21 @@ gtk_notebook_class_init (GtkNotebookClass *class)
                            G_TYPE_LIST_MODEL,
                            GTK_PARAM_READABLE);
 
+  /**
+   * GtkNotebook:lazy-pages:
+   *
+   * Whether pages that have never been shown are left out of
+   * style validation and size measurement.
+   *
+   * See #GtkStack:lazy-pages.
+   */
+  properties[PROP_LAZY_PAGES] =
+      g_param_spec_boolean ("lazy-pages",
+                            P_("Lazy pages"),
+                            P_("Whether pages are only styled and measured once shown"),
+                            FALSE,
+                            GTK_PARAM_READWRITE|G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_install_properties (gobject_class, LAST_PROP, properties);
 
   /**
@@ -1709,6 +1726,9 @@ gtk_notebook_set_property (GObject         *object,
     case PROP_GROUP_NAME:
       gtk_notebook_set_group_name (notebook, g_value_get_string (value));
       break;
+    case PROP_LAZY_PAGES:
+      gtk_notebook_set_lazy_pages (notebook, g_value_get_boolean (value));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1750,6 +1770,9 @@ gtk_notebook_get_property (GObject         *object,
     case PROP_PAGES:
       g_value_set_object (value, gtk_notebook_get_pages (notebook));
       break;
+    case PROP_LAZY_PAGES:
+      g_value_set_boolean (value, gtk_notebook_get_lazy_pages (notebook));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -2834,7 +2857,7 @@ check_threshold (GtkNotebook *notebook,
   GtkSettings *settings;
 
   settings = gtk_widget_get_settings (GTK_WIDGET (notebook));
-  g_object_get (G_OBJECT (settings), "gtk-dnd-drag-threshold", &dnd_threshold, NULL);
+  dnd_threshold = gtk_settings_get_values (settings)->dnd_drag_threshold;
 
   /* we want a large threshold */
   dnd_threshold *= DND_THRESHOLD_MULTIPLIER;
@@ -5277,8 +5300,8 @@ gtk_notebook_calculate_tabs_allocation (GtkNotebook          *notebook,
 
 static void
 gtk_notebook_pages_allocate (GtkNotebook *notebook,
-                             int          width,
-                             int          height)
+                             gint         width,
+                             gint         height)
 {
   GtkNotebookPrivate *priv = notebook->priv;
   GList *children = NULL;
@@ -6971,6 +6994,96 @@ gtk_notebook_get_group_name (GtkNotebook *notebook)
   return g_quark_to_string (notebook->priv->group);
 }
 
+/**
+ * gtk_notebook_set_lazy_pages:
+ * @notebook: a #GtkNotebook
+ * @lazy_pages: %TRUE to only style and measure pages once shown
+ *
+ * Sets whether pages of @notebook that have never been shown
+ * are styled and measured. This can make notebooks with many
+ * expensive pages much cheaper to set up.
+ *
+ * See gtk_stack_set_lazy_pages() for details.
+ */
+void
+gtk_notebook_set_lazy_pages (GtkNotebook *notebook,
+                             gboolean     lazy_pages)
+{
+  GtkStack *stack;
+
+  g_return_if_fail (GTK_IS_NOTEBOOK (notebook));
+
+  stack = GTK_STACK (notebook->priv->stack_widget);
+  lazy_pages = lazy_pages != FALSE;
+
+  if (gtk_stack_get_lazy_pages (stack) == lazy_pages)
+    return;
+
+  gtk_stack_set_lazy_pages (stack, lazy_pages);
+
+  g_object_notify_by_pspec (G_OBJECT (notebook), properties[PROP_LAZY_PAGES]);
+}
+
+/**
+ * gtk_notebook_get_lazy_pages:
+ * @notebook: a #GtkNotebook
+ *
+ * Returns whether pages that have never been shown are left
+ * out of styling and measurement.
+ * See gtk_notebook_set_lazy_pages().
+ *
+ * Returns: %TRUE if @notebook has lazy pages
+ */
+gboolean
+gtk_notebook_get_lazy_pages (GtkNotebook *notebook)
+{
+  g_return_val_if_fail (GTK_IS_NOTEBOOK (notebook), FALSE);
+
+  return gtk_stack_get_lazy_pages (GTK_STACK (notebook->priv->stack_widget));
+}
+
+/**
+ * gtk_notebook_set_placeholder_size:
+ * @notebook: a #GtkNotebook
+ * @width: the width to reserve for unmeasured pages, or -1
+ * @height: the height to reserve for unmeasured pages, or -1
+ *
+ * Sets the size that is reserved for pages that have not been
+ * measured because of #GtkNotebook:lazy-pages.
+ *
+ * See gtk_stack_set_placeholder_size().
+ */
+void
+gtk_notebook_set_placeholder_size (GtkNotebook *notebook,
+                                   gint         width,
+                                   gint         height)
+{
+  g_return_if_fail (GTK_IS_NOTEBOOK (notebook));
+
+  gtk_stack_set_placeholder_size (GTK_STACK (notebook->priv->stack_widget),
+                                  width, height);
+}
+
+/**
+ * gtk_notebook_get_placeholder_size:
+ * @notebook: a #GtkNotebook
+ * @width: (out) (optional): return location for the width
+ * @height: (out) (optional): return location for the height
+ *
+ * Gets the size reserved for pages that have not been measured.
+ * See gtk_notebook_set_placeholder_size().
+ */
+void
+gtk_notebook_get_placeholder_size (GtkNotebook *notebook,
+                                   gint        *width,
+                                   gint        *height)
+{
+  g_return_if_fail (GTK_IS_NOTEBOOK (notebook));
+
+  gtk_stack_get_placeholder_size (GTK_STACK (notebook->priv->stack_widget),
+                                  width, height);
+}
+
 /**
  * gtk_notebook_get_tab_reorderable:
  * @notebook: a #GtkNotebook
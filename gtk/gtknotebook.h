@@ -179,6 +179,24 @@ void         gtk_notebook_set_group_name (GtkNotebook *notebook,
 GDK_AVAILABLE_IN_ALL
 const gchar *gtk_notebook_get_group_name (GtkNotebook *notebook);
 
+/***********************************************************
+ *           Lazy pages                                    *
+ ***********************************************************/
+
+GDK_AVAILABLE_IN_ALL
+void         gtk_notebook_set_lazy_pages       (GtkNotebook *notebook,
+                                                gboolean     lazy_pages);
+GDK_AVAILABLE_IN_ALL
+gboolean     gtk_notebook_get_lazy_pages       (GtkNotebook *notebook);
+GDK_AVAILABLE_IN_ALL
+void         gtk_notebook_set_placeholder_size (GtkNotebook *notebook,
+                                                gint         width,
+                                                gint         height);
+GDK_AVAILABLE_IN_ALL
+void         gtk_notebook_get_placeholder_size (GtkNotebook *notebook,
+                                                gint        *width,
+                                                gint        *height);
+
 
 
 /***********************************************************
@@ -122,6 +122,10 @@
 
 #define HANDLE_EXTRA_SIZE 6
 
+/* How often the children are allocated while the handle is dragged,
+ * with GtkPaned:defer-resize */
+#define DEFERRED_RESIZE_INTERVAL (100 * 1000)
+
 enum {
   CHILD1,
   CHILD2
@@ -149,6 +153,15 @@ typedef struct
   gint          min_position;
   gint          original_position;
 
+  /* With defer-resize, the allocations the children really got while
+   * they are drawn in the areas they should have */
+  GtkAllocation child1_allocation;
+  GtkAllocation child2_allocation;
+  GtkAllocation child1_area;
+  GtkAllocation child2_area;
+  gint64        last_child_allocation;
+  guint         deferred_tick_id;
+
   guint         in_recursion  : 1;
   guint         child1_resize : 1;
   guint         child1_shrink : 1;
@@ -156,6 +169,8 @@ typedef struct
   guint         child2_shrink : 1;
   guint         position_set  : 1;
   guint         panning       : 1;
+  guint         defer_resize  : 1;
+  guint         deferring     : 1;
 } GtkPanedPrivate;
 
 enum {
@@ -165,6 +180,7 @@ enum {
   PROP_MIN_POSITION,
   PROP_MAX_POSITION,
   PROP_WIDE_HANDLE,
+  PROP_DEFER_RESIZE,
   LAST_PROP,
 
   /* GtkOrientable */
@@ -206,6 +222,9 @@ static void     gtk_paned_get_child_property    (GtkContainer     *container,
                                                  GValue           *value,
                                                  GParamSpec       *pspec);
 static void     gtk_paned_finalize              (GObject          *object);
+static void     gtk_paned_snapshot              (GtkWidget        *widget,
+                                                 GtkSnapshot      *snapshot);
+static void     gtk_paned_stop_deferring        (GtkPaned         *paned);
 static void     gtk_paned_measure (GtkWidget *widget,
                                    GtkOrientation  orientation,
                                    int             for_size,
@@ -364,6 +383,7 @@ gtk_paned_class_init (GtkPanedClass *class)
 
   widget_class->measure = gtk_paned_measure;
   widget_class->size_allocate = gtk_paned_size_allocate;
+  widget_class->snapshot = gtk_paned_snapshot;
   widget_class->unrealize = gtk_paned_unrealize;
   widget_class->focus = gtk_paned_focus;
   widget_class->pick = gtk_paned_pick;
@@ -440,6 +460,23 @@ gtk_paned_class_init (GtkPanedClass *class)
                           FALSE,
                           GTK_PARAM_READWRITE|G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * GtkPaned:defer-resize:
+   *
+   * Setting this property to %TRUE makes the paned allocate its
+   * children only a few times per second while the handle is dragged,
+   * and once more when the drag ends. In between, the last allocation
+   * of the children is stretched or clipped to the area they should
+   * have. This keeps dragging smooth when the children are expensive
+   * to lay out, such as large text views.
+   */
+  paned_props[PROP_DEFER_RESIZE] =
+    g_param_spec_boolean ("defer-resize",
+                          P_("Defer Resize"),
+                          P_("Whether the children are allocated less often while the handle is dragged"),
+                          FALSE,
+                          GTK_PARAM_READWRITE|G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_install_properties (object_class, LAST_PROP, paned_props);
 
   g_object_class_override_property (object_class,
@@ -806,6 +843,9 @@ gesture_drag_end_cb (GtkGestureDrag *gesture,
 
   gtk_grab_remove (GTK_WIDGET (paned));
   priv->panning = FALSE;
+
+  /* Allocate the children exactly once the drag is over */
+  gtk_paned_stop_deferring (paned);
 }
 
 static void
@@ -850,6 +890,9 @@ gtk_paned_set_property (GObject        *object,
     case PROP_WIDE_HANDLE:
       gtk_paned_set_wide_handle (paned, g_value_get_boolean (value));
       break;
+    case PROP_DEFER_RESIZE:
+      gtk_paned_set_defer_resize (paned, g_value_get_boolean (value));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -885,6 +928,9 @@ gtk_paned_get_property (GObject        *object,
     case PROP_WIDE_HANDLE:
       g_value_set_boolean (value, gtk_paned_get_wide_handle (paned));
       break;
+    case PROP_DEFER_RESIZE:
+      g_value_set_boolean (value, priv->defer_resize);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1200,6 +1246,88 @@ gtk_paned_set_child_visible (GtkPaned  *paned,
   gtk_widget_set_child_visible (child, visible);
 }
 
+static gboolean
+gtk_paned_deferred_tick (GtkWidget     *widget,
+                         GdkFrameClock *frame_clock,
+                         gpointer       user_data)
+{
+  GtkPaned *paned = GTK_PANED (widget);
+  GtkPanedPrivate *priv = gtk_paned_get_instance_private (paned);
+
+  if (gdk_frame_clock_get_frame_time (frame_clock) - priv->last_child_allocation < DEFERRED_RESIZE_INTERVAL)
+    return G_SOURCE_CONTINUE;
+
+  priv->deferred_tick_id = 0;
+  gtk_widget_queue_allocate (widget);
+
+  return G_SOURCE_REMOVE;
+}
+
+static void
+gtk_paned_stop_deferring (GtkPaned *paned)
+{
+  GtkPanedPrivate *priv = gtk_paned_get_instance_private (paned);
+
+  if (priv->deferred_tick_id)
+    {
+      gtk_widget_remove_tick_callback (GTK_WIDGET (paned), priv->deferred_tick_id);
+      priv->deferred_tick_id = 0;
+    }
+
+  if (priv->deferring)
+    {
+      priv->deferring = FALSE;
+      gtk_widget_queue_allocate (GTK_WIDGET (paned));
+    }
+}
+
+/* Whether the children should keep their old allocation while the
+ * handle is dragged. The areas they should get need to be the same
+ * size as that along the handle, so they only get stretched in one
+ * direction when drawing. */
+static gboolean
+gtk_paned_should_defer (GtkPaned            *paned,
+                        const GtkAllocation *child1_allocation,
+                        const GtkAllocation *child2_allocation)
+{
+  GtkPanedPrivate *priv = gtk_paned_get_instance_private (paned);
+  GdkFrameClock *frame_clock;
+  gint64 now;
+
+  frame_clock = gtk_widget_get_frame_clock (GTK_WIDGET (paned));
+
+  if (!priv->defer_resize || !priv->panning || frame_clock == NULL ||
+      priv->child1_allocation.width <= 0 || priv->child1_allocation.height <= 0 ||
+      priv->child2_allocation.width <= 0 || priv->child2_allocation.height <= 0 ||
+      (priv->orientation == GTK_ORIENTATION_HORIZONTAL &&
+       (child1_allocation->height != priv->child1_allocation.height ||
+        child2_allocation->height != priv->child2_allocation.height)) ||
+      (priv->orientation == GTK_ORIENTATION_VERTICAL &&
+       (child1_allocation->width != priv->child1_allocation.width ||
+        child2_allocation->width != priv->child2_allocation.width)))
+    {
+      priv->deferring = FALSE;
+      return FALSE;
+    }
+
+  now = gdk_frame_clock_get_frame_time (frame_clock);
+  if (now - priv->last_child_allocation >= DEFERRED_RESIZE_INTERVAL)
+    {
+      priv->last_child_allocation = now;
+      priv->deferring = FALSE;
+      return FALSE;
+    }
+
+  /* Make sure the children catch up if the handle stops moving */
+  if (priv->deferred_tick_id == 0)
+    priv->deferred_tick_id = gtk_widget_add_tick_callback (GTK_WIDGET (paned),
+                                                           gtk_paned_deferred_tick,
+                                                           NULL, NULL);
+
+  priv->deferring = TRUE;
+  return TRUE;
+}
+
 static void
 gtk_paned_size_allocate (GtkWidget *widget,
                          int        width,
@@ -1317,11 +1445,25 @@ gtk_paned_size_allocate (GtkWidget *widget,
         }
 
       gtk_widget_size_allocate (priv->handle_widget, &handle_allocation, -1);
+
+      if (gtk_paned_should_defer (paned, &child1_allocation, &child2_allocation))
+        {
+          /* Keep the old layout, it is moved into place when drawing */
+          priv->child1_area = child1_allocation;
+          priv->child2_area = child2_allocation;
+          child1_allocation = priv->child1_allocation;
+          child2_allocation = priv->child2_allocation;
+        }
+
       gtk_widget_size_allocate (priv->child1, &child1_allocation, -1);
       gtk_widget_size_allocate (priv->child2, &child2_allocation, -1);
+      priv->child1_allocation = child1_allocation;
+      priv->child2_allocation = child2_allocation;
     }
   else
     {
+      priv->deferring = FALSE;
+
       if (priv->child1 && gtk_widget_get_visible (priv->child1))
         {
           gtk_paned_set_child_visible (paned, CHILD1, TRUE);
@@ -1348,6 +1490,52 @@ gtk_paned_size_allocate (GtkWidget *widget,
 }
 
 
+/* Draws @child with its allocation @from mapped to @to */
+static void
+gtk_paned_snapshot_deferred_child (GtkPaned            *paned,
+                                   GtkWidget           *child,
+                                   const GtkAllocation *from,
+                                   const GtkAllocation *to,
+                                   GtkSnapshot         *snapshot)
+{
+  gtk_snapshot_push_clip (snapshot, &GRAPHENE_RECT_INIT (to->x, to->y, to->width, to->height));
+  gtk_snapshot_save (snapshot);
+  gtk_snapshot_translate (snapshot, &GRAPHENE_POINT_INIT (to->x, to->y));
+
+  /* Clip the children that got smaller, stretch the ones that grew */
+  if (to->width > from->width || to->height > from->height)
+    gtk_snapshot_scale (snapshot,
+                        (float) MAX (to->width, from->width) / from->width,
+                        (float) MAX (to->height, from->height) / from->height);
+
+  gtk_snapshot_translate (snapshot, &GRAPHENE_POINT_INIT (- from->x, - from->y));
+  gtk_widget_snapshot_child (GTK_WIDGET (paned), child, snapshot);
+  gtk_snapshot_restore (snapshot);
+  gtk_snapshot_pop (snapshot);
+}
+
+static void
+gtk_paned_snapshot (GtkWidget   *widget,
+                    GtkSnapshot *snapshot)
+{
+  GtkPaned *paned = GTK_PANED (widget);
+  GtkPanedPrivate *priv = gtk_paned_get_instance_private (paned);
+
+  if (!priv->deferring)
+    {
+      GTK_WIDGET_CLASS (gtk_paned_parent_class)->snapshot (widget, snapshot);
+      return;
+    }
+
+  gtk_paned_snapshot_deferred_child (paned, priv->child1,
+                                     &priv->child1_allocation, &priv->child1_area,
+                                     snapshot);
+  gtk_paned_snapshot_deferred_child (paned, priv->child2,
+                                     &priv->child2_allocation, &priv->child2_area,
+                                     snapshot);
+  gtk_widget_snapshot_child (widget, priv->handle_widget, snapshot);
+}
+
 static void
 gtk_paned_unrealize (GtkWidget *widget)
 {
@@ -1357,6 +1545,7 @@ gtk_paned_unrealize (GtkWidget *widget)
   gtk_paned_set_last_child2_focus (paned, NULL);
   gtk_paned_set_saved_focus (paned, NULL);
   gtk_paned_set_first_paned (paned, NULL);
+  gtk_paned_stop_deferring (paned);
 
   GTK_WIDGET_CLASS (gtk_paned_parent_class)->unrealize (widget);
 }
@@ -2484,3 +2673,48 @@ gtk_paned_get_wide_handle (GtkPaned *paned)
   return gtk_style_context_has_class (gtk_widget_get_style_context (priv->handle_widget),
                                       GTK_STYLE_CLASS_WIDE);
 }
+
+/**
+ * gtk_paned_set_defer_resize:
+ * @paned: a #GtkPaned
+ * @defer_resize: the new value for the #GtkPaned:defer-resize property
+ *
+ * Sets the #GtkPaned:defer-resize property.
+ */
+void
+gtk_paned_set_defer_resize (GtkPaned *paned,
+                            gboolean  defer_resize)
+{
+  GtkPanedPrivate *priv = gtk_paned_get_instance_private (paned);
+
+  g_return_if_fail (GTK_IS_PANED (paned));
+
+  defer_resize = !!defer_resize;
+  if (priv->defer_resize == defer_resize)
+    return;
+
+  priv->defer_resize = defer_resize;
+  if (!defer_resize)
+    gtk_paned_stop_deferring (paned);
+
+  g_object_notify_by_pspec (G_OBJECT (paned), paned_props[PROP_DEFER_RESIZE]);
+}
+
+/**
+ * gtk_paned_get_defer_resize:
+ * @paned: a #GtkPaned
+ *
+ * Gets the #GtkPaned:defer-resize property.
+ *
+ * Returns: %TRUE if the children are allocated less often while
+ *     the handle is dragged
+ */
+gboolean
+gtk_paned_get_defer_resize (GtkPaned *paned)
+{
+  GtkPanedPrivate *priv = gtk_paned_get_instance_private (paned);
+
+  g_return_val_if_fail (GTK_IS_PANED (paned), FALSE);
+
+  return priv->defer_resize;
+}
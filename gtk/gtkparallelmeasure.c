@@ -0,0 +1,241 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "gtkparallelmeasureprivate.h"
+
+#include <pango/pangocairo.h>
+
+/*
+ * Parallel measuring
+ *
+ * Measuring text is mostly spent in Pango, laying out and shaping the
+ * text. Widgets can only be measured on the main thread, but a
+ * PangoLayout can be laid out on any thread as long as nothing else
+ * touches it at the same time.
+ *
+ * GtkTextLayout builds the layouts of the paragraphs it is about to
+ * validate on the main thread and has them laid out on a pool of
+ * worker threads, while the main thread waits and helps out, see
+ * gtk_parallel_measure_shape_layouts().
+ *
+ * Font maps can not be used from several threads at once, so the
+ * layouts of the workers are created with font maps of their own,
+ * see gtk_parallel_measure_get_font_map().
+ */
+
+#define MAX_WORKERS 8
+
+typedef struct
+{
+  /* Each group is a GPtrArray of layouts sharing a PangoContext,
+   * so all of them must be laid out by the same thread
+   */
+  GPtrArray *groups;
+  gint next_group;
+
+  GMutex mutex;
+  GCond cond;
+  guint n_running;
+} PreshapeJob;
+
+static GThreadPool *preshape_pool;
+static guint n_preshape_workers;
+
+/* Indexed by group, the first group is done by the calling thread */
+static PangoFontMap *worker_font_maps[MAX_WORKERS + 1];
+static guint worker_font_map_serial;
+
+static void
+preshape_job_run (PreshapeJob *job)
+{
+  GPtrArray *group;
+  guint i, j;
+
+  while (TRUE)
+    {
+      i = (guint) g_atomic_int_add (&job->next_group, 1);
+      if (i >= job->groups->len)
+        break;
+
+      group = g_ptr_array_index (job->groups, i);
+      for (j = 0; j < group->len; j++)
+        pango_layout_get_extents (g_ptr_array_index (group, j), NULL, NULL);
+    }
+}
+
+static void
+preshape_worker (gpointer data,
+                 gpointer user_data)
+{
+  PreshapeJob *job = data;
+
+  preshape_job_run (job);
+
+  g_mutex_lock (&job->mutex);
+  job->n_running--;
+  if (job->n_running == 0)
+    g_cond_signal (&job->cond);
+  g_mutex_unlock (&job->mutex);
+}
+
+static void
+preshape_groups (GPtrArray *groups,
+                 guint      n_workers)
+{
+  PreshapeJob job;
+  guint i;
+
+  job.groups = groups;
+  job.next_group = 0;
+  job.n_running = n_workers;
+  g_mutex_init (&job.mutex);
+  g_cond_init (&job.cond);
+
+  for (i = 0; i < n_workers; i++)
+    g_thread_pool_push (preshape_pool, &job, NULL);
+
+  preshape_job_run (&job);
+
+  g_mutex_lock (&job.mutex);
+  while (job.n_running > 0)
+    g_cond_wait (&job.cond, &job.mutex);
+  g_mutex_unlock (&job.mutex);
+
+  g_mutex_clear (&job.mutex);
+  g_cond_clear (&job.cond);
+}
+
+static gboolean
+ensure_preshape_pool (void)
+{
+  if (preshape_pool == NULL)
+    {
+      guint n_processors = g_get_num_processors ();
+
+      if (n_processors < 2)
+        return FALSE;
+
+      /* The main thread works too */
+      n_preshape_workers = MIN (n_processors - 1, MAX_WORKERS);
+      preshape_pool = g_thread_pool_new (preshape_worker, NULL,
+                                         n_preshape_workers, FALSE, NULL);
+    }
+
+  return TRUE;
+}
+
+/*
+ * gtk_parallel_measure_get_n_threads:
+ *
+ * Gets the number of threads, including the calling one, that
+ * gtk_parallel_measure_shape_layouts() spreads its work over.
+ *
+ * Returns: the number of threads, 1 if there are no workers
+ */
+guint
+gtk_parallel_measure_get_n_threads (void)
+{
+  if (!ensure_preshape_pool ())
+    return 1;
+
+  return n_preshape_workers + 1;
+}
+
+/*
+ * gtk_parallel_measure_shape_layouts:
+ * @groups: (element-type GPtrArray): groups of #PangoLayouts
+ *
+ * Lays out all layouts in @groups, using worker threads, and returns
+ * once all of them are done. Layouts that share a #PangoContext must
+ * be in the same group, as every group is laid out by a single thread.
+ * The contexts of every group must use the font map returned by
+ * gtk_parallel_measure_get_font_map() for it. Nothing else may use the
+ * layouts, their contexts or those font maps until this function
+ * returns.
+ */
+void
+gtk_parallel_measure_shape_layouts (GPtrArray *groups)
+{
+  guint n_workers;
+
+  if (groups->len == 0)
+    return;
+
+  if (groups->len > 1 && ensure_preshape_pool ())
+    n_workers = MIN (n_preshape_workers, groups->len - 1);
+  else
+    n_workers = 0;
+
+  if (n_workers > 0)
+    preshape_groups (groups, n_workers);
+  else
+    {
+      PreshapeJob job;
+
+      job.groups = groups;
+      job.next_group = 0;
+      preshape_job_run (&job);
+    }
+}
+
+/*
+ * gtk_parallel_measure_get_font_map:
+ * @font_map: the font map the layouts would normally use
+ * @group: the index of a group for gtk_parallel_measure_shape_layouts()
+ *
+ * Gets the font map to create the contexts for the layouts of @group
+ * with. The first group is laid out by the calling thread and can use
+ * @font_map itself, the other ones get a font map of their own that is
+ * kept for the next calls. As those are created like the default font
+ * map, no other font map can be replaced.
+ *
+ * Returns: (transfer none) (nullable): the font map for @group, or
+ *   %NULL if the layouts of @group can not be laid out on workers
+ */
+PangoFontMap *
+gtk_parallel_measure_get_font_map (PangoFontMap *font_map,
+                                   guint         group)
+{
+  guint i, serial;
+
+  g_return_val_if_fail (group < G_N_ELEMENTS (worker_font_maps), NULL);
+
+  if (group == 0)
+    return font_map;
+
+  if (font_map != pango_cairo_font_map_get_default ())
+    return NULL;
+
+  /* Fonts were added or removed, start over */
+  serial = pango_font_map_get_serial (font_map);
+  if (serial != worker_font_map_serial)
+    {
+      for (i = 0; i < G_N_ELEMENTS (worker_font_maps); i++)
+        g_clear_object (&worker_font_maps[i]);
+      worker_font_map_serial = serial;
+    }
+
+  if (worker_font_maps[group] == NULL)
+    worker_font_maps[group] = pango_cairo_font_map_new ();
+
+  pango_cairo_font_map_set_resolution (PANGO_CAIRO_FONT_MAP (worker_font_maps[group]),
+                                       pango_cairo_font_map_get_resolution (PANGO_CAIRO_FONT_MAP (font_map)));
+
+  return worker_font_maps[group];
+}
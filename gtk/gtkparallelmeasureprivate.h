@@ -0,0 +1,32 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GTK_PARALLEL_MEASURE_PRIVATE_H__
+#define __GTK_PARALLEL_MEASURE_PRIVATE_H__
+
+#include "gtkwidget.h"
+
+G_BEGIN_DECLS
+
+guint           gtk_parallel_measure_get_n_threads      (void);
+void            gtk_parallel_measure_shape_layouts      (GPtrArray      *groups);
+PangoFontMap *  gtk_parallel_measure_get_font_map       (PangoFontMap   *font_map,
+                                                         guint           group);
+
+G_END_DECLS
+
+#endif /* __GTK_PARALLEL_MEASURE_PRIVATE_H__ */
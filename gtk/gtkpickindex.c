@@ -0,0 +1,287 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "gtkpickindexprivate.h"
+
+#include "gtkwidgetprivate.h"
+
+#include <math.h>
+#include <string.h>
+
+/*
+ * Pick index
+ *
+ * The default pick implementation tries all children in reverse paint
+ * order, transforming the point into each of them. For widgets with
+ * many children, a uniform grid over the bounds of the children is
+ * built the first time they are picked after an allocation, and only
+ * the children overlapping the cell below the point are tried.
+ *
+ * Children that may pick outside of their bounds, see
+ * gtk_widget_get_pick_bounds(), are in every cell. If there are too
+ * many of those, the grid is not worth it and all children are tried.
+ */
+
+/* Keep the grid small enough for huge widgets with few children */
+#define MAX_CELLS_PER_SIDE 128
+
+/* Points may land on the edge of a child after transforming them */
+#define BOUNDS_EPSILON 1.f
+
+GtkPickStats gtk_pick_stats;
+
+struct _GtkPickIndex
+{
+  graphene_rect_t bounds;
+  guint n_columns;
+  guint n_rows;
+  float cell_width;
+  float cell_height;
+
+  /* The children of cell i are entries[cells[i]] to entries[cells[i + 1]] */
+  guint *cells;
+  GtkWidget **entries;
+
+  /* The children to try outside of the grid */
+  GtkWidget **unbounded;
+  guint n_unbounded;
+};
+
+static void
+get_cell_range (GtkPickIndex          *index,
+                const graphene_rect_t *rect,
+                guint                 *col0,
+                guint                 *col1,
+                guint                 *row0,
+                guint                 *row1)
+{
+  float x0, x1, y0, y1;
+
+  x0 = (rect->origin.x - index->bounds.origin.x) / index->cell_width;
+  x1 = (rect->origin.x + rect->size.width - index->bounds.origin.x) / index->cell_width;
+  y0 = (rect->origin.y - index->bounds.origin.y) / index->cell_height;
+  y1 = (rect->origin.y + rect->size.height - index->bounds.origin.y) / index->cell_height;
+
+  *col0 = CLAMP ((int) floorf (x0), 0, (int) index->n_columns - 1);
+  *col1 = CLAMP ((int) floorf (x1), 0, (int) index->n_columns - 1);
+  *row0 = CLAMP ((int) floorf (y0), 0, (int) index->n_rows - 1);
+  *row1 = CLAMP ((int) floorf (y1), 0, (int) index->n_rows - 1);
+}
+
+/*
+ * gtk_pick_index_new:
+ * @widget: a #GtkWidget
+ *
+ * Builds the pick index for the current children of @widget and their
+ * allocations. The index must be freed when either changes, it does
+ * not hold references on the children.
+ *
+ * Returns: a new #GtkPickIndex
+ */
+GtkPickIndex *
+gtk_pick_index_new (GtkWidget *widget)
+{
+  GtkPickIndex *index;
+  GtkWidget *child;
+  graphene_rect_t *rects;
+  guint8 *bounded;
+  guint n_children, n_bounded, n_unbounded, n_cells, n_entries;
+  guint i, c, r, col0, col1, row0, row1;
+  guint *cursors;
+
+  gtk_pick_stats.index_builds++;
+
+  index = g_slice_new0 (GtkPickIndex);
+
+  n_children = 0;
+  for (child = _gtk_widget_get_first_child (widget);
+       child != NULL;
+       child = _gtk_widget_get_next_sibling (child))
+    n_children++;
+
+  rects = g_new (graphene_rect_t, n_children);
+  bounded = g_new (guint8, n_children);
+  n_bounded = 0;
+
+  for (child = _gtk_widget_get_first_child (widget), i = 0;
+       child != NULL;
+       child = _gtk_widget_get_next_sibling (child), i++)
+    {
+      bounded[i] = gtk_widget_get_pick_bounds (child, &rects[i]);
+      if (!bounded[i])
+        continue;
+
+      graphene_rect_inset (&rects[i], - BOUNDS_EPSILON, - BOUNDS_EPSILON);
+      if (n_bounded == 0)
+        index->bounds = rects[i];
+      else
+        graphene_rect_union (&index->bounds, &rects[i], &index->bounds);
+      n_bounded++;
+    }
+
+  /* Every unbounded child ends up in every cell */
+  if (n_bounded == 0 || (n_children - n_bounded) * 4 > n_children)
+    {
+      index->n_unbounded = n_children;
+      index->unbounded = g_new (GtkWidget *, n_children);
+      for (child = _gtk_widget_get_first_child (widget), i = 0;
+           child != NULL;
+           child = _gtk_widget_get_next_sibling (child), i++)
+        index->unbounded[i] = child;
+
+      g_free (rects);
+      g_free (bounded);
+
+      return index;
+    }
+
+  /* About one cell per child, with square-ish cells */
+  if (index->bounds.size.height > 0 && index->bounds.size.width > 0)
+    index->n_columns = ceil (sqrt (n_bounded * index->bounds.size.width / index->bounds.size.height));
+  else
+    index->n_columns = index->bounds.size.width > 0 ? n_bounded : 1;
+  index->n_columns = CLAMP (index->n_columns, 1, MAX_CELLS_PER_SIDE);
+  index->n_rows = CLAMP ((n_bounded + index->n_columns - 1) / index->n_columns, 1, MAX_CELLS_PER_SIDE);
+  index->cell_width = MAX (index->bounds.size.width / index->n_columns, BOUNDS_EPSILON);
+  index->cell_height = MAX (index->bounds.size.height / index->n_rows, BOUNDS_EPSILON);
+
+  n_cells = index->n_columns * index->n_rows;
+  index->cells = g_new0 (guint, n_cells + 1);
+  index->n_unbounded = n_children - n_bounded;
+  index->unbounded = g_new (GtkWidget *, MAX (index->n_unbounded, 1));
+
+  /* Count the children per cell, then fill them in paint order */
+  for (i = 0; i < n_children; i++)
+    {
+      if (!bounded[i])
+        {
+          for (c = 0; c < n_cells; c++)
+            index->cells[c + 1]++;
+          continue;
+        }
+
+      get_cell_range (index, &rects[i], &col0, &col1, &row0, &row1);
+      for (r = row0; r <= row1; r++)
+        for (c = col0; c <= col1; c++)
+          index->cells[r * index->n_columns + c + 1]++;
+    }
+
+  for (c = 0; c < n_cells; c++)
+    index->cells[c + 1] += index->cells[c];
+
+  n_entries = index->cells[n_cells];
+  index->entries = g_new (GtkWidget *, MAX (n_entries, 1));
+  cursors = g_memdup (index->cells, n_cells * sizeof (guint));
+
+  n_unbounded = 0;
+  for (child = _gtk_widget_get_first_child (widget), i = 0;
+       child != NULL;
+       child = _gtk_widget_get_next_sibling (child), i++)
+    {
+      if (!bounded[i])
+        {
+          index->unbounded[n_unbounded++] = child;
+          for (c = 0; c < n_cells; c++)
+            index->entries[cursors[c]++] = child;
+          continue;
+        }
+
+      get_cell_range (index, &rects[i], &col0, &col1, &row0, &row1);
+      for (r = row0; r <= row1; r++)
+        for (c = col0; c <= col1; c++)
+          index->entries[cursors[r * index->n_columns + c]++] = child;
+    }
+
+  g_free (cursors);
+  g_free (rects);
+  g_free (bounded);
+
+  return index;
+}
+
+void
+gtk_pick_index_free (GtkPickIndex *index)
+{
+  g_free (index->cells);
+  g_free (index->entries);
+  g_free (index->unbounded);
+  g_slice_free (GtkPickIndex, index);
+}
+
+/*
+ * gtk_pick_index_lookup:
+ * @index: a #GtkPickIndex
+ * @x: X coordinate, relative to the widget's origin
+ * @y: Y coordinate, relative to the widget's origin
+ * @n_children: (out): return location for the number of children
+ *
+ * Finds the children that may contain the point, no other child of
+ * the widget can. They are returned in paint order, so they should
+ * be tried starting from the last one.
+ *
+ * Returns: (array length=n_children) (transfer none): the children
+ */
+GtkWidget * const *
+gtk_pick_index_lookup (GtkPickIndex *index,
+                       double        x,
+                       double        y,
+                       guint        *n_children)
+{
+  guint col, row, cell;
+
+  if (index->n_columns == 0 ||
+      !graphene_rect_contains_point (&index->bounds, &GRAPHENE_POINT_INIT (x, y)))
+    {
+      *n_children = index->n_unbounded;
+      return index->unbounded;
+    }
+
+  col = MIN ((guint) ((x - index->bounds.origin.x) / index->cell_width), index->n_columns - 1);
+  row = MIN ((guint) ((y - index->bounds.origin.y) / index->cell_height), index->n_rows - 1);
+  cell = row * index->n_columns + col;
+
+  *n_children = index->cells[cell + 1] - index->cells[cell];
+  return index->entries + index->cells[cell];
+}
+
+/**
+ * gtk_pick_stats_get:
+ * @stats: (out caller-allocates): return location for the counters
+ *
+ * Fills in the counters accumulated since the last call to
+ * gtk_pick_stats_reset().
+ **/
+void
+gtk_pick_stats_get (GtkPickStats *stats)
+{
+  g_return_if_fail (stats != NULL);
+
+  *stats = gtk_pick_stats;
+}
+
+/**
+ * gtk_pick_stats_reset:
+ *
+ * Resets all counters to 0.
+ **/
+void
+gtk_pick_stats_reset (void)
+{
+  memset (&gtk_pick_stats, 0, sizeof (GtkPickStats));
+}
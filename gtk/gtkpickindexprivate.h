@@ -0,0 +1,60 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GTK_PICK_INDEX_PRIVATE_H__
+#define __GTK_PICK_INDEX_PRIVATE_H__
+
+#include "gtkwidget.h"
+
+G_BEGIN_DECLS
+
+/* Widgets with fewer children just walk them */
+#define GTK_PICK_INDEX_MIN_CHILDREN 32
+
+typedef struct _GtkPickIndex GtkPickIndex;
+typedef struct _GtkPickStats GtkPickStats;
+
+/*
+ * GtkPickStats:
+ *
+ * Counters for the work done by gtk_widget_pick(). Dividing the
+ * widgets visited by the number of picks gives the cost per pointer
+ * event. They are shown by the inspector.
+ */
+struct _GtkPickStats {
+  guint   picks;              /* picks starting at a widget without parent */
+  guint   widgets_visited;    /* calls to gtk_widget_pick() */
+  guint   children_tested;    /* children the default pick transformed the point for */
+  guint   index_builds;       /* pick indexes built */
+};
+
+extern GtkPickStats gtk_pick_stats;
+
+void                    gtk_pick_stats_get              (GtkPickStats           *stats);
+void                    gtk_pick_stats_reset            (void);
+
+GtkPickIndex *          gtk_pick_index_new              (GtkWidget              *widget);
+void                    gtk_pick_index_free             (GtkPickIndex           *index);
+
+GtkWidget * const *     gtk_pick_index_lookup           (GtkPickIndex           *index,
+                                                         double                  x,
+                                                         double                  y,
+                                                         guint                  *n_children);
+
+G_END_DECLS
+
+#endif /* __GTK_PICK_INDEX_PRIVATE_H__ */
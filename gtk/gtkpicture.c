@@ -26,6 +26,7 @@
 #include "gtkcssstyleprivate.h"
 #include "gtkintl.h"
 #include "gtkprivate.h"
+#include "gtkscaledtextureprivate.h"
 #include "gtkscalerprivate.h"
 #include "gtksnapshot.h"
 #include "gtkwidgetprivate.h"
@@ -100,6 +101,7 @@ gtk_picture_snapshot (GtkWidget   *widget,
                       GtkSnapshot *snapshot)
 {
   GtkPicture *self = GTK_PICTURE (widget);
+  GdkPaintable *paintable;
   double ratio;
   int x, y, width, height;
   double w, h;
@@ -113,7 +115,8 @@ gtk_picture_snapshot (GtkWidget   *widget,
 
   if (!self->keep_aspect_ratio || ratio == 0)
     {
-      gdk_paintable_snapshot (self->paintable, snapshot, width, height);
+      paintable = gtk_scaled_texture_lookup (self->paintable, width, height, widget);
+      gdk_paintable_snapshot (paintable, snapshot, width, height);
     }
   else
     {
@@ -135,7 +138,8 @@ gtk_picture_snapshot (GtkWidget   *widget,
 
       gtk_snapshot_save (snapshot);
       gtk_snapshot_translate (snapshot, &GRAPHENE_POINT_INIT (x, y));
-      gdk_paintable_snapshot (self->paintable, snapshot, w, h);
+      paintable = gtk_scaled_texture_lookup (self->paintable, w, h, widget);
+      gdk_paintable_snapshot (paintable, snapshot, w, h);
       gtk_snapshot_restore (snapshot);
     }
 }
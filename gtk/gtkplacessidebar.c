@@ -145,6 +145,13 @@ struct _GtkPlacesSidebar {
   gulong trash_monitor_changed_id;
   GtkWidget *trash_row;
 
+  /* rows from before the last update_places() that weren't added
+   * again yet; they are destroyed once the pending queries are done
+   */
+  GList *stale_rows;
+  guint n_pending_queries;
+  guint update_places_id;
+
   /* DND */
   GList     *drag_list; /* list of GFile */
   gint       drag_data_info;
@@ -452,6 +459,82 @@ list_box_header_func (GtkListBoxRow *row,
     }
 }
 
+static gboolean
+row_matches (GtkWidget                   *row,
+             GtkPlacesSidebarPlaceType    place_type,
+             GtkPlacesSidebarSectionType  section_type,
+             const gchar                 *name,
+             GIcon                       *start_icon,
+             GIcon                       *end_icon,
+             const gchar                 *uri,
+             GDrive                      *drive,
+             GVolume                     *volume,
+             GMount                      *mount,
+             gpointer                     cloud_provider_account,
+             gint                         index,
+             const gchar                 *tooltip,
+             gboolean                     ejectable)
+{
+  GtkPlacesSidebarPlaceType row_place_type;
+  GtkPlacesSidebarSectionType row_section_type;
+  gchar *row_name, *row_uri, *row_tooltip;
+  GIcon *row_start_icon, *row_end_icon;
+  GDrive *row_drive;
+  GVolume *row_volume;
+  GMount *row_mount;
+  GObject *row_account;
+  gboolean row_ejectable;
+  gint row_index;
+  gboolean matches;
+
+  g_object_get (row,
+                "place-type", &row_place_type,
+                "section-type", &row_section_type,
+                "order-index", &row_index,
+                "ejectable", &row_ejectable,
+                NULL);
+
+  if (row_place_type != place_type ||
+      row_section_type != section_type ||
+      row_index != index ||
+      row_ejectable != ejectable)
+    return FALSE;
+
+  g_object_get (row,
+                "label", &row_name,
+                "start-icon", &row_start_icon,
+                "end-icon", &row_end_icon,
+                "uri", &row_uri,
+                "drive", &row_drive,
+                "volume", &row_volume,
+                "mount", &row_mount,
+                "tooltip", &row_tooltip,
+                "cloud-provider-account", &row_account,
+                NULL);
+
+  matches = g_strcmp0 (row_name, name) == 0 &&
+            g_strcmp0 (row_uri, uri) == 0 &&
+            g_strcmp0 (row_tooltip, tooltip) == 0 &&
+            g_icon_equal (row_start_icon, start_icon) &&
+            g_icon_equal (row_end_icon, end_icon) &&
+            row_drive == drive &&
+            row_volume == volume &&
+            row_mount == mount &&
+            row_account == (GObject *) cloud_provider_account;
+
+  g_free (row_name);
+  g_free (row_uri);
+  g_free (row_tooltip);
+  g_clear_object (&row_start_icon);
+  g_clear_object (&row_end_icon);
+  g_clear_object (&row_drive);
+  g_clear_object (&row_volume);
+  g_clear_object (&row_mount);
+  g_clear_object (&row_account);
+
+  return matches;
+}
+
 static GtkWidget*
 add_place (GtkPlacesSidebar            *sidebar,
            GtkPlacesSidebarPlaceType    place_type,
@@ -476,6 +559,7 @@ add_place (GtkPlacesSidebar            *sidebar,
   GtkWidget *row;
   GtkWidget *eject_button;
   GtkGesture *gesture;
+  GList *l;
 
   check_unmount_and_eject (mount, volume, drive,
                            &show_unmount, &show_eject);
@@ -485,6 +569,22 @@ add_place (GtkPlacesSidebar            *sidebar,
 
   show_eject_button = (show_unmount || show_eject);
 
+  /* keep the row if nothing changed, so that updates don't rebuild
+   * the whole list
+   */
+  for (l = sidebar->stale_rows; l != NULL; l = l->next)
+    {
+      row = l->data;
+
+      if (row_matches (row, place_type, section_type, name, start_icon, end_icon,
+                       uri, drive, volume, mount, cloud_provider_account,
+                       index, tooltip, show_eject_button))
+        {
+          sidebar->stale_rows = g_list_delete_link (sidebar->stale_rows, l);
+          return row;
+        }
+    }
+
   row = g_object_new (GTK_TYPE_SIDEBAR_ROW,
                       "sidebar", sidebar,
                       "start-icon", start_icon,
@@ -741,6 +841,13 @@ file_is_shown (GtkPlacesSidebar *sidebar,
   l = rows;
   while (l != NULL && !found)
     {
+      /* rows that are going away don't count */
+      if (g_list_find (sidebar->stale_rows, l->data))
+        {
+          l = l->next;
+          continue;
+        }
+
       g_object_get (l->data, "uri", &uri, NULL);
       if (uri)
         {
@@ -758,6 +865,120 @@ file_is_shown (GtkPlacesSidebar *sidebar,
   return found;
 }
 
+/* The display name and icon of shortcuts and bookmarks, shared by
+ * all sidebars; choosers opened one after the other don't need to
+ * query them again, and show those rows right away.
+ */
+#define PLACE_INFO_ATTRIBUTES "standard::display-name,standard::symbolic-icon"
+#define PLACE_INFO_MAX_AGE (30 * G_TIME_SPAN_SECOND)
+
+typedef struct {
+  GFileInfo *info;
+  gint64 time;
+} PlaceInfo;
+
+static GHashTable *place_infos;
+
+static void
+place_info_free (gpointer data)
+{
+  PlaceInfo *place_info = data;
+
+  g_object_unref (place_info->info);
+  g_slice_free (PlaceInfo, place_info);
+}
+
+static GFileInfo *
+lookup_place_info (GFile *file)
+{
+  PlaceInfo *place_info;
+
+  if (place_infos == NULL)
+    return NULL;
+
+  place_info = g_hash_table_lookup (place_infos, file);
+  if (place_info == NULL)
+    return NULL;
+
+  if (g_get_monotonic_time () - place_info->time > PLACE_INFO_MAX_AGE)
+    {
+      g_hash_table_remove (place_infos, file);
+      return NULL;
+    }
+
+  return g_object_ref (place_info->info);
+}
+
+static void
+cache_place_info (GFile     *file,
+                  GFileInfo *info)
+{
+  PlaceInfo *place_info;
+
+  if (place_infos == NULL)
+    place_infos = g_hash_table_new_full (g_file_hash, (GEqualFunc) g_file_equal,
+                                         g_object_unref, place_info_free);
+
+  place_info = g_slice_new (PlaceInfo);
+  place_info->info = g_object_ref (info);
+  place_info->time = g_get_monotonic_time ();
+  g_hash_table_replace (place_infos, g_object_ref (file), place_info);
+}
+
+static void
+remove_stale_rows (GtkPlacesSidebar *sidebar)
+{
+  GList *rows;
+
+  rows = sidebar->stale_rows;
+  sidebar->stale_rows = NULL;
+  g_list_free_full (rows, (GDestroyNotify) gtk_widget_destroy);
+}
+
+static void
+place_query_done (GtkPlacesSidebar *sidebar)
+{
+  g_assert (sidebar->n_pending_queries > 0);
+
+  sidebar->n_pending_queries--;
+  if (sidebar->n_pending_queries == 0)
+    remove_stale_rows (sidebar);
+}
+
+static void
+add_application_shortcut (GtkPlacesSidebar *sidebar,
+                          GFile            *file,
+                          GFileInfo        *info)
+{
+  gchar *uri;
+  gchar *tooltip;
+  const gchar *name;
+  GIcon *start_icon;
+  int pos = 0;
+
+  name = g_file_info_get_display_name (info);
+  start_icon = g_file_info_get_symbolic_icon (info);
+  uri = g_file_get_uri (file);
+  tooltip = g_file_get_parse_name (file);
+
+  /* XXX: we could avoid this by using an ancillary closure
+   * with the index coming from add_application_shortcuts(),
+   * but in terms of algorithmic overhead, the application
+   * shortcuts is not going to be really big
+   */
+  pos = g_slist_index (sidebar->shortcuts, file);
+
+  add_place (sidebar, PLACES_BUILT_IN,
+             SECTION_COMPUTER,
+             name, start_icon, NULL, uri,
+             NULL, NULL, NULL, NULL,
+             pos,
+             tooltip);
+
+  g_free (uri);
+  g_free (tooltip);
+}
+
 static void
 on_app_shortcuts_query_complete (GObject      *source,
                                  GAsyncResult *result,
@@ -765,42 +986,25 @@ on_app_shortcuts_query_complete (GObject      *source,
 {
   GtkPlacesSidebar *sidebar = data;
   GFile *file = G_FILE (source);
+  GError *error = NULL;
   GFileInfo *info;
 
-  info = g_file_query_info_finish (file, result, NULL);
+  info = g_file_query_info_finish (file, result, &error);
+  if (g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+    {
+      g_error_free (error);
+      return;
+    }
 
   if (info)
     {
-      gchar *uri;
-      gchar *tooltip;
-      const gchar *name;
-      GIcon *start_icon;
-      int pos = 0;
-
-      name = g_file_info_get_display_name (info);
-      start_icon = g_file_info_get_symbolic_icon (info);
-      uri = g_file_get_uri (file);
-      tooltip = g_file_get_parse_name (file);
-
-      /* XXX: we could avoid this by using an ancillary closure
-       * with the index coming from add_application_shortcuts(),
-       * but in terms of algorithmic overhead, the application
-       * shortcuts is not going to be really big
-       */
-      pos = g_slist_index (sidebar->shortcuts, file);
-
-      add_place (sidebar, PLACES_BUILT_IN,
-                 SECTION_COMPUTER,
-                 name, start_icon, NULL, uri,
-                 NULL, NULL, NULL, NULL,
-                 pos,
-                 tooltip);
-
-      g_free (uri);
-      g_free (tooltip);
-
+      cache_place_info (file, info);
+      add_application_shortcut (sidebar, file, info);
       g_object_unref (info);
     }
+
+  g_clear_error (&error);
+  place_query_done (sidebar);
 }
 
 static void
@@ -811,6 +1015,7 @@ add_application_shortcuts (GtkPlacesSidebar *sidebar)
   for (l = sidebar->shortcuts; l; l = l->next)
     {
       GFile *file = l->data;
+      GFileInfo *info;
 
       if (!should_show_file (sidebar, file))
         continue;
@@ -818,8 +1023,17 @@ add_application_shortcuts (GtkPlacesSidebar *sidebar)
       if (file_is_shown (sidebar, file))
         continue;
 
+      info = lookup_place_info (file);
+      if (info)
+        {
+          add_application_shortcut (sidebar, file, info);
+          g_object_unref (info);
+          continue;
+        }
+
+      sidebar->n_pending_queries++;
       g_file_query_info_async (file,
-                               "standard::display-name,standard::symbolic-icon",
+                               PLACE_INFO_ATTRIBUTES,
                                G_FILE_QUERY_INFO_NONE,
                                G_PRIORITY_DEFAULT,
                                sidebar->cancellable,
@@ -835,24 +1049,17 @@ typedef struct {
 } BookmarkQueryClosure;
 
 static void
-on_bookmark_query_info_complete (GObject      *source,
-                                 GAsyncResult *result,
-                                 gpointer      data)
+add_bookmark (GtkPlacesSidebar *sidebar,
+              GFile            *root,
+              GFileInfo        *info,
+              int               index,
+              gboolean          is_native)
 {
-  BookmarkQueryClosure *clos = data;
-  GtkPlacesSidebar *sidebar = clos->sidebar;
-  GFile *root = G_FILE (source);
-  GError *error = NULL;
-  GFileInfo *info;
   gchar *bookmark_name;
   gchar *mount_uri;
   gchar *tooltip;
   GIcon *start_icon;
 
-  info = g_file_query_info_finish (root, result, &error);
-  if (g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
-    goto out;
-
   bookmark_name = _gtk_bookmarks_manager_get_bookmark_label (sidebar->bookmarks_manager, root);
   if (bookmark_name == NULL && info != NULL)
     bookmark_name = g_strdup (g_file_info_get_display_name (info));
@@ -863,14 +1070,14 @@ on_bookmark_query_info_complete (GObject      *source,
       if (!g_utf8_validate (bookmark_name, -1, NULL))
         {
           g_free (bookmark_name);
-          goto out;
+          return;
         }
     }
 
   if (info)
     start_icon = g_object_ref (g_file_info_get_symbolic_icon (info));
   else
-    start_icon = g_themed_icon_new_with_default_fallbacks (clos->is_native ? ICON_NAME_FOLDER : ICON_NAME_FOLDER_NETWORK);
+    start_icon = g_themed_icon_new_with_default_fallbacks (is_native ? ICON_NAME_FOLDER : ICON_NAME_FOLDER_NETWORK);
 
   mount_uri = g_file_get_uri (root);
   tooltip = g_file_get_parse_name (root);
@@ -878,13 +1085,35 @@ on_bookmark_query_info_complete (GObject      *source,
   add_place (sidebar, PLACES_BOOKMARK,
              SECTION_BOOKMARKS,
              bookmark_name, start_icon, NULL, mount_uri,
-             NULL, NULL, NULL, NULL, clos->index,
+             NULL, NULL, NULL, NULL, index,
              tooltip);
 
   g_free (mount_uri);
   g_free (tooltip);
   g_free (bookmark_name);
   g_object_unref (start_icon);
+}
+
+static void
+on_bookmark_query_info_complete (GObject      *source,
+                                 GAsyncResult *result,
+                                 gpointer      data)
+{
+  BookmarkQueryClosure *clos = data;
+  GtkPlacesSidebar *sidebar = clos->sidebar;
+  GFile *root = G_FILE (source);
+  GError *error = NULL;
+  GFileInfo *info;
+
+  info = g_file_query_info_finish (root, result, &error);
+  if (g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+    goto out;
+
+  if (info)
+    cache_place_info (root, info);
+
+  add_bookmark (sidebar, root, info, clos->index, clos->is_native);
+  place_query_done (sidebar);
 
 out:
   g_clear_object (&info);
@@ -1045,12 +1274,20 @@ update_places (GtkPlacesSidebar *sidebar)
   g_object_unref (sidebar->cancellable);
   sidebar->cancellable = g_cancellable_new ();
 
+  if (sidebar->update_places_id != 0)
+    {
+      g_source_remove (sidebar->update_places_id);
+      sidebar->update_places_id = 0;
+    }
+
   /* Reset drag state, just in case we update the places while dragging or
    * ending a drag */
   stop_drop_feedback (sidebar);
-  gtk_container_foreach (GTK_CONTAINER (sidebar->list_box),
-                         (GtkCallback) gtk_widget_destroy,
-                         NULL);
+
+  /* The rows that are added again are kept, see add_place() */
+  g_list_free (sidebar->stale_rows);
+  sidebar->stale_rows = gtk_container_get_children (GTK_CONTAINER (sidebar->list_box));
+  sidebar->n_pending_queries = 0;
 
   network_mounts = network_volumes = NULL;
 
@@ -1122,14 +1359,23 @@ update_places (GtkPlacesSidebar *sidebar)
   /* Trash */
   if (!sidebar->local_only && sidebar->show_trash)
     {
+      GtkWidget *row;
+
       start_icon = _gtk_trash_monitor_get_icon (sidebar->trash_monitor);
-      sidebar->trash_row = add_place (sidebar, PLACES_BUILT_IN,
-                                      SECTION_COMPUTER,
-                                      _("Trash"), start_icon, NULL, "trash:///",
-                                      NULL, NULL, NULL, NULL, 0,
-                                      _("Open the trash"));
-      g_object_add_weak_pointer (G_OBJECT (sidebar->trash_row),
-                                 (gpointer *) &sidebar->trash_row);
+      row = add_place (sidebar, PLACES_BUILT_IN,
+                       SECTION_COMPUTER,
+                       _("Trash"), start_icon, NULL, "trash:///",
+                       NULL, NULL, NULL, NULL, 0,
+                       _("Open the trash"));
+      if (row != sidebar->trash_row)
+        {
+          if (sidebar->trash_row)
+            g_object_remove_weak_pointer (G_OBJECT (sidebar->trash_row),
+                                          (gpointer *) &sidebar->trash_row);
+          sidebar->trash_row = row;
+          g_object_add_weak_pointer (G_OBJECT (sidebar->trash_row),
+                                     (gpointer *) &sidebar->trash_row);
+        }
       g_object_unref (start_icon);
     }
 
@@ -1411,6 +1657,7 @@ update_places (GtkPlacesSidebar *sidebar)
     {
       gboolean is_native;
       BookmarkQueryClosure *clos;
+      GFileInfo *info;
 
       root = sl->data;
       is_native = g_file_is_native (root);
@@ -1421,12 +1668,21 @@ update_places (GtkPlacesSidebar *sidebar)
       if (sidebar->local_only && !is_native)
         continue;
 
+      info = lookup_place_info (root);
+      if (info)
+        {
+          add_bookmark (sidebar, root, info, index, is_native);
+          g_object_unref (info);
+          continue;
+        }
+
       clos = g_slice_new (BookmarkQueryClosure);
       clos->sidebar = sidebar;
       clos->index = index;
       clos->is_native = is_native;
+      sidebar->n_pending_queries++;
       g_file_query_info_async (root,
-                               "standard::display-name,standard::symbolic-icon",
+                               PLACE_INFO_ATTRIBUTES,
                                G_FILE_QUERY_INFO_NONE,
                                G_PRIORITY_DEFAULT,
                                sidebar->cancellable,
@@ -1516,6 +1772,9 @@ update_places (GtkPlacesSidebar *sidebar)
       g_object_unref (start_icon);
     }
 
+  if (sidebar->n_pending_queries == 0)
+    remove_stale_rows (sidebar);
+
   gtk_widget_show (GTK_WIDGET (sidebar));
   /* We want this hidden by default, but need to do it after the show_all call */
   gtk_sidebar_row_hide (GTK_SIDEBAR_ROW (sidebar->new_bookmark_row), TRUE);
@@ -4002,6 +4261,30 @@ hostname_proxy_new_cb (GObject      *source_object,
   update_hostname (sidebar);
 }
 
+static gboolean
+update_places_idle (gpointer data)
+{
+  GtkPlacesSidebar *sidebar = data;
+
+  sidebar->update_places_id = 0;
+  update_places (sidebar);
+
+  return G_SOURCE_REMOVE;
+}
+
+/* Volume monitors and bookmarks report changes in bursts,
+ * update once for all of them.
+ */
+static void
+queue_update_places (GtkPlacesSidebar *sidebar)
+{
+  if (sidebar->update_places_id != 0)
+    return;
+
+  sidebar->update_places_id = g_idle_add (update_places_idle, sidebar);
+  g_source_set_name_by_id (sidebar->update_places_id, "[gtk] update_places_idle");
+}
+
 static void
 create_volume_monitor (GtkPlacesSidebar *sidebar)
 {
@@ -4010,23 +4293,23 @@ create_volume_monitor (GtkPlacesSidebar *sidebar)
   sidebar->volume_monitor = g_volume_monitor_get ();
 
   g_signal_connect_object (sidebar->volume_monitor, "volume_added",
-                           G_CALLBACK (update_places), sidebar, G_CONNECT_SWAPPED);
+                           G_CALLBACK (queue_update_places), sidebar, G_CONNECT_SWAPPED);
   g_signal_connect_object (sidebar->volume_monitor, "volume_removed",
-                           G_CALLBACK (update_places), sidebar, G_CONNECT_SWAPPED);
+                           G_CALLBACK (queue_update_places), sidebar, G_CONNECT_SWAPPED);
   g_signal_connect_object (sidebar->volume_monitor, "volume_changed",
-                           G_CALLBACK (update_places), sidebar, G_CONNECT_SWAPPED);
+                           G_CALLBACK (queue_update_places), sidebar, G_CONNECT_SWAPPED);
   g_signal_connect_object (sidebar->volume_monitor, "mount_added",
-                           G_CALLBACK (update_places), sidebar, G_CONNECT_SWAPPED);
+                           G_CALLBACK (queue_update_places), sidebar, G_CONNECT_SWAPPED);
   g_signal_connect_object (sidebar->volume_monitor, "mount_removed",
-                           G_CALLBACK (update_places), sidebar, G_CONNECT_SWAPPED);
+                           G_CALLBACK (queue_update_places), sidebar, G_CONNECT_SWAPPED);
   g_signal_connect_object (sidebar->volume_monitor, "mount_changed",
-                           G_CALLBACK (update_places), sidebar, G_CONNECT_SWAPPED);
+                           G_CALLBACK (queue_update_places), sidebar, G_CONNECT_SWAPPED);
   g_signal_connect_object (sidebar->volume_monitor, "drive_disconnected",
-                           G_CALLBACK (update_places), sidebar, G_CONNECT_SWAPPED);
+                           G_CALLBACK (queue_update_places), sidebar, G_CONNECT_SWAPPED);
   g_signal_connect_object (sidebar->volume_monitor, "drive_connected",
-                           G_CALLBACK (update_places), sidebar, G_CONNECT_SWAPPED);
+                           G_CALLBACK (queue_update_places), sidebar, G_CONNECT_SWAPPED);
   g_signal_connect_object (sidebar->volume_monitor, "drive_changed",
-                           G_CALLBACK (update_places), sidebar, G_CONNECT_SWAPPED);
+                           G_CALLBACK (queue_update_places), sidebar, G_CONNECT_SWAPPED);
 }
 
 static void
@@ -4070,7 +4353,7 @@ gtk_places_sidebar_init (GtkPlacesSidebar *sidebar)
 
   sidebar->open_flags = GTK_PLACES_OPEN_NORMAL;
 
-  sidebar->bookmarks_manager = _gtk_bookmarks_manager_new ((GtkBookmarksChangedFunc)update_places, sidebar);
+  sidebar->bookmarks_manager = _gtk_bookmarks_manager_new ((GtkBookmarksChangedFunc)queue_update_places, sidebar);
 
   sidebar->trash_monitor = _gtk_trash_monitor_get ();
   sidebar->trash_monitor_changed_id = g_signal_connect_swapped (sidebar->trash_monitor, "trash-state-changed",
@@ -4312,6 +4595,15 @@ gtk_places_sidebar_dispose (GObject *object)
       sidebar->cancellable = NULL;
     }
 
+  if (sidebar->update_places_id != 0)
+    {
+      g_source_remove (sidebar->update_places_id);
+      sidebar->update_places_id = 0;
+    }
+
+  g_list_free (sidebar->stale_rows);
+  sidebar->stale_rows = NULL;
+
   free_drag_data (sidebar);
 
   if (sidebar->bookmarks_manager != NULL)
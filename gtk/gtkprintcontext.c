@@ -234,6 +234,31 @@ gtk_print_context_set_cairo_context (GtkPrintContext *context,
 	       context->pixels_per_unit_y);
 }
 
+/* Swaps in @cr without changing the resolution and without
+ * scaling it, @cr is expected to already be set up for drawing.
+ * Returns the previous cairo context.
+ */
+cairo_t *
+_gtk_print_context_replace_cairo_context (GtkPrintContext *context,
+                                          cairo_t         *cr)
+{
+  cairo_t *old_cr = context->cr;
+
+  context->cr = cairo_reference (cr);
+
+  return old_cr;
+}
+
+/* The number of units per inch that the cairo context is drawing in */
+void
+_gtk_print_context_get_unit_resolution (GtkPrintContext *context,
+                                        gdouble         *units_x,
+                                        gdouble         *units_y)
+{
+  *units_x = context->surface_dpi_x / context->pixels_per_unit_x;
+  *units_y = context->surface_dpi_y / context->pixels_per_unit_y;
+}
+
 
 void
 _gtk_print_context_rotate_according_to_orientation (GtkPrintContext *context)
@@ -65,6 +65,15 @@ struct _GtkPrinterPrivate
   guint accepts_pdf       : 1;
   guint accepts_ps        : 1;
 
+  /* What the backend reported from the details, asked for once per
+   * time the details are set */
+  guint papers_cached       : 1;
+  guint default_page_cached : 1;
+  guint capabilities_cached : 1;
+  GList *papers;
+  GtkPageSetup *default_page;
+  GtkPrintCapabilities capabilities;
+
   gchar *state_message;  
   gint job_count;
 
@@ -251,6 +260,21 @@ gtk_printer_init (GtkPrinter *printer)
   priv->job_count = 0;
 }
 
+static void
+gtk_printer_clear_details_cache (GtkPrinter *printer)
+{
+  GtkPrinterPrivate *priv = printer->priv;
+
+  g_list_free_full (priv->papers, g_object_unref);
+  priv->papers = NULL;
+  g_clear_object (&priv->default_page);
+  priv->capabilities = 0;
+
+  priv->papers_cached = FALSE;
+  priv->default_page_cached = FALSE;
+  priv->capabilities_cached = FALSE;
+}
+
 static void
 gtk_printer_finalize (GObject *object)
 {
@@ -263,6 +287,8 @@ gtk_printer_finalize (GObject *object)
   g_free (priv->state_message);
   g_free (priv->icon_name);
 
+  gtk_printer_clear_details_cache (printer);
+
   if (priv->backend)
     g_object_unref (priv->backend);
 
@@ -621,6 +647,10 @@ void
 gtk_printer_set_has_details (GtkPrinter *printer,
 			     gboolean val)
 {
+  /* Backends set this whenever they (re)load the details, so
+   * anything derived from them may be out of date */
+  gtk_printer_clear_details_cache (printer);
+
   printer->priv->has_details = val;
 }
 
@@ -914,12 +944,24 @@ _gtk_printer_create_cairo_surface (GtkPrinter       *printer,
 GList  *
 gtk_printer_list_papers (GtkPrinter *printer)
 {
+  GtkPrinterPrivate *priv;
   GtkPrintBackendClass *backend_class;
 
   g_return_val_if_fail (GTK_IS_PRINTER (printer), NULL);
 
-  backend_class = GTK_PRINT_BACKEND_GET_CLASS (printer->priv->backend);
-  return backend_class->printer_list_papers (printer);
+  priv = printer->priv;
+  backend_class = GTK_PRINT_BACKEND_GET_CLASS (priv->backend);
+
+  if (!priv->has_details)
+    return backend_class->printer_list_papers (printer);
+
+  if (!priv->papers_cached)
+    {
+      priv->papers = backend_class->printer_list_papers (printer);
+      priv->papers_cached = TRUE;
+    }
+
+  return g_list_copy_deep (priv->papers, (GCopyFunc) gtk_page_setup_copy, NULL);
 }
 
 /**
@@ -933,12 +975,24 @@ gtk_printer_list_papers (GtkPrinter *printer)
 GtkPageSetup  *
 gtk_printer_get_default_page_size (GtkPrinter *printer)
 {
+  GtkPrinterPrivate *priv;
   GtkPrintBackendClass *backend_class;
 
   g_return_val_if_fail (GTK_IS_PRINTER (printer), NULL);
 
-  backend_class = GTK_PRINT_BACKEND_GET_CLASS (printer->priv->backend);
-  return backend_class->printer_get_default_page_size (printer);
+  priv = printer->priv;
+  backend_class = GTK_PRINT_BACKEND_GET_CLASS (priv->backend);
+
+  if (!priv->has_details)
+    return backend_class->printer_get_default_page_size (printer);
+
+  if (!priv->default_page_cached)
+    {
+      priv->default_page = backend_class->printer_get_default_page_size (printer);
+      priv->default_page_cached = TRUE;
+    }
+
+  return priv->default_page ? gtk_page_setup_copy (priv->default_page) : NULL;
 }
 
 /**
@@ -1018,12 +1072,24 @@ gtk_printer_get_hard_margins_for_paper_size (GtkPrinter   *printer,
 GtkPrintCapabilities
 gtk_printer_get_capabilities (GtkPrinter *printer)
 {
+  GtkPrinterPrivate *priv;
   GtkPrintBackendClass *backend_class;
 
   g_return_val_if_fail (GTK_IS_PRINTER (printer), 0);
 
-  backend_class = GTK_PRINT_BACKEND_GET_CLASS (printer->priv->backend);
-  return backend_class->printer_get_capabilities (printer);
+  priv = printer->priv;
+  backend_class = GTK_PRINT_BACKEND_GET_CLASS (priv->backend);
+
+  if (!priv->has_details)
+    return backend_class->printer_get_capabilities (printer);
+
+  if (!priv->capabilities_cached)
+    {
+      priv->capabilities = backend_class->printer_get_capabilities (printer);
+      priv->capabilities_cached = TRUE;
+    }
+
+  return priv->capabilities;
 }
 
 /**
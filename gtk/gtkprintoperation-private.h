@@ -61,6 +61,17 @@ struct _GtkPrintOperationPrivate
   guint print_pages_idle_id;
   guint show_progress_timeout_id;
 
+  /* For gtk_print_operation_get_pages_per_second() */
+  gint64 last_page_time;
+  gdouble pages_per_second;
+
+  /* Pages drawn for gtk_print_operation_preview_render_page() */
+  GHashTable *preview_pages;
+  GQueue preview_pages_lru;
+  gpointer recording_page;
+  cairo_t *preview_cr;
+  guint use_preview_cache : 1;
+
   GtkPrintContext *print_context;
   
   GtkPrintPages print_pages;
@@ -144,6 +155,11 @@ void             _gtk_print_context_set_hard_margins                (GtkPrintCon
 								     gdouble            bottom,
 								     gdouble            left,
 								     gdouble            right);
+cairo_t *        _gtk_print_context_replace_cairo_context           (GtkPrintContext   *context,
+								     cairo_t           *cr);
+void             _gtk_print_context_get_unit_resolution             (GtkPrintContext   *context,
+								     gdouble           *units_x,
+								     gdouble           *units_y);
 
 G_END_DECLS
 
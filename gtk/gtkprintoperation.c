@@ -213,6 +213,14 @@ gtk_print_operation_finalize (GObject *object)
 
   if (priv->error)
     g_error_free (priv->error);
+
+  if (priv->recording_page)
+    {
+      preview_page_free (priv->recording_page);
+      cairo_destroy (priv->preview_cr);
+    }
+
+  g_clear_pointer (&priv->preview_pages, g_hash_table_unref);
   
   G_OBJECT_CLASS (gtk_print_operation_parent_class)->finalize (object);
 }
@@ -257,6 +265,134 @@ gtk_print_operation_init (GtkPrintOperation *operation)
   priv->job_name = g_strdup_printf (_("%s job #%d"), appname, ++job_nr);
 }
 
+/* Previews usually render the same pages again and again while the
+ * user is paging through the document or zooming. What the
+ * #GtkPrintOperation::draw-page handler draws for a page is recorded
+ * and the last pages are kept, so they can be replayed without asking
+ * the application again. Recordings are vector data, after zooming
+ * they are replayed at the new resolution.
+ */
+#define MAX_PREVIEW_PAGES 32
+
+typedef struct
+{
+  gint page_nr;
+  cairo_surface_t *recording;
+  /* The resolution of the user space that the page was drawn in */
+  gdouble units_x;
+  gdouble units_y;
+  GList link;
+} PreviewPage;
+
+static void
+preview_page_free (gpointer data)
+{
+  PreviewPage *page = data;
+
+  cairo_surface_destroy (page->recording);
+  g_slice_free (PreviewPage, page);
+}
+
+static void
+clear_preview_pages (GtkPrintOperation *op)
+{
+  GtkPrintOperationPrivate *priv = op->priv;
+
+  if (priv->preview_pages)
+    g_hash_table_remove_all (priv->preview_pages);
+  g_queue_init (&priv->preview_pages_lru);
+}
+
+static void
+paint_preview_page (GtkPrintOperation *op,
+                    PreviewPage       *page)
+{
+  GtkPrintContext *print_context = op->priv->print_context;
+  gdouble units_x, units_y;
+  cairo_t *cr;
+
+  cr = gtk_print_context_get_cairo_context (print_context);
+  _gtk_print_context_get_unit_resolution (print_context, &units_x, &units_y);
+
+  cairo_save (cr);
+  cairo_scale (cr, units_x / page->units_x, units_y / page->units_y);
+  cairo_set_source_surface (cr, page->recording, 0, 0);
+  cairo_paint (cr);
+  cairo_restore (cr);
+}
+
+static gboolean
+draw_cached_preview_page (GtkPrintOperation *op,
+                          gint               page_nr)
+{
+  GtkPrintOperationPrivate *priv = op->priv;
+  PreviewPage *page;
+
+  if (priv->preview_pages == NULL)
+    return FALSE;
+
+  page = g_hash_table_lookup (priv->preview_pages, GINT_TO_POINTER (page_nr));
+  if (page == NULL)
+    return FALSE;
+
+  g_queue_unlink (&priv->preview_pages_lru, &page->link);
+  g_queue_push_head_link (&priv->preview_pages_lru, &page->link);
+
+  paint_preview_page (op, page);
+
+  return TRUE;
+}
+
+static void
+start_recording_preview_page (GtkPrintOperation *op,
+                              gint               page_nr)
+{
+  GtkPrintOperationPrivate *priv = op->priv;
+  PreviewPage *page;
+  cairo_t *cr;
+
+  page = g_slice_new0 (PreviewPage);
+  page->page_nr = page_nr;
+  page->link.data = page;
+  page->recording = cairo_recording_surface_create (CAIRO_CONTENT_COLOR_ALPHA, NULL);
+  _gtk_print_context_get_unit_resolution (priv->print_context, &page->units_x, &page->units_y);
+
+  cr = cairo_create (page->recording);
+  priv->preview_cr = _gtk_print_context_replace_cairo_context (priv->print_context, cr);
+  cairo_destroy (cr);
+
+  priv->recording_page = page;
+}
+
+static void
+finish_recording_preview_page (GtkPrintOperation *op)
+{
+  GtkPrintOperationPrivate *priv = op->priv;
+  PreviewPage *page = priv->recording_page;
+  GList *link;
+  cairo_t *cr;
+
+  cr = _gtk_print_context_replace_cairo_context (priv->print_context, priv->preview_cr);
+  cairo_destroy (cr);
+  g_clear_pointer (&priv->preview_cr, cairo_destroy);
+  priv->recording_page = NULL;
+
+  paint_preview_page (op, page);
+
+  if (priv->preview_pages == NULL)
+    priv->preview_pages = g_hash_table_new_full (NULL, NULL, NULL, preview_page_free);
+
+  g_hash_table_replace (priv->preview_pages, GINT_TO_POINTER (page->page_nr), page);
+  g_queue_push_head_link (&priv->preview_pages_lru, &page->link);
+
+  while (priv->preview_pages_lru.length > MAX_PREVIEW_PAGES)
+    {
+      link = g_queue_pop_tail_link (&priv->preview_pages_lru);
+      page = link->data;
+      g_hash_table_remove (priv->preview_pages, GINT_TO_POINTER (page->page_nr));
+    }
+}
+
 static void
 preview_iface_render_page (GtkPrintOperationPreview *preview,
 			   gint                      page_nr)
@@ -265,7 +401,10 @@ preview_iface_render_page (GtkPrintOperationPreview *preview,
   GtkPrintOperation *op;
 
   op = GTK_PRINT_OPERATION (preview);
+
+  op->priv->use_preview_cache = TRUE;
   common_render_page (op, page_nr);
+  op->priv->use_preview_cache = FALSE;
 }
 
 static void
@@ -276,6 +415,8 @@ preview_iface_end_preview (GtkPrintOperationPreview *preview)
   
   op = GTK_PRINT_OPERATION (preview);
 
+  clear_preview_pages (op);
+
   g_signal_emit (op, signals[END_PRINT], 0, op->priv->print_context);
 
   if (op->priv->rloop)
@@ -524,8 +665,49 @@ struct _PrintPagesData
   gboolean initialized;
   gboolean is_preview;
   gboolean done;
+  gboolean drawing;
 };
 
+/* How much the last page counts for the page rate, as a fraction */
+#define PAGE_RATE_WEIGHT 0.125
+
+static void
+start_drawing_page (PrintPagesData *data)
+{
+  GtkPrintOperationPrivate *priv = data->op->priv;
+
+  if (priv->last_page_time == 0)
+    priv->last_page_time = g_get_monotonic_time ();
+
+  data->drawing = TRUE;
+}
+
+/* Called from the idle handlers once the page is done, so that
+ * pages drawn in a thread are not counted from that thread. */
+static void
+finish_drawing_page (PrintPagesData *data)
+{
+  GtkPrintOperationPrivate *priv = data->op->priv;
+  gint64 now;
+  gdouble rate;
+
+  if (!data->drawing)
+    return;
+
+  data->drawing = FALSE;
+
+  now = g_get_monotonic_time ();
+  rate = G_USEC_PER_SEC / (gdouble) MAX (now - priv->last_page_time, 1);
+  priv->last_page_time = now;
+
+  /* Smooth out single pages that are much faster or slower,
+   * but follow the rate when the pages get more complex. */
+  if (priv->pages_per_second == 0)
+    priv->pages_per_second = rate;
+  else
+    priv->pages_per_second += (rate - priv->pages_per_second) * PAGE_RATE_WEIGHT;
+}
+
 typedef struct
 {
   GtkPrintOperationPreview *preview;
@@ -598,10 +780,15 @@ preview_print_idle (gpointer data)
         }
       else
         {
+          finish_drawing_page (pop->pages_data);
           increment_page_sequence (pop->pages_data);
 
           if (!pop->pages_data->done)
-            gtk_print_operation_preview_render_page (pop->preview, pop->pages_data->page);
+            {
+              start_drawing_page (pop->pages_data);
+              /* Every page is drawn once, so skip the preview cache */
+              common_render_page (op, pop->pages_data->page);
+            }
           else
             done = priv->page_drawing_state == GTK_PAGE_DRAWING_STATE_READY;
         }
@@ -2376,6 +2563,9 @@ gtk_print_operation_draw_page_finish (GtkPrintOperation *op)
   print_context = priv->print_context;
   page_setup = gtk_print_context_get_page_setup (print_context);
 
+  if (priv->recording_page)
+    finish_recording_preview_page (op);
+
   cr = gtk_print_context_get_cairo_context (print_context);
 
   priv->end_page (op, print_context);
@@ -2607,6 +2797,17 @@ common_render_page (GtkPrintOperation *op,
   
   priv->page_drawing_state = GTK_PAGE_DRAWING_STATE_DRAWING;
 
+  if (priv->use_preview_cache)
+    {
+      if (draw_cached_preview_page (op, page_nr))
+        {
+          gtk_print_operation_draw_page_finish (op);
+          return;
+        }
+
+      start_recording_preview_page (op, page_nr);
+    }
+
   g_signal_emit (op, signals[DRAW_PAGE], 0, 
 		 print_context, page_nr);
 
@@ -2624,6 +2825,12 @@ prepare_data (PrintPagesData *data)
 
   priv = data->op->priv;
 
+  priv->last_page_time = 0;
+  priv->pages_per_second = 0;
+
+  /* Paginating again can move the contents to other pages */
+  clear_preview_pages (data->op);
+
   if (priv->manual_collation)
     {
       data->uncollated_copies = priv->manual_num_copies;
@@ -2809,10 +3016,14 @@ print_pages_idle (gpointer user_data)
           goto out;
         }
 
+      finish_drawing_page (data);
       increment_page_sequence (data);
 
       if (!data->done)
-        common_render_page (data->op, data->page);
+        {
+          start_drawing_page (data);
+          common_render_page (data->op, data->page);
+        }
       else
         done = priv->page_drawing_state == GTK_PAGE_DRAWING_STATE_READY;
 
@@ -3301,3 +3512,27 @@ gtk_print_operation_get_n_pages_to_print (GtkPrintOperation *op)
 
   return op->priv->nr_of_pages_to_print;
 }
+
+/**
+ * gtk_print_operation_get_pages_per_second:
+ * @op: a #GtkPrintOperation
+ *
+ * Returns how fast pages are currently drawn. The rate is measured
+ * from the pages that have been drawn so far, with more weight on
+ * the last ones, and includes the time that is spent waiting for
+ * gtk_print_operation_draw_page_finish() when drawing is deferred.
+ *
+ * Together with gtk_print_operation_get_n_pages_to_print(), this
+ * can be used to estimate how long a print operation will take,
+ * e.g. from a #GtkPrintOperation::draw-page handler.
+ *
+ * Returns: the number of pages drawn per second, or 0 if no
+ *     page has been drawn yet
+ **/
+gdouble
+gtk_print_operation_get_pages_per_second (GtkPrintOperation *op)
+{
+  g_return_val_if_fail (GTK_IS_PRINT_OPERATION (op), 0);
+
+  return op->priv->pages_per_second;
+}
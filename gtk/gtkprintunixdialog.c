@@ -337,6 +337,13 @@ struct GtkPrintUnixDialogPrivate
   GtkWidget *advanced_vbox;
   GtkWidget *advanced_page;
 
+  /* The option widgets of these pages are only created once the page
+   * gets shown */
+  guint image_quality_pending : 1;
+  guint finishing_pending     : 1;
+  guint color_pending         : 1;
+  guint advanced_pending      : 1;
+
   GtkWidget *extension_point;
 
   /* These are set initially on selected printer (either default printer,
@@ -735,6 +742,9 @@ gtk_print_unix_dialog_init (GtkPrintUnixDialog *dialog)
   gtk_widget_set_visible (priv->selection_radio, FALSE);
   gtk_widget_set_visible (priv->conflicts_widget, FALSE);
 
+  g_signal_connect (priv->notebook, "switch-page",
+                    G_CALLBACK (notebook_switch_page), dialog);
+
   /* Treeview auxiliary functions need to be setup here */
   gtk_tree_model_filter_set_visible_func (priv->printer_list_filter,
                                           (GtkTreeModelFilterVisibleFunc) is_printer_active,
@@ -1423,22 +1433,137 @@ add_option_to_table (GtkPrinterOption *option,
 }
 
 static void
+count_table_option (GtkPrinterOption *option,
+                    gpointer          user_data)
+{
+  guint *n_options = user_data;
+
+  if (!g_str_has_prefix (option->name, "gtk-"))
+    (*n_options)++;
+}
+
+/* Whether add_option_to_table() would add anything for @group */
+static gboolean
+group_has_table_options (GtkPrinterOptionSet *options,
+                         const gchar         *group)
+{
+  guint n_options = 0;
+
+  gtk_printer_option_set_foreach_in_group (options, group,
+                                           count_table_option,
+                                           &n_options);
+
+  return n_options > 0;
+}
+
+static gboolean
+is_advanced_group (const gchar *group)
+{
+  return group != NULL &&
+         strcmp (group, "ImageQualityPage") != 0 &&
+         strcmp (group, "ColorPage") != 0 &&
+         strcmp (group, "FinishingPage") != 0 &&
+         strcmp (group, "GtkPrintDialogExtension") != 0;
+}
+
+static gboolean
 setup_page_table (GtkPrinterOptionSet *options,
                   const gchar         *group,
-                  GtkWidget           *table,
                   GtkWidget           *page)
 {
-  gint nrows;
+  gboolean has_options;
 
-  gtk_printer_option_set_foreach_in_group (options, group,
+  has_options = group_has_table_options (options, group);
+  gtk_widget_set_visible (page, has_options);
+
+  return has_options;
+}
+
+static void
+fill_advanced_page (GtkPrintUnixDialog *dialog)
+{
+  GtkPrintUnixDialogPrivate *priv = dialog->priv;
+  GList *groups, *l;
+  gchar *group;
+  GtkWidget *table, *frame;
+
+  groups = gtk_printer_option_set_get_groups (priv->options);
+
+  for (l = groups; l != NULL; l = l->next)
+    {
+      group = l->data;
+
+      if (!is_advanced_group (group) ||
+          !group_has_table_options (priv->options, group))
+        continue;
+
+      table = gtk_grid_new ();
+      gtk_grid_set_row_spacing (GTK_GRID (table), 6);
+      gtk_grid_set_column_spacing (GTK_GRID (table), 12);
+
+      gtk_printer_option_set_foreach_in_group (priv->options,
+                                               group,
+                                               add_option_to_table,
+                                               table);
+
+      frame = wrap_in_frame (group, table);
+      gtk_widget_show (table);
+      gtk_widget_show (frame);
+
+      gtk_container_add (GTK_CONTAINER (priv->advanced_vbox),
+                         frame);
+    }
+
+  g_list_free_full (groups, g_free);
+}
+
+static void
+fill_page (GtkPrintUnixDialog *dialog,
+           GtkWidget          *page)
+{
+  GtkPrintUnixDialogPrivate *priv = dialog->priv;
+  const gchar *group;
+  GtkWidget *table;
+
+  if (page == priv->image_quality_page && priv->image_quality_pending)
+    {
+      priv->image_quality_pending = FALSE;
+      group = "ImageQualityPage";
+      table = priv->image_quality_table;
+    }
+  else if (page == priv->finishing_page && priv->finishing_pending)
+    {
+      priv->finishing_pending = FALSE;
+      group = "FinishingPage";
+      table = priv->finishing_table;
+    }
+  else if (page == priv->color_page && priv->color_pending)
+    {
+      priv->color_pending = FALSE;
+      group = "ColorPage";
+      table = priv->color_table;
+    }
+  else if (page == priv->advanced_page && priv->advanced_pending)
+    {
+      priv->advanced_pending = FALSE;
+      fill_advanced_page (dialog);
+      return;
+    }
+  else
+    return;
+
+  gtk_printer_option_set_foreach_in_group (priv->options, group,
                                            add_option_to_table,
                                            table);
+}
 
-  nrows = grid_rows (GTK_GRID (table));
-  if (nrows == 0)
-    gtk_widget_hide (page);
-  else
-    gtk_widget_show (page);
+static void
+notebook_switch_page (GtkNotebook        *notebook,
+                      GtkWidget          *page,
+                      guint               page_num,
+                      GtkPrintUnixDialog *dialog)
+{
+  fill_page (dialog, page);
 }
 
 static void
@@ -1528,9 +1653,8 @@ update_dialog_from_settings (GtkPrintUnixDialog *dialog)
   GtkPrintUnixDialogPrivate *priv = dialog->priv;
   GList *groups, *l;
   gchar *group;
-  GtkWidget *table, *frame;
+  GtkNotebook *notebook;
   gboolean has_advanced, has_job;
-  guint nrows;
   GList *children;
 
   if (priv->current_printer == NULL)
@@ -1565,20 +1689,17 @@ update_dialog_from_settings (GtkPrintUnixDialog *dialog)
   else
     gtk_widget_hide (priv->job_page);
 
-  setup_page_table (priv->options,
-                    "ImageQualityPage",
-                    priv->image_quality_table,
-                    priv->image_quality_page);
+  priv->image_quality_pending = setup_page_table (priv->options,
+                                                 "ImageQualityPage",
+                                                 priv->image_quality_page);
 
-  setup_page_table (priv->options,
-                    "FinishingPage",
-                    priv->finishing_table,
-                    priv->finishing_page);
+  priv->finishing_pending = setup_page_table (priv->options,
+                                             "FinishingPage",
+                                             priv->finishing_page);
 
-  setup_page_table (priv->options,
-                    "ColorPage",
-                    priv->color_table,
-                    priv->color_page);
+  priv->color_pending = setup_page_table (priv->options,
+                                         "ColorPage",
+                                         priv->color_page);
 
   gtk_printer_option_set_foreach_in_group (priv->options,
                                            "GtkPrintDialogExtension",
@@ -1599,49 +1720,23 @@ update_dialog_from_settings (GtkPrintUnixDialog *dialog)
   groups = gtk_printer_option_set_get_groups (priv->options);
 
   has_advanced = FALSE;
-  for (l = groups; l != NULL; l = l->next)
+  for (l = groups; l != NULL && !has_advanced; l = l->next)
     {
       group = l->data;
 
-      if (group == NULL)
-        continue;
-
-      if (strcmp (group, "ImageQualityPage") == 0 ||
-          strcmp (group, "ColorPage") == 0 ||
-          strcmp (group, "FinishingPage") == 0 ||
-          strcmp (group, "GtkPrintDialogExtension") == 0)
-        continue;
-
-      table = gtk_grid_new ();
-      gtk_grid_set_row_spacing (GTK_GRID (table), 6);
-      gtk_grid_set_column_spacing (GTK_GRID (table), 12);
-
-      gtk_printer_option_set_foreach_in_group (priv->options,
-                                               group,
-                                               add_option_to_table,
-                                               table);
-
-      nrows = grid_rows (GTK_GRID (table));
-      if (nrows == 0)
-        gtk_widget_destroy (table);
-      else
-        {
-          has_advanced = TRUE;
-          frame = wrap_in_frame (group, table);
-          gtk_widget_show (table);
-          gtk_widget_show (frame);
-
-          gtk_container_add (GTK_CONTAINER (priv->advanced_vbox),
-                              frame);
-        }
+      if (is_advanced_group (group) &&
+          group_has_table_options (priv->options, group))
+        has_advanced = TRUE;
     }
 
-  if (has_advanced)
-    gtk_widget_show (priv->advanced_page);
-  else
-    gtk_widget_hide (priv->advanced_page);
-
   g_list_free_full (groups, g_free);
+
+  gtk_widget_set_visible (priv->advanced_page, has_advanced);
+  priv->advanced_pending = has_advanced;
+
+  /* The other pages get their option widgets when they are switched to */
+  notebook = GTK_NOTEBOOK (priv->notebook);
+  fill_page (dialog, gtk_notebook_get_nth_page (notebook, gtk_notebook_get_current_page (notebook)));
 }
 
 static void
@@ -1971,6 +2066,11 @@ clear_per_printer_ui (GtkPrintUnixDialog *dialog)
 {
   GtkPrintUnixDialogPrivate *priv = dialog->priv;
 
+  priv->image_quality_pending = FALSE;
+  priv->finishing_pending = FALSE;
+  priv->color_pending = FALSE;
+  priv->advanced_pending = FALSE;
+
   if (priv->finishing_table == NULL)
     return;
 
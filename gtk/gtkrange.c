@@ -39,6 +39,7 @@
 #include "gtkorientableprivate.h"
 #include "gtkprivate.h"
 #include "gtkscale.h"
+#include "gtksettingsprivate.h"
 #include "gtktypebuiltins.h"
 #include "gtkeventcontrollerkey.h"
 
@@ -1904,9 +1905,7 @@ gtk_range_multipress_gesture_pressed (GtkGestureMultiPress *gesture,
   source_device = gdk_event_get_source_device ((GdkEvent *) event);
   source = gdk_device_get_source (source_device);
 
-  g_object_get (gtk_widget_get_settings (widget),
-                "gtk-primary-button-warps-slider", &primary_warps,
-                NULL);
+  primary_warps = gtk_settings_get_values (gtk_widget_get_settings (widget))->primary_button_warps_slider;
 
   mouse_location = gtk_widget_pick (widget, x, y);
 
@@ -21,6 +21,8 @@
 
 #include "gtkdebug.h"
 
+#include <string.h>
+
 /* Define the following to print adds and removals to stdout.
  * The format of the printout will be suitable for addition as a new test to
  * testsuite/gtk/rbtree-crash.c
@@ -31,6 +33,19 @@
 #undef DUMP_MODIFICATION
 
 typedef struct _GtkRbNode GtkRbNode;
+typedef struct _GtkRbChunk GtkRbChunk;
+
+/* Nodes are allocated from chunks owned by the tree. Chunks start
+ * small so that the many tiny trees of a GtkTreeListModel stay cheap,
+ * and grow for the big ones. Freed nodes go to a free list and the
+ * chunks are only given back once the tree is empty.
+ */
+#define MIN_CHUNK_NODES 16
+#define MAX_CHUNK_NODES 1024
+
+/* Enough for the element and augment data that follows the node */
+#define NODE_ALIGNMENT (2 * sizeof (gpointer))
+#define ALIGN_NODE_SIZE(size) (((size) + NODE_ALIGNMENT - 1) & ~(NODE_ALIGNMENT - 1))
 
 struct _GtkRbTree
 {
@@ -43,8 +58,21 @@ struct _GtkRbTree
   GDestroyNotify clear_augment_func;
 
   GtkRbNode *root;
+  guint n_nodes;
+
+  gsize node_size;
+  guint chunk_n_nodes;
+  GtkRbChunk *chunks;
+  GtkRbNode *free_nodes; /* linked via node->left */
 };
 
+struct _GtkRbChunk
+{
+  GtkRbChunk *next;
+};
+
+#define CHUNK_HEADER_SIZE ALIGN_NODE_SIZE (sizeof (GtkRbChunk))
+
 struct _GtkRbNode
 {
   guint red :1;
@@ -112,12 +140,61 @@ gtk_rb_node_get_size (GtkRbTree *tree)
   return sizeof (GtkRbNode) + tree->element_size + tree->augment_size;
 }
 
+static void
+gtk_rb_tree_add_chunk (GtkRbTree *tree)
+{
+  GtkRbChunk *chunk;
+  guchar *data;
+  guint i;
+
+  chunk = g_malloc (CHUNK_HEADER_SIZE + tree->chunk_n_nodes * tree->node_size);
+  chunk->next = tree->chunks;
+  tree->chunks = chunk;
+
+  /* Thread the nodes in reverse so they get handed out in memory order */
+  data = (guchar *) chunk + CHUNK_HEADER_SIZE;
+  for (i = tree->chunk_n_nodes; i > 0; i--)
+    {
+      GtkRbNode *node = (GtkRbNode *) (data + (i - 1) * tree->node_size);
+
+      node->left = tree->free_nodes;
+      tree->free_nodes = node;
+    }
+
+  tree->chunk_n_nodes = MIN (tree->chunk_n_nodes * 2, MAX_CHUNK_NODES);
+}
+
+static void
+gtk_rb_tree_release_chunks (GtkRbTree *tree)
+{
+  GtkRbChunk *chunk, *next;
+
+  g_assert (tree->n_nodes == 0);
+
+  for (chunk = tree->chunks; chunk != NULL; chunk = next)
+    {
+      next = chunk->next;
+      g_free (chunk);
+    }
+
+  tree->chunks = NULL;
+  tree->free_nodes = NULL;
+  tree->chunk_n_nodes = MIN_CHUNK_NODES;
+}
+
 static GtkRbNode *
 gtk_rb_node_new (GtkRbTree *tree)
 {
   GtkRbNode *result;
 
-  result = g_slice_alloc0 (gtk_rb_node_get_size (tree));
+  if (tree->free_nodes == NULL)
+    gtk_rb_tree_add_chunk (tree);
+
+  result = tree->free_nodes;
+  tree->free_nodes = result->left;
+  tree->n_nodes++;
+
+  memset (result, 0, gtk_rb_node_get_size (tree));
 
   result->red = TRUE;
   result->dirty = TRUE;
@@ -134,7 +211,9 @@ gtk_rb_node_free (GtkRbTree *tree,
   if (tree->clear_augment_func)
     tree->clear_augment_func (NODE_TO_AUG_POINTER (tree, node));
 
-  g_slice_free1 (gtk_rb_node_get_size (tree), node);
+  node->left = tree->free_nodes;
+  tree->free_nodes = node;
+  tree->n_nodes--;
 }
 
 static void
@@ -520,6 +599,9 @@ gtk_rb_tree_new_for_size (gsize                element_size,
   tree->clear_func = clear_func;
   tree->clear_augment_func = clear_augment_func;
 
+  tree->node_size = ALIGN_NODE_SIZE (gtk_rb_node_get_size (tree));
+  tree->chunk_n_nodes = MIN_CHUNK_NODES;
+
   return tree;
 }
 
@@ -540,7 +622,8 @@ gtk_rb_tree_unref (GtkRbTree *tree)
 
   if (tree->root)
     gtk_rb_node_free_deep (tree, tree->root);
-    
+  gtk_rb_tree_release_chunks (tree);
+
   g_slice_free (GtkRbTree, tree);
 }
 
@@ -707,6 +790,118 @@ gtk_rb_tree_insert_after (GtkRbTree *tree,
   return NODE_TO_POINTER (result);
 }
 
+/* Builds a balanced tree out of @n_nodes nodes, keeping their order.
+ *
+ * Splitting in the middle keeps the sizes of both subtrees within one
+ * of each other, so all levels but the deepest one are full. Coloring
+ * just the nodes on that level red then gives a valid red-black tree.
+ */
+static GtkRbNode *
+gtk_rb_tree_build (GtkRbTree  *tree,
+                   GtkRbNode **nodes,
+                   guint       n_nodes,
+                   guint       depth,
+                   guint       red_depth)
+{
+  GtkRbNode *node;
+  guint mid;
+
+  if (n_nodes == 0)
+    return NULL;
+
+  mid = n_nodes / 2;
+  node = nodes[mid];
+
+  node->left = gtk_rb_tree_build (tree, nodes, mid, depth + 1, red_depth);
+  if (node->left)
+    set_parent (tree, node->left, node);
+  node->right = gtk_rb_tree_build (tree, nodes + mid + 1, n_nodes - mid - 1, depth + 1, red_depth);
+  if (node->right)
+    set_parent (tree, node->right, node);
+
+  node->red = depth == red_depth;
+  /* The augment gets computed once, when it is first asked for */
+  node->dirty = TRUE;
+
+  return node;
+}
+
+/**
+ * gtk_rb_tree_insert_n_before:
+ * @tree: a #GtkRbTree
+ * @node: (nullable): the node to insert before or %NULL to append
+ * @n: number of nodes to insert
+ *
+ * Inserts @n new nodes in a row before @node.
+ *
+ * When the new nodes are a good part of the resulting tree, the
+ * whole tree is rebuilt in one go instead of doing @n insertions
+ * with their rebalancing. Existing nodes stay valid either way.
+ *
+ * Returns: (nullable): the first of the new nodes, the others
+ *     follow it. %NULL if @n is 0
+ **/
+gpointer
+gtk_rb_tree_insert_n_before (GtkRbTree *tree,
+                             gpointer   node,
+                             guint      n)
+{
+  GtkRbNode **nodes;
+  GtkRbNode *before, *current, *result;
+  guint i, j, n_total;
+
+  if (n == 0)
+    return NULL;
+
+  if (n == 1 || n < tree->n_nodes / 4)
+    {
+      gpointer first, last;
+
+      first = last = gtk_rb_tree_insert_before (tree, node);
+      for (i = 1; i < n; i++)
+        last = gtk_rb_tree_insert_after (tree, last);
+
+      return first;
+    }
+
+  before = NODE_FROM_POINTER (node);
+  n_total = tree->n_nodes + n;
+  nodes = g_new (GtkRbNode *, n_total);
+  result = NULL;
+
+  i = 0;
+  current = tree->root ? gtk_rb_node_get_first (tree->root) : NULL;
+  while (TRUE)
+    {
+      if (current == before)
+        {
+#ifdef DUMP_MODIFICATION
+          for (j = 0; j < n; j++)
+            g_print ("add (tree, %u); /* 0x%p */\n", i + j, tree);
+#endif /* DUMP_MODIFICATION */
+
+          for (j = 0; j < n; j++)
+            nodes[i++] = gtk_rb_node_new (tree);
+          result = nodes[i - n];
+        }
+
+      if (current == NULL)
+        break;
+
+      nodes[i++] = current;
+      current = gtk_rb_node_get_next (current);
+    }
+
+  g_assert (i == n_total);
+
+  set_parent (tree, gtk_rb_tree_build (tree, nodes, n_total, 0, g_bit_storage (n_total + 1) - 1), NULL);
+  set_black (tree->root);
+
+  g_free (nodes);
+
+  return NODE_TO_POINTER (result);
+}
+
 void
 gtk_rb_tree_remove (GtkRbTree *tree,
                     gpointer   node)
@@ -783,6 +978,8 @@ gtk_rb_tree_remove (GtkRbTree *tree,
     }
 
   gtk_rb_node_free (tree, real_node);
+  if (tree->n_nodes == 0)
+    gtk_rb_tree_release_chunks (tree);
 }
 
 void
@@ -794,6 +991,7 @@ gtk_rb_tree_remove_all (GtkRbTree *tree)
 
   if (tree->root)
     gtk_rb_node_free_deep (tree, tree->root);
+  gtk_rb_tree_release_chunks (tree);
 
   tree->root = NULL;
 }
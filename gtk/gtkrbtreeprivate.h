@@ -64,6 +64,9 @@ gpointer             gtk_rb_tree_insert_before          (GtkRbTree
                                                          gpointer                 node);
 gpointer             gtk_rb_tree_insert_after           (GtkRbTree               *tree,
                                                          gpointer                 node);
+gpointer             gtk_rb_tree_insert_n_before        (GtkRbTree               *tree,
+                                                         gpointer                 node,
+                                                         guint                    n);
 void                 gtk_rb_tree_remove                 (GtkRbTree               *tree,
                                                          gpointer                 node);
 void                 gtk_rb_tree_remove_all             (GtkRbTree               *tree);
@@ -170,6 +170,14 @@ struct _GtkRecentManagerPrivate
 
   GBookmarkFile *recent_items;
 
+  /* uri => GtkRecentInfo, built on demand from recent_items */
+  GHashTable *infos;
+
+  /* the state of the file when we last read or wrote it */
+  guint64 file_mtime;
+  guint64 file_size;
+  guint64 file_inode;
+
   GFileMonitor *monitor;
 
   guint changed_timeout;
@@ -215,6 +223,8 @@ static void     gtk_recent_manager_clamp_to_size       (GtkRecentManager  *manag
 static void     gtk_recent_manager_enabled_changed     (GtkRecentManager  *manager);
 
 
+static gboolean gtk_recent_manager_file_changed        (GtkRecentManager  *manager);
+
 static void     build_recent_items_list                (GtkRecentManager  *manager);
 static void     purge_recent_items_list                (GtkRecentManager  *manager,
                                                         GError           **error);
@@ -328,6 +338,8 @@ gtk_recent_manager_init (GtkRecentManager *manager)
 
   priv->size = 0;
   priv->filename = NULL;
+  priv->infos = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                       NULL, (GDestroyNotify) gtk_recent_info_unref);
 
   settings = gtk_settings_get_default ();
   if (settings)
@@ -387,6 +399,8 @@ gtk_recent_manager_finalize (GObject *object)
   if (priv->recent_items != NULL)
     g_bookmark_file_free (priv->recent_items);
 
+  g_hash_table_unref (priv->infos);
+
   G_OBJECT_CLASS (gtk_recent_manager_parent_class)->finalize (object);
 }
 
@@ -475,6 +489,7 @@ gtk_recent_manager_real_changed (GtkRecentManager *manager)
               g_bookmark_file_free (priv->recent_items);
               priv->recent_items = g_bookmark_file_new ();
               priv->size = 0;
+              g_hash_table_remove_all (priv->infos);
             }
           else
             {
@@ -499,6 +514,9 @@ gtk_recent_manager_real_changed (GtkRecentManager *manager)
               g_error_free (write_error);
             }
 
+          /* don't read back our own changes when the monitor notices them */
+          gtk_recent_manager_file_changed (manager);
+
           if (g_chmod (priv->filename, 0600) < 0)
             {
               gchar *utf8 = g_filename_to_utf8 (priv->filename, -1, NULL, NULL, NULL);
@@ -538,7 +556,8 @@ gtk_recent_manager_monitor_changed (GFileMonitor      *monitor,
     case G_FILE_MONITOR_EVENT_CHANGED:
     case G_FILE_MONITOR_EVENT_CREATED:
     case G_FILE_MONITOR_EVENT_DELETED:
-      gtk_recent_manager_changed (manager);
+      if (gtk_recent_manager_file_changed (manager))
+        gtk_recent_manager_changed (manager);
       break;
 
     case G_FILE_MONITOR_EVENT_CHANGES_DONE_HINT:
@@ -645,9 +664,55 @@ gtk_recent_manager_set_filename (GtkRecentManager *manager,
       g_object_unref (file);
     }
 
+  gtk_recent_manager_file_changed (manager);
   build_recent_items_list (manager);
 }
 
+/* checks whether the recently used resources file is different from
+ * when we last looked at it, and remembers its current state. every
+ * write replaces the file, so the inode changes along with the time.
+ */
+static gboolean
+gtk_recent_manager_file_changed (GtkRecentManager *manager)
+{
+  GtkRecentManagerPrivate *priv = manager->priv;
+  guint64 mtime = 0, size = 0, inode = 0;
+  gboolean changed;
+  GFileInfo *info;
+  GFile *file;
+
+  if (priv->filename == NULL)
+    return TRUE;
+
+  file = g_file_new_for_path (priv->filename);
+  info = g_file_query_info (file,
+                            G_FILE_ATTRIBUTE_TIME_MODIFIED ","
+                            G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC ","
+                            G_FILE_ATTRIBUTE_STANDARD_SIZE ","
+                            G_FILE_ATTRIBUTE_UNIX_INODE,
+                            G_FILE_QUERY_INFO_NONE,
+                            NULL, NULL);
+  if (info != NULL)
+    {
+      mtime = g_file_info_get_attribute_uint64 (info, G_FILE_ATTRIBUTE_TIME_MODIFIED) * G_USEC_PER_SEC +
+              g_file_info_get_attribute_uint32 (info, G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC);
+      size = g_file_info_get_size (info);
+      inode = g_file_info_get_attribute_uint64 (info, G_FILE_ATTRIBUTE_UNIX_INODE);
+      g_object_unref (info);
+    }
+  g_object_unref (file);
+
+  changed = mtime != priv->file_mtime ||
+            size != priv->file_size ||
+            inode != priv->file_inode;
+
+  priv->file_mtime = mtime;
+  priv->file_size = size;
+  priv->file_inode = inode;
+
+  return changed;
+}
+
 /* reads the recently used resources file and builds the items list.
  * we keep the items list inside the parser object, and build the
  * RecentInfo object only on user’s demand to avoid useless replication.
@@ -660,6 +725,8 @@ build_recent_items_list (GtkRecentManager *manager)
   GError *read_error;
   gint size;
 
+  g_hash_table_remove_all (priv->infos);
+
   if (!priv->recent_items)
     {
       priv->recent_items = g_bookmark_file_new ();
@@ -961,6 +1028,8 @@ gtk_recent_manager_add_full (GtkRecentManager    *manager,
       priv->size = 0;
     }
 
+  g_hash_table_remove (priv->infos, uri);
+
   if (data->display_name)
     g_bookmark_file_set_title (priv->recent_items, uri, data->display_name);
 
@@ -1049,6 +1118,8 @@ gtk_recent_manager_remove_item (GtkRecentManager  *manager,
       return FALSE;
     }
 
+  g_hash_table_remove (priv->infos, uri);
+
   priv->is_dirty = TRUE;
   gtk_recent_manager_changed (manager);
 
@@ -1080,6 +1151,35 @@ gtk_recent_manager_has_item (GtkRecentManager *manager,
   return g_bookmark_file_has_item (priv->recent_items, uri);
 }
 
+static void build_recent_info (GBookmarkFile *bookmarks,
+                               GtkRecentInfo *info);
+
+/* the infos are only built once per item and shared by the callers,
+ * since nothing changes them after they are filled in
+ */
+static GtkRecentInfo *
+gtk_recent_manager_get_info (GtkRecentManager *manager,
+                             const gchar      *uri)
+{
+  GtkRecentManagerPrivate *priv = manager->priv;
+  GtkRecentInfo *info;
+
+  info = g_hash_table_lookup (priv->infos, uri);
+  if (info == NULL)
+    {
+      info = gtk_recent_info_new (uri);
+
+      /* fill the RecentInfo structure with the data retrieved by our
+       * parser object from the storage file
+       */
+      build_recent_info (priv->recent_items, info);
+
+      g_hash_table_insert (priv->infos, info->uri, info);
+    }
+
+  return info;
+}
+
 static void
 build_recent_info (GBookmarkFile *bookmarks,
                    GtkRecentInfo *info)
@@ -1162,7 +1262,6 @@ gtk_recent_manager_lookup_item (GtkRecentManager  *manager,
                                 GError           **error)
 {
   GtkRecentManagerPrivate *priv;
-  GtkRecentInfo *info = NULL;
 
   g_return_val_if_fail (GTK_IS_RECENT_MANAGER (manager), NULL);
   g_return_val_if_fail (uri != NULL, NULL);
@@ -1191,15 +1290,7 @@ gtk_recent_manager_lookup_item (GtkRecentManager  *manager,
       return NULL;
     }
 
-  info = gtk_recent_info_new (uri);
-  g_return_val_if_fail (info != NULL, NULL);
-
-  /* fill the RecentInfo structure with the data retrieved by our
-   * parser object from the storage file
-   */
-  build_recent_info (priv->recent_items, info);
-
-  return info;
+  return gtk_recent_info_ref (gtk_recent_manager_get_info (manager, uri));
 }
 
 /**
@@ -1265,6 +1356,10 @@ gtk_recent_manager_move_item (GtkRecentManager  *recent_manager,
       return FALSE;
     }
 
+  g_hash_table_remove (priv->infos, uri);
+  if (new_uri)
+    g_hash_table_remove (priv->infos, new_uri);
+
   priv->is_dirty = TRUE;
   gtk_recent_manager_changed (recent_manager);
 
@@ -1301,10 +1396,9 @@ gtk_recent_manager_get_items (GtkRecentManager *manager)
     {
       GtkRecentInfo *info;
 
-      info = gtk_recent_info_new (uris[i]);
-      build_recent_info (priv->recent_items, info);
+      info = gtk_recent_manager_get_info (manager, uris[i]);
 
-      retval = g_list_prepend (retval, info);
+      retval = g_list_prepend (retval, gtk_recent_info_ref (info));
     }
 
   g_strfreev (uris);
@@ -1324,6 +1418,7 @@ purge_recent_items_list (GtkRecentManager  *manager,
   g_bookmark_file_free (priv->recent_items);
   priv->recent_items = g_bookmark_file_new ();
   priv->size = 0;
+  g_hash_table_remove_all (priv->infos);
 
   /* emit the changed signal, to ensure that the purge is written */
   priv->is_dirty = TRUE;
@@ -1431,7 +1526,10 @@ gtk_recent_manager_clamp_to_age (GtkRecentManager *manager,
       modified = g_bookmark_file_get_modified (priv->recent_items, uri, NULL);
       item_age = (gint) ((now - modified) / (60 * 60 * 24));
       if (item_age > age)
-        g_bookmark_file_remove_item (priv->recent_items, uri, NULL);
+        {
+          g_hash_table_remove (priv->infos, uri);
+          g_bookmark_file_remove_item (priv->recent_items, uri, NULL);
+        }
     }
 
   g_strfreev (uris);
@@ -1459,6 +1557,7 @@ gtk_recent_manager_clamp_to_size (GtkRecentManager *manager,
   for (i = 0; i < n_uris - size; i++)
     {
       const gchar *uri = uris[i];
+      g_hash_table_remove (priv->infos, uri);
       g_bookmark_file_remove_item (priv->recent_items, uri, NULL);
     }
 
@@ -36,6 +36,8 @@
 #include "gtkcssrgbavalueprivate.h"
 #include "gtkcssstyleprivate.h"
 #include "gtkcsstypesprivate.h"
+#include "gtkrendernodecacheprivate.h"
+#include "gtksnapshotprivate.h"
 
 #include <math.h>
 
@@ -268,9 +270,9 @@ gtk_theming_background_snapshot_layer (GtkCssBoxes *bg,
   gtk_snapshot_pop (snapshot);
 }
 
-void
-gtk_css_style_snapshot_background (GtkCssBoxes *boxes,
-                                   GtkSnapshot *snapshot)
+static void
+snapshot_background (GtkCssBoxes *boxes,
+                     GtkSnapshot *snapshot)
 {
   gint idx;
   GtkCssValue *background_image;
@@ -284,18 +286,12 @@ gtk_css_style_snapshot_background (GtkCssBoxes *boxes,
   bg_color = _gtk_css_rgba_value_get_rgba (gtk_css_style_get_value (boxes->style, GTK_CSS_PROPERTY_BACKGROUND_COLOR));
   box_shadow = gtk_css_style_get_value (boxes->style, GTK_CSS_PROPERTY_BOX_SHADOW);
 
-  /* This is the common default case of no background */
-  if (gdk_rgba_is_clear (bg_color) &&
-      _gtk_css_array_value_get_n_values (background_image) == 1 &&
-      _gtk_css_image_value_get_image (_gtk_css_array_value_get_nth (background_image, 0)) == NULL &&
-      _gtk_css_shadows_value_is_none (box_shadow))
-    return;
-
   gtk_snapshot_push_debug (snapshot, "CSS background");
 
   gtk_css_shadows_value_snapshot_outset (box_shadow,
                                          snapshot,
-                                         gtk_css_boxes_get_border_box (boxes));
+                                         gtk_css_boxes_get_border_box (boxes),
+                                         boxes->scale);
 
   blend_modes = gtk_css_style_get_value (boxes->style, GTK_CSS_PROPERTY_BACKGROUND_BLEND_MODE);
   number_of_layers = _gtk_css_array_value_get_n_values (background_image);
@@ -333,3 +329,38 @@ gtk_css_style_snapshot_background (GtkCssBoxes *boxes,
   gtk_snapshot_pop (snapshot);
 }
 
+void
+gtk_css_style_snapshot_background (GtkCssBoxes *boxes,
+                                   GtkSnapshot *snapshot)
+{
+  static GtkRenderNodeCache cache;
+  GtkCssValue *background_image;
+  const GdkRGBA *bg_color;
+  GskRenderNode *node;
+
+  background_image = gtk_css_style_get_value (boxes->style, GTK_CSS_PROPERTY_BACKGROUND_IMAGE);
+  bg_color = _gtk_css_rgba_value_get_rgba (gtk_css_style_get_value (boxes->style, GTK_CSS_PROPERTY_BACKGROUND_COLOR));
+
+  /* This is the common default case of no background */
+  if (gdk_rgba_is_clear (bg_color) &&
+      _gtk_css_array_value_get_n_values (background_image) == 1 &&
+      _gtk_css_image_value_get_image (_gtk_css_array_value_get_nth (background_image, 0)) == NULL &&
+      _gtk_css_shadows_value_is_none (gtk_css_style_get_value (boxes->style, GTK_CSS_PROPERTY_BOX_SHADOW)))
+    return;
+
+  /* Same style, same size: same background */
+  if (!gtk_render_node_cache_lookup (&cache, boxes->style, gtk_css_boxes_get_border_rect (boxes), &node))
+    {
+      gtk_snapshot_push_collect (snapshot);
+      snapshot_background (boxes, snapshot);
+      node = gtk_snapshot_pop_collect (snapshot);
+
+      gtk_render_node_cache_insert (&cache, boxes->style, gtk_css_boxes_get_border_rect (boxes), node);
+      if (node)
+        gsk_render_node_unref (node);
+    }
+
+  if (node)
+    gtk_snapshot_append_node (snapshot, node);
+}
+
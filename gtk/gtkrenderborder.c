@@ -34,6 +34,7 @@
 #include "gtkcssrgbavalueprivate.h"
 #include "gtkcssstyleprivate.h"
 #include "gtkhslaprivate.h"
+#include "gtkrendernodecacheprivate.h"
 #include "gtkroundedboxprivate.h"
 #include "gtksnapshotprivate.h"
 
@@ -647,9 +648,9 @@ snapshot_border (GtkSnapshot          *snapshot,
   snapshot_frame_fill (snapshot, border_box, border_width, colors, hidden_side);
 }
 
-void
-gtk_css_style_snapshot_border (GtkCssBoxes *boxes,
-                               GtkSnapshot *snapshot)
+static void
+snapshot_css_border (GtkCssBoxes *boxes,
+                     GtkSnapshot *snapshot)
 {
   GtkBorderImage border_image;
   float border_width[4];
@@ -707,6 +708,35 @@ gtk_css_style_snapshot_border (GtkCssBoxes *boxes,
     }
 }
 
+void
+gtk_css_style_snapshot_border (GtkCssBoxes *boxes,
+                               GtkSnapshot *snapshot)
+{
+  static GtkRenderNodeCache cache;
+  GskRenderNode *node;
+
+  /* Don't fill the cache with the most common case of "This widget has no border" */
+  if (graphene_rect_equal (gtk_css_boxes_get_border_rect (boxes),
+                           gtk_css_boxes_get_padding_rect (boxes)) &&
+      _gtk_css_image_value_get_image (gtk_css_style_get_value (boxes->style, GTK_CSS_PROPERTY_BORDER_IMAGE_SOURCE)) == NULL)
+    return;
+
+  /* Same style, same size: same border */
+  if (!gtk_render_node_cache_lookup (&cache, boxes->style, gtk_css_boxes_get_border_rect (boxes), &node))
+    {
+      gtk_snapshot_push_collect (snapshot);
+      snapshot_css_border (boxes, snapshot);
+      node = gtk_snapshot_pop_collect (snapshot);
+
+      gtk_render_node_cache_insert (&cache, boxes->style, gtk_css_boxes_get_border_rect (boxes), node);
+      if (node)
+        gsk_render_node_unref (node);
+    }
+
+  if (node)
+    gtk_snapshot_append_node (snapshot, node);
+}
+
 void
 gtk_css_style_snapshot_outline (GtkCssBoxes *boxes,
                                 GtkSnapshot *snapshot)
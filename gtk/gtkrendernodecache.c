@@ -0,0 +1,129 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "gtkrendernodecacheprivate.h"
+
+#include "gtkmemorystatsprivate.h"
+
+#include <string.h>
+
+static void
+gtk_render_node_cache_entry_clear (GtkRenderNodeCacheEntry *entry)
+{
+  g_object_unref (entry->object);
+  g_clear_pointer (&entry->node, gsk_render_node_unref);
+}
+
+/* Drops the least recently used entry */
+static void
+gtk_render_node_cache_drop_last (GtkRenderNodeCache *cache)
+{
+  GtkRenderNodeCacheEntry *entry = &cache->entries[cache->n_entries - 1];
+
+  cache->cost -= entry->cost;
+  gtk_render_node_cache_entry_clear (entry);
+  cache->n_entries--;
+}
+
+/* Moves the entry at @index to the front */
+static void
+gtk_render_node_cache_promote (GtkRenderNodeCache *cache,
+                               guint               index)
+{
+  GtkRenderNodeCacheEntry entry;
+
+  if (index == 0)
+    return;
+
+  entry = cache->entries[index];
+  memmove (&cache->entries[1], &cache->entries[0], index * sizeof (GtkRenderNodeCacheEntry));
+  cache->entries[0] = entry;
+}
+
+/**
+ * gtk_render_node_cache_lookup:
+ * @cache: a #GtkRenderNodeCache
+ * @object: the object that is drawn
+ * @bounds: the box that @object is drawn into
+ * @node: (out) (transfer none) (nullable): return location for the node
+ *
+ * Looks up the node that was inserted for @object and @bounds.
+ *
+ * Returns: %TRUE if the node was found
+ **/
+gboolean
+gtk_render_node_cache_lookup (GtkRenderNodeCache     *cache,
+                              gpointer                object,
+                              const graphene_rect_t  *bounds,
+                              GskRenderNode         **node)
+{
+  guint i;
+
+  for (i = 0; i < cache->n_entries; i++)
+    {
+      GtkRenderNodeCacheEntry *entry = &cache->entries[i];
+
+      if (entry->object == object &&
+          graphene_rect_equal (&entry->bounds, bounds))
+        {
+          gtk_render_node_cache_promote (cache, i);
+          *node = cache->entries[0].node;
+          return TRUE;
+        }
+    }
+
+  return FALSE;
+}
+
+/**
+ * gtk_render_node_cache_insert:
+ * @cache: a #GtkRenderNodeCache
+ * @object: the object that was drawn
+ * @bounds: the box that @object was drawn into
+ * @node: (nullable): the resulting node
+ *
+ * Remembers @node for @object and @bounds, dropping the least
+ * recently used entries until it fits into the cache.
+ **/
+void
+gtk_render_node_cache_insert (GtkRenderNodeCache    *cache,
+                              gpointer               object,
+                              const graphene_rect_t *bounds,
+                              GskRenderNode         *node)
+{
+  GtkRenderNodeCacheEntry *entry;
+  gsize cost;
+
+  cost = gtk_memory_stats_estimate_render_node (node);
+
+  while (cache->n_entries > 0 &&
+         (cache->n_entries == GTK_RENDER_NODE_CACHE_SIZE ||
+          cache->cost + cost > GTK_RENDER_NODE_CACHE_MAX_COST))
+    gtk_render_node_cache_drop_last (cache);
+
+  cache->n_entries++;
+  gtk_render_node_cache_promote (cache, cache->n_entries - 1);
+
+  entry = &cache->entries[0];
+  entry->object = g_object_ref (object);
+  entry->bounds = *bounds;
+  entry->node = node ? gsk_render_node_ref (node) : NULL;
+  entry->cost = cost;
+  cache->cost += cost;
+}
@@ -0,0 +1,74 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GTK_RENDER_NODE_CACHE_PRIVATE_H__
+#define __GTK_RENDER_NODE_CACHE_PRIVATE_H__
+
+#include "gtkcsstypesprivate.h"
+
+G_BEGIN_DECLS
+
+/*
+ * GtkRenderNodeCache:
+ *
+ * A small most-recently-used cache of the render nodes that were created
+ * for drawing an object - like a style or an image - into a box of a given
+ * size, so that everything drawing the same object at the same size can
+ * share the node instead of building it again.
+ *
+ * The objects must be immutable, so that the pointer identifies what was
+ * drawn. Entries keep a reference to their object so that the pointer can
+ * not be reused for a different object while the entry exists.
+ *
+ * Besides the number of entries, the cache is bounded by the estimated
+ * memory the nodes keep alive, so that a few large textures don't stay
+ * around just because they were drawn recently.
+ */
+
+#define GTK_RENDER_NODE_CACHE_SIZE 16
+#define GTK_RENDER_NODE_CACHE_MAX_COST (4 * 1024 * 1024)
+
+typedef struct _GtkRenderNodeCache GtkRenderNodeCache;
+typedef struct _GtkRenderNodeCacheEntry GtkRenderNodeCacheEntry;
+
+struct _GtkRenderNodeCacheEntry
+{
+  gpointer object;
+  graphene_rect_t bounds;
+  GskRenderNode *node;  /* may be %NULL if nothing was drawn */
+  gsize cost;           /* estimated bytes, see gtk_memory_stats_estimate_render_node() */
+};
+
+struct _GtkRenderNodeCache
+{
+  guint n_entries;
+  gsize cost;           /* sum of the costs of all entries */
+  GtkRenderNodeCacheEntry entries[GTK_RENDER_NODE_CACHE_SIZE];
+};
+
+gboolean        gtk_render_node_cache_lookup            (GtkRenderNodeCache     *cache,
+                                                         gpointer                object,
+                                                         const graphene_rect_t  *bounds,
+                                                         GskRenderNode         **node);
+void            gtk_render_node_cache_insert            (GtkRenderNodeCache     *cache,
+                                                         gpointer                object,
+                                                         const graphene_rect_t  *bounds,
+                                                         GskRenderNode          *node);
+
+G_END_DECLS
+
+#endif /* __GTK_RENDER_NODE_CACHE_PRIVATE_H__ */
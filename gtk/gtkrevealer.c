@@ -359,16 +359,28 @@ gtk_revealer_real_size_allocate (GtkWidget *widget,
            * don't make sense. */
           return;
         }
+      /* While sliding, the child keeps the natural size it will have
+       * when revealed, not one derived from the rounded size of the
+       * revealer. So every frame only moves and clips it, without a
+       * new layout. */
       else if (hscale < 1.0)
         {
+          int min, nat;
+
           g_assert (vscale == 1.0);
-          child_allocation.width = MIN (G_MAXINT, ceil (width / hscale));
+          gtk_widget_measure (child, GTK_ORIENTATION_HORIZONTAL, height,
+                              &min, &nat, NULL, NULL);
+          child_allocation.width = MAX (nat, width);
           if (effective_transition (revealer) == GTK_REVEALER_TRANSITION_TYPE_SLIDE_RIGHT)
             child_allocation.x = width - child_allocation.width;
         }
       else if (vscale < 1.0)
         {
-          child_allocation.height = MIN (G_MAXINT, ceil (height / vscale));
+          int min, nat;
+
+          gtk_widget_measure (child, GTK_ORIENTATION_VERTICAL, width,
+                              &min, &nat, NULL, NULL);
+          child_allocation.height = MAX (nat, height);
           if (effective_transition (revealer) == GTK_REVEALER_TRANSITION_TYPE_SLIDE_DOWN)
             child_allocation.y = height - child_allocation.height;
         }
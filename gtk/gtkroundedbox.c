@@ -19,6 +19,7 @@
 
 #include "gtkroundedboxprivate.h"
 
+#include "gtkcssboxesprivate.h"
 #include "gtkcsscornervalueprivate.h"
 #include "gtkcssnumbervalueprivate.h"
 #include "gtkcsstypesprivate.h"
@@ -52,39 +53,6 @@ _gtk_rounded_box_init_rect (GskRoundedRect *box,
   box->bounds.size.height = height;
 }
 
-/* clamp border radius, following CSS specs */
-static void
-gtk_rounded_box_clamp_border_radius (GskRoundedRect *box)
-{
-  gdouble factor = 1.0;
-  gdouble corners;
-
-  corners = box->corner[GSK_CORNER_TOP_LEFT].width + box->corner[GSK_CORNER_TOP_RIGHT].width;
-  if (corners != 0)
-    factor = MIN (factor, box->bounds.size.width / corners);
-
-  corners = box->corner[GSK_CORNER_TOP_RIGHT].height + box->corner[GSK_CORNER_BOTTOM_RIGHT].height;
-  if (corners != 0)
-    factor = MIN (factor, box->bounds.size.height / corners);
-
-  corners = box->corner[GSK_CORNER_BOTTOM_RIGHT].width + box->corner[GSK_CORNER_BOTTOM_LEFT].width;
-  if (corners != 0)
-    factor = MIN (factor, box->bounds.size.width / corners);
-
-  corners = box->corner[GSK_CORNER_TOP_LEFT].height + box->corner[GSK_CORNER_BOTTOM_LEFT].height;
-  if (corners != 0)
-    factor = MIN (factor, box->bounds.size.height / corners);
-
-  box->corner[GSK_CORNER_TOP_LEFT].width *= factor;
-  box->corner[GSK_CORNER_TOP_LEFT].height *= factor;
-  box->corner[GSK_CORNER_TOP_RIGHT].width *= factor;
-  box->corner[GSK_CORNER_TOP_RIGHT].height *= factor;
-  box->corner[GSK_CORNER_BOTTOM_RIGHT].width *= factor;
-  box->corner[GSK_CORNER_BOTTOM_RIGHT].height *= factor;
-  box->corner[GSK_CORNER_BOTTOM_LEFT].width *= factor;
-  box->corner[GSK_CORNER_BOTTOM_LEFT].height *= factor;
-}
-
 static void
 _gtk_rounded_box_apply_border_radius (GskRoundedRect *box,
                                       const GtkCssValue * const corner[4])
@@ -109,7 +77,7 @@ _gtk_rounded_box_apply_border_radius (GskRoundedRect *box,
   box->corner[GSK_CORNER_BOTTOM_LEFT].height = _gtk_css_corner_value_get_y (corner[GSK_CORNER_BOTTOM_LEFT],
                                                                            box->bounds.size.height);
 
-  gtk_rounded_box_clamp_border_radius (box);
+  gtk_css_boxes_clamp_border_radius (box);
 }
 
 void
@@ -0,0 +1,397 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "gtkscaledtextureprivate.h"
+
+#include "gtkprivate.h"
+
+#include <math.h>
+#include <string.h>
+
+/*
+ * Scaled textures
+ *
+ * Drawing a large texture, like a photo, in a small area means the
+ * renderer has to sample the whole texture every frame. Instead,
+ * textures can be drawn from a smaller copy, like the levels of a
+ * mipmap: level n is the texture with its size halved n times.
+ *
+ * The levels are computed in a thread from the closest finer level
+ * that exists, and the widget that asked for them is redrawn when
+ * they are ready. Until then, the texture itself is drawn.
+ *
+ * All levels of all textures share a memory budget, the levels that
+ * were used last are kept.
+ */
+
+/* A texture needs to be 2^MAX_LEVELS times larger than where it is drawn
+ * to use the smallest level, no point in going further */
+#define MAX_LEVELS 12
+
+/* Memory that all the levels of all textures may use together */
+#define MAX_MEMORY (64 * 1024 * 1024)
+
+typedef struct _ScaledLevels ScaledLevels;
+typedef struct _ScaledEntry ScaledEntry;
+typedef struct _ScaleJob ScaleJob;
+
+struct _ScaledEntry
+{
+  ScaledLevels *levels;
+  guint level;
+
+  GdkTexture *texture;          /* NULL while it is computed */
+  gsize size;
+  GList link;                   /* in lru, once texture is set */
+
+  GSList *widgets;              /* GWeakRefs to the widgets to redraw */
+};
+
+struct _ScaledLevels
+{
+  ScaledEntry *entries[MAX_LEVELS + 1];
+};
+
+struct _ScaleJob
+{
+  ScaledEntry *entry;
+  GdkTexture *texture;          /* keeps the entry alive */
+
+  guchar *data;
+  int width;
+  int height;
+  guint n_halvings;
+};
+
+/* Finished entries, most recently used first */
+static GQueue lru = G_QUEUE_INIT;
+static gsize memory_used;
+
+static void
+scaled_entry_free (ScaledEntry *entry)
+{
+  GSList *l;
+
+  if (entry->texture)
+    {
+      g_queue_unlink (&lru, &entry->link);
+      memory_used -= entry->size;
+      g_object_unref (entry->texture);
+    }
+
+  for (l = entry->widgets; l; l = l->next)
+    {
+      g_weak_ref_clear (l->data);
+      g_free (l->data);
+    }
+  g_slist_free (entry->widgets);
+
+  entry->levels->entries[entry->level] = NULL;
+
+  g_slice_free (ScaledEntry, entry);
+}
+
+static void
+scaled_levels_free (gpointer data)
+{
+  ScaledLevels *levels = data;
+  guint i;
+
+  for (i = 1; i <= MAX_LEVELS; i++)
+    {
+      /* Running jobs hold a reference on the texture */
+      g_assert (levels->entries[i] == NULL || levels->entries[i]->texture != NULL);
+
+      if (levels->entries[i])
+        scaled_entry_free (levels->entries[i]);
+    }
+
+  g_slice_free (ScaledLevels, levels);
+}
+
+static guint
+get_level (int    width,
+           int    height,
+           double target_width,
+           double target_height)
+{
+  guint level;
+
+  if (target_width < 1 || target_height < 1)
+    return 0;
+
+  for (level = 0; level < MAX_LEVELS; level++)
+    {
+      if ((width >> (level + 1)) < target_width ||
+          (height >> (level + 1)) < target_height)
+        break;
+    }
+
+  return level;
+}
+
+/* Averages every 2x2 block of premultiplied pixels into one, in place */
+static void
+halve_pixels (guchar *data,
+              int     width,
+              int     height,
+              gsize   stride)
+{
+  int x, y, c;
+
+  for (y = 0; y < height / 2; y++)
+    {
+      const guchar *row1 = data + 2 * y * stride;
+      const guchar *row2 = row1 + stride;
+      guchar *out = data + y * stride;
+
+      for (x = 0; x < width / 2; x++)
+        {
+          for (c = 0; c < 4; c++)
+            out[4 * x + c] = (row1[8 * x + c] + row1[8 * x + 4 + c] +
+                              row2[8 * x + c] + row2[8 * x + 4 + c] + 2) / 4;
+        }
+    }
+}
+
+static void
+scale_thread (GTask        *task,
+              gpointer      source_object,
+              gpointer      task_data,
+              GCancellable *cancellable)
+{
+  ScaleJob *job = task_data;
+  gsize stride = (gsize) job->width * 4;
+  int width, height, y;
+  guint i;
+  guchar *result;
+
+  width = job->width;
+  height = job->height;
+  for (i = 0; i < job->n_halvings; i++)
+    {
+      halve_pixels (job->data, width, height, stride);
+      width /= 2;
+      height /= 2;
+    }
+
+  result = g_malloc ((gsize) width * height * 4);
+  for (y = 0; y < height; y++)
+    memcpy (result + (gsize) y * width * 4, job->data + y * stride, width * 4);
+
+  g_clear_pointer (&job->data, g_free);
+  job->width = width;
+  job->height = height;
+
+  g_task_return_pointer (task,
+                         g_bytes_new_take (result, (gsize) width * height * 4),
+                         (GDestroyNotify) g_bytes_unref);
+}
+
+static void
+scale_job_free (gpointer data)
+{
+  ScaleJob *job = data;
+
+  g_free (job->data);
+  g_object_unref (job->texture);
+
+  g_slice_free (ScaleJob, job);
+}
+
+static void
+scale_done (GObject      *source_object,
+            GAsyncResult *result,
+            gpointer      data)
+{
+  ScaleJob *job = g_task_get_task_data (G_TASK (result));
+  ScaledEntry *entry = job->entry;
+  GSList *l;
+  GBytes *bytes;
+
+  bytes = g_task_propagate_pointer (G_TASK (result), NULL);
+
+  entry->texture = gdk_memory_texture_new (job->width, job->height,
+                                           GDK_MEMORY_DEFAULT,
+                                           bytes,
+                                           job->width * 4);
+  entry->size = g_bytes_get_size (bytes);
+  g_bytes_unref (bytes);
+
+  g_queue_push_head_link (&lru, &entry->link);
+  memory_used += entry->size;
+
+  while (memory_used > MAX_MEMORY && lru.tail != &entry->link)
+    scaled_entry_free (lru.tail->data);
+
+  for (l = entry->widgets; l; l = l->next)
+    {
+      GtkWidget *widget = g_weak_ref_get (l->data);
+
+      if (widget)
+        {
+          gtk_widget_queue_draw (widget);
+          g_object_unref (widget);
+        }
+
+      g_weak_ref_clear (l->data);
+      g_free (l->data);
+    }
+  g_clear_pointer (&entry->widgets, g_slist_free);
+}
+
+static ScaledEntry *
+scaled_entry_new (GdkTexture   *texture,
+                  ScaledLevels *levels,
+                  guint         level)
+{
+  ScaledEntry *entry;
+  GdkTexture *source;
+  ScaleJob *job;
+  GTask *task;
+  guint source_level;
+
+  entry = g_slice_new0 (ScaledEntry);
+  entry->levels = levels;
+  entry->level = level;
+  entry->link.data = entry;
+  levels->entries[level] = entry;
+
+  /* Start from the closest level we have */
+  for (source_level = level - 1; source_level > 0; source_level--)
+    {
+      if (levels->entries[source_level] && levels->entries[source_level]->texture)
+        break;
+    }
+  if (source_level > 0)
+    source = levels->entries[source_level]->texture;
+  else
+    source = texture;
+
+  job = g_slice_new0 (ScaleJob);
+  job->entry = entry;
+  job->texture = g_object_ref (texture);
+  job->width = gdk_texture_get_width (source);
+  job->height = gdk_texture_get_height (source);
+  job->n_halvings = level - source_level;
+
+  /* Downloading has to happen here, textures are not thread-safe */
+  job->data = g_malloc ((gsize) job->width * job->height * 4);
+  gdk_texture_download (source, job->data, job->width * 4);
+
+  task = g_task_new (NULL, NULL, scale_done, NULL);
+  g_task_set_source_tag (task, scaled_entry_new);
+  g_task_set_task_data (task, job, scale_job_free);
+  g_task_run_in_thread (task, scale_thread);
+  g_object_unref (task);
+
+  return entry;
+}
+
+static void
+scaled_entry_add_widget (ScaledEntry *entry,
+                         GtkWidget   *widget)
+{
+  GWeakRef *ref;
+  GSList *l;
+
+  for (l = entry->widgets; l; l = l->next)
+    {
+      GtkWidget *other = g_weak_ref_get (l->data);
+
+      if (other)
+        g_object_unref (other);
+
+      if (other == widget)
+        return;
+    }
+
+  ref = g_new (GWeakRef, 1);
+  g_weak_ref_init (ref, widget);
+  entry->widgets = g_slist_prepend (entry->widgets, ref);
+}
+
+/*
+ * gtk_scaled_texture_lookup:
+ * @paintable: the paintable to draw
+ * @width: the width it is drawn at
+ * @height: the height it is drawn at
+ * @widget: the widget drawing it
+ *
+ * Finds a smaller version of @paintable to draw at the given size,
+ * if @paintable is a texture that is much larger than that.
+ * If the smaller version is not ready yet, @widget is redrawn once
+ * it is.
+ *
+ * Returns: (transfer none): the paintable to draw instead of @paintable
+ */
+GdkPaintable *
+gtk_scaled_texture_lookup (GdkPaintable *paintable,
+                           double        width,
+                           double        height,
+                           GtkWidget    *widget)
+{
+  ScaledLevels *levels;
+  ScaledEntry *entry;
+  GdkTexture *texture;
+  int scale;
+  guint level, i;
+
+  if (!GDK_IS_TEXTURE (paintable))
+    return paintable;
+
+  texture = GDK_TEXTURE (paintable);
+  scale = gtk_widget_get_scale_factor (widget);
+  level = get_level (gdk_texture_get_width (texture),
+                     gdk_texture_get_height (texture),
+                     ceil (width * scale),
+                     ceil (height * scale));
+  if (level == 0)
+    return paintable;
+
+  levels = g_object_get_data (G_OBJECT (texture), "gtk-scaled-texture-levels");
+  if (levels == NULL)
+    {
+      levels = g_slice_new0 (ScaledLevels);
+      g_object_set_data_full (G_OBJECT (texture), "gtk-scaled-texture-levels",
+                              levels, scaled_levels_free);
+    }
+
+  entry = levels->entries[level];
+  if (entry && entry->texture)
+    {
+      g_queue_unlink (&lru, &entry->link);
+      g_queue_push_head_link (&lru, &entry->link);
+
+      return GDK_PAINTABLE (entry->texture);
+    }
+
+  if (entry == NULL)
+    entry = scaled_entry_new (texture, levels, level);
+  scaled_entry_add_widget (entry, widget);
+
+  /* Until then, a finer level is still better than the texture */
+  for (i = level - 1; i > 0; i--)
+    {
+      if (levels->entries[i] && levels->entries[i]->texture)
+        return GDK_PAINTABLE (levels->entries[i]->texture);
+    }
+
+  return paintable;
+}
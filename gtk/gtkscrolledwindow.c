@@ -1395,10 +1395,14 @@ gtk_scrolled_window_size_allocate (GtkWidget *widget,
   GtkBin *bin;
   GtkAllocation child_allocation;
   GtkWidget *child;
+  GtkAdjustment *hadjustment;
+  GtkAdjustment *vadjustment;
   gint sb_width;
   gint sb_height;
 
   bin = GTK_BIN (scrolled_window);
+  hadjustment = gtk_scrollbar_get_adjustment (GTK_SCROLLBAR (priv->hscrollbar));
+  vadjustment = gtk_scrollbar_get_adjustment (GTK_SCROLLBAR (priv->vscrollbar));
 
   /* Get possible scrollbar dimensions */
   gtk_widget_measure (priv->vscrollbar, GTK_ORIENTATION_HORIZONTAL, -1,
@@ -1418,6 +1422,13 @@ gtk_scrolled_window_size_allocate (GtkWidget *widget,
            priv->vscrollbar_policy == GTK_POLICY_EXTERNAL)
     priv->vscrollbar_visible = FALSE;
 
+  /* The child may configure its adjustments several times while we
+   * find out which scrollbars it needs; only let the scrollbars and
+   * everyone else see the final configuration.
+   */
+  gtk_adjustment_begin_batch (hadjustment);
+  gtk_adjustment_begin_batch (vadjustment);
+
   child = gtk_bin_get_child (bin);
   if (child && gtk_widget_get_visible (child))
     {
@@ -1606,6 +1617,9 @@ gtk_scrolled_window_size_allocate (GtkWidget *widget,
       priv->vscrollbar_visible = priv->vscrollbar_policy == GTK_POLICY_ALWAYS;
     }
 
+  gtk_adjustment_end_batch (hadjustment);
+  gtk_adjustment_end_batch (vadjustment);
+
   gtk_widget_set_child_visible (priv->hscrollbar, priv->hscrollbar_visible);
   if (priv->hscrollbar_visible)
     {
@@ -2757,6 +2771,23 @@ gtk_scrolled_window_inner_allocation (GtkScrolledWindow *scrolled_window,
     }
 }
 
+static void
+gtk_scrolled_window_snapshot_indicator (GtkScrolledWindow *scrolled_window,
+                                        Indicator         *indicator,
+                                        GtkSnapshot       *snapshot)
+{
+  if (indicator->current_pos <= 0.0)
+    return;
+
+  if (indicator->current_pos < 1.0)
+    gtk_snapshot_push_opacity (snapshot, indicator->current_pos);
+
+  gtk_widget_snapshot_child (GTK_WIDGET (scrolled_window), indicator->scrollbar, snapshot);
+
+  if (indicator->current_pos < 1.0)
+    gtk_snapshot_pop (snapshot);
+}
+
 static void
 gtk_scrolled_window_snapshot (GtkWidget   *widget,
                               GtkSnapshot *snapshot)
@@ -2764,11 +2795,23 @@ gtk_scrolled_window_snapshot (GtkWidget   *widget,
   GtkScrolledWindow *scrolled_window = GTK_SCROLLED_WINDOW (widget);
   GtkScrolledWindowPrivate *priv = gtk_scrolled_window_get_instance_private (scrolled_window);
 
+  GtkWidget *child;
+
   if (priv->hscrollbar_visible &&
       priv->vscrollbar_visible)
     gtk_scrolled_window_snapshot_scrollbars_junction (scrolled_window, snapshot);
 
-  GTK_WIDGET_CLASS (gtk_scrolled_window_parent_class)->snapshot (widget, snapshot);
+  for (child = gtk_widget_get_first_child (widget);
+       child != NULL;
+       child = gtk_widget_get_next_sibling (child))
+    {
+      if (child == priv->hindicator.scrollbar)
+        gtk_scrolled_window_snapshot_indicator (scrolled_window, &priv->hindicator, snapshot);
+      else if (child == priv->vindicator.scrollbar)
+        gtk_scrolled_window_snapshot_indicator (scrolled_window, &priv->vindicator, snapshot);
+      else
+        gtk_widget_snapshot_child (widget, child, snapshot);
+    }
 
   gtk_scrolled_window_snapshot_undershoot (scrolled_window, snapshot);
   gtk_scrolled_window_snapshot_overshoot (scrolled_window, snapshot);
@@ -3198,6 +3241,28 @@ _gtk_scrolled_window_set_adjustment_value (GtkScrolledWindow *scrolled_window,
   g_signal_emit (scrolled_window, signals[EDGE_OVERSHOT], 0, edge_pos);
 }
 
+/* The time the frame being drawn is expected to be shown at. Computing
+ * positions for it instead of for the start of the frame keeps the
+ * deceleration curve aligned with what the user sees, even when frames
+ * take a different time to present.
+ */
+static gint64
+get_frame_presentation_time (GdkFrameClock *frame_clock)
+{
+  gint64 frame_time;
+  gint64 refresh_interval;
+  gint64 presentation_time;
+
+  frame_time = gdk_frame_clock_get_frame_time (frame_clock);
+  gdk_frame_clock_get_refresh_info (frame_clock, frame_time,
+                                    &refresh_interval, &presentation_time);
+
+  if (presentation_time < frame_time)
+    return frame_time;
+
+  return presentation_time;
+}
+
 static gboolean
 scrolled_window_deceleration_cb (GtkWidget         *widget,
                                  GdkFrameClock     *frame_clock,
@@ -3210,9 +3275,9 @@ scrolled_window_deceleration_cb (GtkWidget         *widget,
   gint64 current_time;
   gdouble position, elapsed;
 
-  current_time = gdk_frame_clock_get_frame_time (frame_clock);
-  elapsed = (current_time - data->last_deceleration_time) / 1000000.0;
-  data->last_deceleration_time = current_time;
+  current_time = get_frame_presentation_time (frame_clock);
+  elapsed = MAX (current_time - data->last_deceleration_time, 0) / 1000000.0;
+  data->last_deceleration_time = MAX (current_time, data->last_deceleration_time);
 
   hadjustment = gtk_scrollbar_get_adjustment (GTK_SCROLLBAR (priv->hscrollbar));
   vadjustment = gtk_scrollbar_get_adjustment (GTK_SCROLLBAR (priv->vscrollbar));
@@ -3276,16 +3341,17 @@ static void
 gtk_scrolled_window_start_deceleration (GtkScrolledWindow *scrolled_window)
 {
   GtkScrolledWindowPrivate *priv = gtk_scrolled_window_get_instance_private (scrolled_window);
-  GdkFrameClock *frame_clock;
   KineticScrollData *data;
 
   g_return_if_fail (priv->deceleration_id == 0);
 
-  frame_clock = gtk_widget_get_frame_clock (GTK_WIDGET (scrolled_window));
-
   data = g_new0 (KineticScrollData, 1);
   data->scrolled_window = scrolled_window;
-  data->last_deceleration_time = gdk_frame_clock_get_frame_time (frame_clock);
+  /* The swipe ended now. The first tick moves the curve ahead to the
+   * presentation of its frame, so the content does not lag behind the
+   * finger by the frame latency.
+   */
+  data->last_deceleration_time = g_get_monotonic_time ();
 
   if (may_hscroll (scrolled_window))
     {
@@ -3648,10 +3714,12 @@ indicator_set_fade (Indicator *indicator,
       indicator->conceil_timer = 0;
     }
 
+  /* The scrolled window applies the fade when it snapshots the
+   * scrollbar, so that the scrollbar keeps its render node and the
+   * child is not touched.
+   */
   if (changed)
-    {
-      gtk_widget_set_opacity (indicator->scrollbar, indicator->current_pos);
-    }
+    gtk_widget_queue_draw (gtk_widget_get_parent (indicator->scrollbar));
 }
 
 static gboolean
@@ -3741,8 +3809,8 @@ setup_indicator (GtkScrolledWindow *scrolled_window,
   g_signal_connect (adjustment, "value-changed",
                     G_CALLBACK (indicator_value_changed), indicator);
 
-  gtk_widget_set_opacity (scrollbar, 0.0);
   indicator->current_pos = 0.0;
+  gtk_widget_queue_draw (GTK_WIDGET (scrolled_window));
 }
 
 static void
@@ -3783,8 +3851,8 @@ remove_indicator (GtkScrolledWindow *scrolled_window,
       indicator->tick_id = 0;
     }
 
-  gtk_widget_set_opacity (scrollbar, 1.0);
   indicator->current_pos = 1.0;
+  gtk_widget_queue_draw (GTK_WIDGET (scrolled_window));
 }
 
 static void
@@ -26,27 +26,73 @@
 #include <gdk/gdk.h>
 
 #include "gtksearchenginesimple.h"
+#include "gtkfilenameindexprivate.h"
 #include "gtkfilesystem.h"
 #include "gtkprivate.h"
 
 #include <string.h>
 
-#define BATCH_SIZE 500
+/* Hits are sent at growing intervals, so the first ones show up
+ * right away and later ones don't flood the main loop. */
+#define BATCH_INTERVAL_MIN (20 * G_TIME_SPAN_MILLISECOND)
+#define BATCH_INTERVAL_MAX (500 * G_TIME_SPAN_MILLISECOND)
+
+/* Directories found while this many are waiting are kept by the
+ * worker that found them, until other workers run out of work. */
+#define MAX_QUEUED_DIRECTORIES 256
+
+#define MAX_WORKERS 4
+
+/* Files from the file name index are checked before crawling */
+#define MAX_INDEXED_FILES 1000
+
+#define SEARCH_ATTRIBUTES \
+  G_FILE_ATTRIBUTE_STANDARD_NAME "," \
+  G_FILE_ATTRIBUTE_STANDARD_DISPLAY_NAME "," \
+  G_FILE_ATTRIBUTE_STANDARD_TYPE "," \
+  G_FILE_ATTRIBUTE_STANDARD_IS_HIDDEN "," \
+  G_FILE_ATTRIBUTE_STANDARD_IS_BACKUP "," \
+  G_FILE_ATTRIBUTE_STANDARD_SIZE "," \
+  G_FILE_ATTRIBUTE_STANDARD_CONTENT_TYPE "," \
+  G_FILE_ATTRIBUTE_STANDARD_TARGET_URI "," \
+  G_FILE_ATTRIBUTE_TIME_MODIFIED "," \
+  G_FILE_ATTRIBUTE_TIME_ACCESS "," \
+  G_FILE_ATTRIBUTE_ACCESS_CAN_RENAME "," \
+  G_FILE_ATTRIBUTE_ACCESS_CAN_TRASH "," \
+  G_FILE_ATTRIBUTE_ACCESS_CAN_DELETE
 
 typedef struct
 {
   GtkSearchEngineSimple *engine;
   GCancellable *cancellable;
+  gulong cancelled_id;
 
-  GQueue *directories;
+  GMutex lock;
+  GCond cond;
 
-  gint n_processed_files;
-  GList *hits;
+  /* Protected by lock */
+  GQueue *directories;
+  guint n_workers;
+  guint n_idle;
+  guint n_running;
+  gboolean done;
+  GList *indexed_files;
 
   GtkQuery *query;
   gboolean recursive;
 } SearchThreadData;
 
+typedef struct
+{
+  SearchThreadData *data;
+
+  /* Directories that didn't fit in data->directories */
+  GQueue directories;
+
+  GList *hits;
+  gint64 last_batch_time;
+  gint64 batch_interval;
+} SearchWorker;
 
 struct _GtkSearchEngineSimple
 {
@@ -88,14 +134,24 @@ gtk_search_engine_simple_dispose (GObject *object)
   G_OBJECT_CLASS (_gtk_search_engine_simple_parent_class)->dispose (object);
 }
 
+static gboolean
+is_local (GFile *file)
+{
+  return file &&
+         !_gtk_file_consider_as_remote (file) &&
+         !g_file_has_uri_scheme (file, "recent");
+}
+
 static void
-queue_if_local (SearchThreadData *data,
-                GFile            *file)
+search_thread_cancelled (GCancellable *cancellable,
+                         gpointer      user_data)
 {
-  if (file &&
-      !_gtk_file_consider_as_remote (file) &&
-      !g_file_has_uri_scheme (file, "recent"))
-    g_queue_push_tail (data->directories, g_object_ref (file));
+  SearchThreadData *data = user_data;
+
+  /* Wake up the workers waiting for a directory */
+  g_mutex_lock (&data->lock);
+  g_cond_broadcast (&data->cond);
+  g_mutex_unlock (&data->lock);
 }
 
 static SearchThreadData *
@@ -103,6 +159,7 @@ search_thread_data_new (GtkSearchEngineSimple *engine,
 			GtkQuery              *query)
 {
   SearchThreadData *data;
+  GFile *location;
 
   data = g_new0 (SearchThreadData, 1);
 
@@ -110,9 +167,35 @@ search_thread_data_new (GtkSearchEngineSimple *engine,
   data->directories = g_queue_new ();
   data->query = g_object_ref (query);
   data->recursive = _gtk_search_engine_get_recursive (GTK_SEARCH_ENGINE (engine));
-  queue_if_local (data, gtk_query_get_location (query));
+  g_mutex_init (&data->lock);
+  g_cond_init (&data->cond);
+
+  location = gtk_query_get_location (query);
+  if (is_local (location))
+    {
+      g_queue_push_tail (data->directories, g_object_ref (location));
+
+      /* With a search service, the other engines find indexed files */
+      if (engine->is_indexed_callback == NULL)
+        {
+          GtkFileNameIndex *index = gtk_file_name_index_get_default ();
+
+          if (index)
+            data->indexed_files = gtk_file_name_index_lookup (index, query, data->recursive,
+                                                              MAX_INDEXED_FILES);
+        }
+    }
+
+  /* Only a recursive search has more than one directory to visit */
+  if (data->recursive)
+    data->n_workers = CLAMP (g_get_num_processors (), 1, MAX_WORKERS);
+  else
+    data->n_workers = 1;
 
   data->cancellable = g_cancellable_new ();
+  data->cancelled_id = g_cancellable_connect (data->cancellable,
+                                              G_CALLBACK (search_thread_cancelled),
+                                              data, NULL);
 
   return data;
 }
@@ -120,8 +203,11 @@ search_thread_data_new (GtkSearchEngineSimple *engine,
 static void
 search_thread_data_free (SearchThreadData *data)
 {
-  g_queue_foreach (data->directories, (GFunc)g_object_unref, NULL);
-  g_queue_free (data->directories);
+  g_cancellable_disconnect (data->cancellable, data->cancelled_id);
+  g_queue_free_full (data->directories, g_object_unref);
+  g_list_free_full (data->indexed_files, g_object_unref);
+  g_mutex_clear (&data->lock);
+  g_cond_clear (&data->cond);
   g_object_unref (data->cancellable);
   g_object_unref (data->query);
   g_object_unref (data->engine);
@@ -166,25 +252,35 @@ search_thread_add_hits_idle (gpointer user_data)
 }
 
 static void
-send_batch (SearchThreadData *data)
+send_batch (SearchWorker *worker)
 {
   Batch *batch;
 
-  data->n_processed_files = 0;
+  worker->last_batch_time = g_get_monotonic_time ();
 
-  if (data->hits)
+  if (worker->hits)
     {
       guint id;
 
       batch = g_new (Batch, 1);
-      batch->hits = data->hits;
-      batch->thread_data = data;
+      batch->hits = worker->hits;
+      batch->thread_data = worker->data;
 
       id = g_idle_add (search_thread_add_hits_idle, batch);
       g_source_set_name_by_id (id, "[gtk] search_thread_add_hits_idle");
+
+      worker->batch_interval = MIN (worker->batch_interval * 2, BATCH_INTERVAL_MAX);
     }
 
-  data->hits = NULL;
+  worker->hits = NULL;
+}
+
+static void
+maybe_send_batch (SearchWorker *worker)
+{
+  if (worker->hits &&
+      g_get_monotonic_time () - worker->last_batch_time >= worker->batch_interval)
+    send_batch (worker);
 }
 
 static gboolean
@@ -207,27 +303,91 @@ is_indexed (GtkSearchEngineSimple *engine,
 }
 
 static void
-visit_directory (GFile *dir, SearchThreadData *data)
+queue_directory (SearchWorker *worker,
+                 GFile        *dir)
 {
+  SearchThreadData *data = worker->data;
+
+  g_mutex_lock (&data->lock);
+
+  /* The callback is not expected to be called from several threads */
+  if (!is_indexed (data->engine, dir))
+    {
+      if (data->directories->length < MAX_QUEUED_DIRECTORIES)
+        {
+          g_queue_push_tail (data->directories, g_object_ref (dir));
+          if (data->n_idle > 0)
+            g_cond_signal (&data->cond);
+        }
+      else
+        g_queue_push_tail (&worker->directories, g_object_ref (dir));
+    }
+
+  g_mutex_unlock (&data->lock);
+}
+
+/* Returns the next directory for @worker to visit, or %NULL once
+ * all workers ran out of directories or the search got cancelled.
+ */
+static GFile *
+next_directory (SearchWorker *worker)
+{
+  SearchThreadData *data = worker->data;
+  GFile *dir = NULL;
+
+  g_mutex_lock (&data->lock);
+
+  while (!data->done && !g_cancellable_is_cancelled (data->cancellable))
+    {
+      if (worker->directories.length > 0)
+        {
+          /* Hand over half of our directories to idle workers */
+          if (data->n_idle > 0 && data->directories->length == 0)
+            {
+              guint n = worker->directories.length / 2;
+
+              while (n-- > 0)
+                g_queue_push_tail (data->directories, g_queue_pop_tail (&worker->directories));
+              g_cond_broadcast (&data->cond);
+            }
+
+          dir = g_queue_pop_head (&worker->directories);
+          break;
+        }
+
+      dir = g_queue_pop_head (data->directories);
+      if (dir)
+        break;
+
+      /* Everybody else is waiting too, so there is nothing left */
+      if (data->n_idle + 1 == data->n_workers)
+        {
+          data->done = TRUE;
+          g_cond_broadcast (&data->cond);
+          break;
+        }
+
+      data->n_idle++;
+      g_cond_wait (&data->cond, &data->lock);
+      data->n_idle--;
+    }
+
+  g_mutex_unlock (&data->lock);
+
+  return dir;
+}
+
+static void
+visit_directory (GFile *dir, SearchWorker *worker)
+{
+  SearchThreadData *data = worker->data;
   GFileEnumerator *enumerator;
   GFileInfo *info;
   GFile *child;
   const gchar *display_name;
 
   enumerator = g_file_enumerate_children (dir,
-                                          G_FILE_ATTRIBUTE_STANDARD_NAME ","
-                                          G_FILE_ATTRIBUTE_STANDARD_DISPLAY_NAME ","
-                                          G_FILE_ATTRIBUTE_STANDARD_TYPE ","
-                                          G_FILE_ATTRIBUTE_STANDARD_IS_HIDDEN ","
-                                          G_FILE_ATTRIBUTE_STANDARD_IS_BACKUP ","
-                                          G_FILE_ATTRIBUTE_STANDARD_SIZE ","
-                                          G_FILE_ATTRIBUTE_STANDARD_CONTENT_TYPE ","
-                                          G_FILE_ATTRIBUTE_STANDARD_TARGET_URI ","
-                                          G_FILE_ATTRIBUTE_TIME_MODIFIED ","
-                                          G_FILE_ATTRIBUTE_TIME_ACCESS ","
-                                          G_FILE_ATTRIBUTE_ACCESS_CAN_RENAME ","
-                                          G_FILE_ATTRIBUTE_ACCESS_CAN_TRASH ","
-                                          G_FILE_ATTRIBUTE_ACCESS_CAN_DELETE,
+                                          SEARCH_ATTRIBUTES,
                                           G_FILE_QUERY_INFO_NOFOLLOW_SYMLINKS,
                                           data->cancellable, NULL);
   if (enumerator == NULL)
@@ -252,43 +412,116 @@ visit_directory (GFile *dir, SearchThreadData *data)
           hit = g_new (GtkSearchHit, 1);
           hit->file = g_object_ref (child);
           hit->info = g_object_ref (info);
-          data->hits = g_list_prepend (data->hits, hit);
+          worker->hits = g_list_prepend (worker->hits, hit);
+          maybe_send_batch (worker);
         }
 
-      data->n_processed_files++;
-      if (data->n_processed_files > BATCH_SIZE)
-        send_batch (data);
-
       if (data->recursive &&
           g_file_info_get_file_type (info) == G_FILE_TYPE_DIRECTORY &&
-          !is_indexed (data->engine, child))
-        queue_if_local (data, child);
+          is_local (child))
+        queue_directory (worker, child);
     }
 
   g_object_unref (enumerator);
+
+  maybe_send_batch (worker);
+}
+
+/* The index may be out of date, so its files are only hits if
+ * they still exist and match. The crawl reports them again, the
+ * composite engine drops the duplicates. */
+static void
+visit_indexed_files (GList        *files,
+                     SearchWorker *worker)
+{
+  SearchThreadData *data = worker->data;
+  GList *l;
+
+  for (l = files; l; l = l->next)
+    {
+      GFile *file = l->data;
+      GFileInfo *info;
+      const char *display_name;
+
+      if (g_cancellable_is_cancelled (data->cancellable))
+        break;
+
+      info = g_file_query_info (file,
+                                SEARCH_ATTRIBUTES,
+                                G_FILE_QUERY_INFO_NOFOLLOW_SYMLINKS,
+                                data->cancellable, NULL);
+      if (info == NULL)
+        continue;
+
+      display_name = g_file_info_get_display_name (info);
+      if (display_name != NULL &&
+          !g_file_info_get_is_hidden (info) &&
+          gtk_query_matches_string (data->query, display_name))
+        {
+          GtkSearchHit *hit;
+
+          hit = g_new (GtkSearchHit, 1);
+          hit->file = g_object_ref (file);
+          hit->info = info;
+          worker->hits = g_list_prepend (worker->hits, hit);
+        }
+      else
+        g_object_unref (info);
+    }
+
+  if (!g_cancellable_is_cancelled (data->cancellable))
+    send_batch (worker);
 }
 
 static gpointer
 search_thread_func (gpointer user_data)
 {
-  SearchThreadData *data;
+  SearchWorker *worker = user_data;
+  SearchThreadData *data = worker->data;
+  gboolean last;
+  GList *files;
   GFile *dir;
   guint id;
 
-  data = user_data;
+  worker->last_batch_time = g_get_monotonic_time ();
+  worker->batch_interval = BATCH_INTERVAL_MIN;
+
+  /* The first worker to start checks the indexed files */
+  g_mutex_lock (&data->lock);
+  files = data->indexed_files;
+  data->indexed_files = NULL;
+  g_mutex_unlock (&data->lock);
 
-  while (!g_cancellable_is_cancelled (data->cancellable) &&
-         (dir = g_queue_pop_head (data->directories)) != NULL)
+  if (files)
     {
-      visit_directory (dir, data);
+      visit_indexed_files (files, worker);
+      g_list_free_full (files, g_object_unref);
+    }
+
+  while ((dir = next_directory (worker)) != NULL)
+    {
+      visit_directory (dir, worker);
       g_object_unref (dir);
     }
 
   if (!g_cancellable_is_cancelled (data->cancellable))
-    send_batch (data);
+    send_batch (worker);
+  else
+    g_list_free_full (worker->hits, (GDestroyNotify)_gtk_search_hit_free);
 
-  id = g_idle_add (search_thread_done_idle, data);
-  g_source_set_name_by_id (id, "[gtk] search_thread_done_idle");
+  g_queue_clear_full (&worker->directories, g_object_unref);
+  g_free (worker);
+
+  g_mutex_lock (&data->lock);
+  last = --data->n_running == 0;
+  g_mutex_unlock (&data->lock);
+
+  /* The idle runs after all the batches sent by the workers */
+  if (last)
+    {
+      id = g_idle_add (search_thread_done_idle, data);
+      g_source_set_name_by_id (id, "[gtk] search_thread_done_idle");
+    }
 
   return NULL;
 }
@@ -298,6 +531,7 @@ gtk_search_engine_simple_start (GtkSearchEngine *engine)
 {
   GtkSearchEngineSimple *simple;
   SearchThreadData *data;
+  guint i;
 
   simple = GTK_SEARCH_ENGINE_SIMPLE (engine);
 
@@ -308,8 +542,18 @@ gtk_search_engine_simple_start (GtkSearchEngine *engine)
     return;
 
   data = search_thread_data_new (simple, simple->query);
+  data->n_running = data->n_workers;
+
+  for (i = 0; i < data->n_workers; i++)
+    {
+      SearchWorker *worker;
 
-  g_thread_unref (g_thread_new ("file-search", search_thread_func, data));
+      worker = g_new0 (SearchWorker, 1);
+      worker->data = data;
+      g_queue_init (&worker->directories);
+
+      g_thread_unref (g_thread_new ("file-search", search_thread_func, worker));
+    }
 
   simple->active_search = data;
 }
@@ -23,8 +23,10 @@
 #include "gtksettings.h"
 
 #include "gtksettingsprivate.h"
+#include "gtkstartuptraceprivate.h"
 #include "gtkintl.h"
-#include "gtkwidget.h"
+#include "gtkwidgetprivate.h"
+#include "gtkwindow.h"
 #include "gtkprivate.h"
 #include "gtkcssproviderprivate.h"
 #include "gtkhslaprivate.h"
@@ -124,6 +126,7 @@ struct _GtkSettingsPrivate
   gboolean font_size_absolute;
   gchar *font_family;
   cairo_font_options_t *font_options;
+  GtkSettingsValues values;
 };
 
 struct _GtkSettingsValuePrivate
@@ -217,6 +220,7 @@ static gboolean settings_update_xsetting         (GtkSettings           *setting
                                                   GParamSpec            *pspec,
                                                   gboolean               force);
 static void    settings_update_xsettings         (GtkSettings           *settings);
+static void    settings_update_values            (GtkSettings           *settings);
 
 static void gtk_settings_load_from_key_file      (GtkSettings           *settings,
                                                   const gchar           *path,
@@ -1149,6 +1153,7 @@ gtk_settings_create_for_display (GdkDisplay *display)
 
   settings_init_style (settings);
   settings_update_xsettings (settings);
+  settings_update_values (settings);
   settings_update_double_click (settings);
   settings_update_cursor_theme (settings);
   settings_update_font_options (settings);
@@ -1168,6 +1173,8 @@ gtk_settings_create_for_display (GdkDisplay *display)
 GtkSettings *
 gtk_settings_get_for_display (GdkDisplay *display)
 {
+  GtkSettings *settings;
+  gint64 trace_start;
   int i;
 
   g_return_val_if_fail (GDK_IS_DISPLAY (display), NULL);
@@ -1182,7 +1189,11 @@ gtk_settings_get_for_display (GdkDisplay *display)
         return settings;
     }
 
-  return gtk_settings_create_for_display (display);
+  trace_start = gtk_startup_trace_begin ();
+  settings = gtk_settings_create_for_display (display);
+  gtk_startup_trace_end (trace_start, "Create settings", gdk_display_get_name (display));
+
+  return settings;
 }
 
 /**
@@ -1264,6 +1275,26 @@ settings_update_font_values (GtkSettings *settings)
     pango_font_description_free (desc);
 }
 
+static void
+settings_update_widget_font_options (GtkSettings *settings,
+                                     gboolean     metrics_changed)
+{
+  GList *list, *toplevels;
+
+  toplevels = gtk_window_list_toplevels ();
+  g_list_foreach (toplevels, (GFunc) g_object_ref, NULL);
+
+  for (list = toplevels; list; list = list->next)
+    {
+      if (gtk_widget_get_display (list->data) == settings->priv->display)
+        gtk_widget_update_font_options (list->data, metrics_changed);
+
+      g_object_unref (list->data);
+    }
+
+  g_list_free (toplevels);
+}
+
 static void
 gtk_settings_notify (GObject    *object,
                      GParamSpec *pspec)
@@ -1272,6 +1303,26 @@ gtk_settings_notify (GObject    *object,
   GtkSettingsPrivate *priv = settings->priv;
   guint property_id = pspec->param_id;
 
+  switch (property_id)
+    {
+    case PROP_DOUBLE_CLICK_TIME:
+    case PROP_DOUBLE_CLICK_DISTANCE:
+    case PROP_DND_DRAG_THRESHOLD:
+    case PROP_CURSOR_BLINK:
+    case PROP_CURSOR_BLINK_TIME:
+    case PROP_CURSOR_BLINK_TIMEOUT:
+    case PROP_SPLIT_CURSOR:
+    case PROP_ENABLE_ANIMATIONS:
+    case PROP_PRIMARY_BUTTON_WARPS_SLIDER:
+    case PROP_ENTRY_SELECT_ON_FOCUS:
+    case PROP_LONG_PRESS_TIME:
+    case PROP_KEYNAV_USE_CARET:
+      settings_update_values (settings);
+      break;
+    default:
+      break;
+    }
+
   if (priv->display == NULL) /* initialization */
     return;
 
@@ -1298,11 +1349,16 @@ gtk_settings_notify (GObject    *object,
       gtk_style_context_reset_widgets (priv->display);
       break;
     case PROP_XFT_ANTIALIAS:
+    case PROP_XFT_RGBA:
+      /* Only changes how glyphs are rendered */
+      settings_update_font_options (settings);
+      settings_update_widget_font_options (settings, FALSE);
+      break;
     case PROP_XFT_HINTING:
     case PROP_XFT_HINTSTYLE:
-    case PROP_XFT_RGBA:
+      /* Hinting can change glyph advances */
       settings_update_font_options (settings);
-      gtk_style_context_reset_widgets (priv->display);
+      settings_update_widget_font_options (settings, TRUE);
       break;
     case PROP_FONTCONFIG_TIMESTAMP:
       if (settings_update_fontconfig (settings))
@@ -1978,20 +2034,55 @@ _gtk_settings_reset_rc_values (GtkSettings *settings)
   g_free (pspecs);
 }
 
+#define INT_VALUE(priv, id) g_value_get_int (&(priv)->property_values[(id) - 1].value)
+#define BOOLEAN_VALUE(priv, id) g_value_get_boolean (&(priv)->property_values[(id) - 1].value)
+
 static void
-settings_update_double_click (GtkSettings *settings)
+settings_update_values (GtkSettings *settings)
 {
   GtkSettingsPrivate *priv = settings->priv;
-  gint double_click_time;
-  gint double_click_distance;
+  GtkSettingsValues *values = &priv->values;
+
+  values->double_click_time = INT_VALUE (priv, PROP_DOUBLE_CLICK_TIME);
+  values->double_click_distance = INT_VALUE (priv, PROP_DOUBLE_CLICK_DISTANCE);
+  values->dnd_drag_threshold = INT_VALUE (priv, PROP_DND_DRAG_THRESHOLD);
+  values->cursor_blink_time = INT_VALUE (priv, PROP_CURSOR_BLINK_TIME);
+  values->cursor_blink_timeout = INT_VALUE (priv, PROP_CURSOR_BLINK_TIMEOUT);
+  values->long_press_time = INT_VALUE (priv, PROP_LONG_PRESS_TIME);
+  values->cursor_blink = BOOLEAN_VALUE (priv, PROP_CURSOR_BLINK);
+  values->split_cursor = BOOLEAN_VALUE (priv, PROP_SPLIT_CURSOR);
+  values->enable_animations = BOOLEAN_VALUE (priv, PROP_ENABLE_ANIMATIONS);
+  values->primary_button_warps_slider = BOOLEAN_VALUE (priv, PROP_PRIMARY_BUTTON_WARPS_SLIDER);
+  values->entry_select_on_focus = BOOLEAN_VALUE (priv, PROP_ENTRY_SELECT_ON_FOCUS);
+  values->keynav_use_caret = BOOLEAN_VALUE (priv, PROP_KEYNAV_USE_CARET);
+}
 
-  g_object_get (settings,
-                "gtk-double-click-time", &double_click_time,
-                "gtk-double-click-distance", &double_click_distance,
-                NULL);
+#undef INT_VALUE
+#undef BOOLEAN_VALUE
+
+/*
+ * gtk_settings_get_values:
+ * @settings: a #GtkSettings
+ *
+ * Gets the current values of the settings that widgets look at while
+ * handling events, without going through g_object_get(). The struct
+ * is updated in place whenever one of them changes.
+ *
+ * Returns: (transfer none): the values
+ */
+const GtkSettingsValues *
+gtk_settings_get_values (GtkSettings *settings)
+{
+  return &settings->priv->values;
+}
+
+static void
+settings_update_double_click (GtkSettings *settings)
+{
+  GtkSettingsPrivate *priv = settings->priv;
 
-  gdk_display_set_double_click_time (priv->display, double_click_time);
-  gdk_display_set_double_click_distance (priv->display, double_click_distance);
+  gdk_display_set_double_click_time (priv->display, priv->values.double_click_time);
+  gdk_display_set_double_click_distance (priv->display, priv->values.double_click_distance);
 }
 
 static void
@@ -2475,7 +2566,8 @@ gtk_settings_get_property (GObject     *object,
   GtkSettings *settings = GTK_SETTINGS (object);
   GtkSettingsPrivate *priv = settings->priv;
 
-  settings_update_xsetting (settings, pspec, FALSE);
+  if (settings_update_xsetting (settings, pspec, FALSE))
+    settings_update_values (settings);
 
   g_value_copy (&priv->property_values[property_id - 1].value, value);
 }
@@ -53,6 +53,25 @@ typedef enum
 GtkSettingsSource  _gtk_settings_get_setting_source (GtkSettings *settings,
                                                      const gchar *name);
 
+/* The settings that are read for every event or blink */
+typedef struct
+{
+  int double_click_time;
+  int double_click_distance;
+  int dnd_drag_threshold;
+  int cursor_blink_time;
+  int cursor_blink_timeout;
+  int long_press_time;
+  guint cursor_blink                : 1;
+  guint split_cursor                : 1;
+  guint enable_animations           : 1;
+  guint primary_button_warps_slider : 1;
+  guint entry_select_on_focus       : 1;
+  guint keynav_use_caret            : 1;
+} GtkSettingsValues;
+
+const GtkSettingsValues *gtk_settings_get_values (GtkSettings *settings);
+
 gboolean gtk_settings_get_enable_animations  (GtkSettings *settings);
 gint     gtk_settings_get_dnd_drag_threshold (GtkSettings *settings);
 const gchar *gtk_settings_get_font_family    (GtkSettings *settings);
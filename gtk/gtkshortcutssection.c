@@ -471,7 +471,7 @@ gtk_shortcuts_section_set_view_name (GtkShortcutsSection *self,
   self->view_name = g_strdup (view_name);
 
   gtk_shortcuts_section_filter_groups (self);
-  gtk_shortcuts_section_reflow_groups (self);
+  gtk_shortcuts_section_maybe_reflow (self);
 
   g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_VIEW_NAME]);
 }
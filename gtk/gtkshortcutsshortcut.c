@@ -57,6 +57,10 @@ struct _GtkShortcutsShortcut
   GtkTextDirection direction;
   gchar *action_name;
   GtkShortcutType  shortcut_type;
+
+  /* Kept until the shortcut is shown, see gtk_shortcuts_shortcut_materialize() */
+  gchar *pending_accelerator;
+  gboolean materialized;
 };
 
 struct _GtkShortcutsShortcutClass
@@ -88,7 +92,24 @@ static void
 gtk_shortcuts_shortcut_set_accelerator (GtkShortcutsShortcut *self,
                                         const gchar          *accelerator)
 {
-  gtk_shortcut_label_set_accelerator (self->accelerator, accelerator);
+  if (self->materialized)
+    {
+      gtk_shortcut_label_set_accelerator (self->accelerator, accelerator);
+    }
+  else
+    {
+      g_free (self->pending_accelerator);
+      self->pending_accelerator = g_strdup (accelerator);
+    }
+}
+
+static const gchar *
+gtk_shortcuts_shortcut_get_accelerator (GtkShortcutsShortcut *self)
+{
+  if (self->materialized)
+    return gtk_shortcut_label_get_accelerator (self->accelerator);
+  else
+    return self->pending_accelerator;
 }
 
 static void
@@ -369,7 +390,7 @@ gtk_shortcuts_shortcut_get_property (GObject    *object,
       break;
 
     case PROP_ACCELERATOR:
-      g_value_set_string (value, gtk_shortcut_label_get_accelerator (self->accelerator));
+      g_value_set_string (value, gtk_shortcuts_shortcut_get_accelerator (self));
       break;
 
     case PROP_ICON:
@@ -465,6 +486,7 @@ gtk_shortcuts_shortcut_finalize (GObject *object)
   g_clear_object (&self->accel_size_group);
   g_clear_object (&self->title_size_group);
   g_free (self->action_name);
+  g_free (self->pending_accelerator);
   gtk_widget_unparent (GTK_WIDGET (self->box));
 
   G_OBJECT_CLASS (gtk_shortcuts_shortcut_parent_class)->finalize (object);
@@ -494,6 +516,39 @@ gtk_shortcuts_shortcut_update_accel (GtkShortcutsShortcut *self,
   g_strfreev (accels);
 }
 
+/*
+ * gtk_shortcuts_shortcut_materialize:
+ * @self: a #GtkShortcutsShortcut
+ *
+ * Creates the keys of the accelerator. Parsing accelerators and
+ * creating a widget for every key is most of the cost of a shortcut,
+ * so it is put off until the shortcut is about to be shown. The
+ * shortcuts window does this for the section it shows, before it is
+ * measured, and mapping a shortcut does it for any other use.
+ */
+void
+gtk_shortcuts_shortcut_materialize (GtkShortcutsShortcut *self)
+{
+  if (self->materialized)
+    return;
+
+  self->materialized = TRUE;
+
+  if (self->pending_accelerator)
+    {
+      gtk_shortcut_label_set_accelerator (self->accelerator, self->pending_accelerator);
+      g_clear_pointer (&self->pending_accelerator, g_free);
+    }
+}
+
+static void
+gtk_shortcuts_shortcut_map (GtkWidget *widget)
+{
+  gtk_shortcuts_shortcut_materialize (GTK_SHORTCUTS_SHORTCUT (widget));
+
+  GTK_WIDGET_CLASS (gtk_shortcuts_shortcut_parent_class)->map (widget);
+}
+
 static void
 gtk_shortcuts_shortcut_measure (GtkWidget      *widget,
                                 GtkOrientation  orientation,
@@ -542,6 +597,7 @@ gtk_shortcuts_shortcut_class_init (GtkShortcutsShortcutClass *klass)
   object_class->set_property = gtk_shortcuts_shortcut_set_property;
 
   widget_class->direction_changed = gtk_shortcuts_shortcut_direction_changed;
+  widget_class->map = gtk_shortcuts_shortcut_map;
   widget_class->measure = gtk_shortcuts_shortcut_measure;
   widget_class->snapshot = gtk_shortcuts_shortcut_snapshot;
   widget_class->size_allocate = gtk_shortcuts_shortcut_size_allocate;
@@ -33,6 +33,7 @@ G_BEGIN_DECLS
 
 void gtk_shortcuts_shortcut_update_accel (GtkShortcutsShortcut *self,
                                           GtkWindow            *window);
+void gtk_shortcuts_shortcut_materialize  (GtkShortcutsShortcut *self);
 
 G_END_DECLS
 
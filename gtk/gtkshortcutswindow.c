@@ -93,9 +93,25 @@
  * The .ui file for this example can be found [here](https://gitlab.gnome.org/GNOME/gtk/tree/master/demos/gtk-demo/shortcuts-builder.ui).
  */
 
+/* The search looks at an index of all shortcuts, and only creates
+ * widgets for the shortcuts that it finds
+ */
 typedef struct
 {
-  GHashTable     *keywords;
+  gchar            *title;
+  gchar            *subtitle;
+  gchar            *accelerator;
+  gchar            *action_name;
+  GIcon            *icon;
+  GtkTextDirection  direction;
+  GtkShortcutType   shortcut_type;
+  gchar            *keywords;
+  GtkWidget        *widget;
+} SearchItem;
+
+typedef struct
+{
+  GPtrArray      *search_items;
   gchar          *initial_section;
   gchar          *last_section_name;
   gchar          *view_name;
@@ -193,24 +209,33 @@ update_title_stack (GtkShortcutsWindow *self)
     }
 }
 
+static void
+search_item_free (SearchItem *item)
+{
+  g_free (item->title);
+  g_free (item->subtitle);
+  g_free (item->accelerator);
+  g_free (item->action_name);
+  g_clear_object (&item->icon);
+  g_free (item->keywords);
+  g_slice_free (SearchItem, item);
+}
+
 static void
 gtk_shortcuts_window_add_search_item (GtkWidget *child, gpointer data)
 {
   GtkShortcutsWindow *self = data;
   GtkShortcutsWindowPrivate *priv = gtk_shortcuts_window_get_instance_private (self);
-  GtkWidget *item;
+  SearchItem *item;
   gchar *accelerator = NULL;
   gchar *title = NULL;
   gchar *hash_key = NULL;
-  GIcon *icon = NULL;
   gboolean icon_set = FALSE;
   gboolean subtitle_set = FALSE;
   GtkTextDirection direction;
   GtkShortcutType shortcut_type;
   gchar *action_name = NULL;
-  gchar *subtitle;
   gchar *str;
-  gchar *keywords;
 
   if (GTK_IS_SHORTCUTS_SHORTCUT (child))
     {
@@ -239,45 +264,28 @@ gtk_shortcuts_window_add_search_item (GtkWidget *child, gpointer data)
           g_free (hash_key);
           g_free (title);
           g_free (accelerator);
+          g_free (action_name);
           return;
         }
 
       g_hash_table_insert (priv->search_items_hash, hash_key, GINT_TO_POINTER (1));
 
-      item = g_object_new (GTK_TYPE_SHORTCUTS_SHORTCUT,
-                           "accelerator", accelerator,
-                           "title", title,
-                           "direction", direction,
-                           "shortcut-type", shortcut_type,
-                           "accel-size-group", priv->search_image_group,
-                           "title-size-group", priv->search_text_group,
-                           "action-name", action_name,
-                           NULL);
+      item = g_slice_new0 (SearchItem);
+      item->title = title;
+      item->accelerator = accelerator;
+      item->action_name = action_name;
+      item->direction = direction;
+      item->shortcut_type = shortcut_type;
       if (icon_set)
-        {
-          g_object_get (child, "icon", &icon, NULL);
-          g_object_set (item, "icon", icon, NULL);
-          g_clear_object (&icon);
-        }
+        g_object_get (child, "icon", &item->icon, NULL);
       if (subtitle_set)
-        {
-          g_object_get (child, "subtitle", &subtitle, NULL);
-          g_object_set (item, "subtitle", subtitle, NULL);
-          g_free (subtitle);
-        }
-      str = g_strdup_printf ("%s %s", accelerator, title);
-      keywords = g_utf8_strdown (str, -1);
-
-      g_hash_table_insert (priv->keywords, item, keywords);
-      if (shortcut_type == GTK_SHORTCUT_ACCELERATOR)
-        gtk_container_add (GTK_CONTAINER (priv->search_shortcuts), item);
-      else
-        gtk_container_add (GTK_CONTAINER (priv->search_gestures), item);
+        g_object_get (child, "subtitle", &item->subtitle, NULL);
 
-      g_free (title);
-      g_free (accelerator);
+      str = g_strdup_printf ("%s %s", accelerator, title);
+      item->keywords = g_utf8_strdown (str, -1);
       g_free (str);
-      g_free (action_name);
+
+      g_ptr_array_add (priv->search_items, item);
     }
   else if (GTK_IS_CONTAINER (child))
     {
@@ -285,6 +293,83 @@ gtk_shortcuts_window_add_search_item (GtkWidget *child, gpointer data)
     }
 }
 
+/* Results are kept in the order of the index, after the closest
+ * earlier item of the same type that has a widget already
+ */
+static void
+gtk_shortcuts_window_create_search_widget (GtkShortcutsWindow *self,
+                                           guint               index)
+{
+  GtkShortcutsWindowPrivate *priv = gtk_shortcuts_window_get_instance_private (self);
+  SearchItem *item = g_ptr_array_index (priv->search_items, index);
+  GtkWidget *sibling = NULL;
+  GtkBox *box;
+  guint i;
+
+  item->widget = g_object_new (GTK_TYPE_SHORTCUTS_SHORTCUT,
+                               "accelerator", item->accelerator,
+                               "title", item->title,
+                               "direction", item->direction,
+                               "shortcut-type", item->shortcut_type,
+                               "accel-size-group", priv->search_image_group,
+                               "title-size-group", priv->search_text_group,
+                               "action-name", item->action_name,
+                               NULL);
+  if (item->icon)
+    g_object_set (item->widget, "icon", item->icon, NULL);
+  if (item->subtitle)
+    g_object_set (item->widget, "subtitle", item->subtitle, NULL);
+  gtk_shortcuts_shortcut_materialize (GTK_SHORTCUTS_SHORTCUT (item->widget));
+
+  for (i = index; i > 0; i--)
+    {
+      SearchItem *other = g_ptr_array_index (priv->search_items, i - 1);
+
+      if (other->widget &&
+          (other->shortcut_type == GTK_SHORTCUT_ACCELERATOR) == (item->shortcut_type == GTK_SHORTCUT_ACCELERATOR))
+        {
+          sibling = other->widget;
+          break;
+        }
+    }
+
+  if (item->shortcut_type == GTK_SHORTCUT_ACCELERATOR)
+    box = priv->search_shortcuts;
+  else
+    box = priv->search_gestures;
+
+  gtk_box_insert_child_after (box, item->widget, sibling);
+}
+
+static void
+materialize_shortcut (GtkWidget *widget,
+                      gpointer   data)
+{
+  if (GTK_IS_SHORTCUTS_SHORTCUT (widget))
+    gtk_shortcuts_shortcut_materialize (GTK_SHORTCUTS_SHORTCUT (widget));
+  else if (GTK_IS_CONTAINER (widget))
+    gtk_container_forall (GTK_CONTAINER (widget), materialize_shortcut, data);
+}
+
+/* Sections only create their accelerator keys when they are first
+ * shown. This runs before the section is measured for it.
+ */
+static void
+materialize_visible_section (GtkShortcutsWindow *self)
+{
+  GtkShortcutsWindowPrivate *priv = gtk_shortcuts_window_get_instance_private (self);
+  GtkWidget *visible_child;
+
+  visible_child = gtk_stack_get_visible_child (priv->stack);
+
+  if (GTK_IS_SHORTCUTS_SECTION (visible_child) &&
+      !g_object_get_data (G_OBJECT (visible_child), "gtk-shortcuts-materialized"))
+    {
+      materialize_shortcut (visible_child, NULL);
+      g_object_set_data (G_OBJECT (visible_child), "gtk-shortcuts-materialized", GINT_TO_POINTER (1));
+    }
+}
+
 static void
 section_notify_cb (GObject    *section,
                    GParamSpec *pspec,
@@ -520,34 +605,17 @@ gtk_shortcuts_window__list_box__row_activated (GtkShortcutsWindow *self,
   gtk_popover_popdown (priv->popover);
 }
 
-static gboolean
-hidden_by_direction (GtkWidget *widget)
-{
-  if (GTK_IS_SHORTCUTS_SHORTCUT (widget))
-    {
-      GtkTextDirection dir;
-
-      g_object_get (widget, "direction", &dir, NULL);
-      if (dir != GTK_TEXT_DIR_NONE &&
-          dir != gtk_widget_get_direction (widget))
-        return TRUE;
-    }
-
-  return FALSE;
-}
-
 static void
 gtk_shortcuts_window__entry__changed (GtkShortcutsWindow *self,
                                      GtkSearchEntry      *search_entry)
 {
   GtkShortcutsWindowPrivate *priv = gtk_shortcuts_window_get_instance_private (self);
   gchar *downcase = NULL;
-  GHashTableIter iter;
   const gchar *text;
   const gchar *last_section_name;
-  gpointer key;
-  gpointer value;
+  GtkTextDirection direction;
   gboolean has_result;
+  guint i;
 
   text = gtk_editable_get_text (GTK_EDITABLE (search_entry));
 
@@ -571,22 +639,25 @@ gtk_shortcuts_window__entry__changed (GtkShortcutsWindow *self,
     }
 
   downcase = g_utf8_strdown (text, -1);
-
-  g_hash_table_iter_init (&iter, priv->keywords);
+  direction = gtk_widget_get_direction (GTK_WIDGET (self));
 
   has_result = FALSE;
-  while (g_hash_table_iter_next (&iter, &key, &value))
+  for (i = 0; i < priv->search_items->len; i++)
     {
-      GtkWidget *widget = key;
-      const gchar *keywords = value;
+      SearchItem *item = g_ptr_array_index (priv->search_items, i);
       gboolean match;
 
-      if (hidden_by_direction (widget))
+      if (item->direction != GTK_TEXT_DIR_NONE &&
+          item->direction != direction)
         match = FALSE;
       else
-        match = strstr (keywords, downcase) != NULL;
+        match = strstr (item->keywords, downcase) != NULL;
 
-      gtk_widget_set_visible (widget, match);
+      if (match && item->widget == NULL)
+        gtk_shortcuts_window_create_search_widget (self, i);
+
+      if (item->widget)
+        gtk_widget_set_visible (item->widget, match);
       has_result |= match;
     }
 
@@ -642,7 +713,7 @@ gtk_shortcuts_window_finalize (GObject *object)
   GtkShortcutsWindow *self = (GtkShortcutsWindow *)object;
   GtkShortcutsWindowPrivate *priv = gtk_shortcuts_window_get_instance_private (self);
 
-  g_clear_pointer (&priv->keywords, g_hash_table_unref);
+  g_clear_pointer (&priv->search_items, g_ptr_array_unref);
   g_clear_pointer (&priv->initial_section, g_free);
   g_clear_pointer (&priv->view_name, g_free);
   g_clear_pointer (&priv->last_section_name, g_free);
@@ -890,7 +961,7 @@ gtk_shortcuts_window_init (GtkShortcutsWindow *self)
                     G_CALLBACK (window_key_pressed), NULL);
   gtk_widget_add_controller (GTK_WIDGET (self), controller);
 
-  priv->keywords = g_hash_table_new_full (NULL, NULL, NULL, g_free);
+  priv->search_items = g_ptr_array_new_with_free_func ((GDestroyNotify) search_item_free);
   priv->search_items_hash = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
 
   priv->search_text_group = gtk_size_group_new (GTK_SIZE_GROUP_HORIZONTAL);
@@ -921,6 +992,7 @@ gtk_shortcuts_window_init (GtkShortcutsWindow *self)
   priv->stack = g_object_new (GTK_TYPE_STACK,
                               "expand", TRUE,
                               "homogeneous", TRUE,
+                              "lazy-pages", TRUE,
                               "transition-type", GTK_STACK_TRANSITION_TYPE_CROSSFADE,
                               NULL);
   gtk_container_add (GTK_CONTAINER (priv->main_box), GTK_WIDGET (priv->stack));
@@ -1048,6 +1120,8 @@ gtk_shortcuts_window_init (GtkShortcutsWindow *self)
 
   gtk_stack_add_named (priv->stack, empty, "no-search-results");
 
+  g_signal_connect_object (priv->stack, "notify::visible-child",
+                           G_CALLBACK (materialize_visible_section), self, G_CONNECT_SWAPPED);
   g_signal_connect_object (priv->stack, "notify::visible-child",
                            G_CALLBACK (update_title_stack), self, G_CONNECT_SWAPPED);
 
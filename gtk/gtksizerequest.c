@@ -24,6 +24,7 @@
 #include "gtksizerequest.h"
 
 #include "gtkdebug.h"
+#include "gtkframephasetimingsprivate.h"
 #include "gtkintl.h"
 #include "gtkprivate.h"
 #include "gtksizegroup-private.h"
@@ -160,8 +161,12 @@ gtk_widget_query_size_for_orientation (GtkWidget        *widget,
                                                    &min_baseline,
                                                    &nat_baseline);
 
+  gtk_widget_class_count_size_request (GTK_WIDGET_GET_CLASS (widget), found_in_cache);
+
   if (!found_in_cache)
     {
+      GtkFramePhaseTimings *timings;
+      gint64 phase_start, phase_nested;
       GtkWidgetClass *widget_class;
       GtkCssStyle *style;
       GtkBorder margin, border, padding;
@@ -173,6 +178,8 @@ gtk_widget_query_size_for_orientation (GtkWidget        *widget,
       int css_extra_for_size;
       int css_extra_size;
 
+      timings = gtk_frame_phase_begin (GTK_FRAME_PHASE_MEASURE, &phase_start, &phase_nested);
+
       style = gtk_css_node_get_style (gtk_widget_get_css_node (widget));
       get_box_margin (style, &margin);
       get_box_border (style, &border);
@@ -352,6 +359,8 @@ gtk_widget_query_size_for_orientation (GtkWidget        *widget,
                                       nat_size,
 				      min_baseline,
 				      nat_baseline);
+
+      gtk_frame_phase_end (timings, GTK_FRAME_PHASE_MEASURE, widget, phase_start, phase_nested);
     }
 
   if (minimum)
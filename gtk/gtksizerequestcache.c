@@ -31,42 +31,115 @@ _gtk_size_request_cache_init (SizeRequestCache *cache)
   memset (cache, 0, sizeof (SizeRequestCache));
 }
 
-static void
-free_sizes_x (SizeRequestX **sizes)
+void
+_gtk_size_request_cache_free (SizeRequestCache *cache)
+{
+  g_free (cache->requests_x);
+  g_free (cache->requests_y);
+}
+
+/* Keeps the allocated ranges and how many of them we allow, so that
+ * a widget that needed more ranges before doesn't have to find out
+ * again every time it is resized. */
+void
+_gtk_size_request_cache_clear (SizeRequestCache *cache)
 {
-  gint i;
+  guint orientation;
 
-  for (i = 0; i < GTK_SIZE_REQUEST_CACHED_SIZES && sizes[i] != NULL; i++)
-    g_slice_free (SizeRequestX, sizes[i]);
+  cache->request_mode_valid = FALSE;
 
-  g_slice_free1 (sizeof (SizeRequestY *) * GTK_SIZE_REQUEST_CACHED_SIZES, sizes);
+  for (orientation = 0; orientation < 2; orientation++)
+    {
+      cache->flags[orientation].n_cached_requests = 0;
+      cache->flags[orientation].cached_size_valid = FALSE;
+    }
 }
 
-static void
-free_sizes_y (SizeRequestY **sizes)
+static inline guint
+get_max_requests (const SizeRequestCache *cache,
+                  GtkOrientation          orientation)
+{
+  if (cache->flags[orientation].n_max_requests == 0)
+    return GTK_SIZE_REQUEST_CACHED_SIZES;
+
+  return cache->flags[orientation].n_max_requests;
+}
+
+/* Moves the range at @index to the front, because it was just used */
+static inline void
+requests_promote (gpointer requests,
+                  gsize    size,
+                  guint    index)
 {
-  gint i;
+  guint8 tmp[MAX (sizeof (SizeRequestX), sizeof (SizeRequestY))];
+  guint8 *data = requests;
 
-  for (i = 0; i < GTK_SIZE_REQUEST_CACHED_SIZES && sizes[i] != NULL; i++)
-    g_slice_free (SizeRequestY, sizes[i]);
+  if (index == 0)
+    return;
 
-  g_slice_free1 (sizeof (SizeRequestY *) * GTK_SIZE_REQUEST_CACHED_SIZES, sizes);
+  memcpy (tmp, data + index * size, size);
+  memmove (data + size, data, index * size);
+  memcpy (data, tmp, size);
 }
 
-void
-_gtk_size_request_cache_free (SizeRequestCache *cache)
+/* Makes room for a new range at the front, dropping the least recently
+ * used one if the cache is full and may not grow anymore */
+static gpointer
+requests_prepend (SizeRequestCache *cache,
+                  GtkOrientation    orientation,
+                  gpointer          requests,
+                  gsize             size)
 {
-  if (cache->requests_x)
-    free_sizes_x (cache->requests_x);
-  if (cache->requests_y)
-    free_sizes_y (cache->requests_y);
+  guint n_requests = cache->flags[orientation].n_cached_requests;
+  guint n_max = get_max_requests (cache, orientation);
+
+  if (n_requests == n_max)
+    {
+      if (n_max < GTK_SIZE_REQUEST_MAX_CACHED_SIZES)
+        {
+          n_max = MIN (2 * n_max, GTK_SIZE_REQUEST_MAX_CACHED_SIZES);
+          cache->flags[orientation].n_max_requests = n_max;
+          if (requests)
+            requests = g_realloc_n (requests, n_max, size);
+        }
+      else
+        n_requests--;
+    }
+
+  if (requests == NULL)
+    requests = g_malloc_n (n_max, size);
+
+  memmove ((guint8 *) requests + size, requests, n_requests * size);
+  cache->flags[orientation].n_cached_requests = n_requests + 1;
+
+  return requests;
 }
 
-void
-_gtk_size_request_cache_clear (SizeRequestCache *cache)
+/* The range at the front was extended. Lookups find it first, so
+ * other ranges it now covers would never be found again and can go. */
+static void
+requests_compress (SizeRequestCache *cache,
+                   GtkOrientation    orientation,
+                   gpointer          requests,
+                   gsize             size)
 {
-  _gtk_size_request_cache_free (cache);
-  _gtk_size_request_cache_init (cache);
+  guint i, n_requests = cache->flags[orientation].n_cached_requests;
+  guint8 *data = requests;
+  /* lower_for_size and upper_for_size come first in both kinds of range */
+  const gint *first = requests;
+
+  for (i = n_requests - 1; i > 0; i--)
+    {
+      const gint *cur = (const gint *) (data + i * size);
+
+      if (cur[0] >= first[0] && cur[1] <= first[1])
+        {
+          memmove (data + i * size, data + (i + 1) * size, (n_requests - i - 1) * size);
+          n_requests--;
+        }
+    }
+
+  cache->flags[orientation].n_cached_requests = n_requests;
 }
 
 void
@@ -112,94 +185,55 @@ _gtk_size_request_cache_commit (SizeRequestCache *cache,
    */
   n_sizes = cache->flags[orientation].n_cached_requests;
 
-
   if (orientation == GTK_ORIENTATION_HORIZONTAL)
     {
-      SizeRequestX **cached_sizes = cache->requests_x;
-      SizeRequestX  *cached_size;
+      SizeRequestX *cached_sizes = cache->requests_x;
 
       for (i = 0; i < n_sizes; i++)
 	{
-	  if (cached_sizes[i]->cached_size.minimum_size == minimum_size &&
-	      cached_sizes[i]->cached_size.natural_size == natural_size)
+	  if (cached_sizes[i].cached_size.minimum_size == minimum_size &&
+	      cached_sizes[i].cached_size.natural_size == natural_size)
 	    {
-	      cached_sizes[i]->lower_for_size = MIN (cached_sizes[i]->lower_for_size, for_size);
-	      cached_sizes[i]->upper_for_size = MAX (cached_sizes[i]->upper_for_size, for_size);
+	      cached_sizes[i].lower_for_size = MIN (cached_sizes[i].lower_for_size, for_size);
+	      cached_sizes[i].upper_for_size = MAX (cached_sizes[i].upper_for_size, for_size);
+              requests_promote (cached_sizes, sizeof (SizeRequestX), i);
+              requests_compress (cache, orientation, cached_sizes, sizeof (SizeRequestX));
 	      return;
 	    }
 	}
 
-      /* If not found, pull a new size from the cache, the returned size cache
-       * will immediately be used to cache the new computed size so we go ahead
-       * and increment the last_cached_request right away */
-      if (n_sizes < GTK_SIZE_REQUEST_CACHED_SIZES)
-	{
-	  cache->flags[orientation].n_cached_requests++;
-	  cache->flags[orientation].last_cached_request = cache->flags[orientation].n_cached_requests - 1;
-	}
-      else
-	{
-	  if (++cache->flags[orientation].last_cached_request == GTK_SIZE_REQUEST_CACHED_SIZES)
-	    cache->flags[orientation].last_cached_request = 0;
-	}
-
-      if (cache->requests_x == NULL)
-	cache->requests_x = g_slice_alloc0 (sizeof (SizeRequestX *) * GTK_SIZE_REQUEST_CACHED_SIZES);
-
-      if (cache->requests_x[cache->flags[orientation].last_cached_request] == NULL)
-	cache->requests_x[cache->flags[orientation].last_cached_request] = g_slice_new (SizeRequestX);
-
-      cached_size = cache->requests_x[cache->flags[orientation].last_cached_request];
-      cached_size->lower_for_size = for_size;
-      cached_size->upper_for_size = for_size;
-      cached_size->cached_size.minimum_size = minimum_size;
-      cached_size->cached_size.natural_size = natural_size;
+      cache->requests_x = requests_prepend (cache, orientation, cache->requests_x, sizeof (SizeRequestX));
+      cache->requests_x[0].lower_for_size = for_size;
+      cache->requests_x[0].upper_for_size = for_size;
+      cache->requests_x[0].cached_size.minimum_size = minimum_size;
+      cache->requests_x[0].cached_size.natural_size = natural_size;
     }
   else
     {
-      SizeRequestY **cached_sizes = cache->requests_y;
-      SizeRequestY  *cached_size;
+      SizeRequestY *cached_sizes = cache->requests_y;
 
       for (i = 0; i < n_sizes; i++)
 	{
-	  if (cached_sizes[i]->cached_size.minimum_size == minimum_size &&
-	      cached_sizes[i]->cached_size.natural_size == natural_size &&
-	      cached_sizes[i]->cached_size.minimum_baseline == minimum_baseline &&
-	      cached_sizes[i]->cached_size.natural_baseline == natural_baseline)
+	  if (cached_sizes[i].cached_size.minimum_size == minimum_size &&
+	      cached_sizes[i].cached_size.natural_size == natural_size &&
+	      cached_sizes[i].cached_size.minimum_baseline == minimum_baseline &&
+	      cached_sizes[i].cached_size.natural_baseline == natural_baseline)
 	    {
-	      cached_sizes[i]->lower_for_size = MIN (cached_sizes[i]->lower_for_size, for_size);
-	      cached_sizes[i]->upper_for_size = MAX (cached_sizes[i]->upper_for_size, for_size);
+	      cached_sizes[i].lower_for_size = MIN (cached_sizes[i].lower_for_size, for_size);
+	      cached_sizes[i].upper_for_size = MAX (cached_sizes[i].upper_for_size, for_size);
+              requests_promote (cached_sizes, sizeof (SizeRequestY), i);
+              requests_compress (cache, orientation, cached_sizes, sizeof (SizeRequestY));
 	      return;
 	    }
 	}
 
-      /* If not found, pull a new size from the cache, the returned size cache
-       * will immediately be used to cache the new computed size so we go ahead
-       * and increment the last_cached_request right away */
-      if (n_sizes < GTK_SIZE_REQUEST_CACHED_SIZES)
-	{
-	  cache->flags[orientation].n_cached_requests++;
-	  cache->flags[orientation].last_cached_request = cache->flags[orientation].n_cached_requests - 1;
-	}
-      else
-	{
-	  if (++cache->flags[orientation].last_cached_request == GTK_SIZE_REQUEST_CACHED_SIZES)
-	    cache->flags[orientation].last_cached_request = 0;
-	}
-
-      if (cache->requests_y == NULL)
-	cache->requests_y = g_slice_alloc0 (sizeof (SizeRequestY *) * GTK_SIZE_REQUEST_CACHED_SIZES);
-
-      if (cache->requests_y[cache->flags[orientation].last_cached_request] == NULL)
-	cache->requests_y[cache->flags[orientation].last_cached_request] = g_slice_new (SizeRequestY);
-
-      cached_size = cache->requests_y[cache->flags[orientation].last_cached_request];
-      cached_size->lower_for_size = for_size;
-      cached_size->upper_for_size = for_size;
-      cached_size->cached_size.minimum_size = minimum_size;
-      cached_size->cached_size.natural_size = natural_size;
-      cached_size->cached_size.minimum_baseline = minimum_baseline;
-      cached_size->cached_size.natural_baseline = natural_baseline;
+      cache->requests_y = requests_prepend (cache, orientation, cache->requests_y, sizeof (SizeRequestY));
+      cache->requests_y[0].lower_for_size = for_size;
+      cache->requests_y[0].upper_for_size = for_size;
+      cache->requests_y[0].cached_size.minimum_size = minimum_size;
+      cache->requests_y[0].cached_size.natural_size = natural_size;
+      cache->requests_y[0].cached_size.minimum_baseline = minimum_baseline;
+      cache->requests_y[0].cached_size.natural_baseline = natural_baseline;
     }
 }
 
@@ -209,13 +243,13 @@ _gtk_size_request_cache_commit (SizeRequestCache *cache,
  * the Clutter toolkit but has evolved for other GTK+ requirements.
  */
 gboolean
-_gtk_size_request_cache_lookup (const SizeRequestCache *cache,
-                                GtkOrientation          orientation,
-                                int                     for_size,
-                                int                    *minimum,
-                                int                    *natural,
-                                int                    *minimum_baseline,
-                                int                    *natural_baseline)
+_gtk_size_request_cache_lookup (SizeRequestCache *cache,
+                                GtkOrientation    orientation,
+                                int               for_size,
+                                int              *minimum,
+                                int              *natural,
+                                int              *minimum_baseline,
+                                int              *natural_baseline)
 {
   guint i, p;
 
@@ -239,7 +273,7 @@ _gtk_size_request_cache_lookup (const SizeRequestCache *cache,
 	  /* Search for an already cached size */
           for (i = 0, p = cache->flags[GTK_ORIENTATION_HORIZONTAL].n_cached_requests; i < p; i++)
             {
-              const SizeRequestX *cur = cache->requests_x[i];
+              const SizeRequestX *cur = &cache->requests_x[i];
 
 	      if (cur->lower_for_size <= for_size &&
 		  cur->upper_for_size >= for_size)
@@ -249,6 +283,7 @@ _gtk_size_request_cache_lookup (const SizeRequestCache *cache,
                   *minimum = result->minimum_size;
                   *natural = result->natural_size;
 
+                  requests_promote (cache->requests_x, sizeof (SizeRequestX), i);
                   return TRUE;
                 }
             }
@@ -278,7 +313,7 @@ _gtk_size_request_cache_lookup (const SizeRequestCache *cache,
 	  /* Search for an already cached size */
           for (i = 0, p = cache->flags[GTK_ORIENTATION_VERTICAL].n_cached_requests; i < p; i++)
             {
-              const SizeRequestY *cur = cache->requests_y[i];
+              const SizeRequestY *cur = &cache->requests_y[i];
 
 	      if (cur->lower_for_size <= for_size &&
 		  cur->upper_for_size >= for_size)
@@ -289,6 +324,8 @@ _gtk_size_request_cache_lookup (const SizeRequestCache *cache,
                   *natural = result->natural_size;
                   *minimum_baseline = result->minimum_baseline;
                   *natural_baseline = result->natural_baseline;
+
+                  requests_promote (cache->requests_y, sizeof (SizeRequestY), i);
                   return TRUE;
                 }
             }
@@ -297,4 +334,3 @@ _gtk_size_request_cache_lookup (const SizeRequestCache *cache,
         }
     }
 }
-
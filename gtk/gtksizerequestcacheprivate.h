@@ -34,9 +34,18 @@ G_BEGIN_DECLS
  * (or width-for-height) as can be rational
  * for a said widget to have, if a label can
  * only wrap to 3 lines, only 3 caches will
- * ever be allocated for it.
+ * ever be used for it.
+ *
+ * Widgets start out with room for
+ * GTK_SIZE_REQUEST_CACHED_SIZES ranges. Every time
+ * a widget would have to evict a range, the room is doubled,
+ * up to GTK_SIZE_REQUEST_MAX_CACHED_SIZES. This way
+ * wrapping labels in a pane that is being resized stop
+ * recomputing their layout, while most widgets never
+ * need more than one or two ranges.
  */
-#define GTK_SIZE_REQUEST_CACHED_SIZES   (5)
+#define GTK_SIZE_REQUEST_CACHED_SIZES       (5)
+#define GTK_SIZE_REQUEST_MAX_CACHED_SIZES   (20)
 
 typedef struct {
   gint minimum_size;
@@ -65,8 +74,9 @@ typedef struct
 } SizeRequestY;
 
 typedef struct {
-  SizeRequestX **requests_x;
-  SizeRequestY **requests_y;
+  /* Sorted by use, the most recently used range comes first */
+  SizeRequestX *requests_x;
+  SizeRequestY *requests_y;
 
   CachedSizeX  cached_size_x;
   CachedSizeY  cached_size_y;
@@ -74,8 +84,8 @@ typedef struct {
   GtkSizeRequestMode request_mode   : 3;
   guint       request_mode_valid    : 1;
   struct {
-    guint       n_cached_requests   : 3;
-    guint       last_cached_request : 3;
+    guint       n_cached_requests   : 5;
+    guint       n_max_requests      : 5; /* 0 means GTK_SIZE_REQUEST_CACHED_SIZES */
     guint       cached_size_valid   : 1;
   }           flags[2];
 } SizeRequestCache;
@@ -91,7 +101,7 @@ void            _gtk_size_request_cache_commit                  (SizeRequestCach
                                                                  int                     natural_size,
                                                                  int                     minimum_baseline,
                                                                  int                     natural_baseline);
-gboolean        _gtk_size_request_cache_lookup                  (const SizeRequestCache *cache,
+gboolean        _gtk_size_request_cache_lookup                  (SizeRequestCache       *cache,
                                                                  GtkOrientation          orientation,
                                                                  int                     for_size,
                                                                  int                    *minimum,
@@ -22,6 +22,7 @@
 #include "gtkslicelistmodel.h"
 
 #include "gtkintl.h"
+#include "gtklistmodelitemsprivate.h"
 #include "gtkprivate.h"
 
 /**
@@ -35,15 +36,26 @@
  *
  * This is useful when implementing paging by setting the size to the number of elements
  * per page and updating the offset whenever a different page is opened.
+ *
+ * When the new slice overlaps the old one, only the items that scrolled
+ * in or out are reported as changed, so views keep the widgets for the
+ * rest. With #GtkSliceListModel:prefetch set, the items of the following
+ * page are requested from the underlying model in idle time, so models
+ * that create their items on demand have them ready by the time they
+ * are needed.
  */
 
 #define DEFAULT_SIZE 10
 
+/* How many items to prefetch at once */
+#define N_PREFETCH_ITEMS 64
+
 enum {
   PROP_0,
   PROP_ITEM_TYPE,
   PROP_MODEL,
   PROP_OFFSET,
+  PROP_PREFETCH,
   PROP_SIZE,
   NUM_PROPERTIES
 };
@@ -58,6 +70,11 @@ struct _GtkSliceListModel
   guint size;
 
   guint n_items;
+
+  guint prefetch : 1;
+  guint prefetch_cb;
+  guint prefetch_position;
+  guint prefetch_end;
 };
 
 struct _GtkSliceListModelClass
@@ -117,8 +134,109 @@ gtk_slice_list_model_model_init (GListModelInterface *iface)
   iface->get_item = gtk_slice_list_model_get_item;
 }
 
+static guint
+gtk_slice_list_model_get_items (GtkListModelItems *list,
+                                guint              position,
+                                guint              n_items,
+                                gpointer          *items)
+{
+  GtkSliceListModel *self = GTK_SLICE_LIST_MODEL (list);
+
+  if (self->model == NULL)
+    return 0;
+
+  if (position >= self->size)
+    return 0;
+
+  return gtk_list_model_get_items (self->model,
+                                   position + self->offset,
+                                   MIN (n_items, self->size - position),
+                                   items);
+}
+
+static void
+gtk_slice_list_model_items_init (GtkListModelItemsInterface *iface)
+{
+  iface->get_items = gtk_slice_list_model_get_items;
+}
+
 G_DEFINE_TYPE_WITH_CODE (GtkSliceListModel, gtk_slice_list_model, G_TYPE_OBJECT,
-                         G_IMPLEMENT_INTERFACE (G_TYPE_LIST_MODEL, gtk_slice_list_model_model_init))
+                         G_IMPLEMENT_INTERFACE (G_TYPE_LIST_MODEL, gtk_slice_list_model_model_init)
+                         G_IMPLEMENT_INTERFACE (GTK_TYPE_LIST_MODEL_ITEMS, gtk_slice_list_model_items_init))
+
+static gboolean
+gtk_slice_list_model_prefetch_cb (gpointer data)
+{
+  GtkSliceListModel *self = data;
+  gpointer items[N_PREFETCH_ITEMS];
+  gint64 end_time;
+  guint i, n;
+
+  end_time = g_get_monotonic_time () + 1000;
+
+  while (self->prefetch_position < self->prefetch_end)
+    {
+      n = gtk_list_model_get_items (self->model,
+                                    self->prefetch_position,
+                                    MIN (self->prefetch_end - self->prefetch_position, N_PREFETCH_ITEMS),
+                                    items);
+      if (n == 0)
+        break;
+
+      /* We only want the underlying models to have done the work */
+      for (i = 0; i < n; i++)
+        g_object_unref (items[i]);
+
+      self->prefetch_position += n;
+
+      if (g_get_monotonic_time () >= end_time)
+        return G_SOURCE_CONTINUE;
+    }
+
+  self->prefetch_cb = 0;
+
+  return G_SOURCE_REMOVE;
+}
+
+static void
+gtk_slice_list_model_stop_prefetch (GtkSliceListModel *self)
+{
+  if (self->prefetch_cb != 0)
+    {
+      g_source_remove (self->prefetch_cb);
+      self->prefetch_cb = 0;
+    }
+}
+
+static void
+gtk_slice_list_model_queue_prefetch (GtkSliceListModel *self)
+{
+  guint n_items;
+
+  if (!self->prefetch || self->model == NULL)
+    {
+      gtk_slice_list_model_stop_prefetch (self);
+      return;
+    }
+
+  n_items = g_list_model_get_n_items (self->model);
+
+  self->prefetch_position = self->offset + MIN (self->size, G_MAXUINT - self->offset);
+  self->prefetch_end = self->prefetch_position + MIN (self->size, G_MAXUINT - self->prefetch_position);
+  self->prefetch_end = MIN (self->prefetch_end, n_items);
+
+  if (self->prefetch_position >= self->prefetch_end)
+    {
+      gtk_slice_list_model_stop_prefetch (self);
+      return;
+    }
+
+  if (self->prefetch_cb == 0)
+    {
+      self->prefetch_cb = g_idle_add (gtk_slice_list_model_prefetch_cb, self);
+      g_source_set_name_by_id (self->prefetch_cb, "[gtk] gtk_slice_list_model_prefetch_cb");
+    }
+}
 
 static void
 gtk_slice_list_model_items_changed_cb (GListModel        *model,
@@ -127,6 +245,8 @@ gtk_slice_list_model_items_changed_cb (GListModel        *model,
                                        guint              added,
                                        GtkSliceListModel *self)
 {
+  gtk_slice_list_model_queue_prefetch (self);
+
   if (position >= self->offset + self->size)
     return;
 
@@ -194,6 +314,10 @@ gtk_slice_list_model_set_property (GObject      *object,
       gtk_slice_list_model_set_offset (self, g_value_get_uint (value));
       break;
 
+    case PROP_PREFETCH:
+      gtk_slice_list_model_set_prefetch (self, g_value_get_boolean (value));
+      break;
+
     case PROP_SIZE:
       gtk_slice_list_model_set_size (self, g_value_get_uint (value));
       break;
@@ -226,6 +350,10 @@ gtk_slice_list_model_get_property (GObject     *object,
       g_value_set_uint (value, self->offset);
       break;
 
+    case PROP_PREFETCH:
+      g_value_set_boolean (value, self->prefetch);
+      break;
+
     case PROP_SIZE:
       g_value_set_uint (value, self->size);
       break;
@@ -251,6 +379,7 @@ gtk_slice_list_model_dispose (GObject *object)
 {
   GtkSliceListModel *self = GTK_SLICE_LIST_MODEL (object);
 
+  gtk_slice_list_model_stop_prefetch (self);
   gtk_slice_list_model_clear_model (self);
 
   G_OBJECT_CLASS (gtk_slice_list_model_parent_class)->dispose (object);
@@ -301,6 +430,18 @@ gtk_slice_list_model_class_init (GtkSliceListModelClass *class)
                          0, G_MAXUINT, 0,
                          GTK_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * GtkSliceListModel:prefetch:
+   *
+   * If the items after the slice are requested ahead of time
+   */
+  properties[PROP_PREFETCH] =
+      g_param_spec_boolean ("prefetch",
+                            P_("Prefetch"),
+                            P_("If the items after the slice are requested ahead of time"),
+                            FALSE,
+                            GTK_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   /**
    * GtkSliceListModel:size:
    *
@@ -405,6 +546,8 @@ gtk_slice_list_model_set_model (GtkSliceListModel *self,
   if (removed > 0 || added > 0)
     g_list_model_items_changed (G_LIST_MODEL (self), 0, removed, added);
 
+  gtk_slice_list_model_queue_prefetch (self);
+
   g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_MODEL]);
 }
 
@@ -438,7 +581,7 @@ void
 gtk_slice_list_model_set_offset (GtkSliceListModel *self,
                                  guint              offset)
 {
-  guint before, after;
+  guint before, after, size, n;
 
   g_return_if_fail (GTK_IS_SLICE_LIST_MODEL (self));
 
@@ -446,13 +589,49 @@ gtk_slice_list_model_set_offset (GtkSliceListModel *self,
     return;
 
   before = g_list_model_get_n_items (G_LIST_MODEL (self));
+  size = self->size;
+
+  if (offset > self->offset && offset - self->offset < before)
+    {
+      guint shift = offset - self->offset;
+
+      /* Drop the items that scrolled out at the start, then add the
+       * new ones at the end. The size gets clamped in between, so the
+       * model is consistent for every emission. */
+      self->offset = offset;
+      self->size = size - shift;
+      g_list_model_items_changed (G_LIST_MODEL (self), 0, shift, 0);
+
+      self->size = size;
+      after = g_list_model_get_n_items (G_LIST_MODEL (self));
+      if (after > before - shift)
+        g_list_model_items_changed (G_LIST_MODEL (self), before - shift, 0, after - (before - shift));
+    }
+  else if (offset < self->offset && self->offset - offset < size && before > 0)
+    {
+      guint shift = self->offset - offset;
 
-  self->offset = offset;
+      /* Same thing backwards: first the end, then the start */
+      self->size = size - shift;
+      n = g_list_model_get_n_items (G_LIST_MODEL (self));
+      if (before > n)
+        g_list_model_items_changed (G_LIST_MODEL (self), n, before - n, 0);
 
-  after = g_list_model_get_n_items (G_LIST_MODEL (self));
+      self->offset = offset;
+      self->size = size;
+      g_list_model_items_changed (G_LIST_MODEL (self), 0, 0, shift);
+    }
+  else
+    {
+      self->offset = offset;
 
-  if (before > 0 || after > 0)
-    g_list_model_items_changed (G_LIST_MODEL (self), 0, before, after);
+      after = g_list_model_get_n_items (G_LIST_MODEL (self));
+
+      if (before > 0 || after > 0)
+        g_list_model_items_changed (G_LIST_MODEL (self), 0, before, after);
+    }
+
+  gtk_slice_list_model_queue_prefetch (self);
 
   g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_OFFSET]);
 }
@@ -507,6 +686,8 @@ gtk_slice_list_model_set_size (GtkSliceListModel *self,
     g_list_model_items_changed (G_LIST_MODEL (self), before, 0, after - before);
   /* else nothing */
 
+  gtk_slice_list_model_queue_prefetch (self);
+
   g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_SIZE]);
 }
 
@@ -526,4 +707,47 @@ gtk_slice_list_model_get_size (GtkSliceListModel *self)
   return self->size;
 }
 
+/**
+ * gtk_slice_list_model_set_prefetch:
+ * @self: a #GtkSliceListModel
+ * @prefetch: %TRUE to request the next page ahead of time
+ *
+ * Sets whether @self requests the items that follow the slice, up to
+ * the size of the slice, from the underlying model when the main loop
+ * is idle.
+ *
+ * This is useful when the underlying model creates its items on
+ * demand and keeps them around for a while, like a #GtkMapListModel
+ * with a #GtkMapListModel:cache-size, so that moving to the next page
+ * does not have to wait for them.
+ **/
+void
+gtk_slice_list_model_set_prefetch (GtkSliceListModel *self,
+                                   gboolean           prefetch)
+{
+  g_return_if_fail (GTK_IS_SLICE_LIST_MODEL (self));
+
+  if (self->prefetch == prefetch)
+    return;
+
+  self->prefetch = prefetch;
+  gtk_slice_list_model_queue_prefetch (self);
+
+  g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_PREFETCH]);
+}
+
+/**
+ * gtk_slice_list_model_get_prefetch:
+ * @self: a #GtkSliceListModel
+ *
+ * Gets the value set via gtk_slice_list_model_set_prefetch().
+ *
+ * Returns: %TRUE if the next page is requested ahead of time
+ **/
+gboolean
+gtk_slice_list_model_get_prefetch (GtkSliceListModel *self)
+{
+  g_return_val_if_fail (GTK_IS_SLICE_LIST_MODEL (self), FALSE);
 
+  return self->prefetch;
+}
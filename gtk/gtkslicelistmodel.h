@@ -58,6 +58,11 @@ void                    gtk_slice_list_model_set_size           (GtkSliceListMod
                                                                  guint                   size);
 GDK_AVAILABLE_IN_ALL
 guint                   gtk_slice_list_model_get_size           (GtkSliceListModel      *self);
+GDK_AVAILABLE_IN_ALL
+void                    gtk_slice_list_model_set_prefetch       (GtkSliceListModel      *self,
+                                                                 gboolean                prefetch);
+GDK_AVAILABLE_IN_ALL
+gboolean                gtk_slice_list_model_get_prefetch       (GtkSliceListModel      *self);
 
 G_END_DECLS
 
@@ -162,10 +162,10 @@ gtk_snapshot_new (void)
 
   snapshot = g_object_new (GTK_TYPE_SNAPSHOT, NULL);
 
-  snapshot->from_parent = FALSE;
-  snapshot->state_stack = g_array_new (FALSE, TRUE, sizeof (GtkSnapshotState));
+  /* Every widget pushes a few states, so start out with some room */
+  snapshot->state_stack = g_array_sized_new (FALSE, TRUE, sizeof (GtkSnapshotState), 16);
   g_array_set_clear_func (snapshot->state_stack, (GDestroyNotify)gtk_snapshot_state_clear);
-  snapshot->nodes = g_ptr_array_new_with_free_func ((GDestroyNotify)gsk_render_node_unref);
+  snapshot->nodes = g_ptr_array_new_full (16, (GDestroyNotify)gsk_render_node_unref);
 
   gtk_snapshot_push_state (snapshot,
                            NULL,
@@ -174,22 +174,16 @@ gtk_snapshot_new (void)
   return snapshot;
 }
 
-/* Private. Does the same as _new but does not allocate a NEW
- * state/node stack. */
-GtkSnapshot *
-gtk_snapshot_new_with_parent (GtkSnapshot *parent_snapshot)
+/* Private. Starts collecting the following nodes into a new node,
+ * like a new snapshot would, but on the stacks of @snapshot so that
+ * no new snapshot and no new stacks need to be allocated.
+ * Must be paired with gtk_snapshot_pop_collect(). */
+void
+gtk_snapshot_push_collect (GtkSnapshot *snapshot)
 {
-  GtkSnapshot *snapshot = g_object_new (GTK_TYPE_SNAPSHOT, NULL);
-
-  snapshot->state_stack = parent_snapshot->state_stack;
-  snapshot->nodes = parent_snapshot->nodes;
-  snapshot->from_parent = TRUE;
-
   gtk_snapshot_push_state (snapshot,
                            NULL,
                            gtk_snapshot_collect_default);
-
-  return snapshot;
 }
 
 /**
@@ -990,8 +984,7 @@ gtk_snapshot_pop_one (GtkSnapshot *snapshot)
   guint state_index;
   GskRenderNode *node;
 
-  if (snapshot->state_stack->len == 0 &&
-      !snapshot->from_parent)
+  if (snapshot->state_stack->len == 0)
     {
       g_warning ("Too many gtk_snapshot_pop() calls.");
       return NULL;
@@ -1084,17 +1077,13 @@ gtk_snapshot_to_node (GtkSnapshot *snapshot)
   result = gtk_snapshot_pop_internal (snapshot);
 
   /* We should have exactly our initial state */
-  if (snapshot->state_stack->len > 0 &&
-      !snapshot->from_parent)
+  if (snapshot->state_stack->len > 0)
     {
       g_warning ("Too many gtk_snapshot_push() calls. %u states remaining.", snapshot->state_stack->len);
     }
 
-  if (!snapshot->from_parent)
-    {
-      g_array_free (snapshot->state_stack, TRUE);
-      g_ptr_array_free (snapshot->nodes, TRUE);
-    }
+  g_array_free (snapshot->state_stack, TRUE);
+  g_ptr_array_free (snapshot->nodes, TRUE);
 
   snapshot->state_stack = NULL;
   snapshot->nodes = NULL;
@@ -1102,6 +1091,14 @@ gtk_snapshot_to_node (GtkSnapshot *snapshot)
   return result;
 }
 
+/* Private. Returns the node collected since the matching
+ * gtk_snapshot_push_collect() without appending it anywhere. */
+GskRenderNode *
+gtk_snapshot_pop_collect (GtkSnapshot *snapshot)
+{
+  return gtk_snapshot_pop_internal (snapshot);
+}
+
 /**
  * gtk_snapshot_to_paintable:
  * @snapshot: a #GtkSnapshot
@@ -1588,6 +1585,7 @@ gtk_snapshot_render_background (GtkSnapshot     *snapshot,
   gtk_css_boxes_init_border_box (&boxes,
                                  gtk_style_context_lookup_style (context),
                                  x, y, width, height);
+  boxes.scale = gtk_style_context_get_scale (context);
   gtk_css_style_snapshot_background (&boxes, snapshot);
 }
 
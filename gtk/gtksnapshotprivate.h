@@ -88,8 +88,6 @@ struct _GdkSnapshot {
 
   GArray                *state_stack;
   GPtrArray             *nodes;
-
-  guint from_parent : 1;
 };
 
 struct _GtkSnapshotClass {
@@ -99,7 +97,8 @@ struct _GtkSnapshotClass {
 void                    gtk_snapshot_append_node_internal       (GtkSnapshot            *snapshot,
                                                                  GskRenderNode          *node);
 
-GtkSnapshot *           gtk_snapshot_new_with_parent            (GtkSnapshot            *parent_snapshot);
+void                    gtk_snapshot_push_collect               (GtkSnapshot            *snapshot);
+GskRenderNode *         gtk_snapshot_pop_collect                (GtkSnapshot            *snapshot);
 
 void                    gtk_snapshot_append_text                (GtkSnapshot            *snapshot,
                                                                  PangoFont              *font,
@@ -22,8 +22,11 @@
 #include "gtksortlistmodel.h"
 
 #include "gtkintl.h"
+#include "gtklistmodelitemsprivate.h"
 #include "gtkprivate.h"
 
+#include <string.h>
+
 /**
  * SECTION:gtksortlistmodel
  * @title: GtkSortListModel
@@ -38,16 +41,51 @@
  * If you run into performance issues with #GtkSortListModel, it
  * is strongly recommended that you write your own sorting list
  * model.
+ *
+ * Sorting large models can take a while. If #GtkSortListModel:incremental
+ * is set, the model does not sort all items at once but in short steps
+ * from an idle handler, emitting #GListModel::items-changed as parts of
+ * the list get sorted. The #GtkSortListModel:pending property can be
+ * used to show the progress.
+ *
+ * Sort functions often extract the same value from both items on every
+ * comparison. If items can be ordered by a string or a number, setting
+ * a key function with gtk_sort_list_model_set_string_key_func() or
+ * gtk_sort_list_model_set_int_key_func() makes the model extract that
+ * key only once per item and compare the cached keys instead.
  */
 
+/* How long one incremental sorting step may run, in microseconds */
+#define SORT_STEP_TIME 1000
+
 enum {
   PROP_0,
   PROP_HAS_SORT,
+  PROP_INCREMENTAL,
   PROP_ITEM_TYPE,
   PROP_MODEL,
+  PROP_PENDING,
   NUM_PROPERTIES
 };
 
+typedef enum {
+  GTK_SORT_LIST_KEY_NONE,
+  GTK_SORT_LIST_KEY_STRING,
+  GTK_SORT_LIST_KEY_INT
+} GtkSortListKeyType;
+
+typedef struct _GtkSortListEntry GtkSortListEntry;
+
+struct _GtkSortListEntry
+{
+  gpointer item; /* owns a reference */
+  guint position; /* position of item in the model */
+  union {
+    char *collate_key;
+    gint64 number;
+  } key; /* unset if key_type == GTK_SORT_LIST_KEY_NONE */
+};
+
 struct _GtkSortListModel
 {
   GObject parent_instance;
@@ -58,8 +96,35 @@ struct _GtkSortListModel
   gpointer user_data;
   GDestroyNotify user_destroy;
 
-  GSequence *sorted; /* NULL if sort_func == NULL */
-  GSequence *unsorted; /* NULL if sort_func == NULL */
+  GtkSortListKeyType key_type;
+  gpointer key_func;
+  gpointer key_data;
+  GDestroyNotify key_destroy;
+
+  /* GtkSortListEntry in sorted order, NULL if not sorting */
+  GArray *entries;
+
+  gboolean incremental;
+
+  /* State of the incremental sort, a bottom-up merge sort. The runs
+   * of sort_width entries starting at sort_start and sort_start +
+   * sort_width are merged into sort_buffer, and copied back into
+   * entries once the merge is complete. sort_left and sort_right are
+   * the next entries of either run, sort_out the next one to write.
+   */
+  guint sorting : 1;
+  guint sort_moved : 1;
+  guint sort_cb;
+  guint sort_level;
+  guint sort_n_levels;
+  guint sort_width;
+  guint sort_start;
+  guint sort_left;
+  guint sort_left_end;
+  guint sort_right;
+  guint sort_right_end;
+  guint sort_out;
+  GtkSortListEntry *sort_buffer;
 };
 
 struct _GtkSortListModelClass
@@ -69,6 +134,8 @@ struct _GtkSortListModelClass
 
 static GParamSpec *properties[NUM_PROPERTIES] = { NULL, };
 
+#define ENTRIES(self) ((GtkSortListEntry *) (self)->entries->data)
+
 static GType
 gtk_sort_list_model_get_item_type (GListModel *list)
 {
@@ -85,8 +152,8 @@ gtk_sort_list_model_get_n_items (GListModel *list)
   if (self->model == NULL)
     return 0;
 
-  if (self->sorted)
-    return g_sequence_get_length (self->sorted);
+  if (self->entries)
+    return self->entries->len;
 
   return g_list_model_get_n_items (self->model);
 }
@@ -96,19 +163,17 @@ gtk_sort_list_model_get_item (GListModel *list,
                               guint       position)
 {
   GtkSortListModel *self = GTK_SORT_LIST_MODEL (list);
-  GSequenceIter *iter;
 
   if (self->model == NULL)
     return NULL;
 
-  if (self->unsorted == NULL)
+  if (self->entries == NULL)
     return g_list_model_get_item (self->model, position);
 
-  iter = g_sequence_get_iter_at_pos (self->sorted, position);
-  if (g_sequence_iter_is_end (iter))
-      return NULL;
+  if (position >= self->entries->len)
+    return NULL;
 
-  return g_object_ref (g_sequence_get (iter));
+  return g_object_ref (ENTRIES (self)[position].item);
 }
 
 static void
@@ -119,9 +184,136 @@ gtk_sort_list_model_model_init (GListModelInterface *iface)
   iface->get_item = gtk_sort_list_model_get_item;
 }
 
+static guint
+gtk_sort_list_model_get_items (GtkListModelItems *list,
+                               guint              position,
+                               guint              n_items,
+                               gpointer          *items)
+{
+  GtkSortListModel *self = GTK_SORT_LIST_MODEL (list);
+  guint i;
+
+  if (self->model == NULL)
+    return 0;
+
+  if (self->entries == NULL)
+    return gtk_list_model_get_items (self->model, position, n_items, items);
+
+  if (position >= self->entries->len)
+    return 0;
+
+  n_items = MIN (n_items, self->entries->len - position);
+  for (i = 0; i < n_items; i++)
+    items[i] = g_object_ref (ENTRIES (self)[position + i].item);
+
+  return n_items;
+}
+
+static void
+gtk_sort_list_model_items_init (GtkListModelItemsInterface *iface)
+{
+  iface->get_items = gtk_sort_list_model_get_items;
+}
+
 G_DEFINE_TYPE_WITH_CODE (GtkSortListModel, gtk_sort_list_model, G_TYPE_OBJECT,
-                         G_IMPLEMENT_INTERFACE (G_TYPE_LIST_MODEL, gtk_sort_list_model_model_init))
+                         G_IMPLEMENT_INTERFACE (G_TYPE_LIST_MODEL, gtk_sort_list_model_model_init)
+                         G_IMPLEMENT_INTERFACE (GTK_TYPE_LIST_MODEL_ITEMS, gtk_sort_list_model_items_init))
+
+static gboolean
+gtk_sort_list_model_is_sorting (GtkSortListModel *self)
+{
+  return self->sort_func != NULL || self->key_type != GTK_SORT_LIST_KEY_NONE;
+}
+
+static void
+gtk_sort_list_model_init_key (GtkSortListModel *self,
+                              GtkSortListEntry *entry)
+{
+  char *string;
+
+  switch (self->key_type)
+    {
+    case GTK_SORT_LIST_KEY_NONE:
+      break;
+
+    case GTK_SORT_LIST_KEY_STRING:
+      string = ((GtkSortListModelStringKeyFunc) self->key_func) (entry->item, self->key_data);
+      entry->key.collate_key = g_utf8_collate_key (string ? string : "", -1);
+      g_free (string);
+      break;
+
+    case GTK_SORT_LIST_KEY_INT:
+      entry->key.number = ((GtkSortListModelIntKeyFunc) self->key_func) (entry->item, self->key_data);
+      break;
+
+    default:
+      g_assert_not_reached ();
+    }
+}
+
+static void
+gtk_sort_list_model_clear_entry (GtkSortListModel *self,
+                                 GtkSortListEntry *entry)
+{
+  if (self->key_type == GTK_SORT_LIST_KEY_STRING)
+    g_free (entry->key.collate_key);
+
+  g_object_unref (entry->item);
+}
+
+static int
+gtk_sort_list_model_compare_entries (gconstpointer a,
+                                     gconstpointer b,
+                                     gpointer      data)
+{
+  GtkSortListModel *self = data;
+  const GtkSortListEntry *entry_a = a;
+  const GtkSortListEntry *entry_b = b;
+  int result;
+
+  switch (self->key_type)
+    {
+    case GTK_SORT_LIST_KEY_NONE:
+      result = 0;
+      break;
+
+    case GTK_SORT_LIST_KEY_STRING:
+      result = strcmp (entry_a->key.collate_key, entry_b->key.collate_key);
+      break;
+
+    case GTK_SORT_LIST_KEY_INT:
+      result = entry_a->key.number < entry_b->key.number ? -1 : (entry_a->key.number > entry_b->key.number);
+      break;
+
+    default:
+      g_assert_not_reached ();
+      result = 0;
+    }
+
+  /* the sort function orders items with equal keys */
+  if (result != 0 || self->sort_func == NULL)
+    return result;
+
+  return self->sort_func (entry_a->item, entry_b->item, self->user_data);
+}
+
+static void
+gtk_sort_list_model_clear_entries (GtkSortListModel *self)
+{
+  guint i;
+
+  if (self->entries == NULL)
+    return;
+
+  for (i = 0; i < self->entries->len; i++)
+    gtk_sort_list_model_clear_entry (self, &ENTRIES (self)[i]);
 
+  g_clear_pointer (&self->entries, g_array_unref);
+}
+
+/* Removes the entries for the @n_items model items starting at @position.
+ * This needs a single pass over all entries.
+ */
 static void
 gtk_sort_list_model_remove_items (GtkSortListModel *self,
                                   guint             position,
@@ -129,34 +321,59 @@ gtk_sort_list_model_remove_items (GtkSortListModel *self,
                                   guint            *unmodified_start,
                                   guint            *unmodified_end)
 {
-  GSequenceIter *unsorted_iter;
-  guint i, pos, start, end, length_before;
+  GtkSortListEntry *entries = ENTRIES (self);
+  guint i, j, start, end, length_before;
 
-  start = end = length_before = g_sequence_get_length (self->sorted);
-  unsorted_iter = g_sequence_get_iter_at_pos (self->unsorted, position);
+  start = end = length_before = self->entries->len;
 
-  for (i = 0; i < n_items ; i++)
+  if (n_items == 0)
     {
-      GSequenceIter *sorted_iter;
-      GSequenceIter *next;
-
-      next = g_sequence_iter_next (unsorted_iter);
-
-      sorted_iter = g_sequence_get (unsorted_iter);
-      pos = g_sequence_iter_get_position (sorted_iter);
-      start = MIN (start, pos);
-      end = MIN (end, length_before - i - 1 - pos);
+      *unmodified_start = start;
+      *unmodified_end = end;
+      return;
+    }
 
-      g_sequence_remove (sorted_iter);
-      g_sequence_remove (unsorted_iter);
+  for (i = 0, j = 0; i < length_before; i++)
+    {
+      if (entries[i].position >= position + n_items)
+        {
+          entries[i].position -= n_items;
+        }
+      else if (entries[i].position >= position)
+        {
+          start = MIN (start, i);
+          end = MIN (end, length_before - i - 1);
+          gtk_sort_list_model_clear_entry (self, &entries[i]);
+          continue;
+        }
 
-      unsorted_iter = next;
+      entries[j++] = entries[i];
     }
 
+  g_array_set_size (self->entries, j);
+
   *unmodified_start = start;
   *unmodified_end = end;
 }
 
+static void
+gtk_sort_list_model_shift_positions (GtkSortListModel *self,
+                                     guint             position,
+                                     guint             n_items)
+{
+  GtkSortListEntry *entries = ENTRIES (self);
+  guint i;
+
+  for (i = 0; i < self->entries->len; i++)
+    {
+      if (entries[i].position >= position)
+        entries[i].position += n_items;
+    }
+}
+
+/* Adds entries for the @n_items model items starting at @position by
+ * sorting them on their own and merging them with the existing entries.
+ */
 static void
 gtk_sort_list_model_add_items (GtkSortListModel *self,
                                guint             position,
@@ -164,23 +381,51 @@ gtk_sort_list_model_add_items (GtkSortListModel *self,
                                guint            *unmodified_start,
                                guint            *unmodified_end)
 {
-  GSequenceIter *unsorted_iter, *sorted_iter;
-  guint i, pos, start, end, length_before;
+  GtkSortListEntry *old, *added, *merged;
+  GArray *result;
+  guint i, j, k, start, end, length_before;
 
-  unsorted_iter = g_sequence_get_iter_at_pos (self->unsorted, position);
-  start = end = length_before = g_sequence_get_length (self->sorted);
+  length_before = self->entries->len;
+  start = end = length_before;
 
-  for (i = 0; i < n_items; i++)
+  if (n_items > 0)
     {
-      gpointer item = g_list_model_get_item (self->model, position + i);
-      sorted_iter = g_sequence_insert_sorted (self->sorted, item, self->sort_func, self->user_data);
-      g_sequence_insert_before (unsorted_iter, sorted_iter);
-      if (unmodified_start != NULL || unmodified_end != NULL)
+      gtk_sort_list_model_shift_positions (self, position, n_items);
+
+      added = g_new (GtkSortListEntry, n_items);
+      for (k = 0; k < n_items; k++)
+        {
+          added[k].item = g_list_model_get_item (self->model, position + k);
+          added[k].position = position + k;
+          gtk_sort_list_model_init_key (self, &added[k]);
+        }
+      g_qsort_with_data (added, n_items, sizeof (GtkSortListEntry),
+                         gtk_sort_list_model_compare_entries, self);
+
+      result = g_array_sized_new (FALSE, FALSE, sizeof (GtkSortListEntry), length_before + n_items);
+      g_array_set_size (result, length_before + n_items);
+      old = ENTRIES (self);
+      merged = (GtkSortListEntry *) result->data;
+
+      for (i = 0, j = 0, k = 0; k < n_items; j++)
         {
-          pos = g_sequence_iter_get_position (sorted_iter);
-          start = MIN (start, pos);
-          end = MIN (end, length_before + i - pos);
+          if (i < length_before &&
+              gtk_sort_list_model_compare_entries (&old[i], &added[k], self) <= 0)
+            {
+              merged[j] = old[i++];
+            }
+          else
+            {
+              start = MIN (start, j);
+              end = result->len - j - 1;
+              merged[j] = added[k++];
+            }
         }
+      memcpy (&merged[j], &old[i], (length_before - i) * sizeof (GtkSortListEntry));
+
+      g_array_unref (self->entries);
+      self->entries = result;
+      g_free (added);
     }
 
   if (unmodified_start)
@@ -189,6 +434,187 @@ gtk_sort_list_model_add_items (GtkSortListModel *self,
     *unmodified_end = end;
 }
 
+/* Adds entries for the @n_items model items starting at @position
+ * at the end, without sorting them.
+ */
+static void
+gtk_sort_list_model_append_items (GtkSortListModel *self,
+                                  guint             position,
+                                  guint             n_items)
+{
+  GtkSortListEntry entry;
+  guint i;
+
+  gtk_sort_list_model_shift_positions (self, position, n_items);
+
+  for (i = 0; i < n_items; i++)
+    {
+      entry.item = g_list_model_get_item (self->model, position + i);
+      entry.position = position + i;
+      gtk_sort_list_model_init_key (self, &entry);
+      g_array_append_val (self->entries, entry);
+    }
+}
+
+static void
+gtk_sort_list_model_start_merge (GtkSortListModel *self)
+{
+  self->sort_left = self->sort_start;
+  self->sort_left_end = self->sort_start + self->sort_width;
+  self->sort_right = self->sort_left_end;
+  self->sort_right_end = MIN (self->sort_left_end + self->sort_width, self->entries->len);
+  self->sort_out = self->sort_start;
+  self->sort_moved = FALSE;
+}
+
+/* Sorts until @end_time, or until done if @end_time is 0.
+ * Returns %TRUE if there is sorting left to do.
+ */
+static gboolean
+gtk_sort_list_model_sort_step (GtkSortListModel *self,
+                               gint64            end_time)
+{
+  GtkSortListEntry *entries = ENTRIES (self);
+  guint n_items, steps, changed_start, changed_end;
+  gboolean done = FALSE;
+
+  n_items = self->entries->len;
+  changed_start = G_MAXUINT;
+  changed_end = 0;
+
+  for (steps = 1; ; steps++)
+    {
+      if (self->sort_left == self->sort_left_end &&
+          self->sort_right == self->sort_right_end)
+        {
+          if (self->sort_moved)
+            {
+              memcpy (&entries[self->sort_start],
+                      &self->sort_buffer[self->sort_start],
+                      (self->sort_right_end - self->sort_start) * sizeof (GtkSortListEntry));
+              changed_start = MIN (changed_start, self->sort_start);
+              changed_end = MAX (changed_end, self->sort_right_end);
+            }
+
+          self->sort_start += 2 * self->sort_width;
+          if (self->sort_start + self->sort_width >= n_items)
+            {
+              self->sort_level++;
+              self->sort_width *= 2;
+              self->sort_start = 0;
+              if (self->sort_width >= n_items)
+                {
+                  done = TRUE;
+                  break;
+                }
+            }
+          gtk_sort_list_model_start_merge (self);
+        }
+      else if (self->sort_right == self->sort_right_end ||
+               (self->sort_left < self->sort_left_end &&
+                gtk_sort_list_model_compare_entries (&entries[self->sort_left],
+                                                     &entries[self->sort_right],
+                                                     self) <= 0))
+        {
+          self->sort_buffer[self->sort_out++] = entries[self->sort_left++];
+        }
+      else
+        {
+          if (self->sort_left < self->sort_left_end)
+            self->sort_moved = TRUE;
+          self->sort_buffer[self->sort_out++] = entries[self->sort_right++];
+        }
+
+      if (end_time > 0 && steps % 128 == 0 && g_get_monotonic_time () >= end_time)
+        break;
+    }
+
+  if (done)
+    {
+      self->sorting = FALSE;
+      self->sort_cb = 0;
+      g_clear_pointer (&self->sort_buffer, g_free);
+    }
+
+  if (changed_start < changed_end)
+    g_list_model_items_changed (G_LIST_MODEL (self),
+                                changed_start,
+                                changed_end - changed_start,
+                                changed_end - changed_start);
+
+  g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_PENDING]);
+
+  return !done;
+}
+
+static gboolean
+gtk_sort_list_model_sort_cb (gpointer data)
+{
+  GtkSortListModel *self = data;
+
+  if (gtk_sort_list_model_sort_step (self, g_get_monotonic_time () + SORT_STEP_TIME))
+    return G_SOURCE_CONTINUE;
+
+  return G_SOURCE_REMOVE;
+}
+
+static void
+gtk_sort_list_model_stop_sorting (GtkSortListModel *self)
+{
+  if (!self->sorting)
+    return;
+
+  self->sorting = FALSE;
+  if (self->sort_cb != 0)
+    {
+      g_source_remove (self->sort_cb);
+      self->sort_cb = 0;
+    }
+  g_clear_pointer (&self->sort_buffer, g_free);
+
+  g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_PENDING]);
+}
+
+static void
+gtk_sort_list_model_finish_sorting (GtkSortListModel *self)
+{
+  if (!self->sorting)
+    return;
+
+  if (self->sort_cb != 0)
+    {
+      g_source_remove (self->sort_cb);
+      self->sort_cb = 0;
+    }
+
+  gtk_sort_list_model_sort_step (self, 0);
+}
+
+static void
+gtk_sort_list_model_start_sorting (GtkSortListModel *self)
+{
+  guint n_items;
+
+  gtk_sort_list_model_stop_sorting (self);
+
+  n_items = self->entries->len;
+  if (n_items <= 1)
+    return;
+
+  self->sorting = TRUE;
+  self->sort_buffer = g_new (GtkSortListEntry, n_items);
+  self->sort_level = 0;
+  self->sort_n_levels = g_bit_storage (n_items - 1);
+  self->sort_width = 1;
+  self->sort_start = 0;
+  gtk_sort_list_model_start_merge (self);
+
+  self->sort_cb = g_idle_add (gtk_sort_list_model_sort_cb, self);
+  g_source_set_name_by_id (self->sort_cb, "[gtk] gtk_sort_list_model_sort_cb");
+
+  g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_PENDING]);
+}
+
 static void
 gtk_sort_list_model_items_changed_cb (GListModel       *model,
                                       guint             position,
@@ -197,23 +623,40 @@ gtk_sort_list_model_items_changed_cb (GListModel       *model,
                                       GtkSortListModel *self)
 {
   guint n_items, start, end, start2, end2;
+  gboolean was_sorting;
 
   if (removed == 0 && added == 0)
     return;
 
-  if (self->sorted == NULL)
+  if (self->entries == NULL)
     {
       g_list_model_items_changed (G_LIST_MODEL (self), position, removed, added);
       return;
     }
 
+  /* While sorting incrementally, the entries are not sorted yet, so
+   * new items are appended and the sort starts over.
+   */
+  was_sorting = self->sorting;
+  gtk_sort_list_model_stop_sorting (self);
+
   gtk_sort_list_model_remove_items (self, position, removed, &start, &end);
-  gtk_sort_list_model_add_items (self, position, added, &start2, &end2);
+  if (was_sorting)
+    {
+      start2 = self->entries->len;
+      end2 = 0;
+      gtk_sort_list_model_append_items (self, position, added);
+    }
+  else
+    gtk_sort_list_model_add_items (self, position, added, &start2, &end2);
   start = MIN (start, start2);
   end = MIN (end, end2);
 
-  n_items = g_sequence_get_length (self->sorted) - start - end;
+  n_items = self->entries->len - start - end;
   g_list_model_items_changed (G_LIST_MODEL (self), start, n_items - added + removed, n_items);
+
+  if (was_sorting)
+    gtk_sort_list_model_start_sorting (self);
 }
 
 static void
@@ -226,6 +669,10 @@ gtk_sort_list_model_set_property (GObject      *object,
 
   switch (prop_id)
     {
+    case PROP_INCREMENTAL:
+      gtk_sort_list_model_set_incremental (self, g_value_get_boolean (value));
+      break;
+
     case PROP_ITEM_TYPE:
       self->item_type = g_value_get_gtype (value);
       break;
@@ -251,7 +698,11 @@ gtk_sort_list_model_get_property (GObject     *object,
   switch (prop_id)
     {
     case PROP_HAS_SORT:
-      g_value_set_boolean (value, self->sort_func != NULL);
+      g_value_set_boolean (value, gtk_sort_list_model_is_sorting (self));
+      break;
+
+    case PROP_INCREMENTAL:
+      g_value_set_boolean (value, self->incremental);
       break;
 
     case PROP_ITEM_TYPE:
@@ -262,6 +713,10 @@ gtk_sort_list_model_get_property (GObject     *object,
       g_value_set_object (value, self->model);
       break;
 
+    case PROP_PENDING:
+      g_value_set_uint (value, gtk_sort_list_model_get_pending (self));
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -274,10 +729,10 @@ gtk_sort_list_model_clear_model (GtkSortListModel *self)
   if (self->model == NULL)
     return;
 
+  gtk_sort_list_model_stop_sorting (self);
   g_signal_handlers_disconnect_by_func (self->model, gtk_sort_list_model_items_changed_cb, self);
   g_clear_object (&self->model);
-  g_clear_pointer (&self->sorted, g_sequence_free);
-  g_clear_pointer (&self->unsorted, g_sequence_free);
+  gtk_sort_list_model_clear_entries (self);
 }
 
 static void
@@ -291,6 +746,12 @@ gtk_sort_list_model_dispose (GObject *object)
   self->sort_func = NULL;
   self->user_data = NULL;
   self->user_destroy = NULL;
+  if (self->key_destroy)
+    self->key_destroy (self->key_data);
+  self->key_type = GTK_SORT_LIST_KEY_NONE;
+  self->key_func = NULL;
+  self->key_data = NULL;
+  self->key_destroy = NULL;
 
   G_OBJECT_CLASS (gtk_sort_list_model_parent_class)->dispose (object);
 };
@@ -316,6 +777,18 @@ gtk_sort_list_model_class_init (GtkSortListModelClass *class)
                             FALSE,
                             GTK_PARAM_READABLE | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * GtkSortListModel:incremental:
+   *
+   * If the model should sort items incrementally
+   */
+  properties[PROP_INCREMENTAL] =
+      g_param_spec_boolean ("incremental",
+                            P_("Incremental"),
+                            P_("Sort items incrementally"),
+                            FALSE,
+                            GTK_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   /**
    * GtkSortListModel:item-type:
    *
@@ -340,6 +813,18 @@ gtk_sort_list_model_class_init (GtkSortListModelClass *class)
                            G_TYPE_LIST_MODEL,
                            GTK_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * GtkSortListModel:pending:
+   *
+   * Estimate of the number of items that still need to be sorted
+   */
+  properties[PROP_PENDING] =
+      g_param_spec_uint ("pending",
+                         P_("Pending"),
+                         P_("Estimate of the number of items that still need to be sorted"),
+                         0, G_MAXUINT, 0,
+                         GTK_PARAM_READABLE | G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_install_properties (gobject_class, NUM_PROPERTIES, properties);
 }
 
@@ -402,15 +887,20 @@ gtk_sort_list_model_new_for_type (GType item_type)
 }
 
 static void
-gtk_sort_list_model_create_sequences (GtkSortListModel *self)
+gtk_sort_list_model_create_entries (GtkSortListModel *self)
 {
-  if (!self->sort_func || self->model == NULL)
+  if (!gtk_sort_list_model_is_sorting (self) || self->model == NULL)
     return;
 
-  self->sorted = g_sequence_new (g_object_unref);
-  self->unsorted = g_sequence_new (NULL);
+  self->entries = g_array_new (FALSE, FALSE, sizeof (GtkSortListEntry));
 
-  gtk_sort_list_model_add_items (self, 0, g_list_model_get_n_items (self->model), NULL, NULL);
+  if (self->incremental)
+    {
+      gtk_sort_list_model_append_items (self, 0, g_list_model_get_n_items (self->model));
+      gtk_sort_list_model_start_sorting (self);
+    }
+  else
+    gtk_sort_list_model_add_items (self, 0, g_list_model_get_n_items (self->model), NULL, NULL);
 }
 
 /**
@@ -431,6 +921,7 @@ gtk_sort_list_model_set_sort_func (GtkSortListModel *self,
                                    gpointer          user_data,
                                    GDestroyNotify    user_destroy)
 {
+  gboolean had_sort;
   guint n_items;
 
   g_return_if_fail (GTK_IS_SORT_LIST_MODEL (self));
@@ -442,19 +933,120 @@ gtk_sort_list_model_set_sort_func (GtkSortListModel *self,
   if (self->user_destroy)
     self->user_destroy (self->user_data);
 
-  g_clear_pointer (&self->unsorted, g_sequence_free);
-  g_clear_pointer (&self->sorted, g_sequence_free);
+  had_sort = gtk_sort_list_model_is_sorting (self);
+  gtk_sort_list_model_stop_sorting (self);
+  gtk_sort_list_model_clear_entries (self);
   self->sort_func = sort_func;
   self->user_data = user_data;
   self->user_destroy = user_destroy;
   
-    gtk_sort_list_model_create_sequences (self);
+    gtk_sort_list_model_create_entries (self);
     
   n_items = g_list_model_get_n_items (G_LIST_MODEL (self));
   if (n_items > 1)
     g_list_model_items_changed (G_LIST_MODEL (self), 0, n_items, n_items);
 
-  g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_HAS_SORT]);
+  if (had_sort != gtk_sort_list_model_is_sorting (self))
+    g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_HAS_SORT]);
+}
+
+static void
+gtk_sort_list_model_set_key_func (GtkSortListModel   *self,
+                                  GtkSortListKeyType  key_type,
+                                  gpointer            key_func,
+                                  gpointer            user_data,
+                                  GDestroyNotify      user_destroy)
+{
+  gboolean had_sort;
+  guint n_items;
+
+  if (key_func == NULL && self->key_func == NULL)
+    return;
+
+  if (self->key_destroy)
+    self->key_destroy (self->key_data);
+
+  had_sort = gtk_sort_list_model_is_sorting (self);
+  gtk_sort_list_model_stop_sorting (self);
+  gtk_sort_list_model_clear_entries (self);
+  self->key_type = key_func ? key_type : GTK_SORT_LIST_KEY_NONE;
+  self->key_func = key_func;
+  self->key_data = user_data;
+  self->key_destroy = user_destroy;
+
+  gtk_sort_list_model_create_entries (self);
+
+  n_items = g_list_model_get_n_items (G_LIST_MODEL (self));
+  if (n_items > 1)
+    g_list_model_items_changed (G_LIST_MODEL (self), 0, n_items, n_items);
+
+  if (had_sort != gtk_sort_list_model_is_sorting (self))
+    g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_HAS_SORT]);
+}
+
+/**
+ * gtk_sort_list_model_set_string_key_func:
+ * @self: a #GtkSortListModel
+ * @key_func: (allow-none): function returning the string to sort an
+ *     item by, or %NULL to unset the key function
+ * @user_data: user data passed to @key_func
+ * @user_destroy: destroy notifier for @user_data
+ *
+ * Sets a function that returns the string that an item is sorted by.
+ * It is called once for every item, and items are then ordered by
+ * comparing the collation keys of these strings, as returned by
+ * g_utf8_collate_key(), without calling any function.
+ *
+ * If a sort function is set as well, it is used to order items with
+ * equal keys.
+ *
+ * The keys are computed again by gtk_sort_list_model_resort().
+ *
+ * This replaces any key function set with
+ * gtk_sort_list_model_set_int_key_func().
+ **/
+void
+gtk_sort_list_model_set_string_key_func (GtkSortListModel              *self,
+                                         GtkSortListModelStringKeyFunc  key_func,
+                                         gpointer                       user_data,
+                                         GDestroyNotify                 user_destroy)
+{
+  g_return_if_fail (GTK_IS_SORT_LIST_MODEL (self));
+  g_return_if_fail (key_func != NULL || (user_data == NULL && !user_destroy));
+
+  gtk_sort_list_model_set_key_func (self, GTK_SORT_LIST_KEY_STRING, key_func, user_data, user_destroy);
+}
+
+/**
+ * gtk_sort_list_model_set_int_key_func:
+ * @self: a #GtkSortListModel
+ * @key_func: (allow-none): function returning the number to sort an
+ *     item by, or %NULL to unset the key function
+ * @user_data: user data passed to @key_func
+ * @user_destroy: destroy notifier for @user_data
+ *
+ * Sets a function that returns the number that an item is sorted by.
+ * It is called once for every item, and items are then ordered by
+ * these numbers, without calling any function.
+ *
+ * If a sort function is set as well, it is used to order items with
+ * equal keys.
+ *
+ * The keys are computed again by gtk_sort_list_model_resort().
+ *
+ * This replaces any key function set with
+ * gtk_sort_list_model_set_string_key_func().
+ **/
+void
+gtk_sort_list_model_set_int_key_func (GtkSortListModel           *self,
+                                      GtkSortListModelIntKeyFunc  key_func,
+                                      gpointer                    user_data,
+                                      GDestroyNotify              user_destroy)
+{
+  g_return_if_fail (GTK_IS_SORT_LIST_MODEL (self));
+  g_return_if_fail (key_func != NULL || (user_data == NULL && !user_destroy));
+
+  gtk_sort_list_model_set_key_func (self, GTK_SORT_LIST_KEY_INT, key_func, user_data, user_destroy);
 }
 
 /**
@@ -490,7 +1082,7 @@ gtk_sort_list_model_set_model (GtkSortListModel *self,
       g_signal_connect (model, "items-changed", G_CALLBACK (gtk_sort_list_model_items_changed_cb), self);
       added = g_list_model_get_n_items (model);
 
-      gtk_sort_list_model_create_sequences (self);
+      gtk_sort_list_model_create_entries (self);
     }
   else
     added = 0;
@@ -530,7 +1122,7 @@ gtk_sort_list_model_has_sort (GtkSortListModel *self)
 {
   g_return_val_if_fail (GTK_IS_SORT_LIST_MODEL (self), FALSE);
 
-  return self->sort_func != NULL;
+  return gtk_sort_list_model_is_sorting (self);
 }
 
 /**
@@ -549,15 +1141,125 @@ gtk_sort_list_model_resort (GtkSortListModel *self)
 
   g_return_if_fail (GTK_IS_SORT_LIST_MODEL (self));
   
-  if (self->sorted == NULL)
+  if (self->entries == NULL)
     return;
 
   n_items = g_list_model_get_n_items (self->model);
   if (n_items <= 1)
     return;
 
-  g_sequence_sort (self->sorted, self->sort_func, self->user_data);
+  if (self->key_type != GTK_SORT_LIST_KEY_NONE)
+    {
+      GtkSortListEntry *entries = ENTRIES (self);
+      guint i;
+
+      for (i = 0; i < self->entries->len; i++)
+        {
+          if (self->key_type == GTK_SORT_LIST_KEY_STRING)
+            g_free (entries[i].key.collate_key);
+          gtk_sort_list_model_init_key (self, &entries[i]);
+        }
+    }
+
+  if (self->incremental)
+    {
+      gtk_sort_list_model_start_sorting (self);
+      return;
+    }
+
+  gtk_sort_list_model_stop_sorting (self);
+  g_qsort_with_data (self->entries->data, self->entries->len, sizeof (GtkSortListEntry),
+                     gtk_sort_list_model_compare_entries, self);
 
   g_list_model_items_changed (G_LIST_MODEL (self), 0, n_items, n_items);
 }
 
+/**
+ * gtk_sort_list_model_set_incremental:
+ * @self: a #GtkSortListModel
+ * @incremental: %TRUE to sort incrementally
+ *
+ * Sets the sort model to do an incremental sort.
+ *
+ * When incremental sorting is enabled, the sortlistmodel will not do
+ * a complete sort immediately when it needs to sort, but will instead
+ * sort in short steps from an idle handler. The items stay available
+ * in their previous order meanwhile and #GListModel::items-changed is
+ * emitted for the parts that got sorted after every step.
+ *
+ * Until sorting is done, items added to the model are put at the end
+ * and sorting starts over.
+ *
+ * By default, incremental sorting is disabled. Disabling it while a
+ * sort is in progress finishes the sort right away.
+ *
+ * See gtk_sort_list_model_get_pending() for progress information
+ * about an ongoing incremental sorting operation.
+ **/
+void
+gtk_sort_list_model_set_incremental (GtkSortListModel *self,
+                                     gboolean          incremental)
+{
+  g_return_if_fail (GTK_IS_SORT_LIST_MODEL (self));
+
+  incremental = incremental != FALSE;
+
+  if (self->incremental == incremental)
+    return;
+
+  self->incremental = incremental;
+
+  if (!incremental)
+    gtk_sort_list_model_finish_sorting (self);
+
+  g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_INCREMENTAL]);
+}
+
+/**
+ * gtk_sort_list_model_get_incremental:
+ * @self: a #GtkSortListModel
+ *
+ * Returns whether incremental sorting was enabled via
+ * gtk_sort_list_model_set_incremental().
+ *
+ * Returns: %TRUE if incremental sorting is enabled
+ **/
+gboolean
+gtk_sort_list_model_get_incremental (GtkSortListModel *self)
+{
+  g_return_val_if_fail (GTK_IS_SORT_LIST_MODEL (self), FALSE);
+
+  return self->incremental;
+}
+
+/**
+ * gtk_sort_list_model_get_pending:
+ * @self: a #GtkSortListModel
+ *
+ * Estimates the number of items that still need to be sorted
+ * by an ongoing incremental sort. If no sort is in progress,
+ * 0 is returned.
+ *
+ * This value is meant to give an idea of the progress, for example
+ * in a progress bar. It is not an exact count and goes down
+ * towards 0 while sorting progresses.
+ *
+ * Returns: an estimate of the items left to sort
+ **/
+guint
+gtk_sort_list_model_get_pending (GtkSortListModel *self)
+{
+  guint64 n_items, done;
+
+  g_return_val_if_fail (GTK_IS_SORT_LIST_MODEL (self), 0);
+
+  if (!self->sorting)
+    return 0;
+
+  /* every level of the merge sort touches all items once */
+  n_items = self->entries->len;
+  done = self->sort_level * n_items + self->sort_out;
+
+  return MIN (self->sort_n_levels * n_items - MIN (done, self->sort_n_levels * n_items), G_MAXUINT);
+}
+
@@ -36,6 +36,30 @@ G_BEGIN_DECLS
 GDK_AVAILABLE_IN_ALL
 G_DECLARE_FINAL_TYPE (GtkSortListModel, gtk_sort_list_model, GTK, SORT_LIST_MODEL, GObject)
 
+/**
+ * GtkSortListModelStringKeyFunc:
+ * @item: (type GObject): the item to get the key for
+ * @user_data: user data
+ *
+ * User function that returns the string that @item gets sorted by,
+ * see gtk_sort_list_model_set_string_key_func().
+ *
+ * Returns: (transfer full) (nullable): the string to sort @item by
+ */
+typedef char * (* GtkSortListModelStringKeyFunc) (gpointer item, gpointer user_data);
+
+/**
+ * GtkSortListModelIntKeyFunc:
+ * @item: (type GObject): the item to get the key for
+ * @user_data: user data
+ *
+ * User function that returns the number that @item gets sorted by,
+ * see gtk_sort_list_model_set_int_key_func().
+ *
+ * Returns: the number to sort @item by
+ */
+typedef gint64 (* GtkSortListModelIntKeyFunc) (gpointer item, gpointer user_data);
+
 GDK_AVAILABLE_IN_ALL
 GtkSortListModel *      gtk_sort_list_model_new                 (GListModel             *model,
                                                                  GCompareDataFunc        sort_func,
@@ -50,6 +74,16 @@ void                    gtk_sort_list_model_set_sort_func       (GtkSortListMode
                                                                  gpointer                user_data,
                                                                  GDestroyNotify          user_destroy);
 GDK_AVAILABLE_IN_ALL
+void                    gtk_sort_list_model_set_string_key_func (GtkSortListModel       *self,
+                                                                 GtkSortListModelStringKeyFunc key_func,
+                                                                 gpointer                user_data,
+                                                                 GDestroyNotify          user_destroy);
+GDK_AVAILABLE_IN_ALL
+void                    gtk_sort_list_model_set_int_key_func    (GtkSortListModel       *self,
+                                                                 GtkSortListModelIntKeyFunc key_func,
+                                                                 gpointer                user_data,
+                                                                 GDestroyNotify          user_destroy);
+GDK_AVAILABLE_IN_ALL
 gboolean                gtk_sort_list_model_has_sort            (GtkSortListModel       *self);
 GDK_AVAILABLE_IN_ALL
 void                    gtk_sort_list_model_set_model           (GtkSortListModel       *self,
@@ -60,6 +94,14 @@ GListModel *            gtk_sort_list_model_get_model           (GtkSortListMode
 GDK_AVAILABLE_IN_ALL
 void                    gtk_sort_list_model_resort              (GtkSortListModel       *self);
 
+GDK_AVAILABLE_IN_ALL
+void                    gtk_sort_list_model_set_incremental     (GtkSortListModel       *self,
+                                                                 gboolean                incremental);
+GDK_AVAILABLE_IN_ALL
+gboolean                gtk_sort_list_model_get_incremental     (GtkSortListModel       *self);
+GDK_AVAILABLE_IN_ALL
+guint                   gtk_sort_list_model_get_pending         (GtkSortListModel       *self);
+
 G_END_DECLS
 
 #endif /* __GTK_SORT_LIST_MODEL_H__ */
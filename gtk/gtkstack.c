@@ -26,6 +26,7 @@
 #include "gtkprivate.h"
 #include "gtkintl.h"
 #include "gtkcontainerprivate.h"
+#include "gtkcssnodeprivate.h"
 #include "gtkprogresstrackerprivate.h"
 #include "gtksettingsprivate.h"
 #include "gtksnapshot.h"
@@ -129,6 +130,8 @@ typedef struct {
   GtkStackPage *last_visible_child;
   GskRenderNode *last_visible_node;
   GtkAllocation last_visible_surface_allocation;
+  gint last_visible_stack_width;
+  gint last_visible_stack_height;
   guint tick_id;
   GtkProgressTracker tracker;
   gboolean first_frame_skipped;
@@ -138,6 +141,10 @@ typedef struct {
 
   gboolean interpolate_size;
 
+  gboolean lazy_pages;
+  gint placeholder_width;
+  gint placeholder_height;
+
   GtkStackTransitionType active_transition_type;
 
   GtkSelectionModel *pages;
@@ -162,6 +169,9 @@ enum  {
   PROP_TRANSITION_RUNNING,
   PROP_INTERPOLATE_SIZE,
   PROP_PAGES,
+  PROP_LAZY_PAGES,
+  PROP_PLACEHOLDER_WIDTH,
+  PROP_PLACEHOLDER_HEIGHT,
   LAST_PROP
 };
 
@@ -185,6 +195,7 @@ struct _GtkStackPage {
   gchar *icon_name;
   gboolean needs_attention;
   gboolean visible;
+  gboolean was_shown;
   GtkWidget *last_focus;
 };
 
@@ -629,6 +640,7 @@ gtk_stack_get_property (GObject   *object,
                         GParamSpec *pspec)
 {
   GtkStack *stack = GTK_STACK (object);
+  GtkStackPrivate *priv = gtk_stack_get_instance_private (stack);
 
   switch (property_id)
     {
@@ -662,6 +674,15 @@ gtk_stack_get_property (GObject   *object,
     case PROP_PAGES:
       g_value_set_object (value, gtk_stack_get_pages (stack));
       break;
+    case PROP_LAZY_PAGES:
+      g_value_set_boolean (value, gtk_stack_get_lazy_pages (stack));
+      break;
+    case PROP_PLACEHOLDER_WIDTH:
+      g_value_set_int (value, priv->placeholder_width);
+      break;
+    case PROP_PLACEHOLDER_HEIGHT:
+      g_value_set_int (value, priv->placeholder_height);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -675,6 +696,7 @@ gtk_stack_set_property (GObject     *object,
                         GParamSpec   *pspec)
 {
   GtkStack *stack = GTK_STACK (object);
+  GtkStackPrivate *priv = gtk_stack_get_instance_private (stack);
 
   switch (property_id)
     {
@@ -702,6 +724,15 @@ gtk_stack_set_property (GObject     *object,
     case PROP_INTERPOLATE_SIZE:
       gtk_stack_set_interpolate_size (stack, g_value_get_boolean (value));
       break;
+    case PROP_LAZY_PAGES:
+      gtk_stack_set_lazy_pages (stack, g_value_get_boolean (value));
+      break;
+    case PROP_PLACEHOLDER_WIDTH:
+      gtk_stack_set_placeholder_size (stack, g_value_get_int (value), priv->placeholder_height);
+      break;
+    case PROP_PLACEHOLDER_HEIGHT:
+      gtk_stack_set_placeholder_size (stack, priv->placeholder_width, g_value_get_int (value));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -783,6 +814,25 @@ gtk_stack_class_init (GtkStackClass *klass)
                            GTK_TYPE_SELECTION_MODEL,
                            GTK_PARAM_READABLE);
 
+  /**
+   * GtkStack:lazy-pages:
+   *
+   * Whether pages that have never been visible are left out of
+   * styling and homogeneous sizing. See gtk_stack_set_lazy_pages().
+   */
+  stack_props[PROP_LAZY_PAGES] =
+      g_param_spec_boolean ("lazy-pages", P_("Lazy pages"), P_("Whether pages are only styled and measured once they have been visible"),
+                            FALSE,
+                            GTK_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+  stack_props[PROP_PLACEHOLDER_WIDTH] =
+      g_param_spec_int ("placeholder-width", P_("Placeholder width"), P_("The width to reserve for pages that have not been visible yet, or -1"),
+                        -1, G_MAXINT, -1,
+                        GTK_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+  stack_props[PROP_PLACEHOLDER_HEIGHT] =
+      g_param_spec_int ("placeholder-height", P_("Placeholder height"), P_("The height to reserve for pages that have not been visible yet, or -1"),
+                        -1, G_MAXINT, -1,
+                        GTK_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_install_properties (object_class, LAST_PROP, stack_props);
 
 
@@ -821,6 +871,29 @@ find_child_info_for_widget (GtkStack  *stack,
   return NULL;
 }
 
+/* With lazy pages, pages that have never been visible are
+ * neither styled nor measured */
+static gboolean
+is_lazy_page (GtkStack     *stack,
+              GtkStackPage *child_info)
+{
+  GtkStackPrivate *priv = gtk_stack_get_instance_private (stack);
+
+  return priv->lazy_pages &&
+         !child_info->was_shown &&
+         child_info != priv->visible_child;
+}
+
+/* Invisible CSS nodes are skipped when styles are validated */
+static void
+update_page_styled (GtkStack     *stack,
+                    GtkStackPage *child_info)
+{
+  gtk_css_node_set_visible (gtk_widget_get_css_node (child_info->widget),
+                            gtk_widget_get_visible (child_info->widget) &&
+                            !is_lazy_page (stack, child_info));
+}
+
 static inline gboolean
 is_left_transition (GtkStackTransitionType transition_type)
 {
@@ -961,10 +1034,9 @@ gtk_stack_progress_updated (GtkStack *stack)
 {
   GtkStackPrivate *priv = gtk_stack_get_instance_private (stack);
 
+  /* Children are moved in the snapshot, not by allocating them */
   if (!priv->vhomogeneous || !priv->hhomogeneous)
     gtk_widget_queue_resize (GTK_WIDGET (stack));
-  else if (is_window_moving_transition (priv->active_transition_type))
-    gtk_widget_queue_allocate (GTK_WIDGET (stack));
   else
     gtk_widget_queue_draw (GTK_WIDGET (stack));
 
@@ -1213,6 +1285,8 @@ set_visible_child (GtkStack               *stack,
 
   if (child_info)
     {
+      child_info->was_shown = TRUE;
+      update_page_styled (stack, child_info);
       gtk_widget_set_child_visible (child_info->widget, TRUE);
 
       if (contains_focus)
@@ -1284,6 +1358,10 @@ stack_child_visibility_notify_cb (GObject    *obj,
 
   child_info = find_child_info_for_widget (stack, child);
 
+  /* Showing the widget made its CSS node visible again */
+  if (child_info && is_lazy_page (stack, child_info))
+    update_page_styled (stack, child_info);
+
   if (priv->visible_child == NULL &&
       gtk_widget_get_visible (child))
     set_visible_child (stack, child_info, priv->transition_type, priv->transition_duration);
@@ -1404,6 +1482,7 @@ gtk_stack_add_page (GtkStack     *stack,
 
   gtk_widget_set_child_visible (child_info->widget, FALSE);
   gtk_widget_set_parent (child_info->widget, GTK_WIDGET (stack));
+  update_page_styled (stack, child_info);
 
   if (priv->pages)
     g_list_model_items_changed (G_LIST_MODEL (priv->pages), g_list_length (priv->children) - 1, 0, 1);
@@ -1442,6 +1521,9 @@ stack_remove (GtkStack  *stack,
 
   g_clear_object (&child_info->widget);
 
+  /* The widget may be reused elsewhere */
+  gtk_css_node_set_visible (gtk_widget_get_css_node (child), was_visible);
+
   if (priv->visible_child == child_info)
     {
       if (in_dispose)
@@ -1869,6 +1951,129 @@ gtk_stack_get_interpolate_size (GtkStack *stack)
   return priv->interpolate_size;
 }
 
+/**
+ * gtk_stack_set_lazy_pages:
+ * @stack: a #GtkStack
+ * @lazy_pages: %TRUE to leave pages alone until they are first shown
+ *
+ * Sets whether pages of @stack that have never been the visible
+ * child are styled and measured.
+ *
+ * Normally a homogeneous stack measures all of its pages, and all of
+ * them get styled for that. With lazy pages, a page is only styled and
+ * taken into account for homogeneous sizing once it has been visible.
+ * This makes stacks with many complex pages cheaper to create, at the
+ * expense of the stack growing when a larger page is shown for the
+ * first time. See gtk_stack_set_placeholder_size() for reserving
+ * space for such pages.
+ */
+void
+gtk_stack_set_lazy_pages (GtkStack *stack,
+                          gboolean  lazy_pages)
+{
+  GtkStackPrivate *priv = gtk_stack_get_instance_private (stack);
+  GList *l;
+
+  g_return_if_fail (GTK_IS_STACK (stack));
+
+  lazy_pages = !!lazy_pages;
+
+  if (priv->lazy_pages == lazy_pages)
+    return;
+
+  priv->lazy_pages = lazy_pages;
+
+  for (l = priv->children; l != NULL; l = l->next)
+    update_page_styled (stack, l->data);
+
+  if (priv->hhomogeneous || priv->vhomogeneous)
+    gtk_widget_queue_resize (GTK_WIDGET (stack));
+
+  g_object_notify_by_pspec (G_OBJECT (stack), stack_props[PROP_LAZY_PAGES]);
+}
+
+/**
+ * gtk_stack_get_lazy_pages:
+ * @stack: a #GtkStack
+ *
+ * Returns whether pages are only styled and measured once they
+ * have been visible. See gtk_stack_set_lazy_pages().
+ *
+ * Returns: %TRUE if pages are left alone until they are first shown
+ */
+gboolean
+gtk_stack_get_lazy_pages (GtkStack *stack)
+{
+  GtkStackPrivate *priv = gtk_stack_get_instance_private (stack);
+  g_return_val_if_fail (GTK_IS_STACK (stack), FALSE);
+
+  return priv->lazy_pages;
+}
+
+/**
+ * gtk_stack_set_placeholder_size:
+ * @stack: a #GtkStack
+ * @width: width to reserve, or -1 to reserve none
+ * @height: height to reserve, or -1 to reserve none
+ *
+ * Sets the size that a homogeneous @stack requests at least for
+ * pages that are not measured yet, because #GtkStack:lazy-pages is
+ * set and they have never been visible.
+ */
+void
+gtk_stack_set_placeholder_size (GtkStack *stack,
+                                gint      width,
+                                gint      height)
+{
+  GtkStackPrivate *priv = gtk_stack_get_instance_private (stack);
+
+  g_return_if_fail (GTK_IS_STACK (stack));
+  g_return_if_fail (width >= -1 && height >= -1);
+
+  g_object_freeze_notify (G_OBJECT (stack));
+
+  if (priv->placeholder_width != width)
+    {
+      priv->placeholder_width = width;
+      g_object_notify_by_pspec (G_OBJECT (stack), stack_props[PROP_PLACEHOLDER_WIDTH]);
+    }
+
+  if (priv->placeholder_height != height)
+    {
+      priv->placeholder_height = height;
+      g_object_notify_by_pspec (G_OBJECT (stack), stack_props[PROP_PLACEHOLDER_HEIGHT]);
+    }
+
+  g_object_thaw_notify (G_OBJECT (stack));
+
+  if (priv->lazy_pages)
+    gtk_widget_queue_resize (GTK_WIDGET (stack));
+}
+
+/**
+ * gtk_stack_get_placeholder_size:
+ * @stack: a #GtkStack
+ * @width: (out) (optional): return location for the width, or %NULL
+ * @height: (out) (optional): return location for the height, or %NULL
+ *
+ * Gets the size reserved for pages that have not been measured yet.
+ * See gtk_stack_set_placeholder_size().
+ */
+void
+gtk_stack_get_placeholder_size (GtkStack *stack,
+                                gint     *width,
+                                gint     *height)
+{
+  GtkStackPrivate *priv = gtk_stack_get_instance_private (stack);
+
+  g_return_if_fail (GTK_IS_STACK (stack));
+
+  if (width)
+    *width = priv->placeholder_width;
+  if (height)
+    *height = priv->placeholder_height;
+}
+
 
 
 /**
@@ -2229,9 +2434,21 @@ gtk_stack_snapshot_slide (GtkWidget   *widget,
       gtk_snapshot_restore (snapshot);
      }
 
-  gtk_widget_snapshot_child (widget,
-                             priv->visible_child->widget,
-                             snapshot);
+  if (is_window_moving_transition (priv->active_transition_type))
+    {
+      gtk_snapshot_save (snapshot);
+      gtk_snapshot_translate (snapshot, &GRAPHENE_POINT_INIT (
+                              get_bin_window_x (stack),
+                              get_bin_window_y (stack)));
+      gtk_widget_snapshot_child (widget,
+                                 priv->visible_child->widget,
+                                 snapshot);
+      gtk_snapshot_restore (snapshot);
+    }
+  else
+    gtk_widget_snapshot_child (widget,
+                               priv->visible_child->widget,
+                               snapshot);
 }
 
 static void
@@ -2255,6 +2472,8 @@ gtk_stack_snapshot (GtkWidget   *widget,
               last_visible_snapshot = gtk_snapshot_new ();
               gtk_widget_snapshot (priv->last_visible_child->widget, last_visible_snapshot);
               priv->last_visible_node = gtk_snapshot_free_to_node (last_visible_snapshot);
+              priv->last_visible_stack_width = gtk_widget_get_width (widget);
+              priv->last_visible_stack_height = gtk_widget_get_height (widget);
             }
 
           gtk_snapshot_push_clip (snapshot,
@@ -2315,10 +2534,15 @@ gtk_stack_size_allocate (GtkWidget *widget,
   GtkStackPrivate *priv = gtk_stack_get_instance_private (stack);
   GtkAllocation child_allocation;
 
-  child_allocation.x = get_bin_window_x (stack);
-  child_allocation.y = get_bin_window_y (stack);
+  child_allocation.x = 0;
+  child_allocation.y = 0;
 
-  if (priv->last_visible_child)
+  /* The outgoing child is only drawn from last_visible_node, so it
+   * needs no layout until the stack changes size */
+  if (priv->last_visible_child &&
+      (priv->last_visible_node == NULL ||
+       priv->last_visible_stack_width != width ||
+       priv->last_visible_stack_height != height))
     {
       int min, nat;
 
@@ -2395,6 +2619,7 @@ gtk_stack_measure (GtkWidget      *widget,
   GtkStackPage *child_info;
   GtkWidget *child;
   gint child_min, child_nat;
+  gboolean skipped_lazy_pages = FALSE;
   GList *l;
 
   *minimum = 0;
@@ -2412,6 +2637,12 @@ gtk_stack_measure (GtkWidget      *widget,
 
       if (gtk_widget_get_visible (child))
         {
+          if (is_lazy_page (stack, child_info))
+            {
+              skipped_lazy_pages = TRUE;
+              continue;
+            }
+
           gtk_widget_measure (child, orientation, for_size, &child_min, &child_nat, NULL, NULL);
 
           *minimum = MAX (*minimum, child_min);
@@ -2419,6 +2650,16 @@ gtk_stack_measure (GtkWidget      *widget,
         }
     }
 
+  if (skipped_lazy_pages)
+    {
+      gint placeholder = orientation == GTK_ORIENTATION_HORIZONTAL
+                         ? priv->placeholder_width
+                         : priv->placeholder_height;
+
+      *minimum = MAX (*minimum, placeholder);
+      *natural = MAX (*natural, placeholder);
+    }
+
   if (priv->last_visible_child != NULL)
     {
       if (orientation == GTK_ORIENTATION_VERTICAL && !priv->vhomogeneous)
@@ -2447,6 +2688,8 @@ gtk_stack_init (GtkStack *stack)
   priv->hhomogeneous = TRUE;
   priv->transition_duration = 200;
   priv->transition_type = GTK_STACK_TRANSITION_TYPE_NONE;
+  priv->placeholder_width = -1;
+  priv->placeholder_height = -1;
 }
 
 /**
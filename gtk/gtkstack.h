@@ -157,6 +157,20 @@ void                   gtk_stack_set_interpolate_size    (GtkStack *stack,
 GDK_AVAILABLE_IN_ALL
 gboolean               gtk_stack_get_interpolate_size    (GtkStack *stack);
 
+GDK_AVAILABLE_IN_ALL
+void                   gtk_stack_set_lazy_pages          (GtkStack *stack,
+                                                          gboolean  lazy_pages);
+GDK_AVAILABLE_IN_ALL
+gboolean               gtk_stack_get_lazy_pages          (GtkStack *stack);
+GDK_AVAILABLE_IN_ALL
+void                   gtk_stack_set_placeholder_size    (GtkStack *stack,
+                                                          gint      width,
+                                                          gint      height);
+GDK_AVAILABLE_IN_ALL
+void                   gtk_stack_get_placeholder_size    (GtkStack *stack,
+                                                          gint     *width,
+                                                          gint     *height);
+
 GDK_AVAILABLE_IN_ALL
 GtkSelectionModel *    gtk_stack_get_pages               (GtkStack *stack);
 
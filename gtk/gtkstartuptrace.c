@@ -0,0 +1,273 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "gtkstartuptraceprivate.h"
+
+#include <string.h>
+#ifdef G_OS_UNIX
+#include <unistd.h>
+#endif
+
+/*
+ * Startup trace
+ *
+ * When GTK_STARTUP_TRACE is set, the time from gtk_init() to the
+ * first frame that is rendered is split into named spans, such as
+ * scanning for modules, loading themes or snapshotting the first
+ * window. Once the first frame is rendered, the spans are printed to
+ * stderr as a waterfall and tracing stops.
+ *
+ * Work that overlaps with startup instead of blocking it, like D-Bus
+ * calls whose replies are handled later, is traced as async spans.
+ * They are marked with a '~' in the waterfall and get a track of
+ * their own in the trace file.
+ *
+ * If GTK_STARTUP_TRACE is not "1", it is the name of a file that the
+ * spans are also written to, in the JSON Trace Event Format that
+ * chrome://tracing, Perfetto and most tracing tools can import.
+ */
+
+typedef struct {
+  gint64 start;
+  gint64 duration;
+  const char *name;
+  char *detail;
+  guint depth;
+  gboolean async;
+} Span;
+
+gboolean gtk_startup_trace_active = FALSE;
+
+static gint64 trace_origin;
+static char *trace_filename;
+static GArray *spans;
+static guint depth;
+
+void
+gtk_startup_trace_init (void)
+{
+  const char *env;
+
+  if (spans != NULL)
+    return;
+
+  env = g_getenv ("GTK_STARTUP_TRACE");
+  if (env == NULL || env[0] == '\0')
+    return;
+
+  if (strcmp (env, "1") != 0)
+    trace_filename = g_strdup (env);
+
+  spans = g_array_new (FALSE, FALSE, sizeof (Span));
+  trace_origin = g_get_monotonic_time ();
+  gtk_startup_trace_active = TRUE;
+}
+
+gint64
+gtk_startup_trace_push (void)
+{
+  depth++;
+
+  /* Never 0, so that the span is not mistaken for being untraced */
+  return MAX (g_get_monotonic_time (), 1);
+}
+
+void
+gtk_startup_trace_pop (gint64      start,
+                       const char *name,
+                       const char *detail)
+{
+  Span span;
+
+  /* Tracing stopped while the span was running */
+  if (!gtk_startup_trace_active)
+    return;
+
+  g_assert (depth > 0);
+  depth--;
+
+  span.start = start - trace_origin;
+  span.duration = g_get_monotonic_time () - start;
+  span.name = name;
+  span.detail = g_strdup (detail);
+  span.depth = depth;
+  span.async = FALSE;
+
+  g_array_append_val (spans, span);
+}
+
+void
+gtk_startup_trace_add (gint64      start,
+                       const char *name,
+                       const char *detail)
+{
+  Span span;
+
+  if (!gtk_startup_trace_active)
+    return;
+
+  span.start = start - trace_origin;
+  span.duration = g_get_monotonic_time () - start;
+  span.name = name;
+  span.detail = g_strdup (detail);
+  span.depth = 0;
+  span.async = TRUE;
+
+  g_array_append_val (spans, span);
+}
+
+static int
+compare_spans (gconstpointer a,
+               gconstpointer b)
+{
+  const Span *span1 = a;
+  const Span *span2 = b;
+
+  /* Spans are added when they end, so parents come after their children */
+  if (span1->start != span2->start)
+    return span1->start < span2->start ? -1 : 1;
+
+  return span1->depth < span2->depth ? -1 : (span1->depth > span2->depth ? 1 : 0);
+}
+
+static void
+print_waterfall (gint64 first_frame)
+{
+  GString *s;
+  guint i;
+
+  s = g_string_new (NULL);
+  g_string_append_printf (s, "Startup trace: first frame after %.1f ms\n",
+                          first_frame / 1000.);
+
+  for (i = 0; i < spans->len; i++)
+    {
+      const Span *span = &g_array_index (spans, Span, i);
+
+      g_string_append_printf (s, "%8.1f ms %8.1f ms %c%*s%s",
+                              span->start / 1000., span->duration / 1000.,
+                              span->async ? '~' : ' ',
+                              2 * span->depth, "", span->name);
+      if (span->detail)
+        g_string_append_printf (s, " (%s)", span->detail);
+      g_string_append_c (s, '\n');
+    }
+
+  g_printerr ("%s", s->str);
+  g_string_free (s, TRUE);
+}
+
+static void
+append_json_string (GString    *s,
+                    const char *str)
+{
+  const char *p;
+
+  g_string_append_c (s, '"');
+  for (p = str; *p; p++)
+    {
+      if (*p == '"' || *p == '\\')
+        g_string_append_printf (s, "\\%c", *p);
+      else if ((guchar) *p < 0x20)
+        g_string_append_printf (s, "\\u%04x", (guchar) *p);
+      else
+        g_string_append_c (s, *p);
+    }
+  g_string_append_c (s, '"');
+}
+
+static void
+write_trace_events (gint64 first_frame)
+{
+  GError *error = NULL;
+  GString *s;
+  int pid;
+  guint i;
+
+#ifdef G_OS_UNIX
+  pid = getpid ();
+#else
+  pid = 0;
+#endif
+
+  s = g_string_new ("{\"traceEvents\":[\n");
+
+  for (i = 0; i < spans->len; i++)
+    {
+      const Span *span = &g_array_index (spans, Span, i);
+
+      g_string_append (s, "{\"name\":");
+      append_json_string (s, span->name);
+      g_string_append_printf (s, ",\"cat\":\"gtk\",\"ph\":\"X\","
+                                 "\"ts\":%" G_GINT64_FORMAT ",\"dur\":%" G_GINT64_FORMAT ","
+                                 "\"pid\":%d,\"tid\":%d",
+                              span->start, span->duration, pid,
+                              span->async ? 0 : pid);
+      if (span->detail)
+        {
+          g_string_append (s, ",\"args\":{\"detail\":");
+          append_json_string (s, span->detail);
+          g_string_append_c (s, '}');
+        }
+      g_string_append (s, "},\n");
+    }
+
+  g_string_append_printf (s, "{\"name\":\"first frame\",\"cat\":\"gtk\",\"ph\":\"i\",\"s\":\"p\","
+                             "\"ts\":%" G_GINT64_FORMAT ",\"pid\":%d,\"tid\":%d}\n"
+                             "]}\n",
+                          first_frame, pid, pid);
+
+  if (!g_file_set_contents (trace_filename, s->str, s->len, &error))
+    {
+      g_warning ("Failed to write startup trace: %s", error->message);
+      g_error_free (error);
+    }
+
+  g_string_free (s, TRUE);
+}
+
+/*
+ * gtk_startup_trace_first_frame:
+ *
+ * Reports the startup trace and stops tracing, to be called
+ * when the first frame has been rendered.
+ */
+void
+gtk_startup_trace_first_frame (void)
+{
+  gint64 first_frame;
+  guint i;
+
+  if (!gtk_startup_trace_active)
+    return;
+
+  gtk_startup_trace_active = FALSE;
+  first_frame = g_get_monotonic_time () - trace_origin;
+
+  g_array_sort (spans, compare_spans);
+
+  print_waterfall (first_frame);
+  if (trace_filename)
+    write_trace_events (first_frame);
+
+  for (i = 0; i < spans->len; i++)
+    g_free (g_array_index (spans, Span, i).detail);
+  g_array_set_size (spans, 0);
+  g_clear_pointer (&trace_filename, g_free);
+}
@@ -0,0 +1,117 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GTK_STARTUP_TRACE_PRIVATE_H__
+#define __GTK_STARTUP_TRACE_PRIVATE_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/* Whether GTK_STARTUP_TRACE is set and the first frame was not rendered yet */
+extern gboolean gtk_startup_trace_active;
+
+void                    gtk_startup_trace_init          (void);
+void                    gtk_startup_trace_first_frame   (void);
+
+gint64                  gtk_startup_trace_push          (void);
+void                    gtk_startup_trace_pop           (gint64          start,
+                                                         const char     *name,
+                                                         const char     *detail);
+void                    gtk_startup_trace_add           (gint64          start,
+                                                         const char     *name,
+                                                         const char     *detail);
+
+/*
+ * gtk_startup_trace_begin:
+ *
+ * Starts a span of the startup trace. This is a cheap check
+ * when startup is not traced. Spans must be ended in the reverse
+ * order they were begun, and only on the main thread.
+ *
+ * Returns: the start time to pass to gtk_startup_trace_end(),
+ *   or 0 if startup is not traced
+ */
+static inline gint64
+gtk_startup_trace_begin (void)
+{
+  if (G_LIKELY (!gtk_startup_trace_active))
+    return 0;
+
+  return gtk_startup_trace_push ();
+}
+
+/*
+ * gtk_startup_trace_end:
+ * @start: the value returned by gtk_startup_trace_begin()
+ * @name: (not nullable): a static string naming the span
+ * @detail: (nullable): what the span worked on, such as a file
+ *
+ * Ends a span of the startup trace. @detail is copied.
+ */
+static inline void
+gtk_startup_trace_end (gint64      start,
+                       const char *name,
+                       const char *detail)
+{
+  if (G_LIKELY (start == 0))
+    return;
+
+  gtk_startup_trace_pop (start, name, detail);
+}
+
+/*
+ * gtk_startup_trace_begin_async:
+ *
+ * Starts a span of the startup trace that does not nest with the
+ * others, such as a D-Bus call that runs while startup continues.
+ * It may be ended at any time, from the main thread.
+ *
+ * Returns: the start time to pass to gtk_startup_trace_end_async(),
+ *   or 0 if startup is not traced
+ */
+static inline gint64
+gtk_startup_trace_begin_async (void)
+{
+  if (G_LIKELY (!gtk_startup_trace_active))
+    return 0;
+
+  return MAX (g_get_monotonic_time (), 1);
+}
+
+/*
+ * gtk_startup_trace_end_async:
+ * @start: the value returned by gtk_startup_trace_begin_async()
+ * @name: (not nullable): a static string naming the span
+ * @detail: (nullable): what the span worked on
+ *
+ * Ends a span begun with gtk_startup_trace_begin_async().
+ */
+static inline void
+gtk_startup_trace_end_async (gint64      start,
+                             const char *name,
+                             const char *detail)
+{
+  if (G_LIKELY (start == 0))
+    return;
+
+  gtk_startup_trace_add (start, name, detail);
+}
+
+G_END_DECLS
+
+#endif /* __GTK_STARTUP_TRACE_PRIVATE_H__ */
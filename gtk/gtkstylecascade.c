@@ -19,6 +19,7 @@
 
 #include "gtkstylecascadeprivate.h"
 
+#include "gtkcssproviderprivate.h"
 #include "gtkstyleprovider.h"
 #include "gtkstyleproviderprivate.h"
 #include "gtkprivate.h"
@@ -39,6 +40,29 @@ struct _GtkStyleProviderData
   guint changed_signal_id;
 };
 
+/*
+ * Merged selector trees
+ *
+ * Looking up a node runs the selector tree of every provider. When
+ * there are several, the cascade merges their rulesets into a single
+ * tree, so that the node is matched once.
+ *
+ * The rules are stored in order of precedence, lowest first. Matches
+ * are returned sorted by their address, so they come out in cascade
+ * order, just like the rulesets of a single provider do.
+ *
+ * Building the tree costs about as much as matching a few hundred
+ * nodes, so it only happens once the cascade is stable: after
+ * MERGE_MIN_LOOKUPS lookups without the providers changing.
+ */
+#define MERGE_MIN_LOOKUPS 256
+
+struct _GtkStyleCascadeRule
+{
+  GtkCssProvider *provider;
+  guint ruleset;
+};
+
 static GtkStyleProvider *
 gtk_style_cascade_iter_next (GtkStyleCascade     *cascade,
                              GtkStyleCascadeIter *iter)
@@ -192,24 +216,149 @@ gtk_style_cascade_get_keyframes (GtkStyleProvider *provider,
 }
 
 static void
-gtk_style_cascade_lookup (GtkStyleProvider    *provider,
-                          const GtkCssMatcher *matcher,
-                          GtkCssLookup        *lookup,
-                          GtkCssChange        *change)
+gtk_style_cascade_clear_tree (GtkStyleCascade *cascade)
+{
+  g_clear_pointer (&cascade->tree, _gtk_css_selector_tree_free);
+  g_clear_pointer (&cascade->rules, g_free);
+  cascade->tree_valid = FALSE;
+  cascade->n_lookups = 0;
+}
+
+static void
+gtk_style_cascade_build_tree (GtkStyleCascade *cascade)
+{
+  GtkStyleCascadeIter iter;
+  GtkStyleProvider *item;
+  GtkCssSelectorTreeBuilder *builder;
+  GPtrArray *providers;
+  guint i, j, n_rules;
+
+  cascade->tree_valid = TRUE;
+
+  /* In order of precedence, highest first */
+  providers = g_ptr_array_new ();
+  for (item = gtk_style_cascade_iter_init (cascade, &iter);
+       item;
+       item = gtk_style_cascade_iter_next (cascade, &iter))
+    {
+      /* Like GtkSettings, which only provides colors and keyframes */
+      if (GTK_STYLE_PROVIDER_GET_INTERFACE (item)->lookup == NULL)
+        continue;
+
+      /* We don't know how to merge the rules of other providers */
+      if (!GTK_IS_CSS_PROVIDER (item))
+        goto out;
+
+      if (gtk_css_provider_get_n_rulesets (GTK_CSS_PROVIDER (item)) > 0)
+        g_ptr_array_add (providers, item);
+    }
+
+  if (providers->len < 2)
+    goto out;
+
+  n_rules = 0;
+  for (i = 0; i < providers->len; i++)
+    n_rules += gtk_css_provider_get_n_rulesets (providers->pdata[i]);
+
+  cascade->rules = g_new (GtkStyleCascadeRule, n_rules);
+
+  builder = _gtk_css_selector_tree_builder_new ();
+  n_rules = 0;
+  for (i = providers->len; i-- > 0; )
+    {
+      GtkCssProvider *provider = providers->pdata[i];
+
+      for (j = 0; j < gtk_css_provider_get_n_rulesets (provider); j++)
+        {
+          GtkStyleCascadeRule *rule = &cascade->rules[n_rules++];
+
+          rule->provider = provider;
+          rule->ruleset = j;
+          _gtk_css_selector_tree_builder_add (builder,
+                                              gtk_css_provider_get_ruleset_selector (provider, j),
+                                              NULL,
+                                              rule);
+        }
+    }
+
+  cascade->tree = _gtk_css_selector_tree_builder_build (builder);
+  _gtk_css_selector_tree_builder_free (builder);
+
+out:
+  g_ptr_array_free (providers, TRUE);
+  gtk_style_cascade_iter_clear (&iter);
+}
+
+static void
+gtk_style_cascade_lookup_tree (GtkStyleCascade              *cascade,
+                               const GtkCountingBloomFilter *filter,
+                               const GtkCssMatcher          *matcher,
+                               GtkCssLookup                 *lookup,
+                               GtkCssChange                 *change)
+{
+  GPtrArray *matches;
+  int i;
+
+  matches = _gtk_css_selector_tree_match_all (cascade->tree, filter, matcher);
+  if (matches)
+    {
+      for (i = matches->len - 1; i >= 0; i--)
+        {
+          GtkStyleCascadeRule *rule = matches->pdata[i];
+
+          gtk_css_provider_lookup_ruleset (rule->provider, rule->ruleset, lookup);
+
+          if (_gtk_css_lookup_is_done (lookup))
+            break;
+        }
+
+      g_ptr_array_free (matches, TRUE);
+    }
+
+  if (change)
+    {
+      GtkCssMatcher change_matcher;
+
+      _gtk_css_matcher_superset_init (&change_matcher, matcher, GTK_CSS_CHANGE_NAME | GTK_CSS_CHANGE_CLASS);
+
+      *change = _gtk_css_selector_tree_get_change_all (cascade->tree, &change_matcher);
+    }
+}
+
+static void
+gtk_style_cascade_lookup (GtkStyleProvider             *provider,
+                          const GtkCountingBloomFilter *filter,
+                          const GtkCssMatcher          *matcher,
+                          GtkCssLookup                 *lookup,
+                          GtkCssChange                 *change)
 {
   GtkStyleCascade *cascade = GTK_STYLE_CASCADE (provider);
   GtkStyleCascadeIter iter;
   GtkStyleProvider *item;
   GtkCssChange iter_change;
 
+  if (!cascade->tree_valid && ++cascade->n_lookups > MERGE_MIN_LOOKUPS)
+    gtk_style_cascade_build_tree (cascade);
+
+  if (cascade->tree)
+    {
+      gtk_style_cascade_lookup_tree (cascade, filter, matcher, lookup, change);
+      return;
+    }
+
   for (item = gtk_style_cascade_iter_init (cascade, &iter);
        item;
        item = gtk_style_cascade_iter_next (cascade, &iter))
     {
       GtkStyleProvider *sp = (GtkStyleProvider *) item;
+
+      /* Providers with lower priority can't set anything anymore */
+      if (change == NULL && _gtk_css_lookup_is_done (lookup))
+        break;
+
       if (GTK_IS_STYLE_PROVIDER (sp))
         {
-          gtk_style_provider_lookup (sp, matcher, lookup,
+          gtk_style_provider_lookup (sp, filter, matcher, lookup,
                                               change ? &iter_change : NULL);
           if (change)
             *change |= iter_change;
@@ -223,6 +372,17 @@ gtk_style_cascade_lookup (GtkStyleProvider    *provider,
   gtk_style_cascade_iter_clear (&iter);
 }
 
+/* The tree must be gone before anyone is told, they might look up
+ * styles right away and the rules point to the providers.
+ */
+static void
+gtk_style_cascade_changed (GtkStyleCascade *cascade)
+{
+  gtk_style_cascade_clear_tree (cascade);
+
+  gtk_style_provider_changed (GTK_STYLE_PROVIDER (cascade));
+}
+
 static void
 gtk_style_cascade_provider_iface_init (GtkStyleProviderInterface *iface)
 {
@@ -244,6 +404,7 @@ gtk_style_cascade_dispose (GObject *object)
 
   _gtk_style_cascade_set_parent (cascade, NULL);
   g_array_unref (cascade->providers);
+  gtk_style_cascade_clear_tree (cascade);
 
   G_OBJECT_CLASS (_gtk_style_cascade_parent_class)->dispose (object);
 }
@@ -295,19 +456,22 @@ _gtk_style_cascade_set_parent (GtkStyleCascade *cascade,
       g_object_ref (parent);
       g_signal_connect_swapped (parent,
                                 "-gtk-private-changed",
-                                G_CALLBACK (gtk_style_provider_changed),
+                                G_CALLBACK (gtk_style_cascade_changed),
                                 cascade);
     }
 
   if (cascade->parent)
     {
       g_signal_handlers_disconnect_by_func (cascade->parent, 
-                                            gtk_style_provider_changed,
+                                            gtk_style_cascade_changed,
                                             cascade);
       g_object_unref (cascade->parent);
     }
 
   cascade->parent = parent;
+
+  /* The tree contains the rules of the parents */
+  gtk_style_cascade_clear_tree (cascade);
 }
 
 void
@@ -326,7 +490,7 @@ _gtk_style_cascade_add_provider (GtkStyleCascade  *cascade,
   data.priority = priority;
   data.changed_signal_id = g_signal_connect_swapped (provider,
                                                      "-gtk-private-changed",
-                                                     G_CALLBACK (gtk_style_provider_changed),
+                                                     G_CALLBACK (gtk_style_cascade_changed),
                                                      cascade);
 
   /* ensure it gets removed first */
@@ -339,7 +503,7 @@ _gtk_style_cascade_add_provider (GtkStyleCascade  *cascade,
     }
   g_array_insert_val (cascade->providers, i, data);
 
-  gtk_style_provider_changed (GTK_STYLE_PROVIDER (cascade));
+  gtk_style_cascade_changed (cascade);
 }
 
 void
@@ -359,7 +523,7 @@ _gtk_style_cascade_remove_provider (GtkStyleCascade  *cascade,
         {
           g_array_remove_index (cascade->providers, i);
   
-          gtk_style_provider_changed (GTK_STYLE_PROVIDER (cascade));
+          gtk_style_cascade_changed (cascade);
           break;
         }
     }
@@ -376,7 +540,7 @@ _gtk_style_cascade_set_scale (GtkStyleCascade *cascade,
 
   cascade->scale = scale;
 
-  gtk_style_provider_changed (GTK_STYLE_PROVIDER (cascade));
+  gtk_style_cascade_changed (cascade);
 }
 
 int
@@ -19,6 +19,7 @@
 #define __GTK_STYLECASCADE_PRIVATE_H__
 
 #include <gdk/gdk.h>
+#include <gtk/gtkcssselectorprivate.h>
 #include <gtk/gtkstyleproviderprivate.h>
 
 G_BEGIN_DECLS
@@ -32,6 +33,7 @@ G_BEGIN_DECLS
 
 typedef struct _GtkStyleCascade           GtkStyleCascade;
 typedef struct _GtkStyleCascadeClass      GtkStyleCascadeClass;
+typedef struct _GtkStyleCascadeRule       GtkStyleCascadeRule;
 
 struct _GtkStyleCascade
 {
@@ -40,6 +42,12 @@ struct _GtkStyleCascade
   GtkStyleCascade *parent;
   GArray *providers;
   int scale;
+
+  /* The selectors of all providers, including the ones of the parents */
+  GtkCssSelectorTree *tree;
+  GtkStyleCascadeRule *rules;
+  guint tree_valid : 1;
+  guint n_lookups;              /* since the last change */
 };
 
 struct _GtkStyleCascadeClass
@@ -103,6 +103,9 @@
  */
 
 #define CURSOR_ASPECT_RATIO (0.04)
+
+/* How many transient nodes are kept for reuse, enough for nested saves */
+#define MAX_UNUSED_NODES 4
 typedef struct PropertyValue PropertyValue;
 
 struct PropertyValue
@@ -120,7 +123,8 @@ struct _GtkStyleContextPrivate
   GtkStyleCascade *cascade;
   GtkStyleContext *parent;
   GtkCssNode *cssnode;
-  GSList *saved_nodes;
+  GPtrArray *saved_nodes;       /* nodes replaced by gtk_style_context_save(), outermost first */
+  GPtrArray *unused_nodes;      /* transient nodes that can be reused for saving */
 
   GtkCssStyleChange *invalidating_context;
 };
@@ -229,13 +233,23 @@ gtk_style_context_pop_style_node (GtkStyleContext *context)
 {
   GtkStyleContextPrivate *priv = gtk_style_context_get_instance_private (context);
 
-  g_return_if_fail (priv->saved_nodes != NULL);
+  g_return_if_fail (priv->saved_nodes->len > 0);
 
   if (GTK_IS_CSS_TRANSIENT_NODE (priv->cssnode))
-    gtk_css_node_set_parent (priv->cssnode, NULL);
-  g_object_unref (priv->cssnode);
-  priv->cssnode = priv->saved_nodes->data;
-  priv->saved_nodes = g_slist_remove (priv->saved_nodes, priv->cssnode);
+    {
+      gtk_css_node_set_parent (priv->cssnode, NULL);
+
+      /* Keep it around for the next save, unless somebody else is using it */
+      if (G_OBJECT (priv->cssnode)->ref_count == 1 &&
+          priv->unused_nodes->len < MAX_UNUSED_NODES)
+        g_ptr_array_add (priv->unused_nodes, priv->cssnode);
+      else
+        g_object_unref (priv->cssnode);
+    }
+  else
+    g_object_unref (priv->cssnode);
+
+  priv->cssnode = g_ptr_array_remove_index (priv->saved_nodes, priv->saved_nodes->len - 1);
 }
 
 static void
@@ -282,6 +296,8 @@ gtk_style_context_init (GtkStyleContext *context)
   GtkStyleContextPrivate *priv = gtk_style_context_get_instance_private (context);
 
   priv->display = gdk_display_get_default ();
+  priv->saved_nodes = g_ptr_array_new ();
+  priv->unused_nodes = g_ptr_array_new ();
 
   if (priv->display == NULL)
     g_error ("Can't create a GtkStyleContext without a display connection");
@@ -305,8 +321,11 @@ gtk_style_context_finalize (GObject *object)
   GtkStyleContext *context = GTK_STYLE_CONTEXT (object);
   GtkStyleContextPrivate *priv = gtk_style_context_get_instance_private (context);
 
-  while (priv->saved_nodes)
+  while (priv->saved_nodes->len > 0)
     gtk_style_context_pop_style_node (context);
+  g_ptr_array_unref (priv->saved_nodes);
+  g_ptr_array_foreach (priv->unused_nodes, (GFunc) g_object_unref, NULL);
+  g_ptr_array_unref (priv->unused_nodes);
 
   if (GTK_IS_CSS_PATH_NODE (priv->cssnode))
     gtk_css_path_node_unset_context (GTK_CSS_PATH_NODE (priv->cssnode));
@@ -375,7 +394,7 @@ gtk_style_context_is_saved (GtkStyleContext *context)
 {
   GtkStyleContextPrivate *priv = gtk_style_context_get_instance_private (context);
 
-  return priv->saved_nodes != NULL;
+  return priv->saved_nodes->len > 0;
 }
 
 static GtkCssNode *
@@ -383,8 +402,8 @@ gtk_style_context_get_root (GtkStyleContext *context)
 {
   GtkStyleContextPrivate *priv = gtk_style_context_get_instance_private (context);
 
-  if (priv->saved_nodes != NULL)
-    return g_slist_last (priv->saved_nodes)->data;
+  if (priv->saved_nodes->len > 0)
+    return g_ptr_array_index (priv->saved_nodes, 0);
   else
     return priv->cssnode;
 }
@@ -1070,7 +1089,7 @@ gtk_style_context_save_to_node (GtkStyleContext *context,
   g_return_if_fail (GTK_IS_STYLE_CONTEXT (context));
   g_return_if_fail (GTK_IS_CSS_NODE (node));
 
-  priv->saved_nodes = g_slist_prepend (priv->saved_nodes, priv->cssnode);
+  g_ptr_array_add (priv->saved_nodes, priv->cssnode);
   priv->cssnode = g_object_ref (node);
 }
 
@@ -1087,7 +1106,16 @@ gtk_style_context_save_named (GtkStyleContext *context,
   if (!gtk_style_context_is_saved (context))
     gtk_style_context_lookup_style (context);
 
-  cssnode = gtk_css_transient_node_new (priv->cssnode);
+  /* Cell renderers and the like save and restore for every row they
+   * draw, so reuse the nodes. Their style usually is in the parent's
+   * style cache already. */
+  if (priv->unused_nodes->len > 0)
+    {
+      cssnode = g_ptr_array_remove_index (priv->unused_nodes, priv->unused_nodes->len - 1);
+      gtk_css_transient_node_reset (cssnode, priv->cssnode);
+    }
+  else
+    cssnode = gtk_css_transient_node_new (priv->cssnode);
   gtk_css_node_set_parent (cssnode, gtk_style_context_get_root (context));
   if (name)
     gtk_css_node_set_name (cssnode, g_intern_string (name));
@@ -1131,7 +1159,7 @@ gtk_style_context_restore (GtkStyleContext *context)
 
   g_return_if_fail (GTK_IS_STYLE_CONTEXT (context));
 
-  if (priv->saved_nodes == NULL)
+  if (priv->saved_nodes->len == 0)
     {
       g_warning ("Unpaired gtk_style_context_restore() call");
       return;
@@ -1790,9 +1818,7 @@ gtk_render_insertion_cursor (GtkStyleContext *context,
   g_return_if_fail (PANGO_IS_LAYOUT (layout));
   g_return_if_fail (index >= 0);
 
-  g_object_get (gtk_settings_get_for_display (priv->display),
-                "gtk-split-cursor", &split_cursor,
-                NULL);
+  split_cursor = gtk_settings_get_values (gtk_settings_get_for_display (priv->display))->split_cursor;
 
   keymap_direction = gdk_keymap_get_direction (gdk_display_get_keymap (priv->display));
 
@@ -1873,9 +1899,7 @@ gtk_snapshot_render_insertion_cursor (GtkSnapshot     *snapshot,
   g_return_if_fail (PANGO_IS_LAYOUT (layout));
   g_return_if_fail (index >= 0);
 
-  g_object_get (gtk_settings_get_for_display (priv->display),
-                "gtk-split-cursor", &split_cursor,
-                NULL);
+  split_cursor = gtk_settings_get_values (gtk_settings_get_for_display (priv->display))->split_cursor;
 
   keymap_direction = gdk_keymap_get_direction (gdk_display_get_keymap (priv->display));
 
@@ -93,10 +93,11 @@ gtk_style_provider_get_keyframes (GtkStyleProvider *provider,
 }
 
 void
-gtk_style_provider_lookup (GtkStyleProvider    *provider,
-                           const GtkCssMatcher *matcher,
-                           GtkCssLookup        *lookup,
-                           GtkCssChange        *out_change)
+gtk_style_provider_lookup (GtkStyleProvider             *provider,
+                           const GtkCountingBloomFilter *filter,
+                           const GtkCssMatcher          *matcher,
+                           GtkCssLookup                 *lookup,
+                           GtkCssChange                 *out_change)
 {
   GtkStyleProviderInterface *iface;
 
@@ -112,7 +113,7 @@ gtk_style_provider_lookup (GtkStyleProvider    *provider,
   if (!iface->lookup)
     return;
 
-  iface->lookup (provider, matcher, lookup, out_change);
+  iface->lookup (provider, filter, matcher, lookup, out_change);
 }
 
 void
@@ -55,7 +55,7 @@
 #include "gtkprivate.h"
 #include "gtkseparatormenuitem.h"
 #include "gtkselection.h"
-#include "gtksettings.h"
+#include "gtksettingsprivate.h"
 #include "gtksnapshot.h"
 #include "gtkstylecontextprivate.h"
 #include "gtktexthandleprivate.h"
@@ -2952,10 +2952,7 @@ gtk_text_grab_focus (GtkWidget *widget)
 
   if (priv->editable && !priv->in_click)
     {
-      g_object_get (gtk_widget_get_settings (widget),
-                    "gtk-entry-select-on-focus",
-                    &select_on_focus,
-                    NULL);
+      select_on_focus = gtk_settings_get_values (gtk_widget_get_settings (widget))->entry_select_on_focus;
 
       if (select_on_focus)
         gtk_text_set_selection_bounds (self, 0, -1);
@@ -3351,9 +3348,7 @@ get_better_cursor_x (GtkText *self,
   int index = g_utf8_offset_to_pointer (text, offset) - text;
   PangoRectangle strong_pos, weak_pos;
   
-  g_object_get (gtk_widget_get_settings (GTK_WIDGET (self)),
-                "gtk-split-cursor", &split_cursor,
-                NULL);
+  split_cursor = gtk_settings_get_values (gtk_widget_get_settings (GTK_WIDGET (self)))->split_cursor;
 
   pango_layout_get_cursor_pos (layout, index, &strong_pos, &weak_pos);
 
@@ -4088,8 +4083,9 @@ gtk_text_create_layout (GtkText  *self,
   char *preedit_string = NULL;
   int preedit_length = 0;
   PangoAttrList *preedit_attrs = NULL;
-  char *display_text;
-  guint n_bytes;
+  char *display_text = NULL;
+  const char *text;
+  gsize n_bytes;
 
   context = gtk_widget_get_style_context (widget);
 
@@ -4101,9 +4097,20 @@ gtk_text_create_layout (GtkText  *self,
   if (!tmp_attrs)
     tmp_attrs = pango_attr_list_new ();
 
-  display_text = gtk_text_get_display_text (self, 0, -1);
-
-  n_bytes = strlen (display_text);
+  /* Visible text is laid out as it is, there is no need to copy
+   * it or to look for its end, which adds up for long text.
+   */
+  if (priv->visible)
+    {
+      text = gtk_entry_buffer_get_text (get_buffer (self));
+      n_bytes = gtk_entry_buffer_get_bytes (get_buffer (self));
+    }
+  else
+    {
+      display_text = gtk_text_get_display_text (self, 0, -1);
+      text = display_text;
+      n_bytes = strlen (display_text);
+    }
 
   if (include_preedit)
     {
@@ -4114,10 +4121,10 @@ gtk_text_create_layout (GtkText  *self,
 
   if (preedit_length)
     {
-      GString *tmp_string = g_string_new (display_text);
+      GString *tmp_string = g_string_new_len (text, n_bytes);
       int pos;
 
-      pos = g_utf8_offset_to_pointer (display_text, priv->current_pos) - display_text;
+      pos = g_utf8_offset_to_pointer (text, priv->current_pos) - text;
       g_string_insert (tmp_string, pos, preedit_string);
       pango_layout_set_text (layout, tmp_string->str, tmp_string->len);
       pango_attr_list_splice (tmp_attrs, preedit_attrs, pos, preedit_length);
@@ -4128,7 +4135,7 @@ gtk_text_create_layout (GtkText  *self,
       PangoDirection pango_dir;
 
       if (gtk_text_get_display_mode (self) == DISPLAY_NORMAL)
-        pango_dir = gdk_find_base_dir (display_text, n_bytes);
+        pango_dir = gdk_find_base_dir (text, n_bytes);
       else
         pango_dir = PANGO_DIRECTION_NEUTRAL;
 
@@ -4157,7 +4164,7 @@ gtk_text_create_layout (GtkText  *self,
 
       priv->resolved_dir = pango_dir;
 
-      pango_layout_set_text (layout, display_text, n_bytes);
+      pango_layout_set_text (layout, text, n_bytes);
     }
 
   pango_layout_set_attributes (layout, tmp_attrs);
@@ -4454,7 +4461,7 @@ gtk_text_handle_drag_finished (GtkTextHandle         *handle,
       guint double_click_time;
 
       settings = gtk_widget_get_settings (GTK_WIDGET (self));
-      g_object_get (settings, "gtk-double-click-time", &double_click_time, NULL);
+      double_click_time = gtk_settings_get_values (settings)->double_click_time;
       if (g_get_monotonic_time() - priv->handle_place_time < double_click_time * 1000)
         {
           gtk_text_select_word (self);
@@ -4733,9 +4740,7 @@ gtk_text_move_visually (GtkText *self,
       gboolean split_cursor;
       gboolean strong;
 
-      g_object_get (gtk_widget_get_settings (GTK_WIDGET (self)),
-                    "gtk-split-cursor", &split_cursor,
-                    NULL);
+      split_cursor = gtk_settings_get_values (gtk_widget_get_settings (GTK_WIDGET (self)))->split_cursor;
 
       if (split_cursor)
         strong = TRUE;
@@ -6153,7 +6158,7 @@ cursor_blinks (GtkText *self)
       gboolean blink;
 
       settings = gtk_widget_get_settings (GTK_WIDGET (self));
-      g_object_get (settings, "gtk-cursor-blink", &blink, NULL);
+      blink = gtk_settings_get_values (settings)->cursor_blink;
 
       return blink;
     }
@@ -6179,7 +6184,7 @@ get_cursor_time (GtkText *self)
   GtkSettings *settings = gtk_widget_get_settings (GTK_WIDGET (self));
   int time;
 
-  g_object_get (settings, "gtk-cursor-blink-time", &time, NULL);
+  time = gtk_settings_get_values (settings)->cursor_blink_time;
 
   return time;
 }
@@ -6190,7 +6195,7 @@ get_cursor_blink_timeout (GtkText *self)
   GtkSettings *settings = gtk_widget_get_settings (GTK_WIDGET (self));
   int timeout;
 
-  g_object_get (settings, "gtk-cursor-blink-timeout", &timeout, NULL);
+  timeout = gtk_settings_get_values (settings)->cursor_blink_timeout;
 
   return timeout;
 }
@@ -82,15 +82,21 @@
 typedef struct TagInfo {
   int numTags;                  /* Number of tags for which there
                                  * is currently information in
-                                 * tags and counts. */
+                                 * tags. */
   int arraySize;                        /* Number of entries allocated for
-                                         * tags and counts. */
+                                         * tags. */
   GtkTextTag **tags;           /* Array of tags seen so far.
                                 * Malloc-ed. */
-  int *counts;                  /* Toggle count (so far) for each
-                                 * entry in tags.  Malloc-ed. */
+  guchar *toggles;              /* TAG_SEEN and TAG_TOGGLED_ON for each
+                                 * tag in the table, indexed by tag
+                                 * priority, so that looking up a tag
+                                 * doesn't depend on how many were
+                                 * seen so far. */
 } TagInfo;
 
+#define TAG_SEEN       (1 << 0)
+#define TAG_TOGGLED_ON (1 << 1)
+
 
 /*
  * This is used to store per-view width/height info at the tree nodes.
@@ -149,6 +155,10 @@ struct _GtkTextBTreeNode {
   int num_lines;                        /* Total number of lines (leaves) in
                                          * the subtree rooted here. */
   int num_chars;                        /* Number of chars below here */
+  int num_toggles;                      /* Number of toggles of any tag
+                                         * below here; allows skipping
+                                         * whole subtrees when looking
+                                         * for toggles of any tag. */
   int num_children;                     /* Number of children of this node. */
   union {                               /* First in linked list of children. */
     struct _GtkTextBTreeNode *node;         /* Used if level > 0. */
@@ -269,6 +279,11 @@ static void             segments_changed                (GtkTextBTree     *tree)
 static void             chars_changed                   (GtkTextBTree     *tree);
 static void             summary_list_destroy            (Summary          *summary);
 static GtkTextLine     *gtk_text_line_new               (void);
+static GtkTextLine     *gtk_text_line_new_packed        (const gchar      *text,
+                                                         guint             len);
+static int              gtk_text_line_delete_segment    (GtkTextLine        *line,
+                                                         GtkTextLineSegment *seg,
+                                                         gboolean          tree_gone);
 static void             gtk_text_line_destroy           (GtkTextBTree     *tree,
                                                          GtkTextLine      *line);
 static void             gtk_text_line_set_parent        (GtkTextLine      *line,
@@ -397,6 +412,7 @@ _gtk_text_btree_new (GtkTextTagTable *table,
   root_node->num_children = 2;
   root_node->num_lines = 2;
   root_node->num_chars = 2;
+  root_node->num_toggles = 0;
 
   line->parent = root_node;
   line->next = line2;
@@ -879,7 +895,7 @@ _gtk_text_btree_delete (GtkTextIter *start,
       next = seg->next;
       char_count = seg->char_count;
 
-      if ((*seg->type->deleteFunc)(seg, curline, FALSE) != 0)
+      if (gtk_text_line_delete_segment (curline, seg, FALSE) != 0)
         {
           /*
            * This segment refuses to die.  Move it to prev_seg and
@@ -1106,6 +1122,7 @@ _gtk_text_btree_insert (GtkTextIter *iter,
                                 * added to this line). */
   GtkTextLineSegment *seg;
   GtkTextLine *newline;
+  GtkTextLine *prev_line;              /* Line in front of line */
   int chunk_len;                        /* # characters in current chunk. */
   gint sol;                           /* start of line */
   gint eol;                           /* Pointer to character just after last
@@ -1132,6 +1149,7 @@ _gtk_text_btree_insert (GtkTextIter *iter,
   line = _gtk_text_iter_get_text_line (iter);
   
   start_line = line;
+  prev_line = NULL;
   start_byte_index = gtk_text_iter_get_line_index (iter);
 
   /* Get our insertion segment split. Note this assumes line allows
@@ -1178,6 +1196,23 @@ _gtk_text_btree_insert (GtkTextIter *iter,
       chunk_len = eol - sol;
 
       g_assert (g_utf8_validate (&text[sol], chunk_len, NULL));
+
+      if (line != start_line && delim != eol)
+        {
+          /* A line in the middle of the text holds nothing but the
+           * chunk, so it goes in front of the line with the leftovers
+           * as a packed line.
+           */
+          newline = gtk_text_line_new_packed (&text[sol], chunk_len);
+          gtk_text_line_set_parent (newline, line->parent);
+          newline->next = line;
+          prev_line->next = newline;
+          prev_line = newline;
+          char_count_delta += newline->segments->char_count;
+          line_count_delta++;
+          continue;
+        }
+
       seg = _gtk_char_segment_new (&text[sol], chunk_len);
 
       char_count_delta += seg->char_count;
@@ -1211,6 +1246,7 @@ _gtk_text_btree_insert (GtkTextIter *iter,
       line->next = newline;
       newline->segments = seg->next;
       seg->next = NULL;
+      prev_line = line;
       line = newline;
       cur_seg = NULL;
       line_count_delta++;
@@ -2206,6 +2242,8 @@ _gtk_text_btree_get_line_at_char (GtkTextBTree      *tree,
   return line;
 }
 
+#define LOTSA_TAGS 1000
+
 /* It returns an array sorted by tags priority, ready to pass to
  * _gtk_text_attributes_fill_from_tags() */
 GtkTextTag**
@@ -2218,17 +2256,29 @@ _gtk_text_btree_get_tags (const GtkTextIter *iter,
   int src, dst, index;
   TagInfo tagInfo;
   GtkTextLine *line;
+  GtkTextBTree *tree;
   gint byte_index;
+  guchar deftoggles[LOTSA_TAGS];
+  int numTableTags;
 
 #define NUM_TAG_INFOS 10
 
   line = _gtk_text_iter_get_text_line (iter);
+  tree = _gtk_text_iter_get_btree (iter);
   byte_index = gtk_text_iter_get_line_index (iter);
 
+  numTableTags = gtk_text_tag_table_get_size (tree->table);
+
   tagInfo.numTags = 0;
   tagInfo.arraySize = NUM_TAG_INFOS;
   tagInfo.tags = g_new (GtkTextTag*, NUM_TAG_INFOS);
-  tagInfo.counts = g_new (int, NUM_TAG_INFOS);
+  if (numTableTags > LOTSA_TAGS)
+    tagInfo.toggles = g_new0 (guchar, numTableTags);
+  else
+    {
+      tagInfo.toggles = deftoggles;
+      memset (deftoggles, 0, numTableTags);
+    }
 
   /*
    * Record tag toggles within the line of indexPtr but preceding
@@ -2301,7 +2351,7 @@ _gtk_text_btree_get_tags (const GtkTextIter *iter,
 
   for (src = 0, dst = 0; src < tagInfo.numTags; src++)
     {
-      if (tagInfo.counts[src] & 1)
+      if (tagInfo.toggles[tagInfo.tags[src]->priv->priority] & TAG_TOGGLED_ON)
         {
           g_assert (GTK_IS_TEXT_TAG (tagInfo.tags[src]));
           tagInfo.tags[dst] = tagInfo.tags[src];
@@ -2310,7 +2360,8 @@ _gtk_text_btree_get_tags (const GtkTextIter *iter,
     }
 
   *num_tags = dst;
-  g_free (tagInfo.counts);
+  if (tagInfo.toggles != deftoggles)
+    g_free (tagInfo.toggles);
   if (dst == 0)
     {
       g_free (tagInfo.tags);
@@ -2468,7 +2519,6 @@ _gtk_text_btree_char_count (GtkTextBTree *tree)
   return tree->root_node->num_chars - 2;
 }
 
-#define LOTSA_TAGS 1000
 gboolean
 _gtk_text_btree_char_is_invisible (const GtkTextIter *iter)
 {
@@ -3102,11 +3152,21 @@ _gtk_text_btree_first_could_contain_tag (GtkTextBTree *tree,
     }
   else
     {
-      /* Looking for any tag at all (tag == NULL).
-         Unfortunately this can't be done in a simple and efficient way
-         right now; so I'm just going to return the
-         first line in the btree. FIXME */
-      return _gtk_text_btree_get_line (tree, 0, NULL);
+      /* Looking for any tag at all (tag == NULL), so go down
+       * to the first node that has toggles of any tag.
+       */
+      node = tree->root_node;
+      if (node->num_toggles == 0)
+        return NULL;
+
+      while (node->level > 0)
+        {
+          node = node->children.node;
+          while (node->num_toggles == 0)
+            node = node->next;
+        }
+
+      return node->children.line;
     }
 }
 
@@ -3967,7 +4027,7 @@ _gtk_text_line_byte_to_char (GtkTextLine *line,
   else
     {
       if (seg->type == &gtk_text_char_type)
-        return char_offset + g_utf8_strlen (seg->body.chars, byte_offset);
+        return char_offset + _gtk_char_segment_byte_to_char (seg, byte_offset);
       else
         {
           g_assert (seg->char_count == 1);
@@ -4174,7 +4234,7 @@ _gtk_text_line_byte_to_char_offsets (GtkTextLine *line,
 
   if (seg->type == &gtk_text_char_type)
     {
-      *seg_char_offset = g_utf8_strlen (seg->body.chars, offset);
+      *seg_char_offset = _gtk_char_segment_byte_to_char (seg, offset);
 
       g_assert (*seg_char_offset < seg->char_count);
 
@@ -4219,16 +4279,7 @@ _gtk_text_line_char_to_byte_offsets (GtkTextLine *line,
 
   if (seg->type == &gtk_text_char_type)
     {
-      const char *p;
-
-      /* if in the last fourth of the segment walk backwards */
-      if (seg->char_count - offset < seg->char_count / 4)
-        p = g_utf8_offset_to_pointer (seg->body.chars + seg->byte_count, 
-                                      offset - seg->char_count);
-      else
-        p = g_utf8_offset_to_pointer (seg->body.chars, offset);
-
-      *seg_byte_offset = p - seg->body.chars;
+      *seg_byte_offset = _gtk_char_segment_char_to_byte (seg, offset);
 
       g_assert (*seg_byte_offset < seg->byte_count);
 
@@ -4343,6 +4394,7 @@ _gtk_text_line_next_could_contain_tag (GtkTextLine  *line,
                                        GtkTextTag   *tag)
 {
   GtkTextBTreeNode *node;
+  GtkTextBTreeNode *tag_root;
   GtkTextTagInfo *info;
   gboolean below_tag_root;
 
@@ -4353,14 +4405,6 @@ _gtk_text_line_next_could_contain_tag (GtkTextLine  *line,
     _gtk_text_btree_check (tree);
 #endif
 
-  if (tag == NULL)
-    {
-      /* Right now we can only offer linear-search if the user wants
-       * to know about any tag toggle at all.
-       */
-      return _gtk_text_line_next_excluding_last (line);
-    }
-
   /* Our tag summaries only have node precision, not line
    * precision. This means that if any line under a node could contain a
    * tag, then any of the others could also contain a tag.
@@ -4370,18 +4414,35 @@ _gtk_text_line_next_could_contain_tag (GtkTextLine  *line,
    * count of toggles under the node. But for now I'm going with KISS.
    */
 
-  /* return same-node line, if any. */
-  if (line->next)
-    return line->next;
+  if (tag == NULL)
+    {
+      /* Nodes count the toggles of all tags below them, so when
+       * looking for any toggle at all, the whole tree serves as the
+       * tag root and nodes without toggles are skipped entirely.
+       */
+      if (line->next && line->parent->num_toggles > 0)
+        return _gtk_text_line_next_excluding_last (line);
 
-  info = gtk_text_btree_get_existing_tag_info (tree, tag);
-  if (info == NULL)
-    return NULL;
+      tag_root = tree->root_node;
+      if (tag_root->num_toggles == 0)
+        return NULL;
+    }
+  else
+    {
+      /* return same-node line, if any. */
+      if (line->next)
+        return line->next;
 
-  if (info->tag_root == NULL)
-    return NULL;
+      info = gtk_text_btree_get_existing_tag_info (tree, tag);
+      if (info == NULL)
+        return NULL;
+
+      tag_root = info->tag_root;
+      if (tag_root == NULL)
+        return NULL;
+    }
 
-  if (info->tag_root == line->parent)
+  if (tag_root == line->parent)
     return NULL; /* we were at the last line under the tag root */
 
   /* We need to go up out of this node, and on to the next one with
@@ -4395,7 +4456,7 @@ _gtk_text_line_next_could_contain_tag (GtkTextLine  *line,
   below_tag_root = FALSE;
   while (node != NULL)
     {
-      if (node == info->tag_root)
+      if (node == tag_root)
         {
           below_tag_root = TRUE;
           break;
@@ -4407,7 +4468,7 @@ _gtk_text_line_next_could_contain_tag (GtkTextLine  *line,
   if (below_tag_root)
     {
       node = line->parent;
-      while (node != info->tag_root)
+      while (node != tag_root)
         {
           if (node->next == NULL)
             node = node->parent;
@@ -4425,12 +4486,12 @@ _gtk_text_line_next_could_contain_tag (GtkTextLine  *line,
     {
       gint ordering;
 
-      ordering = node_compare (line->parent, info->tag_root);
+      ordering = node_compare (line->parent, tag_root);
 
       if (ordering < 0)
         {
           /* Tag root is ahead of us, so search there. */
-          node = info->tag_root;
+          node = tag_root;
           goto found;
         }
       else
@@ -4501,6 +4562,7 @@ _gtk_text_line_previous_could_contain_tag (GtkTextLine  *line,
 {
   GtkTextBTreeNode *node;
   GtkTextBTreeNode *found_node = NULL;
+  GtkTextBTreeNode *tag_root;
   GtkTextTagInfo *info;
   gboolean below_tag_root;
   GtkTextLine *prev;
@@ -4518,27 +4580,33 @@ _gtk_text_line_previous_could_contain_tag (GtkTextLine  *line,
     _gtk_text_btree_check (tree);
 #endif
 
+  /* Return same-node line, if any. */
+  prev = prev_line_under_node (line->parent, line);
+
   if (tag == NULL)
     {
-      /* Right now we can only offer linear-search if the user wants
-       * to know about any tag toggle at all.
-       */
-      return _gtk_text_line_previous (line);
-    }
+      if (prev && line->parent->num_toggles > 0)
+        return prev;
 
-  /* Return same-node line, if any. */
-  prev = prev_line_under_node (line->parent, line);
-  if (prev)
-    return prev;
+      tag_root = tree->root_node;
+      if (tag_root->num_toggles == 0)
+        return NULL;
+    }
+  else
+    {
+      if (prev)
+        return prev;
 
-  info = gtk_text_btree_get_existing_tag_info (tree, tag);
-  if (info == NULL)
-    return NULL;
+      info = gtk_text_btree_get_existing_tag_info (tree, tag);
+      if (info == NULL)
+        return NULL;
 
-  if (info->tag_root == NULL)
-    return NULL;
+      tag_root = info->tag_root;
+      if (tag_root == NULL)
+        return NULL;
+    }
 
-  if (info->tag_root == line->parent)
+  if (tag_root == line->parent)
     return NULL; /* we were at the first line under the tag root */
 
   /* Are we below the tag root */
@@ -4546,7 +4614,7 @@ _gtk_text_line_previous_could_contain_tag (GtkTextLine  *line,
   below_tag_root = FALSE;
   while (node != NULL)
     {
-      if (node == info->tag_root)
+      if (node == tag_root)
         {
           below_tag_root = TRUE;
           break;
@@ -4570,7 +4638,7 @@ _gtk_text_line_previous_could_contain_tag (GtkTextLine  *line,
       line_ancestor = line->parent;
       line_ancestor_parent = line->parent->parent;
 
-      while (line_ancestor != info->tag_root)
+      while (line_ancestor != tag_root)
         {
           GSList *child_nodes = NULL;
           GSList *tmp;
@@ -4622,7 +4690,7 @@ _gtk_text_line_previous_could_contain_tag (GtkTextLine  *line,
     {
       gint ordering;
 
-      ordering = node_compare (line->parent, info->tag_root);
+      ordering = node_compare (line->parent, tag_root);
 
       if (ordering < 0)
         {
@@ -4636,7 +4704,7 @@ _gtk_text_line_previous_could_contain_tag (GtkTextLine  *line,
           /* Tag root is after us, so grab last tagged
            * line underneath the tag root.
            */
-          found_node = info->tag_root;
+          found_node = tag_root;
           goto found;
         }
 
@@ -4752,6 +4820,87 @@ gtk_text_line_new (void)
   return line;
 }
 
+/*
+ * Packed lines
+ *
+ * Most lines of a big text are inserted as a whole and never get any
+ * tags, marks or anchors, so they consist of nothing but a single char
+ * segment. Such lines are allocated together with their segment.
+ * The segment functions don't know about this, so a packed line gets
+ * a separately allocated copy of its segment before anything else
+ * touches its segments.
+ */
+
+typedef struct {
+  GtkTextLine line;
+  GtkTextLineSegment seg;    /* Actual size varies */
+} PackedLine;
+
+#define PACKED_LINE_SEGMENT(line) (&((PackedLine *) (line))->seg)
+#define PACKED_LINE_SIZE(len) (G_STRUCT_OFFSET (PackedLine, seg) \
+        + _gtk_char_segment_get_size (len))
+
+static GtkTextLine*
+gtk_text_line_new_packed (const gchar *text,
+                          guint        len)
+{
+  GtkTextLine *line;
+
+  line = g_slice_alloc0 (PACKED_LINE_SIZE (len));
+  line->dir_strong = PANGO_DIRECTION_NEUTRAL;
+  line->dir_propagated_forward = PANGO_DIRECTION_NEUTRAL;
+  line->dir_propagated_back = PANGO_DIRECTION_NEUTRAL;
+  line->packed = TRUE;
+
+  line->segments = PACKED_LINE_SEGMENT (line);
+  _gtk_char_segment_init (line->segments, text, len);
+
+  return line;
+}
+
+/*
+ * _gtk_text_line_unpack:
+ * @line: a #GtkTextLine
+ *
+ * Replaces the segment of a packed line with a copy that can be
+ * split, merged and freed like any other segment. This has to be
+ * done before any segment gets added to, removed from or moved
+ * out of @line.
+ *
+ * Returns: %TRUE if the segments of @line changed
+ */
+gboolean
+_gtk_text_line_unpack (GtkTextLine *line)
+{
+  GtkTextLineSegment *seg;
+  GtkTextLineSegment *copy;
+
+  if (!line->packed || line->segments != PACKED_LINE_SEGMENT (line))
+    return FALSE;
+
+  seg = line->segments;
+  copy = _gtk_char_segment_new (seg->body.chars, seg->byte_count);
+  copy->next = seg->next;
+  line->segments = copy;
+
+  /* The text itself goes away with the line */
+  _gtk_char_segment_clear (seg);
+
+  return TRUE;
+}
+
+static int
+gtk_text_line_delete_segment (GtkTextLine        *line,
+                              GtkTextLineSegment *seg,
+                              gboolean            tree_gone)
+{
+  /* The segment of a packed line is freed with the line */
+  if (line->packed && seg == PACKED_LINE_SEGMENT (line))
+    return 0;
+
+  return (*seg->type->deleteFunc) (seg, line, tree_gone);
+}
+
 static void
 gtk_text_line_destroy (GtkTextBTree *tree, GtkTextLine *line)
 {
@@ -4775,7 +4924,15 @@ gtk_text_line_destroy (GtkTextBTree *tree, GtkTextLine *line)
       ld = next;
     }
 
-  g_slice_free (GtkTextLine, line);
+  if (line->packed)
+    {
+      GtkTextLineSegment *seg = PACKED_LINE_SEGMENT (line);
+
+      _gtk_char_segment_clear (seg);
+      g_slice_free1 (PACKED_LINE_SIZE (seg->byte_count), line);
+    }
+  else
+    g_slice_free (GtkTextLine, line);
 }
 
 static void
@@ -4888,6 +5045,7 @@ gtk_text_btree_node_new (void)
 
   node = g_slice_new (GtkTextBTreeNode);
 
+  node->num_toggles = 0;
   node->node_data = NULL;
 
   return node;
@@ -4932,11 +5090,16 @@ gtk_text_btree_node_has_tag (GtkTextBTreeNode *node, GtkTextTag *tag)
 {
   Summary *summary;
 
+  if (node->num_toggles == 0)
+    return FALSE;
+
+  if (tag == NULL)
+    return TRUE;
+
   summary = node->summary;
   while (summary != NULL)
     {
-      if (tag == NULL ||
-          summary->info->tag == tag)
+      if (summary->info->tag == tag)
         return TRUE;
 
       summary = summary->next;
@@ -5060,6 +5223,58 @@ _gtk_text_btree_is_valid (GtkTextBTree *tree,
   return (nd && nd->valid);
 }
 
+/**
+ * _gtk_text_btree_get_first_invalid_line:
+ * @tree: a #GtkTextBTree
+ * @view_id: ID for the view
+ *
+ * Finds the line that _gtk_text_btree_validate() will start
+ * validating at for the given view.
+ *
+ * Returns: the first invalid line, or %NULL if the entire
+ * #GtkTextBTree is valid
+ **/
+GtkTextLine *
+_gtk_text_btree_get_first_invalid_line (GtkTextBTree *tree,
+                                        gpointer      view_id)
+{
+  GtkTextBTreeNode *node;
+  GtkTextLine *line;
+  GtkTextLineData *ld;
+  NodeData *nd;
+
+  g_return_val_if_fail (tree != NULL, NULL);
+
+  node = tree->root_node;
+  nd = node_data_find (node->node_data, view_id);
+  if (nd && nd->valid)
+    return NULL;
+
+  while (node->level > 0)
+    {
+      node = node->children.node;
+      while (node)
+        {
+          nd = node_data_find (node->node_data, view_id);
+          if (!nd || !nd->valid)
+            break;
+          node = node->next;
+        }
+
+      if (node == NULL)
+        return NULL;
+    }
+
+  for (line = node->children.line; line != NULL; line = line->next)
+    {
+      ld = _gtk_text_line_get_data (line, view_id);
+      if (!ld || !ld->valid)
+        return line;
+    }
+
+  return NULL;
+}
+
 typedef struct _ValidateState ValidateState;
 
 struct _ValidateState
@@ -5510,7 +5725,7 @@ gtk_text_btree_node_destroy (GtkTextBTree *tree, GtkTextBTreeNode *node)
               seg = line->segments;
               line->segments = seg->next;
 
-              (*seg->type->deleteFunc) (seg, line, TRUE);
+              gtk_text_line_delete_segment (line, seg, TRUE);
             }
           gtk_text_line_destroy (tree, line);
         }
@@ -5694,17 +5909,29 @@ tag_changed_cb (GtkTextTagTable *table,
     }
   else
     {
-      /* We only need to queue a redraw, not a relayout */
+      /* We only need to queue a redraw, not a relayout, and only
+       * of the lines between the first and last toggle of the tag.
+       */
+      GtkTextIter start;
+      GtkTextIter end;
       BTreeView *view;
 
+      if (!_gtk_text_btree_get_iter_at_first_toggle (tree, &start, tag))
+        return;
+
+      _gtk_text_btree_get_iter_at_last_toggle (tree, &end, tag);
+
       view = tree->views;
 
       while (view != NULL)
         {
-          gint width, height;
+          gint start_y, end_y, end_height;
 
-          _gtk_text_btree_get_view_size (tree, view->view_id, &width, &height);
-          gtk_text_layout_changed (view->layout, 0, height, height);
+          gtk_text_layout_get_line_yrange (view->layout, &start, &start_y, NULL);
+          gtk_text_layout_get_line_yrange (view->layout, &end, &end_y, &end_height);
+          gtk_text_layout_changed (view->layout, start_y,
+                                   end_y + end_height - start_y,
+                                   end_y + end_height - start_y);
 
           view = view->next;
         }
@@ -6122,6 +6349,7 @@ recompute_level_zero_counts (GtkTextBTreeNode *node)
 
               info = seg->body.toggle.info;
 
+              node->num_toggles++;
               gtk_text_btree_node_adjust_toggle_count (node, info, 1);
             }
 
@@ -6146,6 +6374,7 @@ recompute_level_nonzero_counts (GtkTextBTreeNode *node)
       node->num_children += 1;
       node->num_lines += child->num_lines;
       node->num_chars += child->num_chars;
+      node->num_toggles += child->num_toggles;
 
       if (child->parent != node)
         {
@@ -6210,6 +6439,7 @@ recompute_node_counts (GtkTextBTree *tree, GtkTextBTreeNode *node)
   node->num_children = 0;
   node->num_lines = 0;
   node->num_chars = 0;
+  node->num_toggles = 0;
 
   /*
    * Scan through the children, adding the childrens’ tag counts into
@@ -6286,6 +6516,9 @@ _gtk_change_node_toggle_count (GtkTextBTreeNode *node,
   GtkTextBTreeNode *node2Ptr;
   int rootLevel;                        /* Level of original tag root */
 
+  for (node2Ptr = node; node2Ptr != NULL; node2Ptr = node2Ptr->parent)
+    node2Ptr->num_toggles += delta;
+
   info->toggle_count += delta;
 
   if (info->tag_root == (GtkTextBTreeNode *) NULL)
@@ -6470,14 +6703,15 @@ _gtk_change_node_toggle_count (GtkTextBTreeNode *node,
  *
  *      This is a utility procedure used by _gtk_text_btree_get_tags.  It
  *      increments the count for a particular tag, adding a new
- *      entry for that tag if there wasn’t one previously.
+ *      entry for that tag if there wasn’t one previously. Counts are
+ *      kept per tag priority, so this takes constant time.
  *
  * Results:
  *      None.
  *
  * Side effects:
- *      The information at *tagInfoPtr may be modified, and the arrays
- *      may be reallocated to make them larger.
+ *      The information at *tagInfoPtr may be modified, and the tags
+ *      array may be reallocated to make it larger.
  *
  *----------------------------------------------------------------------
  */
@@ -6485,48 +6719,33 @@ _gtk_change_node_toggle_count (GtkTextBTreeNode *node,
 static void
 inc_count (GtkTextTag *tag, int inc, TagInfo *tagInfoPtr)
 {
-  GtkTextTag **tag_p;
-  int count;
+  guchar *toggles;
 
-  for (tag_p = tagInfoPtr->tags, count = tagInfoPtr->numTags;
-       count > 0; tag_p++, count--)
+  toggles = &tagInfoPtr->toggles[tag->priv->priority];
+
+  if (!(*toggles & TAG_SEEN))
     {
-      if (*tag_p == tag)
+      /*
+       * There isn’t currently an entry for this tag, so we have to
+       * make a new one.  If the array is full, then enlarge the
+       * array first.
+       */
+
+      if (tagInfoPtr->numTags == tagInfoPtr->arraySize)
         {
-          tagInfoPtr->counts[tagInfoPtr->numTags-count] += inc;
-          return;
+          tagInfoPtr->arraySize *= 2;
+          tagInfoPtr->tags = g_renew (GtkTextTag *, tagInfoPtr->tags,
+                                      tagInfoPtr->arraySize);
         }
-    }
-
-  /*
-   * There isn’t currently an entry for this tag, so we have to
-   * make a new one.  If the arrays are full, then enlarge the
-   * arrays first.
-   */
 
-  if (tagInfoPtr->numTags == tagInfoPtr->arraySize)
-    {
-      GtkTextTag **newTags;
-      int *newCounts, newSize;
-
-      newSize = 2*tagInfoPtr->arraySize;
-      newTags = (GtkTextTag **) g_malloc ((unsigned)
-                                          (newSize*sizeof (GtkTextTag *)));
-      memcpy ((void *) newTags, (void *) tagInfoPtr->tags,
-              tagInfoPtr->arraySize  *sizeof (GtkTextTag *));
-      g_free ((char *) tagInfoPtr->tags);
-      tagInfoPtr->tags = newTags;
-      newCounts = (int *) g_malloc ((unsigned) (newSize*sizeof (int)));
-      memcpy ((void *) newCounts, (void *) tagInfoPtr->counts,
-              tagInfoPtr->arraySize  *sizeof (int));
-      g_free ((char *) tagInfoPtr->counts);
-      tagInfoPtr->counts = newCounts;
-      tagInfoPtr->arraySize = newSize;
+      tagInfoPtr->tags[tagInfoPtr->numTags] = tag;
+      tagInfoPtr->numTags++;
+      *toggles = TAG_SEEN;
     }
 
-  tagInfoPtr->tags[tagInfoPtr->numTags] = tag;
-  tagInfoPtr->counts[tagInfoPtr->numTags] = inc;
-  tagInfoPtr->numTags++;
+  /* Only whether the count is odd matters */
+  if (inc & 1)
+    *toggles ^= TAG_TOGGLED_ON;
 }
 
 static void
@@ -6709,7 +6928,7 @@ gtk_text_btree_node_check_consistency (GtkTextBTree     *tree,
   Summary *summary, *summary2;
   GtkTextLine *line;
   GtkTextLineSegment *segPtr;
-  int num_children, num_lines, num_chars, toggle_count, min_children;
+  int num_children, num_lines, num_chars, num_toggles, toggle_count, min_children;
   GtkTextLineData *ld;
   NodeData *nd;
 
@@ -6741,6 +6960,7 @@ gtk_text_btree_node_check_consistency (GtkTextBTree     *tree,
   num_children = 0;
   num_lines = 0;
   num_chars = 0;
+  num_toggles = 0;
   if (node->level == 0)
     {
       for (line = node->children.line; line != NULL;
@@ -6783,6 +7003,11 @@ gtk_text_btree_node_check_consistency (GtkTextBTree     *tree,
                 }
 
               num_chars += segPtr->char_count;
+
+              if ((segPtr->type == &gtk_text_toggle_on_type ||
+                   segPtr->type == &gtk_text_toggle_off_type) &&
+                  segPtr->body.toggle.inNodeCounts)
+                num_toggles++;
             }
 
           num_children++;
@@ -6829,6 +7054,7 @@ gtk_text_btree_node_check_consistency (GtkTextBTree     *tree,
           num_children++;
           num_lines += childnode->num_lines;
           num_chars += childnode->num_chars;
+          num_toggles += childnode->num_toggles;
         }
     }
   if (num_children != node->num_children)
@@ -6846,6 +7072,11 @@ gtk_text_btree_node_check_consistency (GtkTextBTree     *tree,
       g_error ("gtk_text_btree_node_check_consistency: mismatch in num_chars (%d %d)",
                num_chars, node->num_chars);
     }
+  if (num_toggles != node->num_toggles)
+    {
+      g_error ("gtk_text_btree_node_check_consistency: mismatch in num_toggles (%d %d)",
+               num_toggles, node->num_toggles);
+    }
 
   for (summary = node->summary; summary != NULL;
        summary = summary->next)
@@ -98,6 +98,8 @@ void         _gtk_text_btree_get_view_size     (GtkTextBTree      *tree,
                                                 gint              *height);
 gboolean     _gtk_text_btree_is_valid          (GtkTextBTree      *tree,
                                                 gpointer           view_id);
+GtkTextLine *_gtk_text_btree_get_first_invalid_line (GtkTextBTree *tree,
+                                                   gpointer      view_id);
 gboolean     _gtk_text_btree_validate          (GtkTextBTree      *tree,
                                                 gpointer           view_id,
                                                 gint               max_pixels,
@@ -245,6 +247,9 @@ struct _GtkTextLine {
   guchar dir_strong;                /* BiDi algo dir of line */
   guchar dir_propagated_back;       /* BiDi algo dir of next line */
   guchar dir_propagated_forward;    /* BiDi algo dir of prev line */
+  guchar packed : 1;                /* Allocated together with its first
+                                     * char segment, see
+                                     * _gtk_text_line_unpack () */
 };
 
 
@@ -264,6 +269,7 @@ gboolean            _gtk_text_line_contains_end_iter          (GtkTextLine
 GtkTextLine *       _gtk_text_line_next                       (GtkTextLine         *line);
 GtkTextLine *       _gtk_text_line_next_excluding_last        (GtkTextLine         *line);
 GtkTextLine *       _gtk_text_line_previous                   (GtkTextLine         *line);
+gboolean            _gtk_text_line_unpack                     (GtkTextLine         *line);
 void                _gtk_text_line_add_data                   (GtkTextLine         *line,
                                                                GtkTextLineData     *data);
 gpointer            _gtk_text_line_remove_data                (GtkTextLine         *line,
@@ -63,6 +63,9 @@ struct _GtkTextBufferPrivate
 
   guint user_action_count;
 
+  gint max_lines;
+  guint trim_lines_cb;
+
   /* Whether the buffer has been modified since last save */
   guint modified : 1;
   guint has_selection : 1;
@@ -107,6 +110,7 @@ enum {
   PROP_CURSOR_POSITION,
   PROP_COPY_TARGET_LIST,
   PROP_PASTE_TARGET_LIST,
+  PROP_MAX_LINES,
   LAST_PROP
 };
 
@@ -261,31 +265,85 @@ gtk_text_buffer_content_new (GtkTextBuffer *buffer)
   return GDK_CONTENT_PROVIDER (content);
 }
 
+/* Text is inserted as it arrives, so large pastes never
+ * need to be in memory as a whole before they are in the buffer */
+#define DESERIALIZE_CHUNK_SIZE (64 * 1024)
+
+typedef struct
+{
+  GInputStream *stream;
+  char data[DESERIALIZE_CHUNK_SIZE];
+} DeserializeData;
+
 static void
-gtk_text_buffer_deserialize_text_plain_finish (GObject      *source,
-                                               GAsyncResult *result,
-                                               gpointer      deserializer)
+deserialize_data_free (gpointer data)
 {
-  GOutputStream *stream = G_OUTPUT_STREAM (source);
+  DeserializeData *deserialize_data = data;
+
+  g_object_unref (deserialize_data->stream);
+  g_free (deserialize_data);
+}
+
+static void gtk_text_buffer_deserialize_text_plain_read (GObject      *source,
+                                                         GAsyncResult *result,
+                                                         gpointer      deserializer);
+
+static void
+gtk_text_buffer_deserialize_text_plain_read_next (GdkContentDeserializer *deserializer)
+{
+  DeserializeData *data = gdk_content_deserializer_get_task_data (deserializer);
+
+  g_input_stream_read_async (data->stream,
+                             data->data,
+                             DESERIALIZE_CHUNK_SIZE,
+                             gdk_content_deserializer_get_priority (deserializer),
+                             gdk_content_deserializer_get_cancellable (deserializer),
+                             gtk_text_buffer_deserialize_text_plain_read,
+                             deserializer);
+}
+
+static void
+gtk_text_buffer_deserialize_text_plain_read (GObject      *source,
+                                             GAsyncResult *result,
+                                             gpointer      deserializer)
+{
+  GInputStream *stream = G_INPUT_STREAM (source);
+  DeserializeData *data = gdk_content_deserializer_get_task_data (deserializer);
   GtkTextBuffer *buffer;
   GtkTextIter start, end;
   GError *error = NULL;
-  gssize written;
+  gssize n_read;
+  const char *nul;
 
-  written = g_output_stream_splice_finish (stream, result, &error);
-  if (written < 0)
+  n_read = g_input_stream_read_finish (stream, result, &error);
+  if (n_read < 0)
     {
       gdk_content_deserializer_return_error (deserializer, error);
       return;
     }
 
   buffer = g_value_get_object (gdk_content_deserializer_get_value (deserializer));
-  gtk_text_buffer_get_end_iter (buffer, &end);
-  gtk_text_buffer_insert (buffer, 
-                          &end,
-                          g_memory_output_stream_steal_data (G_MEMORY_OUTPUT_STREAM (
-                               g_filter_output_stream_get_base_stream (G_FILTER_OUTPUT_STREAM (stream)))),
-                          -1);
+
+  /* The text ends at a nul byte, if there is one */
+  nul = memchr (data->data, '\0', n_read);
+  if (nul)
+    n_read = nul - data->data;
+
+  if (n_read > 0)
+    {
+      /* The converter only returns complete characters */
+      gtk_text_buffer_get_end_iter (buffer, &end);
+      gtk_text_buffer_insert (buffer, &end, data->data, n_read);
+    }
+
+  if (n_read > 0 && nul == NULL)
+    {
+      gtk_text_buffer_deserialize_text_plain_read_next (deserializer);
+      return;
+    }
+
+  g_input_stream_close (stream, NULL, NULL);
+
   gtk_text_buffer_get_bounds (buffer, &start, &end);
   gtk_text_buffer_select_range (buffer, &start, &end);
 
@@ -295,14 +353,14 @@ gtk_text_buffer_deserialize_text_plain_finish (GObject      *source,
 static void
 gtk_text_buffer_deserialize_text_plain (GdkContentDeserializer *deserializer)
 {
-  GOutputStream *output, *filter;
   GCharsetConverter *converter;
   GtkTextBuffer *buffer;
+  DeserializeData *data;
   GError *error = NULL;
 
   buffer = gtk_text_buffer_new (NULL);
-  g_value_set_object (gdk_content_deserializer_get_value (deserializer),
-                      buffer);
+  g_value_take_object (gdk_content_deserializer_get_value (deserializer),
+                       buffer);
 
   /* validates the stream */
   converter = g_charset_converter_new ("utf-8", "utf-8", &error);
@@ -313,19 +371,13 @@ gtk_text_buffer_deserialize_text_plain (GdkContentDeserializer *deserializer)
     }
   g_charset_converter_set_use_fallback (converter, TRUE);
 
-  output = g_memory_output_stream_new_resizable ();
-  filter = g_converter_output_stream_new (output, G_CONVERTER (converter));
-  g_object_unref (output);
+  data = g_new (DeserializeData, 1);
+  data->stream = g_converter_input_stream_new (gdk_content_deserializer_get_input_stream (deserializer),
+                                               G_CONVERTER (converter));
   g_object_unref (converter);
+  gdk_content_deserializer_set_task_data (deserializer, data, deserialize_data_free);
 
-  g_output_stream_splice_async (filter,
-                                gdk_content_deserializer_get_input_stream (deserializer),
-                                G_OUTPUT_STREAM_SPLICE_CLOSE_SOURCE | G_OUTPUT_STREAM_SPLICE_CLOSE_TARGET,
-                                gdk_content_deserializer_get_priority (deserializer),
-                                gdk_content_deserializer_get_cancellable (deserializer),
-                                gtk_text_buffer_deserialize_text_plain_finish,
-                                deserializer);
-  g_object_unref (filter);
+  gtk_text_buffer_deserialize_text_plain_read_next (deserializer);
 }
 
 static void
@@ -479,6 +531,21 @@ gtk_text_buffer_class_init (GtkTextBufferClass *klass)
                           GDK_TYPE_CONTENT_FORMATS,
                           GTK_PARAM_READABLE);
 
+  /**
+   * GtkTextBuffer:max-lines:
+   *
+   * The maximum number of lines the buffer keeps, or 0 for no limit.
+   *
+   * See gtk_text_buffer_set_max_lines().
+   */
+  text_buffer_props[PROP_MAX_LINES] =
+      g_param_spec_int ("max-lines",
+                        P_("Maximum lines"),
+                        P_("The maximum number of lines to keep, or 0 for no limit"),
+                        0, G_MAXINT,
+                        0,
+                        GTK_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_install_properties (object_class, LAST_PROP, text_buffer_props);
 
   /**
@@ -899,6 +966,10 @@ gtk_text_buffer_set_property (GObject         *object,
 				g_value_get_string (value), -1);
       break;
 
+    case PROP_MAX_LINES:
+      gtk_text_buffer_set_max_lines (text_buffer, g_value_get_int (value));
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -945,6 +1016,10 @@ gtk_text_buffer_get_property (GObject         *object,
       g_value_set_int (value, gtk_text_iter_get_offset (&iter));
       break;
 
+    case PROP_MAX_LINES:
+      g_value_set_int (value, text_buffer->priv->max_lines);
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -980,6 +1055,12 @@ gtk_text_buffer_finalize (GObject *object)
 
   remove_all_selection_clipboards (buffer);
 
+  if (priv->trim_lines_cb != 0)
+    {
+      g_source_remove (priv->trim_lines_cb);
+      priv->trim_lines_cb = 0;
+    }
+
   if (priv->tag_table)
     {
       _gtk_text_tag_table_remove_buffer (priv->tag_table, buffer);
@@ -1074,6 +1155,54 @@ gtk_text_buffer_set_text (GtkTextBuffer *buffer,
  * Insertion
  */
 
+static void
+gtk_text_buffer_trim_lines (GtkTextBuffer *buffer)
+{
+  GtkTextIter start, end;
+  gint n_lines;
+
+  n_lines = gtk_text_buffer_get_line_count (buffer);
+  if (buffer->priv->max_lines == 0 || n_lines <= buffer->priv->max_lines)
+    return;
+
+  gtk_text_buffer_get_start_iter (buffer, &start);
+  gtk_text_buffer_get_iter_at_line (buffer, &end, n_lines - buffer->priv->max_lines);
+
+  gtk_text_buffer_delete (buffer, &start, &end);
+}
+
+static gboolean
+gtk_text_buffer_trim_lines_cb (gpointer data)
+{
+  GtkTextBuffer *buffer = data;
+
+  buffer->priv->trim_lines_cb = 0;
+  gtk_text_buffer_trim_lines (buffer);
+
+  return G_SOURCE_REMOVE;
+}
+
+/* Trimming right away would invalidate the iters of whoever is
+ * inserting, so we do it once they are done. This also means that
+ * many insertions in a row only cause a single deletion.
+ */
+static void
+gtk_text_buffer_queue_trim_lines (GtkTextBuffer *buffer)
+{
+  GtkTextBufferPrivate *priv = buffer->priv;
+
+  if (priv->max_lines == 0 ||
+      priv->trim_lines_cb != 0 ||
+      gtk_text_buffer_get_line_count (buffer) <= priv->max_lines)
+    return;
+
+  /* Before the views get to redraw */
+  priv->trim_lines_cb = g_idle_add_full (G_PRIORITY_HIGH_IDLE,
+                                         gtk_text_buffer_trim_lines_cb,
+                                         buffer, NULL);
+  g_source_set_name_by_id (priv->trim_lines_cb, "[gtk] gtk_text_buffer_trim_lines_cb");
+}
+
 static void
 gtk_text_buffer_real_insert_text (GtkTextBuffer *buffer,
                                   GtkTextIter   *iter,
@@ -1085,6 +1214,8 @@ gtk_text_buffer_real_insert_text (GtkTextBuffer *buffer,
   
   _gtk_text_btree_insert (iter, text, len);
 
+  gtk_text_buffer_queue_trim_lines (buffer);
+
   g_signal_emit (buffer, signals[CHANGED], 0);
   g_object_notify_by_pspec (G_OBJECT (buffer), text_buffer_props[PROP_CURSOR_POSITION]);
 }
@@ -1718,6 +1849,138 @@ gtk_text_buffer_insert_with_tags (GtkTextBuffer *buffer,
   va_end (args);
 }
 
+typedef struct
+{
+  gint start;
+  gint end;
+} TagRun;
+
+static void
+apply_tag_run (GtkTextBuffer *buffer,
+               GtkTextTag    *tag,
+               gint           start_offset,
+               const TagRun  *run)
+{
+  GtkTextIter start, end;
+
+  gtk_text_buffer_get_iter_at_offset (buffer, &start, start_offset + run->start);
+  gtk_text_buffer_get_iter_at_offset (buffer, &end, start_offset + run->end);
+
+  gtk_text_buffer_apply_tag (buffer, tag, &start, &end);
+}
+
+/**
+ * gtk_text_buffer_insert_chunks:
+ * @buffer: a #GtkTextBuffer
+ * @iter: an iterator in @buffer
+ * @chunks: (array length=n_chunks): the chunks of text to insert
+ * @n_chunks: the number of chunks
+ *
+ * Inserts the text of all @chunks into @buffer at @iter, one after
+ * the other, and applies the tags of every chunk to its text.
+ *
+ * This has the same result as calling gtk_text_buffer_insert_with_tags()
+ * for every chunk, but it is a lot faster when inserting many chunks:
+ * all text is inserted at once, so that the #GtkTextBuffer::insert-text
+ * signal is only emitted once, and the tags are only applied after
+ * that, once for every run of consecutive chunks that use the same tag.
+ *
+ * @iter is invalidated when insertion occurs, but revalidated to point
+ * to the end of the inserted text.
+ */
+void
+gtk_text_buffer_insert_chunks (GtkTextBuffer            *buffer,
+                               GtkTextIter              *iter,
+                               const GtkTextBufferChunk *chunks,
+                               guint                     n_chunks)
+{
+  GHashTable *runs;
+  GHashTableIter hash_iter;
+  GString *text;
+  gint start_offset, offset;
+  gpointer tag, run;
+  guint i, j;
+
+  g_return_if_fail (GTK_IS_TEXT_BUFFER (buffer));
+  g_return_if_fail (iter != NULL);
+  g_return_if_fail (chunks != NULL || n_chunks == 0);
+  g_return_if_fail (gtk_text_iter_get_buffer (iter) == buffer);
+
+  text = g_string_new (NULL);
+  for (i = 0; i < n_chunks; i++)
+    {
+      if (chunks[i].text == NULL)
+        {
+          g_critical ("%s: chunk %u has no text", G_STRFUNC, i);
+          g_string_free (text, TRUE);
+          return;
+        }
+
+      for (j = 0; chunks[i].tags != NULL && chunks[i].tags[j] != NULL; j++)
+        {
+          if (!GTK_IS_TEXT_TAG (chunks[i].tags[j]) ||
+              chunks[i].tags[j]->priv->table != buffer->priv->tag_table)
+            {
+              g_critical ("%s: chunk %u has a tag that is not in the tag table of the buffer",
+                          G_STRFUNC, i);
+              g_string_free (text, TRUE);
+              return;
+            }
+        }
+
+      g_string_append_len (text, chunks[i].text,
+                           chunks[i].len < 0 ? strlen (chunks[i].text) : chunks[i].len);
+    }
+
+  start_offset = gtk_text_iter_get_offset (iter);
+
+  gtk_text_buffer_insert (buffer, iter, text->str, text->len);
+
+  /* Collect the runs of chunks that share a tag, and apply
+   * each run when it ends.
+   */
+  runs = g_hash_table_new_full (NULL, NULL, NULL, g_free);
+  offset = 0;
+  for (i = 0; i < n_chunks; i++)
+    {
+      gint len, start;
+
+      len = chunks[i].len < 0 ? strlen (chunks[i].text) : chunks[i].len;
+      start = offset;
+      offset += g_utf8_strlen (chunks[i].text, len);
+
+      if (chunks[i].tags == NULL || start == offset)
+        continue;
+
+      for (j = 0; chunks[i].tags[j] != NULL; j++)
+        {
+          TagRun *tag_run;
+
+          tag_run = g_hash_table_lookup (runs, chunks[i].tags[j]);
+          if (tag_run == NULL)
+            {
+              tag_run = g_new (TagRun, 1);
+              tag_run->start = start;
+              g_hash_table_insert (runs, chunks[i].tags[j], tag_run);
+            }
+          else if (tag_run->end != start)
+            {
+              apply_tag_run (buffer, chunks[i].tags[j], start_offset, tag_run);
+              tag_run->start = start;
+            }
+
+          tag_run->end = offset;
+        }
+    }
+
+  g_hash_table_iter_init (&hash_iter, runs);
+  while (g_hash_table_iter_next (&hash_iter, &tag, &run))
+    apply_tag_run (buffer, tag, start_offset, run);
+
+  g_hash_table_unref (runs);
+  g_string_free (text, TRUE);
+}
+
 /**
  * gtk_text_buffer_insert_with_tags_by_name:
  * @buffer: a #GtkTextBuffer
@@ -4722,3 +4985,59 @@ gtk_text_buffer_insert_markup (GtkTextBuffer *buffer,
   pango_attr_list_unref (attributes);
   g_free (text); 
 }
+
+/**
+ * gtk_text_buffer_set_max_lines:
+ * @buffer: a #GtkTextBuffer
+ * @max_lines: the maximum number of lines, or 0 for no limit
+ *
+ * Sets the maximum number of lines @buffer keeps. When text is
+ * inserted that makes the buffer grow beyond this, lines are removed
+ * from the start of the buffer, like the scrollback of a terminal.
+ *
+ * The lines are removed when the main loop is idle, so that iters
+ * used by code that inserts text stay valid and many insertions only
+ * cause a single deletion. Setting the limit removes lines right away.
+ **/
+void
+gtk_text_buffer_set_max_lines (GtkTextBuffer *buffer,
+                               gint           max_lines)
+{
+  GtkTextBufferPrivate *priv;
+
+  g_return_if_fail (GTK_IS_TEXT_BUFFER (buffer));
+  g_return_if_fail (max_lines >= 0);
+
+  priv = buffer->priv;
+
+  if (priv->max_lines == max_lines)
+    return;
+
+  priv->max_lines = max_lines;
+
+  if (priv->trim_lines_cb != 0)
+    {
+      g_source_remove (priv->trim_lines_cb);
+      priv->trim_lines_cb = 0;
+    }
+
+  gtk_text_buffer_trim_lines (buffer);
+
+  g_object_notify_by_pspec (G_OBJECT (buffer), text_buffer_props[PROP_MAX_LINES]);
+}
+
+/**
+ * gtk_text_buffer_get_max_lines:
+ * @buffer: a #GtkTextBuffer
+ *
+ * Gets the value set with gtk_text_buffer_set_max_lines().
+ *
+ * Returns: the maximum number of lines, or 0 for no limit
+ **/
+gint
+gtk_text_buffer_get_max_lines (GtkTextBuffer *buffer)
+{
+  g_return_val_if_fail (GTK_IS_TEXT_BUFFER (buffer), 0);
+
+  return buffer->priv->max_lines;
+}
@@ -156,6 +156,24 @@ struct _GtkTextBufferClass
   void (*_gtk_reserved4) (void);
 };
 
+/**
+ * GtkTextBufferChunk:
+ * @text: UTF-8 text
+ * @len: length of @text in bytes, or -1 if it is nul-terminated
+ * @tags: (array zero-terminated=1) (nullable): %NULL-terminated array
+ *   of tags to apply to @text, or %NULL
+ *
+ * A piece of tagged text for gtk_text_buffer_insert_chunks().
+ */
+typedef struct _GtkTextBufferChunk GtkTextBufferChunk;
+
+struct _GtkTextBufferChunk
+{
+  const gchar *text;
+  gint len;
+  GtkTextTag **tags;
+};
+
 GDK_AVAILABLE_IN_ALL
 GType        gtk_text_buffer_get_type       (void) G_GNUC_CONST;
 
@@ -230,6 +248,12 @@ void    gtk_text_buffer_insert_with_tags_by_name  (GtkTextBuffer     *buffer,
                                                    const gchar       *first_tag_name,
                                                    ...) G_GNUC_NULL_TERMINATED;
 
+GDK_AVAILABLE_IN_ALL
+void     gtk_text_buffer_insert_chunks            (GtkTextBuffer            *buffer,
+                                                   GtkTextIter              *iter,
+                                                   const GtkTextBufferChunk *chunks,
+                                                   guint                     n_chunks);
+
 GDK_AVAILABLE_IN_ALL
 void     gtk_text_buffer_insert_markup            (GtkTextBuffer     *buffer,
                                                    GtkTextIter       *iter,
@@ -422,6 +446,12 @@ void            gtk_text_buffer_set_modified            (GtkTextBuffer *buffer,
 GDK_AVAILABLE_IN_ALL
 gboolean        gtk_text_buffer_get_has_selection       (GtkTextBuffer *buffer);
 
+GDK_AVAILABLE_IN_ALL
+void            gtk_text_buffer_set_max_lines           (GtkTextBuffer *buffer,
+                                                         gint           max_lines);
+GDK_AVAILABLE_IN_ALL
+gint            gtk_text_buffer_get_max_lines           (GtkTextBuffer *buffer);
+
 GDK_AVAILABLE_IN_ALL
 void gtk_text_buffer_add_selection_clipboard    (GtkTextBuffer     *buffer,
 						 GdkClipboard      *clipboard);
@@ -811,40 +811,120 @@ get_text_renderer (void)
   return text_renderer;
 }
 
+/* Renders the text of @line_display, with the selection and the block
+ * cursor but without the insertion cursors, into a node that is kept
+ * with the line display. Redrawing a line whose text did not change,
+ * like when the cursor blinks or the view scrolls, reuses the node.
+ */
+static GskRenderNode *
+get_line_node (GtkTextRenderer    *text_renderer,
+               GtkWidget          *widget,
+               GtkTextLineDisplay *line_display,
+               int                 width,
+               int                 selection_start_index,
+               int                 selection_end_index)
+{
+  GtkStateFlags state;
+  gboolean block_cursor;
+  cairo_t *cr;
+
+  state = gtk_widget_get_state_flags (widget);
+  block_cursor = line_display->has_block_cursor;
+
+  if (line_display->node != NULL &&
+      line_display->node_selection_start == selection_start_index &&
+      line_display->node_selection_end == selection_end_index &&
+      line_display->node_state == state &&
+      line_display->node_block_cursor == block_cursor)
+    return line_display->node;
+
+  g_clear_pointer (&line_display->node, gsk_render_node_unref);
+
+  line_display->node = gsk_cairo_node_new (&GRAPHENE_RECT_INIT (0, 0, width, line_display->height));
+  line_display->node_selection_start = selection_start_index;
+  line_display->node_selection_end = selection_end_index;
+  line_display->node_state = state;
+  line_display->node_block_cursor = block_cursor;
+
+  cr = gsk_cairo_node_get_draw_context (line_display->node);
+  text_renderer_begin (text_renderer, widget, cr);
+
+  render_para (text_renderer, line_display,
+               selection_start_index, selection_end_index);
+
+  text_renderer_end (text_renderer);
+  cairo_destroy (cr);
+
+  return line_display->node;
+}
+
+static void
+snapshot_cursors (GtkWidget          *widget,
+                  GtkSnapshot        *snapshot,
+                  GtkTextLineDisplay *line_display,
+                  int                 width)
+{
+  GtkStyleContext *context;
+  PangoDirection dir;
+  cairo_t *cr;
+  int i;
+
+  context = gtk_widget_get_style_context (widget);
+  gtk_style_context_save_to_node (context, gtk_text_view_get_text_node ((GtkTextView *)widget));
+
+  cr = gtk_snapshot_append_cairo (snapshot,
+                                  &GRAPHENE_RECT_INIT (0, 0, width, line_display->height));
+
+  dir = (line_display->direction == GTK_TEXT_DIR_RTL) ? PANGO_DIRECTION_RTL : PANGO_DIRECTION_LTR;
+
+  for (i = 0; i < line_display->cursors->len; i++)
+    {
+      int index;
+
+      index = g_array_index(line_display->cursors, int, i);
+      gtk_render_insertion_cursor (context, cr,
+                                   line_display->x_offset, line_display->top_margin,
+                                   line_display->layout, index, dir);
+    }
+
+  cairo_destroy (cr);
+
+  gtk_style_context_restore (context);
+}
+
 void
 gtk_text_layout_snapshot (GtkTextLayout      *layout,
                           GtkWidget          *widget,
                           GtkSnapshot        *snapshot,
                           const GdkRectangle *clip)
 {
-  GtkStyleContext *context;
   gint offset_y;
+  gint width;
   GtkTextRenderer *text_renderer;
   GtkTextIter selection_start, selection_end;
   gboolean have_selection;
   GSList *line_list;
   GSList *tmp_list;
-  cairo_t *cr;
 
   g_return_if_fail (GTK_IS_TEXT_LAYOUT (layout));
   g_return_if_fail (layout->default_style != NULL);
   g_return_if_fail (layout->buffer != NULL);
   g_return_if_fail (snapshot != NULL);
 
-  context = gtk_widget_get_style_context (widget);
-
   line_list = gtk_text_layout_get_lines (layout, clip->y, clip->y + clip->height, &offset_y);
 
   if (line_list == NULL)
     return; /* nothing on the screen */
 
-  cr = gtk_snapshot_append_cairo (snapshot,
-                                  &GRAPHENE_RECT_INIT(clip->x, clip->y, clip->width, clip->height));
+  /* Lines are rendered completely, so that scrolling horizontally
+   * can reuse them as well
+   */
+  width = MAX (layout->width, layout->screen_width);
+
   text_renderer = get_text_renderer ();
-  text_renderer_begin (text_renderer, widget, cr);
 
-  /* text_renderer_begin/end does cairo_save/restore */
-  cairo_translate (cr, 0, offset_y);
+  gtk_snapshot_save (snapshot);
+  gtk_snapshot_translate (snapshot, &GRAPHENE_POINT_INIT (0, offset_y));
 
   gtk_text_layout_wrap_loop_start (layout);
 
@@ -895,40 +975,26 @@ gtk_text_layout_snapshot (GtkTextLayout      *layout,
                 }
             }
 
-          render_para (text_renderer, line_display,
-                       selection_start_index, selection_end_index);
+          gtk_snapshot_append_node (snapshot,
+                                    get_line_node (text_renderer, widget, line_display, width,
+                                                   selection_start_index, selection_end_index));
 
           /* We paint the cursors last, because they overlap another chunk
            * and need to appear on top.
            */
-          if (line_display->cursors != NULL)
-            {
-              int i;
-
-              for (i = 0; i < line_display->cursors->len; i++)
-                {
-                  int index;
-                  PangoDirection dir;
-
-                  index = g_array_index(line_display->cursors, int, i);
-                  dir = (line_display->direction == GTK_TEXT_DIR_RTL) ? PANGO_DIRECTION_RTL : PANGO_DIRECTION_LTR;
-                  gtk_render_insertion_cursor (context, cr,
-                                               line_display->x_offset, line_display->top_margin,
-                                               line_display->layout, index, dir);
-                }
-            }
+          if (line_display->cursors != NULL && line_display->cursors->len > 0)
+            snapshot_cursors (widget, snapshot, line_display, width);
         } /* line_display->height > 0 */
 
-      cairo_translate (cr, 0, line_display->height);
+      gtk_snapshot_translate (snapshot, &GRAPHENE_POINT_INIT (0, line_display->height));
       gtk_text_layout_free_line_display (layout, line_display);
       
       tmp_list = tmp_list->next;
     }
 
   gtk_text_layout_wrap_loop_end (layout);
-  text_renderer_end (text_renderer);
 
-  g_slist_free (line_list);
+  gtk_snapshot_restore (snapshot);
 
-  cairo_destroy (cr);
+  g_slist_free (line_list);
 }
@@ -2377,13 +2377,15 @@ gtk_text_iter_backward_chars (GtkTextIter *iter, gint count)
 
           /* if in the last fourth of the segment walk backwards */
           if (count < real->segment_char_offset / 4)
-            p = g_utf8_offset_to_pointer (real->segment->body.chars + real->segment_byte_offset, 
-                                          -count);
+            {
+              p = g_utf8_offset_to_pointer (real->segment->body.chars + real->segment_byte_offset,
+                                            -count);
+              new_byte_offset = p - real->segment->body.chars;
+            }
           else
-            p = g_utf8_offset_to_pointer (real->segment->body.chars,
-                                          real->segment_char_offset - count);
+            new_byte_offset = _gtk_char_segment_char_to_byte (real->segment,
+                                                              real->segment_char_offset - count);
 
-          new_byte_offset = p - real->segment->body.chars;
           real->line_byte_offset -= (real->segment_byte_offset - new_byte_offset);
           real->segment_byte_offset = new_byte_offset;
         }
@@ -4839,6 +4841,111 @@ strbreakup (const char *string,
   return str_array;
 }
 
+/* Most lines don't contain what we search for, and extracting their
+ * text just to find that out is what makes searching slow. A LineFilter
+ * looks at the char segments of a line directly and tells whether the
+ * first line of the search string can't possibly be in it, so that the
+ * line can be skipped.
+ *
+ * This only works if the text of the line is the text of its char
+ * segments, so not when skipping invisible text or when searching for
+ * U+FFFC in a slice. For case insensitive searches, only ASCII search
+ * strings and lines are handled, as those casefold to plain lowercase.
+ */
+typedef struct
+{
+  const gchar *needle;
+  gboolean case_insensitive;
+  GString *text;
+} LineFilter;
+
+static gboolean
+line_filter_init (LineFilter  *filter,
+                  const gchar *needle,
+                  gboolean     visible_only,
+                  gboolean     slice,
+                  gboolean     case_insensitive)
+{
+  const gchar *p;
+
+  if (visible_only || needle == NULL || *needle == '\0')
+    return FALSE;
+
+  if (slice && strstr (needle, _gtk_text_unknown_char_utf8) != NULL)
+    return FALSE;
+
+  if (case_insensitive)
+    {
+      for (p = needle; *p; p++)
+        {
+          if ((guchar) *p >= 0x80)
+            return FALSE;
+        }
+    }
+
+  filter->needle = needle;
+  filter->case_insensitive = case_insensitive;
+  filter->text = g_string_new (NULL);
+
+  return TRUE;
+}
+
+static void
+line_filter_clear (LineFilter *filter)
+{
+  g_string_free (filter->text, TRUE);
+}
+
+static gboolean
+line_filter_may_match (LineFilter        *filter,
+                       const GtkTextIter *iter)
+{
+  GtkTextLine *line;
+  GtkTextLineSegment *seg;
+  GtkTextLineSegment *only_seg = NULL;
+  guint n_char_segs = 0;
+  gsize i;
+
+  line = _gtk_text_iter_get_text_line (iter);
+
+  for (seg = line->segments; seg != NULL; seg = seg->next)
+    {
+      if (seg->type != &gtk_text_char_type)
+        continue;
+
+      /* Non-ASCII text needs the real casefolding */
+      if (filter->case_insensitive && seg->byte_count != seg->char_count)
+        return TRUE;
+
+      only_seg = seg;
+      n_char_segs++;
+    }
+
+  if (n_char_segs == 0)
+    return FALSE;
+
+  /* Char segments are nul-terminated, so the common case of a
+   * line made of a single one can be searched in place.
+   */
+  if (n_char_segs == 1 && !filter->case_insensitive)
+    return strstr (only_seg->body.chars, filter->needle) != NULL;
+
+  g_string_truncate (filter->text, 0);
+  for (seg = line->segments; seg != NULL; seg = seg->next)
+    {
+      if (seg->type == &gtk_text_char_type)
+        g_string_append_len (filter->text, seg->body.chars, seg->byte_count);
+    }
+
+  if (filter->case_insensitive)
+    {
+      for (i = 0; i < filter->text->len; i++)
+        filter->text->str[i] = g_ascii_tolower (filter->text->str[i]);
+    }
+
+  return strstr (filter->text->str, filter->needle) != NULL;
+}
+
 /**
  * gtk_text_iter_forward_search:
  * @iter: start of search
@@ -4875,6 +4982,8 @@ gtk_text_iter_forward_search (const GtkTextIter *iter,
   gboolean visible_only;
   gboolean slice;
   gboolean case_insensitive;
+  LineFilter filter;
+  gboolean use_filter;
 
   g_return_val_if_fail (iter != NULL, FALSE);
   g_return_val_if_fail (str != NULL, FALSE);
@@ -4912,6 +5021,8 @@ gtk_text_iter_forward_search (const GtkTextIter *iter,
 
   lines = strbreakup (str, "\n", -1, NULL, case_insensitive);
 
+  use_filter = line_filter_init (&filter, lines[0], visible_only, slice, case_insensitive);
+
   search = *iter;
 
   do
@@ -4925,7 +5036,10 @@ gtk_text_iter_forward_search (const GtkTextIter *iter,
       if (limit &&
           gtk_text_iter_compare (&search, limit) >= 0)
         break;
-      
+
+      if (use_filter && !line_filter_may_match (&filter, &search))
+        continue;
+
       if (lines_match (&search, (const gchar**)lines,
                        visible_only, slice, case_insensitive, &match, &end))
         {
@@ -4947,6 +5061,9 @@ gtk_text_iter_forward_search (const GtkTextIter *iter,
     }
   while (gtk_text_iter_forward_line (&search));
 
+  if (use_filter)
+    line_filter_clear (&filter);
+
   g_strfreev ((gchar**)lines);
 
   return retval;
@@ -78,6 +78,7 @@
 #include "config.h"
 #include "gtkmarshalers.h"
 #include "gtktextlayoutprivate.h"
+#include "gtkparallelmeasureprivate.h"
 #include "gtktextbtree.h"
 #include "gtktextbufferprivate.h"
 #include "gtktextiterprivate.h"
@@ -126,6 +127,18 @@ static void gtk_text_layout_emit_changed           (GtkTextLayout     *layout,
 						    gint               new_height);
 
 static void gtk_text_layout_invalidate_all (GtkTextLayout *layout);
+static void gtk_text_layout_clear_line_display_cache (GtkTextLayout *layout);
+
+static GtkTextLineDisplay *gtk_text_line_display_new           (GtkTextLine        *line,
+                                                                 gboolean            size_only);
+static gboolean            gtk_text_layout_build_line_display  (GtkTextLayout      *layout,
+                                                                 GtkTextLineDisplay *display,
+                                                                 PangoContext       *ltr_context,
+                                                                 PangoContext       *rtl_context,
+                                                                 gboolean           *saw_widget_out);
+static void                gtk_text_layout_finish_line_display (GtkTextLayout      *layout,
+                                                                 GtkTextLineDisplay *display,
+                                                                 gboolean            saw_widget);
 
 static PangoAttribute *gtk_text_attr_appearance_new (const GtkTextAppearance *appearance);
 
@@ -169,6 +182,17 @@ enum {
 
 #define PIXEL_BOUND(d) (((d) + PANGO_SCALE - 1) / PANGO_SCALE)
 
+/* The number of line displays we keep around; a couple of
+ * screens full of lines in a typical view */
+#define LINE_DISPLAY_CACHE_SIZE 128
+
+/* The most lines we lay out on worker threads ahead of validation,
+ * this must stay below LINE_DISPLAY_CACHE_SIZE */
+#define MAX_PRESHAPE_LINES 64
+
+/* Below this, handing lines to other threads costs more than it saves */
+#define MIN_PRESHAPE_LINES 8
+
 static guint signals[LAST_SIGNAL] = { 0 };
 
 PangoAttrType gtk_text_attr_appearance_type = 0;
@@ -193,12 +217,7 @@ gtk_text_layout_dispose (GObject *object)
   g_clear_object (&layout->ltr_context);
   g_clear_object (&layout->rtl_context);
 
-  if (layout->one_display_cache)
-    {
-      GtkTextLineDisplay *tmp_display = layout->one_display_cache;
-      layout->one_display_cache = NULL;
-      gtk_text_layout_free_line_display (layout, tmp_display);
-    }
+  gtk_text_layout_clear_line_display_cache (layout);
 
   if (layout->preedit_attrs != NULL)
     {
@@ -217,6 +236,7 @@ gtk_text_layout_finalize (GObject *object)
   layout = GTK_TEXT_LAYOUT (object);
 
   g_free (layout->preedit_string);
+  g_hash_table_unref (layout->line_display_cache);
 
   G_OBJECT_CLASS (gtk_text_layout_parent_class)->finalize (object);
 }
@@ -277,6 +297,7 @@ static void
 gtk_text_layout_init (GtkTextLayout *text_layout)
 {
   text_layout->cursor_visible = TRUE;
+  text_layout->line_display_cache = g_hash_table_new (NULL, NULL);
 }
 
 GtkTextLayout*
@@ -285,6 +306,24 @@ gtk_text_layout_new (void)
   return g_object_new (GTK_TYPE_TEXT_LAYOUT, NULL);
 }
 
+static void
+gtk_text_layout_uncache_line_display (GtkTextLayout      *layout,
+                                      GtkTextLineDisplay *display)
+{
+  g_hash_table_remove (layout->line_display_cache, display->line);
+  g_queue_unlink (&layout->line_display_lru, &display->cache_link);
+  display->cache_link.data = NULL;
+
+  gtk_text_layout_free_line_display (layout, display);
+}
+
+static void
+gtk_text_layout_clear_line_display_cache (GtkTextLayout *layout)
+{
+  while (layout->line_display_lru.head != NULL)
+    gtk_text_layout_uncache_line_display (layout, layout->line_display_lru.head->data);
+}
+
 static void
 free_style_cache (GtkTextLayout *text_layout)
 {
@@ -310,6 +349,7 @@ gtk_text_layout_set_buffer (GtkTextLayout *layout,
     return;
 
   free_style_cache (layout);
+  gtk_text_layout_clear_line_display_cache (layout);
 
   if (layout->buffer)
     {
@@ -635,18 +675,21 @@ text_layout_changed (GtkTextLayout *layout,
                      gint           new_height,
                      gboolean       cursors_only)
 {
-  /* Check if the range intersects our cached line display,
-   * and invalidate the cached line if so.
+  GList *l, *next;
+
+  /* Check if the range intersects our cached line displays,
+   * and invalidate the cached lines if so.
    */
-  if (layout->one_display_cache)
+  for (l = layout->line_display_lru.head; l != NULL; l = next)
     {
-      GtkTextLine *line = layout->one_display_cache->line;
+      GtkTextLineDisplay *display = l->data;
       gint cache_y = _gtk_text_btree_find_line_top (_gtk_text_buffer_get_btree (layout->buffer),
-						    line, layout);
-      gint cache_height = layout->one_display_cache->height;
+						    display->line, layout);
+
+      next = l->next;
 
-      if (cache_y + cache_height > y && cache_y < y + old_height)
-	gtk_text_layout_invalidate_cache (layout, line, cursors_only);
+      if (cache_y + display->height > y && cache_y < y + old_height)
+	gtk_text_layout_invalidate_cache (layout, display->line, cursors_only);
     }
 
   gtk_text_layout_emit_changed (layout, y, old_height, new_height);
@@ -818,23 +861,24 @@ gtk_text_layout_invalidate_cache (GtkTextLayout *layout,
                                   GtkTextLine   *line,
 				  gboolean       cursors_only)
 {
-  if (layout->one_display_cache && line == layout->one_display_cache->line)
-    {
-      GtkTextLineDisplay *display = layout->one_display_cache;
+  GtkTextLineDisplay *display;
 
+  display = g_hash_table_lookup (layout->line_display_cache, line);
+  if (display)
+    {
       if (cursors_only)
 	{
           if (display->cursors)
             g_array_free (display->cursors, TRUE);
 	  display->cursors = NULL;
 	  display->cursors_invalid = TRUE;
+          /* The block cursor is part of the rendered text */
+          if (display->has_block_cursor)
+            g_clear_pointer (&display->node, gsk_render_node_unref);
 	  display->has_block_cursor = FALSE;
 	}
       else
-	{
-	  layout->one_display_cache = NULL;
-	  gtk_text_layout_free_line_display (layout, display);
-	}
+	gtk_text_layout_uncache_line_display (layout, display);
     }
 }
 
@@ -926,19 +970,13 @@ gtk_text_layout_real_invalidate_cursors (GtkTextLayout     *layout,
 					 const GtkTextIter *start,
 					 const GtkTextIter *end)
 {
-  /* Check if the range intersects our cached line display,
-   * and invalidate the cached line if so.
+  /* Check if the range intersects our cached line displays,
+   * and invalidate the cached lines if so.
    */
-  if (layout->one_display_cache)
+  if (layout->line_display_lru.length > 0)
     {
-      GtkTextIter line_start, line_end;
-      GtkTextLine *line = layout->one_display_cache->line;
-
-      gtk_text_layout_get_iter_at_line (layout, &line_start, line, 0);
-
-      line_end = line_start;
-      if (!gtk_text_iter_ends_line (&line_end))
-	gtk_text_iter_forward_to_line_end (&line_end);
+      GtkTextLine *line;
+      GtkTextLine *last_line;
 
       if (gtk_text_iter_compare (start, end) > 0)
 	{
@@ -947,11 +985,18 @@ gtk_text_layout_real_invalidate_cursors (GtkTextLayout     *layout,
 	  end = tmp;
 	}
 
-      if (gtk_text_iter_compare (&line_start, end) <= 0 &&
-	  gtk_text_iter_compare (start, &line_end) <= 0)
-	{
-	  gtk_text_layout_invalidate_cache (layout, line, TRUE);
-	}
+      last_line = _gtk_text_iter_get_text_line (end);
+      line = _gtk_text_iter_get_text_line (start);
+
+      while (TRUE)
+        {
+          gtk_text_layout_invalidate_cache (layout, line, TRUE);
+
+          if (line == last_line)
+            break;
+
+          line = _gtk_text_line_next_excluding_last (line);
+        }
     }
 
   gtk_text_layout_invalidated (layout);
@@ -1130,6 +1175,191 @@ gtk_text_layout_validate_yrange (GtkTextLayout *layout,
     }
 }
 
+static PangoContext *
+copy_pango_context (PangoContext *context,
+                    PangoFontMap *font_map)
+{
+  PangoContext *copy;
+
+  copy = pango_font_map_create_context (font_map);
+  pango_context_set_font_description (copy, pango_context_get_font_description (context));
+  pango_context_set_language (copy, pango_context_get_language (context));
+  pango_context_set_base_dir (copy, pango_context_get_base_dir (context));
+  pango_context_set_base_gravity (copy, pango_context_get_base_gravity (context));
+  pango_context_set_gravity_hint (copy, pango_context_get_gravity_hint (context));
+  pango_context_set_matrix (copy, pango_context_get_matrix (context));
+  pango_cairo_context_set_font_options (copy, pango_cairo_context_get_font_options (context));
+  pango_cairo_context_set_resolution (copy, pango_cairo_context_get_resolution (context));
+
+  return copy;
+}
+
+/* Lays out the invalid lines that the next validation is going to
+ * wrap on worker threads, puts them into the line display cache and
+ * validates them in the btree, so the shaped layouts are used right
+ * away instead of getting pushed out of the cache again.
+ *
+ * Building the displays needs the btree and has to happen here, but
+ * the PangoLayouts are only itemized and shaped by the workers. The
+ * layouts of every thread get their own copy of our contexts on a
+ * font map of their own, as neither a PangoContext nor a PangoFontMap
+ * can be used by several threads at once.
+ *
+ * Returns the height of the lines that got validated.
+ */
+static gint
+gtk_text_layout_preshape_invalid_lines (GtkTextLayout *layout)
+{
+  GtkTextBTree *btree = _gtk_text_buffer_get_btree (layout->buffer);
+  GtkTextLineDisplay *displays[MAX_PRESHAPE_LINES];
+  gboolean saw_widget[MAX_PRESHAPE_LINES];
+  PangoContext *ltr_contexts[MAX_PRESHAPE_LINES];
+  PangoContext *rtl_contexts[MAX_PRESHAPE_LINES];
+  PangoFontMap *font_map;
+  GtkTextLineData *line_data;
+  GtkTextLine *line, *first_line, *next_line;
+  GPtrArray *groups;
+  guint i, n_lines, n_groups, stamp;
+  gint old_height, new_height;
+  gboolean contiguous;
+
+  n_groups = gtk_parallel_measure_get_n_threads ();
+  if (n_groups < 2)
+    return 0;
+
+  /* Only fonts from the default font map can be had on workers */
+  font_map = pango_context_get_font_map (layout->ltr_context);
+  if (font_map != pango_context_get_font_map (layout->rtl_context) ||
+      gtk_parallel_measure_get_font_map (font_map, 1) == NULL)
+    return 0;
+
+  n_lines = 0;
+  for (line = _gtk_text_btree_get_first_invalid_line (btree, layout);
+       line != NULL && n_lines < MAX_PRESHAPE_LINES;
+       line = _gtk_text_line_next_excluding_last (line))
+    {
+      line_data = _gtk_text_line_get_data (line, layout);
+      if (line_data && line_data->valid)
+        break;
+
+      if (!g_hash_table_contains (layout->line_display_cache, line))
+        displays[n_lines++] = gtk_text_line_display_new (line, TRUE);
+    }
+
+  if (n_lines < MIN_PRESHAPE_LINES)
+    {
+      for (i = 0; i < n_lines; i++)
+        gtk_text_layout_free_line_display (layout, displays[i]);
+      return 0;
+    }
+
+  n_groups = MIN (n_groups, n_lines / (MIN_PRESHAPE_LINES / 2));
+
+  groups = g_ptr_array_new_with_free_func ((GDestroyNotify) g_ptr_array_unref);
+  for (i = 0; i < n_groups; i++)
+    {
+      g_ptr_array_add (groups, g_ptr_array_new_with_free_func (g_object_unref));
+
+      /* The calling thread does its share with our own contexts */
+      if (i == 0)
+        {
+          ltr_contexts[i] = g_object_ref (layout->ltr_context);
+          rtl_contexts[i] = g_object_ref (layout->rtl_context);
+        }
+      else
+        {
+          PangoFontMap *group_font_map = gtk_parallel_measure_get_font_map (font_map, i);
+
+          ltr_contexts[i] = copy_pango_context (layout->ltr_context, group_font_map);
+          rtl_contexts[i] = copy_pango_context (layout->rtl_context, group_font_map);
+        }
+    }
+
+  gtk_text_layout_wrap_loop_start (layout);
+
+  for (i = 0; i < n_lines; i++)
+    {
+      guint group = i % n_groups;
+
+      if (gtk_text_layout_build_line_display (layout, displays[i],
+                                              ltr_contexts[group],
+                                              rtl_contexts[group],
+                                              &saw_widget[i]))
+        g_ptr_array_add (g_ptr_array_index (groups, group), g_object_ref (displays[i]->layout));
+      else
+        {
+          gtk_text_layout_free_line_display (layout, displays[i]);
+          displays[i] = NULL;
+        }
+    }
+
+  gtk_text_layout_wrap_loop_end (layout);
+
+  gtk_parallel_measure_shape_layouts (groups);
+
+  g_ptr_array_unref (groups);
+  for (i = 0; i < n_groups; i++)
+    {
+      g_object_unref (ltr_contexts[i]);
+      g_object_unref (rtl_contexts[i]);
+    }
+
+  /* Allocating child widgets runs signal handlers, which may change
+   * the buffer and invalidate the lines we built displays for. Lines
+   * are only validated while nothing changed and up to the first line
+   * that has no display, so that the validated range stays contiguous.
+   */
+  stamp = _gtk_text_btree_get_segments_changed_stamp (btree);
+  first_line = next_line = NULL;
+  old_height = new_height = 0;
+  contiguous = TRUE;
+  for (i = 0; i < n_lines; i++)
+    {
+      if (displays[i] == NULL)
+        {
+          contiguous = FALSE;
+          continue;
+        }
+
+      if (stamp != _gtk_text_btree_get_segments_changed_stamp (btree))
+        {
+          gtk_text_layout_free_line_display (layout, displays[i]);
+          continue;
+        }
+
+      line = displays[i]->line;
+      gtk_text_layout_finish_line_display (layout, displays[i], saw_widget[i]);
+
+      /* Lines that already had a display were skipped */
+      if (first_line != NULL && line != next_line)
+        contiguous = FALSE;
+
+      if (!contiguous ||
+          stamp != _gtk_text_btree_get_segments_changed_stamp (btree))
+        continue;
+
+      line_data = _gtk_text_line_get_data (line, layout);
+      old_height += line_data ? line_data->height : 0;
+      _gtk_text_btree_validate_line (btree, line, layout);
+      line_data = _gtk_text_line_get_data (line, layout);
+      new_height += line_data ? line_data->height : 0;
+
+      if (first_line == NULL)
+        first_line = line;
+      next_line = _gtk_text_line_next_excluding_last (line);
+    }
+
+  if (first_line == NULL)
+    return 0;
+
+  update_layout_size (layout);
+  gtk_text_layout_emit_changed (layout,
+                                _gtk_text_btree_find_line_top (btree, first_line, layout),
+                                old_height, new_height);
+
+  return new_height;
+}
+
 /**
  * gtk_text_layout_validate:
  * @tree: a #GtkTextLayout
@@ -1147,6 +1377,9 @@ gtk_text_layout_validate (GtkTextLayout *layout,
 
   g_return_if_fail (GTK_IS_TEXT_LAYOUT (layout));
 
+  if (max_pixels > 0 && !gtk_text_layout_is_valid (layout))
+    max_pixels -= gtk_text_layout_preshape_invalid_lines (layout);
+
   while (max_pixels > 0 &&
          _gtk_text_btree_validate (_gtk_text_buffer_get_btree (layout->buffer),
                                    layout,  max_pixels,
@@ -1323,6 +1556,8 @@ totally_invisible_line (GtkTextLayout *layout,
 
 static void
 set_para_values (GtkTextLayout      *layout,
+                 PangoContext       *ltr_context,
+                 PangoContext       *rtl_context,
                  PangoDirection      base_dir,
                  GtkTextAttributes  *style,
                  GtkTextLineDisplay *display)
@@ -1359,9 +1594,9 @@ set_para_values (GtkTextLayout      *layout,
     }
   
   if (display->direction == GTK_TEXT_DIR_RTL)
-    display->layout = pango_layout_new (layout->rtl_context);
+    display->layout = pango_layout_new (rtl_context);
   else
-    display->layout = pango_layout_new (layout->ltr_context);
+    display->layout = pango_layout_new (ltr_context);
 
   switch (style->justification)
     {
@@ -2240,21 +2475,28 @@ tags_array_toggle_tag (GPtrArray  *array,
   return array;
 }
 
-GtkTextLineDisplay *
-gtk_text_layout_get_line_display (GtkTextLayout *layout,
-                                  GtkTextLine   *line,
-                                  gboolean       size_only)
+/* Fills in @display, up to the point where the PangoLayout has to be
+ * laid out. This is the part that must happen on the main thread.
+ *
+ * Returns %FALSE if the line is totally invisible, so that there is
+ * nothing to lay out.
+ */
+static gboolean
+gtk_text_layout_build_line_display (GtkTextLayout      *layout,
+                                    GtkTextLineDisplay *display,
+                                    PangoContext       *ltr_context,
+                                    PangoContext       *rtl_context,
+                                    gboolean           *saw_widget_out)
 {
   GtkTextLayoutPrivate *priv = GTK_TEXT_LAYOUT_GET_PRIVATE (layout);
-  GtkTextLineDisplay *display;
+  GtkTextLine *line = display->line;
+  gboolean size_only = display->size_only;
   GtkTextLineSegment *seg;
   GtkTextIter iter;
   GtkTextAttributes *style;
   gchar *text;
-  gint text_pixel_width;
   PangoAttrList *attrs;
   gint text_allocated, layout_byte_offset, buffer_byte_offset;
-  PangoRectangle extents;
   gboolean para_values_set = FALSE;
   GSList *cursor_byte_offsets = NULL;
   GSList *cursor_segs = NULL;
@@ -2263,35 +2505,6 @@ gtk_text_layout_get_line_display (GtkTextLayout *layout,
   PangoDirection base_dir;
   GPtrArray *tags;
   gboolean initial_toggle_segments;
-  gint h_margin;
-  gint h_padding;
-  
-  g_return_val_if_fail (line != NULL, NULL);
-
-  if (layout->one_display_cache)
-    {
-      if (line == layout->one_display_cache->line &&
-          (size_only || !layout->one_display_cache->size_only))
-	{
-	  if (!size_only)
-            update_text_display_cursors (layout, line, layout->one_display_cache);
-	  return layout->one_display_cache;
-	}
-      else
-        {
-          GtkTextLineDisplay *tmp_display = layout->one_display_cache;
-          layout->one_display_cache = NULL;
-          gtk_text_layout_free_line_display (layout, tmp_display);
-        }
-    }
-
-  DV (g_print ("creating one line display cache (%s)\n", G_STRLOC));
-
-  display = g_slice_new0 (GtkTextLineDisplay);
-
-  display->size_only = size_only;
-  display->line = line;
-  display->insert_index = -1;
 
   /* Special-case optimization for completely
    * invisible lines; makes it faster to deal
@@ -2299,8 +2512,8 @@ gtk_text_layout_get_line_display (GtkTextLayout *layout,
    */
   if (totally_invisible_line (layout, line, &iter))
     {
-      display->layout = pango_layout_new (layout->ltr_context);
-      return display;
+      display->layout = pango_layout_new (ltr_context);
+      return FALSE;
     }
 
   /* Find the bidi base direction */
@@ -2345,7 +2558,7 @@ gtk_text_layout_get_line_display (GtkTextLayout *layout,
            */
           if (!para_values_set)
             {
-              set_para_values (layout, base_dir, style, display);
+              set_para_values (layout, ltr_context, rtl_context, base_dir, style, display);
               para_values_set = TRUE;
             }
 
@@ -2521,7 +2734,7 @@ gtk_text_layout_get_line_display (GtkTextLayout *layout,
   if (!para_values_set)
     {
       style = get_style (layout, tags);
-      set_para_values (layout, base_dir, style, display);
+      set_para_values (layout, ltr_context, rtl_context, base_dir, style, display);
       release_style (layout, style);
     }
   
@@ -2566,6 +2779,33 @@ gtk_text_layout_get_line_display (GtkTextLayout *layout,
   g_slist_free (cursor_byte_offsets);
   g_slist_free (cursor_segs);
 
+  /* Free this if we aren't in a loop */
+  if (layout->wrap_loop_count == 0)
+    invalidate_cached_style (layout);
+
+  g_free (text);
+  pango_attr_list_unref (attrs);
+  if (tags != NULL)
+    g_ptr_array_free (tags, TRUE);
+
+  *saw_widget_out = saw_widget;
+
+  return TRUE;
+}
+
+/* Computes the size of a display built with
+ * gtk_text_layout_build_line_display() and adds it to the cache.
+ */
+static void
+gtk_text_layout_finish_line_display (GtkTextLayout      *layout,
+                                     GtkTextLineDisplay *display,
+                                     gboolean            saw_widget)
+{
+  PangoRectangle extents;
+  gint text_pixel_width;
+  gint h_margin;
+  gint h_padding;
+
   pango_layout_get_extents (display->layout, NULL, &extents);
 
   text_pixel_width = PIXEL_BOUND (extents.width);
@@ -2597,21 +2837,70 @@ gtk_text_layout_get_line_display (GtkTextLayout *layout,
 	  break;
 	}
     }
-  
-  /* Free this if we aren't in a loop */
-  if (layout->wrap_loop_count == 0)
-    invalidate_cached_style (layout);
 
-  g_free (text);
-  pango_attr_list_unref (attrs);
-  if (tags != NULL)
-    g_ptr_array_free (tags, TRUE);
+  display->cache_link.data = display;
+  g_queue_push_head_link (&layout->line_display_lru, &display->cache_link);
+  g_hash_table_insert (layout->line_display_cache, display->line, display);
 
-  layout->one_display_cache = display;
+  while (layout->line_display_lru.length > LINE_DISPLAY_CACHE_SIZE)
+    gtk_text_layout_uncache_line_display (layout, layout->line_display_lru.tail->data);
 
   if (saw_widget)
     allocate_child_widgets (layout, display);
-  
+}
+
+static GtkTextLineDisplay *
+gtk_text_line_display_new (GtkTextLine *line,
+                           gboolean     size_only)
+{
+  GtkTextLineDisplay *display;
+
+  display = g_slice_new0 (GtkTextLineDisplay);
+
+  display->size_only = size_only;
+  display->line = line;
+  display->insert_index = -1;
+
+  return display;
+}
+
+GtkTextLineDisplay *
+gtk_text_layout_get_line_display (GtkTextLayout *layout,
+                                  GtkTextLine   *line,
+                                  gboolean       size_only)
+{
+  GtkTextLineDisplay *display;
+  gboolean saw_widget;
+
+  g_return_val_if_fail (line != NULL, NULL);
+
+  display = g_hash_table_lookup (layout->line_display_cache, line);
+  if (display)
+    {
+      if (size_only || !display->size_only)
+	{
+	  if (!size_only)
+            update_text_display_cursors (layout, line, display);
+
+          g_queue_unlink (&layout->line_display_lru, &display->cache_link);
+          g_queue_push_head_link (&layout->line_display_lru, &display->cache_link);
+
+	  return display;
+	}
+      else
+        gtk_text_layout_uncache_line_display (layout, display);
+    }
+
+  DV (g_print ("creating line display (%s)\n", G_STRLOC));
+
+  display = gtk_text_line_display_new (line, size_only);
+
+  if (gtk_text_layout_build_line_display (layout, display,
+                                          layout->ltr_context,
+                                          layout->rtl_context,
+                                          &saw_widget))
+    gtk_text_layout_finish_line_display (layout, display, saw_widget);
+
   return display;
 }
 
@@ -2619,7 +2908,8 @@ void
 gtk_text_layout_free_line_display (GtkTextLayout      *layout,
                                    GtkTextLineDisplay *display)
 {
-  if (display != layout->one_display_cache)
+  /* Cached displays are owned by the cache */
+  if (display->cache_link.data == NULL)
     {
       if (display->layout)
         g_object_unref (display->layout);
@@ -2630,6 +2920,9 @@ gtk_text_layout_free_line_display (GtkTextLayout      *layout,
       if (display->pg_bg_rgba)
         gdk_rgba_free (display->pg_bg_rgba);
 
+      if (display->node)
+        gsk_render_node_unref (display->node);
+
       g_slice_free (GtkTextLineDisplay, display);
     }
 }
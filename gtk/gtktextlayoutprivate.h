@@ -138,10 +138,12 @@ struct _GtkTextLayout
    * over long runs with the same style. */
   GtkTextAttributes *one_style_cache;
 
-  /* A cache of one line display. Getting the same line
-   * many times in a row is the most common case.
+  /* A cache of the most recently used line displays, so that
+   * redrawing does not lay out the visible lines again. Maps
+   * GtkTextLine to GtkTextLineDisplay, the queue is in LRU order.
    */
-  GtkTextLineDisplay *one_display_cache;
+  GHashTable *line_display_cache;
+  GQueue line_display_lru;
 
   /* Whether we are allowed to wrap right now */
   gint wrap_loop_count;
@@ -247,6 +249,18 @@ struct _GtkTextLineDisplay
   guint size_only : 1;
 
   GdkRGBA *pg_bg_rgba;
+
+  /* The rendered text without the insertion cursors, and the state it
+   * was rendered in, see gtk_text_layout_snapshot()
+   */
+  GskRenderNode *node;
+  gint node_selection_start;
+  gint node_selection_end;
+  GtkStateFlags node_state;
+  guint node_block_cursor : 1;
+
+  /* data is set while the display is in the line display cache */
+  GList cache_link;
 };
 
 #ifdef GTK_COMPILATION
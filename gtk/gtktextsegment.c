@@ -102,6 +102,10 @@ gtk_text_line_segment_split (const GtkTextIter *iter)
 
   count = gtk_text_iter_get_line_index (iter);
 
+  /* The segment of a packed line is not ours to split */
+  if (_gtk_text_line_unpack (line))
+    _gtk_text_btree_segments_changed (tree);
+
   if (GTK_DEBUG_CHECK (TEXT))
     _gtk_text_iter_check (iter);
   
@@ -157,6 +161,26 @@ gtk_text_line_segment_split (const GtkTextIter *iter)
 #define TSEG_SIZE ((unsigned) (G_STRUCT_OFFSET (GtkTextLineSegment, body) \
         + sizeof (GtkTextToggleBody)))
 
+/*
+ * Long char segments store a pointer to an index of byte offsets
+ * behind their characters, so that converting between char and byte
+ * offsets inside of them does not have to walk all the UTF-8 before.
+ * The index is only built when first needed, and never goes stale
+ * since char segments are never modified, only replaced.
+ */
+
+/* The smallest segment that gets an index */
+#define CHAR_INDEX_MIN_BYTES 4096
+
+/* The number of chars between two entries of the index */
+#define CHAR_INDEX_STEP 256
+
+#define CSEG_INDEX_OFFSET(bytes) ((CSEG_SIZE (bytes) + sizeof (gpointer) - 1) \
+        & ~(sizeof (gpointer) - 1))
+#define CSEG_ALLOC_SIZE(bytes) ((bytes) < CHAR_INDEX_MIN_BYTES ? CSEG_SIZE (bytes) \
+        : CSEG_INDEX_OFFSET (bytes) + sizeof (gint *))
+#define CSEG_INDEX(seg) (*(gint **) ((guchar *) (seg) + CSEG_INDEX_OFFSET ((seg)->byte_count)))
+
 /*
  * Type functions
  */
@@ -191,21 +215,69 @@ _gtk_char_segment_new (const gchar *text, guint len)
 {
   GtkTextLineSegment *seg;
 
+  seg = g_slice_alloc (CSEG_ALLOC_SIZE (len));
+  _gtk_char_segment_init (seg, text, len);
+
+  return seg;
+}
+
+/*
+ * _gtk_char_segment_get_size:
+ * @len: the length of the text in bytes
+ *
+ * Returns: the number of bytes a char segment holding @len bytes
+ *     of text needs
+ */
+gsize
+_gtk_char_segment_get_size (guint len)
+{
+  return CSEG_ALLOC_SIZE (len);
+}
+
+/*
+ * _gtk_char_segment_init:
+ * @seg: memory of at least _gtk_char_segment_get_size() bytes
+ * @text: the text of the segment
+ * @len: the length of @text in bytes
+ *
+ * Initializes a char segment in memory that is owned by the caller.
+ * Such a segment must be cleared with _gtk_char_segment_clear() and
+ * never be freed by the segment functions.
+ */
+void
+_gtk_char_segment_init (GtkTextLineSegment *seg,
+                        const gchar        *text,
+                        guint               len)
+{
   g_assert (gtk_text_byte_begins_utf8_char (text));
 
-  seg = g_slice_alloc (CSEG_SIZE (len));
   seg->type = (GtkTextLineSegmentClass *)&gtk_text_char_type;
   seg->next = NULL;
   seg->byte_count = len;
   memcpy (seg->body.chars, text, len);
   seg->body.chars[len] = '\0';
+  if (len >= CHAR_INDEX_MIN_BYTES)
+    CSEG_INDEX (seg) = NULL;
 
   seg->char_count = g_utf8_strlen (seg->body.chars, seg->byte_count);
 
   if (GTK_DEBUG_CHECK (TEXT))
     char_segment_self_check (seg);
+}
 
-  return seg;
+/*
+ * _gtk_char_segment_clear:
+ * @seg: a char segment
+ *
+ * Frees the data @seg owns, without freeing @seg itself.
+ */
+void
+_gtk_char_segment_clear (GtkTextLineSegment *seg)
+{
+  g_assert (seg->type == &gtk_text_char_type);
+
+  if (seg->byte_count >= CHAR_INDEX_MIN_BYTES)
+    g_clear_pointer (&CSEG_INDEX (seg), g_free);
 }
 
 GtkTextLineSegment*
@@ -221,13 +293,15 @@ _gtk_char_segment_new_from_two_strings (const gchar *text1,
   g_assert (gtk_text_byte_begins_utf8_char (text1));
   g_assert (gtk_text_byte_begins_utf8_char (text2));
 
-  seg = g_slice_alloc (CSEG_SIZE (len1+len2));
+  seg = g_slice_alloc (CSEG_ALLOC_SIZE (len1+len2));
   seg->type = &gtk_text_char_type;
   seg->next = NULL;
   seg->byte_count = len1 + len2;
   memcpy (seg->body.chars, text1, len1);
   memcpy (seg->body.chars + len1, text2, len2);
   seg->body.chars[len1+len2] = '\0';
+  if (len1 + len2 >= CHAR_INDEX_MIN_BYTES)
+    CSEG_INDEX (seg) = NULL;
 
   seg->char_count = chars1 + chars2;
 
@@ -243,9 +317,130 @@ _gtk_char_segment_free (GtkTextLineSegment *seg)
   if (seg == NULL)
     return;
 
+  _gtk_char_segment_clear (seg);
+
+  g_slice_free1 (CSEG_ALLOC_SIZE (seg->byte_count), seg);
+}
+
+static const gint *
+char_segment_get_index (GtkTextLineSegment *seg)
+{
+  const gchar *p;
+  gint *index;
+  gint i, n;
+
+  if (seg->byte_count < CHAR_INDEX_MIN_BYTES)
+    return NULL;
+
+  index = CSEG_INDEX (seg);
+  if (index != NULL)
+    return index;
+
+  /* index[i] is the byte offset of char i * CHAR_INDEX_STEP */
+  n = (seg->char_count + CHAR_INDEX_STEP - 1) / CHAR_INDEX_STEP;
+  index = g_new (gint, n);
+
+  p = seg->body.chars;
+  for (i = 0; i < n; i++)
+    {
+      if (i > 0)
+        p = g_utf8_offset_to_pointer (p, CHAR_INDEX_STEP);
+      index[i] = p - seg->body.chars;
+    }
+
+  CSEG_INDEX (seg) = index;
+
+  return index;
+}
+
+/**
+ * _gtk_char_segment_char_to_byte:
+ * @seg: a char segment
+ * @char_offset: a char offset into @seg
+ *
+ * Converts @char_offset into a byte offset into @seg.
+ *
+ * Returns: the byte offset
+ **/
+gint
+_gtk_char_segment_char_to_byte (GtkTextLineSegment *seg,
+                                gint                char_offset)
+{
+  const gint *index;
+  const gchar *p;
+  gint i;
+
   g_assert (seg->type == &gtk_text_char_type);
+  g_assert (char_offset >= 0 && char_offset <= seg->char_count);
+
+  /* No multibyte chars */
+  if (seg->byte_count == seg->char_count)
+    return char_offset;
+
+  /* The index has no entry for the end when char_count is a
+   * multiple of CHAR_INDEX_STEP
+   */
+  if (char_offset == seg->char_count)
+    return seg->byte_count;
+
+  index = char_segment_get_index (seg);
+  if (index != NULL)
+    {
+      i = char_offset / CHAR_INDEX_STEP;
+      p = g_utf8_offset_to_pointer (seg->body.chars + index[i],
+                                    char_offset - i * CHAR_INDEX_STEP);
+    }
+  /* if in the last fourth of the segment walk backwards */
+  else if (seg->char_count - char_offset < seg->char_count / 4)
+    p = g_utf8_offset_to_pointer (seg->body.chars + seg->byte_count,
+                                  char_offset - seg->char_count);
+  else
+    p = g_utf8_offset_to_pointer (seg->body.chars, char_offset);
+
+  return p - seg->body.chars;
+}
+
+/**
+ * _gtk_char_segment_byte_to_char:
+ * @seg: a char segment
+ * @byte_offset: a byte offset into @seg, at the start of a char
+ *
+ * Converts @byte_offset into a char offset into @seg.
+ *
+ * Returns: the char offset
+ **/
+gint
+_gtk_char_segment_byte_to_char (GtkTextLineSegment *seg,
+                                gint                byte_offset)
+{
+  const gint *index;
+  gint lo, hi, mid;
+
+  g_assert (seg->type == &gtk_text_char_type);
+  g_assert (byte_offset >= 0 && byte_offset <= seg->byte_count);
+
+  /* No multibyte chars */
+  if (seg->byte_count == seg->char_count)
+    return byte_offset;
+
+  index = char_segment_get_index (seg);
+  if (index == NULL)
+    return g_utf8_strlen (seg->body.chars, byte_offset);
+
+  /* Find the last entry at or before byte_offset */
+  lo = 0;
+  hi = (seg->char_count + CHAR_INDEX_STEP - 1) / CHAR_INDEX_STEP - 1;
+  while (lo < hi)
+    {
+      mid = (lo + hi + 1) / 2;
+      if (index[mid] <= byte_offset)
+        lo = mid;
+      else
+        hi = mid - 1;
+    }
 
-  g_slice_free1 (CSEG_SIZE (seg->byte_count), seg);
+  return lo * CHAR_INDEX_STEP + g_utf8_strlen (seg->body.chars + index[lo],
+                                               byte_offset - index[lo]);
 }
 
 /*
@@ -161,6 +161,15 @@ GtkTextLineSegment *_gtk_char_segment_new_from_two_strings (const gchar    *text
                                                             const gchar    *text2,
                                                             guint           len2,
 							    guint           chars2);
+gsize               _gtk_char_segment_get_size             (guint           len);
+void                _gtk_char_segment_init                 (GtkTextLineSegment *seg,
+                                                            const gchar    *text,
+                                                            guint           len);
+void                _gtk_char_segment_clear                (GtkTextLineSegment *seg);
+gint                _gtk_char_segment_char_to_byte         (GtkTextLineSegment *seg,
+                                                            gint            char_offset);
+gint                _gtk_char_segment_byte_to_char         (GtkTextLineSegment *seg,
+                                                            gint            byte_offset);
 GtkTextLineSegment *_gtk_toggle_segment_new                (GtkTextTagInfo *info,
                                                             gboolean        on);
 
@@ -1916,22 +1916,6 @@ gtk_text_tag_get_property (GObject      *object,
  * Tag operations
  */
 
-typedef struct {
-  gint high;
-  gint low;
-  gint delta;
-} DeltaData;
-
-static void
-delta_priority_foreach (GtkTextTag *tag, gpointer user_data)
-{
-  GtkTextTagPrivate *priv = tag->priv;
-  DeltaData *dd = user_data;
-
-  if (priv->priority >= dd->low && priv->priority <= dd->high)
-    priv->priority += dd->delta;
-}
-
 /**
  * gtk_text_tag_get_priority:
  * @tag: a #GtkTextTag
@@ -1964,13 +1948,17 @@ gtk_text_tag_get_priority (GtkTextTag *tag)
  * is the order in which they were added to the table, or created with
  * gtk_text_buffer_create_tag(), which adds the tag to the buffer’s table
  * automatically.
+ *
+ * Only the tags whose priority is between the old and the new priority
+ * of @tag are renumbered, and only the text that @tag is applied to
+ * is redrawn; the order of the other tags relative to each other does
+ * not change.
  **/
 void
 gtk_text_tag_set_priority (GtkTextTag *tag,
                            gint        priority)
 {
   GtkTextTagPrivate *priv;
-  DeltaData dd;
 
   g_return_if_fail (GTK_IS_TEXT_TAG (tag));
 
@@ -1983,24 +1971,13 @@ gtk_text_tag_set_priority (GtkTextTag *tag,
   if (priority == priv->priority)
     return;
 
-  if (priority < priv->priority)
-    {
-      dd.low = priority;
-      dd.high = priv->priority - 1;
-      dd.delta = 1;
-    }
-  else
-    {
-      dd.low = priv->priority + 1;
-      dd.high = priority;
-      dd.delta = -1;
-    }
-
-  gtk_text_tag_table_foreach (priv->table,
-                              delta_priority_foreach,
-                              &dd);
+  _gtk_text_tag_table_move_tag (priv->table, tag, priority);
 
-  priv->priority = priority;
+  /* Where @tag overlaps a tag it moved past, the attributes of the
+   * text may now come from the other one. Tags that don't affect the
+   * size can't change it by moving either.
+   */
+  gtk_text_tag_changed (tag, _gtk_text_tag_affects_size (tag));
 }
 
 /**
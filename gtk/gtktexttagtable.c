@@ -66,6 +66,7 @@ struct _GtkTextTagTablePrivate
   GHashTable *hash;
   GSList     *anonymous;
   GSList     *buffers;
+  GPtrArray  *by_priority; /* the tags, indexed by their priority */
 
   gint anon_count;
 };
@@ -155,6 +156,7 @@ gtk_text_tag_table_init (GtkTextTagTable *table)
 {
   table->priv = gtk_text_tag_table_get_instance_private (table);
   table->priv->hash = g_hash_table_new (g_str_hash, g_str_equal);
+  table->priv->by_priority = g_ptr_array_new ();
 }
 
 /**
@@ -205,6 +207,7 @@ gtk_text_tag_table_finalize (GObject *object)
   g_hash_table_destroy (priv->hash);
   g_slist_free (priv->anonymous);
   g_slist_free (priv->buffers);
+  g_ptr_array_free (priv->by_priority, TRUE);
 
   G_OBJECT_CLASS (gtk_text_tag_table_parent_class)->finalize (object);
 }
@@ -277,6 +280,8 @@ gtk_text_tag_table_add (GtkTextTagTable *table,
   size = gtk_text_tag_table_get_size (table);
   g_assert (size > 0);
   tag->priv->priority = size - 1;
+  g_ptr_array_add (priv->by_priority, tag);
+  g_assert (priv->by_priority->len == size);
 
   g_signal_emit (table, signals[TAG_ADDED], 0, tag);
   return TRUE;
@@ -338,8 +343,11 @@ gtk_text_tag_table_remove (GtkTextTagTable *table,
 
   /* Set ourselves to the highest priority; this means
      when we're removed, there won't be any gaps in the
-     priorities of the tags in the table. */
-  gtk_text_tag_set_priority (tag, gtk_text_tag_table_get_size (table) - 1);
+     priorities of the tags in the table. The tag is no
+     longer applied anywhere, so nothing needs to be
+     redrawn for this. */
+  _gtk_text_tag_table_move_tag (table, tag, priv->by_priority->len - 1);
+  g_ptr_array_remove_index (priv->by_priority, priv->by_priority->len - 1);
 
   tag->priv->table = NULL;
 
@@ -432,6 +440,42 @@ gtk_text_tag_table_get_size (GtkTextTagTable *table)
   return g_hash_table_size (priv->hash) + priv->anon_count;
 }
 
+/* Gives @tag the priority @priority, and moves the tags between its
+ * old and new priority by one to make room. Only those tags change,
+ * the relative order of all others stays the same.
+ */
+void
+_gtk_text_tag_table_move_tag (GtkTextTagTable *table,
+                              GtkTextTag      *tag,
+                              gint             priority)
+{
+  GtkTextTagTablePrivate *priv = table->priv;
+  gint i;
+
+  g_assert (tag->priv->table == table);
+  g_assert (priority >= 0 && priority < (gint) priv->by_priority->len);
+  g_assert (g_ptr_array_index (priv->by_priority, tag->priv->priority) == tag);
+
+  for (i = tag->priv->priority; i < priority; i++)
+    {
+      GtkTextTag *next = g_ptr_array_index (priv->by_priority, i + 1);
+
+      next->priv->priority = i;
+      g_ptr_array_index (priv->by_priority, i) = next;
+    }
+
+  for (i = tag->priv->priority; i > priority; i--)
+    {
+      GtkTextTag *prev = g_ptr_array_index (priv->by_priority, i - 1);
+
+      prev->priv->priority = i;
+      g_ptr_array_index (priv->by_priority, i) = prev;
+    }
+
+  tag->priv->priority = priority;
+  g_ptr_array_index (priv->by_priority, priority) = tag;
+}
+
 void
 _gtk_text_tag_table_add_buffer (GtkTextTagTable *table,
                                 gpointer         buffer)
@@ -101,6 +101,9 @@ void _gtk_text_tag_table_add_buffer    (GtkTextTagTable *table,
                                         gpointer         buffer);
 void _gtk_text_tag_table_remove_buffer (GtkTextTagTable *table,
                                         gpointer         buffer);
+void _gtk_text_tag_table_move_tag      (GtkTextTagTable *table,
+                                        GtkTextTag      *tag,
+                                        gint             priority);
 
 G_END_DECLS
 
@@ -40,7 +40,7 @@
 #include "gtkmenuitem.h"
 #include "gtkrenderbackgroundprivate.h"
 #include "gtkseparatormenuitem.h"
-#include "gtksettings.h"
+#include "gtksettingsprivate.h"
 #include "gtktextdisplayprivate.h"
 #include "gtktextiterprivate.h"
 #include "gtkimmulticontext.h"
@@ -1725,6 +1725,35 @@ gtk_text_view_get_selection_node (GtkTextView *text_view)
   return text_view->priv->selection_node;
 }
 
+/*
+ * gtk_text_view_foreach_layout:
+ * @text_view: a #GtkTextView
+ * @func: function to call for each layout
+ * @data: user data for @func
+ *
+ * Calls @func for the #PangoLayout of each line display that the
+ * text layout of @text_view keeps cached.
+ */
+void
+gtk_text_view_foreach_layout (GtkTextView *text_view,
+                              GFunc        func,
+                              gpointer     data)
+{
+  GtkTextLayout *layout = text_view->priv->layout;
+  GList *l;
+
+  if (layout == NULL)
+    return;
+
+  for (l = layout->line_display_lru.head; l != NULL; l = l->next)
+    {
+      GtkTextLineDisplay *display = l->data;
+
+      if (display->layout)
+        func (display->layout, data);
+    }
+}
+
 static void
 _gtk_text_view_ensure_text_handles (GtkTextView *text_view)
 {
@@ -4876,7 +4905,7 @@ gtk_text_view_handle_drag_finished (GtkTextHandle         *handle,
       guint double_click_time;
 
       settings = gtk_widget_get_settings (GTK_WIDGET (text_view));
-      g_object_get (settings, "gtk-double-click-time", &double_click_time, NULL);
+      double_click_time = gtk_settings_get_values (settings)->double_click_time;
       if (g_get_monotonic_time() - priv->handle_place_time < double_click_time * 1000)
         {
           buffer = get_buffer (text_view);
@@ -5573,7 +5602,7 @@ cursor_blinks (GtkTextView *text_view)
   return FALSE;
 #endif
 
-  g_object_get (settings, "gtk-cursor-blink", &blink, NULL);
+  blink = gtk_settings_get_values (settings)->cursor_blink;
 
   if (!blink)
     return FALSE;
@@ -5599,7 +5628,7 @@ cursor_visible (GtkTextView *text_view)
   GtkSettings *settings = gtk_widget_get_settings (GTK_WIDGET (text_view));
   gboolean use_caret;
 
-  g_object_get (settings, "gtk-keynav-use-caret", &use_caret, NULL);
+  use_caret = gtk_settings_get_values (settings)->keynav_use_caret;
 
    return use_caret || text_view->priv->cursor_visible;
 }
@@ -5622,7 +5651,7 @@ get_cursor_time (GtkTextView *text_view)
   GtkSettings *settings = gtk_widget_get_settings (GTK_WIDGET (text_view));
   gint time;
 
-  g_object_get (settings, "gtk-cursor-blink-time", &time, NULL);
+  time = gtk_settings_get_values (settings)->cursor_blink_time;
 
   return time;
 }
@@ -5633,7 +5662,7 @@ get_cursor_blink_timeout (GtkTextView *text_view)
   GtkSettings *settings = gtk_widget_get_settings (GTK_WIDGET (text_view));
   gint time;
 
-  g_object_get (settings, "gtk-cursor-blink-timeout", &time, NULL);
+  time = gtk_settings_get_values (settings)->cursor_blink_timeout;
 
   return time;
 }
@@ -7330,9 +7359,7 @@ gtk_text_view_check_keymap_direction (GtkTextView *text_view)
       GtkTextDirection new_keyboard_dir;
       gboolean split_cursor;
 
-      g_object_get (settings,
-		    "gtk-split-cursor", &split_cursor,
-		    NULL);
+      split_cursor = gtk_settings_get_values (settings)->split_cursor;
       
       if (gdk_keymap_get_direction (keymap) == PANGO_DIRECTION_RTL)
 	new_keyboard_dir = GTK_TEXT_DIR_RTL;
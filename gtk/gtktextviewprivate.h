@@ -30,6 +30,10 @@ GtkCssNode *    gtk_text_view_get_selection_node        (GtkTextView *text_view)
 
 GtkTextAttributes * gtk_text_view_get_default_attributes (GtkTextView *text_view);
 
+void            gtk_text_view_foreach_layout            (GtkTextView *text_view,
+                                                         GFunc        func,
+                                                         gpointer     data);
+
 
 G_END_DECLS
 
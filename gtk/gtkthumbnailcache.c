@@ -0,0 +1,533 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "gtkthumbnailcacheprivate.h"
+
+/*
+ * Thumbnail cache
+ *
+ * Thumbnails are decoded and scaled by a small pool of threads, so
+ * that scrolling through a folder full of pictures does not block
+ * the main loop. The decoded thumbnails are kept in a process-wide
+ * cache, evicting the least recently used ones once they take more
+ * than THUMBNAIL_CACHE_BUDGET bytes.
+ *
+ * Entries are keyed by the thumbnail path, the modification time of
+ * the thumbnailed file and the size, so that a regenerated thumbnail
+ * is decoded again. Thumbnails that fail to decode are remembered too.
+ *
+ * Requests for thumbnails that are visible run before the ones that
+ * are prefetched, and within a priority the most recent ones run
+ * first, as they are the most likely to still be wanted. Finished
+ * requests are handed back to the main thread in batches.
+ *
+ * Everything but the decoding happens on the main thread.
+ */
+
+#define THUMBNAIL_CACHE_BUDGET (32 * 1024 * 1024)
+
+#define MAX_DECODE_THREADS 2
+
+/* What a thumbnail that failed to decode is accounted for */
+#define FAILED_ENTRY_COST 256
+
+typedef struct {
+  char *key;
+  GdkPixbuf *pixbuf;            /* NULL if decoding failed */
+  gsize cost;
+  GList *link;                  /* in cache->lru */
+} CacheEntry;
+
+typedef struct {
+  gpointer owner;
+  GtkThumbnailReadyFunc func;
+  gpointer data;
+  GDestroyNotify destroy;
+} Waiter;
+
+typedef struct {
+  volatile gint ref_count;
+  char *key;
+  char *path;
+  int size;
+  GtkThumbnailPriority priority;
+  GSList *waiters;
+  volatile gint cancelled;
+  volatile gint started;
+  GdkPixbuf *pixbuf;            /* set by the thread decoding it */
+} Request;
+
+/* A request is pushed again when its priority is raised, only the
+ * first job to run for it decodes it.
+ */
+typedef struct {
+  Request *request;
+  GtkThumbnailPriority priority;
+  guint serial;
+} Job;
+
+struct _GtkThumbnailCache
+{
+  GHashTable *entries;          /* key -> CacheEntry */
+  GQueue lru;                   /* most recently used first */
+  gsize size;
+
+  GHashTable *requests;         /* key -> pending Request */
+  GThreadPool *pool;
+  guint serial;
+
+  GMutex lock;                  /* protects the fields below */
+  GSList *finished;
+  gboolean finished_scheduled;
+};
+
+static char *
+make_key (const char *path,
+          guint64     mtime,
+          int         size)
+{
+  return g_strdup_printf ("%d %" G_GUINT64_FORMAT " %s", size, mtime, path);
+}
+
+static Request *
+request_ref (Request *request)
+{
+  g_atomic_int_inc (&request->ref_count);
+
+  return request;
+}
+
+static void
+waiter_free (Waiter *waiter)
+{
+  if (waiter->destroy)
+    waiter->destroy (waiter->data);
+  g_slice_free (Waiter, waiter);
+}
+
+static void
+request_unref (Request *request)
+{
+  if (!g_atomic_int_dec_and_test (&request->ref_count))
+    return;
+
+  g_slist_free_full (request->waiters, (GDestroyNotify) waiter_free);
+  g_clear_object (&request->pixbuf);
+  g_free (request->key);
+  g_free (request->path);
+  g_slice_free (Request, request);
+}
+
+static void
+remove_entry (GtkThumbnailCache *cache,
+              CacheEntry        *entry)
+{
+  g_queue_delete_link (&cache->lru, entry->link);
+  g_hash_table_remove (cache->entries, entry->key);
+  cache->size -= entry->cost;
+
+  g_clear_object (&entry->pixbuf);
+  g_free (entry->key);
+  g_slice_free (CacheEntry, entry);
+}
+
+static void
+insert_entry (GtkThumbnailCache *cache,
+              const char        *key,
+              GdkPixbuf         *pixbuf)
+{
+  CacheEntry *entry;
+
+  entry = g_hash_table_lookup (cache->entries, key);
+  if (entry)
+    remove_entry (cache, entry);
+
+  entry = g_slice_new0 (CacheEntry);
+  entry->key = g_strdup (key);
+  if (pixbuf)
+    {
+      entry->pixbuf = g_object_ref (pixbuf);
+      entry->cost = sizeof (CacheEntry) + gdk_pixbuf_get_byte_length (pixbuf);
+    }
+  else
+    entry->cost = FAILED_ENTRY_COST;
+
+  g_queue_push_head (&cache->lru, entry);
+  entry->link = cache->lru.head;
+  g_hash_table_insert (cache->entries, entry->key, entry);
+  cache->size += entry->cost;
+
+  while (cache->size > THUMBNAIL_CACHE_BUDGET && cache->lru.length > 1)
+    remove_entry (cache, g_queue_peek_tail (&cache->lru));
+}
+
+static gboolean
+requests_finished (gpointer data)
+{
+  GtkThumbnailCache *cache = data;
+  GSList *finished, *l, *w;
+
+  g_mutex_lock (&cache->lock);
+  finished = g_slist_reverse (cache->finished);
+  cache->finished = NULL;
+  cache->finished_scheduled = FALSE;
+  g_mutex_unlock (&cache->lock);
+
+  for (l = finished; l; l = l->next)
+    {
+      Request *request = l->data;
+      Request *pending;
+      GSList *waiters;
+
+      insert_entry (cache, request->key, request->pixbuf);
+
+      /* The request may have been cancelled and queued again since,
+       * whichever is pending gets the result.
+       */
+      pending = g_hash_table_lookup (cache->requests, request->key);
+      if (pending == NULL)
+        {
+          request_unref (request);
+          continue;
+        }
+
+      g_atomic_int_set (&pending->cancelled, TRUE);
+      waiters = pending->waiters;
+      pending->waiters = NULL;
+      g_hash_table_remove (cache->requests, request->key);
+
+      for (w = waiters; w; w = w->next)
+        {
+          Waiter *waiter = w->data;
+
+          if (waiter->func)
+            waiter->func (waiter->owner, request->pixbuf, waiter->data);
+        }
+
+      g_slist_free_full (waiters, (GDestroyNotify) waiter_free);
+      request_unref (request);
+    }
+
+  g_slist_free (finished);
+
+  return G_SOURCE_REMOVE;
+}
+
+static void
+decode_thumbnail (gpointer data,
+                  gpointer user_data)
+{
+  GtkThumbnailCache *cache = user_data;
+  Job *job = data;
+  Request *request = job->request;
+
+  g_slice_free (Job, job);
+
+  if (g_atomic_int_get (&request->cancelled) ||
+      !g_atomic_int_compare_and_exchange (&request->started, FALSE, TRUE))
+    {
+      request_unref (request);
+      return;
+    }
+
+  request->pixbuf = gdk_pixbuf_new_from_file_at_size (request->path,
+                                                      request->size, request->size,
+                                                      NULL);
+
+  /* The job's reference goes to the finished list */
+  g_mutex_lock (&cache->lock);
+  cache->finished = g_slist_prepend (cache->finished, request);
+  if (!cache->finished_scheduled)
+    {
+      GSource *source;
+
+      source = g_idle_source_new ();
+      g_source_set_callback (source, requests_finished, cache, NULL);
+      g_source_set_name (source, "[gtk] requests_finished");
+      g_source_attach (source, NULL);
+      g_source_unref (source);
+
+      cache->finished_scheduled = TRUE;
+    }
+  g_mutex_unlock (&cache->lock);
+}
+
+static gint
+compare_jobs (gconstpointer a,
+              gconstpointer b,
+              gpointer      user_data)
+{
+  const Job *job_a = a;
+  const Job *job_b = b;
+
+  if (job_a->priority != job_b->priority)
+    return job_a->priority < job_b->priority ? -1 : 1;
+
+  /* Newest first */
+  if (job_a->serial != job_b->serial)
+    return job_a->serial > job_b->serial ? -1 : 1;
+
+  return 0;
+}
+
+static void
+push_job (GtkThumbnailCache    *cache,
+          Request              *request,
+          GtkThumbnailPriority  priority)
+{
+  Job *job;
+
+  job = g_slice_new (Job);
+  job->request = request_ref (request);
+  job->priority = priority;
+  job->serial = cache->serial++;
+
+  g_thread_pool_push (cache->pool, job, NULL);
+}
+
+/*
+ * gtk_thumbnail_cache_get_default:
+ *
+ * Gets the thumbnail cache shared by the whole process. It must
+ * only be used from the main thread.
+ *
+ * Returns: (transfer none): the #GtkThumbnailCache
+ */
+GtkThumbnailCache *
+gtk_thumbnail_cache_get_default (void)
+{
+  static GtkThumbnailCache *cache = NULL;
+
+  if (cache == NULL)
+    {
+      cache = g_new0 (GtkThumbnailCache, 1);
+      cache->entries = g_hash_table_new (g_str_hash, g_str_equal);
+      g_queue_init (&cache->lru);
+      cache->requests = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                               NULL, (GDestroyNotify) request_unref);
+      g_mutex_init (&cache->lock);
+      cache->pool = g_thread_pool_new (decode_thumbnail, cache, MAX_DECODE_THREADS, FALSE, NULL);
+      g_thread_pool_set_sort_function (cache->pool, compare_jobs, NULL);
+    }
+
+  return cache;
+}
+
+/*
+ * gtk_thumbnail_cache_lookup:
+ * @cache: a #GtkThumbnailCache
+ * @path: the path of the thumbnail
+ * @mtime: the modification time of the thumbnailed file
+ * @size: the size of the thumbnail, in device pixels
+ * @pixbuf: (out) (transfer full): return location for the thumbnail
+ *
+ * Looks up a decoded thumbnail. @pixbuf is set to %NULL if the
+ * thumbnail could not be decoded.
+ *
+ * Returns: %TRUE if the thumbnail was decoded already
+ */
+gboolean
+gtk_thumbnail_cache_lookup (GtkThumbnailCache  *cache,
+                            const char         *path,
+                            guint64             mtime,
+                            int                 size,
+                            GdkPixbuf         **pixbuf)
+{
+  CacheEntry *entry;
+  char *key;
+
+  key = make_key (path, mtime, size);
+  entry = g_hash_table_lookup (cache->entries, key);
+  g_free (key);
+
+  if (entry == NULL)
+    {
+      *pixbuf = NULL;
+      return FALSE;
+    }
+
+  g_queue_unlink (&cache->lru, entry->link);
+  g_queue_push_head_link (&cache->lru, entry->link);
+
+  *pixbuf = entry->pixbuf ? g_object_ref (entry->pixbuf) : NULL;
+
+  return TRUE;
+}
+
+/*
+ * gtk_thumbnail_cache_insert:
+ * @cache: a #GtkThumbnailCache
+ * @path: the path of the thumbnail
+ * @mtime: the modification time of the thumbnailed file
+ * @size: the size of the thumbnail, in device pixels
+ * @pixbuf: (nullable): the decoded thumbnail, or %NULL if decoding failed
+ *
+ * Adds a thumbnail that was decoded by the caller.
+ */
+void
+gtk_thumbnail_cache_insert (GtkThumbnailCache *cache,
+                            const char        *path,
+                            guint64            mtime,
+                            int                size,
+                            GdkPixbuf         *pixbuf)
+{
+  char *key;
+
+  key = make_key (path, mtime, size);
+  insert_entry (cache, key, pixbuf);
+  g_free (key);
+}
+
+/*
+ * gtk_thumbnail_cache_load:
+ * @cache: a #GtkThumbnailCache
+ * @path: the path of the thumbnail
+ * @mtime: the modification time of the thumbnailed file
+ * @size: the size of the thumbnail, in device pixels
+ * @priority: how soon the thumbnail is needed
+ * @owner: tag to cancel the request with
+ * @func: (nullable): function to call once the thumbnail is decoded
+ * @data: data to pass to @func
+ * @destroy: (nullable): function to free @data with
+ *
+ * Queues the thumbnail for decoding in a thread. Requests for the
+ * same thumbnail are merged, and take the highest priority of them.
+ * Without @func, the thumbnail is just decoded into the cache.
+ *
+ * Nothing happens if the thumbnail is decoded already.
+ */
+void
+gtk_thumbnail_cache_load (GtkThumbnailCache     *cache,
+                          const char            *path,
+                          guint64                mtime,
+                          int                    size,
+                          GtkThumbnailPriority   priority,
+                          gpointer               owner,
+                          GtkThumbnailReadyFunc  func,
+                          gpointer               data,
+                          GDestroyNotify         destroy)
+{
+  Request *request;
+  Waiter *waiter;
+  GSList *l;
+  char *key;
+
+  key = make_key (path, mtime, size);
+
+  if (g_hash_table_contains (cache->entries, key))
+    {
+      g_free (key);
+      if (destroy)
+        destroy (data);
+      return;
+    }
+
+  request = g_hash_table_lookup (cache->requests, key);
+  if (request == NULL)
+    {
+      request = g_slice_new0 (Request);
+      request->ref_count = 1;
+      request->key = key;
+      request->path = g_strdup (path);
+      request->size = size;
+      request->priority = priority;
+      g_hash_table_insert (cache->requests, request->key, request);
+
+      push_job (cache, request, priority);
+    }
+  else
+    {
+      g_free (key);
+
+      if (priority < request->priority)
+        {
+          request->priority = priority;
+          push_job (cache, request, priority);
+        }
+    }
+
+  if (func == NULL)
+    {
+      for (l = request->waiters; l; l = l->next)
+        {
+          waiter = l->data;
+          if (waiter->owner == owner && waiter->func == NULL)
+            {
+              if (destroy)
+                destroy (data);
+              return;
+            }
+        }
+    }
+
+  waiter = g_slice_new (Waiter);
+  waiter->owner = owner;
+  waiter->func = func;
+  waiter->data = data;
+  waiter->destroy = destroy;
+  request->waiters = g_slist_prepend (request->waiters, waiter);
+}
+
+/*
+ * gtk_thumbnail_cache_cancel:
+ * @cache: a #GtkThumbnailCache
+ * @owner: the tag passed to gtk_thumbnail_cache_load()
+ *
+ * Cancels all requests made by @owner. Thumbnails that nobody else
+ * requested are not decoded anymore, unless that already started.
+ *
+ * Returns: the number of callbacks that will not be called
+ */
+guint
+gtk_thumbnail_cache_cancel (GtkThumbnailCache *cache,
+                            gpointer           owner)
+{
+  GHashTableIter iter;
+  Request *request;
+  guint n_cancelled = 0;
+
+  g_hash_table_iter_init (&iter, cache->requests);
+  while (g_hash_table_iter_next (&iter, NULL, (gpointer *) &request))
+    {
+      GSList *l, *next;
+
+      for (l = request->waiters; l; l = next)
+        {
+          Waiter *waiter = l->data;
+
+          next = l->next;
+          if (waiter->owner != owner)
+            continue;
+
+          if (waiter->func)
+            n_cancelled++;
+
+          request->waiters = g_slist_delete_link (request->waiters, l);
+          waiter_free (waiter);
+        }
+
+      if (request->waiters == NULL)
+        {
+          g_atomic_int_set (&request->cancelled, TRUE);
+          g_hash_table_iter_remove (&iter);
+        }
+    }
+
+  return n_cancelled;
+}
@@ -0,0 +1,63 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GTK_THUMBNAIL_CACHE_PRIVATE_H__
+#define __GTK_THUMBNAIL_CACHE_PRIVATE_H__
+
+#include <gdk-pixbuf/gdk-pixbuf.h>
+
+G_BEGIN_DECLS
+
+typedef struct _GtkThumbnailCache GtkThumbnailCache;
+
+typedef enum {
+  GTK_THUMBNAIL_PRIORITY_VISIBLE,
+  GTK_THUMBNAIL_PRIORITY_PREFETCH
+} GtkThumbnailPriority;
+
+typedef void (* GtkThumbnailReadyFunc) (gpointer   owner,
+                                        GdkPixbuf *pixbuf,
+                                        gpointer   data);
+
+GtkThumbnailCache *     gtk_thumbnail_cache_get_default         (void);
+
+gboolean                gtk_thumbnail_cache_lookup              (GtkThumbnailCache      *cache,
+                                                                 const char             *path,
+                                                                 guint64                 mtime,
+                                                                 int                     size,
+                                                                 GdkPixbuf             **pixbuf);
+void                    gtk_thumbnail_cache_insert              (GtkThumbnailCache      *cache,
+                                                                 const char             *path,
+                                                                 guint64                 mtime,
+                                                                 int                     size,
+                                                                 GdkPixbuf              *pixbuf);
+
+void                    gtk_thumbnail_cache_load                (GtkThumbnailCache      *cache,
+                                                                 const char             *path,
+                                                                 guint64                 mtime,
+                                                                 int                     size,
+                                                                 GtkThumbnailPriority    priority,
+                                                                 gpointer                owner,
+                                                                 GtkThumbnailReadyFunc   func,
+                                                                 gpointer                data,
+                                                                 GDestroyNotify          destroy);
+guint                   gtk_thumbnail_cache_cancel              (GtkThumbnailCache      *cache,
+                                                                 gpointer                owner);
+
+G_END_DECLS
+
+#endif /* __GTK_THUMBNAIL_CACHE_PRIVATE_H__ */
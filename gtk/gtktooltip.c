@@ -112,6 +112,13 @@ struct _GtkTooltip
   guint timeout_id;
   guint browse_mode_timeout_id;
 
+  /* Motion over a visible tooltip is queried once per frame,
+   * at the last position seen */
+  GtkWidget *requery_widget;
+  guint requery_tick_id;
+  gdouble requery_x;
+  gdouble requery_y;
+
   GdkRectangle tip_area;
 
   guint browse_mode_enabled : 1;
@@ -140,7 +147,9 @@ static void       gtk_tooltip_handle_event_internal (GdkEventType   event_type,
                                                      GdkSurface    *surface,
                                                      GtkWidget     *target_widget,
                                                      gdouble       dx,
-                                                     gdouble       dy);
+                                                     gdouble       dy,
+                                                     gboolean      throttle);
+static void       gtk_tooltip_cancel_requery        (GtkTooltip    *tooltip);
 
 static inline GQuark tooltip_quark (void)
 {
@@ -202,6 +211,7 @@ gtk_tooltip_dispose (GObject *object)
       tooltip->browse_mode_timeout_id = 0;
     }
 
+  gtk_tooltip_cancel_requery (tooltip);
   gtk_tooltip_set_custom (tooltip, NULL);
   gtk_tooltip_set_last_surface (tooltip, NULL);
 
@@ -405,7 +415,7 @@ gtk_tooltip_trigger_tooltip_query (GtkWidget *widget)
 
   gtk_widget_translate_coordinates (toplevel, widget, x, y, &dx, &dy);
 
-  gtk_tooltip_handle_event_internal (GDK_MOTION_NOTIFY, surface, widget, dx, dy);
+  gtk_tooltip_handle_event_internal (GDK_MOTION_NOTIFY, surface, widget, dx, dy, FALSE);
 }
 
 static void
@@ -905,7 +915,128 @@ _gtk_tooltip_handle_event (GdkEvent *event)
   gdk_event_get_coords (event, &dx, &dy);
   target = gtk_get_event_target (event);
 
-  gtk_tooltip_handle_event_internal (event_type, surface, target, dx, dy);
+  gtk_tooltip_handle_event_internal (event_type, surface, target, dx, dy, TRUE);
+}
+
+/* Whether the visible tooltip still applies at @x, @y of
+ * @target_widget, without asking the widgets again. That is
+ * the case while the pointer stays in the area the tooltip
+ * was set for with gtk_tooltip_set_tip_area(), and no widget
+ * below the one showing the tooltip can have one of its own.
+ */
+static gboolean
+gtk_tooltip_in_tip_area (GtkTooltip *tooltip,
+                         GtkWidget  *target_widget,
+                         gdouble     x,
+                         gdouble     y)
+{
+  GtkWidget *widget;
+  int tx, ty;
+
+  if (!GTK_TOOLTIP_VISIBLE (tooltip) ||
+      !tooltip->tip_area_set ||
+      !tooltip->tooltip_widget)
+    return FALSE;
+
+  for (widget = target_widget;
+       widget != tooltip->tooltip_widget;
+       widget = gtk_widget_get_parent (widget))
+    {
+      if (widget == NULL || gtk_widget_get_has_tooltip (widget))
+        return FALSE;
+    }
+
+  if (!gtk_widget_translate_coordinates (target_widget, tooltip->tooltip_widget,
+                                         x, y, &tx, &ty))
+    return FALSE;
+
+  return gdk_rectangle_contains_point (&tooltip->tip_area, tx, ty);
+}
+
+static void
+gtk_tooltip_handle_motion (GtkTooltip   *tooltip,
+                           GdkEventType  event_type,
+                           GtkWidget    *target_widget,
+                           gdouble       dx,
+                           gdouble       dy)
+{
+  GdkDisplay *display;
+  gboolean tip_area_set;
+  GdkRectangle tip_area;
+  gboolean hide_tooltip;
+  int x = dx, y = dy;
+
+  display = gtk_widget_get_display (target_widget);
+
+  tip_area_set = tooltip->tip_area_set;
+  tip_area = tooltip->tip_area;
+
+  gtk_tooltip_run_requery (&target_widget, tooltip, &x, &y);
+
+  /* Leave notify should override the query function */
+  hide_tooltip = (event_type == GDK_LEAVE_NOTIFY);
+
+  /* Is the pointer above another widget now? */
+  if (GTK_TOOLTIP_VISIBLE (tooltip))
+    hide_tooltip |= target_widget != tooltip->tooltip_widget;
+
+  /* Did the pointer move out of the previous "context area"? */
+  if (tip_area_set)
+    hide_tooltip |= !gdk_rectangle_contains_point (&tip_area, x, y);
+
+  if (hide_tooltip)
+    gtk_tooltip_hide_tooltip (tooltip);
+  else
+    gtk_tooltip_start_delay (display);
+}
+
+static gboolean
+gtk_tooltip_requery_tick (GtkWidget     *widget,
+                          GdkFrameClock *frame_clock,
+                          gpointer       user_data)
+{
+  GtkTooltip *tooltip = user_data;
+
+  tooltip->requery_tick_id = 0;
+  tooltip->requery_widget = NULL;
+
+  gtk_tooltip_handle_motion (tooltip, GDK_MOTION_NOTIFY, widget,
+                             tooltip->requery_x, tooltip->requery_y);
+
+  return G_SOURCE_REMOVE;
+}
+
+static void
+gtk_tooltip_queue_requery (GtkTooltip *tooltip,
+                           GtkWidget  *target_widget,
+                           gdouble     x,
+                           gdouble     y)
+{
+  if (tooltip->requery_widget != target_widget)
+    {
+      gtk_tooltip_cancel_requery (tooltip);
+
+      tooltip->requery_widget = target_widget;
+      tooltip->requery_tick_id = gtk_widget_add_tick_callback (target_widget,
+                                                               gtk_tooltip_requery_tick,
+                                                               g_object_ref (tooltip),
+                                                               g_object_unref);
+    }
+
+  tooltip->requery_x = x;
+  tooltip->requery_y = y;
+}
+
+static void
+gtk_tooltip_cancel_requery (GtkTooltip *tooltip)
+{
+  if (tooltip->requery_tick_id == 0)
+    return;
+
+  gtk_widget_remove_tick_callback (tooltip->requery_widget,
+                                   tooltip->requery_tick_id);
+  tooltip->requery_tick_id = 0;
+  tooltip->requery_widget = NULL;
 }
 
 /* dx/dy must be in @target_widget's coordinates */
@@ -914,9 +1045,9 @@ gtk_tooltip_handle_event_internal (GdkEventType   event_type,
                                    GdkSurface    *surface,
                                    GtkWidget     *target_widget,
                                    gdouble       dx,
-                                   gdouble       dy)
+                                   gdouble       dy,
+                                   gboolean      throttle)
 {
-  int x = 0, y = 0;
   GdkDisplay *display;
   GtkTooltip *current_tooltip;
 
@@ -930,7 +1061,10 @@ gtk_tooltip_handle_event_internal (GdkEventType   event_type,
   if (!target_widget)
     {
       if (current_tooltip)
-	gtk_tooltip_hide_tooltip (current_tooltip);
+        {
+          gtk_tooltip_cancel_requery (current_tooltip);
+	  gtk_tooltip_hide_tooltip (current_tooltip);
+        }
 
       return;
     }
@@ -942,6 +1076,8 @@ gtk_tooltip_handle_event_internal (GdkEventType   event_type,
       case GDK_DRAG_ENTER:
       case GDK_GRAB_BROKEN:
       case GDK_SCROLL:
+        if (current_tooltip)
+          gtk_tooltip_cancel_requery (current_tooltip);
 	gtk_tooltip_hide_tooltip (current_tooltip);
 	break;
 
@@ -950,32 +1086,27 @@ gtk_tooltip_handle_event_internal (GdkEventType   event_type,
       case GDK_LEAVE_NOTIFY:
 	if (current_tooltip)
 	  {
-	    gboolean tip_area_set;
-            GdkRectangle tip_area;
-	    gboolean hide_tooltip;
-
-	    tip_area_set = current_tooltip->tip_area_set;
-	    tip_area = current_tooltip->tip_area;
-
-	    gtk_tooltip_run_requery (&target_widget,
-                                     current_tooltip,
-                                     &x, &y);
-
-	    /* Leave notify should override the query function */
-	    hide_tooltip = (event_type == GDK_LEAVE_NOTIFY);
-
-	    /* Is the pointer above another widget now? */
-	    if (GTK_TOOLTIP_VISIBLE (current_tooltip))
-	      hide_tooltip |= target_widget != current_tooltip->tooltip_widget;
-
-	    /* Did the pointer move out of the previous "context area"? */
-	    if (tip_area_set)
-	      hide_tooltip |= !gdk_rectangle_contains_point (&tip_area, x, y);
-
-	    if (hide_tooltip)
-	      gtk_tooltip_hide_tooltip (current_tooltip);
-	    else
-	      gtk_tooltip_start_delay (display);
+            if (throttle && event_type == GDK_MOTION_NOTIFY)
+              {
+                /* While no tooltip is shown, moving only restarts the
+                 * delay, the widgets are asked once it expires.
+                 */
+                if (!GTK_TOOLTIP_VISIBLE (current_tooltip))
+                  {
+                    gtk_tooltip_cancel_requery (current_tooltip);
+                    gtk_tooltip_start_delay (display);
+                  }
+                else if (gtk_tooltip_in_tip_area (current_tooltip, target_widget, dx, dy))
+                  gtk_tooltip_cancel_requery (current_tooltip);
+                else
+                  gtk_tooltip_queue_requery (current_tooltip, target_widget, dx, dy);
+              }
+            else
+              {
+                gtk_tooltip_cancel_requery (current_tooltip);
+                gtk_tooltip_handle_motion (current_tooltip, event_type,
+                                           target_widget, dx, dy);
+              }
 	  }
 	else
 	  {
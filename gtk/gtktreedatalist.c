@@ -22,30 +22,29 @@
 #include "gtktreedatalist.h"
 #include <string.h>
 
-/* node allocation
+/* Rows are allocated as one array holding the data of all columns,
+ * so that looking up a column does not have to chase pointers.
  */
 GtkTreeDataList *
-_gtk_tree_data_list_alloc (void)
+_gtk_tree_data_list_alloc (gint n_columns)
 {
-  GtkTreeDataList *list;
-
-  list = g_slice_new0 (GtkTreeDataList);
-
-  return list;
+  return g_slice_alloc0 (n_columns * sizeof (GtkTreeDataList));
 }
 
 void
 _gtk_tree_data_list_free (GtkTreeDataList *list,
-			  GType           *column_headers)
+			  GType           *column_headers,
+			  gint             n_columns)
 {
-  GtkTreeDataList *tmp, *next;
-  gint i = 0;
+  GtkTreeDataList *tmp;
+  gint i;
 
-  tmp = list;
+  if (list == NULL)
+    return;
 
-  while (tmp)
+  for (i = 0; i < n_columns; i++)
     {
-      next = tmp->next;
+      tmp = &list[i];
       if (g_type_is_a (column_headers [i], G_TYPE_STRING))
 	g_free ((gchar *) tmp->data.v_pointer);
       else if (g_type_is_a (column_headers [i], G_TYPE_OBJECT) && tmp->data.v_pointer != NULL)
@@ -54,11 +53,9 @@ _gtk_tree_data_list_free (GtkTreeDataList *list,
 	g_boxed_free (column_headers [i], (gpointer) tmp->data.v_pointer);
       else if (g_type_is_a (column_headers [i], G_TYPE_VARIANT) && tmp->data.v_pointer != NULL)
 	g_variant_unref ((gpointer) tmp->data.v_pointer);
-
-      g_slice_free (GtkTreeDataList, tmp);
-      i++;
-      tmp = next;
     }
+
+  g_slice_free1 (n_columns * sizeof (GtkTreeDataList), list);
 }
 
 gboolean
@@ -258,17 +255,11 @@ _gtk_tree_data_list_value_to_node (GtkTreeDataList *list,
     }
 }
 
-GtkTreeDataList *
-_gtk_tree_data_list_node_copy (GtkTreeDataList *list,
-                               GType            type)
+static void
+node_copy (GtkTreeDataList *list,
+           GtkTreeDataList *new_list,
+           GType            type)
 {
-  GtkTreeDataList *new_list;
-
-  g_return_val_if_fail (list != NULL, NULL);
-  
-  new_list = _gtk_tree_data_list_alloc ();
-  new_list->next = NULL;
-
   switch (get_fundamental_type (type))
     {
     case G_TYPE_BOOLEAN:
@@ -312,6 +303,22 @@ _gtk_tree_data_list_node_copy (GtkTreeDataList *list,
       g_warning ("Unsupported node type (%s) copied.", g_type_name (type));
       break;
     }
+}
+
+GtkTreeDataList *
+_gtk_tree_data_list_copy (GtkTreeDataList *list,
+                          GType           *column_headers,
+                          gint             n_columns)
+{
+  GtkTreeDataList *new_list;
+  gint i;
+
+  g_return_val_if_fail (list != NULL, NULL);
+
+  new_list = _gtk_tree_data_list_alloc (n_columns);
+
+  for (i = 0; i < n_columns; i++)
+    node_copy (&list[i], &new_list[i], column_headers[i]);
 
   return new_list;
 }
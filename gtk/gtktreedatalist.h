@@ -21,11 +21,12 @@
 #include <gtk/gtktreemodel.h>
 #include <gtk/gtktreesortable.h>
 
+/* The data of one cell. A row is an array of these,
+ * one for each column, see _gtk_tree_data_list_alloc().
+ */
 typedef struct _GtkTreeDataList GtkTreeDataList;
 struct _GtkTreeDataList
 {
-  GtkTreeDataList *next;
-
   union {
     gint	   v_int;
     gint8          v_char;
@@ -49,9 +50,10 @@ typedef struct _GtkTreeDataSortHeader
   GDestroyNotify destroy;
 } GtkTreeDataSortHeader;
 
-GtkTreeDataList *_gtk_tree_data_list_alloc          (void);
+GtkTreeDataList *_gtk_tree_data_list_alloc          (gint             n_columns);
 void             _gtk_tree_data_list_free           (GtkTreeDataList *list,
-						     GType           *column_headers);
+						     GType           *column_headers,
+						     gint             n_columns);
 gboolean         _gtk_tree_data_list_check_type     (GType            type);
 void             _gtk_tree_data_list_node_to_value  (GtkTreeDataList *list,
 						     GType            type,
@@ -59,8 +61,9 @@ void             _gtk_tree_data_list_node_to_value  (GtkTreeDataList *list,
 void             _gtk_tree_data_list_value_to_node  (GtkTreeDataList *list,
 						     GValue          *value);
 
-GtkTreeDataList *_gtk_tree_data_list_node_copy      (GtkTreeDataList *list,
-                                                     GType            type);
+GtkTreeDataList *_gtk_tree_data_list_copy           (GtkTreeDataList *list,
+                                                     GType           *column_headers,
+                                                     gint             n_columns);
 
 /* Header code */
 gint                   _gtk_tree_data_list_compare_func (GtkTreeModel *model,
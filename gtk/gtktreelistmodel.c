@@ -23,6 +23,7 @@
 
 #include "gtkrbtreeprivate.h"
 #include "gtkintl.h"
+#include "gtklistmodelitemsprivate.h"
 #include "gtkprivate.h"
 
 /**
@@ -38,6 +39,7 @@
 enum {
   PROP_0,
   PROP_AUTOEXPAND,
+  PROP_MAX_CACHED_MODELS,
   PROP_MODEL,
   PROP_PASSTHROUGH,
   NUM_PROPERTIES
@@ -56,6 +58,10 @@ struct _TreeNode
     GtkTreeListModel *list;
   };
 
+  /* Child model kept around while the node is collapsed */
+  GListModel *cached_model;
+  GList cache_link;
+
   guint empty : 1;
   guint is_root : 1;
 };
@@ -76,6 +82,10 @@ struct _GtkTreeListModel
   gpointer user_data;
   GDestroyNotify user_destroy;
 
+  /* nodes with a cached_model, most recently used first */
+  GQueue model_cache;
+  guint max_cached_models;
+
   guint autoexpand : 1;
   guint passthrough : 1;
 };
@@ -333,6 +343,61 @@ tree_node_create_model (GtkTreeListModel *self,
   return model;
 }
 
+static void
+tree_node_uncache_model (GtkTreeListModel *self,
+                         TreeNode         *node)
+{
+  g_queue_unlink (&self->model_cache, &node->cache_link);
+  g_clear_object (&node->cached_model);
+}
+
+static void
+gtk_tree_list_model_trim_model_cache (GtkTreeListModel *self)
+{
+  while (self->model_cache.length > self->max_cached_models)
+    tree_node_uncache_model (self, g_queue_peek_tail (&self->model_cache));
+}
+
+/* Takes ownership of @model */
+static void
+tree_node_cache_model (GtkTreeListModel *self,
+                       TreeNode         *node,
+                       GListModel       *model)
+{
+  g_assert (node->cached_model == NULL);
+
+  if (self->max_cached_models == 0)
+    {
+      g_object_unref (model);
+      return;
+    }
+
+  node->cached_model = model;
+  node->cache_link.data = node;
+  g_queue_push_head_link (&self->model_cache, &node->cache_link);
+
+  gtk_tree_list_model_trim_model_cache (self);
+}
+
+/* Returns a reference to the model for @node's children, reusing
+ * the cached one if there is any.
+ */
+static GListModel *
+tree_node_take_model (GtkTreeListModel *self,
+                      TreeNode         *node)
+{
+  GListModel *model;
+
+  if (node->cached_model)
+    {
+      model = g_object_ref (node->cached_model);
+      tree_node_uncache_model (self, node);
+      return model;
+    }
+
+  return tree_node_create_model (self, node);
+}
+
 static gpointer
 tree_node_get_item (TreeNode *node)
 {
@@ -416,10 +481,17 @@ gtk_tree_list_model_items_changed_cb (GListModel *model,
     }
 
   tree_added = added;
-  for (i = 0; i < added; i++)
+  if (added)
     {
-      child = gtk_rb_tree_insert_before (node->children, child);
-      child->parent = node;
+      TreeNode *first = gtk_rb_tree_insert_n_before (node->children, child, added);
+
+      child = first;
+      for (i = 0; i < added; i++)
+        {
+          child->parent = node;
+          child = gtk_rb_tree_node_get_next (child);
+        }
+      child = first;
     }
   if (self->autoexpand)
     {
@@ -448,6 +520,9 @@ gtk_tree_list_model_clear_node (gpointer data)
   if (node->row)
     gtk_tree_list_row_destroy (node->row);
 
+  if (node->cached_model)
+    tree_node_uncache_model (tree_node_get_tree_list_model (node), node);
+
   if (node->model)
     {
       g_signal_handlers_disconnect_by_func (node->model,
@@ -506,13 +581,13 @@ gtk_tree_list_model_init_node (GtkTreeListModel *list,
                                     NULL);
 
   n = g_list_model_get_n_items (model);
-  node = NULL;
+  node = gtk_rb_tree_insert_n_before (self->children, NULL, n);
   for (i = 0; i < n; i++)
     {
-      node = gtk_rb_tree_insert_after (self->children, node);
       node->parent = self;
       if (list->autoexpand)
         gtk_tree_list_model_expand_node (list, node);
+      node = gtk_rb_tree_node_get_next (node);
     }
 }
 
@@ -528,7 +603,7 @@ gtk_tree_list_model_expand_node (GtkTreeListModel *self,
   if (node->model != NULL)
     return 0;
 
-  model = tree_node_create_model (self, node);
+  model = tree_node_take_model (self, node);
 
   if (model == NULL)
     return 0;
@@ -562,7 +637,10 @@ gtk_tree_list_model_collapse_node (GtkTreeListModel *self,
   n_items = tree_node_get_n_children (node);
 
   g_clear_pointer (&node->children, gtk_rb_tree_unref);
-  g_clear_object (&node->model);
+  g_signal_handlers_disconnect_by_func (node->model,
+                                        gtk_tree_list_model_items_changed_cb,
+                                        node);
+  tree_node_cache_model (self, node, g_steal_pointer (&node->model));
 
   tree_node_mark_dirty (node);
 
@@ -618,8 +696,63 @@ gtk_tree_list_model_model_init (GListModelInterface *iface)
   iface->get_item = gtk_tree_list_model_get_item;
 }
 
+/* Returns the node for the row after @node */
+static TreeNode *
+tree_node_get_next_row (TreeNode *node)
+{
+  TreeNode *next;
+
+  if (node->children)
+    {
+      next = gtk_rb_tree_get_first (node->children);
+      if (next)
+        return next;
+    }
+
+  for (; !node->is_root; node = node->parent)
+    {
+      next = gtk_rb_tree_node_get_next (node);
+      if (next)
+        return next;
+    }
+
+  return NULL;
+}
+
+static guint
+gtk_tree_list_model_get_items (GtkListModelItems *list,
+                               guint              position,
+                               guint              n_items,
+                               gpointer          *items)
+{
+  GtkTreeListModel *self = GTK_TREE_LIST_MODEL (list);
+  TreeNode *node;
+  guint i;
+
+  node = gtk_tree_list_model_get_nth (self, position);
+
+  for (i = 0; i < n_items && node != NULL; i++)
+    {
+      if (self->passthrough)
+        items[i] = tree_node_get_item (node);
+      else
+        items[i] = tree_node_get_row (node);
+
+      node = tree_node_get_next_row (node);
+    }
+
+  return i;
+}
+
+static void
+gtk_tree_list_model_items_init (GtkListModelItemsInterface *iface)
+{
+  iface->get_items = gtk_tree_list_model_get_items;
+}
+
 G_DEFINE_TYPE_WITH_CODE (GtkTreeListModel, gtk_tree_list_model, G_TYPE_OBJECT,
-                         G_IMPLEMENT_INTERFACE (G_TYPE_LIST_MODEL, gtk_tree_list_model_model_init))
+                         G_IMPLEMENT_INTERFACE (G_TYPE_LIST_MODEL, gtk_tree_list_model_model_init)
+                         G_IMPLEMENT_INTERFACE (GTK_TYPE_LIST_MODEL_ITEMS, gtk_tree_list_model_items_init))
 
 static void
 gtk_tree_list_model_set_property (GObject      *object,
@@ -635,6 +768,10 @@ gtk_tree_list_model_set_property (GObject      *object,
       gtk_tree_list_model_set_autoexpand (self, g_value_get_boolean (value));
       break;
 
+    case PROP_MAX_CACHED_MODELS:
+      gtk_tree_list_model_set_max_cached_models (self, g_value_get_uint (value));
+      break;
+
     case PROP_PASSTHROUGH:
       self->passthrough = g_value_get_boolean (value);
       break;
@@ -659,6 +796,10 @@ gtk_tree_list_model_get_property (GObject     *object,
       g_value_set_boolean (value, self->autoexpand);
       break;
 
+    case PROP_MAX_CACHED_MODELS:
+      g_value_set_uint (value, self->max_cached_models);
+      break;
+
     case PROP_MODEL:
       g_value_set_object (value, self->root_node.model);
       break;
@@ -678,6 +819,8 @@ gtk_tree_list_model_finalize (GObject *object)
 {
   GtkTreeListModel *self = GTK_TREE_LIST_MODEL (object);
 
+  self->max_cached_models = 0;
+  gtk_tree_list_model_trim_model_cache (self);
   gtk_tree_list_model_clear_node (&self->root_node);
   if (self->user_destroy)
     self->user_destroy (self->user_data);
@@ -706,6 +849,18 @@ gtk_tree_list_model_class_init (GtkTreeListModelClass *class)
                             FALSE,
                             GTK_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * GtkTreeListModel:max-cached-models:
+   *
+   * The maximum number of child models of collapsed rows to keep around
+   */
+  properties[PROP_MAX_CACHED_MODELS] =
+      g_param_spec_uint ("max-cached-models",
+                         P_("Max cached models"),
+                         P_("Maximum number of child models of collapsed rows to keep around"),
+                         0, G_MAXUINT, 0,
+                         GTK_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   /**
    * GtkTreeListModel:model:
    *
@@ -863,6 +1018,54 @@ gtk_tree_list_model_get_autoexpand (GtkTreeListModel *self)
   return self->autoexpand;
 }
 
+/**
+ * gtk_tree_list_model_set_max_cached_models:
+ * @self: a #GtkTreeListModel
+ * @max_cached_models: the number of child models to keep
+ *
+ * Sets how many child models of collapsed rows @self keeps around.
+ *
+ * Child models are created when a row is expanded or when it is
+ * checked with gtk_tree_list_row_is_expandable(). Normally they are
+ * dropped again when the row is collapsed or has been checked, and
+ * created anew the next time. With a cache, the most recently used
+ * ones are kept and reused instead, which avoids calling the
+ * #GtkTreeListModelCreateModelFunc again when browsing back and forth
+ * in trees where creating the children is expensive.
+ *
+ * The default is 0, which does not keep any of them.
+ **/
+void
+gtk_tree_list_model_set_max_cached_models (GtkTreeListModel *self,
+                                           guint             max_cached_models)
+{
+  g_return_if_fail (GTK_IS_TREE_LIST_MODEL (self));
+
+  if (self->max_cached_models == max_cached_models)
+    return;
+
+  self->max_cached_models = max_cached_models;
+  gtk_tree_list_model_trim_model_cache (self);
+
+  g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_MAX_CACHED_MODELS]);
+}
+
+/**
+ * gtk_tree_list_model_get_max_cached_models:
+ * @self: a #GtkTreeListModel
+ *
+ * Gets the value set via gtk_tree_list_model_set_max_cached_models().
+ *
+ * Returns: the maximum number of child models kept for collapsed rows
+ **/
+guint
+gtk_tree_list_model_get_max_cached_models (GtkTreeListModel *self)
+{
+  g_return_val_if_fail (GTK_IS_TREE_LIST_MODEL (self), 0);
+
+  return self->max_cached_models;
+}
+
 /**
  * gtk_tree_list_model_get_row:
  * @self: a #GtkTreeListModel
@@ -1253,14 +1456,15 @@ gtk_tree_list_row_is_expandable (GtkTreeListRow *self)
   if (self->node->empty)
     return FALSE;
 
-  if (self->node->model)
+  if (self->node->model || self->node->cached_model)
     return TRUE;
 
   list = tree_node_get_tree_list_model (self->node);
   model = tree_node_create_model (list, self->node);
   if (model)
     {
-      g_object_unref (model);
+      /* expanding the row next will likely want it again */
+      tree_node_cache_model (list, self->node, model);
       return TRUE;
     }
 
@@ -74,6 +74,11 @@ void                    gtk_tree_list_model_set_autoexpand      (GtkTreeListMode
                                                                  gboolean                autoexpand);
 GDK_AVAILABLE_IN_ALL
 gboolean                gtk_tree_list_model_get_autoexpand      (GtkTreeListModel       *self);
+GDK_AVAILABLE_IN_ALL
+void                    gtk_tree_list_model_set_max_cached_models (GtkTreeListModel     *self,
+                                                                 guint                   max_cached_models);
+GDK_AVAILABLE_IN_ALL
+guint                   gtk_tree_list_model_get_max_cached_models (GtkTreeListModel     *self);
 
 GDK_AVAILABLE_IN_ALL
 GtkTreeListRow *        gtk_tree_list_model_get_child_row       (GtkTreeListModel       *self,
@@ -294,6 +294,14 @@ struct _GtkTreeModelFilterPrivate
   gulong has_child_toggled_id;
   gulong deleted_id;
   gulong reordered_id;
+
+  /* incremental refilter */
+  guint refilter_id;
+  GtkTreeRowReference *refilter_row;  /* the next child row to test */
+  GtkTreePath *refilter_path;         /* its path, in case it goes away */
+  GPtrArray *refilter_paths;          /* the child rows to test when narrowing */
+  guint refilter_index;
+  guint refilter_paths_stale : 1;
 };
 
 /* properties */
@@ -321,6 +329,9 @@ enum
  */
 #undef MODEL_FILTER_DEBUG
 
+/* How long an incremental refilter may run per main loop iteration */
+#define REFILTER_MS_PER_IDLE 10
+
 #define FILTER_ELT(filter_elt) ((FilterElt *)filter_elt)
 #define FILTER_LEVEL(filter_level) ((FilterLevel *)filter_level)
 #define GET_ELT(siter) ((FilterElt*) (siter ? g_sequence_get (siter) : NULL))
@@ -462,6 +473,7 @@ static void         gtk_tree_model_filter_unref_path                      (GtkTr
                                                                            int                     depth);
 static void         gtk_tree_model_filter_set_root                        (GtkTreeModelFilter     *filter,
                                                                            GtkTreePath            *root);
+static void         gtk_tree_model_filter_stop_refilter                   (GtkTreeModelFilter     *filter);
 
 static GtkTreePath *gtk_real_tree_model_filter_convert_child_path_to_path (GtkTreeModelFilter     *filter,
                                                                            GtkTreePath            *child_path,
@@ -2129,6 +2141,9 @@ gtk_tree_model_filter_row_inserted (GtkTreeModel *c_model,
 
   g_return_if_fail (c_path != NULL || c_iter != NULL);
 
+  /* The paths a narrowing refilter still has to test may be wrong now */
+  filter->priv->refilter_paths_stale = TRUE;
+
   if (!c_path)
     {
       c_path = gtk_tree_model_get_path (c_model, c_iter);
@@ -2540,6 +2555,8 @@ gtk_tree_model_filter_row_deleted (GtkTreeModel *c_model,
 
   g_return_if_fail (c_path != NULL);
 
+  filter->priv->refilter_paths_stale = TRUE;
+
   /* special case the deletion of an ancestor of the virtual root */
   if (filter->priv->virtual_root &&
       (gtk_tree_path_is_ancestor (c_path, filter->priv->virtual_root) ||
@@ -2724,6 +2741,8 @@ gtk_tree_model_filter_rows_reordered (GtkTreeModel *c_model,
 
   g_return_if_fail (new_order != NULL);
 
+  filter->priv->refilter_paths_stale = TRUE;
+
   if (c_path == NULL || gtk_tree_path_get_depth (c_path) == 0)
     {
       length = gtk_tree_model_iter_n_children (c_model, NULL);
@@ -3646,6 +3665,8 @@ gtk_tree_model_filter_set_model (GtkTreeModelFilter *filter,
       g_signal_handler_disconnect (filter->priv->child_model,
                                    filter->priv->reordered_id);
 
+      gtk_tree_model_filter_stop_refilter (filter);
+
       /* reset our state */
       if (filter->priv->root)
         gtk_tree_model_filter_free_level (filter, filter->priv->root,
@@ -4240,12 +4261,267 @@ gtk_tree_model_filter_refilter (GtkTreeModelFilter *filter)
 {
   g_return_if_fail (GTK_IS_TREE_MODEL_FILTER (filter));
 
+  gtk_tree_model_filter_stop_refilter (filter);
+
   /* S L O W */
   gtk_tree_model_foreach (filter->priv->child_model,
                           gtk_tree_model_filter_refilter_helper,
                           filter);
 }
 
+static void
+gtk_tree_model_filter_stop_refilter (GtkTreeModelFilter *filter)
+{
+  GtkTreeModelFilterPrivate *priv = filter->priv;
+
+  if (priv->refilter_id)
+    {
+      g_source_remove (priv->refilter_id);
+      priv->refilter_id = 0;
+    }
+
+  g_clear_pointer (&priv->refilter_row, gtk_tree_row_reference_free);
+  g_clear_pointer (&priv->refilter_path, gtk_tree_path_free);
+  g_clear_pointer (&priv->refilter_paths, g_ptr_array_unref);
+  priv->refilter_index = 0;
+}
+
+/* Collects the child paths of the visible rows, parents first */
+static void
+collect_visible_rows (GtkTreeModelFilter *filter,
+                      FilterLevel        *level,
+                      GPtrArray          *paths)
+{
+  GSequenceIter *siter;
+  FilterElt *elt;
+
+  for (siter = g_sequence_get_begin_iter (level->visible_seq);
+       !g_sequence_iter_is_end (siter);
+       siter = g_sequence_iter_next (siter))
+    {
+      elt = g_sequence_get (siter);
+      g_ptr_array_add (paths,
+                       gtk_tree_model_filter_elt_get_path (level, elt,
+                                                           filter->priv->virtual_root));
+      if (elt->children)
+        collect_visible_rows (filter, elt->children, paths);
+    }
+}
+
+static void
+gtk_tree_model_filter_collect_refilter_paths (GtkTreeModelFilter *filter)
+{
+  GtkTreeModelFilterPrivate *priv = filter->priv;
+
+  g_clear_pointer (&priv->refilter_paths, g_ptr_array_unref);
+  priv->refilter_paths = g_ptr_array_new_with_free_func ((GDestroyNotify) gtk_tree_path_free);
+  priv->refilter_index = 0;
+  priv->refilter_paths_stale = FALSE;
+
+  if (priv->root)
+    collect_visible_rows (filter, priv->root, priv->refilter_paths);
+}
+
+/* Moves @iter and @path to the next row of the child model in
+ * depth-first order, without leaving the virtual root.
+ */
+static gboolean
+refilter_next_row (GtkTreeModelFilter *filter,
+                   GtkTreeIter        *iter,
+                   GtkTreePath        *path)
+{
+  GtkTreeModel *model = filter->priv->child_model;
+  GtkTreeIter tmp;
+  gint root_depth;
+
+  if (filter->priv->virtual_root)
+    root_depth = gtk_tree_path_get_depth (filter->priv->virtual_root);
+  else
+    root_depth = 0;
+
+  if (gtk_tree_model_iter_children (model, &tmp, iter))
+    {
+      *iter = tmp;
+      gtk_tree_path_down (path);
+      return TRUE;
+    }
+
+  while (TRUE)
+    {
+      tmp = *iter;
+      if (gtk_tree_model_iter_next (model, &tmp))
+        {
+          *iter = tmp;
+          gtk_tree_path_next (path);
+          return TRUE;
+        }
+
+      if (gtk_tree_path_get_depth (path) <= root_depth + 1 ||
+          !gtk_tree_model_iter_parent (model, &tmp, iter))
+        return FALSE;
+
+      *iter = tmp;
+      gtk_tree_path_up (path);
+    }
+}
+
+static gboolean
+gtk_tree_model_filter_refilter_step (gpointer data)
+{
+  GtkTreeModelFilter *filter = data;
+  GtkTreeModelFilterPrivate *priv = filter->priv;
+  GtkTreeModel *model = priv->child_model;
+  guint id = priv->refilter_id;
+  gboolean more;
+  GtkTreeIter iter;
+  GtkTreePath *path;
+  GTimer *timer;
+
+  timer = g_timer_new ();
+
+  if (priv->refilter_paths)
+    {
+      GPtrArray *paths;
+
+      if (priv->refilter_paths_stale)
+        gtk_tree_model_filter_collect_refilter_paths (filter);
+
+      /* A visible function may stop or restart us */
+      paths = g_ptr_array_ref (priv->refilter_paths);
+
+      do
+        {
+          more = priv->refilter_index < paths->len;
+          if (!more)
+            break;
+
+          path = g_ptr_array_index (paths, priv->refilter_index);
+          priv->refilter_index++;
+
+          if (gtk_tree_model_get_iter (model, &iter, path))
+            gtk_tree_model_filter_row_changed (model, path, &iter, filter);
+        }
+      while (priv->refilter_id == id &&
+             !priv->refilter_paths_stale &&
+             g_timer_elapsed (timer, NULL) < REFILTER_MS_PER_IDLE / 1000.);
+
+      /* Start over if the child model changed meanwhile */
+      more = priv->refilter_paths_stale || priv->refilter_index < paths->len;
+      g_ptr_array_unref (paths);
+    }
+  else
+    {
+      path = NULL;
+      if (priv->refilter_row)
+        path = gtk_tree_row_reference_get_path (priv->refilter_row);
+      if (path == NULL)
+        path = gtk_tree_path_copy (priv->refilter_path);
+
+      more = gtk_tree_model_get_iter (model, &iter, path);
+
+      while (more)
+        {
+          gtk_tree_model_filter_row_changed (model, path, &iter, filter);
+          more = refilter_next_row (filter, &iter, path);
+
+          if (priv->refilter_id != id ||
+              g_timer_elapsed (timer, NULL) >= REFILTER_MS_PER_IDLE / 1000.)
+            break;
+        }
+
+      if (more && priv->refilter_id == id)
+        {
+          gtk_tree_row_reference_free (priv->refilter_row);
+          priv->refilter_row = gtk_tree_row_reference_new (model, path);
+          gtk_tree_path_free (priv->refilter_path);
+          priv->refilter_path = gtk_tree_path_copy (path);
+        }
+
+      gtk_tree_path_free (path);
+    }
+
+  g_timer_destroy (timer);
+
+  /* Stopped or restarted from a visible function */
+  if (priv->refilter_id != id)
+    return G_SOURCE_REMOVE;
+
+  if (more)
+    return G_SOURCE_CONTINUE;
+
+  priv->refilter_id = 0;
+  gtk_tree_model_filter_stop_refilter (filter);
+
+  return G_SOURCE_REMOVE;
+}
+
+/**
+ * gtk_tree_model_filter_refilter_incremental:
+ * @filter: A #GtkTreeModelFilter.
+ * @narrowing: %TRUE if the filter only got stricter
+ *
+ * Like gtk_tree_model_filter_refilter(), but the work is spread over
+ * several main loop iterations, so that the user interface keeps
+ * responding while a large model is refiltered. Calling this again,
+ * or calling gtk_tree_model_filter_refilter(), cancels a refilter
+ * that has not finished yet, see also
+ * gtk_tree_model_filter_cancel_refilter().
+ *
+ * If @narrowing is %TRUE, the caller promises that no row that is
+ * hidden now would become visible, for example because a search term
+ * only got longer. Only the currently visible rows are then tested
+ * again, which is usually far fewer.
+ */
+void
+gtk_tree_model_filter_refilter_incremental (GtkTreeModelFilter *filter,
+                                            gboolean            narrowing)
+{
+  GtkTreeModelFilterPrivate *priv;
+  GtkTreePath *path;
+
+  g_return_if_fail (GTK_IS_TREE_MODEL_FILTER (filter));
+
+  priv = filter->priv;
+
+  gtk_tree_model_filter_stop_refilter (filter);
+
+  if (priv->child_model == NULL)
+    return;
+
+  if (narrowing)
+    gtk_tree_model_filter_collect_refilter_paths (filter);
+  else
+    {
+      if (priv->virtual_root)
+        path = gtk_tree_path_copy (priv->virtual_root);
+      else
+        path = gtk_tree_path_new ();
+      gtk_tree_path_append_index (path, 0);
+
+      priv->refilter_row = gtk_tree_row_reference_new (priv->child_model, path);
+      priv->refilter_path = path;
+    }
+
+  priv->refilter_id = g_idle_add (gtk_tree_model_filter_refilter_step, filter);
+  g_source_set_name_by_id (priv->refilter_id, "[gtk] gtk_tree_model_filter_refilter_step");
+}
+
+/**
+ * gtk_tree_model_filter_cancel_refilter:
+ * @filter: A #GtkTreeModelFilter.
+ *
+ * Stops a refilter started with gtk_tree_model_filter_refilter_incremental()
+ * that has not finished yet. Rows that were tested already keep their
+ * new visibility, the other ones keep their old one.
+ */
+void
+gtk_tree_model_filter_cancel_refilter (GtkTreeModelFilter *filter)
+{
+  g_return_if_fail (GTK_IS_TREE_MODEL_FILTER (filter));
+
+  gtk_tree_model_filter_stop_refilter (filter);
+}
+
 /**
  * gtk_tree_model_filter_clear_cache:
  * @filter: A #GtkTreeModelFilter.
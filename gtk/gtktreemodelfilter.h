@@ -149,6 +149,11 @@ GtkTreePath  *gtk_tree_model_filter_convert_path_to_child_path (GtkTreeModelFilt
 GDK_AVAILABLE_IN_ALL
 void          gtk_tree_model_filter_refilter                   (GtkTreeModelFilter           *filter);
 GDK_AVAILABLE_IN_ALL
+void          gtk_tree_model_filter_refilter_incremental       (GtkTreeModelFilter           *filter,
+                                                                gboolean                      narrowing);
+GDK_AVAILABLE_IN_ALL
+void          gtk_tree_model_filter_cancel_refilter            (GtkTreeModelFilter           *filter);
+GDK_AVAILABLE_IN_ALL
 void          gtk_tree_model_filter_clear_cache                (GtkTreeModelFilter           *filter);
 
 G_END_DECLS
@@ -216,6 +216,7 @@
 typedef struct _SortElt SortElt;
 typedef struct _SortLevel SortLevel;
 typedef struct _SortData SortData;
+typedef union _SortKey SortKey;
 
 struct _SortElt
 {
@@ -236,6 +237,14 @@ struct _SortLevel
   SortLevel *parent_level;
 };
 
+union _SortKey
+{
+  gint64   i;
+  guint64  u;
+  gdouble  d;
+  gchar   *s;
+};
+
 struct _SortData
 {
   GtkTreeModelSort *tree_model_sort;
@@ -245,6 +254,12 @@ struct _SortData
   GtkTreePath *parent_path;
   gint *parent_path_indices;
   gint parent_path_depth;
+
+  /* Sort keys, indexed by old_index, when sorting a whole level
+   * on a column with the default compare function
+   */
+  SortKey *keys;
+  GType key_type;
 };
 
 /* Properties */
@@ -658,6 +673,8 @@ fill_sort_data (SortData         *data,
   GtkTreeModelSortPrivate *priv = tree_model_sort->priv;
 
   data->tree_model_sort = tree_model_sort;
+  data->keys = NULL;
+  data->key_type = G_TYPE_INVALID;
 
   if (priv->sort_column_id != GTK_TREE_SORTABLE_DEFAULT_SORT_COLUMN_ID)
     {
@@ -701,6 +718,154 @@ free_sort_data (SortData *data)
   gtk_tree_path_free (data->parent_path);
 }
 
+static GType
+sort_key_type (GType type)
+{
+  switch (G_TYPE_FUNDAMENTAL (type))
+    {
+    case G_TYPE_BOOLEAN:
+    case G_TYPE_CHAR:
+    case G_TYPE_INT:
+    case G_TYPE_LONG:
+    case G_TYPE_INT64:
+    case G_TYPE_ENUM:
+      return G_TYPE_INT64;
+    case G_TYPE_UCHAR:
+    case G_TYPE_UINT:
+    case G_TYPE_ULONG:
+    case G_TYPE_UINT64:
+    case G_TYPE_FLAGS:
+      return G_TYPE_UINT64;
+    case G_TYPE_FLOAT:
+    case G_TYPE_DOUBLE:
+      return G_TYPE_DOUBLE;
+    case G_TYPE_STRING:
+      return G_TYPE_STRING;
+    default:
+      return G_TYPE_INVALID;
+    }
+}
+
+/* When a level is sorted on a column with the default compare function,
+ * fetch every value once and turn it into a key that compares the same
+ * way, instead of fetching two values per comparison. For strings that
+ * means a collation key, so g_utf8_collate() is not repeated n log n
+ * times either.
+ */
+static void
+fill_sort_keys (SortData  *data,
+                SortLevel *level)
+{
+  GtkTreeModelSort *tree_model_sort = data->tree_model_sort;
+  GtkTreeModel *child_model = tree_model_sort->priv->child_model;
+  GSequenceIter *siter, *end_siter;
+  gint column;
+  GType type;
+
+  if (data->sort_func != _gtk_tree_data_list_compare_func)
+    return;
+
+  column = GPOINTER_TO_INT (data->sort_data);
+  type = gtk_tree_model_get_column_type (child_model, column);
+  data->key_type = sort_key_type (type);
+  if (data->key_type == G_TYPE_INVALID)
+    return;
+
+  data->keys = g_new (SortKey, g_sequence_get_length (level->seq));
+
+  end_siter = g_sequence_get_end_iter (level->seq);
+  for (siter = g_sequence_get_begin_iter (level->seq);
+       siter != end_siter;
+       siter = g_sequence_iter_next (siter))
+    {
+      SortElt *elt = g_sequence_get (siter);
+      SortKey *key = &data->keys[elt->old_index];
+      GValue value = G_VALUE_INIT;
+      GtkTreeIter child_iter;
+      const gchar *str;
+
+      if (GTK_TREE_MODEL_SORT_CACHE_CHILD_ITERS (tree_model_sort))
+        child_iter = elt->iter;
+      else
+        {
+          data->parent_path_indices [data->parent_path_depth-1] = elt->offset;
+          gtk_tree_model_get_iter (child_model, &child_iter, data->parent_path);
+        }
+
+      gtk_tree_model_get_value (child_model, &child_iter, column, &value);
+
+      switch (G_TYPE_FUNDAMENTAL (type))
+        {
+        case G_TYPE_BOOLEAN:
+          key->i = g_value_get_boolean (&value);
+          break;
+        case G_TYPE_CHAR:
+          key->i = g_value_get_schar (&value);
+          break;
+        case G_TYPE_INT:
+          key->i = g_value_get_int (&value);
+          break;
+        case G_TYPE_LONG:
+          key->i = g_value_get_long (&value);
+          break;
+        case G_TYPE_INT64:
+          key->i = g_value_get_int64 (&value);
+          break;
+        case G_TYPE_ENUM:
+          key->i = g_value_get_enum (&value);
+          break;
+        case G_TYPE_UCHAR:
+          key->u = g_value_get_uchar (&value);
+          break;
+        case G_TYPE_UINT:
+          key->u = g_value_get_uint (&value);
+          break;
+        case G_TYPE_ULONG:
+          key->u = g_value_get_ulong (&value);
+          break;
+        case G_TYPE_UINT64:
+          key->u = g_value_get_uint64 (&value);
+          break;
+        case G_TYPE_FLAGS:
+          key->u = g_value_get_flags (&value);
+          break;
+        case G_TYPE_FLOAT:
+          key->d = g_value_get_float (&value);
+          break;
+        case G_TYPE_DOUBLE:
+          key->d = g_value_get_double (&value);
+          break;
+        case G_TYPE_STRING:
+          str = g_value_get_string (&value);
+          key->s = g_utf8_collate_key (str ? str : "", -1);
+          break;
+        default:
+          g_assert_not_reached ();
+        }
+
+      g_value_unset (&value);
+    }
+}
+
+static void
+free_sort_keys (SortData  *data,
+                SortLevel *level)
+{
+  gint i, n;
+
+  if (data->keys == NULL)
+    return;
+
+  if (data->key_type == G_TYPE_STRING)
+    {
+      n = g_sequence_get_length (level->seq);
+      for (i = 0; i < n; i++)
+        g_free (data->keys[i].s);
+    }
+
+  g_clear_pointer (&data->keys, g_free);
+}
+
 static SortElt *
 lookup_elt_with_offset (GtkTreeModelSort *tree_model_sort,
                         SortLevel        *level,
@@ -1826,22 +1991,48 @@ gtk_tree_model_sort_compare_func (gconstpointer a,
   GtkTreeIter iter_a, iter_b;
   gint retval;
 
-  if (GTK_TREE_MODEL_SORT_CACHE_CHILD_ITERS (tree_model_sort))
+  if (data->keys)
     {
-      iter_a = sa->iter;
-      iter_b = sb->iter;
+      const SortKey *ka = &data->keys[sa->old_index];
+      const SortKey *kb = &data->keys[sb->old_index];
+
+      switch (data->key_type)
+        {
+        case G_TYPE_INT64:
+          retval = (ka->i > kb->i) - (ka->i < kb->i);
+          break;
+        case G_TYPE_UINT64:
+          retval = (ka->u > kb->u) - (ka->u < kb->u);
+          break;
+        case G_TYPE_DOUBLE:
+          retval = (ka->d > kb->d) - (ka->d < kb->d);
+          break;
+        case G_TYPE_STRING:
+          retval = strcmp (ka->s, kb->s);
+          break;
+        default:
+          g_assert_not_reached ();
+        }
     }
   else
     {
-      data->parent_path_indices [data->parent_path_depth-1] = sa->offset;
-      gtk_tree_model_get_iter (GTK_TREE_MODEL (priv->child_model), &iter_a, data->parent_path);
-      data->parent_path_indices [data->parent_path_depth-1] = sb->offset;
-      gtk_tree_model_get_iter (GTK_TREE_MODEL (priv->child_model), &iter_b, data->parent_path);
-    }
+      if (GTK_TREE_MODEL_SORT_CACHE_CHILD_ITERS (tree_model_sort))
+        {
+          iter_a = sa->iter;
+          iter_b = sb->iter;
+        }
+      else
+        {
+          data->parent_path_indices [data->parent_path_depth-1] = sa->offset;
+          gtk_tree_model_get_iter (GTK_TREE_MODEL (priv->child_model), &iter_a, data->parent_path);
+          data->parent_path_indices [data->parent_path_depth-1] = sb->offset;
+          gtk_tree_model_get_iter (GTK_TREE_MODEL (priv->child_model), &iter_b, data->parent_path);
+        }
 
-  retval = (* data->sort_func) (GTK_TREE_MODEL (priv->child_model),
-				&iter_a, &iter_b,
-				data->sort_data);
+      retval = (* data->sort_func) (GTK_TREE_MODEL (priv->child_model),
+                                    &iter_a, &iter_b,
+                                    data->sort_data);
+    }
 
   if (priv->order == GTK_SORT_DESCENDING)
     {
@@ -1933,7 +2124,11 @@ gtk_tree_model_sort_sort_level (GtkTreeModelSort *tree_model_sort,
     g_sequence_sort (level->seq, gtk_tree_model_sort_offset_compare_func,
                      &data);
   else
-    g_sequence_sort (level->seq, gtk_tree_model_sort_compare_func, &data);
+    {
+      fill_sort_keys (&data, level);
+      g_sequence_sort (level->seq, gtk_tree_model_sort_compare_func, &data);
+      free_sort_keys (&data, level);
+    }
 
   free_sort_data (&data);
 
@@ -128,6 +128,8 @@ void		  gtk_tree_view_column_cell_snapshot     (GtkTreeViewColumn  *tree_column,
 void		  _gtk_tree_view_column_cell_set_dirty	 (GtkTreeViewColumn  *tree_column,
 							  gboolean            install_handler);
 gboolean          _gtk_tree_view_column_cell_get_dirty   (GtkTreeViewColumn  *tree_column);
+void              _gtk_tree_view_column_invalidate_cell_data (GtkTreeViewColumn *tree_column,
+                                                              GtkTreePath       *path);
 
 void              _gtk_tree_view_column_push_padding          (GtkTreeViewColumn  *column,
 							       gint                padding);
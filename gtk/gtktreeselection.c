@@ -73,6 +73,12 @@ struct _GtkTreeSelectionPrivate
 static void gtk_tree_selection_finalize          (GObject               *object);
 static gint gtk_tree_selection_real_select_all   (GtkTreeSelection      *selection);
 static gint gtk_tree_selection_real_unselect_all (GtkTreeSelection      *selection);
+static gboolean gtk_tree_selection_needs_selectable_check (GtkTreeSelection *selection);
+static gboolean gtk_tree_selection_toggle_node   (GtkTreeSelection      *selection,
+                                                  GtkTreeRBTree         *tree,
+                                                  GtkTreeRBNode         *node,
+                                                  gboolean               select,
+                                                  gboolean               check_selectable);
 static gint gtk_tree_selection_real_select_node  (GtkTreeSelection      *selection,
 						  GtkTreeRBTree         *tree,
 						  GtkTreeRBNode         *node,
@@ -1084,6 +1090,7 @@ gtk_tree_selection_iter_is_selected (GtkTreeSelection *selection,
 /* Wish I was in python, right now... */
 struct _TempTuple {
   GtkTreeSelection *selection;
+  gboolean check_selectable;
   gint dirty;
 };
 
@@ -1102,7 +1109,8 @@ select_all_helper (GtkTreeRBTree  *tree,
 			  data);
   if (!GTK_TREE_RBNODE_FLAG_SET (node, GTK_TREE_RBNODE_IS_SELECTED))
     {
-      tuple->dirty = gtk_tree_selection_real_select_node (tuple->selection, tree, node, TRUE) || tuple->dirty;
+      tuple->dirty = gtk_tree_selection_toggle_node (tuple->selection, tree, node, TRUE,
+                                                     tuple->check_selectable) || tuple->dirty;
     }
 }
 
@@ -1125,6 +1133,7 @@ gtk_tree_selection_real_select_all (GtkTreeSelection *selection)
   /* Mark all nodes selected */
   tuple = g_new (struct _TempTuple, 1);
   tuple->selection = selection;
+  tuple->check_selectable = gtk_tree_selection_needs_selectable_check (selection);
   tuple->dirty = FALSE;
 
   gtk_tree_rbtree_traverse (tree, tree->root,
@@ -1133,6 +1142,7 @@ gtk_tree_selection_real_select_all (GtkTreeSelection *selection)
                             tuple);
   if (tuple->dirty)
     {
+      gtk_widget_queue_draw (GTK_WIDGET (priv->tree_view));
       g_free (tuple);
       return TRUE;
     }
@@ -1183,7 +1193,8 @@ unselect_all_helper (GtkTreeRBTree *tree,
                               data);
   if (GTK_TREE_RBNODE_FLAG_SET (node, GTK_TREE_RBNODE_IS_SELECTED))
     {
-      tuple->dirty = gtk_tree_selection_real_select_node (tuple->selection, tree, node, FALSE) || tuple->dirty;
+      tuple->dirty = gtk_tree_selection_toggle_node (tuple->selection, tree, node, FALSE,
+                                                     tuple->check_selectable) || tuple->dirty;
     }
 }
 
@@ -1231,6 +1242,7 @@ gtk_tree_selection_real_unselect_all (GtkTreeSelection *selection)
 
       tuple = g_new (struct _TempTuple, 1);
       tuple->selection = selection;
+      tuple->check_selectable = gtk_tree_selection_needs_selectable_check (selection);
       tuple->dirty = FALSE;
 
       tree = _gtk_tree_view_get_rbtree (priv->tree_view);
@@ -1241,6 +1253,7 @@ gtk_tree_selection_real_unselect_all (GtkTreeSelection *selection)
 
       if (tuple->dirty)
         {
+          gtk_widget_queue_draw (GTK_WIDGET (priv->tree_view));
           g_free (tuple);
           return TRUE;
         }
@@ -1290,6 +1303,7 @@ gtk_tree_selection_real_modify_range (GtkTreeSelection *selection,
   GtkTreeRBNode *start_node = NULL, *end_node = NULL;
   GtkTreeRBTree *start_tree, *end_tree;
   GtkTreePath *anchor_path = NULL;
+  gboolean check_selectable;
   gboolean dirty = FALSE;
 
   switch (gtk_tree_path_compare (start_path, end_path))
@@ -1337,9 +1351,13 @@ gtk_tree_selection_real_modify_range (GtkTreeSelection *selection,
   if (anchor_path)
     _gtk_tree_view_set_anchor_path (priv->tree_view, anchor_path);
 
+  check_selectable = gtk_tree_selection_needs_selectable_check (selection);
+
   do
     {
-      dirty |= gtk_tree_selection_real_select_node (selection, start_tree, start_node, (mode == RANGE_SELECT)?TRUE:FALSE);
+      dirty |= gtk_tree_selection_toggle_node (selection, start_tree, start_node,
+                                               (mode == RANGE_SELECT)?TRUE:FALSE,
+                                               check_selectable);
 
       if (start_node == end_node)
 	break;
@@ -1356,12 +1374,15 @@ gtk_tree_selection_real_modify_range (GtkTreeSelection *selection,
 	    {
 	      /* we just ran out of tree.  That means someone passed in bogus values.
 	       */
-	      return dirty;
+	      break;
 	    }
 	}
     }
   while (TRUE);
 
+  if (dirty)
+    gtk_widget_queue_draw (GTK_WIDGET (priv->tree_view));
+
   return dirty;
 }
 
@@ -1593,14 +1614,32 @@ _gtk_tree_selection_emit_changed (GtkTreeSelection *selection)
   g_signal_emit (selection, tree_selection_signals[CHANGED], 0);  
 }
 
-/* NOTE: Any {un,}selection ever done _MUST_ be done through this function!
- */
+/* Whether rows need to be checked with the select function and the
+ * row separator function before their state is changed. Without
+ * them, every row is selectable and large ranges can skip creating a
+ * path and an iter for every row. */
+static gboolean
+gtk_tree_selection_needs_selectable_check (GtkTreeSelection *selection)
+{
+  GtkTreeSelectionPrivate *priv = selection->priv;
+  GtkTreeViewRowSeparatorFunc separator_func;
+  gpointer separator_data;
 
-static gint
-gtk_tree_selection_real_select_node (GtkTreeSelection *selection,
-                                     GtkTreeRBTree    *tree,
-                                     GtkTreeRBNode    *node,
-                                     gboolean          select)
+  _gtk_tree_view_get_row_separator_func (priv->tree_view,
+                                         &separator_func, &separator_data);
+
+  return priv->user_func != NULL || separator_func != NULL;
+}
+
+/* Changes the state of @node without redrawing, for changing many
+ * rows at once. The caller must queue a draw if it returns %TRUE.
+ */
+static gboolean
+gtk_tree_selection_toggle_node (GtkTreeSelection *selection,
+                                GtkTreeRBTree    *tree,
+                                GtkTreeRBNode    *node,
+                                gboolean          select,
+                                gboolean          check_selectable)
 {
   GtkTreeSelectionPrivate *priv = selection->priv;
   gboolean toggle = FALSE;
@@ -1612,9 +1651,14 @@ gtk_tree_selection_real_select_node (GtkTreeSelection *selection,
 
   if (GTK_TREE_RBNODE_FLAG_SET (node, GTK_TREE_RBNODE_IS_SELECTED) != select)
     {
-      path = _gtk_tree_path_new_from_rbtree (tree, node);
-      toggle = _gtk_tree_selection_row_is_selectable (selection, node, path);
-      gtk_tree_path_free (path);
+      if (check_selectable)
+        {
+          path = _gtk_tree_path_new_from_rbtree (tree, node);
+          toggle = _gtk_tree_selection_row_is_selectable (selection, node, path);
+          gtk_tree_path_free (path);
+        }
+      else
+        toggle = TRUE;
     }
 
   if (toggle)
@@ -1630,8 +1674,27 @@ gtk_tree_selection_real_select_node (GtkTreeSelection *selection,
           _gtk_tree_view_accessible_remove_state (priv->tree_view, tree, node, GTK_CELL_RENDERER_SELECTED);
         }
 
-      gtk_widget_queue_draw (GTK_WIDGET (priv->tree_view));
+      return TRUE;
+    }
+
+  return FALSE;
+}
+
+/* NOTE: Any {un,}selection ever done _MUST_ be done through this function,
+ * or gtk_tree_selection_toggle_node() for many rows at once!
+ */
 
+static gint
+gtk_tree_selection_real_select_node (GtkTreeSelection *selection,
+                                     GtkTreeRBTree    *tree,
+                                     GtkTreeRBNode    *node,
+                                     gboolean          select)
+{
+  GtkTreeSelectionPrivate *priv = selection->priv;
+
+  if (gtk_tree_selection_toggle_node (selection, tree, node, select, TRUE))
+    {
+      gtk_widget_queue_draw (GTK_WIDGET (priv->tree_view));
       return TRUE;
     }
 
@@ -148,6 +148,10 @@ static gboolean gtk_tree_store_row_drop_possible  (GtkTreeDragDest   *drag_dest,
 /* Sortable Interfaces */
 
 static void     gtk_tree_store_sort                    (GtkTreeStore           *tree_store);
+static void     gtk_tree_store_sort_helper             (GtkTreeStore           *tree_store,
+							GNode                  *parent,
+							gboolean                recurse,
+							gboolean                emit_reordered);
 static void     gtk_tree_store_sort_iter_changed       (GtkTreeStore           *tree_store,
 							GtkTreeIter            *iter,
 							gint                    column,
@@ -465,8 +469,10 @@ gtk_tree_store_set_column_type (GtkTreeStore *tree_store,
 static gboolean
 node_free (GNode *node, gpointer data)
 {
+  GtkTreeStorePrivate *priv = data;
+
   if (node->data)
-    _gtk_tree_data_list_free (node->data, (GType*)data);
+    _gtk_tree_data_list_free (node->data, priv->column_headers, priv->n_columns);
   node->data = NULL;
 
   return FALSE;
@@ -479,7 +485,7 @@ gtk_tree_store_finalize (GObject *object)
   GtkTreeStorePrivate *priv = tree_store->priv;
 
   g_node_traverse (priv->root, G_POST_ORDER, G_TRAVERSE_ALL, -1,
-		   node_free, priv->column_headers);
+		   node_free, priv);
   g_node_destroy (priv->root);
   _gtk_tree_data_list_header_free (priv->sort_list);
   g_free (priv->column_headers);
@@ -649,19 +655,15 @@ gtk_tree_store_get_value (GtkTreeModel *tree_model,
   GtkTreeStore *tree_store = (GtkTreeStore *) tree_model;
   GtkTreeStorePrivate *priv = tree_store->priv;
   GtkTreeDataList *list;
-  gint tmp_column = column;
 
   g_return_if_fail (column < priv->n_columns);
   g_return_if_fail (VALID_ITER (iter, tree_store));
 
   list = G_NODE (iter->user_data)->data;
 
-  while (tmp_column-- > 0 && list)
-    list = list->next;
-
   if (list)
     {
-      _gtk_tree_data_list_node_to_value (list,
+      _gtk_tree_data_list_node_to_value (&list[column],
 					 priv->column_headers[column],
 					 value);
     }
@@ -844,8 +846,6 @@ gtk_tree_store_real_set_value (GtkTreeStore *tree_store,
 {
   GtkTreeStorePrivate *priv = tree_store->priv;
   GtkTreeDataList *list;
-  GtkTreeDataList *prev;
-  gint old_column = column;
   GValue real_value = G_VALUE_INIT;
   gboolean converted = FALSE;
   gboolean retval = FALSE;
@@ -874,47 +874,12 @@ gtk_tree_store_real_set_value (GtkTreeStore *tree_store,
       converted = TRUE;
     }
 
-  prev = list = G_NODE (iter->user_data)->data;
-
-  while (list != NULL)
-    {
-      if (column == 0)
-	{
-	  if (converted)
-	    _gtk_tree_data_list_value_to_node (list, &real_value);
-	  else
-	    _gtk_tree_data_list_value_to_node (list, value);
-	  retval = TRUE;
-	  if (converted)
-	    g_value_unset (&real_value);
-          if (sort && GTK_TREE_STORE_IS_SORTED (tree_store))
-            gtk_tree_store_sort_iter_changed (tree_store, iter, old_column, TRUE);
-	  return retval;
-	}
-
-      column--;
-      prev = list;
-      list = list->next;
-    }
+  list = G_NODE (iter->user_data)->data;
 
-  if (G_NODE (iter->user_data)->data == NULL)
-    {
-      G_NODE (iter->user_data)->data = list = _gtk_tree_data_list_alloc ();
-      list->next = NULL;
-    }
-  else
-    {
-      list = prev->next = _gtk_tree_data_list_alloc ();
-      list->next = NULL;
-    }
+  if (list == NULL)
+    G_NODE (iter->user_data)->data = list = _gtk_tree_data_list_alloc (priv->n_columns);
 
-  while (column != 0)
-    {
-      list->next = _gtk_tree_data_list_alloc ();
-      list = list->next;
-      list->next = NULL;
-      column --;
-    }
+  list = &list[column];
 
   if (converted)
     _gtk_tree_data_list_value_to_node (list, &real_value);
@@ -926,7 +891,7 @@ gtk_tree_store_real_set_value (GtkTreeStore *tree_store,
     g_value_unset (&real_value);
 
   if (sort && GTK_TREE_STORE_IS_SORTED (tree_store))
-    gtk_tree_store_sort_iter_changed (tree_store, iter, old_column, TRUE);
+    gtk_tree_store_sort_iter_changed (tree_store, iter, column, TRUE);
 
   return retval;
 }
@@ -1220,7 +1185,7 @@ gtk_tree_store_remove (GtkTreeStore *tree_store,
 
   if (G_NODE (iter->user_data)->data)
     g_node_traverse (G_NODE (iter->user_data), G_POST_ORDER, G_TRAVERSE_ALL,
-		     -1, node_free, priv->column_headers);
+		     -1, node_free, priv);
 
   path = gtk_tree_store_get_path (GTK_TREE_MODEL (tree_store), iter);
   g_node_destroy (G_NODE (iter->user_data));
@@ -1988,27 +1953,12 @@ copy_node_data (GtkTreeStore *tree_store,
 {
   GtkTreeDataList *dl = G_NODE (src_iter->user_data)->data;
   GtkTreeDataList *copy_head = NULL;
-  GtkTreeDataList *copy_prev = NULL;
-  GtkTreeDataList *copy_iter = NULL;
   GtkTreePath *path;
-  gint col;
 
-  col = 0;
-  while (dl)
-    {
-      copy_iter = _gtk_tree_data_list_node_copy (dl, tree_store->priv->column_headers[col]);
-
-      if (copy_head == NULL)
-        copy_head = copy_iter;
-
-      if (copy_prev)
-        copy_prev->next = copy_iter;
-
-      copy_prev = copy_iter;
-
-      dl = dl->next;
-      ++col;
-    }
+  if (dl)
+    copy_head = _gtk_tree_data_list_copy (dl,
+                                          tree_store->priv->column_headers,
+                                          tree_store->priv->n_columns);
 
   G_NODE (dest_iter->user_data)->data = copy_head;
 
@@ -2831,6 +2781,212 @@ gtk_tree_store_move_after (GtkTreeStore *tree_store,
   gtk_tree_store_move (tree_store, iter, position, FALSE);
 }
 
+/* Unlinks @node with all its children, and tells the world that
+ * the row is gone. The nodes are not freed.
+ */
+static void
+gtk_tree_store_detach_node (GtkTreeStore *tree_store,
+                            GNode        *node)
+{
+  GtkTreeStorePrivate *priv = tree_store->priv;
+  GtkTreeIter iter;
+  GtkTreePath *path;
+  GNode *parent;
+
+  parent = node->parent;
+
+  iter.stamp = priv->stamp;
+  iter.user_data = node;
+  path = gtk_tree_store_get_path (GTK_TREE_MODEL (tree_store), &iter);
+
+  g_node_unlink (node);
+
+  gtk_tree_model_row_deleted (GTK_TREE_MODEL (tree_store), path);
+
+  if (parent != G_NODE (priv->root) && parent->children == NULL)
+    {
+      gtk_tree_path_up (path);
+
+      iter.user_data = parent;
+      gtk_tree_model_row_has_child_toggled (GTK_TREE_MODEL (tree_store), path, &iter);
+    }
+
+  gtk_tree_path_free (path);
+}
+
+/* Links the detached @node with all its children into @tree_store.
+ * Only the row of @node is announced, nobody can know about its
+ * children yet, and they can be fetched when the row is expanded.
+ */
+static void
+gtk_tree_store_attach_node (GtkTreeStore *tree_store,
+                            GtkTreeIter  *iter,
+                            GNode        *parent_node,
+                            gint          position,
+                            GNode        *node)
+{
+  GtkTreeStorePrivate *priv = tree_store->priv;
+  GtkTreePath *path;
+  GtkTreeIter parent_iter;
+
+  priv->columns_dirty = TRUE;
+
+  iter->stamp = priv->stamp;
+  iter->user_data = node;
+  g_node_insert (parent_node, position, node);
+
+  if (gtk_tree_store_get_compare_func (tree_store))
+    gtk_tree_store_sort_iter_changed (tree_store, iter, priv->sort_column_id, FALSE);
+
+  path = gtk_tree_store_get_path (GTK_TREE_MODEL (tree_store), iter);
+  gtk_tree_model_row_inserted (GTK_TREE_MODEL (tree_store), path, iter);
+
+  if (node->children)
+    gtk_tree_model_row_has_child_toggled (GTK_TREE_MODEL (tree_store), path, iter);
+
+  if (parent_node != priv->root &&
+      node->prev == NULL && node->next == NULL)
+    {
+      gtk_tree_path_up (path);
+
+      parent_iter.stamp = priv->stamp;
+      parent_iter.user_data = parent_node;
+      gtk_tree_model_row_has_child_toggled (GTK_TREE_MODEL (tree_store), path, &parent_iter);
+    }
+
+  gtk_tree_path_free (path);
+
+  validate_tree (tree_store);
+}
+
+static gboolean
+gtk_tree_store_same_columns (GtkTreeStore *a,
+                             GtkTreeStore *b)
+{
+  gint i;
+
+  if (a->priv->n_columns != b->priv->n_columns)
+    return FALSE;
+
+  for (i = 0; i < a->priv->n_columns; i++)
+    {
+      if (a->priv->column_headers[i] != b->priv->column_headers[i])
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
+/**
+ * gtk_tree_store_insert_subtree:
+ * @tree_store: A #GtkTreeStore
+ * @iter: (out) (allow-none): An unset #GtkTreeIter to set to the new row, or %NULL
+ * @parent: (allow-none): A valid #GtkTreeIter, or %NULL
+ * @position: position to insert the new row, or -1 for last
+ * @source: A #GtkTreeStore with the same column types as @tree_store
+ * @source_iter: A valid #GtkTreeIter for a row of @source
+ *
+ * Moves the row @source_iter points to, together with all its
+ * children, from @source to @position in @tree_store, in the same
+ * way as gtk_tree_store_insert() places new rows. The rows are moved,
+ * not copied, and only a single #GtkTreeModel::row-inserted signal is
+ * emitted in @tree_store, for the topmost row, no matter how many
+ * children it has.
+ *
+ * This makes it cheap to build a large hierarchy in a separate store
+ * that is not shown anywhere, and then to add it to a store that is.
+ *
+ * If @tree_store is sorted, the moved rows are sorted as well, and
+ * @position is ignored.
+ *
+ * Iters for the moved rows in @source are invalid afterwards.
+ */
+void
+gtk_tree_store_insert_subtree (GtkTreeStore *tree_store,
+                               GtkTreeIter  *iter,
+                               GtkTreeIter  *parent,
+                               gint          position,
+                               GtkTreeStore *source,
+                               GtkTreeIter  *source_iter)
+{
+  GtkTreeIter tmp_iter;
+  GNode *parent_node;
+  GNode *node;
+
+  g_return_if_fail (GTK_IS_TREE_STORE (tree_store));
+  g_return_if_fail (GTK_IS_TREE_STORE (source));
+  g_return_if_fail (source != tree_store);
+  g_return_if_fail (VALID_ITER (source_iter, source));
+  g_return_if_fail (gtk_tree_store_same_columns (tree_store, source));
+  if (parent)
+    g_return_if_fail (VALID_ITER (parent, tree_store));
+
+  if (!iter)
+    iter = &tmp_iter;
+
+  if (parent)
+    parent_node = parent->user_data;
+  else
+    parent_node = tree_store->priv->root;
+
+  node = source_iter->user_data;
+
+  gtk_tree_store_detach_node (source, node);
+
+  /* Nobody knows about the children yet, so no need to tell anyone */
+  if (gtk_tree_store_get_compare_func (tree_store))
+    gtk_tree_store_sort_helper (tree_store, node, TRUE, FALSE);
+
+  gtk_tree_store_attach_node (tree_store, iter, parent_node, position, node);
+}
+
+/**
+ * gtk_tree_store_move_subtree:
+ * @tree_store: A #GtkTreeStore
+ * @iter: A valid #GtkTreeIter
+ * @new_parent: (allow-none): A valid #GtkTreeIter, or %NULL
+ * @position: position to move the row to, or -1 for last
+ *
+ * Moves the row @iter points to, together with all its children, to
+ * @position below @new_parent, or to the toplevel if @new_parent is
+ * %NULL. Unlike gtk_tree_store_move_before(), the row can move to
+ * another level. The rows are not copied, and @iter as well as iters
+ * for the children stay valid.
+ *
+ * This emits #GtkTreeModel::row-deleted for the old position and
+ * #GtkTreeModel::row-inserted for the new one, just once for the
+ * whole subtree.
+ *
+ * If @tree_store is sorted, @position is ignored.
+ */
+void
+gtk_tree_store_move_subtree (GtkTreeStore *tree_store,
+                             GtkTreeIter  *iter,
+                             GtkTreeIter  *new_parent,
+                             gint          position)
+{
+  GNode *parent_node;
+  GNode *node;
+
+  g_return_if_fail (GTK_IS_TREE_STORE (tree_store));
+  g_return_if_fail (VALID_ITER (iter, tree_store));
+  if (new_parent)
+    g_return_if_fail (VALID_ITER (new_parent, tree_store));
+
+  node = iter->user_data;
+
+  if (new_parent)
+    {
+      parent_node = new_parent->user_data;
+      g_return_if_fail (parent_node != node && !g_node_is_ancestor (node, parent_node));
+    }
+  else
+    parent_node = tree_store->priv->root;
+
+  gtk_tree_store_detach_node (tree_store, node);
+  gtk_tree_store_attach_node (tree_store, iter, parent_node, position, node);
+}
+
 /* Sorting */
 static gint
 gtk_tree_store_compare_func (gconstpointer a,
@@ -2890,7 +3046,8 @@ gtk_tree_store_compare_func (gconstpointer a,
 static void
 gtk_tree_store_sort_helper (GtkTreeStore *tree_store,
 			    GNode        *parent,
-			    gboolean      recurse)
+			    gboolean      recurse,
+			    gboolean      emit_reordered)
 {
   GtkTreeIter iter;
   GArray *sort_array;
@@ -2905,7 +3062,7 @@ gtk_tree_store_sort_helper (GtkTreeStore *tree_store,
   if (node == NULL || node->next == NULL)
     {
       if (recurse && node && node->children)
-        gtk_tree_store_sort_helper (tree_store, node, TRUE);
+        gtk_tree_store_sort_helper (tree_store, node, TRUE, emit_reordered);
 
       return;
     }
@@ -2942,17 +3099,20 @@ gtk_tree_store_sort_helper (GtkTreeStore *tree_store,
   parent->children = g_array_index (sort_array, SortTuple, 0).node;
 
   /* Let the world know about our new order */
-  new_order = g_new (gint, list_length);
-  for (i = 0; i < list_length; i++)
-    new_order[i] = g_array_index (sort_array, SortTuple, i).offset;
+  if (emit_reordered)
+    {
+      new_order = g_new (gint, list_length);
+      for (i = 0; i < list_length; i++)
+        new_order[i] = g_array_index (sort_array, SortTuple, i).offset;
 
-  iter.stamp = tree_store->priv->stamp;
-  iter.user_data = parent;
-  path = gtk_tree_store_get_path (GTK_TREE_MODEL (tree_store), &iter);
-  gtk_tree_model_rows_reordered (GTK_TREE_MODEL (tree_store),
-				 path, &iter, new_order);
-  gtk_tree_path_free (path);
-  g_free (new_order);
+      iter.stamp = tree_store->priv->stamp;
+      iter.user_data = parent;
+      path = gtk_tree_store_get_path (GTK_TREE_MODEL (tree_store), &iter);
+      gtk_tree_model_rows_reordered (GTK_TREE_MODEL (tree_store),
+                                     path, &iter, new_order);
+      gtk_tree_path_free (path);
+      g_free (new_order);
+    }
   g_array_free (sort_array, TRUE);
 
   if (recurse)
@@ -2960,7 +3120,7 @@ gtk_tree_store_sort_helper (GtkTreeStore *tree_store,
       for (tmp_node = parent->children; tmp_node; tmp_node = tmp_node->next)
 	{
 	  if (tmp_node->children)
-	    gtk_tree_store_sort_helper (tree_store, tmp_node, TRUE);
+	    gtk_tree_store_sort_helper (tree_store, tmp_node, TRUE, emit_reordered);
 	}
     }
 }
@@ -2989,7 +3149,7 @@ gtk_tree_store_sort (GtkTreeStore *tree_store)
       g_return_if_fail (priv->default_sort_func != NULL);
     }
 
-  gtk_tree_store_sort_helper (tree_store, G_NODE (priv->root), TRUE);
+  gtk_tree_store_sort_helper (tree_store, G_NODE (priv->root), TRUE, TRUE);
 }
 
 static void
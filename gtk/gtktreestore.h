@@ -163,6 +163,18 @@ GDK_AVAILABLE_IN_ALL
 void          gtk_tree_store_move_after       (GtkTreeStore *tree_store,
                                                GtkTreeIter  *iter,
                                                GtkTreeIter  *position);
+GDK_AVAILABLE_IN_ALL
+void          gtk_tree_store_insert_subtree   (GtkTreeStore *tree_store,
+                                               GtkTreeIter  *iter,
+                                               GtkTreeIter  *parent,
+                                               gint          position,
+                                               GtkTreeStore *source,
+                                               GtkTreeIter  *source_iter);
+GDK_AVAILABLE_IN_ALL
+void          gtk_tree_store_move_subtree     (GtkTreeStore *tree_store,
+                                               GtkTreeIter  *iter,
+                                               GtkTreeIter  *new_parent,
+                                               gint          position);
 
 
 G_END_DECLS
@@ -418,6 +418,12 @@ struct _GtkTreeViewPrivate
   /* fixed height */
   gint fixed_height;
 
+  /* The mean height of the first rows that got validated, used
+   * for the rows that were not validated yet, so that the total
+   * height does not keep growing while validation goes on.
+   */
+  gint estimated_height;
+
   GtkTreeRBNode *rubber_band_start_node;
   GtkTreeRBTree *rubber_band_start_tree;
 
@@ -457,6 +463,12 @@ struct _GtkTreeViewPrivate
   gpointer row_separator_data;
   GDestroyNotify row_separator_destroy;
 
+  /* Row height classes */
+  GtkTreeViewRowHeightClassFunc row_height_class_func;
+  gpointer row_height_class_data;
+  GDestroyNotify row_height_class_destroy;
+  GArray *row_class_heights;
+
   /* Gestures */
   GtkGesture *multipress_gesture;
   GtkGesture *drag_gesture; /* Rubberbanding, row DnD */
@@ -1674,6 +1686,7 @@ gtk_tree_view_init (GtkTreeView *tree_view)
   priv->presize_handler_tick_cb = 0;
   priv->scroll_sync_timer = 0;
   priv->fixed_height = -1;
+  priv->estimated_height = -1;
   priv->fixed_height_mode = FALSE;
   priv->fixed_height_check = 0;
   priv->selection = _gtk_tree_selection_new_with_tree_view (tree_view);
@@ -2146,6 +2159,13 @@ gtk_tree_view_destroy (GtkWidget *widget)
       tree_view->priv->row_separator_destroy (tree_view->priv->row_separator_data);
       tree_view->priv->row_separator_data = NULL;
     }
+
+  if (tree_view->priv->row_height_class_destroy && tree_view->priv->row_height_class_data)
+    {
+      tree_view->priv->row_height_class_destroy (tree_view->priv->row_height_class_data);
+      tree_view->priv->row_height_class_data = NULL;
+    }
+  g_clear_pointer (&tree_view->priv->row_class_heights, g_array_unref);
   
   gtk_tree_view_set_model (tree_view, NULL);
 
@@ -2733,6 +2753,63 @@ row_is_separator (GtkTreeView *tree_view,
   return is_separator;
 }
 
+/* Returns the height class of the row, or -1 if it has none */
+static gint
+get_row_class (GtkTreeView *tree_view,
+               GtkTreeIter *iter,
+               gint         depth)
+{
+  if (!tree_view->priv->row_height_class_func || iter == NULL)
+    return -1;
+
+  return tree_view->priv->row_height_class_func (tree_view->priv->model,
+                                                 iter, depth,
+                                                 tree_view->priv->row_height_class_data);
+}
+
+/* Returns the height of the rows of @row_class, or -1 if no row
+ * of that class was measured yet
+ */
+static gint
+get_row_class_height (GtkTreeView *tree_view,
+                      gint         row_class)
+{
+  GArray *heights = tree_view->priv->row_class_heights;
+
+  if (row_class < 0 || heights == NULL || (guint) row_class >= heights->len)
+    return -1;
+
+  return g_array_index (heights, gint, row_class);
+}
+
+static void
+set_row_class_height (GtkTreeView *tree_view,
+                      gint         row_class,
+                      gint         height)
+{
+  GArray *heights;
+  guint i;
+
+  if (tree_view->priv->row_class_heights == NULL)
+    tree_view->priv->row_class_heights = g_array_new (FALSE, FALSE, sizeof (gint));
+
+  heights = tree_view->priv->row_class_heights;
+  for (i = heights->len; i <= (guint) row_class; i++)
+    {
+      gint unknown = -1;
+      g_array_append_val (heights, unknown);
+    }
+
+  g_array_index (heights, gint, row_class) = height;
+}
+
+static void
+reset_row_class_heights (GtkTreeView *tree_view)
+{
+  if (tree_view->priv->row_class_heights)
+    g_array_set_size (tree_view->priv->row_class_heights, 0);
+}
+
 static int
 gtk_tree_view_get_expander_size (GtkTreeView *tree_view)
 {
@@ -5552,12 +5629,30 @@ validate_row (GtkTreeView   *tree_view,
   gboolean draw_vgrid_lines, draw_hgrid_lines;
   gint expander_size;
   int separator_height;
+  gint row_class;
 
   /* double check the row needs validating */
   if (! GTK_TREE_RBNODE_FLAG_SET (node, GTK_TREE_RBNODE_INVALID) &&
       ! GTK_TREE_RBNODE_FLAG_SET (node, GTK_TREE_RBNODE_COLUMN_INVALID))
     return FALSE;
 
+  /* Rows of a height class that was measured before are not measured again */
+  row_class = get_row_class (tree_view, iter, depth);
+  height = get_row_class_height (tree_view, row_class);
+  if (height >= 0)
+    {
+      if (height != GTK_TREE_RBNODE_GET_HEIGHT (node))
+        {
+          retval = TRUE;
+          gtk_tree_rbtree_node_set_height (tree, node, height);
+        }
+      gtk_tree_rbtree_node_mark_valid (tree, node);
+      tree_view->priv->post_validation_flag = TRUE;
+
+      return retval;
+    }
+  height = 0;
+
   is_separator = row_is_separator (tree_view, iter, NULL);
 
   draw_vgrid_lines =
@@ -5654,6 +5749,9 @@ validate_row (GtkTreeView   *tree_view,
   if (draw_hgrid_lines)
     height += _TREE_VIEW_GRID_LINE_WIDTH;
 
+  if (row_class >= 0)
+    set_row_class_height (tree_view, row_class, height);
+
   if (height != GTK_TREE_RBNODE_GET_HEIGHT (node))
     {
       retval = TRUE;
@@ -6087,6 +6185,7 @@ do_validate_rows (GtkTreeView *tree_view, gboolean queue_resize)
 
   gint y = -1;
   gint prev_height = -1;
+  gint height_sum = 0;
   gboolean fixed_height = TRUE;
 
   g_assert (tree_view);
@@ -6188,6 +6287,7 @@ do_validate_rows (GtkTreeView *tree_view, gboolean queue_resize)
 	  gint height;
 
 	  height = gtk_tree_view_get_row_height (tree_view, node);
+	  height_sum += height;
 	  if (prev_height < 0)
 	    prev_height = height;
 	  else if (prev_height != height)
@@ -6200,8 +6300,17 @@ do_validate_rows (GtkTreeView *tree_view, gboolean queue_resize)
 
   if (!tree_view->priv->fixed_height_check)
    {
+     /* Give the rows that are still invalid the height the first ones
+      * had, or their mean height if they differ, until they get
+      * validated themselves.
+      */
      if (fixed_height)
-       gtk_tree_rbtree_set_fixed_height (tree_view->priv->tree, prev_height, FALSE);
+       tree_view->priv->estimated_height = prev_height;
+     else
+       tree_view->priv->estimated_height = (height_sum + i / 2) / i;
+
+     gtk_tree_rbtree_set_fixed_height (tree_view->priv->tree,
+                                       tree_view->priv->estimated_height, FALSE);
 
      tree_view->priv->fixed_height_check = 1;
    }
@@ -8010,6 +8119,7 @@ gtk_tree_view_style_updated (GtkWidget *widget)
 	}
 
       priv->fixed_height = -1;
+      reset_row_class_heights (tree_view);
       gtk_tree_rbtree_mark_invalid (priv->tree);
     }
 
@@ -8124,6 +8234,19 @@ gtk_tree_view_put (GtkTreeView       *tree_view,
 /* TreeModel Callbacks
  */
 
+/* Forgets the attribute values the columns keep for @path, or for
+ * all rows if @path is %NULL
+ */
+static void
+invalidate_cell_data (GtkTreeView *tree_view,
+                      GtkTreePath *path)
+{
+  GList *list;
+
+  for (list = tree_view->priv->columns; list; list = list->next)
+    _gtk_tree_view_column_invalidate_cell_data (list->data, path);
+}
+
 static void
 gtk_tree_view_row_changed (GtkTreeModel *model,
 			   GtkTreePath  *path,
@@ -8136,6 +8259,7 @@ gtk_tree_view_row_changed (GtkTreeModel *model,
   gboolean free_path = FALSE;
   GList *list;
   GtkTreePath *cursor_path;
+  gint class_height;
 
   g_return_if_fail (path != NULL || iter != NULL);
 
@@ -8160,6 +8284,8 @@ gtk_tree_view_row_changed (GtkTreeModel *model,
   else if (iter == NULL)
     gtk_tree_model_get_iter (model, iter, path);
 
+  invalidate_cell_data (tree_view, path);
+
   if (_gtk_tree_view_find_node (tree_view,
 				path,
 				&tree,
@@ -8172,12 +8298,27 @@ gtk_tree_view_row_changed (GtkTreeModel *model,
 
   _gtk_tree_view_accessible_changed (tree_view, tree, node);
 
+  /* The row may have changed its height class */
+  class_height = get_row_class_height (tree_view,
+                                       get_row_class (tree_view, iter,
+                                                      gtk_tree_path_get_depth (path)));
+
   if (tree_view->priv->fixed_height_mode
       && tree_view->priv->fixed_height >= 0)
     {
       gtk_tree_rbtree_node_set_height (tree, node, tree_view->priv->fixed_height);
       gtk_widget_queue_draw (GTK_WIDGET (tree_view));
     }
+  else if (class_height >= 0)
+    {
+      if (class_height != GTK_TREE_RBNODE_GET_HEIGHT (node))
+        {
+          gtk_tree_rbtree_node_set_height (tree, node, class_height);
+          gtk_widget_queue_resize (GTK_WIDGET (tree_view));
+        }
+      else
+        gtk_widget_queue_draw (GTK_WIDGET (tree_view));
+    }
   else
     {
       gtk_tree_rbtree_node_mark_invalid (tree, node);
@@ -8217,16 +8358,27 @@ gtk_tree_view_row_inserted (GtkTreeModel *model,
   gint depth;
   gint i = 0;
   gint height;
+  gboolean height_known;
   gboolean free_path = FALSE;
   gboolean node_visible = TRUE;
 
   g_return_if_fail (path != NULL || iter != NULL);
 
+  /* The paths of the following rows change */
+  invalidate_cell_data (tree_view, NULL);
+
   if (tree_view->priv->fixed_height_mode
       && tree_view->priv->fixed_height >= 0)
-    height = tree_view->priv->fixed_height;
+    {
+      height = tree_view->priv->fixed_height;
+      height_known = TRUE;
+    }
   else
-    height = 0;
+    {
+      /* Only a guess, the row still needs to be measured */
+      height = MAX (tree_view->priv->estimated_height, 0);
+      height_known = FALSE;
+    }
 
   if (path == NULL)
     {
@@ -8246,6 +8398,18 @@ gtk_tree_view_row_inserted (GtkTreeModel *model,
   depth = gtk_tree_path_get_depth (path);
   indices = gtk_tree_path_get_indices (path);
 
+  if (!height_known)
+    {
+      gint class_height;
+
+      class_height = get_row_class_height (tree_view, get_row_class (tree_view, iter, depth));
+      if (class_height >= 0)
+        {
+          height = class_height;
+          height_known = TRUE;
+        }
+    }
+
   /* First, find the parent tree */
   while (i < depth - 1)
     {
@@ -8302,7 +8466,7 @@ gtk_tree_view_row_inserted (GtkTreeModel *model,
   _gtk_tree_view_accessible_add (tree_view, tree, tmpnode);
 
  done:
-  if (height > 0)
+  if (height_known)
     {
       if (tree)
         gtk_tree_rbtree_node_mark_valid (tree, tmpnode);
@@ -8426,6 +8590,7 @@ gtk_tree_view_row_deleted (GtkTreeModel *model,
   g_return_if_fail (path != NULL);
 
   gtk_tree_row_reference_deleted (G_OBJECT (data), path);
+  invalidate_cell_data (tree_view, NULL);
 
   if (_gtk_tree_view_find_node (tree_view, path, &tree, &node))
     return;
@@ -8558,6 +8723,7 @@ gtk_tree_view_rows_reordered (GtkTreeModel *model,
 				    parent,
 				    iter,
 				    new_order);
+  invalidate_cell_data (tree_view, NULL);
 
   if (_gtk_tree_view_find_node (tree_view,
 				parent,
@@ -8713,7 +8879,9 @@ gtk_tree_view_build_tree (GtkTreeView   *tree_view,
   do
     {
       gtk_tree_model_ref_node (tree_view->priv->model, iter);
-      temp = gtk_tree_rbtree_insert_after (tree, temp, 0, FALSE);
+      temp = gtk_tree_rbtree_insert_after (tree, temp,
+                                           MAX (tree_view->priv->estimated_height, 0),
+                                           FALSE);
 
       if (tree_view->priv->fixed_height > 0)
         {
@@ -8723,6 +8891,17 @@ gtk_tree_view_build_tree (GtkTreeView   *tree_view,
 	      gtk_tree_rbtree_node_mark_valid (tree, temp);
 	    }
         }
+      else if (tree_view->priv->row_height_class_func)
+        {
+          gint class_height;
+
+          class_height = get_row_class_height (tree_view, get_row_class (tree_view, iter, depth));
+          if (class_height >= 0)
+            {
+              gtk_tree_rbtree_node_set_height (tree, temp, class_height);
+              gtk_tree_rbtree_node_mark_valid (tree, temp);
+            }
+        }
 
       if (tree_view->priv->is_list)
         continue;
@@ -10498,10 +10677,13 @@ gtk_tree_view_set_model (GtkTreeView  *tree_view,
       tree_view->priv->search_column = -1;
       tree_view->priv->fixed_height_check = 0;
       tree_view->priv->fixed_height = -1;
+      tree_view->priv->estimated_height = -1;
+      reset_row_class_heights (tree_view);
       tree_view->priv->dy = tree_view->priv->top_row_dy = 0;
     }
 
   tree_view->priv->model = model;
+  invalidate_cell_data (tree_view, NULL);
 
   if (tree_view->priv->model)
     {
@@ -14600,6 +14782,48 @@ gtk_tree_view_set_row_separator_func (GtkTreeView                 *tree_view,
   gtk_widget_queue_resize (GTK_WIDGET (tree_view));
 }
 
+/**
+ * gtk_tree_view_set_row_height_class_func:
+ * @tree_view: a #GtkTreeView
+ * @func: (allow-none): a #GtkTreeViewRowHeightClassFunc
+ * @data: (allow-none): user data to pass to @func, or %NULL
+ * @destroy: (allow-none): destroy notifier for @data, or %NULL
+ *
+ * Sets the function that sorts rows into height classes. All rows of
+ * a class are assumed to have the same height, so @tree_view measures
+ * only the first row of every class it comes across, and gives every
+ * other row of the class that height without measuring it. This
+ * makes expanding large trees fast, even with expanders, rows of
+ * different heights and columns that are not fixed width, as long as
+ * the rows fall into a few classes, for example by depth or by the
+ * type of the row.
+ *
+ * Autosized columns only take the measured rows into account when
+ * computing their width, so columns of fixed width work best with this.
+ *
+ * If @func is %NULL, all rows are measured. This is the default.
+ */
+void
+gtk_tree_view_set_row_height_class_func (GtkTreeView                   *tree_view,
+                                         GtkTreeViewRowHeightClassFunc  func,
+                                         gpointer                       data,
+                                         GDestroyNotify                 destroy)
+{
+  g_return_if_fail (GTK_IS_TREE_VIEW (tree_view));
+
+  if (tree_view->priv->row_height_class_destroy)
+    tree_view->priv->row_height_class_destroy (tree_view->priv->row_height_class_data);
+
+  tree_view->priv->row_height_class_func = func;
+  tree_view->priv->row_height_class_data = data;
+  tree_view->priv->row_height_class_destroy = destroy;
+
+  /* Have the tree recalculate heights */
+  reset_row_class_heights (tree_view);
+  gtk_tree_rbtree_mark_invalid (tree_view->priv->tree);
+  gtk_widget_queue_resize (GTK_WIDGET (tree_view));
+}
+
 /**
  * gtk_tree_view_get_grid_lines:
  * @tree_view: a #GtkTreeView
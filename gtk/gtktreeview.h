@@ -196,6 +196,25 @@ typedef gboolean (*GtkTreeViewSearchEqualFunc) (GtkTreeModel            *model,
 typedef gboolean (*GtkTreeViewRowSeparatorFunc) (GtkTreeModel      *model,
 						 GtkTreeIter       *iter,
 						 gpointer           data);
+
+/**
+ * GtkTreeViewRowHeightClassFunc:
+ * @model: the #GtkTreeModel
+ * @iter: a #GtkTreeIter pointing at a row in @model
+ * @depth: the depth of the row, 1 for toplevel rows
+ * @data: (closure): user data
+ *
+ * Function type for sorting rows into height classes, see
+ * gtk_tree_view_set_row_height_class_func(). Classes are small
+ * integers starting at 0, all rows of a class have the same height.
+ *
+ * Returns: the height class of the row, or -1 if the row has to be
+ *   measured
+ */
+typedef gint     (*GtkTreeViewRowHeightClassFunc) (GtkTreeModel      *model,
+                                                   GtkTreeIter       *iter,
+                                                   gint               depth,
+                                                   gpointer           data);
 typedef void     (*GtkTreeViewSearchPositionFunc) (GtkTreeView  *tree_view,
 						   GtkWidget    *search_dialog,
 						   gpointer      user_data);
@@ -515,6 +534,12 @@ void                        gtk_tree_view_set_row_separator_func (GtkTreeView
 								  gpointer                    data,
 								  GDestroyNotify              destroy);
 
+GDK_AVAILABLE_IN_ALL
+void     gtk_tree_view_set_row_height_class_func (GtkTreeView                   *tree_view,
+                                                  GtkTreeViewRowHeightClassFunc  func,
+                                                  gpointer                       data,
+                                                  GDestroyNotify                 destroy);
+
 GDK_AVAILABLE_IN_ALL
 GtkTreeViewGridLines        gtk_tree_view_get_grid_lines         (GtkTreeView                *tree_view);
 GDK_AVAILABLE_IN_ALL
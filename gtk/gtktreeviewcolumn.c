@@ -182,6 +182,7 @@ struct _GtkTreeViewColumnPrivate
   guint maybe_reordered     : 1;
   guint reorderable         : 1;
   guint expand              : 1;
+  guint cache_cell_data     : 1;
 };
 
 enum
@@ -206,6 +207,7 @@ enum
   PROP_SORT_ORDER,
   PROP_SORT_COLUMN_ID,
   PROP_CELL_AREA,
+  PROP_CACHE_CELL_DATA,
   LAST_PROP
 };
 
@@ -406,6 +408,21 @@ gtk_tree_view_column_class_init (GtkTreeViewColumnClass *class)
                            GTK_TYPE_CELL_AREA,
                            GTK_PARAM_READWRITE|G_PARAM_CONSTRUCT_ONLY);
 
+  /**
+   * GtkTreeViewColumn:cache-cell-data:
+   *
+   * Whether the values of the attributes of the column are kept for
+   * the rows they were pulled from the model for.
+   *
+   * See gtk_tree_view_column_set_cache_cell_data().
+   */
+  tree_column_props[PROP_CACHE_CELL_DATA] =
+      g_param_spec_boolean ("cache-cell-data",
+                            P_("Cache cell data"),
+                            P_("Whether to keep the attribute values of rows"),
+                            FALSE,
+                            GTK_PARAM_READWRITE|G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_install_properties (object_class, LAST_PROP, tree_column_props);
 }
 
@@ -594,6 +611,11 @@ gtk_tree_view_column_set_property (GObject         *object,
 				       g_value_get_boolean (value));
       break;
 
+    case PROP_CACHE_CELL_DATA:
+      gtk_tree_view_column_set_cache_cell_data (tree_column,
+                                                g_value_get_boolean (value));
+      break;
+
     case PROP_CLICKABLE:
       gtk_tree_view_column_set_clickable (tree_column,
                                           g_value_get_boolean (value));
@@ -757,6 +779,11 @@ gtk_tree_view_column_get_property (GObject         *object,
     case PROP_CELL_AREA:
       g_value_set_object (value, tree_column->priv->cell_area);
       break;
+
+    case PROP_CACHE_CELL_DATA:
+      g_value_set_boolean (value,
+                           gtk_tree_view_column_get_cache_cell_data (tree_column));
+      break;
       
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
@@ -1316,6 +1343,7 @@ _gtk_tree_view_column_set_tree_view (GtkTreeViewColumn *column,
   g_assert (priv->tree_view == NULL);
 
   priv->tree_view = GTK_WIDGET (tree_view);
+  _gtk_tree_view_column_invalidate_cell_data (column, NULL);
 
   gtk_widget_set_parent (priv->button, GTK_WIDGET (tree_view));
 
@@ -2348,6 +2376,76 @@ gtk_tree_view_column_get_expand (GtkTreeViewColumn *tree_column)
   return tree_column->priv->expand;
 }
 
+/**
+ * gtk_tree_view_column_set_cache_cell_data:
+ * @tree_column: A #GtkTreeViewColumn.
+ * @cache: %TRUE to keep the attribute values of rows
+ *
+ * Sets whether the values that are pulled from the model for the
+ * attributes of the column are kept per row. Drawing or measuring a
+ * row again then does not need to go to the model, until the tree view
+ * sees the row change.
+ *
+ * Only enable this if the attributes are all the column takes from
+ * the model. Cell data functions are still called every time, but any
+ * change to the model that is not signalled will not be picked up.
+ **/
+void
+gtk_tree_view_column_set_cache_cell_data (GtkTreeViewColumn *tree_column,
+                                          gboolean           cache)
+{
+  GtkTreeViewColumnPrivate *priv;
+
+  g_return_if_fail (GTK_IS_TREE_VIEW_COLUMN (tree_column));
+
+  priv = tree_column->priv;
+
+  cache = !!cache;
+  if (priv->cache_cell_data == cache)
+    return;
+  priv->cache_cell_data = cache;
+
+  _gtk_cell_area_set_cache_attributes (gtk_cell_layout_get_area (GTK_CELL_LAYOUT (tree_column)),
+                                       cache);
+
+  g_object_notify_by_pspec (G_OBJECT (tree_column), tree_column_props[PROP_CACHE_CELL_DATA]);
+}
+
+/**
+ * gtk_tree_view_column_get_cache_cell_data:
+ * @tree_column: A #GtkTreeViewColumn.
+ *
+ * Returns whether the attribute values of rows are kept, see
+ * gtk_tree_view_column_set_cache_cell_data().
+ *
+ * Returns: %TRUE if the attribute values of rows are kept
+ **/
+gboolean
+gtk_tree_view_column_get_cache_cell_data (GtkTreeViewColumn *tree_column)
+{
+  g_return_val_if_fail (GTK_IS_TREE_VIEW_COLUMN (tree_column), FALSE);
+
+  return tree_column->priv->cache_cell_data;
+}
+
+/*
+ * _gtk_tree_view_column_invalidate_cell_data:
+ * @tree_column: A #GtkTreeViewColumn.
+ * @path: (allow-none): the row that changed, or %NULL if rows were
+ *     added, removed or moved
+ *
+ * Forgets the attribute values kept for @path, or for all rows.
+ */
+void
+_gtk_tree_view_column_invalidate_cell_data (GtkTreeViewColumn *tree_column,
+                                            GtkTreePath       *path)
+{
+  GtkTreeViewColumnPrivate *priv = tree_column->priv;
+
+  if (priv->cache_cell_data)
+    _gtk_cell_area_invalidate_cached_attributes (priv->cell_area, path);
+}
+
 /**
  * gtk_tree_view_column_set_clickable:
  * @tree_column: A #GtkTreeViewColumn.
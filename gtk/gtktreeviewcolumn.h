@@ -196,6 +196,11 @@ void                    gtk_tree_view_column_set_expand          (GtkTreeViewCol
 GDK_AVAILABLE_IN_ALL
 gboolean                gtk_tree_view_column_get_expand          (GtkTreeViewColumn       *tree_column);
 GDK_AVAILABLE_IN_ALL
+void                    gtk_tree_view_column_set_cache_cell_data (GtkTreeViewColumn       *tree_column,
+                                                                  gboolean                 cache);
+GDK_AVAILABLE_IN_ALL
+gboolean                gtk_tree_view_column_get_cache_cell_data (GtkTreeViewColumn       *tree_column);
+GDK_AVAILABLE_IN_ALL
 void                    gtk_tree_view_column_set_clickable       (GtkTreeViewColumn       *tree_column,
 								  gboolean                 clickable);
 GDK_AVAILABLE_IN_ALL
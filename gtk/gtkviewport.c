@@ -26,7 +26,7 @@
 
 #include "gtkviewport.h"
 
-#include "gtkadjustment.h"
+#include "gtkadjustmentprivate.h"
 #include "gtkintl.h"
 #include "gtkmarshalers.h"
 #include "gtkprivate.h"
@@ -495,8 +495,8 @@ gtk_viewport_size_allocate (GtkWidget *widget,
   GtkAdjustment *vadjustment = priv->vadjustment;
   GtkWidget *child;
 
-  g_object_freeze_notify (G_OBJECT (hadjustment));
-  g_object_freeze_notify (G_OBJECT (vadjustment));
+  gtk_adjustment_begin_batch (hadjustment);
+  gtk_adjustment_begin_batch (vadjustment);
 
   viewport_set_adjustment_values (viewport, GTK_ORIENTATION_HORIZONTAL);
   viewport_set_adjustment_values (viewport, GTK_ORIENTATION_VERTICAL);
@@ -514,8 +514,8 @@ gtk_viewport_size_allocate (GtkWidget *widget,
       gtk_widget_size_allocate (child, &child_allocation, -1);
     }
 
-  g_object_thaw_notify (G_OBJECT (hadjustment));
-  g_object_thaw_notify (G_OBJECT (vadjustment));
+  gtk_adjustment_end_batch (hadjustment);
+  gtk_adjustment_end_batch (vadjustment);
 }
 
 static void
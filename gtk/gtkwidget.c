@@ -33,6 +33,7 @@
 #include "gtkbindings.h"
 #include "gtkbuildable.h"
 #include "gtkbuilderprivate.h"
+#include "gtkbuilderprecompileprivate.h"
 #include "gtkcontainerprivate.h"
 #include "gtkcssboxesprivate.h"
 #include "gtkcssfiltervalueprivate.h"
@@ -43,6 +44,7 @@
 #include "gtkcssstylepropertyprivate.h"
 #include "gtkcsswidgetnodeprivate.h"
 #include "gtkdebug.h"
+#include "gtkframephasetimingsprivate.h"
 #include "gtkgesturedrag.h"
 #include "gtkgestureprivate.h"
 #include "gtkgesturesingle.h"
@@ -60,6 +62,7 @@
 #include "gtksettingsprivate.h"
 #include "gtksizegroup-private.h"
 #include "gtksnapshotprivate.h"
+#include "gtkstartuptraceprivate.h"
 #include "gtkstylecontextprivate.h"
 #include "gtktooltipprivate.h"
 #include "gsktransformprivate.h"
@@ -454,6 +457,8 @@ typedef struct {
 
 typedef struct {
   GBytes               *data;
+  gboolean              precompiled;
+  GtkBuilderTemplateCache *cache;
   GSList               *children;
   GSList               *callbacks;
   GtkBuilderConnectFunc connect_func;
@@ -467,6 +472,13 @@ struct _GtkWidgetClassPrivate
   GType accessible_type;
   AtkRole accessible_role;
   const char *css_name;
+  guint size_request_lookups;
+  guint size_request_hits;
+  guint resizes_queued;
+  guint resizes_coalesced;
+  guint notifies;
+  guint notifies_deferred;
+  GtkWidgetChildResizeFunc child_resize_func;
 };
 
 enum {
@@ -576,6 +588,9 @@ static void	gtk_widget_constructed           (GObject	    *object);
 static void	gtk_widget_dispose		 (GObject	    *object);
 static void	gtk_widget_real_destroy		 (GtkWidget	    *object);
 static void	gtk_widget_finalize		 (GObject	    *object);
+static void	gtk_widget_dispatch_properties_changed (GObject     *object,
+                                                        guint        n_pspecs,
+                                                        GParamSpec **pspecs);
 static void	gtk_widget_real_show		 (GtkWidget	    *widget);
 static void	gtk_widget_real_hide		 (GtkWidget	    *widget);
 static void	gtk_widget_real_map		 (GtkWidget	    *widget);
@@ -681,6 +696,8 @@ static void gtk_widget_update_input_shape (GtkWidget *widget);
 
 static gboolean gtk_widget_class_get_visible_by_default (GtkWidgetClass *widget_class);
 
+static void gtk_widget_flush_deferred_notify (GtkWidget *widget);
+
 
 /* --- variables --- */
 static gint             GtkWidget_private_offset = 0;
@@ -702,6 +719,11 @@ static GQuark           quark_widget_path = 0;
 static GQuark           quark_action_muxer = 0;
 static GQuark           quark_font_options = 0;
 static GQuark           quark_font_map = 0;
+static GQuark           quark_deferred_notify = 0;
+
+/* See gtk_widget_push_layout_deadline() */
+static gint64           layout_deadline = 0;
+static gboolean         layout_deadline_hit = FALSE;
 
 GParamSpecPool         *_gtk_widget_child_property_pool = NULL;
 GObjectNotifyContext   *_gtk_widget_child_property_notify_context = NULL;
@@ -772,6 +794,13 @@ gtk_widget_base_class_init (gpointer g_class)
 
   klass->priv = G_TYPE_CLASS_GET_PRIVATE (g_class, GTK_TYPE_WIDGET, GtkWidgetClassPrivate);
   klass->priv->template = NULL;
+  /* don't inherit the parent's counts */
+  klass->priv->size_request_lookups = 0;
+  klass->priv->size_request_hits = 0;
+  klass->priv->resizes_queued = 0;
+  klass->priv->resizes_coalesced = 0;
+  klass->priv->notifies = 0;
+  klass->priv->notifies_deferred = 0;
 }
 
 static void
@@ -808,47 +837,212 @@ gtk_widget_real_contains (GtkWidget *widget,
                                        &(graphene_point_t){x, y});
 }
 
+static GtkWidget *
+gtk_widget_pick_child (GtkWidget *child,
+                       gdouble    x,
+                       gdouble    y)
+{
+  GtkWidgetPrivate *priv = gtk_widget_get_instance_private (child);
+  GskTransform *transform;
+  graphene_matrix_t inv;
+  graphene_point3d_t p0, p1, res;
+
+  gtk_pick_stats.children_tested++;
+
+  if (priv->transform)
+    {
+      transform = gsk_transform_invert (gsk_transform_ref (priv->transform));
+      if (transform == NULL)
+        return NULL;
+    }
+  else
+    {
+      transform = NULL;
+    }
+  gsk_transform_to_matrix (transform, &inv);
+  gsk_transform_unref (transform);
+  graphene_point3d_init (&p0, x, y, 0);
+  graphene_point3d_init (&p1, x, y, 1);
+  graphene_matrix_transform_point3d (&inv, &p0, &p0);
+  graphene_matrix_transform_point3d (&inv, &p1, &p1);
+  if (fabs (p0.z - p1.z) < 1.f / 4096)
+    return NULL;
+
+  graphene_point3d_interpolate (&p0, &p1, p0.z / (p0.z - p1.z), &res);
+
+  return gtk_widget_pick (child, res.x, res.y);
+}
+
+static gboolean
+gtk_widget_has_many_children (GtkWidget *widget)
+{
+  return widget->priv->n_children >= GTK_PICK_INDEX_MIN_CHILDREN;
+}
+
+static void
+gtk_widget_invalidate_pick_index (GtkWidget *widget)
+{
+  if (widget)
+    g_clear_pointer (&widget->priv->pick_index, gtk_pick_index_free);
+}
+
+static GPtrArray *
+gtk_widget_ensure_child_index (GtkWidget *widget)
+{
+  GtkWidgetPrivate *priv = widget->priv;
+  GtkWidget *child;
+
+  if (priv->child_index)
+    return priv->child_index;
+
+  priv->child_index = g_ptr_array_sized_new (priv->n_children);
+  for (child = priv->first_child;
+       child != NULL;
+       child = child->priv->next_sibling)
+    {
+      child->priv->child_position = priv->child_index->len;
+      g_ptr_array_add (priv->child_index, child);
+    }
+
+  return priv->child_index;
+}
+
+static void
+gtk_widget_renumber_children (GPtrArray *index,
+                              guint      from)
+{
+  guint i;
+
+  for (i = from; i < index->len; i++)
+    {
+      GtkWidget *child = g_ptr_array_index (index, i);
+
+      child->priv->child_position = i;
+    }
+}
+
+/* Must be called while @child still has its old position,
+ * appending and removing the last child is O(1) */
+static void
+gtk_widget_child_index_remove (GtkWidget *parent,
+                               GtkWidget *child)
+{
+  GPtrArray *index = parent->priv->child_index;
+  guint position = child->priv->child_position;
+
+  if (index == NULL)
+    return;
+
+  g_ptr_array_remove_index (index, position);
+  gtk_widget_renumber_children (index, position);
+}
+
+static void
+gtk_widget_child_index_insert (GtkWidget *parent,
+                               GtkWidget *child,
+                               GtkWidget *previous_sibling)
+{
+  GPtrArray *index = parent->priv->child_index;
+  guint position;
+
+  if (index == NULL)
+    return;
+
+  position = previous_sibling ? previous_sibling->priv->child_position + 1 : 0;
+  g_ptr_array_insert (index, position, child);
+  gtk_widget_renumber_children (index, position);
+}
+
+/*
+ * gtk_widget_get_n_children:
+ * @widget: a #GtkWidget
+ *
+ * Returns: the number of children of @widget
+ */
+guint
+gtk_widget_get_n_children (GtkWidget *widget)
+{
+  return widget->priv->n_children;
+}
+
+/*
+ * gtk_widget_get_child_position:
+ * @widget: a #GtkWidget with a parent
+ *
+ * Gets the position of @widget among its siblings. The first call
+ * after the children of the parent were reordered is O(n), the
+ * following ones are O(1).
+ *
+ * Returns: the position of @widget in its parent
+ */
+guint
+gtk_widget_get_child_position (GtkWidget *widget)
+{
+  g_return_val_if_fail (widget->priv->parent != NULL, 0);
+
+  gtk_widget_ensure_child_index (widget->priv->parent);
+
+  return widget->priv->child_position;
+}
+
+/*
+ * gtk_widget_get_nth_child:
+ * @widget: a #GtkWidget
+ * @position: the position of the child
+ *
+ * Gets the child of @widget at @position, see
+ * gtk_widget_get_child_position().
+ *
+ * Returns: (nullable): the child at @position
+ */
+GtkWidget *
+gtk_widget_get_nth_child (GtkWidget *widget,
+                          guint      position)
+{
+  GPtrArray *index;
+
+  if (position >= widget->priv->n_children)
+    return NULL;
+
+  index = gtk_widget_ensure_child_index (widget);
+
+  return g_ptr_array_index (index, position);
+}
+
 static GtkWidget *
 gtk_widget_real_pick (GtkWidget *widget,
                       gdouble    x,
                       gdouble    y)
 {
-  GtkWidget *child;
+  GtkWidgetPrivate *priv = gtk_widget_get_instance_private (widget);
+  GtkWidget *child, *picked;
+
+  if (priv->pick_index == NULL && gtk_widget_has_many_children (widget))
+    priv->pick_index = gtk_pick_index_new (widget);
 
-  for (child = _gtk_widget_get_last_child (widget);
-       child;
-       child = _gtk_widget_get_prev_sibling (child))
+  if (priv->pick_index)
     {
-      GtkWidgetPrivate *priv = gtk_widget_get_instance_private (child);
-      GskTransform *transform;
-      graphene_matrix_t inv;
-      GtkWidget *picked;
-      graphene_point3d_t p0, p1, res;
+      GtkWidget * const *children;
+      guint i;
 
-      if (priv->transform)
+      children = gtk_pick_index_lookup (priv->pick_index, x, y, &i);
+      while (i-- > 0)
         {
-          transform = gsk_transform_invert (gsk_transform_ref (priv->transform));
-          if (transform == NULL)
-            continue;
+          picked = gtk_widget_pick_child (children[i], x, y);
+          if (picked)
+            return picked;
         }
-      else
+    }
+  else
+    {
+      for (child = _gtk_widget_get_last_child (widget);
+           child;
+           child = _gtk_widget_get_prev_sibling (child))
         {
-          transform = NULL;
+          picked = gtk_widget_pick_child (child, x, y);
+          if (picked)
+            return picked;
         }
-      gsk_transform_to_matrix (transform, &inv);
-      gsk_transform_unref (transform);
-      graphene_point3d_init (&p0, x, y, 0);
-      graphene_point3d_init (&p1, x, y, 1);
-      graphene_matrix_transform_point3d (&inv, &p0, &p0);
-      graphene_matrix_transform_point3d (&inv, &p1, &p1);
-      if (fabs (p0.z - p1.z) < 1.f / 4096)
-        continue;
-
-      graphene_point3d_interpolate (&p0, &p1, p0.z / (p0.z - p1.z), &res);
-
-      picked = gtk_widget_pick (child, res.x, res.y);
-      if (picked)
-        return picked;
     }
 
   if (!gtk_widget_contains (widget, x, y))
@@ -915,6 +1109,7 @@ gtk_widget_class_init (GtkWidgetClass *klass)
   quark_action_muxer = g_quark_from_static_string ("gtk-widget-action-muxer");
   quark_font_options = g_quark_from_static_string ("gtk-widget-font-options");
   quark_font_map = g_quark_from_static_string ("gtk-widget-font-map");
+  quark_deferred_notify = g_quark_from_static_string ("gtk-widget-deferred-notify");
 
   _gtk_widget_child_property_pool = g_param_spec_pool_new (TRUE);
   cpn_context.quark_notify_queue = g_quark_from_static_string ("GtkWidget-child-property-notify-queue");
@@ -924,6 +1119,7 @@ gtk_widget_class_init (GtkWidgetClass *klass)
   gobject_class->constructed = gtk_widget_constructed;
   gobject_class->dispose = gtk_widget_dispose;
   gobject_class->finalize = gtk_widget_finalize;
+  gobject_class->dispatch_properties_changed = gtk_widget_dispatch_properties_changed;
   gobject_class->set_property = gtk_widget_set_property;
   gobject_class->get_property = gtk_widget_get_property;
 
@@ -3087,7 +3283,7 @@ gtk_widget_unparent (GtkWidget *widget)
   GtkWidgetPrivate *priv = gtk_widget_get_instance_private (widget);
   GObjectNotifyQueue *nqueue;
   GtkWidget *old_parent;
-  GtkWidget *old_prev_sibling;
+  guint old_position = 0;
   GtkWidget *toplevel;
 
   g_return_if_fail (GTK_IS_WIDGET (widget));
@@ -3138,6 +3334,11 @@ gtk_widget_unparent (GtkWidget *widget)
   old_parent = priv->parent;
   if (old_parent)
     {
+      if (old_parent->priv->children_observer)
+        old_position = gtk_widget_get_child_position (widget);
+      gtk_widget_child_index_remove (old_parent, widget);
+      old_parent->priv->n_children--;
+
       if (old_parent->priv->first_child == widget)
         old_parent->priv->first_child = priv->next_sibling;
 
@@ -3149,11 +3350,16 @@ gtk_widget_unparent (GtkWidget *widget)
       if (priv->next_sibling)
         priv->next_sibling->priv->prev_sibling = priv->prev_sibling;
     }
-  old_prev_sibling = priv->prev_sibling;
   priv->parent = NULL;
   priv->prev_sibling = NULL;
   priv->next_sibling = NULL;
 
+  gtk_widget_invalidate_pick_index (old_parent);
+  /* The old parent may have become unbounded for its parent's index */
+  if (old_parent)
+    gtk_widget_invalidate_pick_index (old_parent->priv->parent);
+  gtk_widget_invalidate_focus_chain (old_parent);
+
   /* parent may no longer expand if the removed
    * child was expand=TRUE and could therefore
    * be forcing it to.
@@ -3175,7 +3381,7 @@ gtk_widget_unparent (GtkWidget *widget)
   _gtk_widget_update_parent_muxer (widget);
 
   if (old_parent->priv->children_observer)
-    gtk_list_list_model_item_removed (old_parent->priv->children_observer, old_prev_sibling);
+    gtk_list_list_model_item_removed_at (old_parent->priv->children_observer, old_position);
 
   /* Now that the parent pointer is nullified and the unroot vfunc already
    * called, go ahead and unset the parent window, if we are unparenting
@@ -3465,6 +3671,9 @@ gtk_widget_unmap (GtkWidget *widget)
 
       g_signal_emit (widget, widget_signals[UNMAP], 0);
 
+      /* An unmapped toplevel does not get frames */
+      gtk_widget_flush_deferred_notify (widget);
+
       update_cursor_on_state_change (widget);
 
       gtk_widget_pop_verify_invariants (widget);
@@ -3717,6 +3926,8 @@ gtk_widget_disconnect_frame_clock (GtkWidget *widget)
 
   gtk_css_node_invalidate_frame_clock (priv->cssnode, FALSE);
 
+  gtk_widget_flush_deferred_notify (widget);
+
   if (priv->clock_tick_id)
     {
       GdkFrameClock *frame_clock;
@@ -3860,6 +4071,15 @@ gtk_widget_get_surface_allocation (GtkWidget     *widget,
     }
 }
 
+static void
+gtk_widget_clear_background_node (GtkWidget *widget)
+{
+  GtkWidgetPrivate *priv = gtk_widget_get_instance_private (widget);
+
+  g_clear_pointer (&priv->background_node, gsk_render_node_unref);
+  g_clear_object (&priv->background_style);
+}
+
 static void
 gtk_widget_update_paintables (GtkWidget *widget)
 {
@@ -3903,6 +4123,11 @@ gtk_widget_queue_draw (GtkWidget *widget)
 {
   g_return_if_fail (GTK_IS_WIDGET (widget));
 
+  /* The widget itself may draw a different background, like a CSS
+   * image that changed. Its parents only need to redraw because of
+   * it, so they keep theirs. */
+  gtk_widget_clear_background_node (widget);
+
   /* Just return if the widget isn't mapped */
   if (!_gtk_widget_get_mapped (widget))
     return;
@@ -3916,6 +4141,7 @@ gtk_widget_queue_draw (GtkWidget *widget)
 
       priv->draw_needed = TRUE;
       g_clear_pointer (&priv->render_node, gsk_render_node_unref);
+      g_clear_pointer (&priv->transform_node, gsk_render_node_unref);
       if (_gtk_widget_get_has_surface (widget) &&
           _gtk_widget_get_realized (widget))
         gdk_surface_queue_expose (gtk_widget_get_surface (widget));
@@ -3957,39 +4183,193 @@ gtk_widget_get_resize_needed (GtkWidget *widget)
 }
 
 /*
- * gtk_widget_queue_resize_internal:
+ * gtk_widget_mark_resize_needed:
  * @widget: a #GtkWidget
- * 
- * Queue a resize on a widget, and on all other widgets grouped with this widget.
+ *
+ * Marks @widget, the widgets grouped with it and its ancestors
+ * as needing a resize.
+ *
+ * The resize_needed flags are the set of pending resizes, so the
+ * walk stops at the first widget that is already marked: queueing
+ * resizes on many widgets in one frame only marks their shared
+ * ancestors once.
+ *
+ * Returns: %TRUE if the walk ended at a widget that already
+ *   needed a resize
  */
-static void
-gtk_widget_queue_resize_internal (GtkWidget *widget)
+static gboolean
+gtk_widget_mark_resize_needed (GtkWidget *widget)
 {
-  GtkWidgetPrivate *priv = gtk_widget_get_instance_private (widget);
+  GtkWidgetPrivate *priv;
+  GtkWidget *parent;
   GSList *groups, *l, *widgets;
 
-  if (gtk_widget_get_resize_needed (widget))
+  do
+    {
+      priv = gtk_widget_get_instance_private (widget);
+
+      if (priv->resize_needed)
+        return TRUE;
+
+      priv->resize_needed = TRUE;
+      gtk_widget_set_alloc_needed (widget);
+
+      groups = _gtk_widget_get_sizegroups (widget);
+
+      for (l = groups; l; l = l->next)
+        {
+          for (widgets = gtk_size_group_get_widgets (l->data); widgets; widgets = widgets->next)
+            {
+              gtk_widget_mark_resize_needed (widgets->data);
+            }
+        }
+
+      if (!_gtk_widget_get_visible (widget))
+        return FALSE;
+
+      parent = _gtk_widget_get_parent (widget);
+      if (parent)
+        {
+          GtkWidgetClass *parent_class = GTK_WIDGET_GET_CLASS (parent);
+
+          if (parent_class->priv->child_resize_func)
+            parent_class->priv->child_resize_func (parent, widget);
+        }
+
+      widget = parent;
+    }
+  while (widget != NULL);
+
+  return FALSE;
+}
+
+static void
+gtk_widget_dispatch_properties_changed (GObject     *object,
+                                        guint        n_pspecs,
+                                        GParamSpec **pspecs)
+{
+  GTK_WIDGET_GET_CLASS (object)->priv->notifies += n_pspecs;
+
+  G_OBJECT_CLASS (gtk_widget_parent_class)->dispatch_properties_changed (object, n_pspecs, pspecs);
+}
+
+static void
+thaw_deferred_notify (gpointer data)
+{
+  GtkWidget *widget = data;
+
+  widget->priv->notify_deferred = FALSE;
+  g_object_thaw_notify (G_OBJECT (widget));
+  g_object_unref (widget);
+}
+
+static void
+free_deferred_notify (gpointer data)
+{
+  GPtrArray *widgets = data;
+
+  g_ptr_array_foreach (widgets, (GFunc) thaw_deferred_notify, NULL);
+  g_ptr_array_free (widgets, TRUE);
+}
+
+static void
+flush_deferred_notify (GdkFrameClock *clock,
+                       GPtrArray     *widgets)
+{
+  gpointer *pending;
+  guint i, n_pending;
+
+  /* Handlers may defer more notifications, those go to the next frame */
+  n_pending = widgets->len;
+  pending = g_memdup (widgets->pdata, n_pending * sizeof (gpointer));
+  g_ptr_array_set_size (widgets, 0);
+
+  for (i = 0; i < n_pending; i++)
+    thaw_deferred_notify (pending[i]);
+
+  g_free (pending);
+}
+
+/* Emits the notifications held back by gtk_widget_defer_notify() now,
+ * for when @widget is about to lose its frame clock, or the clock
+ * stops ticking.
+ */
+static void
+gtk_widget_flush_deferred_notify (GtkWidget *widget)
+{
+  GdkFrameClock *clock;
+  GPtrArray *widgets;
+
+  if (!widget->priv->notify_deferred)
     return;
 
-  priv->resize_needed = TRUE;
-  gtk_widget_set_alloc_needed (widget);
+  clock = gtk_widget_get_frame_clock (widget);
+  widgets = clock ? g_object_get_qdata (G_OBJECT (clock), quark_deferred_notify) : NULL;
 
-  groups = _gtk_widget_get_sizegroups (widget);
+  if (widgets && g_ptr_array_remove (widgets, widget))
+    thaw_deferred_notify (widget);
+}
 
-  for (l = groups; l; l = l->next)
-  {
-    for (widgets = gtk_size_group_get_widgets (l->data); widgets; widgets = widgets->next)
-      {
-        gtk_widget_queue_resize_internal (widgets->data);
-      }
-  }
+/*
+ * gtk_widget_defer_notify:
+ * @widget: a #GtkWidget
+ *
+ * Holds back property notifications of @widget until the update phase
+ * of the next frame is done, so that setting the same properties many
+ * times per frame only emits ::notify once for each of them. Useful
+ * for code that calls setters like gtk_label_set_text() a lot.
+ *
+ * Unmapped widgets notify right away. The notifications are also
+ * emitted when @widget gets unmapped or unrealized before the frame.
+ */
+void
+gtk_widget_defer_notify (GtkWidget *widget)
+{
+  GdkFrameClock *clock;
+  GPtrArray *widgets;
 
-  if (_gtk_widget_get_visible (widget))
+  if (widget->priv->notify_deferred || !_gtk_widget_get_mapped (widget))
+    return;
+
+  clock = gtk_widget_get_frame_clock (widget);
+  if (clock == NULL)
+    return;
+
+  widgets = g_object_get_qdata (G_OBJECT (clock), quark_deferred_notify);
+  if (widgets == NULL)
     {
-      GtkWidget *parent = _gtk_widget_get_parent (widget);
-      if (parent)
-        gtk_widget_queue_resize_internal (parent);
+      widgets = g_ptr_array_new ();
+      g_object_set_qdata_full (G_OBJECT (clock), quark_deferred_notify,
+                               widgets, free_deferred_notify);
+      /* Run after the tick callbacks, so the notifications are out
+       * before layout.
+       */
+      g_signal_connect_after (clock, "update",
+                              G_CALLBACK (flush_deferred_notify), widgets);
     }
+
+  GTK_WIDGET_GET_CLASS (widget)->priv->notifies_deferred++;
+  widget->priv->notify_deferred = TRUE;
+  g_object_freeze_notify (G_OBJECT (g_object_ref (widget)));
+  g_ptr_array_add (widgets, widget);
+
+  gdk_frame_clock_request_phase (clock, GDK_FRAME_CLOCK_PHASE_UPDATE);
+}
+
+/*
+ * gtk_widget_queue_resize_internal:
+ * @widget: a #GtkWidget
+ * 
+ * Queue a resize on a widget, and on all other widgets grouped with this widget.
+ */
+static void
+gtk_widget_queue_resize_internal (GtkWidget *widget)
+{
+  GtkWidgetClassPrivate *class_priv = GTK_WIDGET_GET_CLASS (widget)->priv;
+
+  class_priv->resizes_queued++;
+  if (gtk_widget_mark_resize_needed (widget))
+    class_priv->resizes_coalesced++;
 }
 
 /**
@@ -4196,13 +4576,18 @@ gtk_widget_allocate (GtkWidget    *widget,
   GtkCssStyle *style;
   GtkBorder margin, border, padding;
   GskTransform *css_transform;
+  GtkFramePhaseTimings *timings;
+  gint64 phase_start, phase_nested;
 #ifdef G_ENABLE_DEBUG
   GdkDisplay *display;
+  GskTransform *skipped_transform = NULL;
+  gboolean verify_skip = FALSE;
 #endif
 
   g_return_if_fail (GTK_IS_WIDGET (widget));
   g_return_if_fail (baseline >= -1);
 
+  timings = gtk_frame_phase_begin (GTK_FRAME_PHASE_ALLOCATE, &phase_start, &phase_nested);
   gtk_widget_push_verify_invariants (widget);
 
   if (!priv->visible && !_gtk_widget_is_toplevel (widget))
@@ -4233,6 +4618,26 @@ gtk_widget_allocate (GtkWidget    *widget,
                   priv->allocated_height != height);
   transform_changed = !gsk_transform_equal (priv->allocated_transform, transform);
 
+  /* Nothing about this widget or its children changed, so the previous
+   * allocation is still valid and there is no need to look at the
+   * subtree at all. Widgets with a surface still need to move it.
+   */
+  if (!alloc_needed && !priv->alloc_needed_on_child &&
+      !size_changed && !baseline_changed && !transform_changed &&
+      !_gtk_widget_get_has_surface (widget))
+    {
+#ifdef G_ENABLE_DEBUG
+      if (GTK_DISPLAY_DEBUG_CHECK (display, GEOMETRY))
+        {
+          /* Do the work anyway and check that we'd end up where we are */
+          verify_skip = TRUE;
+          skipped_transform = gsk_transform_ref (priv->transform);
+        }
+      else
+#endif
+        goto out;
+    }
+
   /* order is important, sometimes priv->allocated_transform == transform */
   gsk_transform_ref (transform);
   gsk_transform_unref (priv->allocated_transform);
@@ -4341,6 +4746,21 @@ gtk_widget_allocate (GtkWidget    *widget,
   if (adjusted.x || adjusted.y)
     transform = gsk_transform_translate (transform, &GRAPHENE_POINT_INIT (adjusted.x, adjusted.y));
 
+#ifdef G_ENABLE_DEBUG
+  if (verify_skip)
+    {
+      if (adjusted.width != priv->width ||
+          adjusted.height != priv->height ||
+          baseline != priv->baseline ||
+          !gsk_transform_equal (transform, skipped_transform))
+        g_warning ("Skipping the allocation of %s %p would have left it with a stale "
+                   "allocation. Did it forget to call gtk_widget_queue_resize()?",
+                   gtk_widget_get_name (widget), widget);
+
+      gsk_transform_unref (skipped_transform);
+    }
+#endif
+
   priv->transform = transform;
 
   if (!alloc_needed && !size_changed && !baseline_changed)
@@ -4391,6 +4811,10 @@ gtk_widget_allocate (GtkWidget    *widget,
   gtk_widget_update_paintables (widget);
 
 skip_allocate:
+  gtk_widget_invalidate_pick_index (priv->parent);
+  if (size_changed || transform_changed)
+    gtk_widget_invalidate_focus_chain (priv->parent);
+
   if (size_changed || baseline_changed)
     gtk_widget_queue_draw (widget);
   else if (transform_changed && priv->parent)
@@ -4401,6 +4825,7 @@ out:
     gtk_widget_ensure_allocate (widget);
 
   gtk_widget_pop_verify_invariants (widget);
+  gtk_frame_phase_end (timings, GTK_FRAME_PHASE_ALLOCATE, widget, phase_start, phase_nested);
 }
 
 /**
@@ -5080,52 +5505,96 @@ _gtk_widget_set_captured_event_handler (GtkWidget               *widget,
   g_object_set_data (G_OBJECT (widget), I_("captured-event-handler"), callback);
 }
 
+static void
+gtk_widget_invalidate_phase_controllers (GtkWidget *widget)
+{
+  GtkWidgetPrivate *priv = gtk_widget_get_instance_private (widget);
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (priv->phase_controllers); i++)
+    g_clear_pointer (&priv->phase_controllers[i], g_ptr_array_unref);
+}
+
+static GPtrArray *
+gtk_widget_get_phase_controllers (GtkWidget           *widget,
+                                  GtkPropagationPhase  phase)
+{
+  GtkWidgetPrivate *priv = gtk_widget_get_instance_private (widget);
+  GList *l;
+
+  if (priv->phase_controllers[phase] == NULL)
+    {
+      GPtrArray *controllers;
+
+      controllers = g_ptr_array_new_with_free_func (g_object_unref);
+      for (l = priv->event_controllers; l; l = l->next)
+        {
+          GtkEventController *controller = l->data;
+
+          if (controller != NULL &&
+              gtk_event_controller_get_propagation_phase (controller) == phase)
+            g_ptr_array_add (controllers, g_object_ref (controller));
+        }
+
+      priv->phase_controllers[phase] = controllers;
+    }
+
+  return priv->phase_controllers[phase];
+}
+
+/*
+ * gtk_widget_controller_phase_changed:
+ * @widget: a #GtkWidget
+ *
+ * Called by controllers of @widget when their propagation phase
+ * changes, so that they are dispatched in the new phase.
+ */
+void
+gtk_widget_controller_phase_changed (GtkWidget *widget)
+{
+  gtk_widget_invalidate_phase_controllers (widget);
+}
+
 gboolean
 gtk_widget_run_controllers (GtkWidget           *widget,
 			    const GdkEvent      *event,
 			    GtkPropagationPhase  phase)
 {
-  GtkWidgetPrivate *priv = gtk_widget_get_instance_private (widget);
   GtkEventController *controller;
   gboolean handled = FALSE;
-  GList *l;
+  GPtrArray *controllers;
+  guint i;
+
+  if (phase == GTK_PHASE_NONE)
+    return FALSE;
 
   g_object_ref (widget);
 
-  l = priv->event_controllers;
-  while (l != NULL)
-    {
-      GList *next = l->next;
+  /* Controllers removed while dispatching stay alive until we are done */
+  controllers = g_ptr_array_ref (gtk_widget_get_phase_controllers (widget, phase));
 
+  for (i = 0; i < controllers->len; i++)
+    {
       if (!WIDGET_REALIZED_FOR_EVENT (widget, event))
         break;
 
-      controller = l->data;
+      controller = g_ptr_array_index (controllers, i);
 
-      if (controller == NULL)
-        {
-          priv->event_controllers = g_list_delete_link (priv->event_controllers, l);
-        }
-      else
-        {
-          GtkPropagationPhase controller_phase;
-
-          controller_phase = gtk_event_controller_get_propagation_phase (controller);
+      if (gtk_event_controller_get_widget (controller) != widget ||
+          gtk_event_controller_get_propagation_phase (controller) != phase)
+        continue;
 
-          if (controller_phase == phase)
-            handled |= gtk_event_controller_handle_event (controller, event);
+      handled |= gtk_event_controller_handle_event (controller, event);
 
-          /* Non-gesture controllers are basically unique entities not meant
-           * to collaborate with anything else. Break early if any such event
-           * controller handled the event.
-           */
-          if (handled && !GTK_IS_GESTURE (controller))
-            break;
-        }
-
-      l = next;
+      /* Non-gesture controllers are basically unique entities not meant
+       * to collaborate with anything else. Break early if any such event
+       * controller handled the event.
+       */
+      if (handled && !GTK_IS_GESTURE (controller))
+        break;
     }
 
+  g_ptr_array_unref (controllers);
   g_object_unref (widget);
 
   return handled;
@@ -5534,6 +6003,12 @@ gtk_widget_real_focus (GtkWidget         *widget,
       /* No children, no possibility to focus anything */
       return FALSE;
     }
+  else if (direction == GTK_DIR_TAB_FORWARD ||
+           direction == GTK_DIR_TAB_BACKWARD)
+    {
+      /* The tab order only depends on the children, so it is cached */
+      return gtk_widget_focus_move_tab (widget, direction);
+    }
   else
     {
       GPtrArray *focus_order = g_ptr_array_new ();
@@ -6602,6 +7077,17 @@ gtk_widget_reposition_after (GtkWidget *widget,
         parent->priv->last_child = widget;
     }
 
+  if (prev_parent == NULL)
+    parent->priv->n_children++;
+  else
+    gtk_widget_child_index_remove (parent, widget);
+  gtk_widget_child_index_insert (parent, widget, previous_sibling);
+
+  gtk_widget_invalidate_pick_index (parent);
+  /* The parent may have become unbounded for its parent's index */
+  gtk_widget_invalidate_pick_index (parent->priv->parent);
+  gtk_widget_invalidate_focus_chain (parent);
+
   parent_flags = _gtk_widget_get_state_flags (parent);
 
   /* Merge both old state and current parent state,
@@ -6628,7 +7114,8 @@ gtk_widget_reposition_after (GtkWidget *widget,
       if (prev_previous)
         g_warning ("oops");
       else
-        gtk_list_list_model_item_added (parent->priv->children_observer, widget);
+        gtk_list_list_model_item_added_at (parent->priv->children_observer,
+                                           gtk_widget_get_child_position (widget));
     }
 
   if (parent->priv->root && priv->root == NULL)
@@ -7159,6 +7646,49 @@ gtk_widget_update_pango_context (GtkWidget *widget)
     update_pango_context (widget, context);
 }
 
+static void
+update_font_options_recurse (GtkWidget *widget,
+                             gpointer   data)
+{
+  gboolean metrics_changed = GPOINTER_TO_INT (data);
+
+  if (gtk_widget_peek_pango_context (widget))
+    {
+      gtk_widget_update_pango_context (widget);
+
+      if (metrics_changed)
+        gtk_widget_queue_resize (widget);
+      else
+        gtk_widget_queue_draw (widget);
+    }
+
+  gtk_widget_forall (widget, update_font_options_recurse, data);
+}
+
+/*
+ * gtk_widget_update_font_options:
+ * @widget: a #GtkWidget
+ * @metrics_changed: whether the change can affect glyph metrics
+ *
+ * Applies changed #GtkSettings font options to the Pango contexts of
+ * @widget and its descendants. The font options are not part of the
+ * style, so this avoids recomputing the style of every widget. Widgets
+ * without a Pango context are not touched, and unless the metrics are
+ * affected, the others are only redrawn.
+ */
+void
+gtk_widget_update_font_options (GtkWidget *widget,
+                                gboolean   metrics_changed)
+{
+  GtkWidgetPrivate *priv = gtk_widget_get_instance_private (widget);
+  GList *l;
+
+  update_font_options_recurse (widget, GINT_TO_POINTER (metrics_changed));
+
+  for (l = priv->attached_windows; l; l = l->next)
+    update_font_options_recurse (l->data, GINT_TO_POINTER (metrics_changed));
+}
+
 /**
  * gtk_widget_set_font_options:
  * @widget: a #GtkWidget
@@ -8373,8 +8903,14 @@ gtk_widget_finalize (GObject *object)
 
   g_clear_object (&priv->context);
 
+  gtk_widget_clear_background_node (widget);
+
   _gtk_size_request_cache_free (&priv->requests);
 
+  gtk_widget_invalidate_pick_index (widget);
+  gtk_widget_invalidate_focus_chain (widget);
+  g_clear_pointer (&priv->child_index, g_ptr_array_unref);
+
   l = priv->event_controllers;
   while (l)
     {
@@ -11166,6 +11702,10 @@ gtk_widget_pick (GtkWidget *widget,
 
   g_return_val_if_fail (GTK_IS_WIDGET (widget), NULL);
 
+  gtk_pick_stats.widgets_visited++;
+  if (priv->parent == NULL)
+    gtk_pick_stats.picks++;
+
   if (!gtk_widget_get_can_pick (widget) ||
       !_gtk_widget_is_sensitive (widget) ||
       !_gtk_widget_is_drawable (widget))
@@ -11673,6 +12213,7 @@ gtk_widget_set_overflow (GtkWidget   *widget,
 
   priv->overflow = overflow;
 
+  gtk_widget_invalidate_pick_index (priv->parent);
   gtk_widget_queue_draw (widget);
 
   g_object_notify_by_pspec (G_OBJECT (widget), widget_props[PROP_OVERFLOW]);
@@ -11826,6 +12367,39 @@ gtk_widget_set_alloc_needed (GtkWidget *widget)
   while (TRUE);
 }
 
+/*
+ * gtk_widget_push_layout_deadline:
+ * @deadline: monotonic time at which to stop
+ *
+ * Makes gtk_widget_ensure_allocate() stop at the first widget it
+ * reaches after @deadline whose own allocation did not change. The
+ * widgets it did not get to keep their alloc-needed flags.
+ */
+void
+gtk_widget_push_layout_deadline (gint64 deadline)
+{
+  layout_deadline = deadline;
+  layout_deadline_hit = FALSE;
+}
+
+/*
+ * gtk_widget_pop_layout_deadline:
+ *
+ * Ends the deadline set with gtk_widget_push_layout_deadline().
+ *
+ * Returns: %TRUE if the deadline was hit and allocations are left
+ */
+gboolean
+gtk_widget_pop_layout_deadline (void)
+{
+  gboolean hit = layout_deadline_hit;
+
+  layout_deadline = 0;
+  layout_deadline_hit = FALSE;
+
+  return hit;
+}
+
 gboolean
 gtk_widget_needs_allocate (GtkWidget *widget)
 {
@@ -11873,8 +12447,22 @@ gtk_widget_ensure_allocate (GtkWidget *widget)
            child != NULL;
            child = _gtk_widget_get_next_sibling (child))
         {
+          /* The children keep their allocation, so the remaining ones
+           * can be done in the next frame.
+           */
+          if (layout_deadline != 0 &&
+              (layout_deadline_hit || g_get_monotonic_time () > layout_deadline))
+            {
+              layout_deadline_hit = TRUE;
+              priv->alloc_needed_on_child = TRUE;
+              break;
+            }
+
           gtk_widget_ensure_allocate (child);
         }
+
+      if (layout_deadline_hit)
+        priv->alloc_needed_on_child = TRUE;
     }
 }
 
@@ -12108,6 +12696,134 @@ gtk_widget_class_get_css_name (GtkWidgetClass *widget_class)
   return widget_class->priv->css_name;
 }
 
+void
+gtk_widget_class_count_size_request (GtkWidgetClass *widget_class,
+                                     gboolean        cache_hit)
+{
+  widget_class->priv->size_request_lookups++;
+  if (cache_hit)
+    widget_class->priv->size_request_hits++;
+}
+
+/*
+ * gtk_widget_class_get_size_request_stats:
+ * @widget_class: a #GtkWidgetClass
+ * @lookups: (out): return location for the number of size requests
+ * @hits: (out): return location for the number of size requests
+ *   that were answered from the size request cache
+ *
+ * Gets how well the size request cache works for widgets of
+ * exactly this class. Subclasses are counted separately.
+ */
+void
+gtk_widget_class_get_size_request_stats (GtkWidgetClass *widget_class,
+                                         guint          *lookups,
+                                         guint          *hits)
+{
+  *lookups = widget_class->priv->size_request_lookups;
+  *hits = widget_class->priv->size_request_hits;
+}
+
+/*
+ * gtk_widget_class_get_resize_stats:
+ * @widget_class: a #GtkWidgetClass
+ * @queued: (out): return location for the number of resizes queued
+ *   on widgets of this class
+ * @coalesced: (out): return location for the number of those that
+ *   stopped at a widget that already had a resize pending
+ *
+ * Gets how often widgets of exactly this class queued a resize, and
+ * how many of those were folded into a resize that was already
+ * pending. Subclasses are counted separately.
+ */
+void
+gtk_widget_class_get_resize_stats (GtkWidgetClass *widget_class,
+                                   guint          *queued,
+                                   guint          *coalesced)
+{
+  *queued = widget_class->priv->resizes_queued;
+  *coalesced = widget_class->priv->resizes_coalesced;
+}
+
+/*
+ * gtk_widget_class_get_notify_stats:
+ * @widget_class: a #GtkWidgetClass
+ * @notifies: (out): return location for the number of property
+ *   notifications emitted on widgets of this class
+ * @deferred: (out): return location for the number of times their
+ *   notifications were held back until the next frame
+ *
+ * Gets how many ::notify emissions widgets of exactly this class did,
+ * and how often gtk_widget_defer_notify() was used to batch them.
+ * Subclasses are counted separately.
+ */
+void
+gtk_widget_class_get_notify_stats (GtkWidgetClass *widget_class,
+                                   guint          *notifies,
+                                   guint          *deferred)
+{
+  *notifies = widget_class->priv->notifies;
+  *deferred = widget_class->priv->notifies_deferred;
+}
+
+/*
+ * gtk_widget_get_pick_bounds:
+ * @widget: a #GtkWidget
+ * @bounds: (out caller-allocates): return location for the bounds
+ *
+ * Gets the area outside of which gtk_widget_pick() is sure to not
+ * find @widget or any of its children, in the coordinates of the
+ * parent. This is the case for widgets that clip their children and
+ * for widgets without children that use the default pick, as long as
+ * they are not transformed in 3D.
+ *
+ * Returns: %TRUE if @bounds was set, %FALSE if @widget may be picked
+ *   anywhere
+ */
+gboolean
+gtk_widget_get_pick_bounds (GtkWidget       *widget,
+                            graphene_rect_t *bounds)
+{
+  GtkWidgetPrivate *priv = gtk_widget_get_instance_private (widget);
+  GtkWidgetClass *widget_class = GTK_WIDGET_GET_CLASS (widget);
+  graphene_matrix_t matrix;
+  GtkCssBoxes boxes;
+
+  if (priv->overflow != GTK_OVERFLOW_HIDDEN &&
+      (priv->first_child != NULL ||
+       widget_class->pick != gtk_widget_real_pick ||
+       widget_class->contains != gtk_widget_real_contains))
+    return FALSE;
+
+  if (gsk_transform_get_category (priv->transform) < GSK_TRANSFORM_CATEGORY_2D)
+    return FALSE;
+
+  gtk_css_boxes_init (&boxes, widget);
+  gsk_transform_to_matrix (priv->transform, &matrix);
+  graphene_matrix_transform_bounds (&matrix, gtk_css_boxes_get_border_rect (&boxes), bounds);
+
+  return TRUE;
+}
+
+/*
+ * gtk_widget_class_set_child_resize_func:
+ * @widget_class: a #GtkWidgetClass
+ * @func: (nullable): function to call when a child queues a resize
+ *
+ * Sets a function that gets called whenever a visible child of a
+ * widget of this class starts needing a resize, before the resize
+ * propagates to the widget itself. Containers that keep per-child
+ * size information can use it to find out which children changed.
+ *
+ * The function is inherited by subclasses.
+ */
+void
+gtk_widget_class_set_child_resize_func (GtkWidgetClass           *widget_class,
+                                        GtkWidgetChildResizeFunc  func)
+{
+  widget_class->priv->child_resize_func = func;
+}
+
 void
 _gtk_widget_style_context_invalidated (GtkWidget *widget)
 {
@@ -12343,6 +13059,8 @@ template_data_free (GtkWidgetTemplate *template_data)
   if (template_data)
     {
       g_bytes_unref (template_data->data);
+      if (template_data->cache)
+        _gtk_builder_template_cache_free (template_data->cache);
       g_slist_free_full (template_data->children, (GDestroyNotify)template_child_class_free);
       g_slist_free_full (template_data->callbacks, (GDestroyNotify)callback_symbol_free);
 
@@ -12432,6 +13150,34 @@ setup_template_child (GtkWidgetTemplate   *template_data,
   return TRUE;
 }
 
+/* Templates are instantiated many times, so the XML is converted
+ * once into precompiled data that the builder loads without parsing
+ */
+static void
+template_ensure_precompiled (GtkWidgetTemplate *template)
+{
+  const gchar *data;
+  gsize size;
+  GBytes *compiled;
+
+  if (template->precompiled)
+    return;
+
+  template->precompiled = TRUE;
+
+  data = g_bytes_get_data (template->data, &size);
+  if (_gtk_builder_is_precompiled (data, size))
+    return;
+
+  /* Malformed XML is kept, so that building it reports the error */
+  compiled = _gtk_builder_precompile (data, size, NULL);
+  if (compiled)
+    {
+      g_bytes_unref (template->data);
+      template->data = compiled;
+    }
+}
+
 /**
  * gtk_widget_init_template:
  * @widget: a #GtkWidget
@@ -12471,7 +13217,12 @@ gtk_widget_init_template (GtkWidget *widget)
   template = GTK_WIDGET_GET_CLASS (widget)->priv->template;
   g_return_if_fail (template != NULL);
 
+  template_ensure_precompiled (template);
+  if (template->cache == NULL)
+    template->cache = _gtk_builder_template_cache_new ();
+
   builder = gtk_builder_new ();
+  _gtk_builder_set_template_cache (builder, template->cache);
 
   /* Add any callback symbols declared for this GType to the GtkBuilder namespace */
   for (l = template->callbacks; l; l = l->next)
@@ -12867,6 +13618,7 @@ gtk_widget_add_controller (GtkWidget          *widget,
   GTK_EVENT_CONTROLLER_GET_CLASS (controller)->set_widget (controller, widget);
 
   priv->event_controllers = g_list_prepend (priv->event_controllers, controller);
+  gtk_widget_invalidate_phase_controllers (widget);
 
   if (priv->controller_observer)
     gtk_list_list_model_item_added_at (priv->controller_observer, 0);
@@ -12899,6 +13651,7 @@ gtk_widget_remove_controller (GtkWidget          *widget,
   list = g_list_find (priv->event_controllers, controller);
   before = list->prev;
   priv->event_controllers = g_list_delete_link (priv->event_controllers, list);
+  gtk_widget_invalidate_phase_controllers (widget);
   g_object_unref (controller);
 
   if (priv->controller_observer)
@@ -12999,23 +13752,58 @@ gtk_widget_maybe_add_debug_render_nodes (GtkWidget   *widget,
 #endif
 }
 
+/* When a child redraws, all of its parents have to create new render
+ * nodes, too. Their backgrounds usually stay the same then, so keep
+ * them from the last time. That saves drawing them and, since the
+ * renderer finds the same nodes again when comparing to the last
+ * frame, only the area of the child is repainted.
+ */
+static void
+gtk_widget_snapshot_background (GtkWidget   *widget,
+                                GtkCssBoxes *boxes,
+                                GtkSnapshot *snapshot)
+{
+  GtkWidgetPrivate *priv = gtk_widget_get_instance_private (widget);
+  GtkSnapshot *background_snapshot;
+
+  if (priv->background_style != boxes->style ||
+      priv->background_width != priv->width ||
+      priv->background_height != priv->height ||
+      priv->background_scale != boxes->scale)
+    {
+      background_snapshot = gtk_snapshot_new ();
+      gtk_css_style_snapshot_background (boxes, background_snapshot);
+      gtk_css_style_snapshot_border (boxes, background_snapshot);
+
+      g_clear_pointer (&priv->background_node, gsk_render_node_unref);
+      priv->background_node = gtk_snapshot_free_to_node (background_snapshot);
+      g_set_object (&priv->background_style, boxes->style);
+      priv->background_width = priv->width;
+      priv->background_height = priv->height;
+      priv->background_scale = boxes->scale;
+    }
+
+  if (priv->background_node)
+    gtk_snapshot_append_node (snapshot, priv->background_node);
+}
+
 static GskRenderNode *
 gtk_widget_create_render_node (GtkWidget   *widget,
-                               GtkSnapshot *parent_snapshot)
+                               GtkSnapshot *snapshot)
 {
   GtkWidgetClass *klass = GTK_WIDGET_GET_CLASS (widget);
   GtkWidgetPrivate *priv = gtk_widget_get_instance_private (widget);
   GtkCssBoxes boxes;
   GtkCssValue *filter_value;
   double opacity;
-  GtkSnapshot *snapshot;
 
   opacity = priv->alpha / 255.0;
   if (opacity <= 0.0)
     return NULL;
 
   gtk_css_boxes_init (&boxes, widget);
-  snapshot = gtk_snapshot_new_with_parent (parent_snapshot);
+  boxes.scale = gtk_widget_get_scale_factor (widget);
+  gtk_snapshot_push_collect (snapshot);
 
   gtk_snapshot_push_debug (snapshot,
                            "RenderNode for %s %p",
@@ -13027,11 +13815,10 @@ gtk_widget_create_render_node (GtkWidget   *widget,
   if (opacity < 1.0)
     gtk_snapshot_push_opacity (snapshot, opacity);
 
+  priv->offscreen_pending = opacity < 1.0 || !gtk_css_filter_value_is_none (filter_value);
+
   if (!GTK_IS_WINDOW (widget))
-    {
-      gtk_css_style_snapshot_background (&boxes, snapshot);
-      gtk_css_style_snapshot_border (&boxes, snapshot);
-    }
+    gtk_widget_snapshot_background (widget, &boxes, snapshot);
 
   if (priv->overflow == GTK_OVERFLOW_HIDDEN)
     gtk_snapshot_push_clip (snapshot, gtk_css_boxes_get_padding_rect (&boxes));
@@ -13054,28 +13841,91 @@ gtk_widget_create_render_node (GtkWidget   *widget,
 
   gtk_snapshot_pop (snapshot);
 
-  return gtk_snapshot_free_to_node (snapshot);
+  return gtk_snapshot_pop_collect (snapshot);
 }
 
-void
-gtk_widget_snapshot (GtkWidget   *widget,
-                     GtkSnapshot *snapshot)
+/* Don't keep textures of more than 16 megapixels around */
+#define MAX_OFFSCREEN_PIXELS (4096 * 4096)
+
+/* Opacity and filters make the renderer draw the widget offscreen
+ * on every frame. When the widget did not change since the last frame,
+ * do that once and replace the render node with the resulting texture
+ * until the next gtk_widget_queue_draw().
+ */
+static void
+gtk_widget_cache_offscreen (GtkWidget *widget)
 {
   GtkWidgetPrivate *priv = gtk_widget_get_instance_private (widget);
+  GskRenderer *renderer;
+  GskTransform *transform;
+  GskRenderNode *node;
+  GdkTexture *texture;
+  graphene_rect_t bounds, viewport;
+  int scale;
 
-  if (!_gtk_widget_is_drawable (widget))
+  priv->offscreen_pending = FALSE;
+
+  if (priv->render_node == NULL || priv->root == NULL)
     return;
 
+  renderer = gtk_root_get_renderer (priv->root);
+  if (renderer == NULL)
+    return;
+
+  /* Cover whole device pixels, so the texture is drawn unscaled */
+  scale = gtk_widget_get_scale_factor (widget);
+  gsk_render_node_get_bounds (priv->render_node, &bounds);
+  viewport.origin.x = floor (bounds.origin.x * scale);
+  viewport.origin.y = floor (bounds.origin.y * scale);
+  viewport.size.width = ceil ((bounds.origin.x + bounds.size.width) * scale) - viewport.origin.x;
+  viewport.size.height = ceil ((bounds.origin.y + bounds.size.height) * scale) - viewport.origin.y;
+
+  if (viewport.size.width < 1 || viewport.size.height < 1 ||
+      viewport.size.width * viewport.size.height > MAX_OFFSCREEN_PIXELS)
+    return;
+
+  transform = gsk_transform_scale (NULL, scale, scale);
+  node = gsk_transform_node_new (priv->render_node, transform);
+  texture = gsk_renderer_render_texture (renderer, node, &viewport);
+  gsk_render_node_unref (node);
+  gsk_transform_unref (transform);
+
+  graphene_rect_init (&bounds,
+                      viewport.origin.x / scale, viewport.origin.y / scale,
+                      viewport.size.width / scale, viewport.size.height / scale);
+
+  g_clear_pointer (&priv->render_node, gsk_render_node_unref);
+  priv->render_node = gsk_texture_node_new (texture, &bounds);
+  g_object_unref (texture);
+}
+
+static GskRenderNode *
+gtk_widget_ensure_render_node (GtkWidget   *widget,
+                               GtkSnapshot *snapshot)
+{
+  GtkWidgetPrivate *priv = gtk_widget_get_instance_private (widget);
+
+  if (!_gtk_widget_is_drawable (widget))
+    return NULL;
+
   if (_gtk_widget_get_alloc_needed (widget))
     {
+      /* The window ran out of layout time, show the old contents */
+      if (GTK_IS_WINDOW (priv->root) &&
+          gtk_window_get_layout_deferred (GTK_WINDOW (priv->root)))
+        return priv->render_node;
+
       g_warning ("Trying to snapshot %s %p without a current allocation", G_OBJECT_TYPE_NAME (widget), widget);
-      return;
+      return NULL;
     }
 
   if (priv->draw_needed)
     {
+      GtkFramePhaseTimings *timings;
+      gint64 phase_start, phase_nested;
       GskRenderNode *render_node;
 
+      timings = gtk_frame_phase_begin (GTK_FRAME_PHASE_SNAPSHOT, &phase_start, &phase_nested);
       gtk_widget_push_paintables (widget);
 
       render_node = gtk_widget_create_render_node (widget, snapshot);
@@ -13088,10 +13938,59 @@ gtk_widget_snapshot (GtkWidget   *widget,
 
       gtk_widget_pop_paintables (widget);
       gtk_widget_update_paintables (widget);
+      gtk_frame_phase_end (timings, GTK_FRAME_PHASE_SNAPSHOT, widget, phase_start, phase_nested);
+    }
+  else if (priv->offscreen_pending)
+    {
+      gtk_widget_cache_offscreen (widget);
     }
 
-  if (priv->render_node)
-    gtk_snapshot_append_node (snapshot, priv->render_node);
+  return priv->render_node;
+}
+
+void
+gtk_widget_snapshot (GtkWidget   *widget,
+                     GtkSnapshot *snapshot)
+{
+  GskRenderNode *render_node;
+
+  render_node = gtk_widget_ensure_render_node (widget, snapshot);
+  if (render_node)
+    gtk_snapshot_append_node (snapshot, render_node);
+}
+
+/* Returns the widget's render node positioned by @transform.
+ *
+ * Widgets that did not change keep their render node, so keep the
+ * transform node around, too. Otherwise every redraw of a container
+ * would create a new transform node for each of its children, and
+ * the renderer could not tell unchanged subtrees apart by pointer
+ * when computing the damage against the previous frame.
+ */
+static GskRenderNode *
+gtk_widget_ensure_transform_node (GtkWidget    *widget,
+                                  GtkSnapshot  *snapshot,
+                                  GskTransform *transform)
+{
+  GtkWidgetPrivate *priv = gtk_widget_get_instance_private (widget);
+  GskRenderNode *render_node;
+
+  render_node = gtk_widget_ensure_render_node (widget, snapshot);
+  if (render_node == NULL)
+    return NULL;
+
+  if (gsk_transform_get_category (transform) == GSK_TRANSFORM_CATEGORY_IDENTITY)
+    return render_node;
+
+  if (priv->transform_node == NULL ||
+      gsk_transform_node_get_child (priv->transform_node) != render_node ||
+      !gsk_transform_equal (gsk_transform_node_get_transform (priv->transform_node), transform))
+    {
+      g_clear_pointer (&priv->transform_node, gsk_render_node_unref);
+      priv->transform_node = gsk_transform_node_new (render_node, transform);
+    }
+
+  return priv->transform_node;
 }
 
 void
@@ -13099,8 +13998,12 @@ gtk_widget_render (GtkWidget            *widget,
                    GdkSurface            *surface,
                    const cairo_region_t *region)
 {
+  GtkFramePhaseTimings *timings, *previous_timings = NULL;
+  gint64 phase_start, phase_nested;
+  gint64 trace_start;
   GtkSnapshot *snapshot;
   GskRenderer *renderer;
+  GskTransform *transform;
   GskRenderNode *root;
   int x, y;
 
@@ -13115,11 +14018,24 @@ gtk_widget_render (GtkWidget            *widget,
   if (renderer == NULL)
     return;
 
+  /* Reuse the root node from the last frame when nothing changed, so
+   * that the renderer's diff against its previous frame stops right
+   * at the unchanged subtrees. */
+  if (GTK_IS_WINDOW (widget))
+    previous_timings = gtk_window_begin_frame_phases (GTK_WINDOW (widget));
+
+  trace_start = gtk_startup_trace_begin ();
+  timings = gtk_frame_phase_begin (GTK_FRAME_PHASE_SNAPSHOT, &phase_start, &phase_nested);
   snapshot = gtk_snapshot_new ();
   gtk_root_get_surface_transform (GTK_ROOT (widget), &x, &y);
-  gtk_snapshot_translate (snapshot, &GRAPHENE_POINT_INIT (x, y));
-  gtk_widget_snapshot (widget, snapshot);
+  transform = gsk_transform_translate (NULL, &GRAPHENE_POINT_INIT (x, y));
+  root = gtk_widget_ensure_transform_node (widget, snapshot, transform);
+  if (root)
+    gtk_snapshot_append_node (snapshot, root);
+  gsk_transform_unref (transform);
   root = gtk_snapshot_free_to_node (snapshot);
+  gtk_frame_phase_end (timings, GTK_FRAME_PHASE_SNAPSHOT, NULL, phase_start, phase_nested);
+  gtk_startup_trace_end (trace_start, "Snapshot", G_OBJECT_TYPE_NAME (widget));
 
   if (root != NULL)
     {
@@ -13129,10 +14045,19 @@ gtk_widget_render (GtkWidget            *widget,
                                            region,
                                            root);
 
+      trace_start = gtk_startup_trace_begin ();
+      timings = gtk_frame_phase_begin (GTK_FRAME_PHASE_RENDER, &phase_start, &phase_nested);
       gsk_renderer_render (renderer, root, region);
+      gtk_frame_phase_end (timings, GTK_FRAME_PHASE_RENDER, NULL, phase_start, phase_nested);
+      gtk_startup_trace_end (trace_start, "Render", G_OBJECT_TYPE_NAME (widget));
 
       gsk_render_node_unref (root);
+
+      gtk_startup_trace_first_frame ();
     }
+
+  if (GTK_IS_WINDOW (widget))
+    gtk_window_end_frame_phases (GTK_WINDOW (widget), previous_timings);
 }
 
 static void
@@ -13168,14 +14093,17 @@ gtk_widget_observe_children (GtkWidget *widget)
   if (priv->children_observer)
     return g_object_ref (G_LIST_MODEL (priv->children_observer));
 
-  priv->children_observer = gtk_list_list_model_new (GTK_TYPE_WIDGET,
-                                                     (gpointer) gtk_widget_get_first_child,
-                                                     (gpointer) gtk_widget_get_next_sibling,
-                                                     (gpointer) gtk_widget_get_prev_sibling,
-                                                     (gpointer) gtk_widget_get_last_child,
-                                                     (gpointer) g_object_ref,
-                                                     widget,
-                                                     gtk_widget_child_observer_destroyed);
+  priv->children_observer = gtk_list_list_model_new_with_size (GTK_TYPE_WIDGET,
+                                                               priv->n_children,
+                                                               (gpointer) gtk_widget_get_first_child,
+                                                               (gpointer) gtk_widget_get_next_sibling,
+                                                               (gpointer) gtk_widget_get_prev_sibling,
+                                                               (gpointer) gtk_widget_get_last_child,
+                                                               (gpointer) g_object_ref,
+                                                               widget,
+                                                               gtk_widget_child_observer_destroyed);
+  gtk_list_list_model_set_get_nth (priv->children_observer,
+                                   (gpointer) gtk_widget_get_nth_child);
 
   return G_LIST_MODEL (priv->children_observer);
 }
@@ -13431,16 +14359,14 @@ gtk_widget_snapshot_child (GtkWidget   *widget,
                            GtkSnapshot *snapshot)
 {
   GtkWidgetPrivate *priv = gtk_widget_get_instance_private (child);
+  GskRenderNode *node;
 
   g_return_if_fail (_gtk_widget_get_parent (child) == widget);
   g_return_if_fail (snapshot != NULL);
 
-  gtk_snapshot_save (snapshot);
-  gtk_snapshot_transform (snapshot, priv->transform);
-
-  gtk_widget_snapshot (child, snapshot);
-
-  gtk_snapshot_restore (snapshot);
+  node = gtk_widget_ensure_transform_node (child, snapshot, priv->transform);
+  if (node)
+    gtk_snapshot_append_node (snapshot, node);
 }
 
 /**
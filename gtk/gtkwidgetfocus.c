@@ -69,36 +69,73 @@ reverse_ptr_array (GPtrArray *arr)
     }
 }
 
+typedef struct
+{
+  GtkWidget *widget;
+  float x;
+  float y;
+  gboolean has_bounds;
+} TabSortKey;
+
 static int
 tab_sort_func (gconstpointer a,
                gconstpointer b,
                gpointer      user_data)
 {
-  graphene_rect_t child_bounds1, child_bounds2;
-  GtkWidget *child1 = *((GtkWidget **)a);
-  GtkWidget *child2 = *((GtkWidget **)b);
+  const TabSortKey *key1 = a;
+  const TabSortKey *key2 = b;
   GtkTextDirection text_direction = GPOINTER_TO_INT (user_data);
-  float y1, y2;
 
-  if (!gtk_widget_compute_bounds (child1, gtk_widget_get_parent (child1), &child_bounds1) ||
-      !gtk_widget_compute_bounds (child2, gtk_widget_get_parent (child2), &child_bounds2))
+  if (!key1->has_bounds || !key2->has_bounds)
     return 0;
 
-  y1 = child_bounds1.origin.y + (child_bounds1.size.height / 2.0f);
-  y2 = child_bounds2.origin.y + (child_bounds2.size.height / 2.0f);
-
-  if (y1 == y2)
+  if (key1->y == key2->y)
     {
-      const float x1 = child_bounds1.origin.x + (child_bounds1.size.width / 2.0f);
-      const float x2 = child_bounds2.origin.x + (child_bounds2.size.width / 2.0f);
-
       if (text_direction == GTK_TEXT_DIR_RTL)
-        return (x1 < x2) ? 1 : ((x1 == x2) ? 0 : -1);
+        return (key1->x < key2->x) ? 1 : ((key1->x == key2->x) ? 0 : -1);
       else
-        return (x1 < x2) ? -1 : ((x1 == x2) ? 0 : 1);
+        return (key1->x < key2->x) ? -1 : ((key1->x == key2->x) ? 0 : 1);
     }
   else
-    return (y1 < y2) ? -1 : 1;
+    return (key1->y < key2->y) ? -1 : 1;
+}
+
+/* Sorts @widgets by the center of their bounds, which are computed
+ * once per widget instead of once per comparison.
+ */
+static void
+sort_tab_order (GPtrArray        *widgets,
+                GtkTextDirection  text_direction)
+{
+  TabSortKey *keys;
+  guint i;
+
+  if (widgets->len < 2)
+    return;
+
+  keys = g_new (TabSortKey, widgets->len);
+
+  for (i = 0; i < widgets->len; i++)
+    {
+      GtkWidget *child = g_ptr_array_index (widgets, i);
+      graphene_rect_t bounds;
+
+      keys[i].widget = child;
+      keys[i].has_bounds = gtk_widget_compute_bounds (child, gtk_widget_get_parent (child), &bounds);
+      if (keys[i].has_bounds)
+        {
+          keys[i].x = bounds.origin.x + (bounds.size.width / 2.0f);
+          keys[i].y = bounds.origin.y + (bounds.size.height / 2.0f);
+        }
+    }
+
+  g_qsort_with_data (keys, widgets->len, sizeof (TabSortKey),
+                     tab_sort_func, GINT_TO_POINTER (text_direction));
+
+  for (i = 0; i < widgets->len; i++)
+    widgets->pdata[i] = keys[i].widget;
+
+  g_free (keys);
 }
 
 static void
@@ -106,9 +143,7 @@ focus_sort_tab (GtkWidget        *widget,
                 GtkDirectionType  direction,
                 GPtrArray        *focus_order)
 {
-  GtkTextDirection text_direction = _gtk_widget_get_direction (widget);
-
-  g_ptr_array_sort_with_data (focus_order, tab_sort_func, GINT_TO_POINTER (text_direction));
+  sort_tab_order (focus_order, _gtk_widget_get_direction (widget));
 
   if (direction == GTK_DIR_TAB_BACKWARD)
     reverse_ptr_array (focus_order);
@@ -484,3 +519,111 @@ gtk_widget_focus_move (GtkWidget        *widget,
 
   return FALSE;
 }
+
+/*
+ * gtk_widget_invalidate_focus_chain:
+ * @widget: (nullable): a #GtkWidget
+ *
+ * Frees the cached tab order of the children of @widget, it must
+ * be called whenever they are added, removed, reordered or moved.
+ */
+void
+gtk_widget_invalidate_focus_chain (GtkWidget *widget)
+{
+  if (widget)
+    g_clear_pointer (&widget->priv->focus_chain, g_ptr_array_unref);
+}
+
+static GPtrArray *
+gtk_widget_get_focus_chain (GtkWidget *widget)
+{
+  GtkWidgetPrivate *priv = widget->priv;
+  GtkTextDirection text_direction = _gtk_widget_get_direction (widget);
+  GtkWidget *child;
+
+  if (priv->focus_chain != NULL &&
+      priv->focus_chain_direction == text_direction)
+    return priv->focus_chain;
+
+  g_clear_pointer (&priv->focus_chain, g_ptr_array_unref);
+
+  /* All children are kept, unrealized ones are not drawable and
+   * get skipped when moving the focus, like in gtk_widget_focus_sort().
+   */
+  priv->focus_chain = g_ptr_array_new ();
+  for (child = _gtk_widget_get_first_child (widget);
+       child != NULL;
+       child = _gtk_widget_get_next_sibling (child))
+    g_ptr_array_add (priv->focus_chain, child);
+
+  sort_tab_order (priv->focus_chain, text_direction);
+  priv->focus_chain_direction = text_direction;
+
+  return priv->focus_chain;
+}
+
+/*
+ * gtk_widget_focus_move_tab:
+ * @widget: a #GtkWidget
+ * @direction: %GTK_DIR_TAB_FORWARD or %GTK_DIR_TAB_BACKWARD
+ *
+ * Does what gtk_widget_focus_sort() followed by gtk_widget_focus_move()
+ * would do for the children of @widget, but the sorted children are
+ * kept until they change, so holding Tab does not sort them on every
+ * key press.
+ *
+ * Returns: %TRUE if the focus ended up inside @widget
+ */
+gboolean
+gtk_widget_focus_move_tab (GtkWidget        *widget,
+                           GtkDirectionType  direction)
+{
+  GtkWidget *focus_child = gtk_widget_get_focus_child (widget);
+  GPtrArray *chain;
+  int i, end, step;
+
+  g_assert (direction == GTK_DIR_TAB_FORWARD ||
+            direction == GTK_DIR_TAB_BACKWARD);
+
+  /* Keep a reference, focusing a child may change the children */
+  chain = g_ptr_array_ref (gtk_widget_get_focus_chain (widget));
+
+  if (direction == GTK_DIR_TAB_FORWARD)
+    {
+      i = 0;
+      end = chain->len;
+      step = 1;
+    }
+  else
+    {
+      i = (int) chain->len - 1;
+      end = -1;
+      step = -1;
+    }
+
+  for (; i != end; i += step)
+    {
+      GtkWidget *child = g_ptr_array_index (chain, i);
+
+      if (focus_child)
+        {
+          if (focus_child == child)
+            {
+              focus_child = NULL;
+
+              if (gtk_widget_child_focus (child, direction))
+                break;
+            }
+        }
+      else if (_gtk_widget_is_drawable (child) &&
+               gtk_widget_is_ancestor (child, widget))
+        {
+          if (gtk_widget_child_focus (child, direction))
+            break;
+        }
+    }
+
+  g_ptr_array_unref (chain);
+
+  return i != end;
+}
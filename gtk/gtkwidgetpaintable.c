@@ -24,8 +24,11 @@
 #include "gtkintl.h"
 #include "gtksnapshot.h"
 #include "gtkrendernodepaintableprivate.h"
+#include "gtkrootprivate.h"
 #include "gtkwidgetprivate.h"
 
+#include <math.h>
+
 /**
  * SECTION:gtkwidgetpaintable
  * @Short_description: Drawing a widget elsewhere
@@ -52,6 +55,12 @@
  * The paintable will take care of recursion when this happens. If you do
  * this however, ensure the #GtkPicture:can-shrink property is set to
  * %TRUE or you might end up with an infinitely growing widget.
+ *
+ * The contents are only updated when the widget is drawn again, drawing
+ * the paintable just draws what the widget drew last. When the paintable
+ * is used for small previews of big widgets, consider setting
+ * #GtkWidgetPaintable:downscale, so that the widget's contents do not
+ * have to be rendered in full whenever a preview is drawn.
  */
 struct _GtkWidgetPaintable
 {
@@ -63,6 +72,12 @@ struct _GtkWidgetPaintable
   GdkPaintable *current_image;          /* the image that we are presenting */
   GdkPaintable *pending_image;          /* the image that we should be presenting */
   guint         pending_update_cb;      /* the idle source that updates the valid image to be the new current image */
+
+  GskRenderNode  *image_node;           /* the render node of the newest image */
+  graphene_rect_t image_bounds;         /* the bounds of the newest image */
+
+  GdkTexture   *texture;                /* current_image, rendered at the size it was last drawn */
+  guint         downscale : 1;
 };
 
 struct _GtkWidgetPaintableClass
@@ -73,12 +88,70 @@ struct _GtkWidgetPaintableClass
 enum {
   PROP_0,
   PROP_WIDGET,
+  PROP_DOWNSCALE,
 
   N_PROPS,
 };
 
 static GParamSpec *properties[N_PROPS] = { NULL, };
 
+/* Draws the current image from a texture when it is drawn smaller than
+ * it is, so the renderer does not have to go through all of the widget's
+ * render nodes again every time.
+ */
+static gboolean
+gtk_widget_paintable_snapshot_texture (GtkWidgetPaintable *self,
+                                       GdkSnapshot        *snapshot,
+                                       double              width,
+                                       double              height)
+{
+  GtkSnapshot *texture_snapshot;
+  GskRenderNode *node;
+  GskRenderer *renderer;
+  GtkRoot *root;
+  int texture_width, texture_height;
+  int scale;
+
+  if (self->widget == NULL ||
+      width >= gdk_paintable_get_intrinsic_width (self->current_image) ||
+      height >= gdk_paintable_get_intrinsic_height (self->current_image))
+    return FALSE;
+
+  scale = gtk_widget_get_scale_factor (self->widget);
+  texture_width = ceil (width * scale);
+  texture_height = ceil (height * scale);
+  if (texture_width < 1 || texture_height < 1)
+    return FALSE;
+
+  if (self->texture == NULL ||
+      gdk_texture_get_width (self->texture) != texture_width ||
+      gdk_texture_get_height (self->texture) != texture_height)
+    {
+      root = gtk_widget_get_root (self->widget);
+      if (root == NULL)
+        return FALSE;
+
+      renderer = gtk_root_get_renderer (root);
+      if (renderer == NULL)
+        return FALSE;
+
+      texture_snapshot = gtk_snapshot_new ();
+      gdk_paintable_snapshot (self->current_image, texture_snapshot, texture_width, texture_height);
+      node = gtk_snapshot_free_to_node (texture_snapshot);
+      if (node == NULL)
+        return FALSE;
+
+      g_clear_object (&self->texture);
+      self->texture = gsk_renderer_render_texture (renderer, node,
+                                                   &GRAPHENE_RECT_INIT (0, 0, texture_width, texture_height));
+      gsk_render_node_unref (node);
+    }
+
+  gdk_paintable_snapshot (GDK_PAINTABLE (self->texture), snapshot, width, height);
+
+  return TRUE;
+}
+
 static void
 gtk_widget_paintable_paintable_snapshot (GdkPaintable *paintable,
                                          GdkSnapshot  *snapshot,
@@ -106,7 +179,8 @@ gtk_widget_paintable_paintable_snapshot (GdkPaintable *paintable,
 
       gtk_snapshot_pop (snapshot);
     }
-  else
+  else if (!self->downscale ||
+           !gtk_widget_paintable_snapshot_texture (self, snapshot, width, height))
     {
       gdk_paintable_snapshot (self->current_image, snapshot, width, height);
     }
@@ -164,6 +238,10 @@ gtk_widget_paintable_set_property (GObject      *object,
       gtk_widget_paintable_set_widget (self, g_value_get_object (value));
       break;
 
+    case PROP_DOWNSCALE:
+      gtk_widget_paintable_set_downscale (self, g_value_get_boolean (value));
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -184,6 +262,10 @@ gtk_widget_paintable_get_property (GObject    *object,
       g_value_set_object (value, self->widget);
       break;
 
+    case PROP_DOWNSCALE:
+      g_value_set_boolean (value, self->downscale);
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -206,6 +288,8 @@ gtk_widget_paintable_finalize (GObject *object)
   GtkWidgetPaintable *self = GTK_WIDGET_PAINTABLE (object);
 
   g_object_unref (self->current_image);
+  g_clear_pointer (&self->image_node, gsk_render_node_unref);
+  g_clear_object (&self->texture);
 
   G_OBJECT_CLASS (gtk_widget_paintable_parent_class)->finalize (object);
 }
@@ -232,6 +316,22 @@ gtk_widget_paintable_class_init (GtkWidgetPaintableClass *klass)
                          GTK_TYPE_WIDGET,
                          G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS);
 
+  /**
+   * GtkWidgetPaintable:downscale
+   *
+   * Whether to draw the widget from a texture of the size the paintable
+   * is drawn at, when that is smaller than the widget.
+   *
+   * This makes drawing small previews of big widgets cheap, at the
+   * cost of rendering the texture again whenever the widget changes.
+   */
+  properties[PROP_DOWNSCALE] =
+    g_param_spec_boolean ("downscale",
+                          P_("Downscale"),
+                          P_("Whether to draw from a texture when drawn smaller than the widget"),
+                          FALSE,
+                          G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY | G_PARAM_STATIC_STRINGS);
+
   g_object_class_install_properties (gobject_class, N_PROPS, properties);
 }
 
@@ -259,21 +359,39 @@ gtk_widget_paintable_new (GtkWidget *widget)
                        NULL);
 }
 
+static void
+gtk_widget_paintable_get_source (GtkWidgetPaintable  *self,
+                                 GskRenderNode      **node,
+                                 graphene_rect_t     *bounds)
+{
+  *node = NULL;
+  graphene_rect_init (bounds, 0, 0, 0, 0);
+
+  if (self->widget == NULL ||
+      !gtk_widget_compute_bounds (self->widget, self->widget, bounds))
+    return;
+
+  *node = self->widget->priv->render_node;
+}
+
 static GdkPaintable *
 gtk_widget_paintable_snapshot_widget (GtkWidgetPaintable *self)
 {
+  GskRenderNode *node;
   graphene_rect_t bounds;
 
-  if (self->widget == NULL)
-    return gdk_paintable_new_empty (0, 0);
+  gtk_widget_paintable_get_source (self, &node, &bounds);
 
-  if (!gtk_widget_compute_bounds (self->widget, self->widget, &bounds))
-    return gdk_paintable_new_empty (0, 0);
+  /* Remember what the image shows, see gtk_widget_paintable_update_image() */
+  g_clear_pointer (&self->image_node, gsk_render_node_unref);
+  if (node)
+    self->image_node = gsk_render_node_ref (node);
+  self->image_bounds = bounds;
 
-  if (self->widget->priv->render_node == NULL)
+  if (node == NULL)
     return gdk_paintable_new_empty (bounds.size.width, bounds.size.height);
-  
-  return gtk_render_node_paintable_new (self->widget->priv->render_node, &bounds);
+
+  return gtk_render_node_paintable_new (node, &bounds);
 }
 
 /**
@@ -330,6 +448,7 @@ gtk_widget_paintable_set_widget (GtkWidgetPaintable *self,
 
   g_object_unref (self->current_image);
   self->current_image = gtk_widget_paintable_snapshot_widget (self);
+  g_clear_object (&self->texture);
   g_clear_object (&self->pending_image);
   if (self->pending_update_cb)
     {
@@ -354,6 +473,7 @@ gtk_widget_paintable_update_func (gpointer data)
       self->current_image = self->pending_image;
       self->pending_image = NULL;
       self->pending_update_cb = 0;
+      g_clear_object (&self->texture);
 
       if (gdk_paintable_get_intrinsic_width (self->current_image) != gdk_paintable_get_intrinsic_width (old_image) ||
           gdk_paintable_get_intrinsic_height (self->current_image) != gdk_paintable_get_intrinsic_height (old_image))
@@ -376,6 +496,16 @@ void
 gtk_widget_paintable_update_image (GtkWidgetPaintable *self)
 {
   GdkPaintable *pending_image;
+  GskRenderNode *node;
+  graphene_rect_t bounds;
+
+  /* Allocating a widget does not always make it draw something new,
+   * don't make everybody redraw the same image again then.
+   */
+  gtk_widget_paintable_get_source (self, &node, &bounds);
+  if (node == self->image_node &&
+      graphene_rect_equal (&bounds, &self->image_bounds))
+    return;
 
   if (self->pending_update_cb == 0)
     {
@@ -402,3 +532,45 @@ gtk_widget_paintable_pop_snapshot_count (GtkWidgetPaintable *self)
   self->snapshot_count--;
 }
 
+/**
+ * gtk_widget_paintable_set_downscale:
+ * @self: a #GtkWidgetPaintable
+ * @downscale: whether to draw from a texture when drawn small
+ *
+ * Sets whether @self is drawn from a texture of the size it is drawn
+ * at when that is smaller than the widget. See
+ * #GtkWidgetPaintable:downscale.
+ **/
+void
+gtk_widget_paintable_set_downscale (GtkWidgetPaintable *self,
+                                    gboolean            downscale)
+{
+  g_return_if_fail (GTK_IS_WIDGET_PAINTABLE (self));
+
+  downscale = !!downscale;
+  if (self->downscale == downscale)
+    return;
+
+  self->downscale = downscale;
+  g_clear_object (&self->texture);
+
+  g_object_notify_by_pspec (G_OBJECT (self), properties[PROP_DOWNSCALE]);
+  gdk_paintable_invalidate_contents (GDK_PAINTABLE (self));
+}
+
+/**
+ * gtk_widget_paintable_get_downscale:
+ * @self: a #GtkWidgetPaintable
+ *
+ * Returns whether @self is drawn from a texture when drawn
+ * smaller than the widget.
+ *
+ * Returns: %TRUE if the paintable downscales
+ **/
+gboolean
+gtk_widget_paintable_get_downscale (GtkWidgetPaintable *self)
+{
+  g_return_val_if_fail (GTK_IS_WIDGET_PAINTABLE (self), FALSE);
+
+  return self->downscale;
+}
@@ -37,6 +37,11 @@ GtkWidget *     gtk_widget_paintable_get_widget         (GtkWidgetPaintable
 GDK_AVAILABLE_IN_ALL
 void            gtk_widget_paintable_set_widget         (GtkWidgetPaintable     *self,
                                                          GtkWidget              *widget);
+GDK_AVAILABLE_IN_ALL
+gboolean        gtk_widget_paintable_get_downscale      (GtkWidgetPaintable     *self);
+GDK_AVAILABLE_IN_ALL
+void            gtk_widget_paintable_set_downscale      (GtkWidgetPaintable     *self,
+                                                         gboolean                downscale);
 
 G_END_DECLS
 
@@ -32,6 +32,7 @@
 #include "gtkcsstypesprivate.h"
 #include "gtkeventcontroller.h"
 #include "gtklistlistmodelprivate.h"
+#include "gtkpickindexprivate.h"
 #include "gtkrootprivate.h"
 #include "gtksizerequestcacheprivate.h"
 #include "gtkwindowprivate.h"
@@ -82,6 +83,7 @@ struct _GtkWidgetPrivate
 
   /* Queue-draw related flags */
   guint draw_needed           : 1;
+  guint offscreen_pending     : 1; /* render_node needs an offscreen and may be replaced by a texture */
   /* Expand-related flags */
   guint need_compute_expand   : 1; /* Need to recompute computed_[hv]_expand */
   guint computed_hexpand      : 1; /* computed results (composite of child flags) */
@@ -95,6 +97,9 @@ struct _GtkWidgetPrivate
   /* SizeGroup related flags */
   guint have_size_groups      : 1;
 
+  /* Notifications are frozen until the next frame */
+  guint notify_deferred       : 1;
+
   /* Alignment */
   guint   halign              : 4;
   guint   valign              : 4;
@@ -154,11 +159,29 @@ struct _GtkWidgetPrivate
   int height;
   int baseline;
 
+  /* Built when picking in widgets with many children, freed on changes */
+  GtkPickIndex *pick_index;
+
+  /* Children in tab order, built on Tab presses and freed on changes */
+  GPtrArray *focus_chain;
+  GtkTextDirection focus_chain_direction;
+
   /* The widget's requested sizes */
   SizeRequestCache requests;
 
   /* The render node we draw or %NULL if not yet created.*/
   GskRenderNode *render_node;
+  /* render_node wrapped in our transform, for use by the parent */
+  GskRenderNode *transform_node;
+  /* Our CSS background and border, drawn for background_style at
+   * background_width x background_height and background_scale. Kept
+   * when only children redraw, so that the renderer sees the same
+   * node again. */
+  GskRenderNode *background_node;
+  GtkCssStyle *background_style;
+  int background_width;
+  int background_height;
+  int background_scale;
 
   GSList *paintables;
 
@@ -169,6 +192,8 @@ struct _GtkWidgetPrivate
   GdkSurface *surface;
 
   GList *event_controllers;
+  /* The controllers of each phase in dispatch order, built on demand */
+  GPtrArray *phase_controllers[GTK_PHASE_TARGET + 1];
 
   AtkObject *accessible;
 
@@ -178,6 +203,13 @@ struct _GtkWidgetPrivate
   GtkWidget *next_sibling;
   GtkWidget *first_child;
   GtkWidget *last_child;
+  guint n_children;
+
+  /* Children in order, built on positional lookups and kept in sync
+   * with the sibling pointers until freed */
+  GPtrArray *child_index;
+  /* Our position in the parent's child_index, if it has one */
+  guint child_position;
 
   /* only created on-demand */
   GtkListListModel *children_observer;
@@ -199,6 +231,8 @@ gboolean     _gtk_widget_get_alloc_needed   (GtkWidget *widget);
 gboolean     gtk_widget_needs_allocate      (GtkWidget *widget);
 void         gtk_widget_ensure_resize       (GtkWidget *widget);
 void         gtk_widget_ensure_allocate     (GtkWidget *widget);
+void         gtk_widget_push_layout_deadline (gint64    deadline);
+gboolean     gtk_widget_pop_layout_deadline  (void);
 void          _gtk_widget_scale_changed     (GtkWidget *widget);
 
 
@@ -319,6 +353,14 @@ void              gtk_widget_focus_sort                    (GtkWidget        *wi
 gboolean          gtk_widget_focus_move                    (GtkWidget        *widget,
                                                             GtkDirectionType  direction,
                                                             GPtrArray        *focus_order);
+gboolean          gtk_widget_focus_move_tab                (GtkWidget        *widget,
+                                                            GtkDirectionType  direction);
+void              gtk_widget_invalidate_focus_chain        (GtkWidget        *widget);
+
+guint             gtk_widget_get_n_children                (GtkWidget        *widget);
+guint             gtk_widget_get_child_position            (GtkWidget        *widget);
+GtkWidget *       gtk_widget_get_nth_child                 (GtkWidget        *widget,
+                                                            guint             position);
 void              gtk_widget_get_surface_allocation         (GtkWidget *widget,
 							     GtkAllocation *allocation);
 
@@ -335,6 +377,34 @@ gboolean          gtk_widget_run_controllers               (GtkWidget
                                                             const GdkEvent      *event,
                                                             GtkPropagationPhase  phase);
 
+void              gtk_widget_class_count_size_request      (GtkWidgetClass      *widget_class,
+                                                            gboolean             cache_hit);
+void              gtk_widget_class_get_size_request_stats  (GtkWidgetClass      *widget_class,
+                                                            guint               *lookups,
+                                                            guint               *hits);
+void              gtk_widget_class_get_resize_stats        (GtkWidgetClass      *widget_class,
+                                                            guint               *queued,
+                                                            guint               *coalesced);
+void              gtk_widget_class_get_notify_stats        (GtkWidgetClass      *widget_class,
+                                                            guint               *notifies,
+                                                            guint               *deferred);
+
+void              gtk_widget_defer_notify                  (GtkWidget           *widget);
+
+void              gtk_widget_update_font_options           (GtkWidget           *widget,
+                                                            gboolean             metrics_changed);
+
+gboolean          gtk_widget_get_pick_bounds               (GtkWidget           *widget,
+                                                            graphene_rect_t     *bounds);
+
+void              gtk_widget_controller_phase_changed      (GtkWidget           *widget);
+
+typedef void (* GtkWidgetChildResizeFunc) (GtkWidget *widget,
+                                           GtkWidget *child);
+
+void              gtk_widget_class_set_child_resize_func   (GtkWidgetClass           *widget_class,
+                                                            GtkWidgetChildResizeFunc  func);
+
 /* inline getters */
 
 static inline GtkWidget *
@@ -349,6 +419,12 @@ _gtk_widget_get_visible (GtkWidget *widget)
   return widget->priv->visible;
 }
 
+static inline gboolean
+_gtk_widget_get_resize_needed (GtkWidget *widget)
+{
+  return widget->priv->resize_needed;
+}
+
 static inline gboolean
 _gtk_widget_get_child_visible (GtkWidget *widget)
 {
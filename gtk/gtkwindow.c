@@ -44,6 +44,7 @@
 #include "gtkdragdest.h"
 #include "gtkeventcontrollerkey.h"
 #include "gtkeventcontrollermotion.h"
+#include "gtkframephasetimingsprivate.h"
 #include "gtkgesturedrag.h"
 #include "gtkgesturemultipress.h"
 #include "gtkgestureprivate.h"
@@ -63,7 +64,7 @@
 #include "gtkprivate.h"
 #include "gtkroot.h"
 #include "gtkseparatormenuitem.h"
-#include "gtksettings.h"
+#include "gtksettingsprivate.h"
 #include "gtksnapshot.h"
 #include "gtkstylecontextprivate.h"
 #include "gtktypebuiltins.h"
@@ -171,6 +172,7 @@
 #define RESIZE_HANDLE_SIZE 20
 #define MNEMONICS_DELAY 300 /* ms */
 #define NO_CONTENT_CHILD_NAT 200
+#define FRAME_PHASES_HISTORY 16 /* frames */
 /* In case the content (excluding header bar and shadows) of the window
  * would be empty, either because there is no visible child widget or only an
  * empty container widget, we use NO_CONTENT_CHILD_NAT as natural width/height
@@ -275,6 +277,8 @@ typedef struct
 
   guint    hide_on_close             : 1;
   guint    in_emit_close_request     : 1;
+  guint    record_frame_phases       : 1;
+  guint    layout_deferred           : 1;
 
   GdkSurfaceTypeHint type_hint;
 
@@ -290,6 +294,14 @@ typedef struct
   GskRenderer *renderer;
 
   GList *foci;
+
+  GQueue frame_phases;
+  gint64 pending_input_time;
+  guint  n_pending_input_events;
+
+  gint64 layout_budget;
+  guint  layout_budget_overruns;
+  gulong after_paint_handler;
 } GtkWindowPrivate;
 
 #ifdef GDK_WINDOWING_X11
@@ -1300,6 +1312,304 @@ gtk_window_is_maximized (GtkWindow *window)
   return priv->maximized;
 }
 
+/**
+ * gtk_window_set_record_frame_phases:
+ * @window: a #GtkWindow
+ * @record: %TRUE to record frame phases
+ *
+ * Sets whether @window records how the time of each of its frames is
+ * split between style validation, size requisition and allocation,
+ * snapshotting and rendering, and which input events each frame
+ * shows the results of. The records of recent frames can be
+ * retrieved with gtk_window_get_frame_phase_timings().
+ *
+ * Recording adds a small overhead to every widget that gets measured,
+ * allocated or snapshot, so it is off by default.
+ */
+void
+gtk_window_set_record_frame_phases (GtkWindow *window,
+                                    gboolean   record)
+{
+  GtkWindowPrivate *priv = gtk_window_get_instance_private (window);
+
+  g_return_if_fail (GTK_IS_WINDOW (window));
+
+  record = record != FALSE;
+
+  if (priv->record_frame_phases == record)
+    return;
+
+  priv->record_frame_phases = record;
+
+  if (!record)
+    {
+      g_queue_clear_full (&priv->frame_phases, (GDestroyNotify) gtk_frame_phase_timings_unref);
+      priv->pending_input_time = 0;
+      priv->n_pending_input_events = 0;
+    }
+}
+
+/**
+ * gtk_window_get_record_frame_phases:
+ * @window: a #GtkWindow
+ *
+ * Returns whether @window records frame phases.
+ * See gtk_window_set_record_frame_phases().
+ *
+ * Returns: %TRUE if frame phases are recorded
+ */
+gboolean
+gtk_window_get_record_frame_phases (GtkWindow *window)
+{
+  GtkWindowPrivate *priv = gtk_window_get_instance_private (window);
+
+  g_return_val_if_fail (GTK_IS_WINDOW (window), FALSE);
+
+  return priv->record_frame_phases;
+}
+
+/**
+ * gtk_window_get_frame_phase_timings:
+ * @window: a #GtkWindow
+ * @frame_counter: the frame counter value identifying the frame
+ *
+ * Retrieves the #GtkFramePhaseTimings of the frame identified by
+ * @frame_counter, as returned by gdk_frame_clock_get_frame_counter().
+ * Only the last few frames are kept, and only while
+ * recording is enabled with gtk_window_set_record_frame_phases().
+ *
+ * The record of the current frame is updated while the frame is
+ * being produced, so it is best to look at the previous frame.
+ *
+ * Returns: (nullable) (transfer full): the #GtkFramePhaseTimings
+ *   of the frame, or %NULL if it is not available
+ */
+GtkFramePhaseTimings *
+gtk_window_get_frame_phase_timings (GtkWindow *window,
+                                    gint64     frame_counter)
+{
+  GtkWindowPrivate *priv = gtk_window_get_instance_private (window);
+  GList *l;
+
+  g_return_val_if_fail (GTK_IS_WINDOW (window), NULL);
+
+  for (l = priv->frame_phases.tail; l; l = l->prev)
+    {
+      GtkFramePhaseTimings *timings = l->data;
+
+      if (timings->frame_counter == frame_counter)
+        return gtk_frame_phase_timings_ref (timings);
+      if (timings->frame_counter < frame_counter)
+        break;
+    }
+
+  return NULL;
+}
+
+/*
+ * gtk_window_begin_frame_phases:
+ * @window: a #GtkWindow
+ *
+ * Makes the record of the frame that @window is currently producing
+ * the one that gtk_frame_phase_begin() adds to, if @window records
+ * frame phases.
+ *
+ * Returns: the previous record, to pass to gtk_window_end_frame_phases()
+ */
+GtkFramePhaseTimings *
+gtk_window_begin_frame_phases (GtkWindow *window)
+{
+  GtkWindowPrivate *priv = gtk_window_get_instance_private (window);
+  GtkFramePhaseTimings *previous = gtk_frame_phase_timings_current;
+  GtkFramePhaseTimings *timings;
+  GdkFrameClock *frame_clock;
+  gint64 frame_counter;
+
+  if (G_LIKELY (!priv->record_frame_phases))
+    {
+      gtk_frame_phase_timings_current = NULL;
+      return previous;
+    }
+
+  frame_clock = gtk_widget_get_frame_clock (GTK_WIDGET (window));
+  frame_counter = frame_clock ? gdk_frame_clock_get_frame_counter (frame_clock) : 0;
+
+  timings = g_queue_peek_tail (&priv->frame_phases);
+  if (timings == NULL || timings->frame_counter != frame_counter)
+    {
+      timings = gtk_frame_phase_timings_new (frame_counter);
+      timings->input_time = priv->pending_input_time;
+      timings->n_input_events = priv->n_pending_input_events;
+      priv->pending_input_time = 0;
+      priv->n_pending_input_events = 0;
+      g_queue_push_tail (&priv->frame_phases, timings);
+      if (g_queue_get_length (&priv->frame_phases) > FRAME_PHASES_HISTORY)
+        gtk_frame_phase_timings_unref (g_queue_pop_head (&priv->frame_phases));
+    }
+
+  gtk_frame_phase_timings_current = timings;
+
+  return previous;
+}
+
+void
+gtk_window_end_frame_phases (GtkWindow            *window,
+                             GtkFramePhaseTimings *previous)
+{
+  gtk_frame_phase_timings_current = previous;
+}
+
+/*
+ * gtk_window_add_input_event:
+ * @window: a #GtkWindow
+ * @receive_time: when GTK started handling the event
+ *
+ * Charges an input event that was just handled to the next frame
+ * of @window, if @window records frame phases and the event caused
+ * widgets to be redrawn or resized. Events that did not change
+ * anything do not wait for a frame, so they are not counted.
+ */
+void
+gtk_window_add_input_event (GtkWindow *window,
+                            gint64     receive_time)
+{
+  GtkWindowPrivate *priv = gtk_window_get_instance_private (window);
+  GtkWidget *widget = GTK_WIDGET (window);
+
+  if (G_LIKELY (!priv->record_frame_phases))
+    return;
+
+  if (!widget->priv->draw_needed &&
+      !_gtk_widget_get_resize_needed (widget) &&
+      !_gtk_widget_get_alloc_needed (widget))
+    return;
+
+  if (priv->n_pending_input_events == 0)
+    priv->pending_input_time = receive_time;
+  priv->n_pending_input_events++;
+}
+
+/**
+ * gtk_window_set_layout_budget:
+ * @window: a #GtkWindow
+ * @budget: the time in microseconds, or 0 for no limit
+ *
+ * Limits how long @window spends allocating widgets in a frame. When
+ * the budget is used up, widgets whose size did not change and that
+ * were not reached yet keep their old allocation and contents. They
+ * are allocated in the next frame, so the frame can be painted and
+ * other windows sharing the frame clock are not held up.
+ *
+ * Widgets whose size changes are always allocated completely. The
+ * number of frames that ran out of budget can be retrieved with
+ * gtk_window_get_layout_budget_overruns().
+ */
+void
+gtk_window_set_layout_budget (GtkWindow *window,
+                              gint64     budget)
+{
+  GtkWindowPrivate *priv = gtk_window_get_instance_private (window);
+
+  g_return_if_fail (GTK_IS_WINDOW (window));
+  g_return_if_fail (budget >= 0);
+
+  priv->layout_budget = budget;
+}
+
+/**
+ * gtk_window_get_layout_budget:
+ * @window: a #GtkWindow
+ *
+ * Returns the layout budget set with gtk_window_set_layout_budget().
+ *
+ * Returns: the budget in microseconds, or 0 if there is none
+ */
+gint64
+gtk_window_get_layout_budget (GtkWindow *window)
+{
+  GtkWindowPrivate *priv = gtk_window_get_instance_private (window);
+
+  g_return_val_if_fail (GTK_IS_WINDOW (window), 0);
+
+  return priv->layout_budget;
+}
+
+/**
+ * gtk_window_get_layout_budget_overruns:
+ * @window: a #GtkWindow
+ *
+ * Returns how many frames of @window left allocations for the next
+ * frame because the layout budget was used up.
+ *
+ * Returns: the number of frames
+ */
+guint
+gtk_window_get_layout_budget_overruns (GtkWindow *window)
+{
+  GtkWindowPrivate *priv = gtk_window_get_instance_private (window);
+
+  g_return_val_if_fail (GTK_IS_WINDOW (window), 0);
+
+  return priv->layout_budget_overruns;
+}
+
+gboolean
+gtk_window_get_layout_deferred (GtkWindow *window)
+{
+  GtkWindowPrivate *priv = gtk_window_get_instance_private (window);
+
+  return priv->layout_deferred;
+}
+
+static void
+stop_deferred_layout (GtkWindow *window)
+{
+  GtkWindowPrivate *priv = gtk_window_get_instance_private (window);
+
+  if (priv->after_paint_handler != 0)
+    {
+      g_signal_handler_disconnect (gtk_widget_get_frame_clock (GTK_WIDGET (window)),
+                                   priv->after_paint_handler);
+      priv->after_paint_handler = 0;
+    }
+
+  priv->layout_deferred = FALSE;
+}
+
+static void
+deferred_layout_after_paint (GdkFrameClock *clock,
+                             GtkWindow     *window)
+{
+  stop_deferred_layout (window);
+
+  /* Asking for the layout phase before the paint would have done the
+   * remaining work in the same frame.
+   */
+  gdk_frame_clock_request_phase (clock, GDK_FRAME_CLOCK_PHASE_LAYOUT);
+}
+
+static void
+gtk_window_defer_layout (GtkWindow *window)
+{
+  GtkWindowPrivate *priv = gtk_window_get_instance_private (window);
+  GdkFrameClock *clock;
+
+  priv->layout_budget_overruns++;
+
+  if (priv->layout_deferred)
+    return;
+
+  clock = gtk_widget_get_frame_clock (GTK_WIDGET (window));
+  if (clock == NULL)
+    return;
+
+  priv->layout_deferred = TRUE;
+  priv->after_paint_handler = g_signal_connect (clock, "after-paint",
+                                                G_CALLBACK (deferred_layout_after_paint),
+                                                window);
+  gdk_frame_clock_request_phase (clock, GDK_FRAME_CLOCK_PHASE_AFTER_PAINT);
+}
+
 void
 _gtk_window_toggle_maximized (GtkWindow *window)
 {
@@ -1581,9 +1891,7 @@ drag_gesture_update_cb (GtkGestureDrag *gesture,
   GtkSettings *settings;
 
   settings = gtk_widget_get_settings (GTK_WIDGET (window));
-  g_object_get (settings,
-                "gtk-double-click-distance", &double_click_distance,
-                NULL);
+  double_click_distance = gtk_settings_get_values (settings)->double_click_distance;
 
   if (ABS (offset_x) > double_click_distance ||
       ABS (offset_y) > double_click_distance)
@@ -5603,6 +5911,8 @@ gtk_window_finalize (GObject *object)
 
   g_clear_object (&priv->renderer);
 
+  g_queue_clear_full (&priv->frame_phases, (GDestroyNotify) gtk_frame_phase_timings_unref);
+
   G_OBJECT_CLASS (gtk_window_parent_class)->finalize (object);
 }
 
@@ -6603,6 +6913,8 @@ gtk_window_unrealize (GtkWidget *widget)
       priv->popup_menu = NULL;
     }
 
+  stop_deferred_layout (window);
+
   /* Icons */
   gtk_window_unrealize_icon (window);
 
@@ -7207,10 +7519,21 @@ gtk_window_remove (GtkContainer *container,
 void
 gtk_window_check_resize (GtkWindow *self)
 {
+  GtkWindowPrivate *priv = gtk_window_get_instance_private (self);
   GtkWidget *widget = GTK_WIDGET (self);
 
   if (!_gtk_widget_get_alloc_needed (widget))
-    gtk_widget_ensure_allocate (widget);
+    {
+      if (priv->layout_budget > 0)
+        {
+          gtk_widget_push_layout_deadline (g_get_monotonic_time () + priv->layout_budget);
+          gtk_widget_ensure_allocate (widget);
+          if (gtk_widget_pop_layout_deadline ())
+            gtk_window_defer_layout (self);
+        }
+      else
+        gtk_widget_ensure_allocate (widget);
+    }
   else if (gtk_widget_get_visible (widget))
     gtk_window_move_resize (self);
 }
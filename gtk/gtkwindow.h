@@ -33,6 +33,7 @@
 #include <gtk/gtkapplication.h>
 #include <gtk/gtkaccelgroup.h>
 #include <gtk/gtkbin.h>
+#include <gtk/gtkframephasetimings.h>
 
 G_BEGIN_DECLS
 
@@ -424,6 +425,24 @@ gboolean gtk_window_is_maximized           (GtkWindow    *window);
 GDK_AVAILABLE_IN_ALL
 void     gtk_window_set_interactive_debugging (gboolean enable);
 
+GDK_AVAILABLE_IN_ALL
+void     gtk_window_set_record_frame_phases (GtkWindow    *window,
+                                             gboolean      record);
+GDK_AVAILABLE_IN_ALL
+gboolean gtk_window_get_record_frame_phases (GtkWindow    *window);
+GDK_AVAILABLE_IN_ALL
+GtkFramePhaseTimings *
+         gtk_window_get_frame_phase_timings (GtkWindow    *window,
+                                             gint64        frame_counter);
+
+GDK_AVAILABLE_IN_ALL
+void     gtk_window_set_layout_budget       (GtkWindow    *window,
+                                             gint64        budget);
+GDK_AVAILABLE_IN_ALL
+gint64   gtk_window_get_layout_budget       (GtkWindow    *window);
+GDK_AVAILABLE_IN_ALL
+guint    gtk_window_get_layout_budget_overruns (GtkWindow *window);
+
 G_DEFINE_AUTOPTR_CLEANUP_FUNC(GtkWindow, g_object_unref)
 G_DEFINE_AUTOPTR_CLEANUP_FUNC(GtkWindowGroup, g_object_unref)
 
@@ -163,6 +163,14 @@ void             gtk_window_maybe_update_cursor (GtkWindow *window,
                                                  GtkWidget *widget,
                                                  GdkDevice *device);
 
+GtkFramePhaseTimings *
+                 gtk_window_begin_frame_phases  (GtkWindow            *window);
+void             gtk_window_end_frame_phases    (GtkWindow            *window,
+                                                 GtkFramePhaseTimings *previous);
+void             gtk_window_add_input_event     (GtkWindow            *window,
+                                                 gint64                receive_time);
+gboolean         gtk_window_get_layout_deferred (GtkWindow            *window);
+
 G_END_DECLS
 
 #endif /* __GTK_WINDOW_PRIVATE_H__ */
@@ -27,17 +27,20 @@ struct _GtkTreeModelCssNodePrivate
   GType                        *column_types;
 
   GtkCssNode                   *root;
-};
 
-static void gtk_tree_model_css_node_connect_node    (GtkTreeModelCssNode *model,
-                                                     GtkCssNode          *node,
-                                                     gboolean             emit_signal);
+  GHashTable                   *tracked;        /* node => refs from the view */
+  GHashTable                   *pending;        /* nodes to emit ::row-changed for */
+  guint                         pending_id;
+};
 
-static void gtk_tree_model_css_node_disconnect_node (GtkTreeModelCssNode *model,
-                                                     GtkCssNode          *node,
-                                                     gboolean             emit_signal,
-                                                     GtkCssNode          *parent,
-                                                     GtkCssNode          *previous);
+static void gtk_tree_model_css_node_untrack         (GtkTreeModelCssNode *model,
+                                                     GtkCssNode          *node);
+static void gtk_tree_model_css_node_untrack_node    (GtkTreeModelCssNode *model,
+                                                     GtkCssNode          *node);
+static void gtk_tree_model_css_node_ref_node        (GtkTreeModel        *tree_model,
+                                                     GtkTreeIter         *iter);
+static void gtk_tree_model_css_node_unref_node      (GtkTreeModel        *tree_model,
+                                                     GtkTreeIter         *iter);
 
 static void gtk_tree_model_css_node_tree_model_init (GtkTreeModelIface   *iface);
 
@@ -331,6 +334,8 @@ gtk_tree_model_css_node_tree_model_init (GtkTreeModelIface *iface)
   iface->iter_n_children = gtk_tree_model_css_node_iter_n_children;
   iface->iter_nth_child = gtk_tree_model_css_node_iter_nth_child;
   iface->iter_parent = gtk_tree_model_css_node_iter_parent;
+  iface->ref_node = gtk_tree_model_css_node_ref_node;
+  iface->unref_node = gtk_tree_model_css_node_unref_node;
 }
 
 static void
@@ -338,12 +343,22 @@ gtk_tree_model_css_node_finalize (GObject *object)
 {
   GtkTreeModelCssNode *model = GTK_TREE_MODEL_CSS_NODE (object);
   GtkTreeModelCssNodePrivate *priv = model->priv;
+  GHashTableIter iter;
+  gpointer node;
 
-  if (priv->root)
+  g_hash_table_iter_init (&iter, priv->tracked);
+  while (g_hash_table_iter_next (&iter, &node, NULL))
     {
-      gtk_tree_model_css_node_disconnect_node (model, priv->root, FALSE, NULL, NULL);
-      priv->root = NULL;
+      g_hash_table_iter_remove (&iter);
+      gtk_tree_model_css_node_untrack_node (model, node);
     }
+  g_hash_table_unref (priv->tracked);
+  g_hash_table_unref (priv->pending);
+
+  if (priv->pending_id)
+    g_source_remove (priv->pending_id);
+
+  g_clear_object (&priv->root);
 
   G_OBJECT_CLASS (gtk_tree_model_css_node_parent_class)->finalize (object);
 }
@@ -360,6 +375,8 @@ static void
 gtk_tree_model_css_node_init (GtkTreeModelCssNode *nodemodel)
 {
   nodemodel->priv = gtk_tree_model_css_node_get_instance_private (nodemodel);
+  nodemodel->priv->tracked = g_hash_table_new (NULL, NULL);
+  nodemodel->priv->pending = g_hash_table_new (NULL, NULL);
 }
 
 GtkTreeModel *
@@ -414,13 +431,44 @@ gtk_tree_model_css_node_newv (GtkTreeModelCssNodeGetFunc  get_func,
   return GTK_TREE_MODEL (result);
 }
 
+/*
+ * Only the rows that the view has built are watched: the view refs
+ * them with gtk_tree_model_ref_node(). Changes to nodes in collapsed
+ * parts of the tree can't be seen anyway, and a large application has
+ * far more of those. Changes to watched rows are emitted in batches
+ * from an idle handler, styles tend to change many times in a row.
+ */
+
+static void
+queue_row_changed (GtkTreeModelCssNode *model,
+                   GtkCssNode          *node);
+
 static void
 child_added_cb (GtkCssNode          *node,
                 GtkCssNode          *child,
                 GtkCssNode          *previous,
                 GtkTreeModelCssNode *model)
 {
-  gtk_tree_model_css_node_connect_node (model, child, TRUE);
+  GtkTreeIter iter;
+  GtkTreePath *path;
+
+  if (gtk_css_node_get_previous_sibling (child) == NULL &&
+      gtk_css_node_get_next_sibling (child) == NULL)
+    {
+      /* We're the first child of the parent */
+      gtk_tree_model_css_node_get_iter_from_node (model, &iter, node);
+      path = gtk_tree_model_css_node_get_path (GTK_TREE_MODEL (model), &iter);
+      gtk_tree_model_row_has_child_toggled (GTK_TREE_MODEL (model), path, &iter);
+      gtk_tree_path_free (path);
+    }
+
+  gtk_tree_model_css_node_get_iter_from_node (model, &iter, child);
+  path = gtk_tree_model_css_node_get_path (GTK_TREE_MODEL (model), &iter);
+  gtk_tree_model_row_inserted (GTK_TREE_MODEL (model), path, &iter);
+  if (gtk_css_node_get_first_child (child))
+    gtk_tree_model_row_has_child_toggled (GTK_TREE_MODEL (model), path, &iter);
+
+  gtk_tree_path_free (path);
 }
 
 static void
@@ -428,147 +476,184 @@ child_removed_cb (GtkCssNode          *node,
                   GtkCssNode          *child,
                   GtkCssNode          *previous,
                   GtkTreeModelCssNode *model)
-{
-  gtk_tree_model_css_node_disconnect_node (model, child, TRUE, node, previous);
-}
-
-static void
-notify_cb (GtkCssNode          *node,
-           GParamSpec          *pspec,
-           GtkTreeModelCssNode *model)
 {
   GtkTreeIter iter;
   GtkTreePath *path;
 
+  /* The view drops its references for deleted rows */
+  gtk_tree_model_css_node_untrack (model, child);
+
   gtk_tree_model_css_node_get_iter_from_node (model, &iter, node);
   path = gtk_tree_model_css_node_get_path (GTK_TREE_MODEL (model), &iter);
+  if (previous)
+    gtk_tree_path_append_index (path, get_node_index (previous) + 1);
+  else
+    gtk_tree_path_append_index (path, 0);
 
-  gtk_tree_model_row_changed (GTK_TREE_MODEL (model), path, &iter);
+  gtk_tree_model_row_deleted (GTK_TREE_MODEL (model), path);
+
+  if (gtk_css_node_get_first_child (node) == NULL)
+    {
+      gtk_tree_path_up (path);
+      gtk_tree_model_row_has_child_toggled (GTK_TREE_MODEL (model), path, &iter);
+    }
 
   gtk_tree_path_free (path);
 }
 
+static void
+notify_cb (GtkCssNode          *node,
+           GParamSpec          *pspec,
+           GtkTreeModelCssNode *model)
+{
+  queue_row_changed (model, node);
+}
+
 static void
 style_changed_cb (GtkCssNode          *node,
                   GtkCssStyleChange   *change,
                   GtkTreeModelCssNode *model)
 {
-  GtkTreeIter iter;
-  GtkTreePath *path;
-
-  gtk_tree_model_css_node_get_iter_from_node (model, &iter, node);
-  path = gtk_tree_model_css_node_get_path (GTK_TREE_MODEL (model), &iter);
-
-  gtk_tree_model_row_changed (GTK_TREE_MODEL (model), path, &iter);
-
-  gtk_tree_path_free (path);
+  queue_row_changed (model, node);
 }
 
-static void
-gtk_tree_model_css_node_connect_node (GtkTreeModelCssNode *model,
-                                      GtkCssNode          *node,
-                                      gboolean             emit_signal)
+static gboolean
+emit_row_changed (gpointer data)
 {
-  GtkCssNode *child;
-
-  if (GTK_IS_CSS_TRANSIENT_NODE (node))
-    return;
-
-  g_object_ref (node);
+  GtkTreeModelCssNode *model = data;
+  GtkTreeModelCssNodePrivate *priv = model->priv;
+  GHashTable *pending;
+  GHashTableIter hash_iter;
+  gpointer node;
 
-  g_signal_connect_after (node, "node-added", G_CALLBACK (child_added_cb), model);
-  g_signal_connect_after (node, "node-removed", G_CALLBACK (child_removed_cb), model);
-  g_signal_connect_after (node, "notify", G_CALLBACK (notify_cb), model);
-  g_signal_connect_after (node, "style-changed", G_CALLBACK (style_changed_cb), model);
+  priv->pending_id = 0;
 
-  for (child = gtk_css_node_get_first_child (node);
-       child;
-       child = gtk_css_node_get_next_sibling (child))
-    {
-      gtk_tree_model_css_node_connect_node (model, child, FALSE);
-    }
+  /* Handlers may queue more changes */
+  pending = priv->pending;
+  priv->pending = g_hash_table_new (NULL, NULL);
 
-  if (emit_signal)
+  g_hash_table_iter_init (&hash_iter, pending);
+  while (g_hash_table_iter_next (&hash_iter, &node, NULL))
     {
       GtkTreeIter iter;
       GtkTreePath *path;
 
-      if (node != model->priv->root &&
-          gtk_css_node_get_previous_sibling (node) == NULL &&
-          gtk_css_node_get_next_sibling (node) == NULL)
-        {
-          /* We're the first child of the parent */
-          gtk_tree_model_css_node_get_iter_from_node (model, &iter, gtk_css_node_get_parent (node));
-          path = gtk_tree_model_css_node_get_path (GTK_TREE_MODEL (model), &iter);
-          gtk_tree_model_row_has_child_toggled (GTK_TREE_MODEL (model), path, &iter);
-          gtk_tree_path_free (path);
-        }
+      /* Untracked while emitting for an earlier one */
+      if (!g_hash_table_contains (priv->tracked, node))
+        continue;
 
       gtk_tree_model_css_node_get_iter_from_node (model, &iter, node);
       path = gtk_tree_model_css_node_get_path (GTK_TREE_MODEL (model), &iter);
-      gtk_tree_model_row_inserted (GTK_TREE_MODEL (model), path, &iter);
-      if (gtk_css_node_get_first_child (node))
-        gtk_tree_model_row_has_child_toggled (GTK_TREE_MODEL (model), path, &iter);
-
+      gtk_tree_model_row_changed (GTK_TREE_MODEL (model), path, &iter);
       gtk_tree_path_free (path);
     }
+
+  g_hash_table_unref (pending);
+
+  return G_SOURCE_REMOVE;
 }
 
 static void
-gtk_tree_model_css_node_disconnect_node (GtkTreeModelCssNode *model,
-                                         GtkCssNode          *node,
-                                         gboolean             emit_signal,
-                                         GtkCssNode          *parent,
-                                         GtkCssNode          *previous)
+queue_row_changed (GtkTreeModelCssNode *model,
+                   GtkCssNode          *node)
 {
-  GtkCssNode *child;
+  GtkTreeModelCssNodePrivate *priv = model->priv;
 
-  if (GTK_IS_CSS_TRANSIENT_NODE (node))
-    return;
+  g_hash_table_add (priv->pending, node);
+
+  if (priv->pending_id == 0)
+    {
+      priv->pending_id = g_idle_add (emit_row_changed, model);
+      g_source_set_name_by_id (priv->pending_id, "[gtk] emit_row_changed");
+    }
+}
+
+static void
+gtk_tree_model_css_node_track (GtkTreeModelCssNode *model,
+                               GtkCssNode          *node)
+{
+  g_object_ref (node);
 
+  g_signal_connect_after (node, "node-added", G_CALLBACK (child_added_cb), model);
+  g_signal_connect_after (node, "node-removed", G_CALLBACK (child_removed_cb), model);
+  g_signal_connect_after (node, "notify", G_CALLBACK (notify_cb), model);
+  g_signal_connect_after (node, "style-changed", G_CALLBACK (style_changed_cb), model);
+}
+
+static void
+gtk_tree_model_css_node_untrack_node (GtkTreeModelCssNode *model,
+                                      GtkCssNode          *node)
+{
   g_signal_handlers_disconnect_by_func (node, G_CALLBACK (child_added_cb), model);
   g_signal_handlers_disconnect_by_func (node, G_CALLBACK (child_removed_cb), model);
   g_signal_handlers_disconnect_by_func (node, G_CALLBACK (notify_cb), model);
   g_signal_handlers_disconnect_by_func (node, G_CALLBACK (style_changed_cb), model);
 
+  g_hash_table_remove (model->priv->pending, node);
+
+  g_object_unref (node);
+}
+
+/* Forgets about @node and its descendants, when they are removed */
+static void
+gtk_tree_model_css_node_untrack (GtkTreeModelCssNode *model,
+                                 GtkCssNode          *node)
+{
+  GtkCssNode *child;
+
+  /* The view only builds the children of rows it has built */
+  if (!g_hash_table_remove (model->priv->tracked, node))
+    return;
+
   for (child = gtk_css_node_get_first_child (node);
        child;
        child = gtk_css_node_get_next_sibling (child))
     {
-      gtk_tree_model_css_node_disconnect_node (model, child, FALSE, NULL, NULL);
+      gtk_tree_model_css_node_untrack (model, child);
     }
 
-  if (emit_signal)
-    {
-      GtkTreeIter iter;
-      GtkTreePath *path;
+  gtk_tree_model_css_node_untrack_node (model, node);
+}
 
-      if (parent)
-        {
-          gtk_tree_model_css_node_get_iter_from_node (model, &iter, parent);
-          path = gtk_tree_model_css_node_get_path (GTK_TREE_MODEL (model), &iter);
-        }
-      else
-        {
-          path = gtk_tree_path_new ();
-        }
-      if (previous)
-        gtk_tree_path_append_index (path, get_node_index (previous) + 1);
-      else
-        gtk_tree_path_append_index (path, 0);
+static void
+gtk_tree_model_css_node_ref_node (GtkTreeModel *tree_model,
+                                  GtkTreeIter  *iter)
+{
+  GtkTreeModelCssNode *model = GTK_TREE_MODEL_CSS_NODE (tree_model);
+  GtkCssNode *node = iter->user_data2;
+  guint count;
 
-      gtk_tree_model_row_deleted (GTK_TREE_MODEL (model), path);
+  if (GTK_IS_CSS_TRANSIENT_NODE (node))
+    return;
 
-      if (parent && gtk_css_node_get_first_child (parent) == NULL)
-        {
-          gtk_tree_path_up (path);
-          gtk_tree_model_row_has_child_toggled (GTK_TREE_MODEL (model), path, &iter);
-        }
+  count = GPOINTER_TO_UINT (g_hash_table_lookup (model->priv->tracked, node));
+  if (count == 0)
+    gtk_tree_model_css_node_track (model, node);
 
-      gtk_tree_path_free (path);
+  g_hash_table_insert (model->priv->tracked, node, GUINT_TO_POINTER (count + 1));
+}
+
+static void
+gtk_tree_model_css_node_unref_node (GtkTreeModel *tree_model,
+                                    GtkTreeIter  *iter)
+{
+  GtkTreeModelCssNode *model = GTK_TREE_MODEL_CSS_NODE (tree_model);
+  GtkCssNode *node = iter->user_data2;
+  guint count;
+
+  /* Untracked already when it was removed */
+  count = GPOINTER_TO_UINT (g_hash_table_lookup (model->priv->tracked, node));
+  if (count == 0)
+    return;
+
+  if (count > 1)
+    {
+      g_hash_table_insert (model->priv->tracked, node, GUINT_TO_POINTER (count - 1));
+      return;
     }
-  
-  g_object_unref (node);
+
+  g_hash_table_remove (model->priv->tracked, node);
+  gtk_tree_model_css_node_untrack_node (model, node);
 }
 
 void
@@ -576,6 +661,8 @@ gtk_tree_model_css_node_set_root_node (GtkTreeModelCssNode *model,
                                        GtkCssNode          *node)
 {
   GtkTreeModelCssNodePrivate *priv;
+  GtkTreePath *path;
+  GtkTreeIter iter;
 
   g_return_if_fail (GTK_IS_TREE_MODEL_CSS_NODE (model));
   g_return_if_fail (node == NULL || GTK_IS_CSS_NODE (node));
@@ -587,14 +674,24 @@ gtk_tree_model_css_node_set_root_node (GtkTreeModelCssNode *model,
 
   if (priv->root)
     {
-      gtk_tree_model_css_node_disconnect_node (model, priv->root, TRUE, NULL, NULL);
-      priv->root = NULL;
+      gtk_tree_model_css_node_untrack (model, priv->root);
+      g_clear_object (&priv->root);
+
+      path = gtk_tree_path_new_first ();
+      gtk_tree_model_row_deleted (GTK_TREE_MODEL (model), path);
+      gtk_tree_path_free (path);
     }
 
   if (node)
     {
-      priv->root = node;
-      gtk_tree_model_css_node_connect_node (model, node, TRUE);
+      priv->root = g_object_ref (node);
+
+      gtk_tree_model_css_node_get_iter_from_node (model, &iter, node);
+      path = gtk_tree_path_new_first ();
+      gtk_tree_model_row_inserted (GTK_TREE_MODEL (model), path, &iter);
+      if (gtk_css_node_get_first_child (node))
+        gtk_tree_model_row_has_child_toggled (GTK_TREE_MODEL (model), path, &iter);
+      gtk_tree_path_free (path);
     }
 }
 
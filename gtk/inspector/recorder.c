@@ -42,6 +42,7 @@
 #include "gtk/gtkrendernodepaintableprivate.h"
 
 #include "recording.h"
+#include "recordingspool.h"
 #include "renderrecording.h"
 #include "startrecording.h"
 
@@ -60,6 +61,9 @@ struct _GtkInspectorRecorderPrivate
   GtkInspectorRecording *recording; /* start recording if recording or NULL if not */
 
   gboolean debug_nodes;
+
+  gboolean stream_to_disk;
+  GtkInspectorRecordingSpool *spool; /* created with the first frame that is streamed */
 };
 
 enum
@@ -67,6 +71,7 @@ enum
   PROP_0,
   PROP_RECORDING,
   PROP_DEBUG_NODES,
+  PROP_STREAM_TO_DISK,
   LAST_PROP
 };
 
@@ -195,6 +200,9 @@ recordings_clear_all (GtkButton            *button,
   GtkInspectorRecorderPrivate *priv = gtk_inspector_recorder_get_instance_private (recorder);
 
   g_list_store_remove_all (G_LIST_STORE (priv->recordings));
+
+  /* Start over with an empty file, once the recordings are gone */
+  g_clear_pointer (&priv->spool, gtk_inspector_recording_spool_unref);
 }
 
 static const char *
@@ -368,7 +376,8 @@ recordings_list_row_selected (GtkListBox           *box,
 
   g_clear_object (&priv->render_node_model);
 
-  if (GTK_INSPECTOR_IS_RENDER_RECORDING (recording))
+  if (GTK_INSPECTOR_IS_RENDER_RECORDING (recording) &&
+      gtk_inspector_render_recording_get_node (GTK_INSPECTOR_RENDER_RECORDING (recording)) != NULL)
     {
       GListStore *root_model;
       graphene_rect_t bounds;
@@ -1039,6 +1048,110 @@ render_node_save (GtkButton            *button,
   gtk_widget_show (dialog);
 }
 
+static GBytes *
+serialize_frame_timings (GListModel *recordings)
+{
+  GString *string;
+  GtkFramePhase phase;
+  guint i;
+
+  string = g_string_new ("frame,timestamp,input_events,input_time,input_latency,"
+                         "style,measure,allocate,snapshot\n");
+
+  for (i = 0; i < g_list_model_get_n_items (recordings); i++)
+    {
+      GtkInspectorRecording *recording = g_list_model_get_item (recordings, i);
+      GtkFramePhaseTimings *timings;
+
+      if (GTK_INSPECTOR_IS_RENDER_RECORDING (recording))
+        {
+          timings = gtk_inspector_render_recording_get_frame_phase_timings (GTK_INSPECTOR_RENDER_RECORDING (recording));
+          if (timings)
+            {
+              g_string_append_printf (string,
+                                      "%" G_GINT64_FORMAT ",%" G_GINT64_FORMAT ",%u,%" G_GINT64_FORMAT ",%" G_GINT64_FORMAT,
+                                      gtk_frame_phase_timings_get_frame_counter (timings),
+                                      gtk_inspector_recording_get_timestamp (recording),
+                                      gtk_frame_phase_timings_get_n_input_events (timings),
+                                      gtk_frame_phase_timings_get_input_time (timings),
+                                      gtk_inspector_render_recording_get_input_latency (GTK_INSPECTOR_RENDER_RECORDING (recording)));
+              for (phase = GTK_FRAME_PHASE_STYLE; phase < GTK_FRAME_PHASE_RENDER; phase++)
+                g_string_append_printf (string, ",%" G_GINT64_FORMAT,
+                                        gtk_frame_phase_timings_get_phase_duration (timings, phase));
+              g_string_append_c (string, '\n');
+            }
+        }
+
+      g_object_unref (recording);
+    }
+
+  return g_string_free_to_bytes (string);
+}
+
+static void
+frame_timings_save_response (GtkWidget            *dialog,
+                             gint                  response,
+                             GtkInspectorRecorder *recorder)
+{
+  GtkInspectorRecorderPrivate *priv = gtk_inspector_recorder_get_instance_private (recorder);
+
+  gtk_widget_hide (dialog);
+
+  if (response == GTK_RESPONSE_ACCEPT)
+    {
+      GBytes *bytes = serialize_frame_timings (priv->recordings);
+      GError *error = NULL;
+
+      if (!g_file_replace_contents (gtk_file_chooser_get_file (GTK_FILE_CHOOSER (dialog)),
+                                    g_bytes_get_data (bytes, NULL),
+                                    g_bytes_get_size (bytes),
+                                    NULL,
+                                    FALSE,
+                                    0,
+                                    NULL,
+                                    NULL,
+                                    &error))
+        {
+          GtkWidget *message_dialog;
+
+          message_dialog = gtk_message_dialog_new (GTK_WINDOW (gtk_window_get_transient_for (GTK_WINDOW (dialog))),
+                                                   GTK_DIALOG_MODAL|GTK_DIALOG_DESTROY_WITH_PARENT,
+                                                   GTK_MESSAGE_INFO,
+                                                   GTK_BUTTONS_OK,
+                                                   _("Saving frame timings failed"));
+          gtk_message_dialog_format_secondary_text (GTK_MESSAGE_DIALOG (message_dialog),
+                                                    "%s", error->message);
+          g_signal_connect (message_dialog, "response", G_CALLBACK (gtk_widget_destroy), NULL);
+          gtk_widget_show (message_dialog);
+          g_error_free (error);
+        }
+
+      g_bytes_unref (bytes);
+    }
+
+  gtk_widget_destroy (dialog);
+}
+
+static void
+frame_timings_save (GtkButton            *button,
+                    GtkInspectorRecorder *recorder)
+{
+  GtkWidget *dialog;
+
+  dialog = gtk_file_chooser_dialog_new ("",
+                                        GTK_WINDOW (gtk_widget_get_toplevel (GTK_WIDGET (recorder))),
+                                        GTK_FILE_CHOOSER_ACTION_SAVE,
+                                        _("_Cancel"), GTK_RESPONSE_CANCEL,
+                                        _("_Save"), GTK_RESPONSE_ACCEPT,
+                                        NULL);
+  gtk_file_chooser_set_current_name (GTK_FILE_CHOOSER (dialog), "frames.csv");
+  gtk_dialog_set_default_response (GTK_DIALOG (dialog), GTK_RESPONSE_ACCEPT);
+  gtk_window_set_modal (GTK_WINDOW (dialog), TRUE);
+  gtk_file_chooser_set_do_overwrite_confirmation (GTK_FILE_CHOOSER (dialog), TRUE);
+  g_signal_connect (dialog, "response", G_CALLBACK (frame_timings_save_response), recorder);
+  gtk_widget_show (dialog);
+}
+
 static char *
 format_timespan (gint64 timespan)
 {
@@ -1197,6 +1310,10 @@ gtk_inspector_recorder_get_property (GObject    *object,
       g_value_set_boolean (value, priv->debug_nodes);
       break;
 
+    case PROP_STREAM_TO_DISK:
+      g_value_set_boolean (value, priv->stream_to_disk);
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, param_id, pspec);
       break;
@@ -1221,6 +1338,10 @@ gtk_inspector_recorder_set_property (GObject      *object,
       gtk_inspector_recorder_set_debug_nodes (recorder, g_value_get_boolean (value));
       break;
 
+    case PROP_STREAM_TO_DISK:
+      gtk_inspector_recorder_set_stream_to_disk (recorder, g_value_get_boolean (value));
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, param_id, pspec);
       break;
@@ -1234,6 +1355,7 @@ gtk_inspector_recorder_dispose (GObject *object)
   GtkInspectorRecorderPrivate *priv = gtk_inspector_recorder_get_instance_private (recorder);
 
   g_clear_object (&priv->render_node_model);
+  g_clear_pointer (&priv->spool, gtk_inspector_recording_spool_unref);
 
   G_OBJECT_CLASS (gtk_inspector_recorder_parent_class)->dispose (object);
 }
@@ -1260,6 +1382,12 @@ gtk_inspector_recorder_class_init (GtkInspectorRecorderClass *klass)
                           "Whether to insert extra debug nodes in the tree",
                           FALSE,
                           G_PARAM_READWRITE);
+  props[PROP_STREAM_TO_DISK] =
+    g_param_spec_boolean ("stream-to-disk",
+                          "Stream to disk",
+                          "Whether to keep recorded frames in a file instead of memory",
+                          FALSE,
+                          G_PARAM_READWRITE);
 
   g_object_class_install_properties (object_class, LAST_PROP, props);
 
@@ -1276,6 +1404,7 @@ gtk_inspector_recorder_class_init (GtkInspectorRecorderClass *klass)
   gtk_widget_class_bind_template_callback (widget_class, recordings_list_row_selected);
   gtk_widget_class_bind_template_callback (widget_class, render_node_list_selection_changed);
   gtk_widget_class_bind_template_callback (widget_class, render_node_save);
+  gtk_widget_class_bind_template_callback (widget_class, frame_timings_save);
   gtk_widget_class_bind_template_callback (widget_class, node_property_activated);
 }
 
@@ -1322,6 +1451,36 @@ gtk_inspector_recorder_add_recording (GtkInspectorRecorder  *recorder,
     }
 }
 
+static void
+record_frame_phases (GtkWidget *widget)
+{
+  GtkWindow *window = GTK_WINDOW (widget);
+
+  if (gtk_window_get_record_frame_phases (window))
+    return;
+
+  gtk_window_set_record_frame_phases (window, TRUE);
+  g_object_set_data (G_OBJECT (window), "gtk-inspector-frame-phases", GINT_TO_POINTER (TRUE));
+}
+
+static void
+stop_recording_frame_phases (void)
+{
+  GList *toplevels, *l;
+
+  /* Leave windows alone that were recording before we came along */
+  toplevels = gtk_window_list_toplevels ();
+  for (l = toplevels; l; l = l->next)
+    {
+      if (!g_object_get_data (l->data, "gtk-inspector-frame-phases"))
+        continue;
+
+      gtk_window_set_record_frame_phases (l->data, FALSE);
+      g_object_set_data (l->data, "gtk-inspector-frame-phases", NULL);
+    }
+  g_list_free (toplevels);
+}
+
 void
 gtk_inspector_recorder_set_recording (GtkInspectorRecorder *recorder,
                                       gboolean              recording)
@@ -1339,6 +1498,7 @@ gtk_inspector_recorder_set_recording (GtkInspectorRecorder *recorder,
   else
     {
       g_clear_object (&priv->recording);
+      stop_recording_frame_phases ();
     }
 
   g_object_notify_by_pspec (G_OBJECT (recorder), props[PROP_RECORDING]);
@@ -1360,23 +1520,61 @@ gtk_inspector_recorder_record_render (GtkInspectorRecorder *recorder,
                                       const cairo_region_t *region,
                                       GskRenderNode        *node)
 {
+  GtkInspectorRecorderPrivate *priv = gtk_inspector_recorder_get_instance_private (recorder);
   GtkInspectorRecording *recording;
+  GtkFramePhaseTimings *timings = NULL;
   GdkFrameClock *frame_clock;
+  gint64 input_latency = 0;
 
   if (!gtk_inspector_recorder_is_recording (recorder))
     return;
 
   frame_clock = gtk_widget_get_frame_clock (widget);
 
+  /* Windows start recording their phases with the first frame we see */
+  if (GTK_IS_WINDOW (widget))
+    {
+      timings = gtk_window_get_frame_phase_timings (GTK_WINDOW (widget),
+                                                    gdk_frame_clock_get_frame_counter (frame_clock));
+      record_frame_phases (widget);
+    }
+
+  /* The frame is not presented yet, so this is the predicted latency */
+  if (timings)
+    input_latency = gtk_frame_phase_timings_get_input_latency (timings, frame_clock);
+
   recording = gtk_inspector_render_recording_new (gdk_frame_clock_get_frame_time (frame_clock),
                                                   gsk_renderer_get_profiler (renderer),
+                                                  timings,
+                                                  input_latency,
                                                   &(GdkRectangle) { 0, 0,
                                                     gdk_surface_get_width (surface),
                                                     gdk_surface_get_height (surface) },
                                                   region,
                                                   node);
+
+  if (priv->stream_to_disk)
+    {
+      GError *error = NULL;
+
+      if (priv->spool == NULL)
+        priv->spool = gtk_inspector_recording_spool_new (&error);
+
+      if (priv->spool)
+        {
+          gtk_inspector_render_recording_spool (GTK_INSPECTOR_RENDER_RECORDING (recording), priv->spool);
+        }
+      else
+        {
+          g_warning ("Failed to create file for recorded frames: %s", error->message);
+          g_error_free (error);
+          gtk_inspector_recorder_set_stream_to_disk (recorder, FALSE);
+        }
+    }
+
   gtk_inspector_recorder_add_recording (recorder, recording);
   g_object_unref (recording);
+  g_clear_pointer (&timings, gtk_frame_phase_timings_unref);
 }
 
 void
@@ -1403,4 +1601,19 @@ gtk_inspector_recorder_set_debug_nodes (GtkInspectorRecorder *recorder,
   g_object_notify_by_pspec (G_OBJECT (recorder), props[PROP_DEBUG_NODES]);
 }
 
+void
+gtk_inspector_recorder_set_stream_to_disk (GtkInspectorRecorder *recorder,
+                                           gboolean              stream_to_disk)
+{
+  GtkInspectorRecorderPrivate *priv = gtk_inspector_recorder_get_instance_private (recorder);
+
+  if (priv->stream_to_disk == stream_to_disk)
+    return;
+
+  /* Frames that are already recorded stay where they are */
+  priv->stream_to_disk = stream_to_disk;
+
+  g_object_notify_by_pspec (G_OBJECT (recorder), props[PROP_STREAM_TO_DISK]);
+}
+
 // vim: set et sw=2 ts=2:
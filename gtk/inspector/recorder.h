@@ -51,6 +51,9 @@ gboolean        gtk_inspector_recorder_is_recording             (GtkInspectorRec
 void            gtk_inspector_recorder_set_debug_nodes          (GtkInspectorRecorder   *recorder,
                                                                  gboolean                debug_nodes);
 
+void            gtk_inspector_recorder_set_stream_to_disk       (GtkInspectorRecorder   *recorder,
+                                                                 gboolean                stream_to_disk);
+
 void            gtk_inspector_recorder_record_render            (GtkInspectorRecorder   *recorder,
                                                                  GtkWidget              *widget,
                                                                  GskRenderer            *renderer,
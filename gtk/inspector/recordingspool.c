@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "recordingspool.h"
+
+#include "renderrecording.h"
+
+/*
+ * The spool keeps the render nodes of long recordings on disk.
+ *
+ * Every node is serialized and compressed on its own and appended
+ * to a temporary file, so any frame can be read back without going
+ * through the ones before it. Only the recordings that were used last
+ * keep their node in memory, the others drop it and read it back from
+ * the file when they are selected again.
+ */
+
+/* How many recordings keep their node in memory */
+#define MAX_LOADED 8
+
+struct _GtkInspectorRecordingSpool
+{
+  int ref_count;
+
+  GFile *file;
+  GFileIOStream *stream;
+
+  /* Recordings with their node loaded, most recently used first */
+  GQueue loaded;
+};
+
+GtkInspectorRecordingSpool *
+gtk_inspector_recording_spool_new (GError **error)
+{
+  GtkInspectorRecordingSpool *spool;
+  GFileIOStream *stream;
+  GFile *file;
+
+  file = g_file_new_tmp ("gtk-inspector-XXXXXX.recording", &stream, error);
+  if (file == NULL)
+    return NULL;
+
+  spool = g_slice_new0 (GtkInspectorRecordingSpool);
+  spool->ref_count = 1;
+  spool->file = file;
+  spool->stream = stream;
+  g_queue_init (&spool->loaded);
+
+  return spool;
+}
+
+GtkInspectorRecordingSpool *
+gtk_inspector_recording_spool_ref (GtkInspectorRecordingSpool *spool)
+{
+  spool->ref_count++;
+
+  return spool;
+}
+
+void
+gtk_inspector_recording_spool_unref (GtkInspectorRecordingSpool *spool)
+{
+  spool->ref_count--;
+  if (spool->ref_count > 0)
+    return;
+
+  /* Every recording holds a reference, so none can be loaded anymore */
+  g_assert (g_queue_is_empty (&spool->loaded));
+
+  g_io_stream_close (G_IO_STREAM (spool->stream), NULL, NULL);
+  g_object_unref (spool->stream);
+  g_file_delete (spool->file, NULL, NULL);
+  g_object_unref (spool->file);
+
+  g_slice_free (GtkInspectorRecordingSpool, spool);
+}
+
+static GBytes *
+convert_bytes (GConverter  *converter,
+               GBytes      *bytes,
+               GError     **error)
+{
+  GOutputStream *memory, *stream;
+  gboolean result;
+
+  memory = g_memory_output_stream_new_resizable ();
+  stream = g_converter_output_stream_new (memory, converter);
+
+  result = g_output_stream_write_all (stream,
+                                      g_bytes_get_data (bytes, NULL),
+                                      g_bytes_get_size (bytes),
+                                      NULL, NULL, error) &&
+           g_output_stream_close (stream, NULL, error);
+
+  g_object_unref (stream);
+
+  if (!result)
+    {
+      g_object_unref (memory);
+      return NULL;
+    }
+
+  bytes = g_memory_output_stream_steal_as_bytes (G_MEMORY_OUTPUT_STREAM (memory));
+  g_object_unref (memory);
+
+  return bytes;
+}
+
+gboolean
+gtk_inspector_recording_spool_write (GtkInspectorRecordingSpool  *spool,
+                                     GskRenderNode               *node,
+                                     goffset                     *offset,
+                                     gsize                       *size,
+                                     GError                     **error)
+{
+  GZlibCompressor *compressor;
+  GBytes *bytes, *compressed;
+  GOutputStream *output;
+  gboolean result;
+
+  bytes = gsk_render_node_serialize (node);
+  compressor = g_zlib_compressor_new (G_ZLIB_COMPRESSOR_FORMAT_RAW, 1);
+  compressed = convert_bytes (G_CONVERTER (compressor), bytes, error);
+  g_object_unref (compressor);
+  g_bytes_unref (bytes);
+
+  if (compressed == NULL)
+    return FALSE;
+
+  if (!g_seekable_seek (G_SEEKABLE (spool->stream), 0, G_SEEK_END, NULL, error))
+    {
+      g_bytes_unref (compressed);
+      return FALSE;
+    }
+
+  *offset = g_seekable_tell (G_SEEKABLE (spool->stream));
+  *size = g_bytes_get_size (compressed);
+
+  output = g_io_stream_get_output_stream (G_IO_STREAM (spool->stream));
+  result = g_output_stream_write_all (output,
+                                      g_bytes_get_data (compressed, NULL),
+                                      g_bytes_get_size (compressed),
+                                      NULL, NULL, error);
+  g_bytes_unref (compressed);
+
+  return result;
+}
+
+GskRenderNode *
+gtk_inspector_recording_spool_read (GtkInspectorRecordingSpool  *spool,
+                                    goffset                      offset,
+                                    gsize                        size,
+                                    GError                     **error)
+{
+  GZlibDecompressor *decompressor;
+  GBytes *bytes, *compressed;
+  GInputStream *input;
+  GskRenderNode *node;
+  guchar *data;
+  gsize n_read;
+
+  if (!g_seekable_seek (G_SEEKABLE (spool->stream), offset, G_SEEK_SET, NULL, error))
+    return NULL;
+
+  data = g_malloc (size);
+  input = g_io_stream_get_input_stream (G_IO_STREAM (spool->stream));
+  if (!g_input_stream_read_all (input, data, size, &n_read, NULL, error))
+    {
+      g_free (data);
+      return NULL;
+    }
+
+  if (n_read != size)
+    {
+      g_set_error_literal (error, G_IO_ERROR, G_IO_ERROR_FAILED,
+                           "Recording file is truncated");
+      g_free (data);
+      return NULL;
+    }
+
+  compressed = g_bytes_new_take (data, size);
+  decompressor = g_zlib_decompressor_new (G_ZLIB_COMPRESSOR_FORMAT_RAW);
+  bytes = convert_bytes (G_CONVERTER (decompressor), compressed, error);
+  g_object_unref (decompressor);
+  g_bytes_unref (compressed);
+
+  if (bytes == NULL)
+    return NULL;
+
+  node = gsk_render_node_deserialize (bytes, error);
+  g_bytes_unref (bytes);
+
+  return node;
+}
+
+/*
+ * gtk_inspector_recording_spool_keep:
+ * @spool: a #GtkInspectorRecordingSpool
+ * @recording: a recording that was written to @spool and has its node loaded
+ *
+ * Marks the node of @recording as used. The nodes of recordings
+ * that were not used for a while are dropped.
+ */
+void
+gtk_inspector_recording_spool_keep (GtkInspectorRecordingSpool  *spool,
+                                    GtkInspectorRenderRecording *recording)
+{
+  GtkInspectorRenderRecording *old;
+  GList *link = &recording->spool_link;
+
+  if (link->data != NULL)
+    g_queue_unlink (&spool->loaded, link);
+  else
+    link->data = recording;
+
+  g_queue_push_head_link (&spool->loaded, link);
+
+  while (spool->loaded.length > MAX_LOADED)
+    {
+      old = g_queue_peek_tail (&spool->loaded);
+      g_queue_unlink (&spool->loaded, &old->spool_link);
+      old->spool_link.data = NULL;
+      g_clear_pointer (&old->node, gsk_render_node_unref);
+    }
+}
+
+void
+gtk_inspector_recording_spool_forget (GtkInspectorRecordingSpool  *spool,
+                                      GtkInspectorRenderRecording *recording)
+{
+  GList *link = &recording->spool_link;
+
+  if (link->data == NULL)
+    return;
+
+  g_queue_unlink (&spool->loaded, link);
+  link->data = NULL;
+}
+
+// vim: set et sw=2 ts=2:
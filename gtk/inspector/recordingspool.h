@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _GTK_INSPECTOR_RECORDING_SPOOL_H_
+#define _GTK_INSPECTOR_RECORDING_SPOOL_H_
+
+#include <gio/gio.h>
+#include <gsk/gsk.h>
+
+G_BEGIN_DECLS
+
+typedef struct _GtkInspectorRecordingSpool GtkInspectorRecordingSpool;
+typedef struct _GtkInspectorRenderRecording GtkInspectorRenderRecording;
+
+GtkInspectorRecordingSpool *
+                gtk_inspector_recording_spool_new            (GError                           **error);
+GtkInspectorRecordingSpool *
+                gtk_inspector_recording_spool_ref            (GtkInspectorRecordingSpool        *spool);
+void            gtk_inspector_recording_spool_unref          (GtkInspectorRecordingSpool        *spool);
+
+gboolean        gtk_inspector_recording_spool_write          (GtkInspectorRecordingSpool        *spool,
+                                                              GskRenderNode                     *node,
+                                                              goffset                           *offset,
+                                                              gsize                             *size,
+                                                              GError                           **error);
+GskRenderNode * gtk_inspector_recording_spool_read           (GtkInspectorRecordingSpool        *spool,
+                                                              goffset                            offset,
+                                                              gsize                              size,
+                                                              GError                           **error);
+
+void            gtk_inspector_recording_spool_keep           (GtkInspectorRecordingSpool        *spool,
+                                                              GtkInspectorRenderRecording       *recording);
+void            gtk_inspector_recording_spool_forget         (GtkInspectorRecordingSpool        *spool,
+                                                              GtkInspectorRenderRecording       *recording);
+
+G_END_DECLS
+
+#endif // _GTK_INSPECTOR_RECORDING_SPOOL_H_
+
+// vim: set et sw=2 ts=2:
@@ -27,9 +27,16 @@ gtk_inspector_render_recording_finalize (GObject *object)
 {
   GtkInspectorRenderRecording *recording = GTK_INSPECTOR_RENDER_RECORDING (object);
 
+  if (recording->spool)
+    {
+      gtk_inspector_recording_spool_forget (recording->spool, recording);
+      gtk_inspector_recording_spool_unref (recording->spool);
+    }
+
   g_clear_pointer (&recording->clip_region, cairo_region_destroy);
   g_clear_pointer (&recording->node, gsk_render_node_unref);
   g_clear_pointer (&recording->profiler_info, g_free);
+  g_clear_pointer (&recording->timings, gtk_frame_phase_timings_unref);
 
   G_OBJECT_CLASS (gtk_inspector_render_recording_parent_class)->finalize (object);
 }
@@ -47,13 +54,76 @@ gtk_inspector_render_recording_init (GtkInspectorRenderRecording *vis)
 {
 }
 
+static const char *
+get_phase_name (GtkFramePhase phase)
+{
+  switch (phase)
+    {
+    case GTK_FRAME_PHASE_STYLE:
+      return "style";
+    case GTK_FRAME_PHASE_MEASURE:
+      return "measure";
+    case GTK_FRAME_PHASE_ALLOCATE:
+      return "allocate";
+    case GTK_FRAME_PHASE_SNAPSHOT:
+      return "snapshot";
+    case GTK_FRAME_PHASE_RENDER:
+    default:
+      return "render";
+    }
+}
+
+static void
+append_frame_phases (GString              *string,
+                     GtkFramePhaseTimings *timings,
+                     gint64                input_latency)
+{
+  GtkFramePhase phase;
+  GtkFramePhase slowest_phase;
+  gint64 duration;
+  const char *name;
+  guint i;
+
+  if (gtk_frame_phase_timings_get_n_input_events (timings) > 0)
+    {
+      g_string_append_printf (string, "input: %u events",
+                              gtk_frame_phase_timings_get_n_input_events (timings));
+      if (input_latency > 0)
+        g_string_append_printf (string, ", %.3f ms to presentation", input_latency / 1000.);
+      g_string_append_c (string, '\n');
+    }
+
+  /* The frame is not rendered yet, the profiler timers cover that */
+  for (phase = GTK_FRAME_PHASE_STYLE; phase < GTK_FRAME_PHASE_RENDER; phase++)
+    {
+      g_string_append_printf (string, "%s: %.3f ms",
+                              get_phase_name (phase),
+                              gtk_frame_phase_timings_get_phase_duration (timings, phase) / 1000.);
+      if (phase != GTK_FRAME_PHASE_STYLE)
+        g_string_append_printf (string, " (%u widgets)",
+                                gtk_frame_phase_timings_get_phase_widgets (timings, phase));
+      g_string_append_c (string, '\n');
+    }
+
+  for (i = 0; i < gtk_frame_phase_timings_get_n_slowest (timings); i++)
+    {
+      name = gtk_frame_phase_timings_get_slowest (timings, i, &slowest_phase, &duration);
+      g_string_append_printf (string, "%s (%s): %.3f ms\n",
+                              name, get_phase_name (slowest_phase), duration / 1000.);
+    }
+}
+
 static void
 collect_profiler_info (GtkInspectorRenderRecording *recording,
-                       GskProfiler                 *profiler)
+                       GskProfiler                 *profiler,
+                       GtkFramePhaseTimings        *timings,
+                       gint64                       input_latency)
 {
   GString *string;
 
   string = g_string_new (NULL);
+  if (timings)
+    append_frame_phases (string, timings, input_latency);
   gsk_profiler_append_timers (profiler, string);
   gsk_profiler_append_counters (profiler, string);
   recording->profiler_info = g_string_free (string, FALSE);
@@ -62,6 +132,8 @@ collect_profiler_info (GtkInspectorRenderRecording *recording,
 GtkInspectorRecording *
 gtk_inspector_render_recording_new (gint64                timestamp,
                                     GskProfiler          *profiler,
+                                    GtkFramePhaseTimings *timings,
+                                    gint64                input_latency,
                                     const GdkRectangle   *area,
                                     const cairo_region_t *clip_region,
                                     GskRenderNode        *node)
@@ -72,7 +144,10 @@ gtk_inspector_render_recording_new (gint64                timestamp,
                             "timestamp", timestamp,
                             NULL);
 
-  collect_profiler_info (recording, profiler);
+  collect_profiler_info (recording, profiler, timings, input_latency);
+  if (timings)
+    recording->timings = gtk_frame_phase_timings_ref (timings);
+  recording->input_latency = input_latency;
   recording->area = *area;
   recording->clip_region = cairo_region_copy (clip_region);
   recording->node = gsk_render_node_ref (node);
@@ -83,9 +158,62 @@ gtk_inspector_render_recording_new (gint64                timestamp,
 GskRenderNode *
 gtk_inspector_render_recording_get_node (GtkInspectorRenderRecording *recording)
 {
+  GError *error = NULL;
+
+  if (recording->spool == NULL)
+    return recording->node;
+
+  if (recording->node == NULL)
+    {
+      recording->node = gtk_inspector_recording_spool_read (recording->spool,
+                                                            recording->spool_offset,
+                                                            recording->spool_size,
+                                                            &error);
+      if (recording->node == NULL)
+        {
+          g_warning ("Failed to load recorded frame: %s", error->message);
+          g_error_free (error);
+          return NULL;
+        }
+    }
+
+  gtk_inspector_recording_spool_keep (recording->spool, recording);
+
   return recording->node;
 }
 
+/*
+ * gtk_inspector_render_recording_spool:
+ * @recording: a #GtkInspectorRenderRecording
+ * @spool: the spool to write the node of @recording to
+ *
+ * Writes the node to @spool, so that it can be dropped from memory
+ * and loaded again when it is needed. If writing fails, the node
+ * is kept in memory.
+ */
+void
+gtk_inspector_render_recording_spool (GtkInspectorRenderRecording *recording,
+                                      GtkInspectorRecordingSpool  *spool)
+{
+  GError *error = NULL;
+
+  g_return_if_fail (recording->spool == NULL);
+
+  if (!gtk_inspector_recording_spool_write (spool,
+                                            recording->node,
+                                            &recording->spool_offset,
+                                            &recording->spool_size,
+                                            &error))
+    {
+      g_warning ("Failed to write recorded frame: %s", error->message);
+      g_error_free (error);
+      return;
+    }
+
+  recording->spool = gtk_inspector_recording_spool_ref (spool);
+  gtk_inspector_recording_spool_keep (spool, recording);
+}
+
 const cairo_region_t *
 gtk_inspector_render_recording_get_clip_region (GtkInspectorRenderRecording *recording)
 {
@@ -104,4 +232,16 @@ gtk_inspector_render_recording_get_profiler_info (GtkInspectorRenderRecording *r
   return recording->profiler_info;
 }
 
+GtkFramePhaseTimings *
+gtk_inspector_render_recording_get_frame_phase_timings (GtkInspectorRenderRecording *recording)
+{
+  return recording->timings;
+}
+
+gint64
+gtk_inspector_render_recording_get_input_latency (GtkInspectorRenderRecording *recording)
+{
+  return recording->input_latency;
+}
+
 // vim: set et sw=2 ts=2:
@@ -20,9 +20,11 @@
 
 #include <gdk/gdk.h>
 #include <gsk/gsk.h>
+#include <gtk/gtk.h>
 #include "gsk/gskprofilerprivate.h"
 
 #include "inspector/recording.h"
+#include "inspector/recordingspool.h"
 
 G_BEGIN_DECLS
 
@@ -36,7 +38,7 @@ G_BEGIN_DECLS
 
 typedef struct _GtkInspectorRenderRecordingPrivate GtkInspectorRenderRecordingPrivate;
 
-typedef struct _GtkInspectorRenderRecording
+struct _GtkInspectorRenderRecording
 {
   GtkInspectorRecording parent;
 
@@ -44,7 +46,16 @@ typedef struct _GtkInspectorRenderRecording
   cairo_region_t *clip_region;
   GskRenderNode *node;
   char *profiler_info;
-} GtkInspectorRenderRecording;
+  GtkFramePhaseTimings *timings;
+  gint64 input_latency;
+
+  /* Set if the node was written to a spool, it is then only in
+   * memory while the recording is among the last ones used */
+  GtkInspectorRecordingSpool *spool;
+  goffset spool_offset;
+  gsize spool_size;
+  GList spool_link;
+};
 
 typedef struct _GtkInspectorRenderRecordingClass
 {
@@ -56,6 +67,8 @@ GType           gtk_inspector_render_recording_get_type      (void);
 GtkInspectorRecording *
                 gtk_inspector_render_recording_new           (gint64                             timestamp,
                                                               GskProfiler                       *profiler,
+                                                              GtkFramePhaseTimings              *timings,
+                                                              gint64                             input_latency,
                                                               const GdkRectangle                *area,
                                                               const cairo_region_t              *clip_region,
                                                               GskRenderNode                     *node);
@@ -67,6 +80,14 @@ const cairo_rectangle_int_t *
                 gtk_inspector_render_recording_get_area      (GtkInspectorRenderRecording       *recording);
 const char *    gtk_inspector_render_recording_get_profiler_info
                                                              (GtkInspectorRenderRecording       *recording);
+GtkFramePhaseTimings *
+                gtk_inspector_render_recording_get_frame_phase_timings
+                                                             (GtkInspectorRenderRecording       *recording);
+gint64          gtk_inspector_render_recording_get_input_latency
+                                                             (GtkInspectorRenderRecording       *recording);
+
+void            gtk_inspector_render_recording_spool         (GtkInspectorRenderRecording       *recording,
+                                                              GtkInspectorRecordingSpool        *spool);
 
 
 G_END_DECLS
@@ -20,6 +20,7 @@
 #include "statistics.h"
 
 #include "graphdata.h"
+#include "window.h"
 
 #include "gtkcelllayout.h"
 #include "gtkcellrenderertext.h"
@@ -31,6 +32,14 @@
 #include "gtktreeview.h"
 #include "gtkeventcontrollerkey.h"
 #include "gtkmain.h"
+#include "gtkcssimageprivate.h"
+#include "gtkcssstatsprivate.h"
+#include "gtkcssstylepropertyprivate.h"
+#include "gtkiconthemeprivate.h"
+#include "gtkmemorystatsprivate.h"
+#include "gtkpickindexprivate.h"
+#include "gtkwidgetprivate.h"
+#include "gtkwindow.h"
 
 #include <glib/gi18n-lib.h>
 
@@ -60,6 +69,22 @@ struct _GtkInspectorStatisticsPrivate
   guint update_source_id;
   GtkWidget *search_entry;
   GtkWidget *search_bar;
+  GtkListStore *css_model;
+  GtkCssStats css_stats;
+  GtkTreeIter *css_rows;
+  guint n_css_rows;
+  guint n_cached_images;
+  gsize image_cache_cost;
+  guint icon_cache_hits;
+  guint icon_cache_misses;
+  gsize icon_cache_bytes;
+  GtkPickStats pick_stats;
+  GtkListStore *size_model;
+  GHashTable *size_rows;
+  GtkListStore *memory_model;
+  GtkTreeIter memory_total_row;
+  GHashTable *memory_window_rows;
+  GHashTable *memory_type_rows;
 };
 
 typedef struct {
@@ -81,6 +106,62 @@ enum
   COLUMN_CUMULATIVE_DATA
 };
 
+enum
+{
+  CSS_COLUMN_NAME,
+  CSS_COLUMN_TOTAL,
+  CSS_COLUMN_DELTA
+};
+
+enum
+{
+  SIZE_COLUMN_TYPE_NAME,
+  SIZE_COLUMN_LOOKUPS,
+  SIZE_COLUMN_HIT_RATE,
+  SIZE_COLUMN_RESIZES,
+  SIZE_COLUMN_COALESCED,
+  SIZE_COLUMN_NOTIFIES,
+  SIZE_COLUMN_NOTIFIES_DEFERRED
+};
+
+enum
+{
+  MEMORY_COLUMN_NAME,
+  MEMORY_COLUMN_WIDGETS,
+  MEMORY_COLUMN_RENDER_NODES,
+  MEMORY_COLUMN_TEXTURES,
+  MEMORY_COLUMN_LAYOUTS,
+  MEMORY_COLUMN_STYLES,
+  MEMORY_COLUMN_TOTAL
+};
+
+static const struct {
+  const char *name;
+  gsize offset;
+} css_counters[] = {
+  { N_("Selectors matched"), G_STRUCT_OFFSET (GtkCssStats, selector_matches) },
+  { N_("Selectors rejected by filter"), G_STRUCT_OFFSET (GtkCssStats, selector_rejects) },
+  { N_("Parent cache lookups"), G_STRUCT_OFFSET (GtkCssStats, parent_cache_lookups) },
+  { N_("Parent cache hits"), G_STRUCT_OFFSET (GtkCssStats, parent_cache_hits) },
+  { N_("Sibling lookups"), G_STRUCT_OFFSET (GtkCssStats, sibling_lookups) },
+  { N_("Sibling hits"), G_STRUCT_OFFSET (GtkCssStats, sibling_hits) },
+  { N_("Styles computed"), G_STRUCT_OFFSET (GtkCssStats, static_styles) },
+  { N_("Image cache lookups"), G_STRUCT_OFFSET (GtkCssStats, image_cache_lookups) },
+  { N_("Image cache hits"), G_STRUCT_OFFSET (GtkCssStats, image_cache_hits) },
+};
+
+static const struct {
+  const char *name;
+  gsize offset;
+} pick_counters[] = {
+  { N_("Picks"), G_STRUCT_OFFSET (GtkPickStats, picks) },
+  { N_("Widgets visited while picking"), G_STRUCT_OFFSET (GtkPickStats, widgets_visited) },
+  { N_("Children tested while picking"), G_STRUCT_OFFSET (GtkPickStats, children_tested) },
+  { N_("Pick indexes built"), G_STRUCT_OFFSET (GtkPickStats, index_builds) },
+};
+
+#define N_CSS_ROWS (G_N_ELEMENTS (css_counters) + 6 + G_N_ELEMENTS (pick_counters) + GTK_CSS_PROPERTY_N_PROPERTIES)
+
 G_DEFINE_TYPE_WITH_PRIVATE (GtkInspectorStatistics, gtk_inspector_statistics, GTK_TYPE_BOX)
 
 static gint
@@ -131,6 +212,8 @@ add_type_count (GtkInspectorStatistics *sl, GType type)
   return cumulative;
 }
 
+static gboolean has_instance_counts (void);
+
 static gboolean
 update_type_counts (gpointer data)
 {
@@ -148,6 +231,312 @@ update_type_counts (gpointer data)
   return TRUE;
 }
 
+static void
+set_css_row (GtkInspectorStatistics *sl,
+             guint                   row,
+             const char             *name,
+             gint64                  total,
+             gint64                  delta)
+{
+  GtkTreeIter *iter = &sl->priv->css_rows[row];
+  char total_text[32], delta_text[32];
+
+  if (row >= sl->priv->n_css_rows)
+    {
+      sl->priv->n_css_rows = row + 1;
+      gtk_list_store_append (sl->priv->css_model, iter);
+      gtk_list_store_set (sl->priv->css_model, iter, CSS_COLUMN_NAME, name, -1);
+    }
+
+  g_snprintf (total_text, sizeof (total_text), "%" G_GINT64_FORMAT, total);
+  g_snprintf (delta_text, sizeof (delta_text), "%" G_GINT64_FORMAT, delta);
+  gtk_list_store_set (sl->priv->css_model, iter,
+                      CSS_COLUMN_TOTAL, total_text,
+                      CSS_COLUMN_DELTA, delta_text,
+                      -1);
+}
+
+static void
+update_css_stats (GtkInspectorStatistics *sl)
+{
+  GtkCssStats stats;
+  GtkPickStats pick_stats;
+  guint i, row, n_cached;
+  guint icon_hits, icon_misses;
+  gsize icon_bytes;
+  gsize image_cost;
+
+  gtk_css_stats_get (&stats);
+
+  row = 0;
+  for (i = 0; i < G_N_ELEMENTS (css_counters); i++)
+    {
+      guint now = G_STRUCT_MEMBER (guint, &stats, css_counters[i].offset);
+      guint before = G_STRUCT_MEMBER (guint, &sl->priv->css_stats, css_counters[i].offset);
+
+      set_css_row (sl, row++, _(css_counters[i].name), now, (gint64) now - before);
+    }
+
+  set_css_row (sl, row++, _("Style compute time (µs)"),
+               stats.compute_time, stats.compute_time - sl->priv->css_stats.compute_time);
+
+  n_cached = gtk_css_image_get_n_cached ();
+  set_css_row (sl, row++, _("Images cached"),
+               n_cached, (gint64) n_cached - sl->priv->n_cached_images);
+  sl->priv->n_cached_images = n_cached;
+
+  image_cost = gtk_css_image_get_cache_cost ();
+  set_css_row (sl, row++, _("Image cache size (bytes)"),
+               image_cost, (gint64) image_cost - (gint64) sl->priv->image_cache_cost);
+  sl->priv->image_cache_cost = image_cost;
+
+  gtk_icon_theme_get_cache_stats (gtk_icon_theme_get_default (),
+                                  &icon_hits, &icon_misses, &icon_bytes);
+  set_css_row (sl, row++, _("Icon cache hits"),
+               icon_hits, (gint64) icon_hits - sl->priv->icon_cache_hits);
+  set_css_row (sl, row++, _("Icon cache misses"),
+               icon_misses, (gint64) icon_misses - sl->priv->icon_cache_misses);
+  set_css_row (sl, row++, _("Icon cache size (bytes)"),
+               icon_bytes, (gint64) icon_bytes - (gint64) sl->priv->icon_cache_bytes);
+  sl->priv->icon_cache_hits = icon_hits;
+  sl->priv->icon_cache_misses = icon_misses;
+  sl->priv->icon_cache_bytes = icon_bytes;
+
+  gtk_pick_stats_get (&pick_stats);
+  for (i = 0; i < G_N_ELEMENTS (pick_counters); i++)
+    {
+      guint now = G_STRUCT_MEMBER (guint, &pick_stats, pick_counters[i].offset);
+      guint before = G_STRUCT_MEMBER (guint, &sl->priv->pick_stats, pick_counters[i].offset);
+
+      set_css_row (sl, row++, _(pick_counters[i].name), now, (gint64) now - before);
+    }
+  sl->priv->pick_stats = pick_stats;
+
+  for (i = 0; i < GTK_CSS_PROPERTY_N_PROPERTIES; i++)
+    {
+      char *name = NULL;
+
+      if (row >= sl->priv->n_css_rows)
+        name = g_strdup_printf (_("Values computed: %s"),
+                                _gtk_style_property_get_name (GTK_STYLE_PROPERTY (_gtk_css_style_property_lookup_by_id (i))));
+
+      set_css_row (sl, row++, name,
+                   stats.computed_values[i],
+                   (gint64) stats.computed_values[i] - sl->priv->css_stats.computed_values[i]);
+      g_free (name);
+    }
+
+  sl->priv->css_stats = stats;
+}
+
+static void
+update_size_stats_for_type (GtkInspectorStatistics *sl,
+                            GType                   type)
+{
+  GtkWidgetClass *widget_class;
+  GtkTreeIter *iter;
+  GType *children;
+  guint i, n_children, lookups, hits, resizes, coalesced, notifies, deferred;
+  char lookups_text[32], hit_rate_text[32];
+  char resizes_text[32], coalesced_text[32];
+  char notifies_text[32], deferred_text[32];
+
+  /* Only look at classes that exist already */
+  widget_class = g_type_class_peek (type);
+  if (widget_class == NULL)
+    return;
+
+  gtk_widget_class_get_size_request_stats (widget_class, &lookups, &hits);
+  gtk_widget_class_get_resize_stats (widget_class, &resizes, &coalesced);
+  gtk_widget_class_get_notify_stats (widget_class, &notifies, &deferred);
+  if (lookups > 0 || resizes > 0 || notifies > 0)
+    {
+      iter = g_hash_table_lookup (sl->priv->size_rows, GSIZE_TO_POINTER (type));
+      if (iter == NULL)
+        {
+          iter = g_new (GtkTreeIter, 1);
+          gtk_list_store_append (sl->priv->size_model, iter);
+          gtk_list_store_set (sl->priv->size_model, iter,
+                              SIZE_COLUMN_TYPE_NAME, g_type_name (type),
+                              -1);
+          g_hash_table_insert (sl->priv->size_rows, GSIZE_TO_POINTER (type), iter);
+        }
+
+      g_snprintf (lookups_text, sizeof (lookups_text), "%u", lookups);
+      if (lookups > 0)
+        g_snprintf (hit_rate_text, sizeof (hit_rate_text), "%.1f %%", 100.0 * hits / lookups);
+      else
+        g_strlcpy (hit_rate_text, "", sizeof (hit_rate_text));
+      g_snprintf (resizes_text, sizeof (resizes_text), "%u", resizes);
+      g_snprintf (coalesced_text, sizeof (coalesced_text), "%u", coalesced);
+      g_snprintf (notifies_text, sizeof (notifies_text), "%u", notifies);
+      g_snprintf (deferred_text, sizeof (deferred_text), "%u", deferred);
+      gtk_list_store_set (sl->priv->size_model, iter,
+                          SIZE_COLUMN_LOOKUPS, lookups_text,
+                          SIZE_COLUMN_HIT_RATE, hit_rate_text,
+                          SIZE_COLUMN_RESIZES, resizes_text,
+                          SIZE_COLUMN_COALESCED, coalesced_text,
+                          SIZE_COLUMN_NOTIFIES, notifies_text,
+                          SIZE_COLUMN_NOTIFIES_DEFERRED, deferred_text,
+                          -1);
+    }
+
+  children = g_type_children (type, &n_children);
+  for (i = 0; i < n_children; i++)
+    update_size_stats_for_type (sl, children[i]);
+  g_free (children);
+}
+
+static void
+format_memory (char   *text,
+               gsize   size,
+               guint   count,
+               gsize   bytes)
+{
+  char *bytes_text;
+
+  bytes_text = g_format_size (bytes);
+  g_snprintf (text, size, "%u (%s)", count, bytes_text);
+  g_free (bytes_text);
+}
+
+static void
+set_memory_row (GtkInspectorStatistics *sl,
+                GtkTreeIter            *iter,
+                const GtkMemoryStats   *stats)
+{
+  char widgets_text[32], nodes_text[64], textures_text[64];
+  char layouts_text[64], styles_text[64];
+  char *total_text;
+
+  g_snprintf (widgets_text, sizeof (widgets_text), "%u", stats->n_widgets);
+  format_memory (nodes_text, sizeof (nodes_text), stats->n_render_nodes, stats->render_node_bytes);
+  format_memory (textures_text, sizeof (textures_text), stats->n_textures, stats->texture_bytes);
+  format_memory (layouts_text, sizeof (layouts_text), stats->n_layouts, stats->layout_bytes);
+  format_memory (styles_text, sizeof (styles_text), stats->n_styles, stats->style_bytes);
+  total_text = g_format_size (gtk_memory_stats_get_bytes (stats));
+
+  gtk_list_store_set (sl->priv->memory_model, iter,
+                      MEMORY_COLUMN_WIDGETS, widgets_text,
+                      MEMORY_COLUMN_RENDER_NODES, nodes_text,
+                      MEMORY_COLUMN_TEXTURES, textures_text,
+                      MEMORY_COLUMN_LAYOUTS, layouts_text,
+                      MEMORY_COLUMN_STYLES, styles_text,
+                      MEMORY_COLUMN_TOTAL, total_text,
+                      -1);
+  g_free (total_text);
+}
+
+static GtkTreeIter *
+ensure_memory_row (GtkInspectorStatistics *sl,
+                   GHashTable             *rows,
+                   gpointer                key,
+                   const char             *name)
+{
+  GtkTreeIter *iter;
+
+  iter = g_hash_table_lookup (rows, key);
+  if (iter == NULL)
+    {
+      iter = g_new (GtkTreeIter, 1);
+      gtk_list_store_append (sl->priv->memory_model, iter);
+      gtk_list_store_set (sl->priv->memory_model, iter,
+                          MEMORY_COLUMN_NAME, name,
+                          -1);
+      g_hash_table_insert (rows, key, iter);
+    }
+
+  return iter;
+}
+
+static void
+update_memory_stats (GtkInspectorStatistics *sl)
+{
+  GHashTable *seen, *by_type, *window_rows;
+  GHashTableIter hash_iter;
+  GtkMemoryStats total = { 0, };
+  GtkMemoryStats *type_stats;
+  GList *toplevels, *l;
+  gpointer key, value;
+
+  seen = g_hash_table_new (NULL, NULL);
+  by_type = g_hash_table_new_full (NULL, NULL, NULL, g_free);
+  window_rows = g_hash_table_new_full (NULL, NULL, NULL, g_free);
+
+  toplevels = gtk_window_list_toplevels ();
+  for (l = toplevels; l != NULL; l = l->next)
+    {
+      GtkWindow *window = l->data;
+      GtkMemoryStats stats = { 0, };
+      GtkTreeIter *iter;
+
+      /* Don't let the inspector show up in its own numbers */
+      if (GTK_INSPECTOR_IS_WINDOW (window))
+        continue;
+
+      gtk_memory_stats_collect (GTK_WIDGET (window), seen, &stats, by_type);
+      gtk_memory_stats_add (&total, &stats);
+
+      iter = g_hash_table_lookup (sl->priv->memory_window_rows, window);
+      if (iter)
+        {
+          g_hash_table_steal (sl->priv->memory_window_rows, window);
+          g_hash_table_insert (window_rows, window, iter);
+        }
+      else
+        {
+          const char *title = gtk_window_get_title (window);
+          char *name;
+
+          if (title && *title)
+            name = g_strdup_printf ("%s \"%s\"", G_OBJECT_TYPE_NAME (window), title);
+          else
+            name = g_strdup_printf ("%s %p", G_OBJECT_TYPE_NAME (window), window);
+          iter = ensure_memory_row (sl, window_rows, window, name);
+          g_free (name);
+        }
+      set_memory_row (sl, iter, &stats);
+    }
+  g_list_free (toplevels);
+
+  /* Whatever is left are windows that went away */
+  g_hash_table_iter_init (&hash_iter, sl->priv->memory_window_rows);
+  while (g_hash_table_iter_next (&hash_iter, NULL, &value))
+    gtk_list_store_remove (sl->priv->memory_model, value);
+  g_hash_table_unref (sl->priv->memory_window_rows);
+  sl->priv->memory_window_rows = window_rows;
+
+  set_memory_row (sl, &sl->priv->memory_total_row, &total);
+
+  g_hash_table_iter_init (&hash_iter, by_type);
+  while (g_hash_table_iter_next (&hash_iter, &key, &value))
+    {
+      type_stats = value;
+      set_memory_row (sl,
+                      ensure_memory_row (sl, sl->priv->memory_type_rows, key,
+                                         g_type_name (GPOINTER_TO_SIZE (key))),
+                      type_stats);
+    }
+
+  g_hash_table_unref (by_type);
+  g_hash_table_unref (seen);
+}
+
+static gboolean
+update_counts (gpointer data)
+{
+  GtkInspectorStatistics *sl = data;
+
+  if (has_instance_counts ())
+    update_type_counts (sl);
+
+  update_css_stats (sl);
+  update_size_stats_for_type (sl, GTK_TYPE_WIDGET);
+  update_memory_stats (sl);
+
+  return TRUE;
+}
+
 static void
 toggle_record (GtkToggleButton        *button,
                GtkInspectorStatistics *sl)
@@ -157,8 +546,8 @@ toggle_record (GtkToggleButton        *button,
 
   if (gtk_toggle_button_get_active (button))
     {
-      sl->priv->update_source_id = g_timeout_add_seconds (1, update_type_counts, sl);
-      update_type_counts (sl);
+      sl->priv->update_source_id = g_timeout_add_seconds (1, update_counts, sl);
+      update_counts (sl);
     }
   else
     {
@@ -378,6 +767,14 @@ gtk_inspector_statistics_init (GtkInspectorStatistics *sl)
                                       cell_data_delta,
                                       GINT_TO_POINTER (COLUMN_CUMULATIVE2), NULL);
   sl->priv->counts = g_hash_table_new_full (NULL, NULL, NULL, type_data_free);
+  sl->priv->css_rows = g_new0 (GtkTreeIter, N_CSS_ROWS);
+  sl->priv->size_rows = g_hash_table_new_full (NULL, NULL, NULL, g_free);
+  sl->priv->memory_window_rows = g_hash_table_new_full (NULL, NULL, NULL, g_free);
+  sl->priv->memory_type_rows = g_hash_table_new_full (NULL, NULL, NULL, g_free);
+  gtk_list_store_append (sl->priv->memory_model, &sl->priv->memory_total_row);
+  gtk_list_store_set (sl->priv->memory_model, &sl->priv->memory_total_row,
+                      MEMORY_COLUMN_NAME, _("All windows"),
+                      -1);
 
   gtk_tree_view_set_search_entry (sl->priv->view, GTK_EDITABLE (sl->priv->search_entry));
   gtk_tree_view_set_search_equal_func (sl->priv->view, match_row, sl, NULL);
@@ -398,8 +795,11 @@ constructed (GObject *object)
       if (instance_counts_enabled ())
         gtk_label_set_text (GTK_LABEL (sl->priv->excuse), _("GLib must be configured with --enable-debug"));
       gtk_stack_set_visible_child_name (GTK_STACK (sl->priv->stack), "excuse");
-      gtk_widget_set_sensitive (sl->priv->button, FALSE);
     }
+
+  update_css_stats (sl);
+  update_size_stats_for_type (sl, GTK_TYPE_WIDGET);
+  update_memory_stats (sl);
 }
 
 static void
@@ -411,6 +811,10 @@ finalize (GObject *object)
     g_source_remove (sl->priv->update_source_id);
 
   g_hash_table_unref (sl->priv->counts);
+  g_free (sl->priv->css_rows);
+  g_hash_table_unref (sl->priv->size_rows);
+  g_hash_table_unref (sl->priv->memory_window_rows);
+  g_hash_table_unref (sl->priv->memory_type_rows);
 
   G_OBJECT_CLASS (gtk_inspector_statistics_parent_class)->finalize (object);
 }
@@ -488,6 +892,9 @@ gtk_inspector_statistics_class_init (GtkInspectorStatisticsClass *klass)
   gtk_widget_class_bind_template_child_private (widget_class, GtkInspectorStatistics, search_entry);
   gtk_widget_class_bind_template_child_private (widget_class, GtkInspectorStatistics, search_bar);
   gtk_widget_class_bind_template_child_private (widget_class, GtkInspectorStatistics, excuse);
+  gtk_widget_class_bind_template_child_private (widget_class, GtkInspectorStatistics, css_model);
+  gtk_widget_class_bind_template_child_private (widget_class, GtkInspectorStatistics, size_model);
+  gtk_widget_class_bind_template_child_private (widget_class, GtkInspectorStatistics, memory_model);
 
 }
 
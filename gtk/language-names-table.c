@@ -0,0 +1,16221 @@
+/* Generated by gen-language-names.py */
+
+static const char language_domains[][10] = {
+  "iso_639",
+  "iso_639_3",
+};
+
+static const char language_names_0[] =
+  "Afar\0"
+  "Ghotuo\0"
+  "Alumu-Tesu\0"
+  "Ari\0"
+  "Amal\0"
+  "Albanian, Arbëreshë\0"
+  "Aranadan\0"
+  "Ambrak\0"
+  "Arapesh, Abu'\0"
+  "Arifama-Miniafia\0"
+  "Ankave\0"
+  "Afade\0"
+  "Anambé\0"
+  "Arabic, Algerian Saharan\0"
+  "Arára, Pará\0"
+  "Abnaki, Eastern\0"
+  "Aasáx\0"
+  "Albanian, Arvanitika\0"
+  "Abau\0"
+  "Solong\0"
+  "Mandobo Atas\0"
+  "Amarasi\0"
+  "Abkhazian\0"
+  "Abé\0"
+  "Bankon\0"
+  "Ayta, Ambala\0"
+  "Manide\0"
+  "Abnaki, Western\0"
+  "Abai Sungai\0"
+  "Abaga\0"
+  "Arabic, Tajiki\0"
+  "Abidji\0"
+  "Aka-Bea\0"
+  "Lampung Nyo\0"
+  "Abanyom\0"
+  "Abua\0"
+  "Abon\0"
+  "Ayta, Abellen\0"
+  "Abaza\0"
+  "Abron\0"
+  "Malay, Ambonese\0"
+  "Ambulas\0"
+  "Abure\0"
+  "Arabic, Baharna\0"
+  "Pal\0"
+  "Inabaknon\0"
+  "Aneme Wake\0"
+  "Abui\0"
+  "Achagua\0"
+  "Áncá\0"
+  "Gikyode\0"
+  "Achinese\0"
+  "Creole French, Saint Lucian\0"
+  "Acoli\0"
+  "Aka-Cari\0"
+  "Aka-Kora\0"
+  "Akar-Bale\0"
+  "Arabic, Mesopotamian\0"
+  "Achang\0"
+  "Acipa, Eastern\0"
+  "Arabic, Ta'izzi-Adeni\0"
+  "Achi\0"
+  "Acroá\0"
+  "Achterhoeks\0"
+  "Achuar-Shiwiar\0"
+  "Achumawi\0"
+  "Arabic, Hijazi\0"
+  "Arabic, Omani\0"
+  "Arabic, Cypriot\0"
+  "Acheron\0"
+  "Adangme\0"
+  "Atauran\0"
+  "Lidzonka\0"
+  "Adele\0"
+  "Arabic, Dhofari\0"
+  "Andegerebinha\0"
+  "Adhola\0"
+  "Adi\0"
+  "Adioukrou\0"
+  "Galo\0"
+  "Adang\0"
+  "Abu\0"
+  "Adangbe\0"
+  "Adonara\0"
+  "Adamorobe Sign Language\0"
+  "Adnyamathanha\0"
+  "Aduge\0"
+  "Amundava\0"
+  "Tibetan, Amdo\0"
+  "Adyghe\0"
+  "Adzera\0"
+  "Avestan\0"
+  "Areba\0"
+  "Arabic, Tunisian\0"
+  "Arabic, Saidi\0"
+  "Argentine Sign Language\0"
+  "Pashai, Northeast\0"
+  "Haeke\0"
+  "Ambele\0"
+  "Arem\0"
+  "Armenian Sign Language\0"
+  "Aer\0"
+  "Arrernte, Eastern\0"
+  "Alsea\0"
+  "Akeu\0"
+  "Ambakich\0"
+  "Amele\0"
+  "Aeka\0"
+  "Afrikaans\0"
+  "Afro-Asiatic languages\0"
+  "Arabic, Gulf\0"
+  "Andai\0"
+  "Putukwam\0"
+  "Afghan Sign Language\0"
+  "Afrihili\0"
+  "Akrukay\0"
+  "Nanubae\0"
+  "Defaka\0"
+  "Eloyi\0"
+  "Tapei\0"
+  "Creole, Afro-Seminole\0"
+  "Afitti\0"
+  "Awutu\0"
+  "Obokuitai\0"
+  "Aguano\0"
+  "Legbo\0"
+  "Agatu\0"
+  "Agarabi\0"
+  "Angal\0"
+  "Arguni\0"
+  "Angor\0"
+  "Ngelima\0"
+  "Agariya\0"
+  "Argobba\0"
+  "Agta, Isarog\0"
+  "Fembe\0"
+  "Angaataha\0"
+  "Agutaynen\0"
+  "Tainae\0"
+  "Aghem\0"
+  "Aguaruna\0"
+  "Esimbi\0"
+  "Agta, Central Cagayan\0"
+  "Aguacateco\0"
+  "Dumagat, Remontado\0"
+  "Kahua\0"
+  "Aghul\0"
+  "Alta, Southern\0"
+  "Agta, Mt. Iriga\0"
+  "Ahanta\0"
+  "Axamb\0"
+  "Qimant\0"
+  "Aghu\0"
+  "Aizi, Tiagbamrin\0"
+  "Akha\0"
+  "Igo\0"
+  "Aizi, Mobumrin\0"
+  "Àhàn\0"
+  "Ahom\0"
+  "Aizi, Aproumu\0"
+  "Ahirani\0"
+  "Ashe\0"
+  "Ahtena\0"
+  "Arosi\0"
+  "Ainu (China)\0"
+  "Ainbai\0"
+  "Alngith\0"
+  "Amara\0"
+  "Agi\0"
+  "Creole English, Antigua and Barbuda\0"
+  "Ai-Cham\0"
+  "Neo-Aramaic, Assyrian\0"
+  "Lishanid Noshan\0"
+  "Ake\0"
+  "Aimele\0"
+  "Aimol\0"
+  "Ainu (Japan)\0"
+  "Aiton\0"
+  "Burumakok\0"
+  "Aimaq\0"
+  "Airoran\0"
+  "Arikem\0"
+  "Aari\0"
+  "Aighon\0"
+  "Ali\0"
+  "Aja (South Sudan)\0"
+  "Aja (Benin)\0"
+  "Ajië\0"
+  "Andajin\0"
+  "Arabic, South Levantine\0"
+  "Algerian Jewish Sign Language\0"
+  "Arabic, Judeo-Moroccan\0"
+  "Ajawa\0"
+  "Karbi, Amri\0"
+  "Akan\0"
+  "Batak Angkola\0"
+  "Mpur\0"
+  "Ukpet-Ehom\0"
+  "Akawaio\0"
+  "Akpa\0"
+  "Anakalangu\0"
+  "Angal Heneng\0"
+  "Aiome\0"
+  "Aka-Jeru\0"
+  "Akkadian\0"
+  "Aklanon\0"
+  "Aka-Bo\0"
+  "Akurio\0"
+  "Siwu\0"
+  "Ak\0"
+  "Araki\0"
+  "Akaselem\0"
+  "Akolet\0"
+  "Akum\0"
+  "Akhvakh\0"
+  "Akwa\0"
+  "Aka-Kede\0"
+  "Aka-Kol\0"
+  "Alabama\0"
+  "Alago\0"
+  "Albanian\0"
+  "Qawasqar\0"
+  "Alladian\0"
+  "Aleut\0"
+  "Alege\0"
+  "Algonquian languages\0"
+  "Alawa\0"
+  "Amaimon\0"
+  "Alangan\0"
+  "Alak\0"
+  "Allar\0"
+  "Amblong\0"
+  "Albanian, Gheg\0"
+  "Larike-Wakasihu\0"
+  "Alune\0"
+  "Algonquin\0"
+  "Alutor\0"
+  "Albanian, Tosk\0"
+  "Altai, Southern\0"
+  "'Are'are\0"
+  "Alaba-K’abeena\0"
+  "Amol\0"
+  "Alyawarr\0"
+  "Alur\0"
+  "Amharic\0"
+  "Amanayé\0"
+  "Ambo\0"
+  "Amahuaca\0"
+  "Yanesha'\0"
+  "Hamer-Banna\0"
+  "Amurdak\0"
+  "Amis\0"
+  "Amdang\0"
+  "Ambai\0"
+  "War-Jaintia\0"
+  "Ama (Papua New Guinea)\0"
+  "Amanab\0"
+  "Amo\0"
+  "Alamblak\0"
+  "Amahai\0"
+  "Amarakaeri\0"
+  "Amami-Oshima, Southern\0"
+  "Amto\0"
+  "Amuzgo, Guerrero\0"
+  "Ambelau\0"
+  "Neo-Aramaic, Western\0"
+  "Anmatyerre\0"
+  "Ami\0"
+  "Atampaya\0"
+  "Aragonese\0"
+  "Andaqui\0"
+  "Andoa\0"
+  "Ngas\0"
+  "Ansus\0"
+  "Xârâcùù\0"
+  "Animere\0"
+  "English, Old (ca. 450-1100)\0"
+  "Nend\0"
+  "Andi\0"
+  "Anor\0"
+  "Goemai\0"
+  "Chin, Anu-Hkongso\0"
+  "Anal\0"
+  "Obolo\0"
+  "Andoque\0"
+  "Angika\0"
+  "Jarawa (India)\0"
+  "Andh\0"
+  "Anserma\0"
+  "Antakarinya\0"
+  "Anuak\0"
+  "Denya\0"
+  "Anaang\0"
+  "Andra-Hus\0"
+  "Anyin\0"
+  "Anem\0"
+  "Angolar\0"
+  "Abom\0"
+  "Pemon\0"
+  "Andarum\0"
+  "Angal Enen\0"
+  "Bragat\0"
+  "Angoram\0"
+  "Anindilyakwa\0"
+  "Mufian\0"
+  "Arhö\0"
+  "Alor\0"
+  "Ömie\0"
+  "Arapesh, Bumbita\0"
+  "Aore\0"
+  "Taikat\0"
+  "Atong (India)\0"
+  "A'ou\0"
+  "Atorada\0"
+  "Uab Meto\0"
+  "Apache languages\0"
+  "Sa'a\0"
+  "Arabic, North Levantine\0"
+  "Arabic, Sudanese\0"
+  "Bukiyip\0"
+  "Agta, Pahanan\0"
+  "Ampanang\0"
+  "Athpariya\0"
+  "Apiaká\0"
+  "Apache, Jicarilla\0"
+  "Apache, Kiowa\0"
+  "Apache, Lipan\0"
+  "Apache, Mescalero-Chiricahua\0"
+  "Apinayé\0"
+  "Ambul\0"
+  "Apma\0"
+  "A-Pucikwar\0"
+  "Arop-Lokep\0"
+  "Arop-Sissano\0"
+  "Apatani\0"
+  "Apurinã\0"
+  "Alapmunte\0"
+  "Apache, Western\0"
+  "Aputai\0"
+  "Apalaí\0"
+  "Safeyoka\0"
+  "Archi\0"
+  "Dogon, Ampari\0"
+  "Arigidi\0"
+  "Aninka\0"
+  "Atohwaim\0"
+  "Alta, Northern\0"
+  "Atakapa\0"
+  "Arhâ\0"
+  "Angaité\0"
+  "Akuntsu\0"
+  "Arabic\0"
+  "Arabic, Standard\0"
+  "Aramaic, Official (700-300 BCE)\0"
+  "Arabana\0"
+  "Arrarnta, Western\0"
+  "Arhuaco\0"
+  "Arikara\0"
+  "Arapaso\0"
+  "Arikapú\0"
+  "Arabela\0"
+  "Armenian\0"
+  "Mapudungun\0"
+  "Araona\0"
+  "Arapaho\0"
+  "Arabic, Algerian\0"
+  "Karo (Brazil)\0"
+  "Arabic, Najdi\0"
+  "Artificial languages\0"
+  "Aruá (Amazonas State)\0"
+  "Arbore\0"
+  "Arawak\0"
+  "Aruá (Rodonia State)\0"
+  "Arabic, Moroccan\0"
+  "Arabic, Egyptian\0"
+  "Assamese\0"
+  "Asu (Tanzania)\0"
+  "Assiniboine\0"
+  "Asmat, Casuarina Coast\0"
+  "American Sign Language\0"
+  "Auslan\0"
+  "Cishingini\0"
+  "Abishira\0"
+  "Buruwai\0"
+  "Sari\0"
+  "Ashkun\0"
+  "Asilulu\0"
+  "Asuriní, Xingú\0"
+  "Dano\0"
+  "Algerian Sign Language\0"
+  "Austrian Sign Language\0"
+  "Asuri\0"
+  "Ipulo\0"
+  "Asturian\0"
+  "Asurini, Tocantins\0"
+  "Asoa\0"
+  "Australian Aborigines Sign Language\0"
+  "Muratayak\0"
+  "Asmat, Yaosakor\0"
+  "As\0"
+  "Pele-Ata\0"
+  "Zaiwa\0"
+  "Atsahuaca\0"
+  "Manobo, Ata\0"
+  "Atemble\0"
+  "Ivbie North-Okpela-Arhe\0"
+  "Athapascan languages\0"
+  "Attié\0"
+  "Atikamekw\0"
+  "Ati\0"
+  "Agta, Mt. Iraya\0"
+  "Ata\0"
+  "Ashtiani\0"
+  "Atong (Cameroon)\0"
+  "Atta, Pudtol\0"
+  "Aralle-Tabulahan\0"
+  "Waimiri-Atroari\0"
+  "Gros Ventre\0"
+  "Atta, Pamplona\0"
+  "Reel\0"
+  "Altai, Northern\0"
+  "Atsugewi\0"
+  "Arutani\0"
+  "Aneityum\0"
+  "Arta\0"
+  "Asumboa\0"
+  "Alugu\0"
+  "Waorani\0"
+  "Anuta\0"
+  "Aguna\0"
+  "Aushi\0"
+  "Anuki\0"
+  "Awjilah\0"
+  "Heyo\0"
+  "Aulua\0"
+  "Asu (Nigeria)\0"
+  "One, Molmo\0"
+  "Auyokawa\0"
+  "Makayam\0"
+  "Anus\0"
+  "Aruek\0"
+  "Australian languages\0"
+  "Austral\0"
+  "Auye\0"
+  "Awyi\0"
+  "Aurá\0"
+  "Awiyaana\0"
+  "Arabic, Uzbeki\0"
+  "Avaric\0"
+  "Avau\0"
+  "Alviri-Vidari\0"
+  "Avikam\0"
+  "Kotava\0"
+  "Arabic, Eastern Egyptian Bedawi\0"
+  "Angkamuthi\0"
+  "Avatime\0"
+  "Agavotaguerra\0"
+  "Aushiri\0"
+  "Au\0"
+  "Avokaya\0"
+  "Avá-Canoeiro\0"
+  "Awadhi\0"
+  "Awa (Papua New Guinea)\0"
+  "Cicipu\0"
+  "Awetí\0"
+  "Anguthimri\0"
+  "Awbono\0"
+  "Aekyom\0"
+  "Awabakal\0"
+  "Arawum\0"
+  "Awngi\0"
+  "Awak\0"
+  "Awera\0"
+  "Awyu, South\0"
+  "Araweté\0"
+  "Awyu, Central\0"
+  "Awyu, Jair\0"
+  "Awun\0"
+  "Awara\0"
+  "Awyu, Edera\0"
+  "Abipon\0"
+  "Ayerrerenge\0"
+  "Arára, Mato Grosso\0"
+  "Yaka (Central African Republic)\0"
+  "Aranda, Lower Southern\0"
+  "Armenian, Middle\0"
+  "Xârâgurè\0"
+  "Aymara\0"
+  "Awar\0"
+  "Gbe, Ayizo\0"
+  "Aymara, Southern\0"
+  "Ayabadhu\0"
+  "Ayere\0"
+  "Ginyanga\0"
+  "Arabic, Hadrami\0"
+  "Leyigha\0"
+  "Akuku\0"
+  "Arabic, Libyan\0"
+  "Arabic, Sanaani\0"
+  "Ayoreo\0"
+  "Arabic, North Mesopotamian\0"
+  "Ayi (Papua New Guinea)\0"
+  "Aymara, Central\0"
+  "Ayta, Sorsogon\0"
+  "Ayta, Magbukun\0"
+  "Ayu\0"
+  "Mai Brat\0"
+  "Azerbaijani\0"
+  "Azha\0"
+  "Azerbaijani, South\0"
+  "Nahuatl, Eastern Durango\0"
+  "Amuzgo, San Pedro Amuzgos\0"
+  "Azerbaijani, North\0"
+  "Amuzgo, Ipalapa\0"
+  "Nahuatl, Western Durango\0"
+  "Awing\0"
+  "Atta, Faire\0"
+  "Nahuatl, Highland Puebla\0"
+  "Bashkir\0"
+  "Babatana\0"
+  "Bainouk-Gunyuño\0"
+  "Badui\0"
+  "Banda languages\0"
+  "Baré\0"
+  "Nubaca\0"
+  "Tuki\0"
+  "Creole English, Bahamas\0"
+  "Bamileke languages\0"
+  "Barakai\0"
+  "Baluchi\0"
+  "Bambara\0"
+  "Balinese\0"
+  "Waimaha\0"
+  "Bantawa\0"
+  "Basque\0"
+  "Bavarian\0"
+  "Basa (Cameroon)\0"
+  "Baltic languages\0"
+  "Bada (Nigeria)\0"
+  "Vengo\0"
+  "Bambili-Bambui\0"
+  "Bamun\0"
+  "Batuley\0"
+  "Baatonum\0"
+  "Barai\0"
+  "Batak Toba\0"
+  "Bau\0"
+  "Bangba\0"
+  "Baibai\0"
+  "Barama\0"
+  "Bugan\0"
+  "Barombi\0"
+  "Ghomálá'\0"
+  "Babanki\0"
+  "Bats\0"
+  "Babango\0"
+  "Uneapa\0"
+  "Bobo Madaré, Northern\0"
+  "Banda, West Central\0"
+  "Bamali\0"
+  "Girawa\0"
+  "Bakpinka\0"
+  "Mburku\0"
+  "Kulung (Nigeria)\0"
+  "Karnai\0"
+  "Baba\0"
+  "Bubia\0"
+  "Befang\0"
+  "Bai, Central\0"
+  "Bainouk-Samik\0"
+  "Balochi, Southern\0"
+  "Babar, North\0"
+  "Bamenyam\0"
+  "Bamu\0"
+  "Baga Pokur\0"
+  "Bariai\0"
+  "Baoulé\0"
+  "Bardi\0"
+  "Bunuba\0"
+  "Bikol, Central\0"
+  "Bannoni\0"
+  "Bali (Nigeria)\0"
+  "Kaluli\0"
+  "Bali (Democratic Republic of Congo)\0"
+  "Bench\0"
+  "Babine\0"
+  "Kohumono\0"
+  "Bendi\0"
+  "Awad Bing\0"
+  "Shoo-Minda-Nye\0"
+  "Bana\0"
+  "Bacama\0"
+  "Bainouk-Gunyaamolo\0"
+  "Bayot\0"
+  "Basap\0"
+  "Emberá-Baudó\0"
+  "Bunama\0"
+  "Bade\0"
+  "Biage\0"
+  "Bonggi\0"
+  "Baka (South Sudan)\0"
+  "Burun\0"
+  "Bai (South Sudan)\0"
+  "Budukh\0"
+  "Bajau, Indonesian\0"
+  "Buduma\0"
+  "Baldemu\0"
+  "Morom\0"
+  "Bende\0"
+  "Bahnar\0"
+  "Bajau, West Coast\0"
+  "Burunge\0"
+  "Bokoto\0"
+  "Oroko\0"
+  "Bodo Parja\0"
+  "Baham\0"
+  "Budong-Budong\0"
+  "Bandjalang\0"
+  "Badeshi\0"
+  "Belarusian\0"
+  "Beaver\0"
+  "Bebele\0"
+  "Iceve-Maci\0"
+  "Bedoanas\0"
+  "Byangsi\0"
+  "Benabena\0"
+  "Belait\0"
+  "Biali\0"
+  "Bekati'\0"
+  "Beja\0"
+  "Bebeli\0"
+  "Bemba (Zambia)\0"
+  "Bengali\0"
+  "Beami\0"
+  "Besoa\0"
+  "Beembe\0"
+  "Berber languages\0"
+  "Besme\0"
+  "Béte, Guiberoua\0"
+  "Blagar\0"
+  "Bété, Daloa\0"
+  "Betawi\0"
+  "Jur Modo\0"
+  "Beli (Papua New Guinea)\0"
+  "Bena (Tanzania)\0"
+  "Bari\0"
+  "Bareli, Pauri\0"
+  "Bai, Panyi\0"
+  "Bafut\0"
+  "Betaf\0"
+  "Bofi\0"
+  "Kayan, Busang\0"
+  "Blafe\0"
+  "British Sign Language\0"
+  "Bafanji\0"
+  "Ban Khor Sign Language\0"
+  "Banda-Ndélé\0"
+  "Mmen\0"
+  "Bunak\0"
+  "Birifor, Malba\0"
+  "Beba\0"
+  "Badaga\0"
+  "Bazigar\0"
+  "Bai, Southern\0"
+  "Balti\0"
+  "Gahri\0"
+  "Bondo\0"
+  "Bantayanon\0"
+  "Bagheli\0"
+  "Pahari, Mahasu\0"
+  "Bulgarian\0"
+  "Gwamhi-Wuri\0"
+  "Bobongko\0"
+  "Haryanvi\0"
+  "Bareli, Rathwi\0"
+  "Bauria\0"
+  "Bangandu\0"
+  "Bugun\0"
+  "Giangan\0"
+  "Bangolan\0"
+  "Bit\0"
+  "Bo (Laos)\0"
+  "Balochi, Western\0"
+  "Baga Koga\0"
+  "Balochi, Eastern\0"
+  "Bagri\0"
+  "Chin, Bawm\0"
+  "Tagabawa\0"
+  "Bughotu\0"
+  "Mbongno\0"
+  "Warkay-Bipim\0"
+  "Bhatri\0"
+  "Turkish, Balkan Gagauz\0"
+  "Benggoi\0"
+  "Banggai\0"
+  "Bihari languages\0"
+  "Bharia\0"
+  "Bhili\0"
+  "Biga\0"
+  "Bhadrawahi\0"
+  "Bhaya\0"
+  "Odiai\0"
+  "Binandere\0"
+  "Bukharic\0"
+  "Bhilali\0"
+  "Bahing\0"
+  "Bimin\0"
+  "Bathari\0"
+  "Neo-Aramaic, Bohtan\0"
+  "Bhojpuri\0"
+  "Bima\0"
+  "Tukang Besi South\0"
+  "Malagasy, Bara\0"
+  "Buwal\0"
+  "Bhattiyali\0"
+  "Bhunjia\0"
+  "Bahau\0"
+  "Biak\0"
+  "Bhalay\0"
+  "Bhele\0"
+  "Bada (Indonesia)\0"
+  "Bislama\0"
+  "Badimaya\0"
+  "Bissa\0"
+  "Bidiyo\0"
+  "Bepour\0"
+  "Biafada\0"
+  "Biangai\0"
+  "Bikol\0"
+  "Bile\0"
+  "Bimoba\0"
+  "Bini\0"
+  "Nai\0"
+  "Bila\0"
+  "Bipi\0"
+  "Bisorio\0"
+  "Berinomo\0"
+  "Biete\0"
+  "Birifor, Southern\0"
+  "Kol (Cameroon)\0"
+  "Bijori\0"
+  "Birhor\0"
+  "Baloi\0"
+  "Budza\0"
+  "Banggarla\0"
+  "Bariji\0"
+  "Mien, Biao-Jiao\0"
+  "Neo-Aramaic, Barzani Jewish\0"
+  "Bidyogo\0"
+  "Bahinemo\0"
+  "Burji\0"
+  "Kanauji\0"
+  "Barok\0"
+  "Bulu (Papua New Guinea)\0"
+  "Bajelani\0"
+  "Banjar\0"
+  "Banda, Mid-Southern\0"
+  "Fanamaket\0"
+  "Binumarien\0"
+  "Bajan\0"
+  "Balanta-Ganja\0"
+  "Busuu\0"
+  "Bedjond\0"
+  "Bakwé\0"
+  "Itneg, Banao\0"
+  "Bayali\0"
+  "Baruga\0"
+  "Kyak\0"
+  "Baka (Cameroon)\0"
+  "Binukid\0"
+  "Beeke\0"
+  "Buraka\0"
+  "Bakoko\0"
+  "Baki\0"
+  "Pande\0"
+  "Brokskat\0"
+  "Berik\0"
+  "Kom (Cameroon)\0"
+  "Bukitan\0"
+  "Kwa'\0"
+  "Boko (Democratic Republic of Congo)\0"
+  "Bakairí\0"
+  "Bakumpai\0"
+  "Sorsoganon, Northern\0"
+  "Boloki\0"
+  "Buhid\0"
+  "Bekwarra\0"
+  "Bekwel\0"
+  "Baikeno\0"
+  "Bokyi\0"
+  "Bungku\0"
+  "Siksika\0"
+  "Bilua\0"
+  "Bella Coola\0"
+  "Bolango\0"
+  "Balanta-Kentohe\0"
+  "Buol\0"
+  "Kuwaa\0"
+  "Bolia\0"
+  "Bolongan\0"
+  "Karen, Pa'o\0"
+  "Biloxi\0"
+  "Beli (South Sudan)\0"
+  "Bikol, Southern Catanduanes\0"
+  "Anii\0"
+  "Blablanga\0"
+  "Baluan-Pam\0"
+  "Blang\0"
+  "Balaesang\0"
+  "Tai Dam\0"
+  "Kibala\0"
+  "Balangao\0"
+  "Ayta, Mag-Indi\0"
+  "Notre\0"
+  "Balantak\0"
+  "Lame\0"
+  "Bembe\0"
+  "Biem\0"
+  "Manduri, Baga\0"
+  "Limassa\0"
+  "Bom-Kim\0"
+  "Bamwe\0"
+  "Kein\0"
+  "Bagirmi\0"
+  "Bote-Majhi\0"
+  "Ghayavi\0"
+  "Bomboli\0"
+  "Malagasy, Northern Betsimisaraka\0"
+  "Bina (Papua New Guinea)\0"
+  "Bambalang\0"
+  "Bulgebi\0"
+  "Bomu\0"
+  "Muinane\0"
+  "Kanuri, Bilma\0"
+  "Biao Mon\0"
+  "Somba-Siawari\0"
+  "Bum\0"
+  "Bomwali\0"
+  "Baimak\0"
+  "Baramu\0"
+  "Bonerate\0"
+  "Bookan\0"
+  "Bontok\0"
+  "Banda (Indonesia)\0"
+  "Bintauna\0"
+  "Masiwang\0"
+  "Benga\0"
+  "Bangi\0"
+  "Tawbuid, Eastern\0"
+  "Bierebo\0"
+  "Boon\0"
+  "Batanga\0"
+  "Bunun\0"
+  "Bantoanon\0"
+  "Bola\0"
+  "Bantik\0"
+  "Butmas-Tur\0"
+  "Bundeli\0"
+  "Bantu (Other)\0"
+  "Bentong\0"
+  "Bonerif\0"
+  "Bisis\0"
+  "Bangubangu\0"
+  "Bintulu\0"
+  "Beezen\0"
+  "Tibetan\0"
+  "Bora\0"
+  "Aweer\0"
+  "Mundabli\0"
+  "Bolon\0"
+  "Bamako Sign Language\0"
+  "Boma\0"
+  "Barbareño\0"
+  "Anjam\0"
+  "Bonjo\0"
+  "Bole\0"
+  "Berom\0"
+  "Bine\0"
+  "Bozo, Tiemacèwè\0"
+  "Bonkiman\0"
+  "Bogaya\0"
+  "Borôro\0"
+  "Bosnian\0"
+  "Bongo\0"
+  "Bondei\0"
+  "Tuwuli\0"
+  "Rema\0"
+  "Buamu\0"
+  "Bodo (Central African Republic)\0"
+  "Bozo, Tiéyaxo\0"
+  "Daakaka\0"
+  "Mbuk\0"
+  "Banda-Banda\0"
+  "Bauni\0"
+  "Bonggo\0"
+  "Botlikh\0"
+  "Bagupi\0"
+  "Binji\0"
+  "Orowe\0"
+  "Broome Pearling Lugger Pidgin\0"
+  "Biyom\0"
+  "Dzao Min\0"
+  "Anasi\0"
+  "Kaure\0"
+  "Malay, Banda\0"
+  "Blaan, Koronadal\0"
+  "Blaan, Sarangani\0"
+  "Barrow Point\0"
+  "Bongu\0"
+  "Marind, Bian\0"
+  "Bo (Papua New Guinea)\0"
+  "Bareli, Palya\0"
+  "Bishnupriya\0"
+  "Bilba\0"
+  "Tchumbuli\0"
+  "Bagusa\0"
+  "Boko (Benin)\0"
+  "Bung\0"
+  "Baga Kaloum\0"
+  "Bago-Kusuntu\0"
+  "Baima\0"
+  "Bakhtiari\0"
+  "Bandial\0"
+  "Banda-Mbrès\0"
+  "Bilakura\0"
+  "Wumboko\0"
+  "Bulgarian Sign Language\0"
+  "Balo\0"
+  "Busa\0"
+  "Biritai\0"
+  "Burusu\0"
+  "Bosngun\0"
+  "Bamukumbit\0"
+  "Boguru\0"
+  "Koro Wachi\0"
+  "Buru (Nigeria)\0"
+  "Baangi\0"
+  "Bengkala Sign Language\0"
+  "Bakaka\0"
+  "Breton\0"
+  "Braj\0"
+  "Brao\0"
+  "Creole Dutch, Berbice\0"
+  "Baraamu\0"
+  "Bira\0"
+  "Baure\0"
+  "Brahui\0"
+  "Mokpwe\0"
+  "Bieria\0"
+  "Birked\0"
+  "Birwa\0"
+  "Barambu\0"
+  "Boruca\0"
+  "Brokkat\0"
+  "Barapasi\0"
+  "Breri\0"
+  "Birao\0"
+  "Baras\0"
+  "Bitare\0"
+  "Bru, Eastern\0"
+  "Bru, Western\0"
+  "Bellari\0"
+  "Bodo (India)\0"
+  "Burui\0"
+  "Bilbil\0"
+  "Abinomn\0"
+  "Bisaya, Brunei\0"
+  "Bassari\0"
+  "Wushi\0"
+  "Bauchi\0"
+  "Bashkardi\0"
+  "Kati\0"
+  "Bassossi\0"
+  "Bangwinji\0"
+  "Burushaski\0"
+  "Basa-Gumna\0"
+  "Busami\0"
+  "Barasana-Eduria\0"
+  "Buso\0"
+  "Baga Sitemu\0"
+  "Bassa\0"
+  "Bassa-Kontagora\0"
+  "Akoose\0"
+  "Basketo\0"
+  "Bahonsuai\0"
+  "Baga Sobané\0"
+  "Baiso\0"
+  "Yangkam\0"
+  "Bisaya, Sabah\0"
+  "Bata\0"
+  "Bati (Cameroon)\0"
+  "Batak Dairi\0"
+  "Gamo-Ningi\0"
+  "Birgit\0"
+  "Bété, Gagnoa\0"
+  "Bidayuh, Biatah\0"
+  "Burate\0"
+  "Malay, Bacanese\0"
+  "Batak languages\0"
+  "Batak Mandailing\0"
+  "Ratagnon\0"
+  "Bikol, Rinconada\0"
+  "Budibud\0"
+  "Batek\0"
+  "Baetora\0"
+  "Batak Simalungun\0"
+  "Bete-Bendi\0"
+  "Batu\0"
+  "Bateri\0"
+  "Butuanon\0"
+  "Batak Karo\0"
+  "Bobot\0"
+  "Batak Alas-Kluet\0"
+  "Buriat\0"
+  "Bua\0"
+  "Bushi\0"
+  "Ntcham\0"
+  "Beothuk\0"
+  "Bushoong\0"
+  "Buginese\0"
+  "Bunu, Younuo\0"
+  "Bongili\0"
+  "Basa-Gurmana\0"
+  "Bugawac\0"
+  "Bulu (Cameroon)\0"
+  "Sherbro\0"
+  "Terei\0"
+  "Busoa\0"
+  "Brem\0"
+  "Burmese\0"
+  "Bokobaru\0"
+  "Bungain\0"
+  "Budu\0"
+  "Bun\0"
+  "Bubi\0"
+  "Boghom\0"
+  "Bullom So\0"
+  "Bukwen\0"
+  "Barein\0"
+  "Bube\0"
+  "Baelelea\0"
+  "Baeggu\0"
+  "Malay, Berau\0"
+  "Boor\0"
+  "Bonkeng\0"
+  "Bure\0"
+  "Belanda Viri\0"
+  "Baan\0"
+  "Bukat\0"
+  "Bolivian Sign Language\0"
+  "Bamunka\0"
+  "Buna\0"
+  "Bolgo\0"
+  "Bumang\0"
+  "Birri\0"
+  "Burarra\0"
+  "Bati (Indonesia)\0"
+  "Malay, Bukit\0"
+  "Baniva\0"
+  "Boga\0"
+  "Dibole\0"
+  "Baybayanon\0"
+  "Bauzi\0"
+  "Bwatoo\0"
+  "Namosi-Naitasiri-Serua\0"
+  "Bwile\0"
+  "Bwaidoka\0"
+  "Karen, Bwe\0"
+  "Boselewa\0"
+  "Barwe\0"
+  "Bishuo\0"
+  "Baniwa\0"
+  "Bwamu, Láá Láá\0"
+  "Bauwaki\0"
+  "Bwela\0"
+  "Biwat\0"
+  "Bunu, Wunai\0"
+  "Boro (Ethiopia)\0"
+  "Mandobo Bawah\0"
+  "Bobo Madaré, Southern\0"
+  "Bura-Pabir\0"
+  "Bomboma\0"
+  "Bafaw-Balong\0"
+  "Buli (Ghana)\0"
+  "Bwa\0"
+  "Bunu, Bu-Nao\0"
+  "Bwamu, Cwi\0"
+  "Bwisi\0"
+  "Tairaha\0"
+  "Bor, Belanda\0"
+  "Molengue\0"
+  "Pela\0"
+  "Birale\0"
+  "Bilur\0"
+  "Bangala\0"
+  "Buhutu\0"
+  "Pirlatapa\0"
+  "Bayungu\0"
+  "Bukusu\0"
+  "Jalkunan\0"
+  "Buriat, Mongolia\0"
+  "Burduna\0"
+  "Barikanchi\0"
+  "Bebil\0"
+  "Beele\0"
+  "Buriat, Russia\0"
+  "Busam\0"
+  "Buriat, China\0"
+  "Berakou\0"
+  "Bankagooma\0"
+  "Binahari\0"
+  "Batak\0"
+  "Bikya\0"
+  "Ubaghara\0"
+  "Benyadu'\0"
+  "Pouye\0"
+  "Bete\0"
+  "Baygo\0"
+  "Bhujel\0"
+  "Buyu\0"
+  "Bina (Nigeria)\0"
+  "Biao\0"
+  "Bayono\0"
+  "Bidjara\0"
+  "Bilin\0"
+  "Biyo\0"
+  "Bumaji\0"
+  "Basay\0"
+  "Baruya\0"
+  "Burak\0"
+  "Berti\0"
+  "Medumba\0"
+  "Belhariya\0"
+  "Qaqet\0"
+  "Banaro\0"
+  "Bandi\0"
+  "Andio\0"
+  "Malagasy, Southern Betsimisaraka\0"
+  "Bribri\0"
+  "Bozo, Jenaama\0"
+  "Boikin\0"
+  "Babuza\0"
+  "Buang, Mapos\0"
+  "Bisu\0"
+  "Kriol English, Belize\0"
+  "Creole English, Nicaragua\0"
+  "Boano (Sulawesi)\0"
+  "Bolondo\0"
+  "Boano (Maluku)\0"
+  "Bozaba\0"
+  "Kemberano\0"
+  "Buli (Indonesia)\0"
+  "Biri\0"
+  "Brazilian Sign Language\0"
+  "Brithenig\0"
+  "Burmeso\0"
+  "Naami\0"
+  "Basa (Nigeria)\0"
+  "Bozo, Kɛlɛngaxo\0"
+  "Obanliku\0"
+  "Evant\0"
+  "Catalan; Valencian\0"
+  "Chortí\0"
+  "Garifuna\0"
+  "Chuj\0"
+  "Caddo\0"
+  "Lehar\0"
+  "Carrier, Southern\0"
+  "Nivaclé\0"
+  "Cahuarano\0"
+  "Central American Indian languages\0"
+  "Chané\0"
+  "Kaqchikel\0"
+  "Carolinian\0"
+  "Cemuhî\0"
+  "Chambri\0"
+  "Chácobo\0"
+  "Chipaya\0"
+  "Nicobarese, Car\0"
+  "Carib, Galibi\0"
+  "Tsimané\0"
+  "Catalan\0"
+  "Caucasian languages\0"
+  "Cavineña\0"
+  "Callawalla\0"
+  "Chiquitano\0"
+  "Cayuga\0"
+  "Canichana\0"
+  "Cabiyarí\0"
+  "Carapana\0"
+  "Carijona\0"
+  "Chimila\0"
+  "Chachi\0"
+  "Ede Cabe\0"
+  "Chavacano\0"
+  "Chin, Bualkhaw\0"
+  "Nyahkur\0"
+  "Izora\0"
+  "Tsucuba\0"
+  "Cashibo-Cacataibo\0"
+  "Cashinahua\0"
+  "Chayahuita\0"
+  "Candoshi-Shapra\0"
+  "Cacua\0"
+  "Kinabalian\0"
+  "Carabayo\0"
+  "Chamicuro\0"
+  "Creole, Cafundo\0"
+  "Chopi\0"
+  "Daka, Samba\0"
+  "Atsam\0"
+  "Kasanga\0"
+  "Cutchi-Swahili\0"
+  "Creole Malay, Malaccan\0"
+  "Chinantec, Comaltepec\0"
+  "Chakma\0"
+  "Cacaopera\0"
+  "Choni\0"
+  "Chenchu\0"
+  "Chiru\0"
+  "Chambeali\0"
+  "Chodri\0"
+  "Churahi\0"
+  "Chepang\0"
+  "Chaudangsi\0"
+  "Chinese, Min Dong\0"
+  "Cinda-Regi-Tiyal\0"
+  "Chadian Sign Language\0"
+  "Chadong\0"
+  "Koda\0"
+  "Chechen\0"
+  "Chehalis, Lower\0"
+  "Cebuano\0"
+  "Chamacoco\0"
+  "Chin, Eastern Khumi\0"
+  "Celtic languages\0"
+  "Cen\0"
+  "Czech\0"
+  "Centúúm\0"
+  "Chin, Ekai\0"
+  "Dijim-Bwilim\0"
+  "Cara\0"
+  "Como Karim\0"
+  "Chin, Falam\0"
+  "Changriwa\0"
+  "Kagayanen\0"
+  "Chiga\0"
+  "Chocangacakha\0"
+  "Chamorro\0"
+  "Chibcha\0"
+  "Catawba\0"
+  "Chontal, Highland Oaxaca\0"
+  "Chontal, Tabasco\0"
+  "Chagatai\0"
+  "Chinook\0"
+  "Chinese\0"
+  "Chinantec, Ojitlán\0"
+  "Chuukese\0"
+  "Cahuilla\0"
+  "Mari (Russia)\0"
+  "Chinook jargon\0"
+  "Choctaw\0"
+  "Chipewyan\0"
+  "Chinantec, Quiotepec\0"
+  "Cherokee\0"
+  "Cholón\0"
+  "Slavic, Church\0"
+  "Chuvash\0"
+  "Chuwabu\0"
+  "Chantyal\0"
+  "Cheyenne\0"
+  "Chinantec, Ozumacín\0"
+  "Cia-Cia\0"
+  "Gbe, Ci\0"
+  "Chickasaw\0"
+  "Chimariko\0"
+  "Cineni\0"
+  "Chinali\0"
+  "Kinnauri, Chitkuli\0"
+  "Cimbrian\0"
+  "Cinta Larga\0"
+  "Chiapanec\0"
+  "Tiri\0"
+  "Chippewa\0"
+  "Chaima\0"
+  "Cham, Western\0"
+  "Chru\0"
+  "Chehalis, Upper\0"
+  "Chamalal\0"
+  "Chokwe\0"
+  "Cham, Eastern\0"
+  "Chenapian\0"
+  "Ashéninka Pajonal\0"
+  "Cabécar\0"
+  "Shor\0"
+  "Chuave\0"
+  "Chinese, Jinyu\0"
+  "Kurdish, Central\0"
+  "Chak\0"
+  "Cibak\0"
+  "Chakavian\0"
+  "Chin, Kaang\0"
+  "Anufo\0"
+  "Kajakse\0"
+  "Kairak\0"
+  "Tayo\0"
+  "Chukot\0"
+  "Koasati\0"
+  "Kavalan\0"
+  "Caka\0"
+  "Cakfem-Mushere\0"
+  "Cakchiquel-Quiché Mixed Language\0"
+  "Ron\0"
+  "Chilcotin\0"
+  "Neo-Aramaic, Chaldean\0"
+  "Chinantec, Lealao\0"
+  "Chilisso\0"
+  "Chakali\0"
+  "Chin, Laitu\0"
+  "Idu-Mishmi\0"
+  "Chala\0"
+  "Clallam\0"
+  "Chontal, Lowland Oaxaca\0"
+  "Chin, Lautu\0"
+  "Caluyanun\0"
+  "Chulym\0"
+  "Chatino, Eastern Highland\0"
+  "Maa\0"
+  "Chamic languages\0"
+  "Cerma\0"
+  "Mongolian, Classical\0"
+  "Emberá-Chamí\0"
+  "Campalagian\0"
+  "Michigamea\0"
+  "Chinese, Mandarin\0"
+  "Mnong, Central\0"
+  "Chin, Mro-Khimi\0"
+  "Messapic\0"
+  "Camtho\0"
+  "Changthang\0"
+  "Chin, Chinbon\0"
+  "Côông\0"
+  "Qiang, Northern\0"
+  "Chin, Hakha\0"
+  "Asháninka\0"
+  "Chin, Khumi\0"
+  "Chinantec, Lalana\0"
+  "Con\0"
+  "Chinese, Northern Ping\0"
+  "Chung\0"
+  "Montenegrin\0"
+  "Asmat, Central\0"
+  "Chinantec, Tepetotutla\0"
+  "Chenoua\0"
+  "Chin, Ngawn\0"
+  "Cornish, Middle\0"
+  "Corsican\0"
+  "Malay, Cocos Islands\0"
+  "Chicomuceltec\0"
+  "Cocopa\0"
+  "Cocama-Cocamilla\0"
+  "Koreguaje\0"
+  "Colorado\0"
+  "Chong\0"
+  "Chonyi-Dzihana-Kauma\0"
+  "Cochimi\0"
+  "Cora, Santa Teresa\0"
+  "Columbia-Wenatchi\0"
+  "Comanche\0"
+  "Cofán\0"
+  "Comox\0"
+  "Coptic\0"
+  "Coquille\0"
+  "Cornish\0"
+  "Caquinte\0"
+  "Wamey\0"
+  "Cao Miao\0"
+  "Cowlitz\0"
+  "Nanti\0"
+  "Chochotec\0"
+  "Chinantec, Palantla\0"
+  "Ashéninka, Ucayali-Yurúa\0"
+  "Ajyíninka Apurucayali\0"
+  "Creoles and pidgins, English based\0"
+  "Creoles and pidgins, French-based\0"
+  "Greek, Cappadocian\0"
+  "Pidgin English, Chinese\0"
+  "Cherepon\0"
+  "Kpeego\0"
+  "Creoles and pidgins, Portuguese-based\0"
+  "Capiznon\0"
+  "Ashéninka, Pichis\0"
+  "Chinese, Pu-Xian\0"
+  "Ashéninka, South Ucayali\0"
+  "Miao, Chuanqiandian Cluster\0"
+  "Cree\0"
+  "Chara\0"
+  "Carib, Island\0"
+  "Lonwolwol\0"
+  "Coeur d'Alene\0"
+  "Caramanta\0"
+  "Michif\0"
+  "Tatar, Crimean\0"
+  "Sãotomense\0"
+  "Cree, Southern East\0"
+  "Cree, Plains\0"
+  "Cree, Northern East\0"
+  "Cree, Moose\0"
+  "Cora, El Nayar\0"
+  "Crow\0"
+  "Creoles and pidgins\0"
+  "Chorote, Iyo'wujwa\0"
+  "Algonquian, Carolina\0"
+  "Creole French, Seselwa\0"
+  "Chorote, Iyojwa'ja\0"
+  "Chaura\0"
+  "Chrau\0"
+  "Carrier\0"
+  "Cori\0"
+  "Cruzeño\0"
+  "Chinantec, Chiltepec\0"
+  "Kashubian\0"
+  "Catalan Sign Language\0"
+  "Chiangmai Sign Language\0"
+  "Czech Sign Language\0"
+  "Cuba Sign Language\0"
+  "Chilean Sign Language\0"
+  "Chin, Asho\0"
+  "Miwok, Coast\0"
+  "Chin, Songlai\0"
+  "Jola-Kasa\0"
+  "Chinese Sign Language\0"
+  "Miwok, Central Sierra\0"
+  "Colombian Sign Language\0"
+  "Chinantec, Sochiapam\0"
+  "Chinese, Southern Ping\0"
+  "Croatia Sign Language\0"
+  "Costa Rican Sign Language\0"
+  "Ohlone, Southern\0"
+  "Ohlone, Northern\0"
+  "Chin, Sumtu\0"
+  "Cree, Swampy\0"
+  "Cambodian Sign Language\0"
+  "Chin, Siyin\0"
+  "Coos\0"
+  "Chatino, Tataltepec\0"
+  "Chetco\0"
+  "Chin, Tedim\0"
+  "Chinantec, Tepinapa\0"
+  "Chittagonian\0"
+  "Chin, Thaiphum\0"
+  "Chinantec, Tlacoatzintepec\0"
+  "Chitimacha\0"
+  "Chhintange\0"
+  "Emberá-Catío\0"
+  "Chatino, Western Highland\0"
+  "Bikol, Northern Catanduanes\0"
+  "Chetti, Wayanad\0"
+  "Chol\0"
+  "Moundadan Chetty\0"
+  "Chatino, Zacatepec\0"
+  "Church Slavic; Old Slavonic; Church Slavonic; Old Bulgarian; Old Church Slavonic\0"
+  "Cua\0"
+  "Cubeo\0"
+  "Chinantec, Usila\0"
+  "Chuka\0"
+  "Cuiba\0"
+  "Mashco Piro\0"
+  "Kuna, San Blas\0"
+  "Culina\0"
+  "Cumanagoto\0"
+  "Cupeño\0"
+  "Cun\0"
+  "Chhulung\0"
+  "Cushitic languages\0"
+  "Cuicatec, Teutila\0"
+  "Tai Ya\0"
+  "Cuvok\0"
+  "Chukwa\0"
+  "Cuicatec, Tepeuxila\0"
+  "Cuitlatec\0"
+  "Chug\0"
+  "Chinantec, Valle Nacional\0"
+  "Kabwa\0"
+  "Maindo\0"
+  "Cree, Woods\0"
+  "Kwere\0"
+  "Chewong\0"
+  "Kuwaataay\0"
+  "Welsh\0"
+  "Chatino, Nopala\0"
+  "Cayubaba\0"
+  "Cuyonon\0"
+  "Chinese, Huizhou\0"
+  "Knaanic\0"
+  "Chatino, Zenzontepec\0"
+  "Chinese, Min Zhong\0"
+  "Chin, Zotung\0"
+  "Danish\0"
+  "Dangaléat\0"
+  "Dambi\0"
+  "Marik\0"
+  "Duupa\0"
+  "Dagbani\0"
+  "Gwahatike\0"
+  "Day\0"
+  "Daju, Dar Fur\0"
+  "Dakota\0"
+  "Dahalo\0"
+  "Damakawa\0"
+  "Chin, Daai\0"
+  "Maria, Dandami\0"
+  "Dargwa\0"
+  "Daho-Doo\0"
+  "Daju, Dar Sila\0"
+  "Taita\0"
+  "Davawenyo\0"
+  "Dayi\0"
+  "Land Dayak languages\0"
+  "Dao\0"
+  "Bangime\0"
+  "Deno\0"
+  "Dadiya\0"
+  "Dabe\0"
+  "Edopi\0"
+  "Dogon, Dogul Dom\0"
+  "Doka\0"
+  "Ida'an\0"
+  "Dyirbal\0"
+  "Duguri\0"
+  "Duriankere\0"
+  "Dulbu\0"
+  "Duwai\0"
+  "Daba\0"
+  "Dabarre\0"
+  "Dogon, Ben Tey\0"
+  "Dogon, Bondum Dom\0"
+  "Dungu\0"
+  "Dogon, Bankan Tey\0"
+  "Dibiyaso\0"
+  "Deccan\0"
+  "Negerhollands\0"
+  "Dadi Dadi\0"
+  "Dongotono\0"
+  "Doondo\0"
+  "Fataluku\0"
+  "Goodenough, West\0"
+  "Jaru\0"
+  "Dendi (Benin)\0"
+  "Dido\0"
+  "Dhudhuroa\0"
+  "Dogon, Donno So\0"
+  "Dawera-Daweloor\0"
+  "German\0"
+  "Dagik\0"
+  "Dedua\0"
+  "Dewoin\0"
+  "Dezfuli\0"
+  "Degema\0"
+  "Dehwari\0"
+  "Demisa\0"
+  "Dek\0"
+  "Delaware\0"
+  "Dem\0"
+  "Slave (Athapascan)\0"
+  "Delaware, Pidgin\0"
+  "Dendi (Central African Republic)\0"
+  "Deori\0"
+  "Desano\0"
+  "Domung\0"
+  "Dengese\0"
+  "Dagaare, Southern\0"
+  "Dogon, Bunoge\0"
+  "Agta, Casiguran Dumagat\0"
+  "Dagaari Dioula\0"
+  "Degenan\0"
+  "Doga\0"
+  "Dghwede\0"
+  "Dagara, Northern\0"
+  "Dagba\0"
+  "Andaandi\0"
+  "Dagoman\0"
+  "Dogri (individual language)\0"
+  "Dogrib\0"
+  "Dogoso\0"
+  "Ndra'ngith\0"
+  "Daungwurrung\0"
+  "Doghoro\0"
+  "Daga\0"
+  "Dhundari\0"
+  "Dhangu-Djangu\0"
+  "Dhimal\0"
+  "Dhalandji\0"
+  "Zemba\0"
+  "Dhanki\0"
+  "Dhodia\0"
+  "Dhargari\0"
+  "Dhaiso\0"
+  "Dhurga\0"
+  "Dehu\0"
+  "Dhanwar (Nepal)\0"
+  "Dhungaloo\0"
+  "Dia\0"
+  "Dinka, South Central\0"
+  "Dida, Lakota\0"
+  "Didinga\0"
+  "Dieri\0"
+  "Digo\0"
+  "Kumiai\0"
+  "Dimbong\0"
+  "Dai\0"
+  "Dinka, Southwestern\0"
+  "Dilling\0"
+  "Dime\0"
+  "Dinka\0"
+  "Dibo\0"
+  "Dinka, Northeastern\0"
+  "Dimli (individual language)\0"
+  "Dirim\0"
+  "Dimasa\0"
+  "Diriku\0"
+  "Dhivehi\0"
+  "Dinka, Northwestern\0"
+  "Dixon Reef\0"
+  "Diuwe\0"
+  "Ding\0"
+  "Djadjawurrung\0"
+  "Djinba\0"
+  "Daju, Dar Daju\0"
+  "Djamindjung\0"
+  "Zarma\0"
+  "Djangun\0"
+  "Djinang\0"
+  "Djeebbana\0"
+  "Eastern Maroon Creole\0"
+  "Dogon, Jamsay\0"
+  "Jawoyn\0"
+  "Jangkang\0"
+  "Djambarrpuyngu\0"
+  "Kapriman\0"
+  "Djawi\0"
+  "Dakpakha\0"
+  "Kadung\0"
+  "Dakka\0"
+  "Kuijau\0"
+  "Dinka, Southeastern\0"
+  "Mazagway\0"
+  "Dolgan\0"
+  "Dahalik\0"
+  "Dalmatian\0"
+  "Darlong\0"
+  "Duma\0"
+  "Dogon, Mombo\0"
+  "Gavak\0"
+  "Madhi Madhi\0"
+  "Dugwor\0"
+  "Medefaidrin\0"
+  "Kinabatangan, Upper\0"
+  "Domaaki\0"
+  "Dameli\0"
+  "Dama\0"
+  "Kemedzung\0"
+  "Damar, East\0"
+  "Dampelas\0"
+  "Dubu\0"
+  "Dumpas\0"
+  "Mudburra\0"
+  "Dema\0"
+  "Demta\0"
+  "Dani, Upper Grand Valley\0"
+  "Daonda\0"
+  "Ndendeule\0"
+  "Dungan\0"
+  "Dani, Lower Grand Valley\0"
+  "Dan\0"
+  "Dengka\0"
+  "Dzùùngoo\0"
+  "Ndrulo\0"
+  "Danaru\0"
+  "Dani, Mid Grand Valley\0"
+  "Danau\0"
+  "Danu\0"
+  "Dani, Western\0"
+  "Dení\0"
+  "Dom\0"
+  "Dobu\0"
+  "Dong, Northern\0"
+  "Doe\0"
+  "Domu\0"
+  "Dong\0"
+  "Dogri (macrolanguage)\0"
+  "Dondo\0"
+  "Doso\0"
+  "Toura (Papua New Guinea)\0"
+  "Dongo\0"
+  "Lukpa\0"
+  "Dominican Sign Language\0"
+  "Dori'o\0"
+  "Dogosé\0"
+  "Dass\0"
+  "Dombe\0"
+  "Doyayo\0"
+  "Bussa\0"
+  "Dompo\0"
+  "Dorze\0"
+  "Papar\0"
+  "Dravidian languages\0"
+  "Dair\0"
+  "Minderico\0"
+  "Darmiya\0"
+  "Dolpo\0"
+  "Rungus\0"
+  "C'Lela\0"
+  "Paakantyi\0"
+  "Damar, West\0"
+  "Melanau, Daro-Matu\0"
+  "Dura\0"
+  "Gedeo\0"
+  "Drents\0"
+  "Rukai\0"
+  "Darai\0"
+  "Sorbian, Lower\0"
+  "Dutch Sign Language\0"
+  "Daasanach\0"
+  "Disa\0"
+  "Danish Sign Language\0"
+  "Dusner\0"
+  "Desiya\0"
+  "Tadaksahak\0"
+  "Mardin Sign Language\0"
+  "Daur\0"
+  "Kadazan, Labuk-Kinabatangan\0"
+  "Ditidaht\0"
+  "Adithinngithigh\0"
+  "Dogon, Ana Tinga\0"
+  "Dogon, Tene Kan\0"
+  "Dogon, Tomo Kan\0"
+  "Daatsʼíin\0"
+  "Dogon, Tommo So\0"
+  "Dusun, Kadazan\0"
+  "Lotud\0"
+  "Dogon, Toro So\0"
+  "Dogon, Toro Tegu\0"
+  "Dogon, Tebul Ure\0"
+  "Dotyali\0"
+  "Duala\0"
+  "Dubli\0"
+  "Duna\0"
+  "Agta, Umiray Dumaget\0"
+  "Dumbea\0"
+  "Duruma\0"
+  "Dungra Bhil\0"
+  "Dumun\0"
+  "Uyajitaya\0"
+  "Agta, Alabat Island\0"
+  "Dutch, Middle (ca. 1050-1350)\0"
+  "Dusun Deyah\0"
+  "Agta, Dupaninan\0"
+  "Duano\0"
+  "Dusun Malang\0"
+  "Dii\0"
+  "Dumi\0"
+  "Dutch; Flemish\0"
+  "Drung\0"
+  "Duvle\0"
+  "Dusun Witu\0"
+  "Duungooma\0"
+  "Agta, Dicamay\0"
+  "Duli-Gey\0"
+  "Divehi; Dhivehi; Maldivian\0"
+  "Duau\0"
+  "Diri\0"
+  "Kui, Dawik\0"
+  "Dawro\0"
+  "Dutton World Speedwords\0"
+  "Dhuwal\0"
+  "Dawawa\0"
+  "Dhuwaya\0"
+  "Rai, Dewas\0"
+  "Dyan\0"
+  "Dyaberdyaber\0"
+  "Dyugun\0"
+  "Agta, Villa Viciosa\0"
+  "Senoufo, Djimini\0"
+  "Dogon, Yanda Dom\0"
+  "Dyangadi\0"
+  "Jola-Fonyi\0"
+  "Dyula\0"
+  "Djabugay\0"
+  "Dzongkha\0"
+  "Tunzu\0"
+  "Djiwarli\0"
+  "Dazaga\0"
+  "Dzalakha\0"
+  "Dzando\0"
+  "Karenggapa\0"
+  "Beginci\0"
+  "Ebughu\0"
+  "Bontok, Eastern\0"
+  "Teke-Ebo\0"
+  "Ebrié\0"
+  "Embu\0"
+  "Eteocretan\0"
+  "Ecuadorian Sign Language\0"
+  "Eteocypriot\0"
+  "Ewe\0"
+  "E\0"
+  "Efai\0"
+  "Efe\0"
+  "Efik\0"
+  "Ega\0"
+  "Emilian\0"
+  "Benamanga\0"
+  "Eggon\0"
+  "Egyptian (Ancient)\0"
+  "Miyakubo Sign Language\0"
+  "Ehueun\0"
+  "Eipomek\0"
+  "Eitiep\0"
+  "Askopan\0"
+  "Ejamat\0"
+  "Ekajuk\0"
+  "Ekit\0"
+  "Ekari\0"
+  "Eki\0"
+  "Estonian, Standard\0"
+  "Kol (Bangladesh)\0"
+  "Elip\0"
+  "Koti\0"
+  "Ekpeye\0"
+  "Yace\0"
+  "Kayah, Eastern\0"
+  "Greek, Modern (1453-)\0"
+  "Elepi\0"
+  "El Hugeirat\0"
+  "Nding\0"
+  "Elkei\0"
+  "Eleme\0"
+  "El Molo\0"
+  "Elu\0"
+  "Elamite\0"
+  "Emai-Iuleha-Ora\0"
+  "Embaloh\0"
+  "Emerillon\0"
+  "Meohang, Eastern\0"
+  "Mussau-Emira\0"
+  "Maninkakan, Eastern\0"
+  "Mamulique\0"
+  "Eman\0"
+  "Emberá, Northern\0"
+  "Minyag, Eastern\0"
+  "Yupik, Pacific Gulf\0"
+  "Muria, Eastern\0"
+  "Emplawas\0"
+  "Erromintxela\0"
+  "Mayan, Epigraphic\0"
+  "Mbessa\0"
+  "English\0"
+  "Apali\0"
+  "Markweeta\0"
+  "En\0"
+  "Ende\0"
+  "Enets, Forest\0"
+  "Enets, Tundra\0"
+  "Enlhet\0"
+  "English, Middle (1100-1500)\0"
+  "Engenni\0"
+  "Enggano\0"
+  "Enga\0"
+  "Emumu\0"
+  "Enu\0"
+  "Enwan (Edo State)\0"
+  "Enwan (Akwa Ibom State)\0"
+  "Enxet\0"
+  "Esperanto\0"
+  "Beti (Côte d'Ivoire)\0"
+  "Epie\0"
+  "Eravallan\0"
+  "Sie\0"
+  "Eruwa\0"
+  "Ogea\0"
+  "Efate, South\0"
+  "Horpa\0"
+  "Erre\0"
+  "Ersu\0"
+  "Eritai\0"
+  "Erokwanas\0"
+  "Spanish; Castilian\0"
+  "Ese Ejja\0"
+  "Gondi, Aheri\0"
+  "Eshtehardi\0"
+  "Inupiatun, North Alaskan\0"
+  "Inupiatun, Northwest Alaska\0"
+  "Egypt Sign Language\0"
+  "Esuma\0"
+  "Salvadoran Sign Language\0"
+  "Estonian Sign Language\0"
+  "Esselen\0"
+  "Yupik, Central Siberian\0"
+  "Estonian\0"
+  "Yupik, Central\0"
+  "Eskayan\0"
+  "Etebi\0"
+  "Etchemin\0"
+  "Ethiopian Sign Language\0"
+  "Eton (Vanuatu)\0"
+  "Eton (Cameroon)\0"
+  "Edolo\0"
+  "Yekhee\0"
+  "Etruscan\0"
+  "Ejagham\0"
+  "Eten\0"
+  "Semimi\0"
+  "Even\0"
+  "Uvbie\0"
+  "Evenki\0"
+  "Ewondo\0"
+  "Extremaduran\0"
+  "Eyak\0"
+  "Keiyo\0"
+  "Ezaa\0"
+  "Uzekwe\0"
+  "Persian\0"
+  "Fasu\0"
+  "Fa d'Ambu\0"
+  "Wagi\0"
+  "Fagani\0"
+  "Finongan\0"
+  "Fali, Baissa\0"
+  "Faiwol\0"
+  "Faita\0"
+  "Fang (Cameroon)\0"
+  "Fali, South\0"
+  "Fam\0"
+  "Fang (Equatorial Guinea)\0"
+  "Faroese\0"
+  "Paloor\0"
+  "Fataleka\0"
+  "Fanti\0"
+  "Fayu\0"
+  "Fala\0"
+  "Fars, Southwestern\0"
+  "Fars, Northwestern\0"
+  "Bikol, West Albay\0"
+  "Quebec Sign Language\0"
+  "Feroge\0"
+  "Fulah\0"
+  "Foia Foia\0"
+  "Fulfulde, Maasina\0"
+  "Fongoro\0"
+  "Finnish\0"
+  "Nobiin\0"
+  "Fyer\0"
+  "Faifi\0"
+  "Fijian\0"
+  "Filipino\0"
+  "Fipa\0"
+  "Firan\0"
+  "Finnish, Tornedalen\0"
+  "Finno-Ugrian languages\0"
+  "Fiwaga\0"
+  "Kirya-Konzəl\0"
+  "Finnish, Kven\0"
+  "Kalispel-Pend d'Oreille\0"
+  "Foau\0"
+  "Fali\0"
+  "Fali, North\0"
+  "Flinders Island\0"
+  "Fuliiru\0"
+  "Flaaitaal\0"
+  "Fe'fe'\0"
+  "Muria, Far Western\0"
+  "Fanbak\0"
+  "Fanagalo\0"
+  "Fania\0"
+  "Foodo\0"
+  "Foi\0"
+  "Foma\0"
+  "Fon\0"
+  "Fore\0"
+  "Siraya\0"
+  "Creole English, Fernando Po\0"
+  "Fas\0"
+  "French\0"
+  "French, Cajun\0"
+  "Fordata\0"
+  "Frankish\0"
+  "French, Middle (ca. 1400-1600)\0"
+  "French, Old (842-ca. 1400)\0"
+  "Arpitan\0"
+  "Forak\0"
+  "Frisian, Northern\0"
+  "Frisian, Eastern\0"
+  "Fortsenal\0"
+  "Frisian, Western\0"
+  "Finnish Sign Language\0"
+  "French Sign Language\0"
+  "Finland-Swedish Sign Language\0"
+  "Fulfulde, Adamawa\0"
+  "Pulaar\0"
+  "Futuna, East\0"
+  "Fulfulde, Borgu\0"
+  "Pular\0"
+  "Fulfulde, Western Niger\0"
+  "Fulfulde, Bagirmi\0"
+  "Ko\0"
+  "Fum\0"
+  "Fulniô\0"
+  "Fulfulde, Central-Eastern Niger\0"
+  "Friulian\0"
+  "Futuna-Aniwa\0"
+  "Furu\0"
+  "Fulfulde, Nigerian\0"
+  "Fuyug\0"
+  "Fur\0"
+  "Fwâi\0"
+  "Fwe\0"
+  "Western Frisian\0"
+  "Irish\0"
+  "Ga\0"
+  "Gabri\0"
+  "Great Andamanese, Mixed\0"
+  "Gaddang\0"
+  "Guarequena\0"
+  "Gende\0"
+  "Gagauz\0"
+  "Alekano\0"
+  "Borei\0"
+  "Gadsup\0"
+  "Gamkonora\0"
+  "Galolen\0"
+  "Kandawo\0"
+  "Chinese, Gan\0"
+  "Gants\0"
+  "Gal\0"
+  "Gata'\0"
+  "Galeya\0"
+  "Garasia, Adiwasi\0"
+  "Kenati\0"
+  "Gadaba, Mudhili\0"
+  "Nobonob\0"
+  "Oromo, Borana-Arsi-Guji\0"
+  "Gayo\0"
+  "Oromo, West Central\0"
+  "Gbaya (Central African Republic)\0"
+  "Kaytetye\0"
+  "Karajarri\0"
+  "Niksek\0"
+  "Gaikundi\0"
+  "Gbanziri\0"
+  "Gbe, Defi\0"
+  "Galela\0"
+  "Gadaba, Bodo\0"
+  "Gaddi\0"
+  "Gamit\0"
+  "Garhwali\0"
+  "Mo'da\0"
+  "Grebo, Northern\0"
+  "Gbaya-Bossangoa\0"
+  "Gbaya-Bozoum\0"
+  "Gbagyi\0"
+  "Gbe, Gbesi\0"
+  "Gagadu\0"
+  "Gbanu\0"
+  "Gabi-Gabi\0"
+  "Gbe, Eastern Xwla\0"
+  "Gbari\0"
+  "Dari, Zoroastrian\0"
+  "Mali\0"
+  "Ganggalida\0"
+  "Galice\0"
+  "Creole French, Guadeloupean\0"
+  "Creole English, Grenadian\0"
+  "Gaina\0"
+  "Creole French, Guianese\0"
+  "German, Colonia Tovar\0"
+  "Gaelic; Scottish Gaelic\0"
+  "Lohar, Gade\0"
+  "Gadaba, Pottangi Ollar\0"
+  "Gugu Badhun\0"
+  "Gedaged\0"
+  "Gude\0"
+  "Guduf-Gava\0"
+  "Ga'dang\0"
+  "Gadjerawang\0"
+  "Gundi\0"
+  "Gurdjar\0"
+  "Gadang\0"
+  "Dirasha\0"
+  "Laal\0"
+  "Umanakaina\0"
+  "Ghodoberi\0"
+  "Mehri\0"
+  "Wipi\0"
+  "Ghandruk Sign Language\0"
+  "Kungardutyi\0"
+  "Gudu\0"
+  "Godwari\0"
+  "Geruma\0"
+  "Kire\0"
+  "Grebo, Gboloo\0"
+  "Gade\0"
+  "Gerai\0"
+  "Gengle\0"
+  "German, Hutterite\0"
+  "Gebe\0"
+  "Gen\0"
+  "Ywom\0"
+  "ut-Ma'in\0"
+  "Germanic languages\0"
+  "Georgian\0"
+  "Geme\0"
+  "Geser-Gorom\0"
+  "Eviya\0"
+  "Gera\0"
+  "Garre\0"
+  "Enya\0"
+  "Geez\0"
+  "Patpatar\0"
+  "Gafat\0"
+  "Gao\0"
+  "Gbii\0"
+  "Gugadj\0"
+  "Gurr-goni\0"
+  "Gurgula\0"
+  "Kungarakany\0"
+  "Ganglau\0"
+  "Gitua\0"
+  "Gagu\0"
+  "Gogodala\0"
+  "Ghadamès\0"
+  "Gaelic, Hiberno-Scottish\0"
+  "Ghale, Southern\0"
+  "Ghale, Northern\0"
+  "Karen, Geko\0"
+  "Ghulfan\0"
+  "Ghanongga\0"
+  "Ghomara\0"
+  "Ghera\0"
+  "Guhu-Samane\0"
+  "Kuke\0"
+  "Kija\0"
+  "Gibanawa\0"
+  "Gail\0"
+  "Gidar\0"
+  "Gaɓogbo\0"
+  "Goaria\0"
+  "Githabul\0"
+  "Girirra\0"
+  "Gilbertese\0"
+  "Gimi (Eastern Highlands)\0"
+  "Hinukh\0"
+  "Gimi (West New Britain)\0"
+  "Gelao, Green\0"
+  "Gelao, Red\0"
+  "Giziga, North\0"
+  "Gitxsan\0"
+  "Mulao\0"
+  "Gelao, White\0"
+  "Gilima\0"
+  "Giyug\0"
+  "Giziga, South\0"
+  "Koli, Kachi\0"
+  "Gunditjmara\0"
+  "Gonja\0"
+  "Gurindji Kriol\0"
+  "Gujari\0"
+  "Guya\0"
+  "Magɨ (Madang Province)\0"
+  "Ndai\0"
+  "Gokana\0"
+  "Kok-Nar\0"
+  "Kpelle, Guinea\0"
+  "ǂUngkue\0"
+  "Galician\0"
+  "Gaelic, Scottish\0"
+  "Belning\0"
+  "Bon Gula\0"
+  "Nanai\0"
+  "Pashai, Northwest\0"
+  "Gula Iro\0"
+  "Gilaki\0"
+  "Garlali\0"
+  "Galambu\0"
+  "Glaro-Twabo\0"
+  "Gula (Chad)\0"
+  "Manx\0"
+  "Glavda\0"
+  "Gule\0"
+  "Gambera\0"
+  "Gula'alaa\0"
+  "Mághdì\0"
+  "Magɨyi\0"
+  "German, Middle High (ca. 1050-1500)\0"
+  "German, Middle Low\0"
+  "Gbaya-Mbodomo\0"
+  "Gimnime\0"
+  "Mirning\0"
+  "Gumalu\0"
+  "Gamo\0"
+  "Magoma\0"
+  "Greek, Mycenaean\0"
+  "Mgbolizhia\0"
+  "Guarani\0"
+  "Kaansa\0"
+  "Gangte\0"
+  "Guanche\0"
+  "Zulgo-Gemzek\0"
+  "Ganang\0"
+  "Ngangam\0"
+  "Lere\0"
+  "Gooniyandi\0"
+  "Ngen\0"
+  "ǁGana\0"
+  "Gangulu\0"
+  "Ginuman\0"
+  "Gumatj\0"
+  "Gondi, Northern\0"
+  "Gana\0"
+  "Gureng Gureng\0"
+  "Guntai\0"
+  "Gnau\0"
+  "Guaraní, Western Bolivian\0"
+  "Ganzi\0"
+  "Guro\0"
+  "Playero\0"
+  "Gorakor\0"
+  "Godié\0"
+  "Gongduk\0"
+  "Gofa\0"
+  "Gogo\0"
+  "German, Old High (ca. 750-1050)\0"
+  "Gobasi\0"
+  "Gowlan\0"
+  "Gowli\0"
+  "Gola\0"
+  "Konkani, Goan\0"
+  "Gondi\0"
+  "Gone Dau\0"
+  "Yeretuar\0"
+  "Gorap\0"
+  "Gorontalo\0"
+  "Gronings\0"
+  "Gothic\0"
+  "Gavar\0"
+  "Goo\0"
+  "Gorowa\0"
+  "Gobu\0"
+  "Goundo\0"
+  "Gozarkhani\0"
+  "Gupa-Abawa\0"
+  "Pidgin English, Ghanaian\0"
+  "Taiap\0"
+  "Ga'anda\0"
+  "Guiqiong\0"
+  "Guana (Brazil)\0"
+  "Gor\0"
+  "Qau\0"
+  "Garasia, Rajput\0"
+  "Grebo\0"
+  "Greek, Ancient (to 1453)\0"
+  "Guruntum-Mbaaru\0"
+  "Madi\0"
+  "Gbiri-Niragu\0"
+  "Ghari\0"
+  "Grebo, Southern\0"
+  "Kota Marudu Talantang\0"
+  "Groma\0"
+  "Gorovu\0"
+  "Taznatit\0"
+  "Gresi\0"
+  "Garo\0"
+  "Kistane\0"
+  "Grebo, Central\0"
+  "Gweda\0"
+  "Guriaso\0"
+  "Grebo, Barclayville\0"
+  "Guramalum\0"
+  "Ghanaian Sign Language\0"
+  "German Sign Language\0"
+  "Gusilay\0"
+  "Guatemalan Sign Language\0"
+  "Nema\0"
+  "Gbaya, Southwest\0"
+  "Wasembo\0"
+  "Greek Sign Language\0"
+  "German, Swiss\0"
+  "Guató\0"
+  "Aghu-Tharnggala\0"
+  "Gujarati\0"
+  "Shiki\0"
+  "Guajajára\0"
+  "Wayuu\0"
+  "Dida, Yocoboué\0"
+  "Gurindji\0"
+  "Gupapuyngu\0"
+  "Guaraní, Paraguayan\0"
+  "Guahibo\0"
+  "Guaraní, Eastern Bolivian\0"
+  "Gumuz\0"
+  "Creole English, Sea Island\0"
+  "Guambiano\0"
+  "Guaraní, Mbyá\0"
+  "Guayabero\0"
+  "Gunwinggu\0"
+  "Aché\0"
+  "Farefare\0"
+  "Guinean Sign Language\0"
+  "Maléku Jaíka\0"
+  "Yanomamö\0"
+  "Gun\0"
+  "Gourmanchéma\0"
+  "Gusii\0"
+  "Guana (Paraguay)\0"
+  "Guanano\0"
+  "Duwet\0"
+  "Golin\0"
+  "Guajá\0"
+  "Gulay\0"
+  "Gurmana\0"
+  "Kuku-Yalanji\0"
+  "Gavião Do Jiparaná\0"
+  "Gavião, Pará\0"
+  "Gurung\0"
+  "Gumawana\0"
+  "Guyani\0"
+  "Mbato\0"
+  "Gwa\0"
+  "Gawri\0"
+  "Gawwada\0"
+  "Gweno\0"
+  "Gowro\0"
+  "Moo\0"
+  "Gwichʼin\0"
+  "ǀGwi\0"
+  "Awngthim\0"
+  "Gwandara\0"
+  "Gwere\0"
+  "Gawar-Bati\0"
+  "Guwamu\0"
+  "Kwini\0"
+  "Gua\0"
+  "Wè Southern\0"
+  "Gbaya, Northwest\0"
+  "Garus\0"
+  "Kayardild\0"
+  "Gyem\0"
+  "Gungabula\0"
+  "Gbayi\0"
+  "Gyele\0"
+  "Gayil\0"
+  "Ngäbere\0"
+  "Creole English, Guyanese\0"
+  "Gyalsumdo\0"
+  "Guarayu\0"
+  "Gunya\0"
+  "Geji\0"
+  "Ganza\0"
+  "Gazi\0"
+  "Gane\0"
+  "Hausa\0"
+  "Han\0"
+  "Hanoi Sign Language\0"
+  "Gurani\0"
+  "Hatam\0"
+  "Oromo, Eastern\0"
+  "Haiphong Sign Language\0"
+  "Hanga\0"
+  "Hahon\0"
+  "Haida\0"
+  "Hajong\0"
+  "Chinese, Hakka\0"
+  "Halang\0"
+  "Hewa\0"
+  "Hangaza\0"
+  "Hakö\0"
+  "Hupla\0"
+  "Ha\0"
+  "Harari\0"
+  "Haisla\0"
+  "Haitian\0"
+  "Havu\0"
+  "Hawaiian\0"
+  "Haida, Southern\0"
+  "Haya\0"
+  "Hazaragi\0"
+  "Hamba\0"
+  "Huba\0"
+  "Heiban\0"
+  "Hebrew, Ancient\0"
+  "Serbo-Croatian\0"
+  "Habu\0"
+  "Creole Hindi, Andaman\0"
+  "Huichol\0"
+  "Haida, Northern\0"
+  "Honduras Sign Language\0"
+  "Hadiyya\0"
+  "Hebrew\0"
+  "Miao, Northern Qiandong\0"
+  "Herdé\0"
+  "Helong\0"
+  "Hehe\0"
+  "Heiltsuk\0"
+  "Hemba\0"
+  "Herero\0"
+  "Haiǁom\0"
+  "Haigwai\0"
+  "Hoia Hoia\0"
+  "Kerak\0"
+  "Hoyahoya\0"
+  "Hindi\0"
+  "Lamang\0"
+  "Hibito\0"
+  "Hidatsa\0"
+  "Hindi, Fiji\0"
+  "Kamwe\0"
+  "Pamosu\0"
+  "Hinduri\0"
+  "Hijuk\0"
+  "Seit-Kaitetu\0"
+  "Hiligaynon\0"
+  "Himachali languages; Western Pahari languages\0"
+  "Tsoa\0"
+  "Himarimã\0"
+  "Hittite\0"
+  "Hiw\0"
+  "Hixkaryána\0"
+  "Haji\0"
+  "Kahe\0"
+  "Hunde\0"
+  "Khah\0"
+  "Hunjara-Kaina Ke\0"
+  "Mel-Khaonh\0"
+  "Hong Kong Sign Language\0"
+  "Halia\0"
+  "Halbi\0"
+  "Halang Doan\0"
+  "Hlersu\0"
+  "Chin, Matu\0"
+  "Luwian, Hieroglyphic\0"
+  "Hmong, Southern Mashan\0"
+  "Songhay, Humburi Senni\0"
+  "Hmong, Central Huishui\0"
+  "Miao, Large Flowery\0"
+  "Hmong, Eastern Huishui\0"
+  "Hmong Don\0"
+  "Hmong, Southwestern Guiyang\0"
+  "Hmong, Southwestern Huishui\0"
+  "Hmong, Northern Huishui\0"
+  "Ge\0"
+  "Maek\0"
+  "Hmong, Luopohe\0"
+  "Hmong, Central Mashan\0"
+  "Hmong\0"
+  "Hiri Motu\0"
+  "Hmong, Northern Mashan\0"
+  "Miao, Eastern Qiandong\0"
+  "Hmar\0"
+  "Miao, Southern Qiandong\0"
+  "Hamtai\0"
+  "Hamap\0"
+  "Hmong Dô\0"
+  "Hmong, Western Mashan\0"
+  "Hmong, Southern Guiyang\0"
+  "Hmong Shua\0"
+  "Mina (Cameroon)\0"
+  "Hindko, Southern\0"
+  "Chhattisgarhi\0"
+  "Hungu\0"
+  "ǁAni\0"
+  "Hani\0"
+  "Hmong Njua\0"
+  "Hanunoo\0"
+  "Hindko, Northern\0"
+  "Hindustani, Caribbean\0"
+  "Hung\0"
+  "Hoava\0"
+  "Mari (Madang Province)\0"
+  "Ho\0"
+  "Holma\0"
+  "Horom\0"
+  "Hobyót\0"
+  "Holikachuk\0"
+  "Hadothi\0"
+  "Holu\0"
+  "Homa\0"
+  "Holoholo\0"
+  "Hopi\0"
+  "Horo\0"
+  "Ho Chi Minh City Sign Language\0"
+  "Hote\0"
+  "Hovongan\0"
+  "Honi\0"
+  "Holiya\0"
+  "Hozo\0"
+  "Hpon\0"
+  "Hawai'i Sign Language (HSL)\0"
+  "Croatian\0"
+  "Hrangkhol\0"
+  "Niwer Mil\0"
+  "Hre\0"
+  "Haruku\0"
+  "Miao, Horned\0"
+  "Haroi\0"
+  "Nhirrpi\0"
+  "Hértevin\0"
+  "Hruso\0"
+  "Warwar Feni\0"
+  "Hunsrik\0"
+  "Harzani\0"
+  "Sorbian, Upper\0"
+  "Hungarian Sign Language\0"
+  "Hausa Sign Language\0"
+  "Chinese, Xiang\0"
+  "Harsusi\0"
+  "Haitian; Haitian Creole\0"
+  "Hoti\0"
+  "Huitoto, Minica\0"
+  "Hadza\0"
+  "Hitu\0"
+  "Hittite, Middle\0"
+  "Hungarian\0"
+  "Huambisa\0"
+  "ǂHua\0"
+  "Huaulu\0"
+  "Huave, San Francisco Del Mar\0"
+  "Humene\0"
+  "Huachipaeri\0"
+  "Huilliche\0"
+  "Huli\0"
+  "Hmong, Northern Guiyang\0"
+  "Hulung\0"
+  "Hula\0"
+  "Hungana\0"
+  "Hu\0"
+  "Hupa\0"
+  "Tsat\0"
+  "Halkomelem\0"
+  "Huastec\0"
+  "Humla\0"
+  "Huitoto, Murui\0"
+  "Huave, San Mateo Del Mar\0"
+  "Hukumina\0"
+  "Huitoto, Nüpode\0"
+  "Hulaulá\0"
+  "Hunzib\0"
+  "Haitian Vodoun Culture Language\0"
+  "Huave, San Dionisio Del Mar\0"
+  "Haveke\0"
+  "Sabu\0"
+  "Huave, Santa María Del Mar\0"
+  "Wané\0"
+  "Creole English, Hawai'i\0"
+  "Hwana\0"
+  "Hya\0"
+  "Armenian, Western\0"
+  "Interlingua (International Auxiliary Language Association)\0"
+  "Iaai\0"
+  "Iatmul\0"
+  "Purari\0"
+  "Iban\0"
+  "Ibibio\0"
+  "Iwaidja\0"
+  "Akpes\0"
+  "Ibanag\0"
+  "Bih\0"
+  "Ibaloi\0"
+  "Agoi\0"
+  "Ibino\0"
+  "Igbo\0"
+  "Ibuoro\0"
+  "Ibu\0"
+  "Ibani\0"
+  "Ede Ica\0"
+  "Icelandic\0"
+  "Etkywan\0"
+  "Icelandic Sign Language\0"
+  "Creole English, Islander\0"
+  "Indonesian\0"
+  "Idakho-Isukha-Tiriki\0"
+  "Indo-Portuguese\0"
+  "Idon\0"
+  "Ede Idaca\0"
+  "Idere\0"
+  "Idi\0"
+  "Ido\0"
+  "Indri\0"
+  "Idesa\0"
+  "Idaté\0"
+  "Idoma\0"
+  "Interlingue; Occidental\0"
+  "Ifugao, Amganad\0"
+  "Ifugao, Batad\0"
+  "Ifè\0"
+  "Ifo\0"
+  "Ifugao, Tuwali\0"
+  "Teke-Fuumu\0"
+  "Ifugao, Mayoyao\0"
+  "Kallahan, Keley-I\0"
+  "Ebira\0"
+  "Igede\0"
+  "Igana\0"
+  "Igala\0"
+  "Kanggape\0"
+  "Ignaciano\0"
+  "Isebe\0"
+  "Interglossa\0"
+  "Igwe\0"
+  "Iha Based Pidgin\0"
+  "Ihievbe\0"
+  "Iha\0"
+  "Bidhawal\0"
+  "Sichuan Yi; Nuosu\0"
+  "Yi, Sichuan\0"
+  "Thiin\0"
+  "Izon\0"
+  "Biseni\0"
+  "Ede Ije\0"
+  "Kalabari\0"
+  "Ijo languages\0"
+  "Ijo, Southeast\0"
+  "Inupiaq\0"
+  "Inuktitut, Eastern Canadian\0"
+  "Iko\0"
+  "Ika\0"
+  "Ikulu\0"
+  "Olulumo-Ikom\0"
+  "Ikpeshi\0"
+  "Ikaranggal\0"
+  "Inuit Sign Language\0"
+  "Inuinnaqtun\0"
+  "Inuktitut\0"
+  "Iku-Gora-Ankwa\0"
+  "Ikwere\0"
+  "Ik\0"
+  "Ikizu\0"
+  "Ile Ape\0"
+  "Ila\0"
+  "Interlingue\0"
+  "Garig-Ilgar\0"
+  "Ili Turki\0"
+  "Ilongot\0"
+  "Iranun (Malaysia)\0"
+  "Iloko\0"
+  "Iranun (Philippines)\0"
+  "International Sign\0"
+  "Ili'uun\0"
+  "Ilue\0"
+  "Malasar, Mala\0"
+  "Anamgura\0"
+  "Miluk\0"
+  "Imonda\0"
+  "Imbongu\0"
+  "Imroing\0"
+  "Marsian\0"
+  "Imotong\0"
+  "Milyan\0"
+  "Inga\0"
+  "Indic languages\0"
+  "Indo-European languages\0"
+  "Degexit'an\0"
+  "Ingush\0"
+  "Inga, Jungle\0"
+  "Indonesian Sign Language\0"
+  "Minaean\0"
+  "Isinai\0"
+  "Inoke-Yate\0"
+  "Iñapari\0"
+  "Indian Sign Language\0"
+  "Intha\0"
+  "Ineseño\0"
+  "Inor\0"
+  "Tuma-Irumu\0"
+  "Iowa-Oto\0"
+  "Ipili\0"
+  "Ipiko\0"
+  "Iquito\0"
+  "Ikwo\0"
+  "Iranian languages\0"
+  "Iresim\0"
+  "Irarutu\0"
+  "Rigwe\0"
+  "Iraqw\0"
+  "Irántxe\0"
+  "Iroquoian languages\0"
+  "Ir\0"
+  "Irula\0"
+  "Kamberau\0"
+  "Iraya\0"
+  "Isabi\0"
+  "Isconahua\0"
+  "Isnag\0"
+  "Italian Sign Language\0"
+  "Irish Sign Language\0"
+  "Esan\0"
+  "Nkem-Nkum\0"
+  "Ishkashimi\0"
+  "Masimasi\0"
+  "Isanzu\0"
+  "Isoko\0"
+  "Israeli Sign Language\0"
+  "Istriot\0"
+  "Isu (Menchum Division)\0"
+  "Italian\0"
+  "Itneg, Binongan\0"
+  "Tidung, Southern\0"
+  "Itene\0"
+  "Itneg, Inlaod\0"
+  "Judeo-Italian\0"
+  "Itelmen\0"
+  "Itu Mbon Uzo\0"
+  "Itonama\0"
+  "Iteri\0"
+  "Isekiri\0"
+  "Itneg, Maeng\0"
+  "Itawit\0"
+  "Ito\0"
+  "Itik\0"
+  "Itneg, Moyadan\0"
+  "Itzá\0"
+  "Mien, Iu\0"
+  "Ibatan\0"
+  "Ivatan\0"
+  "I-Wak\0"
+  "Iwam\0"
+  "Iwur\0"
+  "Iwam, Sepik\0"
+  "Ixcatec\0"
+  "Ixil\0"
+  "Iyayu\0"
+  "Mesaka\0"
+  "Yaka (Congo)\0"
+  "Ingrian\0"
+  "Izere\0"
+  "Izii\0"
+  "Japanese\0"
+  "Jamamadí\0"
+  "Hyam\0"
+  "Popti'\0"
+  "Jahanka\0"
+  "Yabem\0"
+  "Jara\0"
+  "Jah Hut\0"
+  "Zazao\0"
+  "Jakun\0"
+  "Yalahatan\0"
+  "Creole English, Jamaican\0"
+  "Jandai\0"
+  "Yanyuwa\0"
+  "Yaqay\0"
+  "Javanese, New Caledonian\0"
+  "Jakati\0"
+  "Yaur\0"
+  "Javanese\0"
+  "Malay, Jambi\0"
+  "Yan-nhangu\0"
+  "Jawe\0"
+  "Judeo-Berber\0"
+  "Badjiri\0"
+  "Arandai\0"
+  "Barikewa\0"
+  "Bijim\0"
+  "Nafusi\0"
+  "Lojban\0"
+  "Jofotek-Bromnya\0"
+  "Jabutí\0"
+  "Jukun Takum\0"
+  "Yawijibaya\0"
+  "Jamaican Country Sign Language\0"
+  "Krymchak\0"
+  "Jad\0"
+  "Jadgali\0"
+  "Judeo-Tat\0"
+  "Jebero\0"
+  "Jerung\0"
+  "Jeh\0"
+  "Yei\0"
+  "Jeri Kuo\0"
+  "Yelmek\0"
+  "Dza\0"
+  "Jere\0"
+  "Manem\0"
+  "Jonkor Bourmataguil\0"
+  "Ngbee\0"
+  "Judeo-Georgian\0"
+  "Gwak\0"
+  "Ngomba\0"
+  "Jehai\0"
+  "Jhankot Sign Language\0"
+  "Jina\0"
+  "Jibu\0"
+  "Tol\0"
+  "Bu (Kaduna State)\0"
+  "Jilbe\0"
+  "Jingulu\0"
+  "sTodsde\0"
+  "Jiiddu\0"
+  "Jilim\0"
+  "Jimi (Cameroon)\0"
+  "Jiamao\0"
+  "Guanyinqiao\0"
+  "Jita\0"
+  "Jinuo, Youle\0"
+  "Shuar\0"
+  "Jinuo, Buyuan\0"
+  "Jejueo\0"
+  "Bankal\0"
+  "Kaera\0"
+  "Karen, Mobwa\0"
+  "Kubo\0"
+  "Karen, Paku\0"
+  "Koro (India)\0"
+  "Amami Koniya Sign Language\0"
+  "Labir\0"
+  "Ngile\0"
+  "Jamaican Sign Language\0"
+  "Dima\0"
+  "Zumbun\0"
+  "Machame\0"
+  "Yamdena\0"
+  "Jimi (Nigeria)\0"
+  "Jumli\0"
+  "Naga, Makuri\0"
+  "Kamara\0"
+  "Mashi (Nigeria)\0"
+  "Mouwase\0"
+  "Mixtec, Western Juxtlahuaca\0"
+  "Jangshung\0"
+  "Jandavra\0"
+  "Yangman\0"
+  "Janji\0"
+  "Yemsa\0"
+  "Rawat\0"
+  "Jaunsari\0"
+  "Joba\0"
+  "Wojenaka\0"
+  "Jogi\0"
+  "Jorá\0"
+  "Jordanian Sign Language\0"
+  "Jowulu\0"
+  "Aramaic, Jewish Palestinian\0"
+  "Judeo-Persian\0"
+  "Jaqaru\0"
+  "Jarai\0"
+  "Judeo-Arabic\0"
+  "Jiru\0"
+  "Jakattoe\0"
+  "Japrería\0"
+  "Japanese Sign Language\0"
+  "Júma\0"
+  "Wannu\0"
+  "Jurchen\0"
+  "Worodougou\0"
+  "Hõne\0"
+  "Ngadjuri\0"
+  "Wapan\0"
+  "Jirel\0"
+  "Jumjum\0"
+  "Juang\0"
+  "Jiba\0"
+  "Hupdë\0"
+  "Jurúna\0"
+  "Jumla Sign Language\0"
+  "Jutish\0"
+  "Ju\0"
+  "Wãpha\0"
+  "Juray\0"
+  "Javindo\0"
+  "Javanese, Caribbean\0"
+  "Jwira-Pepesa\0"
+  "Jiarong\0"
+  "Arabic, Judeo-Yemeni\0"
+  "Jaya\0"
+  "Kara-Kalpak\0"
+  "Kabyle\0"
+  "Kachin\0"
+  "Adara\0"
+  "Ketangalan\0"
+  "Katso\0"
+  "Kajaman\0"
+  "Kara (Central African Republic)\0"
+  "Karekare\0"
+  "Jju\0"
+  "Kalanguya\0"
+  "Kalaallisut\0"
+  "Kamba (Kenya)\0"
+  "Kannada\0"
+  "Xaasongaxango\0"
+  "Bezhta\0"
+  "Capanahua\0"
+  "Karen languages\0"
+  "Kashmiri\0"
+  "Kanuri\0"
+  "Katukína\0"
+  "Kawi\0"
+  "Kao\0"
+  "Kamayurá\0"
+  "Kazakh\0"
+  "Kalarko\0"
+  "Kaxuiâna\0"
+  "Kadiwéu\0"
+  "Kabardian\0"
+  "Kanju\0"
+  "Khamba\0"
+  "Camsá\0"
+  "Kaptiau\0"
+  "Kari\0"
+  "Koiari, Grass\0"
+  "Kanembu\0"
+  "Iwal\0"
+  "Kare (Central African Republic)\0"
+  "Keliko\0"
+  "Kabiyè\0"
+  "Kamano\0"
+  "Kafa\0"
+  "Kande\0"
+  "Abadi\0"
+  "Kabutra\0"
+  "Dera (Indonesia)\0"
+  "Kaiep\0"
+  "Ap Ma\0"
+  "Kanuri, Manga\0"
+  "Duhwa\0"
+  "Khanty\0"
+  "Kawacha\0"
+  "Lubila\0"
+  "Kanum, Ngkâlmpw\0"
+  "Kaivi\0"
+  "Ukaan\0"
+  "Tyap\0"
+  "Vono\0"
+  "Kamantan\0"
+  "Kobiana\0"
+  "Kalanga\0"
+  "Kela (Papua New Guinea)\0"
+  "Gula (Central African Republic)\0"
+  "Nubi\0"
+  "Kinalakna\0"
+  "Kanga\0"
+  "Kamo\0"
+  "Katla\0"
+  "Koenoem\0"
+  "Kaian\0"
+  "Kami (Tanzania)\0"
+  "Kete\0"
+  "Kabwari\0"
+  "Kachama-Ganjule\0"
+  "Korandje\0"
+  "Konongo\0"
+  "Worimi\0"
+  "Kutu\0"
+  "Yankunytjatjara\0"
+  "Makonde\0"
+  "Mamusi\0"
+  "Seba\0"
+  "Tem\0"
+  "Kumam\0"
+  "Karamojong\0"
+  "Numèè\0"
+  "Tsikimba\0"
+  "Kagoma\0"
+  "Kunda\0"
+  "Kaningdon-Nindem\0"
+  "Koch\0"
+  "Karaim\0"
+  "Kuy\0"
+  "Kadaru\0"
+  "Koneraw\0"
+  "Kam\0"
+  "Keder\0"
+  "Kwaja\0"
+  "Kabuverdianu\0"
+  "Kélé\0"
+  "Keiga\0"
+  "Kerewe\0"
+  "Keres, Eastern\0"
+  "Kpessi\0"
+  "Tese\0"
+  "Keak\0"
+  "Kei\0"
+  "Kadar\0"
+  "Kekchí\0"
+  "Kela (Democratic Republic of Congo)\0"
+  "Kemak\0"
+  "Kenyang\0"
+  "Kakwa\0"
+  "Kaikadi\0"
+  "Kamar\0"
+  "Kera\0"
+  "Kugbo\0"
+  "Ket\0"
+  "Akebu\0"
+  "Kanikkaran\0"
+  "Kewa, West\0"
+  "Kukna\0"
+  "Kupia\0"
+  "Kukele\0"
+  "Kodava\0"
+  "Kolami, Northwestern\0"
+  "Konda-Dora\0"
+  "Koraga, Korra\0"
+  "Kota (India)\0"
+  "Koya\0"
+  "Kudiya\0"
+  "Kurichiya\0"
+  "Kurumba, Kannada\0"
+  "Kemiehua\0"
+  "Kinnauri\0"
+  "Kung\0"
+  "Khunsari\0"
+  "Kuk\0"
+  "Koro (Côte d'Ivoire)\0"
+  "Korwa\0"
+  "Korku\0"
+  "Kachhi\0"
+  "Bilaspuri\0"
+  "Kanjari\0"
+  "Katkari\0"
+  "Kurmukar\0"
+  "Naga, Kharam\0"
+  "Pahari, Kullu\0"
+  "Kumaoni\0"
+  "Koromfé\0"
+  "Kongo\0"
+  "Koyaga\0"
+  "Kawe\0"
+  "Komering\0"
+  "Kube\0"
+  "Kusunda\0"
+  "Selangor Sign Language\0"
+  "Kham, Gamale\0"
+  "Kaiwá\0"
+  "Kunggari\0"
+  "Karipúna\0"
+  "Karingani\0"
+  "Krongo\0"
+  "Kaingang\0"
+  "Kamoro\0"
+  "Abun\0"
+  "Kumbainggar\0"
+  "Somyev\0"
+  "Kobol\0"
+  "Karas\0"
+  "Karon Dori\0"
+  "Kamaru\0"
+  "Kyerung\0"
+  "Khasi\0"
+  "Lü\0"
+  "Tukang Besi North\0"
+  "Kanum, Bädi\0"
+  "Korowai\0"
+  "Khuen\0"
+  "Tibetan, Khams\0"
+  "Kehu\0"
+  "Khoisan languages\0"
+  "Kuturmi\0"
+  "Mongolian, Halh\0"
+  "Lusi\0"
+  "Khmer\0"
+  "Khandesi\0"
+  "Khotanese\0"
+  "Kapori\0"
+  "Songhay, Koyra Chiini\0"
+  "Kharia\0"
+  "Kasua\0"
+  "Khamti\0"
+  "Nkhumbi\0"
+  "Khvarshi\0"
+  "Khowar\0"
+  "Kanu\0"
+  "Kele (Democratic Republic of Congo)\0"
+  "Keapara\0"
+  "Kikuyu; Gikuyu\0"
+  "Kim\0"
+  "Koalib\0"
+  "Kickapoo\0"
+  "Koshin\0"
+  "Kibet\0"
+  "Kham, Eastern Parbate\0"
+  "Kimaama\0"
+  "Kilmeri\0"
+  "Kitsai\0"
+  "Kilivila\0"
+  "Kikuyu\0"
+  "Kariya\0"
+  "Karagas\0"
+  "Kinyarwanda\0"
+  "Kiowa\0"
+  "Kham, Sheshi\0"
+  "Kosadle\0"
+  "Kirghiz\0"
+  "Kis\0"
+  "Agob\0"
+  "Kirmanjki (individual language)\0"
+  "Kimbu\0"
+  "Kiwai, Northeast\0"
+  "Naga, Khiamniungan\0"
+  "Kirikiri\0"
+  "Kisi\0"
+  "Kuanyama; Kwanyama\0"
+  "Mlap\0"
+  "Q'anjob'al\0"
+  "Konjo, Coastal\0"
+  "Kiwai, Southern\0"
+  "Kisar\0"
+  "Khmu\0"
+  "Khakas\0"
+  "Zabana\0"
+  "Khinalugh\0"
+  "Konjo, Highland\0"
+  "Kham, Western Parbate\0"
+  "Kháng\0"
+  "Kunjen\0"
+  "Kinnauri, Harijan\0"
+  "Karen, Pwo Eastern\0"
+  "Keres, Western\0"
+  "Kurudu\0"
+  "Kewa, East\0"
+  "Karen, Phrae Pwo\0"
+  "Kashaya\0"
+  "Kaikavian Literary Language\0"
+  "Ramopa\0"
+  "Erave\0"
+  "Bumthangkha\0"
+  "Kakanda\0"
+  "Kwerisa\0"
+  "Odoodee\0"
+  "Kinuku\0"
+  "Kakabe\0"
+  "Monpa, Kalaktang\0"
+  "Kalinga, Mabaka Valley\0"
+  "Khün\0"
+  "Kagulu\0"
+  "Kako\0"
+  "Kokota\0"
+  "Yale, Kosarek\0"
+  "Kiong\0"
+  "Kon Keu\0"
+  "Karko\0"
+  "Gugubera\0"
+  "Kaeku\0"
+  "Kir-Balar\0"
+  "Giiwo\0"
+  "Koi\0"
+  "Tumi\0"
+  "Kangean\0"
+  "Teke-Kukuya\0"
+  "Kohin\0"
+  "Guugu Yimidhirr\0"
+  "Kaska\0"
+  "Kalaallisut; Greenlandic\0"
+  "Klamath-Modoc\0"
+  "Kiliwa\0"
+  "Kolbila\0"
+  "Gamilaraay\0"
+  "Kulung (Nepal)\0"
+  "Kendeje\0"
+  "Tagakaulo\0"
+  "Weliki\0"
+  "Kalumpang\0"
+  "Khalaj\0"
+  "Kono (Nigeria)\0"
+  "Kalagan, Kagan\0";
+
+static const char language_names_1[] =
+  "Migum\0"
+  "Kalenjin\0"
+  "Kapya\0"
+  "Kamasa\0"
+  "Rumu\0"
+  "Khaling\0"
+  "Kalasha\0"
+  "Nukna\0"
+  "Klao\0"
+  "Maskelynes\0"
+  "Tado\0"
+  "Koluwawa\0"
+  "Kalao\0"
+  "Kabola\0"
+  "Central Khmer\0"
+  "Konni\0"
+  "Kimbundu\0"
+  "Dong, Southern\0"
+  "Kalinga, Majukayang\0"
+  "Bakole\0"
+  "Kare (Papua New Guinea)\0"
+  "Kâte\0"
+  "Kalam\0"
+  "Kami (Nigeria)\0"
+  "Kumarbhag Paharia\0"
+  "Kalinga, Limos\0"
+  "Kalinga, Tanudan\0"
+  "Kom (India)\0"
+  "Awtuw\0"
+  "Kwoma\0"
+  "Gimme\0"
+  "Kwama\0"
+  "Kurdish, Northern\0"
+  "Kamasau\0"
+  "Kemtuik\0"
+  "Kanite\0"
+  "Creole French, Karipúna\0"
+  "Komo (Democratic Republic of Congo)\0"
+  "Waboda\0"
+  "Koma\0"
+  "Khorasani Turkish\0"
+  "Dera (Nigeria)\0"
+  "Kalinga, Lubuagan\0"
+  "Kanuri, Central\0"
+  "Konda\0"
+  "Kankanaey\0"
+  "Mankanya\0"
+  "Koongo\0"
+  "Kanufi\0"
+  "Kanjobal, Western\0"
+  "Kuranko\0"
+  "Keninjal\0"
+  "Kanamarí\0"
+  "Konkani (individual language)\0"
+  "Kono (Sierra Leone)\0"
+  "Kwanja\0"
+  "Kintaq\0"
+  "Kaningra\0"
+  "Kensiu\0"
+  "Katukína, Panoan\0"
+  "Kono (Guinea)\0"
+  "Tabo\0"
+  "Kung-Ekoka\0"
+  "Kendayan\0"
+  "Kanyok\0"
+  "Kalamsé\0"
+  "Korean\0"
+  "Konomala\0"
+  "Kpati\0"
+  "Kodi\0"
+  "Suri, Kacipo-Bale\0"
+  "Kubi\0"
+  "Cogui\0"
+  "Koyo\0"
+  "Komi-Permyak\0"
+  "Konkani (macrolanguage)\0"
+  "Kol (Papua New Guinea)\0"
+  "Komi\0"
+  "Konzo\0"
+  "Waube\0"
+  "Kota (Gabon)\0"
+  "Kosraean\0"
+  "Lagwan\0"
+  "Koke\0"
+  "Kudu-Camo\0"
+  "Kugama\0"
+  "Koyukon\0"
+  "Korak\0"
+  "Kutto\0"
+  "Kurumba, Mullu\0"
+  "Curripaco\0"
+  "Koba\0"
+  "Kpelle\0"
+  "Komba\0"
+  "Kapingamarangi\0"
+  "Kplang\0"
+  "Kofei\0"
+  "Karajá\0"
+  "Kpan\0"
+  "Kpala\0"
+  "Koho\0"
+  "Kepkiriwát\0"
+  "Ikposo\0"
+  "Korupun-Sela\0"
+  "Korafe-Yegha\0"
+  "Tehit\0"
+  "Karata\0"
+  "Kafoa\0"
+  "Komi-Zyrian\0"
+  "Kobon\0"
+  "Koiali, Mountain\0"
+  "Koryak\0"
+  "Kupsabiny\0"
+  "Mum\0"
+  "Kovai\0"
+  "Doromu-Koki\0"
+  "Koy Sanjaq Surat\0"
+  "Kalagan\0"
+  "Kakabai\0"
+  "Khe\0"
+  "Kisankasa\0"
+  "Koitabu\0"
+  "Koromira\0"
+  "Gbe, Kotafon\0"
+  "Kyenele\0"
+  "Khisa\0"
+  "Kaonde\0"
+  "Krahn, Eastern\0"
+  "Kimré\0"
+  "Krenak\0"
+  "Kimaragang\0"
+  "Kissi, Northern\0"
+  "Kadazan, Klias River\0"
+  "Seroa\0"
+  "Okolod\0"
+  "Kandas\0"
+  "Mser\0"
+  "Koorete\0"
+  "Korana\0"
+  "Kumhali\0"
+  "Karkin\0"
+  "Karachay-Balkar\0"
+  "Kairui-Midiki\0"
+  "Panará\0"
+  "Koro (Vanuatu)\0"
+  "Kurama\0"
+  "Krio\0"
+  "Kinaray-A\0"
+  "Kerek\0"
+  "Karelian\0"
+  "Sapo\0"
+  "Kru languages\0"
+  "Korop\0"
+  "Krung\0"
+  "Gbaya (Sudan)\0"
+  "Kanuri, Tumari\0"
+  "Kurukh\0"
+  "Kavet\0"
+  "Krahn, Western\0"
+  "Karon\0"
+  "Kryts\0"
+  "Kanum, Sota\0"
+  "Shuwa-Zamani\0"
+  "Shambala\0"
+  "Kalinga, Southern\0"
+  "Kuanua\0"
+  "Kuni\0"
+  "Bafia\0"
+  "Kusaghe\0"
+  "Kölsch\0"
+  "Krisa\0"
+  "Uare\0"
+  "Kansa\0"
+  "Kumalu\0"
+  "Kumba\0"
+  "Kasiguranin\0"
+  "Kofa\0"
+  "Kaba\0"
+  "Kwaami\0"
+  "Borong\0"
+  "Kisi, Southern\0"
+  "Winyé\0"
+  "Khamyang\0"
+  "Kusu\0"
+  "Karen, S'gaw\0"
+  "Kedang\0"
+  "Kharia Thar\0"
+  "Kodaku\0"
+  "Katua\0"
+  "Kambaata\0"
+  "Kholok\0"
+  "Kokata\0"
+  "Nubri\0"
+  "Kwami\0"
+  "Kalkutung\0"
+  "Karanga\0"
+  "Muyu, North\0"
+  "Krumen, Plapo\0"
+  "Kaniet\0"
+  "Koroshi\0"
+  "Kurti\0"
+  "Karitiâna\0"
+  "Kuot\0"
+  "Kaduo\0"
+  "Katabaga\0"
+  "Muyu, South\0"
+  "Ketum\0"
+  "Kituba (Democratic Republic of Congo)\0"
+  "Katu, Eastern\0"
+  "Kato\0"
+  "Kaxararí\0"
+  "Kango (Bas-Uélé District)\0"
+  "Juǀʼhoan\0"
+  "Kurdish\0"
+  "Kuanyama\0"
+  "Kutep\0"
+  "Kwinsu\0"
+  "'Auhelawa\0"
+  "Kuman (Papua New Guinea)\0"
+  "Katu, Western\0"
+  "Kupa\0"
+  "Kushi\0"
+  "Kuikúro-Kalapálo\0"
+  "Kuria\0"
+  "Kepo'\0"
+  "Kulere\0"
+  "Kumyk\0"
+  "Kunama\0"
+  "Kumukio\0"
+  "Kunimaipa\0"
+  "Karipuna\0"
+  "Kusaal\0"
+  "Kutenai\0"
+  "Kuskokwim, Upper\0"
+  "Kur\0"
+  "Kpagua\0"
+  "Kukatja\0"
+  "Kuuku-Ya'u\0"
+  "Kunza\0"
+  "Bagvalal\0"
+  "Kubu\0"
+  "Kove\0"
+  "Kui (Indonesia)\0"
+  "Kalabakan\0"
+  "Kabalai\0"
+  "Kuni-Boazi\0"
+  "Komodo\0"
+  "Kwang\0"
+  "Psikye\0"
+  "Korean Sign Language\0"
+  "Kayaw\0"
+  "Kendem\0"
+  "Kuna, Border\0"
+  "Dobel\0"
+  "Kompane\0"
+  "Karen, Geba\0"
+  "Kerinci\0"
+  "Karen, Lahta\0"
+  "Karen, Yinbaw\0"
+  "Kola\0"
+  "Wersing\0"
+  "Koli, Parkari\0"
+  "Karen, Yintale\0"
+  "Tsakwambo\0"
+  "Dâw\0"
+  "Kwa\0"
+  "Likwala\0"
+  "Kwaio\0"
+  "Kwerba\0"
+  "Kwara'ae\0"
+  "Sara Kaba Deme\0"
+  "Kowiai\0"
+  "Awa-Cuaiquer\0"
+  "Kwanga\0"
+  "Kwakiutl\0"
+  "Kofyar\0"
+  "Kwambi\0"
+  "Kwangali\0"
+  "Kwomtari\0"
+  "Kodia\0"
+  "Kwer\0"
+  "Kwese\0"
+  "Kwesten\0"
+  "Kwakum\0"
+  "Sara Kaba Náà\0"
+  "Kwinti\0"
+  "Khirwar\0"
+  "Kongo, San Salvador\0"
+  "Kwadi\0"
+  "Kairiru\0"
+  "Krobu\0"
+  "Konso\0"
+  "Brunei\0"
+  "Karen, Manumanaw\0"
+  "Karo (Ethiopia)\0"
+  "Murut, Keningau\0"
+  "Kulfa\0"
+  "Karen, Zayein\0"
+  "Khmer, Northern\0"
+  "Melanau, Kanowit-Tanjong\0"
+  "Kanoé\0"
+  "Koli, Wadiyara\0"
+  "Kanum, Smärky\0"
+  "Koro (Papua New Guinea)\0"
+  "Kangjia\0"
+  "Koiwat\0"
+  "Kuvi\0"
+  "Konai\0"
+  "Likuba\0"
+  "Kayong\0"
+  "Kerewo\0"
+  "Kirghiz; Kyrgyz\0"
+  "Kwaya\0"
+  "Kalinga, Butbut\0"
+  "Kyaka\0"
+  "Karey\0"
+  "Krache\0"
+  "Kouya\0"
+  "Keyagana\0"
+  "Karok\0"
+  "Kiput\0"
+  "Karao\0"
+  "Kamayo\0"
+  "Kalapuya\0"
+  "Kpatili\0"
+  "Binukidnon, Northern\0"
+  "Kelon\0"
+  "Kang\0"
+  "Kenga\0"
+  "Kuruáya\0"
+  "Kayan, Baram\0"
+  "Kayagar\0"
+  "Kayah, Western\0"
+  "Kayort\0"
+  "Kudmali\0"
+  "Rapoisi\0"
+  "Kambaira\0"
+  "Kayabí\0"
+  "Karaboro, Western\0"
+  "Kaibobo\0"
+  "Kulango, Bondoukou\0"
+  "Kadai\0"
+  "Kosena\0"
+  "Kaili, Da'a\0"
+  "Kikai\0"
+  "Kelabit\0"
+  "Kazukuru\0"
+  "Kayeli\0"
+  "Kais\0"
+  "Kokola\0"
+  "Kaningi\0"
+  "Kaidipang\0"
+  "Kaike\0"
+  "Karang\0"
+  "Dusun, Sugut\0"
+  "Kayupulau\0"
+  "Komyandaret\0"
+  "Karirí-Xocó\0"
+  "Kamarian\0"
+  "Kango (Tshopo District)\0"
+  "Kalabra\0"
+  "Latin\0"
+  "Subanen, Southern\0"
+  "Linear A\0"
+  "Lacandon\0"
+  "Ladino\0"
+  "Pattani\0"
+  "Lafofa\0"
+  "Langi\0"
+  "Lahnda\0"
+  "Lambya\0"
+  "Lango (Uganda)\0"
+  "Lalia\0"
+  "Lamba\0"
+  "Laru\0"
+  "Lao\0"
+  "Laka (Chad)\0"
+  "Qabiao\0"
+  "Larteh\0"
+  "Lama (Togo)\0"
+  "Laba\0"
+  "Latvian\0"
+  "Lauje\0"
+  "Tiwa\0"
+  "Bai, Lama\0"
+  "Aribwatsa\0"
+  "Luxembourgish; Letzeburgesch\0"
+  "Label\0"
+  "Lakkia\0"
+  "Lak\0"
+  "Tinani\0"
+  "Laopang\0"
+  "La'bi\0"
+  "Ladakhi\0"
+  "Bontok, Central\0"
+  "Bikol, Libon\0"
+  "Lodhi\0"
+  "Rmeet\0"
+  "Laven\0"
+  "Wampar\0"
+  "Lohorung\0"
+  "Libyan Sign Language\0"
+  "Lachi\0"
+  "Labu\0"
+  "Lavatbura-Lamusong\0"
+  "Tolaki\0"
+  "Lawangan\0"
+  "Lamalama\0"
+  "Lardil\0"
+  "Legenyem\0"
+  "Lola\0"
+  "Loncong\0"
+  "Lubu\0"
+  "Luchazi\0"
+  "Lisela\0"
+  "Tungag\0"
+  "Lawa, Western\0"
+  "Luhu\0"
+  "Lisabata-Nuniali\0"
+  "Kla-Dan\0"
+  "Dũya\0"
+  "Luri\0"
+  "Lenyima\0"
+  "Lamja-Dengsa-Tola\0"
+  "Laari\0"
+  "Lemoro\0"
+  "Leelau\0"
+  "Kaan\0"
+  "Landoma\0"
+  "Láadan\0"
+  "Loo\0"
+  "Tso\0"
+  "Lufu\0"
+  "Lega-Shabunda\0"
+  "Lala-Bisa\0"
+  "Leco\0"
+  "Lendu\0"
+  "Lyélé\0"
+  "Lelemi\0"
+  "Lenje\0"
+  "Lemio\0"
+  "Lengola\0"
+  "Leipon\0"
+  "Lele (Democratic Republic of Congo)\0"
+  "Nomaande\0"
+  "Lenca\0"
+  "Leti (Cameroon)\0"
+  "Lepcha\0"
+  "Lembena\0"
+  "Lenkau\0"
+  "Lese\0"
+  "Lesing-Gelimi\0"
+  "Kara (Papua New Guinea)\0"
+  "Lamma\0"
+  "Kaili, Ledo\0"
+  "Luang\0"
+  "Lemolang\0"
+  "Lezghian\0"
+  "Lefa\0"
+  "Lingua Franca Nova\0"
+  "Ganda\0"
+  "Lungga\0"
+  "Laghu\0"
+  "Lugbara\0"
+  "Laghuu\0"
+  "Lengilu\0"
+  "Lingarak\0"
+  "Wala\0"
+  "Lega-Mwenga\0"
+  "T'apo\0"
+  "Lango (South Sudan)\0"
+  "Logba\0"
+  "Lengo\0"
+  "Pahi\0"
+  "Longgu\0"
+  "Ligenza\0"
+  "Laha (Viet Nam)\0"
+  "Laha (Indonesia)\0"
+  "Lahu Shi\0"
+  "Lohar, Lahul\0"
+  "Lhomi\0"
+  "Lahanan\0"
+  "Lhokpu\0"
+  "Mlahsö\0"
+  "Lo-Toga\0"
+  "Lahu\0"
+  "Limburgan; Limburger; Limburgish\0"
+  "Limba, West-Central\0"
+  "Likum\0"
+  "Hlai\0"
+  "Nyindrou\0"
+  "Likila\0"
+  "Limbu\0"
+  "Ligbi\0"
+  "Lihir\0"
+  "Ligurian\0"
+  "Lika\0"
+  "Lillooet\0"
+  "Limburgan\0"
+  "Lingala\0"
+  "Liki\0"
+  "Sekpele\0"
+  "Libido\0"
+  "English, Liberian\0"
+  "Lisu\0"
+  "Lithuanian\0"
+  "Logorik\0"
+  "Liv\0"
+  "Col\0"
+  "Liabuku\0"
+  "Banda-Bambari\0"
+  "Libinza\0"
+  "Golpa\0"
+  "Rampi\0"
+  "Laiyolo\0"
+  "Li'o\0"
+  "Lampung Api\0"
+  "Yirandali\0"
+  "Yuru\0"
+  "Lakalei\0"
+  "Kabras\0"
+  "Kucong\0"
+  "Lakondê\0"
+  "Kenyi\0"
+  "Lakha\0"
+  "Laki\0"
+  "Remun\0"
+  "Laeko-Libuat\0"
+  "Kalaamaya\0"
+  "Lakon\0"
+  "Khayo\0"
+  "Päri\0"
+  "Kisa\0"
+  "Lakota\0"
+  "Kungkari\0"
+  "Lokoya\0"
+  "Lala-Roba\0"
+  "Lolo\0"
+  "Lele (Guinea)\0"
+  "Ladin\0"
+  "Lele (Papua New Guinea)\0"
+  "Hermit\0"
+  "Lole\0"
+  "Lamu\0"
+  "Teke-Laali\0"
+  "Ladji Ladji\0"
+  "Lelak\0"
+  "Lilau\0"
+  "Lasalimu\0"
+  "Lele (Chad)\0"
+  "Efate, North\0"
+  "Lolak\0"
+  "Lithuanian Sign Language\0"
+  "Lau\0"
+  "Lauan\0"
+  "Limba, East\0"
+  "Merei\0"
+  "Limilngan\0"
+  "Lumun\0"
+  "Pévé\0"
+  "Lembata, South\0"
+  "Lamogai\0"
+  "Lambichhong\0"
+  "Lombi\0"
+  "Lembata, West\0"
+  "Lamkang\0"
+  "Hano\0"
+  "Lambadi\0"
+  "Lombard\0"
+  "Limbum\0"
+  "Lamatuka\0"
+  "Lamalera\0"
+  "Lamenu\0"
+  "Lomaiviti\0"
+  "Miwok, Lake\0"
+  "Laimbue\0"
+  "Lamboya\0"
+  "Langbashe\0"
+  "Mbalanhu\0"
+  "Lundayeh\0"
+  "Langobardic\0"
+  "Lanoh\0"
+  "Daantanai'\0"
+  "Leningitij\0"
+  "Banda, South Central\0"
+  "Langam\0"
+  "Lorediakarkar\0"
+  "Lamnso'\0"
+  "Longuda\0"
+  "Lanima\0"
+  "Lonzo\0"
+  "Loloda\0"
+  "Lobi\0"
+  "Inonhan\0"
+  "Saluan\0"
+  "Logol\0"
+  "Logo\0"
+  "Narim\0"
+  "Loma (Côte d'Ivoire)\0"
+  "Lou\0"
+  "Loko\0"
+  "Mongo\0"
+  "Loma (Liberia)\0"
+  "Lomwe, Malawi\0"
+  "Lombo\0"
+  "Lopa\0"
+  "Lobala\0"
+  "Téén\0"
+  "Loniu\0"
+  "Otuho\0"
+  "Creole, Louisiana\0"
+  "Lopi\0"
+  "Lobu, Tampias\0"
+  "Loun\0"
+  "Loke\0"
+  "Lozi\0"
+  "Lelepa\0"
+  "Lepki\0"
+  "Naga, Long Phuri\0"
+  "Lipo\0"
+  "Lopit\0"
+  "Logir\0"
+  "Rara Bakati'\0"
+  "Luri, Northern\0"
+  "Laurentian\0"
+  "Laragia\0"
+  "Marachi\0"
+  "Loarki\0"
+  "Lari\0"
+  "Marama\0"
+  "Lorang\0"
+  "Laro\0"
+  "Yamphu, Southern\0"
+  "Malay, Larantuka\0"
+  "Larevat\0"
+  "Lemerig\0"
+  "Lasgerdi\0"
+  "Burundian Sign Language\0"
+  "Albarradas Sign Language\0"
+  "Lishana Deni\0"
+  "Lusengo\0"
+  "Lish\0"
+  "Lashi\0"
+  "Latvian Sign Language\0"
+  "Saamia\0"
+  "Tibetan Sign Language\0"
+  "Laos Sign Language\0"
+  "Panamanian Sign Language\0"
+  "Aruop\0"
+  "Lasi\0"
+  "Trinidad and Tobago Sign Language\0"
+  "Sivia Sign Language\0"
+  "Seychelles Sign Language\0"
+  "Mauritian Sign Language\0"
+  "Chinese, Late Middle\0"
+  "Latgalian\0"
+  "Thur\0"
+  "Leti (Indonesia)\0"
+  "Latundê\0"
+  "Tsotso\0"
+  "Tachoni\0"
+  "Latu\0"
+  "Luxembourgish\0"
+  "Luba-Katanga\0"
+  "Luba-Lulua\0"
+  "Aringa\0"
+  "Ludian\0"
+  "Luvale\0"
+  "Laua\0"
+  "Luiseno\0"
+  "Luna\0"
+  "Lunanakha\0"
+  "Olu'bo\0"
+  "Luimbi\0"
+  "Lunda\0"
+  "Luo (Kenya and Tanzania)\0"
+  "Lumbu\0"
+  "Lucumi\0"
+  "Laura\0"
+  "Lushai\0"
+  "Lushootseed\0"
+  "Lumba-Yakkha\0"
+  "Luwati\0"
+  "Luo (Cameroon)\0"
+  "Luyia\0"
+  "Luri, Southern\0"
+  "Maku'a\0"
+  "Lavi\0"
+  "Lavukaleve\0"
+  "Latvian, Standard\0"
+  "Levuka\0"
+  "Lwalu\0"
+  "Lewo Eleng\0"
+  "Wanga\0"
+  "Lachi, White\0"
+  "Lawa, Eastern\0"
+  "Laomian\0"
+  "Luwo\0"
+  "Malawian Sign Language\0"
+  "Lewotobi\0"
+  "Lawu\0"
+  "Lewo\0"
+  "Lakurumau\0"
+  "Layakha\0"
+  "Lyngngam\0"
+  "Luyana\0"
+  "Chinese, Literary\0"
+  "Litzlitz\0"
+  "Naga, Leinong\0"
+  "Laz\0"
+  "Mazatec, San Jerónimo Tecóatl\0"
+  "Mixtec, Yutanduchi\0"
+  "Macedonian\0"
+  "Madurese\0"
+  "Bo-Rukul\0"
+  "Mafa\0"
+  "Magahi\0"
+  "Marshallese\0"
+  "Maithili\0"
+  "Mazatec, Jalapa De Díaz\0"
+  "Makasar\0"
+  "Malayalam\0"
+  "Mam\0"
+  "Mandingo\0"
+  "Maori\0"
+  "Austronesian languages\0"
+  "Mazatec, Chiquihuitlán\0"
+  "Marathi\0"
+  "Masai\0"
+  "Matlatzinca, San Francisco\0"
+  "Mazatec, Huautla\0"
+  "Sateré-Mawé\0"
+  "Mampruli\0"
+  "Malay, North Moluccan\0"
+  "Malay\0"
+  "Mazahua, Central\0"
+  "Higaonon\0"
+  "Manobo, Western Bukidnon\0"
+  "Macushi\0"
+  "Manobo, Dibabawon\0"
+  "Molale\0"
+  "Malay, Baba\0"
+  "Mangseng\0"
+  "Manobo, Ilianen\0"
+  "Nadëb\0"
+  "Malol\0"
+  "Maxakalí\0"
+  "Ombamba\0"
+  "Macaguán\0"
+  "Mbo (Cameroon)\0"
+  "Malayo\0"
+  "Maisin\0"
+  "Nukak Makú\0"
+  "Manobo, Sarangani\0"
+  "Manobo, Matigsalug\0"
+  "Mbula-Bwazza\0"
+  "Mbulungish\0"
+  "Maring\0"
+  "Mari (East Sepik Province)\0"
+  "Memoni\0"
+  "Mixtec, Amoltepec\0"
+  "Maca\0"
+  "Machiguenga\0"
+  "Bitur\0"
+  "Sharanahua\0"
+  "Mixtec, Itundujia\0"
+  "Matsés\0"
+  "Mapoyo\0"
+  "Maquiritari\0"
+  "Mese\0"
+  "Mvanip\0"
+  "Mbunda\0"
+  "Macaguaje\0"
+  "Creole Portuguese, Malaccan\0"
+  "Masana\0"
+  "Mixe, Coatlán\0"
+  "Makaa\0"
+  "Ese\0"
+  "Menya\0"
+  "Mambai\0"
+  "Mengisa\0"
+  "Mambila, Cameroon\0"
+  "Minanibai\0"
+  "Mawa (Chad)\0"
+  "Mpiemo\0"
+  "Watut, South\0"
+  "Mawan\0"
+  "Mada (Nigeria)\0"
+  "Morigi\0"
+  "Male (Papua New Guinea)\0"
+  "Mbum\0"
+  "Maba (Chad)\0"
+  "Moksha\0"
+  "Massalat\0"
+  "Maguindanaon\0"
+  "Mamvu\0"
+  "Mangbetu\0"
+  "Mangbutu\0"
+  "Maltese Sign Language\0"
+  "Mayogo\0"
+  "Mbati\0"
+  "Mbala\0"
+  "Mbole\0"
+  "Mandar\0"
+  "Maria (Papua New Guinea)\0"
+  "Mbere\0"
+  "Mboko\0"
+  "Mixtec, Santa Lucía Monteverde\0"
+  "Mbosi\0"
+  "Dizin\0"
+  "Male (Ethiopia)\0"
+  "Suruí Do Pará\0"
+  "Menka\0"
+  "Ikobi\0"
+  "Marra\0"
+  "Melpa\0"
+  "Mengen\0"
+  "Megam\0"
+  "Mixtec, Southwestern Tlaxiaco\0"
+  "Midob\0"
+  "Meyah\0"
+  "Mekeo\0"
+  "Melanau, Central\0"
+  "Mangala\0"
+  "Mende (Sierra Leone)\0"
+  "Malay, Kedah\0"
+  "Miriwoong\0"
+  "Merey\0"
+  "Meru\0"
+  "Masmaje\0"
+  "Mato\0"
+  "Motu\0"
+  "Mano\0"
+  "Maaka\0"
+  "Hassaniyya\0"
+  "Menominee\0"
+  "Malay, Pattani\0"
+  "Bangka\0"
+  "Mba\0"
+  "Mendankwe-Nkwen\0"
+  "Morisyen\0"
+  "Naki\0"
+  "Mogofin\0"
+  "Matal\0"
+  "Wandala\0"
+  "Mefele\0"
+  "Mofu, North\0"
+  "Putai\0"
+  "Marghi South\0"
+  "Mbembe, Cross River\0"
+  "Mbe\0"
+  "Malay, Makassar\0"
+  "Moba\0"
+  "Marrithiyel\0"
+  "Mexican Sign Language\0"
+  "Mokerang\0"
+  "Mbwela\0"
+  "Mandjak\0"
+  "Mulaha\0"
+  "Melo\0"
+  "Mayo\0"
+  "Mabaan\0"
+  "Malagasy\0"
+  "Irish, Middle (900-1200)\0"
+  "Mararit\0"
+  "Morokodo\0"
+  "Moru\0"
+  "Mango\0"
+  "Maklew\0"
+  "Mpumpong\0"
+  "Makhuwa-Meetto\0"
+  "Lijili\0"
+  "Abureni\0"
+  "Mawes\0"
+  "Maleu-Kilenge\0"
+  "Mambae\0"
+  "Mbangi\0"
+  "Meta'\0"
+  "Magar, Eastern\0"
+  "Malila\0"
+  "Mambwe-Lungu\0"
+  "Manda (Tanzania)\0"
+  "Mongol\0"
+  "Mailu\0"
+  "Matengo\0"
+  "Matumbi\0"
+  "Mbunga\0"
+  "Mbugwe\0"
+  "Manda (India)\0"
+  "Mahongwe\0"
+  "Mocho\0"
+  "Mbugu\0"
+  "Besisi\0"
+  "Mamaa\0"
+  "Margu\0"
+  "Ma'di\0"
+  "Mogholi\0"
+  "Mungaka\0"
+  "Mauwake\0"
+  "Makhuwa-Moniga\0"
+  "Mócheno\0"
+  "Mashi (Zambia)\0"
+  "Malay, Balinese\0"
+  "Mandan\0"
+  "Mari, Eastern\0"
+  "Buru (Indonesia)\0"
+  "Mandahuaca\0"
+  "Digaro-Mishmi\0"
+  "Mbukushu\0"
+  "Maru\0"
+  "Ma'anyan\0"
+  "Mor (Mor Islands)\0"
+  "Miami\0"
+  "Mixtec, Atatláhuca\0"
+  "Mi'kmaq\0"
+  "Mandaic\0"
+  "Mixtec, Ocotepec\0"
+  "Mofu-Gudur\0"
+  "Mixtec, San Miguel El Grande\0"
+  "Mixtec, Chayuco\0"
+  "Mixtec, Chigmecatitlán\0"
+  "Abar\0"
+  "Mikasuki\0"
+  "Mixtec, Peñoles\0"
+  "Mixtec, Alacatlatzala\0"
+  "Minangkabau\0"
+  "Mixtec, Pinotepa Nacional\0"
+  "Mixtec, Apasco-Apoala\0"
+  "Mískito\0"
+  "Mixe, Isthmus\0"
+  "Uncoded languages\0"
+  "Mixtec, Southern Puebla\0"
+  "Mixtec, Cacaloxtepec\0"
+  "Akoye\0"
+  "Mixtec, Mixtepec\0"
+  "Mixtec, Ayutla\0"
+  "Mixtec, Coatzospan\0"
+  "Makalero\0"
+  "Mixtec, San Juan Colorado\0"
+  "Maidu, Northwest\0"
+  "Muskum\0"
+  "Tu\0"
+  "Mwera (Nyasa)\0"
+  "Kim Mun\0"
+  "Mawak\0"
+  "Matukar\0"
+  "Mandeali\0"
+  "Medebur\0"
+  "Ma (Papua New Guinea)\0"
+  "Malankuravan\0"
+  "Malapandaram\0"
+  "Malaryan\0"
+  "Malavedan\0"
+  "Miship\0"
+  "Sauria Paharia\0"
+  "Manna-Dora\0"
+  "Mannan\0"
+  "Karbi\0"
+  "Mahali\0"
+  "Mahican\0"
+  "Majhi\0"
+  "Mbre\0"
+  "Mal Paharia\0"
+  "Siliput\0"
+  "Mawchi\0"
+  "Miya\0"
+  "Mak (China)\0"
+  "Mon-Khmer languages\0"
+  "Dhatki\0"
+  "Mokilese\0"
+  "Byep\0"
+  "Mokole\0"
+  "Moklen\0"
+  "Malay, Kupang\0"
+  "Mingang Doso\0"
+  "Moikodi\0"
+  "Miwok, Bay\0"
+  "Malas\0"
+  "Mixtec, Silacayoapan\0"
+  "Vamale\0"
+  "Maninka, Konyanka\0"
+  "Mafea\0"
+  "Kituba (Congo)\0"
+  "Manobo, Kinamiging\0"
+  "Makian, East\0"
+  "Makasae\0"
+  "Malo\0"
+  "Mbule\0"
+  "Cao Lan\0"
+  "Manambu\0"
+  "Mal\0"
+  "Mape\0"
+  "Malimpung\0"
+  "Miltu\0"
+  "Ilwana\0"
+  "Malua Bay\0"
+  "Mulam\0"
+  "Malango\0"
+  "Mlomp\0"
+  "Bargam\0"
+  "Maninkakan, Western\0"
+  "Vame\0"
+  "Masalit\0"
+  "Maltese\0"
+  "To'abaita\0"
+  "Motlav\0"
+  "Moloko\0"
+  "Malfaxal\0"
+  "Malaynon\0"
+  "Mama\0"
+  "Momina\0"
+  "Mazahua, Michoacán\0"
+  "Maonan\0"
+  "Mae\0"
+  "Mundat\0"
+  "Ambrym, North\0"
+  "Mehináku\0"
+  "Musar\0"
+  "Majhwar\0"
+  "Mukha-Dora\0"
+  "Man Met\0"
+  "Maii\0"
+  "Mamanwa\0"
+  "Buang, Mangga\0"
+  "Siawi\0"
+  "Musak\0"
+  "Miao, Western Xiangxi\0"
+  "Malalamai\0"
+  "Mmaala\0"
+  "Miriti\0"
+  "Emae\0"
+  "Madak\0"
+  "Migaama\0"
+  "Mabaale\0"
+  "Mongolian\0"
+  "Mbula\0"
+  "Muna\0"
+  "Manchu\0"
+  "Mondé\0"
+  "Naba\0"
+  "Mundani\0"
+  "Mnong, Eastern\0"
+  "Mono (Democratic Republic of Congo)\0"
+  "Manipuri\0"
+  "Munji\0"
+  "Mandinka\0"
+  "Tiale\0"
+  "Mapena\0"
+  "Mnong, Southern\0"
+  "Manobo languages\0"
+  "Chinese, Min Bei\0"
+  "Minriq\0"
+  "Mono (USA)\0"
+  "Mansi\0"
+  "Mer\0"
+  "Rennell-Bellona\0"
+  "Mon\0"
+  "Manikion\0"
+  "Manyawa\0"
+  "Moni\0"
+  "Mwan\0"
+  "Mocoví\0"
+  "Mobilian\0"
+  "Innu\0"
+  "Mongondow\0"
+  "Mohawk\0"
+  "Mboi\0"
+  "Monzombo\0"
+  "Morori\0"
+  "Mangue\0"
+  "Monom\0"
+  "Mopán Maya\0"
+  "Mor (Bomberai Peninsula)\0"
+  "Moro\0"
+  "Mossi\0"
+  "Barí\0"
+  "Mogum\0"
+  "Mohave\0"
+  "Moi (Congo)\0"
+  "Molima\0"
+  "Shekkacho\0"
+  "Mukulu\0"
+  "Mpoto\0"
+  "Malak Malak\0"
+  "Mangarrayi\0"
+  "Machinere\0"
+  "Majang\0"
+  "Marba\0"
+  "Maung\0"
+  "Mpade\0"
+  "Martu Wangka\0"
+  "Mbara (Chad)\0"
+  "Watut, Middle\0"
+  "Mixtec, Yosondúa\0"
+  "Mindiri\0"
+  "Miu\0"
+  "Migabac\0"
+  "Matís\0"
+  "Vangunu\0"
+  "Dadibi\0"
+  "Mian\0"
+  "Makuráp\0"
+  "Mungkip\0"
+  "Mapidian\0"
+  "Misima-Panaeati\0"
+  "Mapia\0"
+  "Mpi\0"
+  "Maba (Indonesia)\0"
+  "Mbuko\0"
+  "Mangole\0"
+  "Matepi\0"
+  "Momuna\0"
+  "Malay, Kota Bangun Kutai\0"
+  "Mixtec, Tlazoyaltepec\0"
+  "Mariri\0"
+  "Mamasa\0"
+  "Manobo, Rajah Kabunsuwan\0"
+  "Mbelime\0"
+  "Marquesan, South\0"
+  "Moronene\0"
+  "Modole\0"
+  "Manipa\0"
+  "Minokok\0"
+  "Mander\0"
+  "Makian, West\0"
+  "Mok\0"
+  "Mandari\0"
+  "Mosimo\0"
+  "Murupi\0"
+  "Mamuju\0"
+  "Manggarai\0"
+  "Pano\0"
+  "Mlabri\0"
+  "Marino\0"
+  "Maricopa\0"
+  "Magar, Western\0"
+  "Martha's Vineyard Sign Language\0"
+  "Elseng\0"
+  "Mising\0"
+  "Chin, Mara\0"
+  "Mari, Western\0"
+  "Hmwaveke\0"
+  "Mortlockese\0"
+  "Merlav\0"
+  "Cheke Holo\0"
+  "Mru\0"
+  "Morouas\0"
+  "Marquesan, North\0"
+  "Maria (India)\0"
+  "Maragus\0"
+  "Marghi Central\0"
+  "Mono (Cameroon)\0"
+  "Mangareva\0"
+  "Maranao\0"
+  "Maremgi\0"
+  "Mandaya\0"
+  "Marind\0"
+  "Malay (macrolanguage)\0"
+  "Masbatenyo\0"
+  "Maninka, Sankaran\0"
+  "Yucatec Maya Sign Language\0"
+  "Musey\0"
+  "Mekwei\0"
+  "Moraid\0"
+  "Malagasy, Masikoro\0"
+  "Malay, Sabah\0"
+  "Ma (Democratic Republic of Congo)\0"
+  "Mansaka\0"
+  "Molof\0"
+  "Manobo, Agusan\0"
+  "Vurës\0"
+  "Mombum\0"
+  "Maritsauá\0"
+  "Caac\0"
+  "Mongolian Sign Language\0"
+  "Masela, West\0"
+  "Musom\0"
+  "Maslam\0"
+  "Mansoanka\0"
+  "Moresada\0"
+  "Aruamu\0"
+  "Momare\0"
+  "Manobo, Cotabato\0"
+  "Anyin Morofo\0"
+  "Munit\0"
+  "Mualang\0"
+  "Mono (Solomon Islands)\0"
+  "Murik (Papua New Guinea)\0"
+  "Una\0"
+  "Munggui\0"
+  "Maiwa (Papua New Guinea)\0"
+  "Moskona\0"
+  "Mbe'\0"
+  "Montol\0"
+  "Mator\0"
+  "Matagalpa\0"
+  "Mixe, Totontepec\0"
+  "Wichí Lhamtés Nocten\0"
+  "Muong\0"
+  "Mewari\0"
+  "Yora\0"
+  "Mota\0"
+  "Mixtec, Tututepec\0"
+  "Asaro'o\0"
+  "Binukidnon, Southern\0"
+  "Mixtec, Tidaá\0"
+  "Nabi\0"
+  "Mundang\0"
+  "Mubi\0"
+  "Ajumbu\0"
+  "Aleut, Mednyj\0"
+  "Media Lengua\0"
+  "Musgu\0"
+  "Mündü\0"
+  "Musi\0"
+  "Mabire\0"
+  "Mugom\0"
+  "Multiple languages\0"
+  "Maiwala\0"
+  "Munda languages\0"
+  "Nyong\0"
+  "Malvi\0"
+  "Miao, Eastern Xiangxi\0"
+  "Murle\0"
+  "Creek\0"
+  "Muria, Western\0"
+  "Yaaku\0"
+  "Muthuvan\0"
+  "Bo-Ung\0"
+  "Muyang\0"
+  "Mursi\0"
+  "Manam\0"
+  "Mattole\0"
+  "Mamboru\0"
+  "Marwari (Pakistan)\0"
+  "Mongolian, Peripheral\0"
+  "Mixtec, Yucuañe\0"
+  "Mulgi\0"
+  "Miyako\0"
+  "Mekmek\0"
+  "Mbara (Australia)\0"
+  "Minaveha\0"
+  "Marovo\0"
+  "Duri\0"
+  "Moere\0"
+  "Marau\0"
+  "Massep\0"
+  "Mpotovoro\0"
+  "Marfa\0"
+  "Murut, Tagal\0"
+  "Machinga\0"
+  "Meoswar\0"
+  "Kohistani, Indus\0"
+  "Mesqan\0"
+  "Mwatebu\0"
+  "Juwal\0"
+  "Are\0"
+  "Mwera (Chimwera)\0"
+  "Murrinh-Patha\0"
+  "Aiklep\0"
+  "Mouk-Aria\0"
+  "Labo\0"
+  "Maninkakan, Kita\0"
+  "Mirandese\0"
+  "Sar\0"
+  "Nyamwanga\0"
+  "Maewo, Central\0"
+  "Kala Lagaw Ya\0"
+  "Chin, Mün\0"
+  "Marwari\0"
+  "Mwimbi-Muthambi\0"
+  "Moken\0"
+  "Mittu\0"
+  "Mentawai\0"
+  "Hmong Daw\0"
+  "Moingi\0"
+  "Mixtec, Northwest Oaxaca\0"
+  "Mixtec, Tezoatlán\0"
+  "Manyika\0"
+  "Modang\0"
+  "Mele-Fila\0"
+  "Malgbe\0"
+  "Mbangala\0"
+  "Mvuba\0"
+  "Mozarabic\0"
+  "Miju-Mishmi\0"
+  "Monumbo\0"
+  "Gbe, Maxi\0"
+  "Meramera\0"
+  "Moi (Indonesia)\0"
+  "Mbowe\0"
+  "Mixe, Tlahuitoltepec\0"
+  "Mixe, Juquila\0"
+  "Murik (Malaysia)\0"
+  "Mixtec, Huitepec\0"
+  "Mixtec, Jamiltepec\0"
+  "Mada (Cameroon)\0"
+  "Mixtec, Metlatónoc\0"
+  "Namo\0"
+  "Mahou\0"
+  "Mixtec, Southeastern Nochixtlán\0"
+  "Masela, Central\0"
+  "Mbay\0"
+  "Mayeka\0"
+  "Myene\0"
+  "Bambassi\0"
+  "Manta\0"
+  "Makah\0"
+  "Mangayat\0"
+  "Senoufo, Mamara\0"
+  "Moma\0"
+  "Me'en\0"
+  "Mayan languages\0"
+  "Anfillo\0"
+  "Pirahã\0"
+  "Muniche\0"
+  "Mesmes\0"
+  "Mundurukú\0"
+  "Erzya\0"
+  "Muyuw\0"
+  "Masaaba\0"
+  "Macuna\0"
+  "Mandaic, Classical\0"
+  "Mixtec, Santa María Zacatepec\0"
+  "Tumzabt\0"
+  "Madagascar Sign Language\0"
+  "Malimba\0"
+  "Morawa\0"
+  "Monastic Sign Language\0"
+  "Wichí Lhamtés Güisnay\0"
+  "Mazatec, Ixcatlán\0"
+  "Manya\0"
+  "Mambila, Nigeria\0"
+  "Mixe, Mazatlán\0"
+  "Mumuye\0"
+  "Mazanderani\0"
+  "Matipuhy\0"
+  "Movima\0"
+  "Mori Atas\0"
+  "Marúbo\0"
+  "Macanese\0"
+  "Mintil\0"
+  "Inapang\0"
+  "Manza\0"
+  "Deg\0"
+  "Mawayana\0"
+  "Mozambican Sign Language\0"
+  "Maiadomu\0"
+  "Nauru\0"
+  "Namla\0"
+  "Nambikuára, Southern\0"
+  "Narak\0"
+  "Naka'ela\0"
+  "Nabak\0"
+  "Naga Pidgin\0"
+  "Nahuatl languages\0"
+  "North American Indian languages\0"
+  "Nalu\0"
+  "Nakanai\0"
+  "Nalik\0"
+  "Ngan'gityemerri\0"
+  "Chinese, Min Nan\0"
+  "Naaba\0"
+  "Neapolitan\0"
+  "Khoekhoe\0"
+  "Iguta\0"
+  "Naasioi\0"
+  "Ca̱hungwa̱rya̱\0"
+  "Navajo\0"
+  "Nawuri\0"
+  "Nakwi\0"
+  "Ngarrindjeri\0"
+  "Nahuatl, Coatepec\0"
+  "Bokmål, Norwegian; Norwegian Bokmål\0"
+  "Nyemba\0"
+  "Ndoe\0"
+  "Naga, Chang\0"
+  "Ngbinda\0"
+  "Naga, Konyak\0"
+  "Nagarchal\0"
+  "Ngamo\0"
+  "Naga, Mao\0"
+  "Ngarinyman\0"
+  "Nake\0"
+  "Ndebele, South\0"
+  "Ngbaka Ma'bo\0"
+  "Kuri\0"
+  "Nkukoli\0"
+  "Nnam\0"
+  "Nggem\0"
+  "Numana\0"
+  "Namibian Sign Language\0"
+  "Na\0"
+  "Naga, Rongmei\0"
+  "Ngamambo\0"
+  "Ngbandi, Southern\0"
+  "Ningera\0"
+  "Iyo\0"
+  "Nicobarese, Central\0"
+  "Ponam\0"
+  "Nachering\0"
+  "Yale\0"
+  "Notsi\0"
+  "Nisga'a\0"
+  "Nahuatl, Central Huasteca\0"
+  "Nahuatl, Classical\0"
+  "Nahuatl, Northern Puebla\0"
+  "Na-kara\0"
+  "Nahuatl, Michoacán\0"
+  "Nambo\0"
+  "Nauna\0"
+  "Sibe\0"
+  "Katang, Northern\0"
+  "Ncane\0"
+  "Nicaraguan Sign Language\0"
+  "Naga, Chothe\0"
+  "Chumburung\0"
+  "Nahuatl, Central Puebla\0"
+  "Natchez\0"
+  "Ndebele, North; North Ndebele\0"
+  "Ndasa\0"
+  "Kenswei Nsei\0"
+  "Ndau\0"
+  "Nde-Nsele-Nta\0"
+  "Ndebele, North\0"
+  "Nadruvian\0"
+  "Ndengereko\0"
+  "Ndali\0"
+  "Samba Leko\0"
+  "Ndamba\0"
+  "Ndaka\0"
+  "Ndolo\0"
+  "Ndam\0"
+  "Ngundi\0"
+  "Ndonga\0"
+  "Ndo\0"
+  "Ndombe\0"
+  "Ndoola\0"
+  "German, Low\0"
+  "Ndunga\0"
+  "Dugun\0"
+  "Ndut\0"
+  "Ndobo\0"
+  "Nduga\0"
+  "Lutos\0"
+  "Ndogo\0"
+  "Nepali\0"
+  "Ngad'a, Eastern\0"
+  "Toura (Côte d'Ivoire)\0"
+  "Nedebang\0"
+  "Nde-Gbite\0"
+  "Nêlêmwa-Nixumwak\0"
+  "Nefamese\0"
+  "Negidal\0"
+  "Nyenkha\0"
+  "Hittite, Neo-\0"
+  "Neko\0"
+  "Neku\0"
+  "Nemi\0"
+  "Nengone\0"
+  "Ná-Meo\0"
+  "Nepali (macrolanguage)\0"
+  "Mixe, North Central\0"
+  "Yahadian\0"
+  "Kinnauri, Bhoti\0"
+  "Nete\0"
+  "Neo\0"
+  "Nyaheun\0"
+  "Newari\0"
+  "Neme\0"
+  "Neyo\0"
+  "Nez Perce\0"
+  "Dhao\0"
+  "Ahwai\0"
+  "Ayiwo\0"
+  "Nafaanra\0"
+  "Mfumte\0"
+  "Ngbaka\0"
+  "Ngbandi, Northern\0"
+  "Ngombe (Democratic Republic of Congo)\0"
+  "Ngando (Central African Republic)\0"
+  "Ngemba\0"
+  "Ngbaka Manza\0"
+  "Nǁng\0"
+  "Ngizim\0"
+  "Ngie\0"
+  "Dalabon\0"
+  "Lomwe\0"
+  "Ngatik Men's Creole\0"
+  "Ngwo\0"
+  "Ngulu\0"
+  "Ngurimi\0"
+  "Engdewu\0"
+  "Gvoko\0"
+  "Kriang\0"
+  "Nahuatl, Guerrero\0"
+  "Nagumi\0"
+  "Ngwaba\0"
+  "Nggwahyi\0"
+  "Tibea\0"
+  "Ngungwel\0"
+  "Nhanda\0"
+  "Beng\0"
+  "Nahuatl, Tabasco\0"
+  "Chiripá\0"
+  "Nahuatl, Eastern Huasteca\0"
+  "Nhuwala\0"
+  "Nahuatl, Tetelcingo\0"
+  "Nahari\0"
+  "Nahuatl, Zacatlán-Ahuacatlán-Tepetzintla\0"
+  "Nahuatl, Isthmus-Cosoleacaque\0"
+  "Nahuatl, Morelos\0"
+  "Nahuatl, Central\0"
+  "Takuu\0"
+  "Nahuatl, Isthmus-Pajapan\0"
+  "Nahuatl, Huaxcaleca\0"
+  "Naro\0"
+  "Nahuatl, Ometepec\0"
+  "Noone\0"
+  "Nahuatl, Temascaltepec\0"
+  "Nahuatl, Western Huasteca\0"
+  "Nahuatl, Isthmus-Mecayapan\0"
+  "Nahuatl, Northern Oaxaca\0"
+  "Nahuatl, Santa María La Alta\0"
+  "Nias\0"
+  "Nakame\0"
+  "Niger-Kordofanian languages\0"
+  "Ngandi\0"
+  "Niellim\0"
+  "Nek\0"
+  "Ngalakgan\0"
+  "Nyiha (Tanzania)\0"
+  "Nii\0"
+  "Ngaju\0"
+  "Nicobarese, Southern\0"
+  "Nila\0"
+  "Nilamba\0"
+  "Ninzo\0"
+  "Nganasan\0"
+  "Nandi\0"
+  "Nimboran\0"
+  "Nimi\0"
+  "Kolami, Southeastern\0"
+  "Niuean\0"
+  "Gilyak\0"
+  "Nimo\0"
+  "Hema\0"
+  "Ngiti\0"
+  "Ningil\0"
+  "Nzanyi\0"
+  "Naga, Nocte\0"
+  "Ndonde Hamba\0"
+  "Naga, Lotha\0"
+  "Gudanji\0"
+  "Njen\0"
+  "Njalgulgule\0"
+  "Naga, Angami\0"
+  "Naga, Liangmai\0"
+  "Naga, Ao\0"
+  "Njerep\0"
+  "Nisa\0"
+  "Ndyuka-Trio Pidgin\0"
+  "Ngadjunmaya\0"
+  "Kunyi\0"
+  "Njyem\0"
+  "Nyishi\0"
+  "Nkoya\0"
+  "Naga, Khoibu\0"
+  "Nkongho\0"
+  "Koireng\0"
+  "Duke\0"
+  "Naga, Inpui\0"
+  "Nekgini\0"
+  "Naga, Khezha\0"
+  "Naga, Thangal\0"
+  "Nakai\0"
+  "Nokuku\0"
+  "Namat\0"
+  "Nkangala\0"
+  "Nkonya\0"
+  "Niuatoputapu\0"
+  "Nkami\0"
+  "Nukuoro\0"
+  "Asmat, North\0"
+  "Nyika (Tanzania)\0"
+  "Kulango, Bouna\0"
+  "Nyika (Malawi and Zambia)\0"
+  "Nkutu\0"
+  "Nkoroo\0"
+  "Nkari\0"
+  "Ngombale\0"
+  "Nalca\0"
+  "Dutch\0"
+  "Nyala, East\0"
+  "Gela\0"
+  "Grangali\0"
+  "Nyali\0"
+  "Yali, Ninia\0"
+  "Nihali\0"
+  "Mankiyali\0"
+  "Ngul\0"
+  "Naga, Lao\0"
+  "Nchumbulu\0"
+  "Nahuatl, Orizaba\0"
+  "Walangama\0"
+  "Nahali\0"
+  "Nyamal\0"
+  "Nalögo\0"
+  "Naga, Maram\0"
+  "Nambas, Big\0"
+  "Ngam\0"
+  "Ndumu\0"
+  "Naga, Mzieme\0"
+  "Naga, Tangkhul (India)\0"
+  "Kwasio\0"
+  "Naga, Monsang\0"
+  "Nyam\0"
+  "Ngombe (Central African Republic)\0"
+  "Namakura\0"
+  "Ndemli\0"
+  "Manangba\0"
+  "ǃXóõ\0"
+  "Naga, Moyon\0"
+  "Nimanbur\0"
+  "Nambya\0"
+  "Nimbari\0"
+  "Letemboi\0"
+  "Namonuito\0"
+  "Maidu, Northeast\0"
+  "Ngamini\0"
+  "Nimoa\0"
+  "Nama (Papua New Guinea)\0"
+  "Namuyi\0"
+  "Nawdm\0"
+  "Norwegian Nynorsk; Nynorsk, Norwegian\0"
+  "Nyangumarta\0"
+  "Nande\0"
+  "Nancere\0"
+  "Ambae, West\0"
+  "Ngandyera\0"
+  "Ngaing\0"
+  "Naga, Maring\0"
+  "Ngiemboon\0"
+  "Nuaulu, North\0"
+  "Nyangatom\0"
+  "Nankina\0"
+  "Naga, Northern Rengma\0"
+  "Namia\0"
+  "Ngete\0"
+  "Norwegian Nynorsk\0"
+  "Naga, Wancho\0"
+  "Ngindo\0"
+  "Narungga\0"
+  "Nanticoke\0"
+  "Dwang\0"
+  "Nugunu (Australia)\0"
+  "Nuni, Southern\0"
+  "Nyangga\0"
+  "Nda'nda'\0"
+  "Norwegian\0"
+  "Woun Meu\0"
+  "Norwegian Bokmål\0"
+  "Nuk\0"
+  "Thai, Northern\0"
+  "Nimadi\0"
+  "Nomane\0"
+  "Nogai\0"
+  "Nomu\0"
+  "Noiri\0"
+  "Nonuya\0"
+  "Nooksack\0"
+  "Nomlaki\0"
+  "Nocamán\0"
+  "Norse, Old\0"
+  "Numanggang\0"
+  "Ngongo\0"
+  "Nisu, Eastern\0"
+  "Nomatsiguenga\0"
+  "Ewage-Notu\0"
+  "Novial\0"
+  "Nyambo\0"
+  "Noy\0"
+  "Nayi\0"
+  "Nar Phu\0"
+  "Nupbikha\0"
+  "Naga, Ponyo-Gongwang\0"
+  "Naga, Phom\0"
+  "Nepali (individual language)\0"
+  "Nahuatl, Southeastern Puebla\0"
+  "Mondropolon\0"
+  "Naga, Pochuri\0"
+  "Nipsan\0"
+  "Naga, Puimei\0"
+  "Noipx\0"
+  "Napu\0"
+  "Nago, Southern\0"
+  "Ede Nago, Kura\0"
+  "Ngendelengo\0"
+  "Ndom\0"
+  "Nen\0"
+  "N'Ko\0"
+  "Naga, Kyan-Karyaw\0"
+  "Nteng\0"
+  "Naga, Akyaung Ari\0"
+  "Ndebele, South; South Ndebele\0"
+  "Ngom\0"
+  "Nara\0"
+  "Noric\0"
+  "Naga, Southern Rengma\0"
+  "Jèrriais\0"
+  "Narango\0"
+  "Naga, Chokri\0"
+  "Ngarla\0"
+  "Ngarluma\0"
+  "Narom\0"
+  "Norn\0"
+  "Picene, North\0"
+  "Norra\0"
+  "Kalapuya, Northern\0"
+  "Narua\0"
+  "Ngurmbur\0"
+  "Lala\0"
+  "Naga, Sangtam\0"
+  "Lower Nossob\0"
+  "Nshi\0"
+  "Nisu, Southern\0"
+  "Nsenga\0"
+  "Nisu, Northwestern\0"
+  "Ngasa\0"
+  "Ngoshie\0"
+  "Nigerian Sign Language\0"
+  "Naskapi\0"
+  "Norwegian Sign Language\0"
+  "Naga, Sumi\0"
+  "Nehan\0"
+  "Pedi\0"
+  "Nepalese Sign Language\0"
+  "Miwok, Northern Sierra\0"
+  "Maritime Sign Language\0"
+  "Nali\0"
+  "Naga, Tase\0"
+  "Nahuatl, Sierra Negra\0"
+  "Nisu, Southwestern\0"
+  "Navut\0"
+  "Nsongo\0"
+  "Nasal\0"
+  "Nisenan\0"
+  "Tidung, Northern\0"
+  "Nathembo\0"
+  "Ngantangarra\0"
+  "Natioro\0"
+  "Ngaanyatjarra\0"
+  "Ikoma-Nata-Isenye\0"
+  "Nateni\0"
+  "Ntomba\0"
+  "Tepehuan, Northern\0"
+  "Delo\0"
+  "Natügu\0"
+  "Nottoway\0"
+  "Naga, Tangkhul (Myanmar)\0"
+  "Mantsi\0"
+  "Natanzi\0"
+  "Yuanga\0"
+  "Nubian languages\0"
+  "Nukuini\0"
+  "Ngala\0"
+  "Ngundu\0"
+  "Nusu\0"
+  "Nungali\0"
+  "Ndunda\0"
+  "Ngumbi\0"
+  "Nyole\0"
+  "Nuu-chah-nulth\0"
+  "Nusa Laut\0"
+  "Niuafo'ou\0"
+  "Anong\0"
+  "Nguôn\0"
+  "Nupe-Nupe-Tako\0"
+  "Nukumanu\0"
+  "Nukuria\0"
+  "Nuer\0"
+  "Nung (Viet Nam)\0"
+  "Ngbundu\0"
+  "Nuni, Northern\0"
+  "Nguluwan\0"
+  "Mehek\0"
+  "Nunggubuyu\0"
+  "Nahuatl, Tlamacazapa\0"
+  "Navajo; Navaho\0"
+  "Nasarian\0"
+  "Namiae\0"
+  "Nyokon\0"
+  "Nawathinehena\0"
+  "Nyabwa\0"
+  "Newari, Classical\0"
+  "Ngwe\0"
+  "Ngayawung\0"
+  "Tanna, Southwest\0"
+  "Nyamusa-Molo\0"
+  "Nauo\0"
+  "Nawaru\0"
+  "Ndwewe\0"
+  "Newar, Middle\0"
+  "Nottoway-Meherrin\0"
+  "Nauete\0"
+  "Ngando (Democratic Republic of Congo)\0"
+  "Nage\0"
+  "Ngad'a\0"
+  "Nindi\0"
+  "Naga, Koki\0"
+  "Nuaulu, South\0"
+  "Numidian\0"
+  "Ngawun\0"
+  "Ndambomo\0"
+  "Naxi\0"
+  "Ninggerum\0"
+  "Nafri\0"
+  "Chichewa; Chewa; Nyanja\0"
+  "Nyanja\0"
+  "Nyangbo\0"
+  "Nyanga-li\0"
+  "Nyore\0"
+  "Nyengo\0"
+  "Giryama\0"
+  "Nyindu\0"
+  "Nyikina\0"
+  "Ama (Sudan)\0"
+  "Nyanga\0"
+  "Nyaneka\0"
+  "Nyeu\0"
+  "Nyamwezi\0"
+  "Nyankole\0"
+  "Nyoro\0"
+  "Nyang'i\0"
+  "Nayini\0"
+  "Nyiha (Malawi)\0"
+  "Nyungar\0"
+  "Nyawaygi\0"
+  "Nyungwe\0"
+  "Nyulnyul\0"
+  "Nyaw\0"
+  "Nganyaywana\0"
+  "Nyakyusa-Ngonde\0"
+  "Mbembe, Tigon\0"
+  "Njebi\0"
+  "Nzadi\0"
+  "Nzima\0"
+  "Nzakara\0"
+  "Naga, Zeme\0"
+  "New Zealand Sign Language\0"
+  "Teke-Nzikou\0"
+  "Nzakambay\0"
+  "Dogon, Nanga Dama\0"
+  "Orok\0"
+  "Oroch\0"
+  "Aramaic, Old (up to 700 BCE)\0"
+  "Avar, Old\0"
+  "Obispeño\0"
+  "Bontok, Southern\0"
+  "Oblo\0"
+  "Moabite\0"
+  "Manobo, Obo\0"
+  "Burmese, Old\0"
+  "Breton, Old\0"
+  "Obulom\0"
+  "Occitan (post 1500); Provençal\0"
+  "Ocaina\0"
+  "Chinese, Old\0"
+  "Occitan (post 1500)\0"
+  "Cham, Old\0"
+  "Cornish, Old\0"
+  "Matlatzinca, Atzingo\0"
+  "Odut\0"
+  "Od\0"
+  "Dutch, Old\0"
+  "Odual\0"
+  "Ofo\0"
+  "Frisian, Old\0"
+  "Efutop\0"
+  "Ogbia\0"
+  "Ogbah\0"
+  "Georgian, Old\0"
+  "Ogbogolo\0"
+  "Khana\0"
+  "Ogbronuagum\0"
+  "Hittite, Old\0"
+  "Hungarian, Old\0"
+  "Oirata\0"
+  "Okolie\0"
+  "One, Inebu\0"
+  "Ojibwa\0"
+  "Ojibwa, Northwestern\0"
+  "Ojibwa, Central\0"
+  "Ojibwa, Eastern\0"
+  "Japanese, Old\0"
+  "Ojibwa, Severn\0"
+  "Ontong Java\0"
+  "Ojibwa, Western\0"
+  "Okanagan\0"
+  "Okobo\0"
+  "Kobo\0"
+  "Okodia\0"
+  "Okpe (Southwestern Edo)\0"
+  "Koko Babangk\0"
+  "Koresh-e Rostam\0"
+  "Okiek\0"
+  "Oko-Juwoi\0"
+  "One, Kwamtim\0"
+  "Kentish Sign Language, Old\0"
+  "Korean, Middle (10th-16th cent.)\0"
+  "Oki-No-Erabu\0"
+  "Korean, Old (3rd-9th cent.)\0"
+  "Kirike\0"
+  "Oko-Eni-Osayen\0"
+  "Oku\0"
+  "Orokaiva\0"
+  "Okpe (Northwestern Edo)\0"
+  "Khmer, Old\0"
+  "Walungge\0"
+  "Mochi\0"
+  "Olekha\0"
+  "Olkol\0"
+  "Oloma\0"
+  "Livvi\0"
+  "Olrat\0"
+  "Lithuanian, Old\0"
+  "Kuvale\0"
+  "Oromo\0"
+  "Omaha-Ponca\0"
+  "Ambae, East\0"
+  "Mochica\0"
+  "Omagua\0"
+  "Omi\0"
+  "Omok\0"
+  "Ombo\0"
+  "Minoan\0"
+  "Utarmbung\0"
+  "Manipuri, Old\0"
+  "Marathi, Old\0"
+  "Omotik\0"
+  "Omurano\0"
+  "Tairora, South\0"
+  "Mon, Old\0"
+  "Malay, Old\0"
+  "Ona\0"
+  "Lingao\0"
+  "Oneida\0"
+  "Olo\0"
+  "Onin\0"
+  "Onjob\0"
+  "One, Kabore\0"
+  "Onobasulu\0"
+  "Onondaga\0"
+  "Sartang\0"
+  "One, Northern\0"
+  "Ono\0"
+  "Ontenu\0"
+  "Unua\0"
+  "Nubian, Old\0"
+  "Onin Based Pidgin\0"
+  "Tohono O'odham\0"
+  "Ong\0"
+  "Önge\0"
+  "Oorlams\0"
+  "Ossetic, Old\0"
+  "Okpamheri\0"
+  "Kopkaka\0"
+  "Oksapmin\0"
+  "Opao\0"
+  "Opata\0"
+  "Ofayé\0"
+  "Oriya\0"
+  "Oroha\0"
+  "Orma\0"
+  "Orejón\0"
+  "Oring\0"
+  "Oroqen\0"
+  "Oriya (macrolanguage)\0"
+  "Orang Kanaq\0"
+  "Orokolo\0"
+  "Oruma\0"
+  "Orang Seletar\0"
+  "Oriya, Adivasi\0"
+  "Ormuri\0"
+  "Russian, Old\0"
+  "Oro Win\0"
+  "Oro\0"
+  "Odia\0"
+  "Ormu\0"
+  "Ossetian; Ossetic\0"
+  "Osage\0"
+  "Oscan\0"
+  "Osing\0"
+  "Sundanese, Old\0"
+  "Ososo\0"
+  "Spanish, Old\0"
+  "Ossetian\0"
+  "Osatu\0"
+  "One, Southern\0"
+  "Saxon, Old\0"
+  "Turkish, Ottoman (1500-1928)\0"
+  "Tibetan, Old\0"
+  "Ot Danum\0"
+  "Otomi, Mezquital\0"
+  "Oti\0"
+  "Turkish, Old\0"
+  "Otomi, Tilapa\0"
+  "Otomi, Eastern Highland\0"
+  "Otomi, Tenango\0"
+  "Otomian languages\0"
+  "Otomi, Querétaro\0"
+  "Otoro\0"
+  "Otomi, Estado de México\0"
+  "Otomi, Temoaya\0"
+  "Otuke\0"
+  "Ottawa\0"
+  "Otomi, Texcatepec\0"
+  "Tamil, Old\0"
+  "Otomi, Ixtenco\0"
+  "Tagargrent\0"
+  "Glio-Oubi\0"
+  "Oune\0"
+  "Uighur, Old\0"
+  "Ouma\0"
+  "Elfdalian\0"
+  "Owiniga\0"
+  "Welsh, Old\0"
+  "Oy\0"
+  "Oyda\0"
+  "Wayampi\0"
+  "Oya'oya\0"
+  "Koonzime\0"
+  "Panjabi; Punjabi\0"
+  "Papuan languages\0"
+  "Parecís\0"
+  "Pacoh\0"
+  "Paumarí\0"
+  "Pagibete\0"
+  "Paranawát\0"
+  "Pangasinan\0"
+  "Tenharim\0"
+  "Pe\0"
+  "Parakanã\0"
+  "Pahlavi\0"
+  "Pampanga\0"
+  "Panjabi\0"
+  "Paiute, Northern\0"
+  "Papiamento\0"
+  "Parya\0"
+  "Panamint\0"
+  "Papasena\0"
+  "Palauan\0"
+  "Pakaásnovos\0"
+  "Pawnee\0"
+  "Pankararé\0"
+  "Pech\0"
+  "Pankararú\0"
+  "Páez\0"
+  "Patamona\0"
+  "Popoloca, Mezontla\0"
+  "Popoloca, Coyotepec\0"
+  "Paraujano\0"
+  "E'ñapa Woromaipu\0"
+  "Parkwa\0"
+  "Mak (Nigeria)\0"
+  "Mazatec, Puebla\0"
+  "Kpasam\0"
+  "Papel\0"
+  "Badyara\0"
+  "Pangwa\0"
+  "Pame, Central\0"
+  "Pashto, Southern\0"
+  "Pashto, Northern\0"
+  "Pnar\0"
+  "Pyu (Papua New Guinea)\0"
+  "Popoloca, Santa Inés Ahuatempan\0"
+  "Pear\0"
+  "Bouyei\0"
+  "Picard\0"
+  "Palaung, Ruching\0"
+  "Paliyan\0"
+  "Paniya\0"
+  "Pardhan\0"
+  "Duruwa\0"
+  "Parenga\0"
+  "Chin, Paite\0"
+  "Pardhi\0"
+  "Pidgin, Nigerian\0"
+  "Piti\0"
+  "Pacahuara\0"
+  "Pyapun\0"
+  "Anam\0"
+  "German, Pennsylvania\0"
+  "Pa Di\0"
+  "Podena\0"
+  "Padoe\0"
+  "Plautdietsch\0"
+  "Kayan\0"
+  "Indonesian, Peranakan\0"
+  "Pomo, Eastern\0"
+  "Mala (Papua New Guinea)\0"
+  "Taje\0"
+  "Pomo, Northeastern\0"
+  "Pengo\0"
+  "Bonan\0"
+  "Chichimeca-Jonaz\0"
+  "Pomo, Northern\0"
+  "Penchal\0"
+  "Pekal\0"
+  "Phende\0"
+  "Persian, Old (ca. 600-400 B.C.)\0"
+  "Kunja\0"
+  "Pomo, Southern\0"
+  "Persian, Iranian\0"
+  "Pémono\0"
+  "Petats\0"
+  "Petjo\0"
+  "Penan, Eastern\0"
+  "Pááfang\0"
+  "Pere\0"
+  "Pfaelzisch\0"
+  "Creole Arabic, Sudanese\0"
+  "Gāndhārī\0"
+  "Pangwali\0"
+  "Pagi\0"
+  "Rerep\0"
+  "Irish, Primitive\0"
+  "Paelignian\0"
+  "Pangseng\0"
+  "Pagu\0"
+  "Papua New Guinean Sign Language\0"
+  "Pa-Hng\0"
+  "Phudagi\0"
+  "Phuong\0"
+  "Phukha\0"
+  "Philippine languages\0"
+  "Pahari\0"
+  "Phake\0"
+  "Phalura\0"
+  "Phimbi\0"
+  "Phoenician\0"
+  "Phunoi\0"
+  "Phana'\0"
+  "Pahari-Potwari\0"
+  "Phu Thai\0"
+  "Phuan\0"
+  "Pahlavani\0"
+  "Phangduwali\0"
+  "Pali\0"
+  "Pima Bajo\0"
+  "Yine\0"
+  "Pinji\0"
+  "Piaroa\0"
+  "Piro\0"
+  "Pingelapese\0"
+  "Pisabo\0"
+  "Pitcairn-Norfolk\0"
+  "Pijao\0"
+  "Yom\0"
+  "Powhatan\0"
+  "Piame\0"
+  "Piapoco\0"
+  "Pero\0"
+  "Piratapuyo\0"
+  "Pijin\0"
+  "Pitta Pitta\0"
+  "Pintupi-Luritja\0"
+  "Pileni\0"
+  "Pimbwe\0"
+  "Piu\0"
+  "Piya-Kwonci\0"
+  "Pije\0"
+  "Pitjantjatjara\0"
+  "Prākrit, Ardhamāgadhī\0"
+  "Pokomo\0"
+  "Paekche\0"
+  "Pak-Tong\0"
+  "Pankhu\0"
+  "Pakanha\0"
+  "Pökoot\0"
+  "Pukapuka\0"
+  "Kurumba, Attapady\0"
+  "Pakistan Sign Language\0"
+  "Maleng\0"
+  "Paku\0"
+  "Polish\0"
+  "Miani\0"
+  "Polonombauk\0"
+  "Palawano, Central\0"
+  "Polari\0"
+  "Palu'e\0"
+  "Pilagá\0"
+  "Paulohi\0"
+  "Polci\0"
+  "Shina, Kohistani\0"
+  "Palaung, Shwe\0"
+  "Palenquero\0"
+  "Popoluca, Oluta\0"
+  "Palaic\0"
+  "Senoufo, Palaka\0"
+  "Popoloca, San Marcos Tlacoyalco\0"
+  "Malagasy, Plateau\0"
+  "Palikúr\0"
+  "Palawano, Southwest\0"
+  "Palawano, Brooke's Point\0"
+  "Bolyu\0"
+  "Paluan\0"
+  "Paama\0"
+  "Pambia\0"
+  "Pallanganmiddang\0"
+  "Pwaamei\0"
+  "Pamona\0"
+  "Prākrit, Māhārāṣṭri\0"
+  "Pumi, Northern\0"
+  "Pumi, Southern\0"
+  "Pamlico\0"
+  "Lingua Franca\0"
+  "Pomo\0"
+  "Pam\0"
+  "Pom\0"
+  "Pame, Northern\0"
+  "Paynamar\0"
+  "Piemontese\0"
+  "Tuamotuan\0"
+  "Miwok, Plains\0"
+  "Naga, Poumei\0"
+  "Malay, Papuan\0"
+  "Pame, Southern\0"
+  "Punan Bah-Biau\0"
+  "Panjabi, Western\0"
+  "Pannei\0"
+  "Mpinda\0"
+  "Penan, Western\0"
+  "Pangu\0"
+  "Penrhyn\0"
+  "Aoheng\0"
+  "Pinjarup\0"
+  "Paunaka\0"
+  "Paleni\0"
+  "Punan Batu 1\0"
+  "Pinai-Hagahai\0"
+  "Panobo\0"
+  "Pancana\0"
+  "Pana (Burkina Faso)\0"
+  "Panim\0"
+  "Ponosakan\0"
+  "Pontic\0"
+  "Bunu, Jiongnai\0"
+  "Pinigura\0"
+  "Banyjima\0"
+  "Phong-Kniang\0"
+  "Pinyin\0"
+  "Pana (Central African Republic)\0"
+  "Poqomam\0"
+  "Popoloca, San Juan Atzingo\0"
+  "Poke\0"
+  "Potiguára\0"
+  "Poqomchi'\0"
+  "Popoluca, Highland\0"
+  "Pokangá\0"
+  "Pomo, Southeastern\0"
+  "Pohnpeian\0"
+  "Pomo, Central\0"
+  "Pwapwâ\0"
+  "Popoluca, Texistepec\0"
+  "Portuguese\0"
+  "Popoluca, Sayula\0"
+  "Potawatomi\0"
+  "Crioulo, Upper Guinea\0"
+  "Popoloca, San Felipe Otlaltepec\0"
+  "Polabian\0"
+  "Pogolo\0"
+  "Papi\0"
+  "Paipai\0"
+  "Uma\0"
+  "Pipil\0"
+  "Papuma\0"
+  "Papapana\0"
+  "Folopa\0"
+  "Pelende\0"
+  "Pei\0"
+  "Popoloca, San Luís Temalacayuca\0"
+  "Pare\0"
+  "Papora\0"
+  "Pa'a\0"
+  "Malecite-Passamaquoddy\0"
+  "Prakrit languages\0"
+  "Parachi\0"
+  "Parsi-Dari\0"
+  "Principense\0"
+  "Paranan\0"
+  "Prussian\0"
+  "Porohanon\0"
+  "Paicî\0"
+  "Parauk\0"
+  "Peruvian Sign Language\0"
+  "Kibiri\0"
+  "Prasuni\0"
+  "Provençal, Old (to 1500)\0"
+  "Parsi\0"
+  "Ashéninka Perené\0"
+  "Puri\0"
+  "Dari\0"
+  "Phai\0"
+  "Puragi\0"
+  "Parawen\0"
+  "Purik\0"
+  "Providencia Sign Language\0"
+  "Pushto; Pashto\0"
+  "Awyu, Asue\0"
+  "Iranian Sign Language\0"
+  "Plains Indian Sign Language\0"
+  "Malay, Central\0"
+  "Penang Sign Language\0"
+  "Pashai, Southwest\0"
+  "Pashai, Southeast\0"
+  "Puerto Rican Sign Language\0"
+  "Pauserna\0"
+  "Panasuan\0"
+  "Polish Sign Language\0"
+  "Philippine Sign Language\0"
+  "Pasi\0"
+  "Portuguese Sign Language\0"
+  "Kaulong\0"
+  "Pashto, Central\0"
+  "Prākrit, Sauraseni\0"
+  "Port Sandwich\0"
+  "Piscataway\0"
+  "Pai Tavytera\0"
+  "Pataxó Hã-Ha-Hãe\0"
+  "Pindiini\0"
+  "Patani\0"
+  "Zo'é\0"
+  "Patep\0"
+  "Pattapu\0"
+  "Piamatsina\0"
+  "Enrekang\0"
+  "Bambam\0"
+  "Port Vato\0"
+  "Pentlatch\0"
+  "Pathiya\0"
+  "Purepecha, Western Highland\0"
+  "Purum\0"
+  "Punan Merap\0"
+  "Punan Aput\0"
+  "Puelche\0"
+  "Punan Merah\0"
+  "Phuie\0"
+  "Puinave\0"
+  "Punan Tubu\0"
+  "Puma\0"
+  "Puoc\0"
+  "Pulabu\0"
+  "Puquina\0"
+  "Puruborá\0"
+  "Pushto\0"
+  "Putoh\0"
+  "Punu\0"
+  "Puluwatese\0"
+  "Puare\0"
+  "Purisimeño\0"
+  "Pawaia\0"
+  "Panawa\0"
+  "Gapapaiwa\0"
+  "Patwin\0"
+  "Molbog\0"
+  "Paiwan\0"
+  "Karen, Pwo Western\0"
+  "Powari\0"
+  "Karen, Pwo Northern\0"
+  "Mixe, Quetzaltepec\0"
+  "Krumen, Pye\0"
+  "Fyam\0"
+  "Poyanáwa\0"
+  "Paraguayan Sign Language\0"
+  "Puyuma\0"
+  "Pyu (Myanmar)\0"
+  "Pyen\0"
+  "Pazeh\0"
+  "Jejara Naga\0"
+  "Quechua\0"
+  "Quapaw\0"
+  "Quechua, Huallaga Huánuco\0"
+  "K'iche'\0"
+  "Quichua, Calderón Highland\0"
+  "Quechua, Lambayeque\0"
+  "Quichua, Chimborazo Highland\0"
+  "Quechua, South Bolivian\0"
+  "Quileute\0"
+  "Quechua, Chachapoyas\0"
+  "Quechua, North Bolivian\0"
+  "Sipacapense\0"
+  "Quinault\0"
+  "Quechua, Southern Pastaza\0"
+  "Quinqui\0"
+  "Quechua, Yanahuanca Pasco\0"
+  "Quichua, Santiago del Estero\0"
+  "Sacapulteco\0"
+  "Quichua, Tena Lowland\0"
+  "Quechua, Yauyos\0"
+  "Quechua, Ayacucho\0"
+  "Quechua, Cusco\0"
+  "Quechua, Ambo-Pasco\0"
+  "Quechua, Cajamarca\0"
+  "Quechua, Eastern Apurímac\0"
+  "Quechua, Huamalíes-Dos de Mayo Huánuco\0"
+  "Quichua, Imbabura Highland\0"
+  "Quichua, Loja Highland\0"
+  "Quechua, Cajatambo North Lima\0"
+  "Quechua, Margos-Yarowilca-Lauricocha\0"
+  "Quechua, North Junín\0"
+  "Quechua, Napo Lowland\0"
+  "Quechua, Pacaraos\0"
+  "Quechua, San Martín\0"
+  "Quechua, Huaylla Wanca\0"
+  "Queyu\0"
+  "Quichua, Northern Pastaza\0"
+  "Quechua, Corongo Ancash\0"
+  "Quechua, Classical\0"
+  "Quechua, Huaylas Ancash\0"
+  "Kuman (Russia)\0"
+  "Quechua, Sihuas Ancash\0"
+  "Kwalhioqua-Tlatskanai\0"
+  "Quechua, Chiquián Ancash\0"
+  "Quechua, Chincha\0"
+  "Quechua, Panao Huánuco\0"
+  "Quichua, Salasaca Highland\0"
+  "Quechua, Northern Conchucos Ancash\0"
+  "Quechua, Southern Conchucos Ancash\0"
+  "Quechua, Puno\0"
+  "Qashqa'i\0"
+  "Quichua, Cañar Highland\0"
+  "Qiang, Southern\0"
+  "Quechua, Santa Ana de Tusi Pasco\0"
+  "Quechua, Arequipa-La Unión\0"
+  "Quechua, Jauja Wanca\0"
+  "Quenya\0"
+  "Quiripi\0"
+  "Dungmali\0"
+  "Camling\0"
+  "Rasawa\0"
+  "Rade\0"
+  "Meohang, Western\0"
+  "Logooli\0"
+  "Rabha\0"
+  "Ramoaaina\0"
+  "Rajasthani\0"
+  "Tulu-Bohuai\0"
+  "Ralte\0"
+  "Canela\0"
+  "Riantana\0"
+  "Rao\0"
+  "Rapanui\0"
+  "Saam\0"
+  "Rarotongan\0"
+  "Tegali\0"
+  "Razajerdi\0"
+  "Raute\0"
+  "Sampang\0"
+  "Rawang\0"
+  "Rang\0"
+  "Rapa\0"
+  "Rahambuu\0"
+  "Palaung, Rumai\0"
+  "Bontok, Northern\0"
+  "Bikol, Miraya\0"
+  "Barababaraba\0"
+  "Creole French, Réunion\0"
+  "Rudbari\0"
+  "Rerau\0"
+  "Rembong\0"
+  "Kayan, Rejang\0"
+  "Kara (Tanzania)\0"
+  "Reli\0"
+  "Rejang\0"
+  "Rendille\0"
+  "Remo\0"
+  "Rengao\0"
+  "Rer Bare\0"
+  "Reshe\0"
+  "Retta\0"
+  "Reyesano\0"
+  "Roria\0"
+  "Romano-Greek\0"
+  "Rangkas\0"
+  "Romagnol\0"
+  "Resígaro\0"
+  "Roglai, Southern\0"
+  "Ringgou\0"
+  "Rohingya\0"
+  "Yahang\0"
+  "Riang (India)\0"
+  "Bribri Sign Language\0"
+  "Tarifit\0"
+  "Riang Lang\0"
+  "Nyaturu\0"
+  "Nungu\0"
+  "Ribun\0"
+  "Ritharrngu\0"
+  "Riung\0"
+  "Rajong\0"
+  "Raji\0"
+  "Rajbanshi\0"
+  "Kraol\0"
+  "Rikbaktsa\0"
+  "Rakahanga-Manihiki\0"
+  "Rakhine\0"
+  "Marka\0"
+  "Rangpuri\0"
+  "Arakwal\0"
+  "Romansh\0"
+  "Rama\0"
+  "Rembarrnga\0"
+  "Romani, Carpathian\0"
+  "Danish, Traveller\0"
+  "Angloromani\0"
+  "Romani, Kalo Finnish\0"
+  "Norwegian, Traveller\0"
+  "Murkim\0"
+  "Lomavren\0"
+  "Romkun\0"
+  "Romani, Baltic\0"
+  "Roma\0"
+  "Romani, Balkan\0"
+  "Romani, Sinte\0"
+  "Rempi\0"
+  "Caló\0"
+  "Romanian Sign Language\0"
+  "Domari\0"
+  "Romani, Tavringer\0"
+  "Romanova\0"
+  "Romani, Welsh\0"
+  "Romam\0"
+  "Romani, Vlax\0"
+  "Marma\0"
+  "Rundi\0"
+  "Brunca Sign Language\0"
+  "Ruund\0"
+  "Ronga\0"
+  "Ranglong\0"
+  "Roon\0"
+  "Rongpo\0"
+  "Nari Nari\0"
+  "Rungwa\0"
+  "Romanian; Moldavian; Moldovan\0"
+  "Romance languages\0"
+  "Tae'\0"
+  "Roglai, Cacgia\0"
+  "Rogo\0"
+  "Ronji\0"
+  "Rombo\0"
+  "Roglai, Northern\0"
+  "Romblomanon\0"
+  "Romany\0"
+  "Romanian\0"
+  "Rotokas\0"
+  "Kriol\0"
+  "Rongga\0"
+  "Runga\0"
+  "Dela-Oenale\0"
+  "Repanbitip\0"
+  "Rapting\0"
+  "Ririo\0"
+  "Waima\0"
+  "Arritinngithigh\0"
+  "Romano-Serbian\0"
+  "Ruthenian\0"
+  "Russian Sign Language\0"
+  "Miriwoong Sign Language\0"
+  "Rwandan Sign Language\0"
+  "Chin, Rungtu\0"
+  "Ratahan\0"
+  "Rotuman\0"
+  "Yurats\0"
+  "Rathawi\0"
+  "Russian\0"
+  "Gungu\0"
+  "Ruuli\0"
+  "Rusyn\0"
+  "Luguru\0"
+  "Roviana\0"
+  "Ruga\0"
+  "Rufiji\0"
+  "Che\0"
+  "Romanian, Istro\0"
+  "Romanian, Macedo-\0"
+  "Romanian, Megleno\0"
+  "Rutul\0"
+  "Lobu, Lanas\0"
+  "Mala (Nigeria)\0"
+  "Ruma\0"
+  "Rawo\0"
+  "Rwa\0"
+  "Ruwila\0"
+  "Amba (Uganda)\0"
+  "Rawa\0"
+  "Marwari (India)\0"
+  "Ngardi\0"
+  "Karuwali\0"
+  "Amami-Oshima, Northern\0"
+  "Yaeyama\0"
+  "Okinawan, Central\0"
+  "Rāziḥī\0"
+  "Sanskrit\0"
+  "Saba\0"
+  "Buglere\0"
+  "Meskwaki\0"
+  "Sandawe\0"
+  "Sabanê\0"
+  "Safaliba\0"
+  "Sango\0"
+  "Yakut\0"
+  "South American Indian (Other)\0"
+  "Sahu\0"
+  "Sake\0"
+  "Salishan languages\0"
+  "Aramaic, Samaritan\0"
+  "Sause\0"
+  "Samburu\0"
+  "Saraveca\0"
+  "Sasak\0"
+  "Santali\0"
+  "Saleman\0"
+  "Saafi-Saafi\0"
+  "Sawi\0"
+  "Sa\0"
+  "Saya\0"
+  "Saurashtra\0"
+  "Ngambay\0"
+  "Simbo\0"
+  "Kele (Papua New Guinea)\0"
+  "Samo, Southern\0"
+  "Saliba\0"
+  "Chabu\0"
+  "Seget\0"
+  "Sori-Harengan\0"
+  "Seti\0"
+  "Surbakhal\0"
+  "Safwa\0"
+  "Sambal, Botolan\0"
+  "Sagala\0"
+  "Bhil, Sindhi\0"
+  "Sabüm\0"
+  "Sangu (Tanzania)\0"
+  "Sileibi\0"
+  "Sembakung Murut\0"
+  "Subiya\0"
+  "Kimki\0"
+  "Bhoti, Stod\0"
+  "Sabine\0"
+  "Simba\0"
+  "Seberuang\0"
+  "Soli\0"
+  "Sara Kaba\0"
+  "Sardinian\0"
+  "Chut\0"
+  "Dongxiang\0"
+  "Creole French, San Miguel\0"
+  "Sanggau\0"
+  "Sakachep\0"
+  "Creole Malay, Sri Lankan\0"
+  "Sadri\0"
+  "Shina\0"
+  "Sicilian\0"
+  "Scots\0"
+  "Hyolmo\0"
+  "Sa'och\0"
+  "Slavey, North\0"
+  "Katang, Southern\0"
+  "Shumcho\0"
+  "Sheni\0"
+  "Sha\0"
+  "Sicel\0"
+  "Sindhi\0"
+  "Toraja-Sa'dan\0"
+  "Shabak\0"
+  "Sardinian, Sassarese\0"
+  "Surubu\0"
+  "Sarli\0"
+  "Savi\0"
+  "Kurdish, Southern\0"
+  "Suundi\0"
+  "Sos Kundi\0"
+  "Saudi Arabian Sign Language\0"
+  "Sardinian, Gallurese\0"
+  "Bidayuh, Bukar-Sadung\0"
+  "Sherdukpen\0"
+  "Semandang\0"
+  "Sadri, Oraon\0"
+  "Sened\0"
+  "Shuadit\0"
+  "Sarudu\0"
+  "Melanau, Sibu\0"
+  "Sallands\0"
+  "Northern Sami\0"
+  "Semai\0"
+  "Senoufo, Shempire\0"
+  "Sechelt\0"
+  "Sedang\0"
+  "Seneca\0"
+  "Senoufo, Cebaara\0"
+  "Segeju\0"
+  "Sena\0"
+  "Seri\0"
+  "Sene\0"
+  "Sekani\0"
+  "Selkup\0"
+  "Semitic languages\0"
+  "Sénoufo, Nanerigé\0"
+  "Suarmin\0"
+  "Sénoufo, Sìcìté\0"
+  "Sénoufo, Senara\0"
+  "Serrano\0"
+  "Songhai, Koyraboro Senni\0"
+  "Sentani\0"
+  "Serui-Laut\0"
+  "Senoufo, Nyarafolo\0"
+  "Sewa Bay\0"
+  "Secoya\0"
+  "Chin, Senthang\0"
+  "Langue des signes de Belgique Francophone\0"
+  "Subanen, Eastern\0"
+  "Miao, Small Flowery\0"
+  "South African Sign Language\0"
+  "Sehwi\0"
+  "Irish, Old (to 900)\0"
+  "Ayta, Mag-antsi\0"
+  "Kipsigis\0"
+  "Surigaonon\0"
+  "Segai\0"
+  "Swiss-German Sign Language\0"
+  "Shughni\0"
+  "Suga\0"
+  "Surgujia\0"
+  "Sangkong\0"
+  "Singa\0"
+  "Sign Languages\0"
+  "Singpho\0"
+  "Sangisari\0"
+  "Samogitian\0"
+  "Brokpake\0"
+  "Salas\0"
+  "Sebat Bet Gurage\0"
+  "Sierra Leone Sign Language\0"
+  "Sanglechi\0"
+  "Sursurunga\0"
+  "Shall-Zwall\0"
+  "Ninam\0"
+  "Sonde\0"
+  "Kundal Shahi\0"
+  "Sheko\0"
+  "Shua\0"
+  "Shoshoni\0"
+  "Tachelhit\0"
+  "Shatt\0"
+  "Shilluk\0"
+  "Shendu\0"
+  "Shahrudi\0"
+  "Shan\0"
+  "Shanga\0"
+  "Shipibo-Conibo\0"
+  "Sala\0"
+  "Shi\0"
+  "Shuswap\0"
+  "Shasta\0"
+  "Arabic, Chadian\0"
+  "Shehri\0"
+  "Shwai\0"
+  "She\0"
+  "Tachawit\0"
+  "Senoufo, Syenara\0"
+  "Sinhala; Sinhalese\0"
+  "Sami, Akkala\0"
+  "Sebop\0"
+  "Sidamo\0"
+  "Simaa\0"
+  "Siamou\0"
+  "Paasaal\0"
+  "Zire\0"
+  "Shom Peng\0"
+  "Numbami\0"
+  "Sikiana\0"
+  "Sisaala, Tumulung\0"
+  "Mende (Papua New Guinea)\0"
+  "Sinhala\0"
+  "Siouan languages\0"
+  "Sikkimese\0"
+  "Sonia\0"
+  "Siri\0"
+  "Siuslaw\0"
+  "Sino-Tibetan languages\0"
+  "Sinagen\0"
+  "Sumariup\0"
+  "Siwai\0"
+  "Sumau\0"
+  "Sivandi\0"
+  "Siwi\0"
+  "Epena\0"
+  "Sajau Basap\0"
+  "Sami, Kildin\0"
+  "Sami, Pite\0"
+  "Assangori\0"
+  "Sami, Kemi\0"
+  "Sajalong\0"
+  "Mapun\0"
+  "Sindarin\0"
+  "Xibe\0"
+  "Surjapuri\0"
+  "Siar-Lak\0"
+  "Senhaja De Srair\0"
+  "Sami, Ter\0"
+  "Sami, Ume\0"
+  "Shawnee\0"
+  "Slovak\0"
+  "Skagit\0"
+  "Saek\0"
+  "Ma Manda\0"
+  "Miwok, Southern Sierra\0"
+  "Seke (Vanuatu)\0"
+  "Sakirabiá\0"
+  "Malagasy, Sakalava\0"
+  "Sikule\0"
+  "Sika\0"
+  "Seke (Nepal)\0"
+  "Kutong\0"
+  "Subanon, Kolibugan\0"
+  "Seko Tengah\0"
+  "Sekapan\0"
+  "Sininkere\0"
+  "Saraiki\0"
+  "Maia\0"
+  "Sakata\0"
+  "Sakao\0"
+  "Skou\0"
+  "Creole Dutch, Skepi\0"
+  "Seko Padang\0"
+  "Sikaiana\0"
+  "Sekar\0"
+  "Slovenian\0"
+  "Slavic languages\0"
+  "Sáliba\0"
+  "Sissala\0"
+  "Sholaga\0"
+  "Swiss-Italian Sign Language\0"
+  "Selungai Murut\0"
+  "Salish, Southern Puget Sound\0"
+  "Silesian, Lower\0"
+  "Salumá\0"
+  "Salt-Yui\0"
+  "Sama, Pangutaran\0"
+  "Salinan\0"
+  "Lamaholot\0"
+  "Salchuq\0"
+  "Salar\0"
+  "Singapore Sign Language\0"
+  "Sila\0"
+  "Selaru\0"
+  "Sialum\0"
+  "Salampasu\0"
+  "Selayar\0"
+  "Ma'ya\0"
+  "Samoan\0"
+  "Sami, Southern\0"
+  "Simbari\0"
+  "Som\0"
+  "Sami, Northern\0"
+  "Auwe\0"
+  "Simbali\0"
+  "Samei\0"
+  "Sami languages\0"
+  "Lule Sami\0"
+  "Bolinao\0"
+  "Sama, Central\0"
+  "Musasa\0"
+  "Sami, Inari\0"
+  "Samaritan\0"
+  "Samo\0"
+  "Simeulue\0"
+  "Sami, Skolt\0"
+  "Simte\0"
+  "Somray\0"
+  "Samvedi\0"
+  "Sumbawa\0"
+  "Samba\0"
+  "Semnani\0"
+  "Simeku\0"
+  "Shona\0"
+  "Sinaugoro\0"
+  "Bidayuh, Bau\0"
+  "Noon\0"
+  "Sanga (Democratic Republic of Congo)\0"
+  "Sensi\0"
+  "Sango, Riverain\0"
+  "Soninke\0"
+  "Sangil\0"
+  "Ma'di, Southern\0"
+  "Siona\0"
+  "Snohomish\0"
+  "Siane\0"
+  "Sangu (Gabon)\0"
+  "Sihan\0"
+  "South West Bay\0"
+  "Senggi\0"
+  "Sa'ban\0"
+  "Selee\0"
+  "Sam\0"
+  "Saniyo-Hiyewe\0"
+  "Kou\0"
+  "Somali\0"
+  "Thai Song\0"
+  "Sobei\0"
+  "So (Democratic Republic of Congo)\0"
+  "Songoora\0"
+  "Songomeno\0"
+  "Sogdian\0"
+  "Aka\0"
+  "Sonha\0"
+  "Soi\0"
+  "Sokoro\0"
+  "Solos\0"
+  "Songhai languages\0"
+  "Songo\0"
+  "Songe\0"
+  "Kanasi\0"
+  "Somrai\0"
+  "Seeku\0"
+  "Sotho, Southern\0"
+  "Thai, Southern\0"
+  "Sonsorol\0"
+  "Sowanda\0"
+  "Swo\0"
+  "Miyobe\0"
+  "Temi\0"
+  "Spanish\0"
+  "Sepa (Indonesia)\0"
+  "Sapé\0"
+  "Saep\0"
+  "Sepa (Papua New Guinea)\0"
+  "Sian\0"
+  "Saponi\0"
+  "Sengo\0"
+  "Selepet\0"
+  "Akukem\0"
+  "Sanapaná\0"
+  "Spokane\0"
+  "Senoufo, Supyire\0"
+  "Spanish, Loreto-Ucayali\0"
+  "Saparua\0"
+  "Saposa\0"
+  "Bhoti, Spiti\0"
+  "Sapuan\0"
+  "Sambalpuri\0"
+  "Picene, South\0"
+  "Sabaot\0"
+  "Shama-Sambuga\0"
+  "Shau\0"
+  "Albanian Sign Language\0"
+  "Suma\0"
+  "Susquehannock\0"
+  "Sorkhei\0"
+  "Sou\0"
+  "Arabic, Siculo\0"
+  "Sri Lankan Sign Language\0"
+  "Soqotri\0"
+  "Squamish\0"
+  "Kufr Qassem Sign Language (KQSL)\0"
+  "Serbian\0"
+  "Saruga\0"
+  "Sora\0"
+  "Sardinian, Logudorese\0"
+  "Sara\0"
+  "Nafi\0"
+  "Sulod\0"
+  "Sarikoli\0"
+  "Siriano\0"
+  "Serudung Murut\0"
+  "Isirawa\0"
+  "Saramaccan\0"
+  "Sranan Tongo\0"
+  "Sardinian, Campidanese\0"
+  "Sirionó\0"
+  "Serer\0"
+  "Sarsi\0"
+  "Sauri\0"
+  "Suruí\0"
+  "Sorsoganon, Southern\0"
+  "Serua\0"
+  "Sirmauri\0"
+  "Sera\0"
+  "Shahmirzadi\0"
+  "Swati\0"
+  "Nilo-Saharan languages\0"
+  "Sama, Southern\0"
+  "Suba-Simbiti\0"
+  "Siroi\0"
+  "Balangingi\0"
+  "Thao\0"
+  "Seimat\0"
+  "Arabic, Shihhi\0"
+  "Sansi\0"
+  "Sausi\0"
+  "Sunam\0"
+  "Sisaala, Western\0"
+  "Semnam\0"
+  "Waata\0"
+  "Sissano\0"
+  "Spanish Sign Language\0"
+  "So'a\0"
+  "Swiss-French Sign Language\0"
+  "Sô\0"
+  "Sinasina\0"
+  "Susuami\0"
+  "Shark Bay\0"
+  "Samberigi\0"
+  "Saho\0"
+  "Sengseng\0"
+  "Settla\0"
+  "Subanen, Northern\0"
+  "Sentinel\0"
+  "Liana-Seti\0"
+  "Seta\0"
+  "Trieng\0"
+  "Shelta\0"
+  "Stieng, Bulo\0"
+  "Samo, Matya\0"
+  "Arammba\0"
+  "Stellingwerfs\0"
+  "Setaman\0"
+  "Owa\0"
+  "Stoney\0"
+  "Tepehuan, Southeastern\0"
+  "Saterfriesisch\0"
+  "Salish, Straits\0"
+  "Shumashti\0"
+  "Stieng, Budeh\0"
+  "Samtao\0"
+  "Silt'e\0"
+  "Satawalese\0"
+  "Tatar, Siberian\0"
+  "Sundanese\0"
+  "Sulka\0"
+  "Suku\0"
+  "Subanon, Western\0"
+  "Suena\0"
+  "Suganga\0"
+  "Suki\0"
+  "Shubi\0"
+  "Sukuma\0"
+  "Bouni\0"
+  "Suri, Tirmaga-Chai\0"
+  "Mwaghavul\0"
+  "Susu\0"
+  "Subtiaba\0"
+  "Puroik\0"
+  "Sumbwa\0"
+  "Sumerian\0"
+  "Suyá\0"
+  "Sunwar\0"
+  "Swedish\0"
+  "Svan\0"
+  "Ulau-Suain\0"
+  "Creole English, Vincentian\0"
+  "Serili\0"
+  "Slovakian Sign Language\0"
+  "Slavomolisano\0"
+  "Savosavo\0"
+  "Skalvian\0"
+  "Swahili\0"
+  "Swahili (macrolanguage)\0"
+  "Comorian, Maore\0"
+  "Swahili, Congo\0"
+  "Sere\0"
+  "Swabian\0"
+  "Swahili (individual language)\0"
+  "Sui\0"
+  "Sira\0"
+  "Sena, Malawi\0"
+  "Swedish Sign Language\0"
+  "Samosa\0"
+  "Sawknah\0"
+  "Shanenawa\0"
+  "Suau\0"
+  "Sharwa\0"
+  "Saweru\0"
+  "Seluwasan\0"
+  "Sawila\0"
+  "Suwawa\0"
+  "Shekhawati\0"
+  "Sowa\0"
+  "Suruahá\0"
+  "Sarua\0"
+  "Suba\0"
+  "Sicanian\0"
+  "Sighu\0"
+  "Shuhi\0"
+  "Kalapuya, Southern\0"
+  "Selian\0"
+  "Samre\0"
+  "Sangir\0"
+  "Sorothaptic\0"
+  "Saaroa\0"
+  "Sasaru\0"
+  "Saxon, Upper\0"
+  "Gbe, Saxwe\0"
+  "Siang\0"
+  "Subanen, Central\0";
+
+static const char language_names_2[] =
+  "Syriac, Classical\0"
+  "Seki\0"
+  "Sukur\0"
+  "Sylheti\0"
+  "Samo, Maya\0"
+  "Senaya\0"
+  "Suoy\0"
+  "Syriac\0"
+  "Sinyar\0"
+  "Kagate\0"
+  "Samay\0"
+  "Al-Sayyid Bedouin Sign Language\0"
+  "Semelai\0"
+  "Ngalum\0"
+  "Semaq Beri\0"
+  "Seru\0"
+  "Seze\0"
+  "Sengele\0"
+  "Silesian\0"
+  "Sula\0"
+  "Suabo\0"
+  "Solomon Islands Sign Language\0"
+  "Isu (Fako Division)\0"
+  "Sawai\0"
+  "Sakizaya\0"
+  "Tamil\0"
+  "Tanana, Lower\0"
+  "Tabassaran\0"
+  "Tarahumara, Lowland\0"
+  "Tause\0"
+  "Tariana\0"
+  "Tapirapé\0"
+  "Tagoi\0"
+  "Tahitian\0"
+  "Tai languages\0"
+  "Tamang, Eastern\0"
+  "Tala\0"
+  "Tal\0"
+  "Tangale\0"
+  "Yami\0"
+  "Taabwa\0"
+  "Tamasheq\0"
+  "Tarahumara, Central\0"
+  "Tay Boi\0"
+  "Tatar\0"
+  "Tanana, Upper\0"
+  "Tatuyo\0"
+  "Tai\0"
+  "Tamki\0"
+  "Atayal\0"
+  "Tocho\0"
+  "Aikanã\0"
+  "Takia\0"
+  "Kaki Ae\0"
+  "Tanimbili\0"
+  "Mandara\0"
+  "Tairora, North\0"
+  "Dharawal\0"
+  "Gaam\0"
+  "Tiang\0"
+  "Tagbanwa, Calamian\0"
+  "Tboli\0"
+  "Tagbu\0"
+  "Tunebo, Barro Negro\0"
+  "Tawala\0"
+  "Taworta\0"
+  "Tumtum\0"
+  "Tanguat\0"
+  "Tembo (Kitembo)\0"
+  "Tubar\0"
+  "Tobo\0"
+  "Tagbanwa\0"
+  "Kapin\0"
+  "Tabaru\0"
+  "Ditammari\0"
+  "Ticuna\0"
+  "Tanacross\0"
+  "Datooga\0"
+  "Tafi\0"
+  "Tutchone, Southern\0"
+  "Me'phaa, Malinaltepec\0"
+  "Tamagario\0"
+  "Creole English, Turks And Caicos\0"
+  "Wára\0"
+  "Tchitchege\0"
+  "Taman (Myanmar)\0"
+  "Tanahmerah\0"
+  "Tichurong\0"
+  "Taungyo\0"
+  "Chin, Tawr\0"
+  "Kaiy\0"
+  "Creole, Torres Strait\0"
+  "T'en\0"
+  "Tarahumara, Southeastern\0"
+  "Totonac, Tecpatlán\0"
+  "Toda\0"
+  "Tulu\0"
+  "Chin, Thado\0"
+  "Tagdal\0"
+  "Panchpargania\0"
+  "Emberá-Tadó\0"
+  "Tai Nüa\0"
+  "Dogon, Tiranige Diga\0"
+  "Talieng\0"
+  "Tamang, Western\0"
+  "Thulung\0"
+  "Tomadino\0"
+  "Tajio\0"
+  "Tambas\0"
+  "Sur\0"
+  "Taruma\0"
+  "Tondano\0"
+  "Teme\0"
+  "Tita\0"
+  "Todrah\0"
+  "Doutai\0"
+  "Tetun Dili\0"
+  "Toro\0"
+  "Malagasy, Tandroy-Mahafaly\0"
+  "Tadyawan\0"
+  "Telugu\0"
+  "Temiar\0"
+  "Tetete\0"
+  "Terik\0"
+  "Krumen, Tepo\0"
+  "Tepehua, Huehuetla\0"
+  "Teressa\0"
+  "Teke-Tege\0"
+  "Tehuelche\0"
+  "Torricelli\0"
+  "Teke, Ibali\0"
+  "Timne\0"
+  "Tama (Colombia)\0"
+  "Teso\0"
+  "Tepecano\0"
+  "Temein\0"
+  "Tereno\0"
+  "Tengger\0"
+  "Tetum\0"
+  "Soo\0"
+  "Teor\0"
+  "Tewa (USA)\0"
+  "Tennet\0"
+  "Tulishi\0"
+  "Tetserret\0"
+  "Gbe, Tofin\0"
+  "Tanaina\0"
+  "Tefaro\0"
+  "Teribe\0"
+  "Ternate\0"
+  "Tajik\0"
+  "Sagalla\0"
+  "Tobilung\0"
+  "Tigak\0"
+  "Ciwogai\0"
+  "Tamang, Eastern Gorkha\0"
+  "Chalikha\0"
+  "Creole English, Tobagonian\0"
+  "Lawunuia\0"
+  "Tagin\0"
+  "Tagalog\0"
+  "Tandaganon\0"
+  "Sudest\0"
+  "Tangoa\0"
+  "Tring\0"
+  "Tareng\0"
+  "Nume\0"
+  "Tagbanwa, Central\0"
+  "Tanggu\0"
+  "Tingui-Boto\0"
+  "Senoufo, Tagwana\0"
+  "Tagish\0"
+  "Togoyo\0"
+  "Tagalaka\0"
+  "Thai\0"
+  "Kuuk Thaayorre\0"
+  "Tharu, Chitwania\0"
+  "Thangmi\0"
+  "Tarahumara, Northern\0"
+  "Tai Long\0"
+  "Tharaka\0"
+  "Tharu, Dangaura\0"
+  "Aheu\0"
+  "Thachanadan\0"
+  "Thompson\0"
+  "Tharu, Kochila\0"
+  "Tharu, Rana\0"
+  "Thakali\0"
+  "Tahltan\0"
+  "Thuri\0"
+  "Tamahaq, Tahaggart\0"
+  "Tha\0"
+  "Tamajeq, Tayart\0"
+  "Tigrinya\0"
+  "Tamazight, Tidikelt\0"
+  "Tira\0"
+  "Tifal\0"
+  "Tigre\0"
+  "Murut, Timugon\0"
+  "Tiene\0"
+  "Tilung\0"
+  "Tikar\0"
+  "Tillamook\0"
+  "Timbe\0"
+  "Tindi\0"
+  "Teop\0"
+  "Trimuris\0"
+  "Tiéfo\0"
+  "Itneg, Masadiit\0"
+  "Tinigua\0"
+  "Adasen\0"
+  "Tiv\0"
+  "Tiwi\0"
+  "Tiwa, Southern\0"
+  "Tiruray\0"
+  "Tai Hongjin\0"
+  "Tajuasohn\0"
+  "Tunjung\0"
+  "Tujia, Northern\0"
+  "Tjungundji\0"
+  "Tai Laing\0"
+  "Timucua\0"
+  "Tonjon\0"
+  "Tamazight, Temacine\0"
+  "Tjupany\0"
+  "Tujia, Southern\0"
+  "Tjurruru\0"
+  "Djabwurrung\0"
+  "Turkmen\0"
+  "Truká\0"
+  "Buksa\0"
+  "Tukudede\0"
+  "Takwane\0"
+  "Tukumanféd\0"
+  "Malagasy, Tesaka\0"
+  "Tokelau\0"
+  "Takelma\0"
+  "Toku-No-Shima\0"
+  "Tikopia\0"
+  "Tee\0"
+  "Tsakhur\0"
+  "Takestani\0"
+  "Tharu, Kathoriya\0"
+  "Totonac, Upper Necaxa\0"
+  "Mur Pano\0"
+  "Teanu\0"
+  "Tangko\0"
+  "Takua\0"
+  "Tepehuan, Southwestern\0"
+  "Tobelo\0"
+  "Totonac, Yecuatla\0"
+  "Talaud\0"
+  "Telefol\0"
+  "Tofanma\0"
+  "Klingon\0"
+  "Tlingit\0"
+  "Talinga-Bwisi\0"
+  "Taloki\0"
+  "Tetela\0"
+  "Tolomako\0"
+  "Talondo'\0"
+  "Talodi\0"
+  "Totonac, Filomena Mata-Coahuitlán\0"
+  "Tai Loi\0"
+  "Talise\0"
+  "Tambotalo\0"
+  "Sou Nama\0"
+  "Tulehu\0"
+  "Taliabu\0"
+  "Khehek\0"
+  "Talysh\0"
+  "Tama (Chad)\0"
+  "Katbol\0"
+  "Tumak\0"
+  "Haruai\0"
+  "Tremembé\0"
+  "Toba-Maskoy\0"
+  "Ternateño\0"
+  "Tamashek\0"
+  "Tutuba\0"
+  "Samarokena\0"
+  "Tamang, Northwestern\0"
+  "Citak, Tamnim\0"
+  "Tai Thanh\0"
+  "Taman (Indonesia)\0"
+  "Temoq\0"
+  "Tumleo\0"
+  "Aramaic, Jewish Babylonian (ca. 200-1200 CE)\0"
+  "Tima\0"
+  "Tasmate\0"
+  "Iau\0"
+  "Tembo (Motembo)\0"
+  "Temuan\0"
+  "Tami\0"
+  "Tamanaku\0"
+  "Tswana\0"
+  "Tacana\0"
+  "Tunebo, Western\0"
+  "Tanimuca-Retuarã\0"
+  "Tunebo, Angosturas\0"
+  "Tobanga\0"
+  "Maiani\0"
+  "Tandia\0"
+  "Kwamera\0"
+  "Lenakel\0"
+  "Tabla\0"
+  "Tanna, North\0"
+  "Toromono\0"
+  "Whitesands\0"
+  "Taino\0"
+  "Ménik\0"
+  "Tenis\0"
+  "Tontemboan\0"
+  "Tay Khang\0"
+  "Tangchangya\0"
+  "Tonsawang\0"
+  "Tanema\0"
+  "Tongwe\0"
+  "Ten'edn\0"
+  "Tonga (Tonga Islands)\0"
+  "Toba\0"
+  "Totonac, Coyutla\0"
+  "Toma\0"
+  "Gizrra\0"
+  "Tonga (Nyasa)\0"
+  "Gitonga\0"
+  "Tonga (Zambia)\0"
+  "Tojolabal\0"
+  "Toki Pona\0"
+  "Tolowa\0"
+  "Tombulu\0"
+  "Totonac, Xicotepec De Juárez\0"
+  "Totonac, Papantla\0"
+  "Toposa\0"
+  "Banda, Togbo-Vara\0"
+  "Totonac, Highland\0"
+  "Tho\0"
+  "Taromi, Upper\0"
+  "Jemez\0"
+  "Tobian\0"
+  "Topoiyo\0"
+  "To\0"
+  "Taupota\0"
+  "Me'phaa, Azoyú\0"
+  "Tippera\0"
+  "Tarpia\0"
+  "Kula\0"
+  "Tok Pisin\0"
+  "Tapieté\0"
+  "Tupinikin\0"
+  "Me'phaa, Tlacoapa\0"
+  "Tampulma\0"
+  "Tupinambá\0"
+  "Tai Pao\0"
+  "Tepehua, Pisaflores\0"
+  "Tukpa\0"
+  "Tuparí\0"
+  "Tepehua, Tlachichilco\0"
+  "Tampuan\0"
+  "Tanapag\0"
+  "Tupí\0"
+  "Me'phaa, Acatepec\0"
+  "Trumai\0"
+  "Tinputz\0"
+  "Tembé\0"
+  "Lehali\0"
+  "Turumsa\0"
+  "Tenino\0"
+  "Toaripi\0"
+  "Tomoip\0"
+  "Tunni\0"
+  "Torona\0"
+  "Totonac, Western\0"
+  "Touo\0"
+  "Tonkawa\0"
+  "Turkish\0"
+  "Tirahi\0"
+  "Terebu\0"
+  "Triqui, Copala\0"
+  "Turi\0"
+  "Tarangan, East\0"
+  "Creole English, Trinidadian\0"
+  "Lishán Didán\0"
+  "Turaka\0"
+  "Trió\0"
+  "Toram\0"
+  "Scottish, Traveller\0"
+  "Tregami\0"
+  "Trinitario\0"
+  "Naga, Tarao\0"
+  "Kok Borok\0"
+  "Triqui, San Martín Itunyoso\0"
+  "Taushiro\0"
+  "Triqui, Chicahuaxtla\0"
+  "Tunggare\0"
+  "Turoyo\0"
+  "Sediq\0"
+  "Torwali\0"
+  "Bidayuh, Tringgus-Sembaan\0"
+  "Turung\0"
+  "Torá\0"
+  "Tsonga\0"
+  "Tsaangi\0"
+  "Tsamai\0"
+  "Tswa\0"
+  "Tsakonian\0"
+  "Tunisian Sign Language\0"
+  "Tausug\0"
+  "Tsuvan\0"
+  "Tsimshian\0"
+  "Tshangla\0"
+  "Tseku\0"
+  "Ts'ün-Lao\0"
+  "Turkish Sign Language\0"
+  "Toussian, Northern\0"
+  "Thai Sign Language\0"
+  "Akei\0"
+  "Taiwan Sign Language\0"
+  "Songway Kiini, Tondi\0"
+  "Tsou\0"
+  "Tsogo\0"
+  "Tsishingini\0"
+  "Mubami\0"
+  "Tebul Sign Language\0"
+  "Purepecha\0"
+  "Tutelo\0"
+  "Gaa\0"
+  "Tektiteko\0"
+  "Tauade\0"
+  "Bwanabwana\0"
+  "Tuotomb\0"
+  "Tutong\0"
+  "Ta'oih, Upper\0"
+  "Tobati\0"
+  "Tooro\0"
+  "Totoro\0"
+  "Totela\0"
+  "Tutchone, Northern\0"
+  "Towei\0"
+  "Ta'oih, Lower\0"
+  "Tombelala\0"
+  "Tamajaq, Tawallammat\0"
+  "Tera\0"
+  "Thai, Northeastern\0"
+  "Tat, Muslim\0"
+  "Torau\0"
+  "Titan\0"
+  "Long Wat\0"
+  "Sikaritai\0"
+  "Tsum\0"
+  "Wiarumus\0"
+  "Tübatulabal\0"
+  "Mutu\0"
+  "Tuxá\0"
+  "Tuyuca\0"
+  "Tunebo, Central\0"
+  "Tunia\0"
+  "Taulil\0"
+  "Tupuri\0"
+  "Tugutil\0"
+  "Tula\0"
+  "Tumbuka\0"
+  "Tunica\0"
+  "Tucano\0"
+  "Tupi languages\0"
+  "Tedaga\0"
+  "Tuscarora\0"
+  "Altaic languages\0"
+  "Tututni\0"
+  "Turkana\0"
+  "Tuxináwa\0"
+  "Tugen\0"
+  "Turka\0"
+  "Vaghua\0"
+  "Tsuvadi\0"
+  "Te'un\0"
+  "Ambrym, Southeast\0"
+  "Tuvalu\0"
+  "Tela-Masbuar\0"
+  "Tavoyan\0"
+  "Tidore\0"
+  "Taveta\0"
+  "Naga, Tutsa\0"
+  "Tunen\0"
+  "Sedoa\0"
+  "Taivoan\0"
+  "Pidgin, Timor\0"
+  "Twi\0"
+  "Twana\0"
+  "Tawbuid, Western\0"
+  "Teshenawa\0"
+  "Twents\0"
+  "Tewa (Indonesia)\0"
+  "Tiwa, Northern\0"
+  "Tereweng\0"
+  "Tai Dón\0"
+  "Tawara\0"
+  "Monpa, Tawang\0"
+  "Twendi\0"
+  "Tswapong\0"
+  "Ere\0"
+  "Tasawaq\0"
+  "Tarahumara, Southwestern\0"
+  "Turiwára\0"
+  "Termanu\0"
+  "Tuwari\0"
+  "Tewe\0"
+  "Tawoyan\0"
+  "Tombonuo\0"
+  "Tokharian B\0"
+  "Tsetsaut\0"
+  "Totoli\0"
+  "Tangut\0"
+  "Thracian\0"
+  "Ikpeng\0"
+  "Tarjumo\0"
+  "Tomini\0"
+  "Tarangan, West\0"
+  "Toto\0"
+  "Tii\0"
+  "Tartessian\0"
+  "Tonsea\0"
+  "Citak\0"
+  "Kayapó\0"
+  "Tatana\0"
+  "Malagasy, Tanosy\0"
+  "Tauya\0"
+  "Kyanga\0"
+  "O'du\0"
+  "Teke-Tsaayi\0"
+  "Tai Do\0"
+  "Thu Lao\0"
+  "Kombai\0"
+  "Thaypan\0"
+  "Tai Daeng\0"
+  "Tày Sa Pa\0"
+  "Tày Tac\0"
+  "Kua\0"
+  "Tuvinian\0"
+  "Teke-Tyee\0"
+  "Tiyaa\0"
+  "Tày\0"
+  "Tanzanian Sign Language\0"
+  "Tzeltal\0"
+  "Tz'utujil\0"
+  "Talossan\0"
+  "Tamazight, Central Atlas\0"
+  "Tugun\0"
+  "Tzotzil\0"
+  "Tabriak\0"
+  "Uamué\0"
+  "Kuan\0"
+  "Tairuma\0"
+  "Ubang\0"
+  "Ubi\0"
+  "Bikol, Buhi'non\0"
+  "Ubir\0"
+  "Umbu-Ungu\0"
+  "Ubykh\0"
+  "Uda\0"
+  "Udihe\0"
+  "Muduga\0"
+  "Udi\0"
+  "Ujir\0"
+  "Wuzlam\0"
+  "Udmurt\0"
+  "Uduk\0"
+  "Kioko\0"
+  "Ufim\0"
+  "Uighur; Uyghur\0"
+  "Ugaritic\0"
+  "Kuku-Ugbanh\0"
+  "Ughele\0"
+  "Kubachi\0"
+  "Ugandan Sign Language\0"
+  "Ugong\0"
+  "Uruguayan Sign Language\0"
+  "Uhami\0"
+  "Damal\0"
+  "Uighur\0"
+  "Uisai\0"
+  "Iyive\0"
+  "Tanjijili\0"
+  "Ukrainian\0"
+  "Kaburi\0"
+  "Ukuriguma\0"
+  "Ukhwejo\0"
+  "Kui (India)\0"
+  "Muak Sa-aak\0"
+  "Ukrainian Sign Language\0"
+  "Ukpe-Bayobiri\0"
+  "Ukwa\0"
+  "Urubú-Kaapor Sign Language\0"
+  "Ukue\0"
+  "Kuku\0"
+  "Ukwuani-Aboh-Ndoni\0"
+  "Kuuk-Yak\0"
+  "Fungwa\0"
+  "Ulukwumi\0"
+  "Ulch\0"
+  "Lule\0"
+  "Usku\0"
+  "Ulithian\0"
+  "Meriam Mir\0"
+  "Ullatan\0"
+  "Ulumanda'\0"
+  "Unserdeutsch\0"
+  "Uma' Lung\0"
+  "Ulwa\0"
+  "Umatilla\0"
+  "Umbundu\0"
+  "Marrucinian\0"
+  "Umbindhamu\0"
+  "Morrobalama\0"
+  "Ukit\0"
+  "Umon\0"
+  "Naga, Makyan\0"
+  "Umotína\0"
+  "Umpila\0"
+  "Umbugarla\0"
+  "Pendau\0"
+  "Munsee\0"
+  "Watut, North\0"
+  "Undetermined\0"
+  "Uneme\0"
+  "Ngarinyin\0"
+  "Uni\0"
+  "Enawené-Nawé\0"
+  "Unami\0"
+  "Kurnai\0"
+  "Mundari\0"
+  "Unubahe\0"
+  "Munda\0"
+  "Kaili, Unde\0"
+  "Kulon\0"
+  "Umeda\0"
+  "Uripiv-Wala-Rano-Atchin\0"
+  "Urdu\0"
+  "Urarina\0"
+  "Urubú-Kaapor\0"
+  "Urningangg\0"
+  "Uru\0"
+  "Uradhi\0"
+  "Urigina\0"
+  "Urhobo\0"
+  "Urim\0"
+  "Urak Lawoi'\0"
+  "Urali\0"
+  "Urapmin\0"
+  "Uruangnirin\0"
+  "Ura (Papua New Guinea)\0"
+  "Uru-Pa-In\0"
+  "Lehalurup\0"
+  "Urat\0"
+  "Urumi\0"
+  "Uruava\0"
+  "Sop\0"
+  "Urimo\0"
+  "Orya\0"
+  "Uru-Eu-Wau-Wau\0"
+  "Usarufa\0"
+  "Ushojo\0"
+  "Usui\0"
+  "Usaghade\0"
+  "Uspanteco\0"
+  "us-Saare\0"
+  "Uya\0"
+  "Otank\0"
+  "Ute-Southern Paiute\0"
+  "ut-Hun\0"
+  "Amba (Solomon Islands)\0"
+  "Etulo\0"
+  "Utu\0"
+  "Urum\0"
+  "Ura (Vanuatu)\0"
+  "U\0"
+  "Uvean, West\0"
+  "Uri\0"
+  "Lote\0"
+  "Kuku-Uwanh\0"
+  "Doko-Uyanga\0"
+  "Uzbek\0"
+  "Uzbek, Northern\0"
+  "Uzbek, Southern\0"
+  "Vaagri Booli\0"
+  "Vale\0"
+  "Vafsi\0"
+  "Vagla\0"
+  "Varhadi-Nagpuri\0"
+  "Vai\0"
+  "Sekele\0"
+  "Vehes\0"
+  "Vanimo\0"
+  "Valman\0"
+  "Vao\0"
+  "Vaiphei\0"
+  "Huarijio\0"
+  "Vasavi\0"
+  "Vanuma\0"
+  "Varli\0"
+  "Wayu\0"
+  "Babar, Southeast\0"
+  "Bontok, Southwestern\0"
+  "Venda\0"
+  "Venetian\0"
+  "Veddah\0"
+  "Veluws\0"
+  "Vemgo-Mabas\0"
+  "Ventureño\0"
+  "Veps\0"
+  "Mom Jango\0"
+  "Vaghri\0"
+  "Vlaamse Gebarentaal\0"
+  "Vietnamese\0"
+  "Creole English, Virgin Islands\0"
+  "Vidunda\0"
+  "Vili\0"
+  "Viemo\0"
+  "Vilela\0"
+  "Vinza\0"
+  "Vishavan\0"
+  "Viti\0"
+  "Iduna\0"
+  "Kariyarra\0"
+  "Kujarge\0"
+  "Kaur\0"
+  "Kulisusu\0"
+  "Kamakan\0"
+  "Koro Nulu\0"
+  "Kodeoha\0"
+  "Creole Portuguese, Korlai\0"
+  "Malay, Tenggarong Kutai\0"
+  "Kurrama\0"
+  "Koro Zuba\0"
+  "Valpei\0"
+  "Vlaams\0"
+  "Martuyhunira\0"
+  "Barbaram\0"
+  "Mixtec, Juxtlahuaca\0"
+  "Koraga, Mudu\0"
+  "Masela, East\0"
+  "Mainfränkisch\0"
+  "Lungalunga\0"
+  "Maraghei\0"
+  "Miwa\0"
+  "Mixtec, Ixtayutla\0"
+  "Makhuwa-Shirima\0"
+  "Malgana\0"
+  "Mixtec, Mitlatongo\0"
+  "Mazatec, Soyaltepec\0"
+  "Mixtec, Soyaltepec\0"
+  "Marenje\0"
+  "Moksela\0"
+  "Muluridyi\0"
+  "Maidu, Valley\0"
+  "Makhuwa\0"
+  "Mixtec, Tamazola\0"
+  "Mazatec, Ayautla\0"
+  "Mazatec, Mazatlán\0"
+  "Vano\0"
+  "Vinmavis\0"
+  "Vunapu\0"
+  "Volapük\0"
+  "Voro\0"
+  "Votic\0"
+  "Vera'a\0"
+  "Võro\0"
+  "Varisi\0"
+  "Burmbar\0"
+  "Moldova Sign Language\0"
+  "Venezuelan Sign Language\0"
+  "Valencian Sign Language\0"
+  "Vitou\0"
+  "Vumbu\0"
+  "Vunjo\0"
+  "Vute\0"
+  "Awa (China)\0"
+  "Walloon\0"
+  "Walla Walla\0"
+  "Wab\0"
+  "Wasco-Wishram\0"
+  "Wamesa\0"
+  "Walser\0"
+  "Wakoná\0"
+  "Wa'ema\0"
+  "Watubela\0"
+  "Wares\0"
+  "Waffa\0"
+  "Wakashan languages\0"
+  "Wolaytta\0"
+  "Wampanoag\0"
+  "Wan\0"
+  "Wappo\0"
+  "Wapishana\0"
+  "Wagiman\0"
+  "Waray (Philippines)\0"
+  "Washo\0"
+  "Kaninuwa\0"
+  "Waurá\0"
+  "Waka\0"
+  "Waiwai\0"
+  "Watam\0"
+  "Wayana\0"
+  "Wampur\0"
+  "Warao\0"
+  "Wabo\0"
+  "Waritai\0"
+  "Wara\0"
+  "Wanda\0"
+  "Vwanji\0"
+  "Alagwa\0"
+  "Waigali\0"
+  "Wakhi\0"
+  "Wa\0"
+  "Warlpiri\0"
+  "Waddar\0"
+  "Wagdi\0"
+  "West Bengal Sign Language\0"
+  "Warnman\0"
+  "Wajarri\0"
+  "Woi\0"
+  "Yanomámi\0"
+  "Gbe, Waci\0"
+  "Wandji\0"
+  "Wadaginam\0"
+  "Wadjiginy\0"
+  "Wadikali\0"
+  "Wendat\0"
+  "Wadjigu\0"
+  "Wadjabangayi\0"
+  "Wewaw\0"
+  "Wè Western\0"
+  "Wedau\0"
+  "Wergaia\0"
+  "Weh\0"
+  "Kiunum\0"
+  "Gbe, Weme\0"
+  "Sorbian languages\0"
+  "Wemale\0"
+  "Westphalien\0"
+  "Weri\0"
+  "Pidgin, Cameroon\0"
+  "Perai\0"
+  "Chin, Rawngtu\0"
+  "Wejewa\0"
+  "Yafi\0"
+  "Wagaya\0"
+  "Wagawaga\0"
+  "Wangkangurru\0"
+  "Wahgi\0"
+  "Waigeo\0"
+  "Wirangu\0"
+  "Warrgamay\0"
+  "Sou Upaa\0"
+  "Wahgi, North\0"
+  "Kenyah, Wahau\0"
+  "Kayan, Wahau\0"
+  "Toussian, Southern\0"
+  "Wichita\0"
+  "Wik-Epa\0"
+  "Wik-Keyangan\0"
+  "Wik Ngathan\0"
+  "Wik-Me'anha\0"
+  "Minidien\0"
+  "Wik-Iiyanh\0"
+  "Wikalkan\0"
+  "Wilawila\0"
+  "Wik-Mungkan\0"
+  "Ho-Chunk\0"
+  "Wiraféd\0"
+  "Wiru\0"
+  "Vitu\0"
+  "Wiyot\0"
+  "Waja\0"
+  "Warji\0"
+  "Kw'adza\0"
+  "Kumbaran\0"
+  "Wakde\0"
+  "Kalanadi\0"
+  "Keerray-Woorroong\0"
+  "Kunduvadi\0"
+  "Wakawaka\0"
+  "Wangkayutyuru\0"
+  "Walio\0"
+  "Comorian, Mwali\0"
+  "Wolane\0"
+  "Kunbarlang\0"
+  "Welaun\0"
+  "Waioli\0"
+  "Wailaki\0"
+  "Wali (Sudan)\0"
+  "Welsh, Middle\0"
+  "Wolio\0"
+  "Wailapa\0"
+  "Wallisian\0"
+  "Wuliwuli\0"
+  "Wichí Lhamtés Vejoz\0"
+  "Walak\0"
+  "Wali (Ghana)\0"
+  "Waling\0"
+  "Mawa (Nigeria)\0"
+  "Wambaya\0"
+  "Wamas\0"
+  "Mamaindé\0"
+  "Wambule\0"
+  "Minyag, Western\0"
+  "Waima'a\0"
+  "Wamin\0"
+  "Maiwa (Indonesia)\0"
+  "Waamwang\0"
+  "Wom (Papua New Guinea)\0"
+  "Wambon\0"
+  "Walmajarri\0"
+  "Mwani\0"
+  "Womo\0"
+  "Wanambre\0"
+  "Wantoat\0"
+  "Wandarang\0"
+  "Waneci\0"
+  "Wanggom\0"
+  "Comorian, Ndzwani\0"
+  "Wanukaka\0"
+  "Wanggamala\0"
+  "Wunumara\0"
+  "Wano\0"
+  "Wanap\0"
+  "Usan\0"
+  "Wintu\0"
+  "Wanyi\0"
+  "Wolof\0"
+  "Kuwema\0"
+  "Wè Northern\0"
+  "Wogeo\0"
+  "Wolani\0"
+  "Woleaian\0"
+  "Wolof, Gambian\0"
+  "Wogamusin\0"
+  "Kamang\0"
+  "Longto\0"
+  "Wom (Nigeria)\0"
+  "Wongo\0"
+  "Manombai\0"
+  "Woria\0"
+  "Hanga Hundi\0"
+  "Wawonii\0"
+  "Weyto\0"
+  "Maco\0"
+  "Waluwarra\0"
+  "Warungu\0"
+  "Wiradjuri\0"
+  "Wariyangga\0"
+  "Garrwa\0"
+  "Warlmanpa\0"
+  "Warumungu\0"
+  "Warnang\0"
+  "Worrorra\0"
+  "Waropen\0"
+  "Wardaman\0"
+  "Waris\0"
+  "Waru\0"
+  "Waruna\0"
+  "Gugu Warra\0"
+  "Wae Rana\0"
+  "Merwari\0"
+  "Waray (Australia)\0"
+  "Warembori\0"
+  "Gondi, Adilabad\0"
+  "Wusi\0"
+  "Waskia\0"
+  "Owenia\0"
+  "Wasa\0"
+  "Wasu\0"
+  "Wotapuri-Katarqalai\0"
+  "Watiwa\0"
+  "Wathawurrung\0"
+  "Berta\0"
+  "Watakataui\0"
+  "Mewati\0"
+  "Wotu\0"
+  "Wikngenchera\0"
+  "Wunambal\0"
+  "Wudu\0"
+  "Wutunhua\0"
+  "Silimo\0"
+  "Wumbvu\0"
+  "Bungu\0"
+  "Wurrugu\0"
+  "Wutung\0"
+  "Chinese, Wu\0"
+  "Wuvulu-Aua\0"
+  "Wulna\0"
+  "Wauyai\0"
+  "Waama\0"
+  "Wakabunga\0"
+  "Wetamut\0"
+  "Warrwa\0"
+  "Wawa\0"
+  "Waxianghua\0"
+  "Wardandi\0"
+  "Wangaaybuwan-Ngiyambaa\0"
+  "Woiwurrung\0"
+  "Wymysorys\0"
+  "Wyandot\0"
+  "Wayoró\0"
+  "Fijian, Western\0"
+  "Arabic, Andalusian\0"
+  "Sambe\0"
+  "Kachari\0"
+  "Adai\0"
+  "Aequian\0"
+  "Aghwan\0"
+  "Kaimbé\0"
+  "Ararandewára\0"
+  "Máku\0"
+  "Kalmyk\0"
+  "ǀXam\0"
+  "Xamtanga\0"
+  "Khao\0"
+  "Apalachee\0"
+  "Aquitanian\0"
+  "Karami\0"
+  "Kamas\0"
+  "Katawixi\0"
+  "Kauwera\0"
+  "Xavánte\0"
+  "Kawaiisu\0"
+  "Kayan Mahakam\0"
+  "Burdekin, Lower\0"
+  "Bactrian\0"
+  "Bindal\0"
+  "Bigambal\0"
+  "Bunganditj\0"
+  "Kombio\0"
+  "Birrpayi\0"
+  "Breton, Middle\0"
+  "Kenaboi\0"
+  "Bolgarian\0"
+  "Bibbulman\0"
+  "Kambera\0"
+  "Kambiwá\0"
+  "Batjala\0"
+  "Cumbric\0"
+  "Camunic\0"
+  "Celtiberian\0"
+  "Gaulish, Cisalpine\0"
+  "Chemakum\0"
+  "Armenian, Classical\0"
+  "Comecrudo\0"
+  "Cotoname\0"
+  "Chorasmian\0"
+  "Carian\0"
+  "Tibetan, Classical\0"
+  "Curonian\0"
+  "Chuvantsy\0"
+  "Coahuilteco\0"
+  "Cayuse\0"
+  "Darkinyung\0"
+  "Dacian\0"
+  "Dharuk\0"
+  "Edomite\0"
+  "Kwandu\0"
+  "Kaitag\0"
+  "Dayak, Malayic\0"
+  "Eblan\0"
+  "Hdi\0"
+  "ǁXegwi\0"
+  "Kelo\0"
+  "Kembayan\0"
+  "Epi-Olmec\0"
+  "Xerénte\0"
+  "Kesawai\0"
+  "Xetá\0"
+  "Keoru-Ahia\0"
+  "Faliscan\0"
+  "Galatian\0"
+  "Gbin\0"
+  "Gudang\0"
+  "Gabrielino-Fernandeño\0"
+  "Goreng\0"
+  "Garingbal\0"
+  "Galindan\0"
+  "Dharumbal\0"
+  "Garza\0"
+  "Unggumi\0"
+  "Guwa\0"
+  "Xhosa\0"
+  "Harami\0"
+  "Hunnic\0"
+  "Hadrami\0"
+  "Khetrani\0"
+  "Khmer, Middle (1400 to 1850 CE)\0"
+  "Hernican\0"
+  "Hattic\0"
+  "Hurrian\0"
+  "Khua\0"
+  "Iberian\0"
+  "Xiri\0"
+  "Illyrian\0"
+  "Xinca\0"
+  "Xiriâna\0"
+  "Kisan\0"
+  "Indus Valley Language\0"
+  "Xipaya\0"
+  "Minjungbal\0"
+  "Jaitmatang\0"
+  "Kalkoti\0"
+  "Nago, Northern\0"
+  "Kho'ini\0"
+  "Kayan, Mendalam\0"
+  "Kereho\0"
+  "Khengkha\0"
+  "Kagoro\0"
+  "Kenyan Sign Language\0"
+  "Kajali\0"
+  "Kachok\0"
+  "Mainstream Kenyah\0"
+  "Kayan, Kayan River\0"
+  "Kiorr\0"
+  "Kabatei\0"
+  "Koroni\0"
+  "Xakriabá\0"
+  "Kumbewaha\0"
+  "Kantosi\0"
+  "Kaamba\0"
+  "Kgalagadi\0"
+  "Kembra\0"
+  "Karore\0"
+  "Uma' Lasan\0"
+  "Kurtokha\0"
+  "Kamula\0"
+  "Loup B\0"
+  "Lycian\0"
+  "Lydian\0"
+  "Lemnian\0"
+  "Ligurian (Ancient)\0"
+  "Liburnian\0"
+  "Alanic\0"
+  "Loup A\0"
+  "Lepontic\0"
+  "Lusitanian\0"
+  "Luwian, Cuneiform\0"
+  "Elymian\0"
+  "Mushungulu\0"
+  "Mbonga\0"
+  "Makhuwa-Marrevone\0"
+  "Mbudum\0"
+  "Median\0"
+  "Mingrelian\0"
+  "Mengaka\0"
+  "Kugu-Muminh\0"
+  "Majera\0"
+  "Macedonian, Ancient\0"
+  "Malaysian Sign Language\0"
+  "Malay, Manado\0"
+  "Persian, Manichaean Middle\0"
+  "Morerebi\0"
+  "Kuku-Mu'inh\0"
+  "Kuku-Mangk\0"
+  "Meroitic\0"
+  "Moroccan Sign Language\0"
+  "Matbat\0"
+  "Kamu\0"
+  "Malagasy, Antankarana\0"
+  "Malagasy, Tsimihety\0"
+  "Salawati\0"
+  "Mayaguduna\0"
+  "Mori Bawah\0"
+  "North Arabian, Ancient\0"
+  "Kanakanabu\0"
+  "Mongolian, Middle\0"
+  "Kuanhua\0"
+  "Ngarigu\0"
+  "Ngoni (Tanzania)\0"
+  "Nganakarti\0"
+  "Ngumbarl\0"
+  "Kankanay, Northern\0"
+  "Anglo-Norman\0"
+  "Ngoni (Mozambique)\0"
+  "Kangri\0"
+  "Kanashi\0"
+  "Narragansett\0"
+  "Nukunul\0"
+  "Nyiyaparli\0"
+  "Kenzi\0"
+  "O'chi'chi'\0"
+  "Kokoda\0"
+  "Soga\0"
+  "Kominimung\0"
+  "Xokleng\0"
+  "Komo (Sudan)\0"
+  "Konkomba\0"
+  "Xukurú\0"
+  "Kopar\0"
+  "Korubo\0"
+  "Kowaki\0"
+  "Pirriya\0"
+  "Tasmanian, Northeastern\0"
+  "Pecheneg\0"
+  "Tasmanian, Oyster Bay\0"
+  "Kpelle, Liberia\0"
+  "Tasmanian, Southeast\0"
+  "Phrygian\0"
+  "Tasmanian, North Midlands\0"
+  "Pictish\0"
+  "Mpalitjanh\0"
+  "Pano, Kulina\0"
+  "Tasmanian, Port Sorell\0"
+  "Pumpokol\0"
+  "Kapinawá\0"
+  "Pochutec\0"
+  "Puyo-Paekche\0"
+  "Mohegan-Pequot\0"
+  "Parthian\0"
+  "Pisidian\0"
+  "Punthamara\0"
+  "Punic\0"
+  "Tasmanian, Northern\0"
+  "Tasmanian, Northwestern\0"
+  "Tasmanian, Southwestern\0"
+  "Puyo\0"
+  "Tasmanian, Bruny Island\0"
+  "Karakhanid\0"
+  "Qatabanian\0"
+  "Krahô\0"
+  "Karaboro, Eastern\0"
+  "Gundungurra\0"
+  "Kreye\0"
+  "Minang\0"
+  "Krikati-Timbira\0"
+  "Armazic\0"
+  "Arin\0"
+  "Raetic\0"
+  "Aranama-Tamique\0"
+  "Marriammu\0"
+  "Karawa\0"
+  "Sabaean\0"
+  "Sambal\0"
+  "Scythian\0"
+  "Sidetic\0"
+  "Sempan\0"
+  "Shamang\0"
+  "Sio\0"
+  "Subi\0"
+  "Slavey, South\0"
+  "Kasem\0"
+  "Sanga (Nigeria)\0"
+  "Solano\0"
+  "Silopi\0"
+  "Makhuwa-Saka\0"
+  "Sherpa\0"
+  "Assan\0"
+  "Sanumá\0"
+  "Sudovian\0"
+  "Saisiyat\0"
+  "Mixtec, Alcozauca\0"
+  "Mixtec, Chazumba\0"
+  "Katcha-Kadugli-Miri\0"
+  "Mixtec, Diuxi-Tilantongo\0"
+  "Ketengban\0"
+  "Gaulish, Transalpine\0"
+  "Yitha Yitha\0"
+  "Mixtec, Sinicahua\0"
+  "Mixtec, San Juan Teita\0"
+  "Mixtec, Tijaltepec\0"
+  "Mixtec, Magdalena Peñasco\0"
+  "Mixtec, Northern Tlaxiaco\0"
+  "Tokharian A\0"
+  "Mixtec, San Miguel Piedras\0"
+  "Tumshuqese\0"
+  "Tripuri, Early\0"
+  "Mixtec, Sindihui\0"
+  "Mixtec, Tacahua\0"
+  "Mixtec, Cuyamecalco\0"
+  "Thawa\0"
+  "Tawandê\0"
+  "Mixtec, Yoloxochitl\0"
+  "Kurumba, Alu\0"
+  "Kurumba, Betta\0"
+  "Umiida\0"
+  "Kunigami\0"
+  "Kurumba, Jennu\0"
+  "Ngunawal\0"
+  "Umbrian\0"
+  "Unggaranggu\0"
+  "Kuo\0"
+  "Umpqua, Upper\0"
+  "Urartian\0"
+  "Kuthant\0"
+  "Kxoe\0"
+  "Venetic\0"
+  "Kamviri\0"
+  "Vandalic\0"
+  "Volscian\0"
+  "Vestinian\0"
+  "Kwaza\0"
+  "Woccon\0"
+  "Wadi Wadi\0"
+  "Gbe, Xwela\0"
+  "Kwegu\0"
+  "Wajuk\0"
+  "Wangkumara\0"
+  "Gbe, Western Xwla\0"
+  "Oirat, Written\0"
+  "Kwerba Mamberamo\0"
+  "Wotjobaluk\0"
+  "Wemba Wemba\0"
+  "Boro (Ghana)\0"
+  "Ke'o\0"
+  "Minkin\0"
+  "Koropó\0"
+  "Tambora\0"
+  "Yaygir\0"
+  "Yandjibara\0"
+  "Mayi-Yapi\0"
+  "Mayi-Kulan\0"
+  "Yalakalore\0"
+  "Mayi-Thakurti\0"
+  "Yorta Yorta\0"
+  "Zhang-Zhung\0"
+  "Zemgalian\0"
+  "Zapotec, Ancient\0"
+  "Yaminahua\0"
+  "Yuhup\0"
+  "Yali, Pass Valley\0"
+  "Yagua\0"
+  "Pumé\0"
+  "Yaka (Democratic Republic of Congo)\0"
+  "Yámana\0"
+  "Yazgulyam\0"
+  "Yagnobi\0"
+  "Banda-Yangere\0"
+  "Yakama\0"
+  "Yalunka\0"
+  "Yamba\0"
+  "Mayangna\0"
+  "Yao\0"
+  "Yapese\0"
+  "Yaqui\0"
+  "Yabarana\0"
+  "Nugunu (Cameroon)\0"
+  "Yambeta\0"
+  "Yuwana\0"
+  "Yangben\0"
+  "Yawalapití\0"
+  "Yauma\0"
+  "Agwagwune\0"
+  "Lokaa\0"
+  "Yala\0"
+  "Yemba\0"
+  "Yugur, West\0"
+  "Yakha\0"
+  "Yamphu\0"
+  "Hasha\0"
+  "Bokha\0"
+  "Yukuben\0"
+  "Yaben\0"
+  "Yabaâna\0"
+  "Yabong\0"
+  "Yawiyo\0"
+  "Yaweyuha\0"
+  "Chesu\0"
+  "Lolopo\0"
+  "Yucuna\0"
+  "Chepya\0"
+  "Yanda\0"
+  "Yiddish, Eastern\0"
+  "Yangum Dey\0"
+  "Yidgha\0"
+  "Yoidik\0"
+  "Ravula\0"
+  "Yeniche\0"
+  "Yimas\0"
+  "Yeni\0"
+  "Yevanic\0"
+  "Yela\0"
+  "Tarok\0"
+  "Nyankpa\0"
+  "Yetfa\0"
+  "Yerukula\0"
+  "Yapunda\0"
+  "Yeyi\0"
+  "Malyangapa\0"
+  "Yiningayi\0"
+  "Yangum Gel\0"
+  "Yagomi\0"
+  "Gepo\0"
+  "Yagaria\0"
+  "Yolŋu Sign Language\0"
+  "Yugul\0"
+  "Yagwoia\0"
+  "Buyang, Baha\0"
+  "Arabic, Judeo-Iraqi\0"
+  "Phowa, Hlepho\0"
+  "Yan-nhaŋu Sign Language\0"
+  "Yiddish\0"
+  "Yinggarda\0"
+  "Ache\0"
+  "Nasu, Wusa\0"
+  "Yiddish, Western\0"
+  "Yidiny\0"
+  "Yindjibarndi\0"
+  "Lalo, Dongshanba\0"
+  "Yindjilandji\0"
+  "Naga, Yimchungru\0"
+  "Riang Lai\0"
+  "Pholo\0"
+  "Miqie\0"
+  "Awyu, North\0"
+  "Yis\0"
+  "Lalu, Eastern\0"
+  "Awu\0"
+  "Nisu, Northern\0"
+  "Yi, Axi\0"
+  "Azhe\0"
+  "Yakan\0"
+  "Yukaghir, Northern\0"
+  "Yoke\0"
+  "Yakaikeke\0"
+  "Khlula\0"
+  "Kap\0"
+  "Kua-nsi\0"
+  "Yasa\0"
+  "Yekora\0"
+  "Kathu\0"
+  "Kuamasi\0"
+  "Yakoma\0"
+  "Yaul\0"
+  "Yaleba\0"
+  "Yele\0"
+  "Yelogu\0"
+  "Yali, Angguruk\0"
+  "Yil\0"
+  "Limi\0"
+  "Buyang, Langnian\0"
+  "Yi, Naluo\0"
+  "Yalarnnga\0"
+  "Aribwaung\0"
+  "Nyâlayu\0"
+  "Yambes\0"
+  "Muji, Southern\0"
+  "Muda\0"
+  "Yameo\0"
+  "Yamongeri\0"
+  "Mili\0"
+  "Moji\0"
+  "Makwe\0"
+  "Iamalele\0"
+  "Maay\0"
+  "Yamna\0"
+  "Yangum Mon\0"
+  "Yamap\0"
+  "Muji, Qila\0"
+  "Malasar\0"
+  "Mysian\0"
+  "Muji, Northern\0"
+  "Muzi\0"
+  "Aluo\0"
+  "Yandruwandha\0"
+  "Lang'e\0"
+  "Yango\0"
+  "Yupik, Naukan\0"
+  "Yangulam\0"
+  "Yana\0"
+  "Yong\0"
+  "Yendang\0"
+  "Yansi\0"
+  "Yahuna\0"
+  "Yoruba\0"
+  "Yoba\0"
+  "Yogad\0"
+  "Yonaguni\0"
+  "Yokuts\0"
+  "Yola\0"
+  "Yombe\0"
+  "Yongkom\0"
+  "Yotti\0"
+  "Yoron\0"
+  "Yoy\0"
+  "Phala\0"
+  "Phowa, Labo\0"
+  "Phola\0"
+  "Phupha\0"
+  "Yupik languages\0"
+  "Phuma\0"
+  "Phowa, Ani\0"
+  "Phola, Alo\0"
+  "Phupa\0"
+  "Phuza\0"
+  "Yerakai\0"
+  "Yareba\0"
+  "Yaouré\0"
+  "Nenets\0"
+  "Nhengatu\0"
+  "Yirrk-Mel\0"
+  "Yerong\0"
+  "Yaroamë\0"
+  "Yarsun\0"
+  "Yarawata\0"
+  "Yarluyandi\0"
+  "Yassic\0"
+  "Samatao\0"
+  "Sonaga\0"
+  "Yugoslavian Sign Language\0"
+  "Myanmar Sign Language\0"
+  "Sani\0"
+  "Nisi (China)\0"
+  "Lolopo, Southern\0"
+  "Yupik, Sirenik\0"
+  "Yessan-Mayo\0"
+  "Sanie\0"
+  "Talu\0"
+  "Tanglang\0"
+  "Thopho\0"
+  "Yout Wam\0"
+  "Yatay\0"
+  "Yucateco\0"
+  "Yugambal\0"
+  "Yuchi\0"
+  "Arabic, Judeo-Tripolitanian\0"
+  "Chinese, Yue\0"
+  "Havasupai-Walapai-Yavapai\0"
+  "Yug\0"
+  "Yurutí\0"
+  "Karkar-Yuri\0"
+  "Yuki\0"
+  "Yulu\0"
+  "Quechan\0"
+  "Bena (Nigeria)\0"
+  "Yukpa\0"
+  "Yuqui\0"
+  "Yurok\0"
+  "Yopno\0"
+  "Yau (Morobe Province)\0"
+  "Yukaghir, Southern\0"
+  "Yugur, East\0"
+  "Yuracare\0"
+  "Yawa\0"
+  "Yavitero\0"
+  "Kalou\0"
+  "Yinhawangka\0"
+  "Lalu, Western\0"
+  "Yawanawa\0"
+  "Yi, Wuding-Luquan\0"
+  "Yawuru\0"
+  "Lalo, Xishanba\0"
+  "Nasu, Wumeng\0"
+  "Yawarawarga\0"
+  "Mayawali\0"
+  "Yagara\0"
+  "Yardliyawarra\0"
+  "Yinwum\0"
+  "Yuyu\0"
+  "Yabula Yabula\0"
+  "Yir Yoront\0"
+  "Yau (Sandaun Province)\0"
+  "Ayizi\0"
+  "Buyang, E'ma\0"
+  "Zokhuo\0"
+  "Zhuang; Chuang\0"
+  "Zapotec, Sierra de Juárez\0"
+  "Zapotec, Western Tlacolula Valley\0"
+  "Zapotec, Ocotlán\0"
+  "Zapotec, Cajonos\0"
+  "Zapotec, Yareni\0"
+  "Zapotec, Ayoquesco\0"
+  "Zaghawa\0"
+  "Zangwal\0"
+  "Zapotec, Isthmus\0"
+  "Zaramo\0"
+  "Zanaki\0"
+  "Zauzou\0"
+  "Zapotec, Miahuatlán\0"
+  "Zapotec, Ozolotepec\0"
+  "Zapotec\0"
+  "Zapotec, Aloápam\0"
+  "Zapotec, Rincón\0"
+  "Zapotec, Santo Domingo Albarradas\0"
+  "Zapotec, Tabaa\0"
+  "Zangskari\0"
+  "Zapotec, Yatzachi\0"
+  "Zapotec, Mitla\0"
+  "Zapotec, Xadani\0"
+  "Zayse-Zergulla\0"
+  "Zari\0"
+  "Balaibalan\0"
+  "Berawan, Central\0"
+  "Berawan, East\0"
+  "Blissymbols\0"
+  "Batui\0"
+  "Bu (Bauchi State)\0"
+  "Berawan, West\0"
+  "Zapotec, Coatecas Altas\0"
+  "Zapotec, Las Delicias\0"
+  "Zhuang, Central Hongshuihe\0"
+  "Comorian, Ngazidja\0"
+  "Zeeuws\0"
+  "Zenag\0"
+  "Zhuang, Eastern Hongshuihe\0"
+  "Zenaga\0"
+  "Kinga\0"
+  "Zhuang, Guibei\0"
+  "Tamazight, Standard Moroccan\0"
+  "Zhuang, Minz\0"
+  "Zhuang, Guibian\0"
+  "Magori\0"
+  "Zhuang\0"
+  "Zhaba\0"
+  "Zhuang, Dai\0"
+  "Zhire\0"
+  "Zhuang, Nong\0"
+  "Zhoa\0"
+  "Zia\0"
+  "Zimbabwe Sign Language\0"
+  "Zimakani\0"
+  "Zialo\0"
+  "Mesme\0"
+  "Zinza\0"
+  "Zigula\0"
+  "Zizilivakan\0"
+  "Kaimbulawa\0"
+  "Koibal\0"
+  "Kadu\0"
+  "Koguryo\0"
+  "Khorezmian\0"
+  "Karankawa\0"
+  "Kanan\0"
+  "Kott\0"
+  "Kaingáng, São Paulo\0"
+  "Zakhring\0"
+  "Kitan\0"
+  "Kaurna\0"
+  "Krevinian\0"
+  "Khazar\0"
+  "Zula\0"
+  "Zhuang, Liujiang\0"
+  "Malay (individual language)\0"
+  "Zhuang, Lianshan\0"
+  "Zhuang, Liuqian\0"
+  "Manda (Australia)\0"
+  "Zimba\0"
+  "Margany\0"
+  "Maridan\0"
+  "Mangerr\0"
+  "Mfinu\0"
+  "Marti Ke\0"
+  "Makolkol\0"
+  "Negeri Sembilan Malay\0"
+  "Maridjabin\0"
+  "Mandandanyi\0"
+  "Matngala\0"
+  "Marimanindji\0"
+  "Mbangwe\0"
+  "Molo\0"
+  "Mpuono\0"
+  "Mituku\0"
+  "Maranunggu\0"
+  "Mbesa\0"
+  "Maringarr\0"
+  "Muruwari\0"
+  "Mbariman-Gudhinma\0"
+  "Mbo (Democratic Republic of Congo)\0"
+  "Bomitaba\0"
+  "Mariyedi\0"
+  "Mbandja\0"
+  "Zan Gula\0"
+  "Zande languages\0"
+  "Zande (individual language)\0"
+  "Mang\0"
+  "Manangkari\0"
+  "Mangas\0"
+  "Zoque, Copainalá\0"
+  "Zoque, Chimalapa\0"
+  "Zou\0"
+  "Zapotec, Asunción Mixtepec\0"
+  "Zoque, Tabasco\0"
+  "Zoque, Rayón\0"
+  "Zoque, Francisco León\0"
+  "Zapotec, Lachiguiri\0"
+  "Zapotec, Yautepec\0"
+  "Zapotec, Choapan\0"
+  "Zapotec, Southeastern Ixtlán\0"
+  "Zapotec, Petapa\0"
+  "Zapotec, San Pedro Quiatoni\0"
+  "Zapotec, Guevea De Humboldt\0"
+  "Zapotec, Totomachapan\0"
+  "Zapotec, Santa María Quiegolani\0"
+  "Zapotec, Quiavicuzas\0"
+  "Zapotec, Tlacolulita\0"
+  "Zapotec, Lachixío\0"
+  "Zapotec, Mixtepec\0"
+  "Zapotec, Santa Inés Yatzechi\0"
+  "Zapotec, Amatlán\0"
+  "Zapotec, El Alto\0"
+  "Zapotec, Zoogocho\0"
+  "Zapotec, Santiago Xanica\0"
+  "Zapotec, Coatlán\0"
+  "Zapotec, San Vicente Coatlán\0"
+  "Zapotec, Yalálag\0"
+  "Zapotec, Chichicapan\0"
+  "Zapotec, Zaniza\0"
+  "Zapotec, San Baltazar Loxicha\0"
+  "Zapotec, Mazaltepec\0"
+  "Zapotec, Texmelucan\0"
+  "Zhuang, Qiubei\0"
+  "Kara (Korea)\0"
+  "Mirgan\0"
+  "Zerenkel\0"
+  "Záparo\0"
+  "Zarphatic\0"
+  "Mairasi\0"
+  "Sarasira\0"
+  "Kaskean\0"
+  "Zambian Sign Language\0"
+  "Malay, Standard\0"
+  "Zapotec, Southern Rincon\0"
+  "Sukurum\0"
+  "Zapotec, Elotepec\0"
+  "Zapotec, Xanaguía\0"
+  "Zapotec, Lapaguía-Guivini\0"
+  "Zapotec, San Agustín Mixtepec\0"
+  "Zapotec, Santa Catarina Albarradas\0"
+  "Zapotec, Loxicha\0"
+  "Zapotec, Quioquitani-Quierí\0"
+  "Zapotec, Tilquiapan\0"
+  "Zapotec, Tejalapan\0"
+  "Zapotec, Güilá\0"
+  "Zapotec, Zaachila\0"
+  "Zapotec, Yatee\0"
+  "Zulu\0"
+  "Zeem\0"
+  "Tokano\0"
+  "Kumzari\0"
+  "Zuni\0"
+  "Zumaya\0"
+  "Zay\0"
+  "No linguistic content\0"
+  "Zhuang, Yongbei\0"
+  "Zhuang, Yang\0"
+  "Zhuang, Youjiang\0"
+  "Zhuang, Yongnan\0"
+  "Chin, Zyphe\0"
+  "Zaza\0"
+  "Zhuang, Zuojiang\0";
+
+static const char * const language_names[] = {
+  language_names_0,
+  language_names_1,
+  language_names_2,
+};
+
+typedef struct {
+  char code[4];
+  guint8 domain;
+  guint8 chunk;
+  guint16 name;
+} LanguageInfo;
+
+/* Sorted by code */
+static const LanguageInfo languages[] = {
+  { "aa", 0, 0,     0 },
+  { "aaa", 1, 0,     5 },
+  { "aab", 1, 0,    12 },
+  { "aac", 1, 0,    23 },
+  { "aad", 1, 0,    27 },
+  { "aae", 1, 0,    32 },
+  { "aaf", 1, 0,    54 },
+  { "aag", 1, 0,    63 },
+  { "aah", 1, 0,    70 },
+  { "aai", 1, 0,    84 },
+  { "aak", 1, 0,   101 },
+  { "aal", 1, 0,   108 },
+  { "aan", 1, 0,   114 },
+  { "aao", 1, 0,   122 },
+  { "aap", 1, 0,   147 },
+  { "aaq", 1, 0,   161 },
+  { "aar", 1, 0,     0 },
+  { "aas", 1, 0,   177 },
+  { "aat", 1, 0,   184 },
+  { "aau", 1, 0,   205 },
+  { "aaw", 1, 0,   210 },
+  { "aax", 1, 0,   217 },
+  { "aaz", 1, 0,   230 },
+  { "ab", 0, 0,   238 },
+  { "aba", 1, 0,   248 },
+  { "abb", 1, 0,   253 },
+  { "abc", 1, 0,   260 },
+  { "abd", 1, 0,   273 },
+  { "abe", 1, 0,   280 },
+  { "abf", 1, 0,   296 },
+  { "abg", 1, 0,   308 },
+  { "abh", 1, 0,   314 },
+  { "abi", 1, 0,   329 },
+  { "abj", 1, 0,   336 },
+  { "abk", 1, 0,   238 },
+  { "abl", 1, 0,   344 },
+  { "abm", 1, 0,   356 },
+  { "abn", 1, 0,   364 },
+  { "abo", 1, 0,   369 },
+  { "abp", 1, 0,   374 },
+  { "abq", 1, 0,   388 },
+  { "abr", 1, 0,   394 },
+  { "abs", 1, 0,   400 },
+  { "abt", 1, 0,   416 },
+  { "abu", 1, 0,   424 },
+  { "abv", 1, 0,   430 },
+  { "abw", 1, 0,   446 },
+  { "abx", 1, 0,   450 },
+  { "aby", 1, 0,   460 },
+  { "abz", 1, 0,   471 },
+  { "aca", 1, 0,   476 },
+  { "acb", 1, 0,   484 },
+  { "acd", 1, 0,   491 },
+  { "ace", 1, 0,   499 },
+  { "acf", 1, 0,   508 },
+  { "ach", 1, 0,   536 },
+  { "aci", 1, 0,   542 },
+  { "ack", 1, 0,   551 },
+  { "acl", 1, 0,   560 },
+  { "acm", 1, 0,   570 },
+  { "acn", 1, 0,   591 },
+  { "acp", 1, 0,   598 },
+  { "acq", 1, 0,   613 },
+  { "acr", 1, 0,   635 },
+  { "acs", 1, 0,   640 },
+  { "act", 1, 0,   647 },
+  { "acu", 1, 0,   659 },
+  { "acv", 1, 0,   674 },
+  { "acw", 1, 0,   683 },
+  { "acx", 1, 0,   698 },
+  { "acy", 1, 0,   712 },
+  { "acz", 1, 0,   728 },
+  { "ada", 1, 0,   736 },
+  { "adb", 1, 0,   744 },
+  { "add", 1, 0,   752 },
+  { "ade", 1, 0,   761 },
+  { "adf", 1, 0,   767 },
+  { "adg", 1, 0,   783 },
+  { "adh", 1, 0,   797 },
+  { "adi", 1, 0,   804 },
+  { "adj", 1, 0,   808 },
+  { "adl", 1, 0,   818 },
+  { "adn", 1, 0,   823 },
+  { "ado", 1, 0,   829 },
+  { "adq", 1, 0,   833 },
+  { "adr", 1, 0,   841 },
+  { "ads", 1, 0,   849 },
+  { "adt", 1, 0,   873 },
+  { "adu", 1, 0,   887 },
+  { "adw", 1, 0,   893 },
+  { "adx", 1, 0,   902 },
+  { "ady", 1, 0,   916 },
+  { "adz", 1, 0,   923 },
+  { "ae", 0, 0,   930 },
+  { "aea", 1, 0,   938 },
+  { "aeb", 1, 0,   944 },
+  { "aec", 1, 0,   961 },
+  { "aed", 1, 0,   975 },
+  { "aee", 1, 0,   999 },
+  { "aek", 1, 0,  1017 },
+  { "ael", 1, 0,  1023 },
+  { "aem", 1, 0,  1030 },
+  { "aen", 1, 0,  1035 },
+  { "aeq", 1, 0,  1058 },
+  { "aer", 1, 0,  1062 },
+  { "aes", 1, 0,  1080 },
+  { "aeu", 1, 0,  1086 },
+  { "aew", 1, 0,  1091 },
+  { "aey", 1, 0,  1100 },
+  { "aez", 1, 0,  1106 },
+  { "af", 0, 0,  1111 },
+  { "afa", 0, 0,  1121 },
+  { "afb", 1, 0,  1144 },
+  { "afd", 1, 0,  1157 },
+  { "afe", 1, 0,  1163 },
+  { "afg", 1, 0,  1172 },
+  { "afh", 1, 0,  1193 },
+  { "afi", 1, 0,  1202 },
+  { "afk", 1, 0,  1210 },
+  { "afn", 1, 0,  1218 },
+  { "afo", 1, 0,  1225 },
+  { "afp", 1, 0,  1231 },
+  { "afr", 1, 0,  1111 },
+  { "afs", 1, 0,  1237 },
+  { "aft", 1, 0,  1259 },
+  { "afu", 1, 0,  1266 },
+  { "afz", 1, 0,  1272 },
+  { "aga", 1, 0,  1282 },
+  { "agb", 1, 0,  1289 },
+  { "agc", 1, 0,  1295 },
+  { "agd", 1, 0,  1301 },
+  { "age", 1, 0,  1309 },
+  { "agf", 1, 0,  1315 },
+  { "agg", 1, 0,  1322 },
+  { "agh", 1, 0,  1328 },
+  { "agi", 1, 0,  1336 },
+  { "agj", 1, 0,  1344 },
+  { "agk", 1, 0,  1352 },
+  { "agl", 1, 0,  1365 },
+  { "agm", 1, 0,  1371 },
+  { "agn", 1, 0,  1381 },
+  { "ago", 1, 0,  1391 },
+  { "agq", 1, 0,  1398 },
+  { "agr", 1, 0,  1404 },
+  { "ags", 1, 0,  1413 },
+  { "agt", 1, 0,  1420 },
+  { "agu", 1, 0,  1442 },
+  { "agv", 1, 0,  1453 },
+  { "agw", 1, 0,  1472 },
+  { "agx", 1, 0,  1478 },
+  { "agy", 1, 0,  1484 },
+  { "agz", 1, 0,  1499 },
+  { "aha", 1, 0,  1515 },
+  { "ahb", 1, 0,  1522 },
+  { "ahg", 1, 0,  1528 },
+  { "ahh", 1, 0,  1535 },
+  { "ahi", 1, 0,  1540 },
+  { "ahk", 1, 0,  1557 },
+  { "ahl", 1, 0,  1562 },
+  { "ahm", 1, 0,  1566 },
+  { "ahn", 1, 0,  1581 },
+  { "aho", 1, 0,  1588 },
+  { "ahp", 1, 0,  1593 },
+  { "ahr", 1, 0,  1607 },
+  { "ahs", 1, 0,  1615 },
+  { "aht", 1, 0,  1620 },
+  { "aia", 1, 0,  1627 },
+  { "aib", 1, 0,  1633 },
+  { "aic", 1, 0,  1646 },
+  { "aid", 1, 0,  1653 },
+  { "aie", 1, 0,  1661 },
+  { "aif", 1, 0,  1667 },
+  { "aig", 1, 0,  1671 },
+  { "aih", 1, 0,  1707 },
+  { "aii", 1, 0,  1715 },
+  { "aij", 1, 0,  1737 },
+  { "aik", 1, 0,  1753 },
+  { "ail", 1, 0,  1757 },
+  { "aim", 1, 0,  1764 },
+  { "ain", 1, 0,  1770 },
+  { "aio", 1, 0,  1783 },
+  { "aip", 1, 0,  1789 },
+  { "aiq", 1, 0,  1799 },
+  { "air", 1, 0,  1805 },
+  { "ait", 1, 0,  1813 },
+  { "aiw", 1, 0,  1820 },
+  { "aix", 1, 0,  1825 },
+  { "aiy", 1, 0,  1832 },
+  { "aja", 1, 0,  1836 },
+  { "ajg", 1, 0,  1854 },
+  { "aji", 1, 0,  1866 },
+  { "ajn", 1, 0,  1872 },
+  { "ajp", 1, 0,  1880 },
+  { "ajs", 1, 0,  1904 },
+  { "aju", 1, 0,  1934 },
+  { "ajw", 1, 0,  1957 },
+  { "ajz", 1, 0,  1963 },
+  { "ak", 0, 0,  1975 },
+  { "aka", 1, 0,  1975 },
+  { "akb", 1, 0,  1980 },
+  { "akc", 1, 0,  1994 },
+  { "akd", 1, 0,  1999 },
+  { "ake", 1, 0,  2010 },
+  { "akf", 1, 0,  2018 },
+  { "akg", 1, 0,  2023 },
+  { "akh", 1, 0,  2034 },
+  { "aki", 1, 0,  2047 },
+  { "akj", 1, 0,  2053 },
+  { "akk", 1, 0,  2062 },
+  { "akl", 1, 0,  2071 },
+  { "akm", 1, 0,  2079 },
+  { "ako", 1, 0,  2086 },
+  { "akp", 1, 0,  2093 },
+  { "akq", 1, 0,  2098 },
+  { "akr", 1, 0,  2101 },
+  { "aks", 1, 0,  2107 },
+  { "akt", 1, 0,  2116 },
+  { "aku", 1, 0,  2123 },
+  { "akv", 1, 0,  2128 },
+  { "akw", 1, 0,  2136 },
+  { "akx", 1, 0,  2141 },
+  { "aky", 1, 0,  2150 },
+  { "akz", 1, 0,  2158 },
+  { "ala", 1, 0,  2166 },
+  { "alb", 0, 0,  2172 },
+  { "alc", 1, 0,  2181 },
+  { "ald", 1, 0,  2190 },
+  { "ale", 1, 0,  2199 },
+  { "alf", 1, 0,  2205 },
+  { "alg", 0, 0,  2211 },
+  { "alh", 1, 0,  2232 },
+  { "ali", 1, 0,  2238 },
+  { "alj", 1, 0,  2246 },
+  { "alk", 1, 0,  2254 },
+  { "all", 1, 0,  2259 },
+  { "alm", 1, 0,  2265 },
+  { "aln", 1, 0,  2273 },
+  { "alo", 1, 0,  2288 },
+  { "alp", 1, 0,  2304 },
+  { "alq", 1, 0,  2310 },
+  { "alr", 1, 0,  2320 },
+  { "als", 1, 0,  2327 },
+  { "alt", 1, 0,  2342 },
+  { "alu", 1, 0,  2358 },
+  { "alw", 1, 0,  2367 },
+  { "alx", 1, 0,  2384 },
+  { "aly", 1, 0,  2389 },
+  { "alz", 1, 0,  2398 },
+  { "am", 0, 0,  2403 },
+  { "ama", 1, 0,  2411 },
+  { "amb", 1, 0,  2420 },
+  { "amc", 1, 0,  2425 },
+  { "ame", 1, 0,  2434 },
+  { "amf", 1, 0,  2443 },
+  { "amg", 1, 0,  2455 },
+  { "amh", 1, 0,  2403 },
+  { "ami", 1, 0,  2463 },
+  { "amj", 1, 0,  2468 },
+  { "amk", 1, 0,  2475 },
+  { "aml", 1, 0,  2481 },
+  { "amm", 1, 0,  2493 },
+  { "amn", 1, 0,  2516 },
+  { "amo", 1, 0,  2523 },
+  { "amp", 1, 0,  2527 },
+  { "amq", 1, 0,  2536 },
+  { "amr", 1, 0,  2543 },
+  { "ams", 1, 0,  2554 },
+  { "amt", 1, 0,  2577 },
+  { "amu", 1, 0,  2582 },
+  { "amv", 1, 0,  2599 },
+  { "amw", 1, 0,  2607 },
+  { "amx", 1, 0,  2628 },
+  { "amy", 1, 0,  2639 },
+  { "amz", 1, 0,  2643 },
+  { "an", 0, 0,  2652 },
+  { "ana", 1, 0,  2662 },
+  { "anb", 1, 0,  2670 },
+  { "anc", 1, 0,  2676 },
+  { "and", 1, 0,  2681 },
+  { "ane", 1, 0,  2687 },
+  { "anf", 1, 0,  2699 },
+  { "ang", 1, 0,  2707 },
+  { "anh", 1, 0,  2735 },
+  { "ani", 1, 0,  2740 },
+  { "anj", 1, 0,  2745 },
+  { "ank", 1, 0,  2750 },
+  { "anl", 1, 0,  2757 },
+  { "anm", 1, 0,  2775 },
+  { "ann", 1, 0,  2780 },
+  { "ano", 1, 0,  2786 },
+  { "anp", 1, 0,  2794 },
+  { "anq", 1, 0,  2801 },
+  { "anr", 1, 0,  2816 },
+  { "ans", 1, 0,  2821 },
+  { "ant", 1, 0,  2829 },
+  { "anu", 1, 0,  2841 },
+  { "anv", 1, 0,  2847 },
+  { "anw", 1, 0,  2853 },
+  { "anx", 1, 0,  2860 },
+  { "any", 1, 0,  2870 },
+  { "anz", 1, 0,  2876 },
+  { "aoa", 1, 0,  2881 },
+  { "aob", 1, 0,  2889 },
+  { "aoc", 1, 0,  2894 },
+  { "aod", 1, 0,  2900 },
+  { "aoe", 1, 0,  2908 },
+  { "aof", 1, 0,  2919 },
+  { "aog", 1, 0,  2926 },
+  { "aoi", 1, 0,  2934 },
+  { "aoj", 1, 0,  2947 },
+  { "aok", 1, 0,  2954 },
+  { "aol", 1, 0,  2960 },
+  { "aom", 1, 0,  2965 },
+  { "aon", 1, 0,  2971 },
+  { "aor", 1, 0,  2988 },
+  { "aos", 1, 0,  2993 },
+  { "aot", 1, 0,  3000 },
+  { "aou", 1, 0,  3014 },
+  { "aox", 1, 0,  3019 },
+  { "aoz", 1, 0,  3027 },
+  { "apa", 0, 0,  3036 },
+  { "apb", 1, 0,  3053 },
+  { "apc", 1, 0,  3058 },
+  { "apd", 1, 0,  3082 },
+  { "ape", 1, 0,  3099 },
+  { "apf", 1, 0,  3107 },
+  { "apg", 1, 0,  3121 },
+  { "aph", 1, 0,  3130 },
+  { "api", 1, 0,  3140 },
+  { "apj", 1, 0,  3148 },
+  { "apk", 1, 0,  3166 },
+  { "apl", 1, 0,  3180 },
+  { "apm", 1, 0,  3194 },
+  { "apn", 1, 0,  3223 },
+  { "apo", 1, 0,  3232 },
+  { "app", 1, 0,  3238 },
+  { "apq", 1, 0,  3243 },
+  { "apr", 1, 0,  3254 },
+  { "aps", 1, 0,  3265 },
+  { "apt", 1, 0,  3278 },
+  { "apu", 1, 0,  3286 },
+  { "apv", 1, 0,  3295 },
+  { "apw", 1, 0,  3305 },
+  { "apx", 1, 0,  3321 },
+  { "apy", 1, 0,  3328 },
+  { "apz", 1, 0,  3336 },
+  { "aqc", 1, 0,  3345 },
+  { "aqd", 1, 0,  3351 },
+  { "aqg", 1, 0,  3365 },
+  { "aqk", 1, 0,  3373 },
+  { "aqm", 1, 0,  3380 },
+  { "aqn", 1, 0,  3389 },
+  { "aqp", 1, 0,  3404 },
+  { "aqr", 1, 0,  3412 },
+  { "aqt", 1, 0,  3418 },
+  { "aqz", 1, 0,  3427 },
+  { "ar", 0, 0,  3435 },
+  { "ara", 1, 0,  3435 },
+  { "arb", 1, 0,  3442 },
+  { "arc", 1, 0,  3459 },
+  { "ard", 1, 0,  3491 },
+  { "are", 1, 0,  3499 },
+  { "arg", 1, 0,  2652 },
+  { "arh", 1, 0,  3517 },
+  { "ari", 1, 0,  3525 },
+  { "arj", 1, 0,  3533 },
+  { "ark", 1, 0,  3541 },
+  { "arl", 1, 0,  3550 },
+  { "arm", 0, 0,  3558 },
+  { "arn", 1, 0,  3567 },
+  { "aro", 1, 0,  3578 },
+  { "arp", 1, 0,  3585 },
+  { "arq", 1, 0,  3593 },
+  { "arr", 1, 0,  3610 },
+  { "ars", 1, 0,  3624 },
+  { "art", 0, 0,  3638 },
+  { "aru", 1, 0,  3659 },
+  { "arv", 1, 0,  3682 },
+  { "arw", 1, 0,  3689 },
+  { "arx", 1, 0,  3696 },
+  { "ary", 1, 0,  3718 },
+  { "arz", 1, 0,  3735 },
+  { "as", 0, 0,  3752 },
+  { "asa", 1, 0,  3761 },
+  { "asb", 1, 0,  3776 },
+  { "asc", 1, 0,  3788 },
+  { "ase", 1, 0,  3811 },
+  { "asf", 1, 0,  3834 },
+  { "asg", 1, 0,  3841 },
+  { "ash", 1, 0,  3852 },
+  { "asi", 1, 0,  3861 },
+  { "asj", 1, 0,  3869 },
+  { "ask", 1, 0,  3874 },
+  { "asl", 1, 0,  3881 },
+  { "asm", 1, 0,  3752 },
+  { "asn", 1, 0,  3889 },
+  { "aso", 1, 0,  3906 },
+  { "asp", 1, 0,  3911 },
+  { "asq", 1, 0,  3934 },
+  { "asr", 1, 0,  3957 },
+  { "ass", 1, 0,  3963 },
+  { "ast", 1, 0,  3969 },
+  { "asu", 1, 0,  3978 },
+  { "asv", 1, 0,  3997 },
+  { "asw", 1, 0,  4002 },
+  { "asx", 1, 0,  4038 },
+  { "asy", 1, 0,  4048 },
+  { "asz", 1, 0,  4064 },
+  { "ata", 1, 0,  4067 },
+  { "atb", 1, 0,  4076 },
+  { "atc", 1, 0,  4082 },
+  { "atd", 1, 0,  4092 },
+  { "ate", 1, 0,  4104 },
+  { "atg", 1, 0,  4112 },
+  { "ath", 0, 0,  4136 },
+  { "ati", 1, 0,  4157 },
+  { "atj", 1, 0,  4164 },
+  { "atk", 1, 0,  4174 },
+  { "atl", 1, 0,  4178 },
+  { "atm", 1, 0,  4194 },
+  { "atn", 1, 0,  4198 },
+  { "ato", 1, 0,  4207 },
+  { "atp", 1, 0,  4224 },
+  { "atq", 1, 0,  4237 },
+  { "atr", 1, 0,  4254 },
+  { "ats", 1, 0,  4270 },
+  { "att", 1, 0,  4282 },
+  { "atu", 1, 0,  4297 },
+  { "atv", 1, 0,  4302 },
+  { "atw", 1, 0,  4318 },
+  { "atx", 1, 0,  4327 },
+  { "aty", 1, 0,  4335 },
+  { "atz", 1, 0,  4344 },
+  { "aua", 1, 0,  4349 },
+  { "aub", 1, 0,  4357 },
+  { "auc", 1, 0,  4363 },
+  { "aud", 1, 0,  4371 },
+  { "aug", 1, 0,  4377 },
+  { "auh", 1, 0,  4383 },
+  { "aui", 1, 0,  4389 },
+  { "auj", 1, 0,  4395 },
+  { "auk", 1, 0,  4403 },
+  { "aul", 1, 0,  4408 },
+  { "aum", 1, 0,  4414 },
+  { "aun", 1, 0,  4428 },
+  { "auo", 1, 0,  4439 },
+  { "aup", 1, 0,  4448 },
+  { "auq", 1, 0,  4456 },
+  { "aur", 1, 0,  4461 },
+  { "aus", 0, 0,  4467 },
+  { "aut", 1, 0,  4488 },
+  { "auu", 1, 0,  4496 },
+  { "auw", 1, 0,  4501 },
+  { "aux", 1, 0,  4506 },
+  { "auy", 1, 0,  4512 },
+  { "auz", 1, 0,  4521 },
+  { "av", 0, 0,  4536 },
+  { "ava", 1, 0,  4536 },
+  { "avb", 1, 0,  4543 },
+  { "avd", 1, 0,  4548 },
+  { "ave", 1, 0,   930 },
+  { "avi", 1, 0,  4562 },
+  { "avk", 1, 0,  4569 },
+  { "avl", 1, 0,  4576 },
+  { "avm", 1, 0,  4608 },
+  { "avn", 1, 0,  4619 },
+  { "avo", 1, 0,  4627 },
+  { "avs", 1, 0,  4641 },
+  { "avt", 1, 0,  4649 },
+  { "avu", 1, 0,  4652 },
+  { "avv", 1, 0,  4660 },
+  { "awa", 1, 0,  4674 },
+  { "awb", 1, 0,  4681 },
+  { "awc", 1, 0,  4704 },
+  { "awe", 1, 0,  4711 },
+  { "awg", 1, 0,  4718 },
+  { "awh", 1, 0,  4729 },
+  { "awi", 1, 0,  4736 },
+  { "awk", 1, 0,  4743 },
+  { "awm", 1, 0,  4752 },
+  { "awn", 1, 0,  4759 },
+  { "awo", 1, 0,  4765 },
+  { "awr", 1, 0,  4770 },
+  { "aws", 1, 0,  4776 },
+  { "awt", 1, 0,  4788 },
+  { "awu", 1, 0,  4797 },
+  { "awv", 1, 0,  4811 },
+  { "aww", 1, 0,  4822 },
+  { "awx", 1, 0,  4827 },
+  { "awy", 1, 0,  4833 },
+  { "axb", 1, 0,  4845 },
+  { "axe", 1, 0,  4852 },
+  { "axg", 1, 0,  4864 },
+  { "axk", 1, 0,  4884 },
+  { "axl", 1, 0,  4916 },
+  { "axm", 1, 0,  4939 },
+  { "axx", 1, 0,  4956 },
+  { "ay", 0, 0,  4968 },
+  { "aya", 1, 0,  4975 },
+  { "ayb", 1, 0,  4980 },
+  { "ayc", 1, 0,  4991 },
+  { "ayd", 1, 0,  5008 },
+  { "aye", 1, 0,  5017 },
+  { "ayg", 1, 0,  5023 },
+  { "ayh", 1, 0,  5032 },
+  { "ayi", 1, 0,  5048 },
+  { "ayk", 1, 0,  5056 },
+  { "ayl", 1, 0,  5062 },
+  { "aym", 1, 0,  4968 },
+  { "ayn", 1, 0,  5077 },
+  { "ayo", 1, 0,  5093 },
+  { "ayp", 1, 0,  5100 },
+  { "ayq", 1, 0,  5127 },
+  { "ayr", 1, 0,  5150 },
+  { "ays", 1, 0,  5166 },
+  { "ayt", 1, 0,  5181 },
+  { "ayu", 1, 0,  5196 },
+  { "ayz", 1, 0,  5200 },
+  { "az", 0, 0,  5209 },
+  { "aza", 1, 0,  5221 },
+  { "azb", 1, 0,  5226 },
+  { "azd", 1, 0,  5245 },
+  { "aze", 1, 0,  5209 },
+  { "azg", 1, 0,  5270 },
+  { "azj", 1, 0,  5296 },
+  { "azm", 1, 0,  5315 },
+  { "azn", 1, 0,  5331 },
+  { "azo", 1, 0,  5356 },
+  { "azt", 1, 0,  5362 },
+  { "azz", 1, 0,  5374 },
+  { "ba", 0, 0,  5399 },
+  { "baa", 1, 0,  5407 },
+  { "bab", 1, 0,  5416 },
+  { "bac", 1, 0,  5433 },
+  { "bad", 0, 0,  5439 },
+  { "bae", 1, 0,  5455 },
+  { "baf", 1, 0,  5461 },
+  { "bag", 1, 0,  5468 },
+  { "bah", 1, 0,  5473 },
+  { "bai", 0, 0,  5497 },
+  { "baj", 1, 0,  5516 },
+  { "bak", 1, 0,  5399 },
+  { "bal", 1, 0,  5524 },
+  { "bam", 1, 0,  5532 },
+  { "ban", 1, 0,  5540 },
+  { "bao", 1, 0,  5549 },
+  { "bap", 1, 0,  5557 },
+  { "baq", 0, 0,  5565 },
+  { "bar", 1, 0,  5572 },
+  { "bas", 1, 0,  5581 },
+  { "bat", 0, 0,  5597 },
+  { "bau", 1, 0,  5614 },
+  { "bav", 1, 0,  5629 },
+  { "baw", 1, 0,  5635 },
+  { "bax", 1, 0,  5650 },
+  { "bay", 1, 0,  5656 },
+  { "bba", 1, 0,  5664 },
+  { "bbb", 1, 0,  5673 },
+  { "bbc", 1, 0,  5679 },
+  { "bbd", 1, 0,  5690 },
+  { "bbe", 1, 0,  5694 },
+  { "bbf", 1, 0,  5701 },
+  { "bbg", 1, 0,  5708 },
+  { "bbh", 1, 0,  5715 },
+  { "bbi", 1, 0,  5721 },
+  { "bbj", 1, 0,  5729 },
+  { "bbk", 1, 0,  5740 },
+  { "bbl", 1, 0,  5748 },
+  { "bbm", 1, 0,  5753 },
+  { "bbn", 1, 0,  5761 },
+  { "bbo", 1, 0,  5768 },
+  { "bbp", 1, 0,  5791 },
+  { "bbq", 1, 0,  5811 },
+  { "bbr", 1, 0,  5818 },
+  { "bbs", 1, 0,  5825 },
+  { "bbt", 1, 0,  5834 },
+  { "bbu", 1, 0,  5841 },
+  { "bbv", 1, 0,  5858 },
+  { "bbw", 1, 0,  5865 },
+  { "bbx", 1, 0,  5870 },
+  { "bby", 1, 0,  5876 },
+  { "bca", 1, 0,  5883 },
+  { "bcb", 1, 0,  5896 },
+  { "bcc", 1, 0,  5910 },
+  { "bcd", 1, 0,  5928 },
+  { "bce", 1, 0,  5941 },
+  { "bcf", 1, 0,  5950 },
+  { "bcg", 1, 0,  5955 },
+  { "bch", 1, 0,  5966 },
+  { "bci", 1, 0,  5973 },
+  { "bcj", 1, 0,  5981 },
+  { "bck", 1, 0,  5987 },
+  { "bcl", 1, 0,  5994 },
+  { "bcm", 1, 0,  6009 },
+  { "bcn", 1, 0,  6017 },
+  { "bco", 1, 0,  6032 },
+  { "bcp", 1, 0,  6039 },
+  { "bcq", 1, 0,  6075 },
+  { "bcr", 1, 0,  6081 },
+  { "bcs", 1, 0,  6088 },
+  { "bct", 1, 0,  6097 },
+  { "bcu", 1, 0,  6103 },
+  { "bcv", 1, 0,  6113 },
+  { "bcw", 1, 0,  6128 },
+  { "bcy", 1, 0,  6133 },
+  { "bcz", 1, 0,  6140 },
+  { "bda", 1, 0,  6159 },
+  { "bdb", 1, 0,  6165 },
+  { "bdc", 1, 0,  6171 },
+  { "bdd", 1, 0,  6186 },
+  { "bde", 1, 0,  6193 },
+  { "bdf", 1, 0,  6198 },
+  { "bdg", 1, 0,  6204 },
+  { "bdh", 1, 0,  6211 },
+  { "bdi", 1, 0,  6230 },
+  { "bdj", 1, 0,  6236 },
+  { "bdk", 1, 0,  6254 },
+  { "bdl", 1, 0,  6261 },
+  { "bdm", 1, 0,  6279 },
+  { "bdn", 1, 0,  6286 },
+  { "bdo", 1, 0,  6294 },
+  { "bdp", 1, 0,  6300 },
+  { "bdq", 1, 0,  6306 },
+  { "bdr", 1, 0,  6313 },
+  { "bds", 1, 0,  6331 },
+  { "bdt", 1, 0,  6339 },
+  { "bdu", 1, 0,  6346 },
+  { "bdv", 1, 0,  6352 },
+  { "bdw", 1, 0,  6363 },
+  { "bdx", 1, 0,  6369 },
+  { "bdy", 1, 0,  6383 },
+  { "bdz", 1, 0,  6394 },
+  { "be", 0, 0,  6402 },
+  { "bea", 1, 0,  6413 },
+  { "beb", 1, 0,  6420 },
+  { "bec", 1, 0,  6427 },
+  { "bed", 1, 0,  6438 },
+  { "bee", 1, 0,  6447 },
+  { "bef", 1, 0,  6455 },
+  { "beg", 1, 0,  6464 },
+  { "beh", 1, 0,  6471 },
+  { "bei", 1, 0,  6477 },
+  { "bej", 1, 0,  6485 },
+  { "bek", 1, 0,  6490 },
+  { "bel", 1, 0,  6402 },
+  { "bem", 1, 0,  6497 },
+  { "ben", 1, 0,  6512 },
+  { "beo", 1, 0,  6520 },
+  { "bep", 1, 0,  6526 },
+  { "beq", 1, 0,  6532 },
+  { "ber", 0, 0,  6539 },
+  { "bes", 1, 0,  6556 },
+  { "bet", 1, 0,  6562 },
+  { "beu", 1, 0,  6579 },
+  { "bev", 1, 0,  6586 },
+  { "bew", 1, 0,  6600 },
+  { "bex", 1, 0,  6607 },
+  { "bey", 1, 0,  6616 },
+  { "bez", 1, 0,  6640 },
+  { "bfa", 1, 0,  6656 },
+  { "bfb", 1, 0,  6661 },
+  { "bfc", 1, 0,  6675 },
+  { "bfd", 1, 0,  6686 },
+  { "bfe", 1, 0,  6692 },
+  { "bff", 1, 0,  6698 },
+  { "bfg", 1, 0,  6703 },
+  { "bfh", 1, 0,  6717 },
+  { "bfi", 1, 0,  6723 },
+  { "bfj", 1, 0,  6745 },
+  { "bfk", 1, 0,  6753 },
+  { "bfl", 1, 0,  6776 },
+  { "bfm", 1, 0,  6790 },
+  { "bfn", 1, 0,  6795 },
+  { "bfo", 1, 0,  6801 },
+  { "bfp", 1, 0,  6816 },
+  { "bfq", 1, 0,  6821 },
+  { "bfr", 1, 0,  6828 },
+  { "bfs", 1, 0,  6836 },
+  { "bft", 1, 0,  6850 },
+  { "bfu", 1, 0,  6856 },
+  { "bfw", 1, 0,  6862 },
+  { "bfx", 1, 0,  6868 },
+  { "bfy", 1, 0,  6879 },
+  { "bfz", 1, 0,  6887 },
+  { "bg", 0, 0,  6902 },
+  { "bga", 1, 0,  6912 },
+  { "bgb", 1, 0,  6924 },
+  { "bgc", 1, 0,  6933 },
+  { "bgd", 1, 0,  6942 },
+  { "bge", 1, 0,  6957 },
+  { "bgf", 1, 0,  6964 },
+  { "bgg", 1, 0,  6973 },
+  { "bgi", 1, 0,  6979 },
+  { "bgj", 1, 0,  6987 },
+  { "bgk", 1, 0,  6996 },
+  { "bgl", 1, 0,  7000 },
+  { "bgn", 1, 0,  7010 },
+  { "bgo", 1, 0,  7027 },
+  { "bgp", 1, 0,  7037 },
+  { "bgq", 1, 0,  7054 },
+  { "bgr", 1, 0,  7060 },
+  { "bgs", 1, 0,  7071 },
+  { "bgt", 1, 0,  7080 },
+  { "bgu", 1, 0,  7088 },
+  { "bgv", 1, 0,  7096 },
+  { "bgw", 1, 0,  7109 },
+  { "bgx", 1, 0,  7116 },
+  { "bgy", 1, 0,  7139 },
+  { "bgz", 1, 0,  7147 },
+  { "bh", 0, 0,  7155 },
+  { "bha", 1, 0,  7172 },
+  { "bhb", 1, 0,  7179 },
+  { "bhc", 1, 0,  7185 },
+  { "bhd", 1, 0,  7190 },
+  { "bhe", 1, 0,  7201 },
+  { "bhf", 1, 0,  7207 },
+  { "bhg", 1, 0,  7213 },
+  { "bhh", 1, 0,  7223 },
+  { "bhi", 1, 0,  7232 },
+  { "bhj", 1, 0,  7240 },
+  { "bhl", 1, 0,  7247 },
+  { "bhm", 1, 0,  7253 },
+  { "bhn", 1, 0,  7261 },
+  { "bho", 1, 0,  7281 },
+  { "bhp", 1, 0,  7290 },
+  { "bhq", 1, 0,  7295 },
+  { "bhr", 1, 0,  7313 },
+  { "bhs", 1, 0,  7328 },
+  { "bht", 1, 0,  7334 },
+  { "bhu", 1, 0,  7345 },
+  { "bhv", 1, 0,  7353 },
+  { "bhw", 1, 0,  7359 },
+  { "bhx", 1, 0,  7364 },
+  { "bhy", 1, 0,  7371 },
+  { "bhz", 1, 0,  7377 },
+  { "bi", 0, 0,  7394 },
+  { "bia", 1, 0,  7402 },
+  { "bib", 1, 0,  7411 },
+  { "bid", 1, 0,  7417 },
+  { "bie", 1, 0,  7424 },
+  { "bif", 1, 0,  7431 },
+  { "big", 1, 0,  7439 },
+  { "bih", 0, 0,  7155 },
+  { "bik", 1, 0,  7447 },
+  { "bil", 1, 0,  7453 },
+  { "bim", 1, 0,  7458 },
+  { "bin", 1, 0,  7465 },
+  { "bio", 1, 0,  7470 },
+  { "bip", 1, 0,  7474 },
+  { "biq", 1, 0,  7479 },
+  { "bir", 1, 0,  7484 },
+  { "bis", 1, 0,  7394 },
+  { "bit", 1, 0,  7492 },
+  { "biu", 1, 0,  7501 },
+  { "biv", 1, 0,  7507 },
+  { "biw", 1, 0,  7525 },
+  { "bix", 1, 0,  7540 },
+  { "biy", 1, 0,  7547 },
+  { "biz", 1, 0,  7554 },
+  { "bja", 1, 0,  7560 },
+  { "bjb", 1, 0,  7566 },
+  { "bjc", 1, 0,  7576 },
+  { "bje", 1, 0,  7583 },
+  { "bjf", 1, 0,  7599 },
+  { "bjg", 1, 0,  7627 },
+  { "bjh", 1, 0,  7635 },
+  { "bji", 1, 0,  7644 },
+  { "bjj", 1, 0,  7650 },
+  { "bjk", 1, 0,  7658 },
+  { "bjl", 1, 0,  7664 },
+  { "bjm", 1, 0,  7688 },
+  { "bjn", 1, 0,  7697 },
+  { "bjo", 1, 0,  7704 },
+  { "bjp", 1, 0,  7724 },
+  { "bjr", 1, 0,  7734 },
+  { "bjs", 1, 0,  7745 },
+  { "bjt", 1, 0,  7751 },
+  { "bju", 1, 0,  7765 },
+  { "bjv", 1, 0,  7771 },
+  { "bjw", 1, 0,  7779 },
+  { "bjx", 1, 0,  7786 },
+  { "bjy", 1, 0,  7799 },
+  { "bjz", 1, 0,  7806 },
+  { "bka", 1, 0,  7813 },
+  { "bkc", 1, 0,  7818 },
+  { "bkd", 1, 0,  7834 },
+  { "bkf", 1, 0,  7842 },
+  { "bkg", 1, 0,  7848 },
+  { "bkh", 1, 0,  7855 },
+  { "bki", 1, 0,  7862 },
+  { "bkj", 1, 0,  7867 },
+  { "bkk", 1, 0,  7873 },
+  { "bkl", 1, 0,  7882 },
+  { "bkm", 1, 0,  7888 },
+  { "bkn", 1, 0,  7903 },
+  { "bko", 1, 0,  7911 },
+  { "bkp", 1, 0,  7916 },
+  { "bkq", 1, 0,  7952 },
+  { "bkr", 1, 0,  7961 },
+  { "bks", 1, 0,  7970 },
+  { "bkt", 1, 0,  7991 },
+  { "bku", 1, 0,  7998 },
+  { "bkv", 1, 0,  8004 },
+  { "bkw", 1, 0,  8013 },
+  { "bkx", 1, 0,  8020 },
+  { "bky", 1, 0,  8028 },
+  { "bkz", 1, 0,  8034 },
+  { "bla", 1, 0,  8041 },
+  { "blb", 1, 0,  8049 },
+  { "blc", 1, 0,  8055 },
+  { "bld", 1, 0,  8067 },
+  { "ble", 1, 0,  8075 },
+  { "blf", 1, 0,  8091 },
+  { "blh", 1, 0,  8096 },
+  { "bli", 1, 0,  8102 },
+  { "blj", 1, 0,  8108 },
+  { "blk", 1, 0,  8117 },
+  { "bll", 1, 0,  8129 },
+  { "blm", 1, 0,  8136 },
+  { "bln", 1, 0,  8155 },
+  { "blo", 1, 0,  8183 },
+  { "blp", 1, 0,  8188 },
+  { "blq", 1, 0,  8198 },
+  { "blr", 1, 0,  8209 },
+  { "bls", 1, 0,  8215 },
+  { "blt", 1, 0,  8225 },
+  { "blv", 1, 0,  8233 },
+  { "blw", 1, 0,  8240 },
+  { "blx", 1, 0,  8249 },
+  { "bly", 1, 0,  8264 },
+  { "blz", 1, 0,  8270 },
+  { "bm", 0, 0,  5532 },
+  { "bma", 1, 0,  8279 },
+  { "bmb", 1, 0,  8284 },
+  { "bmc", 1, 0,  8290 },
+  { "bmd", 1, 0,  8295 },
+  { "bme", 1, 0,  8309 },
+  { "bmf", 1, 0,  8317 },
+  { "bmg", 1, 0,  8325 },
+  { "bmh", 1, 0,  8331 },
+  { "bmi", 1, 0,  8336 },
+  { "bmj", 1, 0,  8344 },
+  { "bmk", 1, 0,  8355 },
+  { "bml", 1, 0,  8363 },
+  { "bmm", 1, 0,  8371 },
+  { "bmn", 1, 0,  8404 },
+  { "bmo", 1, 0,  8428 },
+  { "bmp", 1, 0,  8438 },
+  { "bmq", 1, 0,  8446 },
+  { "bmr", 1, 0,  8451 },
+  { "bms", 1, 0,  8459 },
+  { "bmt", 1, 0,  8473 },
+  { "bmu", 1, 0,  8482 },
+  { "bmv", 1, 0,  8496 },
+  { "bmw", 1, 0,  8500 },
+  { "bmx", 1, 0,  8508 },
+  { "bmz", 1, 0,  8515 },
+  { "bn", 0, 0,  6512 },
+  { "bna", 1, 0,  8522 },
+  { "bnb", 1, 0,  8531 },
+  { "bnc", 1, 0,  8538 },
+  { "bnd", 1, 0,  8545 },
+  { "bne", 1, 0,  8563 },
+  { "bnf", 1, 0,  8572 },
+  { "bng", 1, 0,  8581 },
+  { "bni", 1, 0,  8587 },
+  { "bnj", 1, 0,  8593 },
+  { "bnk", 1, 0,  8610 },
+  { "bnl", 1, 0,  8618 },
+  { "bnm", 1, 0,  8623 },
+  { "bnn", 1, 0,  8631 },
+  { "bno", 1, 0,  8637 },
+  { "bnp", 1, 0,  8647 },
+  { "bnq", 1, 0,  8652 },
+  { "bnr", 1, 0,  8659 },
+  { "bns", 1, 0,  8670 },
+  { "bnt", 0, 0,  8678 },
+  { "bnu", 1, 0,  8692 },
+  { "bnv", 1, 0,  8700 },
+  { "bnw", 1, 0,  8708 },
+  { "bnx", 1, 0,  8714 },
+  { "bny", 1, 0,  8725 },
+  { "bnz", 1, 0,  8733 },
+  { "bo", 0, 0,  8740 },
+  { "boa", 1, 0,  8748 },
+  { "bob", 1, 0,  8753 },
+  { "bod", 1, 0,  8740 },
+  { "boe", 1, 0,  8759 },
+  { "bof", 1, 0,  8768 },
+  { "bog", 1, 0,  8774 },
+  { "boh", 1, 0,  8795 },
+  { "boi", 1, 0,  8800 },
+  { "boj", 1, 0,  8811 },
+  { "bok", 1, 0,  8817 },
+  { "bol", 1, 0,  8823 },
+  { "bom", 1, 0,  8828 },
+  { "bon", 1, 0,  8834 },
+  { "boo", 1, 0,  8839 },
+  { "bop", 1, 0,  8857 },
+  { "boq", 1, 0,  8866 },
+  { "bor", 1, 0,  8873 },
+  { "bos", 1, 0,  8881 },
+  { "bot", 1, 0,  8889 },
+  { "bou", 1, 0,  8895 },
+  { "bov", 1, 0,  8902 },
+  { "bow", 1, 0,  8909 },
+  { "box", 1, 0,  8914 },
+  { "boy", 1, 0,  8920 },
+  { "boz", 1, 0,  8952 },
+  { "bpa", 1, 0,  8967 },
+  { "bpc", 1, 0,  8975 },
+  { "bpd", 1, 0,  8980 },
+  { "bpe", 1, 0,  8992 },
+  { "bpg", 1, 0,  8998 },
+  { "bph", 1, 0,  9005 },
+  { "bpi", 1, 0,  9013 },
+  { "bpj", 1, 0,  9020 },
+  { "bpk", 1, 0,  9026 },
+  { "bpl", 1, 0,  9032 },
+  { "bpm", 1, 0,  9062 },
+  { "bpn", 1, 0,  9068 },
+  { "bpo", 1, 0,  9077 },
+  { "bpp", 1, 0,  9083 },
+  { "bpq", 1, 0,  9089 },
+  { "bpr", 1, 0,  9102 },
+  { "bps", 1, 0,  9119 },
+  { "bpt", 1, 0,  9136 },
+  { "bpu", 1, 0,  9149 },
+  { "bpv", 1, 0,  9155 },
+  { "bpw", 1, 0,  9168 },
+  { "bpx", 1, 0,  9190 },
+  { "bpy", 1, 0,  9204 },
+  { "bpz", 1, 0,  9216 },
+  { "bqa", 1, 0,  9222 },
+  { "bqb", 1, 0,  9232 },
+  { "bqc", 1, 0,  9239 },
+  { "bqd", 1, 0,  9252 },
+  { "bqf", 1, 0,  9257 },
+  { "bqg", 1, 0,  9269 },
+  { "bqh", 1, 0,  9282 },
+  { "bqi", 1, 0,  9288 },
+  { "bqj", 1, 0,  9298 },
+  { "bqk", 1, 0,  9306 },
+  { "bql", 1, 0,  9319 },
+  { "bqm", 1, 0,  9328 },
+  { "bqn", 1, 0,  9336 },
+  { "bqo", 1, 0,  9360 },
+  { "bqp", 1, 0,  9365 },
+  { "bqq", 1, 0,  9370 },
+  { "bqr", 1, 0,  9378 },
+  { "bqs", 1, 0,  9385 },
+  { "bqt", 1, 0,  9393 },
+  { "bqu", 1, 0,  9404 },
+  { "bqv", 1, 0,  9411 },
+  { "bqw", 1, 0,  9422 },
+  { "bqx", 1, 0,  9437 },
+  { "bqy", 1, 0,  9444 },
+  { "bqz", 1, 0,  9467 },
+  { "br", 0, 0,  9474 },
+  { "bra", 1, 0,  9481 },
+  { "brb", 1, 0,  9486 },
+  { "brc", 1, 0,  9491 },
+  { "brd", 1, 0,  9513 },
+  { "bre", 1, 0,  9474 },
+  { "brf", 1, 0,  9521 },
+  { "brg", 1, 0,  9526 },
+  { "brh", 1, 0,  9532 },
+  { "bri", 1, 0,  9539 },
+  { "brj", 1, 0,  9546 },
+  { "brk", 1, 0,  9553 },
+  { "brl", 1, 0,  9560 },
+  { "brm", 1, 0,  9566 },
+  { "brn", 1, 0,  9574 },
+  { "bro", 1, 0,  9581 },
+  { "brp", 1, 0,  9589 },
+  { "brq", 1, 0,  9598 },
+  { "brr", 1, 0,  9604 },
+  { "brs", 1, 0,  9610 },
+  { "brt", 1, 0,  9616 },
+  { "bru", 1, 0,  9623 },
+  { "brv", 1, 0,  9636 },
+  { "brw", 1, 0,  9649 },
+  { "brx", 1, 0,  9657 },
+  { "bry", 1, 0,  9670 },
+  { "brz", 1, 0,  9676 },
+  { "bs", 0, 0,  8881 },
+  { "bsa", 1, 0,  9683 },
+  { "bsb", 1, 0,  9691 },
+  { "bsc", 1, 0,  9706 },
+  { "bse", 1, 0,  9714 },
+  { "bsf", 1, 0,  9720 },
+  { "bsg", 1, 0,  9727 },
+  { "bsh", 1, 0,  9737 },
+  { "bsi", 1, 0,  9742 },
+  { "bsj", 1, 0,  9751 },
+  { "bsk", 1, 0,  9761 },
+  { "bsl", 1, 0,  9772 },
+  { "bsm", 1, 0,  9783 },
+  { "bsn", 1, 0,  9790 },
+  { "bso", 1, 0,  9806 },
+  { "bsp", 1, 0,  9811 },
+  { "bsq", 1, 0,  9823 },
+  { "bsr", 1, 0,  9829 },
+  { "bss", 1, 0,  9845 },
+  { "bst", 1, 0,  9852 },
+  { "bsu", 1, 0,  9860 },
+  { "bsv", 1, 0,  9870 },
+  { "bsw", 1, 0,  9883 },
+  { "bsx", 1, 0,  9889 },
+  { "bsy", 1, 0,  9897 },
+  { "bta", 1, 0,  9911 },
+  { "btc", 1, 0,  9916 },
+  { "btd", 1, 0,  9932 },
+  { "bte", 1, 0,  9944 },
+  { "btf", 1, 0,  9955 },
+  { "btg", 1, 0,  9962 },
+  { "bth", 1, 0,  9977 },
+  { "bti", 1, 0,  9993 },
+  { "btj", 1, 0, 10000 },
+  { "btk", 0, 0, 10016 },
+  { "btm", 1, 0, 10032 },
+  { "btn", 1, 0, 10049 },
+  { "bto", 1, 0, 10058 },
+  { "btp", 1, 0, 10075 },
+  { "btq", 1, 0, 10083 },
+  { "btr", 1, 0, 10089 },
+  { "bts", 1, 0, 10097 },
+  { "btt", 1, 0, 10114 },
+  { "btu", 1, 0, 10125 },
+  { "btv", 1, 0, 10130 },
+  { "btw", 1, 0, 10137 },
+  { "btx", 1, 0, 10146 },
+  { "bty", 1, 0, 10157 },
+  { "btz", 1, 0, 10163 },
+  { "bua", 1, 0, 10180 },
+  { "bub", 1, 0, 10187 },
+  { "buc", 1, 0, 10191 },
+  { "bud", 1, 0, 10197 },
+  { "bue", 1, 0, 10204 },
+  { "buf", 1, 0, 10212 },
+  { "bug", 1, 0, 10221 },
+  { "buh", 1, 0, 10230 },
+  { "bui", 1, 0, 10243 },
+  { "buj", 1, 0, 10251 },
+  { "buk", 1, 0, 10264 },
+  { "bul", 1, 0,  6902 },
+  { "bum", 1, 0, 10272 },
+  { "bun", 1, 0, 10288 },
+  { "buo", 1, 0, 10296 },
+  { "bup", 1, 0, 10302 },
+  { "buq", 1, 0, 10308 },
+  { "bur", 0, 0, 10313 },
+  { "bus", 1, 0, 10321 },
+  { "but", 1, 0, 10330 },
+  { "buu", 1, 0, 10338 },
+  { "buv", 1, 0, 10343 },
+  { "buw", 1, 0, 10347 },
+  { "bux", 1, 0, 10352 },
+  { "buy", 1, 0, 10359 },
+  { "buz", 1, 0, 10369 },
+  { "bva", 1, 0, 10376 },
+  { "bvb", 1, 0, 10383 },
+  { "bvc", 1, 0, 10388 },
+  { "bvd", 1, 0, 10397 },
+  { "bve", 1, 0, 10404 },
+  { "bvf", 1, 0, 10417 },
+  { "bvg", 1, 0, 10422 },
+  { "bvh", 1, 0, 10430 },
+  { "bvi", 1, 0, 10435 },
+  { "bvj", 1, 0, 10448 },
+  { "bvk", 1, 0, 10453 },
+  { "bvl", 1, 0, 10459 },
+  { "bvm", 1, 0, 10482 },
+  { "bvn", 1, 0, 10490 },
+  { "bvo", 1, 0, 10495 },
+  { "bvp", 1, 0, 10501 },
+  { "bvq", 1, 0, 10508 },
+  { "bvr", 1, 0, 10514 },
+  { "bvt", 1, 0, 10522 },
+  { "bvu", 1, 0, 10539 },
+  { "bvv", 1, 0, 10552 },
+  { "bvw", 1, 0, 10559 },
+  { "bvx", 1, 0, 10564 },
+  { "bvy", 1, 0, 10571 },
+  { "bvz", 1, 0, 10582 },
+  { "bwa", 1, 0, 10588 },
+  { "bwb", 1, 0, 10595 },
+  { "bwc", 1, 0, 10618 },
+  { "bwd", 1, 0, 10624 },
+  { "bwe", 1, 0, 10633 },
+  { "bwf", 1, 0, 10644 },
+  { "bwg", 1, 0, 10653 },
+  { "bwh", 1, 0, 10659 },
+  { "bwi", 1, 0, 10666 },
+  { "bwj", 1, 0, 10673 },
+  { "bwk", 1, 0, 10692 },
+  { "bwl", 1, 0, 10700 },
+  { "bwm", 1, 0, 10706 },
+  { "bwn", 1, 0, 10712 },
+  { "bwo", 1, 0, 10724 },
+  { "bwp", 1, 0, 10740 },
+  { "bwq", 1, 0, 10754 },
+  { "bwr", 1, 0, 10777 },
+  { "bws", 1, 0, 10788 },
+  { "bwt", 1, 0, 10796 },
+  { "bwu", 1, 0, 10809 },
+  { "bww", 1, 0, 10822 },
+  { "bwx", 1, 0, 10826 },
+  { "bwy", 1, 0, 10839 },
+  { "bwz", 1, 0, 10850 },
+  { "bxa", 1, 0, 10856 },
+  { "bxb", 1, 0, 10864 },
+  { "bxc", 1, 0, 10877 },
+  { "bxd", 1, 0, 10886 },
+  { "bxe", 1, 0, 10891 },
+  { "bxf", 1, 0, 10898 },
+  { "bxg", 1, 0, 10904 },
+  { "bxh", 1, 0, 10912 },
+  { "bxi", 1, 0, 10919 },
+  { "bxj", 1, 0, 10929 },
+  { "bxk", 1, 0, 10937 },
+  { "bxl", 1, 0, 10944 },
+  { "bxm", 1, 0, 10953 },
+  { "bxn", 1, 0, 10970 },
+  { "bxo", 1, 0, 10978 },
+  { "bxp", 1, 0, 10989 },
+  { "bxq", 1, 0, 10995 },
+  { "bxr", 1, 0, 11001 },
+  { "bxs", 1, 0, 11016 },
+  { "bxu", 1, 0, 11022 },
+  { "bxv", 1, 0, 11036 },
+  { "bxw", 1, 0, 11044 },
+  { "bxz", 1, 0, 11055 },
+  { "bya", 1, 0, 11064 },
+  { "byb", 1, 0, 11070 },
+  { "byc", 1, 0, 11076 },
+  { "byd", 1, 0, 11085 },
+  { "bye", 1, 0, 11094 },
+  { "byf", 1, 0, 11100 },
+  { "byg", 1, 0, 11105 },
+  { "byh", 1, 0, 11111 },
+  { "byi", 1, 0, 11118 },
+  { "byj", 1, 0, 11123 },
+  { "byk", 1, 0, 11138 },
+  { "byl", 1, 0, 11143 },
+  { "bym", 1, 0, 11150 },
+  { "byn", 1, 0, 11158 },
+  { "byo", 1, 0, 11164 },
+  { "byp", 1, 0, 11169 },
+  { "byq", 1, 0, 11176 },
+  { "byr", 1, 0, 11182 },
+  { "bys", 1, 0, 11189 },
+  { "byt", 1, 0, 11195 },
+  { "byv", 1, 0, 11201 },
+  { "byw", 1, 0, 11209 },
+  { "byx", 1, 0, 11219 },
+  { "byz", 1, 0, 11225 },
+  { "bza", 1, 0, 11232 },
+  { "bzb", 1, 0, 11238 },
+  { "bzc", 1, 0, 11244 },
+  { "bzd", 1, 0, 11277 },
+  { "bze", 1, 0, 11284 },
+  { "bzf", 1, 0, 11298 },
+  { "bzg", 1, 0, 11305 },
+  { "bzh", 1, 0, 11312 },
+  { "bzi", 1, 0, 11325 },
+  { "bzj", 1, 0, 11330 },
+  { "bzk", 1, 0, 11352 },
+  { "bzl", 1, 0, 11378 },
+  { "bzm", 1, 0, 11395 },
+  { "bzn", 1, 0, 11403 },
+  { "bzo", 1, 0, 11418 },
+  { "bzp", 1, 0, 11425 },
+  { "bzq", 1, 0, 11435 },
+  { "bzr", 1, 0, 11452 },
+  { "bzs", 1, 0, 11457 },
+  { "bzt", 1, 0, 11481 },
+  { "bzu", 1, 0, 11491 },
+  { "bzv", 1, 0, 11499 },
+  { "bzw", 1, 0, 11505 },
+  { "bzx", 1, 0, 11520 },
+  { "bzy", 1, 0, 11538 },
+  { "bzz", 1, 0, 11547 },
+  { "ca", 0, 0, 11553 },
+  { "caa", 1, 0, 11572 },
+  { "cab", 1, 0, 11580 },
+  { "cac", 1, 0, 11589 },
+  { "cad", 1, 0, 11594 },
+  { "cae", 1, 0, 11600 },
+  { "caf", 1, 0, 11606 },
+  { "cag", 1, 0, 11624 },
+  { "cah", 1, 0, 11633 },
+  { "cai", 0, 0, 11643 },
+  { "caj", 1, 0, 11677 },
+  { "cak", 1, 0, 11684 },
+  { "cal", 1, 0, 11694 },
+  { "cam", 1, 0, 11705 },
+  { "can", 1, 0, 11713 },
+  { "cao", 1, 0, 11721 },
+  { "cap", 1, 0, 11730 },
+  { "caq", 1, 0, 11738 },
+  { "car", 1, 0, 11754 },
+  { "cas", 1, 0, 11768 },
+  { "cat", 1, 0, 11777 },
+  { "cau", 0, 0, 11785 },
+  { "cav", 1, 0, 11805 },
+  { "caw", 1, 0, 11815 },
+  { "cax", 1, 0, 11826 },
+  { "cay", 1, 0, 11837 },
+  { "caz", 1, 0, 11844 },
+  { "cbb", 1, 0, 11854 },
+  { "cbc", 1, 0, 11864 },
+  { "cbd", 1, 0, 11873 },
+  { "cbg", 1, 0, 11882 },
+  { "cbi", 1, 0, 11890 },
+  { "cbj", 1, 0, 11897 },
+  { "cbk", 1, 0, 11906 },
+  { "cbl", 1, 0, 11916 },
+  { "cbn", 1, 0, 11931 },
+  { "cbo", 1, 0, 11939 },
+  { "cbq", 1, 0, 11945 },
+  { "cbr", 1, 0, 11953 },
+  { "cbs", 1, 0, 11971 },
+  { "cbt", 1, 0, 11982 },
+  { "cbu", 1, 0, 11993 },
+  { "cbv", 1, 0, 12009 },
+  { "cbw", 1, 0, 12015 },
+  { "cby", 1, 0, 12026 },
+  { "ccc", 1, 0, 12035 },
+  { "ccd", 1, 0, 12045 },
+  { "cce", 1, 0, 12061 },
+  { "ccg", 1, 0, 12067 },
+  { "cch", 1, 0, 12079 },
+  { "ccj", 1, 0, 12085 },
+  { "ccl", 1, 0, 12093 },
+  { "ccm", 1, 0, 12108 },
+  { "cco", 1, 0, 12131 },
+  { "ccp", 1, 0, 12153 },
+  { "ccr", 1, 0, 12160 },
+  { "cda", 1, 0, 12170 },
+  { "cde", 1, 0, 12176 },
+  { "cdf", 1, 0, 12184 },
+  { "cdh", 1, 0, 12190 },
+  { "cdi", 1, 0, 12200 },
+  { "cdj", 1, 0, 12207 },
+  { "cdm", 1, 0, 12215 },
+  { "cdn", 1, 0, 12223 },
+  { "cdo", 1, 0, 12234 },
+  { "cdr", 1, 0, 12252 },
+  { "cds", 1, 0, 12269 },
+  { "cdy", 1, 0, 12291 },
+  { "cdz", 1, 0, 12299 },
+  { "ce", 0, 0, 12304 },
+  { "cea", 1, 0, 12312 },
+  { "ceb", 1, 0, 12328 },
+  { "ceg", 1, 0, 12336 },
+  { "cek", 1, 0, 12346 },
+  { "cel", 0, 0, 12366 },
+  { "cen", 1, 0, 12383 },
+  { "ces", 1, 0, 12387 },
+  { "cet", 1, 0, 12393 },
+  { "cey", 1, 0, 12403 },
+  { "cfa", 1, 0, 12414 },
+  { "cfd", 1, 0, 12427 },
+  { "cfg", 1, 0, 12432 },
+  { "cfm", 1, 0, 12443 },
+  { "cga", 1, 0, 12455 },
+  { "cgc", 1, 0, 12465 },
+  { "cgg", 1, 0, 12475 },
+  { "cgk", 1, 0, 12481 },
+  { "ch", 0, 0, 12495 },
+  { "cha", 1, 0, 12495 },
+  { "chb", 1, 0, 12504 },
+  { "chc", 1, 0, 12512 },
+  { "chd", 1, 0, 12520 },
+  { "che", 1, 0, 12304 },
+  { "chf", 1, 0, 12545 },
+  { "chg", 1, 0, 12562 },
+  { "chh", 1, 0, 12571 },
+  { "chi", 0, 0, 12579 },
+  { "chj", 1, 0, 12587 },
+  { "chk", 1, 0, 12607 },
+  { "chl", 1, 0, 12616 },
+  { "chm", 1, 0, 12625 },
+  { "chn", 1, 0, 12639 },
+  { "cho", 1, 0, 12654 },
+  { "chp", 1, 0, 12662 },
+  { "chq", 1, 0, 12672 },
+  { "chr", 1, 0, 12693 },
+  { "cht", 1, 0, 12702 },
+  { "chu", 1, 0, 12710 },
+  { "chv", 1, 0, 12725 },
+  { "chw", 1, 0, 12733 },
+  { "chx", 1, 0, 12741 },
+  { "chy", 1, 0, 12750 },
+  { "chz", 1, 0, 12759 },
+  { "cia", 1, 0, 12780 },
+  { "cib", 1, 0, 12788 },
+  { "cic", 1, 0, 12796 },
+  { "cid", 1, 0, 12806 },
+  { "cie", 1, 0, 12816 },
+  { "cih", 1, 0, 12823 },
+  { "cik", 1, 0, 12831 },
+  { "cim", 1, 0, 12850 },
+  { "cin", 1, 0, 12859 },
+  { "cip", 1, 0, 12871 },
+  { "cir", 1, 0, 12881 },
+  { "ciw", 1, 0, 12886 },
+  { "ciy", 1, 0, 12895 },
+  { "cja", 1, 0, 12902 },
+  { "cje", 1, 0, 12916 },
+  { "cjh", 1, 0, 12921 },
+  { "cji", 1, 0, 12937 },
+  { "cjk", 1, 0, 12946 },
+  { "cjm", 1, 0, 12953 },
+  { "cjn", 1, 0, 12967 },
+  { "cjo", 1, 0, 12977 },
+  { "cjp", 1, 0, 12996 },
+  { "cjs", 1, 0, 13005 },
+  { "cjv", 1, 0, 13010 },
+  { "cjy", 1, 0, 13017 },
+  { "ckb", 1, 0, 13032 },
+  { "ckh", 1, 0, 13049 },
+  { "ckl", 1, 0, 13054 },
+  { "ckm", 1, 0, 13060 },
+  { "ckn", 1, 0, 13070 },
+  { "cko", 1, 0, 13082 },
+  { "ckq", 1, 0, 13088 },
+  { "ckr", 1, 0, 13096 },
+  { "cks", 1, 0, 13103 },
+  { "ckt", 1, 0, 13108 },
+  { "cku", 1, 0, 13115 },
+  { "ckv", 1, 0, 13123 },
+  { "ckx", 1, 0, 13131 },
+  { "cky", 1, 0, 13136 },
+  { "ckz", 1, 0, 13151 },
+  { "cla", 1, 0, 13185 },
+  { "clc", 1, 0, 13189 },
+  { "cld", 1, 0, 13199 },
+  { "cle", 1, 0, 13221 },
+  { "clh", 1, 0, 13239 },
+  { "cli", 1, 0, 13248 },
+  { "clj", 1, 0, 13256 },
+  { "clk", 1, 0, 13268 },
+  { "cll", 1, 0, 13279 },
+  { "clm", 1, 0, 13285 },
+  { "clo", 1, 0, 13293 },
+  { "clt", 1, 0, 13317 },
+  { "clu", 1, 0, 13329 },
+  { "clw", 1, 0, 13339 },
+  { "cly", 1, 0, 13346 },
+  { "cma", 1, 0, 13372 },
+  { "cmc", 0, 0, 13376 },
+  { "cme", 1, 0, 13393 },
+  { "cmg", 1, 0, 13399 },
+  { "cmi", 1, 0, 13420 },
+  { "cml", 1, 0, 13435 },
+  { "cmm", 1, 0, 13447 },
+  { "cmn", 1, 0, 13458 },
+  { "cmo", 1, 0, 13476 },
+  { "cmr", 1, 0, 13491 },
+  { "cms", 1, 0, 13507 },
+  { "cmt", 1, 0, 13516 },
+  { "cna", 1, 0, 13523 },
+  { "cnb", 1, 0, 13534 },
+  { "cnc", 1, 0, 13548 },
+  { "cng", 1, 0, 13556 },
+  { "cnh", 1, 0, 13572 },
+  { "cni", 1, 0, 13584 },
+  { "cnk", 1, 0, 13595 },
+  { "cnl", 1, 0, 13607 },
+  { "cno", 1, 0, 13625 },
+  { "cnp", 1, 0, 13629 },
+  { "cnq", 1, 0, 13652 },
+  { "cnr", 1, 0, 13658 },
+  { "cns", 1, 0, 13670 },
+  { "cnt", 1, 0, 13685 },
+  { "cnu", 1, 0, 13708 },
+  { "cnw", 1, 0, 13716 },
+  { "cnx", 1, 0, 13728 },
+  { "co", 0, 0, 13744 },
+  { "coa", 1, 0, 13753 },
+  { "cob", 1, 0, 13774 },
+  { "coc", 1, 0, 13788 },
+  { "cod", 1, 0, 13795 },
+  { "coe", 1, 0, 13812 },
+  { "cof", 1, 0, 13822 },
+  { "cog", 1, 0, 13831 },
+  { "coh", 1, 0, 13837 },
+  { "coj", 1, 0, 13858 },
+  { "cok", 1, 0, 13866 },
+  { "col", 1, 0, 13885 },
+  { "com", 1, 0, 13903 },
+  { "con", 1, 0, 13912 },
+  { "coo", 1, 0, 13919 },
+  { "cop", 1, 0, 13925 },
+  { "coq", 1, 0, 13932 },
+  { "cor", 1, 0, 13941 },
+  { "cos", 1, 0, 13744 },
+  { "cot", 1, 0, 13949 },
+  { "cou", 1, 0, 13958 },
+  { "cov", 1, 0, 13964 },
+  { "cow", 1, 0, 13973 },
+  { "cox", 1, 0, 13981 },
+  { "coz", 1, 0, 13987 },
+  { "cpa", 1, 0, 13997 },
+  { "cpb", 1, 0, 14017 },
+  { "cpc", 1, 0, 14044 },
+  { "cpe", 0, 0, 14067 },
+  { "cpf", 0, 0, 14102 },
+  { "cpg", 1, 0, 14136 },
+  { "cpi", 1, 0, 14155 },
+  { "cpn", 1, 0, 14179 },
+  { "cpo", 1, 0, 14188 },
+  { "cpp", 0, 0, 14195 },
+  { "cps", 1, 0, 14233 },
+  { "cpu", 1, 0, 14242 },
+  { "cpx", 1, 0, 14261 },
+  { "cpy", 1, 0, 14278 },
+  { "cqd", 1, 0, 14304 },
+  { "cr", 0, 0, 14332 },
+  { "cra", 1, 0, 14337 },
+  { "crb", 1, 0, 14343 },
+  { "crc", 1, 0, 14357 },
+  { "crd", 1, 0, 14367 },
+  { "cre", 1, 0, 14332 },
+  { "crf", 1, 0, 14381 },
+  { "crg", 1, 0, 14391 },
+  { "crh", 1, 0, 14398 },
+  { "cri", 1, 0, 14413 },
+  { "crj", 1, 0, 14425 },
+  { "crk", 1, 0, 14445 },
+  { "crl", 1, 0, 14458 },
+  { "crm", 1, 0, 14478 },
+  { "crn", 1, 0, 14490 },
+  { "cro", 1, 0, 14505 },
+  { "crp", 0, 0, 14510 },
+  { "crq", 1, 0, 14530 },
+  { "crr", 1, 0, 14549 },
+  { "crs", 1, 0, 14570 },
+  { "crt", 1, 0, 14593 },
+  { "crv", 1, 0, 14612 },
+  { "crw", 1, 0, 14619 },
+  { "crx", 1, 0, 14625 },
+  { "cry", 1, 0, 14633 },
+  { "crz", 1, 0, 14638 },
+  { "cs", 0, 0, 12387 },
+  { "csa", 1, 0, 14647 },
+  { "csb", 1, 0, 14668 },
+  { "csc", 1, 0, 14678 },
+  { "csd", 1, 0, 14700 },
+  { "cse", 1, 0, 14724 },
+  { "csf", 1, 0, 14744 },
+  { "csg", 1, 0, 14763 },
+  { "csh", 1, 0, 14785 },
+  { "csi", 1, 0, 14796 },
+  { "csj", 1, 0, 14809 },
+  { "csk", 1, 0, 14823 },
+  { "csl", 1, 0, 14833 },
+  { "csm", 1, 0, 14855 },
+  { "csn", 1, 0, 14877 },
+  { "cso", 1, 0, 14901 },
+  { "csp", 1, 0, 14922 },
+  { "csq", 1, 0, 14945 },
+  { "csr", 1, 0, 14967 },
+  { "css", 1, 0, 14993 },
+  { "cst", 1, 0, 15010 },
+  { "csv", 1, 0, 15027 },
+  { "csw", 1, 0, 15039 },
+  { "csx", 1, 0, 15052 },
+  { "csy", 1, 0, 15076 },
+  { "csz", 1, 0, 15088 },
+  { "cta", 1, 0, 15093 },
+  { "ctc", 1, 0, 15113 },
+  { "ctd", 1, 0, 15120 },
+  { "cte", 1, 0, 15132 },
+  { "ctg", 1, 0, 15152 },
+  { "cth", 1, 0, 15165 },
+  { "ctl", 1, 0, 15180 },
+  { "ctm", 1, 0, 15207 },
+  { "ctn", 1, 0, 15218 },
+  { "cto", 1, 0, 15229 },
+  { "ctp", 1, 0, 15244 },
+  { "cts", 1, 0, 15270 },
+  { "ctt", 1, 0, 15298 },
+  { "ctu", 1, 0, 15314 },
+  { "cty", 1, 0, 15319 },
+  { "ctz", 1, 0, 15336 },
+  { "cu", 0, 0, 15355 },
+  { "cua", 1, 0, 15436 },
+  { "cub", 1, 0, 15440 },
+  { "cuc", 1, 0, 15446 },
+  { "cuh", 1, 0, 15463 },
+  { "cui", 1, 0, 15469 },
+  { "cuj", 1, 0, 15475 },
+  { "cuk", 1, 0, 15487 },
+  { "cul", 1, 0, 15502 },
+  { "cuo", 1, 0, 15509 },
+  { "cup", 1, 0, 15520 },
+  { "cuq", 1, 0, 15528 },
+  { "cur", 1, 0, 15532 },
+  { "cus", 0, 0, 15541 },
+  { "cut", 1, 0, 15560 },
+  { "cuu", 1, 0, 15578 },
+  { "cuv", 1, 0, 15585 },
+  { "cuw", 1, 0, 15591 },
+  { "cux", 1, 0, 15598 },
+  { "cuy", 1, 0, 15618 },
+  { "cv", 0, 0, 12725 },
+  { "cvg", 1, 0, 15628 },
+  { "cvn", 1, 0, 15633 },
+  { "cwa", 1, 0, 15659 },
+  { "cwb", 1, 0, 15665 },
+  { "cwd", 1, 0, 15672 },
+  { "cwe", 1, 0, 15684 },
+  { "cwg", 1, 0, 15690 },
+  { "cwt", 1, 0, 15698 },
+  { "cy", 0, 0, 15708 },
+  { "cya", 1, 0, 15714 },
+  { "cyb", 1, 0, 15730 },
+  { "cym", 1, 0, 15708 },
+  { "cyo", 1, 0, 15739 },
+  { "cze", 0, 0, 12387 },
+  { "czh", 1, 0, 15747 },
+  { "czk", 1, 0, 15764 },
+  { "czn", 1, 0, 15772 },
+  { "czo", 1, 0, 15793 },
+  { "czt", 1, 0, 15812 },
+  { "da", 0, 0, 15825 },
+  { "daa", 1, 0, 15832 },
+  { "dac", 1, 0, 15843 },
+  { "dad", 1, 0, 15849 },
+  { "dae", 1, 0, 15855 },
+  { "dag", 1, 0, 15861 },
+  { "dah", 1, 0, 15869 },
+  { "dai", 1, 0, 15879 },
+  { "daj", 1, 0, 15883 },
+  { "dak", 1, 0, 15897 },
+  { "dal", 1, 0, 15904 },
+  { "dam", 1, 0, 15911 },
+  { "dan", 1, 0, 15825 },
+  { "dao", 1, 0, 15920 },
+  { "daq", 1, 0, 15931 },
+  { "dar", 1, 0, 15946 },
+  { "das", 1, 0, 15953 },
+  { "dau", 1, 0, 15962 },
+  { "dav", 1, 0, 15977 },
+  { "daw", 1, 0, 15983 },
+  { "dax", 1, 0, 15993 },
+  { "day", 0, 0, 15998 },
+  { "daz", 1, 0, 16019 },
+  { "dba", 1, 0, 16023 },
+  { "dbb", 1, 0, 16031 },
+  { "dbd", 1, 0, 16036 },
+  { "dbe", 1, 0, 16043 },
+  { "dbf", 1, 0, 16048 },
+  { "dbg", 1, 0, 16054 },
+  { "dbi", 1, 0, 16071 },
+  { "dbj", 1, 0, 16076 },
+  { "dbl", 1, 0, 16083 },
+  { "dbm", 1, 0, 16091 },
+  { "dbn", 1, 0, 16098 },
+  { "dbo", 1, 0, 16109 },
+  { "dbp", 1, 0, 16115 },
+  { "dbq", 1, 0, 16121 },
+  { "dbr", 1, 0, 16126 },
+  { "dbt", 1, 0, 16134 },
+  { "dbu", 1, 0, 16149 },
+  { "dbv", 1, 0, 16167 },
+  { "dbw", 1, 0, 16173 },
+  { "dby", 1, 0, 16191 },
+  { "dcc", 1, 0, 16200 },
+  { "dcr", 1, 0, 16207 },
+  { "dda", 1, 0, 16221 },
+  { "ddd", 1, 0, 16231 },
+  { "dde", 1, 0, 16241 },
+  { "ddg", 1, 0, 16248 },
+  { "ddi", 1, 0, 16257 },
+  { "ddj", 1, 0, 16274 },
+  { "ddn", 1, 0, 16279 },
+  { "ddo", 1, 0, 16293 },
+  { "ddr", 1, 0, 16298 },
+  { "dds", 1, 0, 16308 },
+  { "ddw", 1, 0, 16324 },
+  { "de", 0, 0, 16340 },
+  { "dec", 1, 0, 16347 },
+  { "ded", 1, 0, 16353 },
+  { "dee", 1, 0, 16359 },
+  { "def", 1, 0, 16366 },
+  { "deg", 1, 0, 16374 },
+  { "deh", 1, 0, 16381 },
+  { "dei", 1, 0, 16389 },
+  { "dek", 1, 0, 16396 },
+  { "del", 1, 0, 16400 },
+  { "dem", 1, 0, 16409 },
+  { "den", 1, 0, 16413 },
+  { "dep", 1, 0, 16432 },
+  { "deq", 1, 0, 16449 },
+  { "der", 1, 0, 16482 },
+  { "des", 1, 0, 16488 },
+  { "deu", 1, 0, 16340 },
+  { "dev", 1, 0, 16495 },
+  { "dez", 1, 0, 16502 },
+  { "dga", 1, 0, 16510 },
+  { "dgb", 1, 0, 16528 },
+  { "dgc", 1, 0, 16542 },
+  { "dgd", 1, 0, 16566 },
+  { "dge", 1, 0, 16581 },
+  { "dgg", 1, 0, 16589 },
+  { "dgh", 1, 0, 16594 },
+  { "dgi", 1, 0, 16602 },
+  { "dgk", 1, 0, 16619 },
+  { "dgl", 1, 0, 16625 },
+  { "dgn", 1, 0, 16634 },
+  { "dgo", 1, 0, 16642 },
+  { "dgr", 1, 0, 16670 },
+  { "dgs", 1, 0, 16677 },
+  { "dgt", 1, 0, 16684 },
+  { "dgw", 1, 0, 16695 },
+  { "dgx", 1, 0, 16708 },
+  { "dgz", 1, 0, 16716 },
+  { "dhd", 1, 0, 16721 },
+  { "dhg", 1, 0, 16730 },
+  { "dhi", 1, 0, 16744 },
+  { "dhl", 1, 0, 16751 },
+  { "dhm", 1, 0, 16761 },
+  { "dhn", 1, 0, 16767 },
+  { "dho", 1, 0, 16774 },
+  { "dhr", 1, 0, 16781 },
+  { "dhs", 1, 0, 16790 },
+  { "dhu", 1, 0, 16797 },
+  { "dhv", 1, 0, 16804 },
+  { "dhw", 1, 0, 16809 },
+  { "dhx", 1, 0, 16825 },
+  { "dia", 1, 0, 16835 },
+  { "dib", 1, 0, 16839 },
+  { "dic", 1, 0, 16860 },
+  { "did", 1, 0, 16873 },
+  { "dif", 1, 0, 16881 },
+  { "dig", 1, 0, 16887 },
+  { "dih", 1, 0, 16892 },
+  { "dii", 1, 0, 16899 },
+  { "dij", 1, 0, 16907 },
+  { "dik", 1, 0, 16911 },
+  { "dil", 1, 0, 16931 },
+  { "dim", 1, 0, 16939 },
+  { "din", 1, 0, 16944 },
+  { "dio", 1, 0, 16950 },
+  { "dip", 1, 0, 16955 },
+  { "diq", 1, 0, 16975 },
+  { "dir", 1, 0, 17003 },
+  { "dis", 1, 0, 17009 },
+  { "diu", 1, 0, 17016 },
+  { "div", 1, 0, 17023 },
+  { "diw", 1, 0, 17031 },
+  { "dix", 1, 0, 17051 },
+  { "diy", 1, 0, 17062 },
+  { "diz", 1, 0, 17068 },
+  { "dja", 1, 0, 17073 },
+  { "djb", 1, 0, 17087 },
+  { "djc", 1, 0, 17094 },
+  { "djd", 1, 0, 17109 },
+  { "dje", 1, 0, 17121 },
+  { "djf", 1, 0, 17127 },
+  { "dji", 1, 0, 17135 },
+  { "djj", 1, 0, 17143 },
+  { "djk", 1, 0, 17153 },
+  { "djm", 1, 0, 17175 },
+  { "djn", 1, 0, 17189 },
+  { "djo", 1, 0, 17196 },
+  { "djr", 1, 0, 17205 },
+  { "dju", 1, 0, 17220 },
+  { "djw", 1, 0, 17229 },
+  { "dka", 1, 0, 17235 },
+  { "dkg", 1, 0, 17244 },
+  { "dkk", 1, 0, 17251 },
+  { "dkr", 1, 0, 17257 },
+  { "dks", 1, 0, 17264 },
+  { "dkx", 1, 0, 17284 },
+  { "dlg", 1, 0, 17293 },
+  { "dlk", 1, 0, 17300 },
+  { "dlm", 1, 0, 17308 },
+  { "dln", 1, 0, 17318 },
+  { "dma", 1, 0, 17326 },
+  { "dmb", 1, 0, 17331 },
+  { "dmc", 1, 0, 17344 },
+  { "dmd", 1, 0, 17350 },
+  { "dme", 1, 0, 17362 },
+  { "dmf", 1, 0, 17369 },
+  { "dmg", 1, 0, 17381 },
+  { "dmk", 1, 0, 17401 },
+  { "dml", 1, 0, 17409 },
+  { "dmm", 1, 0, 17416 },
+  { "dmo", 1, 0, 17421 },
+  { "dmr", 1, 0, 17431 },
+  { "dms", 1, 0, 17443 },
+  { "dmu", 1, 0, 17452 },
+  { "dmv", 1, 0, 17457 },
+  { "dmw", 1, 0, 17464 },
+  { "dmx", 1, 0, 17473 },
+  { "dmy", 1, 0, 17478 },
+  { "dna", 1, 0, 17484 },
+  { "dnd", 1, 0, 17509 },
+  { "dne", 1, 0, 17516 },
+  { "dng", 1, 0, 17526 },
+  { "dni", 1, 0, 17533 },
+  { "dnj", 1, 0, 17558 },
+  { "dnk", 1, 0, 17562 },
+  { "dnn", 1, 0, 17569 },
+  { "dno", 1, 0, 17580 },
+  { "dnr", 1, 0, 17587 },
+  { "dnt", 1, 0, 17594 },
+  { "dnu", 1, 0, 17617 },
+  { "dnv", 1, 0, 17623 },
+  { "dnw", 1, 0, 17628 },
+  { "dny", 1, 0, 17642 },
+  { "doa", 1, 0, 17648 },
+  { "dob", 1, 0, 17652 },
+  { "doc", 1, 0, 17657 },
+  { "doe", 1, 0, 17672 },
+  { "dof", 1, 0, 17676 },
+  { "doh", 1, 0, 17681 },
+  { "doi", 1, 0, 17686 },
+  { "dok", 1, 0, 17708 },
+  { "dol", 1, 0, 17714 },
+  { "don", 1, 0, 17719 },
+  { "doo", 1, 0, 17744 },
+  { "dop", 1, 0, 17750 },
+  { "doq", 1, 0, 17756 },
+  { "dor", 1, 0, 17780 },
+  { "dos", 1, 0, 17787 },
+  { "dot", 1, 0, 17795 },
+  { "dov", 1, 0, 17800 },
+  { "dow", 1, 0, 17806 },
+  { "dox", 1, 0, 17813 },
+  { "doy", 1, 0, 17819 },
+  { "doz", 1, 0, 17825 },
+  { "dpp", 1, 0, 17831 },
+  { "dra", 0, 0, 17837 },
+  { "drb", 1, 0, 17857 },
+  { "drc", 1, 0, 17862 },
+  { "drd", 1, 0, 17872 },
+  { "dre", 1, 0, 17880 },
+  { "drg", 1, 0, 17886 },
+  { "dri", 1, 0, 17893 },
+  { "drl", 1, 0, 17900 },
+  { "drn", 1, 0, 17910 },
+  { "dro", 1, 0, 17922 },
+  { "drq", 1, 0, 17941 },
+  { "drs", 1, 0, 17946 },
+  { "drt", 1, 0, 17952 },
+  { "dru", 1, 0, 17959 },
+  { "dry", 1, 0, 17965 },
+  { "dsb", 1, 0, 17971 },
+  { "dse", 1, 0, 17986 },
+  { "dsh", 1, 0, 18006 },
+  { "dsi", 1, 0, 18016 },
+  { "dsl", 1, 0, 18021 },
+  { "dsn", 1, 0, 18042 },
+  { "dso", 1, 0, 18049 },
+  { "dsq", 1, 0, 18056 },
+  { "dsz", 1, 0, 18067 },
+  { "dta", 1, 0, 18088 },
+  { "dtb", 1, 0, 18093 },
+  { "dtd", 1, 0, 18121 },
+  { "dth", 1, 0, 18130 },
+  { "dti", 1, 0, 18146 },
+  { "dtk", 1, 0, 18163 },
+  { "dtm", 1, 0, 18179 },
+  { "dtn", 1, 0, 18195 },
+  { "dto", 1, 0, 18208 },
+  { "dtp", 1, 0, 18224 },
+  { "dtr", 1, 0, 18239 },
+  { "dts", 1, 0, 18245 },
+  { "dtt", 1, 0, 18260 },
+  { "dtu", 1, 0, 18277 },
+  { "dty", 1, 0, 18294 },
+  { "dua", 1, 0, 18302 },
+  { "dub", 1, 0, 18308 },
+  { "duc", 1, 0, 18314 },
+  { "due", 1, 0, 18319 },
+  { "duf", 1, 0, 18340 },
+  { "dug", 1, 0, 18347 },
+  { "duh", 1, 0, 18354 },
+  { "dui", 1, 0, 18366 },
+  { "duk", 1, 0, 18372 },
+  { "dul", 1, 0, 18382 },
+  { "dum", 1, 0, 18402 },
+  { "dun", 1, 0, 18432 },
+  { "duo", 1, 0, 18444 },
+  { "dup", 1, 0, 18460 },
+  { "duq", 1, 0, 18466 },
+  { "dur", 1, 0, 18479 },
+  { "dus", 1, 0, 18483 },
+  { "dut", 0, 0, 18488 },
+  { "duu", 1, 0, 18503 },
+  { "duv", 1, 0, 18509 },
+  { "duw", 1, 0, 18515 },
+  { "dux", 1, 0, 18526 },
+  { "duy", 1, 0, 18536 },
+  { "duz", 1, 0, 18550 },
+  { "dv", 0, 0, 18559 },
+  { "dva", 1, 0, 18586 },
+  { "dwa", 1, 0, 18591 },
+  { "dwk", 1, 0, 18596 },
+  { "dwr", 1, 0, 18607 },
+  { "dws", 1, 0, 18613 },
+  { "dwu", 1, 0, 18637 },
+  { "dww", 1, 0, 18644 },
+  { "dwy", 1, 0, 18651 },
+  { "dwz", 1, 0, 18659 },
+  { "dya", 1, 0, 18670 },
+  { "dyb", 1, 0, 18675 },
+  { "dyd", 1, 0, 18688 },
+  { "dyg", 1, 0, 18695 },
+  { "dyi", 1, 0, 18715 },
+  { "dym", 1, 0, 18732 },
+  { "dyn", 1, 0, 18749 },
+  { "dyo", 1, 0, 18758 },
+  { "dyu", 1, 0, 18769 },
+  { "dyy", 1, 0, 18775 },
+  { "dz", 0, 0, 18784 },
+  { "dza", 1, 0, 18793 },
+  { "dze", 1, 0, 18799 },
+  { "dzg", 1, 0, 18808 },
+  { "dzl", 1, 0, 18815 },
+  { "dzn", 1, 0, 18824 },
+  { "dzo", 1, 0, 18784 },
+  { "eaa", 1, 0, 18831 },
+  { "ebc", 1, 0, 18842 },
+  { "ebg", 1, 0, 18850 },
+  { "ebk", 1, 0, 18857 },
+  { "ebo", 1, 0, 18873 },
+  { "ebr", 1, 0, 18882 },
+  { "ebu", 1, 0, 18889 },
+  { "ecr", 1, 0, 18894 },
+  { "ecs", 1, 0, 18905 },
+  { "ecy", 1, 0, 18930 },
+  { "ee", 0, 0, 18942 },
+  { "eee", 1, 0, 18946 },
+  { "efa", 1, 0, 18948 },
+  { "efe", 1, 0, 18953 },
+  { "efi", 1, 0, 18957 },
+  { "ega", 1, 0, 18962 },
+  { "egl", 1, 0, 18966 },
+  { "egm", 1, 0, 18974 },
+  { "ego", 1, 0, 18984 },
+  { "egy", 1, 0, 18990 },
+  { "ehs", 1, 0, 19009 },
+  { "ehu", 1, 0, 19032 },
+  { "eip", 1, 0, 19039 },
+  { "eit", 1, 0, 19047 },
+  { "eiv", 1, 0, 19054 },
+  { "eja", 1, 0, 19062 },
+  { "eka", 1, 0, 19069 },
+  { "eke", 1, 0, 19076 },
+  { "ekg", 1, 0, 19081 },
+  { "eki", 1, 0, 19087 },
+  { "ekk", 1, 0, 19091 },
+  { "ekl", 1, 0, 19110 },
+  { "ekm", 1, 0, 19127 },
+  { "eko", 1, 0, 19132 },
+  { "ekp", 1, 0, 19137 },
+  { "ekr", 1, 0, 19144 },
+  { "eky", 1, 0, 19149 },
+  { "el", 0, 0, 19164 },
+  { "ele", 1, 0, 19186 },
+  { "elh", 1, 0, 19192 },
+  { "eli", 1, 0, 19204 },
+  { "elk", 1, 0, 19210 },
+  { "ell", 1, 0, 19164 },
+  { "elm", 1, 0, 19216 },
+  { "elo", 1, 0, 19222 },
+  { "elu", 1, 0, 19230 },
+  { "elx", 1, 0, 19234 },
+  { "ema", 1, 0, 19242 },
+  { "emb", 1, 0, 19258 },
+  { "eme", 1, 0, 19266 },
+  { "emg", 1, 0, 19276 },
+  { "emi", 1, 0, 19293 },
+  { "emk", 1, 0, 19306 },
+  { "emm", 1, 0, 19326 },
+  { "emn", 1, 0, 19336 },
+  { "emp", 1, 0, 19341 },
+  { "emq", 1, 0, 19359 },
+  { "ems", 1, 0, 19375 },
+  { "emu", 1, 0, 19395 },
+  { "emw", 1, 0, 19410 },
+  { "emx", 1, 0, 19419 },
+  { "emy", 1, 0, 19432 },
+  { "emz", 1, 0, 19450 },
+  { "en", 0, 0, 19457 },
+  { "ena", 1, 0, 19465 },
+  { "enb", 1, 0, 19471 },
+  { "enc", 1, 0, 19481 },
+  { "end", 1, 0, 19484 },
+  { "enf", 1, 0, 19489 },
+  { "eng", 1, 0, 19457 },
+  { "enh", 1, 0, 19503 },
+  { "enl", 1, 0, 19517 },
+  { "enm", 1, 0, 19524 },
+  { "enn", 1, 0, 19552 },
+  { "eno", 1, 0, 19560 },
+  { "enq", 1, 0, 19568 },
+  { "enr", 1, 0, 19573 },
+  { "enu", 1, 0, 19579 },
+  { "env", 1, 0, 19583 },
+  { "enw", 1, 0, 19601 },
+  { "enx", 1, 0, 19625 },
+  { "eo", 0, 0, 19631 },
+  { "eot", 1, 0, 19641 },
+  { "epi", 1, 0, 19663 },
+  { "epo", 1, 0, 19631 },
+  { "era", 1, 0, 19668 },
+  { "erg", 1, 0, 19678 },
+  { "erh", 1, 0, 19682 },
+  { "eri", 1, 0, 19688 },
+  { "erk", 1, 0, 19693 },
+  { "ero", 1, 0, 19706 },
+  { "err", 1, 0, 19712 },
+  { "ers", 1, 0, 19717 },
+  { "ert", 1, 0, 19722 },
+  { "erw", 1, 0, 19729 },
+  { "es", 0, 0, 19739 },
+  { "ese", 1, 0, 19758 },
+  { "esg", 1, 0, 19767 },
+  { "esh", 1, 0, 19780 },
+  { "esi", 1, 0, 19791 },
+  { "esk", 1, 0, 19816 },
+  { "esl", 1, 0, 19844 },
+  { "esm", 1, 0, 19864 },
+  { "esn", 1, 0, 19870 },
+  { "eso", 1, 0, 19895 },
+  { "esq", 1, 0, 19918 },
+  { "ess", 1, 0, 19926 },
+  { "est", 1, 0, 19950 },
+  { "esu", 1, 0, 19959 },
+  { "esy", 1, 0, 19974 },
+  { "et", 0, 0, 19950 },
+  { "etb", 1, 0, 19982 },
+  { "etc", 1, 0, 19988 },
+  { "eth", 1, 0, 19997 },
+  { "etn", 1, 0, 20021 },
+  { "eto", 1, 0, 20036 },
+  { "etr", 1, 0, 20052 },
+  { "ets", 1, 0, 20058 },
+  { "ett", 1, 0, 20065 },
+  { "etu", 1, 0, 20074 },
+  { "etx", 1, 0, 20082 },
+  { "etz", 1, 0, 20087 },
+  { "eu", 0, 0,  5565 },
+  { "eus", 1, 0,  5565 },
+  { "eve", 1, 0, 20094 },
+  { "evh", 1, 0, 20099 },
+  { "evn", 1, 0, 20105 },
+  { "ewe", 1, 0, 18942 },
+  { "ewo", 1, 0, 20112 },
+  { "ext", 1, 0, 20119 },
+  { "eya", 1, 0, 20132 },
+  { "eyo", 1, 0, 20137 },
+  { "eza", 1, 0, 20143 },
+  { "eze", 1, 0, 20148 },
+  { "fa", 0, 0, 20155 },
+  { "faa", 1, 0, 20163 },
+  { "fab", 1, 0, 20168 },
+  { "fad", 1, 0, 20178 },
+  { "faf", 1, 0, 20183 },
+  { "fag", 1, 0, 20190 },
+  { "fah", 1, 0, 20199 },
+  { "fai", 1, 0, 20212 },
+  { "faj", 1, 0, 20219 },
+  { "fak", 1, 0, 20225 },
+  { "fal", 1, 0, 20241 },
+  { "fam", 1, 0, 20253 },
+  { "fan", 1, 0, 20257 },
+  { "fao", 1, 0, 20282 },
+  { "fap", 1, 0, 20290 },
+  { "far", 1, 0, 20297 },
+  { "fas", 1, 0, 20155 },
+  { "fat", 1, 0, 20306 },
+  { "fau", 1, 0, 20312 },
+  { "fax", 1, 0, 20317 },
+  { "fay", 1, 0, 20322 },
+  { "faz", 1, 0, 20341 },
+  { "fbl", 1, 0, 20360 },
+  { "fcs", 1, 0, 20378 },
+  { "fer", 1, 0, 20399 },
+  { "ff", 0, 0, 20406 },
+  { "ffi", 1, 0, 20412 },
+  { "ffm", 1, 0, 20422 },
+  { "fgr", 1, 0, 20440 },
+  { "fi", 0, 0, 20448 },
+  { "fia", 1, 0, 20456 },
+  { "fie", 1, 0, 20463 },
+  { "fif", 1, 0, 20468 },
+  { "fij", 1, 0, 20474 },
+  { "fil", 1, 0, 20481 },
+  { "fin", 1, 0, 20448 },
+  { "fip", 1, 0, 20490 },
+  { "fir", 1, 0, 20495 },
+  { "fit", 1, 0, 20501 },
+  { "fiu", 0, 0, 20521 },
+  { "fiw", 1, 0, 20544 },
+  { "fj", 0, 0, 20474 },
+  { "fkk", 1, 0, 20551 },
+  { "fkv", 1, 0, 20565 },
+  { "fla", 1, 0, 20579 },
+  { "flh", 1, 0, 20603 },
+  { "fli", 1, 0, 20608 },
+  { "fll", 1, 0, 20613 },
+  { "fln", 1, 0, 20625 },
+  { "flr", 1, 0, 20641 },
+  { "fly", 1, 0, 20649 },
+  { "fmp", 1, 0, 20659 },
+  { "fmu", 1, 0, 20666 },
+  { "fnb", 1, 0, 20685 },
+  { "fng", 1, 0, 20692 },
+  { "fni", 1, 0, 20701 },
+  { "fo", 0, 0, 20282 },
+  { "fod", 1, 0, 20707 },
+  { "foi", 1, 0, 20713 },
+  { "fom", 1, 0, 20717 },
+  { "fon", 1, 0, 20722 },
+  { "for", 1, 0, 20726 },
+  { "fos", 1, 0, 20731 },
+  { "fpe", 1, 0, 20738 },
+  { "fqs", 1, 0, 20766 },
+  { "fr", 0, 0, 20770 },
+  { "fra", 1, 0, 20770 },
+  { "frc", 1, 0, 20777 },
+  { "frd", 1, 0, 20791 },
+  { "fre", 0, 0, 20770 },
+  { "frk", 1, 0, 20799 },
+  { "frm", 1, 0, 20808 },
+  { "fro", 1, 0, 20839 },
+  { "frp", 1, 0, 20866 },
+  { "frq", 1, 0, 20874 },
+  { "frr", 1, 0, 20880 },
+  { "frs", 1, 0, 20898 },
+  { "frt", 1, 0, 20915 },
+  { "fry", 1, 0, 20925 },
+  { "fse", 1, 0, 20942 },
+  { "fsl", 1, 0, 20964 },
+  { "fss", 1, 0, 20985 },
+  { "fub", 1, 0, 21015 },
+  { "fuc", 1, 0, 21033 },
+  { "fud", 1, 0, 21040 },
+  { "fue", 1, 0, 21053 },
+  { "fuf", 1, 0, 21069 },
+  { "fuh", 1, 0, 21075 },
+  { "fui", 1, 0, 21099 },
+  { "fuj", 1, 0, 21117 },
+  { "ful", 1, 0, 20406 },
+  { "fum", 1, 0, 21120 },
+  { "fun", 1, 0, 21124 },
+  { "fuq", 1, 0, 21132 },
+  { "fur", 1, 0, 21164 },
+  { "fut", 1, 0, 21173 },
+  { "fuu", 1, 0, 21186 },
+  { "fuv", 1, 0, 21191 },
+  { "fuy", 1, 0, 21210 },
+  { "fvr", 1, 0, 21216 },
+  { "fwa", 1, 0, 21220 },
+  { "fwe", 1, 0, 21226 },
+  { "fy", 0, 0, 21230 },
+  { "ga", 0, 0, 21246 },
+  { "gaa", 1, 0, 21252 },
+  { "gab", 1, 0, 21255 },
+  { "gac", 1, 0, 21261 },
+  { "gad", 1, 0, 21285 },
+  { "gae", 1, 0, 21293 },
+  { "gaf", 1, 0, 21304 },
+  { "gag", 1, 0, 21310 },
+  { "gah", 1, 0, 21317 },
+  { "gai", 1, 0, 21325 },
+  { "gaj", 1, 0, 21331 },
+  { "gak", 1, 0, 21338 },
+  { "gal", 1, 0, 21348 },
+  { "gam", 1, 0, 21356 },
+  { "gan", 1, 0, 21364 },
+  { "gao", 1, 0, 21377 },
+  { "gap", 1, 0, 21383 },
+  { "gaq", 1, 0, 21387 },
+  { "gar", 1, 0, 21393 },
+  { "gas", 1, 0, 21400 },
+  { "gat", 1, 0, 21417 },
+  { "gau", 1, 0, 21424 },
+  { "gaw", 1, 0, 21440 },
+  { "gax", 1, 0, 21448 },
+  { "gay", 1, 0, 21472 },
+  { "gaz", 1, 0, 21477 },
+  { "gba", 1, 0, 21497 },
+  { "gbb", 1, 0, 21530 },
+  { "gbd", 1, 0, 21539 },
+  { "gbe", 1, 0, 21549 },
+  { "gbf", 1, 0, 21556 },
+  { "gbg", 1, 0, 21565 },
+  { "gbh", 1, 0, 21574 },
+  { "gbi", 1, 0, 21584 },
+  { "gbj", 1, 0, 21591 },
+  { "gbk", 1, 0, 21604 },
+  { "gbl", 1, 0, 21610 },
+  { "gbm", 1, 0, 21616 },
+  { "gbn", 1, 0, 21625 },
+  { "gbo", 1, 0, 21631 },
+  { "gbp", 1, 0, 21647 },
+  { "gbq", 1, 0, 21663 },
+  { "gbr", 1, 0, 21676 },
+  { "gbs", 1, 0, 21683 },
+  { "gbu", 1, 0, 21694 },
+  { "gbv", 1, 0, 21701 },
+  { "gbw", 1, 0, 21707 },
+  { "gbx", 1, 0, 21717 },
+  { "gby", 1, 0, 21735 },
+  { "gbz", 1, 0, 21741 },
+  { "gcc", 1, 0, 21759 },
+  { "gcd", 1, 0, 21764 },
+  { "gce", 1, 0, 21775 },
+  { "gcf", 1, 0, 21782 },
+  { "gcl", 1, 0, 21810 },
+  { "gcn", 1, 0, 21836 },
+  { "gcr", 1, 0, 21842 },
+  { "gct", 1, 0, 21866 },
+  { "gd", 0, 0, 21888 },
+  { "gda", 1, 0, 21912 },
+  { "gdb", 1, 0, 21924 },
+  { "gdc", 1, 0, 21947 },
+  { "gdd", 1, 0, 21959 },
+  { "gde", 1, 0, 21967 },
+  { "gdf", 1, 0, 21972 },
+  { "gdg", 1, 0, 21983 },
+  { "gdh", 1, 0, 21991 },
+  { "gdi", 1, 0, 22003 },
+  { "gdj", 1, 0, 22009 },
+  { "gdk", 1, 0, 22017 },
+  { "gdl", 1, 0, 22024 },
+  { "gdm", 1, 0, 22032 },
+  { "gdn", 1, 0, 22037 },
+  { "gdo", 1, 0, 22048 },
+  { "gdq", 1, 0, 22058 },
+  { "gdr", 1, 0, 22064 },
+  { "gds", 1, 0, 22069 },
+  { "gdt", 1, 0, 22092 },
+  { "gdu", 1, 0, 22104 },
+  { "gdx", 1, 0, 22109 },
+  { "gea", 1, 0, 22117 },
+  { "geb", 1, 0, 22124 },
+  { "gec", 1, 0, 22129 },
+  { "ged", 1, 0, 22143 },
+  { "gef", 1, 0, 22148 },
+  { "geg", 1, 0, 22154 },
+  { "geh", 1, 0, 22161 },
+  { "gei", 1, 0, 22179 },
+  { "gej", 1, 0, 22184 },
+  { "gek", 1, 0, 22188 },
+  { "gel", 1, 0, 22193 },
+  { "gem", 0, 0, 22202 },
+  { "geo", 0, 0, 22221 },
+  { "geq", 1, 0, 22230 },
+  { "ger", 0, 0, 16340 },
+  { "ges", 1, 0, 22235 },
+  { "gev", 1, 0, 22247 },
+  { "gew", 1, 0, 22253 },
+  { "gex", 1, 0, 22258 },
+  { "gey", 1, 0, 22264 },
+  { "gez", 1, 0, 22269 },
+  { "gfk", 1, 0, 22274 },
+  { "gft", 1, 0, 22283 },
+  { "gga", 1, 0, 22289 },
+  { "ggb", 1, 0, 22293 },
+  { "ggd", 1, 0, 22298 },
+  { "gge", 1, 0, 22305 },
+  { "ggg", 1, 0, 22315 },
+  { "ggk", 1, 0, 22323 },
+  { "ggl", 1, 0, 22335 },
+  { "ggt", 1, 0, 22343 },
+  { "ggu", 1, 0, 22349 },
+  { "ggw", 1, 0, 22354 },
+  { "gha", 1, 0, 22363 },
+  { "ghc", 1, 0, 22373 },
+  { "ghe", 1, 0, 22398 },
+  { "ghh", 1, 0, 22414 },
+  { "ghk", 1, 0, 22430 },
+  { "ghl", 1, 0, 22442 },
+  { "ghn", 1, 0, 22450 },
+  { "gho", 1, 0, 22460 },
+  { "ghr", 1, 0, 22468 },
+  { "ghs", 1, 0, 22474 },
+  { "ght", 1, 0, 22486 },
+  { "gia", 1, 0, 22491 },
+  { "gib", 1, 0, 22496 },
+  { "gic", 1, 0, 22505 },
+  { "gid", 1, 0, 22510 },
+  { "gie", 1, 0, 22516 },
+  { "gig", 1, 0, 22525 },
+  { "gih", 1, 0, 22532 },
+  { "gii", 1, 0, 22541 },
+  { "gil", 1, 0, 22549 },
+  { "gim", 1, 0, 22560 },
+  { "gin", 1, 0, 22585 },
+  { "gip", 1, 0, 22592 },
+  { "giq", 1, 0, 22616 },
+  { "gir", 1, 0, 22629 },
+  { "gis", 1, 0, 22640 },
+  { "git", 1, 0, 22654 },
+  { "giu", 1, 0, 22662 },
+  { "giw", 1, 0, 22668 },
+  { "gix", 1, 0, 22681 },
+  { "giy", 1, 0, 22688 },
+  { "giz", 1, 0, 22694 },
+  { "gjk", 1, 0, 22708 },
+  { "gjm", 1, 0, 22720 },
+  { "gjn", 1, 0, 22732 },
+  { "gjr", 1, 0, 22738 },
+  { "gju", 1, 0, 22753 },
+  { "gka", 1, 0, 22760 },
+  { "gkd", 1, 0, 22765 },
+  { "gke", 1, 0, 22789 },
+  { "gkn", 1, 0, 22794 },
+  { "gko", 1, 0, 22801 },
+  { "gkp", 1, 0, 22809 },
+  { "gku", 1, 0, 22824 },
+  { "gl", 0, 0, 22833 },
+  { "gla", 1, 0, 22842 },
+  { "glb", 1, 0, 22859 },
+  { "glc", 1, 0, 22867 },
+  { "gld", 1, 0, 22876 },
+  { "gle", 1, 0, 21246 },
+  { "glg", 1, 0, 22833 },
+  { "glh", 1, 0, 22882 },
+  { "glj", 1, 0, 22900 },
+  { "glk", 1, 0, 22909 },
+  { "gll", 1, 0, 22916 },
+  { "glo", 1, 0, 22924 },
+  { "glr", 1, 0, 22932 },
+  { "glu", 1, 0, 22944 },
+  { "glv", 1, 0, 22956 },
+  { "glw", 1, 0, 22961 },
+  { "gly", 1, 0, 22968 },
+  { "gma", 1, 0, 22973 },
+  { "gmb", 1, 0, 22981 },
+  { "gmd", 1, 0, 22991 },
+  { "gmg", 1, 0, 23000 },
+  { "gmh", 1, 0, 23008 },
+  { "gml", 1, 0, 23044 },
+  { "gmm", 1, 0, 23063 },
+  { "gmn", 1, 0, 23077 },
+  { "gmr", 1, 0, 23085 },
+  { "gmu", 1, 0, 23093 },
+  { "gmv", 1, 0, 23100 },
+  { "gmx", 1, 0, 23105 },
+  { "gmy", 1, 0, 23112 },
+  { "gmz", 1, 0, 23129 },
+  { "gn", 0, 0, 23140 },
+  { "gna", 1, 0, 23148 },
+  { "gnb", 1, 0, 23155 },
+  { "gnc", 1, 0, 23162 },
+  { "gnd", 1, 0, 23170 },
+  { "gne", 1, 0, 23183 },
+  { "gng", 1, 0, 23190 },
+  { "gnh", 1, 0, 23198 },
+  { "gni", 1, 0, 23203 },
+  { "gnj", 1, 0, 23214 },
+  { "gnk", 1, 0, 23219 },
+  { "gnl", 1, 0, 23226 },
+  { "gnm", 1, 0, 23234 },
+  { "gnn", 1, 0, 23242 },
+  { "gno", 1, 0, 23249 },
+  { "gnq", 1, 0, 23265 },
+  { "gnr", 1, 0, 23270 },
+  { "gnt", 1, 0, 23284 },
+  { "gnu", 1, 0, 23291 },
+  { "gnw", 1, 0, 23296 },
+  { "gnz", 1, 0, 23323 },
+  { "goa", 1, 0, 23329 },
+  { "gob", 1, 0, 23334 },
+  { "goc", 1, 0, 23342 },
+  { "god", 1, 0, 23350 },
+  { "goe", 1, 0, 23357 },
+  { "gof", 1, 0, 23365 },
+  { "gog", 1, 0, 23370 },
+  { "goh", 1, 0, 23375 },
+  { "goi", 1, 0, 23407 },
+  { "goj", 1, 0, 23414 },
+  { "gok", 1, 0, 23421 },
+  { "gol", 1, 0, 23427 },
+  { "gom", 1, 0, 23432 },
+  { "gon", 1, 0, 23446 },
+  { "goo", 1, 0, 23452 },
+  { "gop", 1, 0, 23461 },
+  { "goq", 1, 0, 23470 },
+  { "gor", 1, 0, 23476 },
+  { "gos", 1, 0, 23486 },
+  { "got", 1, 0, 23495 },
+  { "gou", 1, 0, 23502 },
+  { "gov", 1, 0, 23508 },
+  { "gow", 1, 0, 23512 },
+  { "gox", 1, 0, 23519 },
+  { "goy", 1, 0, 23524 },
+  { "goz", 1, 0, 23531 },
+  { "gpa", 1, 0, 23542 },
+  { "gpe", 1, 0, 23553 },
+  { "gpn", 1, 0, 23578 },
+  { "gqa", 1, 0, 23584 },
+  { "gqi", 1, 0, 23592 },
+  { "gqn", 1, 0, 23601 },
+  { "gqr", 1, 0, 23616 },
+  { "gqu", 1, 0, 23620 },
+  { "gra", 1, 0, 23624 },
+  { "grb", 1, 0, 23640 },
+  { "grc", 1, 0, 23646 },
+  { "grd", 1, 0, 23671 },
+  { "gre", 0, 0, 19164 },
+  { "grg", 1, 0, 23687 },
+  { "grh", 1, 0, 23692 },
+  { "gri", 1, 0, 23705 },
+  { "grj", 1, 0, 23711 },
+  { "grm", 1, 0, 23727 },
+  { "grn", 1, 0, 23140 },
+  { "gro", 1, 0, 23749 },
+  { "grq", 1, 0, 23755 },
+  { "grr", 1, 0, 23762 },
+  { "grs", 1, 0, 23771 },
+  { "grt", 1, 0, 23777 },
+  { "gru", 1, 0, 23782 },
+  { "grv", 1, 0, 23790 },
+  { "grw", 1, 0, 23805 },
+  { "grx", 1, 0, 23811 },
+  { "gry", 1, 0, 23819 },
+  { "grz", 1, 0, 23839 },
+  { "gse", 1, 0, 23849 },
+  { "gsg", 1, 0, 23872 },
+  { "gsl", 1, 0, 23893 },
+  { "gsm", 1, 0, 23901 },
+  { "gsn", 1, 0, 23926 },
+  { "gso", 1, 0, 23931 },
+  { "gsp", 1, 0, 23948 },
+  { "gss", 1, 0, 23956 },
+  { "gsw", 1, 0, 23976 },
+  { "gta", 1, 0, 23990 },
+  { "gtu", 1, 0, 23997 },
+  { "gu", 0, 0, 24013 },
+  { "gua", 1, 0, 24022 },
+  { "gub", 1, 0, 24028 },
+  { "guc", 1, 0, 24039 },
+  { "gud", 1, 0, 24045 },
+  { "gue", 1, 0, 24061 },
+  { "guf", 1, 0, 24070 },
+  { "gug", 1, 0, 24081 },
+  { "guh", 1, 0, 24102 },
+  { "gui", 1, 0, 24110 },
+  { "guj", 1, 0, 24013 },
+  { "guk", 1, 0, 24137 },
+  { "gul", 1, 0, 24143 },
+  { "gum", 1, 0, 24170 },
+  { "gun", 1, 0, 24180 },
+  { "guo", 1, 0, 24196 },
+  { "gup", 1, 0, 24206 },
+  { "guq", 1, 0, 24216 },
+  { "gur", 1, 0, 24222 },
+  { "gus", 1, 0, 24231 },
+  { "gut", 1, 0, 24253 },
+  { "guu", 1, 0, 24268 },
+  { "guw", 1, 0, 24278 },
+  { "gux", 1, 0, 24282 },
+  { "guz", 1, 0, 24296 },
+  { "gv", 0, 0, 22956 },
+  { "gva", 1, 0, 24302 },
+  { "gvc", 1, 0, 24319 },
+  { "gve", 1, 0, 24327 },
+  { "gvf", 1, 0, 24333 },
+  { "gvj", 1, 0, 24339 },
+  { "gvl", 1, 0, 24346 },
+  { "gvm", 1, 0, 24352 },
+  { "gvn", 1, 0, 24360 },
+  { "gvo", 1, 0, 24373 },
+  { "gvp", 1, 0, 24394 },
+  { "gvr", 1, 0, 24409 },
+  { "gvs", 1, 0, 24416 },
+  { "gvy", 1, 0, 24425 },
+  { "gwa", 1, 0, 24432 },
+  { "gwb", 1, 0, 24438 },
+  { "gwc", 1, 0, 24442 },
+  { "gwd", 1, 0, 24448 },
+  { "gwe", 1, 0, 24456 },
+  { "gwf", 1, 0, 24462 },
+  { "gwg", 1, 0, 24468 },
+  { "gwi", 1, 0, 24472 },
+  { "gwj", 1, 0, 24482 },
+  { "gwm", 1, 0, 24488 },
+  { "gwn", 1, 0, 24497 },
+  { "gwr", 1, 0, 24506 },
+  { "gwt", 1, 0, 24512 },
+  { "gwu", 1, 0, 24523 },
+  { "gww", 1, 0, 24530 },
+  { "gwx", 1, 0, 24536 },
+  { "gxx", 1, 0, 24540 },
+  { "gya", 1, 0, 24553 },
+  { "gyb", 1, 0, 24570 },
+  { "gyd", 1, 0, 24576 },
+  { "gye", 1, 0, 24586 },
+  { "gyf", 1, 0, 24591 },
+  { "gyg", 1, 0, 24601 },
+  { "gyi", 1, 0, 24607 },
+  { "gyl", 1, 0, 24613 },
+  { "gym", 1, 0, 24619 },
+  { "gyn", 1, 0, 24628 },
+  { "gyo", 1, 0, 24653 },
+  { "gyr", 1, 0, 24663 },
+  { "gyy", 1, 0, 24671 },
+  { "gyz", 1, 0, 24677 },
+  { "gza", 1, 0, 24682 },
+  { "gzi", 1, 0, 24688 },
+  { "gzn", 1, 0, 24693 },
+  { "ha", 0, 0, 24698 },
+  { "haa", 1, 0, 24704 },
+  { "hab", 1, 0, 24708 },
+  { "hac", 1, 0, 24728 },
+  { "had", 1, 0, 24735 },
+  { "hae", 1, 0, 24741 },
+  { "haf", 1, 0, 24756 },
+  { "hag", 1, 0, 24779 },
+  { "hah", 1, 0, 24785 },
+  { "hai", 1, 0, 24791 },
+  { "haj", 1, 0, 24797 },
+  { "hak", 1, 0, 24804 },
+  { "hal", 1, 0, 24819 },
+  { "ham", 1, 0, 24826 },
+  { "han", 1, 0, 24831 },
+  { "hao", 1, 0, 24839 },
+  { "hap", 1, 0, 24845 },
+  { "haq", 1, 0, 24851 },
+  { "har", 1, 0, 24854 },
+  { "has", 1, 0, 24861 },
+  { "hat", 1, 0, 24868 },
+  { "hau", 1, 0, 24698 },
+  { "hav", 1, 0, 24876 },
+  { "haw", 1, 0, 24881 },
+  { "hax", 1, 0, 24890 },
+  { "hay", 1, 0, 24906 },
+  { "haz", 1, 0, 24911 },
+  { "hba", 1, 0, 24920 },
+  { "hbb", 1, 0, 24926 },
+  { "hbn", 1, 0, 24931 },
+  { "hbo", 1, 0, 24938 },
+  { "hbs", 1, 0, 24954 },
+  { "hbu", 1, 0, 24969 },
+  { "hca", 1, 0, 24974 },
+  { "hch", 1, 0, 24996 },
+  { "hdn", 1, 0, 25004 },
+  { "hds", 1, 0, 25020 },
+  { "hdy", 1, 0, 25043 },
+  { "he", 0, 0, 25051 },
+  { "hea", 1, 0, 25058 },
+  { "heb", 1, 0, 25051 },
+  { "hed", 1, 0, 25082 },
+  { "heg", 1, 0, 25089 },
+  { "heh", 1, 0, 25096 },
+  { "hei", 1, 0, 25101 },
+  { "hem", 1, 0, 25110 },
+  { "her", 1, 0, 25116 },
+  { "hgm", 1, 0, 25123 },
+  { "hgw", 1, 0, 25131 },
+  { "hhi", 1, 0, 25139 },
+  { "hhr", 1, 0, 25149 },
+  { "hhy", 1, 0, 25155 },
+  { "hi", 0, 0, 25164 },
+  { "hia", 1, 0, 25170 },
+  { "hib", 1, 0, 25177 },
+  { "hid", 1, 0, 25184 },
+  { "hif", 1, 0, 25192 },
+  { "hig", 1, 0, 25204 },
+  { "hih", 1, 0, 25210 },
+  { "hii", 1, 0, 25217 },
+  { "hij", 1, 0, 25225 },
+  { "hik", 1, 0, 25231 },
+  { "hil", 1, 0, 25244 },
+  { "him", 0, 0, 25255 },
+  { "hin", 1, 0, 25164 },
+  { "hio", 1, 0, 25301 },
+  { "hir", 1, 0, 25306 },
+  { "hit", 1, 0, 25316 },
+  { "hiw", 1, 0, 25324 },
+  { "hix", 1, 0, 25328 },
+  { "hji", 1, 0, 25340 },
+  { "hka", 1, 0, 25345 },
+  { "hke", 1, 0, 25350 },
+  { "hkh", 1, 0, 25356 },
+  { "hkk", 1, 0, 25361 },
+  { "hkn", 1, 0, 25378 },
+  { "hks", 1, 0, 25389 },
+  { "hla", 1, 0, 25413 },
+  { "hlb", 1, 0, 25419 },
+  { "hld", 1, 0, 25425 },
+  { "hle", 1, 0, 25437 },
+  { "hlt", 1, 0, 25444 },
+  { "hlu", 1, 0, 25455 },
+  { "hma", 1, 0, 25476 },
+  { "hmb", 1, 0, 25499 },
+  { "hmc", 1, 0, 25522 },
+  { "hmd", 1, 0, 25545 },
+  { "hme", 1, 0, 25565 },
+  { "hmf", 1, 0, 25588 },
+  { "hmg", 1, 0, 25598 },
+  { "hmh", 1, 0, 25626 },
+  { "hmi", 1, 0, 25654 },
+  { "hmj", 1, 0, 25678 },
+  { "hmk", 1, 0, 25681 },
+  { "hml", 1, 0, 25686 },
+  { "hmm", 1, 0, 25701 },
+  { "hmn", 1, 0, 25723 },
+  { "hmo", 1, 0, 25729 },
+  { "hmp", 1, 0, 25739 },
+  { "hmq", 1, 0, 25762 },
+  { "hmr", 1, 0, 25785 },
+  { "hms", 1, 0, 25790 },
+  { "hmt", 1, 0, 25814 },
+  { "hmu", 1, 0, 25821 },
+  { "hmv", 1, 0, 25827 },
+  { "hmw", 1, 0, 25837 },
+  { "hmy", 1, 0, 25859 },
+  { "hmz", 1, 0, 25883 },
+  { "hna", 1, 0, 25894 },
+  { "hnd", 1, 0, 25910 },
+  { "hne", 1, 0, 25927 },
+  { "hng", 1, 0, 25941 },
+  { "hnh", 1, 0, 25947 },
+  { "hni", 1, 0, 25953 },
+  { "hnj", 1, 0, 25958 },
+  { "hnn", 1, 0, 25969 },
+  { "hno", 1, 0, 25977 },
+  { "hns", 1, 0, 25994 },
+  { "hnu", 1, 0, 26016 },
+  { "ho", 0, 0, 25729 },
+  { "hoa", 1, 0, 26021 },
+  { "hob", 1, 0, 26027 },
+  { "hoc", 1, 0, 26050 },
+  { "hod", 1, 0, 26053 },
+  { "hoe", 1, 0, 26059 },
+  { "hoh", 1, 0, 26065 },
+  { "hoi", 1, 0, 26073 },
+  { "hoj", 1, 0, 26084 },
+  { "hol", 1, 0, 26092 },
+  { "hom", 1, 0, 26097 },
+  { "hoo", 1, 0, 26102 },
+  { "hop", 1, 0, 26111 },
+  { "hor", 1, 0, 26116 },
+  { "hos", 1, 0, 26121 },
+  { "hot", 1, 0, 26152 },
+  { "hov", 1, 0, 26157 },
+  { "how", 1, 0, 26166 },
+  { "hoy", 1, 0, 26171 },
+  { "hoz", 1, 0, 26178 },
+  { "hpo", 1, 0, 26183 },
+  { "hps", 1, 0, 26188 },
+  { "hr", 0, 0, 26216 },
+  { "hra", 1, 0, 26225 },
+  { "hrc", 1, 0, 26235 },
+  { "hre", 1, 0, 26245 },
+  { "hrk", 1, 0, 26249 },
+  { "hrm", 1, 0, 26256 },
+  { "hro", 1, 0, 26269 },
+  { "hrp", 1, 0, 26275 },
+  { "hrt", 1, 0, 26283 },
+  { "hru", 1, 0, 26293 },
+  { "hrv", 1, 0, 26216 },
+  { "hrw", 1, 0, 26299 },
+  { "hrx", 1, 0, 26311 },
+  { "hrz", 1, 0, 26319 },
+  { "hsb", 1, 0, 26327 },
+  { "hsh", 1, 0, 26342 },
+  { "hsl", 1, 0, 26366 },
+  { "hsn", 1, 0, 26386 },
+  { "hss", 1, 0, 26401 },
+  { "ht", 0, 0, 26409 },
+  { "hti", 1, 0, 26433 },
+  { "hto", 1, 0, 26438 },
+  { "hts", 1, 0, 26454 },
+  { "htu", 1, 0, 26460 },
+  { "htx", 1, 0, 26465 },
+  { "hu", 0, 0, 26481 },
+  { "hub", 1, 0, 26491 },
+  { "huc", 1, 0, 26500 },
+  { "hud", 1, 0, 26506 },
+  { "hue", 1, 0, 26513 },
+  { "huf", 1, 0, 26542 },
+  { "hug", 1, 0, 26549 },
+  { "huh", 1, 0, 26561 },
+  { "hui", 1, 0, 26571 },
+  { "huj", 1, 0, 26576 },
+  { "huk", 1, 0, 26600 },
+  { "hul", 1, 0, 26607 },
+  { "hum", 1, 0, 26612 },
+  { "hun", 1, 0, 26481 },
+  { "huo", 1, 0, 26620 },
+  { "hup", 1, 0, 26623 },
+  { "huq", 1, 0, 26628 },
+  { "hur", 1, 0, 26633 },
+  { "hus", 1, 0, 26644 },
+  { "hut", 1, 0, 26652 },
+  { "huu", 1, 0, 26658 },
+  { "huv", 1, 0, 26673 },
+  { "huw", 1, 0, 26698 },
+  { "hux", 1, 0, 26707 },
+  { "huy", 1, 0, 26724 },
+  { "huz", 1, 0, 26733 },
+  { "hvc", 1, 0, 26740 },
+  { "hve", 1, 0, 26772 },
+  { "hvk", 1, 0, 26800 },
+  { "hvn", 1, 0, 26807 },
+  { "hvv", 1, 0, 26812 },
+  { "hwa", 1, 0, 26840 },
+  { "hwc", 1, 0, 26846 },
+  { "hwo", 1, 0, 26870 },
+  { "hy", 0, 0,  3558 },
+  { "hya", 1, 0, 26876 },
+  { "hye", 1, 0,  3558 },
+  { "hyw", 1, 0, 26880 },
+  { "hz", 0, 0, 25116 },
+  { "ia", 0, 0, 26898 },
+  { "iai", 1, 0, 26957 },
+  { "ian", 1, 0, 26962 },
+  { "iar", 1, 0, 26969 },
+  { "iba", 1, 0, 26976 },
+  { "ibb", 1, 0, 26981 },
+  { "ibd", 1, 0, 26988 },
+  { "ibe", 1, 0, 26996 },
+  { "ibg", 1, 0, 27002 },
+  { "ibh", 1, 0, 27009 },
+  { "ibl", 1, 0, 27013 },
+  { "ibm", 1, 0, 27020 },
+  { "ibn", 1, 0, 27025 },
+  { "ibo", 1, 0, 27031 },
+  { "ibr", 1, 0, 27036 },
+  { "ibu", 1, 0, 27043 },
+  { "iby", 1, 0, 27047 },
+  { "ica", 1, 0, 27053 },
+  { "ice", 0, 0, 27061 },
+  { "ich", 1, 0, 27071 },
+  { "icl", 1, 0, 27079 },
+  { "icr", 1, 0, 27103 },
+  { "id", 0, 0, 27128 },
+  { "ida", 1, 0, 27139 },
+  { "idb", 1, 0, 27160 },
+  { "idc", 1, 0, 27176 },
+  { "idd", 1, 0, 27181 },
+  { "ide", 1, 0, 27191 },
+  { "idi", 1, 0, 27197 },
+  { "ido", 1, 0, 27201 },
+  { "idr", 1, 0, 27205 },
+  { "ids", 1, 0, 27211 },
+  { "idt", 1, 0, 27217 },
+  { "idu", 1, 0, 27224 },
+  { "ie", 0, 0, 27230 },
+  { "ifa", 1, 0, 27254 },
+  { "ifb", 1, 0, 27270 },
+  { "ife", 1, 0, 27284 },
+  { "iff", 1, 0, 27289 },
+  { "ifk", 1, 0, 27293 },
+  { "ifm", 1, 0, 27308 },
+  { "ifu", 1, 0, 27319 },
+  { "ify", 1, 0, 27335 },
+  { "ig", 0, 0, 27031 },
+  { "igb", 1, 0, 27353 },
+  { "ige", 1, 0, 27359 },
+  { "igg", 1, 0, 27365 },
+  { "igl", 1, 0, 27371 },
+  { "igm", 1, 0, 27377 },
+  { "ign", 1, 0, 27386 },
+  { "igo", 1, 0, 27396 },
+  { "igs", 1, 0, 27402 },
+  { "igw", 1, 0, 27414 },
+  { "ihb", 1, 0, 27419 },
+  { "ihi", 1, 0, 27436 },
+  { "ihp", 1, 0, 27444 },
+  { "ihw", 1, 0, 27448 },
+  { "ii", 0, 0, 27457 },
+  { "iii", 1, 0, 27475 },
+  { "iin", 1, 0, 27487 },
+  { "ijc", 1, 0, 27493 },
+  { "ije", 1, 0, 27498 },
+  { "ijj", 1, 0, 27505 },
+  { "ijn", 1, 0, 27513 },
+  { "ijo", 0, 0, 27522 },
+  { "ijs", 1, 0, 27536 },
+  { "ik", 0, 0, 27551 },
+  { "ike", 1, 0, 27559 },
+  { "iki", 1, 0, 27587 },
+  { "ikk", 1, 0, 27591 },
+  { "ikl", 1, 0, 27595 },
+  { "iko", 1, 0, 27601 },
+  { "ikp", 1, 0, 27614 },
+  { "ikr", 1, 0, 27622 },
+  { "iks", 1, 0, 27633 },
+  { "ikt", 1, 0, 27653 },
+  { "iku", 1, 0, 27665 },
+  { "ikv", 1, 0, 27675 },
+  { "ikw", 1, 0, 27690 },
+  { "ikx", 1, 0, 27697 },
+  { "ikz", 1, 0, 27700 },
+  { "ila", 1, 0, 27706 },
+  { "ilb", 1, 0, 27714 },
+  { "ile", 1, 0, 27718 },
+  { "ilg", 1, 0, 27730 },
+  { "ili", 1, 0, 27742 },
+  { "ilk", 1, 0, 27752 },
+  { "ilm", 1, 0, 27760 },
+  { "ilo", 1, 0, 27778 },
+  { "ilp", 1, 0, 27784 },
+  { "ils", 1, 0, 27805 },
+  { "ilu", 1, 0, 27824 },
+  { "ilv", 1, 0, 27832 },
+  { "ima", 1, 0, 27837 },
+  { "imi", 1, 0, 27851 },
+  { "iml", 1, 0, 27860 },
+  { "imn", 1, 0, 27866 },
+  { "imo", 1, 0, 27873 },
+  { "imr", 1, 0, 27881 },
+  { "ims", 1, 0, 27889 },
+  { "imt", 1, 0, 27897 },
+  { "imy", 1, 0, 27905 },
+  { "ina", 1, 0, 26898 },
+  { "inb", 1, 0, 27912 },
+  { "inc", 0, 0, 27917 },
+  { "ind", 1, 0, 27128 },
+  { "ine", 0, 0, 27933 },
+  { "ing", 1, 0, 27957 },
+  { "inh", 1, 0, 27968 },
+  { "inj", 1, 0, 27975 },
+  { "inl", 1, 0, 27988 },
+  { "inm", 1, 0, 28013 },
+  { "inn", 1, 0, 28021 },
+  { "ino", 1, 0, 28028 },
+  { "inp", 1, 0, 28039 },
+  { "ins", 1, 0, 28048 },
+  { "int", 1, 0, 28069 },
+  { "inz", 1, 0, 28075 },
+  { "io", 0, 0, 27201 },
+  { "ior", 1, 0, 28084 },
+  { "iou", 1, 0, 28089 },
+  { "iow", 1, 0, 28100 },
+  { "ipi", 1, 0, 28109 },
+  { "ipk", 1, 0, 27551 },
+  { "ipo", 1, 0, 28115 },
+  { "iqu", 1, 0, 28121 },
+  { "iqw", 1, 0, 28128 },
+  { "ira", 0, 0, 28133 },
+  { "ire", 1, 0, 28151 },
+  { "irh", 1, 0, 28158 },
+  { "iri", 1, 0, 28166 },
+  { "irk", 1, 0, 28172 },
+  { "irn", 1, 0, 28178 },
+  { "iro", 0, 0, 28187 },
+  { "irr", 1, 0, 28207 },
+  { "iru", 1, 0, 28210 },
+  { "irx", 1, 0, 28216 },
+  { "iry", 1, 0, 28225 },
+  { "is", 0, 0, 27061 },
+  { "isa", 1, 0, 28231 },
+  { "isc", 1, 0, 28237 },
+  { "isd", 1, 0, 28247 },
+  { "ise", 1, 0, 28253 },
+  { "isg", 1, 0, 28275 },
+  { "ish", 1, 0, 28295 },
+  { "isi", 1, 0, 28300 },
+  { "isk", 1, 0, 28310 },
+  { "isl", 1, 0, 27061 },
+  { "ism", 1, 0, 28321 },
+  { "isn", 1, 0, 28330 },
+  { "iso", 1, 0, 28337 },
+  { "isr", 1, 0, 28343 },
+  { "ist", 1, 0, 28365 },
+  { "isu", 1, 0, 28373 },
+  { "it", 0, 0, 28396 },
+  { "ita", 1, 0, 28396 },
+  { "itb", 1, 0, 28404 },
+  { "itd", 1, 0, 28420 },
+  { "ite", 1, 0, 28437 },
+  { "iti", 1, 0, 28443 },
+  { "itk", 1, 0, 28457 },
+  { "itl", 1, 0, 28471 },
+  { "itm", 1, 0, 28479 },
+  { "ito", 1, 0, 28492 },
+  { "itr", 1, 0, 28500 },
+  { "its", 1, 0, 28506 },
+  { "itt", 1, 0, 28514 },
+  { "itv", 1, 0, 28527 },
+  { "itw", 1, 0, 28534 },
+  { "itx", 1, 0, 28538 },
+  { "ity", 1, 0, 28543 },
+  { "itz", 1, 0, 28558 },
+  { "iu", 0, 0, 27665 },
+  { "ium", 1, 0, 28564 },
+  { "ivb", 1, 0, 28573 },
+  { "ivv", 1, 0, 28580 },
+  { "iwk", 1, 0, 28587 },
+  { "iwm", 1, 0, 28593 },
+  { "iwo", 1, 0, 28598 },
+  { "iws", 1, 0, 28603 },
+  { "ixc", 1, 0, 28615 },
+  { "ixl", 1, 0, 28623 },
+  { "iya", 1, 0, 28628 },
+  { "iyo", 1, 0, 28634 },
+  { "iyx", 1, 0, 28641 },
+  { "izh", 1, 0, 28654 },
+  { "izr", 1, 0, 28662 },
+  { "izz", 1, 0, 28668 },
+  { "ja", 0, 0, 28673 },
+  { "jaa", 1, 0, 28682 },
+  { "jab", 1, 0, 28692 },
+  { "jac", 1, 0, 28697 },
+  { "jad", 1, 0, 28704 },
+  { "jae", 1, 0, 28712 },
+  { "jaf", 1, 0, 28718 },
+  { "jah", 1, 0, 28723 },
+  { "jaj", 1, 0, 28731 },
+  { "jak", 1, 0, 28737 },
+  { "jal", 1, 0, 28743 },
+  { "jam", 1, 0, 28753 },
+  { "jan", 1, 0, 28778 },
+  { "jao", 1, 0, 28785 },
+  { "jaq", 1, 0, 28793 },
+  { "jas", 1, 0, 28799 },
+  { "jat", 1, 0, 28824 },
+  { "jau", 1, 0, 28831 },
+  { "jav", 1, 0, 28836 },
+  { "jax", 1, 0, 28845 },
+  { "jay", 1, 0, 28858 },
+  { "jaz", 1, 0, 28869 },
+  { "jbe", 1, 0, 28874 },
+  { "jbi", 1, 0, 28887 },
+  { "jbj", 1, 0, 28895 },
+  { "jbk", 1, 0, 28903 },
+  { "jbm", 1, 0, 28912 },
+  { "jbn", 1, 0, 28918 },
+  { "jbo", 1, 0, 28925 },
+  { "jbr", 1, 0, 28932 },
+  { "jbt", 1, 0, 28948 },
+  { "jbu", 1, 0, 28956 },
+  { "jbw", 1, 0, 28968 },
+  { "jcs", 1, 0, 28979 },
+  { "jct", 1, 0, 29010 },
+  { "jda", 1, 0, 29019 },
+  { "jdg", 1, 0, 29023 },
+  { "jdt", 1, 0, 29031 },
+  { "jeb", 1, 0, 29041 },
+  { "jee", 1, 0, 29048 },
+  { "jeh", 1, 0, 29055 },
+  { "jei", 1, 0, 29059 },
+  { "jek", 1, 0, 29063 },
+  { "jel", 1, 0, 29072 },
+  { "jen", 1, 0, 29079 },
+  { "jer", 1, 0, 29083 },
+  { "jet", 1, 0, 29088 },
+  { "jeu", 1, 0, 29094 },
+  { "jgb", 1, 0, 29114 },
+  { "jge", 1, 0, 29120 },
+  { "jgk", 1, 0, 29135 },
+  { "jgo", 1, 0, 29140 },
+  { "jhi", 1, 0, 29147 },
+  { "jhs", 1, 0, 29153 },
+  { "jia", 1, 0, 29175 },
+  { "jib", 1, 0, 29180 },
+  { "jic", 1, 0, 29185 },
+  { "jid", 1, 0, 29189 },
+  { "jie", 1, 0, 29207 },
+  { "jig", 1, 0, 29213 },
+  { "jih", 1, 0, 29221 },
+  { "jii", 1, 0, 29229 },
+  { "jil", 1, 0, 29236 },
+  { "jim", 1, 0, 29242 },
+  { "jio", 1, 0, 29258 },
+  { "jiq", 1, 0, 29265 },
+  { "jit", 1, 0, 29277 },
+  { "jiu", 1, 0, 29282 },
+  { "jiv", 1, 0, 29295 },
+  { "jiy", 1, 0, 29301 },
+  { "jje", 1, 0, 29315 },
+  { "jjr", 1, 0, 29322 },
+  { "jka", 1, 0, 29329 },
+  { "jkm", 1, 0, 29335 },
+  { "jko", 1, 0, 29348 },
+  { "jkp", 1, 0, 29353 },
+  { "jkr", 1, 0, 29365 },
+  { "jks", 1, 0, 29378 },
+  { "jku", 1, 0, 29405 },
+  { "jle", 1, 0, 29411 },
+  { "jls", 1, 0, 29417 },
+  { "jma", 1, 0, 29440 },
+  { "jmb", 1, 0, 29445 },
+  { "jmc", 1, 0, 29452 },
+  { "jmd", 1, 0, 29460 },
+  { "jmi", 1, 0, 29468 },
+  { "jml", 1, 0, 29483 },
+  { "jmn", 1, 0, 29489 },
+  { "jmr", 1, 0, 29502 },
+  { "jms", 1, 0, 29509 },
+  { "jmw", 1, 0, 29525 },
+  { "jmx", 1, 0, 29533 },
+  { "jna", 1, 0, 29561 },
+  { "jnd", 1, 0, 29571 },
+  { "jng", 1, 0, 29580 },
+  { "jni", 1, 0, 29588 },
+  { "jnj", 1, 0, 29594 },
+  { "jnl", 1, 0, 29600 },
+  { "jns", 1, 0, 29606 },
+  { "job", 1, 0, 29615 },
+  { "jod", 1, 0, 29620 },
+  { "jog", 1, 0, 29629 },
+  { "jor", 1, 0, 29634 },
+  { "jos", 1, 0, 29640 },
+  { "jow", 1, 0, 29664 },
+  { "jpa", 1, 0, 29671 },
+  { "jpn", 1, 0, 28673 },
+  { "jpr", 1, 0, 29699 },
+  { "jqr", 1, 0, 29713 },
+  { "jra", 1, 0, 29720 },
+  { "jrb", 1, 0, 29726 },
+  { "jrr", 1, 0, 29739 },
+  { "jrt", 1, 0, 29744 },
+  { "jru", 1, 0, 29753 },
+  { "jsl", 1, 0, 29763 },
+  { "jua", 1, 0, 29786 },
+  { "jub", 1, 0, 29792 },
+  { "juc", 1, 0, 29798 },
+  { "jud", 1, 0, 29806 },
+  { "juh", 1, 0, 29817 },
+  { "jui", 1, 0, 29823 },
+  { "juk", 1, 0, 29832 },
+  { "jul", 1, 0, 29838 },
+  { "jum", 1, 0, 29844 },
+  { "jun", 1, 0, 29851 },
+  { "juo", 1, 0, 29857 },
+  { "jup", 1, 0, 29862 },
+  { "jur", 1, 0, 29869 },
+  { "jus", 1, 0, 29877 },
+  { "jut", 1, 0, 29897 },
+  { "juu", 1, 0, 29904 },
+  { "juw", 1, 0, 29907 },
+  { "juy", 1, 0, 29914 },
+  { "jv", 0, 0, 28836 },
+  { "jvd", 1, 0, 29920 },
+  { "jvn", 1, 0, 29928 },
+  { "jwi", 1, 0, 29948 },
+  { "jya", 1, 0, 29961 },
+  { "jye", 1, 0, 29969 },
+  { "jyy", 1, 0, 29990 },
+  { "ka", 0, 0, 22221 },
+  { "kaa", 1, 0, 29995 },
+  { "kab", 1, 0, 30007 },
+  { "kac", 1, 0, 30014 },
+  { "kad", 1, 0, 30021 },
+  { "kae", 1, 0, 30027 },
+  { "kaf", 1, 0, 30038 },
+  { "kag", 1, 0, 30044 },
+  { "kah", 1, 0, 30052 },
+  { "kai", 1, 0, 30084 },
+  { "kaj", 1, 0, 30093 },
+  { "kak", 1, 0, 30097 },
+  { "kal", 1, 0, 30107 },
+  { "kam", 1, 0, 30119 },
+  { "kan", 1, 0, 30133 },
+  { "kao", 1, 0, 30141 },
+  { "kap", 1, 0, 30155 },
+  { "kaq", 1, 0, 30162 },
+  { "kar", 0, 0, 30172 },
+  { "kas", 1, 0, 30188 },
+  { "kat", 1, 0, 22221 },
+  { "kau", 1, 0, 30197 },
+  { "kav", 1, 0, 30204 },
+  { "kaw", 1, 0, 30214 },
+  { "kax", 1, 0, 30219 },
+  { "kay", 1, 0, 30223 },
+  { "kaz", 1, 0, 30233 },
+  { "kba", 1, 0, 30240 },
+  { "kbb", 1, 0, 30248 },
+  { "kbc", 1, 0, 30258 },
+  { "kbd", 1, 0, 30267 },
+  { "kbe", 1, 0, 30277 },
+  { "kbg", 1, 0, 30283 },
+  { "kbh", 1, 0, 30290 },
+  { "kbi", 1, 0, 30297 },
+  { "kbj", 1, 0, 30305 },
+  { "kbk", 1, 0, 30310 },
+  { "kbl", 1, 0, 30324 },
+  { "kbm", 1, 0, 30332 },
+  { "kbn", 1, 0, 30337 },
+  { "kbo", 1, 0, 30369 },
+  { "kbp", 1, 0, 30376 },
+  { "kbq", 1, 0, 30384 },
+  { "kbr", 1, 0, 30391 },
+  { "kbs", 1, 0, 30396 },
+  { "kbt", 1, 0, 30402 },
+  { "kbu", 1, 0, 30408 },
+  { "kbv", 1, 0, 30416 },
+  { "kbw", 1, 0, 30433 },
+  { "kbx", 1, 0, 30439 },
+  { "kby", 1, 0, 30445 },
+  { "kbz", 1, 0, 30459 },
+  { "kca", 1, 0, 30465 },
+  { "kcb", 1, 0, 30472 },
+  { "kcc", 1, 0, 30480 },
+  { "kcd", 1, 0, 30487 },
+  { "kce", 1, 0, 30504 },
+  { "kcf", 1, 0, 30510 },
+  { "kcg", 1, 0, 30516 },
+  { "kch", 1, 0, 30521 },
+  { "kci", 1, 0, 30526 },
+  { "kcj", 1, 0, 30535 },
+  { "kck", 1, 0, 30543 },
+  { "kcl", 1, 0, 30551 },
+  { "kcm", 1, 0, 30575 },
+  { "kcn", 1, 0, 30607 },
+  { "kco", 1, 0, 30612 },
+  { "kcp", 1, 0, 30622 },
+  { "kcq", 1, 0, 30628 },
+  { "kcr", 1, 0, 30633 },
+  { "kcs", 1, 0, 30639 },
+  { "kct", 1, 0, 30647 },
+  { "kcu", 1, 0, 30653 },
+  { "kcv", 1, 0, 30669 },
+  { "kcw", 1, 0, 30674 },
+  { "kcx", 1, 0, 30682 },
+  { "kcy", 1, 0, 30698 },
+  { "kcz", 1, 0, 30707 },
+  { "kda", 1, 0, 30715 },
+  { "kdc", 1, 0, 30722 },
+  { "kdd", 1, 0, 30727 },
+  { "kde", 1, 0, 30743 },
+  { "kdf", 1, 0, 30751 },
+  { "kdg", 1, 0, 30758 },
+  { "kdh", 1, 0, 30763 },
+  { "kdi", 1, 0, 30767 },
+  { "kdj", 1, 0, 30773 },
+  { "kdk", 1, 0, 30784 },
+  { "kdl", 1, 0, 30792 },
+  { "kdm", 1, 0, 30801 },
+  { "kdn", 1, 0, 30808 },
+  { "kdp", 1, 0, 30814 },
+  { "kdq", 1, 0, 30831 },
+  { "kdr", 1, 0, 30836 },
+  { "kdt", 1, 0, 30843 },
+  { "kdu", 1, 0, 30847 },
+  { "kdw", 1, 0, 30854 },
+  { "kdx", 1, 0, 30862 },
+  { "kdy", 1, 0, 30866 },
+  { "kdz", 1, 0, 30872 },
+  { "kea", 1, 0, 30878 },
+  { "keb", 1, 0, 30891 },
+  { "kec", 1, 0, 30898 },
+  { "ked", 1, 0, 30904 },
+  { "kee", 1, 0, 30911 },
+  { "kef", 1, 0, 30926 },
+  { "keg", 1, 0, 30933 },
+  { "keh", 1, 0, 30938 },
+  { "kei", 1, 0, 30943 },
+  { "kej", 1, 0, 30947 },
+  { "kek", 1, 0, 30953 },
+  { "kel", 1, 0, 30961 },
+  { "kem", 1, 0, 30997 },
+  { "ken", 1, 0, 31003 },
+  { "keo", 1, 0, 31011 },
+  { "kep", 1, 0, 31017 },
+  { "keq", 1, 0, 31025 },
+  { "ker", 1, 0, 31031 },
+  { "kes", 1, 0, 31036 },
+  { "ket", 1, 0, 31042 },
+  { "keu", 1, 0, 31046 },
+  { "kev", 1, 0, 31052 },
+  { "kew", 1, 0, 31063 },
+  { "kex", 1, 0, 31074 },
+  { "key", 1, 0, 31080 },
+  { "kez", 1, 0, 31086 },
+  { "kfa", 1, 0, 31093 },
+  { "kfb", 1, 0, 31100 },
+  { "kfc", 1, 0, 31121 },
+  { "kfd", 1, 0, 31132 },
+  { "kfe", 1, 0, 31146 },
+  { "kff", 1, 0, 31159 },
+  { "kfg", 1, 0, 31164 },
+  { "kfh", 1, 0, 31171 },
+  { "kfi", 1, 0, 31181 },
+  { "kfj", 1, 0, 31198 },
+  { "kfk", 1, 0, 31207 },
+  { "kfl", 1, 0, 31216 },
+  { "kfm", 1, 0, 31221 },
+  { "kfn", 1, 0, 31230 },
+  { "kfo", 1, 0, 31234 },
+  { "kfp", 1, 0, 31256 },
+  { "kfq", 1, 0, 31262 },
+  { "kfr", 1, 0, 31268 },
+  { "kfs", 1, 0, 31275 },
+  { "kft", 1, 0, 31285 },
+  { "kfu", 1, 0, 31293 },
+  { "kfv", 1, 0, 31301 },
+  { "kfw", 1, 0, 31310 },
+  { "kfx", 1, 0, 31323 },
+  { "kfy", 1, 0, 31337 },
+  { "kfz", 1, 0, 31345 },
+  { "kg", 0, 0, 31354 },
+  { "kga", 1, 0, 31360 },
+  { "kgb", 1, 0, 31367 },
+  { "kge", 1, 0, 31372 },
+  { "kgf", 1, 0, 31381 },
+  { "kgg", 1, 0, 31386 },
+  { "kgi", 1, 0, 31394 },
+  { "kgj", 1, 0, 31417 },
+  { "kgk", 1, 0, 31430 },
+  { "kgl", 1, 0, 31437 },
+  { "kgm", 1, 0, 31446 },
+  { "kgn", 1, 0, 31456 },
+  { "kgo", 1, 0, 31466 },
+  { "kgp", 1, 0, 31473 },
+  { "kgq", 1, 0, 31482 },
+  { "kgr", 1, 0, 31489 },
+  { "kgs", 1, 0, 31494 },
+  { "kgt", 1, 0, 31506 },
+  { "kgu", 1, 0, 31513 },
+  { "kgv", 1, 0, 31519 },
+  { "kgw", 1, 0, 31525 },
+  { "kgx", 1, 0, 31536 },
+  { "kgy", 1, 0, 31543 },
+  { "kha", 1, 0, 31551 },
+  { "khb", 1, 0, 31557 },
+  { "khc", 1, 0, 31561 },
+  { "khd", 1, 0, 31579 },
+  { "khe", 1, 0, 31592 },
+  { "khf", 1, 0, 31600 },
+  { "khg", 1, 0, 31606 },
+  { "khh", 1, 0, 31621 },
+  { "khi", 0, 0, 31626 },
+  { "khj", 1, 0, 31644 },
+  { "khk", 1, 0, 31652 },
+  { "khl", 1, 0, 31668 },
+  { "khm", 1, 0, 31673 },
+  { "khn", 1, 0, 31679 },
+  { "kho", 1, 0, 31688 },
+  { "khp", 1, 0, 31698 },
+  { "khq", 1, 0, 31705 },
+  { "khr", 1, 0, 31727 },
+  { "khs", 1, 0, 31734 },
+  { "kht", 1, 0, 31740 },
+  { "khu", 1, 0, 31747 },
+  { "khv", 1, 0, 31755 },
+  { "khw", 1, 0, 31764 },
+  { "khx", 1, 0, 31771 },
+  { "khy", 1, 0, 31776 },
+  { "khz", 1, 0, 31812 },
+  { "ki", 0, 0, 31820 },
+  { "kia", 1, 0, 31835 },
+  { "kib", 1, 0, 31839 },
+  { "kic", 1, 0, 31846 },
+  { "kid", 1, 0, 31855 },
+  { "kie", 1, 0, 31862 },
+  { "kif", 1, 0, 31868 },
+  { "kig", 1, 0, 31890 },
+  { "kih", 1, 0, 31898 },
+  { "kii", 1, 0, 31906 },
+  { "kij", 1, 0, 31913 },
+  { "kik", 1, 0, 31922 },
+  { "kil", 1, 0, 31929 },
+  { "kim", 1, 0, 31936 },
+  { "kin", 1, 0, 31944 },
+  { "kio", 1, 0, 31956 },
+  { "kip", 1, 0, 31962 },
+  { "kiq", 1, 0, 31975 },
+  { "kir", 1, 0, 31983 },
+  { "kis", 1, 0, 31991 },
+  { "kit", 1, 0, 31995 },
+  { "kiu", 1, 0, 32000 },
+  { "kiv", 1, 0, 32032 },
+  { "kiw", 1, 0, 32038 },
+  { "kix", 1, 0, 32055 },
+  { "kiy", 1, 0, 32074 },
+  { "kiz", 1, 0, 32083 },
+  { "kj", 0, 0, 32088 },
+  { "kja", 1, 0, 32107 },
+  { "kjb", 1, 0, 32112 },
+  { "kjc", 1, 0, 32123 },
+  { "kjd", 1, 0, 32138 },
+  { "kje", 1, 0, 32154 },
+  { "kjg", 1, 0, 32160 },
+  { "kjh", 1, 0, 32165 },
+  { "kji", 1, 0, 32172 },
+  { "kjj", 1, 0, 32179 },
+  { "kjk", 1, 0, 32189 },
+  { "kjl", 1, 0, 32205 },
+  { "kjm", 1, 0, 32227 },
+  { "kjn", 1, 0, 32234 },
+  { "kjo", 1, 0, 32241 },
+  { "kjp", 1, 0, 32259 },
+  { "kjq", 1, 0, 32278 },
+  { "kjr", 1, 0, 32293 },
+  { "kjs", 1, 0, 32300 },
+  { "kjt", 1, 0, 32311 },
+  { "kju", 1, 0, 32328 },
+  { "kjv", 1, 0, 32336 },
+  { "kjx", 1, 0, 32364 },
+  { "kjy", 1, 0, 32371 },
+  { "kjz", 1, 0, 32377 },
+  { "kk", 0, 0, 30233 },
+  { "kka", 1, 0, 32389 },
+  { "kkb", 1, 0, 32397 },
+  { "kkc", 1, 0, 32405 },
+  { "kkd", 1, 0, 32413 },
+  { "kke", 1, 0, 32420 },
+  { "kkf", 1, 0, 32427 },
+  { "kkg", 1, 0, 32444 },
+  { "kkh", 1, 0, 32467 },
+  { "kki", 1, 0, 32473 },
+  { "kkj", 1, 0, 32480 },
+  { "kkk", 1, 0, 32485 },
+  { "kkl", 1, 0, 32492 },
+  { "kkm", 1, 0, 32506 },
+  { "kkn", 1, 0, 32512 },
+  { "kko", 1, 0, 32520 },
+  { "kkp", 1, 0, 32526 },
+  { "kkq", 1, 0, 32535 },
+  { "kkr", 1, 0, 32541 },
+  { "kks", 1, 0, 32551 },
+  { "kkt", 1, 0, 32557 },
+  { "kku", 1, 0, 32561 },
+  { "kkv", 1, 0, 32566 },
+  { "kkw", 1, 0, 32574 },
+  { "kkx", 1, 0, 32586 },
+  { "kky", 1, 0, 32592 },
+  { "kkz", 1, 0, 32608 },
+  { "kl", 0, 0, 32614 },
+  { "kla", 1, 0, 32639 },
+  { "klb", 1, 0, 32653 },
+  { "klc", 1, 0, 32660 },
+  { "kld", 1, 0, 32668 },
+  { "kle", 1, 0, 32679 },
+  { "klf", 1, 0, 32694 },
+  { "klg", 1, 0, 32702 },
+  { "klh", 1, 0, 32712 },
+  { "kli", 1, 0, 32719 },
+  { "klj", 1, 0, 32729 },
+  { "klk", 1, 0, 32736 },
+  { "kll", 1, 0, 32751 },
+  { "klm", 1, 1,     0 },
+  { "kln", 1, 1,     6 },
+  { "klo", 1, 1,    15 },
+  { "klp", 1, 1,    21 },
+  { "klq", 1, 1,    28 },
+  { "klr", 1, 1,    33 },
+  { "kls", 1, 1,    41 },
+  { "klt", 1, 1,    49 },
+  { "klu", 1, 1,    55 },
+  { "klv", 1, 1,    60 },
+  { "klw", 1, 1,    71 },
+  { "klx", 1, 1,    76 },
+  { "kly", 1, 1,    85 },
+  { "klz", 1, 1,    91 },
+  { "km", 0, 1,    98 },
+  { "kma", 1, 1,   112 },
+  { "kmb", 1, 1,   118 },
+  { "kmc", 1, 1,   127 },
+  { "kmd", 1, 1,   142 },
+  { "kme", 1, 1,   162 },
+  { "kmf", 1, 1,   169 },
+  { "kmg", 1, 1,   193 },
+  { "kmh", 1, 1,   199 },
+  { "kmi", 1, 1,   205 },
+  { "kmj", 1, 1,   220 },
+  { "kmk", 1, 1,   238 },
+  { "kml", 1, 1,   253 },
+  { "kmm", 1, 1,   270 },
+  { "kmn", 1, 1,   282 },
+  { "kmo", 1, 1,   288 },
+  { "kmp", 1, 1,   294 },
+  { "kmq", 1, 1,   300 },
+  { "kmr", 1, 1,   306 },
+  { "kms", 1, 1,   324 },
+  { "kmt", 1, 1,   332 },
+  { "kmu", 1, 1,   340 },
+  { "kmv", 1, 1,   347 },
+  { "kmw", 1, 1,   372 },
+  { "kmx", 1, 1,   408 },
+  { "kmy", 1, 1,   415 },
+  { "kmz", 1, 1,   420 },
+  { "kn", 0, 0, 30133 },
+  { "kna", 1, 1,   438 },
+  { "knb", 1, 1,   453 },
+  { "knc", 1, 1,   471 },
+  { "knd", 1, 1,   487 },
+  { "kne", 1, 1,   493 },
+  { "knf", 1, 1,   503 },
+  { "kng", 1, 1,   512 },
+  { "kni", 1, 1,   519 },
+  { "knj", 1, 1,   526 },
+  { "knk", 1, 1,   544 },
+  { "knl", 1, 1,   552 },
+  { "knm", 1, 1,   561 },
+  { "knn", 1, 1,   571 },
+  { "kno", 1, 1,   601 },
+  { "knp", 1, 1,   621 },
+  { "knq", 1, 1,   628 },
+  { "knr", 1, 1,   635 },
+  { "kns", 1, 1,   644 },
+  { "knt", 1, 1,   651 },
+  { "knu", 1, 1,   669 },
+  { "knv", 1, 1,   683 },
+  { "knw", 1, 1,   688 },
+  { "knx", 1, 1,   699 },
+  { "kny", 1, 1,   708 },
+  { "knz", 1, 1,   715 },
+  { "ko", 0, 1,   724 },
+  { "koa", 1, 1,   731 },
+  { "koc", 1, 1,   740 },
+  { "kod", 1, 1,   746 },
+  { "koe", 1, 1,   751 },
+  { "kof", 1, 1,   769 },
+  { "kog", 1, 1,   774 },
+  { "koh", 1, 1,   780 },
+  { "koi", 1, 1,   785 },
+  { "kok", 1, 1,   798 },
+  { "kol", 1, 1,   822 },
+  { "kom", 1, 1,   845 },
+  { "kon", 1, 0, 31354 },
+  { "koo", 1, 1,   850 },
+  { "kop", 1, 1,   856 },
+  { "koq", 1, 1,   862 },
+  { "kor", 1, 1,   724 },
+  { "kos", 1, 1,   875 },
+  { "kot", 1, 1,   884 },
+  { "kou", 1, 1,   891 },
+  { "kov", 1, 1,   896 },
+  { "kow", 1, 1,   906 },
+  { "koy", 1, 1,   913 },
+  { "koz", 1, 1,   921 },
+  { "kpa", 1, 1,   927 },
+  { "kpb", 1, 1,   933 },
+  { "kpc", 1, 1,   948 },
+  { "kpd", 1, 1,   958 },
+  { "kpe", 1, 1,   963 },
+  { "kpf", 1, 1,   970 },
+  { "kpg", 1, 1,   976 },
+  { "kph", 1, 1,   991 },
+  { "kpi", 1, 1,   998 },
+  { "kpj", 1, 1,  1004 },
+  { "kpk", 1, 1,  1012 },
+  { "kpl", 1, 1,  1017 },
+  { "kpm", 1, 1,  1023 },
+  { "kpn", 1, 1,  1028 },
+  { "kpo", 1, 1,  1040 },
+  { "kpq", 1, 1,  1047 },
+  { "kpr", 1, 1,  1060 },
+  { "kps", 1, 1,  1073 },
+  { "kpt", 1, 1,  1079 },
+  { "kpu", 1, 1,  1086 },
+  { "kpv", 1, 1,  1092 },
+  { "kpw", 1, 1,  1104 },
+  { "kpx", 1, 1,  1110 },
+  { "kpy", 1, 1,  1127 },
+  { "kpz", 1, 1,  1134 },
+  { "kqa", 1, 1,  1144 },
+  { "kqb", 1, 1,  1148 },
+  { "kqc", 1, 1,  1154 },
+  { "kqd", 1, 1,  1166 },
+  { "kqe", 1, 1,  1183 },
+  { "kqf", 1, 1,  1191 },
+  { "kqg", 1, 1,  1199 },
+  { "kqh", 1, 1,  1203 },
+  { "kqi", 1, 1,  1213 },
+  { "kqj", 1, 1,  1221 },
+  { "kqk", 1, 1,  1230 },
+  { "kql", 1, 1,  1243 },
+  { "kqm", 1, 1,  1251 },
+  { "kqn", 1, 1,  1257 },
+  { "kqo", 1, 1,  1264 },
+  { "kqp", 1, 1,  1279 },
+  { "kqq", 1, 1,  1286 },
+  { "kqr", 1, 1,  1293 },
+  { "kqs", 1, 1,  1304 },
+  { "kqt", 1, 1,  1320 },
+  { "kqu", 1, 1,  1341 },
+  { "kqv", 1, 1,  1347 },
+  { "kqw", 1, 1,  1354 },
+  { "kqx", 1, 1,  1361 },
+  { "kqy", 1, 1,  1366 },
+  { "kqz", 1, 1,  1374 },
+  { "kr", 0, 0, 30197 },
+  { "kra", 1, 1,  1381 },
+  { "krb", 1, 1,  1389 },
+  { "krc", 1, 1,  1396 },
+  { "krd", 1, 1,  1412 },
+  { "kre", 1, 1,  1426 },
+  { "krf", 1, 1,  1434 },
+  { "krh", 1, 1,  1449 },
+  { "kri", 1, 1,  1456 },
+  { "krj", 1, 1,  1461 },
+  { "krk", 1, 1,  1471 },
+  { "krl", 1, 1,  1477 },
+  { "krn", 1, 1,  1486 },
+  { "kro", 0, 1,  1491 },
+  { "krp", 1, 1,  1505 },
+  { "krr", 1, 1,  1511 },
+  { "krs", 1, 1,  1517 },
+  { "krt", 1, 1,  1531 },
+  { "kru", 1, 1,  1546 },
+  { "krv", 1, 1,  1553 },
+  { "krw", 1, 1,  1559 },
+  { "krx", 1, 1,  1574 },
+  { "kry", 1, 1,  1580 },
+  { "krz", 1, 1,  1586 },
+  { "ks", 0, 0, 30188 },
+  { "ksa", 1, 1,  1598 },
+  { "ksb", 1, 1,  1611 },
+  { "ksc", 1, 1,  1620 },
+  { "ksd", 1, 1,  1638 },
+  { "kse", 1, 1,  1645 },
+  { "ksf", 1, 1,  1650 },
+  { "ksg", 1, 1,  1656 },
+  { "ksh", 1, 1,  1664 },
+  { "ksi", 1, 1,  1672 },
+  { "ksj", 1, 1,  1678 },
+  { "ksk", 1, 1,  1683 },
+  { "ksl", 1, 1,  1689 },
+  { "ksm", 1, 1,  1696 },
+  { "ksn", 1, 1,  1702 },
+  { "kso", 1, 1,  1714 },
+  { "ksp", 1, 1,  1719 },
+  { "ksq", 1, 1,  1724 },
+  { "ksr", 1, 1,  1731 },
+  { "kss", 1, 1,  1738 },
+  { "kst", 1, 1,  1753 },
+  { "ksu", 1, 1,  1760 },
+  { "ksv", 1, 1,  1769 },
+  { "ksw", 1, 1,  1774 },
+  { "ksx", 1, 1,  1787 },
+  { "ksy", 1, 1,  1794 },
+  { "ksz", 1, 1,  1806 },
+  { "kta", 1, 1,  1813 },
+  { "ktb", 1, 1,  1819 },
+  { "ktc", 1, 1,  1828 },
+  { "ktd", 1, 1,  1835 },
+  { "kte", 1, 1,  1842 },
+  { "ktf", 1, 1,  1848 },
+  { "ktg", 1, 1,  1854 },
+  { "kth", 1, 1,  1864 },
+  { "kti", 1, 1,  1872 },
+  { "ktj", 1, 1,  1884 },
+  { "ktk", 1, 1,  1898 },
+  { "ktl", 1, 1,  1905 },
+  { "ktm", 1, 1,  1913 },
+  { "ktn", 1, 1,  1919 },
+  { "kto", 1, 1,  1930 },
+  { "ktp", 1, 1,  1935 },
+  { "ktq", 1, 1,  1941 },
+  { "kts", 1, 1,  1950 },
+  { "ktt", 1, 1,  1962 },
+  { "ktu", 1, 1,  1968 },
+  { "ktv", 1, 1,  2006 },
+  { "ktw", 1, 1,  2020 },
+  { "ktx", 1, 1,  2025 },
+  { "kty", 1, 1,  2035 },
+  { "ktz", 1, 1,  2063 },
+  { "ku", 0, 1,  2074 },
+  { "kua", 1, 1,  2082 },
+  { "kub", 1, 1,  2091 },
+  { "kuc", 1, 1,  2097 },
+  { "kud", 1, 1,  2104 },
+  { "kue", 1, 1,  2114 },
+  { "kuf", 1, 1,  2139 },
+  { "kug", 1, 1,  2153 },
+  { "kuh", 1, 1,  2158 },
+  { "kui", 1, 1,  2164 },
+  { "kuj", 1, 1,  2183 },
+  { "kuk", 1, 1,  2189 },
+  { "kul", 1, 1,  2195 },
+  { "kum", 1, 1,  2202 },
+  { "kun", 1, 1,  2208 },
+  { "kuo", 1, 1,  2215 },
+  { "kup", 1, 1,  2223 },
+  { "kuq", 1, 1,  2233 },
+  { "kur", 1, 1,  2074 },
+  { "kus", 1, 1,  2242 },
+  { "kut", 1, 1,  2249 },
+  { "kuu", 1, 1,  2257 },
+  { "kuv", 1, 1,  2274 },
+  { "kuw", 1, 1,  2278 },
+  { "kux", 1, 1,  2285 },
+  { "kuy", 1, 1,  2293 },
+  { "kuz", 1, 1,  2304 },
+  { "kv", 0, 1,   845 },
+  { "kva", 1, 1,  2310 },
+  { "kvb", 1, 1,  2319 },
+  { "kvc", 1, 1,  2324 },
+  { "kvd", 1, 1,  2329 },
+  { "kve", 1, 1,  2345 },
+  { "kvf", 1, 1,  2355 },
+  { "kvg", 1, 1,  2363 },
+  { "kvh", 1, 1,  2374 },
+  { "kvi", 1, 1,  2381 },
+  { "kvj", 1, 1,  2387 },
+  { "kvk", 1, 1,  2394 },
+  { "kvl", 1, 1,  2415 },
+  { "kvm", 1, 1,  2421 },
+  { "kvn", 1, 1,  2428 },
+  { "kvo", 1, 1,  2441 },
+  { "kvp", 1, 1,  2447 },
+  { "kvq", 1, 1,  2455 },
+  { "kvr", 1, 1,  2467 },
+  { "kvt", 1, 1,  2475 },
+  { "kvu", 1, 1,  2488 },
+  { "kvv", 1, 1,  2502 },
+  { "kvw", 1, 1,  2507 },
+  { "kvx", 1, 1,  2515 },
+  { "kvy", 1, 1,  2529 },
+  { "kvz", 1, 1,  2544 },
+  { "kw", 0, 0, 13941 },
+  { "kwa", 1, 1,  2554 },
+  { "kwb", 1, 1,  2559 },
+  { "kwc", 1, 1,  2563 },
+  { "kwd", 1, 1,  2571 },
+  { "kwe", 1, 1,  2577 },
+  { "kwf", 1, 1,  2584 },
+  { "kwg", 1, 1,  2593 },
+  { "kwh", 1, 1,  2608 },
+  { "kwi", 1, 1,  2615 },
+  { "kwj", 1, 1,  2628 },
+  { "kwk", 1, 1,  2635 },
+  { "kwl", 1, 1,  2644 },
+  { "kwm", 1, 1,  2651 },
+  { "kwn", 1, 1,  2658 },
+  { "kwo", 1, 1,  2667 },
+  { "kwp", 1, 1,  2676 },
+  { "kwr", 1, 1,  2682 },
+  { "kws", 1, 1,  2687 },
+  { "kwt", 1, 1,  2693 },
+  { "kwu", 1, 1,  2701 },
+  { "kwv", 1, 1,  2708 },
+  { "kww", 1, 1,  2724 },
+  { "kwx", 1, 1,  2731 },
+  { "kwy", 1, 1,  2739 },
+  { "kwz", 1, 1,  2759 },
+  { "kxa", 1, 1,  2765 },
+  { "kxb", 1, 1,  2773 },
+  { "kxc", 1, 1,  2779 },
+  { "kxd", 1, 1,  2785 },
+  { "kxf", 1, 1,  2792 },
+  { "kxh", 1, 1,  2809 },
+  { "kxi", 1, 1,  2825 },
+  { "kxj", 1, 1,  2841 },
+  { "kxk", 1, 1,  2847 },
+  { "kxm", 1, 1,  2861 },
+  { "kxn", 1, 1,  2877 },
+  { "kxo", 1, 1,  2902 },
+  { "kxp", 1, 1,  2909 },
+  { "kxq", 1, 1,  2924 },
+  { "kxr", 1, 1,  2939 },
+  { "kxs", 1, 1,  2963 },
+  { "kxt", 1, 1,  2971 },
+  { "kxv", 1, 1,  2978 },
+  { "kxw", 1, 1,  2983 },
+  { "kxx", 1, 1,  2989 },
+  { "kxy", 1, 1,  2996 },
+  { "kxz", 1, 1,  3003 },
+  { "ky", 0, 1,  3010 },
+  { "kya", 1, 1,  3026 },
+  { "kyb", 1, 1,  3032 },
+  { "kyc", 1, 1,  3048 },
+  { "kyd", 1, 1,  3054 },
+  { "kye", 1, 1,  3060 },
+  { "kyf", 1, 1,  3067 },
+  { "kyg", 1, 1,  3073 },
+  { "kyh", 1, 1,  3082 },
+  { "kyi", 1, 1,  3088 },
+  { "kyj", 1, 1,  3094 },
+  { "kyk", 1, 1,  3100 },
+  { "kyl", 1, 1,  3107 },
+  { "kym", 1, 1,  3116 },
+  { "kyn", 1, 1,  3124 },
+  { "kyo", 1, 1,  3145 },
+  { "kyp", 1, 1,  3151 },
+  { "kyq", 1, 1,  3156 },
+  { "kyr", 1, 1,  3162 },
+  { "kys", 1, 1,  3171 },
+  { "kyt", 1, 1,  3184 },
+  { "kyu", 1, 1,  3192 },
+  { "kyv", 1, 1,  3207 },
+  { "kyw", 1, 1,  3214 },
+  { "kyx", 1, 1,  3222 },
+  { "kyy", 1, 1,  3230 },
+  { "kyz", 1, 1,  3239 },
+  { "kza", 1, 1,  3247 },
+  { "kzb", 1, 1,  3265 },
+  { "kzc", 1, 1,  3273 },
+  { "kzd", 1, 1,  3292 },
+  { "kze", 1, 1,  3298 },
+  { "kzf", 1, 1,  3305 },
+  { "kzg", 1, 1,  3317 },
+  { "kzi", 1, 1,  3323 },
+  { "kzk", 1, 1,  3331 },
+  { "kzl", 1, 1,  3340 },
+  { "kzm", 1, 1,  3347 },
+  { "kzn", 1, 1,  3352 },
+  { "kzo", 1, 1,  3359 },
+  { "kzp", 1, 1,  3367 },
+  { "kzq", 1, 1,  3377 },
+  { "kzr", 1, 1,  3383 },
+  { "kzs", 1, 1,  3390 },
+  { "kzu", 1, 1,  3403 },
+  { "kzv", 1, 1,  3413 },
+  { "kzw", 1, 1,  3425 },
+  { "kzx", 1, 1,  3439 },
+  { "kzy", 1, 1,  3448 },
+  { "kzz", 1, 1,  3472 },
+  { "la", 0, 1,  3480 },
+  { "laa", 1, 1,  3486 },
+  { "lab", 1, 1,  3504 },
+  { "lac", 1, 1,  3513 },
+  { "lad", 1, 1,  3522 },
+  { "lae", 1, 1,  3529 },
+  { "laf", 1, 1,  3537 },
+  { "lag", 1, 1,  3544 },
+  { "lah", 1, 1,  3550 },
+  { "lai", 1, 1,  3557 },
+  { "laj", 1, 1,  3564 },
+  { "lal", 1, 1,  3579 },
+  { "lam", 1, 1,  3585 },
+  { "lan", 1, 1,  3591 },
+  { "lao", 1, 1,  3596 },
+  { "lap", 1, 1,  3600 },
+  { "laq", 1, 1,  3612 },
+  { "lar", 1, 1,  3619 },
+  { "las", 1, 1,  3626 },
+  { "lat", 1, 1,  3480 },
+  { "lau", 1, 1,  3638 },
+  { "lav", 1, 1,  3643 },
+  { "law", 1, 1,  3651 },
+  { "lax", 1, 1,  3657 },
+  { "lay", 1, 1,  3662 },
+  { "laz", 1, 1,  3672 },
+  { "lb", 0, 1,  3682 },
+  { "lbb", 1, 1,  3711 },
+  { "lbc", 1, 1,  3717 },
+  { "lbe", 1, 1,  3724 },
+  { "lbf", 1, 1,  3728 },
+  { "lbg", 1, 1,  3735 },
+  { "lbi", 1, 1,  3743 },
+  { "lbj", 1, 1,  3749 },
+  { "lbk", 1, 1,  3757 },
+  { "lbl", 1, 1,  3773 },
+  { "lbm", 1, 1,  3786 },
+  { "lbn", 1, 1,  3792 },
+  { "lbo", 1, 1,  3798 },
+  { "lbq", 1, 1,  3804 },
+  { "lbr", 1, 1,  3811 },
+  { "lbs", 1, 1,  3820 },
+  { "lbt", 1, 1,  3841 },
+  { "lbu", 1, 1,  3847 },
+  { "lbv", 1, 1,  3852 },
+  { "lbw", 1, 1,  3871 },
+  { "lbx", 1, 1,  3878 },
+  { "lby", 1, 1,  3887 },
+  { "lbz", 1, 1,  3896 },
+  { "lcc", 1, 1,  3903 },
+  { "lcd", 1, 1,  3912 },
+  { "lce", 1, 1,  3917 },
+  { "lcf", 1, 1,  3925 },
+  { "lch", 1, 1,  3930 },
+  { "lcl", 1, 1,  3938 },
+  { "lcm", 1, 1,  3945 },
+  { "lcp", 1, 1,  3952 },
+  { "lcq", 1, 1,  3966 },
+  { "lcs", 1, 1,  3971 },
+  { "lda", 1, 1,  3988 },
+  { "ldb", 1, 1,  3996 },
+  { "ldd", 1, 1,  4003 },
+  { "ldg", 1, 1,  4008 },
+  { "ldh", 1, 1,  4016 },
+  { "ldi", 1, 1,  4034 },
+  { "ldj", 1, 1,  4040 },
+  { "ldk", 1, 1,  4047 },
+  { "ldl", 1, 1,  4054 },
+  { "ldm", 1, 1,  4059 },
+  { "ldn", 1, 1,  4067 },
+  { "ldo", 1, 1,  4075 },
+  { "ldp", 1, 1,  4079 },
+  { "ldq", 1, 1,  4083 },
+  { "lea", 1, 1,  4088 },
+  { "leb", 1, 1,  4102 },
+  { "lec", 1, 1,  4112 },
+  { "led", 1, 1,  4117 },
+  { "lee", 1, 1,  4123 },
+  { "lef", 1, 1,  4131 },
+  { "leh", 1, 1,  4138 },
+  { "lei", 1, 1,  4144 },
+  { "lej", 1, 1,  4150 },
+  { "lek", 1, 1,  4158 },
+  { "lel", 1, 1,  4165 },
+  { "lem", 1, 1,  4201 },
+  { "len", 1, 1,  4210 },
+  { "leo", 1, 1,  4216 },
+  { "lep", 1, 1,  4232 },
+  { "leq", 1, 1,  4239 },
+  { "ler", 1, 1,  4247 },
+  { "les", 1, 1,  4254 },
+  { "let", 1, 1,  4259 },
+  { "leu", 1, 1,  4273 },
+  { "lev", 1, 1,  4297 },
+  { "lew", 1, 1,  4303 },
+  { "lex", 1, 1,  4315 },
+  { "ley", 1, 1,  4321 },
+  { "lez", 1, 1,  4330 },
+  { "lfa", 1, 1,  4339 },
+  { "lfn", 1, 1,  4344 },
+  { "lg", 0, 1,  4363 },
+  { "lga", 1, 1,  4369 },
+  { "lgb", 1, 1,  4376 },
+  { "lgg", 1, 1,  4382 },
+  { "lgh", 1, 1,  4390 },
+  { "lgi", 1, 1,  4397 },
+  { "lgk", 1, 1,  4405 },
+  { "lgl", 1, 1,  4414 },
+  { "lgm", 1, 1,  4419 },
+  { "lgn", 1, 1,  4431 },
+  { "lgo", 1, 1,  4437 },
+  { "lgq", 1, 1,  4457 },
+  { "lgr", 1, 1,  4463 },
+  { "lgt", 1, 1,  4469 },
+  { "lgu", 1, 1,  4474 },
+  { "lgz", 1, 1,  4481 },
+  { "lha", 1, 1,  4489 },
+  { "lhh", 1, 1,  4505 },
+  { "lhi", 1, 1,  4522 },
+  { "lhl", 1, 1,  4531 },
+  { "lhm", 1, 1,  4544 },
+  { "lhn", 1, 1,  4550 },
+  { "lhp", 1, 1,  4558 },
+  { "lhs", 1, 1,  4565 },
+  { "lht", 1, 1,  4573 },
+  { "lhu", 1, 1,  4581 },
+  { "li", 0, 1,  4586 },
+  { "lia", 1, 1,  4619 },
+  { "lib", 1, 1,  4639 },
+  { "lic", 1, 1,  4645 },
+  { "lid", 1, 1,  4650 },
+  { "lie", 1, 1,  4659 },
+  { "lif", 1, 1,  4666 },
+  { "lig", 1, 1,  4672 },
+  { "lih", 1, 1,  4678 },
+  { "lij", 1, 1,  4684 },
+  { "lik", 1, 1,  4693 },
+  { "lil", 1, 1,  4698 },
+  { "lim", 1, 1,  4707 },
+  { "lin", 1, 1,  4717 },
+  { "lio", 1, 1,  4725 },
+  { "lip", 1, 1,  4730 },
+  { "liq", 1, 1,  4738 },
+  { "lir", 1, 1,  4745 },
+  { "lis", 1, 1,  4763 },
+  { "lit", 1, 1,  4768 },
+  { "liu", 1, 1,  4779 },
+  { "liv", 1, 1,  4787 },
+  { "liw", 1, 1,  4791 },
+  { "lix", 1, 1,  4795 },
+  { "liy", 1, 1,  4803 },
+  { "liz", 1, 1,  4817 },
+  { "lja", 1, 1,  4825 },
+  { "lje", 1, 1,  4831 },
+  { "lji", 1, 1,  4837 },
+  { "ljl", 1, 1,  4845 },
+  { "ljp", 1, 1,  4850 },
+  { "ljw", 1, 1,  4862 },
+  { "ljx", 1, 1,  4872 },
+  { "lka", 1, 1,  4877 },
+  { "lkb", 1, 1,  4885 },
+  { "lkc", 1, 1,  4892 },
+  { "lkd", 1, 1,  4899 },
+  { "lke", 1, 1,  4908 },
+  { "lkh", 1, 1,  4914 },
+  { "lki", 1, 1,  4920 },
+  { "lkj", 1, 1,  4925 },
+  { "lkl", 1, 1,  4931 },
+  { "lkm", 1, 1,  4944 },
+  { "lkn", 1, 1,  4954 },
+  { "lko", 1, 1,  4960 },
+  { "lkr", 1, 1,  4966 },
+  { "lks", 1, 1,  4972 },
+  { "lkt", 1, 1,  4977 },
+  { "lku", 1, 1,  4984 },
+  { "lky", 1, 1,  4993 },
+  { "lla", 1, 1,  5000 },
+  { "llb", 1, 1,  5010 },
+  { "llc", 1, 1,  5015 },
+  { "lld", 1, 1,  5029 },
+  { "lle", 1, 1,  5035 },
+  { "llf", 1, 1,  5059 },
+  { "llg", 1, 1,  5066 },
+  { "llh", 1, 1,  5071 },
+  { "lli", 1, 1,  5076 },
+  { "llj", 1, 1,  5087 },
+  { "llk", 1, 1,  5099 },
+  { "lll", 1, 1,  5105 },
+  { "llm", 1, 1,  5111 },
+  { "lln", 1, 1,  5120 },
+  { "llp", 1, 1,  5132 },
+  { "llq", 1, 1,  5145 },
+  { "lls", 1, 1,  5151 },
+  { "llu", 1, 1,  5176 },
+  { "llx", 1, 1,  5180 },
+  { "lma", 1, 1,  5186 },
+  { "lmb", 1, 1,  5198 },
+  { "lmc", 1, 1,  5204 },
+  { "lmd", 1, 1,  5214 },
+  { "lme", 1, 1,  5220 },
+  { "lmf", 1, 1,  5227 },
+  { "lmg", 1, 1,  5242 },
+  { "lmh", 1, 1,  5250 },
+  { "lmi", 1, 1,  5262 },
+  { "lmj", 1, 1,  5268 },
+  { "lmk", 1, 1,  5282 },
+  { "lml", 1, 1,  5290 },
+  { "lmn", 1, 1,  5295 },
+  { "lmo", 1, 1,  5303 },
+  { "lmp", 1, 1,  5311 },
+  { "lmq", 1, 1,  5318 },
+  { "lmr", 1, 1,  5327 },
+  { "lmu", 1, 1,  5336 },
+  { "lmv", 1, 1,  5343 },
+  { "lmw", 1, 1,  5353 },
+  { "lmx", 1, 1,  5365 },
+  { "lmy", 1, 1,  5373 },
+  { "ln", 0, 1,  4717 },
+  { "lna", 1, 1,  5381 },
+  { "lnb", 1, 1,  5391 },
+  { "lnd", 1, 1,  5400 },
+  { "lng", 1, 1,  5409 },
+  { "lnh", 1, 1,  5421 },
+  { "lni", 1, 1,  5427 },
+  { "lnj", 1, 1,  5438 },
+  { "lnl", 1, 1,  5449 },
+  { "lnm", 1, 1,  5470 },
+  { "lnn", 1, 1,  5477 },
+  { "lns", 1, 1,  5491 },
+  { "lnu", 1, 1,  5499 },
+  { "lnw", 1, 1,  5507 },
+  { "lnz", 1, 1,  5514 },
+  { "lo", 0, 1,  3596 },
+  { "loa", 1, 1,  5520 },
+  { "lob", 1, 1,  5527 },
+  { "loc", 1, 1,  5532 },
+  { "loe", 1, 1,  5540 },
+  { "lof", 1, 1,  5547 },
+  { "log", 1, 1,  5553 },
+  { "loh", 1, 1,  5558 },
+  { "loi", 1, 1,  5564 },
+  { "loj", 1, 1,  5586 },
+  { "lok", 1, 1,  5590 },
+  { "lol", 1, 1,  5595 },
+  { "lom", 1, 1,  5601 },
+  { "lon", 1, 1,  5616 },
+  { "loo", 1, 1,  5630 },
+  { "lop", 1, 1,  5636 },
+  { "loq", 1, 1,  5641 },
+  { "lor", 1, 1,  5648 },
+  { "los", 1, 1,  5655 },
+  { "lot", 1, 1,  5661 },
+  { "lou", 1, 1,  5667 },
+  { "lov", 1, 1,  5685 },
+  { "low", 1, 1,  5690 },
+  { "lox", 1, 1,  5704 },
+  { "loy", 1, 1,  5709 },
+  { "loz", 1, 1,  5714 },
+  { "lpa", 1, 1,  5719 },
+  { "lpe", 1, 1,  5726 },
+  { "lpn", 1, 1,  5732 },
+  { "lpo", 1, 1,  5749 },
+  { "lpx", 1, 1,  5754 },
+  { "lqr", 1, 1,  5760 },
+  { "lra", 1, 1,  5766 },
+  { "lrc", 1, 1,  5779 },
+  { "lre", 1, 1,  5794 },
+  { "lrg", 1, 1,  5805 },
+  { "lri", 1, 1,  5813 },
+  { "lrk", 1, 1,  5821 },
+  { "lrl", 1, 1,  5828 },
+  { "lrm", 1, 1,  5833 },
+  { "lrn", 1, 1,  5840 },
+  { "lro", 1, 1,  5847 },
+  { "lrr", 1, 1,  5852 },
+  { "lrt", 1, 1,  5869 },
+  { "lrv", 1, 1,  5886 },
+  { "lrz", 1, 1,  5894 },
+  { "lsa", 1, 1,  5902 },
+  { "lsb", 1, 1,  5911 },
+  { "lsc", 1, 1,  5935 },
+  { "lsd", 1, 1,  5960 },
+  { "lse", 1, 1,  5973 },
+  { "lsh", 1, 1,  5981 },
+  { "lsi", 1, 1,  5986 },
+  { "lsl", 1, 1,  5992 },
+  { "lsm", 1, 1,  6014 },
+  { "lsn", 1, 1,  6021 },
+  { "lso", 1, 1,  6043 },
+  { "lsp", 1, 1,  6062 },
+  { "lsr", 1, 1,  6087 },
+  { "lss", 1, 1,  6093 },
+  { "lst", 1, 1,  6098 },
+  { "lsv", 1, 1,  6132 },
+  { "lsw", 1, 1,  6152 },
+  { "lsy", 1, 1,  6177 },
+  { "lt", 0, 1,  4768 },
+  { "ltc", 1, 1,  6201 },
+  { "ltg", 1, 1,  6222 },
+  { "lth", 1, 1,  6232 },
+  { "lti", 1, 1,  6237 },
+  { "ltn", 1, 1,  6254 },
+  { "lto", 1, 1,  6263 },
+  { "lts", 1, 1,  6270 },
+  { "ltu", 1, 1,  6278 },
+  { "ltz", 1, 1,  6283 },
+  { "lu", 0, 1,  6297 },
+  { "lua", 1, 1,  6310 },
+  { "lub", 1, 1,  6297 },
+  { "luc", 1, 1,  6321 },
+  { "lud", 1, 1,  6328 },
+  { "lue", 1, 1,  6335 },
+  { "luf", 1, 1,  6342 },
+  { "lug", 1, 1,  4363 },
+  { "lui", 1, 1,  6347 },
+  { "luj", 1, 1,  6355 },
+  { "luk", 1, 1,  6360 },
+  { "lul", 1, 1,  6370 },
+  { "lum", 1, 1,  6377 },
+  { "lun", 1, 1,  6384 },
+  { "luo", 1, 1,  6390 },
+  { "lup", 1, 1,  6415 },
+  { "luq", 1, 1,  6421 },
+  { "lur", 1, 1,  6428 },
+  { "lus", 1, 1,  6434 },
+  { "lut", 1, 1,  6441 },
+  { "luu", 1, 1,  6453 },
+  { "luv", 1, 1,  6466 },
+  { "luw", 1, 1,  6473 },
+  { "luy", 1, 1,  6488 },
+  { "luz", 1, 1,  6494 },
+  { "lv", 0, 1,  3643 },
+  { "lva", 1, 1,  6509 },
+  { "lvi", 1, 1,  6516 },
+  { "lvk", 1, 1,  6521 },
+  { "lvs", 1, 1,  6532 },
+  { "lvu", 1, 1,  6550 },
+  { "lwa", 1, 1,  6557 },
+  { "lwe", 1, 1,  6563 },
+  { "lwg", 1, 1,  6574 },
+  { "lwh", 1, 1,  6580 },
+  { "lwl", 1, 1,  6593 },
+  { "lwm", 1, 1,  6607 },
+  { "lwo", 1, 1,  6615 },
+  { "lws", 1, 1,  6620 },
+  { "lwt", 1, 1,  6643 },
+  { "lwu", 1, 1,  6652 },
+  { "lww", 1, 1,  6657 },
+  { "lxm", 1, 1,  6662 },
+  { "lya", 1, 1,  6672 },
+  { "lyg", 1, 1,  6680 },
+  { "lyn", 1, 1,  6689 },
+  { "lzh", 1, 1,  6696 },
+  { "lzl", 1, 1,  6714 },
+  { "lzn", 1, 1,  6723 },
+  { "lzz", 1, 1,  6737 },
+  { "maa", 1, 1,  6741 },
+  { "mab", 1, 1,  6773 },
+  { "mac", 0, 1,  6792 },
+  { "mad", 1, 1,  6803 },
+  { "mae", 1, 1,  6812 },
+  { "maf", 1, 1,  6821 },
+  { "mag", 1, 1,  6826 },
+  { "mah", 1, 1,  6833 },
+  { "mai", 1, 1,  6845 },
+  { "maj", 1, 1,  6854 },
+  { "mak", 1, 1,  6879 },
+  { "mal", 1, 1,  6887 },
+  { "mam", 1, 1,  6897 },
+  { "man", 1, 1,  6901 },
+  { "mao", 0, 1,  6910 },
+  { "map", 0, 1,  6916 },
+  { "maq", 1, 1,  6939 },
+  { "mar", 1, 1,  6963 },
+  { "mas", 1, 1,  6971 },
+  { "mat", 1, 1,  6977 },
+  { "mau", 1, 1,  7004 },
+  { "mav", 1, 1,  7021 },
+  { "maw", 1, 1,  7035 },
+  { "max", 1, 1,  7044 },
+  { "may", 0, 1,  7066 },
+  { "maz", 1, 1,  7072 },
+  { "mba", 1, 1,  7089 },
+  { "mbb", 1, 1,  7098 },
+  { "mbc", 1, 1,  7123 },
+  { "mbd", 1, 1,  7131 },
+  { "mbe", 1, 1,  7149 },
+  { "mbf", 1, 1,  7156 },
+  { "mbh", 1, 1,  7168 },
+  { "mbi", 1, 1,  7177 },
+  { "mbj", 1, 1,  7193 },
+  { "mbk", 1, 1,  7200 },
+  { "mbl", 1, 1,  7206 },
+  { "mbm", 1, 1,  7216 },
+  { "mbn", 1, 1,  7224 },
+  { "mbo", 1, 1,  7234 },
+  { "mbp", 1, 1,  7249 },
+  { "mbq", 1, 1,  7256 },
+  { "mbr", 1, 1,  7263 },
+  { "mbs", 1, 1,  7275 },
+  { "mbt", 1, 1,  7293 },
+  { "mbu", 1, 1,  7312 },
+  { "mbv", 1, 1,  7325 },
+  { "mbw", 1, 1,  7336 },
+  { "mbx", 1, 1,  7343 },
+  { "mby", 1, 1,  7370 },
+  { "mbz", 1, 1,  7377 },
+  { "mca", 1, 1,  7395 },
+  { "mcb", 1, 1,  7400 },
+  { "mcc", 1, 1,  7412 },
+  { "mcd", 1, 1,  7418 },
+  { "mce", 1, 1,  7429 },
+  { "mcf", 1, 1,  7447 },
+  { "mcg", 1, 1,  7455 },
+  { "mch", 1, 1,  7462 },
+  { "mci", 1, 1,  7474 },
+  { "mcj", 1, 1,  7479 },
+  { "mck", 1, 1,  7486 },
+  { "mcl", 1, 1,  7493 },
+  { "mcm", 1, 1,  7503 },
+  { "mcn", 1, 1,  7531 },
+  { "mco", 1, 1,  7538 },
+  { "mcp", 1, 1,  7553 },
+  { "mcq", 1, 1,  7559 },
+  { "mcr", 1, 1,  7563 },
+  { "mcs", 1, 1,  7569 },
+  { "mct", 1, 1,  7576 },
+  { "mcu", 1, 1,  7584 },
+  { "mcv", 1, 1,  7602 },
+  { "mcw", 1, 1,  7612 },
+  { "mcx", 1, 1,  7624 },
+  { "mcy", 1, 1,  7631 },
+  { "mcz", 1, 1,  7644 },
+  { "mda", 1, 1,  7650 },
+  { "mdb", 1, 1,  7665 },
+  { "mdc", 1, 1,  7672 },
+  { "mdd", 1, 1,  7696 },
+  { "mde", 1, 1,  7701 },
+  { "mdf", 1, 1,  7713 },
+  { "mdg", 1, 1,  7720 },
+  { "mdh", 1, 1,  7729 },
+  { "mdi", 1, 1,  7742 },
+  { "mdj", 1, 1,  7748 },
+  { "mdk", 1, 1,  7757 },
+  { "mdl", 1, 1,  7766 },
+  { "mdm", 1, 1,  7788 },
+  { "mdn", 1, 1,  7795 },
+  { "mdp", 1, 1,  7801 },
+  { "mdq", 1, 1,  7807 },
+  { "mdr", 1, 1,  7813 },
+  { "mds", 1, 1,  7820 },
+  { "mdt", 1, 1,  7845 },
+  { "mdu", 1, 1,  7851 },
+  { "mdv", 1, 1,  7857 },
+  { "mdw", 1, 1,  7889 },
+  { "mdx", 1, 1,  7895 },
+  { "mdy", 1, 1,  7901 },
+  { "mdz", 1, 1,  7917 },
+  { "mea", 1, 1,  7933 },
+  { "meb", 1, 1,  7939 },
+  { "mec", 1, 1,  7945 },
+  { "med", 1, 1,  7951 },
+  { "mee", 1, 1,  7957 },
+  { "mef", 1, 1,  7964 },
+  { "meh", 1, 1,  7970 },
+  { "mei", 1, 1,  8000 },
+  { "mej", 1, 1,  8006 },
+  { "mek", 1, 1,  8012 },
+  { "mel", 1, 1,  8018 },
+  { "mem", 1, 1,  8035 },
+  { "men", 1, 1,  8043 },
+  { "meo", 1, 1,  8064 },
+  { "mep", 1, 1,  8077 },
+  { "meq", 1, 1,  8087 },
+  { "mer", 1, 1,  8093 },
+  { "mes", 1, 1,  8098 },
+  { "met", 1, 1,  8106 },
+  { "meu", 1, 1,  8111 },
+  { "mev", 1, 1,  8116 },
+  { "mew", 1, 1,  8121 },
+  { "mey", 1, 1,  8127 },
+  { "mez", 1, 1,  8138 },
+  { "mfa", 1, 1,  8148 },
+  { "mfb", 1, 1,  8163 },
+  { "mfc", 1, 1,  8170 },
+  { "mfd", 1, 1,  8174 },
+  { "mfe", 1, 1,  8190 },
+  { "mff", 1, 1,  8199 },
+  { "mfg", 1, 1,  8204 },
+  { "mfh", 1, 1,  8212 },
+  { "mfi", 1, 1,  8218 },
+  { "mfj", 1, 1,  8226 },
+  { "mfk", 1, 1,  8233 },
+  { "mfl", 1, 1,  8245 },
+  { "mfm", 1, 1,  8251 },
+  { "mfn", 1, 1,  8264 },
+  { "mfo", 1, 1,  8284 },
+  { "mfp", 1, 1,  8288 },
+  { "mfq", 1, 1,  8304 },
+  { "mfr", 1, 1,  8309 },
+  { "mfs", 1, 1,  8321 },
+  { "mft", 1, 1,  8343 },
+  { "mfu", 1, 1,  8352 },
+  { "mfv", 1, 1,  8359 },
+  { "mfw", 1, 1,  8367 },
+  { "mfx", 1, 1,  8374 },
+  { "mfy", 1, 1,  8379 },
+  { "mfz", 1, 1,  8384 },
+  { "mg", 0, 1,  8391 },
+  { "mga", 1, 1,  8400 },
+  { "mgb", 1, 1,  8425 },
+  { "mgc", 1, 1,  8433 },
+  { "mgd", 1, 1,  8442 },
+  { "mge", 1, 1,  8447 },
+  { "mgf", 1, 1,  8453 },
+  { "mgg", 1, 1,  8460 },
+  { "mgh", 1, 1,  8469 },
+  { "mgi", 1, 1,  8484 },
+  { "mgj", 1, 1,  8491 },
+  { "mgk", 1, 1,  8499 },
+  { "mgl", 1, 1,  8505 },
+  { "mgm", 1, 1,  8519 },
+  { "mgn", 1, 1,  8526 },
+  { "mgo", 1, 1,  8533 },
+  { "mgp", 1, 1,  8539 },
+  { "mgq", 1, 1,  8554 },
+  { "mgr", 1, 1,  8561 },
+  { "mgs", 1, 1,  8574 },
+  { "mgt", 1, 1,  8591 },
+  { "mgu", 1, 1,  8598 },
+  { "mgv", 1, 1,  8604 },
+  { "mgw", 1, 1,  8612 },
+  { "mgy", 1, 1,  8620 },
+  { "mgz", 1, 1,  8627 },
+  { "mh", 0, 1,  6833 },
+  { "mha", 1, 1,  8634 },
+  { "mhb", 1, 1,  8648 },
+  { "mhc", 1, 1,  8657 },
+  { "mhd", 1, 1,  8663 },
+  { "mhe", 1, 1,  8669 },
+  { "mhf", 1, 1,  8676 },
+  { "mhg", 1, 1,  8682 },
+  { "mhi", 1, 1,  8688 },
+  { "mhj", 1, 1,  8694 },
+  { "mhk", 1, 1,  8702 },
+  { "mhl", 1, 1,  8710 },
+  { "mhm", 1, 1,  8718 },
+  { "mhn", 1, 1,  8733 },
+  { "mho", 1, 1,  8742 },
+  { "mhp", 1, 1,  8757 },
+  { "mhq", 1, 1,  8773 },
+  { "mhr", 1, 1,  8780 },
+  { "mhs", 1, 1,  8794 },
+  { "mht", 1, 1,  8811 },
+  { "mhu", 1, 1,  8822 },
+  { "mhw", 1, 1,  8836 },
+  { "mhx", 1, 1,  8845 },
+  { "mhy", 1, 1,  8850 },
+  { "mhz", 1, 1,  8859 },
+  { "mi", 0, 1,  6910 },
+  { "mia", 1, 1,  8877 },
+  { "mib", 1, 1,  8883 },
+  { "mic", 1, 1,  8903 },
+  { "mid", 1, 1,  8911 },
+  { "mie", 1, 1,  8919 },
+  { "mif", 1, 1,  8936 },
+  { "mig", 1, 1,  8947 },
+  { "mih", 1, 1,  8976 },
+  { "mii", 1, 1,  8992 },
+  { "mij", 1, 1,  9016 },
+  { "mik", 1, 1,  9021 },
+  { "mil", 1, 1,  9030 },
+  { "mim", 1, 1,  9047 },
+  { "min", 1, 1,  9069 },
+  { "mio", 1, 1,  9081 },
+  { "mip", 1, 1,  9107 },
+  { "miq", 1, 1,  9129 },
+  { "mir", 1, 1,  9138 },
+  { "mis", 1, 1,  9152 },
+  { "mit", 1, 1,  9170 },
+  { "miu", 1, 1,  9194 },
+  { "miw", 1, 1,  9215 },
+  { "mix", 1, 1,  9221 },
+  { "miy", 1, 1,  9238 },
+  { "miz", 1, 1,  9253 },
+  { "mjb", 1, 1,  9272 },
+  { "mjc", 1, 1,  9281 },
+  { "mjd", 1, 1,  9307 },
+  { "mje", 1, 1,  9324 },
+  { "mjg", 1, 1,  9331 },
+  { "mjh", 1, 1,  9334 },
+  { "mji", 1, 1,  9348 },
+  { "mjj", 1, 1,  9356 },
+  { "mjk", 1, 1,  9362 },
+  { "mjl", 1, 1,  9370 },
+  { "mjm", 1, 1,  9379 },
+  { "mjn", 1, 1,  9387 },
+  { "mjo", 1, 1,  9409 },
+  { "mjp", 1, 1,  9422 },
+  { "mjq", 1, 1,  9435 },
+  { "mjr", 1, 1,  9444 },
+  { "mjs", 1, 1,  9454 },
+  { "mjt", 1, 1,  9461 },
+  { "mju", 1, 1,  9476 },
+  { "mjv", 1, 1,  9487 },
+  { "mjw", 1, 1,  9494 },
+  { "mjx", 1, 1,  9500 },
+  { "mjy", 1, 1,  9507 },
+  { "mjz", 1, 1,  9515 },
+  { "mk", 0, 1,  6792 },
+  { "mka", 1, 1,  9521 },
+  { "mkb", 1, 1,  9526 },
+  { "mkc", 1, 1,  9538 },
+  { "mkd", 1, 1,  6792 },
+  { "mke", 1, 1,  9546 },
+  { "mkf", 1, 1,  9553 },
+  { "mkg", 1, 1,  9558 },
+  { "mkh", 0, 1,  9570 },
+  { "mki", 1, 1,  9590 },
+  { "mkj", 1, 1,  9597 },
+  { "mkk", 1, 1,  9606 },
+  { "mkl", 1, 1,  9611 },
+  { "mkm", 1, 1,  9618 },
+  { "mkn", 1, 1,  9625 },
+  { "mko", 1, 1,  9639 },
+  { "mkp", 1, 1,  9652 },
+  { "mkq", 1, 1,  9660 },
+  { "mkr", 1, 1,  9671 },
+  { "mks", 1, 1,  9677 },
+  { "mkt", 1, 1,  9698 },
+  { "mku", 1, 1,  9705 },
+  { "mkv", 1, 1,  9723 },
+  { "mkw", 1, 1,  9729 },
+  { "mkx", 1, 1,  9744 },
+  { "mky", 1, 1,  9763 },
+  { "mkz", 1, 1,  9776 },
+  { "ml", 0, 1,  6887 },
+  { "mla", 1, 1,  9784 },
+  { "mlb", 1, 1,  9789 },
+  { "mlc", 1, 1,  9795 },
+  { "mle", 1, 1,  9803 },
+  { "mlf", 1, 1,  9811 },
+  { "mlg", 1, 1,  8391 },
+  { "mlh", 1, 1,  9815 },
+  { "mli", 1, 1,  9820 },
+  { "mlj", 1, 1,  9830 },
+  { "mlk", 1, 1,  9836 },
+  { "mll", 1, 1,  9843 },
+  { "mlm", 1, 1,  9853 },
+  { "mln", 1, 1,  9859 },
+  { "mlo", 1, 1,  9867 },
+  { "mlp", 1, 1,  9873 },
+  { "mlq", 1, 1,  9880 },
+  { "mlr", 1, 1,  9900 },
+  { "mls", 1, 1,  9905 },
+  { "mlt", 1, 1,  9913 },
+  { "mlu", 1, 1,  9921 },
+  { "mlv", 1, 1,  9931 },
+  { "mlw", 1, 1,  9938 },
+  { "mlx", 1, 1,  9945 },
+  { "mlz", 1, 1,  9954 },
+  { "mma", 1, 1,  9963 },
+  { "mmb", 1, 1,  9968 },
+  { "mmc", 1, 1,  9975 },
+  { "mmd", 1, 1,  9995 },
+  { "mme", 1, 1, 10002 },
+  { "mmf", 1, 1, 10006 },
+  { "mmg", 1, 1, 10013 },
+  { "mmh", 1, 1, 10027 },
+  { "mmi", 1, 1, 10037 },
+  { "mmj", 1, 1, 10043 },
+  { "mmk", 1, 1, 10051 },
+  { "mml", 1, 1, 10062 },
+  { "mmm", 1, 1, 10070 },
+  { "mmn", 1, 1, 10075 },
+  { "mmo", 1, 1, 10083 },
+  { "mmp", 1, 1, 10097 },
+  { "mmq", 1, 1, 10103 },
+  { "mmr", 1, 1, 10109 },
+  { "mmt", 1, 1, 10131 },
+  { "mmu", 1, 1, 10141 },
+  { "mmv", 1, 1, 10148 },
+  { "mmw", 1, 1, 10155 },
+  { "mmx", 1, 1, 10160 },
+  { "mmy", 1, 1, 10166 },
+  { "mmz", 1, 1, 10174 },
+  { "mn", 0, 1, 10182 },
+  { "mna", 1, 1, 10192 },
+  { "mnb", 1, 1, 10198 },
+  { "mnc", 1, 1, 10203 },
+  { "mnd", 1, 1, 10210 },
+  { "mne", 1, 1, 10217 },
+  { "mnf", 1, 1, 10222 },
+  { "mng", 1, 1, 10230 },
+  { "mnh", 1, 1, 10245 },
+  { "mni", 1, 1, 10281 },
+  { "mnj", 1, 1, 10290 },
+  { "mnk", 1, 1, 10296 },
+  { "mnl", 1, 1, 10305 },
+  { "mnm", 1, 1, 10311 },
+  { "mnn", 1, 1, 10318 },
+  { "mno", 0, 1, 10334 },
+  { "mnp", 1, 1, 10351 },
+  { "mnq", 1, 1, 10368 },
+  { "mnr", 1, 1, 10375 },
+  { "mns", 1, 1, 10386 },
+  { "mnu", 1, 1, 10392 },
+  { "mnv", 1, 1, 10396 },
+  { "mnw", 1, 1, 10412 },
+  { "mnx", 1, 1, 10416 },
+  { "mny", 1, 1, 10425 },
+  { "mnz", 1, 1, 10433 },
+  { "moa", 1, 1, 10438 },
+  { "moc", 1, 1, 10443 },
+  { "mod", 1, 1, 10451 },
+  { "moe", 1, 1, 10460 },
+  { "mog", 1, 1, 10465 },
+  { "moh", 1, 1, 10475 },
+  { "moi", 1, 1, 10482 },
+  { "moj", 1, 1, 10487 },
+  { "mok", 1, 1, 10496 },
+  { "mom", 1, 1, 10503 },
+  { "mon", 1, 1, 10182 },
+  { "moo", 1, 1, 10510 },
+  { "mop", 1, 1, 10516 },
+  { "moq", 1, 1, 10528 },
+  { "mor", 1, 1, 10553 },
+  { "mos", 1, 1, 10558 },
+  { "mot", 1, 1, 10564 },
+  { "mou", 1, 1, 10570 },
+  { "mov", 1, 1, 10576 },
+  { "mow", 1, 1, 10583 },
+  { "mox", 1, 1, 10595 },
+  { "moy", 1, 1, 10602 },
+  { "moz", 1, 1, 10612 },
+  { "mpa", 1, 1, 10619 },
+  { "mpb", 1, 1, 10625 },
+  { "mpc", 1, 1, 10637 },
+  { "mpd", 1, 1, 10648 },
+  { "mpe", 1, 1, 10658 },
+  { "mpg", 1, 1, 10665 },
+  { "mph", 1, 1, 10671 },
+  { "mpi", 1, 1, 10677 },
+  { "mpj", 1, 1, 10683 },
+  { "mpk", 1, 1, 10696 },
+  { "mpl", 1, 1, 10709 },
+  { "mpm", 1, 1, 10723 },
+  { "mpn", 1, 1, 10741 },
+  { "mpo", 1, 1, 10749 },
+  { "mpp", 1, 1, 10753 },
+  { "mpq", 1, 1, 10761 },
+  { "mpr", 1, 1, 10768 },
+  { "mps", 1, 1, 10776 },
+  { "mpt", 1, 1, 10783 },
+  { "mpu", 1, 1, 10788 },
+  { "mpv", 1, 1, 10797 },
+  { "mpw", 1, 1, 10805 },
+  { "mpx", 1, 1, 10814 },
+  { "mpy", 1, 1, 10830 },
+  { "mpz", 1, 1, 10836 },
+  { "mqa", 1, 1, 10840 },
+  { "mqb", 1, 1, 10857 },
+  { "mqc", 1, 1, 10863 },
+  { "mqe", 1, 1, 10871 },
+  { "mqf", 1, 1, 10878 },
+  { "mqg", 1, 1, 10885 },
+  { "mqh", 1, 1, 10910 },
+  { "mqi", 1, 1, 10932 },
+  { "mqj", 1, 1, 10939 },
+  { "mqk", 1, 1, 10946 },
+  { "mql", 1, 1, 10971 },
+  { "mqm", 1, 1, 10979 },
+  { "mqn", 1, 1, 10996 },
+  { "mqo", 1, 1, 11005 },
+  { "mqp", 1, 1, 11012 },
+  { "mqq", 1, 1, 11019 },
+  { "mqr", 1, 1, 11027 },
+  { "mqs", 1, 1, 11034 },
+  { "mqt", 1, 1, 11047 },
+  { "mqu", 1, 1, 11051 },
+  { "mqv", 1, 1, 11059 },
+  { "mqw", 1, 1, 11066 },
+  { "mqx", 1, 1, 11073 },
+  { "mqy", 1, 1, 11080 },
+  { "mqz", 1, 1, 11090 },
+  { "mr", 0, 1,  6963 },
+  { "mra", 1, 1, 11095 },
+  { "mrb", 1, 1, 11102 },
+  { "mrc", 1, 1, 11109 },
+  { "mrd", 1, 1, 11118 },
+  { "mre", 1, 1, 11133 },
+  { "mrf", 1, 1, 11165 },
+  { "mrg", 1, 1, 11172 },
+  { "mrh", 1, 1, 11179 },
+  { "mri", 1, 1,  6910 },
+  { "mrj", 1, 1, 11190 },
+  { "mrk", 1, 1, 11204 },
+  { "mrl", 1, 1, 11213 },
+  { "mrm", 1, 1, 11225 },
+  { "mrn", 1, 1, 11232 },
+  { "mro", 1, 1, 11243 },
+  { "mrp", 1, 1, 11247 },
+  { "mrq", 1, 1, 11255 },
+  { "mrr", 1, 1, 11272 },
+  { "mrs", 1, 1, 11286 },
+  { "mrt", 1, 1, 11294 },
+  { "mru", 1, 1, 11309 },
+  { "mrv", 1, 1, 11325 },
+  { "mrw", 1, 1, 11335 },
+  { "mrx", 1, 1, 11343 },
+  { "mry", 1, 1, 11351 },
+  { "mrz", 1, 1, 11359 },
+  { "ms", 0, 1,  7066 },
+  { "msa", 1, 1, 11366 },
+  { "msb", 1, 1, 11388 },
+  { "msc", 1, 1, 11399 },
+  { "msd", 1, 1, 11417 },
+  { "mse", 1, 1, 11444 },
+  { "msf", 1, 1, 11450 },
+  { "msg", 1, 1, 11457 },
+  { "msh", 1, 1, 11464 },
+  { "msi", 1, 1, 11483 },
+  { "msj", 1, 1, 11496 },
+  { "msk", 1, 1, 11530 },
+  { "msl", 1, 1, 11538 },
+  { "msm", 1, 1, 11544 },
+  { "msn", 1, 1, 11559 },
+  { "mso", 1, 1, 11566 },
+  { "msp", 1, 1, 11573 },
+  { "msq", 1, 1, 11584 },
+  { "msr", 1, 1, 11589 },
+  { "mss", 1, 1, 11613 },
+  { "msu", 1, 1, 11626 },
+  { "msv", 1, 1, 11632 },
+  { "msw", 1, 1, 11639 },
+  { "msx", 1, 1, 11649 },
+  { "msy", 1, 1, 11658 },
+  { "msz", 1, 1, 11665 },
+  { "mt", 0, 1,  9913 },
+  { "mta", 1, 1, 11672 },
+  { "mtb", 1, 1, 11689 },
+  { "mtc", 1, 1, 11702 },
+  { "mtd", 1, 1, 11708 },
+  { "mte", 1, 1, 11716 },
+  { "mtf", 1, 1, 11739 },
+  { "mtg", 1, 1, 11764 },
+  { "mth", 1, 1, 11768 },
+  { "mti", 1, 1, 11776 },
+  { "mtj", 1, 1, 11801 },
+  { "mtk", 1, 1, 11809 },
+  { "mtl", 1, 1, 11814 },
+  { "mtm", 1, 1, 11821 },
+  { "mtn", 1, 1, 11827 },
+  { "mto", 1, 1, 11837 },
+  { "mtp", 1, 1, 11854 },
+  { "mtq", 1, 1, 11877 },
+  { "mtr", 1, 1, 11883 },
+  { "mts", 1, 1, 11890 },
+  { "mtt", 1, 1, 11895 },
+  { "mtu", 1, 1, 11900 },
+  { "mtv", 1, 1, 11918 },
+  { "mtw", 1, 1, 11926 },
+  { "mtx", 1, 1, 11947 },
+  { "mty", 1, 1, 11962 },
+  { "mua", 1, 1, 11967 },
+  { "mub", 1, 1, 11975 },
+  { "muc", 1, 1, 11980 },
+  { "mud", 1, 1, 11987 },
+  { "mue", 1, 1, 12001 },
+  { "mug", 1, 1, 12014 },
+  { "muh", 1, 1, 12020 },
+  { "mui", 1, 1, 12028 },
+  { "muj", 1, 1, 12033 },
+  { "muk", 1, 1, 12040 },
+  { "mul", 1, 1, 12046 },
+  { "mum", 1, 1, 12065 },
+  { "mun", 0, 1, 12073 },
+  { "muo", 1, 1, 12089 },
+  { "mup", 1, 1, 12095 },
+  { "muq", 1, 1, 12101 },
+  { "mur", 1, 1, 12123 },
+  { "mus", 1, 1, 12129 },
+  { "mut", 1, 1, 12135 },
+  { "muu", 1, 1, 12150 },
+  { "muv", 1, 1, 12156 },
+  { "mux", 1, 1, 12165 },
+  { "muy", 1, 1, 12172 },
+  { "muz", 1, 1, 12179 },
+  { "mva", 1, 1, 12185 },
+  { "mvb", 1, 1, 12191 },
+  { "mvd", 1, 1, 12199 },
+  { "mve", 1, 1, 12207 },
+  { "mvf", 1, 1, 12226 },
+  { "mvg", 1, 1, 12248 },
+  { "mvh", 1, 1, 12265 },
+  { "mvi", 1, 1, 12271 },
+  { "mvk", 1, 1, 12278 },
+  { "mvl", 1, 1, 12285 },
+  { "mvn", 1, 1, 12303 },
+  { "mvo", 1, 1, 12312 },
+  { "mvp", 1, 1, 12319 },
+  { "mvq", 1, 1, 12324 },
+  { "mvr", 1, 1, 12330 },
+  { "mvs", 1, 1, 12336 },
+  { "mvt", 1, 1, 12343 },
+  { "mvu", 1, 1, 12353 },
+  { "mvv", 1, 1, 12359 },
+  { "mvw", 1, 1, 12372 },
+  { "mvx", 1, 1, 12381 },
+  { "mvy", 1, 1, 12389 },
+  { "mvz", 1, 1, 12406 },
+  { "mwa", 1, 1, 12413 },
+  { "mwb", 1, 1, 12421 },
+  { "mwc", 1, 1, 12427 },
+  { "mwe", 1, 1, 12431 },
+  { "mwf", 1, 1, 12448 },
+  { "mwg", 1, 1, 12462 },
+  { "mwh", 1, 1, 12469 },
+  { "mwi", 1, 1, 12479 },
+  { "mwk", 1, 1, 12484 },
+  { "mwl", 1, 1, 12501 },
+  { "mwm", 1, 1, 12511 },
+  { "mwn", 1, 1, 12515 },
+  { "mwo", 1, 1, 12525 },
+  { "mwp", 1, 1, 12540 },
+  { "mwq", 1, 1, 12554 },
+  { "mwr", 1, 1, 12565 },
+  { "mws", 1, 1, 12573 },
+  { "mwt", 1, 1, 12589 },
+  { "mwu", 1, 1, 12595 },
+  { "mwv", 1, 1, 12601 },
+  { "mww", 1, 1, 12610 },
+  { "mwz", 1, 1, 12620 },
+  { "mxa", 1, 1, 12627 },
+  { "mxb", 1, 1, 12652 },
+  { "mxc", 1, 1, 12671 },
+  { "mxd", 1, 1, 12679 },
+  { "mxe", 1, 1, 12686 },
+  { "mxf", 1, 1, 12696 },
+  { "mxg", 1, 1, 12703 },
+  { "mxh", 1, 1, 12712 },
+  { "mxi", 1, 1, 12718 },
+  { "mxj", 1, 1, 12728 },
+  { "mxk", 1, 1, 12740 },
+  { "mxl", 1, 1, 12748 },
+  { "mxm", 1, 1, 12758 },
+  { "mxn", 1, 1, 12767 },
+  { "mxo", 1, 1, 12783 },
+  { "mxp", 1, 1, 12789 },
+  { "mxq", 1, 1, 12810 },
+  { "mxr", 1, 1, 12824 },
+  { "mxs", 1, 1, 12841 },
+  { "mxt", 1, 1, 12858 },
+  { "mxu", 1, 1, 12877 },
+  { "mxv", 1, 1, 12893 },
+  { "mxw", 1, 1, 12913 },
+  { "mxx", 1, 1, 12918 },
+  { "mxy", 1, 1, 12924 },
+  { "mxz", 1, 1, 12957 },
+  { "my", 0, 0, 10313 },
+  { "mya", 1, 0, 10313 },
+  { "myb", 1, 1, 12973 },
+  { "myc", 1, 1, 12978 },
+  { "mye", 1, 1, 12985 },
+  { "myf", 1, 1, 12991 },
+  { "myg", 1, 1, 13000 },
+  { "myh", 1, 1, 13006 },
+  { "myj", 1, 1, 13012 },
+  { "myk", 1, 1, 13021 },
+  { "myl", 1, 1, 13037 },
+  { "mym", 1, 1, 13042 },
+  { "myn", 0, 1, 13048 },
+  { "myo", 1, 1, 13064 },
+  { "myp", 1, 1, 13072 },
+  { "myr", 1, 1, 13080 },
+  { "mys", 1, 1, 13088 },
+  { "myu", 1, 1, 13095 },
+  { "myv", 1, 1, 13106 },
+  { "myw", 1, 1, 13112 },
+  { "myx", 1, 1, 13118 },
+  { "myy", 1, 1, 13126 },
+  { "myz", 1, 1, 13133 },
+  { "mza", 1, 1, 13152 },
+  { "mzb", 1, 1, 13183 },
+  { "mzc", 1, 1, 13191 },
+  { "mzd", 1, 1, 13216 },
+  { "mze", 1, 1, 13224 },
+  { "mzg", 1, 1, 13231 },
+  { "mzh", 1, 1, 13254 },
+  { "mzi", 1, 1, 13279 },
+  { "mzj", 1, 1, 13298 },
+  { "mzk", 1, 1, 13304 },
+  { "mzl", 1, 1, 13321 },
+  { "mzm", 1, 1, 13337 },
+  { "mzn", 1, 1, 13344 },
+  { "mzo", 1, 1, 13356 },
+  { "mzp", 1, 1, 13365 },
+  { "mzq", 1, 1, 13372 },
+  { "mzr", 1, 1, 13382 },
+  { "mzs", 1, 1, 13390 },
+  { "mzt", 1, 1, 13399 },
+  { "mzu", 1, 1, 13406 },
+  { "mzv", 1, 1, 13414 },
+  { "mzw", 1, 1, 13420 },
+  { "mzx", 1, 1, 13424 },
+  { "mzy", 1, 1, 13433 },
+  { "mzz", 1, 1, 13458 },
+  { "na", 0, 1, 13467 },
+  { "naa", 1, 1, 13473 },
+  { "nab", 1, 1, 13479 },
+  { "nac", 1, 1, 13501 },
+  { "nae", 1, 1, 13507 },
+  { "naf", 1, 1, 13516 },
+  { "nag", 1, 1, 13522 },
+  { "nah", 0, 1, 13534 },
+  { "nai", 0, 1, 13552 },
+  { "naj", 1, 1, 13584 },
+  { "nak", 1, 1, 13589 },
+  { "nal", 1, 1, 13597 },
+  { "nam", 1, 1, 13603 },
+  { "nan", 1, 1, 13619 },
+  { "nao", 1, 1, 13636 },
+  { "nap", 1, 1, 13642 },
+  { "naq", 1, 1, 13653 },
+  { "nar", 1, 1, 13662 },
+  { "nas", 1, 1, 13668 },
+  { "nat", 1, 1, 13676 },
+  { "nau", 1, 1, 13467 },
+  { "nav", 1, 1, 13694 },
+  { "naw", 1, 1, 13701 },
+  { "nax", 1, 1, 13708 },
+  { "nay", 1, 1, 13714 },
+  { "naz", 1, 1, 13727 },
+  { "nb", 0, 1, 13745 },
+  { "nba", 1, 1, 13783 },
+  { "nbb", 1, 1, 13790 },
+  { "nbc", 1, 1, 13795 },
+  { "nbd", 1, 1, 13807 },
+  { "nbe", 1, 1, 13815 },
+  { "nbg", 1, 1, 13828 },
+  { "nbh", 1, 1, 13838 },
+  { "nbi", 1, 1, 13844 },
+  { "nbj", 1, 1, 13854 },
+  { "nbk", 1, 1, 13865 },
+  { "nbl", 1, 1, 13870 },
+  { "nbm", 1, 1, 13885 },
+  { "nbn", 1, 1, 13898 },
+  { "nbo", 1, 1, 13903 },
+  { "nbp", 1, 1, 13911 },
+  { "nbq", 1, 1, 13916 },
+  { "nbr", 1, 1, 13922 },
+  { "nbs", 1, 1, 13929 },
+  { "nbt", 1, 1, 13952 },
+  { "nbu", 1, 1, 13955 },
+  { "nbv", 1, 1, 13969 },
+  { "nbw", 1, 1, 13978 },
+  { "nby", 1, 1, 13996 },
+  { "nca", 1, 1, 14004 },
+  { "ncb", 1, 1, 14008 },
+  { "ncc", 1, 1, 14028 },
+  { "ncd", 1, 1, 14034 },
+  { "nce", 1, 1, 14044 },
+  { "ncf", 1, 1, 14049 },
+  { "ncg", 1, 1, 14055 },
+  { "nch", 1, 1, 14063 },
+  { "nci", 1, 1, 14089 },
+  { "ncj", 1, 1, 14108 },
+  { "nck", 1, 1, 14133 },
+  { "ncl", 1, 1, 14141 },
+  { "ncm", 1, 1, 14161 },
+  { "ncn", 1, 1, 14167 },
+  { "nco", 1, 1, 14173 },
+  { "ncq", 1, 1, 14178 },
+  { "ncr", 1, 1, 14195 },
+  { "ncs", 1, 1, 14201 },
+  { "nct", 1, 1, 14226 },
+  { "ncu", 1, 1, 14239 },
+  { "ncx", 1, 1, 14250 },
+  { "ncz", 1, 1, 14274 },
+  { "nd", 0, 1, 14282 },
+  { "nda", 1, 1, 14312 },
+  { "ndb", 1, 1, 14318 },
+  { "ndc", 1, 1, 14331 },
+  { "ndd", 1, 1, 14336 },
+  { "nde", 1, 1, 14350 },
+  { "ndf", 1, 1, 14365 },
+  { "ndg", 1, 1, 14375 },
+  { "ndh", 1, 1, 14386 },
+  { "ndi", 1, 1, 14392 },
+  { "ndj", 1, 1, 14403 },
+  { "ndk", 1, 1, 14410 },
+  { "ndl", 1, 1, 14416 },
+  { "ndm", 1, 1, 14422 },
+  { "ndn", 1, 1, 14427 },
+  { "ndo", 1, 1, 14434 },
+  { "ndp", 1, 1, 14441 },
+  { "ndq", 1, 1, 14445 },
+  { "ndr", 1, 1, 14452 },
+  { "nds", 1, 1, 14459 },
+  { "ndt", 1, 1, 14471 },
+  { "ndu", 1, 1, 14478 },
+  { "ndv", 1, 1, 14484 },
+  { "ndw", 1, 1, 14489 },
+  { "ndx", 1, 1, 14495 },
+  { "ndy", 1, 1, 14501 },
+  { "ndz", 1, 1, 14507 },
+  { "ne", 0, 1, 14513 },
+  { "nea", 1, 1, 14520 },
+  { "neb", 1, 1, 14536 },
+  { "nec", 1, 1, 14559 },
+  { "ned", 1, 1, 14568 },
+  { "nee", 1, 1, 14578 },
+  { "nef", 1, 1, 14597 },
+  { "neg", 1, 1, 14606 },
+  { "neh", 1, 1, 14614 },
+  { "nei", 1, 1, 14622 },
+  { "nej", 1, 1, 14636 },
+  { "nek", 1, 1, 14641 },
+  { "nem", 1, 1, 14646 },
+  { "nen", 1, 1, 14651 },
+  { "neo", 1, 1, 14659 },
+  { "nep", 1, 1, 14667 },
+  { "neq", 1, 1, 14690 },
+  { "ner", 1, 1, 14710 },
+  { "nes", 1, 1, 14719 },
+  { "net", 1, 1, 14735 },
+  { "neu", 1, 1, 14740 },
+  { "nev", 1, 1, 14744 },
+  { "new", 1, 1, 14752 },
+  { "nex", 1, 1, 14759 },
+  { "ney", 1, 1, 14764 },
+  { "nez", 1, 1, 14769 },
+  { "nfa", 1, 1, 14779 },
+  { "nfd", 1, 1, 14784 },
+  { "nfl", 1, 1, 14790 },
+  { "nfr", 1, 1, 14796 },
+  { "nfu", 1, 1, 14805 },
+  { "ng", 0, 1, 14434 },
+  { "nga", 1, 1, 14812 },
+  { "ngb", 1, 1, 14819 },
+  { "ngc", 1, 1, 14837 },
+  { "ngd", 1, 1, 14875 },
+  { "nge", 1, 1, 14909 },
+  { "ngg", 1, 1, 14916 },
+  { "ngh", 1, 1, 14929 },
+  { "ngi", 1, 1, 14935 },
+  { "ngj", 1, 1, 14942 },
+  { "ngk", 1, 1, 14947 },
+  { "ngl", 1, 1, 14955 },
+  { "ngm", 1, 1, 14961 },
+  { "ngn", 1, 1, 14981 },
+  { "ngp", 1, 1, 14986 },
+  { "ngq", 1, 1, 14992 },
+  { "ngr", 1, 1, 15000 },
+  { "ngs", 1, 1, 15008 },
+  { "ngt", 1, 1, 15014 },
+  { "ngu", 1, 1, 15021 },
+  { "ngv", 1, 1, 15039 },
+  { "ngw", 1, 1, 15046 },
+  { "ngx", 1, 1, 15053 },
+  { "ngy", 1, 1, 15062 },
+  { "ngz", 1, 1, 15068 },
+  { "nha", 1, 1, 15077 },
+  { "nhb", 1, 1, 15084 },
+  { "nhc", 1, 1, 15089 },
+  { "nhd", 1, 1, 15106 },
+  { "nhe", 1, 1, 15115 },
+  { "nhf", 1, 1, 15141 },
+  { "nhg", 1, 1, 15149 },
+  { "nhh", 1, 1, 15169 },
+  { "nhi", 1, 1, 15176 },
+  { "nhk", 1, 1, 15219 },
+  { "nhm", 1, 1, 15249 },
+  { "nhn", 1, 1, 15266 },
+  { "nho", 1, 1, 15283 },
+  { "nhp", 1, 1, 15289 },
+  { "nhq", 1, 1, 15314 },
+  { "nhr", 1, 1, 15334 },
+  { "nht", 1, 1, 15339 },
+  { "nhu", 1, 1, 15357 },
+  { "nhv", 1, 1, 15363 },
+  { "nhw", 1, 1, 15386 },
+  { "nhx", 1, 1, 15412 },
+  { "nhy", 1, 1, 15439 },
+  { "nhz", 1, 1, 15464 },
+  { "nia", 1, 1, 15494 },
+  { "nib", 1, 1, 15499 },
+  { "nic", 0, 1, 15506 },
+  { "nid", 1, 1, 15534 },
+  { "nie", 1, 1, 15541 },
+  { "nif", 1, 1, 15549 },
+  { "nig", 1, 1, 15553 },
+  { "nih", 1, 1, 15563 },
+  { "nii", 1, 1, 15580 },
+  { "nij", 1, 1, 15584 },
+  { "nik", 1, 1, 15590 },
+  { "nil", 1, 1, 15611 },
+  { "nim", 1, 1, 15616 },
+  { "nin", 1, 1, 15624 },
+  { "nio", 1, 1, 15630 },
+  { "niq", 1, 1, 15639 },
+  { "nir", 1, 1, 15645 },
+  { "nis", 1, 1, 15654 },
+  { "nit", 1, 1, 15659 },
+  { "niu", 1, 1, 15680 },
+  { "niv", 1, 1, 15687 },
+  { "niw", 1, 1, 15694 },
+  { "nix", 1, 1, 15699 },
+  { "niy", 1, 1, 15704 },
+  { "niz", 1, 1, 15710 },
+  { "nja", 1, 1, 15717 },
+  { "njb", 1, 1, 15724 },
+  { "njd", 1, 1, 15736 },
+  { "njh", 1, 1, 15749 },
+  { "nji", 1, 1, 15761 },
+  { "njj", 1, 1, 15769 },
+  { "njl", 1, 1, 15774 },
+  { "njm", 1, 1, 15786 },
+  { "njn", 1, 1, 15799 },
+  { "njo", 1, 1, 15814 },
+  { "njr", 1, 1, 15823 },
+  { "njs", 1, 1, 15830 },
+  { "njt", 1, 1, 15835 },
+  { "nju", 1, 1, 15854 },
+  { "njx", 1, 1, 15866 },
+  { "njy", 1, 1, 15872 },
+  { "njz", 1, 1, 15878 },
+  { "nka", 1, 1, 15885 },
+  { "nkb", 1, 1, 15891 },
+  { "nkc", 1, 1, 15904 },
+  { "nkd", 1, 1, 15912 },
+  { "nke", 1, 1, 15920 },
+  { "nkf", 1, 1, 15925 },
+  { "nkg", 1, 1, 15937 },
+  { "nkh", 1, 1, 15945 },
+  { "nki", 1, 1, 15958 },
+  { "nkj", 1, 1, 15972 },
+  { "nkk", 1, 1, 15978 },
+  { "nkm", 1, 1, 15985 },
+  { "nkn", 1, 1, 15991 },
+  { "nko", 1, 1, 16000 },
+  { "nkp", 1, 1, 16007 },
+  { "nkq", 1, 1, 16020 },
+  { "nkr", 1, 1, 16026 },
+  { "nks", 1, 1, 16034 },
+  { "nkt", 1, 1, 16047 },
+  { "nku", 1, 1, 16064 },
+  { "nkv", 1, 1, 16079 },
+  { "nkw", 1, 1, 16105 },
+  { "nkx", 1, 1, 16111 },
+  { "nkz", 1, 1, 16118 },
+  { "nl", 0, 0, 18488 },
+  { "nla", 1, 1, 16124 },
+  { "nlc", 1, 1, 16133 },
+  { "nld", 1, 1, 16139 },
+  { "nle", 1, 1, 16145 },
+  { "nlg", 1, 1, 16157 },
+  { "nli", 1, 1, 16162 },
+  { "nlj", 1, 1, 16171 },
+  { "nlk", 1, 1, 16177 },
+  { "nll", 1, 1, 16189 },
+  { "nlm", 1, 1, 16196 },
+  { "nlo", 1, 1, 16206 },
+  { "nlq", 1, 1, 16211 },
+  { "nlu", 1, 1, 16221 },
+  { "nlv", 1, 1, 16231 },
+  { "nlw", 1, 1, 16248 },
+  { "nlx", 1, 1, 16258 },
+  { "nly", 1, 1, 16265 },
+  { "nlz", 1, 1, 16272 },
+  { "nma", 1, 1, 16280 },
+  { "nmb", 1, 1, 16292 },
+  { "nmc", 1, 1, 16304 },
+  { "nmd", 1, 1, 16309 },
+  { "nme", 1, 1, 16315 },
+  { "nmf", 1, 1, 16328 },
+  { "nmg", 1, 1, 16351 },
+  { "nmh", 1, 1, 16358 },
+  { "nmi", 1, 1, 16372 },
+  { "nmj", 1, 1, 16377 },
+  { "nmk", 1, 1, 16411 },
+  { "nml", 1, 1, 16420 },
+  { "nmm", 1, 1, 16427 },
+  { "nmn", 1, 1, 16436 },
+  { "nmo", 1, 1, 16444 },
+  { "nmp", 1, 1, 16456 },
+  { "nmq", 1, 1, 16465 },
+  { "nmr", 1, 1, 16472 },
+  { "nms", 1, 1, 16480 },
+  { "nmt", 1, 1, 16489 },
+  { "nmu", 1, 1, 16499 },
+  { "nmv", 1, 1, 16516 },
+  { "nmw", 1, 1, 16524 },
+  { "nmx", 1, 1, 16530 },
+  { "nmy", 1, 1, 16554 },
+  { "nmz", 1, 1, 16561 },
+  { "nn", 0, 1, 16567 },
+  { "nna", 1, 1, 16605 },
+  { "nnb", 1, 1, 16617 },
+  { "nnc", 1, 1, 16623 },
+  { "nnd", 1, 1, 16631 },
+  { "nne", 1, 1, 16643 },
+  { "nnf", 1, 1, 16653 },
+  { "nng", 1, 1, 16660 },
+  { "nnh", 1, 1, 16673 },
+  { "nni", 1, 1, 16683 },
+  { "nnj", 1, 1, 16697 },
+  { "nnk", 1, 1, 16707 },
+  { "nnl", 1, 1, 16715 },
+  { "nnm", 1, 1, 16737 },
+  { "nnn", 1, 1, 16743 },
+  { "nno", 1, 1, 16749 },
+  { "nnp", 1, 1, 16767 },
+  { "nnq", 1, 1, 16780 },
+  { "nnr", 1, 1, 16787 },
+  { "nnt", 1, 1, 16796 },
+  { "nnu", 1, 1, 16806 },
+  { "nnv", 1, 1, 16812 },
+  { "nnw", 1, 1, 16831 },
+  { "nny", 1, 1, 16846 },
+  { "nnz", 1, 1, 16854 },
+  { "no", 0, 1, 16863 },
+  { "noa", 1, 1, 16873 },
+  { "nob", 1, 1, 16882 },
+  { "noc", 1, 1, 16900 },
+  { "nod", 1, 1, 16904 },
+  { "noe", 1, 1, 16919 },
+  { "nof", 1, 1, 16926 },
+  { "nog", 1, 1, 16933 },
+  { "noh", 1, 1, 16939 },
+  { "noi", 1, 1, 16944 },
+  { "noj", 1, 1, 16950 },
+  { "nok", 1, 1, 16957 },
+  { "nol", 1, 1, 16966 },
+  { "nom", 1, 1, 16974 },
+  { "non", 1, 1, 16983 },
+  { "nop", 1, 1, 16994 },
+  { "noq", 1, 1, 17005 },
+  { "nor", 1, 1, 16863 },
+  { "nos", 1, 1, 17012 },
+  { "not", 1, 1, 17026 },
+  { "nou", 1, 1, 17040 },
+  { "nov", 1, 1, 17051 },
+  { "now", 1, 1, 17058 },
+  { "noy", 1, 1, 17065 },
+  { "noz", 1, 1, 17069 },
+  { "npa", 1, 1, 17074 },
+  { "npb", 1, 1, 17082 },
+  { "npg", 1, 1, 17091 },
+  { "nph", 1, 1, 17112 },
+  { "npi", 1, 1, 17123 },
+  { "npl", 1, 1, 17152 },
+  { "npn", 1, 1, 17181 },
+  { "npo", 1, 1, 17193 },
+  { "nps", 1, 1, 17207 },
+  { "npu", 1, 1, 17214 },
+  { "npx", 1, 1, 17227 },
+  { "npy", 1, 1, 17233 },
+  { "nqg", 1, 1, 17238 },
+  { "nqk", 1, 1, 17253 },
+  { "nql", 1, 1, 17268 },
+  { "nqm", 1, 1, 17280 },
+  { "nqn", 1, 1, 17285 },
+  { "nqo", 1, 1, 17289 },
+  { "nqq", 1, 1, 17294 },
+  { "nqt", 1, 1, 17312 },
+  { "nqy", 1, 1, 17318 },
+  { "nr", 0, 1, 17336 },
+  { "nra", 1, 1, 17366 },
+  { "nrb", 1, 1, 17371 },
+  { "nrc", 1, 1, 17376 },
+  { "nre", 1, 1, 17382 },
+  { "nrf", 1, 1, 17404 },
+  { "nrg", 1, 1, 17414 },
+  { "nri", 1, 1, 17422 },
+  { "nrk", 1, 1, 17435 },
+  { "nrl", 1, 1, 17442 },
+  { "nrm", 1, 1, 17451 },
+  { "nrn", 1, 1, 17457 },
+  { "nrp", 1, 1, 17462 },
+  { "nrr", 1, 1, 17476 },
+  { "nrt", 1, 1, 17482 },
+  { "nru", 1, 1, 17501 },
+  { "nrx", 1, 1, 17507 },
+  { "nrz", 1, 1, 17516 },
+  { "nsa", 1, 1, 17521 },
+  { "nsb", 1, 1, 17535 },
+  { "nsc", 1, 1, 17548 },
+  { "nsd", 1, 1, 17553 },
+  { "nse", 1, 1, 17568 },
+  { "nsf", 1, 1, 17575 },
+  { "nsg", 1, 1, 17594 },
+  { "nsh", 1, 1, 17600 },
+  { "nsi", 1, 1, 17608 },
+  { "nsk", 1, 1, 17631 },
+  { "nsl", 1, 1, 17639 },
+  { "nsm", 1, 1, 17663 },
+  { "nsn", 1, 1, 17674 },
+  { "nso", 1, 1, 17680 },
+  { "nsp", 1, 1, 17685 },
+  { "nsq", 1, 1, 17708 },
+  { "nsr", 1, 1, 17731 },
+  { "nss", 1, 1, 17754 },
+  { "nst", 1, 1, 17759 },
+  { "nsu", 1, 1, 17770 },
+  { "nsv", 1, 1, 17792 },
+  { "nsw", 1, 1, 17811 },
+  { "nsx", 1, 1, 17817 },
+  { "nsy", 1, 1, 17824 },
+  { "nsz", 1, 1, 17830 },
+  { "ntd", 1, 1, 17838 },
+  { "nte", 1, 1, 17855 },
+  { "ntg", 1, 1, 17864 },
+  { "nti", 1, 1, 17877 },
+  { "ntj", 1, 1, 17885 },
+  { "ntk", 1, 1, 17899 },
+  { "ntm", 1, 1, 17917 },
+  { "nto", 1, 1, 17924 },
+  { "ntp", 1, 1, 17931 },
+  { "ntr", 1, 1, 17950 },
+  { "ntu", 1, 1, 17955 },
+  { "ntw", 1, 1, 17963 },
+  { "ntx", 1, 1, 17972 },
+  { "nty", 1, 1, 17997 },
+  { "ntz", 1, 1, 18004 },
+  { "nua", 1, 1, 18012 },
+  { "nub", 0, 1, 18019 },
+  { "nuc", 1, 1, 18036 },
+  { "nud", 1, 1, 18044 },
+  { "nue", 1, 1, 18050 },
+  { "nuf", 1, 1, 18057 },
+  { "nug", 1, 1, 18062 },
+  { "nuh", 1, 1, 18070 },
+  { "nui", 1, 1, 18077 },
+  { "nuj", 1, 1, 18084 },
+  { "nuk", 1, 1, 18090 },
+  { "nul", 1, 1, 18105 },
+  { "num", 1, 1, 18115 },
+  { "nun", 1, 1, 18125 },
+  { "nuo", 1, 1, 18131 },
+  { "nup", 1, 1, 18138 },
+  { "nuq", 1, 1, 18153 },
+  { "nur", 1, 1, 18162 },
+  { "nus", 1, 1, 18170 },
+  { "nut", 1, 1, 18175 },
+  { "nuu", 1, 1, 18191 },
+  { "nuv", 1, 1, 18199 },
+  { "nuw", 1, 1, 18214 },
+  { "nux", 1, 1, 18223 },
+  { "nuy", 1, 1, 18229 },
+  { "nuz", 1, 1, 18240 },
+  { "nv", 0, 1, 18261 },
+  { "nvh", 1, 1, 18276 },
+  { "nvm", 1, 1, 18285 },
+  { "nvo", 1, 1, 18292 },
+  { "nwa", 1, 1, 18299 },
+  { "nwb", 1, 1, 18313 },
+  { "nwc", 1, 1, 18320 },
+  { "nwe", 1, 1, 18338 },
+  { "nwg", 1, 1, 18343 },
+  { "nwi", 1, 1, 18353 },
+  { "nwm", 1, 1, 18370 },
+  { "nwo", 1, 1, 18383 },
+  { "nwr", 1, 1, 18388 },
+  { "nww", 1, 1, 18395 },
+  { "nwx", 1, 1, 18402 },
+  { "nwy", 1, 1, 18416 },
+  { "nxa", 1, 1, 18434 },
+  { "nxd", 1, 1, 18441 },
+  { "nxe", 1, 1, 18479 },
+  { "nxg", 1, 1, 18484 },
+  { "nxi", 1, 1, 18491 },
+  { "nxk", 1, 1, 18497 },
+  { "nxl", 1, 1, 18508 },
+  { "nxm", 1, 1, 18522 },
+  { "nxn", 1, 1, 18531 },
+  { "nxo", 1, 1, 18538 },
+  { "nxq", 1, 1, 18547 },
+  { "nxr", 1, 1, 18552 },
+  { "nxx", 1, 1, 18562 },
+  { "ny", 0, 1, 18568 },
+  { "nya", 1, 1, 18592 },
+  { "nyb", 1, 1, 18599 },
+  { "nyc", 1, 1, 18607 },
+  { "nyd", 1, 1, 18617 },
+  { "nye", 1, 1, 18623 },
+  { "nyf", 1, 1, 18630 },
+  { "nyg", 1, 1, 18638 },
+  { "nyh", 1, 1, 18645 },
+  { "nyi", 1, 1, 18653 },
+  { "nyj", 1, 1, 18665 },
+  { "nyk", 1, 1, 18672 },
+  { "nyl", 1, 1, 18680 },
+  { "nym", 1, 1, 18685 },
+  { "nyn", 1, 1, 18694 },
+  { "nyo", 1, 1, 18703 },
+  { "nyp", 1, 1, 18709 },
+  { "nyq", 1, 1, 18717 },
+  { "nyr", 1, 1, 18724 },
+  { "nys", 1, 1, 18739 },
+  { "nyt", 1, 1, 18747 },
+  { "nyu", 1, 1, 18756 },
+  { "nyv", 1, 1, 18764 },
+  { "nyw", 1, 1, 18773 },
+  { "nyx", 1, 1, 18778 },
+  { "nyy", 1, 1, 18790 },
+  { "nza", 1, 1, 18806 },
+  { "nzb", 1, 1, 18820 },
+  { "nzd", 1, 1, 18826 },
+  { "nzi", 1, 1, 18832 },
+  { "nzk", 1, 1, 18838 },
+  { "nzm", 1, 1, 18846 },
+  { "nzs", 1, 1, 18857 },
+  { "nzu", 1, 1, 18883 },
+  { "nzy", 1, 1, 18895 },
+  { "nzz", 1, 1, 18905 },
+  { "oaa", 1, 1, 18923 },
+  { "oac", 1, 1, 18928 },
+  { "oar", 1, 1, 18934 },
+  { "oav", 1, 1, 18963 },
+  { "obi", 1, 1, 18973 },
+  { "obk", 1, 1, 18983 },
+  { "obl", 1, 1, 19000 },
+  { "obm", 1, 1, 19005 },
+  { "obo", 1, 1, 19013 },
+  { "obr", 1, 1, 19025 },
+  { "obt", 1, 1, 19038 },
+  { "obu", 1, 1, 19050 },
+  { "oc", 0, 1, 19057 },
+  { "oca", 1, 1, 19089 },
+  { "och", 1, 1, 19096 },
+  { "oci", 1, 1, 19109 },
+  { "ocm", 1, 1, 19129 },
+  { "oco", 1, 1, 19139 },
+  { "ocu", 1, 1, 19152 },
+  { "oda", 1, 1, 19173 },
+  { "odk", 1, 1, 19178 },
+  { "odt", 1, 1, 19181 },
+  { "odu", 1, 1, 19192 },
+  { "ofo", 1, 1, 19198 },
+  { "ofs", 1, 1, 19202 },
+  { "ofu", 1, 1, 19215 },
+  { "ogb", 1, 1, 19222 },
+  { "ogc", 1, 1, 19228 },
+  { "oge", 1, 1, 19234 },
+  { "ogg", 1, 1, 19248 },
+  { "ogo", 1, 1, 19257 },
+  { "ogu", 1, 1, 19263 },
+  { "oht", 1, 1, 19275 },
+  { "ohu", 1, 1, 19288 },
+  { "oia", 1, 1, 19303 },
+  { "oie", 1, 1, 19310 },
+  { "oin", 1, 1, 19317 },
+  { "oj", 0, 1, 19328 },
+  { "ojb", 1, 1, 19335 },
+  { "ojc", 1, 1, 19356 },
+  { "ojg", 1, 1, 19372 },
+  { "oji", 1, 1, 19328 },
+  { "ojp", 1, 1, 19388 },
+  { "ojs", 1, 1, 19402 },
+  { "ojv", 1, 1, 19417 },
+  { "ojw", 1, 1, 19429 },
+  { "oka", 1, 1, 19445 },
+  { "okb", 1, 1, 19454 },
+  { "okc", 1, 1, 19460 },
+  { "okd", 1, 1, 19465 },
+  { "oke", 1, 1, 19472 },
+  { "okg", 1, 1, 19496 },
+  { "okh", 1, 1, 19509 },
+  { "oki", 1, 1, 19525 },
+  { "okj", 1, 1, 19531 },
+  { "okk", 1, 1, 19541 },
+  { "okl", 1, 1, 19554 },
+  { "okm", 1, 1, 19581 },
+  { "okn", 1, 1, 19614 },
+  { "oko", 1, 1, 19627 },
+  { "okr", 1, 1, 19655 },
+  { "oks", 1, 1, 19662 },
+  { "oku", 1, 1, 19677 },
+  { "okv", 1, 1, 19681 },
+  { "okx", 1, 1, 19690 },
+  { "okz", 1, 1, 19714 },
+  { "ola", 1, 1, 19725 },
+  { "old", 1, 1, 19734 },
+  { "ole", 1, 1, 19740 },
+  { "olk", 1, 1, 19747 },
+  { "olm", 1, 1, 19753 },
+  { "olo", 1, 1, 19759 },
+  { "olr", 1, 1, 19765 },
+  { "olt", 1, 1, 19771 },
+  { "olu", 1, 1, 19787 },
+  { "om", 0, 1, 19794 },
+  { "oma", 1, 1, 19800 },
+  { "omb", 1, 1, 19812 },
+  { "omc", 1, 1, 19824 },
+  { "omg", 1, 1, 19832 },
+  { "omi", 1, 1, 19839 },
+  { "omk", 1, 1, 19843 },
+  { "oml", 1, 1, 19848 },
+  { "omn", 1, 1, 19853 },
+  { "omo", 1, 1, 19860 },
+  { "omp", 1, 1, 19870 },
+  { "omr", 1, 1, 19884 },
+  { "omt", 1, 1, 19897 },
+  { "omu", 1, 1, 19904 },
+  { "omw", 1, 1, 19912 },
+  { "omx", 1, 1, 19927 },
+  { "omy", 1, 1, 19936 },
+  { "ona", 1, 1, 19947 },
+  { "onb", 1, 1, 19951 },
+  { "one", 1, 1, 19958 },
+  { "ong", 1, 1, 19965 },
+  { "oni", 1, 1, 19969 },
+  { "onj", 1, 1, 19974 },
+  { "onk", 1, 1, 19980 },
+  { "onn", 1, 1, 19992 },
+  { "ono", 1, 1, 20002 },
+  { "onp", 1, 1, 20011 },
+  { "onr", 1, 1, 20019 },
+  { "ons", 1, 1, 20033 },
+  { "ont", 1, 1, 20037 },
+  { "onu", 1, 1, 20044 },
+  { "onw", 1, 1, 20049 },
+  { "onx", 1, 1, 20061 },
+  { "ood", 1, 1, 20079 },
+  { "oog", 1, 1, 20094 },
+  { "oon", 1, 1, 20098 },
+  { "oor", 1, 1, 20104 },
+  { "oos", 1, 1, 20112 },
+  { "opa", 1, 1, 20125 },
+  { "opk", 1, 1, 20135 },
+  { "opm", 1, 1, 20143 },
+  { "opo", 1, 1, 20152 },
+  { "opt", 1, 1, 20157 },
+  { "opy", 1, 1, 20163 },
+  { "or", 0, 1, 20170 },
+  { "ora", 1, 1, 20176 },
+  { "orc", 1, 1, 20182 },
+  { "ore", 1, 1, 20187 },
+  { "org", 1, 1, 20195 },
+  { "orh", 1, 1, 20201 },
+  { "ori", 1, 1, 20208 },
+  { "orm", 1, 1, 19794 },
+  { "orn", 1, 1, 20230 },
+  { "oro", 1, 1, 20242 },
+  { "orr", 1, 1, 20250 },
+  { "ors", 1, 1, 20256 },
+  { "ort", 1, 1, 20270 },
+  { "oru", 1, 1, 20285 },
+  { "orv", 1, 1, 20292 },
+  { "orw", 1, 1, 20305 },
+  { "orx", 1, 1, 20313 },
+  { "ory", 1, 1, 20317 },
+  { "orz", 1, 1, 20322 },
+  { "os", 0, 1, 20327 },
+  { "osa", 1, 1, 20345 },
+  { "osc", 1, 1, 20351 },
+  { "osi", 1, 1, 20357 },
+  { "osn", 1, 1, 20363 },
+  { "oso", 1, 1, 20378 },
+  { "osp", 1, 1, 20384 },
+  { "oss", 1, 1, 20397 },
+  { "ost", 1, 1, 20406 },
+  { "osu", 1, 1, 20412 },
+  { "osx", 1, 1, 20426 },
+  { "ota", 1, 1, 20437 },
+  { "otb", 1, 1, 20466 },
+  { "otd", 1, 1, 20479 },
+  { "ote", 1, 1, 20488 },
+  { "oti", 1, 1, 20505 },
+  { "otk", 1, 1, 20509 },
+  { "otl", 1, 1, 20522 },
+  { "otm", 1, 1, 20536 },
+  { "otn", 1, 1, 20560 },
+  { "oto", 0, 1, 20575 },
+  { "otq", 1, 1, 20593 },
+  { "otr", 1, 1, 20611 },
+  { "ots", 1, 1, 20617 },
+  { "ott", 1, 1, 20642 },
+  { "otu", 1, 1, 20657 },
+  { "otw", 1, 1, 20663 },
+  { "otx", 1, 1, 20670 },
+  { "oty", 1, 1, 20688 },
+  { "otz", 1, 1, 20699 },
+  { "oua", 1, 1, 20714 },
+  { "oub", 1, 1, 20725 },
+  { "oue", 1, 1, 20735 },
+  { "oui", 1, 1, 20740 },
+  { "oum", 1, 1, 20752 },
+  { "ovd", 1, 1, 20757 },
+  { "owi", 1, 1, 20767 },
+  { "owl", 1, 1, 20775 },
+  { "oyb", 1, 1, 20786 },
+  { "oyd", 1, 1, 20789 },
+  { "oym", 1, 1, 20794 },
+  { "oyy", 1, 1, 20802 },
+  { "ozm", 1, 1, 20810 },
+  { "pa", 0, 1, 20819 },
+  { "paa", 0, 1, 20836 },
+  { "pab", 1, 1, 20853 },
+  { "pac", 1, 1, 20862 },
+  { "pad", 1, 1, 20868 },
+  { "pae", 1, 1, 20877 },
+  { "paf", 1, 1, 20886 },
+  { "pag", 1, 1, 20897 },
+  { "pah", 1, 1, 20908 },
+  { "pai", 1, 1, 20917 },
+  { "pak", 1, 1, 20920 },
+  { "pal", 1, 1, 20930 },
+  { "pam", 1, 1, 20938 },
+  { "pan", 1, 1, 20947 },
+  { "pao", 1, 1, 20955 },
+  { "pap", 1, 1, 20972 },
+  { "paq", 1, 1, 20983 },
+  { "par", 1, 1, 20989 },
+  { "pas", 1, 1, 20998 },
+  { "pau", 1, 1, 21007 },
+  { "pav", 1, 1, 21015 },
+  { "paw", 1, 1, 21028 },
+  { "pax", 1, 1, 21035 },
+  { "pay", 1, 1, 21046 },
+  { "paz", 1, 1, 21051 },
+  { "pbb", 1, 1, 21062 },
+  { "pbc", 1, 1, 21068 },
+  { "pbe", 1, 1, 21077 },
+  { "pbf", 1, 1, 21096 },
+  { "pbg", 1, 1, 21116 },
+  { "pbh", 1, 1, 21126 },
+  { "pbi", 1, 1, 21144 },
+  { "pbl", 1, 1, 21151 },
+  { "pbm", 1, 1, 21165 },
+  { "pbn", 1, 1, 21181 },
+  { "pbo", 1, 1, 21188 },
+  { "pbp", 1, 1, 21194 },
+  { "pbr", 1, 1, 21202 },
+  { "pbs", 1, 1, 21209 },
+  { "pbt", 1, 1, 21223 },
+  { "pbu", 1, 1, 21240 },
+  { "pbv", 1, 1, 21257 },
+  { "pby", 1, 1, 21262 },
+  { "pca", 1, 1, 21285 },
+  { "pcb", 1, 1, 21318 },
+  { "pcc", 1, 1, 21323 },
+  { "pcd", 1, 1, 21330 },
+  { "pce", 1, 1, 21337 },
+  { "pcf", 1, 1, 21354 },
+  { "pcg", 1, 1, 21362 },
+  { "pch", 1, 1, 21369 },
+  { "pci", 1, 1, 21377 },
+  { "pcj", 1, 1, 21384 },
+  { "pck", 1, 1, 21392 },
+  { "pcl", 1, 1, 21404 },
+  { "pcm", 1, 1, 21411 },
+  { "pcn", 1, 1, 21428 },
+  { "pcp", 1, 1, 21433 },
+  { "pcw", 1, 1, 21443 },
+  { "pda", 1, 1, 21450 },
+  { "pdc", 1, 1, 21455 },
+  { "pdi", 1, 1, 21476 },
+  { "pdn", 1, 1, 21482 },
+  { "pdo", 1, 1, 21489 },
+  { "pdt", 1, 1, 21495 },
+  { "pdu", 1, 1, 21508 },
+  { "pea", 1, 1, 21514 },
+  { "peb", 1, 1, 21536 },
+  { "ped", 1, 1, 21550 },
+  { "pee", 1, 1, 21574 },
+  { "pef", 1, 1, 21579 },
+  { "peg", 1, 1, 21598 },
+  { "peh", 1, 1, 21604 },
+  { "pei", 1, 1, 21610 },
+  { "pej", 1, 1, 21627 },
+  { "pek", 1, 1, 21642 },
+  { "pel", 1, 1, 21650 },
+  { "pem", 1, 1, 21656 },
+  { "peo", 1, 1, 21663 },
+  { "pep", 1, 1, 21695 },
+  { "peq", 1, 1, 21701 },
+  { "per", 0, 0, 20155 },
+  { "pes", 1, 1, 21716 },
+  { "pev", 1, 1, 21733 },
+  { "pex", 1, 1, 21741 },
+  { "pey", 1, 1, 21748 },
+  { "pez", 1, 1, 21754 },
+  { "pfa", 1, 1, 21769 },
+  { "pfe", 1, 1, 21779 },
+  { "pfl", 1, 1, 21784 },
+  { "pga", 1, 1, 21795 },
+  { "pgd", 1, 1, 21819 },
+  { "pgg", 1, 1, 21831 },
+  { "pgi", 1, 1, 21840 },
+  { "pgk", 1, 1, 21845 },
+  { "pgl", 1, 1, 21851 },
+  { "pgn", 1, 1, 21868 },
+  { "pgs", 1, 1, 21879 },
+  { "pgu", 1, 1, 21888 },
+  { "pgz", 1, 1, 21893 },
+  { "pha", 1, 1, 21925 },
+  { "phd", 1, 1, 21932 },
+  { "phg", 1, 1, 21940 },
+  { "phh", 1, 1, 21947 },
+  { "phi", 0, 1, 21954 },
+  { "phj", 1, 1, 21975 },
+  { "phk", 1, 1, 21982 },
+  { "phl", 1, 1, 21988 },
+  { "phm", 1, 1, 21996 },
+  { "phn", 1, 1, 22003 },
+  { "pho", 1, 1, 22014 },
+  { "phq", 1, 1, 22021 },
+  { "phr", 1, 1, 22028 },
+  { "pht", 1, 1, 22043 },
+  { "phu", 1, 1, 22052 },
+  { "phv", 1, 1, 22058 },
+  { "phw", 1, 1, 22068 },
+  { "pi", 0, 1, 22080 },
+  { "pia", 1, 1, 22085 },
+  { "pib", 1, 1, 22095 },
+  { "pic", 1, 1, 22100 },
+  { "pid", 1, 1, 22106 },
+  { "pie", 1, 1, 22113 },
+  { "pif", 1, 1, 22118 },
+  { "pig", 1, 1, 22130 },
+  { "pih", 1, 1, 22137 },
+  { "pij", 1, 1, 22154 },
+  { "pil", 1, 1, 22160 },
+  { "pim", 1, 1, 22164 },
+  { "pin", 1, 1, 22173 },
+  { "pio", 1, 1, 22179 },
+  { "pip", 1, 1, 22187 },
+  { "pir", 1, 1, 22192 },
+  { "pis", 1, 1, 22203 },
+  { "pit", 1, 1, 22209 },
+  { "piu", 1, 1, 22221 },
+  { "piv", 1, 1, 22237 },
+  { "piw", 1, 1, 22244 },
+  { "pix", 1, 1, 22251 },
+  { "piy", 1, 1, 22255 },
+  { "piz", 1, 1, 22267 },
+  { "pjt", 1, 1, 22272 },
+  { "pka", 1, 1, 22287 },
+  { "pkb", 1, 1, 22312 },
+  { "pkc", 1, 1, 22319 },
+  { "pkg", 1, 1, 22327 },
+  { "pkh", 1, 1, 22336 },
+  { "pkn", 1, 1, 22343 },
+  { "pko", 1, 1, 22351 },
+  { "pkp", 1, 1, 22359 },
+  { "pkr", 1, 1, 22368 },
+  { "pks", 1, 1, 22386 },
+  { "pkt", 1, 1, 22409 },
+  { "pku", 1, 1, 22416 },
+  { "pl", 0, 1, 22421 },
+  { "pla", 1, 1, 22428 },
+  { "plb", 1, 1, 22434 },
+  { "plc", 1, 1, 22446 },
+  { "pld", 1, 1, 22464 },
+  { "ple", 1, 1, 22471 },
+  { "plg", 1, 1, 22478 },
+  { "plh", 1, 1, 22486 },
+  { "pli", 1, 1, 22080 },
+  { "plj", 1, 1, 22494 },
+  { "plk", 1, 1, 22500 },
+  { "pll", 1, 1, 22517 },
+  { "pln", 1, 1, 22531 },
+  { "plo", 1, 1, 22542 },
+  { "plq", 1, 1, 22558 },
+  { "plr", 1, 1, 22565 },
+  { "pls", 1, 1, 22581 },
+  { "plt", 1, 1, 22613 },
+  { "plu", 1, 1, 22631 },
+  { "plv", 1, 1, 22640 },
+  { "plw", 1, 1, 22660 },
+  { "ply", 1, 1, 22685 },
+  { "plz", 1, 1, 22691 },
+  { "pma", 1, 1, 22698 },
+  { "pmb", 1, 1, 22704 },
+  { "pmd", 1, 1, 22711 },
+  { "pme", 1, 1, 22728 },
+  { "pmf", 1, 1, 22736 },
+  { "pmh", 1, 1, 22743 },
+  { "pmi", 1, 1, 22771 },
+  { "pmj", 1, 1, 22786 },
+  { "pmk", 1, 1, 22801 },
+  { "pml", 1, 1, 22809 },
+  { "pmm", 1, 1, 22823 },
+  { "pmn", 1, 1, 22828 },
+  { "pmo", 1, 1, 22832 },
+  { "pmq", 1, 1, 22836 },
+  { "pmr", 1, 1, 22851 },
+  { "pms", 1, 1, 22860 },
+  { "pmt", 1, 1, 22871 },
+  { "pmw", 1, 1, 22881 },
+  { "pmx", 1, 1, 22895 },
+  { "pmy", 1, 1, 22908 },
+  { "pmz", 1, 1, 22922 },
+  { "pna", 1, 1, 22937 },
+  { "pnb", 1, 1, 22952 },
+  { "pnc", 1, 1, 22969 },
+  { "pnd", 1, 1, 22976 },
+  { "pne", 1, 1, 22983 },
+  { "png", 1, 1, 22998 },
+  { "pnh", 1, 1, 23004 },
+  { "pni", 1, 1, 23012 },
+  { "pnj", 1, 1, 23019 },
+  { "pnk", 1, 1, 23028 },
+  { "pnl", 1, 1, 23036 },
+  { "pnm", 1, 1, 23043 },
+  { "pnn", 1, 1, 23056 },
+  { "pno", 1, 1, 23070 },
+  { "pnp", 1, 1, 23077 },
+  { "pnq", 1, 1, 23085 },
+  { "pnr", 1, 1, 23105 },
+  { "pns", 1, 1, 23111 },
+  { "pnt", 1, 1, 23121 },
+  { "pnu", 1, 1, 23128 },
+  { "pnv", 1, 1, 23143 },
+  { "pnw", 1, 1, 23152 },
+  { "pnx", 1, 1, 23161 },
+  { "pny", 1, 1, 23174 },
+  { "pnz", 1, 1, 23181 },
+  { "poc", 1, 1, 23213 },
+  { "poe", 1, 1, 23221 },
+  { "pof", 1, 1, 23248 },
+  { "pog", 1, 1, 23253 },
+  { "poh", 1, 1, 23264 },
+  { "poi", 1, 1, 23274 },
+  { "pok", 1, 1, 23293 },
+  { "pol", 1, 1, 22421 },
+  { "pom", 1, 1, 23302 },
+  { "pon", 1, 1, 23321 },
+  { "poo", 1, 1, 23331 },
+  { "pop", 1, 1, 23345 },
+  { "poq", 1, 1, 23353 },
+  { "por", 1, 1, 23374 },
+  { "pos", 1, 1, 23385 },
+  { "pot", 1, 1, 23402 },
+  { "pov", 1, 1, 23413 },
+  { "pow", 1, 1, 23435 },
+  { "pox", 1, 1, 23467 },
+  { "poy", 1, 1, 23476 },
+  { "ppe", 1, 1, 23483 },
+  { "ppi", 1, 1, 23488 },
+  { "ppk", 1, 1, 23495 },
+  { "ppl", 1, 1, 23499 },
+  { "ppm", 1, 1, 23505 },
+  { "ppn", 1, 1, 23512 },
+  { "ppo", 1, 1, 23521 },
+  { "ppp", 1, 1, 23528 },
+  { "ppq", 1, 1, 23536 },
+  { "pps", 1, 1, 23540 },
+  { "ppt", 1, 1, 23573 },
+  { "ppu", 1, 1, 23578 },
+  { "pqa", 1, 1, 23585 },
+  { "pqm", 1, 1, 23590 },
+  { "pra", 0, 1, 23613 },
+  { "prc", 1, 1, 23631 },
+  { "prd", 1, 1, 23639 },
+  { "pre", 1, 1, 23650 },
+  { "prf", 1, 1, 23662 },
+  { "prg", 1, 1, 23670 },
+  { "prh", 1, 1, 23679 },
+  { "pri", 1, 1, 23689 },
+  { "prk", 1, 1, 23696 },
+  { "prl", 1, 1, 23703 },
+  { "prm", 1, 1, 23726 },
+  { "prn", 1, 1, 23733 },
+  { "pro", 1, 1, 23741 },
+  { "prp", 1, 1, 23767 },
+  { "prq", 1, 1, 23773 },
+  { "prr", 1, 1, 23792 },
+  { "prs", 1, 1, 23797 },
+  { "prt", 1, 1, 23802 },
+  { "pru", 1, 1, 23807 },
+  { "prw", 1, 1, 23814 },
+  { "prx", 1, 1, 23822 },
+  { "prz", 1, 1, 23828 },
+  { "ps", 0, 1, 23854 },
+  { "psa", 1, 1, 23869 },
+  { "psc", 1, 1, 23880 },
+  { "psd", 1, 1, 23902 },
+  { "pse", 1, 1, 23930 },
+  { "psg", 1, 1, 23945 },
+  { "psh", 1, 1, 23966 },
+  { "psi", 1, 1, 23984 },
+  { "psl", 1, 1, 24002 },
+  { "psm", 1, 1, 24029 },
+  { "psn", 1, 1, 24038 },
+  { "pso", 1, 1, 24047 },
+  { "psp", 1, 1, 24068 },
+  { "psq", 1, 1, 24093 },
+  { "psr", 1, 1, 24098 },
+  { "pss", 1, 1, 24123 },
+  { "pst", 1, 1, 24131 },
+  { "psu", 1, 1, 24147 },
+  { "psw", 1, 1, 24167 },
+  { "psy", 1, 1, 24181 },
+  { "pt", 0, 1, 23374 },
+  { "pta", 1, 1, 24192 },
+  { "pth", 1, 1, 24205 },
+  { "pti", 1, 1, 24225 },
+  { "ptn", 1, 1, 24234 },
+  { "pto", 1, 1, 24241 },
+  { "ptp", 1, 1, 24247 },
+  { "ptq", 1, 1, 24253 },
+  { "ptr", 1, 1, 24261 },
+  { "ptt", 1, 1, 24272 },
+  { "ptu", 1, 1, 24281 },
+  { "ptv", 1, 1, 24288 },
+  { "ptw", 1, 1, 24298 },
+  { "pty", 1, 1, 24308 },
+  { "pua", 1, 1, 24316 },
+  { "pub", 1, 1, 24344 },
+  { "puc", 1, 1, 24350 },
+  { "pud", 1, 1, 24362 },
+  { "pue", 1, 1, 24373 },
+  { "puf", 1, 1, 24381 },
+  { "pug", 1, 1, 24393 },
+  { "pui", 1, 1, 24399 },
+  { "puj", 1, 1, 24407 },
+  { "pum", 1, 1, 24418 },
+  { "puo", 1, 1, 24423 },
+  { "pup", 1, 1, 24428 },
+  { "puq", 1, 1, 24435 },
+  { "pur", 1, 1, 24443 },
+  { "pus", 1, 1, 24453 },
+  { "put", 1, 1, 24460 },
+  { "puu", 1, 1, 24466 },
+  { "puw", 1, 1, 24471 },
+  { "pux", 1, 1, 24482 },
+  { "puy", 1, 1, 24488 },
+  { "pwa", 1, 1, 24500 },
+  { "pwb", 1, 1, 24507 },
+  { "pwg", 1, 1, 24514 },
+  { "pwi", 1, 1, 24524 },
+  { "pwm", 1, 1, 24531 },
+  { "pwn", 1, 1, 24538 },
+  { "pwo", 1, 1, 24545 },
+  { "pwr", 1, 1, 24564 },
+  { "pww", 1, 1, 24571 },
+  { "pxm", 1, 1, 24591 },
+  { "pye", 1, 1, 24610 },
+  { "pym", 1, 1, 24622 },
+  { "pyn", 1, 1, 24627 },
+  { "pys", 1, 1, 24637 },
+  { "pyu", 1, 1, 24662 },
+  { "pyx", 1, 1, 24669 },
+  { "pyy", 1, 1, 24683 },
+  { "pzh", 1, 1, 24688 },
+  { "pzn", 1, 1, 24694 },
+  { "qu", 0, 1, 24706 },
+  { "qua", 1, 1, 24714 },
+  { "qub", 1, 1, 24721 },
+  { "quc", 1, 1, 24748 },
+  { "qud", 1, 1, 24756 },
+  { "que", 1, 1, 24706 },
+  { "quf", 1, 1, 24784 },
+  { "qug", 1, 1, 24804 },
+  { "quh", 1, 1, 24833 },
+  { "qui", 1, 1, 24857 },
+  { "quk", 1, 1, 24866 },
+  { "qul", 1, 1, 24887 },
+  { "qum", 1, 1, 24911 },
+  { "qun", 1, 1, 24923 },
+  { "qup", 1, 1, 24932 },
+  { "quq", 1, 1, 24958 },
+  { "qur", 1, 1, 24966 },
+  { "qus", 1, 1, 24992 },
+  { "quv", 1, 1, 25021 },
+  { "quw", 1, 1, 25033 },
+  { "qux", 1, 1, 25055 },
+  { "quy", 1, 1, 25071 },
+  { "quz", 1, 1, 25089 },
+  { "qva", 1, 1, 25104 },
+  { "qvc", 1, 1, 25124 },
+  { "qve", 1, 1, 25143 },
+  { "qvh", 1, 1, 25170 },
+  { "qvi", 1, 1, 25211 },
+  { "qvj", 1, 1, 25238 },
+  { "qvl", 1, 1, 25261 },
+  { "qvm", 1, 1, 25291 },
+  { "qvn", 1, 1, 25328 },
+  { "qvo", 1, 1, 25350 },
+  { "qvp", 1, 1, 25372 },
+  { "qvs", 1, 1, 25390 },
+  { "qvw", 1, 1, 25411 },
+  { "qvy", 1, 1, 25434 },
+  { "qvz", 1, 1, 25440 },
+  { "qwa", 1, 1, 25466 },
+  { "qwc", 1, 1, 25490 },
+  { "qwh", 1, 1, 25509 },
+  { "qwm", 1, 1, 25533 },
+  { "qws", 1, 1, 25548 },
+  { "qwt", 1, 1, 25571 },
+  { "qxa", 1, 1, 25593 },
+  { "qxc", 1, 1, 25619 },
+  { "qxh", 1, 1, 25636 },
+  { "qxl", 1, 1, 25660 },
+  { "qxn", 1, 1, 25687 },
+  { "qxo", 1, 1, 25722 },
+  { "qxp", 1, 1, 25757 },
+  { "qxq", 1, 1, 25771 },
+  { "qxr", 1, 1, 25780 },
+  { "qxs", 1, 1, 25805 },
+  { "qxt", 1, 1, 25821 },
+  { "qxu", 1, 1, 25854 },
+  { "qxw", 1, 1, 25882 },
+  { "qya", 1, 1, 25903 },
+  { "qyp", 1, 1, 25910 },
+  { "raa", 1, 1, 25918 },
+  { "rab", 1, 1, 25927 },
+  { "rac", 1, 1, 25935 },
+  { "rad", 1, 1, 25942 },
+  { "raf", 1, 1, 25947 },
+  { "rag", 1, 1, 25964 },
+  { "rah", 1, 1, 25972 },
+  { "rai", 1, 1, 25978 },
+  { "raj", 1, 1, 25988 },
+  { "rak", 1, 1, 25999 },
+  { "ral", 1, 1, 26011 },
+  { "ram", 1, 1, 26017 },
+  { "ran", 1, 1, 26024 },
+  { "rao", 1, 1, 26033 },
+  { "rap", 1, 1, 26037 },
+  { "raq", 1, 1, 26045 },
+  { "rar", 1, 1, 26050 },
+  { "ras", 1, 1, 26061 },
+  { "rat", 1, 1, 26068 },
+  { "rau", 1, 1, 26078 },
+  { "rav", 1, 1, 26084 },
+  { "raw", 1, 1, 26092 },
+  { "rax", 1, 1, 26099 },
+  { "ray", 1, 1, 26104 },
+  { "raz", 1, 1, 26109 },
+  { "rbb", 1, 1, 26118 },
+  { "rbk", 1, 1, 26133 },
+  { "rbl", 1, 1, 26150 },
+  { "rbp", 1, 1, 26164 },
+  { "rcf", 1, 1, 26177 },
+  { "rdb", 1, 1, 26201 },
+  { "rea", 1, 1, 26209 },
+  { "reb", 1, 1, 26215 },
+  { "ree", 1, 1, 26223 },
+  { "reg", 1, 1, 26237 },
+  { "rei", 1, 1, 26253 },
+  { "rej", 1, 1, 26258 },
+  { "rel", 1, 1, 26265 },
+  { "rem", 1, 1, 26274 },
+  { "ren", 1, 1, 26279 },
+  { "rer", 1, 1, 26286 },
+  { "res", 1, 1, 26295 },
+  { "ret", 1, 1, 26301 },
+  { "rey", 1, 1, 26307 },
+  { "rga", 1, 1, 26316 },
+  { "rge", 1, 1, 26322 },
+  { "rgk", 1, 1, 26335 },
+  { "rgn", 1, 1, 26343 },
+  { "rgr", 1, 1, 26352 },
+  { "rgs", 1, 1, 26362 },
+  { "rgu", 1, 1, 26379 },
+  { "rhg", 1, 1, 26387 },
+  { "rhp", 1, 1, 26396 },
+  { "ria", 1, 1, 26403 },
+  { "rib", 1, 1, 26417 },
+  { "rif", 1, 1, 26438 },
+  { "ril", 1, 1, 26446 },
+  { "rim", 1, 1, 26457 },
+  { "rin", 1, 1, 26465 },
+  { "rir", 1, 1, 26471 },
+  { "rit", 1, 1, 26477 },
+  { "riu", 1, 1, 26488 },
+  { "rjg", 1, 1, 26494 },
+  { "rji", 1, 1, 26501 },
+  { "rjs", 1, 1, 26506 },
+  { "rka", 1, 1, 26516 },
+  { "rkb", 1, 1, 26522 },
+  { "rkh", 1, 1, 26532 },
+  { "rki", 1, 1, 26551 },
+  { "rkm", 1, 1, 26559 },
+  { "rkt", 1, 1, 26565 },
+  { "rkw", 1, 1, 26574 },
+  { "rm", 0, 1, 26582 },
+  { "rma", 1, 1, 26590 },
+  { "rmb", 1, 1, 26595 },
+  { "rmc", 1, 1, 26606 },
+  { "rmd", 1, 1, 26625 },
+  { "rme", 1, 1, 26643 },
+  { "rmf", 1, 1, 26655 },
+  { "rmg", 1, 1, 26676 },
+  { "rmh", 1, 1, 26697 },
+  { "rmi", 1, 1, 26704 },
+  { "rmk", 1, 1, 26713 },
+  { "rml", 1, 1, 26720 },
+  { "rmm", 1, 1, 26735 },
+  { "rmn", 1, 1, 26740 },
+  { "rmo", 1, 1, 26755 },
+  { "rmp", 1, 1, 26769 },
+  { "rmq", 1, 1, 26775 },
+  { "rms", 1, 1, 26781 },
+  { "rmt", 1, 1, 26804 },
+  { "rmu", 1, 1, 26811 },
+  { "rmv", 1, 1, 26829 },
+  { "rmw", 1, 1, 26838 },
+  { "rmx", 1, 1, 26852 },
+  { "rmy", 1, 1, 26858 },
+  { "rmz", 1, 1, 26871 },
+  { "rn", 0, 1, 26877 },
+  { "rnb", 1, 1, 26883 },
+  { "rnd", 1, 1, 26904 },
+  { "rng", 1, 1, 26910 },
+  { "rnl", 1, 1, 26916 },
+  { "rnn", 1, 1, 26925 },
+  { "rnp", 1, 1, 26930 },
+  { "rnr", 1, 1, 26937 },
+  { "rnw", 1, 1, 26947 },
+  { "ro", 0, 1, 26954 },
+  { "roa", 0, 1, 26984 },
+  { "rob", 1, 1, 27002 },
+  { "roc", 1, 1, 27007 },
+  { "rod", 1, 1, 27022 },
+  { "roe", 1, 1, 27027 },
+  { "rof", 1, 1, 27033 },
+  { "rog", 1, 1, 27039 },
+  { "roh", 1, 1, 26582 },
+  { "rol", 1, 1, 27056 },
+  { "rom", 1, 1, 27068 },
+  { "ron", 1, 1, 27075 },
+  { "roo", 1, 1, 27084 },
+  { "rop", 1, 1, 27092 },
+  { "ror", 1, 1, 27098 },
+  { "rou", 1, 1, 27105 },
+  { "row", 1, 1, 27111 },
+  { "rpn", 1, 1, 27123 },
+  { "rpt", 1, 1, 27134 },
+  { "rri", 1, 1, 27142 },
+  { "rro", 1, 1, 27148 },
+  { "rrt", 1, 1, 27154 },
+  { "rsb", 1, 1, 27170 },
+  { "rsk", 1, 1, 27185 },
+  { "rsl", 1, 1, 27195 },
+  { "rsm", 1, 1, 27217 },
+  { "rsn", 1, 1, 27241 },
+  { "rtc", 1, 1, 27263 },
+  { "rth", 1, 1, 27276 },
+  { "rtm", 1, 1, 27284 },
+  { "rts", 1, 1, 27292 },
+  { "rtw", 1, 1, 27299 },
+  { "ru", 0, 1, 27307 },
+  { "rub", 1, 1, 27315 },
+  { "ruc", 1, 1, 27321 },
+  { "rue", 1, 1, 27327 },
+  { "ruf", 1, 1, 27333 },
+  { "rug", 1, 1, 27340 },
+  { "ruh", 1, 1, 27348 },
+  { "rui", 1, 1, 27353 },
+  { "ruk", 1, 1, 27360 },
+  { "rum", 0, 1, 26954 },
+  { "run", 1, 1, 26877 },
+  { "ruo", 1, 1, 27364 },
+  { "rup", 1, 1, 27380 },
+  { "ruq", 1, 1, 27398 },
+  { "rus", 1, 1, 27307 },
+  { "rut", 1, 1, 27416 },
+  { "ruu", 1, 1, 27422 },
+  { "ruy", 1, 1, 27434 },
+  { "ruz", 1, 1, 27449 },
+  { "rw", 0, 0, 31944 },
+  { "rwa", 1, 1, 27454 },
+  { "rwk", 1, 1, 27459 },
+  { "rwl", 1, 1, 27463 },
+  { "rwm", 1, 1, 27470 },
+  { "rwo", 1, 1, 27484 },
+  { "rwr", 1, 1, 27489 },
+  { "rxd", 1, 1, 27505 },
+  { "rxw", 1, 1, 27512 },
+  { "ryn", 1, 1, 27521 },
+  { "rys", 1, 1, 27544 },
+  { "ryu", 1, 1, 27552 },
+  { "rzh", 1, 1, 27570 },
+  { "sa", 0, 1, 27581 },
+  { "saa", 1, 1, 27590 },
+  { "sab", 1, 1, 27595 },
+  { "sac", 1, 1, 27603 },
+  { "sad", 1, 1, 27612 },
+  { "sae", 1, 1, 27620 },
+  { "saf", 1, 1, 27628 },
+  { "sag", 1, 1, 27637 },
+  { "sah", 1, 1, 27643 },
+  { "sai", 0, 1, 27649 },
+  { "saj", 1, 1, 27679 },
+  { "sak", 1, 1, 27684 },
+  { "sal", 0, 1, 27689 },
+  { "sam", 1, 1, 27708 },
+  { "san", 1, 1, 27581 },
+  { "sao", 1, 1, 27727 },
+  { "saq", 1, 1, 27733 },
+  { "sar", 1, 1, 27741 },
+  { "sas", 1, 1, 27750 },
+  { "sat", 1, 1, 27756 },
+  { "sau", 1, 1, 27764 },
+  { "sav", 1, 1, 27772 },
+  { "saw", 1, 1, 27784 },
+  { "sax", 1, 1, 27789 },
+  { "say", 1, 1, 27792 },
+  { "saz", 1, 1, 27797 },
+  { "sba", 1, 1, 27808 },
+  { "sbb", 1, 1, 27816 },
+  { "sbc", 1, 1, 27822 },
+  { "sbd", 1, 1, 27846 },
+  { "sbe", 1, 1, 27861 },
+  { "sbf", 1, 1, 27868 },
+  { "sbg", 1, 1, 27874 },
+  { "sbh", 1, 1, 27880 },
+  { "sbi", 1, 1, 27894 },
+  { "sbj", 1, 1, 27899 },
+  { "sbk", 1, 1, 27909 },
+  { "sbl", 1, 1, 27915 },
+  { "sbm", 1, 1, 27931 },
+  { "sbn", 1, 1, 27938 },
+  { "sbo", 1, 1, 27951 },
+  { "sbp", 1, 1, 27958 },
+  { "sbq", 1, 1, 27975 },
+  { "sbr", 1, 1, 27983 },
+  { "sbs", 1, 1, 27999 },
+  { "sbt", 1, 1, 28006 },
+  { "sbu", 1, 1, 28012 },
+  { "sbv", 1, 1, 28024 },
+  { "sbw", 1, 1, 28031 },
+  { "sbx", 1, 1, 28037 },
+  { "sby", 1, 1, 28047 },
+  { "sbz", 1, 1, 28052 },
+  { "sc", 0, 1, 28062 },
+  { "scb", 1, 1, 28072 },
+  { "sce", 1, 1, 28077 },
+  { "scf", 1, 1, 28087 },
+  { "scg", 1, 1, 28113 },
+  { "sch", 1, 1, 28121 },
+  { "sci", 1, 1, 28130 },
+  { "sck", 1, 1, 28155 },
+  { "scl", 1, 1, 28161 },
+  { "scn", 1, 1, 28167 },
+  { "sco", 1, 1, 28176 },
+  { "scp", 1, 1, 28182 },
+  { "scq", 1, 1, 28189 },
+  { "scs", 1, 1, 28196 },
+  { "sct", 1, 1, 28210 },
+  { "scu", 1, 1, 28227 },
+  { "scv", 1, 1, 28235 },
+  { "scw", 1, 1, 28241 },
+  { "scx", 1, 1, 28245 },
+  { "sd", 0, 1, 28251 },
+  { "sda", 1, 1, 28258 },
+  { "sdb", 1, 1, 28272 },
+  { "sdc", 1, 1, 28279 },
+  { "sde", 1, 1, 28300 },
+  { "sdf", 1, 1, 28307 },
+  { "sdg", 1, 1, 28313 },
+  { "sdh", 1, 1, 28318 },
+  { "sdj", 1, 1, 28336 },
+  { "sdk", 1, 1, 28343 },
+  { "sdl", 1, 1, 28353 },
+  { "sdn", 1, 1, 28381 },
+  { "sdo", 1, 1, 28402 },
+  { "sdp", 1, 1, 28424 },
+  { "sdq", 1, 1, 28435 },
+  { "sdr", 1, 1, 28445 },
+  { "sds", 1, 1, 28458 },
+  { "sdt", 1, 1, 28464 },
+  { "sdu", 1, 1, 28472 },
+  { "sdx", 1, 1, 28479 },
+  { "sdz", 1, 1, 28493 },
+  { "se", 0, 1, 28502 },
+  { "sea", 1, 1, 28516 },
+  { "seb", 1, 1, 28522 },
+  { "sec", 1, 1, 28540 },
+  { "sed", 1, 1, 28548 },
+  { "see", 1, 1, 28555 },
+  { "sef", 1, 1, 28562 },
+  { "seg", 1, 1, 28579 },
+  { "seh", 1, 1, 28586 },
+  { "sei", 1, 1, 28591 },
+  { "sej", 1, 1, 28596 },
+  { "sek", 1, 1, 28601 },
+  { "sel", 1, 1, 28608 },
+  { "sem", 0, 1, 28615 },
+  { "sen", 1, 1, 28633 },
+  { "seo", 1, 1, 28653 },
+  { "sep", 1, 1, 28661 },
+  { "seq", 1, 1, 28681 },
+  { "ser", 1, 1, 28698 },
+  { "ses", 1, 1, 28706 },
+  { "set", 1, 1, 28731 },
+  { "seu", 1, 1, 28739 },
+  { "sev", 1, 1, 28750 },
+  { "sew", 1, 1, 28769 },
+  { "sey", 1, 1, 28778 },
+  { "sez", 1, 1, 28785 },
+  { "sfb", 1, 1, 28800 },
+  { "sfe", 1, 1, 28842 },
+  { "sfm", 1, 1, 28859 },
+  { "sfs", 1, 1, 28879 },
+  { "sfw", 1, 1, 28907 },
+  { "sg", 0, 1, 27637 },
+  { "sga", 1, 1, 28913 },
+  { "sgb", 1, 1, 28933 },
+  { "sgc", 1, 1, 28949 },
+  { "sgd", 1, 1, 28958 },
+  { "sge", 1, 1, 28969 },
+  { "sgg", 1, 1, 28975 },
+  { "sgh", 1, 1, 29002 },
+  { "sgi", 1, 1, 29010 },
+  { "sgj", 1, 1, 29015 },
+  { "sgk", 1, 1, 29024 },
+  { "sgm", 1, 1, 29033 },
+  { "sgn", 0, 1, 29039 },
+  { "sgp", 1, 1, 29054 },
+  { "sgr", 1, 1, 29062 },
+  { "sgs", 1, 1, 29072 },
+  { "sgt", 1, 1, 29083 },
+  { "sgu", 1, 1, 29092 },
+  { "sgw", 1, 1, 29098 },
+  { "sgx", 1, 1, 29115 },
+  { "sgy", 1, 1, 29142 },
+  { "sgz", 1, 1, 29152 },
+  { "sha", 1, 1, 29163 },
+  { "shb", 1, 1, 29175 },
+  { "shc", 1, 1, 29181 },
+  { "shd", 1, 1, 29187 },
+  { "she", 1, 1, 29200 },
+  { "shg", 1, 1, 29206 },
+  { "shh", 1, 1, 29211 },
+  { "shi", 1, 1, 29220 },
+  { "shj", 1, 1, 29230 },
+  { "shk", 1, 1, 29236 },
+  { "shl", 1, 1, 29244 },
+  { "shm", 1, 1, 29251 },
+  { "shn", 1, 1, 29260 },
+  { "sho", 1, 1, 29265 },
+  { "shp", 1, 1, 29272 },
+  { "shq", 1, 1, 29287 },
+  { "shr", 1, 1, 29292 },
+  { "shs", 1, 1, 29296 },
+  { "sht", 1, 1, 29304 },
+  { "shu", 1, 1, 29311 },
+  { "shv", 1, 1, 29327 },
+  { "shw", 1, 1, 29334 },
+  { "shx", 1, 1, 29340 },
+  { "shy", 1, 1, 29344 },
+  { "shz", 1, 1, 29353 },
+  { "si", 0, 1, 29370 },
+  { "sia", 1, 1, 29389 },
+  { "sib", 1, 1, 29402 },
+  { "sid", 1, 1, 29408 },
+  { "sie", 1, 1, 29415 },
+  { "sif", 1, 1, 29421 },
+  { "sig", 1, 1, 29428 },
+  { "sih", 1, 1, 29436 },
+  { "sii", 1, 1, 29441 },
+  { "sij", 1, 1, 29451 },
+  { "sik", 1, 1, 29459 },
+  { "sil", 1, 1, 29467 },
+  { "sim", 1, 1, 29485 },
+  { "sin", 1, 1, 29510 },
+  { "sio", 0, 1, 29518 },
+  { "sip", 1, 1, 29535 },
+  { "siq", 1, 1, 29545 },
+  { "sir", 1, 1, 29551 },
+  { "sis", 1, 1, 29556 },
+  { "sit", 0, 1, 29564 },
+  { "siu", 1, 1, 29587 },
+  { "siv", 1, 1, 29595 },
+  { "siw", 1, 1, 29604 },
+  { "six", 1, 1, 29610 },
+  { "siy", 1, 1, 29616 },
+  { "siz", 1, 1, 29624 },
+  { "sja", 1, 1, 29629 },
+  { "sjb", 1, 1, 29635 },
+  { "sjd", 1, 1, 29647 },
+  { "sje", 1, 1, 29660 },
+  { "sjg", 1, 1, 29671 },
+  { "sjk", 1, 1, 29681 },
+  { "sjl", 1, 1, 29692 },
+  { "sjm", 1, 1, 29701 },
+  { "sjn", 1, 1, 29707 },
+  { "sjo", 1, 1, 29716 },
+  { "sjp", 1, 1, 29721 },
+  { "sjr", 1, 1, 29731 },
+  { "sjs", 1, 1, 29740 },
+  { "sjt", 1, 1, 29757 },
+  { "sju", 1, 1, 29767 },
+  { "sjw", 1, 1, 29777 },
+  { "sk", 0, 1, 29785 },
+  { "ska", 1, 1, 29792 },
+  { "skb", 1, 1, 29799 },
+  { "skc", 1, 1, 29804 },
+  { "skd", 1, 1, 29813 },
+  { "ske", 1, 1, 29836 },
+  { "skf", 1, 1, 29851 },
+  { "skg", 1, 1, 29862 },
+  { "skh", 1, 1, 29881 },
+  { "ski", 1, 1, 29888 },
+  { "skj", 1, 1, 29893 },
+  { "skm", 1, 1, 29906 },
+  { "skn", 1, 1, 29913 },
+  { "sko", 1, 1, 29932 },
+  { "skp", 1, 1, 29944 },
+  { "skq", 1, 1, 29952 },
+  { "skr", 1, 1, 29962 },
+  { "sks", 1, 1, 29970 },
+  { "skt", 1, 1, 29975 },
+  { "sku", 1, 1, 29982 },
+  { "skv", 1, 1, 29988 },
+  { "skw", 1, 1, 29993 },
+  { "skx", 1, 1, 30013 },
+  { "sky", 1, 1, 30025 },
+  { "skz", 1, 1, 30034 },
+  { "sl", 0, 1, 30040 },
+  { "sla", 0, 1, 30050 },
+  { "slc", 1, 1, 30067 },
+  { "sld", 1, 1, 30075 },
+  { "sle", 1, 1, 30083 },
+  { "slf", 1, 1, 30091 },
+  { "slg", 1, 1, 30119 },
+  { "slh", 1, 1, 30134 },
+  { "sli", 1, 1, 30163 },
+  { "slj", 1, 1, 30179 },
+  { "slk", 1, 1, 29785 },
+  { "sll", 1, 1, 30187 },
+  { "slm", 1, 1, 30196 },
+  { "sln", 1, 1, 30213 },
+  { "slo", 0, 1, 29785 },
+  { "slp", 1, 1, 30221 },
+  { "slq", 1, 1, 30231 },
+  { "slr", 1, 1, 30239 },
+  { "sls", 1, 1, 30245 },
+  { "slt", 1, 1, 30269 },
+  { "slu", 1, 1, 30274 },
+  { "slv", 1, 1, 30040 },
+  { "slw", 1, 1, 30281 },
+  { "slx", 1, 1, 30288 },
+  { "sly", 1, 1, 30298 },
+  { "slz", 1, 1, 30306 },
+  { "sm", 0, 1, 30312 },
+  { "sma", 1, 1, 30319 },
+  { "smb", 1, 1, 30334 },
+  { "smc", 1, 1, 30342 },
+  { "sme", 1, 1, 30346 },
+  { "smf", 1, 1, 30361 },
+  { "smg", 1, 1, 30366 },
+  { "smh", 1, 1, 30374 },
+  { "smi", 0, 1, 30380 },
+  { "smj", 1, 1, 30395 },
+  { "smk", 1, 1, 30405 },
+  { "sml", 1, 1, 30413 },
+  { "smm", 1, 1, 30427 },
+  { "smn", 1, 1, 30434 },
+  { "smo", 1, 1, 30312 },
+  { "smp", 1, 1, 30446 },
+  { "smq", 1, 1, 30456 },
+  { "smr", 1, 1, 30461 },
+  { "sms", 1, 1, 30470 },
+  { "smt", 1, 1, 30482 },
+  { "smu", 1, 1, 30488 },
+  { "smv", 1, 1, 30495 },
+  { "smw", 1, 1, 30503 },
+  { "smx", 1, 1, 30511 },
+  { "smy", 1, 1, 30517 },
+  { "smz", 1, 1, 30525 },
+  { "sn", 0, 1, 30532 },
+  { "sna", 1, 1, 30532 },
+  { "snc", 1, 1, 30538 },
+  { "snd", 1, 1, 28251 },
+  { "sne", 1, 1, 30548 },
+  { "snf", 1, 1, 30561 },
+  { "sng", 1, 1, 30566 },
+  { "sni", 1, 1, 30603 },
+  { "snj", 1, 1, 30609 },
+  { "snk", 1, 1, 30625 },
+  { "snl", 1, 1, 30633 },
+  { "snm", 1, 1, 30640 },
+  { "snn", 1, 1, 30656 },
+  { "sno", 1, 1, 30662 },
+  { "snp", 1, 1, 30672 },
+  { "snq", 1, 1, 30678 },
+  { "snr", 1, 1, 30692 },
+  { "sns", 1, 1, 30698 },
+  { "snu", 1, 1, 30713 },
+  { "snv", 1, 1, 30720 },
+  { "snw", 1, 1, 30727 },
+  { "snx", 1, 1, 30733 },
+  { "sny", 1, 1, 30737 },
+  { "snz", 1, 1, 30751 },
+  { "so", 0, 1, 30755 },
+  { "soa", 1, 1, 30762 },
+  { "sob", 1, 1, 30772 },
+  { "soc", 1, 1, 30778 },
+  { "sod", 1, 1, 30812 },
+  { "soe", 1, 1, 30821 },
+  { "sog", 1, 1, 30831 },
+  { "soh", 1, 1, 30839 },
+  { "soi", 1, 1, 30843 },
+  { "soj", 1, 1, 30849 },
+  { "sok", 1, 1, 30853 },
+  { "sol", 1, 1, 30860 },
+  { "som", 1, 1, 30755 },
+  { "son", 0, 1, 30866 },
+  { "soo", 1, 1, 30884 },
+  { "sop", 1, 1, 30890 },
+  { "soq", 1, 1, 30896 },
+  { "sor", 1, 1, 30903 },
+  { "sos", 1, 1, 30910 },
+  { "sot", 1, 1, 30916 },
+  { "sou", 1, 1, 30932 },
+  { "sov", 1, 1, 30947 },
+  { "sow", 1, 1, 30956 },
+  { "sox", 1, 1, 30964 },
+  { "soy", 1, 1, 30968 },
+  { "soz", 1, 1, 30975 },
+  { "spa", 1, 1, 30980 },
+  { "spb", 1, 1, 30988 },
+  { "spc", 1, 1, 31005 },
+  { "spd", 1, 1, 31011 },
+  { "spe", 1, 1, 31016 },
+  { "spg", 1, 1, 31040 },
+  { "spi", 1, 1, 31045 },
+  { "spk", 1, 1, 31052 },
+  { "spl", 1, 1, 31058 },
+  { "spm", 1, 1, 31066 },
+  { "spn", 1, 1, 31073 },
+  { "spo", 1, 1, 31083 },
+  { "spp", 1, 1, 31091 },
+  { "spq", 1, 1, 31108 },
+  { "spr", 1, 1, 31132 },
+  { "sps", 1, 1, 31140 },
+  { "spt", 1, 1, 31147 },
+  { "spu", 1, 1, 31160 },
+  { "spv", 1, 1, 31167 },
+  { "spx", 1, 1, 31178 },
+  { "spy", 1, 1, 31192 },
+  { "sq", 0, 0,  2172 },
+  { "sqa", 1, 1, 31199 },
+  { "sqh", 1, 1, 31213 },
+  { "sqi", 1, 0,  2172 },
+  { "sqk", 1, 1, 31218 },
+  { "sqm", 1, 1, 31241 },
+  { "sqn", 1, 1, 31246 },
+  { "sqo", 1, 1, 31260 },
+  { "sqq", 1, 1, 31268 },
+  { "sqr", 1, 1, 31272 },
+  { "sqs", 1, 1, 31287 },
+  { "sqt", 1, 1, 31312 },
+  { "squ", 1, 1, 31320 },
+  { "sqx", 1, 1, 31329 },
+  { "sr", 0, 1, 31362 },
+  { "sra", 1, 1, 31370 },
+  { "srb", 1, 1, 31377 },
+  { "src", 1, 1, 31382 },
+  { "srd", 1, 1, 28062 },
+  { "sre", 1, 1, 31404 },
+  { "srf", 1, 1, 31409 },
+  { "srg", 1, 1, 31414 },
+  { "srh", 1, 1, 31420 },
+  { "sri", 1, 1, 31429 },
+  { "srk", 1, 1, 31437 },
+  { "srl", 1, 1, 31452 },
+  { "srm", 1, 1, 31460 },
+  { "srn", 1, 1, 31471 },
+  { "sro", 1, 1, 31484 },
+  { "srp", 1, 1, 31362 },
+  { "srq", 1, 1, 31507 },
+  { "srr", 1, 1, 31516 },
+  { "srs", 1, 1, 31522 },
+  { "srt", 1, 1, 31528 },
+  { "sru", 1, 1, 31534 },
+  { "srv", 1, 1, 31541 },
+  { "srw", 1, 1, 31562 },
+  { "srx", 1, 1, 31568 },
+  { "sry", 1, 1, 31577 },
+  { "srz", 1, 1, 31582 },
+  { "ss", 0, 1, 31594 },
+  { "ssa", 0, 1, 31600 },
+  { "ssb", 1, 1, 31623 },
+  { "ssc", 1, 1, 31638 },
+  { "ssd", 1, 1, 31651 },
+  { "sse", 1, 1, 31657 },
+  { "ssf", 1, 1, 31668 },
+  { "ssg", 1, 1, 31673 },
+  { "ssh", 1, 1, 31680 },
+  { "ssi", 1, 1, 31695 },
+  { "ssj", 1, 1, 31701 },
+  { "ssk", 1, 1, 31707 },
+  { "ssl", 1, 1, 31713 },
+  { "ssm", 1, 1, 31730 },
+  { "ssn", 1, 1, 31737 },
+  { "sso", 1, 1, 31743 },
+  { "ssp", 1, 1, 31751 },
+  { "ssq", 1, 1, 31773 },
+  { "ssr", 1, 1, 31778 },
+  { "sss", 1, 1, 31805 },
+  { "sst", 1, 1, 31809 },
+  { "ssu", 1, 1, 31818 },
+  { "ssv", 1, 1, 31826 },
+  { "ssw", 1, 1, 31594 },
+  { "ssx", 1, 1, 31836 },
+  { "ssy", 1, 1, 31846 },
+  { "ssz", 1, 1, 31851 },
+  { "st", 0, 1, 30916 },
+  { "sta", 1, 1, 31860 },
+  { "stb", 1, 1, 31867 },
+  { "std", 1, 1, 31885 },
+  { "ste", 1, 1, 31894 },
+  { "stf", 1, 1, 31905 },
+  { "stg", 1, 1, 31910 },
+  { "sth", 1, 1, 31917 },
+  { "sti", 1, 1, 31924 },
+  { "stj", 1, 1, 31937 },
+  { "stk", 1, 1, 31949 },
+  { "stl", 1, 1, 31957 },
+  { "stm", 1, 1, 31971 },
+  { "stn", 1, 1, 31979 },
+  { "sto", 1, 1, 31983 },
+  { "stp", 1, 1, 31990 },
+  { "stq", 1, 1, 32013 },
+  { "str", 1, 1, 32028 },
+  { "sts", 1, 1, 32044 },
+  { "stt", 1, 1, 32054 },
+  { "stu", 1, 1, 32068 },
+  { "stv", 1, 1, 32075 },
+  { "stw", 1, 1, 32082 },
+  { "sty", 1, 1, 32093 },
+  { "su", 0, 1, 32109 },
+  { "sua", 1, 1, 32119 },
+  { "sub", 1, 1, 32125 },
+  { "suc", 1, 1, 32130 },
+  { "sue", 1, 1, 32147 },
+  { "sug", 1, 1, 32153 },
+  { "sui", 1, 1, 32161 },
+  { "suj", 1, 1, 32166 },
+  { "suk", 1, 1, 32172 },
+  { "sun", 1, 1, 32109 },
+  { "suo", 1, 1, 32179 },
+  { "suq", 1, 1, 32185 },
+  { "sur", 1, 1, 32204 },
+  { "sus", 1, 1, 32214 },
+  { "sut", 1, 1, 32219 },
+  { "suv", 1, 1, 32228 },
+  { "suw", 1, 1, 32235 },
+  { "sux", 1, 1, 32242 },
+  { "suy", 1, 1, 32251 },
+  { "suz", 1, 1, 32257 },
+  { "sv", 0, 1, 32264 },
+  { "sva", 1, 1, 32272 },
+  { "svb", 1, 1, 32277 },
+  { "svc", 1, 1, 32288 },
+  { "sve", 1, 1, 32315 },
+  { "svk", 1, 1, 32322 },
+  { "svm", 1, 1, 32346 },
+  { "svs", 1, 1, 32360 },
+  { "svx", 1, 1, 32369 },
+  { "sw", 0, 1, 32378 },
+  { "swa", 1, 1, 32386 },
+  { "swb", 1, 1, 32410 },
+  { "swc", 1, 1, 32426 },
+  { "swe", 1, 1, 32264 },
+  { "swf", 1, 1, 32441 },
+  { "swg", 1, 1, 32446 },
+  { "swh", 1, 1, 32454 },
+  { "swi", 1, 1, 32484 },
+  { "swj", 1, 1, 32488 },
+  { "swk", 1, 1, 32493 },
+  { "swl", 1, 1, 32506 },
+  { "swm", 1, 1, 32528 },
+  { "swn", 1, 1, 32535 },
+  { "swo", 1, 1, 32543 },
+  { "swp", 1, 1, 32553 },
+  { "swq", 1, 1, 32558 },
+  { "swr", 1, 1, 32565 },
+  { "sws", 1, 1, 32572 },
+  { "swt", 1, 1, 32582 },
+  { "swu", 1, 1, 32589 },
+  { "swv", 1, 1, 32596 },
+  { "sww", 1, 1, 32607 },
+  { "swx", 1, 1, 32612 },
+  { "swy", 1, 1, 32621 },
+  { "sxb", 1, 1, 32627 },
+  { "sxc", 1, 1, 32632 },
+  { "sxe", 1, 1, 32641 },
+  { "sxg", 1, 1, 32647 },
+  { "sxk", 1, 1, 32653 },
+  { "sxl", 1, 1, 32672 },
+  { "sxm", 1, 1, 32679 },
+  { "sxn", 1, 1, 32685 },
+  { "sxo", 1, 1, 32692 },
+  { "sxr", 1, 1, 32704 },
+  { "sxs", 1, 1, 32711 },
+  { "sxu", 1, 1, 32718 },
+  { "sxw", 1, 1, 32731 },
+  { "sya", 1, 1, 32742 },
+  { "syb", 1, 1, 32748 },
+  { "syc", 1, 2,     0 },
+  { "syi", 1, 2,    18 },
+  { "syk", 1, 2,    23 },
+  { "syl", 1, 2,    29 },
+  { "sym", 1, 2,    37 },
+  { "syn", 1, 2,    48 },
+  { "syo", 1, 2,    55 },
+  { "syr", 1, 2,    60 },
+  { "sys", 1, 2,    67 },
+  { "syw", 1, 2,    74 },
+  { "syx", 1, 2,    81 },
+  { "syy", 1, 2,    87 },
+  { "sza", 1, 2,   119 },
+  { "szb", 1, 2,   127 },
+  { "szc", 1, 2,   134 },
+  { "szd", 1, 2,   145 },
+  { "sze", 1, 2,   150 },
+  { "szg", 1, 2,   155 },
+  { "szl", 1, 2,   163 },
+  { "szn", 1, 2,   172 },
+  { "szp", 1, 2,   177 },
+  { "szs", 1, 2,   183 },
+  { "szv", 1, 2,   213 },
+  { "szw", 1, 2,   233 },
+  { "szy", 1, 2,   239 },
+  { "ta", 0, 2,   248 },
+  { "taa", 1, 2,   254 },
+  { "tab", 1, 2,   268 },
+  { "tac", 1, 2,   279 },
+  { "tad", 1, 2,   299 },
+  { "tae", 1, 2,   305 },
+  { "taf", 1, 2,   313 },
+  { "tag", 1, 2,   323 },
+  { "tah", 1, 2,   329 },
+  { "tai", 0, 2,   338 },
+  { "taj", 1, 2,   352 },
+  { "tak", 1, 2,   368 },
+  { "tal", 1, 2,   373 },
+  { "tam", 1, 2,   248 },
+  { "tan", 1, 2,   377 },
+  { "tao", 1, 2,   385 },
+  { "tap", 1, 2,   390 },
+  { "taq", 1, 2,   397 },
+  { "tar", 1, 2,   406 },
+  { "tas", 1, 2,   426 },
+  { "tat", 1, 2,   434 },
+  { "tau", 1, 2,   440 },
+  { "tav", 1, 2,   454 },
+  { "taw", 1, 2,   461 },
+  { "tax", 1, 2,   465 },
+  { "tay", 1, 2,   471 },
+  { "taz", 1, 2,   478 },
+  { "tba", 1, 2,   484 },
+  { "tbc", 1, 2,   492 },
+  { "tbd", 1, 2,   498 },
+  { "tbe", 1, 2,   506 },
+  { "tbf", 1, 2,   516 },
+  { "tbg", 1, 2,   524 },
+  { "tbh", 1, 2,   539 },
+  { "tbi", 1, 2,   548 },
+  { "tbj", 1, 2,   553 },
+  { "tbk", 1, 2,   559 },
+  { "tbl", 1, 2,   578 },
+  { "tbm", 1, 2,   584 },
+  { "tbn", 1, 2,   590 },
+  { "tbo", 1, 2,   610 },
+  { "tbp", 1, 2,   617 },
+  { "tbr", 1, 2,   625 },
+  { "tbs", 1, 2,   632 },
+  { "tbt", 1, 2,   640 },
+  { "tbu", 1, 2,   656 },
+  { "tbv", 1, 2,   662 },
+  { "tbw", 1, 2,   667 },
+  { "tbx", 1, 2,   676 },
+  { "tby", 1, 2,   682 },
+  { "tbz", 1, 2,   689 },
+  { "tca", 1, 2,   699 },
+  { "tcb", 1, 2,   706 },
+  { "tcc", 1, 2,   716 },
+  { "tcd", 1, 2,   724 },
+  { "tce", 1, 2,   729 },
+  { "tcf", 1, 2,   748 },
+  { "tcg", 1, 2,   770 },
+  { "tch", 1, 2,   780 },
+  { "tci", 1, 2,   813 },
+  { "tck", 1, 2,   819 },
+  { "tcl", 1, 2,   830 },
+  { "tcm", 1, 2,   846 },
+  { "tcn", 1, 2,   857 },
+  { "tco", 1, 2,   867 },
+  { "tcp", 1, 2,   875 },
+  { "tcq", 1, 2,   886 },
+  { "tcs", 1, 2,   891 },
+  { "tct", 1, 2,   913 },
+  { "tcu", 1, 2,   918 },
+  { "tcw", 1, 2,   943 },
+  { "tcx", 1, 2,   963 },
+  { "tcy", 1, 2,   968 },
+  { "tcz", 1, 2,   973 },
+  { "tda", 1, 2,   985 },
+  { "tdb", 1, 2,   992 },
+  { "tdc", 1, 2,  1006 },
+  { "tdd", 1, 2,  1020 },
+  { "tde", 1, 2,  1029 },
+  { "tdf", 1, 2,  1050 },
+  { "tdg", 1, 2,  1058 },
+  { "tdh", 1, 2,  1074 },
+  { "tdi", 1, 2,  1082 },
+  { "tdj", 1, 2,  1091 },
+  { "tdk", 1, 2,  1097 },
+  { "tdl", 1, 2,  1104 },
+  { "tdm", 1, 2,  1108 },
+  { "tdn", 1, 2,  1115 },
+  { "tdo", 1, 2,  1123 },
+  { "tdq", 1, 2,  1128 },
+  { "tdr", 1, 2,  1133 },
+  { "tds", 1, 2,  1140 },
+  { "tdt", 1, 2,  1147 },
+  { "tdv", 1, 2,  1158 },
+  { "tdx", 1, 2,  1163 },
+  { "tdy", 1, 2,  1190 },
+  { "te", 0, 2,  1199 },
+  { "tea", 1, 2,  1206 },
+  { "teb", 1, 2,  1213 },
+  { "tec", 1, 2,  1220 },
+  { "ted", 1, 2,  1226 },
+  { "tee", 1, 2,  1239 },
+  { "tef", 1, 2,  1258 },
+  { "teg", 1, 2,  1266 },
+  { "teh", 1, 2,  1276 },
+  { "tei", 1, 2,  1286 },
+  { "tek", 1, 2,  1297 },
+  { "tel", 1, 2,  1199 },
+  { "tem", 1, 2,  1309 },
+  { "ten", 1, 2,  1315 },
+  { "teo", 1, 2,  1331 },
+  { "tep", 1, 2,  1336 },
+  { "teq", 1, 2,  1345 },
+  { "ter", 1, 2,  1352 },
+  { "tes", 1, 2,  1359 },
+  { "tet", 1, 2,  1367 },
+  { "teu", 1, 2,  1373 },
+  { "tev", 1, 2,  1377 },
+  { "tew", 1, 2,  1382 },
+  { "tex", 1, 2,  1393 },
+  { "tey", 1, 2,  1400 },
+  { "tez", 1, 2,  1408 },
+  { "tfi", 1, 2,  1418 },
+  { "tfn", 1, 2,  1429 },
+  { "tfo", 1, 2,  1437 },
+  { "tfr", 1, 2,  1444 },
+  { "tft", 1, 2,  1451 },
+  { "tg", 0, 2,  1459 },
+  { "tga", 1, 2,  1465 },
+  { "tgb", 1, 2,  1473 },
+  { "tgc", 1, 2,  1482 },
+  { "tgd", 1, 2,  1488 },
+  { "tge", 1, 2,  1496 },
+  { "tgf", 1, 2,  1519 },
+  { "tgh", 1, 2,  1528 },
+  { "tgi", 1, 2,  1555 },
+  { "tgj", 1, 2,  1564 },
+  { "tgk", 1, 2,  1459 },
+  { "tgl", 1, 2,  1570 },
+  { "tgn", 1, 2,  1578 },
+  { "tgo", 1, 2,  1589 },
+  { "tgp", 1, 2,  1596 },
+  { "tgq", 1, 2,  1603 },
+  { "tgr", 1, 2,  1609 },
+  { "tgs", 1, 2,  1616 },
+  { "tgt", 1, 2,  1621 },
+  { "tgu", 1, 2,  1639 },
+  { "tgv", 1, 2,  1646 },
+  { "tgw", 1, 2,  1658 },
+  { "tgx", 1, 2,  1675 },
+  { "tgy", 1, 2,  1682 },
+  { "tgz", 1, 2,  1689 },
+  { "th", 0, 2,  1698 },
+  { "tha", 1, 2,  1698 },
+  { "thd", 1, 2,  1703 },
+  { "the", 1, 2,  1718 },
+  { "thf", 1, 2,  1735 },
+  { "thh", 1, 2,  1743 },
+  { "thi", 1, 2,  1764 },
+  { "thk", 1, 2,  1773 },
+  { "thl", 1, 2,  1781 },
+  { "thm", 1, 2,  1797 },
+  { "thn", 1, 2,  1802 },
+  { "thp", 1, 2,  1814 },
+  { "thq", 1, 2,  1823 },
+  { "thr", 1, 2,  1838 },
+  { "ths", 1, 2,  1850 },
+  { "tht", 1, 2,  1858 },
+  { "thu", 1, 2,  1866 },
+  { "thv", 1, 2,  1872 },
+  { "thy", 1, 2,  1891 },
+  { "thz", 1, 2,  1895 },
+  { "ti", 0, 2,  1911 },
+  { "tia", 1, 2,  1920 },
+  { "tib", 0, 0,  8740 },
+  { "tic", 1, 2,  1940 },
+  { "tif", 1, 2,  1945 },
+  { "tig", 1, 2,  1951 },
+  { "tih", 1, 2,  1957 },
+  { "tii", 1, 2,  1972 },
+  { "tij", 1, 2,  1978 },
+  { "tik", 1, 2,  1985 },
+  { "til", 1, 2,  1991 },
+  { "tim", 1, 2,  2001 },
+  { "tin", 1, 2,  2007 },
+  { "tio", 1, 2,  2013 },
+  { "tip", 1, 2,  2018 },
+  { "tiq", 1, 2,  2027 },
+  { "tir", 1, 2,  1911 },
+  { "tis", 1, 2,  2034 },
+  { "tit", 1, 2,  2050 },
+  { "tiu", 1, 2,  2058 },
+  { "tiv", 1, 2,  2065 },
+  { "tiw", 1, 2,  2069 },
+  { "tix", 1, 2,  2074 },
+  { "tiy", 1, 2,  2089 },
+  { "tiz", 1, 2,  2097 },
+  { "tja", 1, 2,  2109 },
+  { "tjg", 1, 2,  2119 },
+  { "tji", 1, 2,  2127 },
+  { "tjj", 1, 2,  2143 },
+  { "tjl", 1, 2,  2154 },
+  { "tjm", 1, 2,  2164 },
+  { "tjn", 1, 2,  2172 },
+  { "tjo", 1, 2,  2179 },
+  { "tjp", 1, 2,  2199 },
+  { "tjs", 1, 2,  2207 },
+  { "tju", 1, 2,  2223 },
+  { "tjw", 1, 2,  2232 },
+  { "tk", 0, 2,  2244 },
+  { "tka", 1, 2,  2252 },
+  { "tkb", 1, 2,  2259 },
+  { "tkd", 1, 2,  2265 },
+  { "tke", 1, 2,  2274 },
+  { "tkf", 1, 2,  2282 },
+  { "tkg", 1, 2,  2294 },
+  { "tkl", 1, 2,  2311 },
+  { "tkm", 1, 2,  2319 },
+  { "tkn", 1, 2,  2327 },
+  { "tkp", 1, 2,  2341 },
+  { "tkq", 1, 2,  2349 },
+  { "tkr", 1, 2,  2353 },
+  { "tks", 1, 2,  2361 },
+  { "tkt", 1, 2,  2371 },
+  { "tku", 1, 2,  2388 },
+  { "tkv", 1, 2,  2410 },
+  { "tkw", 1, 2,  2419 },
+  { "tkx", 1, 2,  2425 },
+  { "tkz", 1, 2,  2432 },
+  { "tl", 0, 2,  1570 },
+  { "tla", 1, 2,  2438 },
+  { "tlb", 1, 2,  2461 },
+  { "tlc", 1, 2,  2468 },
+  { "tld", 1, 2,  2486 },
+  { "tlf", 1, 2,  2493 },
+  { "tlg", 1, 2,  2501 },
+  { "tlh", 1, 2,  2509 },
+  { "tli", 1, 2,  2517 },
+  { "tlj", 1, 2,  2525 },
+  { "tlk", 1, 2,  2539 },
+  { "tll", 1, 2,  2546 },
+  { "tlm", 1, 2,  2553 },
+  { "tln", 1, 2,  2562 },
+  { "tlo", 1, 2,  2571 },
+  { "tlp", 1, 2,  2578 },
+  { "tlq", 1, 2,  2613 },
+  { "tlr", 1, 2,  2621 },
+  { "tls", 1, 2,  2628 },
+  { "tlt", 1, 2,  2638 },
+  { "tlu", 1, 2,  2647 },
+  { "tlv", 1, 2,  2654 },
+  { "tlx", 1, 2,  2662 },
+  { "tly", 1, 2,  2669 },
+  { "tma", 1, 2,  2676 },
+  { "tmb", 1, 2,  2688 },
+  { "tmc", 1, 2,  2695 },
+  { "tmd", 1, 2,  2701 },
+  { "tme", 1, 2,  2708 },
+  { "tmf", 1, 2,  2718 },
+  { "tmg", 1, 2,  2730 },
+  { "tmh", 1, 2,  2741 },
+  { "tmi", 1, 2,  2750 },
+  { "tmj", 1, 2,  2757 },
+  { "tmk", 1, 2,  2768 },
+  { "tml", 1, 2,  2789 },
+  { "tmm", 1, 2,  2803 },
+  { "tmn", 1, 2,  2813 },
+  { "tmo", 1, 2,  2831 },
+  { "tmq", 1, 2,  2837 },
+  { "tmr", 1, 2,  2844 },
+  { "tms", 1, 2,  2889 },
+  { "tmt", 1, 2,  2894 },
+  { "tmu", 1, 2,  2902 },
+  { "tmv", 1, 2,  2906 },
+  { "tmw", 1, 2,  2922 },
+  { "tmy", 1, 2,  2929 },
+  { "tmz", 1, 2,  2934 },
+  { "tn", 0, 2,  2943 },
+  { "tna", 1, 2,  2950 },
+  { "tnb", 1, 2,  2957 },
+  { "tnc", 1, 2,  2973 },
+  { "tnd", 1, 2,  2991 },
+  { "tng", 1, 2,  3010 },
+  { "tnh", 1, 2,  3018 },
+  { "tni", 1, 2,  3025 },
+  { "tnk", 1, 2,  3032 },
+  { "tnl", 1, 2,  3040 },
+  { "tnm", 1, 2,  3048 },
+  { "tnn", 1, 2,  3054 },
+  { "tno", 1, 2,  3067 },
+  { "tnp", 1, 2,  3076 },
+  { "tnq", 1, 2,  3087 },
+  { "tnr", 1, 2,  3093 },
+  { "tns", 1, 2,  3100 },
+  { "tnt", 1, 2,  3106 },
+  { "tnu", 1, 2,  3117 },
+  { "tnv", 1, 2,  3127 },
+  { "tnw", 1, 2,  3139 },
+  { "tnx", 1, 2,  3149 },
+  { "tny", 1, 2,  3156 },
+  { "tnz", 1, 2,  3163 },
+  { "to", 0, 2,  3171 },
+  { "tob", 1, 2,  3193 },
+  { "toc", 1, 2,  3198 },
+  { "tod", 1, 2,  3215 },
+  { "tof", 1, 2,  3220 },
+  { "tog", 1, 2,  3227 },
+  { "toh", 1, 2,  3241 },
+  { "toi", 1, 2,  3249 },
+  { "toj", 1, 2,  3264 },
+  { "tok", 1, 2,  3274 },
+  { "tol", 1, 2,  3284 },
+  { "tom", 1, 2,  3291 },
+  { "ton", 1, 2,  3171 },
+  { "too", 1, 2,  3299 },
+  { "top", 1, 2,  3329 },
+  { "toq", 1, 2,  3347 },
+  { "tor", 1, 2,  3354 },
+  { "tos", 1, 2,  3372 },
+  { "tou", 1, 2,  3390 },
+  { "tov", 1, 2,  3394 },
+  { "tow", 1, 2,  3408 },
+  { "tox", 1, 2,  3414 },
+  { "toy", 1, 2,  3421 },
+  { "toz", 1, 2,  3429 },
+  { "tpa", 1, 2,  3432 },
+  { "tpc", 1, 2,  3440 },
+  { "tpe", 1, 2,  3456 },
+  { "tpf", 1, 2,  3464 },
+  { "tpg", 1, 2,  3471 },
+  { "tpi", 1, 2,  3476 },
+  { "tpj", 1, 2,  3486 },
+  { "tpk", 1, 2,  3495 },
+  { "tpl", 1, 2,  3505 },
+  { "tpm", 1, 2,  3523 },
+  { "tpn", 1, 2,  3532 },
+  { "tpo", 1, 2,  3543 },
+  { "tpp", 1, 2,  3551 },
+  { "tpq", 1, 2,  3571 },
+  { "tpr", 1, 2,  3577 },
+  { "tpt", 1, 2,  3585 },
+  { "tpu", 1, 2,  3607 },
+  { "tpv", 1, 2,  3615 },
+  { "tpw", 1, 2,  3623 },
+  { "tpx", 1, 2,  3629 },
+  { "tpy", 1, 2,  3647 },
+  { "tpz", 1, 2,  3654 },
+  { "tqb", 1, 2,  3662 },
+  { "tql", 1, 2,  3669 },
+  { "tqm", 1, 2,  3676 },
+  { "tqn", 1, 2,  3684 },
+  { "tqo", 1, 2,  3691 },
+  { "tqp", 1, 2,  3699 },
+  { "tqq", 1, 2,  3706 },
+  { "tqr", 1, 2,  3712 },
+  { "tqt", 1, 2,  3719 },
+  { "tqu", 1, 2,  3736 },
+  { "tqw", 1, 2,  3741 },
+  { "tr", 0, 2,  3749 },
+  { "tra", 1, 2,  3757 },
+  { "trb", 1, 2,  3764 },
+  { "trc", 1, 2,  3771 },
+  { "trd", 1, 2,  3786 },
+  { "tre", 1, 2,  3791 },
+  { "trf", 1, 2,  3806 },
+  { "trg", 1, 2,  3834 },
+  { "trh", 1, 2,  3849 },
+  { "tri", 1, 2,  3856 },
+  { "trj", 1, 2,  3862 },
+  { "trl", 1, 2,  3868 },
+  { "trm", 1, 2,  3888 },
+  { "trn", 1, 2,  3896 },
+  { "tro", 1, 2,  3907 },
+  { "trp", 1, 2,  3919 },
+  { "trq", 1, 2,  3929 },
+  { "trr", 1, 2,  3958 },
+  { "trs", 1, 2,  3967 },
+  { "trt", 1, 2,  3988 },
+  { "tru", 1, 2,  3997 },
+  { "trv", 1, 2,  4004 },
+  { "trw", 1, 2,  4010 },
+  { "trx", 1, 2,  4018 },
+  { "try", 1, 2,  4044 },
+  { "trz", 1, 2,  4051 },
+  { "ts", 0, 2,  4057 },
+  { "tsa", 1, 2,  4064 },
+  { "tsb", 1, 2,  4072 },
+  { "tsc", 1, 2,  4079 },
+  { "tsd", 1, 2,  4084 },
+  { "tse", 1, 2,  4094 },
+  { "tsg", 1, 2,  4117 },
+  { "tsh", 1, 2,  4124 },
+  { "tsi", 1, 2,  4131 },
+  { "tsj", 1, 2,  4141 },
+  { "tsk", 1, 2,  4150 },
+  { "tsl", 1, 2,  4156 },
+  { "tsm", 1, 2,  4167 },
+  { "tsn", 1, 2,  2943 },
+  { "tso", 1, 2,  4057 },
+  { "tsp", 1, 2,  4189 },
+  { "tsq", 1, 2,  4208 },
+  { "tsr", 1, 2,  4227 },
+  { "tss", 1, 2,  4232 },
+  { "tst", 1, 2,  4253 },
+  { "tsu", 1, 2,  4274 },
+  { "tsv", 1, 2,  4279 },
+  { "tsw", 1, 2,  4285 },
+  { "tsx", 1, 2,  4297 },
+  { "tsy", 1, 2,  4304 },
+  { "tsz", 1, 2,  4324 },
+  { "tt", 0, 2,   434 },
+  { "tta", 1, 2,  4334 },
+  { "ttb", 1, 2,  4341 },
+  { "ttc", 1, 2,  4345 },
+  { "ttd", 1, 2,  4355 },
+  { "tte", 1, 2,  4362 },
+  { "ttf", 1, 2,  4373 },
+  { "ttg", 1, 2,  4381 },
+  { "tth", 1, 2,  4388 },
+  { "tti", 1, 2,  4402 },
+  { "ttj", 1, 2,  4409 },
+  { "ttk", 1, 2,  4415 },
+  { "ttl", 1, 2,  4422 },
+  { "ttm", 1, 2,  4429 },
+  { "ttn", 1, 2,  4448 },
+  { "tto", 1, 2,  4454 },
+  { "ttp", 1, 2,  4468 },
+  { "ttq", 1, 2,  4478 },
+  { "ttr", 1, 2,  4499 },
+  { "tts", 1, 2,  4504 },
+  { "ttt", 1, 2,  4523 },
+  { "ttu", 1, 2,  4535 },
+  { "ttv", 1, 2,  4541 },
+  { "ttw", 1, 2,  4547 },
+  { "tty", 1, 2,  4556 },
+  { "ttz", 1, 2,  4566 },
+  { "tua", 1, 2,  4571 },
+  { "tub", 1, 2,  4580 },
+  { "tuc", 1, 2,  4593 },
+  { "tud", 1, 2,  4598 },
+  { "tue", 1, 2,  4604 },
+  { "tuf", 1, 2,  4611 },
+  { "tug", 1, 2,  4627 },
+  { "tuh", 1, 2,  4633 },
+  { "tui", 1, 2,  4640 },
+  { "tuj", 1, 2,  4647 },
+  { "tuk", 1, 2,  2244 },
+  { "tul", 1, 2,  4655 },
+  { "tum", 1, 2,  4660 },
+  { "tun", 1, 2,  4668 },
+  { "tuo", 1, 2,  4675 },
+  { "tup", 0, 2,  4682 },
+  { "tuq", 1, 2,  4697 },
+  { "tur", 1, 2,  3749 },
+  { "tus", 1, 2,  4704 },
+  { "tut", 0, 2,  4714 },
+  { "tuu", 1, 2,  4731 },
+  { "tuv", 1, 2,  4739 },
+  { "tux", 1, 2,  4747 },
+  { "tuy", 1, 2,  4757 },
+  { "tuz", 1, 2,  4763 },
+  { "tva", 1, 2,  4769 },
+  { "tvd", 1, 2,  4776 },
+  { "tve", 1, 2,  4784 },
+  { "tvk", 1, 2,  4790 },
+  { "tvl", 1, 2,  4808 },
+  { "tvm", 1, 2,  4815 },
+  { "tvn", 1, 2,  4828 },
+  { "tvo", 1, 2,  4836 },
+  { "tvs", 1, 2,  4843 },
+  { "tvt", 1, 2,  4850 },
+  { "tvu", 1, 2,  4862 },
+  { "tvw", 1, 2,  4868 },
+  { "tvx", 1, 2,  4874 },
+  { "tvy", 1, 2,  4882 },
+  { "tw", 0, 2,  4896 },
+  { "twa", 1, 2,  4900 },
+  { "twb", 1, 2,  4906 },
+  { "twc", 1, 2,  4923 },
+  { "twd", 1, 2,  4933 },
+  { "twe", 1, 2,  4940 },
+  { "twf", 1, 2,  4957 },
+  { "twg", 1, 2,  4972 },
+  { "twh", 1, 2,  4981 },
+  { "twi", 1, 2,  4896 },
+  { "twl", 1, 2,  4990 },
+  { "twm", 1, 2,  4997 },
+  { "twn", 1, 2,  5011 },
+  { "two", 1, 2,  5018 },
+  { "twp", 1, 2,  5027 },
+  { "twq", 1, 2,  5031 },
+  { "twr", 1, 2,  5039 },
+  { "twt", 1, 2,  5064 },
+  { "twu", 1, 2,  5074 },
+  { "tww", 1, 2,  5082 },
+  { "twx", 1, 2,  5089 },
+  { "twy", 1, 2,  5094 },
+  { "txa", 1, 2,  5102 },
+  { "txb", 1, 2,  5111 },
+  { "txc", 1, 2,  5123 },
+  { "txe", 1, 2,  5132 },
+  { "txg", 1, 2,  5139 },
+  { "txh", 1, 2,  5146 },
+  { "txi", 1, 2,  5155 },
+  { "txj", 1, 2,  5162 },
+  { "txm", 1, 2,  5170 },
+  { "txn", 1, 2,  5177 },
+  { "txo", 1, 2,  5192 },
+  { "txq", 1, 2,  5197 },
+  { "txr", 1, 2,  5201 },
+  { "txs", 1, 2,  5212 },
+  { "txt", 1, 2,  5219 },
+  { "txu", 1, 2,  5225 },
+  { "txx", 1, 2,  5233 },
+  { "txy", 1, 2,  5240 },
+  { "ty", 0, 2,   329 },
+  { "tya", 1, 2,  5257 },
+  { "tye", 1, 2,  5263 },
+  { "tyh", 1, 2,  5270 },
+  { "tyi", 1, 2,  5275 },
+  { "tyj", 1, 2,  5287 },
+  { "tyl", 1, 2,  5294 },
+  { "tyn", 1, 2,  5302 },
+  { "typ", 1, 2,  5309 },
+  { "tyr", 1, 2,  5317 },
+  { "tys", 1, 2,  5327 },
+  { "tyt", 1, 2,  5338 },
+  { "tyu", 1, 2,  5347 },
+  { "tyv", 1, 2,  5351 },
+  { "tyx", 1, 2,  5360 },
+  { "tyy", 1, 2,  5370 },
+  { "tyz", 1, 2,  5376 },
+  { "tza", 1, 2,  5381 },
+  { "tzh", 1, 2,  5405 },
+  { "tzj", 1, 2,  5413 },
+  { "tzl", 1, 2,  5423 },
+  { "tzm", 1, 2,  5432 },
+  { "tzn", 1, 2,  5457 },
+  { "tzo", 1, 2,  5463 },
+  { "tzx", 1, 2,  5471 },
+  { "uam", 1, 2,  5479 },
+  { "uan", 1, 2,  5486 },
+  { "uar", 1, 2,  5491 },
+  { "uba", 1, 2,  5499 },
+  { "ubi", 1, 2,  5505 },
+  { "ubl", 1, 2,  5509 },
+  { "ubr", 1, 2,  5525 },
+  { "ubu", 1, 2,  5530 },
+  { "uby", 1, 2,  5540 },
+  { "uda", 1, 2,  5546 },
+  { "ude", 1, 2,  5550 },
+  { "udg", 1, 2,  5556 },
+  { "udi", 1, 2,  5563 },
+  { "udj", 1, 2,  5567 },
+  { "udl", 1, 2,  5572 },
+  { "udm", 1, 2,  5579 },
+  { "udu", 1, 2,  5586 },
+  { "ues", 1, 2,  5591 },
+  { "ufi", 1, 2,  5597 },
+  { "ug", 0, 2,  5602 },
+  { "uga", 1, 2,  5617 },
+  { "ugb", 1, 2,  5626 },
+  { "uge", 1, 2,  5638 },
+  { "ugh", 1, 2,  5645 },
+  { "ugn", 1, 2,  5653 },
+  { "ugo", 1, 2,  5675 },
+  { "ugy", 1, 2,  5681 },
+  { "uha", 1, 2,  5705 },
+  { "uhn", 1, 2,  5711 },
+  { "uig", 1, 2,  5717 },
+  { "uis", 1, 2,  5724 },
+  { "uiv", 1, 2,  5730 },
+  { "uji", 1, 2,  5736 },
+  { "uk", 0, 2,  5746 },
+  { "uka", 1, 2,  5756 },
+  { "ukg", 1, 2,  5763 },
+  { "ukh", 1, 2,  5773 },
+  { "uki", 1, 2,  5781 },
+  { "ukk", 1, 2,  5793 },
+  { "ukl", 1, 2,  5805 },
+  { "ukp", 1, 2,  5829 },
+  { "ukq", 1, 2,  5843 },
+  { "ukr", 1, 2,  5746 },
+  { "uks", 1, 2,  5848 },
+  { "uku", 1, 2,  5876 },
+  { "ukv", 1, 2,  5881 },
+  { "ukw", 1, 2,  5886 },
+  { "uky", 1, 2,  5905 },
+  { "ula", 1, 2,  5914 },
+  { "ulb", 1, 2,  5921 },
+  { "ulc", 1, 2,  5930 },
+  { "ule", 1, 2,  5935 },
+  { "ulf", 1, 2,  5940 },
+  { "uli", 1, 2,  5945 },
+  { "ulk", 1, 2,  5954 },
+  { "ull", 1, 2,  5965 },
+  { "ulm", 1, 2,  5973 },
+  { "uln", 1, 2,  5983 },
+  { "ulu", 1, 2,  5996 },
+  { "ulw", 1, 2,  6006 },
+  { "uma", 1, 2,  6011 },
+  { "umb", 1, 2,  6020 },
+  { "umc", 1, 2,  6028 },
+  { "umd", 1, 2,  6040 },
+  { "umg", 1, 2,  6051 },
+  { "umi", 1, 2,  6063 },
+  { "umm", 1, 2,  6068 },
+  { "umn", 1, 2,  6073 },
+  { "umo", 1, 2,  6086 },
+  { "ump", 1, 2,  6095 },
+  { "umr", 1, 2,  6102 },
+  { "ums", 1, 2,  6112 },
+  { "umu", 1, 2,  6119 },
+  { "una", 1, 2,  6126 },
+  { "und", 1, 2,  6139 },
+  { "une", 1, 2,  6152 },
+  { "ung", 1, 2,  6158 },
+  { "uni", 1, 2,  6168 },
+  { "unk", 1, 2,  6172 },
+  { "unm", 1, 2,  6187 },
+  { "unn", 1, 2,  6193 },
+  { "unr", 1, 2,  6200 },
+  { "unu", 1, 2,  6208 },
+  { "unx", 1, 2,  6216 },
+  { "unz", 1, 2,  6222 },
+  { "uon", 1, 2,  6234 },
+  { "upi", 1, 2,  6240 },
+  { "upv", 1, 2,  6246 },
+  { "ur", 0, 2,  6270 },
+  { "ura", 1, 2,  6275 },
+  { "urb", 1, 2,  6283 },
+  { "urc", 1, 2,  6297 },
+  { "urd", 1, 2,  6270 },
+  { "ure", 1, 2,  6308 },
+  { "urf", 1, 2,  6312 },
+  { "urg", 1, 2,  6319 },
+  { "urh", 1, 2,  6327 },
+  { "uri", 1, 2,  6334 },
+  { "urk", 1, 2,  6339 },
+  { "url", 1, 2,  6351 },
+  { "urm", 1, 2,  6357 },
+  { "urn", 1, 2,  6365 },
+  { "uro", 1, 2,  6377 },
+  { "urp", 1, 2,  6400 },
+  { "urr", 1, 2,  6410 },
+  { "urt", 1, 2,  6420 },
+  { "uru", 1, 2,  6425 },
+  { "urv", 1, 2,  6431 },
+  { "urw", 1, 2,  6438 },
+  { "urx", 1, 2,  6442 },
+  { "ury", 1, 2,  6448 },
+  { "urz", 1, 2,  6453 },
+  { "usa", 1, 2,  6468 },
+  { "ush", 1, 2,  6476 },
+  { "usi", 1, 2,  6483 },
+  { "usk", 1, 2,  6488 },
+  { "usp", 1, 2,  6497 },
+  { "uss", 1, 2,  6507 },
+  { "usu", 1, 2,  6516 },
+  { "uta", 1, 2,  6520 },
+  { "ute", 1, 2,  6526 },
+  { "uth", 1, 2,  6546 },
+  { "utp", 1, 2,  6553 },
+  { "utr", 1, 2,  6576 },
+  { "utu", 1, 2,  6582 },
+  { "uum", 1, 2,  6586 },
+  { "uur", 1, 2,  6591 },
+  { "uuu", 1, 2,  6605 },
+  { "uve", 1, 2,  6607 },
+  { "uvh", 1, 2,  6619 },
+  { "uvl", 1, 2,  6623 },
+  { "uwa", 1, 2,  6628 },
+  { "uya", 1, 2,  6639 },
+  { "uz", 0, 2,  6651 },
+  { "uzb", 1, 2,  6651 },
+  { "uzn", 1, 2,  6657 },
+  { "uzs", 1, 2,  6673 },
+  { "vaa", 1, 2,  6689 },
+  { "vae", 1, 2,  6702 },
+  { "vaf", 1, 2,  6707 },
+  { "vag", 1, 2,  6713 },
+  { "vah", 1, 2,  6719 },
+  { "vai", 1, 2,  6735 },
+  { "vaj", 1, 2,  6739 },
+  { "val", 1, 2,  6746 },
+  { "vam", 1, 2,  6752 },
+  { "van", 1, 2,  6759 },
+  { "vao", 1, 2,  6766 },
+  { "vap", 1, 2,  6770 },
+  { "var", 1, 2,  6778 },
+  { "vas", 1, 2,  6787 },
+  { "vau", 1, 2,  6794 },
+  { "vav", 1, 2,  6801 },
+  { "vay", 1, 2,  6807 },
+  { "vbb", 1, 2,  6812 },
+  { "vbk", 1, 2,  6829 },
+  { "ve", 0, 2,  6850 },
+  { "vec", 1, 2,  6856 },
+  { "ved", 1, 2,  6865 },
+  { "vel", 1, 2,  6872 },
+  { "vem", 1, 2,  6879 },
+  { "ven", 1, 2,  6850 },
+  { "veo", 1, 2,  6891 },
+  { "vep", 1, 2,  6902 },
+  { "ver", 1, 2,  6907 },
+  { "vgr", 1, 2,  6917 },
+  { "vgt", 1, 2,  6924 },
+  { "vi", 0, 2,  6944 },
+  { "vic", 1, 2,  6955 },
+  { "vid", 1, 2,  6986 },
+  { "vie", 1, 2,  6944 },
+  { "vif", 1, 2,  6994 },
+  { "vig", 1, 2,  6999 },
+  { "vil", 1, 2,  7005 },
+  { "vin", 1, 2,  7012 },
+  { "vis", 1, 2,  7018 },
+  { "vit", 1, 2,  7027 },
+  { "viv", 1, 2,  7032 },
+  { "vka", 1, 2,  7038 },
+  { "vkj", 1, 2,  7048 },
+  { "vkk", 1, 2,  7056 },
+  { "vkl", 1, 2,  7061 },
+  { "vkm", 1, 2,  7070 },
+  { "vkn", 1, 2,  7078 },
+  { "vko", 1, 2,  7088 },
+  { "vkp", 1, 2,  7096 },
+  { "vkt", 1, 2,  7122 },
+  { "vku", 1, 2,  7146 },
+  { "vkz", 1, 2,  7154 },
+  { "vlp", 1, 2,  7164 },
+  { "vls", 1, 2,  7171 },
+  { "vma", 1, 2,  7178 },
+  { "vmb", 1, 2,  7191 },
+  { "vmc", 1, 2,  7200 },
+  { "vmd", 1, 2,  7220 },
+  { "vme", 1, 2,  7233 },
+  { "vmf", 1, 2,  7246 },
+  { "vmg", 1, 2,  7261 },
+  { "vmh", 1, 2,  7272 },
+  { "vmi", 1, 2,  7281 },
+  { "vmj", 1, 2,  7286 },
+  { "vmk", 1, 2,  7304 },
+  { "vml", 1, 2,  7320 },
+  { "vmm", 1, 2,  7328 },
+  { "vmp", 1, 2,  7347 },
+  { "vmq", 1, 2,  7367 },
+  { "vmr", 1, 2,  7386 },
+  { "vms", 1, 2,  7394 },
+  { "vmu", 1, 2,  7402 },
+  { "vmv", 1, 2,  7412 },
+  { "vmw", 1, 2,  7426 },
+  { "vmx", 1, 2,  7434 },
+  { "vmy", 1, 2,  7451 },
+  { "vmz", 1, 2,  7468 },
+  { "vnk", 1, 2,  7487 },
+  { "vnm", 1, 2,  7492 },
+  { "vnp", 1, 2,  7501 },
+  { "vo", 0, 2,  7508 },
+  { "vol", 1, 2,  7508 },
+  { "vor", 1, 2,  7517 },
+  { "vot", 1, 2,  7522 },
+  { "vra", 1, 2,  7528 },
+  { "vro", 1, 2,  7535 },
+  { "vrs", 1, 2,  7541 },
+  { "vrt", 1, 2,  7548 },
+  { "vsi", 1, 2,  7556 },
+  { "vsl", 1, 2,  7578 },
+  { "vsv", 1, 2,  7603 },
+  { "vto", 1, 2,  7627 },
+  { "vum", 1, 2,  7633 },
+  { "vun", 1, 2,  7639 },
+  { "vut", 1, 2,  7645 },
+  { "vwa", 1, 2,  7650 },
+  { "wa", 0, 2,  7662 },
+  { "waa", 1, 2,  7670 },
+  { "wab", 1, 2,  7682 },
+  { "wac", 1, 2,  7686 },
+  { "wad", 1, 2,  7700 },
+  { "wae", 1, 2,  7707 },
+  { "waf", 1, 2,  7714 },
+  { "wag", 1, 2,  7722 },
+  { "wah", 1, 2,  7729 },
+  { "wai", 1, 2,  7738 },
+  { "waj", 1, 2,  7744 },
+  { "wak", 0, 2,  7750 },
+  { "wal", 1, 2,  7769 },
+  { "wam", 1, 2,  7778 },
+  { "wan", 1, 2,  7788 },
+  { "wao", 1, 2,  7792 },
+  { "wap", 1, 2,  7798 },
+  { "waq", 1, 2,  7808 },
+  { "war", 1, 2,  7816 },
+  { "was", 1, 2,  7836 },
+  { "wat", 1, 2,  7842 },
+  { "wau", 1, 2,  7851 },
+  { "wav", 1, 2,  7858 },
+  { "waw", 1, 2,  7863 },
+  { "wax", 1, 2,  7870 },
+  { "way", 1, 2,  7876 },
+  { "waz", 1, 2,  7883 },
+  { "wba", 1, 2,  7890 },
+  { "wbb", 1, 2,  7896 },
+  { "wbe", 1, 2,  7901 },
+  { "wbf", 1, 2,  7909 },
+  { "wbh", 1, 2,  7914 },
+  { "wbi", 1, 2,  7920 },
+  { "wbj", 1, 2,  7927 },
+  { "wbk", 1, 2,  7934 },
+  { "wbl", 1, 2,  7942 },
+  { "wbm", 1, 2,  7948 },
+  { "wbp", 1, 2,  7951 },
+  { "wbq", 1, 2,  7960 },
+  { "wbr", 1, 2,  7967 },
+  { "wbs", 1, 2,  7973 },
+  { "wbt", 1, 2,  7999 },
+  { "wbv", 1, 2,  8007 },
+  { "wbw", 1, 2,  8015 },
+  { "wca", 1, 2,  8019 },
+  { "wci", 1, 2,  8029 },
+  { "wdd", 1, 2,  8039 },
+  { "wdg", 1, 2,  8046 },
+  { "wdj", 1, 2,  8056 },
+  { "wdk", 1, 2,  8066 },
+  { "wdt", 1, 2,  8075 },
+  { "wdu", 1, 2,  8082 },
+  { "wdy", 1, 2,  8090 },
+  { "wea", 1, 2,  8103 },
+  { "wec", 1, 2,  8109 },
+  { "wed", 1, 2,  8121 },
+  { "weg", 1, 2,  8127 },
+  { "weh", 1, 2,  8135 },
+  { "wei", 1, 2,  8139 },
+  { "wel", 0, 0, 15708 },
+  { "wem", 1, 2,  8146 },
+  { "wen", 0, 2,  8156 },
+  { "weo", 1, 2,  8174 },
+  { "wep", 1, 2,  8181 },
+  { "wer", 1, 2,  8193 },
+  { "wes", 1, 2,  8198 },
+  { "wet", 1, 2,  8215 },
+  { "weu", 1, 2,  8221 },
+  { "wew", 1, 2,  8235 },
+  { "wfg", 1, 2,  8242 },
+  { "wga", 1, 2,  8247 },
+  { "wgb", 1, 2,  8254 },
+  { "wgg", 1, 2,  8263 },
+  { "wgi", 1, 2,  8276 },
+  { "wgo", 1, 2,  8282 },
+  { "wgu", 1, 2,  8289 },
+  { "wgy", 1, 2,  8297 },
+  { "wha", 1, 2,  8307 },
+  { "whg", 1, 2,  8316 },
+  { "whk", 1, 2,  8329 },
+  { "whu", 1, 2,  8343 },
+  { "wib", 1, 2,  8356 },
+  { "wic", 1, 2,  8375 },
+  { "wie", 1, 2,  8383 },
+  { "wif", 1, 2,  8391 },
+  { "wig", 1, 2,  8404 },
+  { "wih", 1, 2,  8416 },
+  { "wii", 1, 2,  8428 },
+  { "wij", 1, 2,  8437 },
+  { "wik", 1, 2,  8448 },
+  { "wil", 1, 2,  8457 },
+  { "wim", 1, 2,  8466 },
+  { "win", 1, 2,  8478 },
+  { "wir", 1, 2,  8487 },
+  { "wiu", 1, 2,  8496 },
+  { "wiv", 1, 2,  8501 },
+  { "wiy", 1, 2,  8506 },
+  { "wja", 1, 2,  8512 },
+  { "wji", 1, 2,  8517 },
+  { "wka", 1, 2,  8523 },
+  { "wkb", 1, 2,  8531 },
+  { "wkd", 1, 2,  8540 },
+  { "wkl", 1, 2,  8546 },
+  { "wkr", 1, 2,  8555 },
+  { "wku", 1, 2,  8573 },
+  { "wkw", 1, 2,  8583 },
+  { "wky", 1, 2,  8592 },
+  { "wla", 1, 2,  8606 },
+  { "wlc", 1, 2,  8612 },
+  { "wle", 1, 2,  8628 },
+  { "wlg", 1, 2,  8635 },
+  { "wlh", 1, 2,  8646 },
+  { "wli", 1, 2,  8653 },
+  { "wlk", 1, 2,  8660 },
+  { "wll", 1, 2,  8668 },
+  { "wlm", 1, 2,  8681 },
+  { "wln", 1, 2,  7662 },
+  { "wlo", 1, 2,  8695 },
+  { "wlr", 1, 2,  8701 },
+  { "wls", 1, 2,  8709 },
+  { "wlu", 1, 2,  8719 },
+  { "wlv", 1, 2,  8728 },
+  { "wlw", 1, 2,  8750 },
+  { "wlx", 1, 2,  8756 },
+  { "wly", 1, 2,  8769 },
+  { "wma", 1, 2,  8776 },
+  { "wmb", 1, 2,  8791 },
+  { "wmc", 1, 2,  8799 },
+  { "wmd", 1, 2,  8805 },
+  { "wme", 1, 2,  8815 },
+  { "wmg", 1, 2,  8823 },
+  { "wmh", 1, 2,  8839 },
+  { "wmi", 1, 2,  8847 },
+  { "wmm", 1, 2,  8853 },
+  { "wmn", 1, 2,  8871 },
+  { "wmo", 1, 2,  8880 },
+  { "wms", 1, 2,  8903 },
+  { "wmt", 1, 2,  8910 },
+  { "wmw", 1, 2,  8921 },
+  { "wmx", 1, 2,  8927 },
+  { "wnb", 1, 2,  8932 },
+  { "wnc", 1, 2,  8941 },
+  { "wnd", 1, 2,  8949 },
+  { "wne", 1, 2,  8959 },
+  { "wng", 1, 2,  8966 },
+  { "wni", 1, 2,  8974 },
+  { "wnk", 1, 2,  8992 },
+  { "wnm", 1, 2,  9001 },
+  { "wnn", 1, 2,  9012 },
+  { "wno", 1, 2,  9021 },
+  { "wnp", 1, 2,  9026 },
+  { "wnu", 1, 2,  9032 },
+  { "wnw", 1, 2,  9037 },
+  { "wny", 1, 2,  9043 },
+  { "wo", 0, 2,  9049 },
+  { "woa", 1, 2,  9055 },
+  { "wob", 1, 2,  9062 },
+  { "woc", 1, 2,  9075 },
+  { "wod", 1, 2,  9081 },
+  { "woe", 1, 2,  9088 },
+  { "wof", 1, 2,  9097 },
+  { "wog", 1, 2,  9112 },
+  { "woi", 1, 2,  9122 },
+  { "wok", 1, 2,  9129 },
+  { "wol", 1, 2,  9049 },
+  { "wom", 1, 2,  9136 },
+  { "won", 1, 2,  9150 },
+  { "woo", 1, 2,  9156 },
+  { "wor", 1, 2,  9165 },
+  { "wos", 1, 2,  9171 },
+  { "wow", 1, 2,  9183 },
+  { "woy", 1, 2,  9191 },
+  { "wpc", 1, 2,  9197 },
+  { "wrb", 1, 2,  9202 },
+  { "wrg", 1, 2,  9212 },
+  { "wrh", 1, 2,  9220 },
+  { "wri", 1, 2,  9230 },
+  { "wrk", 1, 2,  9241 },
+  { "wrl", 1, 2,  9248 },
+  { "wrm", 1, 2,  9258 },
+  { "wrn", 1, 2,  9268 },
+  { "wro", 1, 2,  9276 },
+  { "wrp", 1, 2,  9285 },
+  { "wrr", 1, 2,  9293 },
+  { "wrs", 1, 2,  9302 },
+  { "wru", 1, 2,  9308 },
+  { "wrv", 1, 2,  9313 },
+  { "wrw", 1, 2,  9320 },
+  { "wrx", 1, 2,  9331 },
+  { "wry", 1, 2,  9340 },
+  { "wrz", 1, 2,  9348 },
+  { "wsa", 1, 2,  9366 },
+  { "wsg", 1, 2,  9376 },
+  { "wsi", 1, 2,  9392 },
+  { "wsk", 1, 2,  9397 },
+  { "wsr", 1, 2,  9404 },
+  { "wss", 1, 2,  9411 },
+  { "wsu", 1, 2,  9416 },
+  { "wsv", 1, 2,  9421 },
+  { "wtf", 1, 2,  9441 },
+  { "wth", 1, 2,  9448 },
+  { "wti", 1, 2,  9461 },
+  { "wtk", 1, 2,  9467 },
+  { "wtm", 1, 2,  9478 },
+  { "wtw", 1, 2,  9485 },
+  { "wua", 1, 2,  9490 },
+  { "wub", 1, 2,  9503 },
+  { "wud", 1, 2,  9512 },
+  { "wuh", 1, 2,  9517 },
+  { "wul", 1, 2,  9526 },
+  { "wum", 1, 2,  9533 },
+  { "wun", 1, 2,  9540 },
+  { "wur", 1, 2,  9546 },
+  { "wut", 1, 2,  9554 },
+  { "wuu", 1, 2,  9561 },
+  { "wuv", 1, 2,  9573 },
+  { "wux", 1, 2,  9584 },
+  { "wuy", 1, 2,  9590 },
+  { "wwa", 1, 2,  9597 },
+  { "wwb", 1, 2,  9603 },
+  { "wwo", 1, 2,  9613 },
+  { "wwr", 1, 2,  9621 },
+  { "www", 1, 2,  9628 },
+  { "wxa", 1, 2,  9633 },
+  { "wxw", 1, 2,  9644 },
+  { "wyb", 1, 2,  9653 },
+  { "wyi", 1, 2,  9676 },
+  { "wym", 1, 2,  9687 },
+  { "wyn", 1, 2,  9697 },
+  { "wyr", 1, 2,  9705 },
+  { "wyy", 1, 2,  9713 },
+  { "xaa", 1, 2,  9729 },
+  { "xab", 1, 2,  9748 },
+  { "xac", 1, 2,  9754 },
+  { "xad", 1, 2,  9762 },
+  { "xae", 1, 2,  9767 },
+  { "xag", 1, 2,  9775 },
+  { "xai", 1, 2,  9782 },
+  { "xaj", 1, 2,  9790 },
+  { "xak", 1, 2,  9804 },
+  { "xal", 1, 2,  9810 },
+  { "xam", 1, 2,  9817 },
+  { "xan", 1, 2,  9823 },
+  { "xao", 1, 2,  9832 },
+  { "xap", 1, 2,  9837 },
+  { "xaq", 1, 2,  9847 },
+  { "xar", 1, 2,  9858 },
+  { "xas", 1, 2,  9865 },
+  { "xat", 1, 2,  9871 },
+  { "xau", 1, 2,  9880 },
+  { "xav", 1, 2,  9888 },
+  { "xaw", 1, 2,  9897 },
+  { "xay", 1, 2,  9906 },
+  { "xbb", 1, 2,  9920 },
+  { "xbc", 1, 2,  9936 },
+  { "xbd", 1, 2,  9945 },
+  { "xbe", 1, 2,  9952 },
+  { "xbg", 1, 2,  9961 },
+  { "xbi", 1, 2,  9972 },
+  { "xbj", 1, 2,  9979 },
+  { "xbm", 1, 2,  9988 },
+  { "xbn", 1, 2, 10003 },
+  { "xbo", 1, 2, 10011 },
+  { "xbp", 1, 2, 10021 },
+  { "xbr", 1, 2, 10031 },
+  { "xbw", 1, 2, 10039 },
+  { "xby", 1, 2, 10048 },
+  { "xcb", 1, 2, 10056 },
+  { "xcc", 1, 2, 10064 },
+  { "xce", 1, 2, 10072 },
+  { "xcg", 1, 2, 10084 },
+  { "xch", 1, 2, 10103 },
+  { "xcl", 1, 2, 10112 },
+  { "xcm", 1, 2, 10132 },
+  { "xcn", 1, 2, 10142 },
+  { "xco", 1, 2, 10151 },
+  { "xcr", 1, 2, 10162 },
+  { "xct", 1, 2, 10169 },
+  { "xcu", 1, 2, 10188 },
+  { "xcv", 1, 2, 10197 },
+  { "xcw", 1, 2, 10207 },
+  { "xcy", 1, 2, 10219 },
+  { "xda", 1, 2, 10226 },
+  { "xdc", 1, 2, 10237 },
+  { "xdk", 1, 2, 10244 },
+  { "xdm", 1, 2, 10251 },
+  { "xdo", 1, 2, 10259 },
+  { "xdq", 1, 2, 10266 },
+  { "xdy", 1, 2, 10273 },
+  { "xeb", 1, 2, 10288 },
+  { "xed", 1, 2, 10294 },
+  { "xeg", 1, 2, 10298 },
+  { "xel", 1, 2, 10306 },
+  { "xem", 1, 2, 10311 },
+  { "xep", 1, 2, 10320 },
+  { "xer", 1, 2, 10330 },
+  { "xes", 1, 2, 10339 },
+  { "xet", 1, 2, 10347 },
+  { "xeu", 1, 2, 10353 },
+  { "xfa", 1, 2, 10364 },
+  { "xga", 1, 2, 10373 },
+  { "xgb", 1, 2, 10382 },
+  { "xgd", 1, 2, 10387 },
+  { "xgf", 1, 2, 10394 },
+  { "xgg", 1, 2, 10417 },
+  { "xgi", 1, 2, 10424 },
+  { "xgl", 1, 2, 10434 },
+  { "xgm", 1, 2, 10443 },
+  { "xgr", 1, 2, 10453 },
+  { "xgu", 1, 2, 10459 },
+  { "xgw", 1, 2, 10467 },
+  { "xh", 0, 2, 10472 },
+  { "xha", 1, 2, 10478 },
+  { "xhc", 1, 2, 10485 },
+  { "xhd", 1, 2, 10492 },
+  { "xhe", 1, 2, 10500 },
+  { "xhm", 1, 2, 10509 },
+  { "xho", 1, 2, 10472 },
+  { "xhr", 1, 2, 10541 },
+  { "xht", 1, 2, 10550 },
+  { "xhu", 1, 2, 10557 },
+  { "xhv", 1, 2, 10565 },
+  { "xib", 1, 2, 10570 },
+  { "xii", 1, 2, 10578 },
+  { "xil", 1, 2, 10583 },
+  { "xin", 1, 2, 10592 },
+  { "xir", 1, 2, 10598 },
+  { "xis", 1, 2, 10607 },
+  { "xiv", 1, 2, 10613 },
+  { "xiy", 1, 2, 10635 },
+  { "xjb", 1, 2, 10642 },
+  { "xjt", 1, 2, 10653 },
+  { "xka", 1, 2, 10664 },
+  { "xkb", 1, 2, 10672 },
+  { "xkc", 1, 2, 10687 },
+  { "xkd", 1, 2, 10695 },
+  { "xke", 1, 2, 10711 },
+  { "xkf", 1, 2, 10718 },
+  { "xkg", 1, 2, 10727 },
+  { "xki", 1, 2, 10734 },
+  { "xkj", 1, 2, 10755 },
+  { "xkk", 1, 2, 10762 },
+  { "xkl", 1, 2, 10769 },
+  { "xkn", 1, 2, 10787 },
+  { "xko", 1, 2, 10806 },
+  { "xkp", 1, 2, 10812 },
+  { "xkq", 1, 2, 10820 },
+  { "xkr", 1, 2, 10827 },
+  { "xks", 1, 2, 10837 },
+  { "xkt", 1, 2, 10847 },
+  { "xku", 1, 2, 10855 },
+  { "xkv", 1, 2, 10862 },
+  { "xkw", 1, 2, 10872 },
+  { "xkx", 1, 2, 10879 },
+  { "xky", 1, 2, 10886 },
+  { "xkz", 1, 2, 10897 },
+  { "xla", 1, 2, 10906 },
+  { "xlb", 1, 2, 10913 },
+  { "xlc", 1, 2, 10920 },
+  { "xld", 1, 2, 10927 },
+  { "xle", 1, 2, 10934 },
+  { "xlg", 1, 2, 10942 },
+  { "xli", 1, 2, 10961 },
+  { "xln", 1, 2, 10971 },
+  { "xlo", 1, 2, 10978 },
+  { "xlp", 1, 2, 10985 },
+  { "xls", 1, 2, 10994 },
+  { "xlu", 1, 2, 11005 },
+  { "xly", 1, 2, 11023 },
+  { "xma", 1, 2, 11031 },
+  { "xmb", 1, 2, 11042 },
+  { "xmc", 1, 2, 11049 },
+  { "xmd", 1, 2, 11067 },
+  { "xme", 1, 2, 11074 },
+  { "xmf", 1, 2, 11081 },
+  { "xmg", 1, 2, 11092 },
+  { "xmh", 1, 2, 11100 },
+  { "xmj", 1, 2, 11112 },
+  { "xmk", 1, 2, 11119 },
+  { "xml", 1, 2, 11139 },
+  { "xmm", 1, 2, 11163 },
+  { "xmn", 1, 2, 11177 },
+  { "xmo", 1, 2, 11204 },
+  { "xmp", 1, 2, 11213 },
+  { "xmq", 1, 2, 11225 },
+  { "xmr", 1, 2, 11236 },
+  { "xms", 1, 2, 11245 },
+  { "xmt", 1, 2, 11268 },
+  { "xmu", 1, 2, 11275 },
+  { "xmv", 1, 2, 11280 },
+  { "xmw", 1, 2, 11302 },
+  { "xmx", 1, 2, 11322 },
+  { "xmy", 1, 2, 11331 },
+  { "xmz", 1, 2, 11342 },
+  { "xna", 1, 2, 11353 },
+  { "xnb", 1, 2, 11376 },
+  { "xng", 1, 2, 11387 },
+  { "xnh", 1, 2, 11405 },
+  { "xni", 1, 2, 11413 },
+  { "xnj", 1, 2, 11421 },
+  { "xnk", 1, 2, 11438 },
+  { "xnm", 1, 2, 11449 },
+  { "xnn", 1, 2, 11458 },
+  { "xno", 1, 2, 11477 },
+  { "xnq", 1, 2, 11490 },
+  { "xnr", 1, 2, 11509 },
+  { "xns", 1, 2, 11516 },
+  { "xnt", 1, 2, 11524 },
+  { "xnu", 1, 2, 11537 },
+  { "xny", 1, 2, 11545 },
+  { "xnz", 1, 2, 11556 },
+  { "xoc", 1, 2, 11562 },
+  { "xod", 1, 2, 11573 },
+  { "xog", 1, 2, 11580 },
+  { "xoi", 1, 2, 11585 },
+  { "xok", 1, 2, 11596 },
+  { "xom", 1, 2, 11604 },
+  { "xon", 1, 2, 11617 },
+  { "xoo", 1, 2, 11626 },
+  { "xop", 1, 2, 11634 },
+  { "xor", 1, 2, 11640 },
+  { "xow", 1, 2, 11647 },
+  { "xpa", 1, 2, 11654 },
+  { "xpb", 1, 2, 11662 },
+  { "xpc", 1, 2, 11686 },
+  { "xpd", 1, 2, 11695 },
+  { "xpe", 1, 2, 11717 },
+  { "xpf", 1, 2, 11733 },
+  { "xpg", 1, 2, 11754 },
+  { "xph", 1, 2, 11763 },
+  { "xpi", 1, 2, 11789 },
+  { "xpj", 1, 2, 11797 },
+  { "xpk", 1, 2, 11808 },
+  { "xpl", 1, 2, 11821 },
+  { "xpm", 1, 2, 11844 },
+  { "xpn", 1, 2, 11853 },
+  { "xpo", 1, 2, 11863 },
+  { "xpp", 1, 2, 11872 },
+  { "xpq", 1, 2, 11885 },
+  { "xpr", 1, 2, 11900 },
+  { "xps", 1, 2, 11909 },
+  { "xpt", 1, 2, 11918 },
+  { "xpu", 1, 2, 11929 },
+  { "xpv", 1, 2, 11935 },
+  { "xpw", 1, 2, 11955 },
+  { "xpx", 1, 2, 11979 },
+  { "xpy", 1, 2, 12003 },
+  { "xpz", 1, 2, 12008 },
+  { "xqa", 1, 2, 12032 },
+  { "xqt", 1, 2, 12043 },
+  { "xra", 1, 2, 12054 },
+  { "xrb", 1, 2, 12061 },
+  { "xrd", 1, 2, 12079 },
+  { "xre", 1, 2, 12091 },
+  { "xrg", 1, 2, 12097 },
+  { "xri", 1, 2, 12104 },
+  { "xrm", 1, 2, 12120 },
+  { "xrn", 1, 2, 12128 },
+  { "xrr", 1, 2, 12133 },
+  { "xrt", 1, 2, 12140 },
+  { "xru", 1, 2, 12156 },
+  { "xrw", 1, 2, 12166 },
+  { "xsa", 1, 2, 12173 },
+  { "xsb", 1, 2, 12181 },
+  { "xsc", 1, 2, 12188 },
+  { "xsd", 1, 2, 12197 },
+  { "xse", 1, 2, 12205 },
+  { "xsh", 1, 2, 12212 },
+  { "xsi", 1, 2, 12220 },
+  { "xsj", 1, 2, 12224 },
+  { "xsl", 1, 2, 12229 },
+  { "xsm", 1, 2, 12243 },
+  { "xsn", 1, 2, 12249 },
+  { "xso", 1, 2, 12265 },
+  { "xsp", 1, 2, 12272 },
+  { "xsq", 1, 2, 12279 },
+  { "xsr", 1, 2, 12292 },
+  { "xss", 1, 2, 12299 },
+  { "xsu", 1, 2, 12305 },
+  { "xsv", 1, 2, 12313 },
+  { "xsy", 1, 2, 12322 },
+  { "xta", 1, 2, 12331 },
+  { "xtb", 1, 2, 12349 },
+  { "xtc", 1, 2, 12366 },
+  { "xtd", 1, 2, 12386 },
+  { "xte", 1, 2, 12411 },
+  { "xtg", 1, 2, 12421 },
+  { "xth", 1, 2, 12442 },
+  { "xti", 1, 2, 12454 },
+  { "xtj", 1, 2, 12472 },
+  { "xtl", 1, 2, 12495 },
+  { "xtm", 1, 2, 12514 },
+  { "xtn", 1, 2, 12541 },
+  { "xto", 1, 2, 12567 },
+  { "xtp", 1, 2, 12579 },
+  { "xtq", 1, 2, 12606 },
+  { "xtr", 1, 2, 12617 },
+  { "xts", 1, 2, 12632 },
+  { "xtt", 1, 2, 12649 },
+  { "xtu", 1, 2, 12665 },
+  { "xtv", 1, 2, 12685 },
+  { "xtw", 1, 2, 12691 },
+  { "xty", 1, 2, 12700 },
+  { "xua", 1, 2, 12720 },
+  { "xub", 1, 2, 12733 },
+  { "xud", 1, 2, 12748 },
+  { "xug", 1, 2, 12755 },
+  { "xuj", 1, 2, 12764 },
+  { "xul", 1, 2, 12779 },
+  { "xum", 1, 2, 12788 },
+  { "xun", 1, 2, 12796 },
+  { "xuo", 1, 2, 12808 },
+  { "xup", 1, 2, 12812 },
+  { "xur", 1, 2, 12826 },
+  { "xut", 1, 2, 12835 },
+  { "xuu", 1, 2, 12843 },
+  { "xve", 1, 2, 12848 },
+  { "xvi", 1, 2, 12856 },
+  { "xvn", 1, 2, 12864 },
+  { "xvo", 1, 2, 12873 },
+  { "xvs", 1, 2, 12882 },
+  { "xwa", 1, 2, 12892 },
+  { "xwc", 1, 2, 12898 },
+  { "xwd", 1, 2, 12905 },
+  { "xwe", 1, 2, 12915 },
+  { "xwg", 1, 2, 12926 },
+  { "xwj", 1, 2, 12932 },
+  { "xwk", 1, 2, 12938 },
+  { "xwl", 1, 2, 12949 },
+  { "xwo", 1, 2, 12967 },
+  { "xwr", 1, 2, 12982 },
+  { "xwt", 1, 2, 12999 },
+  { "xww", 1, 2, 13010 },
+  { "xxb", 1, 2, 13022 },
+  { "xxk", 1, 2, 13035 },
+  { "xxm", 1, 2, 13040 },
+  { "xxr", 1, 2, 13047 },
+  { "xxt", 1, 2, 13055 },
+  { "xya", 1, 2, 13063 },
+  { "xyb", 1, 2, 13070 },
+  { "xyj", 1, 2, 13081 },
+  { "xyk", 1, 2, 13091 },
+  { "xyl", 1, 2, 13102 },
+  { "xyt", 1, 2, 13113 },
+  { "xyy", 1, 2, 13127 },
+  { "xzh", 1, 2, 13139 },
+  { "xzm", 1, 2, 13151 },
+  { "xzp", 1, 2, 13161 },
+  { "yaa", 1, 2, 13178 },
+  { "yab", 1, 2, 13188 },
+  { "yac", 1, 2, 13194 },
+  { "yad", 1, 2, 13212 },
+  { "yae", 1, 2, 13218 },
+  { "yaf", 1, 2, 13224 },
+  { "yag", 1, 2, 13260 },
+  { "yah", 1, 2, 13268 },
+  { "yai", 1, 2, 13278 },
+  { "yaj", 1, 2, 13286 },
+  { "yak", 1, 2, 13300 },
+  { "yal", 1, 2, 13307 },
+  { "yam", 1, 2, 13315 },
+  { "yan", 1, 2, 13321 },
+  { "yao", 1, 2, 13330 },
+  { "yap", 1, 2, 13334 },
+  { "yaq", 1, 2, 13341 },
+  { "yar", 1, 2, 13347 },
+  { "yas", 1, 2, 13356 },
+  { "yat", 1, 2, 13374 },
+  { "yau", 1, 2, 13382 },
+  { "yav", 1, 2, 13389 },
+  { "yaw", 1, 2, 13397 },
+  { "yax", 1, 2, 13409 },
+  { "yay", 1, 2, 13415 },
+  { "yaz", 1, 2, 13425 },
+  { "yba", 1, 2, 13431 },
+  { "ybb", 1, 2, 13436 },
+  { "ybe", 1, 2, 13442 },
+  { "ybh", 1, 2, 13454 },
+  { "ybi", 1, 2, 13460 },
+  { "ybj", 1, 2, 13467 },
+  { "ybk", 1, 2, 13473 },
+  { "ybl", 1, 2, 13479 },
+  { "ybm", 1, 2, 13487 },
+  { "ybn", 1, 2, 13493 },
+  { "ybo", 1, 2, 13502 },
+  { "ybx", 1, 2, 13509 },
+  { "yby", 1, 2, 13516 },
+  { "ych", 1, 2, 13525 },
+  { "ycl", 1, 2, 13531 },
+  { "ycn", 1, 2, 13538 },
+  { "ycp", 1, 2, 13545 },
+  { "yda", 1, 2, 13552 },
+  { "ydd", 1, 2, 13558 },
+  { "yde", 1, 2, 13575 },
+  { "ydg", 1, 2, 13586 },
+  { "ydk", 1, 2, 13593 },
+  { "yea", 1, 2, 13600 },
+  { "yec", 1, 2, 13607 },
+  { "yee", 1, 2, 13615 },
+  { "yei", 1, 2, 13621 },
+  { "yej", 1, 2, 13626 },
+  { "yel", 1, 2, 13634 },
+  { "yer", 1, 2, 13639 },
+  { "yes", 1, 2, 13645 },
+  { "yet", 1, 2, 13653 },
+  { "yeu", 1, 2, 13659 },
+  { "yev", 1, 2, 13668 },
+  { "yey", 1, 2, 13676 },
+  { "yga", 1, 2, 13681 },
+  { "ygi", 1, 2, 13692 },
+  { "ygl", 1, 2, 13702 },
+  { "ygm", 1, 2, 13713 },
+  { "ygp", 1, 2, 13720 },
+  { "ygr", 1, 2, 13725 },
+  { "ygs", 1, 2, 13733 },
+  { "ygu", 1, 2, 13754 },
+  { "ygw", 1, 2, 13760 },
+  { "yha", 1, 2, 13768 },
+  { "yhd", 1, 2, 13781 },
+  { "yhl", 1, 2, 13801 },
+  { "yhs", 1, 2, 13815 },
+  { "yi", 0, 2, 13840 },
+  { "yia", 1, 2, 13848 },
+  { "yid", 1, 2, 13840 },
+  { "yif", 1, 2, 13858 },
+  { "yig", 1, 2, 13863 },
+  { "yih", 1, 2, 13874 },
+  { "yii", 1, 2, 13891 },
+  { "yij", 1, 2, 13898 },
+  { "yik", 1, 2, 13911 },
+  { "yil", 1, 2, 13928 },
+  { "yim", 1, 2, 13941 },
+  { "yin", 1, 2, 13958 },
+  { "yip", 1, 2, 13968 },
+  { "yiq", 1, 2, 13974 },
+  { "yir", 1, 2, 13980 },
+  { "yis", 1, 2, 13992 },
+  { "yit", 1, 2, 13996 },
+  { "yiu", 1, 2, 14010 },
+  { "yiv", 1, 2, 14014 },
+  { "yix", 1, 2, 14029 },
+  { "yiz", 1, 2, 14037 },
+  { "yka", 1, 2, 14042 },
+  { "ykg", 1, 2, 14048 },
+  { "yki", 1, 2, 14067 },
+  { "ykk", 1, 2, 14072 },
+  { "ykl", 1, 2, 14082 },
+  { "ykm", 1, 2, 14089 },
+  { "ykn", 1, 2, 14093 },
+  { "yko", 1, 2, 14101 },
+  { "ykr", 1, 2, 14106 },
+  { "ykt", 1, 2, 14113 },
+  { "yku", 1, 2, 14119 },
+  { "yky", 1, 2, 14127 },
+  { "yla", 1, 2, 14134 },
+  { "ylb", 1, 2, 14139 },
+  { "yle", 1, 2, 14146 },
+  { "ylg", 1, 2, 14151 },
+  { "yli", 1, 2, 14158 },
+  { "yll", 1, 2, 14173 },
+  { "ylm", 1, 2, 14177 },
+  { "yln", 1, 2, 14182 },
+  { "ylo", 1, 2, 14199 },
+  { "ylr", 1, 2, 14209 },
+  { "ylu", 1, 2, 14219 },
+  { "yly", 1, 2, 14229 },
+  { "ymb", 1, 2, 14238 },
+  { "ymc", 1, 2, 14245 },
+  { "ymd", 1, 2, 14260 },
+  { "yme", 1, 2, 14265 },
+  { "ymg", 1, 2, 14271 },
+  { "ymh", 1, 2, 14281 },
+  { "ymi", 1, 2, 14286 },
+  { "ymk", 1, 2, 14291 },
+  { "yml", 1, 2, 14297 },
+  { "ymm", 1, 2, 14306 },
+  { "ymn", 1, 2, 14311 },
+  { "ymo", 1, 2, 14317 },
+  { "ymp", 1, 2, 14328 },
+  { "ymq", 1, 2, 14334 },
+  { "ymr", 1, 2, 14345 },
+  { "yms", 1, 2, 14353 },
+  { "ymx", 1, 2, 14360 },
+  { "ymz", 1, 2, 14375 },
+  { "yna", 1, 2, 14380 },
+  { "ynd", 1, 2, 14385 },
+  { "yne", 1, 2, 14398 },
+  { "yng", 1, 2, 14405 },
+  { "ynk", 1, 2, 14411 },
+  { "ynl", 1, 2, 14425 },
+  { "ynn", 1, 2, 14434 },
+  { "yno", 1, 2, 14439 },
+  { "ynq", 1, 2, 14444 },
+  { "yns", 1, 2, 14452 },
+  { "ynu", 1, 2, 14458 },
+  { "yo", 0, 2, 14465 },
+  { "yob", 1, 2, 14472 },
+  { "yog", 1, 2, 14477 },
+  { "yoi", 1, 2, 14483 },
+  { "yok", 1, 2, 14492 },
+  { "yol", 1, 2, 14499 },
+  { "yom", 1, 2, 14504 },
+  { "yon", 1, 2, 14510 },
+  { "yor", 1, 2, 14465 },
+  { "yot", 1, 2, 14518 },
+  { "yox", 1, 2, 14524 },
+  { "yoy", 1, 2, 14530 },
+  { "ypa", 1, 2, 14534 },
+  { "ypb", 1, 2, 14540 },
+  { "ypg", 1, 2, 14552 },
+  { "yph", 1, 2, 14558 },
+  { "ypk", 0, 2, 14565 },
+  { "ypm", 1, 2, 14581 },
+  { "ypn", 1, 2, 14587 },
+  { "ypo", 1, 2, 14598 },
+  { "ypp", 1, 2, 14609 },
+  { "ypz", 1, 2, 14615 },
+  { "yra", 1, 2, 14621 },
+  { "yrb", 1, 2, 14629 },
+  { "yre", 1, 2, 14636 },
+  { "yrk", 1, 2, 14644 },
+  { "yrl", 1, 2, 14651 },
+  { "yrm", 1, 2, 14660 },
+  { "yrn", 1, 2, 14670 },
+  { "yro", 1, 2, 14677 },
+  { "yrs", 1, 2, 14686 },
+  { "yrw", 1, 2, 14693 },
+  { "yry", 1, 2, 14702 },
+  { "ysc", 1, 2, 14713 },
+  { "ysd", 1, 2, 14720 },
+  { "ysg", 1, 2, 14728 },
+  { "ysl", 1, 2, 14735 },
+  { "ysm", 1, 2, 14761 },
+  { "ysn", 1, 2, 14783 },
+  { "yso", 1, 2, 14788 },
+  { "ysp", 1, 2, 14801 },
+  { "ysr", 1, 2, 14818 },
+  { "yss", 1, 2, 14833 },
+  { "ysy", 1, 2, 14845 },
+  { "yta", 1, 2, 14851 },
+  { "ytl", 1, 2, 14856 },
+  { "ytp", 1, 2, 14865 },
+  { "ytw", 1, 2, 14872 },
+  { "yty", 1, 2, 14881 },
+  { "yua", 1, 2, 14887 },
+  { "yub", 1, 2, 14896 },
+  { "yuc", 1, 2, 14905 },
+  { "yud", 1, 2, 14911 },
+  { "yue", 1, 2, 14939 },
+  { "yuf", 1, 2, 14952 },
+  { "yug", 1, 2, 14978 },
+  { "yui", 1, 2, 14982 },
+  { "yuj", 1, 2, 14990 },
+  { "yuk", 1, 2, 15002 },
+  { "yul", 1, 2, 15007 },
+  { "yum", 1, 2, 15012 },
+  { "yun", 1, 2, 15020 },
+  { "yup", 1, 2, 15035 },
+  { "yuq", 1, 2, 15041 },
+  { "yur", 1, 2, 15047 },
+  { "yut", 1, 2, 15053 },
+  { "yuw", 1, 2, 15059 },
+  { "yux", 1, 2, 15081 },
+  { "yuy", 1, 2, 15100 },
+  { "yuz", 1, 2, 15112 },
+  { "yva", 1, 2, 15121 },
+  { "yvt", 1, 2, 15126 },
+  { "ywa", 1, 2, 15135 },
+  { "ywg", 1, 2, 15141 },
+  { "ywl", 1, 2, 15153 },
+  { "ywn", 1, 2, 15167 },
+  { "ywq", 1, 2, 15176 },
+  { "ywr", 1, 2, 15194 },
+  { "ywt", 1, 2, 15201 },
+  { "ywu", 1, 2, 15216 },
+  { "yww", 1, 2, 15229 },
+  { "yxa", 1, 2, 15241 },
+  { "yxg", 1, 2, 15250 },
+  { "yxl", 1, 2, 15257 },
+  { "yxm", 1, 2, 15271 },
+  { "yxu", 1, 2, 15278 },
+  { "yxy", 1, 2, 15283 },
+  { "yyr", 1, 2, 15297 },
+  { "yyu", 1, 2, 15308 },
+  { "yyz", 1, 2, 15331 },
+  { "yzg", 1, 2, 15337 },
+  { "yzk", 1, 2, 15350 },
+  { "za", 0, 2, 15357 },
+  { "zaa", 1, 2, 15372 },
+  { "zab", 1, 2, 15399 },
+  { "zac", 1, 2, 15433 },
+  { "zad", 1, 2, 15451 },
+  { "zae", 1, 2, 15468 },
+  { "zaf", 1, 2, 15484 },
+  { "zag", 1, 2, 15503 },
+  { "zah", 1, 2, 15511 },
+  { "zai", 1, 2, 15519 },
+  { "zaj", 1, 2, 15536 },
+  { "zak", 1, 2, 15543 },
+  { "zal", 1, 2, 15550 },
+  { "zam", 1, 2, 15557 },
+  { "zao", 1, 2, 15578 },
+  { "zap", 1, 2, 15598 },
+  { "zaq", 1, 2, 15606 },
+  { "zar", 1, 2, 15624 },
+  { "zas", 1, 2, 15641 },
+  { "zat", 1, 2, 15675 },
+  { "zau", 1, 2, 15690 },
+  { "zav", 1, 2, 15700 },
+  { "zaw", 1, 2, 15718 },
+  { "zax", 1, 2, 15733 },
+  { "zay", 1, 2, 15749 },
+  { "zaz", 1, 2, 15764 },
+  { "zba", 1, 2, 15769 },
+  { "zbc", 1, 2, 15780 },
+  { "zbe", 1, 2, 15797 },
+  { "zbl", 1, 2, 15811 },
+  { "zbt", 1, 2, 15823 },
+  { "zbu", 1, 2, 15829 },
+  { "zbw", 1, 2, 15847 },
+  { "zca", 1, 2, 15861 },
+  { "zcd", 1, 2, 15885 },
+  { "zch", 1, 2, 15907 },
+  { "zdj", 1, 2, 15934 },
+  { "zea", 1, 2, 15953 },
+  { "zeg", 1, 2, 15960 },
+  { "zeh", 1, 2, 15966 },
+  { "zen", 1, 2, 15993 },
+  { "zga", 1, 2, 16000 },
+  { "zgb", 1, 2, 16006 },
+  { "zgh", 1, 2, 16021 },
+  { "zgm", 1, 2, 16050 },
+  { "zgn", 1, 2, 16063 },
+  { "zgr", 1, 2, 16079 },
+  { "zh", 0, 0, 12579 },
+  { "zha", 1, 2, 16086 },
+  { "zhb", 1, 2, 16093 },
+  { "zhd", 1, 2, 16099 },
+  { "zhi", 1, 2, 16111 },
+  { "zhn", 1, 2, 16117 },
+  { "zho", 1, 0, 12579 },
+  { "zhw", 1, 2, 16130 },
+  { "zia", 1, 2, 16135 },
+  { "zib", 1, 2, 16139 },
+  { "zik", 1, 2, 16162 },
+  { "zil", 1, 2, 16171 },
+  { "zim", 1, 2, 16177 },
+  { "zin", 1, 2, 16183 },
+  { "ziw", 1, 2, 16189 },
+  { "ziz", 1, 2, 16196 },
+  { "zka", 1, 2, 16208 },
+  { "zkb", 1, 2, 16219 },
+  { "zkd", 1, 2, 16226 },
+  { "zkg", 1, 2, 16231 },
+  { "zkh", 1, 2, 16239 },
+  { "zkk", 1, 2, 16250 },
+  { "zkn", 1, 2, 16260 },
+  { "zko", 1, 2, 16266 },
+  { "zkp", 1, 2, 16271 },
+  { "zkr", 1, 2, 16293 },
+  { "zkt", 1, 2, 16302 },
+  { "zku", 1, 2, 16308 },
+  { "zkv", 1, 2, 16315 },
+  { "zkz", 1, 2, 16325 },
+  { "zla", 1, 2, 16332 },
+  { "zlj", 1, 2, 16337 },
+  { "zlm", 1, 2, 16354 },
+  { "zln", 1, 2, 16382 },
+  { "zlq", 1, 2, 16399 },
+  { "zma", 1, 2, 16415 },
+  { "zmb", 1, 2, 16433 },
+  { "zmc", 1, 2, 16439 },
+  { "zmd", 1, 2, 16447 },
+  { "zme", 1, 2, 16455 },
+  { "zmf", 1, 2, 16463 },
+  { "zmg", 1, 2, 16469 },
+  { "zmh", 1, 2, 16478 },
+  { "zmi", 1, 2, 16487 },
+  { "zmj", 1, 2, 16509 },
+  { "zmk", 1, 2, 16520 },
+  { "zml", 1, 2, 16532 },
+  { "zmm", 1, 2, 16541 },
+  { "zmn", 1, 2, 16554 },
+  { "zmo", 1, 2, 16562 },
+  { "zmp", 1, 2, 16567 },
+  { "zmq", 1, 2, 16574 },
+  { "zmr", 1, 2, 16581 },
+  { "zms", 1, 2, 16592 },
+  { "zmt", 1, 2, 16598 },
+  { "zmu", 1, 2, 16608 },
+  { "zmv", 1, 2, 16617 },
+  { "zmw", 1, 2, 16635 },
+  { "zmx", 1, 2, 16670 },
+  { "zmy", 1, 2, 16679 },
+  { "zmz", 1, 2, 16688 },
+  { "zna", 1, 2, 16696 },
+  { "znd", 0, 2, 16705 },
+  { "zne", 1, 2, 16721 },
+  { "zng", 1, 2, 16749 },
+  { "znk", 1, 2, 16754 },
+  { "zns", 1, 2, 16765 },
+  { "zoc", 1, 2, 16772 },
+  { "zoh", 1, 2, 16790 },
+  { "zom", 1, 2, 16807 },
+  { "zoo", 1, 2, 16811 },
+  { "zoq", 1, 2, 16839 },
+  { "zor", 1, 2, 16854 },
+  { "zos", 1, 2, 16868 },
+  { "zpa", 1, 2, 16891 },
+  { "zpb", 1, 2, 16911 },
+  { "zpc", 1, 2, 16929 },
+  { "zpd", 1, 2, 16946 },
+  { "zpe", 1, 2, 16976 },
+  { "zpf", 1, 2, 16992 },
+  { "zpg", 1, 2, 17020 },
+  { "zph", 1, 2, 17048 },
+  { "zpi", 1, 2, 17070 },
+  { "zpj", 1, 2, 17103 },
+  { "zpk", 1, 2, 17124 },
+  { "zpl", 1, 2, 17145 },
+  { "zpm", 1, 2, 17164 },
+  { "zpn", 1, 2, 17182 },
+  { "zpo", 1, 2, 17212 },
+  { "zpp", 1, 2, 17230 },
+  { "zpq", 1, 2, 17247 },
+  { "zpr", 1, 2, 17265 },
+  { "zps", 1, 2, 17290 },
+  { "zpt", 1, 2, 17308 },
+  { "zpu", 1, 2, 17338 },
+  { "zpv", 1, 2, 17356 },
+  { "zpw", 1, 2, 17377 },
+  { "zpx", 1, 2, 17393 },
+  { "zpy", 1, 2, 17423 },
+  { "zpz", 1, 2, 17443 },
+  { "zqe", 1, 2, 17463 },
+  { "zra", 1, 2, 17478 },
+  { "zrg", 1, 2, 17491 },
+  { "zrn", 1, 2, 17498 },
+  { "zro", 1, 2, 17507 },
+  { "zrp", 1, 2, 17515 },
+  { "zrs", 1, 2, 17525 },
+  { "zsa", 1, 2, 17533 },
+  { "zsk", 1, 2, 17542 },
+  { "zsl", 1, 2, 17550 },
+  { "zsm", 1, 2, 17572 },
+  { "zsr", 1, 2, 17588 },
+  { "zsu", 1, 2, 17613 },
+  { "zte", 1, 2, 17621 },
+  { "ztg", 1, 2, 17639 },
+  { "ztl", 1, 2, 17658 },
+  { "ztm", 1, 2, 17685 },
+  { "ztn", 1, 2, 17716 },
+  { "ztp", 1, 2, 17751 },
+  { "ztq", 1, 2, 17768 },
+  { "zts", 1, 2, 17797 },
+  { "ztt", 1, 2, 17817 },
+  { "ztu", 1, 2, 17836 },
+  { "ztx", 1, 2, 17853 },
+  { "zty", 1, 2, 17871 },
+  { "zu", 0, 2, 17886 },
+  { "zua", 1, 2, 17891 },
+  { "zuh", 1, 2, 17896 },
+  { "zul", 1, 2, 17886 },
+  { "zum", 1, 2, 17903 },
+  { "zun", 1, 2, 17911 },
+  { "zuy", 1, 2, 17916 },
+  { "zwa", 1, 2, 17923 },
+  { "zxx", 1, 2, 17927 },
+  { "zyb", 1, 2, 17949 },
+  { "zyg", 1, 2, 17965 },
+  { "zyj", 1, 2, 17978 },
+  { "zyn", 1, 2, 17995 },
+  { "zyp", 1, 2, 18011 },
+  { "zza", 1, 2, 18023 },
+  { "zzj", 1, 2, 18028 },
+};
@@ -34,85 +34,116 @@
 #include "gdkpixbufutilsprivate.h"
 
 static gchar *output_dir = NULL;
+static gchar *manifest = NULL;
+static gint n_jobs = 0;
 
 static GOptionEntry args[] = {
   { "output", 'o', 0, G_OPTION_ARG_FILENAME, &output_dir, N_("Output to this directory instead of cwd"), NULL },
+  { "manifest", 'm', 0, G_OPTION_ARG_FILENAME, &manifest, N_("Encode the icons listed in this file"), N_("FILE") },
+  { "jobs", 'j', 0, G_OPTION_ARG_INT, &n_jobs, N_("Number of icons to encode in parallel"), N_("N") },
   { NULL }
 };
 
-int
-main (int argc, char **argv)
-{
-  gchar *path, *basename, *pngpath, *pngfile, *dot;
-  GOptionContext *context;
-  GdkPixbuf *symbolic;
-  GError *error;
-  int width, height;
-  gchar **sizev;
-  GFileOutputStream *out;
-  GFile *dest;
-  char *data;
-  gsize len;
+/* The hash of the svg and the size an icon was encoded from, it lets
+ * batch mode skip icons that are already up to date */
+#define HASH_OPTION "tEXt::gtk-symbolic-hash"
 
-  setlocale (LC_ALL, "");
+typedef struct {
+  gchar *path;
+  gchar *dir;
+  int width;
+  int height;
+} Job;
 
-#ifdef ENABLE_NLS
-  bindtextdomain (GETTEXT_PACKAGE, GTK_LOCALEDIR);
-#ifdef HAVE_BIND_TEXTDOMAIN_CODESET
-  bind_textdomain_codeset (GETTEXT_PACKAGE, "UTF-8");
-#endif
-#endif
+static gint n_failed = 0;
 
-  g_set_prgname ("gtk-encode-symbolic-svg");
-
-  context = g_option_context_new ("PATH WIDTHxHEIGHT");
-  g_option_context_add_main_entries (context, args, GETTEXT_PACKAGE);
-
-  g_option_context_parse (context, &argc, &argv, NULL);
-
-  if (argc < 3)
-    {
-      g_printerr ("%s\n", g_option_context_get_help (context, FALSE, NULL));
-      return 1;
-    }
+static gboolean
+parse_size (const char *str,
+            int        *width,
+            int        *height)
+{
+  gchar **sizev;
 
-  width = 0;
-  height = 0;
-  sizev = g_strsplit (argv[2], "x", 0);
+  *width = 0;
+  *height = 0;
+  sizev = g_strsplit (str, "x", 0);
   if (g_strv_length (sizev) == 2)
     {
-      width = atoi(sizev[0]);
-      height = atoi(sizev[1]);
+      *width = atoi(sizev[0]);
+      *height = atoi(sizev[1]);
     }
   g_strfreev (sizev);
 
-  if (width == 0 || height == 0)
+  if (*width == 0 || *height == 0)
     {
-      g_printerr (_("Invalid size %s\n"), argv[2]);
-      return 1;
+      g_printerr (_("Invalid size %s\n"), str);
+      return FALSE;
     }
 
-  path = argv[1];
-#ifdef G_OS_WIN32
-  path = g_locale_to_utf8 (path, -1, NULL, NULL, NULL);
-#endif
+  return TRUE;
+}
+
+static gchar *
+compute_hash (const char *data,
+              gsize       len,
+              int         width,
+              int         height)
+{
+  GChecksum *checksum;
+  gchar *size;
+  gchar *hash;
+
+  checksum = g_checksum_new (G_CHECKSUM_SHA256);
+  g_checksum_update (checksum, (const guchar *) data, len);
+  size = g_strdup_printf ("%dx%d", width, height);
+  g_checksum_update (checksum, (const guchar *) size, -1);
+  hash = g_strdup (g_checksum_get_string (checksum));
+  g_checksum_free (checksum);
+  g_free (size);
+
+  return hash;
+}
+
+static gboolean
+is_up_to_date (const char *pngpath,
+               const char *hash)
+{
+  GdkPixbuf *pixbuf;
+  gboolean result;
+
+  pixbuf = gdk_pixbuf_new_from_file (pngpath, NULL);
+  if (pixbuf == NULL)
+    return FALSE;
+
+  result = g_strcmp0 (gdk_pixbuf_get_option (pixbuf, HASH_OPTION), hash) == 0;
+  g_object_unref (pixbuf);
+
+  return result;
+}
+
+static gboolean
+encode_symbolic (const char *path,
+                 int         width,
+                 int         height,
+                 const char *dir,
+                 gboolean    skip_unchanged)
+{
+  gchar *basename, *pngpath, *pngfile, *dot, *hash;
+  GdkPixbuf *symbolic;
+  GError *error;
+  GFileOutputStream *out;
+  GFile *dest;
+  char *data;
+  gsize len;
 
   error = NULL;
   if (!g_file_get_contents (path, &data, &len, &error))
     {
       g_printerr (_("Can’t load file: %s\n"), error->message);
-      return 1;
+      g_error_free (error);
+      return FALSE;
     }
 
-  symbolic = gtk_make_symbolic_pixbuf_from_data (data, len, width, height, 1.0, &error);
-  if (symbolic == NULL)
-    {
-      g_printerr (_("Can’t load file: %s\n"), error->message);
-      return 1;
-    }
-
-  g_free (data);
-
   basename = g_path_get_basename (path);
 
   dot = strrchr (basename, '.');
@@ -121,40 +152,211 @@ main (int argc, char **argv)
   pngfile = g_strconcat (basename, ".symbolic.png", NULL);
   g_free (basename);
 
-  if (output_dir != NULL)
-    pngpath = g_build_filename (output_dir, pngfile, NULL);
+  if (dir != NULL)
+    pngpath = g_build_filename (dir, pngfile, NULL);
   else
     pngpath = g_strdup (pngfile);
 
   g_free (pngfile);
 
-  dest = g_file_new_for_path (pngpath);
+  hash = compute_hash (data, len, width, height);
 
+  if (skip_unchanged && is_up_to_date (pngpath, hash))
+    {
+      g_free (hash);
+      g_free (pngpath);
+      g_free (data);
+      return TRUE;
+    }
+
+  symbolic = gtk_make_symbolic_pixbuf_from_data (data, len, width, height, 1.0, &error);
+  g_free (data);
+  if (symbolic == NULL)
+    {
+      g_printerr (_("Can’t load file: %s\n"), error->message);
+      g_error_free (error);
+      g_free (hash);
+      g_free (pngpath);
+      return FALSE;
+    }
+
+  dest = g_file_new_for_path (pngpath);
 
   out = g_file_replace (dest,
 			NULL, FALSE,
 			G_FILE_CREATE_REPLACE_DESTINATION,
 			NULL, &error);
+  g_object_unref (dest);
   if (out == NULL)
     {
       g_printerr (_("Can’t save file %s: %s\n"), pngpath, error->message);
-      return 1;
+      g_error_free (error);
+      g_object_unref (symbolic);
+      g_free (hash);
+      g_free (pngpath);
+      return FALSE;
     }
 
-  if (!gdk_pixbuf_save_to_stream (symbolic, G_OUTPUT_STREAM (out), "png", NULL, &error, NULL))
+  if (!gdk_pixbuf_save_to_stream (symbolic, G_OUTPUT_STREAM (out), "png", NULL, &error,
+                                  HASH_OPTION, hash,
+                                  NULL))
     {
       g_printerr (_("Can’t save file %s: %s\n"), pngpath, error->message);
-      return 1;
+      g_error_free (error);
+      g_object_unref (out);
+      g_object_unref (symbolic);
+      g_free (hash);
+      g_free (pngpath);
+      return FALSE;
     }
 
+  g_object_unref (symbolic);
+  g_free (hash);
+
   if (!g_output_stream_close (G_OUTPUT_STREAM (out), NULL, &error))
     {
       g_printerr (_("Can’t close stream"));
-      return 1;
+      g_error_free (error);
+      g_object_unref (out);
+      g_free (pngpath);
+      return FALSE;
     }
 
   g_object_unref (out);
   g_free (pngpath);
 
+  return TRUE;
+}
+
+static void
+job_free (Job *job)
+{
+  g_free (job->path);
+  g_free (job->dir);
+  g_slice_free (Job, job);
+}
+
+static void
+encode_job (gpointer data,
+            gpointer user_data)
+{
+  Job *job = data;
+
+  if (!encode_symbolic (job->path, job->width, job->height, job->dir, TRUE))
+    g_atomic_int_inc (&n_failed);
+
+  job_free (job);
+}
+
+/* Each line of the manifest is "PATH WIDTHxHEIGHT [DIR]", quoted like
+ * in the shell. DIR defaults to the --output directory. Empty lines and
+ * lines starting with # are ignored. */
+static int
+encode_manifest (const char *filename)
+{
+  GThreadPool *pool;
+  GError *error;
+  gchar **lines;
+  char *data;
+  guint i;
+
+  error = NULL;
+  if (!g_file_get_contents (filename, &data, NULL, &error))
+    {
+      g_printerr (_("Can’t load file: %s\n"), error->message);
+      g_error_free (error);
+      return 1;
+    }
+
+  lines = g_strsplit (data, "\n", -1);
+  g_free (data);
+
+  if (n_jobs <= 0)
+    n_jobs = g_get_num_processors ();
+
+  pool = g_thread_pool_new (encode_job, NULL, n_jobs, TRUE, NULL);
+
+  for (i = 0; lines[i] != NULL; i++)
+    {
+      gchar **fields;
+      gint n_fields;
+      Job *job;
+      int width, height;
+
+      g_strstrip (lines[i]);
+      if (lines[i][0] == '\0' || lines[i][0] == '#')
+        continue;
+
+      if (!g_shell_parse_argv (lines[i], &n_fields, &fields, NULL))
+        fields = NULL;
+
+      if (fields == NULL || n_fields < 2 || n_fields > 3 ||
+          !parse_size (fields[1], &width, &height))
+        {
+          g_printerr ("%s:%u: %s\n", filename, i + 1, lines[i]);
+          g_atomic_int_inc (&n_failed);
+          g_strfreev (fields);
+          continue;
+        }
+
+      job = g_slice_new (Job);
+      job->path = g_strdup (fields[0]);
+      job->dir = g_strdup (fields[2] ? fields[2] : output_dir);
+      job->width = width;
+      job->height = height;
+      g_strfreev (fields);
+
+      g_thread_pool_push (pool, job, NULL);
+    }
+
+  g_thread_pool_free (pool, FALSE, TRUE);
+  g_strfreev (lines);
+
+  return g_atomic_int_get (&n_failed) > 0 ? 1 : 0;
+}
+
+int
+main (int argc, char **argv)
+{
+  GOptionContext *context;
+  int width, height;
+  gchar *path;
+
+  setlocale (LC_ALL, "");
+
+#ifdef ENABLE_NLS
+  bindtextdomain (GETTEXT_PACKAGE, GTK_LOCALEDIR);
+#ifdef HAVE_BIND_TEXTDOMAIN_CODESET
+  bind_textdomain_codeset (GETTEXT_PACKAGE, "UTF-8");
+#endif
+#endif
+
+  g_set_prgname ("gtk-encode-symbolic-svg");
+
+  context = g_option_context_new ("PATH WIDTHxHEIGHT");
+  g_option_context_add_main_entries (context, args, GETTEXT_PACKAGE);
+
+  g_option_context_parse (context, &argc, &argv, NULL);
+
+  if (manifest != NULL)
+    return encode_manifest (manifest);
+
+  if (argc < 3)
+    {
+      g_printerr ("%s\n", g_option_context_get_help (context, FALSE, NULL));
+      return 1;
+    }
+
+  if (!parse_size (argv[2], &width, &height))
+    return 1;
+
+  path = argv[1];
+#ifdef G_OS_WIN32
+  path = g_locale_to_utf8 (path, -1, NULL, NULL, NULL);
+#endif
+
+  if (!encode_symbolic (path, width, height, output_dir, FALSE))
+    return 1;
+
   return 0;
 }
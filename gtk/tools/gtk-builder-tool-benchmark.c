@@ -0,0 +1,667 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <glib/gi18n.h>
+#include <glib/gprintf.h>
+#include <glib/gstdio.h>
+#include <gtk/gtk.h>
+#include "gtkbuilderprecompileprivate.h"
+
+/* The benchmark splits the cost of loading a .ui file into phases that
+ * can be timed on their own through public API:
+ *
+ * - parse: the XML parsing, without any GtkBuilder handling
+ * - types: resolving the class names with gtk_builder_get_type_from_name()
+ * - values: converting the property values with gtk_builder_value_from_string()
+ * - build: building everything with GtkBuilder, or by instantiating
+ *   the template class for templates
+ *
+ * Every phase is run once to warm up and then as often as requested,
+ * and the fastest run is reported, since that is the least noisy.
+ */
+
+typedef struct
+{
+  gchar *type_name;
+  gchar *name;
+  GString *text;
+  GParamSpec *pspec;
+} BenchProperty;
+
+typedef struct
+{
+  gchar *filename;
+  gchar *contents;
+  gsize length;
+  GBytes *precompiled;
+
+  gchar *template_class;
+  gchar *template_parent;
+
+  GPtrArray *classes;
+  GPtrArray *properties;
+  guint n_elements;
+  guint n_values;
+
+  /* Used while collecting */
+  GPtrArray *stack;
+  BenchProperty *property;
+} BenchFile;
+
+typedef struct
+{
+  gint64 parse;
+  gint64 types;
+  gint64 values;
+  gint64 build;
+} BenchTimes;
+
+static void
+bench_property_free (BenchProperty *property)
+{
+  g_free (property->type_name);
+  g_free (property->name);
+  g_string_free (property->text, TRUE);
+  g_slice_free (BenchProperty, property);
+}
+
+static void
+bench_file_free (BenchFile *file)
+{
+  g_free (file->filename);
+  g_free (file->contents);
+  if (file->precompiled)
+    g_bytes_unref (file->precompiled);
+  g_free (file->template_class);
+  g_free (file->template_parent);
+  g_ptr_array_unref (file->classes);
+  g_ptr_array_unref (file->properties);
+  g_slice_free (BenchFile, file);
+}
+
+static void
+collect_start_element (GMarkupParseContext  *context,
+                       const gchar          *element_name,
+                       const gchar         **names,
+                       const gchar         **values,
+                       gpointer              user_data,
+                       GError              **error)
+{
+  BenchFile *file = user_data;
+  const gchar *type_name = NULL;
+  const gchar *parent = NULL;
+  const gchar *name = NULL;
+  gint i;
+
+  file->n_elements++;
+
+  /* An object as property value, that is not a conversion */
+  if (file->property)
+    {
+      bench_property_free (file->property);
+      file->property = NULL;
+    }
+
+  for (i = 0; names[i]; i++)
+    {
+      if (strcmp (names[i], "class") == 0)
+        type_name = values[i];
+      else if (strcmp (names[i], "parent") == 0)
+        parent = values[i];
+      else if (strcmp (names[i], "name") == 0)
+        name = values[i];
+    }
+
+  if (strcmp (element_name, "object") == 0 && type_name)
+    {
+      g_ptr_array_add (file->classes, g_strdup (type_name));
+      g_ptr_array_add (file->stack, (gpointer) g_intern_string (type_name));
+      return;
+    }
+
+  if (strcmp (element_name, "template") == 0 && type_name && parent)
+    {
+      g_free (file->template_class);
+      g_free (file->template_parent);
+      file->template_class = g_strdup (type_name);
+      file->template_parent = g_strdup (parent);
+      g_ptr_array_add (file->classes, g_strdup (parent));
+      g_ptr_array_add (file->stack, (gpointer) g_intern_string (parent));
+      return;
+    }
+
+  /* Only <property> directly below an object sets a property of it */
+  if (strcmp (element_name, "property") == 0 && name &&
+      file->stack->len > 0 &&
+      g_ptr_array_index (file->stack, file->stack->len - 1) != NULL)
+    {
+      file->property = g_slice_new0 (BenchProperty);
+      file->property->type_name = g_strdup (g_ptr_array_index (file->stack, file->stack->len - 1));
+      file->property->name = g_strdup (name);
+      file->property->text = g_string_new ("");
+    }
+
+  g_ptr_array_add (file->stack, NULL);
+}
+
+static void
+collect_end_element (GMarkupParseContext  *context,
+                     const gchar          *element_name,
+                     gpointer              user_data,
+                     GError              **error)
+{
+  BenchFile *file = user_data;
+
+  g_ptr_array_remove_index (file->stack, file->stack->len - 1);
+
+  if (strcmp (element_name, "property") == 0 && file->property)
+    {
+      g_ptr_array_add (file->properties, file->property);
+      file->property = NULL;
+    }
+}
+
+static void
+collect_text (GMarkupParseContext  *context,
+              const gchar          *text,
+              gsize                 text_len,
+              gpointer              user_data,
+              GError              **error)
+{
+  BenchFile *file = user_data;
+
+  if (file->property)
+    g_string_append_len (file->property->text, text, text_len);
+}
+
+static const GMarkupParser collect_parser = {
+  collect_start_element,
+  collect_end_element,
+  collect_text,
+  NULL,
+  NULL
+};
+
+static const GMarkupParser empty_parser = {
+  NULL,
+};
+
+static gboolean
+parse_contents (BenchFile            *file,
+                const GMarkupParser  *parser,
+                GError              **error)
+{
+  GMarkupParseContext *context;
+  gboolean ret;
+
+  context = g_markup_parse_context_new (parser, G_MARKUP_TREAT_CDATA_AS_TEXT, file, NULL);
+  ret = g_markup_parse_context_parse (context, file->contents, file->length, error) &&
+        g_markup_parse_context_end_parse (context, error);
+  g_markup_parse_context_free (context);
+
+  return ret;
+}
+
+/* Only look up the param specs once, that is not what is measured */
+static void
+resolve_properties (BenchFile *file)
+{
+  GtkBuilder *builder;
+  guint i;
+
+  builder = gtk_builder_new ();
+
+  for (i = 0; i < file->properties->len; i++)
+    {
+      BenchProperty *property = g_ptr_array_index (file->properties, i);
+      GType type, value_type;
+      GObjectClass *oclass;
+
+      type = gtk_builder_get_type_from_name (builder, property->type_name);
+      if (!G_TYPE_IS_OBJECT (type))
+        continue;
+
+      oclass = g_type_class_ref (type);
+      property->pspec = g_object_class_find_property (oclass, property->name);
+      g_type_class_unref (oclass);
+
+      if (property->pspec == NULL)
+        continue;
+
+      /* Object values are references to other objects, not conversions */
+      value_type = G_PARAM_SPEC_VALUE_TYPE (property->pspec);
+      if (G_TYPE_IS_OBJECT (value_type) || G_TYPE_IS_INTERFACE (value_type))
+        property->pspec = NULL;
+      else
+        file->n_values++;
+    }
+
+  g_object_unref (builder);
+}
+
+static BenchFile *
+load_file (const gchar *filename,
+           gboolean     precompile)
+{
+  BenchFile *file;
+  GError *error = NULL;
+
+  file = g_slice_new0 (BenchFile);
+  file->filename = g_strdup (filename);
+  file->classes = g_ptr_array_new_with_free_func (g_free);
+  file->properties = g_ptr_array_new_with_free_func ((GDestroyNotify) bench_property_free);
+
+  if (!g_file_get_contents (filename, &file->contents, &file->length, &error))
+    {
+      g_printerr (_("Can’t load file: %s\n"), error->message);
+      g_error_free (error);
+      bench_file_free (file);
+      return NULL;
+    }
+
+  file->stack = g_ptr_array_new ();
+  if (!parse_contents (file, &collect_parser, &error))
+    {
+      g_printerr ("%s: %s\n", filename, error->message);
+      g_error_free (error);
+      g_clear_pointer (&file->property, bench_property_free);
+      g_ptr_array_unref (file->stack);
+      bench_file_free (file);
+      return NULL;
+    }
+  g_ptr_array_unref (file->stack);
+  file->stack = NULL;
+
+  resolve_properties (file);
+
+  if (precompile)
+    {
+      file->precompiled = _gtk_builder_precompile (file->contents, file->length, &error);
+      if (file->precompiled == NULL)
+        {
+          g_printerr ("%s: %s\n", filename, error->message);
+          g_error_free (error);
+          bench_file_free (file);
+          return NULL;
+        }
+    }
+
+  return file;
+}
+
+static gint64
+run_parse (BenchFile *file)
+{
+  gint64 before;
+
+  before = g_get_monotonic_time ();
+  parse_contents (file, &empty_parser, NULL);
+
+  return g_get_monotonic_time () - before;
+}
+
+static gint64
+run_types (BenchFile *file)
+{
+  GtkBuilder *builder;
+  gint64 before, after;
+  guint i;
+
+  builder = gtk_builder_new ();
+
+  before = g_get_monotonic_time ();
+  for (i = 0; i < file->classes->len; i++)
+    gtk_builder_get_type_from_name (builder, g_ptr_array_index (file->classes, i));
+  after = g_get_monotonic_time ();
+
+  g_object_unref (builder);
+
+  return after - before;
+}
+
+static gint64
+run_values (BenchFile *file)
+{
+  GtkBuilder *builder;
+  gint64 before, after;
+  guint i;
+
+  builder = gtk_builder_new ();
+
+  before = g_get_monotonic_time ();
+  for (i = 0; i < file->properties->len; i++)
+    {
+      BenchProperty *property = g_ptr_array_index (file->properties, i);
+      GValue value = G_VALUE_INIT;
+
+      if (property->pspec == NULL)
+        continue;
+
+      if (gtk_builder_value_from_string (builder, property->pspec, property->text->str, &value, NULL))
+        g_value_unset (&value);
+    }
+  after = g_get_monotonic_time ();
+
+  g_object_unref (builder);
+
+  return after - before;
+}
+
+static void
+destroy_widget (GtkWidget *widget)
+{
+  if (GTK_IS_WINDOW (widget))
+    gtk_widget_destroy (widget);
+  else
+    {
+      g_object_ref_sink (widget);
+      g_object_unref (widget);
+    }
+}
+
+static GType
+make_fake_type (const gchar *type_name,
+                const gchar *parent_name)
+{
+  GType parent_type;
+  GTypeQuery query;
+
+  parent_type = g_type_from_name (parent_name);
+  if (parent_type == G_TYPE_INVALID)
+    return G_TYPE_INVALID;
+
+  g_type_query (parent_type, &query);
+  return g_type_register_static_simple (parent_type,
+                                        type_name,
+                                        query.class_size,
+                                        NULL,
+                                        query.instance_size,
+                                        NULL,
+                                        0);
+}
+
+static gint64
+run_build (BenchFile  *file,
+           GError    **error)
+{
+  GtkBuilder *builder;
+  const gchar *buffer;
+  gsize length;
+  gint64 before, after;
+  GSList *objects, *l;
+  gboolean ret;
+
+  if (file->precompiled)
+    buffer = g_bytes_get_data (file->precompiled, &length);
+  else
+    {
+      buffer = file->contents;
+      length = file->length;
+    }
+
+  if (file->template_class)
+    {
+      GType type;
+      GtkWidget *widget;
+
+      /* Existing classes build from their own template, like
+       * applications do, fake ones are extended with the file
+       */
+      type = g_type_from_name (file->template_class);
+      if (type != G_TYPE_INVALID)
+        {
+          before = g_get_monotonic_time ();
+          widget = g_object_new (type, NULL);
+          after = g_get_monotonic_time ();
+
+          destroy_widget (widget);
+
+          return after - before;
+        }
+
+      type = make_fake_type (file->template_class, file->template_parent);
+      if (type == G_TYPE_INVALID)
+        {
+          g_set_error (error, GTK_BUILDER_ERROR, GTK_BUILDER_ERROR_INVALID_TYPE,
+                       "Invalid template parent type '%s'", file->template_parent);
+          return -1;
+        }
+
+      widget = g_object_new (type, NULL);
+      builder = gtk_builder_new ();
+
+      before = g_get_monotonic_time ();
+      ret = gtk_builder_extend_with_template (builder, widget, type, buffer, length, error);
+      after = g_get_monotonic_time ();
+
+      g_object_unref (builder);
+      destroy_widget (widget);
+
+      return ret ? after - before : -1;
+    }
+
+  builder = gtk_builder_new ();
+
+  before = g_get_monotonic_time ();
+  ret = gtk_builder_add_from_string (builder, buffer, length, error);
+  after = g_get_monotonic_time ();
+
+  objects = gtk_builder_get_objects (builder);
+  for (l = objects; l; l = l->next)
+    {
+      if (GTK_IS_WINDOW (l->data))
+        gtk_widget_destroy (l->data);
+    }
+  g_slist_free (objects);
+  g_object_unref (builder);
+
+  return ret ? after - before : -1;
+}
+
+static gboolean
+run_file (BenchFile  *file,
+          gint        runs,
+          BenchTimes *times)
+{
+  GError *error = NULL;
+  gboolean builds = TRUE;
+  gint i;
+
+  /* The first run registers types and fills caches */
+  run_parse (file);
+  run_types (file);
+  run_values (file);
+  if (run_build (file, &error) < 0)
+    {
+      g_printerr ("%s: %s\n", file->filename, error->message);
+      g_error_free (error);
+      builds = FALSE;
+    }
+
+  times->parse = times->types = times->values = times->build = G_MAXINT64;
+
+  for (i = 0; i < runs; i++)
+    {
+      times->parse = MIN (times->parse, run_parse (file));
+      times->types = MIN (times->types, run_types (file));
+      times->values = MIN (times->values, run_values (file));
+      if (builds)
+        times->build = MIN (times->build, run_build (file, NULL));
+    }
+
+  if (!builds)
+    times->build = -1;
+
+  return builds;
+}
+
+static void
+print_row (const gchar      *name,
+           const BenchTimes *times,
+           guint             n_elements,
+           guint             n_objects,
+           guint             n_values)
+{
+  gchar build[32];
+
+  if (times->build >= 0)
+    g_snprintf (build, sizeof (build), "%" G_GINT64_FORMAT, times->build);
+  else
+    g_snprintf (build, sizeof (build), "-");
+
+  g_print ("%-32s %8" G_GINT64_FORMAT " %8" G_GINT64_FORMAT " %8" G_GINT64_FORMAT " %8s %8u %8u %8u\n",
+           name, times->parse, times->types, times->values, build,
+           n_elements, n_objects, n_values);
+}
+
+static gint
+compare_filenames (gconstpointer a,
+                   gconstpointer b)
+{
+  return g_strcmp0 (*(const gchar **) a, *(const gchar **) b);
+}
+
+/* Also used by 'profile' */
+void
+add_filenames (GPtrArray   *filenames,
+               const gchar *path)
+{
+  GDir *dir;
+  const gchar *name;
+  GPtrArray *names;
+  guint i;
+
+  dir = g_dir_open (path, 0, NULL);
+  if (dir == NULL)
+    {
+      g_ptr_array_add (filenames, g_strdup (path));
+      return;
+    }
+
+  /* Sort, so that runs are comparable */
+  names = g_ptr_array_new ();
+  while ((name = g_dir_read_name (dir)))
+    {
+      if (g_str_has_suffix (name, ".ui"))
+        g_ptr_array_add (names, g_build_filename (path, name, NULL));
+    }
+  g_dir_close (dir);
+
+  g_ptr_array_sort (names, compare_filenames);
+  for (i = 0; i < names->len; i++)
+    g_ptr_array_add (filenames, g_ptr_array_index (names, i));
+  g_ptr_array_free (names, TRUE);
+}
+
+void
+do_benchmark (int          *argc,
+              const char ***argv)
+{
+  gint runs = 5;
+  gboolean precompiled = FALSE;
+  char **paths = NULL;
+  GOptionContext *ctx;
+  const GOptionEntry entries[] = {
+    { "runs", 0, 0, G_OPTION_ARG_INT, &runs, NULL, NULL },
+    { "precompiled", 0, 0, G_OPTION_ARG_NONE, &precompiled, NULL, NULL },
+    { G_OPTION_REMAINING, 0, 0, G_OPTION_ARG_FILENAME_ARRAY, &paths, NULL, NULL },
+    { NULL, }
+  };
+  GError *error = NULL;
+  GPtrArray *filenames;
+  BenchTimes total = { 0, };
+  guint total_elements = 0, total_objects = 0, total_values = 0;
+  gboolean failed = FALSE;
+  guint i;
+
+  ctx = g_option_context_new (NULL);
+  g_option_context_set_help_enabled (ctx, FALSE);
+  g_option_context_add_main_entries (ctx, entries, NULL);
+
+  if (!g_option_context_parse (ctx, argc, (char ***)argv, &error))
+    {
+      g_printerr ("%s\n", error->message);
+      g_error_free (error);
+      exit (1);
+    }
+
+  g_option_context_free (ctx);
+
+  if (paths == NULL)
+    {
+      g_printerr (_("No .ui file specified\n"));
+      exit (1);
+    }
+
+  if (runs < 1)
+    runs = 1;
+
+  filenames = g_ptr_array_new_with_free_func (g_free);
+  for (i = 0; paths[i]; i++)
+    add_filenames (filenames, paths[i]);
+  g_strfreev (paths);
+
+  g_print ("%-32s %8s %8s %8s %8s %8s %8s %8s\n",
+           "File", "Parse", "Types", "Values", "Build",
+           "Elements", "Objects", "Props");
+
+  for (i = 0; i < filenames->len; i++)
+    {
+      const gchar *filename = g_ptr_array_index (filenames, i);
+      BenchFile *file;
+      BenchTimes times = { 0, };
+      gchar *name;
+
+      file = load_file (filename, precompiled);
+      if (file == NULL)
+        {
+          failed = TRUE;
+          continue;
+        }
+
+      if (!run_file (file, runs, &times))
+        failed = TRUE;
+
+      name = g_path_get_basename (filename);
+      print_row (name, &times, file->n_elements, file->classes->len, file->n_values);
+      g_free (name);
+
+      total.parse += times.parse;
+      total.types += times.types;
+      total.values += times.values;
+      if (times.build >= 0 && total.build >= 0)
+        total.build += times.build;
+      else
+        total.build = -1;
+      total_elements += file->n_elements;
+      total_objects += file->classes->len;
+      total_values += file->n_values;
+
+      bench_file_free (file);
+    }
+
+  print_row ("Total", &total, total_elements, total_objects, total_values);
+
+  g_ptr_array_unref (filenames);
+
+  if (failed)
+    exit (1);
+}
@@ -0,0 +1,121 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <glib/gi18n.h>
+#include <glib/gprintf.h>
+#include <glib/gstdio.h>
+#include <gtk/gtk.h>
+#include "gtkbuilderprecompileprivate.h"
+
+static gboolean
+precompile_file (const gchar *filename,
+                 const gchar *output)
+{
+  gchar *contents;
+  gsize length;
+  GBytes *bytes;
+  GError *error = NULL;
+  gboolean ret;
+
+  if (!g_file_get_contents (filename, &contents, &length, &error))
+    {
+      g_printerr (_("Can’t load file: %s\n"), error->message);
+      g_error_free (error);
+      return FALSE;
+    }
+
+  bytes = _gtk_builder_precompile (contents, length, &error);
+  g_free (contents);
+
+  if (bytes == NULL)
+    {
+      g_printerr ("%s: %s\n", filename, error->message);
+      g_error_free (error);
+      return FALSE;
+    }
+
+  if (output)
+    {
+      ret = g_file_set_contents (output,
+                                 g_bytes_get_data (bytes, NULL),
+                                 g_bytes_get_size (bytes),
+                                 &error);
+      if (!ret)
+        {
+          g_printerr (_("Failed to write %s: “%s”\n"), output, error->message);
+          g_error_free (error);
+        }
+    }
+  else
+    {
+      ret = fwrite (g_bytes_get_data (bytes, NULL), 1, g_bytes_get_size (bytes), stdout) ==
+            g_bytes_get_size (bytes);
+      if (!ret)
+        g_printerr (_("Failed to write %s: “%s”\n"), "stdout", g_strerror (errno));
+    }
+
+  g_bytes_unref (bytes);
+
+  return ret;
+}
+
+void
+do_precompile (int          *argc,
+               const char ***argv)
+{
+  char *output = NULL;
+  char **filenames = NULL;
+  GOptionContext *ctx;
+  const GOptionEntry entries[] = {
+    { "output", 0, 0, G_OPTION_ARG_FILENAME, &output, NULL, NULL },
+    { G_OPTION_REMAINING, 0, 0, G_OPTION_ARG_FILENAME_ARRAY, &filenames, NULL, NULL },
+    { NULL, }
+  };
+  GError *error = NULL;
+
+  ctx = g_option_context_new (NULL);
+  g_option_context_set_help_enabled (ctx, FALSE);
+  g_option_context_add_main_entries (ctx, entries, NULL);
+
+  if (!g_option_context_parse (ctx, argc, (char ***)argv, &error))
+    {
+      g_printerr ("%s\n", error->message);
+      g_error_free (error);
+      exit (1);
+    }
+
+  g_option_context_free (ctx);
+
+  if (filenames == NULL)
+    {
+      g_printerr (_("No .ui file specified\n"));
+      exit (1);
+    }
+
+  if (g_strv_length (filenames) > 1)
+    {
+      g_printerr (_("Can only precompile a single .ui file\n"));
+      exit (1);
+    }
+
+  if (!precompile_file (filenames[0], output))
+    exit (1);
+}
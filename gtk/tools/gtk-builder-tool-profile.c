@@ -0,0 +1,530 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <glib/gi18n.h>
+#include <glib/gprintf.h>
+#include <glib/gstdio.h>
+#include <gtk/gtk.h>
+
+/* The profile puts the widgets of a .ui file into a window that is
+ * never presented to the user and then produces frames:
+ *
+ * - all styles are invalidated with gtk_widget_reset_style()
+ * - a resize and a redraw of the window are queued
+ * - the main loop runs until the frame clock emitted ::after-paint
+ *
+ * The window records its frame phases, see
+ * gtk_window_set_record_frame_phases(), so the time spent and
+ * the number of widgets that did work in every phase of every
+ * frame are known. The first frame maps the window and is not
+ * counted. The results are printed as JSON, so that they can be
+ * compared by scripts.
+ *
+ * The style counters of all files are reported as well. Themes are
+ * full of descendant selectors that can't match most widgets, so if
+ * the ancestor filter skipped none of them, it is broken and the
+ * profile fails.
+ */
+
+/* Give up on files whose window does not produce a frame */
+#define FRAME_TIMEOUT_SECONDS 5
+
+extern void add_filenames (GPtrArray   *filenames,
+                           const gchar *path);
+
+typedef struct
+{
+  gboolean painted;
+  gboolean timed_out;
+  gint64 frame_counter;
+} ProfileFrame;
+
+typedef struct
+{
+  /* Indexed by GtkFramePhase, one entry per frame */
+  GArray **durations;
+  GArray **widgets;
+  GArray *totals;
+  guint n_phases;
+} ProfileResults;
+
+static gchar *
+find_template_class (const gchar *contents,
+                     gsize        length)
+{
+  const gchar *start, *end;
+
+  /* Good enough for the files that the builder accepts */
+  start = g_strstr_len (contents, length, "<template");
+  if (start == NULL)
+    return NULL;
+
+  start = strstr (start, "class=\"");
+  if (start == NULL)
+    return NULL;
+
+  start += strlen ("class=\"");
+  end = strchr (start, '"');
+  if (end == NULL)
+    return NULL;
+
+  return g_strndup (start, end - start);
+}
+
+static GtkWidget *
+load_window (const gchar  *filename,
+             GtkBuilder  **builder_out,
+             GError      **error)
+{
+  GtkBuilder *builder;
+  gchar *contents;
+  gsize length;
+  gchar *template_class;
+  GtkWidget *widget, *window;
+  GSList *objects, *l;
+
+  *builder_out = NULL;
+
+  if (!g_file_get_contents (filename, &contents, &length, error))
+    return NULL;
+
+  template_class = find_template_class (contents, length);
+  if (template_class)
+    {
+      GType type;
+
+      /* Templates of existing classes are built by creating an instance */
+      type = g_type_from_name (template_class);
+      g_free (contents);
+      if (!g_type_is_a (type, GTK_TYPE_WIDGET))
+        {
+          g_set_error (error, GTK_BUILDER_ERROR, GTK_BUILDER_ERROR_INVALID_TYPE,
+                       "Template class '%s' is not a known widget type", template_class);
+          g_free (template_class);
+          return NULL;
+        }
+      g_free (template_class);
+
+      widget = g_object_new (type, NULL);
+    }
+  else
+    {
+      builder = gtk_builder_new ();
+      if (!gtk_builder_add_from_string (builder, contents, length, error))
+        {
+          g_free (contents);
+          g_object_unref (builder);
+          return NULL;
+        }
+      g_free (contents);
+
+      /* Like preview, prefer windows and then toplevel widgets */
+      widget = NULL;
+      objects = gtk_builder_get_objects (builder);
+      for (l = objects; l; l = l->next)
+        {
+          if (GTK_IS_WINDOW (l->data))
+            {
+              widget = l->data;
+              break;
+            }
+          else if (GTK_IS_WIDGET (l->data) &&
+                   gtk_widget_get_parent (l->data) == NULL &&
+                   widget == NULL)
+            widget = l->data;
+        }
+      g_slist_free (objects);
+
+      if (widget == NULL)
+        {
+          g_set_error (error, GTK_BUILDER_ERROR, GTK_BUILDER_ERROR_INVALID_VALUE,
+                       "No widget found");
+          g_object_unref (builder);
+          return NULL;
+        }
+
+      *builder_out = builder;
+    }
+
+  if (GTK_IS_WINDOW (widget))
+    return widget;
+
+  window = gtk_window_new (GTK_WINDOW_TOPLEVEL);
+  gtk_container_add (GTK_CONTAINER (window), widget);
+
+  return window;
+}
+
+static void
+after_paint (GdkFrameClock *clock,
+             ProfileFrame  *frame)
+{
+  frame->frame_counter = gdk_frame_clock_get_frame_counter (clock);
+  frame->painted = TRUE;
+}
+
+static gboolean
+frame_timeout (gpointer data)
+{
+  ProfileFrame *frame = data;
+
+  frame->timed_out = TRUE;
+
+  return G_SOURCE_REMOVE;
+}
+
+static gboolean
+run_frame (GtkWidget    *window,
+           ProfileFrame *frame)
+{
+  GdkFrameClock *clock;
+  gulong handler;
+  guint timeout;
+
+  frame->painted = FALSE;
+  frame->timed_out = FALSE;
+
+  gtk_widget_reset_style (window);
+  gtk_widget_queue_resize (window);
+  gtk_widget_queue_draw (window);
+
+  clock = gtk_widget_get_frame_clock (window);
+  if (clock == NULL)
+    return FALSE;
+
+  handler = g_signal_connect (clock, "after-paint", G_CALLBACK (after_paint), frame);
+  timeout = g_timeout_add_seconds (FRAME_TIMEOUT_SECONDS, frame_timeout, frame);
+
+  while (!frame->painted && !frame->timed_out)
+    g_main_context_iteration (NULL, TRUE);
+
+  g_signal_handler_disconnect (clock, handler);
+  if (!frame->timed_out)
+    g_source_remove (timeout);
+
+  return frame->painted;
+}
+
+static ProfileResults *
+profile_results_new (void)
+{
+  ProfileResults *results;
+  GEnumClass *phases;
+  guint i;
+
+  phases = g_type_class_ref (GTK_TYPE_FRAME_PHASE);
+
+  results = g_slice_new0 (ProfileResults);
+  results->n_phases = phases->n_values;
+  results->durations = g_new (GArray *, results->n_phases);
+  results->widgets = g_new (GArray *, results->n_phases);
+  for (i = 0; i < results->n_phases; i++)
+    {
+      results->durations[i] = g_array_new (FALSE, FALSE, sizeof (gint64));
+      results->widgets[i] = g_array_new (FALSE, FALSE, sizeof (gint64));
+    }
+  results->totals = g_array_new (FALSE, FALSE, sizeof (gint64));
+
+  g_type_class_unref (phases);
+
+  return results;
+}
+
+static void
+profile_results_free (ProfileResults *results)
+{
+  guint i;
+
+  for (i = 0; i < results->n_phases; i++)
+    {
+      g_array_unref (results->durations[i]);
+      g_array_unref (results->widgets[i]);
+    }
+  g_free (results->durations);
+  g_free (results->widgets);
+  g_array_unref (results->totals);
+  g_slice_free (ProfileResults, results);
+}
+
+static gboolean
+profile_window (GtkWidget       *window,
+                gint             cycles,
+                ProfileResults  *results,
+                GError         **error)
+{
+  ProfileFrame frame = { 0, };
+  gint i;
+  guint p;
+
+  gtk_window_set_record_frame_phases (GTK_WINDOW (window), TRUE);
+  gtk_window_present (GTK_WINDOW (window));
+
+  /* Mapping and the first styling is not what is measured */
+  if (!run_frame (window, &frame))
+    {
+      g_set_error (error, G_IO_ERROR, G_IO_ERROR_TIMED_OUT,
+                   "The window did not produce a frame");
+      return FALSE;
+    }
+
+  for (i = 0; i < cycles; i++)
+    {
+      GtkFramePhaseTimings *timings;
+      gint64 total = 0;
+
+      if (!run_frame (window, &frame))
+        {
+          g_set_error (error, G_IO_ERROR, G_IO_ERROR_TIMED_OUT,
+                       "The window stopped producing frames");
+          return FALSE;
+        }
+
+      timings = gtk_window_get_frame_phase_timings (GTK_WINDOW (window), frame.frame_counter);
+      if (timings == NULL)
+        continue;
+
+      for (p = 0; p < results->n_phases; p++)
+        {
+          gint64 duration = gtk_frame_phase_timings_get_phase_duration (timings, p);
+          gint64 widgets = gtk_frame_phase_timings_get_phase_widgets (timings, p);
+
+          g_array_append_val (results->durations[p], duration);
+          g_array_append_val (results->widgets[p], widgets);
+          total += duration;
+        }
+      g_array_append_val (results->totals, total);
+
+      gtk_frame_phase_timings_unref (timings);
+    }
+
+  return TRUE;
+}
+
+static gint
+compare_int64 (gconstpointer a,
+               gconstpointer b)
+{
+  gint64 x = *(const gint64 *) a;
+  gint64 y = *(const gint64 *) b;
+
+  return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+/* Nearest rank, on a sorted array */
+static gint64
+percentile (GArray *values,
+            guint   percent)
+{
+  guint rank;
+
+  if (values->len == 0)
+    return 0;
+
+  rank = (values->len * percent + 99) / 100;
+  rank = CLAMP (rank, 1, values->len);
+
+  return g_array_index (values, gint64, rank - 1);
+}
+
+static void
+append_json_string (GString     *json,
+                    const gchar *string)
+{
+  const gchar *p;
+
+  g_string_append_c (json, '"');
+  for (p = string; *p; p++)
+    {
+      if (*p == '"' || *p == '\\')
+        g_string_append_printf (json, "\\%c", *p);
+      else if ((guchar) *p < 0x20)
+        g_string_append_printf (json, "\\u%04x", *p);
+      else
+        g_string_append_c (json, *p);
+    }
+  g_string_append_c (json, '"');
+}
+
+static void
+append_json_stats (GString *json,
+                   GArray  *values)
+{
+  g_array_sort (values, compare_int64);
+
+  g_string_append_printf (json,
+                          "{ \"min\": %" G_GINT64_FORMAT
+                          ", \"median\": %" G_GINT64_FORMAT
+                          ", \"p90\": %" G_GINT64_FORMAT
+                          ", \"p99\": %" G_GINT64_FORMAT
+                          ", \"max\": %" G_GINT64_FORMAT " }",
+                          percentile (values, 0),
+                          percentile (values, 50),
+                          percentile (values, 90),
+                          percentile (values, 99),
+                          percentile (values, 100));
+}
+
+static void
+append_json_results (GString        *json,
+                     const gchar    *filename,
+                     ProfileResults *results,
+                     const GError   *error)
+{
+  GEnumClass *phases;
+  guint p;
+
+  g_string_append (json, "    {\n      \"file\": ");
+  append_json_string (json, filename);
+
+  if (error)
+    {
+      g_string_append (json, ",\n      \"error\": ");
+      append_json_string (json, error->message);
+      g_string_append (json, "\n    }");
+      return;
+    }
+
+  phases = g_type_class_ref (GTK_TYPE_FRAME_PHASE);
+
+  g_string_append_printf (json, ",\n      \"frames\": %u", results->totals->len);
+  g_string_append (json, ",\n      \"total\": ");
+  append_json_stats (json, results->totals);
+  g_string_append (json, ",\n      \"phases\": {\n");
+  for (p = 0; p < results->n_phases; p++)
+    {
+      g_string_append (json, "        ");
+      append_json_string (json, g_enum_get_value (phases, p)->value_nick);
+      g_string_append (json, ": {\n          \"time\": ");
+      append_json_stats (json, results->durations[p]);
+      g_string_append (json, ",\n          \"widgets\": ");
+      append_json_stats (json, results->widgets[p]);
+      g_string_append_printf (json, "\n        }%s\n", p + 1 < results->n_phases ? "," : "");
+    }
+  g_string_append (json, "      }\n    }");
+
+  g_type_class_unref (phases);
+}
+
+void
+do_profile (int          *argc,
+            const char ***argv)
+{
+  gint cycles = 50;
+  char **paths = NULL;
+  GOptionContext *ctx;
+  const GOptionEntry entries[] = {
+    { "cycles", 0, 0, G_OPTION_ARG_INT, &cycles, NULL, NULL },
+    { G_OPTION_REMAINING, 0, 0, G_OPTION_ARG_FILENAME_ARRAY, &paths, NULL, NULL },
+    { NULL, }
+  };
+  GError *error = NULL;
+  GPtrArray *filenames;
+  GString *json;
+  GVariant *stats;
+  guint32 matches, rejects;
+  gboolean failed = FALSE;
+  guint i;
+
+  ctx = g_option_context_new (NULL);
+  g_option_context_set_help_enabled (ctx, FALSE);
+  g_option_context_add_main_entries (ctx, entries, NULL);
+
+  if (!g_option_context_parse (ctx, argc, (char ***)argv, &error))
+    {
+      g_printerr ("%s\n", error->message);
+      g_error_free (error);
+      exit (1);
+    }
+
+  g_option_context_free (ctx);
+
+  if (paths == NULL)
+    {
+      g_printerr (_("No .ui file specified\n"));
+      exit (1);
+    }
+
+  if (cycles < 1)
+    cycles = 1;
+
+  filenames = g_ptr_array_new_with_free_func (g_free);
+  for (i = 0; paths[i]; i++)
+    add_filenames (filenames, paths[i]);
+  g_strfreev (paths);
+
+  gtk_css_stats_reset ();
+
+  json = g_string_new (NULL);
+  g_string_append_printf (json, "{\n  \"cycles\": %d,\n  \"unit\": \"us\",\n  \"files\": [\n", cycles);
+
+  for (i = 0; i < filenames->len; i++)
+    {
+      const gchar *filename = g_ptr_array_index (filenames, i);
+      ProfileResults *results;
+      GtkBuilder *builder;
+      GtkWidget *window;
+      gchar *name;
+
+      results = profile_results_new ();
+
+      window = load_window (filename, &builder, &error);
+      if (window)
+        profile_window (window, cycles, results, &error);
+
+      if (error)
+        failed = TRUE;
+
+      name = g_path_get_basename (filename);
+      append_json_results (json, name, results, error);
+      g_string_append (json, i + 1 < filenames->len ? ",\n" : "\n");
+      g_free (name);
+
+      g_clear_error (&error);
+      if (window)
+        gtk_widget_destroy (window);
+      g_clear_object (&builder);
+      profile_results_free (results);
+    }
+
+  stats = g_variant_ref_sink (gtk_css_stats_snapshot ());
+  if (!g_variant_lookup (stats, "selector-matches", "u", &matches))
+    matches = 0;
+  if (!g_variant_lookup (stats, "selector-rejects", "u", &rejects))
+    rejects = 0;
+  g_variant_unref (stats);
+
+  g_string_append_printf (json,
+                          "  ],\n  \"selector-matches\": %u,\n  \"selector-rejects\": %u\n}\n",
+                          matches, rejects);
+  g_print ("%s", json->str);
+  g_string_free (json, TRUE);
+
+  if (matches > 0 && rejects == 0)
+    {
+      g_printerr ("The ancestor filter did not reject any of %u selectors\n", matches);
+      failed = TRUE;
+    }
+
+  g_ptr_array_unref (filenames);
+
+  if (failed)
+    exit (1);
+}
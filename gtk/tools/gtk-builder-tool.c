@@ -31,6 +31,9 @@ extern void do_simplify  (int *argc, const char ***argv);
 extern void do_validate  (int *argc, const char ***argv);
 extern void do_enumerate (int *argc, const char ***argv);
 extern void do_preview   (int *argc, const char ***argv);
+extern void do_precompile (int *argc, const char ***argv);
+extern void do_benchmark (int *argc, const char ***argv);
+extern void do_profile   (int *argc, const char ***argv);
 
 static void
 usage (void)
@@ -43,6 +46,9 @@ usage (void)
              "  simplify [OPTIONS] Simplify the file\n"
              "  enumerate          List all named objects\n"
              "  preview [OPTIONS]  Preview the file\n"
+             "  precompile [OPTIONS] Precompile the file\n"
+             "  benchmark [OPTIONS] Time loading the files\n"
+             "  profile [OPTIONS]  Time styling, layout and snapshots of the files\n"
              "\n"
              "Simplify Options:\n"
              "  --replace          Replace the file\n"
@@ -52,6 +58,16 @@ usage (void)
              "  --id=ID            Preview only the named object\n"
              "  --css=FILE         Use style from CSS file\n"
              "\n"
+             "Precompile Options:\n"
+             "  --output=FILE      Write to FILE instead of stdout\n"
+             "\n"
+             "Benchmark Options:\n"
+             "  --runs=N           Repeat every phase N times\n"
+             "  --precompiled      Build from precompiled data\n"
+             "\n"
+             "Profile Options:\n"
+             "  --cycles=N         Produce N frames for each file\n"
+             "\n"
              "Perform various tasks on GtkBuilder .ui files.\n"));
   exit (1);
 }
@@ -82,6 +98,12 @@ main (int argc, const char *argv[])
     do_enumerate (&argc, &argv);
   else if (strcmp (argv[0], "preview") == 0)
     do_preview (&argc, &argv);
+  else if (strcmp (argv[0], "precompile") == 0)
+    do_precompile (&argc, &argv);
+  else if (strcmp (argv[0], "benchmark") == 0)
+    do_benchmark (&argc, &argv);
+  else if (strcmp (argv[0], "profile") == 0)
+    do_profile (&argc, &argv);
   else
     usage ();
 
@@ -0,0 +1,140 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+
+#include <glib/gi18n.h>
+#include <glib/gprintf.h>
+#include <gtk/gtk.h>
+
+/* Times parsing CSS files with GtkCssProvider.
+ *
+ * Every file is parsed once to warm up, so that the file is in the
+ * page cache and the names in it are interned, and then as often as
+ * requested. The fastest and the median run are reported.
+ * Without files, the Adwaita theme that is built into GTK is parsed.
+ */
+
+#define DEFAULT_THEME "resource:///org/gtk/libgtk/theme/Adwaita/gtk-contained.css"
+
+static void
+parsing_error (GtkCssProvider *provider,
+               GtkCssSection  *section,
+               const GError   *error,
+               gpointer        user_data)
+{
+  guint *n_errors = user_data;
+
+  (*n_errors)++;
+}
+
+static int
+compare_times (gconstpointer a,
+               gconstpointer b)
+{
+  gint64 t1 = *(const gint64 *) a;
+  gint64 t2 = *(const gint64 *) b;
+
+  return t1 < t2 ? -1 : (t1 > t2 ? 1 : 0);
+}
+
+static void
+bench_file (const char *uri,
+            int         n_runs)
+{
+  GtkCssProvider *provider;
+  GFile *file;
+  gint64 *times;
+  guint n_errors = 0;
+  gint64 start;
+  int i;
+
+  file = g_file_new_for_commandline_arg (uri);
+  provider = gtk_css_provider_new ();
+  g_signal_connect (provider, "parsing-error", G_CALLBACK (parsing_error), &n_errors);
+
+  gtk_css_provider_load_from_file (provider, file);
+
+  times = g_new (gint64, n_runs);
+  for (i = 0; i < n_runs; i++)
+    {
+      /* Reloading the same file is the cold parse we want to measure,
+       * the provider throws away everything it had before. */
+      start = g_get_monotonic_time ();
+      gtk_css_provider_load_from_file (provider, file);
+      times[i] = g_get_monotonic_time () - start;
+    }
+
+  qsort (times, n_runs, sizeof (gint64), compare_times);
+
+  g_print ("%s: min %.3f ms, median %.3f ms",
+           uri, times[0] / 1000., times[n_runs / 2] / 1000.);
+  if (n_errors > 0)
+    g_print (", %u errors", n_errors / (n_runs + 1));
+  g_print ("\n");
+
+  g_free (times);
+  g_object_unref (provider);
+  g_object_unref (file);
+}
+
+int
+main (int argc, char *argv[])
+{
+  char **filenames = NULL;
+  int runs = 20;
+  GOptionContext *context;
+  const GOptionEntry entries[] = {
+    { "runs", 0, 0, G_OPTION_ARG_INT, &runs, "Number of times to parse each file", "COUNT" },
+    { G_OPTION_REMAINING, 0, 0, G_OPTION_ARG_FILENAME_ARRAY, &filenames, NULL, "FILE…" },
+    { NULL, }
+  };
+  GError *error = NULL;
+  int i;
+
+  g_set_prgname ("gtk4-css-benchmark");
+
+  gtk_init ();
+
+  context = g_option_context_new (NULL);
+  g_option_context_set_summary (context, "Time parsing of CSS files.");
+  g_option_context_add_main_entries (context, entries, NULL);
+
+  if (!g_option_context_parse (context, &argc, &argv, &error))
+    {
+      g_printerr ("%s\n", error->message);
+      g_error_free (error);
+      exit (1);
+    }
+
+  g_option_context_free (context);
+
+  if (runs < 1)
+    runs = 1;
+
+  if (filenames == NULL)
+    bench_file (DEFAULT_THEME, runs);
+  else
+    {
+      for (i = 0; filenames[i]; i++)
+        bench_file (filenames[i], runs);
+    }
+
+  g_strfreev (filenames);
+
+  return 0;
+}
@@ -0,0 +1,552 @@
+/* GTK - The GIMP Toolkit
+ * Copyright (C) 2019 the GTK+ Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "gtkbuilderprecompileprivate.h"
+
+#include <string.h>
+
+/*
+ * Precompiled GtkBuilder data
+ *
+ * Instantiating a template or loading a .ui file spends most of its
+ * parsing time tokenizing the XML. Precompiled data contains the same
+ * document as a list of records, with every string stored only once,
+ * so it can be replayed into the builder without looking at XML.
+ *
+ * All numbers are 32 bit little endian. The data starts with a header:
+ *
+ *   "GBU\0", format version, number of strings, size of the strings
+ *
+ * followed by the nul-terminated strings, padded to 4 bytes, and the
+ * records. Strings are referred to by their index. The records are:
+ *
+ *   RECORD_START_ELEMENT, name, line, column, n_attributes,
+ *     n_attributes × (attribute name, attribute value)
+ *   RECORD_END_ELEMENT, name
+ *   RECORD_TEXT, text
+ *   RECORD_FRAGMENT, parent element name, line, XML
+ *
+ * Only elements that GtkBuilder handles itself are turned into records.
+ * Custom tags are parsed by the buildables with a GMarkupParseContext,
+ * so they are kept as XML fragments. Text is only kept where GtkBuilder
+ * looks at it, inside <property>.
+ */
+
+#define PRECOMPILED_MAGIC "GBU\0"
+#define PRECOMPILED_VERSION 1
+#define PRECOMPILED_HEADER_SIZE 16
+
+enum {
+  RECORD_START_ELEMENT = 1,
+  RECORD_END_ELEMENT,
+  RECORD_TEXT,
+  RECORD_FRAGMENT
+};
+
+typedef struct
+{
+  GHashTable *strings;
+  GString *string_data;
+  guint n_strings;
+
+  GByteArray *records;
+
+  GPtrArray *element_stack;
+
+  /* The depth of the element a fragment started at, or 0 */
+  guint fragment_depth;
+  GString *fragment;
+  gint fragment_start_line;
+  gint fragment_line;
+} Compiler;
+
+static const gchar *core_elements[] = {
+  "interface",
+  "requires",
+  "object",
+  "template",
+  "property",
+  "child",
+  "signal",
+  "placeholder"
+};
+
+static gboolean
+is_core_element (const gchar *element_name)
+{
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (core_elements); i++)
+    {
+      if (strcmp (element_name, core_elements[i]) == 0)
+        return TRUE;
+    }
+
+  return FALSE;
+}
+
+static guint32
+intern_string (Compiler    *compiler,
+               const gchar *string)
+{
+  gpointer index;
+
+  index = g_hash_table_lookup (compiler->strings, string);
+  if (index)
+    return GPOINTER_TO_UINT (index) - 1;
+
+  g_hash_table_insert (compiler->strings,
+                       g_strdup (string),
+                       GUINT_TO_POINTER (compiler->n_strings + 1));
+  g_string_append_len (compiler->string_data, string, strlen (string) + 1);
+
+  return compiler->n_strings++;
+}
+
+static void
+write_uint32 (GByteArray *array,
+              guint32     value)
+{
+  value = GUINT32_TO_LE (value);
+  g_byte_array_append (array, (guint8 *) &value, 4);
+}
+
+static void
+fragment_sync_line (Compiler            *compiler,
+                    GMarkupParseContext *context)
+{
+  gint line;
+
+  /* Keep the lines of the fragment the same as the ones of the
+   * original file, so errors from custom parsers point to the
+   * right place
+   */
+  g_markup_parse_context_get_position (context, &line, NULL);
+  while (compiler->fragment_line < line)
+    {
+      g_string_append_c (compiler->fragment, '\n');
+      compiler->fragment_line++;
+    }
+}
+
+static void
+fragment_append_escaped (Compiler    *compiler,
+                         const gchar *text,
+                         gssize       text_len)
+{
+  gchar *escaped;
+  const gchar *p;
+
+  escaped = g_markup_escape_text (text, text_len);
+  g_string_append (compiler->fragment, escaped);
+
+  for (p = escaped; *p; p++)
+    {
+      if (*p == '\n')
+        compiler->fragment_line++;
+    }
+
+  g_free (escaped);
+}
+
+static void
+compile_start_element (GMarkupParseContext  *context,
+                       const gchar          *element_name,
+                       const gchar         **attribute_names,
+                       const gchar         **attribute_values,
+                       gpointer              user_data,
+                       GError              **error)
+{
+  Compiler *compiler = user_data;
+  gint line, col;
+  guint i;
+
+  if (compiler->fragment_depth == 0 && !is_core_element (element_name))
+    {
+      compiler->fragment_depth = compiler->element_stack->len + 1;
+      g_string_truncate (compiler->fragment, 0);
+      g_markup_parse_context_get_position (context, &line, NULL);
+      compiler->fragment_start_line = line;
+      compiler->fragment_line = line;
+    }
+
+  g_ptr_array_add (compiler->element_stack, g_strdup (element_name));
+
+  if (compiler->fragment_depth)
+    {
+      fragment_sync_line (compiler, context);
+      g_string_append_printf (compiler->fragment, "<%s", element_name);
+      for (i = 0; attribute_names[i]; i++)
+        {
+          g_string_append_printf (compiler->fragment, " %s=\"", attribute_names[i]);
+          fragment_append_escaped (compiler, attribute_values[i], -1);
+          g_string_append_c (compiler->fragment, '"');
+        }
+      g_string_append_c (compiler->fragment, '>');
+      return;
+    }
+
+  g_markup_parse_context_get_position (context, &line, &col);
+
+  write_uint32 (compiler->records, RECORD_START_ELEMENT);
+  write_uint32 (compiler->records, intern_string (compiler, element_name));
+  write_uint32 (compiler->records, line);
+  write_uint32 (compiler->records, col);
+  write_uint32 (compiler->records, g_strv_length ((gchar **) attribute_names));
+  for (i = 0; attribute_names[i]; i++)
+    {
+      write_uint32 (compiler->records, intern_string (compiler, attribute_names[i]));
+      write_uint32 (compiler->records, intern_string (compiler, attribute_values[i]));
+    }
+}
+
+static void
+compile_end_element (GMarkupParseContext  *context,
+                     const gchar          *element_name,
+                     gpointer              user_data,
+                     GError              **error)
+{
+  Compiler *compiler = user_data;
+  guint depth = compiler->element_stack->len;
+
+  if (compiler->fragment_depth)
+    {
+      g_string_append_printf (compiler->fragment, "</%s>", element_name);
+
+      if (depth == compiler->fragment_depth)
+        {
+          const gchar *parent;
+
+          parent = depth > 1 ? g_ptr_array_index (compiler->element_stack, depth - 2) : "";
+
+          write_uint32 (compiler->records, RECORD_FRAGMENT);
+          write_uint32 (compiler->records, intern_string (compiler, parent));
+          write_uint32 (compiler->records, compiler->fragment_start_line);
+          write_uint32 (compiler->records, intern_string (compiler, compiler->fragment->str));
+
+          compiler->fragment_depth = 0;
+        }
+    }
+  else
+    {
+      write_uint32 (compiler->records, RECORD_END_ELEMENT);
+      write_uint32 (compiler->records, intern_string (compiler, element_name));
+    }
+
+  g_ptr_array_set_size (compiler->element_stack, depth - 1);
+}
+
+static void
+compile_text (GMarkupParseContext  *context,
+              const gchar          *text,
+              gsize                 text_len,
+              gpointer              user_data,
+              GError              **error)
+{
+  Compiler *compiler = user_data;
+  guint depth = compiler->element_stack->len;
+  gchar *string;
+
+  if (compiler->fragment_depth)
+    {
+      fragment_append_escaped (compiler, text, text_len);
+      return;
+    }
+
+  if (depth == 0 ||
+      strcmp (g_ptr_array_index (compiler->element_stack, depth - 1), "property") != 0)
+    return;
+
+  string = g_strndup (text, text_len);
+  write_uint32 (compiler->records, RECORD_TEXT);
+  write_uint32 (compiler->records, intern_string (compiler, string));
+  g_free (string);
+}
+
+static const GMarkupParser compile_parser = {
+  compile_start_element,
+  compile_end_element,
+  compile_text,
+  NULL,
+  NULL
+};
+
+/*
+ * _gtk_builder_is_precompiled:
+ * @data: GtkBuilder data
+ * @length: the length of @data
+ *
+ * Checks if @data was created by _gtk_builder_precompile().
+ * XML can not start with a nul byte, so this never mistakes
+ * an XML document for precompiled data.
+ *
+ * Returns: %TRUE if @data is precompiled
+ */
+gboolean
+_gtk_builder_is_precompiled (const gchar *data,
+                             gsize        length)
+{
+  return length >= PRECOMPILED_HEADER_SIZE &&
+         memcmp (data, PRECOMPILED_MAGIC, 4) == 0;
+}
+
+/*
+ * _gtk_builder_precompile:
+ * @data: a GtkBuilder XML document
+ * @length: the length of @data, or -1 if it is nul-terminated
+ * @error: return location for an error
+ *
+ * Converts a GtkBuilder XML document into the precompiled form,
+ * which GtkBuilder loads without parsing XML. The document is
+ * not validated beyond being well-formed XML.
+ *
+ * Returns: (transfer full): the precompiled data, or %NULL on error
+ */
+GBytes *
+_gtk_builder_precompile (const gchar  *data,
+                         gssize        length,
+                         GError      **error)
+{
+  GMarkupParseContext *context;
+  Compiler compiler;
+  GByteArray *result;
+  GBytes *bytes = NULL;
+
+  compiler.strings = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+  compiler.string_data = g_string_new (NULL);
+  compiler.n_strings = 0;
+  compiler.records = g_byte_array_new ();
+  compiler.element_stack = g_ptr_array_new_with_free_func (g_free);
+  compiler.fragment_depth = 0;
+  compiler.fragment = g_string_new (NULL);
+
+  context = g_markup_parse_context_new (&compile_parser,
+                                        G_MARKUP_TREAT_CDATA_AS_TEXT,
+                                        &compiler, NULL);
+
+  if (g_markup_parse_context_parse (context, data, length, error) &&
+      g_markup_parse_context_end_parse (context, error))
+    {
+      while (compiler.string_data->len % 4 != 0)
+        g_string_append_c (compiler.string_data, '\0');
+
+      result = g_byte_array_sized_new (PRECOMPILED_HEADER_SIZE +
+                                       compiler.string_data->len +
+                                       compiler.records->len);
+      g_byte_array_append (result, (guint8 *) PRECOMPILED_MAGIC, 4);
+      write_uint32 (result, PRECOMPILED_VERSION);
+      write_uint32 (result, compiler.n_strings);
+      write_uint32 (result, compiler.string_data->len);
+      g_byte_array_append (result, (guint8 *) compiler.string_data->str, compiler.string_data->len);
+      g_byte_array_append (result, compiler.records->data, compiler.records->len);
+
+      bytes = g_byte_array_free_to_bytes (result);
+    }
+
+  g_markup_parse_context_free (context);
+  g_hash_table_unref (compiler.strings);
+  g_string_free (compiler.string_data, TRUE);
+  g_byte_array_unref (compiler.records);
+  g_ptr_array_unref (compiler.element_stack);
+  g_string_free (compiler.fragment, TRUE);
+
+  return bytes;
+}
+
+static inline gboolean
+read_uint32 (const gchar  *data,
+             gsize         length,
+             gsize        *pos,
+             guint32      *value)
+{
+  if (length - *pos < 4)
+    return FALSE;
+
+  memcpy (value, data + *pos, 4);
+  *value = GUINT32_FROM_LE (*value);
+  *pos += 4;
+
+  return TRUE;
+}
+
+static inline gboolean
+read_string (const gchar  *data,
+             gsize         length,
+             gsize        *pos,
+             const gchar **strings,
+             guint32       n_strings,
+             const gchar **value)
+{
+  guint32 index;
+
+  if (!read_uint32 (data, length, pos, &index) || index >= n_strings)
+    return FALSE;
+
+  *value = strings[index];
+
+  return TRUE;
+}
+
+/*
+ * _gtk_builder_replay_precompiled:
+ * @data: precompiled data
+ * @length: the length of @data
+ * @parser: the callbacks to call for the records
+ * @user_data: data to pass to the callbacks
+ * @error: return location for an error
+ *
+ * Calls the callbacks of @parser for the records in @data, in order,
+ * until all records are done or a callback sets an error.
+ *
+ * Returns: %TRUE if all records were replayed
+ */
+gboolean
+_gtk_builder_replay_precompiled (const gchar                  *data,
+                                 gsize                         length,
+                                 const GtkBuilderReplayParser *parser,
+                                 gpointer                      user_data,
+                                 GError                      **error)
+{
+  guint32 version, n_strings, strings_size;
+  const gchar **strings = NULL;
+  GPtrArray *names, *values;
+  GError *tmp_error = NULL;
+  const gchar *p, *end;
+  gsize pos;
+  guint32 i;
+
+  pos = 4;
+  if (!_gtk_builder_is_precompiled (data, length) ||
+      !read_uint32 (data, length, &pos, &version) ||
+      version != PRECOMPILED_VERSION ||
+      !read_uint32 (data, length, &pos, &n_strings) ||
+      !read_uint32 (data, length, &pos, &strings_size) ||
+      strings_size > length - pos ||
+      n_strings > strings_size)
+    goto invalid;
+
+  strings = g_new (const gchar *, n_strings);
+  p = data + pos;
+  end = p + strings_size;
+  for (i = 0; i < n_strings; i++)
+    {
+      const gchar *nul = memchr (p, '\0', end - p);
+
+      if (nul == NULL)
+        goto invalid;
+
+      strings[i] = p;
+      p = nul + 1;
+    }
+  pos += strings_size;
+
+  names = g_ptr_array_new ();
+  values = g_ptr_array_new ();
+
+  while (pos < length && tmp_error == NULL)
+    {
+      const gchar *element_name, *name, *value;
+      guint32 type, line, col, n_attributes;
+
+      if (!read_uint32 (data, length, &pos, &type))
+        break;
+
+      switch (type)
+        {
+        case RECORD_START_ELEMENT:
+          if (!read_string (data, length, &pos, strings, n_strings, &element_name) ||
+              !read_uint32 (data, length, &pos, &line) ||
+              !read_uint32 (data, length, &pos, &col) ||
+              !read_uint32 (data, length, &pos, &n_attributes) ||
+              n_attributes > (length - pos) / 8)
+            goto invalid_records;
+
+          g_ptr_array_set_size (names, 0);
+          g_ptr_array_set_size (values, 0);
+          for (i = 0; i < n_attributes; i++)
+            {
+              if (!read_string (data, length, &pos, strings, n_strings, &name) ||
+                  !read_string (data, length, &pos, strings, n_strings, &value))
+                goto invalid_records;
+
+              g_ptr_array_add (names, (gpointer) name);
+              g_ptr_array_add (values, (gpointer) value);
+            }
+          g_ptr_array_add (names, NULL);
+          g_ptr_array_add (values, NULL);
+
+          parser->start_element (element_name,
+                                 (const gchar **) names->pdata,
+                                 (const gchar **) values->pdata,
+                                 line, col,
+                                 user_data, &tmp_error);
+          break;
+
+        case RECORD_END_ELEMENT:
+          if (!read_string (data, length, &pos, strings, n_strings, &name))
+            goto invalid_records;
+
+          parser->end_element (name, user_data, &tmp_error);
+          break;
+
+        case RECORD_TEXT:
+          if (!read_string (data, length, &pos, strings, n_strings, &value))
+            goto invalid_records;
+
+          parser->text (value, strlen (value), user_data, &tmp_error);
+          break;
+
+        case RECORD_FRAGMENT:
+          if (!read_string (data, length, &pos, strings, n_strings, &name) ||
+              !read_uint32 (data, length, &pos, &line) ||
+              !read_string (data, length, &pos, strings, n_strings, &value))
+            goto invalid_records;
+
+          parser->fragment (name, value, strlen (value), line, user_data, &tmp_error);
+          break;
+
+        default:
+          goto invalid_records;
+        }
+    }
+
+  g_ptr_array_unref (names);
+  g_ptr_array_unref (values);
+  g_free (strings);
+
+  if (tmp_error)
+    {
+      g_propagate_error (error, tmp_error);
+      return FALSE;
+    }
+
+  return TRUE;
+
+invalid_records:
+  g_ptr_array_unref (names);
+  g_ptr_array_unref (values);
+
+invalid:
+  g_free (strings);
+  g_set_error_literal (error,
+                       G_MARKUP_ERROR, G_MARKUP_ERROR_INVALID_CONTENT,
+                       "Invalid precompiled GtkBuilder data");
+
+  return FALSE;
+}
@@ -70,7 +70,7 @@ check_version (CacheInfo *info)
   guint16 major, minor;
 
   check ("major version", get_uint16 (info, 0, &major) && major == 1);
-  check ("minor version", get_uint16 (info, 2, &minor) && minor == 0);
+  check ("minor version", get_uint16 (info, 2, &minor) && minor <= ICON_CACHE_INDEX_MINOR_VERSION);
 
   return TRUE;
 }
@@ -146,6 +146,31 @@ check_directory_list (CacheInfo *info,
   return TRUE;
 }
 
+static gboolean
+check_texture_data (CacheInfo *info,
+                    guint32    offset,
+                    guint32    length)
+{
+  guint32 width, height, stride, format, texel_offset;
+
+  check ("texture data length", length + 8 >= ICON_CACHE_TEXTURE_HEADER_SIZE);
+  check ("offset, texture width", get_uint32 (info, offset + 8, &width));
+  check ("offset, texture height", get_uint32 (info, offset + 12, &height));
+  check ("offset, texture stride", get_uint32 (info, offset + 16, &stride));
+  check ("offset, texture format", get_uint32 (info, offset + 20, &format));
+  check ("offset, texel offset", get_uint32 (info, offset + 24, &texel_offset));
+
+  check ("texture size", width > 0 && height > 0 && width <= G_MAXUINT16 && height <= G_MAXUINT16);
+  check ("texture format", format == ICON_CACHE_TEXTURE_FORMAT_B8G8R8A8_PREMULTIPLIED);
+  check ("texture stride", stride >= width * 4 && stride % 4 == 0);
+  check ("texel offset", texel_offset >= ICON_CACHE_TEXTURE_HEADER_SIZE);
+  check ("texel alignment", (offset + texel_offset) % ICON_CACHE_TEXTURE_ALIGNMENT == 0);
+  check ("texel data", texel_offset <= length + 8 &&
+                       (guint64) stride * height <= length + 8 - texel_offset);
+
+  return TRUE;
+}
+
 static gboolean
 check_pixel_data (CacheInfo *info,
                   guint32    offset)
@@ -156,9 +181,13 @@ check_pixel_data (CacheInfo *info,
   check ("offset, pixel data type", get_uint32 (info, offset, &type));
   check ("offset, pixel data length", get_uint32 (info, offset + 4, &length));
 
-  check ("pixel data type", type == 0);
+  check ("pixel data type", type == ICON_CACHE_PIXEL_DATA_PIXDATA ||
+                             type == ICON_CACHE_PIXEL_DATA_TEXTURE);
   check ("pixel data length", offset + 8 + length < info->cache_size);
 
+  if (type == ICON_CACHE_PIXEL_DATA_TEXTURE)
+    return check_texture_data (info, offset, length);
+
   if (info->flags & CHECK_PIXBUFS)
     {
       GdkPixdata data;
@@ -368,6 +397,38 @@ check_hash (CacheInfo *info,
   return TRUE;
 }
 
+static gboolean
+check_index (CacheInfo *info,
+             guint32    offset)
+{
+  guint32 n_slots, n_words;
+  guint32 hash, icon_offset, name_offset;
+  guint32 i;
+
+  check ("offset, index size", get_uint32 (info, offset, &n_slots));
+  check ("index size", n_slots > 0 && (n_slots & (n_slots - 1)) == 0);
+  check ("offset, index bitmap size", get_uint32 (info, offset + 4, &n_words));
+  check ("index bitmap size", n_words == (info->n_directories + 31) / 32);
+  check ("index end", (guint64) offset + 8 + (guint64) n_slots * (8 + 4 * n_words) <= info->cache_size);
+
+  for (i = 0; i < n_slots; i++)
+    {
+      get_uint32 (info, offset + 8 + 8 * i, &hash);
+      get_uint32 (info, offset + 12 + 8 * i, &icon_offset);
+      if (icon_offset == 0xffffffff)
+        continue;
+
+      check ("offset, index icon name", get_uint32 (info, icon_offset + 4, &name_offset));
+      if (!check_string (info, name_offset))
+        return FALSE;
+      /* Only terminated strings can be hashed safely */
+      if (info->flags & CHECK_STRINGS)
+        check ("index hash", hash == icon_cache_index_hash (info->cache + name_offset));
+    }
+
+  return TRUE;
+}
+
 /**
  * gtk_icon_cache_validate:
  * @info: a CacheInfo structure
@@ -385,11 +446,14 @@ check_hash (CacheInfo *info,
 gboolean
 gtk_icon_cache_validate (CacheInfo *info)
 {
+  guint16 minor;
   guint32 hash_offset;
   guint32 directory_list_offset;
+  guint32 index_offset;
 
   if (!check_version (info))
     return FALSE;
+  get_uint16 (info, 2, &minor);
   check ("header, hash offset", get_uint32 (info, 4, &hash_offset));
   check ("header, directory list offset", get_uint32 (info, 8, &directory_list_offset));
   if (!check_directory_list (info, directory_list_offset))
@@ -398,6 +462,14 @@ gtk_icon_cache_validate (CacheInfo *info)
   if (!check_hash (info, hash_offset))
     return FALSE;
 
+  if (minor >= ICON_CACHE_INDEX_MINOR_VERSION)
+    {
+      check ("header size", hash_offset >= 16);
+      check ("header, index offset", get_uint32 (info, 12, &index_offset));
+      if (!check_index (info, index_offset))
+        return FALSE;
+    }
+
   return TRUE;
 }
 
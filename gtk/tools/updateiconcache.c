@@ -45,7 +45,9 @@ static gboolean force_update = FALSE;
 static gboolean ignore_theme_index = FALSE;
 static gboolean quiet = FALSE;
 static gboolean index_only = TRUE;
+static gboolean texture_data = FALSE;
 static gboolean validate = FALSE;
+static gint n_jobs = 0;
 static gchar *var_name = (gchar *) "-";
 
 #define CACHE_NAME "icon-theme.cache"
@@ -56,8 +58,11 @@ static gchar *var_name = (gchar *) "-";
 #define HAS_ICON_FILE  (1 << 3)
 
 #define MAJOR_VERSION 1
-#define MINOR_VERSION 0
-#define HASH_OFFSET 12
+#define MINOR_VERSION ICON_CACHE_INDEX_MINOR_VERSION
+
+/* Larger images are stored as pixdata, even with --include-texture-data */
+#define MAX_TEXTURE_DATA_SIZE 128
+#define HASH_OFFSET 16
 
 #define ALIGN_VALUE(this, boundary) \
   (( ((unsigned long)(this)) + (((unsigned long)(boundary)) -1)) & (~(((unsigned long)(boundary))-1)))
@@ -160,8 +165,17 @@ typedef struct
 {
   GdkPixdata pixdata;
   gboolean has_pixdata;
+
+  /* Premultiplied texels, used instead of the pixdata */
+  guchar *texels;
+  gint width;
+  gint height;
+  gint stride;
+
   guint32 offset;
   guint size;
+
+  gboolean load_queued;
 } ImageData;
 
 typedef struct
@@ -182,6 +196,17 @@ typedef struct
 static GHashTable *image_data_hash = NULL;
 static GHashTable *icon_data_hash = NULL;
 
+/* Images are loaded after scanning, in threads. Each ImageData is only
+ * touched by one load, so the cache is the same as when loading them
+ * one by one. */
+typedef struct
+{
+  ImageData *idata;
+  gchar *path;
+} ImageLoad;
+
+static GPtrArray *image_loads = NULL;
+
 typedef struct
 {
   int flags;
@@ -457,6 +482,118 @@ follow_links (const gchar *path)
   return path2;
 }
 
+/* Converts the pixbuf to premultiplied BGRA, the format that GdkTextures
+ * use natively, so that they can be made from the mapped cache without
+ * converting anything at runtime.
+ */
+static void
+make_texels (ImageData *idata,
+             GdkPixbuf *pixbuf)
+{
+  const guchar *src_data, *src;
+  guchar *dst;
+  gint n_channels, src_stride;
+  gint x, y;
+
+  idata->width = gdk_pixbuf_get_width (pixbuf);
+  idata->height = gdk_pixbuf_get_height (pixbuf);
+  idata->stride = idata->width * 4;
+  idata->texels = g_malloc (idata->stride * idata->height);
+
+  n_channels = gdk_pixbuf_get_n_channels (pixbuf);
+  src_stride = gdk_pixbuf_get_rowstride (pixbuf);
+  src_data = gdk_pixbuf_read_pixels (pixbuf);
+
+  for (y = 0; y < idata->height; y++)
+    {
+      src = src_data + y * src_stride;
+      dst = idata->texels + y * idata->stride;
+
+      for (x = 0; x < idata->width; x++)
+        {
+          guint a = n_channels == 4 ? src[3] : 255;
+
+          dst[0] = (src[2] * a + 127) / 255;
+          dst[1] = (src[1] * a + 127) / 255;
+          dst[2] = (src[0] * a + 127) / 255;
+          dst[3] = a;
+
+          src += n_channels;
+          dst += 4;
+        }
+    }
+}
+
+static void
+load_image_data (gpointer data,
+                 gpointer user_data)
+{
+  ImageLoad *load = data;
+  ImageData *idata = load->idata;
+  GdkPixbuf *pixbuf;
+
+  pixbuf = gdk_pixbuf_new_from_file (load->path, NULL);
+
+  if (pixbuf)
+    {
+      if (texture_data &&
+          gdk_pixbuf_get_width (pixbuf) <= MAX_TEXTURE_DATA_SIZE &&
+          gdk_pixbuf_get_height (pixbuf) <= MAX_TEXTURE_DATA_SIZE)
+        {
+          make_texels (idata, pixbuf);
+          /* Leave room to align the texels */
+          idata->size = ICON_CACHE_TEXTURE_HEADER_SIZE
+                        + ICON_CACHE_TEXTURE_ALIGNMENT - 4
+                        + idata->stride * idata->height;
+          g_object_unref (pixbuf);
+        }
+      else
+        {
+G_GNUC_BEGIN_IGNORE_DEPRECATIONS;
+          gdk_pixdata_from_pixbuf (&idata->pixdata, pixbuf, FALSE);
+G_GNUC_END_IGNORE_DEPRECATIONS;
+          idata->size = idata->pixdata.length + 8;
+          idata->has_pixdata = TRUE;
+        }
+    }
+
+  g_free (load->path);
+  g_free (load);
+}
+
+/* Loads the images that scanning found */
+static void
+load_queued_image_data (void)
+{
+  GThreadPool *pool;
+  guint i;
+
+  if (image_loads->len == 0)
+    return;
+
+  if (n_jobs <= 0)
+    n_jobs = g_get_num_processors ();
+
+  if (n_jobs == 1)
+    {
+      for (i = 0; i < image_loads->len; i++)
+        load_image_data (g_ptr_array_index (image_loads, i), NULL);
+    }
+  else
+    {
+      pool = g_thread_pool_new (load_image_data, NULL,
+                                MIN ((guint) n_jobs, image_loads->len),
+                                FALSE, NULL);
+      for (i = 0; i < image_loads->len; i++)
+        g_thread_pool_push (pool, g_ptr_array_index (image_loads, i), NULL);
+
+      /* Waits for the loads to finish */
+      g_thread_pool_free (pool, FALSE, TRUE);
+    }
+
+  g_ptr_array_set_size (image_loads, 0);
+}
+
 static void
 maybe_cache_image_data (Image       *image,
 			const gchar *path)
@@ -464,7 +601,6 @@ maybe_cache_image_data (Image       *image,
   if (!index_only && !image->image_data &&
       (g_str_has_suffix (path, ".png") || g_str_has_suffix (path, ".xpm")))
     {
-      GdkPixbuf *pixbuf;
       ImageData *idata;
       gchar *path2;
 
@@ -501,18 +637,15 @@ maybe_cache_image_data (Image       *image,
 	    g_hash_table_insert (image_data_hash, g_strdup (path2), idata);
 	}
 
-      if (!idata->has_pixdata)
+      if (!idata->load_queued)
 	{
-	  pixbuf = gdk_pixbuf_new_from_file (path, NULL);
+	  ImageLoad *load;
 
-	  if (pixbuf)
-	    {
-G_GNUC_BEGIN_IGNORE_DEPRECATIONS;
-	      gdk_pixdata_from_pixbuf (&idata->pixdata, pixbuf, FALSE);
-G_GNUC_END_IGNORE_DEPRECATIONS;
-	      idata->size = idata->pixdata.length + 8;
-	      idata->has_pixdata = TRUE;
-	    }
+	  load = g_new (ImageLoad, 1);
+	  load->idata = idata;
+	  load->path = g_strdup (path);
+	  g_ptr_array_add (image_loads, load);
+	  idata->load_queued = TRUE;
 	}
 
       image->image_data = idata;
@@ -817,6 +950,43 @@ write_card32 (FILE *cache, guint32 n)
 }
 
 
+static gboolean
+write_padding (FILE *cache, int n_bytes)
+{
+  static const char zeros[ICON_CACHE_TEXTURE_ALIGNMENT] = { 0, };
+
+  g_assert (n_bytes < ICON_CACHE_TEXTURE_ALIGNMENT);
+
+  return n_bytes == 0 || fwrite (zeros, n_bytes, 1, cache) == 1;
+}
+
+static gboolean
+write_texture_data (FILE *cache, ImageData *image_data, int offset)
+{
+  int texels_size, padding;
+
+  texels_size = image_data->stride * image_data->height;
+  padding = (ICON_CACHE_TEXTURE_ALIGNMENT
+             - (offset + ICON_CACHE_TEXTURE_HEADER_SIZE) % ICON_CACHE_TEXTURE_ALIGNMENT)
+            % ICON_CACHE_TEXTURE_ALIGNMENT;
+
+  if (!write_card32 (cache, ICON_CACHE_PIXEL_DATA_TEXTURE) ||
+      !write_card32 (cache, image_data->size - 8) ||
+      !write_card32 (cache, image_data->width) ||
+      !write_card32 (cache, image_data->height) ||
+      !write_card32 (cache, image_data->stride) ||
+      !write_card32 (cache, ICON_CACHE_TEXTURE_FORMAT_B8G8R8A8_PREMULTIPLIED) ||
+      !write_card32 (cache, ICON_CACHE_TEXTURE_HEADER_SIZE + padding))
+    return FALSE;
+
+  /* The room for the alignment that isn't used before
+   * the texels goes after them
+   */
+  return write_padding (cache, padding) &&
+         fwrite (image_data->texels, texels_size, 1, cache) == 1 &&
+         write_padding (cache, ICON_CACHE_TEXTURE_ALIGNMENT - 4 - padding);
+}
+
 static gboolean
 write_image_data (FILE *cache, ImageData *image_data, int offset)
 {
@@ -825,8 +995,10 @@ write_image_data (FILE *cache, ImageData *image_data, int offset)
   gint i;
   GdkPixdata *pixdata = &image_data->pixdata;
 
-  /* Type 0 is GdkPixdata */
-  if (!write_card32 (cache, 0))
+  if (image_data->texels)
+    return write_texture_data (cache, image_data, offset);
+
+  if (!write_card32 (cache, ICON_CACHE_PIXEL_DATA_PIXDATA))
     return FALSE;
 
 G_GNUC_BEGIN_IGNORE_DEPRECATIONS;
@@ -962,12 +1134,13 @@ write_icon_data (FILE *cache, IconData *icon_data, int offset)
 }
 
 static gboolean
-write_header (FILE *cache, guint32 dir_list_offset)
+write_header (FILE *cache, guint32 dir_list_offset, guint32 index_offset)
 {
   return (write_card16 (cache, MAJOR_VERSION) &&
 	  write_card16 (cache, MINOR_VERSION) &&
 	  write_card32 (cache, HASH_OFFSET) &&
-	  write_card32 (cache, dir_list_offset));
+	  write_card32 (cache, dir_list_offset) &&
+	  write_card32 (cache, index_offset));
 }
 
 static gint
@@ -1045,7 +1218,7 @@ get_image_pixel_data_size (Image *image)
   if (image->pixel_data_size == 0)
     {
       if (image->image_data &&
-	  image->image_data->has_pixdata)
+	  (image->image_data->has_pixdata || image->image_data->texels))
 	{
 	  image->pixel_data_size = image->image_data->size;
 	  image->image_data->size = 0;
@@ -1370,11 +1543,122 @@ write_dir_index (FILE *cache, int offset, GList *directories)
   return TRUE;
 }
 
+/* See gtkiconcachevalidatorprivate.h for the format of the index */
+static gboolean
+write_icon_index (FILE *cache, HashContext *context, int n_dirs)
+{
+  HashNode *node, **slots;
+  guint32 *hashes, *bits;
+  guint n_icons, n_slots, n_words, mask;
+  guint i, j;
+  GList *l;
+
+  n_icons = 0;
+  for (i = 0; i < context->size; i++)
+    for (node = context->nodes[i]; node; node = node->next)
+      n_icons++;
+
+  /* Keep the load at 3/4 or below */
+  n_slots = 8;
+  while (n_slots * 3 < n_icons * 4)
+    n_slots *= 2;
+  mask = n_slots - 1;
+
+  n_words = (n_dirs + 31) / 32;
+
+  slots = g_new0 (HashNode *, n_slots);
+  hashes = g_new0 (guint32, n_slots);
+
+  for (i = 0; i < context->size; i++)
+    for (node = context->nodes[i]; node; node = node->next)
+      {
+        HashNode *cur = node;
+        guint32 hash = icon_cache_index_hash (node->name);
+        guint32 pos = hash & mask;
+        guint32 dist = 0;
+
+        /* Robin Hood: take the slot of any icon that
+         * is closer to its home slot than we are
+         */
+        while (slots[pos] != NULL)
+          {
+            guint32 slot_dist = (pos - (hashes[pos] & mask)) & mask;
+
+            if (slot_dist < dist)
+              {
+                HashNode *tmp_node = slots[pos];
+                guint32 tmp_hash = hashes[pos];
+
+                slots[pos] = cur;
+                hashes[pos] = hash;
+                cur = tmp_node;
+                hash = tmp_hash;
+                dist = slot_dist;
+              }
+
+            pos = (pos + 1) & mask;
+            dist++;
+          }
+
+        slots[pos] = cur;
+        hashes[pos] = hash;
+      }
+
+  if (!write_card32 (cache, n_slots) ||
+      !write_card32 (cache, n_words))
+    goto fail;
+
+  for (i = 0; i < n_slots; i++)
+    {
+      if (!write_card32 (cache, slots[i] ? hashes[i] : 0) ||
+          !write_card32 (cache, slots[i] ? slots[i]->offset : 0xffffffff))
+        goto fail;
+    }
+
+  bits = g_new (guint32, MAX (n_words, 1));
+  for (i = 0; i < n_slots; i++)
+    {
+      memset (bits, 0, n_words * sizeof (guint32));
+
+      if (slots[i])
+        {
+          for (l = slots[i]->image_list; l; l = l->next)
+            {
+              Image *image = l->data;
+
+              bits[image->dir_index / 32] |= 1u << (image->dir_index % 32);
+            }
+        }
+
+      for (j = 0; j < n_words; j++)
+        {
+          if (!write_card32 (cache, bits[j]))
+            {
+              g_free (bits);
+              goto fail;
+            }
+        }
+    }
+  g_free (bits);
+
+  g_free (slots);
+  g_free (hashes);
+
+  return TRUE;
+
+fail:
+  g_free (slots);
+  g_free (hashes);
+
+  return FALSE;
+}
+
 static gboolean
 write_file (FILE *cache, GHashTable *files, GList *directories)
 {
   HashContext context;
   int new_offset;
+  int index_offset;
 
   /* Convert the hash table into something looking a bit more
    * like what we want to write to disk.
@@ -1385,9 +1669,9 @@ write_file (FILE *cache, GHashTable *files, GList *directories)
   g_hash_table_foreach_remove (files, convert_to_hash, &context);
 
   /* Now write the file */
-  /* We write 0 as the directory list offset and go
-   * back and change it later */
-  if (!write_header (cache, 0))
+  /* We write 0 as the directory list and index offsets
+   * and go back and change them later */
+  if (!write_header (cache, 0, 0))
     {
       g_printerr (_("Failed to write header\n"));
       return FALSE;
@@ -1405,9 +1689,17 @@ write_file (FILE *cache, GHashTable *files, GList *directories)
       return FALSE;
     }
 
+  index_offset = ftell (cache);
+
+  if (!write_icon_index (cache, &context, g_list_length (directories)))
+    {
+      g_printerr (_("Failed to write icon index\n"));
+      return FALSE;
+    }
+
   rewind (cache);
 
-  if (!write_header (cache, new_offset))
+  if (!write_header (cache, new_offset, index_offset))
     {
       g_printerr (_("Failed to rewrite header\n"));
       return FALSE;
@@ -1519,8 +1811,10 @@ opentmp:
   image_data_hash = g_hash_table_new (g_str_hash, g_str_equal);
   icon_data_hash = g_hash_table_new (g_str_hash, g_str_equal);
   string_pool = g_hash_table_new (g_str_hash, g_str_equal);
+  image_loads = g_ptr_array_new ();
 
   directories = scan_directory (path, NULL, files, NULL, 0);
+  load_queued_image_data ();
 
   if (g_hash_table_size (files) == 0)
     {
@@ -1659,9 +1953,11 @@ static GOptionEntry args[] = {
   { "ignore-theme-index", 't', 0, G_OPTION_ARG_NONE, &ignore_theme_index, N_("Don’t check for the existence of index.theme"), NULL },
   { "index-only", 'i', 0, G_OPTION_ARG_NONE, &index_only, N_("Don’t include image data in the cache"), NULL },
   { "include-image-data", 0, G_OPTION_FLAG_REVERSE, G_OPTION_ARG_NONE, &index_only, N_("Include image data in the cache"), NULL },
+  { "include-texture-data", 0, 0, G_OPTION_ARG_NONE, &texture_data, N_("Include image data in the cache, ready for use as textures"), NULL },
   { "source", 'c', 0, G_OPTION_ARG_STRING, &var_name, N_("Output a C header file"), "NAME" },
   { "quiet", 'q', 0, G_OPTION_ARG_NONE, &quiet, N_("Turn off verbose output"), NULL },
   { "validate", 'v', 0, G_OPTION_ARG_NONE, &validate, N_("Validate existing icon cache"), NULL },
+  { "jobs", 'j', 0, G_OPTION_ARG_INT, &n_jobs, N_("Number of threads to load image data with"), "N" },
   { NULL }
 };
 
@@ -1716,6 +2012,9 @@ main (int argc, char **argv)
 
   g_option_context_parse (context, &argc, &argv, NULL);
 
+  if (texture_data)
+    index_only = FALSE;
+
   path = argv[1];
 #ifdef G_OS_WIN32
   path = g_locale_to_utf8 (path, -1, NULL, NULL, NULL);
@@ -0,0 +1,547 @@
+/*
+Creation: 1200,20190410
+Name(s):  Grant Mulholland
+Email(s): grantlmul@gmail.com
+*/
+#include "number.h"
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+
+using namespace std;
+
+typedef vector<uint32_t> Limbs;
+
+static thread_local function<void ()> interrupt_check;
+
+void set_interrupt_check(const function<void ()> &check)
+{
+    interrupt_check = check;
+}
+
+static void check_interrupt()
+{
+    if (interrupt_check)
+        interrupt_check();
+}
+
+static void trim(Limbs &a)
+{
+    while (!a.empty() && a.back() == 0)
+        a.pop_back();
+}
+
+static int compare_abs(const Limbs &a, const Limbs &b)
+{
+    if (a.size() != b.size())
+        return a.size() < b.size() ? -1 : 1;
+    for (size_t i = a.size(); i-- > 0;) {
+        if (a[i] != b[i])
+            return a[i] < b[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+static Limbs add_abs(const Limbs &a, const Limbs &b, uint32_t base)
+{
+    const Limbs &longer = a.size() >= b.size() ? a : b;
+    const Limbs &shorter = a.size() >= b.size() ? b : a;
+    Limbs result(longer.size() + 1);
+    uint32_t carry = 0;
+
+    for (size_t i = 0; i < longer.size(); i++) {
+        uint32_t sum = longer[i] + carry + (i < shorter.size() ? shorter[i] : 0);
+        carry = sum >= base;
+        result[i] = carry ? sum - base : sum;
+    }
+    result[longer.size()] = carry;
+    trim(result);
+    return result;
+}
+
+/* a must not be smaller than b */
+static Limbs sub_abs(const Limbs &a, const Limbs &b, uint32_t base)
+{
+    Limbs result(a.size());
+    uint32_t borrow = 0;
+
+    for (size_t i = 0; i < a.size(); i++) {
+        uint32_t sub = borrow + (i < b.size() ? b[i] : 0);
+        borrow = a[i] < sub;
+        result[i] = borrow ? a[i] + base - sub : a[i] - sub;
+    }
+    trim(result);
+    return result;
+}
+
+static Limbs mul_abs(const Limbs &a, const Limbs &b, uint32_t base)
+{
+    if (a.empty() || b.empty())
+        return Limbs();
+
+    Limbs result(a.size() + b.size());
+    for (size_t i = 0; i < a.size(); i++) {
+        uint64_t carry = 0;
+
+        if ((i & 0xff) == 0xff)
+            check_interrupt();
+        for (size_t j = 0; j < b.size(); j++) {
+            uint64_t cur = result[i + j] + (uint64_t) a[i] * b[j] + carry;
+            result[i + j] = cur % base;
+            carry = cur / base;
+        }
+        result[i + b.size()] = carry;
+    }
+    trim(result);
+    return result;
+}
+
+static Limbs mul_small(const Limbs &a, uint32_t m, uint32_t base)
+{
+    Limbs result(a.size() + 1);
+    uint64_t carry = 0;
+
+    for (size_t i = 0; i < a.size(); i++) {
+        uint64_t cur = (uint64_t) a[i] * m + carry;
+        result[i] = cur % base;
+        carry = cur / base;
+    }
+    result[a.size()] = carry;
+    trim(result);
+    return result;
+}
+
+/* Compares the n limbs of u from i on with b, which has at most n limbs */
+static int compare_window(const Limbs &u, size_t i, size_t n, const Limbs &b)
+{
+    for (size_t k = n; k-- > 0;) {
+        uint32_t bk = k < b.size() ? b[k] : 0;
+        if (u[i + k] != bk)
+            return u[i + k] < bk ? -1 : 1;
+    }
+    return 0;
+}
+
+/* Subtracts b from the n limbs of u from i on, which must not be smaller */
+static void sub_window(Limbs &u, size_t i, size_t n, const Limbs &b, uint32_t base)
+{
+    uint32_t borrow = 0;
+
+    for (size_t k = 0; k < n; k++) {
+        uint32_t sub = borrow + (k < b.size() ? b[k] : 0);
+        borrow = u[i + k] < sub;
+        u[i + k] = borrow ? u[i + k] + base - sub : u[i + k] - sub;
+    }
+}
+
+/* Schoolbook long division, one limb of the quotient at a time.
+   Each limb is estimated from the leading limbs and then corrected.
+   The remainder is kept in place in a copy of a, as the m + 1 limbs
+   that end at the limb that was brought down last. */
+static void divmod_abs(const Limbs &a, const Limbs &b, uint32_t base, Limbs &q, Limbs &r)
+{
+    q.assign(a.size(), 0);
+    r.clear();
+
+    if (b.size() == 1) {
+        uint64_t rem = 0;
+        for (size_t i = a.size(); i-- > 0;) {
+            uint64_t cur = rem * base + a[i];
+            q[i] = cur / b[0];
+            rem = cur % b[0];
+        }
+        if (rem)
+            r.push_back(rem);
+        trim(q);
+        return;
+    }
+
+    if (compare_abs(a, b) < 0) {
+        q.clear();
+        r = a;
+        return;
+    }
+
+    size_t m = b.size();
+    double bv = (double) b[m - 1] * base + b[m - 2];
+    Limbs u(a);
+
+    u.push_back(0);
+    for (size_t i = a.size() - m + 1; i-- > 0;) {
+        if ((i & 0xff) == 0)
+            check_interrupt();
+
+        if (compare_window(u, i, m + 1, b) < 0)
+            continue;
+
+        double rv = ((double) u[i + m] * base + u[i + m - 1]) * base + u[i + m - 2];
+
+        uint64_t qd = (uint64_t) (rv / bv);
+        if (qd >= base)
+            qd = base - 1;
+
+        Limbs prod = mul_small(b, qd, base);
+        while (compare_window(u, i, m + 1, prod) < 0) {
+            qd--;
+            prod = sub_abs(prod, b, base);
+        }
+        sub_window(u, i, m + 1, prod, base);
+        while (compare_window(u, i, m + 1, b) >= 0) {
+            qd++;
+            sub_window(u, i, m + 1, b, base);
+        }
+        q[i] = qd;
+    }
+    trim(q);
+    r.assign(u.begin(), u.begin() + m);
+    trim(r);
+}
+
+BigInt::BigInt() : negative(false)
+{
+}
+
+BigInt::BigInt(long long value) : negative(value < 0)
+{
+    unsigned long long magnitude = value < 0 ? 0ULL - (unsigned long long) value : value;
+
+    while (magnitude) {
+        limbs.push_back(magnitude % BASE);
+        magnitude /= BASE;
+    }
+}
+
+BigInt BigInt::from_digits(const string &digits)
+{
+    BigInt result;
+
+    for (size_t end = digits.size(); end > 0;) {
+        size_t start = end >= 9 ? end - 9 : 0;
+        result.limbs.push_back(strtoul(digits.substr(start, end - start).c_str(), NULL, 10));
+        end = start;
+    }
+    trim(result.limbs);
+    return result;
+}
+
+size_t BigInt::digits() const
+{
+    if (limbs.empty())
+        return 0;
+    return (limbs.size() - 1) * 9 + std::to_string(limbs.back()).size();
+}
+
+double BigInt::log10() const
+{
+    if (limbs.empty())
+        return 0;
+
+    double top = limbs.back();
+    if (limbs.size() > 1)
+        top += (double) limbs[limbs.size() - 2] / BASE;
+    return std::log10(top) + (limbs.size() - 1) * 9.0;
+}
+
+bool BigInt::to_long(long &value) const
+{
+    unsigned long long magnitude = 0;
+
+    if (limbs.size() > 2)
+        return false;
+    for (size_t i = limbs.size(); i-- > 0;)
+        magnitude = magnitude * BASE + limbs[i];
+    if (magnitude > (unsigned long long) 1 << 62)
+        return false;
+
+    value = negative ? -(long long) magnitude : (long long) magnitude;
+    return true;
+}
+
+BigInt BigInt::operator-() const
+{
+    BigInt result(*this);
+
+    if (!result.is_zero())
+        result.negative = !negative;
+    return result;
+}
+
+BigInt BigInt::abs() const
+{
+    BigInt result(*this);
+
+    result.negative = false;
+    return result;
+}
+
+BigInt operator+(const BigInt &a, const BigInt &b)
+{
+    BigInt result;
+
+    if (a.negative == b.negative) {
+        result.limbs = add_abs(a.limbs, b.limbs, BigInt::BASE);
+        result.negative = a.negative;
+    } else if (compare_abs(a.limbs, b.limbs) >= 0) {
+        result.limbs = sub_abs(a.limbs, b.limbs, BigInt::BASE);
+        result.negative = a.negative;
+    } else {
+        result.limbs = sub_abs(b.limbs, a.limbs, BigInt::BASE);
+        result.negative = b.negative;
+    }
+    if (result.is_zero())
+        result.negative = false;
+    return result;
+}
+
+BigInt operator-(const BigInt &a, const BigInt &b)
+{
+    return a + -b;
+}
+
+BigInt operator*(const BigInt &a, const BigInt &b)
+{
+    BigInt result;
+
+    result.limbs = mul_abs(a.limbs, b.limbs, BigInt::BASE);
+    result.negative = !result.is_zero() && a.negative != b.negative;
+    return result;
+}
+
+void BigInt::divmod(const BigInt &a, const BigInt &b, BigInt &quotient, BigInt &remainder)
+{
+    Limbs q, r;
+
+    divmod_abs(a.limbs, b.limbs, BASE, q, r);
+    quotient.limbs = q;
+    quotient.negative = !quotient.is_zero() && a.negative != b.negative;
+    remainder.limbs = r;
+    remainder.negative = !remainder.is_zero() && a.negative;
+}
+
+BigInt BigInt::gcd(BigInt a, BigInt b)
+{
+    a = a.abs();
+    b = b.abs();
+    while (!b.is_zero()) {
+        BigInt q, r;
+
+        check_interrupt();
+        divmod(a, b, q, r);
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+int BigInt::compare(const BigInt &a, const BigInt &b)
+{
+    if (a.negative != b.negative)
+        return a.negative ? -1 : 1;
+    int result = compare_abs(a.limbs, b.limbs);
+    return a.negative ? -result : result;
+}
+
+string BigInt::to_string() const
+{
+    if (is_zero())
+        return "0";
+
+    string result = negative ? "-" : "";
+    result += std::to_string(limbs.back());
+    for (size_t i = limbs.size() - 1; i-- > 0;) {
+        string limb = std::to_string(limbs[i]);
+        result += string(9 - limb.size(), '0') + limb;
+    }
+    return result;
+}
+
+Rational::Rational() : num(0), den(1)
+{
+}
+
+Rational::Rational(const BigInt &numerator, const BigInt &denominator)
+    : num(numerator), den(denominator)
+{
+    normalize();
+}
+
+void Rational::normalize()
+{
+    if (den.is_negative()) {
+        num = -num;
+        den = -den;
+    }
+    if (den.is_one())
+        return;
+
+    BigInt g = BigInt::gcd(num, den);
+    if (!g.is_one() && !g.is_zero()) {
+        BigInt r;
+        BigInt::divmod(num, g, num, r);
+        BigInt::divmod(den, g, den, r);
+    }
+}
+
+bool Rational::parse(const string &text, Rational &value)
+{
+    string digits;
+    size_t i = 0;
+    long fraction_digits = 0;
+    long exponent = 0;
+
+    while (i < text.size() && isdigit((unsigned char) text[i]))
+        digits += text[i++];
+    if (i < text.size() && text[i] == '.') {
+        i++;
+        while (i < text.size() && isdigit((unsigned char) text[i])) {
+            digits += text[i++];
+            fraction_digits++;
+        }
+    }
+    if (digits.empty())
+        return false;
+
+    if (i < text.size() && (text[i] == 'e' || text[i] == 'E')) {
+        bool negative = false;
+        string exponent_digits;
+
+        i++;
+        if (i < text.size() && (text[i] == '+' || text[i] == '-'))
+            negative = text[i++] == '-';
+        while (i < text.size() && isdigit((unsigned char) text[i]))
+            exponent_digits += text[i++];
+        if (exponent_digits.empty() || exponent_digits.size() > 9)
+            return false;
+        exponent = strtol(exponent_digits.c_str(), NULL, 10);
+        if (negative)
+            exponent = -exponent;
+    }
+    if (i != text.size())
+        return false;
+
+    exponent -= fraction_digits;
+    value = Rational(BigInt::from_digits(digits));
+    if (exponent != 0) {
+        Rational scale = Rational(BigInt(10)).pow(exponent);
+        value = value * scale;
+    }
+    return true;
+}
+
+Rational Rational::operator-() const
+{
+    Rational result;
+
+    result.num = -num;
+    result.den = den;
+    return result;
+}
+
+Rational Rational::reciprocal() const
+{
+    return Rational(den, num);
+}
+
+Rational Rational::pow(long exponent) const
+{
+    Rational result;
+    BigInt base_num = num, base_den = den;
+    unsigned long e = exponent < 0 ? 0UL - (unsigned long) exponent : exponent;
+
+    /* Powers of numbers in lowest terms stay in lowest terms */
+    result.num = BigInt(1);
+    result.den = BigInt(1);
+    while (e) {
+        if (e & 1) {
+            result.num = result.num * base_num;
+            result.den = result.den * base_den;
+        }
+        e >>= 1;
+        if (e) {
+            base_num = base_num * base_num;
+            base_den = base_den * base_den;
+        }
+    }
+
+    if (exponent < 0)
+        return result.reciprocal();
+    return result;
+}
+
+static BigInt exact_quotient(const BigInt &a, const BigInt &b)
+{
+    BigInt q, r;
+
+    if (b.is_one())
+        return a;
+    BigInt::divmod(a, b, q, r);
+    return q;
+}
+
+/* Both operands are in lowest terms, so only the common factors of
+   the denominators can be left in the sum, and the gcd that is needed
+   is one with those rather than with the whole result */
+Rational operator+(const Rational &a, const Rational &b)
+{
+    if (a.den.is_one() && b.den.is_one())
+        return Rational(a.num + b.num);
+
+    BigInt g = BigInt::gcd(a.den, b.den);
+    BigInt a_den = exact_quotient(a.den, g);
+    BigInt b_den = exact_quotient(b.den, g);
+    BigInt sum = a.num * b_den + b.num * a_den;
+    Rational result;
+
+    if (sum.is_zero())
+        return result;
+
+    BigInt h = g.is_one() ? g : BigInt::gcd(sum, g);
+    result.num = exact_quotient(sum, h);
+    result.den = a_den * exact_quotient(b.den, h);
+    return result;
+}
+
+/* Likewise, a factor can only cancel between a numerator and the
+   other denominator */
+Rational operator*(const Rational &a, const Rational &b)
+{
+    if (a.den.is_one() && b.den.is_one())
+        return Rational(a.num * b.num);
+    if (a.is_zero() || b.is_zero())
+        return Rational();
+
+    BigInt g = BigInt::gcd(a.num, b.den);
+    BigInt h = BigInt::gcd(b.num, a.den);
+    Rational result;
+
+    result.num = exact_quotient(a.num, g) * exact_quotient(b.num, h);
+    result.den = exact_quotient(a.den, h) * exact_quotient(b.den, g);
+    return result;
+}
+
+string Rational::to_decimal(int max_fraction_digits, bool &exact) const
+{
+    BigInt scale = Rational(BigInt(10)).pow(max_fraction_digits).numerator();
+    BigInt scaled, remainder;
+
+    /* Round half away from zero */
+    BigInt::divmod(num.abs() * scale, den, scaled, remainder);
+    exact = remainder.is_zero();
+    if (BigInt::compare(remainder + remainder, den) >= 0)
+        scaled = scaled + BigInt(1);
+
+    string digits = scaled.to_string();
+    if (digits.size() <= (size_t) max_fraction_digits)
+        digits = string(max_fraction_digits - digits.size() + 1, '0') + digits;
+
+    string integer = digits.substr(0, digits.size() - max_fraction_digits);
+    string fraction = digits.substr(digits.size() - max_fraction_digits);
+    fraction.erase(fraction.find_last_not_of('0') + 1);
+
+    string result = num.is_negative() && !scaled.is_zero() ? "-" : "";
+    result += integer;
+    if (!fraction.empty())
+        result += "." + fraction;
+    return result;
+}
@@ -0,0 +1,107 @@
+/*
+Creation: 1200,20190410
+Name(s):  Grant Mulholland
+Email(s): grantlmul@gmail.com
+*/
+#ifndef GTKALC_NUMBER_H
+#define GTKALC_NUMBER_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/*
+Sets a function for the calling thread that long computations call
+every now and then. It may throw to abandon them, the numbers that
+were being computed are left unchanged then.
+*/
+void set_interrupt_check(const std::function<void ()> &check);
+
+/*
+Arbitrary-precision integers, stored as base 10^9 limbs so that
+printing them in decimal is cheap.
+*/
+class BigInt
+{
+public:
+    BigInt();
+    BigInt(long long value);
+
+    /* digits must only contain '0'-'9' */
+    static BigInt from_digits(const std::string &digits);
+
+    bool is_zero() const { return limbs.empty(); }
+    bool is_negative() const { return negative; }
+    bool is_one() const { return !negative && limbs.size() == 1 && limbs[0] == 1; }
+
+    /* Number of decimal digits */
+    size_t digits() const;
+    /* Of the absolute value, approximately; 0 for zero */
+    double log10() const;
+
+    /* Whether the value fits, and stores it in value */
+    bool to_long(long &value) const;
+
+    BigInt operator-() const;
+    BigInt abs() const;
+
+    friend BigInt operator+(const BigInt &a, const BigInt &b);
+    friend BigInt operator-(const BigInt &a, const BigInt &b);
+    friend BigInt operator*(const BigInt &a, const BigInt &b);
+
+    /* Truncating division, like C: the remainder has the sign of a */
+    static void divmod(const BigInt &a, const BigInt &b, BigInt &quotient, BigInt &remainder);
+    static BigInt gcd(BigInt a, BigInt b);
+    static int compare(const BigInt &a, const BigInt &b);
+
+    std::string to_string() const;
+
+private:
+    static const uint32_t BASE = 1000000000;
+
+    bool negative;
+    std::vector<uint32_t> limbs; /* least significant first, no leading zeros */
+};
+
+/*
+Exact fractions of BigInts, always in lowest terms with a positive
+denominator. Every operation is exact, so sums and products can be
+regrouped without changing the result.
+*/
+class Rational
+{
+public:
+    Rational();
+    Rational(const BigInt &numerator, const BigInt &denominator = BigInt(1));
+
+    /* Parses a number like "12", "1.5" or "2.5e-3" exactly */
+    static bool parse(const std::string &text, Rational &value);
+
+    const BigInt &numerator() const { return num; }
+    const BigInt &denominator() const { return den; }
+
+    bool is_zero() const { return num.is_zero(); }
+    bool is_integer() const { return den.is_one(); }
+    size_t digits() const { return num.digits() + den.digits(); }
+
+    Rational operator-() const;
+    /* Must not be zero */
+    Rational reciprocal() const;
+    Rational pow(long exponent) const;
+
+    friend Rational operator+(const Rational &a, const Rational &b);
+    friend Rational operator*(const Rational &a, const Rational &b);
+
+    /* At most max_fraction_digits after the point, rounded to nearest.
+       exact is set to whether nothing was rounded off. */
+    std::string to_decimal(int max_fraction_digits, bool &exact) const;
+
+private:
+    BigInt num;
+    BigInt den;
+
+    void normalize();
+};
+
+#endif
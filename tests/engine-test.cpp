@@ -0,0 +1,164 @@
+/*
+Creation: 1200,20190410
+Name(s):  Grant Mulholland
+Email(s): grantlmul@gmail.com
+*/
+#include "engine.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <glib.h>
+
+using namespace std;
+
+static int failures;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            failures++; \
+        } \
+    } while (0)
+
+struct Collector
+{
+    vector<Result> results;
+    GMainLoop *loop;
+    unsigned long waiting_for;
+};
+
+static void collect(Collector *collector, const Result &result)
+{
+    collector->results.push_back(result);
+    if (result.generation == collector->waiting_for)
+        g_main_loop_quit(collector->loop);
+}
+
+static gboolean timeout(gpointer data)
+{
+    g_main_loop_quit(static_cast<GMainLoop *>(data));
+    return G_SOURCE_REMOVE;
+}
+
+/* Runs the main loop until the result for generation arrives, or for
+   a while longer after it, to see that nothing else does */
+static void wait_for(Collector &collector, unsigned long generation, guint extra_ms = 0)
+{
+    guint id;
+
+    collector.waiting_for = generation;
+    id = g_timeout_add_seconds(30, timeout, collector.loop);
+    g_main_loop_run(collector.loop);
+    g_source_remove(id);
+
+    if (extra_ms) {
+        g_timeout_add(extra_ms, timeout, collector.loop);
+        g_main_loop_run(collector.loop);
+    }
+}
+
+static Result evaluate(Engine &engine, Collector &collector, const string &text)
+{
+    collector.results.clear();
+    wait_for(collector, engine.set_expression(text));
+    CHECK(collector.results.size() == 1);
+    return collector.results.empty() ? Result() : collector.results.back();
+}
+
+static void test_results(Engine &engine, Collector &collector)
+{
+    Result result;
+
+    result = evaluate(engine, collector, "1 + 2 * 3");
+    CHECK(result.ok && result.text == "7" && result.exact);
+
+    result = evaluate(engine, collector, "1/3");
+    CHECK(result.ok && result.text == "0.33333" && !result.exact);
+
+    result = evaluate(engine, collector, "-2^2");
+    CHECK(result.ok && result.text == "-4");
+
+    result = evaluate(engine, collector, "2^-1");
+    CHECK(result.ok && result.text == "0.5" && result.exact);
+
+    result = evaluate(engine, collector, "");
+    CHECK(!result.ok && result.text.empty());
+
+    result = evaluate(engine, collector, "(1 + 2");
+    CHECK(!result.ok && result.text == "Missing )");
+
+    result = evaluate(engine, collector, "1 + 2)");
+    CHECK(!result.ok && result.text == "Missing (");
+
+    result = evaluate(engine, collector, "1 +");
+    CHECK(!result.ok && result.text == "Expression is incomplete");
+
+    result = evaluate(engine, collector, "2e");
+    CHECK(!result.ok && result.text == "Syntax error");
+
+    result = evaluate(engine, collector, "1/(2 - 2)");
+    CHECK(!result.ok && result.text == "Division by zero");
+
+    result = evaluate(engine, collector, "2^0.5");
+    CHECK(!result.ok && result.text == "Exponent must be an integer");
+}
+
+/* Only the last of several expressions set in a row gets a result,
+   and an evaluation that is still running is abandoned for it */
+static void test_generations(Engine &engine, Collector &collector)
+{
+    string slow = "1";
+    unsigned long first, last;
+
+    for (int i = 2; i <= 20000; i++)
+        slow += " + 1/" + to_string(i);
+
+    collector.results.clear();
+    first = engine.set_expression(slow);
+    engine.set_expression("1 + 1");
+    last = engine.set_expression("2 + 2");
+    CHECK(last > first);
+
+    wait_for(collector, last, 200);
+    CHECK(collector.results.size() == 1);
+    CHECK(!collector.results.empty() && collector.results.back().generation == last);
+    CHECK(!collector.results.empty() && collector.results.back().text == "4");
+
+    /* Replaced while it runs */
+    collector.results.clear();
+    first = engine.set_expression(slow);
+    g_usleep(G_USEC_PER_SEC / 20);
+    last = engine.set_expression("3");
+    wait_for(collector, last, 200);
+    CHECK(collector.results.size() == 1);
+    CHECK(!collector.results.empty() && collector.results.back().generation == last);
+}
+
+int main()
+{
+    Collector collector;
+
+    collector.loop = g_main_loop_new(NULL, FALSE);
+    collector.waiting_for = 0;
+
+    {
+        Engine engine([&collector](const Result &result) { collect(&collector, result); }, 5);
+
+        test_results(engine, collector);
+        test_generations(engine, collector);
+
+        /* Destroying the engine stops the slow evaluation */
+        engine.set_expression("2^99999 * 3^99999 + 1/7");
+    }
+
+    g_main_loop_unref(collector.loop);
+
+    if (failures) {
+        fprintf(stderr, "%d checks failed\n", failures);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,214 @@
+/*
+Creation: 1200,20190410
+Name(s):  Grant Mulholland
+Email(s): grantlmul@gmail.com
+*/
+#include "number.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using namespace std;
+
+static int failures;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            failures++; \
+        } \
+    } while (0)
+
+static BigInt big(const char *digits)
+{
+    if (digits[0] == '-')
+        return -BigInt::from_digits(digits + 1);
+    return BigInt::from_digits(digits);
+}
+
+static void check_divmod(const BigInt &a, const BigInt &b)
+{
+    BigInt q, r;
+
+    BigInt::divmod(a, b, q, r);
+    CHECK(BigInt::compare(q * b + r, a) == 0);
+    CHECK(BigInt::compare(r.abs(), b.abs()) < 0);
+    CHECK(r.is_zero() || r.is_negative() == a.is_negative());
+}
+
+static void test_divmod()
+{
+    BigInt q, r;
+
+    /* Truncating, the remainder has the sign of the dividend */
+    BigInt::divmod(BigInt(7), BigInt(2), q, r);
+    CHECK(q.to_string() == "3" && r.to_string() == "1");
+    BigInt::divmod(BigInt(-7), BigInt(2), q, r);
+    CHECK(q.to_string() == "-3" && r.to_string() == "-1");
+    BigInt::divmod(BigInt(7), BigInt(-2), q, r);
+    CHECK(q.to_string() == "-3" && r.to_string() == "1");
+    BigInt::divmod(BigInt(-7), BigInt(-2), q, r);
+    CHECK(q.to_string() == "3" && r.to_string() == "-1");
+
+    /* Dividend smaller than a multi-limb divisor */
+    BigInt::divmod(big("123"), big("1000000000000000000000"), q, r);
+    CHECK(q.is_zero() && r.to_string() == "123");
+
+    /* Multi-limb divisors, including quotient limbs that need correcting */
+    BigInt::divmod(big("1000000000000000000000000000000000000"), big("999999999999999999"), q, r);
+    CHECK(q.to_string() == "1000000000000000001" && r.to_string() == "1");
+
+    check_divmod(big("340282366920938463463374607431768211456"), big("18446744073709551616"));
+    check_divmod(big("-340282366920938463463374607431768211457"), big("18446744073709551615"));
+    check_divmod(big("999999999999999999999999999999999999999999999"), big("999999999000000000"));
+    check_divmod(big("100000000000000000000000000000000000000000000"), big("100000000000000000000000001"));
+
+    /* Pseudo-random operands of many sizes */
+    unsigned long long seed = 1;
+    for (int i = 0; i < 200; i++) {
+        string a_digits, b_digits;
+
+        for (int j = 0; j < 1 + i % 60; j++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            a_digits += to_string(seed >> 40);
+        }
+        for (int j = 0; j < 1 + i % 23; j++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            b_digits += to_string(seed >> 44);
+        }
+        BigInt a = BigInt::from_digits(a_digits);
+        BigInt b = BigInt::from_digits(b_digits);
+        if (b.is_zero())
+            continue;
+
+        check_divmod(a, b);
+        check_divmod(-a, b);
+        check_divmod(a * b + b - BigInt(1), b);
+        check_divmod(a * b, b);
+    }
+}
+
+static void test_gcd()
+{
+    CHECK(BigInt::gcd(BigInt(12), BigInt(18)).to_string() == "6");
+    CHECK(BigInt::gcd(BigInt(-12), BigInt(18)).to_string() == "6");
+    CHECK(BigInt::gcd(BigInt(0), BigInt(5)).to_string() == "5");
+    CHECK(BigInt::gcd(big("1000000000000000000000"), big("1000000000000000000001")).is_one());
+}
+
+static string decimal(const Rational &value, int digits, bool &exact)
+{
+    return value.to_decimal(digits, exact);
+}
+
+static void test_to_decimal()
+{
+    bool exact;
+
+    CHECK(decimal(Rational(BigInt(2), BigInt(3)), 3, exact) == "0.667" && !exact);
+    CHECK(decimal(Rational(BigInt(-2), BigInt(3)), 3, exact) == "-0.667" && !exact);
+    CHECK(decimal(Rational(BigInt(1), BigInt(3)), 3, exact) == "0.333" && !exact);
+
+    /* Halves round away from zero */
+    CHECK(decimal(Rational(BigInt(1), BigInt(8)), 2, exact) == "0.13" && !exact);
+    CHECK(decimal(Rational(BigInt(-1), BigInt(8)), 2, exact) == "-0.13" && !exact);
+    CHECK(decimal(Rational(BigInt(5), BigInt(2)), 0, exact) == "3" && !exact);
+    CHECK(decimal(Rational(BigInt(-5), BigInt(2)), 0, exact) == "-3" && !exact);
+
+    /* Rounding up carries into the integer part */
+    CHECK(decimal(Rational(BigInt(1999), BigInt(1000)), 2, exact) == "2" && !exact);
+
+    /* Nothing that rounds to zero gets a sign */
+    CHECK(decimal(Rational(BigInt(-1), BigInt(1000)), 2, exact) == "0" && !exact);
+
+    CHECK(decimal(Rational(BigInt(1), BigInt(4)), 5, exact) == "0.25" && exact);
+    CHECK(decimal(Rational(BigInt(-3)), 5, exact) == "-3" && exact);
+    CHECK(decimal(Rational(), 5, exact) == "0" && exact);
+}
+
+static void test_parse()
+{
+    Rational value;
+    bool exact;
+
+    CHECK(Rational::parse("12", value) && decimal(value, 5, exact) == "12");
+    CHECK(Rational::parse("1.5", value) && decimal(value, 5, exact) == "1.5");
+    CHECK(Rational::parse(".5", value) && decimal(value, 5, exact) == "0.5");
+    CHECK(Rational::parse("5.", value) && decimal(value, 5, exact) == "5");
+    CHECK(Rational::parse("2.5e-3", value) && decimal(value, 5, exact) == "0.0025");
+    CHECK(Rational::parse("1E3", value) && value.is_integer() && decimal(value, 5, exact) == "1000");
+    CHECK(Rational::parse("1e+2", value) && decimal(value, 5, exact) == "100");
+
+    CHECK(!Rational::parse("", value));
+    CHECK(!Rational::parse(".", value));
+    CHECK(!Rational::parse("e5", value));
+    CHECK(!Rational::parse("1e", value));
+    CHECK(!Rational::parse("1e+", value));
+    CHECK(!Rational::parse("1.2.3", value));
+    CHECK(!Rational::parse("12a", value));
+    CHECK(!Rational::parse("-1", value));
+    CHECK(!Rational::parse("1e1234567890", value));
+}
+
+static void test_arithmetic()
+{
+    Rational sum;
+    bool exact;
+
+    for (int i = 1; i <= 10; i++)
+        sum = sum + Rational(BigInt(1), BigInt(i));
+    CHECK(sum.numerator().to_string() == "7381" && sum.denominator().to_string() == "2520");
+
+    Rational third(BigInt(1), BigInt(3));
+    CHECK((third + -third).is_zero() && (third + -third).denominator().is_one());
+    CHECK(decimal(third * Rational(BigInt(3)), 5, exact) == "1" && (third * Rational(BigInt(3))).is_integer());
+    CHECK(decimal(Rational(BigInt(-2), BigInt(9)) * Rational(BigInt(3), BigInt(-4)), 5, exact) == "0.16667");
+    CHECK((Rational(BigInt(-2), BigInt(9)) * Rational(BigInt(3), BigInt(-4))).denominator().to_string() == "6");
+    CHECK((Rational(BigInt(5), BigInt(6)) + Rational(BigInt(1), BigInt(6))).is_integer());
+    CHECK(Rational(BigInt(2), BigInt(3)).pow(-2).numerator().to_string() == "9");
+}
+
+/* Throws from inside a long gcd */
+struct Interrupted
+{
+};
+
+static void test_interrupt()
+{
+    BigInt a = Rational(BigInt(3)).pow(20000).numerator();
+    BigInt b = Rational(BigInt(2)).pow(30000).numerator();
+    int calls = 0;
+    bool interrupted = false;
+
+    set_interrupt_check([&calls] {
+        if (++calls == 10)
+            throw Interrupted();
+    });
+    try {
+        BigInt::gcd(a, b);
+    } catch (const Interrupted &) {
+        interrupted = true;
+    }
+    set_interrupt_check(nullptr);
+
+    CHECK(interrupted);
+    CHECK(BigInt::gcd(a, b).is_one());
+}
+
+int main()
+{
+    test_divmod();
+    test_gcd();
+    test_to_decimal();
+    test_parse();
+    test_arithmetic();
+    test_interrupt();
+
+    if (failures) {
+        fprintf(stderr, "%d checks failed\n", failures);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}